@@ -0,0 +1,226 @@
+#include "access_patterns.h"
+#include "errors.h"
+
+#include <algorithm>
+#include <cmath>
+#include <random>
+#include <sstream>
+
+namespace AccessPatterns {
+
+namespace {
+
+// Prime above MAX_INDEXED_ELEMENTS: multiplying by it permutes any smaller element count
+constexpr uint64_t RANK_SCATTER_PRIME = 2147483647ULL;
+constexpr double MAX_ZIPF_EXPONENT = 4.0;
+
+bool parse_size(const std::string& str, size_t& value) {
+    if (str.empty() || str[0] == '-' || str[0] == '+') {
+        return false;
+    }
+    try {
+        size_t parsed = 0;
+        value = std::stoul(str, &parsed);
+        return parsed == str.size();
+    } catch (const std::exception&) {
+        return false;
+    }
+}
+
+/**
+ * @brief Zipf rank in [1, n] by inverting the continuous rank-frequency CDF
+ *
+ * Exact sampling needs the generalized harmonic numbers of n, which is too
+ * slow for billions of elements; the continuous approximation keeps the
+ * head of the distribution within a few percent and is O(1) per draw.
+ */
+uint64_t zipf_rank(double u, double n, double exponent) {
+    double x;
+    if (std::fabs(exponent - 1.0) < 1e-9) {
+        x = std::exp(u * std::log(n));
+    } else {
+        double a = 1.0 - exponent;
+        x = std::pow(1.0 + u * (std::pow(n, a) - 1.0), 1.0 / a);
+    }
+    uint64_t rank = static_cast<uint64_t>(x);
+    return std::clamp<uint64_t>(rank, 1, static_cast<uint64_t>(n));
+}
+
+}  // namespace
+
+size_t parse_element_size(const std::string& str) {
+    size_t bytes = 0;
+    if (!parse_size(str, bytes) || (bytes != 4 && bytes != 8 && bytes != 64)) {
+        throw ArgumentError("Invalid element size '" + str + "'. Valid element sizes: 4, 8, 64");
+    }
+    return bytes;
+}
+
+size_t parse_stride(const std::string& str, size_t element_bytes) {
+    size_t stride = 0;
+    if (!parse_size(str, stride) || stride < element_bytes || stride > MAX_STRIDE_BYTES ||
+        stride % element_bytes != 0) {
+        throw ArgumentError("Invalid stride '" + str + "'. Stride must be a multiple of the " +
+                            std::to_string(element_bytes) + "-byte element size, at most " +
+                            std::to_string(MAX_STRIDE_BYTES) + " bytes");
+    }
+    return stride;
+}
+
+void parse_distribution(const std::string& str, AccessConfig& config) {
+    if (str == "uniform") {
+        config.distribution = Distribution::UNIFORM;
+        return;
+    }
+    if (str == "page") {
+        config.distribution = Distribution::PAGE_LOCAL;
+        return;
+    }
+    if (str == "zipf") {
+        config.distribution = Distribution::ZIPF;
+        return;
+    }
+
+    const std::string zipf_prefix = "zipf:";
+    if (str.rfind(zipf_prefix, 0) == 0) {
+        std::string value = str.substr(zipf_prefix.size());
+        double exponent = 0.0;
+        try {
+            size_t parsed = 0;
+            exponent = std::stod(value, &parsed);
+            if (parsed != value.size()) {
+                exponent = 0.0;
+            }
+        } catch (const std::exception&) {
+            exponent = 0.0;
+        }
+        if (!(exponent > 0.0 && exponent <= MAX_ZIPF_EXPONENT)) {
+            throw ArgumentError("Invalid Zipf exponent '" + value + "'. Exponent must be in (0, 4]");
+        }
+        config.distribution = Distribution::ZIPF;
+        config.zipf_exponent = exponent;
+        return;
+    }
+
+    throw ArgumentError("Invalid index distribution '" + str + "'. Valid distributions: uniform, zipf[:S], page");
+}
+
+std::string distribution_to_string(const AccessConfig& config) {
+    switch (config.distribution) {
+        case Distribution::UNIFORM:
+            return "uniform";
+        case Distribution::ZIPF: {
+            std::ostringstream oss;
+            oss << "zipf:" << config.zipf_exponent;
+            return oss.str();
+        }
+        case Distribution::PAGE_LOCAL:
+            return "page";
+    }
+    return "uniform";
+}
+
+std::vector<uint32_t> build_indices(size_t elements, size_t count, const AccessConfig& config, uint64_t seed) {
+    elements = std::min(elements, MAX_INDEXED_ELEMENTS);
+    std::vector<uint32_t> indices;
+    if (elements == 0) {
+        return indices;
+    }
+    indices.reserve(count);
+    std::mt19937_64 gen(seed);
+
+    switch (config.distribution) {
+        case Distribution::UNIFORM: {
+            std::uniform_int_distribution<uint32_t> pick(0, static_cast<uint32_t>(elements - 1));
+            for (size_t i = 0; i < count; ++i) {
+                indices.push_back(pick(gen));
+            }
+            break;
+        }
+
+        case Distribution::ZIPF: {
+            // Rank 1 is the hottest key; scattering ranks keeps hot keys off adjacent lines
+            std::uniform_real_distribution<double> unit(0.0, 1.0);
+            double n = static_cast<double>(elements);
+            for (size_t i = 0; i < count; ++i) {
+                uint64_t rank = zipf_rank(unit(gen), n, config.zipf_exponent);
+                indices.push_back(static_cast<uint32_t>(((rank - 1) * RANK_SCATTER_PRIME) % elements));
+            }
+            break;
+        }
+
+        case Distribution::PAGE_LOCAL: {
+            const size_t elements_per_page = std::max<size_t>(1, PAGE_BYTES / config.element_bytes);
+            const size_t accesses_per_page = PAGE_BYTES / LINE_BYTES;
+            size_t page_count = (elements + elements_per_page - 1) / elements_per_page;
+
+            std::vector<size_t> pages(page_count);
+            for (size_t p = 0; p < page_count; ++p) {
+                pages[p] = p;
+            }
+            std::shuffle(pages.begin(), pages.end(), gen);
+
+            for (size_t i = 0; i < count; ++i) {
+                size_t first = pages[(i / accesses_per_page) % page_count] * elements_per_page;
+                size_t in_page = std::min(elements_per_page, elements - first);
+                std::uniform_int_distribution<size_t> pick(0, in_page - 1);
+                indices.push_back(static_cast<uint32_t>(first + pick(gen)));
+            }
+            break;
+        }
+    }
+    return indices;
+}
+
+LineTraffic count_traffic(const std::vector<uint32_t>& indices, size_t element_bytes) {
+    LineTraffic traffic;
+    if (indices.empty() || element_bytes == 0) {
+        return traffic;
+    }
+    size_t lines_per_element = (element_bytes + LINE_BYTES - 1) / LINE_BYTES;
+    size_t highest = *std::max_element(indices.begin(), indices.end());
+    std::vector<bool> element_seen(highest + 1, false);
+    std::vector<bool> line_seen(((highest + 1) * element_bytes + LINE_BYTES - 1) / LINE_BYTES, false);
+
+    for (uint32_t index : indices) {
+        if (element_seen[index]) {
+            continue;
+        }
+        element_seen[index] = true;
+        traffic.used_bytes += element_bytes;
+        size_t first = static_cast<size_t>(index) * element_bytes / LINE_BYTES;
+        for (size_t line = first; line < first + lines_per_element; ++line) {
+            if (!line_seen[line]) {
+                line_seen[line] = true;
+                traffic.line_bytes += LINE_BYTES;
+            }
+        }
+    }
+    return traffic;
+}
+
+size_t strided_accesses(size_t range_bytes, size_t stride_bytes, size_t element_bytes) {
+    if (stride_bytes == 0 || range_bytes < element_bytes) {
+        return 0;
+    }
+    return (range_bytes - element_bytes) / stride_bytes + 1;
+}
+
+LineTraffic strided_traffic(size_t range_bytes, size_t stride_bytes, size_t element_bytes) {
+    LineTraffic traffic;
+    size_t accesses = strided_accesses(range_bytes, stride_bytes, element_bytes);
+    if (accesses == 0) {
+        return traffic;
+    }
+    traffic.used_bytes = accesses * element_bytes;
+    if (stride_bytes >= LINE_BYTES) {
+        // Aligned elements of at most a line never straddle two lines
+        traffic.line_bytes = accesses * LINE_BYTES;
+    } else {
+        size_t span = (accesses - 1) * stride_bytes + element_bytes;
+        traffic.line_bytes = (span + LINE_BYTES - 1) / LINE_BYTES * LINE_BYTES;
+    }
+    return traffic;
+}
+
+}  // namespace AccessPatterns
@@ -0,0 +1,126 @@
+#ifndef ACCESS_PATTERNS_H
+#define ACCESS_PATTERNS_H
+
+#include <cstddef>
+#include <cstdint>
+#include <string>
+#include <vector>
+
+/**
+ * @brief Strided and index-driven (gather/scatter) access layouts
+ *
+ * Hash joins and embedding lookups read 4 to 64 bytes out of each cache
+ * line they touch, often from skewed key distributions. These helpers
+ * describe such layouts - element size, stride, index distribution - and
+ * build the index lists the gather and scatter kernels walk, so results can
+ * report the bytes the program used next to the lines the memory system
+ * had to move.
+ */
+namespace AccessPatterns {
+
+/**
+ * @brief How gather/scatter indices are drawn over the working set
+ */
+enum class Distribution {
+    UNIFORM,     ///< Every element equally likely
+    ZIPF,        ///< Rank-frequency power law (hot keys), ranks scattered over the working set
+    PAGE_LOCAL   ///< 64 random elements within each 4 KB page, pages in random order
+};
+
+/**
+ * @brief Sparse access layout selected on the command line
+ */
+struct AccessConfig {
+    size_t element_bytes = 8;                    ///< Bytes used per access (4, 8 or 64)
+    size_t stride_bytes = 64;                    ///< Distance between strided accesses
+    Distribution distribution = Distribution::UNIFORM;  ///< Index distribution of gather/scatter
+    double zipf_exponent = 0.99;                 ///< Skew of the ZIPF distribution
+};
+
+/// Cache line size used to count the lines an access pattern pulls in
+constexpr size_t LINE_BYTES = 64;
+/// Page size the PAGE_LOCAL distribution keeps its accesses within
+constexpr size_t PAGE_BYTES = 4096;
+/// Largest --stride accepted
+constexpr size_t MAX_STRIDE_BYTES = 4096;
+/// Indices stay below this so they are valid signed 32-bit gather offsets
+constexpr size_t MAX_INDEXED_ELEMENTS = 0x7FFFFFFE;
+/// Index list length cap of one gather/scatter pass (64 MB of indices)
+constexpr size_t MAX_INDICES_PER_PASS = size_t{1} << 24;
+
+/**
+ * @brief Parse an element size: 4, 8 or 64 bytes
+ * @throws ArgumentError for any other value
+ */
+size_t parse_element_size(const std::string& str);
+
+/**
+ * @brief Parse a stride in bytes for the given element size
+ *
+ * The stride must be a multiple of the element size, so accesses stay
+ * aligned, and at most MAX_STRIDE_BYTES.
+ *
+ * @throws ArgumentError if the stride is malformed or out of range
+ */
+size_t parse_stride(const std::string& str, size_t element_bytes);
+
+/**
+ * @brief Parse an index distribution into a configuration
+ *
+ * Accepts "uniform", "page", "zipf" or "zipf:S" with an exponent S in (0, 4].
+ *
+ * @throws ArgumentError if the distribution is unknown or S is invalid
+ */
+void parse_distribution(const std::string& str, AccessConfig& config);
+
+/**
+ * @brief Command-line form of the index distribution ("uniform", "zipf:0.99", "page")
+ */
+std::string distribution_to_string(const AccessConfig& config);
+
+/**
+ * @brief Build an index list over a working set
+ *
+ * @param elements Number of elements in the working set (capped at MAX_INDEXED_ELEMENTS)
+ * @param count Number of indices to draw
+ * @param config Element size and distribution
+ * @param seed Seed for the generator (same seed, same indices)
+ * @return Element indices, each below the (capped) element count
+ */
+std::vector<uint32_t> build_indices(size_t elements, size_t count, const AccessConfig& config, uint64_t seed);
+
+/**
+ * @brief Distinct bytes one pass of an access pattern touches, at line and element granularity
+ *
+ * Repeated accesses are counted once, so used_bytes / line_bytes is the
+ * fraction of every line pulled in that the program actually reads.
+ */
+struct LineTraffic {
+    size_t line_bytes = 0;  ///< Bytes of the distinct cache lines touched
+    size_t used_bytes = 0;  ///< Bytes of the distinct elements accessed within them
+
+    LineTraffic& operator+=(const LineTraffic& other) {
+        line_bytes += other.line_bytes;
+        used_bytes += other.used_bytes;
+        return *this;
+    }
+};
+
+/**
+ * @brief Distinct line and element bytes an index list touches
+ */
+LineTraffic count_traffic(const std::vector<uint32_t>& indices, size_t element_bytes);
+
+/**
+ * @brief Number of accesses a strided pass over a range performs
+ */
+size_t strided_accesses(size_t range_bytes, size_t stride_bytes, size_t element_bytes);
+
+/**
+ * @brief Distinct line and element bytes a strided pass over a range touches
+ */
+LineTraffic strided_traffic(size_t range_bytes, size_t stride_bytes, size_t element_bytes);
+
+}  // namespace AccessPatterns
+
+#endif  // ACCESS_PATTERNS_H
@@ -1,9 +1,10 @@
 #include "aligned_buffer.h"
 #include "errors.h"
-#include <new>
 #include <cstdint>
+#include <cstring>
+#include <utility>
 
-AlignedBuffer::AlignedBuffer(size_t size, size_t alignment) 
+AlignedBuffer::AlignedBuffer(size_t size, size_t alignment, PageMode page_mode, bool initialize) 
     : aligned_ptr_(nullptr), size_(size), alignment_(alignment) {
     
     if (size == 0) {
@@ -14,24 +15,51 @@ AlignedBuffer::AlignedBuffer(size_t size, size_t alignment)
         throw MemoryError("Alignment must be a power of 2");
     }
     
-    // Allocate extra space to ensure we can achieve alignment
     // Check for overflow before allocation
     if (size > SIZE_MAX - alignment) {
         throw MemoryError("Buffer size would cause overflow");
     }
-    size_t total_size = size + alignment;
-    raw_buffer_ = std::make_unique<uint8_t[]>(total_size);
     
-    calculate_aligned_pointer();
-    initialize_pattern();
+    // The heap backend over-allocates and rounds up to the alignment; mmap
+    // backends are page aligned, which covers any cache line alignment
+    allocation_ = PageAllocator::allocate(size, alignment, page_mode);
+    aligned_ptr_ = static_cast<uint8_t*>(allocation_.usable);
+    
+    // Fresh heap blocks and mappings are not zeroed here: the pattern write
+    // is the first touch, so each page is faulted in exactly once
+    if (initialize) {
+        initialize_pattern();
+    }
+}
+
+AlignedBuffer::AlignedBuffer(size_t size, size_t alignment, const FileOptions& file, bool initialize)
+    : aligned_ptr_(nullptr), size_(size), alignment_(alignment), file_options_(file) {
+
+    if (!is_power_of_two(alignment)) {
+        throw MemoryError("Alignment must be a power of 2");
+    }
+
+    // File mappings are page aligned, which covers any cache line alignment
+    allocation_ = PageAllocator::allocate_file(size, file);
+    aligned_ptr_ = static_cast<uint8_t*>(allocation_.usable);
+
+    if (initialize) {
+        initialize_pattern();
+    }
+}
+
+AlignedBuffer::~AlignedBuffer() {
+    PageAllocator::release(allocation_);
 }
 
 AlignedBuffer::AlignedBuffer(AlignedBuffer&& other) noexcept
-    : raw_buffer_(std::move(other.raw_buffer_))
+    : allocation_(other.allocation_)
     , aligned_ptr_(other.aligned_ptr_)
     , size_(other.size_)
-    , alignment_(other.alignment_) {
+    , alignment_(other.alignment_)
+    , file_options_(std::move(other.file_options_)) {
     
+    other.allocation_ = PageAllocator::Allocation();
     other.aligned_ptr_ = nullptr;
     other.size_ = 0;
     other.alignment_ = 0;
@@ -39,11 +67,14 @@ AlignedBuffer::AlignedBuffer(AlignedBuffer&& other) noexcept
 
 AlignedBuffer& AlignedBuffer::operator=(AlignedBuffer&& other) noexcept {
     if (this != &other) {
-        raw_buffer_ = std::move(other.raw_buffer_);
+        PageAllocator::release(allocation_);
+        allocation_ = other.allocation_;
         aligned_ptr_ = other.aligned_ptr_;
         size_ = other.size_;
         alignment_ = other.alignment_;
+        file_options_ = std::move(other.file_options_);
         
+        other.allocation_ = PageAllocator::Allocation();
         other.aligned_ptr_ = nullptr;
         other.size_ = 0;
         other.alignment_ = 0;
@@ -51,29 +82,46 @@ AlignedBuffer& AlignedBuffer::operator=(AlignedBuffer&& other) noexcept {
     return *this;
 }
 
-void AlignedBuffer::calculate_aligned_pointer() {
-    /**
-     * Cache Line Aligned Buffer Calculation
-     * 
-     * Problem: std::unique_ptr doesn't guarantee cache line alignment
-     * Solution: Allocate extra space and manually align the buffer
-     * 
-     * Step 1: Get raw pointer address as integer
-     * Step 2: Round UP to next alignment boundary using bit masking
-     *   - Formula: (addr + alignment - 1) & ~(alignment - 1)
-     *   - The mask ~(alignment - 1) clears the lower bits to align
-     *   - Example: addr=0x1009, alignment=64 (0x40)
-     *     → (0x1009 + 0x3F) & ~0x3F → 0x1048 & 0xFFC0 → 0x1040
-     * Step 3: Convert back to pointer for aligned memory access
-     */
-    uintptr_t addr = reinterpret_cast<uintptr_t>(raw_buffer_.get());
-    uintptr_t aligned_addr = (addr + alignment_ - 1) & ~(alignment_ - 1);
-    aligned_ptr_ = reinterpret_cast<uint8_t*>(aligned_addr);
+PageAllocator::PageReport AlignedBuffer::page_backing() const {
+    return PageAllocator::query_backing(aligned_ptr_, allocation_.mode);
+}
+
+void AlignedBuffer::reset_page_cache_state() {
+    PageAllocator::reset_file_pages(allocation_, file_options_);
 }
 
 void AlignedBuffer::initialize_pattern() {
-    // Initialize buffer with a simple pattern for testing
-    for (size_t i = 0; i < size_; ++i) {
+    initialize_pattern(0, size_);
+}
+
+void AlignedBuffer::initialize_pattern(size_t begin, size_t end) noexcept {
+    /**
+     * Byte i holds i & 0xFF, so the pattern repeats every 256 bytes. One
+     * period is built as 32 64-bit words and copied whole; the fixed-size
+     * copy compiles to full-width vector stores instead of a byte loop.
+     */
+    constexpr size_t PERIOD = 256;
+    end = end < size_ ? end : size_;
+    if (begin >= end) {
+        return;
+    }
+
+    uint64_t period[PERIOD / sizeof(uint64_t)];
+    uint8_t* period_bytes = reinterpret_cast<uint8_t*>(period);
+    for (size_t i = 0; i < PERIOD; ++i) {
+        period_bytes[i] = static_cast<uint8_t>(i);
+    }
+
+    size_t i = begin;
+    // Head: bytes up to the next period boundary
+    for (; i < end && (i % PERIOD) != 0; ++i) {
+        aligned_ptr_[i] = static_cast<uint8_t>(i & 0xFF);
+    }
+    for (; i + PERIOD <= end; i += PERIOD) {
+        std::memcpy(aligned_ptr_ + i, period, PERIOD);
+    }
+    // Tail: remaining partial period
+    for (; i < end; ++i) {
         aligned_ptr_[i] = static_cast<uint8_t>(i & 0xFF);
     }
 }
@@ -4,6 +4,7 @@
 #include <memory>
 #include <cstddef>
 #include <cstdint>
+#include "page_allocator.h"
 
 /**
  * @brief RAII wrapper for cache-line aligned memory buffers
@@ -17,10 +18,23 @@ public:
      * @brief Construct aligned buffer with specified size and alignment
      * @param size Buffer size in bytes
      * @param alignment Alignment requirement (must be power of 2)
-     * @throws std::bad_alloc if allocation fails
-     * @throws std::invalid_argument if alignment is not power of 2
+     * @param page_mode Page backing to request (default: heap allocation)
+     * @param initialize Write the test pattern now; pass false to first-touch
+     *        the buffer later with initialize_pattern(begin, end) from the
+     *        threads that will use each slice
+     * @throws MemoryError if allocation fails or alignment is not power of 2
      */
-    AlignedBuffer(size_t size, size_t alignment);
+    AlignedBuffer(size_t size, size_t alignment, PageMode page_mode = PageMode::DEFAULT, bool initialize = true);
+
+    /**
+     * @brief Construct a buffer backed by a shared mapping of a temporary file
+     * @param size Buffer size in bytes
+     * @param alignment Alignment requirement (must be power of 2)
+     * @param file Backing file directory, MAP_POPULATE, advice and page-cache state
+     * @param initialize Write the test pattern now (see above)
+     * @throws MemoryError if the file cannot be created or mapped
+     */
+    AlignedBuffer(size_t size, size_t alignment, const FileOptions& file, bool initialize = true);
     
     // No copy constructor/assignment (unique ownership)
     AlignedBuffer(const AlignedBuffer&) = delete;
@@ -31,13 +45,22 @@ public:
     AlignedBuffer& operator=(AlignedBuffer&& other) noexcept;
     
     // Automatic cleanup
-    ~AlignedBuffer() = default;
+    ~AlignedBuffer();
     
     // Access methods
     uint8_t* data() noexcept { return aligned_ptr_; }
     const uint8_t* data() const noexcept { return aligned_ptr_; }
     size_t size() const noexcept { return size_; }
     size_t alignment() const noexcept { return alignment_; }
+    PageMode page_mode() const noexcept { return allocation_.mode; }
+    bool file_backed() const noexcept { return allocation_.fd >= 0; }
+    const FileOptions& file_options() const noexcept { return file_options_; }
+
+    // Return a file-backed buffer to its page-cache state before a measurement (no-op otherwise)
+    void reset_page_cache_state();
+    
+    // Page backing the kernel actually provided (read after initialization)
+    PageAllocator::PageReport page_backing() const;
     
     // Array access operators
     uint8_t& operator[](size_t index) noexcept { return aligned_ptr_[index]; }
@@ -46,16 +69,19 @@ public:
     // Initialize buffer with pattern
     void initialize_pattern();
     
+    // Initialize bytes [begin, end) with the same pattern (safe to call concurrently on disjoint ranges)
+    void initialize_pattern(size_t begin, size_t end) noexcept;
+    
     // Verify alignment
     bool is_aligned() const noexcept;
 
 private:
-    std::unique_ptr<uint8_t[]> raw_buffer_;
+    PageAllocator::Allocation allocation_;
     uint8_t* aligned_ptr_;
     size_t size_;
     size_t alignment_;
+    FileOptions file_options_;
     
-    void calculate_aligned_pointer();
     static bool is_power_of_two(size_t n) noexcept;
 };
 
@@ -0,0 +1,649 @@
+#include "allocator_bench.h"
+#include "constants.h"
+#include "errors.h"
+#include "safe_file_utils.h"
+#include "worker_pool.h"
+
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <cmath>
+#include <cstdlib>
+#include <map>
+#include <memory>
+#include <mutex>
+#include <random>
+#include <sstream>
+#include <thread>
+#include <dlfcn.h>
+#include <unistd.h>
+
+#ifdef __APPLE__
+#include <mach/mach.h>
+#endif
+
+namespace AllocatorBench {
+
+namespace {
+
+using Clock = std::chrono::steady_clock;
+using MallocFunction = void* (*)(size_t);
+using FreeFunction = void (*)(void*);
+
+constexpr size_t PAGE_BYTES = 4 * BenchmarkConstants::KB;
+constexpr size_t CHURN_MIN_BYTES = 16;
+constexpr size_t CHURN_MAX_BYTES = 256;
+constexpr size_t FRAGMENT_MIN_BYTES = 16;
+constexpr size_t FRAGMENT_MAX_BYTES = 64 * BenchmarkConstants::KB;
+constexpr size_t SIZE_TABLE = 4096;    // Sizes cycle through this many draws
+constexpr size_t VICTIM_TABLE = 4093;  // Coprime with SIZE_TABLE, so pairs do not repeat in step
+constexpr uint64_t SEED = 0xA110C8ED;
+
+// One byte per page, so the allocation is committed like a real object's
+inline void touch(void* p, size_t size) {
+    volatile uint8_t* bytes = static_cast<volatile uint8_t*>(p);
+    for (size_t offset = 0; offset < size; offset += PAGE_BYTES) {
+        bytes[offset] = 1;
+    }
+    bytes[size - 1] = 1;
+}
+
+struct SystemHeap {
+    MallocFunction allocate_fn;
+    FreeFunction free_fn;
+
+    void* allocate(size_t size) { return allocate_fn(size); }
+    void release(void* p) { free_fn(p); }
+    void end_round() {}
+};
+
+// Bump allocation over chunks taken from the process allocator; a round reuses them from the start
+class Arena {
+public:
+    ~Arena() {
+        for (uint8_t* chunk : chunks_) {
+            std::free(chunk);
+        }
+    }
+
+    void* allocate(size_t size) {
+        size = (size + 15) & ~static_cast<size_t>(15);
+        if (offset_ + size > BenchmarkConstants::ALLOC_ARENA_CHUNK) {
+            next_chunk();
+        }
+        void* p = chunks_[current_] + offset_;
+        offset_ += size;
+        return p;
+    }
+
+    void release(void*) {}
+
+    void end_round() {
+        current_ = 0;
+        offset_ = chunks_.empty() ? BenchmarkConstants::ALLOC_ARENA_CHUNK : 0;
+    }
+
+private:
+    void next_chunk() {
+        if (chunks_.empty() || current_ + 1 == chunks_.size()) {
+            void* chunk = std::malloc(BenchmarkConstants::ALLOC_ARENA_CHUNK);
+            if (chunk == nullptr) {
+                throw MemoryError("Arena chunk allocation failed");
+            }
+            chunks_.push_back(static_cast<uint8_t*>(chunk));
+            current_ = chunks_.size() - 1;
+        } else {
+            ++current_;
+        }
+        offset_ = 0;
+    }
+
+    std::vector<uint8_t*> chunks_;
+    size_t current_ = 0;
+    size_t offset_ = BenchmarkConstants::ALLOC_ARENA_CHUNK;
+};
+
+// Power-of-two size classes with intrusive free lists. A block's header keeps its class and,
+// while allocated, its owning pool; a block freed by another thread is pushed onto the owner's
+// remote list, which the owner drains once its own list of that class runs dry.
+class Pool {
+public:
+    static constexpr size_t MIN_SHIFT = 4;  // 16 B
+    static constexpr size_t CLASSES = 13;   // Up to 64 KB
+    static constexpr size_t HEADER = 16;    // Class and owner (or next); keeps blocks 16-byte aligned
+
+    ~Pool() {
+        for (uint8_t* chunk : chunks_) {
+            std::free(chunk);
+        }
+    }
+
+    void* allocate(size_t size) {
+        size_t cls = class_of(size);
+        if (free_[cls] == nullptr) {
+            drain_remote();
+            if (free_[cls] == nullptr) {
+                carve(cls);
+            }
+        }
+        Header* header = free_[cls];
+        free_[cls] = header->next;
+        header->owner = this;
+        return reinterpret_cast<uint8_t*>(header) + HEADER;
+    }
+
+    void release(void* p) {
+        Header* header = reinterpret_cast<Header*>(static_cast<uint8_t*>(p) - HEADER);
+        Pool* owner = header->owner;
+        if (owner == this) {
+            header->next = free_[header->cls];
+            free_[header->cls] = header;
+            return;
+        }
+        Header* head = owner->remote_.load(std::memory_order_relaxed);
+        do {
+            header->next = head;
+        } while (!owner->remote_.compare_exchange_weak(head, header, std::memory_order_release,
+                                                       std::memory_order_relaxed));
+    }
+
+    void end_round() {}
+
+private:
+    struct Header {
+        size_t cls;
+        union {
+            Pool* owner;   // While allocated
+            Header* next;  // While free
+        };
+    };
+    static_assert(sizeof(Header) == HEADER, "pool block header layout");
+
+    static size_t class_of(size_t size) {
+        size_t cls = 0;
+        while ((static_cast<size_t>(1) << (cls + MIN_SHIFT)) < size) {
+            ++cls;
+        }
+        return std::min(cls, CLASSES - 1);
+    }
+
+    void drain_remote() {
+        Header* header = remote_.exchange(nullptr, std::memory_order_acquire);
+        while (header != nullptr) {
+            Header* next = header->next;
+            header->next = free_[header->cls];
+            free_[header->cls] = header;
+            header = next;
+        }
+    }
+
+    void carve(size_t cls) {
+        size_t block = HEADER + (static_cast<size_t>(1) << (cls + MIN_SHIFT));
+        size_t chunk_bytes = std::max(BenchmarkConstants::ALLOC_POOL_CHUNK, block);
+        uint8_t* chunk = static_cast<uint8_t*>(std::malloc(chunk_bytes));
+        if (chunk == nullptr) {
+            throw MemoryError("Pool chunk allocation failed");
+        }
+        chunks_.push_back(chunk);
+        for (size_t offset = 0; offset + block <= chunk_bytes; offset += block) {
+            Header* header = reinterpret_cast<Header*>(chunk + offset);
+            header->cls = cls;
+            header->next = free_[cls];
+            free_[cls] = header;
+        }
+    }
+
+    Header* free_[CLASSES] = {};
+    std::vector<uint8_t*> chunks_;
+    alignas(CoherenceTests::PADDED_SLOT_BYTES) std::atomic<Header*> remote_{nullptr};
+};
+
+// Sizes and victims drawn before timing
+struct Tables {
+    std::vector<uint32_t> sizes;
+    std::vector<uint32_t> victims;
+};
+
+Tables make_tables(Workload workload, size_t thread_index) {
+    std::mt19937_64 rng(SEED + thread_index);
+    Tables tables;
+    tables.sizes.resize(SIZE_TABLE);
+    if (workload == Workload::FRAGMENTATION) {
+        // Log-uniform: as many 16-32 B objects as 32-64 KB ones
+        std::uniform_real_distribution<double> exponent(std::log2(static_cast<double>(FRAGMENT_MIN_BYTES)),
+                                                        std::log2(static_cast<double>(FRAGMENT_MAX_BYTES)));
+        for (auto& size : tables.sizes) {
+            size = static_cast<uint32_t>(std::min<double>(FRAGMENT_MAX_BYTES, std::exp2(exponent(rng))));
+        }
+        std::uniform_int_distribution<uint32_t> victim(0, BenchmarkConstants::ALLOC_FRAGMENTATION_LIVE - 1);
+        tables.victims.resize(VICTIM_TABLE);
+        for (auto& v : tables.victims) {
+            v = victim(rng);
+        }
+    } else {
+        std::uniform_int_distribution<uint32_t> size(CHURN_MIN_BYTES, CHURN_MAX_BYTES);
+        for (auto& s : tables.sizes) {
+            s = size(rng);
+        }
+        // Free order of a churn batch
+        tables.victims.resize(BenchmarkConstants::ALLOC_CHURN_BATCH);
+        for (size_t i = 0; i < tables.victims.size(); ++i) {
+            tables.victims[i] = static_cast<uint32_t>(i);
+        }
+        std::shuffle(tables.victims.begin(), tables.victims.end(), rng);
+    }
+    return tables;
+}
+
+// Fixed-capacity single-producer single-consumer ring of pointers
+struct alignas(CoherenceTests::PADDED_SLOT_BYTES) Ring {
+    std::vector<void*> slots;
+    alignas(CoherenceTests::PADDED_SLOT_BYTES) std::atomic<size_t> head{0};  // Next slot to fill
+    alignas(CoherenceTests::PADDED_SLOT_BYTES) std::atomic<size_t> tail{0};  // Next slot to drain
+
+    Ring() : slots(BenchmarkConstants::ALLOC_QUEUE_DEPTH, nullptr) {}
+
+    void push(void* p) {
+        size_t h = head.load(std::memory_order_relaxed);
+        while (h - tail.load(std::memory_order_acquire) == slots.size()) {
+            std::this_thread::yield();
+        }
+        slots[h % slots.size()] = p;
+        head.store(h + 1, std::memory_order_release);
+    }
+
+    void* pop() {
+        size_t t = tail.load(std::memory_order_relaxed);
+        while (head.load(std::memory_order_acquire) == t) {
+            std::this_thread::yield();
+        }
+        void* p = slots[t % slots.size()];
+        tail.store(t + 1, std::memory_order_release);
+        return p;
+    }
+};
+
+// State shared by the threads of one run
+struct RunState {
+    SpinBarrier start;
+    SpinBarrier measured;  // Threads and the main thread: RSS is read between the two waits
+    SpinBarrier release;
+    std::vector<double> seconds;
+    std::vector<uint64_t> ops;
+    std::vector<uint64_t> live;
+    std::vector<std::unique_ptr<Ring>> rings;
+
+    RunState(size_t threads)
+        : start(threads), measured(threads + 1), release(threads + 1), seconds(threads, 0.0), ops(threads, 0),
+          live(threads, 0) {}
+};
+
+template <typename Heap>
+void churn(Heap& heap, const Tables& tables, size_t ops, RunState& state, size_t t) {
+    const size_t batch = BenchmarkConstants::ALLOC_CHURN_BATCH;
+    std::vector<void*> objects(batch, nullptr);
+    size_t next_size = 0;
+    size_t done = 0;
+
+    state.start.arrive_and_wait();
+    auto start = Clock::now();
+    while (done < ops) {
+        size_t count = std::min(batch, ops - done);
+        for (size_t i = 0; i < count; ++i) {
+            size_t size = tables.sizes[next_size++ % SIZE_TABLE];
+            objects[i] = heap.allocate(size);
+            touch(objects[i], size);
+        }
+        for (size_t i = 0; i < batch; ++i) {
+            size_t victim = tables.victims[i];
+            if (victim < count) {
+                heap.release(objects[victim]);
+            }
+        }
+        heap.end_round();
+        done += count;
+    }
+    state.seconds[t] = std::chrono::duration<double>(Clock::now() - start).count();
+    state.ops[t] = done;
+
+    state.measured.arrive_and_wait();
+    state.release.arrive_and_wait();
+}
+
+template <typename Heap>
+void fragmentation(Heap& heap, const Tables& tables, size_t ops, RunState& state, size_t t) {
+    const size_t live = BenchmarkConstants::ALLOC_FRAGMENTATION_LIVE;
+    std::vector<void*> objects(live, nullptr);
+    std::vector<uint32_t> sizes(live, 0);
+    size_t next_size = 0;
+    uint64_t live_bytes = 0;
+    for (size_t i = 0; i < live; ++i) {
+        sizes[i] = tables.sizes[next_size++ % SIZE_TABLE];
+        objects[i] = heap.allocate(sizes[i]);
+        touch(objects[i], sizes[i]);
+        live_bytes += sizes[i];
+    }
+
+    state.start.arrive_and_wait();
+    auto start = Clock::now();
+    for (size_t i = 0; i < ops; ++i) {
+        size_t victim = tables.victims[i % VICTIM_TABLE];
+        heap.release(objects[victim]);
+        live_bytes -= sizes[victim];
+        sizes[victim] = tables.sizes[next_size++ % SIZE_TABLE];
+        objects[victim] = heap.allocate(sizes[victim]);
+        touch(objects[victim], sizes[victim]);
+        live_bytes += sizes[victim];
+    }
+    state.seconds[t] = std::chrono::duration<double>(Clock::now() - start).count();
+    state.ops[t] = ops;
+    state.live[t] = live_bytes;
+
+    state.measured.arrive_and_wait();
+    state.release.arrive_and_wait();
+    for (void* p : objects) {
+        heap.release(p);
+    }
+}
+
+// Even threads allocate and queue, odd threads free what their partner queued
+template <typename Heap>
+void producer_consumer(Heap& heap, const Tables& tables, size_t ops, RunState& state, size_t t) {
+    Ring& ring = *state.rings[t / 2];
+    const bool producer = (t % 2) == 0;
+
+    state.start.arrive_and_wait();
+    auto start = Clock::now();
+    if (producer) {
+        for (size_t i = 0; i < ops; ++i) {
+            size_t size = tables.sizes[i % SIZE_TABLE];
+            void* p = heap.allocate(size);
+            touch(p, size);
+            ring.push(p);
+        }
+    } else {
+        for (size_t i = 0; i < ops; ++i) {
+            heap.release(ring.pop());
+        }
+    }
+    state.seconds[t] = std::chrono::duration<double>(Clock::now() - start).count();
+    state.ops[t] = producer ? ops : 0;
+
+    state.measured.arrive_and_wait();
+    state.release.arrive_and_wait();
+}
+
+template <typename Heap>
+void run_thread(Heap& heap, Workload workload, const Tables& tables, size_t ops, RunState& state, size_t t) {
+    switch (workload) {
+        case Workload::CHURN:
+            churn(heap, tables, ops, state, t);
+            break;
+        case Workload::FRAGMENTATION:
+            fragmentation(heap, tables, ops, state, t);
+            break;
+        case Workload::PRODUCER_CONSUMER:
+            producer_consumer(heap, tables, ops, state, t);
+            break;
+    }
+}
+
+// Heaps are built before the threads start and destroyed after they joined, so a block a
+// consumer frees into its producer's pool never outlives the chunk it was carved from
+template <typename Heap>
+void run_threads(std::vector<Heap>& heaps, Workload workload, size_t ops, const std::vector<size_t>& cpus,
+                 const CoherenceTests::PinFunction& pin, RunState& state, uint64_t& rss_before,
+                 uint64_t& rss_after) {
+    const size_t num_threads = cpus.size();
+    std::vector<Tables> tables;
+    for (size_t t = 0; t < num_threads; ++t) {
+        tables.push_back(make_tables(workload, t));
+    }
+
+    rss_before = resident_bytes();
+    std::vector<std::thread> threads;
+    for (size_t t = 0; t < num_threads; ++t) {
+        threads.emplace_back([&, t] {
+            if (pin) {
+                pin(cpus[t]);
+            }
+            run_thread(heaps[t], workload, tables[t], ops, state, t);
+        });
+    }
+    state.measured.arrive_and_wait();
+    rss_after = resident_bytes();
+    state.release.arrive_and_wait();
+    for (auto& thread : threads) {
+        thread.join();
+    }
+}
+
+// Libraries stay loaded: an allocator may have started threads or registered TLS destructors
+SystemHeap load_library(const std::string& path) {
+    static std::mutex mutex;
+    static std::map<std::string, SystemHeap> loaded;
+    std::lock_guard<std::mutex> lock(mutex);
+    auto it = loaded.find(path);
+    if (it != loaded.end()) {
+        return it->second;
+    }
+
+    void* handle = dlopen(path.c_str(), RTLD_NOW | RTLD_LOCAL);
+    if (handle == nullptr) {
+        const char* error = dlerror();
+        throw ConfigurationError("Cannot load allocator library '" + path + "': " + (error ? error : "unknown error"));
+    }
+    void* allocate_fn = dlsym(handle, "malloc");
+    void* free_fn = dlsym(handle, "free");
+
+    // dlsym also searches the library's dependencies, so a library without its own malloc would
+    // silently resolve to the C library's; the symbol must come from the library just loaded
+    Dl_info info;
+    bool own = false;
+    if (allocate_fn != nullptr && free_fn != nullptr && dladdr(allocate_fn, &info) != 0 && info.dli_fname != nullptr) {
+        void* owner = dlopen(info.dli_fname, RTLD_NOW | RTLD_NOLOAD);
+        own = owner == handle;
+        if (owner != nullptr) {
+            dlclose(owner);
+        }
+    }
+    if (!own) {
+        throw ConfigurationError("Allocator library '" + path + "' does not define malloc and free");
+    }
+    SystemHeap heap{reinterpret_cast<MallocFunction>(allocate_fn), reinterpret_cast<FreeFunction>(free_fn)};
+    loaded.emplace(path, heap);
+    return heap;
+}
+
+std::vector<std::string> split_list(const std::string& str) {
+    std::vector<std::string> items;
+    std::stringstream stream(str);
+    std::string item;
+    while (std::getline(stream, item, ',')) {
+        items.push_back(item);
+    }
+    return items;
+}
+
+}  // namespace
+
+std::string workload_to_string(Workload workload) {
+    switch (workload) {
+        case Workload::CHURN:
+            return "churn";
+        case Workload::PRODUCER_CONSUMER:
+            return "producer_consumer";
+        case Workload::FRAGMENTATION:
+            return "fragmentation";
+    }
+    return "churn";
+}
+
+std::vector<Workload> parse_workloads(const std::string& str) {
+    const std::vector<Workload> all = {Workload::CHURN, Workload::PRODUCER_CONSUMER, Workload::FRAGMENTATION};
+    if (str == "all") {
+        return all;
+    }
+    std::vector<Workload> workloads;
+    for (const std::string& name : split_list(str)) {
+        auto it = std::find_if(all.begin(), all.end(), [&](Workload w) { return workload_to_string(w) == name; });
+        if (it == all.end()) {
+            throw ArgumentError("Unknown allocator workload '" + name +
+                                "' (expected churn, producer_consumer, fragmentation or all)");
+        }
+        if (std::find(workloads.begin(), workloads.end(), *it) == workloads.end()) {
+            workloads.push_back(*it);
+        }
+    }
+    if (workloads.empty()) {
+        throw ArgumentError("--alloc-workloads needs at least one workload");
+    }
+    return workloads;
+}
+
+std::vector<AllocatorSpec> parse_allocators(const std::string& str) {
+    std::vector<AllocatorSpec> specs;
+    for (const std::string& name : split_list(str)) {
+        AllocatorSpec spec;
+        spec.name = name;
+        if (name == "system") {
+            spec.kind = Kind::SYSTEM;
+            spec.name = describe_system_allocator();
+        } else if (name == "arena") {
+            spec.kind = Kind::ARENA;
+        } else if (name == "pool") {
+            spec.kind = Kind::POOL;
+        } else if (name.compare(0, 4, "lib:") == 0) {
+            spec.kind = Kind::LIBRARY;
+            spec.path = name.substr(4);
+            if (spec.path.empty()) {
+                throw ArgumentError("--allocators lib: needs the path of a shared library");
+            }
+        } else {
+            throw ArgumentError("Unknown allocator '" + name + "' (expected system, arena, pool or lib:PATH)");
+        }
+        specs.push_back(spec);
+    }
+    if (specs.empty()) {
+        throw ArgumentError("--allocators needs at least one allocator");
+    }
+    return specs;
+}
+
+std::string describe_system_allocator() {
+    if (dlsym(RTLD_DEFAULT, "mallctl") != nullptr) {
+        return "system (jemalloc)";
+    }
+    if (dlsym(RTLD_DEFAULT, "tc_malloc") != nullptr) {
+        return "system (tcmalloc)";
+    }
+    if (dlsym(RTLD_DEFAULT, "mi_malloc") != nullptr) {
+        return "system (mimalloc)";
+    }
+#if defined(__APPLE__)
+    return "system (libmalloc)";
+#elif defined(__GLIBC__)
+    return "system (glibc)";
+#else
+    return "system";
+#endif
+}
+
+uint64_t resident_bytes() {
+#ifdef __APPLE__
+    mach_task_basic_info info;
+    mach_msg_type_number_t count = MACH_TASK_BASIC_INFO_COUNT;
+    if (task_info(mach_task_self(), MACH_TASK_BASIC_INFO, reinterpret_cast<task_info_t>(&info), &count) !=
+        KERN_SUCCESS) {
+        return 0;
+    }
+    return info.resident_size;
+#else
+    // statm: total program size, then resident pages
+    std::string line;
+    if (!SafeFileUtils::read_single_line("/proc/self/statm", line)) {
+        return 0;
+    }
+    std::istringstream fields(line);
+    uint64_t size_pages = 0;
+    uint64_t resident_pages = 0;
+    if (!(fields >> size_pages >> resident_pages)) {
+        return 0;
+    }
+    return resident_pages * static_cast<uint64_t>(sysconf(_SC_PAGESIZE));
+#endif
+}
+
+Result run(const AllocatorSpec& allocator, Workload workload, size_t ops_per_thread, const std::vector<size_t>& cpus,
+           const CoherenceTests::PinFunction& pin) {
+    if (cpus.empty()) {
+        throw ConfigurationError("Allocator tests need at least one thread");
+    }
+
+    Result result;
+    result.allocator = allocator.name;
+    result.workload = workload;
+    result.num_threads = cpus.size();
+    if (workload == Workload::PRODUCER_CONSUMER && cpus.size() < 2) {
+        result.available = false;
+        result.note = "needs 2 threads";
+        return result;
+    }
+    if (workload != Workload::CHURN && allocator.kind == Kind::ARENA) {
+        result.available = false;
+        result.note = "arena never reuses freed memory";
+        return result;
+    }
+
+    std::vector<size_t> placement = cpus;
+    if (workload == Workload::PRODUCER_CONSUMER && placement.size() % 2 != 0) {
+        placement.pop_back();
+    }
+    const size_t num_threads = placement.size();
+    result.num_threads = num_threads;
+
+    RunState state(num_threads);
+    if (workload == Workload::PRODUCER_CONSUMER) {
+        for (size_t pair = 0; pair < num_threads / 2; ++pair) {
+            state.rings.push_back(std::make_unique<Ring>());
+        }
+    }
+
+    uint64_t rss_before = 0;
+    uint64_t rss_after = 0;
+    switch (allocator.kind) {
+        case Kind::SYSTEM:
+        case Kind::LIBRARY: {
+            SystemHeap heap = allocator.kind == Kind::SYSTEM ? SystemHeap{std::malloc, std::free}
+                                                             : load_library(allocator.path);
+            std::vector<SystemHeap> heaps(num_threads, heap);
+            run_threads(heaps, workload, ops_per_thread, placement, pin, state, rss_before, rss_after);
+            break;
+        }
+        case Kind::ARENA: {
+            std::vector<Arena> heaps(num_threads);
+            run_threads(heaps, workload, ops_per_thread, placement, pin, state, rss_before, rss_after);
+            break;
+        }
+        case Kind::POOL: {
+            std::vector<Pool> heaps(num_threads);
+            run_threads(heaps, workload, ops_per_thread, placement, pin, state, rss_before, rss_after);
+            break;
+        }
+    }
+
+    result.seconds = *std::max_element(state.seconds.begin(), state.seconds.end());
+    for (size_t t = 0; t < num_threads; ++t) {
+        result.ops += state.ops[t];
+        result.live_bytes += state.live[t];
+    }
+    if (result.ops > 0 && result.seconds > 0.0) {
+        size_t active = (workload == Workload::PRODUCER_CONSUMER) ? num_threads / 2 : num_threads;
+        result.total_mops = static_cast<double>(result.ops) / result.seconds / 1e6;
+        result.ns_per_op = result.seconds * 1e9 / (static_cast<double>(result.ops) / static_cast<double>(active));
+    }
+    result.rss_growth_bytes = static_cast<int64_t>(rss_after) - static_cast<int64_t>(rss_before);
+    return result;
+}
+
+}  // namespace AllocatorBench
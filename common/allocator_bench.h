@@ -0,0 +1,123 @@
+#ifndef ALLOCATOR_BENCH_H
+#define ALLOCATOR_BENCH_H
+
+#include <cstddef>
+#include <cstdint>
+#include <string>
+#include <vector>
+
+#include "coherence_tests.h"
+
+/**
+ * @brief Allocator throughput and memory growth
+ *
+ * Memory-bound services spend much of their time in malloc and free, and
+ * allocators differ most under the patterns the single up-front buffer of
+ * the bandwidth tests never exercises: many small objects, objects freed
+ * by another thread, and long-lived mixes of very different sizes. Each
+ * workload runs on one thread per CPU entry against one allocator:
+ *
+ * - the process allocator: glibc, or whatever LD_PRELOAD put in front of it
+ *   (jemalloc, tcmalloc, mimalloc are recognised by their extra symbols)
+ * - a shared library loaded with dlopen, called through its malloc and free
+ * - a built-in bump arena (free is a no-op, the arena rewinds between
+ *   rounds) and a built-in pool of power-of-two size classes with per-thread
+ *   free lists (remote frees go back to the owning thread), as the cost floor
+ *   the general allocators are compared to
+ *
+ * Sizes and free orders are drawn before timing; every allocation has one
+ * byte per page written so its pages are committed. Besides ns per
+ * operation, each run reports how much the process RSS grew while it ran,
+ * measured while the workload's live set is still allocated.
+ */
+namespace AllocatorBench {
+
+/**
+ * @brief Access pattern of a run
+ */
+enum class Workload {
+    CHURN,              ///< Rounds of 16-256 B allocations, freed in shuffled order
+    PRODUCER_CONSUMER,  ///< Thread pairs: one allocates and queues, the other frees
+    FRAGMENTATION       ///< A live set of 16 B - 64 KB objects, random victims replaced
+};
+
+/**
+ * @brief Source of malloc and free
+ */
+enum class Kind {
+    SYSTEM,   ///< The process allocator (LD_PRELOAD replaces it)
+    LIBRARY,  ///< malloc and free of a dlopen'ed shared library
+    ARENA,    ///< Built-in per-thread bump arena
+    POOL      ///< Built-in per-thread power-of-two pools
+};
+
+/**
+ * @brief One allocator of --allocators
+ */
+struct AllocatorSpec {
+    Kind kind = Kind::SYSTEM;
+    std::string path;  ///< Library of LIBRARY
+    std::string name;  ///< As reported ("system (jemalloc)", "lib:/usr/lib/libmimalloc.so", "arena", "pool")
+};
+
+/**
+ * @brief Outcome of one workload on one allocator and thread count
+ */
+struct Result {
+    std::string allocator;
+    Workload workload = Workload::CHURN;
+    size_t num_threads = 0;
+    bool available = true;
+    std::string note;              ///< Why the run was skipped
+    uint64_t ops = 0;              ///< Allocation and free pairs over all threads
+    double seconds = 0.0;          ///< Wall time of the slowest thread
+    double total_mops = 0.0;       ///< Pairs per second over all threads, in millions
+    double ns_per_op = 0.0;        ///< Per thread: seconds / pairs of that thread
+    uint64_t live_bytes = 0;       ///< Bytes still allocated when RSS was read
+    int64_t rss_growth_bytes = 0;  ///< Resident set change over the run, live set included
+};
+
+std::string workload_to_string(Workload workload);
+
+/**
+ * @brief Parse --alloc-workloads: churn, producer_consumer, fragmentation, comma-separated or all
+ * @throws ArgumentError on an unknown or empty name
+ */
+std::vector<Workload> parse_workloads(const std::string& str);
+
+/**
+ * @brief Parse --allocators: system, arena, pool and lib:PATH, comma-separated
+ *
+ * Libraries are not loaded here, so parsing never touches the filesystem.
+ *
+ * @throws ArgumentError on an unknown or empty name or a lib: without a path
+ */
+std::vector<AllocatorSpec> parse_allocators(const std::string& str);
+
+/**
+ * @brief Name of the process allocator, from the symbols LD_PRELOAD brought in
+ */
+std::string describe_system_allocator();
+
+/**
+ * @brief Resident set of this process in bytes (0 if unknown)
+ */
+uint64_t resident_bytes();
+
+/**
+ * @brief Run one workload on one thread per CPU entry
+ *
+ * The producer/consumer workload pairs consecutive threads and drops an odd
+ * last one; with a single thread it is reported unavailable. Only churn runs
+ * on the arena, which reuses memory solely when a round rewinds it.
+ *
+ * @param ops_per_thread Allocation and free pairs per thread (per producer)
+ * @param pin Pins each thread (empty: no pinning)
+ * @throws ConfigurationError if cpus is empty or a library cannot be loaded
+ */
+Result run(const AllocatorSpec& allocator, Workload workload, size_t ops_per_thread, const std::vector<size_t>& cpus,
+           const CoherenceTests::PinFunction& pin);
+
+}  // namespace AllocatorBench
+
+#endif  // ALLOCATOR_BENCH_H
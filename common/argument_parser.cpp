@@ -1,10 +1,39 @@
 #include "argument_parser.h"
 #include "test_patterns.h"
+#include "pattern_registry.h"
 #include "output_formatter.h"
+#include "simd_kernels.h"
+#include "cpu_features.h"
+#include "pointer_chase.h"
+#include "page_allocator.h"
+#include "matrix_multiply_interface.h"
+#include "working_sets.h"
+#include "io_tests.h"
+#include "mapping_tests.h"
+#include "tlb_sweep.h"
+#include "ring_transfer.h"
+#include "copy_sweep.h"
+#include "memory_tiers.h"
+#include "gpu_bandwidth.h"
+#include "fleet.h"
+#include "trace_replay.h"
+#include "allocator_bench.h"
+#include "access_patterns.h"
+#include "encoded_scans.h"
+#include "proxy_kernels.h"
+#include "irregular_kernels.h"
+#include "cold_cache.h"
+#include "prefetch_control.h"
+#include "numa_utils.h"
+#include "thread_scaling.h"
+#include "cpu_topology.h"
+#include "contention.h"
+#include "soak.h"
 #include <iostream>
 #include <sstream>
 #include <algorithm>
 #include <thread>
+#include <utility>
 
 ArgumentParser::ArgumentParser(const std::string& program_name, const std::string& description)
     : program_name_(program_name), description_(description), platform_(create_platform_interface()) {
@@ -25,7 +54,7 @@ ArgumentParser::ArgumentParser(const std::string& program_name, const std::strin
             config.memory_sizes_gb = parse_memory_sizes(value);
         });
     
-    add_argument("--iterations", "", "Number of iterations (default: 10)", true,
+    add_argument("--iterations", "", "Number of iterations (default: 10; cache-sized working sets scale it by size instead of calibrating)", true,
         [](BenchmarkConfig& config, const std::string& value) {
             try {
                 config.iterations = std::stoull(value);
@@ -35,10 +64,31 @@ ArgumentParser::ArgumentParser(const std::string& program_name, const std::strin
             } catch (const std::exception&) {
                 throw ArgumentError("Invalid iterations value: " + value);
             }
+            config.iterations_set = true;
         });
     
-    add_argument("--threads", "", "Number of threads (default: auto-detect)", true,
+    add_argument("--time-budget", "", "Seconds per cache-sized measurement: calibrate iterations, then repeat until the 95% confidence interval is within 1% (default: 1)", true,
         [](BenchmarkConfig& config, const std::string& value) {
+            try {
+                config.time_budget_seconds = std::stod(value);
+            } catch (const std::exception&) {
+                throw ArgumentError("Invalid time budget: " + value);
+            }
+            if (!(config.time_budget_seconds > 0.0)) {
+                throw ArgumentError("Time budget must be greater than 0 seconds");
+            }
+            config.time_budget_set = true;
+        });
+    
+    add_argument("--threads", "", "Number of threads (default: auto-detect), or sweep / a list such as 1,2,4,8 to measure bandwidth scaling over the same buffers", true,
+        [](BenchmarkConfig& config, const std::string& value) {
+            if (ThreadScaling::is_thread_sweep(value)) {
+                config.threads_str = value;
+                if (value != "sweep") {
+                    config.num_threads = ThreadScaling::parse_thread_counts(value, 0).back();
+                }
+                return;
+            }
             try {
                 config.num_threads = std::stoull(value);
                 if (config.num_threads == 0) {
@@ -49,16 +99,170 @@ ArgumentParser::ArgumentParser(const std::string& program_name, const std::strin
             }
         });
     
-    add_argument("--pattern", "", "Test pattern: sequential_read, sequential_write, random_read, random_write, copy, triad, matrix_multiply (default: all)", true,
+    add_argument("--placement", "", "Thread placement from the CPU topology: compact (fill one package, cores before SMT siblings), scatter (alternate packages), one-per-core (no SMT siblings), per-ccx (alternate LLC domains) or list:CPUS; default for --threads sweep: compact", true,
+        [](BenchmarkConfig& config, const std::string& value) {
+            config.placement_str = value;
+        });
+    
+    std::string pattern_names;
+    for (const auto& name : PatternRegistry::names()) {
+        pattern_names += (pattern_names.empty() ? "" : ", ") + name;
+    }
+    add_argument("--pattern", "", "Test pattern: " + pattern_names + " (default: all)", true,
         [](BenchmarkConfig& config, const std::string& value) {
             config.pattern_str = value;
         });
     
+    add_argument("--streams", "", "Multi-stream pattern reading R arrays and writing W arrays per element (R:W, each 0-16); runs with --pattern all or streams (default: 4:1)", true,
+        [](BenchmarkConfig& config, const std::string& value) {
+            config.streams_str = value;
+        });
+    
+    add_argument("--element", "", "Bytes used per access by strided, gather and scatter: 4, 8, 64 (default: 8)", true,
+        [](BenchmarkConfig& config, const std::string& value) {
+            config.element_str = value;
+        });
+    
+    add_argument("--stride", "", "Bytes between strided reads, a multiple of --element up to 4096 (default: 64)", true,
+        [](BenchmarkConfig& config, const std::string& value) {
+            config.stride_str = value;
+        });
+    
+    add_argument("--index", "", "Index distribution of gather and scatter: uniform, zipf[:S], page (default: uniform)", true,
+        [](BenchmarkConfig& config, const std::string& value) {
+            config.index_str = value;
+        });
+    
+    add_argument("--bits", "", "Packed value width of decode_bitpack and decode_delta (1-32) and decode_dict (1-16) (default: 8)", true,
+        [](BenchmarkConfig& config, const std::string& value) {
+            config.bits_str = value;
+        });
+    
+    add_argument("--probe", "", "Probe sequence of hash_probe: linear (slot by slot) or group (16 tags compared at once, Swiss-table style) (default: group)", true,
+        [](BenchmarkConfig& config, const std::string& value) {
+            config.probe_str = value;
+        });
+    
+    add_argument("--load-factor", "", "Share of the hash_probe table's slots filled before probing (0.05-0.95) (default: 0.75)", true,
+        [](BenchmarkConfig& config, const std::string& value) {
+            config.load_factor_str = value;
+        });
+    
+    add_argument("--hash-batch", "", "Lookups hash_probe hashes and prefetches together (1-64, 1: no prefetch) (default: 16)", true,
+        [](BenchmarkConfig& config, const std::string& value) {
+            config.hash_batch_str = value;
+        });
+    
+    add_argument("--merge-ways", "", "Sorted runs the merge pattern merges at once (2-64) (default: 8)", true,
+        [](BenchmarkConfig& config, const std::string& value) {
+            config.merge_ways_str = value;
+        });
+    
+    add_argument("--matrix", "", "Synthetic matrix of spmv_csr and spmv_sell: banded (diagonal band) or powerlaw (Pareto row lengths, random columns) (default: banded)", true,
+        [](BenchmarkConfig& config, const std::string& value) {
+            config.matrix_str = value;
+        });
+    
+    add_argument("--row-nnz", "", "Nonzeros per row of spmv_csr and spmv_sell, the mean for powerlaw (2-128) (default: 16)", true,
+        [](BenchmarkConfig& config, const std::string& value) {
+            config.row_nnz_str = value;
+        });
+    
+    add_argument("--stencil-block", "", "Tile rows of the cache-blocked stencil sweep (4-4096) (default: unblocked)", true,
+        [](BenchmarkConfig& config, const std::string& value) {
+            config.stencil_block_str = value;
+        });
+    
+    add_argument("--cold", "", "Evict the working set before every pass, outside the timed window: flush its lines (CLFLUSHOPT/CLFLUSH, DC CIVAC) or evict them by streaming a buffer sized from the caches, for cold-start bandwidth and latency of small working sets", true,
+        [](BenchmarkConfig& config, const std::string& value) {
+            config.cold_str = value;
+        });
+    
+    add_argument("--prefetch", "", "Software prefetch distance in bytes for sequential_read, strided, random_read and random_write (a multiple of 64 up to 16384), or sweep to compare distances (default: none)", true,
+        [](BenchmarkConfig& config, const std::string& value) {
+            config.prefetch_str = value;
+        });
+    
+    add_argument("--hw-prefetch", "", "Hardware prefetchers: on, off, both (both needs --prefetch sweep; off and both need root and the msr driver on Intel Linux) (default: on)", true,
+        [](BenchmarkConfig& config, const std::string& value) {
+            config.hw_prefetch_str = value;
+        });
+    
     add_argument("--format", "", "Output format: markdown, json, csv (default: markdown)", true,
         [](BenchmarkConfig& config, const std::string& value) {
             config.format_str = value;
         });
     
+    add_argument("--ndjson", "", "Also append one JSON record per result to FILE as each measurement completes (schema-versioned, with host fingerprint, kernel, placement, pages and full statistics; flushed per record)", true,
+        [](BenchmarkConfig& config, const std::string& value) {
+            config.ndjson_path = value;
+        });
+    
+    add_argument("--save-baseline", "", "Store this run's results and per-iteration samples in the baseline FILE under this host's fingerprint (CPU, memory, kernel, pages), replacing its previous entry", true,
+        [](BenchmarkConfig& config, const std::string& value) {
+            config.save_baseline_path = value;
+        });
+    
+    add_argument("--compare", "", "Compare the results with this host's entry in the baseline FILE (Mann-Whitney U test on the per-iteration samples) and exit with status 3 on a significant regression", true,
+        [](BenchmarkConfig& config, const std::string& value) {
+            config.compare_path = value;
+        });
+    
+    add_argument("--agent", "", "Serve fleet runs: listen on TCP PORT and run what a --coordinate host sends, streaming the records back (no authentication: trusted networks only)", true,
+        [](BenchmarkConfig& config, const std::string& value) {
+            config.agent_port_str = value;
+        });
+    
+    add_argument("--coordinate", "", "Run the other options on the --agent hosts HOST[:PORT],... (default port " + std::to_string(BenchmarkConstants::FLEET_DEFAULT_PORT) + ") from a common start time and report percentiles per hardware SKU with outlier hosts", true,
+        [](BenchmarkConfig& config, const std::string& value) {
+            config.coordinate_str = value;
+        });
+    
+    add_argument("--calibrate", "", "Measure this host's practical peak: the best read, write and copy kernels with every supported store policy at 1, 2, 4, ... --threads threads, stored in the peak file; later runs report efficiency against it too", false,
+        [](BenchmarkConfig& config, const std::string&) {
+            config.calibrate = true;
+        });
+    
+    add_argument("--tune", "", "Find the fastest read, write and triad loop shape (element width, unroll, accumulators) at each cache level and DRAM, stored in the peak file; later runs with --kernel auto use them", false,
+        [](BenchmarkConfig& config, const std::string&) {
+            config.tune = true;
+        });
+    
+    add_argument("--peak-file", "", "File of calibrated peaks, keyed by host fingerprint (default: ~/.cache/memory-benchmarks/peaks.json, or under $XDG_CACHE_HOME)", true,
+        [](BenchmarkConfig& config, const std::string& value) {
+            config.peak_file = value;
+        });
+    
+    add_argument("--system-cache", "", "File that keeps this boot's system detection (CPU, caches, memory layout) so later runs skip it; re-detected after a reboot", true,
+        [](BenchmarkConfig& config, const std::string& value) {
+            config.system_cache = value;
+        });
+    
+    add_argument("--kernel", "", "SIMD kernel for read/write/copy/triad: auto, scalar, sse2, avx2, avx512, neon, sve (default: auto)", true,
+        [](BenchmarkConfig& config, const std::string& value) {
+            config.kernel_str = value;
+        });
+    
+    add_argument("--stores", "", "Store policy for write/copy/triad: temporal, nontemporal, clzero, dczva; comma-separated list or all runs them side by side (default: temporal)", true,
+        [](BenchmarkConfig& config, const std::string& value) {
+            config.store_policy_str = value;
+        });
+    
+    add_argument("--chase", "", "Chain layout for latency_chase: random, page (random within 4KB pages) or stride:BYTES (default: random)", true,
+        [](BenchmarkConfig& config, const std::string& value) {
+            config.chase_str = value;
+        });
+    
+    add_argument("--pages", "", "Page size backing the buffers: default (heap), 4k, thp (transparent huge pages), 2m, 1g (default: default)", true,
+        [](BenchmarkConfig& config, const std::string& value) {
+            config.pages_str = value;
+        });
+    
+    add_argument("--precision", "", "Operand precision for matrix_multiply: fp64, fp32, bf16, fp16, int8; comma-separated list or all runs them side by side (default: fp32)", true,
+        [](BenchmarkConfig& config, const std::string& value) {
+            config.precision_str = value;
+        });
+    
     add_argument("--cache-hierarchy", "", "Cache-sized working sets (L1/L2/L3) - Peak cache performance", false,
         [](BenchmarkConfig& config, const std::string&) {
             config.cache_hierarchy = true;
@@ -70,15 +274,243 @@ ArgumentParser::ArgumentParser(const std::string& program_name, const std::strin
             config.cache_hierarchy = false;
         });
     
-    // Platform-specific arguments
+    add_argument("--numa-matrix", "", "Bind threads to each NUMA node and memory to each node in turn; report the node-to-node bandwidth/latency matrix (Linux)", false,
+        [](BenchmarkConfig& config, const std::string&) {
+            config.numa_matrix = true;
+        });
+    
+    add_argument("--tiers", "", "Bind threads to the local NUMA node and place memory at each --tier-ratios local:far page ratio over every memory-only (CXL) node, or remote nodes without one; report bandwidth per ratio and the fastest (Linux)", false,
+        [](BenchmarkConfig& config, const std::string&) {
+            config.memory_tiers = true;
+        });
+    
+    add_argument("--tier-ratios", "", "LOCAL:FAR page ratios for --tiers, weights 0 to 255; 1:0 is local only, 0:1 far only; comma-separated (default: 1:0,3:1,2:1,1:1,1:2,1:3,0:1)", true,
+        [](BenchmarkConfig& config, const std::string& value) {
+            config.tier_ratios_str = value;
+        });
+    
+    add_argument("--gpu", "", "Run read, copy and triad GPU kernels over buffers shared with the CPU, alone, next to CPU threads alone, and both at once; report each side's bandwidth and how much it keeps when shared (Apple Silicon)", false,
+        [](BenchmarkConfig& config, const std::string&) {
+            config.gpu = true;
+        });
+    
+    add_argument("--gpu-kernels", "", "Kernels for --gpu: read, copy, triad or all; comma-separated (default: all)", true,
+        [](BenchmarkConfig& config, const std::string& value) {
+            config.gpu_kernels_str = value;
+        });
+    
+    add_argument("--loaded-latency", "", "Pointer-chase probe on one thread while the others generate throttled read/write/copy traffic; report (bandwidth, latency) points", false,
+        [](BenchmarkConfig& config, const std::string&) {
+            config.loaded_latency = true;
+        });
+    
+    add_argument("--roofline", "", "Sweep an FP64 kernel from 1/16 to 64 FLOP/byte over L1, L2, L3 and DRAM working sets; report points plus triad bandwidth and GEMM compute ceilings", false,
+        [](BenchmarkConfig& config, const std::string&) {
+            config.roofline = true;
+        });
+    
+    add_argument("--core-to-core", "", "Bounce a cache line between pinned threads on every CPU pair and report the one-way latency matrix, then compare packed and padded counters under false sharing", false,
+        [](BenchmarkConfig& config, const std::string&) {
+            config.core_to_core = true;
+        });
+    
+    add_argument("--cpus", "", "CPUs of the core-to-core matrix or the --rings pairs, as a kernel CPU list such as 0-7,64-71 (default: every online CPU)", true,
+        [](BenchmarkConfig& config, const std::string& value) {
+            config.cpus_str = value;
+        });
+    
+    add_argument("--atomics", "", "Measure fetch_add and compare-exchange throughput, relaxed and seq_cst, on a shared line and on private lines, from 1 to --threads threads (LSE against LL/SC on aarch64)", false,
+        [](BenchmarkConfig& config, const std::string&) {
+            config.atomics = true;
+        });
+    
+    add_argument("--allocators", "", "Benchmark allocators, comma-separated: system (the process allocator, or one LD_PRELOAD put in front), lib:PATH (malloc and free of a shared library), arena, pool; ns per malloc/free pair and RSS growth from 1 to --threads threads, or at the counts of a --threads list", true,
+        [](BenchmarkConfig& config, const std::string& value) {
+            config.allocators_str = value;
+        });
+    
+    add_argument("--alloc-workloads", "", "Workloads for --allocators: churn, producer_consumer, fragmentation; comma-separated list or all (default: all)", true,
+        [](BenchmarkConfig& config, const std::string& value) {
+            config.alloc_workloads_str = value;
+        });
+    
+    add_argument("--contention", "", "Noisy-neighbor interference: --victim-threads run --pattern while the other threads run a throttled --aggressor load on separate buffers; report victim slowdown against aggressor bandwidth", false,
+        [](BenchmarkConfig& config, const std::string&) {
+            config.contention = true;
+        });
+    
+    add_argument("--aggressor", "", "Aggressor traffic for --contention: sequential_write, sequential_read, copy, random_read, atomics (default: sequential_write)", true,
+        [](BenchmarkConfig& config, const std::string& value) {
+            config.aggressor_str = value;
+        });
+    
+    add_argument("--victim-threads", "", "Victim threads for --contention, fewer than --threads (default: 1)", true,
+        [](BenchmarkConfig& config, const std::string& value) {
+            try {
+                config.victim_threads = std::stoull(value);
+            } catch (const std::exception&) {
+                throw ArgumentError("Invalid victim thread count: " + value);
+            }
+            if (config.victim_threads == 0) {
+                throw ArgumentError("Victim thread count must be greater than 0");
+            }
+        });
+    
+    add_argument("--resctrl-victim", "", "Place the --contention victims in a resctrl group with these limits, such as MB:0=50 or L3:0=ff0 (Linux, root, RDT/PQoS)", true,
+        [](BenchmarkConfig& config, const std::string& value) {
+            config.resctrl_victim_str = value;
+        });
+    
+    add_argument("--resctrl-aggressor", "", "Place the --contention aggressors in a resctrl group with these limits, such as MB:0=10 or MB:0=10,L3:0=f (Linux, root, RDT/PQoS)", true,
+        [](BenchmarkConfig& config, const std::string& value) {
+            config.resctrl_aggressor_str = value;
+        });
+    
+    add_argument("--sweep", "", "Single-threaded read and latency sweep over geometric working sets from 4KB to --size, STEPS per octave (log2:STEPS, 1-32); reports the knees as effective cache capacities", true,
+        [](BenchmarkConfig& config, const std::string& value) {
+            config.sweep_str = value;
+        });
+    
+    add_argument("--duration", "", "Soak each pattern for this long (seconds, or 30s, 10m, 24h) and record aggregate bandwidth, core frequency and CPU/DIMM temperature at every --sample-interval; reports bandwidth decay and throttling", true,
+        [](BenchmarkConfig& config, const std::string& value) {
+            config.duration_str = value;
+        });
+    
+    add_argument("--sample-interval", "", "Sampling period of --duration in milliseconds, 10-60000 (default: 100)", true,
+        [](BenchmarkConfig& config, const std::string& value) {
+            config.sample_interval_str = value;
+        });
+    
+    add_argument("--counters", "", "Read hardware performance counters (IPC, LLC and dTLB misses, memory-controller DRAM bytes) around each measured region (perf_event_open on Linux, kperf on macOS)", false,
+        [](BenchmarkConfig& config, const std::string&) {
+            config.counters = true;
+        });
+    
+    add_argument("--energy", "", "Read package and DRAM energy counters around each measured region and report average watts and pJ/byte, and the energy-optimal count of a --threads sweep (RAPL through powercap or MSRs on Linux, usually as root; IOReport on Apple Silicon)", false,
+        [](BenchmarkConfig& config, const std::string&) {
+            config.energy = true;
+        });
+    
+    add_argument("--file", "", "Back the buffers with a shared mapping of a temporary file created in DIR (tmpfs, disk or DAX mount) and report page faults with bandwidth", true,
+        [](BenchmarkConfig& config, const std::string& value) {
+            config.file_dir = value;
+        });
+    
+    add_argument("--file-populate", "", "Map the --file buffers with MAP_POPULATE and keep their page tables between runs (pre-populated baseline)", false,
+        [](BenchmarkConfig& config, const std::string&) {
+            config.file_populate = true;
+        });
+    
+    add_argument("--madvise", "", "Access advice for the --file mapping: normal, sequential, random, willneed (default: normal)", true,
+        [](BenchmarkConfig& config, const std::string& value) {
+            config.madvise_str = value;
+        });
+    
+    add_argument("--file-cache", "", "Page-cache state of the --file buffers before each run: warm (page tables dropped, pages cached) or cold (pages evicted) (default: warm)", true,
+        [](BenchmarkConfig& config, const std::string& value) {
+            config.file_cache_str = value;
+        });
+    
+    add_argument("--io", "", "Compare file read paths (read, pread, O_DIRECT, mmap, io_uring) over a --size file created in DIR; reports GB/s and CPU cycles per byte", true,
+        [](BenchmarkConfig& config, const std::string& value) {
+            config.io_dir = value;
+        });
+    
+    add_argument("--io-methods", "", "I/O paths for --io: read, pread, direct, mmap, io_uring, io_uring_direct; comma-separated list or all (default: all)", true,
+        [](BenchmarkConfig& config, const std::string& value) {
+            config.io_methods_str = value;
+        });
+    
+    add_argument("--io-block", "", "Block sizes for --io, multiples of 4k (default: 4k,128k,1m)", true,
+        [](BenchmarkConfig& config, const std::string& value) {
+            config.io_block_str = value;
+        });
+    
+    add_argument("--io-depth", "", "io_uring queue depths for --io (default: 1,32)", true,
+        [](BenchmarkConfig& config, const std::string& value) {
+            config.io_depth_str = value;
+        });
+    
+    add_argument("--mapping", "", "Time first-touch faults, MAP_POPULATE, MADV_DONTNEED reclaim, THP collapse and munmap (TLB shootdowns) of fresh --size mappings from 1 to --threads threads, or at the counts of a --threads list", false,
+        [](BenchmarkConfig& config, const std::string&) {
+            config.mapping = true;
+        });
+    
+    add_argument("--mapping-ops", "", "Operations for --mapping: first_touch, populate, dontneed, thp_collapse, munmap; comma-separated list or all (default: all)", true,
+        [](BenchmarkConfig& config, const std::string& value) {
+            config.mapping_ops_str = value;
+        });
+    
+    add_argument("--tlb", "", "Chase one line per page over increasing page counts of each --tlb-pages size to find the L1 dTLB and STLB reach and the page-walk latency; --size caps the span", false,
+        [](BenchmarkConfig& config, const std::string&) {
+            config.tlb = true;
+        });
+    
+    add_argument("--tlb-pages", "", "Page sizes for --tlb: 4k, thp, 2m, 1g; comma-separated (default: 4k,2m,1g; 2m falls back to THP)", true,
+        [](BenchmarkConfig& config, const std::string& value) {
+            config.tlb_pages_str = value;
+        });
+    
+    add_argument("--rings", "", "Stream --ring-payload messages through SPSC and MPMC rings between pinned threads on every pair of --cpus; reports GB/s and single-message handoff latency, grouped by the cache level each pair shares", false,
+        [](BenchmarkConfig& config, const std::string&) {
+            config.rings = true;
+        });
+    
+    add_argument("--ring-payload", "", "Message sizes for --rings: multiples of 8 bytes up to 64k, comma-separated (default: 64,1k,16k)", true,
+        [](BenchmarkConfig& config, const std::string& value) {
+            config.ring_payload_str = value;
+        });
+    
+    add_argument("--ring-kinds", "", "Ring algorithms for --rings: spsc, mpmc; comma-separated (default: spsc,mpmc)", true,
+        [](BenchmarkConfig& config, const std::string& value) {
+            config.ring_kinds_str = value;
+        });
+    
+    add_argument("--memcpy", "", "Time libc memcpy/memset, REP MOVSB/STOSB and the SIMD kernels over a geometric ladder of --memcpy-sizes at each --memcpy-align misalignment, and report the sizes at which the fastest implementation changes", false,
+        [](BenchmarkConfig& config, const std::string&) {
+            config.memcpy_sweep = true;
+        });
+    
+    add_argument("--memcpy-sizes", "", "Size range for --memcpy: MIN-MAX in bytes with an optional k, m or g suffix, multiples of 8 (default: 16-64m)", true,
+        [](BenchmarkConfig& config, const std::string& value) {
+            config.memcpy_sizes_str = value;
+        });
+    
+    add_argument("--memcpy-impls", "", "Implementations for --memcpy: libc, rep, a --kernel name, or one with -nt for non-temporal stores; comma-separated (default: all the CPU supports)", true,
+        [](BenchmarkConfig& config, const std::string& value) {
+            config.memcpy_impls_str = value;
+        });
+    
+    add_argument("--memcpy-align", "", "Source:destination offsets from a page for --memcpy, 0 to 63; comma-separated (default: 0:0,1:0,0:1)", true,
+        [](BenchmarkConfig& config, const std::string& value) {
+            config.memcpy_align_str = value;
+        });
+    
+    add_argument("--memcpy-ops", "", "Operations for --memcpy: copy, set; comma-separated (default: copy,set)", true,
+        [](BenchmarkConfig& config, const std::string& value) {
+            config.memcpy_ops_str = value;
+        });
+    
+    add_argument("--trace", "", "Replay the access trace in FILE, (offset, size, read/write) records, over a working set as large as its span on --threads threads; reports bandwidth, access rate and the share spent decoding", true,
+        [](BenchmarkConfig& config, const std::string& value) {
+            config.trace_path = value;
+        });
+    
+    add_argument("--trace-convert", "", "Write the --trace file from perf:FILE (perf script -F event,addr output of perf mem record) or histogram:FILE (ADDRESS COUNT [r|w [SIZE]] lines) instead of replaying", true,
+        [](BenchmarkConfig& config, const std::string& value) {
+            config.trace_convert_str = value;
+        });
+    
+    // Platform-specific arguments: core-type affinity where P-cores and E-cores coexist
     if (platform_ && platform_->supports_cpu_affinity()) {
-        if (platform_->get_platform_name() == "macOS") {
-            add_argument("--p-cores", "", "Run only on Performance cores (Apple Silicon)", false,
+        if (platform_->get_platform_name() == "macOS" ||
+            platform_->get_max_threads_for_affinity(CPUAffinityType::E_CORES) > 0) {
+            add_argument("--p-cores", "", "Run only on Performance cores (Apple Silicon, Intel hybrid, Arm big.LITTLE)", false,
                 [](BenchmarkConfig& config, const std::string&) {
                     config.cpu_affinity = CPUAffinityType::P_CORES;
                 });
             
-            add_argument("--e-cores", "", "Run only on Efficiency cores (Apple Silicon)", false,
+            add_argument("--e-cores", "", "Run only on Efficiency cores (Apple Silicon, Intel hybrid, Arm big.LITTLE)", false,
                 [](BenchmarkConfig& config, const std::string&) {
                     config.cpu_affinity = CPUAffinityType::E_CORES;
                 });
@@ -101,20 +533,38 @@ BenchmarkConfig ArgumentParser::parse(int argc, char* argv[]) {
         std::string arg = argv[i];
         bool found = false;
         
+        // Accept --option=value as well as --option value
+        std::string inline_value;
+        bool has_inline_value = false;
+        size_t equals_pos = arg.find('=');
+        if (arg.rfind("--", 0) == 0 && equals_pos != std::string::npos) {
+            inline_value = arg.substr(equals_pos + 1);
+            arg = arg.substr(0, equals_pos);
+            has_inline_value = true;
+        }
+        
         // Find matching argument definition
         for (const auto& arg_def : arguments_) {
             if (arg == arg_def.long_name || (!arg_def.short_name.empty() && arg == arg_def.short_name)) {
                 found = true;
                 
                 if (arg_def.requires_value) {
-                    if (i + 1 >= argc) {
-                        throw ArgumentError("Argument " + arg + " requires a value");
+                    std::string value;
+                    if (has_inline_value) {
+                        value = inline_value;
+                    } else {
+                        if (i + 1 >= argc) {
+                            throw ArgumentError("Argument " + arg + " requires a value");
+                        }
+                        value = argv[++i];
                     }
-                    std::string value = argv[++i];
                     if (arg_def.handler) {
                         arg_def.handler(config, value);
                     }
                 } else {
+                    if (has_inline_value) {
+                        throw ArgumentError("Argument " + arg + " does not take a value");
+                    }
                     if (arg_def.handler) {
                         arg_def.handler(config, "");
                     }
@@ -149,6 +599,37 @@ void ArgumentParser::validate_config(BenchmarkConfig& config) {
     validate_memory_sizes(config);
     validate_pattern(config);
     validate_format(config);
+    validate_kernel(config);
+    validate_store_policy(config);
+    validate_chase(config);
+    validate_pages(config);
+    validate_precision(config);
+    validate_sweep(config);
+    validate_file_backing(config);
+    validate_io(config);
+    validate_mapping(config);
+    validate_tlb(config);
+    validate_rings(config);
+    validate_memcpy(config);
+    validate_tiers(config);
+    validate_gpu(config);
+    validate_fleet(config);
+    validate_streams(config);
+    validate_access(config);
+    validate_decode(config);
+    validate_proxy(config);
+    validate_irregular(config);
+    validate_cold(config);
+    validate_prefetch(config);
+    validate_core_to_core(config);
+    validate_atomics(config);
+    validate_allocators(config);
+    validate_contention(config);
+    validate_soak(config);
+    validate_calibrate(config);
+    validate_tune(config);
+    validate_trace(config);
+    validate_thread_sweep(config);
     validate_mode_compatibility(config);
 }
 
@@ -222,13 +703,766 @@ void ArgumentParser::validate_format(const BenchmarkConfig& config) {
     }
 }
 
+void ArgumentParser::validate_kernel(const BenchmarkConfig& config) {
+    auto supported = SimdKernels::get_kernel_names();
+    if (std::find(supported.begin(), supported.end(), config.kernel_str) == supported.end()) {
+        std::string valid_kernels;
+        for (size_t i = 0; i < supported.size(); ++i) {
+            if (i > 0) valid_kernels += ", ";
+            valid_kernels += supported[i];
+        }
+        throw ArgumentError("Invalid kernel '" + config.kernel_str + "'. Valid kernels: " + valid_kernels);
+    }
+    
+    if (!SimdKernels::is_kernel_supported(SimdKernels::string_to_kernel_type(config.kernel_str))) {
+        throw ArgumentError("Kernel '" + config.kernel_str + "' is not supported on this CPU "
+                           "(detected: " + CpuFeatureDetection::describe_cpu_features() + ")");
+    }
+}
+
+void ArgumentParser::validate_store_policy(const BenchmarkConfig& config) {
+    KernelType kernel = SimdKernels::string_to_kernel_type(config.kernel_str);
+    std::vector<StorePolicy> policies;
+    try {
+        policies = SimdKernels::parse_store_policies(config.store_policy_str, kernel);
+    } catch (const ArgumentError&) {
+        auto supported = SimdKernels::get_store_policy_names();
+        std::string valid_policies;
+        for (size_t i = 0; i < supported.size(); ++i) {
+            if (i > 0) valid_policies += ", ";
+            valid_policies += supported[i];
+        }
+        throw ArgumentError("Invalid store policy '" + config.store_policy_str + "'. Valid store policies: " + valid_policies);
+    }
+    
+    for (StorePolicy policy : policies) {
+        if (!SimdKernels::is_store_policy_supported(kernel, policy)) {
+            throw ArgumentError("Store policy '" + SimdKernels::store_policy_to_string(policy) +
+                               "' is not supported with kernel '" + config.kernel_str + "' on this CPU "
+                               "(detected: " + CpuFeatureDetection::describe_cpu_features() + ")");
+        }
+    }
+}
+
+void ArgumentParser::validate_chase(const BenchmarkConfig& config) {
+    // Throws ArgumentError with the list of valid modes
+    PointerChase::parse_chase_mode(config.chase_str);
+}
+
+void ArgumentParser::validate_pages(const BenchmarkConfig& config) {
+    // Throws ArgumentError with the list of valid page sizes; availability
+    // of the pages themselves is only known once the buffers are mapped
+    PageAllocator::string_to_page_mode(config.pages_str);
+}
+
+void ArgumentParser::validate_precision(const BenchmarkConfig& config) {
+    std::vector<MatrixMultiply::MatrixPrecision> precisions;
+    if (!MatrixMultiply::parse_precisions(config.precision_str, precisions)) {
+        throw ArgumentError("Invalid precision '" + config.precision_str +
+                           "'. Valid precisions: fp64, fp32, bf16, fp16, int8, all");
+    }
+}
+
+void ArgumentParser::validate_sweep(const BenchmarkConfig& config) {
+    if (!config.sweep_str.empty()) {
+        // Throws ArgumentError with the expected syntax
+        WorkingSetSizes::parse_sweep(config.sweep_str);
+    }
+}
+
+void ArgumentParser::validate_file_backing(const BenchmarkConfig& config) {
+    if (config.file_dir.empty()) {
+        if (config.file_populate || !config.madvise_str.empty() || !config.file_cache_str.empty()) {
+            throw ArgumentError("--file-populate, --madvise and --file-cache require --file DIR.");
+        }
+        return;
+    }
+    // Both throw ArgumentError with the list of valid values
+    if (!config.madvise_str.empty()) {
+        PageAllocator::string_to_file_advice(config.madvise_str);
+    }
+    if (!config.file_cache_str.empty() &&
+        PageAllocator::string_to_file_cache(config.file_cache_str) == FileCache::COLD && config.file_populate) {
+        throw ArgumentError("--file-populate and --file-cache cold are mutually exclusive. "
+                           "A populated mapping keeps its pages resident.");
+    }
+    if (config.pages_str != "default") {
+        throw ArgumentError("--file and --pages are mutually exclusive. "
+                           "File mappings use the page size of the file system backing DIR.");
+    }
+}
+
+void ArgumentParser::validate_io(const BenchmarkConfig& config) {
+    BenchmarkConfig defaults;
+    if (config.io_dir.empty()) {
+        if (config.io_methods_str != defaults.io_methods_str || config.io_block_str != defaults.io_block_str ||
+            config.io_depth_str != defaults.io_depth_str) {
+            throw ArgumentError("--io-methods, --io-block and --io-depth require --io DIR.");
+        }
+        return;
+    }
+    // Each throws ArgumentError describing the expected values
+    IoTests::parse_methods(config.io_methods_str);
+    IoTests::parse_block_sizes(config.io_block_str);
+    IoTests::parse_queue_depths(config.io_depth_str);
+}
+
+void ArgumentParser::validate_streams(const BenchmarkConfig& config) {
+    if (config.streams_str.empty()) {
+        return;
+    }
+    // Throws ArgumentError describing the expected R:W form
+    parse_stream_counts(config.streams_str);
+    if (config.pattern_str != "all" && config.pattern_str != "streams") {
+        throw ArgumentError("--streams requires --pattern all or streams. "
+                           "With all, the multi-stream pattern runs after the STREAM kernels.");
+    }
+}
+
+void ArgumentParser::validate_access(const BenchmarkConfig& config) {
+    bool strided = config.pattern_str == "strided";
+    bool indexed = config.pattern_str == "gather" || config.pattern_str == "scatter";
+
+    // Each parse throws ArgumentError describing the expected values
+    AccessPatterns::AccessConfig access;
+    if (!config.element_str.empty()) {
+        access.element_bytes = AccessPatterns::parse_element_size(config.element_str);
+        if (!strided && !indexed) {
+            throw ArgumentError("--element requires --pattern strided, gather or scatter.");
+        }
+    }
+    if (!config.stride_str.empty()) {
+        AccessPatterns::parse_stride(config.stride_str, access.element_bytes);
+        if (!strided) {
+            throw ArgumentError("--stride requires --pattern strided.");
+        }
+    }
+    if (!config.index_str.empty()) {
+        AccessPatterns::parse_distribution(config.index_str, access);
+        if (!indexed) {
+            throw ArgumentError("--index requires --pattern gather or scatter.");
+        }
+    }
+}
+
+void ArgumentParser::validate_decode(const BenchmarkConfig& config) {
+    if (config.bits_str.empty()) {
+        return;
+    }
+    const PatternRegistry::Pattern* pattern = PatternRegistry::find(config.pattern_str);
+    if (pattern == nullptr || !pattern->encoded) {
+        throw ArgumentError("--bits requires --pattern decode_bitpack, decode_delta or decode_dict.");
+    }
+    // Throws ArgumentError describing the widths the encoding accepts
+    EncodedScans::parse_bits(config.bits_str, pattern->encoding);
+}
+
+void ArgumentParser::validate_proxy(const BenchmarkConfig& config) {
+    bool hash_options = !config.probe_str.empty() || !config.load_factor_str.empty() ||
+                        !config.hash_batch_str.empty();
+    if (hash_options && config.pattern_str != "hash_probe") {
+        throw ArgumentError("--probe, --load-factor and --hash-batch require --pattern hash_probe.");
+    }
+    if (!config.merge_ways_str.empty() && config.pattern_str != "merge") {
+        throw ArgumentError("--merge-ways requires --pattern merge.");
+    }
+    // Each throws ArgumentError describing the values it accepts
+    if (!config.probe_str.empty()) {
+        ProxyKernels::parse_probe(config.probe_str);
+    }
+    if (!config.load_factor_str.empty()) {
+        ProxyKernels::parse_load_factor(config.load_factor_str);
+    }
+    if (!config.hash_batch_str.empty()) {
+        ProxyKernels::parse_batch(config.hash_batch_str);
+    }
+    if (!config.merge_ways_str.empty()) {
+        ProxyKernels::parse_merge_ways(config.merge_ways_str);
+    }
+}
+
+void ArgumentParser::validate_irregular(const BenchmarkConfig& config) {
+    bool spmv = config.pattern_str == "spmv_csr" || config.pattern_str == "spmv_sell";
+    if ((!config.matrix_str.empty() || !config.row_nnz_str.empty()) && !spmv) {
+        throw ArgumentError("--matrix and --row-nnz require --pattern spmv_csr or spmv_sell.");
+    }
+    if (!config.stencil_block_str.empty() && config.pattern_str != "stencil") {
+        throw ArgumentError("--stencil-block requires --pattern stencil.");
+    }
+    // Each throws ArgumentError describing the values it accepts
+    if (!config.matrix_str.empty()) {
+        IrregularKernels::parse_matrix(config.matrix_str);
+    }
+    if (!config.row_nnz_str.empty()) {
+        IrregularKernels::parse_row_nnz(config.row_nnz_str);
+    }
+    if (!config.stencil_block_str.empty()) {
+        IrregularKernels::parse_block(config.stencil_block_str);
+    }
+}
+
+void ArgumentParser::validate_cold(const BenchmarkConfig& config) {
+    if (config.cold_str.empty()) {
+        return;
+    }
+    // Throws ArgumentError for an unknown method, or flush where no flush instruction exists
+    ColdCache::parse_method(config.cold_str);
+    // --pattern all runs the patterns of its list that support cold passes
+    const PatternRegistry::Pattern* pattern = PatternRegistry::find(config.pattern_str);
+    if (config.pattern_str != "all" && (pattern == nullptr || !pattern->cold)) {
+        std::string names;
+        for (const auto& registered : PatternRegistry::all()) {
+            if (registered.cold) {
+                names += (names.empty() ? "" : ", ") + registered.name;
+            }
+        }
+        throw ArgumentError("--cold requires --pattern all or one of " + names + ".");
+    }
+    // The evictions run inside the per-working-set kernels; the other modes time loops of their own
+    if (config.numa_matrix || config.loaded_latency || !config.io_dir.empty() || config.prefetch_str == "sweep" ||
+        config.core_to_core || config.atomics || config.contention || !config.duration_str.empty() ||
+        config.calibrate || !config.trace_path.empty() || !config.allocators_str.empty() || config.mapping ||
+        config.tlb || config.rings || config.memcpy_sweep || config.memory_tiers || config.gpu) {
+        throw ArgumentError("--cold is only supported in large-memory, cache-hierarchy and --threads sweep runs.");
+    }
+    if (config.energy) {
+        throw ArgumentError("--cold cannot be combined with --energy: the evictions would be metered with the passes.");
+    }
+}
+
+void ArgumentParser::validate_prefetch(const BenchmarkConfig& config) {
+    // Each parse throws ArgumentError describing the expected values
+    PrefetchControl::HardwareMode hardware = PrefetchControl::parse_hardware_mode(config.hw_prefetch_str);
+    bool sweep = config.prefetch_str == "sweep";
+    if (!config.prefetch_str.empty() && !sweep) {
+        PrefetchControl::parse_distance(config.prefetch_str);
+    }
+    if (hardware == PrefetchControl::HardwareMode::BOTH && !sweep) {
+        throw ArgumentError("--hw-prefetch both requires --prefetch sweep.");
+    }
+    if (!config.prefetch_str.empty() && config.pattern_str != "all" && config.pattern_str != "sequential_read" &&
+        config.pattern_str != "strided" && config.pattern_str != "random_read" &&
+        config.pattern_str != "random_write") {
+        throw ArgumentError("--prefetch requires --pattern all, sequential_read, strided, random_read or random_write.");
+    }
+
+    // Prefetching applies to the patterns run per working set; the other modes run their own loops
+    if ((!config.prefetch_str.empty() || hardware != PrefetchControl::HardwareMode::DEFAULT) &&
+        (config.loaded_latency || config.roofline || !config.sweep_str.empty() || !config.io_dir.empty())) {
+        throw ArgumentError("--prefetch and --hw-prefetch cannot be combined with --loaded-latency, "
+                           "--roofline, --sweep or --io.");
+    }
+    if (sweep && (config.cache_hierarchy || config.numa_matrix)) {
+        throw ArgumentError("--prefetch sweep cannot be combined with --cache-hierarchy or --numa-matrix. "
+                           "Use --size to choose the working sets of the sweep.");
+    }
+}
+
+void ArgumentParser::validate_core_to_core(const BenchmarkConfig& config) {
+    if (!config.cpus_str.empty()) {
+        if (!config.core_to_core && !config.rings) {
+            throw ArgumentError("--cpus requires --core-to-core or --rings.");
+        }
+        if (NumaUtils::parse_id_list(config.cpus_str).empty()) {
+            throw ArgumentError("Invalid CPU list '" + config.cpus_str + "'. Expected a list such as 0-3,8");
+        }
+    }
+    if (!config.core_to_core) {
+        return;
+    }
+
+    // The coherence tests touch no working set, so every buffer and pattern option is meaningless
+    if (config.cache_hierarchy || config.numa_matrix || config.loaded_latency || config.roofline ||
+        !config.sweep_str.empty() || !config.io_dir.empty() || !config.prefetch_str.empty() || config.counters ||
+        !config.file_dir.empty() || !config.streams_str.empty()) {
+        throw ArgumentError("--core-to-core cannot be combined with other modes, --prefetch, --counters, --file "
+                           "or --streams.");
+    }
+    if (config.pattern_str != "all") {
+        throw ArgumentError("--core-to-core and --pattern are mutually exclusive. "
+                           "It always runs the ping-pong matrix and the false-sharing comparison.");
+    }
+}
+
+void ArgumentParser::validate_atomics(const BenchmarkConfig& config) {
+    if (!config.atomics) {
+        return;
+    }
+
+    // Like the coherence tests, the atomic runs touch one counter per thread and no working set
+    if (config.core_to_core || config.cache_hierarchy || config.numa_matrix || config.loaded_latency ||
+        config.roofline || !config.sweep_str.empty() || !config.io_dir.empty() || !config.prefetch_str.empty() ||
+        config.counters || !config.file_dir.empty() || !config.streams_str.empty()) {
+        throw ArgumentError("--atomics cannot be combined with other modes, --prefetch, --counters, --file "
+                           "or --streams.");
+    }
+    if (config.pattern_str != "all") {
+        throw ArgumentError("--atomics and --pattern are mutually exclusive. "
+                           "It always runs every operation, ordering and sharing combination.");
+    }
+}
+
+void ArgumentParser::validate_allocators(const BenchmarkConfig& config) {
+    AllocatorBench::parse_workloads(config.alloc_workloads_str);
+    if (config.allocators_str.empty()) {
+        if (config.alloc_workloads_str != "all") {
+            throw ArgumentError("--alloc-workloads requires --allocators.");
+        }
+        return;
+    }
+    AllocatorBench::parse_allocators(config.allocators_str);
+
+    // The allocator runs size their own objects and use no working set
+    if (config.cache_hierarchy || config.numa_matrix || config.loaded_latency || config.roofline ||
+        !config.sweep_str.empty() || !config.io_dir.empty() || !config.prefetch_str.empty() ||
+        config.core_to_core || config.atomics || config.contention || !config.duration_str.empty() ||
+        config.calibrate || !config.trace_path.empty() || config.counters || !config.file_dir.empty() ||
+        !config.streams_str.empty()) {
+        throw ArgumentError("--allocators cannot be combined with other modes, --prefetch, --counters, --file "
+                           "or --streams.");
+    }
+    if (config.pattern_str != "all") {
+        throw ArgumentError("--allocators and --pattern are mutually exclusive. "
+                           "Use --alloc-workloads to choose the workloads.");
+    }
+}
+
+void ArgumentParser::validate_contention(const BenchmarkConfig& config) {
+    Contention::parse_aggressor(config.aggressor_str);
+    if (!config.resctrl_victim_str.empty()) {
+        Contention::parse_schemata(config.resctrl_victim_str);
+    }
+    if (!config.resctrl_aggressor_str.empty()) {
+        Contention::parse_schemata(config.resctrl_aggressor_str);
+    }
+    if (!config.contention) {
+        if (config.aggressor_str != "sequential_write" || config.victim_threads != 1 ||
+            !config.resctrl_victim_str.empty() || !config.resctrl_aggressor_str.empty()) {
+            throw ArgumentError("--aggressor, --victim-threads, --resctrl-victim and --resctrl-aggressor "
+                               "require --contention.");
+        }
+        return;
+    }
+
+    // Victims and aggressors each own a pair of large-memory buffers and a fixed share of the threads
+    if (config.cache_hierarchy || config.numa_matrix || config.loaded_latency || config.roofline ||
+        !config.sweep_str.empty() || !config.io_dir.empty() || !config.prefetch_str.empty() ||
+        config.core_to_core || config.atomics || !config.threads_str.empty() || config.counters ||
+        !config.file_dir.empty() || !config.streams_str.empty()) {
+        throw ArgumentError("--contention cannot be combined with other modes, --prefetch, --counters, --file "
+                           "or --streams.");
+    }
+    if (config.victim_threads >= config.num_threads) {
+        throw ArgumentError("--victim-threads " + std::to_string(config.victim_threads) +
+                           " leaves no aggressor thread; --contention needs --threads above it.");
+    }
+    if (config.pattern_str != "all" && config.pattern_str != "sequential_read" &&
+        config.pattern_str != "sequential_write" && config.pattern_str != "copy" &&
+        config.pattern_str != "random_read" && config.pattern_str != "latency_chase") {
+        throw ArgumentError("Invalid victim pattern '" + config.pattern_str +
+                           "'. Valid victim patterns: all, sequential_read, sequential_write, copy, "
+                           "random_read, latency_chase");
+    }
+}
+
+void ArgumentParser::validate_soak(const BenchmarkConfig& config) {
+    Soak::parse_interval(config.sample_interval_str);
+    if (config.duration_str.empty()) {
+        if (config.sample_interval_str != std::to_string(BenchmarkConstants::SOAK_DEFAULT_INTERVAL_MS)) {
+            throw ArgumentError("--sample-interval requires --duration.");
+        }
+        return;
+    }
+    Soak::parse_duration(config.duration_str);
+
+    // A soak streams the large-memory buffers until the deadline, so iteration-based modes do not apply
+    if (config.cache_hierarchy || config.numa_matrix || config.loaded_latency || config.roofline ||
+        !config.sweep_str.empty() || !config.io_dir.empty() || !config.prefetch_str.empty() ||
+        config.core_to_core || config.atomics || config.contention || !config.threads_str.empty() ||
+        config.counters || !config.file_dir.empty() || !config.streams_str.empty()) {
+        throw ArgumentError("--duration cannot be combined with other modes, --prefetch, --counters, --file "
+                           "or --streams.");
+    }
+    if (config.iterations_set) {
+        throw ArgumentError("--duration and --iterations are mutually exclusive. A soak runs until the deadline.");
+    }
+    if (config.pattern_str != "all" && config.pattern_str != "sequential_read" &&
+        config.pattern_str != "sequential_write" && config.pattern_str != "copy" &&
+        config.pattern_str != "random_read") {
+        throw ArgumentError("Invalid soak pattern '" + config.pattern_str +
+                           "'. Valid soak patterns: all, sequential_read, sequential_write, copy, random_read");
+    }
+}
+
+void ArgumentParser::validate_calibrate(const BenchmarkConfig& config) {
+    if (!config.calibrate) {
+        return;
+    }
+
+    // Calibration sweeps its own kernels and thread counts over the large-memory buffers
+    if (config.cache_hierarchy || config.numa_matrix || config.loaded_latency || config.roofline ||
+        !config.sweep_str.empty() || !config.io_dir.empty() || !config.prefetch_str.empty() ||
+        config.core_to_core || config.atomics || config.contention || !config.duration_str.empty() ||
+        !config.threads_str.empty() || config.counters || !config.file_dir.empty() || !config.streams_str.empty()) {
+        throw ArgumentError("--calibrate cannot be combined with other modes, --prefetch, --counters, --file "
+                           "or --streams.");
+    }
+    if (config.pattern_str != "all" || config.store_policy_str != "temporal") {
+        throw ArgumentError("--calibrate, --pattern and --stores are mutually exclusive. "
+                           "It always runs read, write and copy with every store policy the kernel supports.");
+    }
+}
+
+void ArgumentParser::validate_tune(const BenchmarkConfig& config) {
+    if (!config.tune) {
+        return;
+    }
+
+    // Tuning sizes its own working sets and runs every shape of read, write and triad
+    if (config.cache_hierarchy || config.numa_matrix || config.loaded_latency || config.roofline ||
+        !config.sweep_str.empty() || !config.io_dir.empty() || !config.prefetch_str.empty() ||
+        config.core_to_core || config.atomics || config.contention || !config.duration_str.empty() ||
+        config.calibrate || !config.trace_path.empty() || !config.allocators_str.empty() || config.mapping ||
+        config.tlb || config.rings || config.memcpy_sweep || config.memory_tiers || config.gpu ||
+        !config.threads_str.empty() || config.counters || !config.file_dir.empty() || !config.streams_str.empty() ||
+        !config.cold_str.empty()) {
+        throw ArgumentError("--tune cannot be combined with other modes, --prefetch, --counters, --file, "
+                           "--streams or --cold.");
+    }
+    if (config.pattern_str != "all" || config.store_policy_str != "temporal" || config.kernel_str != "auto") {
+        throw ArgumentError("--tune, --pattern, --stores and --kernel are mutually exclusive. "
+                           "It always tunes read, write and triad with temporal stores against the automatic kernel.");
+    }
+}
+
+void ArgumentParser::validate_mapping(const BenchmarkConfig& config) {
+    MappingTests::parse_operations(config.mapping_ops_str);
+    if (!config.mapping) {
+        if (config.mapping_ops_str != "all") {
+            throw ArgumentError("--mapping-ops requires --mapping.");
+        }
+        return;
+    }
+
+    // Each operation creates and destroys its own mappings, so page and file options do not apply
+    if (config.cache_hierarchy || config.numa_matrix || config.loaded_latency || config.roofline ||
+        !config.sweep_str.empty() || !config.io_dir.empty() || !config.prefetch_str.empty() ||
+        config.core_to_core || config.atomics || !config.allocators_str.empty() || config.contention ||
+        !config.duration_str.empty() || config.calibrate || !config.trace_path.empty() || config.counters ||
+        !config.file_dir.empty() || !config.streams_str.empty()) {
+        throw ArgumentError("--mapping cannot be combined with other modes, --prefetch, --counters, --file "
+                           "or --streams.");
+    }
+    if (config.pattern_str != "all") {
+        throw ArgumentError("--mapping and --pattern are mutually exclusive. "
+                           "Use --mapping-ops to choose the operations.");
+    }
+}
+
+void ArgumentParser::validate_tlb(const BenchmarkConfig& config) {
+    TlbSweep::parse_page_modes(config.tlb_pages_str);
+    if (!config.tlb) {
+        if (config.tlb_pages_str != "4k,2m,1g") {
+            throw ArgumentError("--tlb-pages requires --tlb.");
+        }
+        return;
+    }
+
+    // The sweep maps its own buffers per page size, so --pages and file options do not apply
+    if (config.cache_hierarchy || config.numa_matrix || config.loaded_latency || config.roofline ||
+        !config.sweep_str.empty() || !config.io_dir.empty() || !config.prefetch_str.empty() ||
+        config.core_to_core || config.atomics || !config.allocators_str.empty() || config.contention ||
+        !config.duration_str.empty() || config.calibrate || !config.trace_path.empty() || config.mapping ||
+        config.counters || !config.file_dir.empty() || !config.streams_str.empty() || config.pages_str != "default" ||
+        !config.threads_str.empty()) {
+        throw ArgumentError("--tlb cannot be combined with other modes, --prefetch, --counters, --file, --streams, "
+                           "--pages or a --threads list.");
+    }
+    if (config.pattern_str != "all") {
+        throw ArgumentError("--tlb and --pattern are mutually exclusive. "
+                           "Use --tlb-pages to choose the page sizes.");
+    }
+}
+
+void ArgumentParser::validate_rings(const BenchmarkConfig& config) {
+    RingTransfer::parse_payloads(config.ring_payload_str);
+    RingTransfer::parse_kinds(config.ring_kinds_str);
+    if (!config.rings) {
+        if (config.ring_payload_str != "64,1k,16k" || config.ring_kinds_str != "spsc,mpmc") {
+            throw ArgumentError("--ring-payload and --ring-kinds require --rings.");
+        }
+        return;
+    }
+
+    // Like the coherence tests, the rings are the only memory the pairs touch
+    if (config.cache_hierarchy || config.numa_matrix || config.loaded_latency || config.roofline ||
+        !config.sweep_str.empty() || !config.io_dir.empty() || !config.prefetch_str.empty() ||
+        config.core_to_core || config.atomics || !config.allocators_str.empty() || config.contention ||
+        !config.duration_str.empty() || config.calibrate || !config.trace_path.empty() || config.mapping ||
+        config.tlb || config.counters || !config.file_dir.empty() || !config.streams_str.empty() ||
+        !config.threads_str.empty()) {
+        throw ArgumentError("--rings cannot be combined with other modes, --prefetch, --counters, --file, --streams "
+                           "or a --threads list.");
+    }
+    if (config.pattern_str != "all") {
+        throw ArgumentError("--rings and --pattern are mutually exclusive. "
+                           "Use --ring-payload and --ring-kinds to choose the transfers.");
+    }
+}
+
+void ArgumentParser::validate_memcpy(const BenchmarkConfig& config) {
+    CopySweep::parse_size_range(config.memcpy_sizes_str);
+    CopySweep::parse_implementations(config.memcpy_impls_str);
+    CopySweep::parse_alignments(config.memcpy_align_str);
+    CopySweep::parse_operations(config.memcpy_ops_str);
+    if (!config.memcpy_sweep) {
+        if (config.memcpy_sizes_str != "16-64m" || config.memcpy_impls_str != "all" ||
+            config.memcpy_align_str != "0:0,1:0,0:1" || config.memcpy_ops_str != "copy,set") {
+            throw ArgumentError("--memcpy-sizes, --memcpy-impls, --memcpy-align and --memcpy-ops require --memcpy.");
+        }
+        return;
+    }
+
+    // One pinned thread calls each implementation on buffers of its own
+    if (config.cache_hierarchy || config.numa_matrix || config.loaded_latency || config.roofline ||
+        !config.sweep_str.empty() || !config.io_dir.empty() || !config.prefetch_str.empty() ||
+        config.core_to_core || config.atomics || !config.allocators_str.empty() || config.contention ||
+        !config.duration_str.empty() || config.calibrate || !config.trace_path.empty() || config.mapping ||
+        config.tlb || config.rings || config.counters || !config.file_dir.empty() || !config.streams_str.empty() ||
+        config.pages_str != "default" || !config.threads_str.empty()) {
+        throw ArgumentError("--memcpy cannot be combined with other modes, --prefetch, --counters, --file, --streams, "
+                           "--pages or a --threads list.");
+    }
+    if (config.pattern_str != "all") {
+        throw ArgumentError("--memcpy and --pattern are mutually exclusive. "
+                           "Use --memcpy-ops and --memcpy-impls to choose the calls.");
+    }
+}
+
+void ArgumentParser::validate_tiers(const BenchmarkConfig& config) {
+    MemoryTiers::parse_ratios(config.tier_ratios_str);
+    if (!config.memory_tiers) {
+        if (config.tier_ratios_str != "1:0,3:1,2:1,1:1,1:2,1:3,0:1") {
+            throw ArgumentError("--tier-ratios requires --tiers.");
+        }
+        return;
+    }
+
+    // Threads are bound to the local node and buffers placed per ratio, over large-memory working sets
+    if (config.cache_hierarchy || config.numa_matrix || config.loaded_latency || config.roofline ||
+        !config.sweep_str.empty() || !config.io_dir.empty() || !config.prefetch_str.empty() ||
+        config.core_to_core || config.atomics || !config.allocators_str.empty() || config.contention ||
+        !config.duration_str.empty() || config.calibrate || !config.trace_path.empty() || config.mapping ||
+        config.tlb || config.rings || config.memcpy_sweep || config.counters || !config.file_dir.empty() ||
+        !config.threads_str.empty() || !config.placement_str.empty() ||
+        config.cpu_affinity != CPUAffinityType::DEFAULT) {
+        throw ArgumentError("--tiers cannot be combined with other modes, --prefetch, --counters, --file, "
+                           "a --threads list, --placement or core-type affinity options.");
+    }
+}
+
+void ArgumentParser::validate_gpu(const BenchmarkConfig& config) {
+    GpuBandwidth::parse_kernels(config.gpu_kernels_str);
+    if (!config.gpu) {
+        if (config.gpu_kernels_str != "all") {
+            throw ArgumentError("--gpu-kernels requires --gpu.");
+        }
+        return;
+    }
+
+    // The GPU wraps buffers of its own; the CPU side is a fixed streaming load next to it
+    if (config.cache_hierarchy || config.numa_matrix || config.loaded_latency || config.roofline ||
+        !config.sweep_str.empty() || !config.io_dir.empty() || !config.prefetch_str.empty() ||
+        config.core_to_core || config.atomics || !config.allocators_str.empty() || config.contention ||
+        !config.duration_str.empty() || config.calibrate || !config.trace_path.empty() || config.mapping ||
+        config.tlb || config.rings || config.memcpy_sweep || config.memory_tiers || config.counters ||
+        !config.file_dir.empty() || !config.streams_str.empty() || config.pages_str != "default" ||
+        !config.threads_str.empty()) {
+        throw ArgumentError("--gpu cannot be combined with other modes, --prefetch, --counters, --file, --streams, "
+                           "--pages or a --threads list.");
+    }
+    if (config.pattern_str != "all") {
+        throw ArgumentError("--gpu and --pattern are mutually exclusive. "
+                           "Use --gpu-kernels to choose the kernels.");
+    }
+}
+
+void ArgumentParser::validate_fleet(const BenchmarkConfig& config) {
+    if (!config.agent_port_str.empty()) {
+        Fleet::parse_port(config.agent_port_str, "--agent");
+        if (!config.coordinate_str.empty()) {
+            throw ArgumentError("--agent and --coordinate are mutually exclusive.");
+        }
+    }
+    if (config.coordinate_str.empty()) {
+        return;
+    }
+    Fleet::parse_endpoints(config.coordinate_str);
+    // Baselines hold one host's results; the fleet report compares hosts with each other
+    if (!config.save_baseline_path.empty() || !config.compare_path.empty()) {
+        throw ArgumentError("--coordinate cannot be combined with --save-baseline or --compare.");
+    }
+}
+
+void ArgumentParser::validate_trace(const BenchmarkConfig& config) {
+    if (!config.trace_convert_str.empty()) {
+        TraceReplay::parse_source(config.trace_convert_str);
+        if (config.trace_path.empty()) {
+            throw ArgumentError("--trace-convert requires --trace, the file the trace is written to.");
+        }
+    }
+    if (config.trace_path.empty()) {
+        return;
+    }
+
+    // The trace defines the accesses and the working set; it is replayed over a buffer of its own span
+    if (config.cache_hierarchy || config.numa_matrix || config.loaded_latency || config.roofline ||
+        !config.sweep_str.empty() || !config.io_dir.empty() || !config.prefetch_str.empty() ||
+        config.core_to_core || config.atomics || config.contention || !config.duration_str.empty() ||
+        !config.threads_str.empty() || config.calibrate || config.counters || !config.file_dir.empty() ||
+        !config.streams_str.empty()) {
+        throw ArgumentError("--trace cannot be combined with other modes, --prefetch, --counters, --file "
+                           "or --streams.");
+    }
+    if (config.pattern_str != "all" || config.store_policy_str != "temporal") {
+        throw ArgumentError("--trace, --pattern and --stores are mutually exclusive. "
+                           "The trace records which bytes are read and written.");
+    }
+}
+
+void ArgumentParser::validate_thread_sweep(const BenchmarkConfig& config) {
+    if (!config.placement_str.empty()) {
+        CpuTopologyUtils::parse_placement(config.placement_str);
+        if (config.cpu_affinity != CPUAffinityType::DEFAULT || config.numa_matrix) {
+            throw ArgumentError("--placement cannot be combined with core-type affinity options or --numa-matrix, "
+                               "which place threads themselves.");
+        }
+    }
+    if (config.threads_str.empty()) {
+        return;
+    }
+
+    // The sweep reuses the large-memory buffers and the thread count of every other mode is fixed
+    if (config.cache_hierarchy || config.numa_matrix || config.loaded_latency || config.roofline ||
+        !config.sweep_str.empty() || !config.io_dir.empty() || config.prefetch_str == "sweep" ||
+        config.core_to_core || config.atomics) {
+        throw ArgumentError("--threads " + config.threads_str + " runs a scaling sweep in large-memory mode and "
+                           "cannot be combined with other modes.");
+    }
+    if (config.cpu_affinity != CPUAffinityType::DEFAULT) {
+        throw ArgumentError("--threads " + config.threads_str + " places threads in NUMA node order and cannot be "
+                           "combined with core-type affinity options.");
+    }
+}
+
 void ArgumentParser::validate_mode_compatibility(const BenchmarkConfig& config) {
-    // --cache-hierarchy and --pattern are mutually exclusive
-    if (config.cache_hierarchy && config.pattern_str != "all") {
+    // --cache-hierarchy and --pattern are mutually exclusive, but for the encoded scans, application
+    // proxies and irregular patterns the suite leaves out
+    const PatternRegistry::Pattern* selected = PatternRegistry::find(config.pattern_str);
+    bool encoded = selected != nullptr && (selected->encoded || selected->proxy || selected->irregular);
+    if (config.cache_hierarchy && config.pattern_str != "all" && !encoded) {
         throw ArgumentError("--cache-hierarchy and --pattern are mutually exclusive. "
                            "Cache hierarchy mode runs its own comprehensive test suite. "
                            "Use --large-memory for pattern-specific tests.");
     }
+    
+    // The NUMA matrix binds threads itself and uses large-memory working sets
+    if (config.numa_matrix && config.cache_hierarchy) {
+        throw ArgumentError("--numa-matrix and --cache-hierarchy are mutually exclusive. "
+                           "Cache-sized working sets never leave the local node.");
+    }
+    if (config.numa_matrix && config.cpu_affinity != CPUAffinityType::DEFAULT) {
+        throw ArgumentError("--numa-matrix chooses thread placement itself and cannot be combined "
+                           "with core-type affinity options.");
+    }
+
+    // Loaded latency runs its own probe and load threads over large-memory working sets
+    if (config.loaded_latency && (config.cache_hierarchy || config.numa_matrix)) {
+        throw ArgumentError("--loaded-latency, --cache-hierarchy and --numa-matrix are mutually exclusive.");
+    }
+
+    // A fixed iteration count disables calibration, so a budget would be ignored
+    if (config.iterations_set && config.time_budget_set) {
+        throw ArgumentError("--iterations and --time-budget are mutually exclusive. "
+                           "--iterations fixes the count; --time-budget calibrates it.");
+    }
+
+    // The roofline sizes its own working sets and runs a fixed set of kernels
+    if (config.roofline && (config.cache_hierarchy || config.numa_matrix || config.loaded_latency)) {
+        throw ArgumentError("--roofline cannot be combined with --cache-hierarchy, --numa-matrix "
+                           "or --loaded-latency.");
+    }
+    if (config.roofline && config.pattern_str != "all") {
+        throw ArgumentError("--roofline and --pattern are mutually exclusive. "
+                           "The roofline always runs triad, matrix multiply and its own intensity sweep.");
+    }
+
+    // The sweep picks its own working sets and always runs read and latency chase
+    if (!config.sweep_str.empty() &&
+        (config.cache_hierarchy || config.numa_matrix || config.loaded_latency || config.roofline)) {
+        throw ArgumentError("--sweep cannot be combined with --cache-hierarchy, --numa-matrix, "
+                           "--loaded-latency or --roofline.");
+    }
+    if (!config.sweep_str.empty() && config.pattern_str != "all") {
+        throw ArgumentError("--sweep and --pattern are mutually exclusive. "
+                           "The sweep always measures sequential read bandwidth and chase latency.");
+    }
+
+    // Counters are attached to TestResult rows, which only these two modes produce
+    if (config.counters &&
+        (config.numa_matrix || config.loaded_latency || config.roofline || !config.sweep_str.empty())) {
+        throw ArgumentError("--counters is only supported in large-memory and cache-hierarchy runs.");
+    }
+    // Energy is attached to TestResult rows and thread-scaling points
+    if (config.energy &&
+        (config.numa_matrix || config.loaded_latency || config.roofline || !config.sweep_str.empty() ||
+         !config.io_dir.empty() || config.prefetch_str == "sweep" || config.core_to_core || config.atomics ||
+         config.contention || !config.duration_str.empty() || config.calibrate || !config.trace_path.empty() ||
+         !config.allocators_str.empty() || config.mapping || config.tlb || config.rings || config.memcpy_sweep ||
+         config.memory_tiers || config.gpu)) {
+        throw ArgumentError("--energy is only supported in large-memory, cache-hierarchy and --threads sweep runs.");
+    }
+    // Page faults are reported on TestResult rows as well; NUMA runs bind anonymous memory
+    if (!config.file_dir.empty() &&
+        (config.numa_matrix || config.loaded_latency || config.roofline || !config.sweep_str.empty())) {
+        throw ArgumentError("--file is only supported in large-memory and cache-hierarchy runs.");
+    }
+    // Records, baselines and fleet runs carry TestResult fields; the other modes report their own curves and matrices
+    if (config.numa_matrix || config.loaded_latency || config.roofline || !config.sweep_str.empty() ||
+        !config.io_dir.empty() || config.prefetch_str == "sweep" || config.core_to_core || config.atomics ||
+        config.contention || !config.duration_str.empty() || !config.threads_str.empty() || config.calibrate ||
+        !config.trace_path.empty() || !config.allocators_str.empty() || config.mapping || config.tlb ||
+        config.rings || config.memcpy_sweep || config.memory_tiers || config.gpu) {
+        const std::pair<const char*, const std::string*> sinks[] = {{"--ndjson", &config.ndjson_path},
+                                                                    {"--save-baseline", &config.save_baseline_path},
+                                                                    {"--compare", &config.compare_path},
+                                                                    {"--coordinate", &config.coordinate_str}};
+        for (const auto& sink : sinks) {
+            if (!sink.second->empty()) {
+                throw ArgumentError(std::string(sink.first) +
+                                    " is only supported in large-memory and cache-hierarchy runs.");
+            }
+        }
+    }
+    // Extra arrays are placed by the modes that allocate per pattern
+    if (!config.streams_str.empty() &&
+        (config.loaded_latency || config.roofline || !config.sweep_str.empty() || !config.io_dir.empty())) {
+        throw ArgumentError("--streams is only supported in large-memory, cache-hierarchy and NUMA matrix runs.");
+    }
+    // The I/O comparison reads its own file with its own methods
+    if (!config.io_dir.empty() &&
+        (config.cache_hierarchy || config.numa_matrix || config.loaded_latency || config.roofline ||
+         !config.sweep_str.empty() || config.counters || !config.file_dir.empty())) {
+        throw ArgumentError("--io cannot be combined with other modes, --counters or --file.");
+    }
+    if (!config.io_dir.empty() && config.pattern_str != "all") {
+        throw ArgumentError("--io and --pattern are mutually exclusive. Use --io-methods to choose the read paths.");
+    }
+    if (config.loaded_latency && config.pattern_str != "all" && config.pattern_str != "sequential_read" &&
+        config.pattern_str != "sequential_write" && config.pattern_str != "copy") {
+        throw ArgumentError("Invalid load pattern '" + config.pattern_str +
+                           "'. Valid load patterns: all, sequential_read, sequential_write, copy");
+    }
 }
 
 std::vector<double> ArgumentParser::parse_memory_sizes(const std::string& size_str) {
@@ -262,7 +1496,11 @@ std::vector<double> ArgumentParser::parse_memory_sizes(const std::string& size_s
 }
 
 std::vector<std::string> ArgumentParser::get_supported_patterns() const {
-    return {"all", "sequential_read", "sequential_write", "random_read", "random_write", "copy", "triad", "matrix_multiply"};
+    std::vector<std::string> patterns = {"all"};
+    for (const auto& name : PatternRegistry::names()) {
+        patterns.push_back(name);
+    }
+    return patterns;
 }
 
 std::vector<std::string> ArgumentParser::get_supported_formats() const {
@@ -300,9 +1538,50 @@ void ArgumentParser::print_help() const {
     std::cout << "\nExamples:\n";
     std::cout << "  " << program_name_ << " --large-memory --size 8 --iterations 5\n";
     std::cout << "  " << program_name_ << " --cache-hierarchy --pattern sequential_read\n";
+    std::cout << "  " << program_name_ << " --cache-hierarchy --time-budget 0.5\n";
+    std::cout << "  " << program_name_ << " --pattern copy --kernel=scalar\n";
+    std::cout << "  " << program_name_ << " --pattern sequential_write --stores temporal,nontemporal\n";
+    std::cout << "  " << program_name_ << " --pattern matrix_multiply --precision all --size 1\n";
+    std::cout << "  " << program_name_ << " --numa-matrix --pattern sequential_read --size 4\n";
+    std::cout << "  " << program_name_ << " --loaded-latency --pattern copy --threads 8 --size 4\n";
+    std::cout << "  " << program_name_ << " --contention --pattern latency_chase --aggressor random_read --threads 8\n";
+    std::cout << "  " << program_name_ << " --duration 24h --pattern sequential_read --format csv\n";
+    std::cout << "  " << program_name_ << " --cache-hierarchy --compare baseline.json\n";
+    std::cout << "  " << program_name_ << " --agent 7531\n";
+    std::cout << "  " << program_name_ << " --coordinate node1,node2,node3:7600 --pattern sequential_read --size 4\n";
+    std::cout << "  " << program_name_ << " --calibrate --size 4\n";
+    std::cout << "  " << program_name_ << " --tune --size 2\n";
+    std::cout << "  " << program_name_ << " --roofline --precision fp64,bf16 --format json\n";
+    std::cout << "  " << program_name_ << " --sweep=log2:4 --size 1\n";
+    std::cout << "  " << program_name_ << " --pattern copy --counters --format json\n";
+    std::cout << "  " << program_name_ << " --pattern sequential_read --threads sweep --energy\n";
+    std::cout << "  " << program_name_ << " --cache-hierarchy --cold flush\n";
+    std::cout << "  " << program_name_ << " --pattern sequential_read --file /dev/shm --madvise sequential --file-cache cold\n";
+    std::cout << "  " << program_name_ << " --io /var/tmp --io-block 128k --io-depth 1,8,32 --size 1\n";
+    std::cout << "  " << program_name_ << " --mapping --size 2 --threads 1,8,64\n";
+    std::cout << "  " << program_name_ << " --tlb --tlb-pages 4k,2m --size 4\n";
+    std::cout << "  " << program_name_ << " --rings --cpus 0-3,64 --ring-payload 64,4k --iterations 5\n";
+    std::cout << "  " << program_name_ << " --memcpy --memcpy-sizes 64-64k --memcpy-impls libc,rep,avx2 --memcpy-ops copy\n";
+    std::cout << "  " << program_name_ << " --tiers --pattern sequential_read --size 4 --tier-ratios 1:0,4:1,2:1,1:1,0:1\n";
+    std::cout << "  " << program_name_ << " --gpu --gpu-kernels copy,triad --size 2 --threads 4\n";
+    std::cout << "  " << program_name_ << " --trace service.trace --trace-convert perf:perf-mem.txt\n";
+    std::cout << "  " << program_name_ << " --trace service.trace --threads 8 --iterations 20\n";
+    std::cout << "  " << program_name_ << " --allocators system,arena,pool,lib:/usr/lib/libjemalloc.so.2 --threads 1,4,16\n";
+    std::cout << "  " << program_name_ << " --pattern latency_chase --chase page --size 1\n";
+    std::cout << "  " << program_name_ << " --pattern streams --streams 8:2 --size 2\n";
+    std::cout << "  " << program_name_ << " --pattern gather --element 8 --index zipf:0.99 --size 1\n";
+    std::cout << "  " << program_name_ << " --cache-hierarchy --pattern decode_dict --bits 12\n";
+    std::cout << "  " << program_name_ << " --cache-hierarchy --pattern hash_probe --probe linear --load-factor 0.9\n";
+    std::cout << "  " << program_name_ << " --cache-hierarchy --pattern spmv_sell --matrix powerlaw --row-nnz 32\n";
+    std::cout << "  " << program_name_ << " --pattern random_read --pages 2m --size 2\n";
+    std::cout << "  " << program_name_ << " --core-to-core --cpus 0-15 --threads 8\n";
+    std::cout << "  " << program_name_ << " --atomics --threads 16\n";
+    std::cout << "  " << program_name_ << " --threads sweep --placement scatter --pattern sequential_read --size 4\n";
+    std::cout << "  " << program_name_ << " --prefetch sweep --hw-prefetch both --pattern sequential_read --size 1\n";
     
     if (platform_ && platform_->supports_cpu_affinity()) {
-        if (platform_->get_platform_name() == "macOS") {
+        if (platform_->get_platform_name() == "macOS" ||
+            platform_->get_max_threads_for_affinity(CPUAffinityType::E_CORES) > 0) {
             std::cout << "  " << program_name_ << " --cache-hierarchy --p-cores\n";
             std::cout << "  " << program_name_ << " --large-memory --e-cores --threads 4\n";
         }
@@ -18,10 +18,88 @@ struct BenchmarkConfig {
     // Test configuration
     std::vector<double> memory_sizes_gb;
     size_t iterations;
+    bool iterations_set;        // --iterations given: fixed counts instead of calibration
+    double time_budget_seconds;
+    bool time_budget_set;
     size_t num_threads;
+    std::string threads_str;    // --threads sweep or LIST: scaling sweep up to num_threads, empty for one count
+    std::string placement_str;  // --placement compact or scatter, empty when not given (thread i on CPU i)
     std::string pattern_str;
+    std::string streams_str;    // --streams R:W, empty when not given (the streams pattern then uses 4:1)
+    std::string element_str;    // --element BYTES of sparse patterns, empty when not given (8)
+    std::string stride_str;     // --stride BYTES of the strided pattern, empty when not given (64)
+    std::string index_str;      // --index distribution of gather/scatter, empty when not given (uniform)
+    std::string bits_str;       // --bits width of the decode patterns, empty when not given (8)
+    std::string probe_str;      // --probe linear or group of hash_probe, empty when not given (group)
+    std::string load_factor_str; // --load-factor of hash_probe, empty when not given (0.75)
+    std::string hash_batch_str; // --hash-batch lookups of hash_probe, empty when not given (16)
+    std::string merge_ways_str; // --merge-ways runs of merge, empty when not given (8)
+    std::string matrix_str;     // --matrix banded or powerlaw of the SpMV patterns, empty when not given (banded)
+    std::string row_nnz_str;    // --row-nnz nonzeros per row of the SpMV patterns, empty when not given (16)
+    std::string stencil_block_str; // --stencil-block tile rows of stencil, empty when not given (unblocked)
+    std::string cold_str;       // --cold flush or evict, empty when passes run warm
+    std::string prefetch_str;   // --prefetch BYTES or sweep, empty when not given (no software prefetch)
+    std::string hw_prefetch_str; // --hw-prefetch on, off or both
     bool cache_hierarchy;
+    bool numa_matrix;
+    bool loaded_latency;
+    bool roofline;
+    bool core_to_core;          // --core-to-core: ping-pong matrix and false sharing
+    std::string cpus_str;       // --cpus LIST of the core-to-core matrix or the ring pairs, empty when not given (every online CPU)
+    bool atomics;               // --atomics: fetch_add and CAS throughput from 1 to --threads threads
+    std::string allocators_str;      // --allocators LIST: allocator benchmark (empty: not run)
+    std::string alloc_workloads_str; // --alloc-workloads of the allocator benchmark
+    bool contention;            // --contention: victim slowdown under a throttled aggressor group
+    std::string aggressor_str;  // --aggressor traffic of the contention aggressors
+    size_t victim_threads;      // --victim-threads: victims of the contention mode, aggressors are the rest
+    std::string resctrl_victim_str;     // --resctrl-victim SCHEMATA, empty when not given (no resctrl group)
+    std::string resctrl_aggressor_str;  // --resctrl-aggressor SCHEMATA, empty when not given
+    std::string sweep_str;      // --sweep=log2:STEPS, empty when not sweeping
+    std::string duration_str;   // --duration soak length per pattern, empty when not soaking
+    std::string sample_interval_str;  // --sample-interval MS of the soak sampler
+    bool counters;              // Hardware counters around each measured region
+    bool energy;                // Package and DRAM energy around each measured region
+    std::string file_dir;       // --file DIR: buffers map a temporary file there (empty: anonymous memory)
+    bool file_populate;         // --file-populate: MAP_POPULATE the file mapping
+    std::string madvise_str;    // --madvise, empty when not given
+    std::string file_cache_str; // --file-cache, empty when not given
+    std::string io_dir;         // --io DIR: I/O-path comparison over a file there (empty: not run)
+    std::string io_methods_str;
+    std::string io_block_str;
+    std::string io_depth_str;
+    bool mapping;               // --mapping: page-fault, reclaim and unmap costs of fresh --size mappings
+    std::string mapping_ops_str;  // --mapping-ops of the mapping mode
+    bool tlb;                   // --tlb: page-stride chase over increasing page counts per page size
+    std::string tlb_pages_str;  // --tlb-pages of the TLB reach mode
+    bool rings;                 // --rings: SPSC/MPMC ring transfers between every pair of --cpus
+    std::string ring_payload_str;  // --ring-payload sizes of the ring mode
+    std::string ring_kinds_str;    // --ring-kinds of the ring mode
+    bool memcpy_sweep;          // --memcpy: memcpy/memset implementations over a ladder of size classes
+    std::string memcpy_sizes_str;  // --memcpy-sizes MIN-MAX of the copy sweep
+    std::string memcpy_impls_str;  // --memcpy-impls of the copy sweep
+    std::string memcpy_align_str;  // --memcpy-align SRC:DST offsets of the copy sweep
+    std::string memcpy_ops_str;    // --memcpy-ops of the copy sweep
+    bool memory_tiers;          // --tiers: local, far (CXL) and interleaved placement at each --tier-ratios ratio
+    std::string tier_ratios_str;   // --tier-ratios LOCAL:FAR page ratios of the tier curve
+    bool gpu;                   // --gpu: GPU kernels over unified memory, alone and against CPU traffic
+    std::string gpu_kernels_str;   // --gpu-kernels of the GPU run
+    std::string trace_path;     // --trace FILE: replay the access trace there (empty: not run)
+    std::string trace_convert_str;  // --trace-convert perf:FILE or histogram:FILE written to --trace, empty when not converting
     std::string format_str;
+    std::string ndjson_path;    // --ndjson FILE: append one record per result there (empty: no records)
+    std::string save_baseline_path;  // --save-baseline FILE: store this host's results there (empty: not stored)
+    std::string compare_path;   // --compare FILE: compare the results with the baseline there (empty: no comparison)
+    std::string agent_port_str; // --agent PORT: serve fleet runs on that port (empty: not an agent)
+    std::string coordinate_str; // --coordinate HOST[:PORT],...: run on those agents (empty: run here)
+    bool calibrate;             // --calibrate: measure this host's practical peak and store it in the peak file
+    bool tune;                  // --tune: find the fastest read, write and triad loop shapes per level and store them in the peak file
+    std::string peak_file;      // --peak-file FILE of calibrated peaks, empty when not given (PeakCalibration::default_path())
+    std::string system_cache;   // --system-cache FILE of this boot's system probe, empty when not given (detect every run)
+    std::string kernel_str;
+    std::string store_policy_str;
+    std::string chase_str;
+    std::string pages_str;
+    std::string precision_str;
     CPUAffinityType cpu_affinity;
     
     // Flags
@@ -32,10 +110,88 @@ struct BenchmarkConfig {
     BenchmarkConfig() 
         : memory_sizes_gb({BenchmarkConstants::DEFAULT_MEMORY_SIZE_GB})
         , iterations(BenchmarkConstants::DEFAULT_ITERATIONS)
+        , iterations_set(false)
+        , time_budget_seconds(BenchmarkConstants::CALIBRATION_TIME_BUDGET_SECONDS)
+        , time_budget_set(false)
         , num_threads(0)  // Will be set to hardware_concurrency if 0
+        , threads_str("")
+        , placement_str("")
         , pattern_str("all")
+        , streams_str("")
+        , element_str("")
+        , stride_str("")
+        , index_str("")
+        , bits_str("")
+        , probe_str("")
+        , load_factor_str("")
+        , hash_batch_str("")
+        , merge_ways_str("")
+        , matrix_str("")
+        , row_nnz_str("")
+        , stencil_block_str("")
+        , cold_str("")
+        , prefetch_str("")
+        , hw_prefetch_str("on")
         , cache_hierarchy(false)
+        , numa_matrix(false)
+        , loaded_latency(false)
+        , roofline(false)
+        , core_to_core(false)
+        , cpus_str("")
+        , atomics(false)
+        , allocators_str("")
+        , alloc_workloads_str("all")
+        , contention(false)
+        , aggressor_str("sequential_write")
+        , victim_threads(1)
+        , resctrl_victim_str("")
+        , resctrl_aggressor_str("")
+        , sweep_str("")
+        , duration_str("")
+        , sample_interval_str(std::to_string(BenchmarkConstants::SOAK_DEFAULT_INTERVAL_MS))
+        , counters(false)
+        , energy(false)
+        , file_dir("")
+        , file_populate(false)
+        , madvise_str("")
+        , file_cache_str("")
+        , io_dir("")
+        , io_methods_str("all")
+        , io_block_str("4k,128k,1m")
+        , io_depth_str("1,32")
+        , mapping(false)
+        , mapping_ops_str("all")
+        , tlb(false)
+        , tlb_pages_str("4k,2m,1g")
+        , rings(false)
+        , ring_payload_str("64,1k,16k")
+        , ring_kinds_str("spsc,mpmc")
+        , memcpy_sweep(false)
+        , memcpy_sizes_str("16-64m")
+        , memcpy_impls_str("all")
+        , memcpy_align_str("0:0,1:0,0:1")
+        , memcpy_ops_str("copy,set")
+        , memory_tiers(false)
+        , tier_ratios_str("1:0,3:1,2:1,1:1,1:2,1:3,0:1")
+        , gpu(false)
+        , gpu_kernels_str("all")
+        , trace_path("")
+        , trace_convert_str("")
         , format_str("markdown")
+        , ndjson_path("")
+        , save_baseline_path("")
+        , compare_path("")
+        , agent_port_str("")
+        , coordinate_str("")
+        , calibrate(false)
+        , tune(false)
+        , peak_file("")
+        , system_cache("")
+        , kernel_str("auto")
+        , store_policy_str("temporal")
+        , chase_str("random")
+        , pages_str("default")
+        , precision_str("fp32")
         , cpu_affinity(CPUAffinityType::DEFAULT)
         , help_requested(false)
         , show_info(false) {}
@@ -87,6 +243,37 @@ private:
     void validate_memory_sizes(const BenchmarkConfig& config);
     void validate_pattern(const BenchmarkConfig& config);
     void validate_format(const BenchmarkConfig& config);
+    void validate_kernel(const BenchmarkConfig& config);
+    void validate_store_policy(const BenchmarkConfig& config);
+    void validate_chase(const BenchmarkConfig& config);
+    void validate_pages(const BenchmarkConfig& config);
+    void validate_precision(const BenchmarkConfig& config);
+    void validate_sweep(const BenchmarkConfig& config);
+    void validate_file_backing(const BenchmarkConfig& config);
+    void validate_io(const BenchmarkConfig& config);
+    void validate_mapping(const BenchmarkConfig& config);
+    void validate_tlb(const BenchmarkConfig& config);
+    void validate_rings(const BenchmarkConfig& config);
+    void validate_memcpy(const BenchmarkConfig& config);
+    void validate_tiers(const BenchmarkConfig& config);
+    void validate_gpu(const BenchmarkConfig& config);
+    void validate_fleet(const BenchmarkConfig& config);
+    void validate_streams(const BenchmarkConfig& config);
+    void validate_access(const BenchmarkConfig& config);
+    void validate_decode(const BenchmarkConfig& config);
+    void validate_proxy(const BenchmarkConfig& config);
+    void validate_irregular(const BenchmarkConfig& config);
+    void validate_cold(const BenchmarkConfig& config);
+    void validate_prefetch(const BenchmarkConfig& config);
+    void validate_core_to_core(const BenchmarkConfig& config);
+    void validate_atomics(const BenchmarkConfig& config);
+    void validate_allocators(const BenchmarkConfig& config);
+    void validate_calibrate(const BenchmarkConfig& config);
+    void validate_tune(const BenchmarkConfig& config);
+    void validate_contention(const BenchmarkConfig& config);
+    void validate_soak(const BenchmarkConfig& config);
+    void validate_trace(const BenchmarkConfig& config);
+    void validate_thread_sweep(const BenchmarkConfig& config);
     void validate_mode_compatibility(const BenchmarkConfig& config);
     
     // Helper methods
@@ -0,0 +1,250 @@
+#include "atomic_tests.h"
+#include "cpu_features.h"
+#include "errors.h"
+#include "worker_pool.h"
+
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <cstdint>
+#include <thread>
+
+namespace AtomicTests {
+
+namespace {
+
+using Clock = std::chrono::steady_clock;
+using Kernel = void (*)(std::atomic<uint64_t>* counter, size_t ops);
+
+struct alignas(CoherenceTests::PADDED_SLOT_BYTES) PaddedCounter {
+    std::atomic<uint64_t> value{0};
+};
+
+template <Operation OP, bool SEQ_CST>
+void std_kernel(std::atomic<uint64_t>* counter, size_t ops) {
+    constexpr std::memory_order order = SEQ_CST ? std::memory_order_seq_cst : std::memory_order_relaxed;
+    for (size_t i = 0; i < ops; ++i) {
+        if constexpr (OP == Operation::FETCH_ADD) {
+            counter->fetch_add(1, order);
+        } else {
+            uint64_t expected = counter->load(std::memory_order_relaxed);
+            while (!counter->compare_exchange_weak(expected, expected + 1, order, std::memory_order_relaxed)) {
+            }
+        }
+    }
+}
+
+#if defined(__aarch64__)
+// The instructions are spelled out so neither -march nor -moutline-atomics can change what is measured.
+// Acquire-release forms (LDADDAL, CASAL, LDAXR/STLXR) are what compilers emit for seq_cst.
+
+template <Operation OP, bool SEQ_CST>
+void lse_kernel(std::atomic<uint64_t>* counter, size_t ops) {
+    uint64_t* p = reinterpret_cast<uint64_t*>(counter);
+    const uint64_t one = 1;
+    for (size_t i = 0; i < ops; ++i) {
+        if constexpr (OP == Operation::FETCH_ADD) {
+            uint64_t old;
+            if constexpr (SEQ_CST) {
+                asm volatile(".arch_extension lse\n\tldaddal %x[inc], %x[old], [%x[ptr]]"
+                             : [old] "=r"(old) : [inc] "r"(one), [ptr] "r"(p) : "memory");
+            } else {
+                asm volatile(".arch_extension lse\n\tldadd %x[inc], %x[old], [%x[ptr]]"
+                             : [old] "=r"(old) : [inc] "r"(one), [ptr] "r"(p) : "memory");
+            }
+        } else {
+            uint64_t expected = __atomic_load_n(p, __ATOMIC_RELAXED);
+            for (;;) {
+                uint64_t seen = expected;
+                if constexpr (SEQ_CST) {
+                    asm volatile(".arch_extension lse\n\tcasal %x[seen], %x[desired], [%x[ptr]]"
+                                 : [seen] "+r"(seen) : [desired] "r"(expected + 1), [ptr] "r"(p) : "memory");
+                } else {
+                    asm volatile(".arch_extension lse\n\tcas %x[seen], %x[desired], [%x[ptr]]"
+                                 : [seen] "+r"(seen) : [desired] "r"(expected + 1), [ptr] "r"(p) : "memory");
+                }
+                if (seen == expected) break;
+                expected = seen;
+            }
+        }
+    }
+}
+
+template <Operation OP, bool SEQ_CST>
+void llsc_kernel(std::atomic<uint64_t>* counter, size_t ops) {
+    uint64_t* p = reinterpret_cast<uint64_t*>(counter);
+    for (size_t i = 0; i < ops; ++i) {
+        if constexpr (OP == Operation::FETCH_ADD) {
+            uint64_t value;
+            uint32_t status;
+            if constexpr (SEQ_CST) {
+                asm volatile("1:\n\tldaxr %x[value], [%x[ptr]]\n\tadd %x[value], %x[value], #1\n\t"
+                             "stlxr %w[status], %x[value], [%x[ptr]]\n\tcbnz %w[status], 1b"
+                             : [value] "=&r"(value), [status] "=&r"(status) : [ptr] "r"(p) : "memory");
+            } else {
+                asm volatile("1:\n\tldxr %x[value], [%x[ptr]]\n\tadd %x[value], %x[value], #1\n\t"
+                             "stxr %w[status], %x[value], [%x[ptr]]\n\tcbnz %w[status], 1b"
+                             : [value] "=&r"(value), [status] "=&r"(status) : [ptr] "r"(p) : "memory");
+            }
+        } else {
+            // One weak compare-exchange per attempt: a mismatch or a lost reservation retries
+            uint64_t expected = __atomic_load_n(p, __ATOMIC_RELAXED);
+            for (;;) {
+                uint64_t seen;
+                uint32_t status = 1;
+                if constexpr (SEQ_CST) {
+                    asm volatile("ldaxr %x[seen], [%x[ptr]]\n\tcmp %x[seen], %x[expected]\n\tb.ne 1f\n\t"
+                                 "stlxr %w[status], %x[desired], [%x[ptr]]\n1:"
+                                 : [seen] "=&r"(seen), [status] "+r"(status)
+                                 : [expected] "r"(expected), [desired] "r"(expected + 1), [ptr] "r"(p)
+                                 : "memory", "cc");
+                } else {
+                    asm volatile("ldxr %x[seen], [%x[ptr]]\n\tcmp %x[seen], %x[expected]\n\tb.ne 1f\n\t"
+                                 "stxr %w[status], %x[desired], [%x[ptr]]\n1:"
+                                 : [seen] "=&r"(seen), [status] "+r"(status)
+                                 : [expected] "r"(expected), [desired] "r"(expected + 1), [ptr] "r"(p)
+                                 : "memory", "cc");
+                }
+                if (seen == expected && status == 0) break;
+                expected = seen;
+            }
+        }
+    }
+}
+#endif  // __aarch64__
+
+template <Operation OP, bool SEQ_CST>
+Kernel kernel_for(Implementation impl) {
+    switch (impl) {
+        case Implementation::STD:
+            return std_kernel<OP, SEQ_CST>;
+#if defined(__aarch64__)
+        case Implementation::LSE:
+            return lse_kernel<OP, SEQ_CST>;
+        case Implementation::LLSC:
+            return llsc_kernel<OP, SEQ_CST>;
+#endif
+        default:
+            return nullptr;
+    }
+}
+
+Kernel select_kernel(const Config& config) {
+    bool seq_cst = config.ordering == Ordering::SEQ_CST;
+    if (config.op == Operation::FETCH_ADD) {
+        return seq_cst ? kernel_for<Operation::FETCH_ADD, true>(config.impl)
+                       : kernel_for<Operation::FETCH_ADD, false>(config.impl);
+    }
+    return seq_cst ? kernel_for<Operation::CAS_LOOP, true>(config.impl)
+                   : kernel_for<Operation::CAS_LOOP, false>(config.impl);
+}
+
+}  // namespace
+
+std::string operation_to_string(Operation op) {
+    return op == Operation::FETCH_ADD ? "fetch_add" : "cas_loop";
+}
+
+std::string ordering_to_string(Ordering ordering) {
+    return ordering == Ordering::RELAXED ? "relaxed" : "seq_cst";
+}
+
+std::string sharing_to_string(Sharing sharing) {
+    return sharing == Sharing::SHARED ? "shared" : "private";
+}
+
+std::string implementation_to_string(Implementation impl) {
+    switch (impl) {
+        case Implementation::STD:
+            return "std";
+        case Implementation::LSE:
+            return "lse";
+        case Implementation::LLSC:
+            return "llsc";
+    }
+    return "std";
+}
+
+std::string describe_std_atomics() {
+#if defined(__x86_64__) || defined(__i386__)
+    return "lock prefix";
+#elif defined(__aarch64__) && defined(__ARM_FEATURE_ATOMICS)
+    return "lse";
+#elif defined(__aarch64__)
+    // GCC 10+ defaults to -moutline-atomics, which defines no macro
+    return "ll/sc or outline helpers (no inline lse)";
+#else
+    return "compiler builtins";
+#endif
+}
+
+std::vector<Implementation> supported_implementations() {
+    std::vector<Implementation> impls = {Implementation::STD};
+#if defined(__aarch64__)
+    if (CpuFeatureDetection::get_cpu_features().lse) {
+        impls.push_back(Implementation::LSE);
+    }
+    impls.push_back(Implementation::LLSC);
+#endif
+    return impls;
+}
+
+Result run(const Config& config, const std::vector<size_t>& cpus, const CoherenceTests::PinFunction& pin) {
+    if (cpus.empty()) {
+        throw ConfigurationError("Atomic tests need at least one thread");
+    }
+    std::vector<Implementation> supported = supported_implementations();
+    Kernel kernel = select_kernel(config);
+    if (kernel == nullptr || std::find(supported.begin(), supported.end(), config.impl) == supported.end()) {
+        throw ConfigurationError("Atomic implementation '" + implementation_to_string(config.impl) +
+                                 "' is not supported on this CPU");
+    }
+
+    const size_t num_threads = cpus.size();
+    std::vector<PaddedCounter> counters(config.sharing == Sharing::SHARED ? 1 : num_threads);
+    SpinBarrier barrier(num_threads);
+    std::vector<double> seconds(num_threads, 0.0);
+    std::vector<std::thread> threads;
+    for (size_t t = 0; t < num_threads; ++t) {
+        threads.emplace_back([&, t] {
+            if (pin) {
+                pin(cpus[t]);
+            }
+            std::atomic<uint64_t>* counter = &counters[config.sharing == Sharing::SHARED ? 0 : t].value;
+            barrier.arrive_and_wait();
+            auto start = Clock::now();
+            kernel(counter, config.ops_per_thread);
+            seconds[t] = std::chrono::duration<double>(Clock::now() - start).count();
+        });
+    }
+    for (auto& thread : threads) {
+        thread.join();
+    }
+
+    Result result;
+    result.config = config;
+    result.num_threads = num_threads;
+    result.seconds = *std::max_element(seconds.begin(), seconds.end());
+    if (config.ops_per_thread > 0 && result.seconds > 0.0) {
+        result.total_mops = static_cast<double>(config.ops_per_thread * num_threads) / result.seconds / 1e6;
+        result.ns_per_op = result.seconds * 1e9 / static_cast<double>(config.ops_per_thread);
+    }
+    uint64_t per_counter = config.ops_per_thread * (config.sharing == Sharing::SHARED ? num_threads : 1);
+    result.verified = std::all_of(counters.begin(), counters.end(), [per_counter](const PaddedCounter& counter) {
+        return counter.value.load(std::memory_order_relaxed) == per_counter;
+    });
+    return result;
+}
+
+std::vector<size_t> thread_counts(size_t max_threads) {
+    std::vector<size_t> counts;
+    for (size_t threads = 1; threads < max_threads; threads *= 2) {
+        counts.push_back(threads);
+    }
+    if (max_threads > 0) {
+        counts.push_back(max_threads);
+    }
+    return counts;
+}
+
+}  // namespace AtomicTests
@@ -0,0 +1,116 @@
+#ifndef ATOMIC_TESTS_H
+#define ATOMIC_TESTS_H
+
+#include <cstddef>
+#include <string>
+#include <vector>
+
+#include "coherence_tests.h"
+
+/**
+ * @brief Atomic read-modify-write throughput
+ *
+ * Lock-free structures are bounded by how fast a core can update one
+ * word, and by how that rate collapses once every core updates the same
+ * line. Each run has threads perform fetch_add or a compare_exchange
+ * increment loop, with relaxed or sequentially consistent ordering, on a
+ * shared line or on one private line per thread. On aarch64 the same loops
+ * also run as explicit LSE instructions (LDADD, CAS) and as LL/SC
+ * exclusive-pair loops, next to what std::atomic was compiled to, so a
+ * build that lost LSE shows up as a std::atomic row matching LL/SC.
+ */
+namespace AtomicTests {
+
+/**
+ * @brief Read-modify-write performed per operation
+ */
+enum class Operation {
+    FETCH_ADD,  ///< One fetch_add(1)
+    CAS_LOOP    ///< compare_exchange_weak(expected, expected + 1) until it succeeds
+};
+
+/**
+ * @brief Memory ordering of the read-modify-write
+ */
+enum class Ordering {
+    RELAXED,
+    SEQ_CST
+};
+
+/**
+ * @brief Where each thread's counter lives
+ */
+enum class Sharing {
+    SHARED,   ///< All threads update one counter
+    PRIVATE   ///< Each thread updates its own counter on its own line
+};
+
+/**
+ * @brief Instructions the operation is issued as
+ */
+enum class Implementation {
+    STD,   ///< std::atomic as compiled (lock-prefixed on x86; LSE, outline helpers or LL/SC on aarch64)
+    LSE,   ///< aarch64 LDADD / CAS (needs CpuFeatures::lse)
+    LLSC   ///< aarch64 LDXR/STXR exclusive-pair loop
+};
+
+std::string operation_to_string(Operation op);
+std::string ordering_to_string(Ordering ordering);
+std::string sharing_to_string(Sharing sharing);
+std::string implementation_to_string(Implementation impl);
+
+/**
+ * @brief How this build's std::atomic read-modify-writes reach the hardware
+ *
+ * "lock prefix" on x86; on aarch64 "lse" when the compiler targeted
+ * ARMv8.1-A or later, otherwise LL/SC or -moutline-atomics helpers, which
+ * the compiler does not tell apart (compare the std and lse rows).
+ */
+std::string describe_std_atomics();
+
+/**
+ * @brief Implementations this machine can run: STD, plus LSE (when supported) and LLSC on aarch64
+ */
+std::vector<Implementation> supported_implementations();
+
+/**
+ * @brief Parameters of one run
+ */
+struct Config {
+    Operation op = Operation::FETCH_ADD;
+    Ordering ordering = Ordering::RELAXED;
+    Sharing sharing = Sharing::SHARED;
+    Implementation impl = Implementation::STD;
+    size_t ops_per_thread = 0;
+};
+
+/**
+ * @brief Outcome of one run
+ */
+struct Result {
+    Config config;
+    size_t num_threads = 0;
+    double seconds = 0.0;      ///< Wall time of the slowest thread
+    double total_mops = 0.0;   ///< Operations per second over all threads, in millions
+    double ns_per_op = 0.0;    ///< Per thread: seconds / ops_per_thread
+    bool verified = false;     ///< Counters hold exactly the operations performed
+};
+
+/**
+ * @brief Run one configuration on one thread per CPU entry
+ *
+ * @param config Operation, ordering, sharing, implementation and count
+ * @param cpus CPU of each thread
+ * @param pin Pins each thread (empty: no pinning)
+ * @throws ConfigurationError if cpus is empty or the implementation is not supported here
+ */
+Result run(const Config& config, const std::vector<size_t>& cpus, const CoherenceTests::PinFunction& pin);
+
+/**
+ * @brief Thread counts of a scaling run: powers of two up to max_threads, then max_threads itself
+ */
+std::vector<size_t> thread_counts(size_t max_threads);
+
+}  // namespace AtomicTests
+
+#endif  // ATOMIC_TESTS_H
@@ -0,0 +1,327 @@
+#include "baseline.h"
+#include "constants.h"
+#include "errors.h"
+#include "json.h"
+#include "output_formatter.h"
+#include "sample_stats.h"
+
+#include <algorithm>
+#include <cmath>
+#include <cstdio>
+#include <fstream>
+#include <sstream>
+
+namespace Baseline {
+
+namespace {
+
+double median_or(const std::vector<double>& samples, double fallback) {
+    return samples.empty() ? fallback : SampleStats::summarize(samples).median;
+}
+
+std::string entry_to_json(const Entry& entry) {
+    std::vector<std::string> samples;
+    for (double sample : entry.samples) {
+        samples.push_back(Json::number(sample));
+    }
+    return Json::Object()
+        .add_string("test_name", entry.test_name)
+        .add_string("working_set", entry.working_set)
+        .add_string("kernel", entry.kernel)
+        .add_string("store_policy", entry.store_policy)
+        .add_count("threads", entry.threads)
+        .add_number("bandwidth_gbps", entry.bandwidth_gbps)
+        .add_raw("samples", Json::array(samples))
+        .str();
+}
+
+size_t get_count(const Json::Value& value, const std::string& key) {
+    return static_cast<size_t>(std::max(0.0, value.get_number(key)));
+}
+
+Entry entry_from_json(const Json::Value& value) {
+    Entry entry;
+    entry.test_name = value.get_string("test_name");
+    entry.working_set = value.get_string("working_set");
+    entry.kernel = value.get_string("kernel");
+    entry.store_policy = value.get_string("store_policy");
+    entry.threads = get_count(value, "threads");
+    entry.bandwidth_gbps = value.get_number("bandwidth_gbps");
+    if (const Json::Value* samples = value.find("samples")) {
+        for (const auto& sample : samples->items) {
+            if (sample.type == Json::Value::Type::NUMBER) {
+                entry.samples.push_back(sample.number);
+            }
+        }
+    }
+    return entry;
+}
+
+template <typename T>
+void note_change(std::vector<std::string>& differences, const std::string& field, const T& before, const T& after) {
+    if (before != after) {
+        std::stringstream ss;
+        ss << field << ": " << before << " -> " << after;
+        differences.push_back(ss.str());
+    }
+}
+
+}  // namespace
+
+std::string Entry::key() const {
+    return test_name + "|" + working_set + "|" + kernel + "|" + store_policy + "|" + std::to_string(threads);
+}
+
+std::string host_key(const Ndjson::HostFingerprint& host, const std::string& pages) {
+    return host.cpu_name + "|" + host.memory_type + "|" + std::to_string(host.memory_speed_mtps) + "|" +
+           std::to_string(host.memory_channels) + "|" + host.os_release + "|" + pages;
+}
+
+Entry entry_from(const TestResult& result) {
+    Entry entry;
+    entry.test_name = result.test_name;
+    entry.working_set = result.working_set_desc;
+    entry.kernel = result.kernel_name;
+    entry.store_policy = result.store_policy;
+    entry.threads = result.num_threads;
+    entry.bandwidth_gbps = result.stats.bandwidth_gbps;
+    entry.samples = result.bandwidth_samples;
+    return entry;
+}
+
+Store load(const std::string& path) {
+    Store store;
+    std::ifstream file(path);
+    if (!file) {
+        return store;
+    }
+    std::stringstream text;
+    text << file.rdbuf();
+
+    Json::Value root;
+    try {
+        root = Json::parse(text.str());
+    } catch (const ConfigurationError& e) {
+        throw ConfigurationError("Baseline " + path + " is not valid JSON: " + e.what());
+    }
+    const Json::Value* hosts = root.find("hosts");
+    if (!root.find("baseline_version") || !hosts || hosts->type != Json::Value::Type::ARRAY) {
+        throw ConfigurationError("Baseline " + path + " has no baseline_version and hosts array");
+    }
+    double version = root.get_number("baseline_version");
+    if (version > static_cast<double>(BenchmarkConstants::BASELINE_VERSION)) {
+        throw ConfigurationError("Baseline " + path + " is version " + Json::number(version) +
+                                 "; this build reads up to version " +
+                                 std::to_string(BenchmarkConstants::BASELINE_VERSION));
+    }
+
+    for (const auto& item : hosts->items) {
+        HostBaseline host;
+        host.host_key = item.get_string("host_key");
+        host.pages = item.get_string("pages");
+        host.recorded = item.get_string("recorded");
+        if (const Json::Value* fingerprint = item.find("host")) {
+            host.host = Ndjson::host_from_json(*fingerprint);
+        }
+        if (const Json::Value* results = item.find("results")) {
+            for (const auto& result : results->items) {
+                host.entries.push_back(entry_from_json(result));
+            }
+        }
+        store.hosts.push_back(host);
+    }
+    return store;
+}
+
+void save(const std::string& path, const Store& store) {
+    std::string temporary = path + ".tmp";
+    {
+        std::ofstream file(temporary, std::ios::out | std::ios::trunc);
+        file << "{\n"
+             << "  \"baseline_version\": " << BenchmarkConstants::BASELINE_VERSION << ",\n"
+             << "  \"hosts\": [";
+        for (size_t h = 0; h < store.hosts.size(); ++h) {
+            const HostBaseline& host = store.hosts[h];
+            file << (h > 0 ? "," : "") << "\n"
+                 << "    {\n"
+                 << "      \"host_key\": " << Json::quote(host.host_key) << ",\n"
+                 << "      \"recorded\": " << Json::quote(host.recorded) << ",\n"
+                 << "      \"pages\": " << Json::quote(host.pages) << ",\n"
+                 << "      \"host\": " << Ndjson::host_to_json(host.host) << ",\n"
+                 << "      \"results\": [";
+            for (size_t i = 0; i < host.entries.size(); ++i) {
+                file << (i > 0 ? "," : "") << "\n        " << entry_to_json(host.entries[i]);
+            }
+            file << "\n      ]\n"
+                 << "    }";
+        }
+        file << "\n  ]\n"
+             << "}\n";
+        file.flush();
+        if (!file) {
+            std::remove(temporary.c_str());
+            throw ConfigurationError("Cannot write baseline " + temporary);
+        }
+    }
+    if (std::rename(temporary.c_str(), path.c_str()) != 0) {
+        std::remove(temporary.c_str());
+        throw ConfigurationError("Cannot replace baseline " + path);
+    }
+}
+
+void upsert(Store& store, const HostBaseline& host) {
+    store.hosts.erase(std::remove_if(store.hosts.begin(), store.hosts.end(),
+                                     [&](const HostBaseline& stored) { return stored.host_key == host.host_key; }),
+                      store.hosts.end());
+    store.hosts.push_back(host);
+}
+
+const HostBaseline* find_match(const Store& store, const HostBaseline& current,
+                               std::vector<std::string>& differences) {
+    differences.clear();
+    const HostBaseline* match = nullptr;
+    for (const auto& stored : store.hosts) {
+        if (stored.host_key == current.host_key) {
+            match = &stored;
+        }
+    }
+    // Later entries were saved later, so the last match is the most recent one
+    if (!match) {
+        for (const auto& stored : store.hosts) {
+            if (!current.host.hostname.empty() && stored.host.hostname == current.host.hostname) {
+                match = &stored;
+            }
+        }
+    }
+    if (!match) {
+        for (const auto& stored : store.hosts) {
+            if (stored.host.cpu_name == current.host.cpu_name) {
+                match = &stored;
+            }
+        }
+    }
+    if (match) {
+        const Ndjson::HostFingerprint& before = match->host;
+        const Ndjson::HostFingerprint& after = current.host;
+        note_change(differences, "hostname", before.hostname, after.hostname);
+        note_change(differences, "cpu_name", before.cpu_name, after.cpu_name);
+        note_change(differences, "os_release", before.os_release, after.os_release);
+        note_change(differences, "memory_type", before.memory_type, after.memory_type);
+        note_change(differences, "memory_speed_mtps", before.memory_speed_mtps, after.memory_speed_mtps);
+        note_change(differences, "memory_channels", before.memory_channels, after.memory_channels);
+        note_change(differences, "total_ram_gb", before.total_ram_gb, after.total_ram_gb);
+        note_change(differences, "cpu_threads", before.cpu_threads, after.cpu_threads);
+        note_change(differences, "pages", match->pages, current.pages);
+    }
+    return match;
+}
+
+MannWhitney mann_whitney(const std::vector<double>& a, const std::vector<double>& b) {
+    MannWhitney result;
+    size_t n1 = a.size();
+    size_t n2 = b.size();
+    if (n1 == 0 || n2 == 0) {
+        return result;
+    }
+
+    // Rank the pooled samples, giving tied values their mean rank
+    std::vector<std::pair<double, bool>> pooled;  // (value, from a)
+    for (double value : a) pooled.emplace_back(value, true);
+    for (double value : b) pooled.emplace_back(value, false);
+    std::sort(pooled.begin(), pooled.end(),
+              [](const auto& x, const auto& y) { return x.first < y.first; });
+
+    double rank_sum_a = 0.0;
+    double tie_term = 0.0;  // Sum of t^3 - t over tie groups
+    for (size_t i = 0; i < pooled.size();) {
+        size_t j = i;
+        while (j < pooled.size() && pooled[j].first == pooled[i].first) {
+            ++j;
+        }
+        double rank = (static_cast<double>(i + 1) + static_cast<double>(j)) / 2.0;
+        for (size_t k = i; k < j; ++k) {
+            if (pooled[k].second) {
+                rank_sum_a += rank;
+            }
+        }
+        double t = static_cast<double>(j - i);
+        tie_term += t * t * t - t;
+        i = j;
+    }
+
+    double n1d = static_cast<double>(n1);
+    double n2d = static_cast<double>(n2);
+    double n = n1d + n2d;
+    result.u = rank_sum_a - n1d * (n1d + 1.0) / 2.0;
+    double mean = n1d * n2d / 2.0;
+    double variance = n1d * n2d / 12.0 * ((n + 1.0) - tie_term / (n * (n - 1.0)));
+    if (variance <= 0.0) {
+        return result;  // Every sample is equal
+    }
+    double deviation = std::max(0.0, std::fabs(result.u - mean) - 0.5);
+    result.z = (result.u >= mean ? deviation : -deviation) / std::sqrt(variance);
+    result.p_value = std::erfc(std::fabs(result.z) / std::sqrt(2.0));
+    return result;
+}
+
+Comparison compare(const Entry* baseline, const Entry& current) {
+    Comparison comparison;
+    comparison.current = current;
+    comparison.current_gbps = median_or(current.samples, current.bandwidth_gbps);
+    if (!baseline) {
+        comparison.verdict = Verdict::NEW;
+        return comparison;
+    }
+    comparison.baseline_gbps = median_or(baseline->samples, baseline->bandwidth_gbps);
+    if (comparison.baseline_gbps > 0.0) {
+        comparison.change_percent =
+            (comparison.current_gbps - comparison.baseline_gbps) / comparison.baseline_gbps * 100.0;
+    }
+
+    comparison.tested = baseline->samples.size() >= BenchmarkConstants::BASELINE_MIN_SAMPLES &&
+                        current.samples.size() >= BenchmarkConstants::BASELINE_MIN_SAMPLES;
+    if (comparison.tested) {
+        comparison.p_value = mann_whitney(current.samples, baseline->samples).p_value;
+    }
+    bool beyond = std::fabs(comparison.change_percent) >= BenchmarkConstants::BASELINE_REGRESSION_PERCENT;
+    if (beyond && !comparison.tested) {
+        comparison.verdict = Verdict::INCONCLUSIVE;
+    } else if (!beyond || comparison.p_value >= BenchmarkConstants::BASELINE_SIGNIFICANCE) {
+        comparison.verdict = Verdict::UNCHANGED;
+    } else {
+        comparison.verdict = (comparison.change_percent < 0.0) ? Verdict::REGRESSED : Verdict::IMPROVED;
+    }
+    return comparison;
+}
+
+std::vector<Comparison> compare_all(const HostBaseline& baseline, const std::vector<Entry>& current) {
+    std::vector<Comparison> comparisons;
+    for (const auto& entry : current) {
+        const Entry* match = nullptr;
+        for (const auto& stored : baseline.entries) {
+            if (stored.key() == entry.key()) {
+                match = &stored;
+            }
+        }
+        comparisons.push_back(compare(match, entry));
+    }
+    return comparisons;
+}
+
+size_t count(const std::vector<Comparison>& comparisons, Verdict verdict) {
+    return static_cast<size_t>(std::count_if(comparisons.begin(), comparisons.end(),
+                                             [verdict](const Comparison& c) { return c.verdict == verdict; }));
+}
+
+std::string verdict_to_string(Verdict verdict) {
+    switch (verdict) {
+        case Verdict::UNCHANGED: return "unchanged";
+        case Verdict::IMPROVED: return "improved";
+        case Verdict::REGRESSED: return "regressed";
+        case Verdict::NEW: return "new";
+        case Verdict::INCONCLUSIVE: return "inconclusive";
+    }
+    return "unknown";
+}
+
+}  // namespace Baseline
@@ -0,0 +1,152 @@
+#ifndef BASELINE_H
+#define BASELINE_H
+
+#include <cstddef>
+#include <string>
+#include <vector>
+
+#include "ndjson_sink.h"
+
+struct TestResult;
+
+/**
+ * @brief Stored baselines and statistical regression checks (--save-baseline, --compare)
+ *
+ * A baseline file holds, per host, the results of one run together with
+ * their per-iteration bandwidth samples. Hosts are keyed by their
+ * fingerprint: CPU model, memory type, speed and channels, kernel release
+ * and requested page size, and saving again replaces the entry with the
+ * same key. A comparison matches each current result to the baseline
+ * result of the same test, working set, kernel, store policy and thread
+ * count, compares their median bandwidth and tests the two sample sets with
+ * a two-sided Mann-Whitney U test, so a drop only counts as a regression
+ * when it is both large and significant.
+ */
+namespace Baseline {
+
+/**
+ * @brief One stored or current result
+ */
+struct Entry {
+    std::string test_name;
+    std::string working_set;
+    std::string kernel;
+    std::string store_policy;
+    size_t threads = 0;
+    double bandwidth_gbps = 0.0;   ///< Reported bandwidth of the run
+    std::vector<double> samples;   ///< Per-iteration bandwidth samples of all threads (GB/s)
+
+    /**
+     * @brief Identity a current result is matched on ("Copy|1GB|avx2|temporal|8")
+     */
+    std::string key() const;
+};
+
+/**
+ * @brief Results of one host
+ */
+struct HostBaseline {
+    std::string host_key;
+    Ndjson::HostFingerprint host;
+    std::string pages;     ///< Requested page mode
+    std::string recorded;  ///< UTC time the results were measured
+    std::vector<Entry> entries;
+};
+
+/**
+ * @brief Contents of a baseline file
+ */
+struct Store {
+    std::vector<HostBaseline> hosts;
+};
+
+/**
+ * @brief Outcome of one current result against its baseline
+ */
+enum class Verdict {
+    UNCHANGED,  ///< Within the threshold, or not significant
+    IMPROVED,
+    REGRESSED,
+    NEW,        ///< No baseline result to compare with
+    INCONCLUSIVE  ///< Beyond the threshold, but too few samples to test
+};
+
+struct Comparison {
+    Entry current;
+    double baseline_gbps = 0.0;   ///< Median baseline sample (reported bandwidth without samples)
+    double current_gbps = 0.0;    ///< Median current sample
+    double change_percent = 0.0;
+    double p_value = 1.0;         ///< Mann-Whitney p-value (1 when not tested)
+    bool tested = false;          ///< Both sides had BASELINE_MIN_SAMPLES samples (else never regressed)
+    Verdict verdict = Verdict::NEW;
+};
+
+struct MannWhitney {
+    double u = 0.0;        ///< U statistic of the first sample set
+    double z = 0.0;        ///< Normal approximation with tie and continuity correction
+    double p_value = 1.0;  ///< Two-sided
+};
+
+/**
+ * @brief Key of a host: "cpu|memory type|MT/s|channels|kernel release|pages"
+ */
+std::string host_key(const Ndjson::HostFingerprint& host, const std::string& pages);
+
+/**
+ * @brief Stored form of a result
+ */
+Entry entry_from(const TestResult& result);
+
+/**
+ * @brief Read a baseline file; a file that does not exist yet is an empty store
+ * @throws ConfigurationError if the file is malformed or of a newer version
+ */
+Store load(const std::string& path);
+
+/**
+ * @brief Write a store, replacing the file only once it is complete
+ * @throws ConfigurationError if the file cannot be written
+ */
+void save(const std::string& path, const Store& store);
+
+/**
+ * @brief Add a host, replacing an entry with the same host key
+ */
+void upsert(Store& store, const HostBaseline& host);
+
+/**
+ * @brief Stored host a current run compares against
+ *
+ * The same host key if stored, otherwise the most recent entry of the same
+ * hostname, otherwise of the same CPU model: a kernel or BIOS update changes
+ * the key, and the comparison is what shows whether it mattered.
+ *
+ * @param differences Set to the fingerprint fields that changed ("memory_channels: 8 -> 4"),
+ *                    including the hostname when an identical host recorded the baseline
+ * @return nullptr if nothing matches
+ */
+const HostBaseline* find_match(const Store& store, const HostBaseline& current,
+                               std::vector<std::string>& differences);
+
+/**
+ * @brief Two-sided Mann-Whitney U test of two sample sets
+ */
+MannWhitney mann_whitney(const std::vector<double>& a, const std::vector<double>& b);
+
+/**
+ * @brief Compare a current result with its baseline result (nullptr: none)
+ */
+Comparison compare(const Entry* baseline, const Entry& current);
+
+/**
+ * @brief Compare every current result; baseline results not measured again are ignored
+ */
+std::vector<Comparison> compare_all(const HostBaseline& baseline, const std::vector<Entry>& current);
+
+size_t count(const std::vector<Comparison>& comparisons, Verdict verdict);
+
+std::string verdict_to_string(Verdict verdict);
+
+}  // namespace Baseline
+
+#endif  // BASELINE_H
@@ -0,0 +1,274 @@
+#ifndef BLOCKED_GEMM_H
+#define BLOCKED_GEMM_H
+
+#include "matrix_multiply_interface.h"
+#include "memory_types.h"
+
+#include <algorithm>
+#include <chrono>
+#include <cstddef>
+#include <cstring>
+#include <type_traits>
+#include <vector>
+
+/**
+ * @brief Cache-blocked GEMM driver shared by the SIMD matrix multipliers
+ *
+ * Computes C += A * B for row-major matrices using the usual three-level
+ * blocking: a KC x NC panel of B and an MC x KC block of A are packed into
+ * contiguous, zero-padded micro-panels, and an MR x NR register-blocked
+ * micro-kernel walks them. Platform code only supplies the micro-kernel.
+ *
+ * Operands may be stored in a narrower type than the kernel computes in
+ * (BF16/FP16 into FP32, INT8 into INT32); packing widens them, so the
+ * conversion cost is paid once per packed panel rather than per FMA.
+ */
+namespace MatrixMultiply {
+namespace BlockedGemm {
+
+/**
+ * @brief Micro-kernel: C[0..MR) x [0..NR) += packed A panel * packed B panel
+ *
+ * @param kc Depth of the panels
+ * @param a Packed A panel (kc groups of MR values)
+ * @param b Packed B panel (kc groups of NR values)
+ * @param c Top-left element of the C tile
+ * @param ldc Row stride of C in elements
+ */
+template <typename T>
+using MicroKernel = void (*)(size_t kc, const T* a, const T* b, T* c, size_t ldc);
+
+/**
+ * @brief Register and cache block sizes
+ */
+struct Blocking {
+    size_t mr;  ///< Micro-tile rows (registers)
+    size_t nr;  ///< Micro-tile columns (registers)
+    size_t mc;  ///< Rows of A per packed block (L2 resident)
+    size_t kc;  ///< Depth of packed panels (one B micro-panel stays in L1)
+    size_t nc;  ///< Columns of B per packed panel (L3 resident)
+};
+
+/**
+ * @brief Packing buffers reused across calls so timed loops never allocate
+ */
+template <typename T>
+struct Workspace {
+    std::vector<T> a;
+    std::vector<T> b;
+    std::vector<T> tile;
+};
+
+inline size_t round_up(size_t value, size_t multiple) {
+    return (value + multiple - 1) / multiple * multiple;
+}
+
+/**
+ * @brief Derive cache block sizes from the detected cache hierarchy
+ *
+ * KC keeps one KC x NR micro-panel of B in half of L1, MC keeps the packed
+ * MC x KC block of A in half of L2, and NC keeps the packed KC x NC panel
+ * of B in half of L3. Undetected (zero) sizes fall back to 32 KB / 1 MB /
+ * 8 MB.
+ */
+inline Blocking blocking_for_cache(const CacheInfo& cache, size_t mr, size_t nr, size_t element_size) {
+    size_t l1 = cache.l1_data_size > 0 ? cache.l1_data_size : 32 * 1024;
+    size_t l2 = cache.l2_size > 0 ? cache.l2_size : 1024 * 1024;
+    size_t l3 = cache.l3_size > 0 ? cache.l3_size : 8 * 1024 * 1024;
+
+    Blocking blocking;
+    blocking.mr = mr;
+    blocking.nr = nr;
+    blocking.kc = std::clamp<size_t>(l1 / 2 / (nr * element_size) / 8 * 8, 16, 1024);
+    blocking.mc = std::clamp<size_t>(l2 / 2 / (blocking.kc * element_size) / mr * mr, mr, 4096 / mr * mr);
+    blocking.nc = std::clamp<size_t>(l3 / 2 / (blocking.kc * element_size) / nr * nr, nr, 16384 / nr * nr);
+    return blocking;
+}
+
+/// Acceleration name of the portable path
+constexpr const char* PORTABLE_NAME = "Blocked portable";
+
+/**
+ * @brief Convert a stored operand to the compute type of the kernel
+ */
+template <typename T, typename In>
+inline T widen(In value) {
+    if constexpr (std::is_same_v<In, BFloat16> || std::is_same_v<In, Float16>) {
+        return static_cast<T>(to_float(value));
+    } else {
+        return static_cast<T>(value);
+    }
+}
+
+/// Register block of the portable micro-kernel
+constexpr size_t PORTABLE_MR = 4;
+constexpr size_t PORTABLE_NR = 16;
+
+/**
+ * @brief Portable 4x16 micro-kernel (fixed trip counts the compiler vectorizes)
+ */
+template <typename T>
+void portable_kernel(size_t kc, const T* a, const T* b, T* c, size_t ldc) {
+    T acc[PORTABLE_MR][PORTABLE_NR] = {};
+    for (size_t k = 0; k < kc; ++k) {
+        for (size_t i = 0; i < PORTABLE_MR; ++i) {
+            T ai = a[i];
+            for (size_t j = 0; j < PORTABLE_NR; ++j) {
+                acc[i][j] += ai * b[j];
+            }
+        }
+        a += PORTABLE_MR;
+        b += PORTABLE_NR;
+    }
+    for (size_t i = 0; i < PORTABLE_MR; ++i) {
+        for (size_t j = 0; j < PORTABLE_NR; ++j) {
+            c[i * ldc + j] += acc[i][j];
+        }
+    }
+}
+
+/**
+ * @brief Pack an mc x kc block of A into MR-row micro-panels (zero-padded)
+ */
+template <typename In, typename T>
+void pack_a(const In* A, size_t lda, size_t mc, size_t kc, size_t mr, T* packed) {
+    for (size_t i0 = 0; i0 < mc; i0 += mr) {
+        size_t rows = std::min(mr, mc - i0);
+        for (size_t k = 0; k < kc; ++k) {
+            for (size_t i = 0; i < rows; ++i) {
+                packed[i] = widen<T>(A[(i0 + i) * lda + k]);
+            }
+            for (size_t i = rows; i < mr; ++i) {
+                packed[i] = T(0);
+            }
+            packed += mr;
+        }
+    }
+}
+
+/**
+ * @brief Pack a kc x nc panel of B into NR-column micro-panels (zero-padded)
+ */
+template <typename In, typename T>
+void pack_b(const In* B, size_t ldb, size_t kc, size_t nc, size_t nr, T* packed) {
+    for (size_t j0 = 0; j0 < nc; j0 += nr) {
+        size_t cols = std::min(nr, nc - j0);
+        for (size_t k = 0; k < kc; ++k) {
+            const In* row = B + k * ldb + j0;
+            for (size_t j = 0; j < cols; ++j) {
+                packed[j] = widen<T>(row[j]);
+            }
+            for (size_t j = cols; j < nr; ++j) {
+                packed[j] = T(0);
+            }
+            packed += nr;
+        }
+    }
+}
+
+/**
+ * @brief C[M x N] += A[M x K] * B[K x N] (row-major, leading dimensions K, N, N)
+ *
+ * Full micro-tiles are accumulated straight into C; edge tiles go through a
+ * zeroed scratch tile and only their valid part is added back. A and B
+ * hold In elements and are widened to T while packing.
+ */
+template <typename T, typename In>
+void multiply(T* C, const In* A, const In* B, size_t M, size_t K, size_t N,
+              const Blocking& blocking, MicroKernel<T> kernel, Workspace<T>& workspace) {
+    const size_t mr = blocking.mr;
+    const size_t nr = blocking.nr;
+    workspace.a.resize(round_up(std::min(blocking.mc, M), mr) * blocking.kc);
+    workspace.b.resize(blocking.kc * round_up(std::min(blocking.nc, N), nr));
+    workspace.tile.resize(mr * nr);
+
+    for (size_t jc = 0; jc < N; jc += blocking.nc) {
+        size_t nc = std::min(blocking.nc, N - jc);
+        for (size_t pc = 0; pc < K; pc += blocking.kc) {
+            size_t kc = std::min(blocking.kc, K - pc);
+            pack_b(B + pc * N + jc, N, kc, nc, nr, workspace.b.data());
+
+            for (size_t ic = 0; ic < M; ic += blocking.mc) {
+                size_t mc = std::min(blocking.mc, M - ic);
+                pack_a(A + ic * K + pc, K, mc, kc, mr, workspace.a.data());
+
+                for (size_t jr = 0; jr < nc; jr += nr) {
+                    size_t cols = std::min(nr, nc - jr);
+                    const T* b_panel = workspace.b.data() + jr * kc;
+                    for (size_t ir = 0; ir < mc; ir += mr) {
+                        size_t rows = std::min(mr, mc - ir);
+                        const T* a_panel = workspace.a.data() + ir * kc;
+                        T* c = C + (ic + ir) * N + jc + jr;
+
+                        if (rows == mr && cols == nr) {
+                            kernel(kc, a_panel, b_panel, c, N);
+                            continue;
+                        }
+                        std::fill(workspace.tile.begin(), workspace.tile.end(), T(0));
+                        kernel(kc, a_panel, b_panel, workspace.tile.data(), nr);
+                        for (size_t i = 0; i < rows; ++i) {
+                            for (size_t j = 0; j < cols; ++j) {
+                                c[i * N + j] += workspace.tile[i * nr + j];
+                            }
+                        }
+                    }
+                }
+            }
+        }
+    }
+}
+
+/**
+ * @brief Run config.iterations blocked products into a zeroed C and time them
+ *
+ * Only completed iterations are counted, so a stop request mid-run still
+ * reports a consistent rate. Traffic counts A and B at their stored width
+ * and C at the accumulate width.
+ */
+template <typename T, typename In>
+MatrixPerformanceStats timed_multiply(T* C, const In* A, const In* B, const MatrixConfig& config,
+                                      const std::atomic<bool>& stop_flag, const Blocking& blocking,
+                                      MicroKernel<T> kernel, Workspace<T>& workspace,
+                                      const std::string& acceleration) {
+    const size_t M = config.M;
+    const size_t K = config.K;
+    const size_t N = config.N;
+
+    std::memset(C, 0, M * N * sizeof(T));
+
+    size_t completed = 0;
+    auto start_time = std::chrono::high_resolution_clock::now();
+
+    for (size_t iter = 0; iter < config.iterations && !stop_flag; ++iter) {
+        multiply(C, A, B, M, K, N, blocking, kernel, workspace);
+        ++completed;
+    }
+
+    auto end_time = std::chrono::high_resolution_clock::now();
+    double time_seconds = std::chrono::duration<double>(end_time - start_time).count();
+
+    size_t operations = 2 * M * N * K * completed;
+    size_t bytes_processed = ((M * K + K * N) * sizeof(In) + M * N * sizeof(T)) * completed;
+
+    return calculate_matrix_stats(bytes_processed, time_seconds, operations, acceleration);
+}
+
+/**
+ * @brief timed_multiply with the portable kernel and blocking derived from cache
+ *
+ * Pool workers are persistent, so each thread keeps its packing buffers
+ * between runs.
+ */
+template <typename T, typename In>
+MatrixPerformanceStats portable_multiply(T* C, const In* A, const In* B, const MatrixConfig& config,
+                                         const std::atomic<bool>& stop_flag, const CacheInfo& cache,
+                                         const std::string& acceleration) {
+    thread_local Workspace<T> workspace;
+    Blocking blocking = blocking_for_cache(cache, PORTABLE_MR, PORTABLE_NR, sizeof(T));
+    return timed_multiply(C, A, B, config, stop_flag, blocking, portable_kernel<T>, workspace, acceleration);
+}
+
+}  // namespace BlockedGemm
+}  // namespace MatrixMultiply
+
+#endif  // BLOCKED_GEMM_H
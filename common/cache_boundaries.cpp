@@ -0,0 +1,116 @@
+#include "cache_boundaries.h"
+
+#include <algorithm>
+#include <cmath>
+
+#include "constants.h"
+
+namespace CacheBoundaries {
+
+namespace {
+
+double median_of(std::vector<double> values) {
+    std::sort(values.begin(), values.end());
+    size_t mid = values.size() / 2;
+    return (values.size() % 2 == 1) ? values[mid] : (values[mid - 1] + values[mid]) / 2.0;
+}
+
+/**
+ * @brief Index of the unused knee nearest to a size (in log space), or -1
+ */
+long nearest_knee(const std::vector<Knee>& knees, const std::vector<bool>& used, size_t size) {
+    long best = -1;
+    double best_distance = std::log(BenchmarkConstants::SWEEP_MATCH_FACTOR);
+    for (size_t i = 0; i < knees.size(); ++i) {
+        if (used[i]) continue;
+        double distance = std::abs(std::log(static_cast<double>(knees[i].capacity_bytes) / size));
+        if (distance <= best_distance) {
+            best = static_cast<long>(i);
+            best_distance = distance;
+        }
+    }
+    return best;
+}
+
+}  // namespace
+
+std::vector<Knee> detect_knees(const std::vector<size_t>& sizes, const std::vector<double>& values, Curve curve) {
+    auto to_cost = [curve](double value) { return curve == Curve::LATENCY ? value : 1.0 / value; };
+    auto to_value = [curve](double cost) { return curve == Curve::LATENCY ? cost : 1.0 / cost; };
+
+    std::vector<Knee> knees;
+    std::vector<double> plateau;
+    bool in_plateau = true;
+    double previous_cost = 0.0;
+    size_t previous_size = 0;
+
+    for (size_t i = 0; i < sizes.size() && i < values.size(); ++i) {
+        if (!(values[i] > 0.0)) continue;
+        double cost = to_cost(values[i]);
+
+        if (plateau.empty() && in_plateau) {
+            plateau.push_back(cost);
+        } else if (in_plateau) {
+            double reference = median_of(plateau);
+            if (cost > reference * (1.0 + BenchmarkConstants::SWEEP_KNEE_THRESHOLD)) {
+                knees.push_back({previous_size, to_value(reference), 0.0});
+                in_plateau = false;
+            } else {
+                plateau.push_back(cost);
+            }
+        } else if (cost <= previous_cost * (1.0 + BenchmarkConstants::SWEEP_SETTLE_RATIO)) {
+            knees.back().after = to_value(cost);
+            plateau.assign(1, cost);
+            in_plateau = true;
+        }
+
+        previous_cost = cost;
+        previous_size = sizes[i];
+    }
+    if (!knees.empty() && knees.back().after == 0.0) {
+        knees.back().after = to_value(previous_cost);
+    }
+    return knees;
+}
+
+std::vector<EffectiveCapacity> match_levels(const CacheInfo& cache_info, const std::vector<Knee>& bandwidth_knees,
+                                            const std::vector<Knee>& latency_knees) {
+    std::vector<EffectiveCapacity> capacities;
+    std::vector<bool> bandwidth_used(bandwidth_knees.size(), false);
+    std::vector<bool> latency_used(latency_knees.size(), false);
+
+    const std::pair<const char*, size_t> levels[] = {
+        {"L1", cache_info.l1_data_size}, {"L2", cache_info.l2_size}, {"L3", cache_info.l3_size}};
+    for (const auto& [name, reported] : levels) {
+        if (reported == 0) continue;
+        EffectiveCapacity capacity;
+        capacity.level = name;
+        capacity.reported_bytes = reported;
+
+        long bandwidth = nearest_knee(bandwidth_knees, bandwidth_used, reported);
+        if (bandwidth >= 0) {
+            bandwidth_used[bandwidth] = true;
+            capacity.bandwidth_bytes = bandwidth_knees[bandwidth].capacity_bytes;
+        }
+        long latency = nearest_knee(latency_knees, latency_used, reported);
+        if (latency >= 0) {
+            latency_used[latency] = true;
+            capacity.latency_bytes = latency_knees[latency].capacity_bytes;
+        }
+        capacities.push_back(capacity);
+    }
+
+    for (size_t i = 0; i < bandwidth_knees.size(); ++i) {
+        if (!bandwidth_used[i]) {
+            capacities.push_back({"unattributed", 0, bandwidth_knees[i].capacity_bytes, 0});
+        }
+    }
+    for (size_t i = 0; i < latency_knees.size(); ++i) {
+        if (!latency_used[i]) {
+            capacities.push_back({"unattributed", 0, 0, latency_knees[i].capacity_bytes});
+        }
+    }
+    return capacities;
+}
+
+}  // namespace CacheBoundaries
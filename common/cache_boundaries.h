@@ -0,0 +1,75 @@
+#ifndef CACHE_BOUNDARIES_H
+#define CACHE_BOUNDARIES_H
+
+#include <cstddef>
+#include <string>
+#include <vector>
+
+#include "memory_types.h"
+
+/**
+ * @brief Effective cache capacities inferred from a working-set sweep
+ *
+ * A cache level shows up as a plateau in bandwidth or latency followed by a
+ * knee once the working set no longer fits. Sysfs and CPUID sizes are often
+ * wrong under VMs and cache partitioning (CAT), so the knees are reported
+ * next to the detected sizes rather than replacing them.
+ */
+namespace CacheBoundaries {
+
+/**
+ * @brief Curve a knee is detected on
+ */
+enum class Curve {
+    BANDWIDTH,  ///< Falls at each level boundary
+    LATENCY     ///< Rises at each level boundary
+};
+
+/**
+ * @brief End of a plateau
+ */
+struct Knee {
+    size_t capacity_bytes = 0;  ///< Largest working set still on the plateau
+    double before = 0.0;        ///< Median value of the plateau
+    double after = 0.0;         ///< Value where the next plateau starts (or the last point)
+};
+
+/**
+ * @brief Detected and effective size of one cache level
+ */
+struct EffectiveCapacity {
+    std::string level;            ///< "L1", "L2", "L3", or "unattributed" for a knee matching no level
+    size_t reported_bytes = 0;    ///< Size reported by the platform (0 for unattributed knees)
+    size_t bandwidth_bytes = 0;   ///< Matching bandwidth knee (0: none)
+    size_t latency_bytes = 0;     ///< Matching latency knee (0: none)
+};
+
+/**
+ * @brief Find the knees of a curve over increasing working sets
+ *
+ * Values are turned into a cost that rises at level boundaries (latency,
+ * or the inverse of bandwidth). A point whose cost exceeds the plateau
+ * median by SWEEP_KNEE_THRESHOLD ends the plateau; the next plateau starts
+ * once the step-to-step rise drops below SWEEP_SETTLE_RATIO. Points with
+ * non-positive values are ignored.
+ *
+ * @param sizes Working sets in increasing order
+ * @param values Bandwidth or latency at each working set
+ * @param curve Which of the two the values are
+ * @return Knees in increasing order of capacity
+ */
+std::vector<Knee> detect_knees(const std::vector<size_t>& sizes, const std::vector<double>& values, Curve curve);
+
+/**
+ * @brief Pair reported cache levels with the nearest knee of each curve
+ *
+ * A knee is only attributed to a level within SWEEP_MATCH_FACTOR of its
+ * reported size, and to one level at most. Knees left over (TLB reach,
+ * partitioned or undetected levels) are listed as "unattributed".
+ */
+std::vector<EffectiveCapacity> match_levels(const CacheInfo& cache_info, const std::vector<Knee>& bandwidth_knees,
+                                            const std::vector<Knee>& latency_knees);
+
+}  // namespace CacheBoundaries
+
+#endif  // CACHE_BOUNDARIES_H
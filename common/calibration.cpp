@@ -0,0 +1,94 @@
+#include "calibration.h"
+
+#include <algorithm>
+#include <chrono>
+#include <cmath>
+#include <limits>
+#include <numeric>
+
+namespace Calibration {
+
+namespace {
+
+// Two-sided 97.5% quantiles of Student's t for 1..30 degrees of freedom
+constexpr double T_QUANTILES[] = {12.706, 4.303, 3.182, 2.776, 2.571, 2.447, 2.365, 2.306, 2.262, 2.228,
+                                  2.201,  2.179, 2.160, 2.145, 2.131, 2.120, 2.110, 2.101, 2.093, 2.086,
+                                  2.080,  2.074, 2.069, 2.064, 2.060, 2.056, 2.052, 2.048, 2.045, 2.042};
+
+double t_quantile(size_t degrees_of_freedom) {
+    constexpr size_t table_size = sizeof(T_QUANTILES) / sizeof(T_QUANTILES[0]);
+    return degrees_of_freedom <= table_size ? T_QUANTILES[degrees_of_freedom - 1] : 1.96;
+}
+
+}  // namespace
+
+double confidence_interval_percent(const std::vector<double>& values) {
+    size_t n = values.size();
+    if (n < 2) {
+        return std::numeric_limits<double>::infinity();
+    }
+    double mean = std::accumulate(values.begin(), values.end(), 0.0) / n;
+    if (mean <= 0.0) {
+        return std::numeric_limits<double>::infinity();
+    }
+    double squares = 0.0;
+    for (double value : values) {
+        squares += (value - mean) * (value - mean);
+    }
+    double stddev = std::sqrt(squares / (n - 1));
+    return t_quantile(n - 1) * stddev / std::sqrt(static_cast<double>(n)) / mean * 100.0;
+}
+
+Result measure(const Measure& measure, const Settings& settings) {
+    auto start = std::chrono::steady_clock::now();
+    auto elapsed = [start]() {
+        return std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count();
+    };
+
+    Result result;
+    size_t calls = 0;
+
+    // Double until one run is long enough to time reliably
+    size_t iterations = 1;
+    PerformanceStats stats = measure(iterations);
+    ++calls;
+    while (stats.bytes_processed > 0 && stats.time_seconds < settings.target_sample_seconds &&
+           iterations < settings.max_iterations && elapsed() < settings.time_budget_seconds) {
+        iterations = std::min(iterations * 2, settings.max_iterations);
+        stats = measure(iterations);
+        ++calls;
+    }
+
+    std::vector<PerformanceStats> runs = {stats};
+    std::vector<size_t> run_calls = {calls - 1};
+    std::vector<double> bandwidths = {stats.bandwidth_gbps};
+    auto converged = [&]() {
+        return runs.size() >= settings.min_repetitions &&
+               confidence_interval_percent(bandwidths) <= settings.ci_percent;
+    };
+
+    while (stats.bytes_processed > 0 && runs.size() < settings.max_repetitions && !converged() &&
+           elapsed() < settings.time_budget_seconds) {
+        stats = measure(iterations);
+        runs.push_back(stats);
+        run_calls.push_back(calls++);
+        bandwidths.push_back(stats.bandwidth_gbps);
+    }
+    double ci = confidence_interval_percent(bandwidths);
+    result.converged = converged();
+
+    std::vector<size_t> order(runs.size());
+    std::iota(order.begin(), order.end(), 0);
+    std::sort(order.begin(), order.end(),
+              [&bandwidths](size_t a, size_t b) { return bandwidths[a] < bandwidths[b]; });
+    size_t median = order[(order.size() - 1) / 2];
+
+    result.stats = runs[median];
+    result.iterations = iterations;
+    result.repetitions = runs.size();
+    result.ci_percent = std::isfinite(ci) ? ci : 0.0;
+    result.median_call = run_calls[median];
+    return result;
+}
+
+}  // namespace Calibration
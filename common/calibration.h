@@ -0,0 +1,75 @@
+#ifndef CALIBRATION_H
+#define CALIBRATION_H
+
+#include <cstddef>
+#include <functional>
+#include <vector>
+
+#include "constants.h"
+#include "test_patterns.h"
+
+/**
+ * @brief Time-budgeted measurements
+ *
+ * Instead of a fixed iteration count per working-set size, the iteration
+ * count is doubled until one repetition lasts at least a target duration,
+ * then repetitions run until the 95% confidence interval of their mean
+ * bandwidth is tight enough or the time budget runs out. The repetition
+ * with the median bandwidth is reported.
+ */
+namespace Calibration {
+
+/**
+ * @brief Targets and limits of a calibrated measurement
+ */
+struct Settings {
+    double target_sample_seconds = BenchmarkConstants::CALIBRATION_TARGET_SECONDS;
+    double time_budget_seconds = BenchmarkConstants::CALIBRATION_TIME_BUDGET_SECONDS;
+    double ci_percent = BenchmarkConstants::CALIBRATION_CI_PERCENT;
+    size_t min_repetitions = BenchmarkConstants::CALIBRATION_MIN_REPETITIONS;
+    size_t max_repetitions = BenchmarkConstants::CALIBRATION_MAX_REPETITIONS;
+    size_t max_iterations = BenchmarkConstants::CALIBRATION_MAX_ITERATIONS;
+};
+
+/**
+ * @brief Outcome of a calibrated measurement
+ */
+struct Result {
+    PerformanceStats stats{};  ///< Repetition with the median bandwidth
+    size_t iterations = 0;     ///< Iterations per repetition
+    size_t repetitions = 0;    ///< Repetitions measured at that count
+    double ci_percent = 0.0;   ///< 95% confidence half-width of the mean bandwidth (% of mean; 0 if unknown)
+    bool converged = false;    ///< ci_percent reached the target before the budget ran out
+    size_t median_call = 0;    ///< Index of the reported run among all calls of the measurement
+};
+
+/**
+ * @brief One run of the measured kernel with a given iteration count
+ */
+using Measure = std::function<PerformanceStats(size_t iterations)>;
+
+/**
+ * @brief 95% confidence half-width of the mean, in percent of the mean
+ *
+ * Uses Student's t for small sample counts.
+ *
+ * @return Half-width, or infinity for fewer than two values or a non-positive mean
+ */
+double confidence_interval_percent(const std::vector<double>& values);
+
+/**
+ * @brief Calibrate the iteration count, then repeat until converged or out of budget
+ *
+ * The last calibration run already lasts the target duration and counts as
+ * the first repetition. Runs that move no bytes (stopped or empty) end the
+ * measurement immediately.
+ *
+ * @param measure Runs the kernel and returns its aggregated statistics
+ * @param settings Targets and limits
+ * @return Reported repetition and convergence information
+ */
+Result measure(const Measure& measure, const Settings& settings = {});
+
+}  // namespace Calibration
+
+#endif  // CALIBRATION_H
@@ -0,0 +1,213 @@
+#include "coherence_tests.h"
+#include "cycle_timer.h"
+#include "errors.h"
+#include "worker_pool.h"
+
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <cstdint>
+#include <thread>
+
+#if defined(__x86_64__) || defined(__i386__)
+#include <immintrin.h>
+#endif
+
+namespace CoherenceTests {
+
+namespace {
+
+using Clock = CycleTimer::Clock;
+
+// Spins before a waiter yields: a transfer takes well under a microsecond, so only a descheduled partner gets here
+constexpr size_t SPIN_LIMIT = 1 << 14;
+
+inline void cpu_relax() {
+#if defined(__x86_64__) || defined(__i386__)
+    _mm_pause();
+#elif defined(__aarch64__)
+    asm volatile("yield" ::: "memory");
+#endif
+}
+
+struct alignas(PADDED_SLOT_BYTES) PaddedCounter {
+    std::atomic<uint64_t> value{0};
+};
+
+struct alignas(PADDED_SLOT_BYTES) PackedCounters {
+    std::atomic<uint64_t> values[MAX_PACKED_COUNTERS] = {};
+};
+
+static_assert(sizeof(std::atomic<uint64_t>) * MAX_PACKED_COUNTERS <= 64, "packed counters must fit one line");
+
+inline void wait_for(const std::atomic<uint64_t>& line, uint64_t value) {
+    size_t spins = 0;
+    while (line.load(std::memory_order_acquire) != value) {
+        if (++spins < SPIN_LIMIT) {
+            cpu_relax();
+        } else {
+            std::this_thread::yield();
+        }
+    }
+}
+
+double median_of(std::vector<double> values) {
+    if (values.empty()) {
+        return 0.0;
+    }
+    std::sort(values.begin(), values.end());
+    size_t mid = values.size() / 2;
+    return (values.size() % 2 == 1) ? values[mid] : (values[mid - 1] + values[mid]) / 2.0;
+}
+
+}  // namespace
+
+PingPongResult measure_ping_pong(size_t cpu_a, size_t cpu_b, size_t round_trips, size_t batches,
+                                 const PinFunction& pin) {
+    PingPongResult result;
+    result.cpu_a = cpu_a;
+    result.cpu_b = cpu_b;
+    result.round_trips = round_trips;
+    if (round_trips == 0 || batches == 0) {
+        return result;
+    }
+
+    PaddedCounter line;
+    std::atomic<bool> responder_ready{false};
+    const uint64_t total = static_cast<uint64_t>(round_trips) * (batches + 1);
+    std::vector<double> batch_ns;
+
+    std::thread responder([&] {
+        if (pin) {
+            pin(cpu_b);
+        }
+        responder_ready.store(true, std::memory_order_release);
+        for (uint64_t i = 0; i < total; ++i) {
+            wait_for(line.value, 2 * i + 1);
+            line.value.store(2 * i + 2, std::memory_order_release);
+        }
+    });
+    std::thread initiator([&] {
+        if (pin) {
+            pin(cpu_a);
+        }
+        while (!responder_ready.load(std::memory_order_acquire)) {
+            std::this_thread::yield();
+        }
+        uint64_t i = 0;
+        // Batch 0 warms up both cores and is discarded
+        for (size_t batch = 0; batch <= batches; ++batch) {
+            uint64_t start = CycleTimer::start_ticks();
+            for (size_t r = 0; r < round_trips; ++r, ++i) {
+                line.value.store(2 * i + 1, std::memory_order_release);
+                wait_for(line.value, 2 * i + 2);
+            }
+            double ns = CycleTimer::ticks_to_ns(start, CycleTimer::stop_ticks());
+            if (batch > 0) {
+                batch_ns.push_back(ns / (2.0 * static_cast<double>(round_trips)));
+            }
+        }
+    });
+    initiator.join();
+    responder.join();
+
+    result.one_way_ns = median_of(batch_ns);
+    result.min_one_way_ns = *std::min_element(batch_ns.begin(), batch_ns.end());
+    return result;
+}
+
+std::vector<PingPongResult> measure_core_to_core(const std::vector<size_t>& cpus, size_t round_trips,
+                                                 size_t batches, const PinFunction& pin) {
+    std::vector<PingPongResult> matrix;
+    matrix.reserve(cpus.size() * cpus.size());
+    for (size_t a : cpus) {
+        for (size_t b : cpus) {
+            if (a == b) {
+                PingPongResult diagonal;
+                diagonal.cpu_a = a;
+                diagonal.cpu_b = b;
+                matrix.push_back(diagonal);
+            } else {
+                matrix.push_back(measure_ping_pong(a, b, round_trips, batches, pin));
+            }
+        }
+    }
+    return matrix;
+}
+
+std::string layout_to_string(CounterLayout layout) {
+    return layout == CounterLayout::PACKED ? "packed" : "padded";
+}
+
+FalseSharingResult measure_false_sharing(const std::vector<size_t>& cpus, size_t increments, CounterLayout layout,
+                                         const PinFunction& pin) {
+    if (cpus.empty() || cpus.size() > MAX_PACKED_COUNTERS) {
+        throw ConfigurationError("False sharing needs 1 to " + std::to_string(MAX_PACKED_COUNTERS) +
+                                 " threads, got " + std::to_string(cpus.size()));
+    }
+
+    const size_t num_threads = cpus.size();
+    PackedCounters packed;
+    std::vector<PaddedCounter> padded(num_threads);
+    std::vector<std::atomic<uint64_t>*> counters(num_threads);
+    for (size_t t = 0; t < num_threads; ++t) {
+        counters[t] = (layout == CounterLayout::PACKED) ? &packed.values[t] : &padded[t].value;
+    }
+
+    SpinBarrier barrier(num_threads);
+    std::vector<double> seconds(num_threads, 0.0);
+    std::vector<std::thread> threads;
+    for (size_t t = 0; t < num_threads; ++t) {
+        threads.emplace_back([&, t] {
+            if (pin) {
+                pin(cpus[t]);
+            }
+            std::atomic<uint64_t>& counter = *counters[t];
+            barrier.arrive_and_wait();
+            auto start = Clock::now();
+            for (size_t i = 0; i < increments; ++i) {
+                counter.fetch_add(1, std::memory_order_relaxed);
+            }
+            seconds[t] = CycleTimer::elapsed_seconds(start, Clock::now());
+        });
+    }
+    for (auto& thread : threads) {
+        thread.join();
+    }
+
+    FalseSharingResult result;
+    result.layout = layout;
+    result.num_threads = num_threads;
+    result.increments_per_thread = increments;
+    result.seconds = *std::max_element(seconds.begin(), seconds.end());
+    if (increments > 0 && result.seconds > 0.0) {
+        result.ns_per_increment = result.seconds * 1e9 / static_cast<double>(increments);
+        result.total_mops = static_cast<double>(increments * num_threads) / result.seconds / 1e6;
+    }
+    result.verified = std::all_of(counters.begin(), counters.end(), [increments](const std::atomic<uint64_t>* c) {
+        return c->load(std::memory_order_relaxed) == increments;
+    });
+    return result;
+}
+
+MatrixSummary summarize(const std::vector<PingPongResult>& matrix) {
+    MatrixSummary summary;
+    std::vector<double> latencies;
+    for (const auto& cell : matrix) {
+        if (cell.cpu_a == cell.cpu_b || cell.round_trips == 0) {
+            continue;
+        }
+        if (latencies.empty() || cell.one_way_ns < summary.fastest.one_way_ns) {
+            summary.fastest = cell;
+        }
+        if (latencies.empty() || cell.one_way_ns > summary.slowest.one_way_ns) {
+            summary.slowest = cell;
+        }
+        latencies.push_back(cell.one_way_ns);
+    }
+    summary.pairs = latencies.size();
+    summary.median_ns = median_of(latencies);
+    return summary;
+}
+
+}  // namespace CoherenceTests
@@ -0,0 +1,126 @@
+#ifndef COHERENCE_TESTS_H
+#define COHERENCE_TESTS_H
+
+#include <cstddef>
+#include <functional>
+#include <string>
+#include <vector>
+
+/**
+ * @brief Cache-coherence transfer tests between pinned threads
+ *
+ * Every other test gives its threads disjoint slices, so lines never move
+ * between cores. These tests make them move: a ping-pong bounces ownership
+ * of one line between two threads to time a core-to-core transfer, and a
+ * false-sharing run has several threads increment counters that share a
+ * line, against the same counters on lines of their own. On chiplet parts
+ * the transfer matrix shows which cores share a last-level cache, which is
+ * where producer/consumer pairs of a lock-free queue belong.
+ */
+namespace CoherenceTests {
+
+/// Line granularity counters are padded to: two 64-byte lines, so adjacent-line prefetch never pairs them
+constexpr size_t PADDED_SLOT_BYTES = 128;
+/// Most threads a false-sharing run puts on one line (one 8-byte counter each)
+constexpr size_t MAX_PACKED_COUNTERS = 8;
+
+/**
+ * @brief Pins the calling thread to a CPU; an empty function leaves threads where the scheduler puts them
+ */
+using PinFunction = std::function<void(size_t cpu)>;
+
+/**
+ * @brief One cell of the core-to-core matrix
+ */
+struct PingPongResult {
+    size_t cpu_a = 0;           ///< CPU of the initiating thread
+    size_t cpu_b = 0;           ///< CPU of the responding thread
+    double one_way_ns = 0.0;    ///< Median one-way transfer latency (half a round trip) over the batches
+    double min_one_way_ns = 0.0;  ///< Fastest batch
+    size_t round_trips = 0;     ///< Round trips timed per batch
+};
+
+/**
+ * @brief Time line ownership bouncing between two threads
+ *
+ * The initiator writes an odd value and spins until the responder has
+ * answered with the next even one, so every round trip moves the line to
+ * the other core and back. One warm-up batch is discarded.
+ *
+ * @param cpu_a CPU the initiator is pinned to
+ * @param cpu_b CPU the responder is pinned to
+ * @param round_trips Round trips per batch
+ * @param batches Timed batches; the result is their median
+ * @param pin Pins each thread (empty: no pinning)
+ */
+PingPongResult measure_ping_pong(size_t cpu_a, size_t cpu_b, size_t round_trips, size_t batches,
+                                 const PinFunction& pin);
+
+/**
+ * @brief Transfer latency between every ordered pair of CPUs
+ *
+ * @param cpus CPUs to pair (the diagonal is not measured)
+ * @return Row-major results, cpus.size() squared; diagonal cells have one_way_ns 0
+ */
+std::vector<PingPongResult> measure_core_to_core(const std::vector<size_t>& cpus, size_t round_trips,
+                                                 size_t batches, const PinFunction& pin);
+
+/**
+ * @brief Counter layout of a false-sharing run
+ */
+enum class CounterLayout {
+    PACKED,  ///< Every thread's 8-byte counter on the same line
+    PADDED   ///< Each counter alone in a PADDED_SLOT_BYTES slot
+};
+
+/**
+ * @brief Layout as reported in results ("packed", "padded")
+ */
+std::string layout_to_string(CounterLayout layout);
+
+/**
+ * @brief Outcome of one false-sharing run
+ */
+struct FalseSharingResult {
+    CounterLayout layout = CounterLayout::PADDED;
+    size_t num_threads = 0;
+    size_t increments_per_thread = 0;
+    double seconds = 0.0;              ///< Wall time of the slowest thread
+    double ns_per_increment = 0.0;     ///< Per thread: seconds / increments_per_thread
+    double total_mops = 0.0;           ///< Increments per second over all threads, in millions
+    bool verified = false;             ///< Every counter holds exactly its increments
+};
+
+/**
+ * @brief Have each thread increment its own counter
+ *
+ * Increments are relaxed atomic read-modify-writes, so each one needs the
+ * line in the thread's cache; with PACKED counters every increment steals
+ * the line from another core.
+ *
+ * @param cpus CPU of each thread (one thread per entry, at most MAX_PACKED_COUNTERS)
+ * @param increments Increments per thread
+ * @param layout Packed on one line or padded
+ * @param pin Pins each thread (empty: no pinning)
+ */
+FalseSharingResult measure_false_sharing(const std::vector<size_t>& cpus, size_t increments, CounterLayout layout,
+                                         const PinFunction& pin);
+
+/**
+ * @brief Summary of a core-to-core matrix: fastest, median and slowest pair
+ */
+struct MatrixSummary {
+    PingPongResult fastest;
+    PingPongResult slowest;
+    double median_ns = 0.0;
+    size_t pairs = 0;  ///< Off-diagonal cells summarized (0: nothing was measured)
+};
+
+/**
+ * @brief Summarize the off-diagonal cells of measure_core_to_core
+ */
+MatrixSummary summarize(const std::vector<PingPongResult>& matrix);
+
+}  // namespace CoherenceTests
+
+#endif  // COHERENCE_TESTS_H
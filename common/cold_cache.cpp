@@ -0,0 +1,141 @@
+#include "cold_cache.h"
+#include "constants.h"
+#include "cpu_features.h"
+#include "errors.h"
+
+#include <algorithm>
+
+#if defined(__x86_64__) || defined(__i386__)
+#include <immintrin.h>
+#endif
+
+namespace ColdCache {
+
+namespace {
+
+constexpr size_t LINE_BYTES = CacheConstants::DEFAULT_CACHE_LINE_SIZE;
+
+#if defined(__x86_64__) || defined(__i386__)
+__attribute__((target("clflushopt"))) void flush_lines_clflushopt(const uint8_t* begin, const uint8_t* end) {
+    for (const uint8_t* line = begin; line < end; line += LINE_BYTES) {
+        _mm_clflushopt(const_cast<uint8_t*>(line));
+    }
+    _mm_sfence();  // CLFLUSHOPT is only ordered by fences
+}
+
+void flush_lines_clflush(const uint8_t* begin, const uint8_t* end) {
+    for (const uint8_t* line = begin; line < end; line += LINE_BYTES) {
+        _mm_clflush(line);
+    }
+    _mm_mfence();
+}
+#elif defined(__aarch64__)
+// Smallest data cache line of the system: CTR_EL0.DminLine is log2 of its size in words
+size_t data_line_bytes() {
+    uint64_t ctr = 0;
+    asm volatile("mrs %0, ctr_el0" : "=r"(ctr));
+    return size_t{4} << ((ctr >> 16) & 0xF);
+}
+#endif
+
+}  // namespace
+
+Method parse_method(const std::string& value) {
+    if (value == "flush") {
+        if (!flush_supported()) {
+            throw ArgumentError("--cold flush needs a cache line flush instruction this CPU lacks. Use --cold evict.");
+        }
+        return Method::FLUSH;
+    }
+    if (value == "evict") {
+        return Method::EVICT;
+    }
+    throw ArgumentError("Invalid --cold value '" + value + "'. Expected flush or evict");
+}
+
+std::string method_to_string(Method method) {
+    return method == Method::EVICT ? "evict" : "flush";
+}
+
+bool flush_supported() {
+#if defined(__x86_64__) || defined(__i386__) || defined(__aarch64__)
+    return true;  // CLFLUSH is part of SSE2; DC CIVAC is enabled at EL0 by Linux and macOS
+#else
+    return false;
+#endif
+}
+
+std::string flush_instruction() {
+#if defined(__x86_64__) || defined(__i386__)
+    return CpuFeatureDetection::get_cpu_features().clflushopt ? "clflushopt" : "clflush";
+#elif defined(__aarch64__)
+    return "dc civac";
+#else
+    return "none";
+#endif
+}
+
+void flush_range(const void* data, size_t bytes) {
+    if (data == nullptr || bytes == 0) {
+        return;
+    }
+    const uint8_t* end = static_cast<const uint8_t*>(data) + bytes;
+#if defined(__x86_64__) || defined(__i386__)
+    // Start at the line holding the first byte so partial lines at both ends go too
+    const uint8_t* begin = reinterpret_cast<const uint8_t*>(reinterpret_cast<uintptr_t>(data) & ~(LINE_BYTES - 1));
+    if (CpuFeatureDetection::get_cpu_features().clflushopt) {
+        flush_lines_clflushopt(begin, end);
+    } else {
+        flush_lines_clflush(begin, end);
+    }
+#elif defined(__aarch64__)
+    static const size_t line_bytes = data_line_bytes();
+    const uint8_t* begin = reinterpret_cast<const uint8_t*>(reinterpret_cast<uintptr_t>(data) & ~(line_bytes - 1));
+    for (const uint8_t* line = begin; line < end; line += line_bytes) {
+        asm volatile("dc civac, %0" : : "r"(line) : "memory");
+    }
+    asm volatile("dsb ish" ::: "memory");
+#else
+    (void)end;
+#endif
+}
+
+size_t eviction_bytes(const CacheInfo& cache, size_t num_threads) {
+    size_t threads = std::max<size_t>(num_threads, 1);
+    size_t share = cache.l2_size + (cache.l3_size + threads - 1) / threads;
+    if (share == 0) {
+        return BenchmarkConstants::COLD_EVICT_FALLBACK_BYTES;
+    }
+    return share * BenchmarkConstants::COLD_EVICT_FACTOR;
+}
+
+Evictor::Evictor(Method method, size_t eviction_bytes)
+    : method_(method), eviction_bytes_(method == Method::EVICT ? eviction_bytes : 0) {}
+
+void Evictor::prepare() {
+    if (buffer_.size() != eviction_bytes_) {
+        buffer_.assign(eviction_bytes_, 1);  // Written here, so the pages belong to this thread's node
+    }
+}
+
+void Evictor::begin() {
+    if (method_ != Method::EVICT) {
+        return;
+    }
+    prepare();
+    uint64_t sum = 0;
+    const uint8_t* data = buffer_.data();
+    for (size_t offset = 0; offset < buffer_.size(); offset += LINE_BYTES) {
+        sum += data[offset];
+    }
+    checksum_ += sum;
+    asm volatile("" : : "r"(checksum_) : "memory");
+}
+
+void Evictor::evict(const void* data, size_t bytes) {
+    if (method_ == Method::FLUSH) {
+        flush_range(data, bytes);
+    }
+}
+
+}  // namespace ColdCache
@@ -0,0 +1,108 @@
+#ifndef COLD_CACHE_H
+#define COLD_CACHE_H
+
+#include <cstddef>
+#include <cstdint>
+#include <string>
+#include <vector>
+
+#include "memory_types.h"
+
+/**
+ * @brief Cold-cache passes: evict a working set before every timed pass
+ *
+ * Repeated passes over a set that fits in cache measure warm cache, which
+ * is not what the first request after idle sees. Between passes a kernel
+ * can either flush the lines of its slice (CLFLUSHOPT or CLFLUSH on x86,
+ * DC CIVAC on AArch64) or stream a private eviction buffer sized from
+ * CacheInfo through the hierarchy. Either way it happens off the clock:
+ * the kernels subtract it from their time and keep it out of the counters.
+ */
+namespace ColdCache {
+
+/**
+ * @brief How lines leave the caches between passes
+ */
+enum class Method {
+    FLUSH,  ///< Flush every line of the slice to memory (exact, needs a flush instruction)
+    EVICT   ///< Read an eviction buffer larger than the caches (any CPU, approximate)
+};
+
+/**
+ * @brief Parse a --cold value ("flush", "evict")
+ * @throws ArgumentError for any other value, or flush without a flush instruction
+ */
+Method parse_method(const std::string& value);
+
+/**
+ * @brief Method as shown in results ("flush", "evict")
+ */
+std::string method_to_string(Method method);
+
+/**
+ * @brief Whether this CPU can flush lines from user space
+ */
+bool flush_supported();
+
+/**
+ * @brief Instruction flush_range uses ("clflushopt", "clflush", "dc civac", "none")
+ */
+std::string flush_instruction();
+
+/**
+ * @brief Write back and invalidate every line of a range, then wait for completion
+ *
+ * A no-op where flush_supported() is false.
+ */
+void flush_range(const void* data, size_t bytes);
+
+/**
+ * @brief Eviction buffer of one of num_threads threads
+ *
+ * COLD_EVICT_FACTOR times the private L2 plus an equal share of the L3,
+ * so concurrent threads together stream past the shared cache as well;
+ * COLD_EVICT_FALLBACK_BYTES when CacheInfo reports neither.
+ */
+size_t eviction_bytes(const CacheInfo& cache, size_t num_threads);
+
+/**
+ * @brief Evicts between the passes of one thread
+ *
+ * Each thread owns one: the eviction buffer is allocated and first touched
+ * by prepare() on that thread, so it is local to its node.
+ */
+class Evictor {
+public:
+    Evictor() = default;
+    Evictor(Method method, size_t eviction_bytes);
+
+    /**
+     * @brief Allocate and touch the eviction buffer (EVICT, first call only)
+     */
+    void prepare();
+
+    /**
+     * @brief Start an eviction: streams the eviction buffer once (EVICT)
+     */
+    void begin();
+
+    /**
+     * @brief Evict one array of the slice: flushes its lines (FLUSH)
+     *
+     * A kernel calls begin() and then evict() for each array it touches.
+     */
+    void evict(const void* data, size_t bytes);
+
+    Method method() const { return method_; }
+    size_t buffer_bytes() const { return eviction_bytes_; }
+
+private:
+    Method method_ = Method::FLUSH;
+    size_t eviction_bytes_ = 0;
+    std::vector<uint8_t> buffer_;
+    uint64_t checksum_ = 0;  // Keeps the eviction loads live
+};
+
+}  // namespace ColdCache
+
+#endif  // COLD_CACHE_H
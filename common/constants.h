@@ -62,12 +62,189 @@ namespace BenchmarkConstants {
     constexpr uint64_t TEST_PATTERN_BASE = 0x0123456789ABCDEF;
     constexpr double TRIAD_SCALAR = 3.14159;
     
+    // Pointer-chase hop bounds per timed pass
+    constexpr size_t MIN_CHASE_HOPS = 1 << 16;                // Enough hops to time an L1-sized chain
+    constexpr size_t MAX_CHASE_HOPS = 1 << 22;                // Caps a DRAM pass at roughly half a second
+    
+    // Loaded-latency load generation and probe
+    constexpr size_t LOAD_CHUNK_BYTES = 4 * KB;               // Traffic issued between two throttle delays
+    constexpr size_t LOADED_LATENCY_PROBE_BYTES = 512 * MB;   // Probe chain: far beyond any LLC, cheap to build
+    constexpr size_t LOADED_LATENCY_DELAYS[] = {              // Pause instructions per chunk, lightest load first
+        20000, 10000, 5000, 2000, 1000, 500, 200, 100, 50, 0};
+    
+    // Core-to-core ping-pong and false sharing
+    constexpr size_t PING_PONG_ROUND_TRIPS = 2000;            // Per batch: well under a millisecond at cross-socket latencies
+    constexpr size_t PING_PONG_BATCHES = 7;                   // Timed batches per pair (median reported)
+    constexpr size_t FALSE_SHARING_INCREMENTS = 5000000;      // Per thread: about a second packed on a large part
+    constexpr size_t FALSE_SHARING_THREADS[] = {2, 4, 8};     // Thread counts, up to --threads
+    
+    // Atomic read-modify-write throughput
+    constexpr size_t ATOMIC_OPS_PER_THREAD = 1 << 20;         // Per thread and run: tens of milliseconds contended
+    
+    // Allocator benchmark (--allocators)
+    constexpr size_t ALLOC_OPS_PER_THREAD = 1 << 20;          // Churn and producer/consumer pairs: tens of ms per thread
+    constexpr size_t ALLOC_FRAGMENTATION_OPS = 1 << 18;       // Replacements: each touches up to 16 pages
+    constexpr size_t ALLOC_CHURN_BATCH = 1024;                // Objects alive per churn round
+    constexpr size_t ALLOC_FRAGMENTATION_LIVE = 2048;         // Live objects per thread: ~16 MB at the mean size
+    constexpr size_t ALLOC_QUEUE_DEPTH = 1024;                // Producer/consumer ring slots
+    constexpr size_t ALLOC_ARENA_CHUNK = 1 * MB;              // Bump arena growth step
+    constexpr size_t ALLOC_POOL_CHUNK = 256 * KB;             // Carved per pool size class at a time
+    
+    // Mapping costs (--mapping)
+    constexpr size_t MAPPING_UNMAP_CHUNK = 64 * KB;           // Per munmap call: one shootdown per allocator-sized release
+    constexpr size_t MAPPING_HUGE_PAGE = 2 * MB;              // Mappings are rounded to and aligned on this
+    
+    // TLB reach (--tlb)
+    constexpr size_t TLB_MIN_PAGES = 2;                       // Smallest chain: a cycle needs two nodes
+    constexpr size_t TLB_STEPS_PER_OCTAVE = 4;                // Resolves STLBs of 1536 or 3072 entries
+    constexpr size_t TLB_MAX_SMALL_PAGES = 1 << 16;           // 256 MB of 4 KB pages: past every STLB and paging-structure cache
+    constexpr size_t TLB_MAX_HUGE_PAGES = 1 << 12;            // 8 GB of 2 MB pages, bounded by --size
+    constexpr size_t TLB_HOPS_PER_PAGE = 16;                  // Timed hops per chain node, within the chase bounds
+    
+    // Cycle timer calibration
+    constexpr size_t CYCLE_CALIBRATION_MS = 20;               // TSC against steady_clock: 1 ppm of error is 20 ns here
+    constexpr size_t CYCLE_OVERHEAD_SAMPLES = 1000;           // Back-to-back read pairs; the least is the overhead
+    
+    // Cold passes (--cold)
+    constexpr size_t COLD_EVICT_FACTOR = 2;                   // Eviction buffer: twice each thread's L2 and share of the LLC
+    constexpr size_t COLD_EVICT_FALLBACK_BYTES = 64 * MB;     // Used when CacheInfo reports no L2 or L3
+    
+    // Copy size classes (--memcpy)
+    constexpr size_t MEMCPY_MIN_BYTES = 8;                    // Sizes are whole 64-bit words, which every kernel copies exactly
+    constexpr size_t MEMCPY_MAX_BYTES = 1 * GB;
+    constexpr size_t MEMCPY_MAX_OFFSET = 63;                  // Misalignments within one cache line
+    constexpr size_t MEMCPY_RUN_BYTES = 16 * MB;              // Bytes per timed run: a millisecond or more at any rate
+    constexpr size_t MEMCPY_MIN_CALLS = 2;                    // Calls per timed run of the largest sizes
+    constexpr size_t MEMCPY_MAX_CALLS = 1 << 20;              // Bounds the run of the smallest sizes
+    constexpr size_t MEMCPY_NT_MIN_BYTES = 4 * KB;            // Non-temporal variants only run from here up: below, nobody streams
+    constexpr double MEMCPY_CROSSOVER_MARGIN = 0.05;          // A new fastest implementation must lead by this share
+    
+    // Memory tiers (--tiers)
+    constexpr size_t NUMA_MAX_INTERLEAVE_WEIGHT = 255;        // Kernel weighted-interleave weights are one byte
+    constexpr size_t TIER_RANGE_BYTES = 2 * MB;               // Fallback interleave granularity: one huge page, 512 VMAs per GB
+
+    // GPU unified memory (--gpu)
+    constexpr size_t GPU_GRID_THREADS = 1 << 20;              // Threads per dispatch; each walks the arrays with a grid stride
+    constexpr size_t GPU_THREADGROUP_SIZE = 256;              // Capped by the pipeline's own maximum
+    constexpr double GPU_MIN_SECONDS = 0.5;                   // GPU time each measurement is scaled to reach
+    constexpr int GPU_CPU_RAMP_MS = 20;                       // CPU threads start streaming before the shared GPU run
+    constexpr float GPU_TRIAD_SCALAR = 3.0f;
+    
+    // Producer/consumer rings (--rings)
+    constexpr size_t RING_BYTES = 64 * KB;                    // Payload a ring holds: inside every L2, so pairs stream cache to cache
+    constexpr size_t RING_MIN_SLOTS = 8;                      // Large payloads still leave the producer room to run ahead
+    constexpr size_t RING_MAX_SLOTS = 1024;
+    constexpr size_t RING_MAX_PAYLOAD = 64 * KB;
+    constexpr size_t RING_TRANSFER_BYTES = 32 * MB;           // Payload per timed run: milliseconds at cross-socket rates
+    constexpr size_t RING_MIN_MESSAGES = 1 << 14;             // Small payloads are bound by the index handoff, not bytes
+    constexpr size_t RING_HANDOFF_ROUND_TRIPS = 2000;         // Single-message round trips per timed handoff run
+    
+    // Soak runs (--duration): bandwidth time series and throttling detection
+    constexpr size_t SOAK_DEFAULT_INTERVAL_MS = 100;          // Sampler period: resolves frequency steps, cheap to read
+    constexpr size_t SOAK_MIN_INTERVAL_MS = 10;
+    constexpr size_t SOAK_MAX_INTERVAL_MS = 60000;
+    constexpr double SOAK_WINDOW_FRACTION = 0.10;             // Share of the samples averaged at the start and the end
+    constexpr double SOAK_THROTTLE_PERCENT = 5.0;             // Bandwidth or frequency drop reported as throttling
+    constexpr size_t SOAK_TABLE_ROWS = 60;                    // Markdown rows; CSV and JSON keep every sample
+    
+    // Streaming result records (--ndjson)
+    constexpr size_t NDJSON_SCHEMA_VERSION = 1;               // Bumped when a field is renamed, retyped or removed
+    
+    // Baselines (--save-baseline, --compare)
+    constexpr size_t BASELINE_VERSION = 1;                    // Bumped when the stored layout changes
+    constexpr double BASELINE_REGRESSION_PERCENT = 5.0;       // Median bandwidth drop that counts as a regression
+    constexpr double BASELINE_SIGNIFICANCE = 0.01;            // Two-sided Mann-Whitney p-value the drop must reach
+    constexpr size_t BASELINE_MIN_SAMPLES = 6;                // Per side; the fewest that can reach p < 0.01
+    constexpr int BASELINE_REGRESSION_EXIT_CODE = 3;          // Exit status of --compare when a result regressed
+
+    // Fleet runs (--agent, --coordinate)
+    constexpr uint16_t FLEET_DEFAULT_PORT = 7531;             // Port of --coordinate hosts given without one
+    constexpr int64_t FLEET_START_DELAY_MS = 2000;            // Lead time between sending the run and its common start
+    constexpr int64_t FLEET_MAX_START_DELAY_MS = 60000;       // Agents refuse starts further out than this
+    constexpr int FLEET_CONNECT_TIMEOUT_MS = 5000;            // Connect and accept handshake, per agent
+    constexpr int FLEET_POLL_MS = 100;                        // Agent record tail and coordinator socket poll interval
+    constexpr double FLEET_MAX_SKEW_MS = 50.0;                // Clock offset above which a host's start is flagged
+    constexpr size_t FLEET_MAX_LINE_BYTES = 1 * MB;           // Longest message or record accepted on a connection
+    constexpr size_t FLEET_OUTLIER_MIN_HOSTS = 3;             // Per SKU and test; fewer samples have no fleet to deviate from
+    constexpr double FLEET_OUTLIER_MADS = 3.5;                // Robust z-score (scaled MAD) that marks an outlier
+    constexpr double FLEET_OUTLIER_MIN_PERCENT = 5.0;         // And its distance from the SKU median, so tight fleets flag nothing
+    
+    // Calibrated peaks (--calibrate, --peak-file)
+    constexpr size_t PEAK_CALIBRATION_VERSION = 1;            // Bumped when the stored layout changes
+
+    // Cached system probe (--system-cache)
+    constexpr size_t SYSTEM_PROBE_VERSION = 1;                // Bumped when the stored layout changes
+
+    // Access-pattern traces (--trace, --trace-convert)
+    constexpr uint32_t TRACE_VERSION = 1;                     // Bumped when the record layout changes
+    constexpr size_t TRACE_BLOCK_RECORDS = 4096;              // Records decoded at once: 44 KB of workspace, L2-resident
+    constexpr size_t TRACE_PAGE_BYTES = 4 * KB;               // Granule the converters compact sampled addresses by
+    constexpr uint16_t TRACE_SAMPLE_ACCESS_BYTES = 8;         // Width of a perf mem sample, which records no size
+    constexpr size_t TRACE_MAX_CONVERT_RECORDS = 1ULL << 28;  // 4 GB of converter state; larger mixes are downsampled first
+    constexpr uint64_t TRACE_SHUFFLE_SEED = 0x5EED7ACE;       // Histogram expansion order, fixed so conversions repeat
+
+    // Cooperative GEMM partitioning
+    constexpr size_t MATRIX_ROW_BLOCK = 32;                   // Rows of C per band unit (one AMX C block)
+    
+    // Roofline arithmetic-intensity kernel (FP64, read + write of 16 bytes per element)
+    constexpr size_t ROOFLINE_FLOPS_PER_ELEMENT[] = {         // Intensity 1/16 to 64 FLOP/byte in powers of two
+        1, 2, 4, 8, 16, 32, 64, 128, 256, 512, 1024};
+    constexpr size_t ROOFLINE_BYTES_PER_ELEMENT = 2 * sizeof(double);
+    constexpr size_t ROOFLINE_BLOCK_ELEMENTS = 64;            // Independent FMA chains: enough to hide FMA latency
+    
+    // Adaptive measurement: calibrate iterations, then repeat until the result is stable
+    constexpr double CALIBRATION_TARGET_SECONDS = 0.05;       // Minimum duration of one repetition
+    constexpr double CALIBRATION_TIME_BUDGET_SECONDS = 1.0;   // Default --time-budget per measurement
+    constexpr double CALIBRATION_CI_PERCENT = 1.0;            // 95% confidence half-width that counts as converged
+    constexpr size_t CALIBRATION_MIN_REPETITIONS = 3;
+    constexpr size_t CALIBRATION_MAX_REPETITIONS = 100;
+    constexpr size_t CALIBRATION_MAX_ITERATIONS = 1ULL << 30; // Stops doubling for kernels that never take time
+    
+    // Working-set sweep and cache-boundary detection
+    constexpr size_t SWEEP_MAX_STEPS_PER_OCTAVE = 32;
+    constexpr double SWEEP_KNEE_THRESHOLD = 0.25;             // Cost rise over the plateau median that marks a knee
+    constexpr double SWEEP_SETTLE_RATIO = 0.10;               // Step-to-step rise below which a new plateau starts
+    constexpr double SWEEP_MATCH_FACTOR = 4.0;                // Knees further than this from a reported size stay unattributed
+    
+    // Multi-stream pattern (--streams R:W)
+    constexpr size_t MAX_STREAM_ARRAYS = 16;                  // Per side: wider than any columnar scan we model
+    constexpr size_t DEFAULT_BUFFER_SPLIT = 4;                // --size is divided into this many arrays (or more)
+    
+    // Application proxy patterns (hash_probe, radix_partition, merge)
+    constexpr double HASH_DEFAULT_LOAD_FACTOR = 0.75;         // Swiss tables grow at 7/8, linear-probing tables near 1/2
+    constexpr double HASH_MIN_LOAD_FACTOR = 0.05;
+    constexpr double HASH_MAX_LOAD_FACTOR = 0.95;             // Every probe sequence still reaches an empty slot
+    constexpr size_t HASH_DEFAULT_BATCH = 16;                 // Lookups hashed and prefetched ahead of their probes
+    constexpr size_t HASH_MAX_BATCH = 64;                     // More misses in flight than any core's fill buffers
+    constexpr size_t MERGE_DEFAULT_WAYS = 8;
+    constexpr size_t MERGE_MAX_WAYS = 64;
+    
+    // Irregular compute patterns (spmv_csr, spmv_sell, stencil)
+    constexpr size_t SPMV_DEFAULT_ROW_NNZ = 16;               // Nonzeros per row of the synthetic matrices (mean for powerlaw)
+    constexpr size_t SPMV_MIN_ROW_NNZ = 2;
+    constexpr size_t SPMV_MAX_ROW_NNZ = 128;
+    constexpr size_t SELL_CHUNK_ROWS = 8;                     // C: rows per SELL chunk, one 512-bit vector of doubles
+    constexpr size_t SELL_SORT_WINDOW = 256;                  // sigma: rows sorted by length within each window
+    constexpr size_t STENCIL_MIN_BLOCK = 4;                   // Rows of a --stencil-block tile
+    constexpr size_t STENCIL_MAX_BLOCK = 4096;
+    constexpr double ROOFLINE_MIN_SECONDS = 0.05;             // Shortest triad run a roofline is read from
+
+    // Kernel shape tuning (--tune)
+    constexpr double TUNE_MIN_SECONDS = 0.02;                 // Shortest run a candidate shape is ranked by
+    constexpr size_t TUNE_FINALISTS = 3;                      // Fastest shapes per level measured again
+    constexpr size_t TUNE_REPETITIONS = 5;                    // Best of this many runs decides among the finalists
+
     // Buffer allocation alignment
     constexpr size_t MAX_ALIGNMENT_SIZE = 1024;               // Maximum reasonable alignment
     
     // Validation constants
     constexpr double MIN_LATENCY_NS = 0.1;                    // Minimum realistic latency
     constexpr double MAX_EFFICIENCY_VIRTUALIZED = 50.0;       // Max efficiency in VMs
+    constexpr double MAX_CORE_CLOCK_GHZ = 6.5;                // Above any shipping boost clock
+    constexpr double L1_BYTES_PER_CYCLE = 256.0;              // Per core: wider than any load + store port mix
+    constexpr double L2_BYTES_PER_CYCLE = 128.0;              // Per core: two lines per cycle
+    constexpr double L3_BYTES_PER_CYCLE = 64.0;               // Per core: one line per cycle
+    constexpr double DRAM_CEILING_TOLERANCE = 1.10;           // Headroom over the theoretical DRAM peak
 }
 
 #endif  // CONSTANTS_H
\ No newline at end of file
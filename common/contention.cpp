@@ -0,0 +1,225 @@
+#include "contention.h"
+#include "errors.h"
+#include "standard_tests.h"
+
+#include <cctype>
+#include <cerrno>
+#include <cstring>
+#include <fstream>
+#include <sstream>
+
+#ifdef __linux__
+#include <sys/stat.h>
+#include <sys/syscall.h>
+#include <unistd.h>
+#endif
+
+namespace Contention {
+
+namespace {
+
+const char* const CACHE_RESOURCES[] = {"L3", "L3CODE", "L3DATA", "L2", "L2CODE", "L2DATA"};
+const char* const BANDWIDTH_RESOURCES[] = {"MB", "SMBA"};
+
+bool all_of(const std::string& text, int (*predicate)(int)) {
+    if (text.empty()) {
+        return false;
+    }
+    for (char c : text) {
+        if (!predicate(static_cast<unsigned char>(c))) {
+            return false;
+        }
+    }
+    return true;
+}
+
+// Validate "ID=VALUE;ID=VALUE" for one resource
+bool valid_domains(const std::string& domains, bool hexadecimal) {
+    std::stringstream ss(domains);
+    std::string domain;
+    size_t count = 0;
+    while (std::getline(ss, domain, ';')) {
+        size_t equals = domain.find('=');
+        if (equals == std::string::npos || !all_of(domain.substr(0, equals), ::isdigit) ||
+            !all_of(domain.substr(equals + 1), hexadecimal ? ::isxdigit : ::isdigit)) {
+            return false;
+        }
+        ++count;
+    }
+    return count > 0 && domains.back() != ';';
+}
+
+bool write_file(const std::string& path, const std::string& text, std::string& error) {
+    std::ofstream file(path);
+    if (file) {
+        file << text;
+        file.flush();
+    }
+    if (!file) {
+        error = "cannot write " + path + ": " + std::strerror(errno);
+        return false;
+    }
+    return true;
+}
+
+}  // namespace
+
+Aggressor parse_aggressor(const std::string& str) {
+    if (str == "sequential_write") return Aggressor::SEQUENTIAL_WRITE;
+    if (str == "sequential_read") return Aggressor::SEQUENTIAL_READ;
+    if (str == "copy") return Aggressor::COPY;
+    if (str == "random_read") return Aggressor::RANDOM_READ;
+    if (str == "atomics") return Aggressor::ATOMICS;
+    throw ArgumentError("Invalid aggressor '" + str +
+                        "'. Valid aggressors: sequential_write, sequential_read, copy, random_read, atomics");
+}
+
+std::string aggressor_to_string(Aggressor aggressor) {
+    switch (aggressor) {
+        case Aggressor::SEQUENTIAL_WRITE: return "sequential_write";
+        case Aggressor::SEQUENTIAL_READ: return "sequential_read";
+        case Aggressor::COPY: return "copy";
+        case Aggressor::RANDOM_READ: return "random_read";
+        case Aggressor::ATOMICS: return "atomics";
+    }
+    return "unknown";
+}
+
+bool supports_victim(TestPattern pattern) {
+    return pattern == TestPattern::SEQUENTIAL_READ || pattern == TestPattern::SEQUENTIAL_WRITE ||
+           pattern == TestPattern::COPY || pattern == TestPattern::RANDOM_READ ||
+           pattern == TestPattern::LATENCY_CHASE;
+}
+
+PerformanceStats run_aggressor(Aggressor aggressor, const uint8_t* src_buffer, uint8_t* dst_buffer,
+                               size_t buffer_size, size_t start_offset, size_t end_offset, size_t delay_spins,
+                               const std::atomic<bool>& stop_flag, KernelType kernel, StorePolicy store_policy) {
+    TestPattern pattern = TestPattern::SEQUENTIAL_READ;
+    switch (aggressor) {
+        case Aggressor::ATOMICS:
+            return StandardTests::throttled_atomic_test(dst_buffer, buffer_size, start_offset, end_offset,
+                                                        delay_spins, stop_flag);
+        case Aggressor::SEQUENTIAL_WRITE: pattern = TestPattern::SEQUENTIAL_WRITE; break;
+        case Aggressor::COPY: pattern = TestPattern::COPY; break;
+        case Aggressor::RANDOM_READ: pattern = TestPattern::RANDOM_READ; break;
+        case Aggressor::SEQUENTIAL_READ: break;
+    }
+    return StandardTests::throttled_load_test(src_buffer, dst_buffer, buffer_size, start_offset, end_offset,
+                                              pattern, delay_spins, stop_flag, kernel, store_policy);
+}
+
+void annotate(std::vector<ContentionPoint>& points) {
+    if (points.empty() || points.front().victim_latency_ns <= 0.0) {
+        return;
+    }
+    double baseline = points.front().victim_latency_ns;
+    for (auto& point : points) {
+        point.slowdown = point.victim_latency_ns / baseline;
+    }
+}
+
+std::string parse_schemata(const std::string& str) {
+    std::string text;
+    std::stringstream ss(str);
+    std::string line;
+    while (std::getline(ss, line, ',')) {
+        size_t colon = line.find(':');
+        std::string resource = line.substr(0, colon);
+        bool hexadecimal = false;
+        bool known = false;
+        for (const char* name : CACHE_RESOURCES) {
+            if (resource == name) {
+                known = hexadecimal = true;
+            }
+        }
+        for (const char* name : BANDWIDTH_RESOURCES) {
+            if (resource == name) {
+                known = true;
+            }
+        }
+        if (colon == std::string::npos || !known || !valid_domains(line.substr(colon + 1), hexadecimal)) {
+            throw ArgumentError("Invalid resctrl schemata '" + str +
+                                "'. Expected RESOURCE:ID=VALUE[;ID=VALUE] per resource, comma-separated, "
+                                "such as MB:0=20 or MB:0=30,L3:0=f");
+        }
+        text += line + "\n";
+    }
+    if (text.empty() || str.back() == ',') {
+        throw ArgumentError("Invalid resctrl schemata '" + str + "'. Expected for example MB:0=20");
+    }
+    return text;
+}
+
+long current_thread_id() {
+#ifdef __linux__
+    return static_cast<long>(syscall(SYS_gettid));
+#else
+    return 0;
+#endif
+}
+
+ResctrlGroup::~ResctrlGroup() {
+    remove();
+}
+
+bool ResctrlGroup::create(const std::string& name, const std::string& schemata, std::string& error) {
+#ifdef __linux__
+    remove();
+    struct stat info = {};
+    if (stat((RESCTRL_ROOT + "/schemata").c_str(), &info) != 0) {
+        error = RESCTRL_ROOT + " is not mounted (mount -t resctrl resctrl " + RESCTRL_ROOT +
+                "; needs root and RDT or PQoS support)";
+        return false;
+    }
+    std::string path = RESCTRL_ROOT + "/" + name;
+    if (mkdir(path.c_str(), 0755) != 0 && errno != EEXIST) {
+        error = "cannot create " + path + ": " + std::strerror(errno);
+        return false;
+    }
+    path_ = path;
+    if (!write_file(path_ + "/schemata", schemata, error)) {
+        remove();
+        return false;
+    }
+    schemata_ = schemata;
+    return true;
+#else
+    (void)name;
+    (void)schemata;
+    error = "resctrl is only available on Linux";
+    return false;
+#endif
+}
+
+bool ResctrlGroup::add_thread(long tid, std::string& error) {
+    if (path_.empty()) {
+        error = "resctrl group was not created";
+        return false;
+    }
+    return write_file(path_ + "/tasks", std::to_string(tid), error);
+}
+
+void ResctrlGroup::remove() {
+#ifdef __linux__
+    if (!path_.empty()) {
+        rmdir(path_.c_str());
+    }
+#endif
+    path_.clear();
+    schemata_.clear();
+}
+
+std::string ResctrlGroup::describe() const {
+    std::string text = schemata_;
+    for (char& c : text) {
+        if (c == '\n') {
+            c = ',';
+        }
+    }
+    if (!text.empty()) {
+        text.pop_back();
+    }
+    return text;
+}
+
+}  // namespace Contention
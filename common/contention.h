@@ -0,0 +1,154 @@
+#ifndef CONTENTION_H
+#define CONTENTION_H
+
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <string>
+#include <vector>
+
+#include "simd_kernels.h"
+#include "test_patterns.h"
+
+/**
+ * @brief Noisy-neighbor interference between a victim and an aggressor group
+ *
+ * A victim thread group runs one pattern over its own buffers while an
+ * aggressor group on the remaining workers generates throttled traffic over
+ * different buffers: sequential writes, reads or copies, random cache-line
+ * reads, or atomic updates. Sweeping the aggressor throttle from idle to
+ * unthrottled shows how much the victim slows down per GB/s the neighbors
+ * inject. On Linux, each group can be placed in a resctrl group so Intel
+ * RDT / AMD PQoS memory bandwidth allocation (MB) and cache allocation (L3,
+ * L2) limits can be tested against the same curve.
+ */
+namespace Contention {
+
+/// Parent of every resctrl group (the resctrl filesystem must be mounted)
+const std::string RESCTRL_ROOT = "/sys/fs/resctrl";
+
+/**
+ * @brief Traffic generated by the aggressor group
+ */
+enum class Aggressor {
+    SEQUENTIAL_WRITE,  ///< Streaming writes: the heaviest load on the memory controllers
+    SEQUENTIAL_READ,   ///< Streaming reads
+    COPY,              ///< Streaming reads and writes
+    RANDOM_READ,       ///< Independent random cache-line reads: DRAM page misses, no prefetching
+    ATOMICS            ///< Relaxed fetch_add, one per line
+};
+
+/**
+ * @brief Parse --aggressor: sequential_write, sequential_read, copy, random_read, atomics
+ * @throws ArgumentError for any other value
+ */
+Aggressor parse_aggressor(const std::string& str);
+
+/**
+ * @brief Aggressor as passed to --aggressor and reported in results
+ */
+std::string aggressor_to_string(Aggressor aggressor);
+
+/**
+ * @brief Whether a pattern can run as the victim
+ *
+ * Sequential read and write, copy, random read and latency chase can; the
+ * other patterns need buffers or set-up the contention mode does not have.
+ */
+bool supports_victim(TestPattern pattern);
+
+/**
+ * @brief Run the aggressor load over one thread's slice, at least one chunk and then until stop_flag is set
+ *
+ * @param src_buffer Buffer read by the read and copy aggressors
+ * @param dst_buffer Buffer written by the write and copy aggressors, updated by the atomic one
+ * @param delay_spins Pause instructions between two load chunks (0: unthrottled)
+ * @return PerformanceStats with the bandwidth the aggressor achieved
+ */
+PerformanceStats run_aggressor(Aggressor aggressor, const uint8_t* src_buffer, uint8_t* dst_buffer,
+                               size_t buffer_size, size_t start_offset, size_t end_offset, size_t delay_spins,
+                               const std::atomic<bool>& stop_flag, KernelType kernel = KernelType::AUTO,
+                               StorePolicy store_policy = StorePolicy::TEMPORAL);
+
+/**
+ * @brief One point of a contention curve
+ */
+struct ContentionPoint {
+    size_t aggressor_threads = 0;   ///< Threads generating interference (0: victim alone)
+    size_t delay_spins = 0;         ///< Aggressor pause instructions between two load chunks
+    double aggressor_gbps = 0.0;    ///< Bandwidth achieved by the aggressors
+    double victim_gbps = 0.0;       ///< Bandwidth achieved by the victims
+    double victim_latency_ns = 0.0; ///< Victim mean time per access
+    double slowdown = 0.0;          ///< Victim time per access over that of the first point
+};
+
+/**
+ * @brief Fill in slowdown against the first point, the victim running alone
+ */
+void annotate(std::vector<ContentionPoint>& points);
+
+/**
+ * @brief Parse a resctrl schemata option into the text written to a group's schemata file
+ *
+ * Resources are separated by commas and each is RESOURCE:ID=VALUE[;ID=VALUE...],
+ * for example "MB:0=20;1=20" (memory bandwidth percentage per domain) or
+ * "MB:0=30,L3:0=f" (plus an L3 way mask). Resources are MB, L3, L2 and their
+ * CODE/DATA variants, and SMBA; MB and SMBA values are decimal, cache values
+ * hexadecimal bit masks.
+ *
+ * @return One schemata line per resource, each terminated by a newline
+ * @throws ArgumentError on a malformed value
+ */
+std::string parse_schemata(const std::string& str);
+
+/**
+ * @brief Kernel thread id of the calling thread (what resctrl tasks files take)
+ */
+long current_thread_id();
+
+/**
+ * @brief A resctrl control group created for the run and removed with this object
+ *
+ * Threads added to the group keep its allocation until the group is
+ * removed, at which point the kernel moves them back to the default group.
+ */
+class ResctrlGroup {
+public:
+    ResctrlGroup() = default;
+    ~ResctrlGroup();
+
+    ResctrlGroup(const ResctrlGroup&) = delete;
+    ResctrlGroup& operator=(const ResctrlGroup&) = delete;
+
+    /**
+     * @brief Create RESCTRL_ROOT/name and write its schemata
+     * @param schemata Text returned by parse_schemata
+     * @param error Receives the reason on failure (no group is left behind then)
+     * @return true if the group exists with the given limits
+     */
+    bool create(const std::string& name, const std::string& schemata, std::string& error);
+
+    /**
+     * @brief Move a thread into the group
+     * @param error Receives the reason on failure
+     */
+    bool add_thread(long tid, std::string& error);
+
+    /**
+     * @brief Remove the group (no-op if it was not created)
+     */
+    void remove();
+
+    /**
+     * @brief Limits for run notes ("MB:0=20")
+     */
+    std::string describe() const;
+
+private:
+    std::string path_;
+    std::string schemata_;
+};
+
+}  // namespace Contention
+
+#endif  // CONTENTION_H
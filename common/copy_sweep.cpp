@@ -0,0 +1,458 @@
+#include "copy_sweep.h"
+#include "constants.h"
+#include "cycle_timer.h"
+#include "errors.h"
+
+#include <algorithm>
+#include <cstdint>
+#include <cstring>
+#include <exception>
+#include <map>
+#include <sstream>
+#include <thread>
+#include <tuple>
+
+namespace CopySweep {
+
+namespace {
+
+using Clock = CycleTimer::Clock;
+
+constexpr size_t PAGE_BYTES = 4096;
+constexpr size_t LINE_BYTES = 64;
+constexpr size_t GUARD_BYTES = 64;                 // Checked on both sides of the destination
+constexpr uint8_t CLEAR_BYTE = 0x00;
+constexpr uint8_t SET_BYTE = 0x5A;
+constexpr uint64_t SET_PATTERN = 0x5A5A5A5A5A5A5A5AULL;
+
+void copy_libc(uint8_t* dst, const uint8_t* src, size_t bytes) {
+    std::memcpy(dst, src, bytes);
+}
+
+void set_libc(uint8_t* data, size_t bytes, uint64_t pattern) {
+    std::memset(data, static_cast<int>(pattern & 0xFF), bytes);
+}
+
+#if defined(__x86_64__) || defined(__i386__)
+void copy_rep_movsb(uint8_t* dst, const uint8_t* src, size_t bytes) {
+    asm volatile("rep movsb" : "+D"(dst), "+S"(src), "+c"(bytes) : : "memory");
+}
+
+void set_rep_stosb(uint8_t* data, size_t bytes, uint64_t pattern) {
+    asm volatile("rep stosb" : "+D"(data), "+c"(bytes) : "a"(static_cast<uint8_t>(pattern)) : "memory");
+}
+#endif
+
+size_t round_up(size_t value, size_t granule) {
+    return (value + granule - 1) / granule * granule;
+}
+
+// Vector storage starting on a page, so every offset is relative to a known alignment
+class PageAlignedBuffer {
+public:
+    explicit PageAlignedBuffer(size_t bytes) : storage_(bytes + PAGE_BYTES) {
+        uintptr_t raw = reinterpret_cast<uintptr_t>(storage_.data());
+        base_ = storage_.data() + (round_up(raw, PAGE_BYTES) - raw);
+    }
+
+    uint8_t* data() { return base_; }
+
+private:
+    std::vector<uint8_t> storage_;
+    uint8_t* base_ = nullptr;
+};
+
+// The SIMD non-temporal kernels expect a line-aligned destination: the partial lines go through libc
+inline void call(const Implementation& implementation, Operation operation, uint8_t* dst, const uint8_t* src,
+                 size_t bytes) {
+    if (!implementation.nontemporal) {
+        if (operation == Operation::COPY) {
+            implementation.copy(dst, src, bytes);
+        } else {
+            implementation.set(dst, bytes, SET_PATTERN);
+        }
+        return;
+    }
+    size_t head = std::min((LINE_BYTES - (reinterpret_cast<uintptr_t>(dst) & (LINE_BYTES - 1))) & (LINE_BYTES - 1),
+                           bytes);
+    size_t body = (bytes - head) & ~(LINE_BYTES - 1);
+    size_t done = head + body;
+    if (operation == Operation::COPY) {
+        std::memcpy(dst, src, head);
+        implementation.copy(dst + head, src + head, body);
+        std::memcpy(dst + done, src + done, bytes - done);
+    } else {
+        std::memset(dst, SET_BYTE, head);
+        implementation.set(dst + head, body, SET_PATTERN);
+        std::memset(dst + done, SET_BYTE, bytes - done);
+    }
+}
+
+// One call over a cleared destination: the expected bytes land, and the bytes around them stay clear
+bool verify(const Implementation& implementation, Operation operation, uint8_t* destination,
+            const uint8_t* source, size_t bytes, const Alignment& alignment) {
+    size_t window = alignment.destination_offset + bytes + GUARD_BYTES;
+    std::memset(destination, CLEAR_BYTE, window);
+    uint8_t* dst = destination + alignment.destination_offset;
+    const uint8_t* src = source + alignment.source_offset;
+    call(implementation, operation, dst, src, bytes);
+
+    auto clear = [](const uint8_t* begin, const uint8_t* end) {
+        return std::all_of(begin, end, [](uint8_t byte) { return byte == CLEAR_BYTE; });
+    };
+    if (!clear(destination, dst) || !clear(dst + bytes, destination + window)) {
+        return false;
+    }
+    if (operation == Operation::COPY) {
+        return std::memcmp(dst, src, bytes) == 0;
+    }
+    return std::all_of(dst, dst + bytes, [](uint8_t byte) { return byte == SET_BYTE; });
+}
+
+double time_run(const Implementation& implementation, Operation operation, uint8_t* dst, const uint8_t* src,
+                size_t bytes, size_t calls) {
+    Clock::time_point start = Clock::now();
+    for (size_t i = 0; i < calls; ++i) {
+        call(implementation, operation, dst, src, bytes);
+        asm volatile("" : : "r"(dst) : "memory");  // Every call stores; none can be merged or dropped
+    }
+    return CycleTimer::elapsed_seconds(start, Clock::now());
+}
+
+Point measure(const Implementation& implementation, Operation operation, size_t bytes, const Alignment& alignment,
+              uint8_t* destination, const uint8_t* source, size_t repetitions) {
+    Point point;
+    point.operation = operation;
+    point.implementation = implementation.name;
+    point.alignment = alignment;
+    point.bytes = bytes;
+    point.calls = std::min(std::max(BenchmarkConstants::MEMCPY_RUN_BYTES / bytes, BenchmarkConstants::MEMCPY_MIN_CALLS),
+                           BenchmarkConstants::MEMCPY_MAX_CALLS);
+    point.verified = verify(implementation, operation, destination, source, bytes, alignment);
+
+    uint8_t* dst = destination + alignment.destination_offset;
+    const uint8_t* src = source + alignment.source_offset;
+    time_run(implementation, operation, dst, src, bytes, point.calls);  // Warm-up
+    std::vector<double> seconds;
+    for (size_t i = 0; i < std::max<size_t>(repetitions, 1); ++i) {
+        seconds.push_back(time_run(implementation, operation, dst, src, bytes, point.calls));
+    }
+    std::sort(seconds.begin(), seconds.end());
+    double median = seconds[seconds.size() / 2];
+    if (seconds.size() % 2 == 0) {
+        median = (median + seconds[seconds.size() / 2 - 1]) / 2.0;
+    }
+    point.ns_per_call = median * 1e9 / static_cast<double>(point.calls);
+    point.bandwidth_gbps = point.ns_per_call > 0.0 ? static_cast<double>(bytes) / point.ns_per_call : 0.0;
+    return point;
+}
+
+// Bytes with an optional k, m or g suffix
+size_t parse_bytes(const std::string& text, const std::string& range) {
+    size_t multiplier = 1;
+    std::string digits = text;
+    if (!digits.empty()) {
+        switch (digits.back()) {
+            case 'k': case 'K': multiplier = BenchmarkConstants::KB; break;
+            case 'm': case 'M': multiplier = BenchmarkConstants::MB; break;
+            case 'g': case 'G': multiplier = BenchmarkConstants::GB; break;
+            default: break;
+        }
+        if (multiplier != 1) {
+            digits.pop_back();
+        }
+    }
+    if (digits.empty() || digits.size() > 10 || digits.find_first_not_of("0123456789") != std::string::npos) {
+        throw ArgumentError("Invalid --memcpy-sizes '" + range + "'. Expected MIN-MAX such as 16-64m");
+    }
+    size_t bytes = std::stoull(digits) * multiplier;
+    if (bytes < BenchmarkConstants::MEMCPY_MIN_BYTES || bytes % 8 != 0 || bytes > BenchmarkConstants::MEMCPY_MAX_BYTES) {
+        throw ArgumentError("--memcpy-sizes bound '" + text + "' must be a multiple of 8 bytes from " +
+                            std::to_string(BenchmarkConstants::MEMCPY_MIN_BYTES) + " to " +
+                            std::to_string(BenchmarkConstants::MEMCPY_MAX_BYTES / BenchmarkConstants::GB) + "g");
+    }
+    return bytes;
+}
+
+size_t parse_offset(const std::string& text, const std::string& item) {
+    if (text.empty() || text.size() > 2 || text.find_first_not_of("0123456789") != std::string::npos ||
+        std::stoul(text) > BenchmarkConstants::MEMCPY_MAX_OFFSET) {
+        throw ArgumentError("Invalid --memcpy-align pair '" + item + "'. Expected SRC:DST offsets from 0 to " +
+                            std::to_string(BenchmarkConstants::MEMCPY_MAX_OFFSET));
+    }
+    return std::stoul(text);
+}
+
+}  // namespace
+
+std::string operation_to_string(Operation operation) {
+    return operation == Operation::SET ? "set" : "copy";
+}
+
+std::vector<Operation> parse_operations(const std::string& list) {
+    std::vector<Operation> operations;
+    std::stringstream stream(list);
+    std::string name;
+    while (std::getline(stream, name, ',')) {
+        Operation operation;
+        if (name == "copy") {
+            operation = Operation::COPY;
+        } else if (name == "set") {
+            operation = Operation::SET;
+        } else {
+            throw ArgumentError("Unknown --memcpy-ops operation '" + name + "' (expected copy or set)");
+        }
+        if (std::find(operations.begin(), operations.end(), operation) == operations.end()) {
+            operations.push_back(operation);
+        }
+    }
+    if (operations.empty()) {
+        throw ArgumentError("--memcpy-ops needs at least one operation");
+    }
+    return operations;
+}
+
+std::vector<std::string> default_implementation_names() {
+    std::vector<std::string> names = {"libc"};
+#if defined(__x86_64__) || defined(__i386__)
+    names.push_back("rep");
+#endif
+    for (KernelType type : SimdKernels::get_supported_kernels()) {
+        if (type != KernelType::SCALAR) {
+            names.push_back(SimdKernels::kernel_type_to_string(type));
+        }
+    }
+    KernelType widest = SimdKernels::resolve_kernel(KernelType::AUTO);
+    if (SimdKernels::is_store_policy_supported(widest, StorePolicy::NONTEMPORAL)) {
+        names.push_back(SimdKernels::kernel_type_to_string(widest) + "-nt");
+    }
+    return names;
+}
+
+std::vector<Implementation> parse_implementations(const std::string& list) {
+    std::vector<std::string> names;
+    std::stringstream stream(list);
+    std::string name;
+    while (std::getline(stream, name, ',')) {
+        if (name == "all") {
+            std::vector<std::string> defaults = default_implementation_names();
+            names.insert(names.end(), defaults.begin(), defaults.end());
+        } else {
+            names.push_back(name);
+        }
+    }
+
+    std::vector<Implementation> implementations;
+    for (const std::string& entry : names) {
+        auto same = [&entry](const Implementation& known) { return known.name == entry; };
+        if (std::find_if(implementations.begin(), implementations.end(), same) != implementations.end()) {
+            continue;
+        }
+        Implementation implementation;
+        implementation.name = entry;
+        if (entry == "libc") {
+            implementation.copy = copy_libc;
+            implementation.set = set_libc;
+        } else if (entry == "rep") {
+#if defined(__x86_64__) || defined(__i386__)
+            implementation.copy = copy_rep_movsb;
+            implementation.set = set_rep_stosb;
+#else
+            throw ArgumentError("--memcpy-impls rep needs an x86 CPU (REP MOVSB/STOSB)");
+#endif
+        } else {
+            std::string kernel_name = entry;
+            implementation.nontemporal =
+                kernel_name.size() > 3 && kernel_name.compare(kernel_name.size() - 3, 3, "-nt") == 0;
+            if (implementation.nontemporal) {
+                kernel_name.resize(kernel_name.size() - 3);
+            }
+            std::vector<std::string> kernels = SimdKernels::get_kernel_names();
+            if (kernel_name == "auto" || std::find(kernels.begin(), kernels.end(), kernel_name) == kernels.end()) {
+                throw ArgumentError("Unknown --memcpy-impls implementation '" + entry +
+                                    "' (expected all, libc, rep, a --kernel name or one with -nt)");
+            }
+            KernelType type = SimdKernels::string_to_kernel_type(kernel_name);
+            StorePolicy policy = implementation.nontemporal ? StorePolicy::NONTEMPORAL : StorePolicy::TEMPORAL;
+            if (!SimdKernels::is_store_policy_supported(type, policy)) {
+                throw ArgumentError("--memcpy-impls implementation '" + entry + "' is not supported on this CPU");
+            }
+            SimdKernels::StoreKernels kernels_for_policy = SimdKernels::get_store_kernels(type, policy);
+            implementation.copy = kernels_for_policy.copy;
+            implementation.set = kernels_for_policy.write;
+        }
+        implementations.push_back(implementation);
+    }
+    if (implementations.empty()) {
+        throw ArgumentError("--memcpy-impls needs at least one implementation");
+    }
+    return implementations;
+}
+
+std::string alignment_to_string(const Alignment& alignment) {
+    return "src+" + std::to_string(alignment.source_offset) + "/dst+" + std::to_string(alignment.destination_offset);
+}
+
+std::vector<Alignment> parse_alignments(const std::string& list) {
+    std::vector<Alignment> alignments;
+    std::stringstream stream(list);
+    std::string item;
+    while (std::getline(stream, item, ',')) {
+        size_t colon = item.find(':');
+        if (colon == std::string::npos) {
+            throw ArgumentError("Invalid --memcpy-align pair '" + item + "'. Expected SRC:DST such as 1:0");
+        }
+        Alignment alignment;
+        alignment.source_offset = parse_offset(item.substr(0, colon), item);
+        alignment.destination_offset = parse_offset(item.substr(colon + 1), item);
+        auto same = [&alignment](const Alignment& known) {
+            return known.source_offset == alignment.source_offset &&
+                   known.destination_offset == alignment.destination_offset;
+        };
+        if (std::find_if(alignments.begin(), alignments.end(), same) == alignments.end()) {
+            alignments.push_back(alignment);
+        }
+    }
+    if (alignments.empty()) {
+        throw ArgumentError("--memcpy-align needs at least one SRC:DST pair");
+    }
+    return alignments;
+}
+
+std::pair<size_t, size_t> parse_size_range(const std::string& range) {
+    size_t dash = range.find('-');
+    size_t min_bytes = parse_bytes(range.substr(0, dash), range);
+    size_t max_bytes = dash == std::string::npos ? min_bytes : parse_bytes(range.substr(dash + 1), range);
+    if (min_bytes > max_bytes) {
+        throw ArgumentError("Invalid --memcpy-sizes '" + range + "': MIN is larger than MAX");
+    }
+    return {min_bytes, max_bytes};
+}
+
+std::vector<size_t> size_ladder(size_t min_bytes, size_t max_bytes) {
+    std::vector<size_t> sizes = {min_bytes};
+    for (size_t power = 8; power <= max_bytes; power *= 2) {
+        for (size_t size : {power, power + power / 2}) {
+            if (size % 8 == 0 && size > min_bytes && size < max_bytes) {
+                sizes.push_back(size);
+            }
+        }
+    }
+    if (max_bytes > min_bytes) {
+        sizes.push_back(max_bytes);
+    }
+    return sizes;
+}
+
+std::vector<Crossover> crossovers(const std::vector<Point>& points) {
+    // Rates by (operation, source offset, destination offset), then size, then implementation
+    using Key = std::tuple<int, size_t, size_t>;
+    std::vector<Key> order;
+    std::map<Key, std::map<size_t, std::map<std::string, double>>> groups;
+    for (const Point& point : points) {
+        Key key{static_cast<int>(point.operation), point.alignment.source_offset, point.alignment.destination_offset};
+        if (groups.find(key) == groups.end()) {
+            order.push_back(key);
+        }
+        auto& rates = groups[key][point.bytes];
+        if (point.verified) {
+            rates[point.implementation] = point.bandwidth_gbps;
+        }
+    }
+
+    std::vector<Crossover> result;
+    for (const Key& key : order) {
+        std::string current;
+        for (const auto& size_rates : groups[key]) {
+            const std::map<std::string, double>& rates = size_rates.second;
+            if (rates.empty()) {
+                continue;
+            }
+            auto best = std::max_element(rates.begin(), rates.end(),
+                                         [](const auto& a, const auto& b) { return a.second < b.second; });
+            auto held = rates.find(current);
+            bool take_over = held == rates.end() ||
+                             (best->first != current &&
+                              best->second > held->second * (1.0 + BenchmarkConstants::MEMCPY_CROSSOVER_MARGIN));
+            if (take_over) {
+                Crossover crossover;
+                crossover.operation = static_cast<Operation>(std::get<0>(key));
+                crossover.alignment.source_offset = std::get<1>(key);
+                crossover.alignment.destination_offset = std::get<2>(key);
+                crossover.from_bytes = size_rates.first;
+                crossover.to_bytes = size_rates.first;
+                crossover.implementation = best->first;
+                crossover.peak_gbps = best->second;
+                result.push_back(crossover);
+                current = best->first;
+            } else {
+                result.back().to_bytes = size_rates.first;
+                result.back().peak_gbps = std::max(result.back().peak_gbps, held->second);
+            }
+        }
+    }
+    return result;
+}
+
+std::vector<Point> run(const std::vector<Operation>& operations, const std::vector<Implementation>& implementations,
+                       const std::vector<Alignment>& alignments, const std::vector<size_t>& sizes,
+                       size_t repetitions, size_t cpu, const CoherenceTests::PinFunction& pin) {
+    std::vector<Point> points;
+    if (sizes.empty()) {
+        return points;
+    }
+    size_t buffer_bytes = *std::max_element(sizes.begin(), sizes.end()) + BenchmarkConstants::MEMCPY_MAX_OFFSET +
+                          GUARD_BYTES;
+
+    std::exception_ptr error;
+    std::thread worker([&] {
+        try {
+            if (pin) {
+                pin(cpu);
+            }
+            // Allocated and written on the measuring thread, so the pages are local to its node
+            PageAlignedBuffer source(buffer_bytes);
+            PageAlignedBuffer destination(buffer_bytes);
+            for (size_t i = 0; i < buffer_bytes; ++i) {
+                source.data()[i] = static_cast<uint8_t>(i * 131 + 7);
+            }
+
+            for (Operation operation : operations) {
+                std::vector<Alignment> runs;
+                for (const Alignment& alignment : alignments) {
+                    Alignment effective = alignment;
+                    if (operation == Operation::SET) {
+                        effective.source_offset = 0;  // memset has no source
+                    }
+                    auto same = [&effective](const Alignment& known) {
+                        return known.source_offset == effective.source_offset &&
+                               known.destination_offset == effective.destination_offset;
+                    };
+                    if (std::find_if(runs.begin(), runs.end(), same) == runs.end()) {
+                        runs.push_back(effective);
+                    }
+                }
+                for (const Alignment& alignment : runs) {
+                    for (const Implementation& implementation : implementations) {
+                        for (size_t bytes : sizes) {
+                            if (implementation.nontemporal && bytes < BenchmarkConstants::MEMCPY_NT_MIN_BYTES) {
+                                continue;
+                            }
+                            points.push_back(measure(implementation, operation, bytes, alignment,
+                                                     destination.data(), source.data(), repetitions));
+                        }
+                    }
+                }
+            }
+        } catch (...) {
+            error = std::current_exception();
+        }
+    });
+    worker.join();
+    if (error) {
+        std::rethrow_exception(error);
+    }
+    return points;
+}
+
+}  // namespace CopySweep
@@ -0,0 +1,164 @@
+#ifndef COPY_SWEEP_H
+#define COPY_SWEEP_H
+
+#include <cstddef>
+#include <string>
+#include <utility>
+#include <vector>
+
+#include "coherence_tests.h"
+#include "simd_kernels.h"
+
+/**
+ * @brief memcpy and memset implementations across size classes
+ *
+ * The copy pattern times one copy of the whole working set per pass; most
+ * copies in a service move 64 B to 64 KB buffers, where the cost of the
+ * call, the libc dispatch, the startup of REP MOVSB (ERMS, FSRM) and the
+ * alignment of each end decide the rate, not the memory bandwidth. The
+ * sweep calls each implementation over a geometric ladder of sizes and
+ * source/destination misalignments, back to back on warm buffers: libc
+ * memcpy and memset, REP MOVSB and REP STOSB on x86, every SIMD kernel
+ * this CPU supports, and their non-temporal variants from
+ * MEMCPY_NT_MIN_BYTES up. The sizes at which the fastest implementation
+ * changes are the thresholds a copy routine should switch at.
+ */
+namespace CopySweep {
+
+/**
+ * @brief Function measured
+ */
+enum class Operation {
+    COPY,  ///< memcpy: source to destination
+    SET    ///< memset: one byte value over the destination
+};
+
+/**
+ * @brief Operation as reported in results ("copy", "set")
+ */
+std::string operation_to_string(Operation operation);
+
+/**
+ * @brief Parse --memcpy-ops: copy, set or both, comma-separated
+ * @throws ArgumentError on an unknown name or an empty list
+ */
+std::vector<Operation> parse_operations(const std::string& list);
+
+/**
+ * @brief One copy and set routine
+ */
+struct Implementation {
+    std::string name;                         ///< "libc", "rep", a kernel name ("avx2") or one with "-nt"
+    SimdKernels::CopyKernel copy = nullptr;
+    SimdKernels::WriteKernel set = nullptr;   ///< Stores the low byte of the pattern, replicated
+    bool nontemporal = false;                 ///< Only measured from MEMCPY_NT_MIN_BYTES up; the partial
+                                              ///< lines at both ends go through libc, as in a streaming memcpy
+};
+
+/**
+ * @brief Implementations "all" stands for on this CPU
+ *
+ * libc, rep on x86, every supported SIMD kernel but scalar, and the
+ * non-temporal variant of the widest one.
+ */
+std::vector<std::string> default_implementation_names();
+
+/**
+ * @brief Parse --memcpy-impls: "all", or a comma-separated list of libc, rep, kernel names and kernel-nt names
+ * @throws ArgumentError on an unknown name, one this CPU cannot run, or an empty list
+ */
+std::vector<Implementation> parse_implementations(const std::string& list);
+
+/**
+ * @brief Byte offsets of both ends from a page boundary
+ */
+struct Alignment {
+    size_t source_offset = 0;
+    size_t destination_offset = 0;
+};
+
+/**
+ * @brief Alignment as reported in results ("src+1/dst+0")
+ */
+std::string alignment_to_string(const Alignment& alignment);
+
+/**
+ * @brief Parse --memcpy-align: comma-separated SRC:DST offsets from 0 to MEMCPY_MAX_OFFSET ("0:0,1:0,0:1")
+ * @throws ArgumentError on a malformed or out-of-range pair, or an empty list
+ */
+std::vector<Alignment> parse_alignments(const std::string& list);
+
+/**
+ * @brief Parse --memcpy-sizes: MIN-MAX, or one size, with optional k, m or g suffixes ("16-64m")
+ *
+ * Both ends are multiples of 8 bytes from MEMCPY_MIN_BYTES to
+ * MEMCPY_MAX_BYTES, and MIN is at most MAX.
+ *
+ * @return {MIN, MAX} in bytes
+ * @throws ArgumentError on a malformed or out-of-range bound
+ */
+std::pair<size_t, size_t> parse_size_range(const std::string& range);
+
+/**
+ * @brief Powers of two and their midpoints (3 * 2^(k-1)) from min_bytes to max_bytes
+ *
+ * Every size is a multiple of 8; min_bytes opens and max_bytes closes the
+ * ladder when they are not on it.
+ */
+std::vector<size_t> size_ladder(size_t min_bytes, size_t max_bytes);
+
+/**
+ * @brief One implementation at one size and alignment
+ */
+struct Point {
+    Operation operation = Operation::COPY;
+    std::string implementation;
+    Alignment alignment;             ///< source_offset is 0 for SET
+    size_t bytes = 0;
+    size_t calls = 0;                ///< Calls per timed run
+    double ns_per_call = 0.0;        ///< Median over the timed runs
+    double bandwidth_gbps = 0.0;     ///< bytes / ns_per_call (bytes written; a copy also reads as many)
+    bool verified = false;           ///< Destination holds the expected bytes and its neighbours are untouched
+};
+
+/**
+ * @brief Sizes over which one implementation stays the fastest
+ */
+struct Crossover {
+    Operation operation = Operation::COPY;
+    Alignment alignment;
+    size_t from_bytes = 0;
+    size_t to_bytes = 0;
+    std::string implementation;
+    double peak_gbps = 0.0;          ///< Best rate of the implementation over the range
+};
+
+/**
+ * @brief Fastest implementation by size class, per operation and alignment
+ *
+ * A new implementation takes over only when it beats the current one by
+ * MEMCPY_CROSSOVER_MARGIN at that size (or the current one has no
+ * verified point there), so near ties do not split the ladder into many
+ * one-size ranges.
+ */
+std::vector<Crossover> crossovers(const std::vector<Point>& points);
+
+/**
+ * @brief Every operation, implementation, alignment and size, optionally pinned to one CPU
+ *
+ * A run repeats one call on the same page-aligned buffers
+ * MEMCPY_RUN_BYTES / bytes times, clamped to MEMCPY_MIN_CALLS and
+ * MEMCPY_MAX_CALLS; one warm-up run is discarded. SET runs once per
+ * distinct destination offset.
+ *
+ * @param repetitions Timed runs per point (median reported)
+ * @param pin Pins the measuring thread to cpu (empty: no pinning)
+ * @return Operation by operation, then alignment, implementation and size
+ */
+std::vector<Point> run(const std::vector<Operation>& operations, const std::vector<Implementation>& implementations,
+                       const std::vector<Alignment>& alignments, const std::vector<size_t>& sizes,
+                       size_t repetitions, size_t cpu, const CoherenceTests::PinFunction& pin);
+
+}  // namespace CopySweep
+
+#endif  // COPY_SWEEP_H
@@ -0,0 +1,109 @@
+#include "cpu_features.h"
+
+#include <cstdint>
+
+#if defined(__x86_64__) || defined(__amd64__)
+#include <cpuid.h>
+#endif
+
+#if defined(__linux__) && defined(__aarch64__)
+#include <asm/hwcap.h>
+#include <sys/auxv.h>
+#endif
+
+namespace CpuFeatureDetection {
+
+namespace {
+
+CpuFeatures detect_cpu_features() {
+    CpuFeatures features = {};
+
+#if defined(__x86_64__) || defined(__amd64__)
+    // __builtin_cpu_supports also checks XCR0, so AVX/AVX-512 are only
+    // reported when the OS saves the wider register state
+    __builtin_cpu_init();
+    features.sse2 = __builtin_cpu_supports("sse2");
+    features.avx2 = __builtin_cpu_supports("avx2");
+    features.fma = __builtin_cpu_supports("fma");
+    features.avx512f = __builtin_cpu_supports("avx512f");
+
+    // CLZERO is reported in CPUID 0x80000008 EBX bit 0 (AMD only)
+    unsigned int eax = 0, ebx = 0, ecx = 0, edx = 0;
+    if (__get_cpuid(0x80000008, &eax, &ebx, &ecx, &edx)) {
+        features.clzero = (ebx & 1u) != 0;
+    }
+
+    // AMX is reported in CPUID 7.0 EDX (bf16 bit 22, tile bit 24, int8 bit 25).
+    // Linux additionally requires a per-process permission request before
+    // tile data may be used; the AMX matrix multiplier asks for it. Bit 15
+    // marks Intel hybrid parts (Alder Lake and later). CLFLUSHOPT is EBX bit 23,
+    // ERMS EBX bit 9 and FSRM EDX bit 4.
+    if (__get_cpuid_count(7, 0, &eax, &ebx, &ecx, &edx)) {
+        features.clflushopt = (ebx & (1u << 23)) != 0;
+        features.erms = (ebx & (1u << 9)) != 0;
+        features.fsrm = (edx & (1u << 4)) != 0;
+        features.amx_bf16 = (edx & (1u << 22)) != 0;
+        features.amx_tile = (edx & (1u << 24)) != 0;
+        features.amx_int8 = (edx & (1u << 25)) != 0;
+        features.hybrid = (edx & (1u << 15)) != 0;
+    }
+#elif defined(__aarch64__)
+    // Advanced SIMD is mandatory on AArch64
+    features.neon = true;
+#if defined(__linux__) && defined(HWCAP_SVE)
+    features.sve = (getauxval(AT_HWCAP) & HWCAP_SVE) != 0;
+#endif
+#if defined(__linux__) && defined(HWCAP_ATOMICS)
+    features.lse = (getauxval(AT_HWCAP) & HWCAP_ATOMICS) != 0;
+#elif defined(__APPLE__)
+    // Every Apple silicon core implements ARMv8.4-A or later, LSE included
+    features.lse = true;
+#endif
+
+    // DCZID_EL0: bit 4 (DZP) prohibits DC ZVA, bits 3:0 are log2(block size in words)
+    uint64_t dczid = 0;
+    asm volatile("mrs %0, dczid_el0" : "=r"(dczid));
+    features.dc_zva = (dczid & 0x10) == 0;
+    features.dc_zva_block_size = features.dc_zva ? (4u << (dczid & 0xF)) : 0;
+#endif
+
+    return features;
+}
+
+}  // namespace
+
+const CpuFeatures& get_cpu_features() {
+    static const CpuFeatures features = detect_cpu_features();
+    return features;
+}
+
+std::string describe_cpu_features() {
+    const CpuFeatures& features = get_cpu_features();
+    std::string result;
+
+    auto append = [&result](bool present, const char* name) {
+        if (!present) return;
+        if (!result.empty()) result += " ";
+        result += name;
+    };
+
+    append(features.sse2, "sse2");
+    append(features.avx2, "avx2");
+    append(features.fma, "fma");
+    append(features.avx512f, "avx512f");
+    append(features.clzero, "clzero");
+    append(features.clflushopt, "clflushopt");
+    append(features.erms, "erms");
+    append(features.fsrm, "fsrm");
+    append(features.amx_tile, "amx-tile");
+    append(features.amx_bf16, "amx-bf16");
+    append(features.amx_int8, "amx-int8");
+    append(features.neon, "neon");
+    append(features.sve, "sve");
+    append(features.lse, "lse");
+    append(features.dc_zva, "dczva");
+
+    return result.empty() ? "none" : result;
+}
+
+}  // namespace CpuFeatureDetection
@@ -0,0 +1,53 @@
+#ifndef CPU_FEATURES_H
+#define CPU_FEATURES_H
+
+#include <cstddef>
+#include <string>
+
+/**
+ * @brief Runtime CPU instruction set feature flags
+ *
+ * Populated once from CPUID (x86) or the auxiliary vector (Linux/aarch64)
+ * so kernel dispatch reflects what the running CPU and OS actually support,
+ * not what the binary was compiled for.
+ */
+struct CpuFeatures {
+    bool sse2;     ///< x86 SSE2 (128-bit integer/double vectors)
+    bool avx2;     ///< x86 AVX2 (256-bit integer vectors)
+    bool fma;      ///< x86 FMA3
+    bool avx512f;  ///< x86 AVX-512 Foundation (512-bit vectors)
+    bool clzero;   ///< AMD CLZERO (zero a cache line without reading it)
+    bool clflushopt;  ///< x86 CLFLUSHOPT (weakly ordered cache line flush)
+    bool erms;     ///< x86 Enhanced REP MOVSB/STOSB (microcoded string copies at line granularity)
+    bool fsrm;     ///< x86 Fast Short REP MOV (REP MOVSB fast below 128 bytes too)
+    bool amx_tile;  ///< x86 AMX tile registers (TILECFG/TILEDATA)
+    bool amx_bf16;  ///< x86 AMX BF16 tile multiply (TDPBF16PS)
+    bool amx_int8;  ///< x86 AMX INT8 tile multiply (TDPBSSD and variants)
+    bool hybrid;   ///< x86 hybrid part: performance and efficiency cores in one package (CPUID 0x1A is valid)
+    bool neon;     ///< ARM Advanced SIMD (128-bit vectors)
+    bool sve;      ///< ARM Scalable Vector Extension
+    bool lse;      ///< ARM Large System Extensions: single-instruction atomics (LDADD, CAS, SWP)
+    bool dc_zva;   ///< ARM DC ZVA permitted at EL0 (zero a block without reading it)
+    size_t dc_zva_block_size;  ///< Bytes zeroed by one DC ZVA (0 if unavailable)
+};
+
+namespace CpuFeatureDetection {
+
+/**
+ * @brief Get the CPU features of the running machine
+ *
+ * Detection runs on first call; subsequent calls return the cached result.
+ *
+ * @return Reference to the detected feature flags
+ */
+const CpuFeatures& get_cpu_features();
+
+/**
+ * @brief Describe detected SIMD features as a space-separated list
+ * @return Feature list such as "sse2 avx2 fma avx512f"
+ */
+std::string describe_cpu_features();
+
+}  // namespace CpuFeatureDetection
+
+#endif  // CPU_FEATURES_H
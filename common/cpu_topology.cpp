@@ -0,0 +1,548 @@
+#include "cpu_topology.h"
+#include "cpu_features.h"
+#include "errors.h"
+#include "numa_utils.h"
+#include "safe_file_utils.h"
+
+#include <algorithm>
+#include <map>
+#include <set>
+#include <sstream>
+#include <thread>
+#include <tuple>
+#include <utility>
+
+#ifdef __linux__
+#include <pthread.h>
+#include <sched.h>
+#endif
+
+#if defined(__x86_64__) || defined(__amd64__)
+#include <cpuid.h>
+#endif
+
+namespace CpuTopologyUtils {
+
+namespace {
+
+const std::string LIST_PREFIX = "list:";
+
+#ifdef __linux__
+const std::string CPU_SYSFS_ROOT = "/sys/devices/system/cpu/";
+constexpr size_t MAX_CACHE_INDICES = 8;  // index0..index7 covers L1I, L1D, L2, L3 and L4 with room to spare
+
+bool read_size(const std::string& path, size_t& value) {
+    std::string text;
+    if (!SafeFileUtils::read_single_line(path, text)) {
+        return false;
+    }
+    try {
+        value = std::stoul(text);
+    } catch (const std::exception&) {
+        return false;
+    }
+    return true;
+}
+
+// CPUs sharing the highest-level data or unified cache of a CPU
+std::vector<size_t> read_llc_shared(size_t cpu) {
+    std::vector<size_t> shared;
+    size_t best_level = 0;
+    for (size_t index = 0; index < MAX_CACHE_INDICES; ++index) {
+        std::string base = CPU_SYSFS_ROOT + "cpu" + std::to_string(cpu) + "/cache/index" + std::to_string(index) + "/";
+        size_t level = 0;
+        if (!read_size(base + "level", level)) {
+            break;
+        }
+        std::string type;
+        std::string list;
+        if (!SafeFileUtils::read_single_line(base + "type", type) || type == "Instruction" || level < best_level ||
+            !SafeFileUtils::read_single_line(base + "shared_cpu_list", list)) {
+            continue;
+        }
+        best_level = level;
+        shared = NumaUtils::parse_id_list(list);
+    }
+    return shared;
+}
+// Bytes of a sysfs cache size such as "48K" or "2M"
+bool read_cache_bytes(const std::string& path, size_t& bytes) {
+    std::string text;
+    if (!SafeFileUtils::read_single_line(path, text)) {
+        return false;
+    }
+    size_t value = 0;
+    size_t digits = 0;
+    try {
+        value = std::stoul(text, &digits);
+    } catch (const std::exception&) {
+        return false;
+    }
+    std::string unit = text.substr(digits);
+    if (unit == "K") {
+        value *= 1024;
+    } else if (unit == "M") {
+        value *= 1024 * 1024;
+    } else if (!unit.empty()) {
+        return false;
+    }
+    bytes = value;
+    return value > 0;
+}
+
+bool contains(const std::vector<size_t>& ids, size_t id) {
+    return std::find(ids.begin(), ids.end(), id) != ids.end();
+}
+
+// Intel hybrid parts register one perf PMU per core type, each listing its CPUs
+bool read_hybrid_pmu_types(std::vector<SysfsCpu>& cpus) {
+    std::string core_list;
+    std::string atom_list;
+    if (!SafeFileUtils::read_single_line("/sys/devices/cpu_core/cpus", core_list) ||
+        !SafeFileUtils::read_single_line("/sys/devices/cpu_atom/cpus", atom_list)) {
+        return false;
+    }
+    std::vector<size_t> performance = NumaUtils::parse_id_list(core_list);
+    std::vector<size_t> efficiency = NumaUtils::parse_id_list(atom_list);
+    for (auto& cpu : cpus) {
+        if (contains(performance, cpu.cpu)) {
+            cpu.core_type = CPUAffinityType::P_CORES;
+        } else if (contains(efficiency, cpu.cpu)) {
+            cpu.core_type = CPUAffinityType::E_CORES;
+        }
+    }
+    return !performance.empty() && !efficiency.empty();
+}
+
+#if defined(__x86_64__) || defined(__amd64__)
+constexpr unsigned int INTEL_CORE_TYPE_ATOM = 0x20;  // CPUID 0x1A EAX[31:24]
+constexpr unsigned int INTEL_CORE_TYPE_CORE = 0x40;
+
+// CPUID 0x1A describes the CPU executing it, so a pinned probe thread visits
+// each CPU in turn (kernels before 5.13 lack the cpu_core/cpu_atom PMUs)
+void read_cpuid_core_types(std::vector<SysfsCpu>& cpus) {
+    if (!CpuFeatureDetection::get_cpu_features().hybrid) {
+        return;
+    }
+    for (auto& cpu : cpus) {
+        if (cpu.cpu >= CPU_SETSIZE) {
+            continue;
+        }
+        std::thread probe([&cpu]() {
+            cpu_set_t cpuset;
+            CPU_ZERO(&cpuset);
+            CPU_SET(cpu.cpu, &cpuset);
+            unsigned int eax = 0, ebx = 0, ecx = 0, edx = 0;
+            if (pthread_setaffinity_np(pthread_self(), sizeof(cpu_set_t), &cpuset) != 0 ||
+                !__get_cpuid_count(0x1A, 0, &eax, &ebx, &ecx, &edx)) {
+                return;
+            }
+            unsigned int type = eax >> 24;
+            if (type == INTEL_CORE_TYPE_CORE) {
+                cpu.core_type = CPUAffinityType::P_CORES;
+            } else if (type == INTEL_CORE_TYPE_ATOM) {
+                cpu.core_type = CPUAffinityType::E_CORES;
+            }
+        });
+        probe.join();
+    }
+}
+#else
+// Arm big.LITTLE: cpu_capacity from the device tree or ACPI; failing that the
+// maximum frequency, but only when MIDR part numbers show distinct core designs
+void read_arm_capacities(std::vector<SysfsCpu>& cpus) {
+    bool any_capacity = false;
+    for (auto& cpu : cpus) {
+        any_capacity |= read_size(CPU_SYSFS_ROOT + "cpu" + std::to_string(cpu.cpu) + "/cpu_capacity", cpu.capacity);
+    }
+    if (any_capacity) {
+        return;
+    }
+
+    std::set<unsigned long long> parts;
+    for (const auto& cpu : cpus) {
+        std::string midr;
+        if (SafeFileUtils::read_single_line(
+                CPU_SYSFS_ROOT + "cpu" + std::to_string(cpu.cpu) + "/regs/identification/midr_el1", midr)) {
+            try {
+                parts.insert((std::stoull(midr, nullptr, 16) >> 4) & 0xFFF);  // MIDR_EL1 PartNum, bits 15:4
+            } catch (const std::exception&) {
+                // Unreadable register: treat as unknown
+            }
+        }
+    }
+    if (parts.size() < 2) {
+        return;
+    }
+    for (auto& cpu : cpus) {
+        read_size(CPU_SYSFS_ROOT + "cpu" + std::to_string(cpu.cpu) + "/cpufreq/cpuinfo_max_freq", cpu.capacity);
+    }
+}
+#endif
+#endif  // __linux__
+
+CpuTopology fallback_topology(const NumaTopology& numa) {
+    std::vector<SysfsCpu> cpus;
+    size_t cpu_count = std::max(1u, std::thread::hardware_concurrency());
+    for (size_t cpu = 0; cpu < cpu_count; ++cpu) {
+        SysfsCpu entry;
+        entry.cpu = cpu;
+        entry.core_id = cpu;
+        cpus.push_back(entry);
+    }
+    CpuTopology topology = build_topology(cpus, numa);
+    topology.detected = false;
+    return topology;
+}
+
+// Assign dense ids to keys in ascending key order
+template <typename Key>
+void renumber(std::map<Key, size_t>& ids) {
+    size_t next = 0;
+    for (auto& entry : ids) {
+        entry.second = next++;
+    }
+}
+
+// Rank of each CPU's core among the distinct cores of its group (package or cluster)
+std::vector<size_t> core_rank_within(const CpuTopology& topology, size_t CpuLocation::*group) {
+    std::map<size_t, std::set<size_t>> cores_of_group;
+    for (const auto& location : topology.cpus) {
+        cores_of_group[location.*group].insert(location.core);
+    }
+    std::vector<size_t> ranks;
+    for (const auto& location : topology.cpus) {
+        const std::set<size_t>& cores = cores_of_group[location.*group];
+        ranks.push_back(static_cast<size_t>(std::distance(cores.begin(), cores.find(location.core))));
+    }
+    return ranks;
+}
+
+// CPUs of the topology ordered by a key of their index into topology.cpus
+template <typename KeyFunction>
+std::vector<size_t> ordered_by(const CpuTopology& topology, KeyFunction key) {
+    std::vector<size_t> indices(topology.cpus.size());
+    for (size_t i = 0; i < indices.size(); ++i) {
+        indices[i] = i;
+    }
+    std::stable_sort(indices.begin(), indices.end(), [&key](size_t a, size_t b) { return key(a) < key(b); });
+    std::vector<size_t> order;
+    for (size_t i : indices) {
+        order.push_back(topology.cpus[i].cpu);
+    }
+    return order;
+}
+
+}  // namespace
+
+CpuTopology build_topology(const std::vector<SysfsCpu>& cpus, const NumaTopology& numa) {
+    std::vector<SysfsCpu> sorted = cpus;
+    std::sort(sorted.begin(), sorted.end(), [](const SysfsCpu& a, const SysfsCpu& b) { return a.cpu < b.cpu; });
+
+    std::map<size_t, size_t> packages;
+    std::map<std::pair<size_t, size_t>, size_t> dies;
+    std::map<std::tuple<size_t, size_t, size_t>, size_t> cores;
+    std::map<std::pair<size_t, size_t>, size_t> clusters;  // (0, lowest CPU sharing the LLC) or (1, package id)
+    auto cluster_key = [](const SysfsCpu& cpu) {
+        if (cpu.llc_shared.empty()) {
+            return std::make_pair(size_t{1}, cpu.package_id);
+        }
+        return std::make_pair(size_t{0}, *std::min_element(cpu.llc_shared.begin(), cpu.llc_shared.end()));
+    };
+    for (const auto& cpu : sorted) {
+        packages[cpu.package_id] = 0;
+        dies[{cpu.package_id, cpu.die_id}] = 0;
+        cores[std::make_tuple(cpu.package_id, cpu.die_id, cpu.core_id)] = 0;
+        clusters[cluster_key(cpu)] = 0;
+    }
+    renumber(packages);
+    renumber(dies);
+    renumber(cores);
+    renumber(clusters);
+
+    std::map<size_t, size_t> node_of_cpu;
+    for (const auto& node : numa.nodes) {
+        for (size_t cpu : node.cpus) {
+            node_of_cpu[cpu] = node.id;
+        }
+    }
+
+    // Capacities only split core types when they differ
+    bool typed = std::any_of(sorted.begin(), sorted.end(),
+                             [](const SysfsCpu& cpu) { return cpu.core_type != CPUAffinityType::DEFAULT; });
+    size_t max_capacity = 0;
+    size_t min_capacity = 0;
+    for (const auto& cpu : sorted) {
+        if (cpu.capacity > 0) {
+            max_capacity = std::max(max_capacity, cpu.capacity);
+            min_capacity = min_capacity == 0 ? cpu.capacity : std::min(min_capacity, cpu.capacity);
+        }
+    }
+    auto core_type_of = [&](const SysfsCpu& cpu) {
+        if (typed || min_capacity == max_capacity || cpu.capacity == 0) {
+            return cpu.core_type;
+        }
+        return cpu.capacity == max_capacity ? CPUAffinityType::P_CORES : CPUAffinityType::E_CORES;
+    };
+
+    CpuTopology topology;
+    std::map<size_t, size_t> siblings_seen;
+    for (const auto& cpu : sorted) {
+        CpuLocation location;
+        location.cpu = cpu.cpu;
+        location.package = packages[cpu.package_id];
+        location.die = dies[{cpu.package_id, cpu.die_id}];
+        location.cluster = clusters[cluster_key(cpu)];
+        location.core = cores[std::make_tuple(cpu.package_id, cpu.die_id, cpu.core_id)];
+        location.smt = siblings_seen[location.core]++;
+        auto node = node_of_cpu.find(cpu.cpu);
+        location.node = node != node_of_cpu.end() ? node->second : 0;
+        location.core_type = core_type_of(cpu);
+        topology.cpus.push_back(location);
+    }
+    auto has_type = [&topology](CPUAffinityType type) {
+        return std::any_of(topology.cpus.begin(), topology.cpus.end(),
+                           [type](const CpuLocation& location) { return location.core_type == type; });
+    };
+    topology.hybrid = has_type(CPUAffinityType::P_CORES) && has_type(CPUAffinityType::E_CORES);
+    topology.packages = packages.size();
+    topology.dies = dies.size();
+    topology.clusters = clusters.size();
+    topology.physical_cores = cores.size();
+    topology.detected = !topology.cpus.empty();
+    return topology;
+}
+
+CpuTopology detect_topology(const NumaTopology& numa) {
+#ifdef __linux__
+    std::string online;
+    std::vector<size_t> online_cpus;
+    if (SafeFileUtils::read_single_line(CPU_SYSFS_ROOT + "online", online)) {
+        online_cpus = NumaUtils::parse_id_list(online);
+    }
+
+    std::vector<SysfsCpu> cpus;
+    for (size_t cpu : online_cpus) {
+        std::string base = CPU_SYSFS_ROOT + "cpu" + std::to_string(cpu) + "/topology/";
+        SysfsCpu entry;
+        entry.cpu = cpu;
+        if (!read_size(base + "physical_package_id", entry.package_id) || !read_size(base + "core_id", entry.core_id)) {
+            return fallback_topology(numa);
+        }
+        read_size(base + "die_id", entry.die_id);  // Absent before Linux 5.3 and on most Arm parts
+        entry.llc_shared = read_llc_shared(cpu);
+        cpus.push_back(entry);
+    }
+    if (cpus.empty()) {
+        return fallback_topology(numa);
+    }
+    if (!read_hybrid_pmu_types(cpus)) {
+#if defined(__x86_64__) || defined(__amd64__)
+        read_cpuid_core_types(cpus);
+#else
+        read_arm_capacities(cpus);
+#endif
+    }
+    return build_topology(cpus, numa);
+#else
+    return fallback_topology(numa);
+#endif
+}
+
+const CpuTopology& get_topology() {
+    static const CpuTopology topology = detect_topology(NumaUtils::get_topology());
+    return topology;
+}
+
+std::vector<size_t> cpus_of_type(const CpuTopology& topology, CPUAffinityType affinity_type) {
+    std::vector<size_t> cpus;
+    for (size_t cpu : placement_order(topology, Placement::COMPACT)) {
+        CPUAffinityType core_type = find_cpu(topology, cpu)->core_type;
+        if (core_type == CPUAffinityType::DEFAULT) {
+            core_type = CPUAffinityType::P_CORES;  // Uniform cores are all performance cores
+        }
+        if (affinity_type == CPUAffinityType::DEFAULT || core_type == affinity_type) {
+            cpus.push_back(cpu);
+        }
+    }
+    return cpus;
+}
+
+void read_cache_sizes(size_t cpu, CacheInfo& info) {
+#ifdef __linux__
+    for (size_t index = 0; index < MAX_CACHE_INDICES; ++index) {
+        std::string base = CPU_SYSFS_ROOT + "cpu" + std::to_string(cpu) + "/cache/index" + std::to_string(index) + "/";
+        size_t level = 0;
+        if (!read_size(base + "level", level)) {
+            break;
+        }
+        std::string type;
+        size_t bytes = 0;
+        if (!SafeFileUtils::read_single_line(base + "type", type) || !read_cache_bytes(base + "size", bytes)) {
+            continue;
+        }
+        if (level == 1 && type == "Data") {
+            info.l1_data_size = bytes;
+        } else if (level == 1 && type == "Instruction") {
+            info.l1_instruction_size = bytes;
+        } else if (level == 2 && type == "Unified") {
+            info.l2_size = bytes;
+        } else if (level == 3 && type == "Unified") {
+            info.l3_size = bytes;
+        }
+    }
+#else
+    (void)cpu;
+    (void)info;
+#endif
+}
+
+void read_cache_sharing(const CpuTopology& topology, CacheInfo& info) {
+#ifdef __linux__
+    std::set<std::vector<size_t>> l1d;
+    std::set<std::vector<size_t>> l2;
+    std::set<std::vector<size_t>> l3;
+    for (const auto& location : topology.cpus) {
+        for (size_t index = 0; index < MAX_CACHE_INDICES; ++index) {
+            std::string base =
+                CPU_SYSFS_ROOT + "cpu" + std::to_string(location.cpu) + "/cache/index" + std::to_string(index) + "/";
+            size_t level = 0;
+            if (!read_size(base + "level", level)) {
+                break;
+            }
+            std::string type;
+            std::string list;
+            if (!SafeFileUtils::read_single_line(base + "type", type) ||
+                !SafeFileUtils::read_single_line(base + "shared_cpu_list", list)) {
+                continue;
+            }
+            std::vector<size_t> shared = NumaUtils::parse_id_list(list);
+            if (shared.empty()) {
+                continue;
+            }
+            if (level == 1 && type == "Data") {
+                l1d.insert(shared);
+            } else if (level == 2 && type == "Unified") {
+                l2.insert(shared);
+            } else if (level == 3 && type == "Unified") {
+                l3.insert(shared);
+            }
+        }
+    }
+    if (!l1d.empty()) {
+        info.l1d_sharing.assign(l1d.begin(), l1d.end());
+    }
+    if (!l2.empty()) {
+        info.l2_sharing.assign(l2.begin(), l2.end());
+    }
+    if (!l3.empty()) {
+        info.l3_sharing.assign(l3.begin(), l3.end());
+    }
+#else
+    (void)topology;
+    (void)info;
+#endif
+}
+
+Placement parse_placement(const std::string& str) {
+    if (str == "compact") return Placement::COMPACT;
+    if (str == "scatter") return Placement::SCATTER;
+    if (str == "one-per-core") return Placement::ONE_PER_CORE;
+    if (str == "per-ccx") return Placement::PER_CCX;
+    if (str.compare(0, LIST_PREFIX.size(), LIST_PREFIX) == 0) {
+        parse_placement_list(str);
+        return Placement::LIST;
+    }
+    throw ArgumentError("Invalid placement '" + str + "'. Valid placements: compact, scatter, one-per-core, "
+                        "per-ccx, list:CPUS");
+}
+
+std::vector<size_t> parse_placement_list(const std::string& str) {
+    std::vector<size_t> cpus;
+    if (str.compare(0, LIST_PREFIX.size(), LIST_PREFIX) == 0) {
+        cpus = NumaUtils::parse_id_list(str.substr(LIST_PREFIX.size()));
+    }
+    if (cpus.empty()) {
+        throw ArgumentError("Invalid placement list '" + str + "'. Expected list: and a CPU list such as list:0-3,8");
+    }
+    return cpus;
+}
+
+std::string placement_to_string(Placement placement) {
+    switch (placement) {
+        case Placement::COMPACT:
+            return "compact";
+        case Placement::SCATTER:
+            return "scatter";
+        case Placement::ONE_PER_CORE:
+            return "one-per-core";
+        case Placement::PER_CCX:
+            return "per-ccx";
+        case Placement::LIST:
+            return "list";
+        default:
+            return "default";
+    }
+}
+
+std::vector<size_t> placement_order(const CpuTopology& topology, Placement placement,
+                                    const std::vector<size_t>& list) {
+    const std::vector<CpuLocation>& cpus = topology.cpus;
+    switch (placement) {
+        case Placement::COMPACT:
+            return ordered_by(topology, [&cpus](size_t i) {
+                return std::make_tuple(cpus[i].package, cpus[i].smt, cpus[i].core);
+            });
+        case Placement::SCATTER: {
+            std::vector<size_t> rank = core_rank_within(topology, &CpuLocation::package);
+            return ordered_by(topology, [&cpus, &rank](size_t i) {
+                return std::make_tuple(cpus[i].smt, rank[i], cpus[i].package);
+            });
+        }
+        case Placement::ONE_PER_CORE: {
+            std::vector<size_t> order;
+            for (size_t cpu : ordered_by(topology, [&cpus](size_t i) {
+                     return std::make_tuple(cpus[i].package, cpus[i].core);
+                 })) {
+                if (find_cpu(topology, cpu)->smt == 0) {
+                    order.push_back(cpu);
+                }
+            }
+            return order;
+        }
+        case Placement::PER_CCX: {
+            std::vector<size_t> rank = core_rank_within(topology, &CpuLocation::cluster);
+            return ordered_by(topology, [&cpus, &rank](size_t i) {
+                return std::make_tuple(cpus[i].smt, rank[i], cpus[i].cluster);
+            });
+        }
+        case Placement::LIST:
+            return list;
+        default:
+            return {};
+    }
+}
+
+const CpuLocation* find_cpu(const CpuTopology& topology, size_t cpu) {
+    for (const auto& location : topology.cpus) {
+        if (location.cpu == cpu) {
+            return &location;
+        }
+    }
+    return nullptr;
+}
+
+std::string describe(const CpuTopology& topology) {
+    std::stringstream ss;
+    ss << topology.packages << (topology.packages == 1 ? " package, " : " packages, ") << topology.dies
+       << (topology.dies == 1 ? " die, " : " dies, ") << topology.clusters
+       << (topology.clusters == 1 ? " LLC domain, " : " LLC domains, ") << topology.physical_cores
+       << (topology.physical_cores == 1 ? " core, " : " cores, ") << topology.cpus.size()
+       << (topology.cpus.size() == 1 ? " thread" : " threads");
+    if (!topology.detected) {
+        ss << " (not detected)";
+    }
+    return ss.str();
+}
+
+}  // namespace CpuTopologyUtils
@@ -0,0 +1,149 @@
+#ifndef CPU_TOPOLOGY_H
+#define CPU_TOPOLOGY_H
+
+#include <cstddef>
+#include <string>
+#include <vector>
+
+#include "memory_types.h"
+
+/**
+ * @brief CPU topology detection and topology-aware thread placement
+ *
+ * Logical CPU numbers interleave SMT siblings and sockets differently on
+ * every vendor and firmware, so "thread i on CPU i" can put two memory
+ * streams on one physical core or split a run across sockets. The topology
+ * is read from /sys/devices/system/cpu (package, die, core and the CPUs
+ * sharing the last-level cache), and placement policies turn it into the
+ * CPU order threads are pinned in. On heterogeneous parts every CPU is also
+ * classified as a performance or efficiency core: Intel hybrid through the
+ * cpu_core/cpu_atom perf PMUs (CPUID 0x1A on older kernels), Arm big.LITTLE
+ * through cpu_capacity (or the maximum frequency when MIDR part numbers differ).
+ */
+namespace CpuTopologyUtils {
+
+/**
+ * @brief How thread i of a run is placed
+ */
+enum class Placement {
+    DEFAULT,       ///< Platform default: thread i on logical CPU i
+    COMPACT,       ///< Fill one package before the next: its physical cores first, then their SMT siblings
+    SCATTER,       ///< Alternate between packages, physical cores before SMT siblings
+    ONE_PER_CORE,  ///< First hardware thread of each physical core only, package by package
+    PER_CCX,       ///< Alternate between last-level cache domains (CCX, cluster), cores before siblings
+    LIST           ///< An explicit CPU list, in the order given
+};
+
+/**
+ * @brief Sysfs fields of one online CPU
+ */
+struct SysfsCpu {
+    size_t cpu = 0;
+    size_t package_id = 0;            ///< topology/physical_package_id
+    size_t die_id = 0;                ///< topology/die_id (0 where absent)
+    size_t core_id = 0;               ///< topology/core_id, unique within a package
+    std::vector<size_t> llc_shared;   ///< shared_cpu_list of the last-level cache (empty: unknown)
+    CPUAffinityType core_type = CPUAffinityType::DEFAULT;  ///< Core type reported by the platform, if any
+    size_t capacity = 0;              ///< Relative core performance (cpu_capacity), 0 if unknown
+};
+
+/**
+ * @brief Build a topology from sysfs fields
+ *
+ * Package, die, core and cluster ids are renumbered densely; a CPU's SMT
+ * index is its rank among the CPUs of the same core. Without last-level
+ * cache information each package is one cluster. Without explicit core
+ * types, CPUs of the highest capacity are performance cores and all others
+ * efficiency cores, provided capacities differ.
+ *
+ * @param cpus Online CPUs
+ * @param numa NUMA topology the node of each CPU is looked up in
+ */
+CpuTopology build_topology(const std::vector<SysfsCpu>& cpus, const NumaTopology& numa);
+
+/**
+ * @brief Detect the CPU topology of the running system
+ *
+ * Falls back to every logical CPU as its own core on one package
+ * (detected false) when sysfs offers no topology (non-Linux hosts,
+ * restricted containers).
+ */
+CpuTopology detect_topology(const NumaTopology& numa);
+
+/**
+ * @brief Topology detected once per process
+ *
+ * Per-thread pinning to a core type reads this instead of re-parsing sysfs.
+ */
+const CpuTopology& get_topology();
+
+/**
+ * @brief CPUs of one core type, physical cores before their SMT siblings
+ *
+ * Without a performance/efficiency split every core counts as a
+ * performance core, so P_CORES yields every CPU and E_CORES none.
+ *
+ * @param affinity_type DEFAULT yields every CPU
+ */
+std::vector<size_t> cpus_of_type(const CpuTopology& topology, CPUAffinityType affinity_type);
+
+/**
+ * @brief Overwrite cache sizes with those sysfs reports for one CPU
+ *
+ * Levels sysfs does not describe keep their value in info, so platform
+ * defaults survive on hosts without cache information.
+ */
+void read_cache_sizes(size_t cpu, CacheInfo& info);
+
+/**
+ * @brief Fill the sharing lists of info with every distinct cache instance
+ *
+ * The shared_cpu_list of each online CPU's L1 data, L2 and L3 caches is
+ * read, so a Zen part reports one L3 instance per CCX and a cluster-based
+ * Arm part one L2 instance per cluster. Levels sysfs does not describe are
+ * left untouched.
+ */
+void read_cache_sharing(const CpuTopology& topology, CacheInfo& info);
+
+/**
+ * @brief Parse --placement: compact, scatter, one-per-core, per-ccx or list:CPUS
+ * @throws ArgumentError for any other value or a malformed list
+ */
+Placement parse_placement(const std::string& str);
+
+/**
+ * @brief CPUs of a "list:0,2,4-7" placement, in the order given
+ * @throws ArgumentError if str is not a well-formed list placement
+ */
+std::vector<size_t> parse_placement_list(const std::string& str);
+
+/**
+ * @brief Placement as reported in results ("default", "compact", "one-per-core", ...)
+ */
+std::string placement_to_string(Placement placement);
+
+/**
+ * @brief CPUs in the order threads are placed on them
+ *
+ * Thread i of a run goes to the i-th entry (wrapping past the end).
+ *
+ * @param list CPUs of a LIST placement (ignored otherwise)
+ * @return Empty for DEFAULT or a topology without CPUs
+ */
+std::vector<size_t> placement_order(const CpuTopology& topology, Placement placement,
+                                    const std::vector<size_t>& list = {});
+
+/**
+ * @brief Find a CPU by logical number
+ * @return Pointer into topology.cpus, or nullptr if not online
+ */
+const CpuLocation* find_cpu(const CpuTopology& topology, size_t cpu);
+
+/**
+ * @brief One-line summary: "2 packages, 4 dies, 16 LLC domains, 64 cores, 128 threads"
+ */
+std::string describe(const CpuTopology& topology);
+
+}  // namespace CpuTopologyUtils
+
+#endif  // CPU_TOPOLOGY_H
@@ -0,0 +1,156 @@
+#include "cycle_timer.h"
+#include "constants.h"
+#include "safe_file_utils.h"
+
+#include <algorithm>
+#include <cstdio>
+#include <mutex>
+
+#if defined(__x86_64__) || defined(__i386__)
+#include <cpuid.h>
+#endif
+
+namespace CycleTimer {
+
+namespace detail {
+
+std::atomic<double> ns_per_tick{0.0};
+uint64_t base_ticks = 0;
+
+}  // namespace detail
+
+namespace {
+
+using Steady = std::chrono::steady_clock;
+
+Calibration calibration;
+std::once_flag calibrated;
+
+#if defined(__x86_64__) || defined(__i386__)
+// CPUID 0x80000007 EDX bit 8; hypervisors often hide it, while Linux only keeps the TSC as clocksource if it is stable
+bool tsc_is_stable() {
+    unsigned int eax = 0, ebx = 0, ecx = 0, edx = 0;
+    if (__get_cpuid(0x80000007, &eax, &ebx, &ecx, &edx) && (edx & (1u << 8)) != 0) {
+        return true;
+    }
+    std::string clocksource;
+    return SafeFileUtils::read_single_line("/sys/devices/system/clocksource/clocksource0/current_clocksource",
+                                           clocksource) &&
+           clocksource == "tsc";
+}
+
+// Ticks per second over CYCLE_CALIBRATION_MS, each end bracketed by steady_clock reads
+double measure_tsc_frequency() {
+    auto bracket = [](Steady::time_point& when) {
+        Steady::time_point before = Steady::now();
+        uint64_t ticks = start_ticks();
+        Steady::time_point after = Steady::now();
+        when = before + (after - before) / 2;
+        return ticks;
+    };
+    Steady::time_point begin_time, end_time;
+    uint64_t begin_ticks = bracket(begin_time);
+    Steady::time_point deadline = begin_time + std::chrono::milliseconds(BenchmarkConstants::CYCLE_CALIBRATION_MS);
+    while (Steady::now() < deadline) {
+    }
+    uint64_t end_ticks = bracket(end_time);
+    double seconds = std::chrono::duration<double>(end_time - begin_time).count();
+    return seconds > 0.0 ? static_cast<double>(end_ticks - begin_ticks) / seconds : 0.0;
+}
+#endif
+
+void measure_overheads() {
+    double least = -1.0;
+    double least_ticks = -1.0;
+    for (size_t i = 0; i < BenchmarkConstants::CYCLE_OVERHEAD_SAMPLES; ++i) {
+        Clock::time_point first = Clock::now();
+        Clock::time_point second = Clock::now();
+        double ns = static_cast<double>((second - first).count());
+        least = (least < 0.0) ? ns : std::min(least, ns);
+
+        uint64_t start = start_ticks();
+        uint64_t stop = stop_ticks();
+        double tick_ns = static_cast<double>(stop - start) * 1e9 / calibration.ticks_per_second;
+        least_ticks = (least_ticks < 0.0) ? tick_ns : std::min(least_ticks, tick_ns);
+    }
+    calibration.overhead_ns = std::max(least, 0.0);
+    calibration.tick_overhead_ns = std::max(least_ticks, 0.0);
+}
+
+void run_calibration() {
+    double frequency = 0.0;
+#if defined(__x86_64__) || defined(__i386__)
+    frequency = measure_tsc_frequency();
+    calibration.source = tsc_is_stable() ? Source::TSC : Source::STEADY_CLOCK;
+#elif defined(__APPLE__)
+    mach_timebase_info_data_t timebase = {};
+    mach_timebase_info(&timebase);
+    frequency = (timebase.numer > 0) ? 1e9 * timebase.denom / timebase.numer : 0.0;
+    calibration.source = Source::MACH;
+#elif defined(__aarch64__)
+    uint64_t cntfrq = 0;
+    asm volatile("mrs %0, cntfrq_el0" : "=r"(cntfrq));
+    frequency = static_cast<double>(cntfrq);
+    calibration.source = Source::CNTVCT;
+#else
+    calibration.source = Source::STEADY_CLOCK;  // read_counter() returns steady_clock ticks
+#endif
+    if (frequency <= 0.0) {
+        frequency = static_cast<double>(Steady::period::den) / Steady::period::num;
+        calibration.source = Source::STEADY_CLOCK;
+    }
+    calibration.ticks_per_second = frequency;
+    calibration.resolution_ns = 1e9 / frequency;
+
+    detail::base_ticks = detail::read_counter();
+    detail::ns_per_tick.store(calibration.source == Source::STEADY_CLOCK ? -1.0 : 1e9 / frequency,
+                              std::memory_order_release);
+    measure_overheads();
+}
+
+}  // namespace
+
+void detail::calibrate_once() {
+    std::call_once(calibrated, run_calibration);
+}
+
+const Calibration& calibrate() {
+    detail::calibrate_once();
+    return calibration;
+}
+
+std::string source_to_string(Source source) {
+    switch (source) {
+        case Source::TSC: return "tsc";
+        case Source::CNTVCT: return "cntvct_el0";
+        case Source::MACH: return "mach_absolute_time";
+        case Source::STEADY_CLOCK: return "steady_clock";
+    }
+    return "steady_clock";
+}
+
+std::string describe() {
+    const Calibration& timer = calibrate();
+    char text[128];
+    if (timer.source == Source::STEADY_CLOCK) {
+        std::snprintf(text, sizeof(text), "steady_clock (no stable cycle counter), %.1f ns per read pair",
+                      timer.overhead_ns);
+    } else {
+        std::snprintf(text, sizeof(text), "%s at %.3f GHz, %.1f ns per read pair",
+                      source_to_string(timer.source).c_str(), timer.ticks_per_second / 1e9, timer.overhead_ns);
+    }
+    return text;
+}
+
+double elapsed_seconds(Clock::time_point start, Clock::time_point end) {
+    double ns = static_cast<double>((end - start).count()) - calibrate().overhead_ns;
+    return std::max(ns, 0.0) * 1e-9;
+}
+
+double ticks_to_ns(uint64_t start, uint64_t stop) {
+    const Calibration& timer = calibrate();
+    double ns = static_cast<double>(static_cast<int64_t>(stop - start)) * 1e9 / timer.ticks_per_second;
+    return std::max(ns - timer.tick_overhead_ns, 0.0);
+}
+
+}  // namespace CycleTimer
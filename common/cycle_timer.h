@@ -0,0 +1,158 @@
+#ifndef CYCLE_TIMER_H
+#define CYCLE_TIMER_H
+
+#include <atomic>
+#include <chrono>
+#include <cstdint>
+#include <string>
+
+#if defined(__x86_64__) || defined(__i386__)
+#include <x86intrin.h>
+#elif defined(__APPLE__)
+#include <mach/mach_time.h>
+#endif
+
+/**
+ * @brief Low-overhead timing from the CPU's own counter
+ *
+ * steady_clock goes through the vDSO and costs 20-50 ns per read, which is
+ * the size of an L1 pass or a handful of chase hops. The timer reads the
+ * counter directly: the TSC on x86 (fenced on both sides so the read
+ * neither starts before earlier work retires nor lets later work start
+ * early), CNTVCT_EL0 behind an ISB on AArch64, and mach_absolute_time on
+ * macOS. The TSC frequency is calibrated once against steady_clock; the
+ * other counters report theirs. Clock is a std::chrono clock over those
+ * reads, and elapsed_seconds() subtracts the cost of a pair of reads.
+ */
+namespace CycleTimer {
+
+/**
+ * @brief Counter behind Clock
+ */
+enum class Source {
+    TSC,           ///< x86 time-stamp counter (invariant, or the kernel's clocksource)
+    CNTVCT,        ///< AArch64 generic timer virtual count
+    MACH,          ///< macOS mach_absolute_time
+    STEADY_CLOCK   ///< Fallback: a TSC that may stop or change rate, or no counter at all
+};
+
+/**
+ * @brief Source as shown in run notes ("tsc", "cntvct_el0", "mach_absolute_time", "steady_clock")
+ */
+std::string source_to_string(Source source);
+
+/**
+ * @brief What calibrate() found
+ */
+struct Calibration {
+    Source source = Source::STEADY_CLOCK;
+    double ticks_per_second = 0.0;  ///< Counter frequency: measured for the TSC, reported by the others
+    double overhead_ns = 0.0;       ///< Least cost of two back-to-back Clock reads, subtracted by elapsed_seconds
+    double tick_overhead_ns = 0.0;  ///< The same for start_ticks()/stop_ticks(), subtracted by ticks_to_ns
+    double resolution_ns = 0.0;     ///< One tick
+};
+
+/**
+ * @brief Pick the counter, calibrate its frequency and measure the read overhead
+ *
+ * Runs once, on the first call or the first Clock::now(); later calls
+ * return the same result. Calibrating the TSC takes CYCLE_CALIBRATION_MS,
+ * so main calls this at startup rather than inside the first measurement.
+ */
+const Calibration& calibrate();
+
+/**
+ * @brief Calibration as a run note ("tsc at 2.100 GHz, 12.3 ns per read pair")
+ */
+std::string describe();
+
+namespace detail {
+
+extern std::atomic<double> ns_per_tick;  // 0: not calibrated yet, negative: STEADY_CLOCK
+extern uint64_t base_ticks;              // Counter at calibration, so tick deltas stay exact in a double
+
+void calibrate_once();
+
+inline uint64_t read_counter() {
+#if defined(__x86_64__) || defined(__i386__)
+    _mm_lfence();
+    uint64_t ticks = __rdtsc();
+    _mm_lfence();
+    return ticks;
+#elif defined(__APPLE__)
+    return mach_absolute_time();
+#elif defined(__aarch64__)
+    uint64_t ticks;
+    asm volatile("isb\n\tmrs %0, cntvct_el0" : "=r"(ticks) : : "memory");
+    return ticks;
+#else
+    return static_cast<uint64_t>(std::chrono::steady_clock::now().time_since_epoch().count());
+#endif
+}
+
+}  // namespace detail
+
+/**
+ * @brief Raw counter at the start of an interval (LFENCE; RDTSC on x86)
+ */
+inline uint64_t start_ticks() {
+#if defined(__x86_64__) || defined(__i386__)
+    _mm_lfence();
+    return __rdtsc();
+#else
+    return detail::read_counter();
+#endif
+}
+
+/**
+ * @brief Raw counter at the end of an interval (RDTSCP; LFENCE on x86)
+ */
+inline uint64_t stop_ticks() {
+#if defined(__x86_64__) || defined(__i386__)
+    unsigned int aux;
+    uint64_t ticks = __rdtscp(&aux);
+    _mm_lfence();
+    return ticks;
+#else
+    return detail::read_counter();
+#endif
+}
+
+/**
+ * @brief std::chrono clock over the counter, in nanoseconds since calibration
+ */
+struct Clock {
+    using rep = int64_t;
+    using period = std::nano;
+    using duration = std::chrono::nanoseconds;
+    using time_point = std::chrono::time_point<Clock>;
+    static constexpr bool is_steady = true;
+
+    static time_point now() noexcept {
+        double scale = detail::ns_per_tick.load(std::memory_order_acquire);
+        if (scale == 0.0) {
+            detail::calibrate_once();
+            scale = detail::ns_per_tick.load(std::memory_order_acquire);
+        }
+        if (scale < 0.0) {
+            return time_point(std::chrono::duration_cast<duration>(
+                std::chrono::steady_clock::now().time_since_epoch()));
+        }
+        double ticks = static_cast<double>(static_cast<int64_t>(detail::read_counter() - detail::base_ticks));
+        return time_point(duration(static_cast<rep>(ticks * scale)));
+    }
+};
+
+/**
+ * @brief Seconds between two Clock readings, less the read overhead (never negative)
+ */
+double elapsed_seconds(Clock::time_point start, Clock::time_point end);
+
+/**
+ * @brief Nanoseconds between start_ticks() and stop_ticks(), less the read overhead (never negative)
+ */
+double ticks_to_ns(uint64_t start, uint64_t stop);
+
+}  // namespace CycleTimer
+
+#endif  // CYCLE_TIMER_H
@@ -0,0 +1,62 @@
+#include "encoded_scans.h"
+#include "errors.h"
+
+#include <exception>
+#include <random>
+
+namespace EncodedScans {
+
+unsigned parse_bits(const std::string& str, Encoding encoding) {
+    const unsigned max_bits = (encoding == Encoding::DICTIONARY) ? MAX_DICT_BITS : MAX_BITS;
+    unsigned long bits = 0;
+    bool valid = !str.empty() && str[0] != '-' && str[0] != '+';
+    if (valid) {
+        try {
+            size_t parsed = 0;
+            bits = std::stoul(str, &parsed);
+            valid = parsed == str.size();
+        } catch (const std::exception&) {
+            valid = false;
+        }
+    }
+    if (!valid || bits < 1 || bits > max_bits) {
+        throw ArgumentError("Invalid value width '" + str + "' for " + encoding_to_string(encoding) +
+                            ". Valid widths: 1-" + std::to_string(max_bits) + " bits");
+    }
+    return static_cast<unsigned>(bits);
+}
+
+std::string encoding_to_string(Encoding encoding) {
+    switch (encoding) {
+        case Encoding::BITPACK:
+            return "bitpack";
+        case Encoding::DELTA:
+            return "delta";
+        case Encoding::DICTIONARY:
+            return "dict";
+    }
+    return "bitpack";
+}
+
+size_t output_bytes(Encoding encoding) {
+    return (encoding == Encoding::DICTIONARY) ? sizeof(uint64_t) : sizeof(uint32_t);
+}
+
+size_t group_bytes(unsigned bits) {
+    return GROUP_VALUES * bits / 8;
+}
+
+double expansion(Encoding encoding, unsigned bits) {
+    return (bits > 0) ? static_cast<double>(output_bytes(encoding) * 8) / bits : 0.0;
+}
+
+std::vector<uint64_t> build_dictionary(unsigned bits, uint64_t seed) {
+    std::mt19937_64 gen(seed);
+    std::vector<uint64_t> dictionary(size_t{1} << bits);
+    for (auto& value : dictionary) {
+        value = gen();
+    }
+    return dictionary;
+}
+
+}  // namespace EncodedScans
@@ -0,0 +1,73 @@
+#ifndef ENCODED_SCANS_H
+#define ENCODED_SCANS_H
+
+#include <cstddef>
+#include <cstdint>
+#include <string>
+#include <vector>
+
+/**
+ * @brief Bit-packed, delta and dictionary column layouts
+ *
+ * Analytical engines scan columns stored as fixed-width bit-packed values,
+ * often as deltas of sorted keys or as codes into a dictionary, so a scan
+ * moves fewer bytes than it hands to the operator above it. Values are
+ * packed LSB first without gaps, as Parquet and ORC do, so any buffer
+ * contents are a valid column and the benchmark buffers need no encoding
+ * pass. Results report the compressed bytes read next to the values and
+ * decoded bytes produced.
+ */
+namespace EncodedScans {
+
+/**
+ * @brief How the packed values of a column are turned into output values
+ */
+enum class Encoding {
+    BITPACK,    ///< Values themselves, zero-extended to 32 bits
+    DELTA,      ///< Differences: each value is the running sum modulo 2^32
+    DICTIONARY  ///< Codes into a table of 64-bit values
+};
+
+/// Values per group: 8 * bits bytes, whole bytes for every width, so thread slices split on groups
+constexpr size_t GROUP_VALUES = 64;
+/// Widest packed value
+constexpr unsigned MAX_BITS = 32;
+/// Widest dictionary code: 65536 entries of 8 bytes, a table that fits in L2
+constexpr unsigned MAX_DICT_BITS = 16;
+/// Width used when --bits is not given
+constexpr unsigned DEFAULT_BITS = 8;
+
+/**
+ * @brief Parse a value width for an encoding: 1-32 bits, 1-16 for dictionary codes
+ * @throws ArgumentError if the width is malformed or out of range
+ */
+unsigned parse_bits(const std::string& str, Encoding encoding);
+
+/**
+ * @brief Short name used in results ("bitpack", "delta", "dict")
+ */
+std::string encoding_to_string(Encoding encoding);
+
+/**
+ * @brief Bytes of one decoded value: 4, or 8 for dictionary values
+ */
+size_t output_bytes(Encoding encoding);
+
+/**
+ * @brief Packed bytes of one group of GROUP_VALUES values
+ */
+size_t group_bytes(unsigned bits);
+
+/**
+ * @brief Decoded bytes per packed byte (output_bytes * 8 / bits)
+ */
+double expansion(Encoding encoding, unsigned bits);
+
+/**
+ * @brief Dictionary of 2^bits pseudo-random 64-bit values
+ */
+std::vector<uint64_t> build_dictionary(unsigned bits, uint64_t seed);
+
+}  // namespace EncodedScans
+
+#endif  // ENCODED_SCANS_H
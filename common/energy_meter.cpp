@@ -0,0 +1,299 @@
+#include "energy_meter.h"
+#include "numa_utils.h"
+#include "safe_file_utils.h"
+
+#include <algorithm>
+#include <cstdlib>
+#include <sstream>
+#include <utility>
+
+#ifdef __linux__
+#include <dirent.h>
+#include <fcntl.h>
+#include <unistd.h>
+#endif
+
+namespace EnergyMeter {
+
+namespace {
+
+#ifdef __linux__
+const std::string CPU_SYSFS_ROOT = "/sys/devices/system/cpu/";
+const std::string ZONE_PREFIX = "intel-rapl:";
+
+std::string join_names(const std::string& source, const std::vector<Counter>& counters) {
+    std::stringstream ss;
+    ss << source << ":";
+    for (size_t i = 0; i < counters.size(); ++i) {
+        ss << (i == 0 ? " " : ", ") << counters[i].name;
+    }
+    return ss.str();
+}
+
+// Zones resolve to /sys/devices/virtual/powercap, outside the SafeFileUtils roots
+bool read_zone_line(const std::string& path, std::string& line) {
+    int fd = open(path.c_str(), O_RDONLY);
+    if (fd < 0) {
+        return false;
+    }
+    char buffer[128] = {};
+    ssize_t length = read(fd, buffer, sizeof(buffer) - 1);
+    close(fd);
+    if (length <= 0) {
+        return false;
+    }
+    line.assign(buffer, static_cast<size_t>(length));
+    while (!line.empty() && (line.back() == '\n' || line.back() == ' ')) {
+        line.pop_back();
+    }
+    return !line.empty();
+}
+
+// Decimal counter of an open sysfs attribute, read from the start
+bool read_counter(int fd, uint64_t& value) {
+    char buffer[32] = {};
+    ssize_t length = pread(fd, buffer, sizeof(buffer) - 1, 0);
+    if (length <= 0) {
+        return false;
+    }
+    char* end = nullptr;
+    value = std::strtoull(buffer, &end, 10);
+    return end != buffer;
+}
+
+/**
+ * @brief energy_uj of every package and DRAM zone, kept open between snapshots
+ */
+class PowercapMeter : public Meter {
+public:
+    PowercapMeter(std::vector<Counter> counters, std::vector<int> fds)
+        : counters_(std::move(counters)), fds_(std::move(fds)) {}
+
+    ~PowercapMeter() override {
+        for (int fd : fds_) {
+            close(fd);
+        }
+    }
+
+    const std::vector<Counter>& counters() const override { return counters_; }
+
+    Snapshot snapshot() override {
+        Snapshot snapshot;
+        snapshot.values.resize(fds_.size());
+        snapshot.valid = true;
+        for (size_t i = 0; i < fds_.size(); ++i) {
+            snapshot.valid = read_counter(fds_[i], snapshot.values[i]) && snapshot.valid;
+        }
+        return snapshot;
+    }
+
+    std::string describe() const override { return join_names("powercap", counters_); }
+
+private:
+    std::vector<Counter> counters_;
+    std::vector<int> fds_;
+};
+
+/**
+ * @brief Package energy status register of one CPU per package
+ */
+class MsrMeter : public Meter {
+public:
+    MsrMeter(uint32_t msr, std::vector<Counter> counters, std::vector<int> fds)
+        : msr_(msr), counters_(std::move(counters)), fds_(std::move(fds)) {}
+
+    ~MsrMeter() override {
+        for (int fd : fds_) {
+            close(fd);
+        }
+    }
+
+    const std::vector<Counter>& counters() const override { return counters_; }
+
+    Snapshot snapshot() override {
+        Snapshot snapshot;
+        snapshot.values.resize(fds_.size());
+        snapshot.valid = true;
+        for (size_t i = 0; i < fds_.size(); ++i) {
+            uint64_t value = 0;
+            if (pread(fds_[i], &value, sizeof(value), msr_) != sizeof(value)) {
+                snapshot.valid = false;
+            }
+            snapshot.values[i] = value & 0xFFFFFFFFull;
+        }
+        return snapshot;
+    }
+
+    std::string describe() const override {
+        std::stringstream ss;
+        ss << "RAPL MSR 0x" << std::hex << msr_;
+        return join_names(ss.str(), counters_);
+    }
+
+private:
+    uint32_t msr_;
+    std::vector<Counter> counters_;
+    std::vector<int> fds_;
+};
+
+std::vector<std::string> list_zones(const std::string& root) {
+    std::vector<std::string> names;
+    DIR* dir = opendir(root.c_str());
+    if (dir == nullptr) {
+        return names;
+    }
+    while (dirent* entry = readdir(dir)) {
+        std::string name = entry->d_name;
+        if (name.compare(0, ZONE_PREFIX.size(), ZONE_PREFIX) == 0) {
+            names.push_back(name);
+        }
+    }
+    closedir(dir);
+    std::sort(names.begin(), names.end());
+    return names;
+}
+#endif  // __linux__
+
+}  // namespace
+
+std::string domain_to_string(Domain domain) {
+    return domain == Domain::DRAM ? "dram" : "package";
+}
+
+uint64_t counter_delta(uint64_t before, uint64_t after, uint64_t range) {
+    if (after >= before) {
+        return after - before;
+    }
+    if (range == 0 || before >= range) {
+        return 0;
+    }
+    return (range - before) + after;
+}
+
+Energy energy_between(const std::vector<Counter>& counters, const Snapshot& begin, const Snapshot& end) {
+    Energy energy;
+    if (!begin.valid || !end.valid || begin.values.size() != counters.size() ||
+        end.values.size() != counters.size()) {
+        return energy;
+    }
+    for (size_t i = 0; i < counters.size(); ++i) {
+        double joules = static_cast<double>(counter_delta(begin.values[i], end.values[i], counters[i].range)) *
+                        counters[i].joules_per_unit;
+        if (counters[i].domain == Domain::DRAM) {
+            energy.dram = true;
+            energy.dram_joules += joules;
+        } else {
+            energy.package = true;
+            energy.package_joules += joules;
+        }
+    }
+    return energy;
+}
+
+std::unique_ptr<Meter> create_powercap_meter(const std::string& root) {
+#ifdef __linux__
+    std::string base = root;
+    if (!base.empty() && base.back() != '/') {
+        base += '/';
+    }
+    std::vector<Counter> counters;
+    std::vector<int> fds;
+    for (const auto& zone : list_zones(base)) {
+        std::string name;
+        if (!read_zone_line(base + zone + "/name", name)) {
+            continue;
+        }
+        Counter counter;
+        if (name.compare(0, 7, "package") == 0) {
+            counter.domain = Domain::PACKAGE;
+            counter.name = name;
+        } else if (name == "dram") {
+            // Subzones are named after their package zone: intel-rapl:0:1 under intel-rapl:0
+            std::string parent_name;
+            size_t colon = zone.rfind(':');
+            if (colon < ZONE_PREFIX.size() ||
+                !read_zone_line(base + zone.substr(0, colon) + "/name", parent_name)) {
+                parent_name = zone;
+            }
+            counter.domain = Domain::DRAM;
+            counter.name = parent_name + "/dram";
+        } else {
+            continue;  // core, uncore and psys overlap the package or the platform
+        }
+        counter.joules_per_unit = 1e-6;
+        std::string range;
+        if (read_zone_line(base + zone + "/max_energy_range_uj", range)) {
+            counter.range = std::strtoull(range.c_str(), nullptr, 10);
+        }
+
+        int fd = open((base + zone + "/energy_uj").c_str(), O_RDONLY);
+        uint64_t value = 0;
+        if (fd < 0 || !read_counter(fd, value)) {
+            if (fd >= 0) close(fd);
+            continue;
+        }
+        counters.push_back(counter);
+        fds.push_back(fd);
+    }
+    if (counters.empty()) {
+        return nullptr;
+    }
+    return std::make_unique<PowercapMeter>(std::move(counters), std::move(fds));
+#else
+    (void)root;
+    return nullptr;
+#endif
+}
+
+std::unique_ptr<Meter> create_rapl_msr_meter(uint32_t unit_msr, uint32_t package_msr) {
+#ifdef __linux__
+    std::string online;
+    if (!SafeFileUtils::read_single_line(CPU_SYSFS_ROOT + "online", online)) {
+        return nullptr;
+    }
+    std::vector<size_t> packages;
+    std::vector<Counter> counters;
+    std::vector<int> fds;
+    for (size_t cpu : NumaUtils::parse_id_list(online)) {
+        std::string package_id;
+        size_t package = 0;
+        if (SafeFileUtils::read_single_line(
+                CPU_SYSFS_ROOT + "cpu" + std::to_string(cpu) + "/topology/physical_package_id", package_id)) {
+            package = std::strtoul(package_id.c_str(), nullptr, 10);
+        }
+        if (std::find(packages.begin(), packages.end(), package) != packages.end()) {
+            continue;
+        }
+
+        int fd = open(("/dev/cpu/" + std::to_string(cpu) + "/msr").c_str(), O_RDONLY);
+        uint64_t units = 0;
+        uint64_t value = 0;
+        if (fd < 0 || pread(fd, &units, sizeof(units), unit_msr) != sizeof(units) ||
+            pread(fd, &value, sizeof(value), package_msr) != sizeof(value)) {
+            if (fd >= 0) close(fd);
+            for (int opened : fds) {
+                close(opened);
+            }
+            return nullptr;
+        }
+        packages.push_back(package);
+        Counter counter;
+        counter.domain = Domain::PACKAGE;
+        counter.name = "package-" + std::to_string(package);
+        counter.joules_per_unit = 1.0 / static_cast<double>(1ull << ((units >> 8) & 0x1F));
+        counter.range = 1ull << 32;
+        counters.push_back(counter);
+        fds.push_back(fd);
+    }
+    if (counters.empty()) {
+        return nullptr;
+    }
+    return std::make_unique<MsrMeter>(package_msr, std::move(counters), std::move(fds));
+#else
+    (void)unit_msr;
+    (void)package_msr;
+    return nullptr;
+#endif
+}
+
+}  // namespace EnergyMeter
@@ -0,0 +1,131 @@
+#ifndef ENERGY_METER_H
+#define ENERGY_METER_H
+
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <string>
+#include <vector>
+
+/**
+ * @brief Package and DRAM energy counters around measured regions
+ *
+ * Bandwidth alone does not say what a transfer costs under a power cap.
+ * RAPL (Intel, and AMD since Zen) keeps cumulative energy counters per
+ * package and, on most servers, per DRAM domain; Apple Silicon reports the
+ * same through IOReport. A meter reads every counter it found at the start
+ * and the end of a region, and the difference, corrected for a counter
+ * wrapping once, gives the joules spent. The counters cover the whole
+ * package, so idle power and any other load on the machine are included.
+ */
+namespace EnergyMeter {
+
+/**
+ * @brief What a counter measures
+ */
+enum class Domain {
+    PACKAGE,  ///< Cores, caches and uncore of a package (the CPU complex on Apple Silicon)
+    DRAM      ///< Memory attached to a package
+};
+
+/**
+ * @brief Domain as reported in results ("package", "dram")
+ */
+std::string domain_to_string(Domain domain);
+
+/**
+ * @brief One cumulative energy counter
+ */
+struct Counter {
+    Domain domain = Domain::PACKAGE;
+    std::string name;              ///< Zone or channel ("package-0", "package-0/dram", "CPU Energy")
+    double joules_per_unit = 0.0;  ///< Energy of one count
+    uint64_t range = 0;            ///< Counts after which the counter wraps to 0 (0: never wraps)
+};
+
+/**
+ * @brief Raw values of every counter of a meter, in Meter::counters() order
+ */
+struct Snapshot {
+    std::vector<uint64_t> values;
+    bool valid = false;  ///< Every counter was read
+};
+
+/**
+ * @brief Joules spent between two snapshots, summed per domain
+ */
+struct Energy {
+    bool package = false;  ///< A package counter contributed
+    bool dram = false;     ///< A DRAM counter contributed
+    double package_joules = 0.0;
+    double dram_joules = 0.0;
+};
+
+/**
+ * @brief Counts from before to after, assuming at most one wrap at range
+ *
+ * A counter that went backwards without a range (or past it) yields 0.
+ */
+uint64_t counter_delta(uint64_t before, uint64_t after, uint64_t range);
+
+/**
+ * @brief Energy of counters between two snapshots (empty unless both are valid and match counters)
+ */
+Energy energy_between(const std::vector<Counter>& counters, const Snapshot& begin, const Snapshot& end);
+
+/**
+ * @brief A set of energy counters read together
+ */
+class Meter {
+public:
+    virtual ~Meter() = default;
+
+    /**
+     * @brief Counters read by snapshot()
+     */
+    virtual const std::vector<Counter>& counters() const = 0;
+
+    /**
+     * @brief Read every counter now
+     */
+    virtual Snapshot snapshot() = 0;
+
+    /**
+     * @brief Source and counters, for run notes ("powercap: package-0, package-0/dram")
+     */
+    virtual std::string describe() const = 0;
+
+    Energy between(const Snapshot& begin, const Snapshot& end) const {
+        return energy_between(counters(), begin, end);
+    }
+};
+
+/**
+ * @brief RAPL zones of the Linux powercap driver
+ *
+ * Reads the package zones (intel-rapl:N, also used by AMD) and their DRAM
+ * subzones; core, uncore and psys zones overlap the package or the whole
+ * platform and are skipped. energy_uj is root-only since Linux 5.10.
+ *
+ * @param root Directory of the zones
+ * @return Meter, or nullptr if no zone is present and readable
+ */
+std::unique_ptr<Meter> create_powercap_meter(const std::string& root = "/sys/class/powercap/");
+
+/**
+ * @brief Package energy from the RAPL MSRs of one CPU per package
+ *
+ * Uses /dev/cpu/N/msr (Linux, msr driver loaded, root or CAP_SYS_RAWIO).
+ * The counters are 32 bits wide; bits 12:8 of the unit register give the
+ * energy unit. DRAM is left to powercap, which knows the models whose DRAM
+ * domain uses a fixed unit instead.
+ *
+ * @param unit_msr Power unit register (Intel 0x606, AMD 0xC0010299)
+ * @param package_msr Package energy status register (Intel 0x611, AMD 0xC001029B)
+ * @return Meter, or nullptr outside Linux or if the registers cannot be read
+ */
+std::unique_ptr<Meter> create_rapl_msr_meter(uint32_t unit_msr, uint32_t package_msr);
+
+}  // namespace EnergyMeter
+
+#endif  // ENERGY_METER_H
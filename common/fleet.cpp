@@ -0,0 +1,807 @@
+#include "fleet.h"
+#include "constants.h"
+#include "errors.h"
+#include "json.h"
+#include "sample_stats.h"
+
+#include <algorithm>
+#include <cerrno>
+#include <chrono>
+#include <cmath>
+#include <csignal>
+#include <cstdlib>
+#include <cstring>
+#include <fstream>
+#include <iostream>
+#include <map>
+#include <thread>
+
+#include <fcntl.h>
+#include <netdb.h>
+#include <netinet/in.h>
+#include <poll.h>
+#include <sys/socket.h>
+#include <sys/types.h>
+#include <sys/wait.h>
+#include <unistd.h>
+
+namespace Fleet {
+
+namespace {
+
+using Json::Object;
+
+// Options that belong to the coordinator's own output, with the value that follows them
+const char* const COORDINATOR_OPTIONS[] = {"--coordinate", "--agent", "--format", "--ndjson", "--save-baseline",
+                                           "--compare"};
+
+// Options an agent runs nothing for: fleet roles, and paths on the agent's file system
+const char* const REFUSED_OPTIONS[] = {"--agent", "--coordinate", "--ndjson", "--save-baseline", "--compare",
+                                       "--calibrate", "--tune", "--peak-file", "--system-cache", "--file", "--io",
+                                       "--trace", "--trace-convert", "--help", "-h", "--info"};
+
+// 1.4826 * MAD estimates the standard deviation of normally distributed values
+constexpr double MAD_TO_SIGMA = 1.4826;
+// Floor of the scaled MAD relative to the median, so identical hosts do not divide by zero
+constexpr double MIN_SPREAD_FRACTION = 0.001;
+
+std::string option_name(const std::string& arg) {
+    size_t equals = arg.find('=');
+    return arg.rfind("--", 0) == 0 && equals != std::string::npos ? arg.substr(0, equals) : arg;
+}
+
+std::string local_hostname() {
+    char name[256] = {};
+    if (gethostname(name, sizeof(name) - 1) != 0) {
+        return "unknown";
+    }
+    return name;
+}
+
+std::string system_error(const std::string& what) {
+    return what + ": " + std::strerror(errno);
+}
+
+/**
+ * @brief Line-oriented view of a connected socket
+ */
+class Connection {
+  public:
+    explicit Connection(int fd = -1) : fd_(fd) {}
+    Connection(const Connection&) = delete;
+    Connection& operator=(const Connection&) = delete;
+    Connection(Connection&& other) noexcept : fd_(other.fd_), buffer_(std::move(other.buffer_)) { other.fd_ = -1; }
+    Connection& operator=(Connection&& other) noexcept {
+        if (this != &other) {
+            close();
+            fd_ = other.fd_;
+            buffer_ = std::move(other.buffer_);
+            other.fd_ = -1;
+        }
+        return *this;
+    }
+    ~Connection() { close(); }
+
+    int fd() const { return fd_; }
+    bool is_open() const { return fd_ >= 0; }
+
+    void close() {
+        if (fd_ >= 0) {
+            ::close(fd_);
+            fd_ = -1;
+        }
+    }
+
+    bool send_line(const std::string& line) {
+        std::string data = line + "\n";
+        size_t sent = 0;
+        while (fd_ >= 0 && sent < data.size()) {
+            ssize_t n = ::send(fd_, data.data() + sent, data.size() - sent, 0);
+            if (n < 0 && errno == EINTR) {
+                continue;
+            }
+            if (n <= 0) {
+                return false;
+            }
+            sent += static_cast<size_t>(n);
+        }
+        return sent == data.size();
+    }
+
+    /**
+     * @brief Read what the socket has; false once the peer closed or the line limit was exceeded
+     */
+    bool receive() {
+        char chunk[64 * 1024];
+        ssize_t n = ::recv(fd_, chunk, sizeof(chunk), 0);
+        if (n < 0 && (errno == EINTR || errno == EAGAIN)) {
+            return true;
+        }
+        if (n <= 0) {
+            return false;
+        }
+        buffer_.append(chunk, static_cast<size_t>(n));
+        return buffer_.size() <= BenchmarkConstants::FLEET_MAX_LINE_BYTES || buffer_.find('\n') != std::string::npos;
+    }
+
+    bool next_line(std::string& line) {
+        size_t newline = buffer_.find('\n');
+        if (newline == std::string::npos) {
+            return false;
+        }
+        line = buffer_.substr(0, newline);
+        buffer_.erase(0, newline + 1);
+        return true;
+    }
+
+    /**
+     * @brief Wait up to timeout_ms for one complete line
+     */
+    bool read_line(std::string& line, int timeout_ms) {
+        auto deadline = std::chrono::steady_clock::now() + std::chrono::milliseconds(timeout_ms);
+        while (!next_line(line)) {
+            int remaining = static_cast<int>(std::chrono::duration_cast<std::chrono::milliseconds>(
+                                                 deadline - std::chrono::steady_clock::now())
+                                                 .count());
+            pollfd descriptor = {fd_, POLLIN, 0};
+            if (remaining <= 0 || poll(&descriptor, 1, remaining) <= 0 || !receive()) {
+                return false;
+            }
+        }
+        return true;
+    }
+
+  private:
+    int fd_;
+    std::string buffer_;
+};
+
+Connection connect_to(const Endpoint& endpoint, std::string& error) {
+    addrinfo hints = {};
+    hints.ai_family = AF_UNSPEC;
+    hints.ai_socktype = SOCK_STREAM;
+    addrinfo* addresses = nullptr;
+    int status = getaddrinfo(endpoint.host.c_str(), std::to_string(endpoint.port).c_str(), &hints, &addresses);
+    if (status != 0) {
+        error = std::string("cannot resolve host: ") + gai_strerror(status);
+        return Connection();
+    }
+
+    error = "no address";
+    for (addrinfo* address = addresses; address != nullptr; address = address->ai_next) {
+        int fd = socket(address->ai_family, address->ai_socktype, address->ai_protocol);
+        if (fd < 0) {
+            error = system_error("socket");
+            continue;
+        }
+        // Non-blocking connect bounds the wait on hosts that drop SYNs
+        int flags = fcntl(fd, F_GETFL, 0);
+        fcntl(fd, F_SETFL, flags | O_NONBLOCK);
+        int result = connect(fd, address->ai_addr, address->ai_addrlen);
+        if (result != 0 && errno == EINPROGRESS) {
+            pollfd descriptor = {fd, POLLOUT, 0};
+            int socket_error = ETIMEDOUT;
+            socklen_t length = sizeof(socket_error);
+            if (poll(&descriptor, 1, BenchmarkConstants::FLEET_CONNECT_TIMEOUT_MS) == 1) {
+                getsockopt(fd, SOL_SOCKET, SO_ERROR, &socket_error, &length);
+            }
+            errno = socket_error;
+            result = socket_error == 0 ? 0 : -1;
+        }
+        if (result == 0) {
+            fcntl(fd, F_SETFL, flags);
+            freeaddrinfo(addresses);
+            error.clear();
+            return Connection(fd);
+        }
+        error = system_error("connect");
+        ::close(fd);
+    }
+    freeaddrinfo(addresses);
+    return Connection();
+}
+
+std::string error_message(const std::string& message) {
+    return Object().add_string("type", "error").add_string("message", message).str();
+}
+
+// Last non-empty line of a file: the error the benchmark printed before it exited
+std::string last_line(const std::string& path) {
+    std::ifstream file(path);
+    std::string line;
+    std::string last;
+    while (std::getline(file, line)) {
+        if (line.find_first_not_of(" \t\r") != std::string::npos) {
+            last = line;
+        }
+    }
+    return last;
+}
+
+std::string temporary_file(const std::string& tag) {
+    const char* directory = std::getenv("TMPDIR");
+    std::string path = std::string(directory != nullptr && *directory != '\0' ? directory : "/tmp") +
+                       "/membench-fleet-" + tag + "-XXXXXX";
+    std::vector<char> buffer(path.begin(), path.end());
+    buffer.push_back('\0');
+    int fd = mkstemp(buffer.data());
+    if (fd < 0) {
+        throw PlatformError(system_error("Cannot create a temporary file in " + path.substr(0, path.rfind('/'))));
+    }
+    ::close(fd);
+    return buffer.data();
+}
+
+/**
+ * @brief Appends lines written to a file since the last call
+ */
+class Tail {
+  public:
+    explicit Tail(const std::string& path) : fd_(open(path.c_str(), O_RDONLY)) {}
+    ~Tail() {
+        if (fd_ >= 0) {
+            ::close(fd_);
+        }
+    }
+
+    void read_lines(std::vector<std::string>& lines) {
+        char chunk[64 * 1024];
+        ssize_t n;
+        while (fd_ >= 0 && (n = read(fd_, chunk, sizeof(chunk))) > 0) {
+            partial_.append(chunk, static_cast<size_t>(n));
+        }
+        size_t newline;
+        while ((newline = partial_.find('\n')) != std::string::npos) {
+            lines.push_back(partial_.substr(0, newline));
+            partial_.erase(0, newline + 1);
+        }
+    }
+
+  private:
+    int fd_;
+    std::string partial_;
+};
+
+pid_t spawn(const std::string& program, const std::vector<std::string>& args, const std::string& stderr_path) {
+    pid_t pid = fork();
+    if (pid != 0) {
+        return pid;
+    }
+    int null_fd = open("/dev/null", O_RDWR);
+    int error_fd = open(stderr_path.c_str(), O_WRONLY | O_TRUNC);
+    if (null_fd >= 0) {
+        dup2(null_fd, STDIN_FILENO);
+        dup2(null_fd, STDOUT_FILENO);
+    }
+    if (error_fd >= 0) {
+        dup2(error_fd, STDERR_FILENO);
+    }
+    std::vector<char*> argv;
+    argv.push_back(const_cast<char*>(program.c_str()));
+    for (const auto& arg : args) {
+        argv.push_back(const_cast<char*>(arg.c_str()));
+    }
+    argv.push_back(nullptr);
+    execv(program.c_str(), argv.data());
+    _exit(127);
+}
+
+int exit_status(int status) {
+    if (WIFEXITED(status)) {
+        return WEXITSTATUS(status);
+    }
+    return WIFSIGNALED(status) ? 128 + WTERMSIG(status) : -1;
+}
+
+// One coordinator connection: check the run, wait for its start, run it and stream the records
+void handle(Connection& connection, const std::string& program, const Validator& validate) {
+    std::string line;
+    if (!connection.read_line(line, BenchmarkConstants::FLEET_CONNECT_TIMEOUT_MS)) {
+        return;
+    }
+    RunSpec spec;
+    try {
+        spec = spec_from_json(Json::parse(line));
+    } catch (const std::exception& e) {
+        connection.send_line(error_message(std::string("Bad run message: ") + e.what()));
+        return;
+    }
+
+    std::string refusal = refused_option(spec.args);
+    int64_t lead_ms = spec.start_unix_ms - unix_ms();
+    if (refusal.empty() && lead_ms > BenchmarkConstants::FLEET_MAX_START_DELAY_MS) {
+        refusal = "Start time is " + std::to_string(lead_ms / 1000) + " s away; agents wait at most " +
+                  std::to_string(BenchmarkConstants::FLEET_MAX_START_DELAY_MS / 1000) + " s";
+    }
+    std::string records_path = temporary_file("records");
+    std::vector<std::string> args = spec.args;
+    args.push_back("--ndjson");
+    args.push_back(records_path);
+    if (refusal.empty()) {
+        refusal = validate(args);
+    }
+    if (!refusal.empty()) {
+        unlink(records_path.c_str());
+        connection.send_line(error_message(refusal));
+        std::cerr << "Refused fleet run " << spec.fleet_id << ": " << refusal << "\n";
+        return;
+    }
+    connection.send_line(Object()
+                             .add_string("type", "accepted")
+                             .add_string("hostname", local_hostname())
+                             .add_count("unix_ms", static_cast<uint64_t>(unix_ms()))
+                             .str());
+    std::cerr << "Accepted fleet run " << spec.fleet_id << " (" << spec.args.size() << " options), starting in "
+              << std::max<int64_t>(lead_ms, 0) << " ms\n";
+
+    while (unix_ms() < spec.start_unix_ms) {
+        std::this_thread::sleep_for(std::chrono::milliseconds(std::min<int64_t>(spec.start_unix_ms - unix_ms(), 10)));
+    }
+    std::string stderr_path = temporary_file("stderr");
+    pid_t child = spawn(program, args, stderr_path);
+
+    Tail tail(records_path);
+    std::vector<std::string> lines;
+    uint64_t records = 0;
+    int status = 0;
+    bool finished = child < 0;
+    bool connected = true;
+    while (!finished && connected) {
+        pollfd descriptor = {connection.fd(), POLLIN, 0};
+        if (poll(&descriptor, 1, BenchmarkConstants::FLEET_POLL_MS) > 0) {
+            // The coordinator sends nothing after the run message: readable means it went away
+            char byte;
+            connected = ::recv(connection.fd(), &byte, 1, MSG_PEEK) > 0;
+        }
+        finished = waitpid(child, &status, WNOHANG) == child;
+        tail.read_lines(lines);
+        for (const auto& record : lines) {
+            connected = connected && connection.send_line(record);
+            ++records;
+        }
+        lines.clear();
+    }
+    if (!finished) {
+        kill(child, SIGTERM);
+        waitpid(child, &status, 0);
+        std::cerr << "Coordinator of fleet run " << spec.fleet_id << " disconnected; run stopped\n";
+    } else {
+        int exit_code = child < 0 ? -1 : exit_status(status);
+        std::string message = child < 0 ? system_error("fork") : exit_code == 0 ? "" : last_line(stderr_path);
+        connection.send_line(Object()
+                                 .add_string("type", "done")
+                                 .add_raw("exit_code", std::to_string(exit_code))
+                                 .add_count("records", records)
+                                 .add_string("message", message)
+                                 .str());
+        std::cerr << "Finished fleet run " << spec.fleet_id << ": exit " << exit_code << ", " << records
+                  << " records\n";
+    }
+    unlink(records_path.c_str());
+    unlink(stderr_path.c_str());
+}
+
+/**
+ * @brief Coordinator side of one agent
+ */
+struct Peer {
+    Connection connection;
+    HostRun* run = nullptr;
+    int64_t sent_unix_ms = 0;
+    bool done = false;
+};
+
+void finish(Peer& peer, const std::string& message) {
+    if (peer.run->message.empty()) {
+        peer.run->message = message;
+    }
+    peer.connection.close();
+    peer.done = true;
+}
+
+// One message or record of an agent
+void dispatch(Peer& peer, const std::string& line, std::vector<Sample>& samples, std::ofstream& records) {
+    Json::Value message;
+    try {
+        message = Json::parse(line);
+    } catch (const ConfigurationError& e) {
+        finish(peer, std::string("malformed message: ") + e.what());
+        return;
+    }
+    std::string type = message.get_string("type");
+    HostRun& run = *peer.run;
+    if (type == "accepted") {
+        int64_t now = unix_ms();
+        run.accepted = true;
+        run.hostname = message.get_string("hostname");
+        run.clock_offset_ms = message.get_number("unix_ms") - 0.5 * static_cast<double>(peer.sent_unix_ms + now);
+        std::cerr << run.endpoint << " (" << run.hostname << "): accepted, clock offset " << std::showpos
+                  << static_cast<long long>(std::llround(run.clock_offset_ms)) << std::noshowpos << " ms\n";
+    } else if (type == "error") {
+        finish(peer, message.get_string("message", "refused the run"));
+        std::cerr << run.endpoint << ": " << run.message << "\n";
+    } else if (type == "done") {
+        run.exit_code = static_cast<int>(message.get_number("exit_code", -1));
+        finish(peer, message.get_string("message"));
+        std::cerr << run.endpoint << " (" << run.hostname << "): finished, exit " << run.exit_code << ", "
+                  << run.records << " records\n";
+    } else if (message.get_string("record") == "result") {
+        ++run.records;
+        if (records.is_open()) {
+            records << line << "\n" << std::flush;
+        }
+        Sample sample;
+        if (sample_from_record(message, sample)) {
+            run.sku = sample.sku;
+            samples.push_back(sample);
+        }
+    }
+}
+
+}  // namespace
+
+std::string endpoint_to_string(const Endpoint& endpoint) {
+    bool ipv6 = endpoint.host.find(':') != std::string::npos;
+    return (ipv6 ? "[" + endpoint.host + "]" : endpoint.host) + ":" + std::to_string(endpoint.port);
+}
+
+uint16_t parse_port(const std::string& text, const std::string& option) {
+    if (text.empty() || text.size() > 5 || text.find_first_not_of("0123456789") != std::string::npos ||
+        std::stoul(text) == 0 || std::stoul(text) > 65535) {
+        throw ArgumentError("Invalid " + option + " port '" + text + "'. Expected 1 to 65535");
+    }
+    return static_cast<uint16_t>(std::stoul(text));
+}
+
+std::vector<Endpoint> parse_endpoints(const std::string& list) {
+    std::vector<Endpoint> endpoints;
+    size_t position = 0;
+    while (position <= list.size()) {
+        size_t comma = list.find(',', position);
+        std::string item = list.substr(position, comma == std::string::npos ? std::string::npos : comma - position);
+        position = comma == std::string::npos ? list.size() + 1 : comma + 1;
+
+        Endpoint endpoint;
+        endpoint.port = BenchmarkConstants::FLEET_DEFAULT_PORT;
+        std::string port;
+        if (!item.empty() && item[0] == '[') {
+            size_t close = item.find(']');
+            if (close == std::string::npos || (close + 1 < item.size() && item[close + 1] != ':')) {
+                throw ArgumentError("Invalid --coordinate host '" + item + "'. Expected [IPv6]:PORT");
+            }
+            endpoint.host = item.substr(1, close - 1);
+            if (close + 1 < item.size()) {
+                port = item.substr(close + 2);
+                endpoint.port = parse_port(port, "--coordinate");
+            }
+        } else if (std::count(item.begin(), item.end(), ':') == 1) {
+            endpoint.host = item.substr(0, item.find(':'));
+            endpoint.port = parse_port(item.substr(item.find(':') + 1), "--coordinate");
+        } else {
+            endpoint.host = item;  // A name, IPv4 address or bare IPv6 address
+        }
+        if (endpoint.host.empty()) {
+            throw ArgumentError("Invalid --coordinate host '" + item + "'. Expected HOST[:PORT]");
+        }
+        auto same = [&endpoint](const Endpoint& known) {
+            return known.host == endpoint.host && known.port == endpoint.port;
+        };
+        if (std::find_if(endpoints.begin(), endpoints.end(), same) == endpoints.end()) {
+            endpoints.push_back(endpoint);
+        }
+    }
+    return endpoints;
+}
+
+std::vector<std::string> forwarded_args(int argc, char* argv[]) {
+    std::vector<std::string> args;
+    for (int i = 1; i < argc; ++i) {
+        std::string arg = argv[i];
+        std::string name = option_name(arg);
+        bool coordinator = std::any_of(std::begin(COORDINATOR_OPTIONS), std::end(COORDINATOR_OPTIONS),
+                                       [&name](const char* option) { return name == option; });
+        if (!coordinator) {
+            args.push_back(arg);
+        } else if (name == arg) {
+            ++i;  // The value follows as its own argument
+        }
+    }
+    return args;
+}
+
+std::string refused_option(const std::vector<std::string>& args) {
+    for (const auto& arg : args) {
+        std::string name = option_name(arg);
+        if (std::any_of(std::begin(REFUSED_OPTIONS), std::end(REFUSED_OPTIONS),
+                        [&name](const char* option) { return name == option; })) {
+            return "Agents do not accept " + name + " from a coordinator: it names a file on the agent or is "
+                   "not a benchmark option";
+        }
+    }
+    return "";
+}
+
+std::string spec_to_json(const RunSpec& spec) {
+    std::vector<std::string> args;
+    for (const auto& arg : spec.args) {
+        args.push_back(Json::quote(arg));
+    }
+    return Object()
+        .add_string("type", "run")
+        .add_string("fleet_id", spec.fleet_id)
+        .add_raw("args", Json::array(args))
+        .add_count("start_unix_ms", static_cast<uint64_t>(spec.start_unix_ms))
+        .str();
+}
+
+RunSpec spec_from_json(const Json::Value& message) {
+    const Json::Value* args = message.find("args");
+    const Json::Value* start = message.find("start_unix_ms");
+    if (message.get_string("type") != "run" || args == nullptr || args->type != Json::Value::Type::ARRAY ||
+        start == nullptr || start->type != Json::Value::Type::NUMBER) {
+        throw ConfigurationError("expected {\"type\":\"run\"} with args and start_unix_ms");
+    }
+    RunSpec spec;
+    spec.fleet_id = message.get_string("fleet_id");
+    spec.start_unix_ms = static_cast<int64_t>(start->number);
+    for (const auto& arg : args->items) {
+        if (arg.type != Json::Value::Type::STRING) {
+            throw ConfigurationError("run args must be strings");
+        }
+        spec.args.push_back(arg.string);
+    }
+    return spec;
+}
+
+int64_t unix_ms() {
+    return std::chrono::duration_cast<std::chrono::milliseconds>(
+               std::chrono::system_clock::now().time_since_epoch())
+        .count();
+}
+
+std::string sku_key(const Ndjson::HostFingerprint& host) {
+    return host.cpu_name + " " + host.memory_type + "-" + std::to_string(host.memory_speed_mtps) + " x" +
+           std::to_string(host.memory_channels);
+}
+
+bool sample_from_record(const Json::Value& record, Sample& sample) {
+    const Json::Value* host = record.find("host");
+    const Json::Value* verified = record.find("verified");
+    if (record.get_string("record") != "result" || host == nullptr ||
+        (verified != nullptr && verified->type == Json::Value::Type::BOOL && !verified->boolean)) {
+        return false;
+    }
+    Ndjson::HostFingerprint fingerprint = Ndjson::host_from_json(*host);
+
+    double bandwidth = record.get_number("bandwidth_gbps");
+    double latency = record.get_number("latency_ns");
+    if (bandwidth <= 0.0 && latency <= 0.0) {
+        return false;
+    }
+    sample.hostname = fingerprint.hostname;
+    sample.sku = sku_key(fingerprint);
+    sample.test = record.get_string("test_name") + " " + record.get_string("working_set") + " " +
+                  record.get_string("kernel") + " " + record.get_string("store_policy") + " " +
+                  std::to_string(static_cast<size_t>(record.get_number("threads"))) + "T";
+    sample.metric = bandwidth > 0.0 ? "bandwidth_gbps" : "latency_ns";
+    sample.value = bandwidth > 0.0 ? bandwidth : latency;
+    return true;
+}
+
+void summarize(const std::vector<Sample>& samples, Report& report) {
+    std::vector<std::vector<const Sample*>> groups;
+    std::map<std::string, size_t> group_of;
+    for (const auto& sample : samples) {
+        std::string key = sample.sku + "\n" + sample.test + "\n" + sample.metric;
+        auto found = group_of.find(key);
+        if (found == group_of.end()) {
+            found = group_of.emplace(key, groups.size()).first;
+            groups.emplace_back();
+        }
+        groups[found->second].push_back(&sample);
+    }
+
+    for (const auto& group : groups) {
+        std::vector<double> values;
+        for (const Sample* sample : group) {
+            values.push_back(sample->value);
+        }
+        std::sort(values.begin(), values.end());
+
+        Summary summary;
+        summary.sku = group.front()->sku;
+        summary.test = group.front()->test;
+        summary.metric = group.front()->metric;
+        summary.hosts = values.size();
+        summary.min = values.front();
+        summary.p10 = SampleStats::percentile(values, 0.10);
+        summary.median = SampleStats::percentile(values, 0.50);
+        summary.p90 = SampleStats::percentile(values, 0.90);
+        summary.max = values.back();
+        report.summaries.push_back(summary);
+        if (values.size() < BenchmarkConstants::FLEET_OUTLIER_MIN_HOSTS || summary.median <= 0.0) {
+            continue;
+        }
+
+        std::vector<double> deviations;
+        for (double value : values) {
+            deviations.push_back(std::fabs(value - summary.median));
+        }
+        std::sort(deviations.begin(), deviations.end());
+        double spread = std::max(MAD_TO_SIGMA * SampleStats::percentile(deviations, 0.50),
+                                 MIN_SPREAD_FRACTION * summary.median);
+        for (const Sample* sample : group) {
+            Outlier outlier;
+            outlier.hostname = sample->hostname;
+            outlier.sku = sample->sku;
+            outlier.test = sample->test;
+            outlier.metric = sample->metric;
+            outlier.value = sample->value;
+            outlier.median = summary.median;
+            outlier.deviation_percent = (sample->value - summary.median) / summary.median * 100.0;
+            outlier.robust_z = std::fabs(sample->value - summary.median) / spread;
+            if (outlier.robust_z > BenchmarkConstants::FLEET_OUTLIER_MADS &&
+                std::fabs(outlier.deviation_percent) > BenchmarkConstants::FLEET_OUTLIER_MIN_PERCENT) {
+                report.outliers.push_back(outlier);
+            }
+        }
+    }
+    std::stable_sort(report.outliers.begin(), report.outliers.end(), [](const Outlier& a, const Outlier& b) {
+        return std::fabs(a.deviation_percent) > std::fabs(b.deviation_percent);
+    });
+}
+
+std::string executable_path(const char* argv0) {
+    char path[4096] = {};
+    ssize_t length = readlink("/proc/self/exe", path, sizeof(path) - 1);
+    return length > 0 ? std::string(path, static_cast<size_t>(length)) : std::string(argv0);
+}
+
+void serve(uint16_t port, const std::string& program, const Validator& validate) {
+    std::signal(SIGPIPE, SIG_IGN);
+    int listener = socket(AF_INET6, SOCK_STREAM, 0);
+    bool dual_stack = listener >= 0;
+    if (!dual_stack) {
+        listener = socket(AF_INET, SOCK_STREAM, 0);
+    }
+    if (listener < 0) {
+        throw PlatformError(system_error("Cannot create the agent socket"));
+    }
+    fcntl(listener, F_SETFD, FD_CLOEXEC);
+    int yes = 1;
+    int no = 0;
+    setsockopt(listener, SOL_SOCKET, SO_REUSEADDR, &yes, sizeof(yes));
+    int bound;
+    if (dual_stack) {
+        setsockopt(listener, IPPROTO_IPV6, IPV6_V6ONLY, &no, sizeof(no));
+        sockaddr_in6 address = {};
+        address.sin6_family = AF_INET6;
+        address.sin6_addr = in6addr_any;
+        address.sin6_port = htons(port);
+        bound = bind(listener, reinterpret_cast<sockaddr*>(&address), sizeof(address));
+    } else {
+        sockaddr_in address = {};
+        address.sin_family = AF_INET;
+        address.sin_addr.s_addr = htonl(INADDR_ANY);
+        address.sin_port = htons(port);
+        bound = bind(listener, reinterpret_cast<sockaddr*>(&address), sizeof(address));
+    }
+    if (bound != 0 || listen(listener, 4) != 0) {
+        std::string error = system_error("Cannot listen on port " + std::to_string(port));
+        ::close(listener);
+        throw PlatformError(error);
+    }
+    std::cerr << "Fleet agent listening on port " << port << " (no authentication: trusted networks only)\n";
+
+    for (;;) {
+        int fd = accept(listener, nullptr, nullptr);
+        if (fd < 0) {
+            if (errno != EINTR) {
+                std::cerr << system_error("accept") << "\n";
+            }
+            continue;
+        }
+        fcntl(fd, F_SETFD, FD_CLOEXEC);  // The benchmark child must not hold the coordinator's connection open
+        Connection connection(fd);
+        try {
+            handle(connection, program, validate);
+        } catch (const std::exception& e) {
+            connection.send_line(error_message(e.what()));
+            std::cerr << "Fleet run failed: " << e.what() << "\n";
+        }
+    }
+}
+
+Report coordinate(const std::vector<Endpoint>& agents, const std::vector<std::string>& args,
+                  const std::string& records_path) {
+    std::signal(SIGPIPE, SIG_IGN);
+    Report report;
+    report.fleet_id = local_hostname() + "-" + std::to_string(getpid()) + "-" + std::to_string(unix_ms() / 1000);
+    report.hosts.resize(agents.size());
+
+    std::ofstream records;
+    if (!records_path.empty()) {
+        records.open(records_path, std::ios::out | std::ios::app);
+        if (!records) {
+            throw ConfigurationError("Cannot open --ndjson file " + records_path + " for appending");
+        }
+    }
+
+    std::vector<Peer> peers;
+    for (size_t i = 0; i < agents.size(); ++i) {
+        report.hosts[i].endpoint = endpoint_to_string(agents[i]);
+        std::string error;
+        Connection connection = connect_to(agents[i], error);
+        if (!connection.is_open()) {
+            report.hosts[i].message = error;
+            std::cerr << report.hosts[i].endpoint << ": " << error << "\n";
+            continue;
+        }
+        Peer peer;
+        peer.connection = std::move(connection);
+        peer.run = &report.hosts[i];
+        peers.push_back(std::move(peer));
+    }
+
+    // Connecting is done before the start is chosen, so slow hosts do not eat into the lead time
+    RunSpec spec;
+    spec.fleet_id = report.fleet_id;
+    spec.args = args;
+    spec.start_unix_ms = unix_ms() + BenchmarkConstants::FLEET_START_DELAY_MS;
+    report.start_unix_ms = spec.start_unix_ms;
+    std::string message = spec_to_json(spec);
+    for (auto& peer : peers) {
+        peer.sent_unix_ms = unix_ms();
+        if (!peer.connection.send_line(message)) {
+            finish(peer, system_error("send"));
+        }
+    }
+
+    std::vector<Sample> samples;
+    auto handshake_deadline = std::chrono::steady_clock::now() +
+                              std::chrono::milliseconds(BenchmarkConstants::FLEET_CONNECT_TIMEOUT_MS);
+    for (;;) {
+        std::vector<pollfd> descriptors;
+        std::vector<Peer*> polled;
+        for (auto& peer : peers) {
+            if (!peer.done && !peer.run->accepted && std::chrono::steady_clock::now() > handshake_deadline) {
+                finish(peer, "no answer to the run message");
+            }
+            if (!peer.done) {
+                descriptors.push_back({peer.connection.fd(), POLLIN, 0});
+                polled.push_back(&peer);
+            }
+        }
+        if (descriptors.empty()) {
+            break;
+        }
+        if (poll(descriptors.data(), descriptors.size(), BenchmarkConstants::FLEET_POLL_MS) <= 0) {
+            continue;
+        }
+        for (size_t i = 0; i < polled.size(); ++i) {
+            Peer& peer = *polled[i];
+            if (descriptors[i].revents == 0) {
+                continue;
+            }
+            bool open = peer.connection.receive();
+            std::string line;
+            while (!peer.done && peer.connection.next_line(line)) {
+                dispatch(peer, line, samples, records);
+            }
+            if (!open && !peer.done) {
+                finish(peer, "connection closed before the run finished");
+            }
+        }
+    }
+
+    if (std::none_of(report.hosts.begin(), report.hosts.end(), [](const HostRun& run) { return run.accepted; })) {
+        throw BenchmarkError("No agent accepted the fleet run" +
+                             (report.hosts.empty() ? std::string()
+                                                   : " (" + report.hosts.front().endpoint + ": " +
+                                                         report.hosts.front().message + ")"));
+    }
+    summarize(samples, report);
+    return report;
+}
+
+}  // namespace Fleet
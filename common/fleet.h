@@ -0,0 +1,230 @@
+#ifndef FLEET_H
+#define FLEET_H
+
+#include <cstddef>
+#include <cstdint>
+#include <functional>
+#include <string>
+#include <vector>
+
+#include "ndjson_sink.h"
+
+namespace Json {
+struct Value;
+}
+
+/**
+ * @brief One run spread over many hosts, with a fleet report per hardware SKU (--agent, --coordinate)
+ *
+ * Each host runs an agent that listens on a TCP port. The coordinator
+ * connects to every agent and sends the same run: the options it was given
+ * itself, without the fleet and output options, and a wall-clock start
+ * time a couple of seconds out. Each agent checks the options, reports its
+ * own clock, waits for the start time and runs the benchmark as a child
+ * process with --ndjson, streaming every record back as it is written.
+ * The coordinator groups the records by hardware SKU and test, reports the
+ * spread of each group and flags the hosts that sit far from their SKU's
+ * median, which are the machines to look at (bad DIMM population, BIOS
+ * settings, a noisy neighbour).
+ *
+ * Messages are single-line JSON objects, one per line, in both directions:
+ *   coordinator: {"type":"run","fleet_id":...,"args":[...],"start_unix_ms":...}
+ *   agent:       {"type":"accepted","hostname":...,"unix_ms":...} or {"type":"error","message":...}
+ *   agent:       the --ndjson records of the run, unchanged
+ *   agent:       {"type":"done","exit_code":...,"records":...,"message":...}
+ *
+ * The protocol has no authentication or encryption: agents run any
+ * benchmark options a peer sends them, so they belong on a trusted
+ * management network only. Options that read or write files on the agent
+ * are refused. The common start relies on the hosts' clocks being synced
+ * (NTP or PTP); the coordinator reports each host's offset from its own.
+ */
+namespace Fleet {
+
+/**
+ * @brief Agent address of --coordinate
+ */
+struct Endpoint {
+    std::string host;
+    uint16_t port = 0;
+};
+
+/**
+ * @brief "host:port", with IPv6 literals in brackets
+ */
+std::string endpoint_to_string(const Endpoint& endpoint);
+
+/**
+ * @brief Parse a TCP port (1 to 65535)
+ * @throws ArgumentError naming the option on anything else
+ */
+uint16_t parse_port(const std::string& text, const std::string& option);
+
+/**
+ * @brief Parse --coordinate: comma-separated host[:port] ("node1,node2:7600,[fe80::1]:7531")
+ *
+ * Hosts without a port use FLEET_DEFAULT_PORT. Repeated endpoints are dropped.
+ *
+ * @throws ArgumentError on an empty list, an empty host or a bad port
+ */
+std::vector<Endpoint> parse_endpoints(const std::string& list);
+
+/**
+ * @brief Options of a coordinator command line to send to the agents
+ *
+ * Everything but the program name, --coordinate and --agent, and the
+ * output options --format, --ndjson, --save-baseline and --compare, which
+ * apply to the coordinator's own report.
+ */
+std::vector<std::string> forwarded_args(int argc, char* argv[]);
+
+/**
+ * @brief Why an agent refuses a set of run options, or empty when it accepts them
+ *
+ * Fleet options and options naming a file or directory on the agent
+ * (--ndjson, --file, --io, --trace, ...) are refused.
+ */
+std::string refused_option(const std::vector<std::string>& args);
+
+/**
+ * @brief Run a coordinator sends to its agents
+ */
+struct RunSpec {
+    std::string fleet_id;            ///< Coordinator hostname-pid-start time, shared by every host of the run
+    std::vector<std::string> args;   ///< Benchmark options (forwarded_args)
+    int64_t start_unix_ms = 0;       ///< Wall-clock time at which every agent starts the run
+};
+
+/**
+ * @brief Run message as a single line of JSON, without the trailing newline
+ */
+std::string spec_to_json(const RunSpec& spec);
+
+/**
+ * @brief Run read back from its message
+ * @throws ConfigurationError if it is not a run message or a field is missing
+ */
+RunSpec spec_from_json(const Json::Value& message);
+
+/**
+ * @brief Current wall-clock time in milliseconds since the Unix epoch
+ */
+int64_t unix_ms();
+
+/**
+ * @brief Hardware SKU a host's results are compared within ("Intel Xeon 6430 DDR5-4800 x8")
+ */
+std::string sku_key(const Ndjson::HostFingerprint& host);
+
+/**
+ * @brief Headline value of one record
+ */
+struct Sample {
+    std::string hostname;
+    std::string sku;
+    std::string test;      ///< Test, working set, kernel, stores and threads ("Copy 1GB avx2 temporal 8T")
+    std::string metric;    ///< "bandwidth_gbps", or "latency_ns" for latency tests
+    double value = 0.0;
+};
+
+/**
+ * @brief Sample of a result record
+ * @return false if the value is not a result record or carries no measurement
+ */
+bool sample_from_record(const Json::Value& record, Sample& sample);
+
+/**
+ * @brief Outcome of one agent
+ */
+struct HostRun {
+    std::string endpoint;
+    std::string hostname;        ///< As the agent reports it (empty if it never answered)
+    std::string sku;
+    bool accepted = false;
+    int exit_code = -1;          ///< Of the benchmark process, -1 if it never finished
+    size_t records = 0;          ///< Result records received
+    double clock_offset_ms = 0;  ///< Agent clock minus coordinator clock at the handshake
+    std::string message;         ///< Why the host failed, empty if it did not
+};
+
+/**
+ * @brief Spread of one test over the hosts of one SKU
+ */
+struct Summary {
+    std::string sku;
+    std::string test;
+    std::string metric;
+    size_t hosts = 0;
+    double min = 0.0;
+    double p10 = 0.0;
+    double median = 0.0;
+    double p90 = 0.0;
+    double max = 0.0;
+};
+
+/**
+ * @brief Host that sits far from the median of its SKU
+ */
+struct Outlier {
+    std::string hostname;
+    std::string sku;
+    std::string test;
+    std::string metric;
+    double value = 0.0;
+    double median = 0.0;
+    double deviation_percent = 0.0;  ///< Signed distance from the median
+    double robust_z = 0.0;           ///< Distance in scaled median absolute deviations
+};
+
+/**
+ * @brief Everything the coordinator reports
+ */
+struct Report {
+    std::string fleet_id;
+    int64_t start_unix_ms = 0;
+    std::vector<HostRun> hosts;
+    std::vector<Summary> summaries;  ///< In first-seen order of SKU and test
+    std::vector<Outlier> outliers;   ///< Largest deviation first
+};
+
+/**
+ * @brief Fill the summaries and outliers of a report from its samples
+ *
+ * Outliers need FLEET_OUTLIER_MIN_HOSTS samples in their group, a robust
+ * z-score above FLEET_OUTLIER_MADS and a distance of FLEET_OUTLIER_MIN_PERCENT
+ * from the median, so a fleet that agrees to a fraction of a percent flags
+ * nobody.
+ */
+void summarize(const std::vector<Sample>& samples, Report& report);
+
+/**
+ * @brief Checks run options as the benchmark would, returning the error or empty when valid
+ */
+using Validator = std::function<std::string(const std::vector<std::string>& args)>;
+
+/**
+ * @brief Path an agent re-executes to run the benchmark: /proc/self/exe where it exists, else argv0
+ */
+std::string executable_path(const char* argv0);
+
+/**
+ * @brief Agent: serve coordinators on port, one at a time, until killed
+ *
+ * @param program Benchmark executable that runs each accepted run
+ * @param validate Parses the options of a run before it is accepted
+ * @throws PlatformError if the port cannot be bound
+ */
+void serve(uint16_t port, const std::string& program, const Validator& validate);
+
+/**
+ * @brief Coordinator: run args on every agent and collect the records
+ *
+ * @param records_path Also append every record received to this file (empty: do not)
+ * @throws BenchmarkError if no agent accepted the run
+ */
+Report coordinate(const std::vector<Endpoint>& agents, const std::vector<std::string>& args,
+                  const std::string& records_path);
+
+}  // namespace Fleet
+
+#endif  // FLEET_H
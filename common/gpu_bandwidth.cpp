@@ -0,0 +1,86 @@
+#include "gpu_bandwidth.h"
+#include "constants.h"
+#include "errors.h"
+
+#include <algorithm>
+#include <sstream>
+
+namespace GpuBandwidth {
+
+std::vector<Kernel> parse_kernels(const std::string& list) {
+    std::vector<Kernel> kernels;
+    std::stringstream stream(list);
+    std::string name;
+    while (std::getline(stream, name, ',')) {
+        std::vector<Kernel> named;
+        if (name == "all") {
+            named = {Kernel::READ, Kernel::COPY, Kernel::TRIAD};
+        } else if (name == "read") {
+            named = {Kernel::READ};
+        } else if (name == "copy") {
+            named = {Kernel::COPY};
+        } else if (name == "triad") {
+            named = {Kernel::TRIAD};
+        } else {
+            throw ArgumentError("Unknown --gpu-kernels kernel '" + name + "' (expected read, copy, triad or all)");
+        }
+        for (Kernel kernel : named) {
+            if (std::find(kernels.begin(), kernels.end(), kernel) == kernels.end()) {
+                kernels.push_back(kernel);
+            }
+        }
+    }
+    if (kernels.empty()) {
+        throw ArgumentError("--gpu-kernels needs at least one kernel");
+    }
+    return kernels;
+}
+
+std::string kernel_to_string(Kernel kernel) {
+    switch (kernel) {
+        case Kernel::READ:
+            return "read";
+        case Kernel::COPY:
+            return "copy";
+        case Kernel::TRIAD:
+            return "triad";
+    }
+    return "unknown";
+}
+
+size_t traffic_factor(Kernel kernel) {
+    switch (kernel) {
+        case Kernel::READ:
+            return 1;
+        case Kernel::COPY:
+            return 2;
+        case Kernel::TRIAD:
+            return 3;
+    }
+    return 1;
+}
+
+Contention::Aggressor cpu_traffic(Kernel kernel) {
+    return kernel == Kernel::READ ? Contention::Aggressor::SEQUENTIAL_READ : Contention::Aggressor::COPY;
+}
+
+void fill(float* a, float* b, float* c, size_t count) {
+    std::fill(a, a + count, 0.0f);
+    std::fill(b, b + count, 1.0f);
+    std::fill(c, c + count, 2.0f);
+}
+
+bool verify(Kernel kernel, const Arrays& arrays, double read_sum) {
+    if (kernel == Kernel::READ) {
+        // Every partial sum is a small integer, so the total is exact
+        return read_sum == static_cast<double>(arrays.count);
+    }
+    float expected = kernel == Kernel::COPY ? 1.0f : 1.0f + BenchmarkConstants::GPU_TRIAD_SCALAR * 2.0f;
+    return std::all_of(arrays.a, arrays.a + arrays.count, [expected](float value) { return value == expected; });
+}
+
+double retained_percent(double shared_gbps, double alone_gbps) {
+    return alone_gbps > 0.0 ? shared_gbps / alone_gbps * 100.0 : 0.0;
+}
+
+}  // namespace GpuBandwidth
@@ -0,0 +1,126 @@
+#ifndef GPU_BANDWIDTH_H
+#define GPU_BANDWIDTH_H
+
+#include <cstddef>
+#include <string>
+#include <vector>
+
+#include "contention.h"
+
+/**
+ * @brief GPU bandwidth over unified memory, alone and against CPU traffic (--gpu)
+ *
+ * On Apple Silicon the CPU clusters and the GPU share one memory fabric and
+ * the same DRAM. A GPU backend wraps the CPU's own buffers without copying
+ * (shared storage) and runs read, copy and triad compute kernels over them.
+ * Each kernel is measured three ways: the GPU alone, CPU threads alone
+ * streaming the same kind of traffic over buffers of their own, and both at
+ * once. How much of its solo bandwidth each side keeps when the other is
+ * running shows how the fabric splits between them, which is what a
+ * pipeline that overlaps CPU pre-processing with GPU compute gets.
+ */
+namespace GpuBandwidth {
+
+/**
+ * @brief Compute kernel run by the GPU
+ */
+enum class Kernel {
+    READ,   ///< Sum of b, one partial sum per GPU thread
+    COPY,   ///< a = b
+    TRIAD   ///< a = b + scalar * c
+};
+
+/**
+ * @brief Parse --gpu-kernels: comma-separated read, copy, triad, or all (duplicates dropped)
+ * @throws ArgumentError on an unknown kernel or an empty list
+ */
+std::vector<Kernel> parse_kernels(const std::string& list);
+
+/**
+ * @brief Kernel as passed to --gpu-kernels and reported in results
+ */
+std::string kernel_to_string(Kernel kernel);
+
+/**
+ * @brief Bytes a kernel moves per byte of one array (1 for read, 2 for copy, 3 for triad)
+ */
+size_t traffic_factor(Kernel kernel);
+
+/**
+ * @brief CPU traffic that matches a kernel: sequential reads for read, copies for copy and triad
+ */
+Contention::Aggressor cpu_traffic(Kernel kernel);
+
+/**
+ * @brief Float arrays a kernel runs over, page aligned and a whole number of pages long
+ */
+struct Arrays {
+    float* a = nullptr;        ///< Destination of copy and triad
+    const float* b = nullptr;  ///< Source of every kernel
+    const float* c = nullptr;  ///< Second triad source
+    size_t count = 0;          ///< Floats per array, a multiple of 4
+};
+
+/**
+ * @brief Fill b with 1, c with 2 and a with 0, the values verify expects
+ */
+void fill(float* a, float* b, float* c, size_t count);
+
+/**
+ * @brief Whether the arrays hold what the kernel should have left
+ * @param read_sum Timing::read_sum of a read kernel (unused for the others)
+ */
+bool verify(Kernel kernel, const Arrays& arrays, double read_sum);
+
+/**
+ * @brief Time of one run of a kernel, iterated back to back
+ */
+struct Timing {
+    double seconds = 0.0;   ///< GPU execution time of all the iterations
+    double read_sum = 0.0;  ///< Sum computed by the last read iteration
+};
+
+/**
+ * @brief A GPU that can run the kernels over CPU memory in place
+ */
+class Device {
+  public:
+    virtual ~Device() = default;
+
+    /// Device name as the driver reports it
+    virtual std::string name() const = 0;
+
+    /// Alignment and size granularity of the buffers the device can wrap
+    virtual size_t page_size() const = 0;
+
+    /**
+     * @brief Run a kernel iterations times in one submission and wait for it
+     * @param error Receives the reason on failure
+     */
+    virtual bool run(Kernel kernel, const Arrays& arrays, size_t iterations, Timing& timing, std::string& error) = 0;
+};
+
+/**
+ * @brief One kernel alone on each side and shared
+ */
+struct Point {
+    Kernel kernel = Kernel::READ;
+    std::string device;             ///< GPU as the driver names it
+    size_t array_bytes = 0;
+    size_t gpu_iterations = 0;
+    size_t cpu_threads = 0;
+    double gpu_alone_gbps = 0.0;
+    double cpu_alone_gbps = 0.0;
+    double gpu_shared_gbps = 0.0;   ///< GPU while the CPU threads stream
+    double cpu_shared_gbps = 0.0;   ///< CPU threads while the GPU kernel runs
+    bool verified = true;           ///< Both GPU runs left the expected values
+};
+
+/**
+ * @brief Share of its solo bandwidth a side keeps when shared, in percent (0 without a solo value)
+ */
+double retained_percent(double shared_gbps, double alone_gbps);
+
+}  // namespace GpuBandwidth
+
+#endif  // GPU_BANDWIDTH_H
@@ -0,0 +1,505 @@
+#include "io_tests.h"
+#include "aligned_buffer.h"
+#include "errors.h"
+#include "simd_kernels.h"
+
+#include <algorithm>
+#include <cerrno>
+#include <chrono>
+#include <cstdint>
+#include <cstdio>
+#include <cstring>
+#include <ctime>
+#include <memory>
+#include <sstream>
+
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <unistd.h>
+
+#ifdef __linux__
+#include <linux/io_uring.h>
+#include <sys/syscall.h>
+#include <sys/uio.h>
+#endif
+
+namespace IoTests {
+
+namespace {
+
+const std::vector<Method> ALL_METHODS = {Method::READ,  Method::PREAD,    Method::DIRECT,
+                                         Method::MMAP,  Method::IO_URING, Method::IO_URING_DIRECT};
+
+double thread_cpu_seconds() {
+    timespec ts = {};
+    clock_gettime(CLOCK_THREAD_CPUTIME_ID, &ts);
+    return ts.tv_sec + ts.tv_nsec * 1e-9;
+}
+
+std::string errno_text(const std::string& what) {
+    return what + ": " + std::strerror(errno);
+}
+
+Result unavailable(Method method, const Config& config, const std::string& note) {
+    Result result;
+    result.method = method;
+    result.block_size = config.block_size;
+    result.queue_depth = config.queue_depth;
+    result.note = note;
+    return result;
+}
+
+int open_for_reading(const std::string& path, bool direct) {
+    int flags = O_RDONLY | O_CLOEXEC;
+#ifdef O_DIRECT
+    if (direct) {
+        flags |= O_DIRECT;
+    }
+#endif
+    int fd = open(path.c_str(), flags);
+#if defined(__APPLE__)
+    if (fd >= 0 && direct) {
+        fcntl(fd, F_NOCACHE, 1);
+    }
+#endif
+    return fd;
+}
+
+/**
+ * @brief Synchronous paths: one block at a time into the same buffer
+ * @return Empty on success, otherwise why the path failed
+ */
+std::string read_blocks(Method method, int fd, const Config& config, uint8_t* buffer, size_t& blocks) {
+    size_t blocks_per_pass = config.file_size / config.block_size;
+    for (size_t pass = 0; pass < config.passes; ++pass) {
+        if (method == Method::READ && lseek(fd, 0, SEEK_SET) != 0) {
+            return errno_text("lseek");
+        }
+        for (size_t block = 0; block < blocks_per_pass; ++block) {
+            ssize_t got = (method == Method::READ)
+                              ? read(fd, buffer, config.block_size)
+                              : pread(fd, buffer, config.block_size, static_cast<off_t>(block * config.block_size));
+            if (got != static_cast<ssize_t>(config.block_size)) {
+                return got < 0 ? errno_text("read") : "short read";
+            }
+            ++blocks;
+        }
+    }
+    return "";
+}
+
+std::string read_mapped(int fd, const Config& config, size_t& blocks) {
+    void* mapping = mmap(nullptr, config.file_size, PROT_READ, MAP_SHARED, fd, 0);
+    if (mapping == MAP_FAILED) {
+        return errno_text("mmap");
+    }
+    madvise(mapping, config.file_size, MADV_SEQUENTIAL);
+
+    SimdKernels::ReadKernel read_kernel = SimdKernels::get_kernel_set(KernelType::AUTO).read;
+    volatile uint64_t sink = 0;
+    for (size_t pass = 0; pass < config.passes; ++pass) {
+        sink = sink + read_kernel(static_cast<const uint8_t*>(mapping), config.file_size);
+        ++blocks;
+    }
+    (void)sink;
+    munmap(mapping, config.file_size);
+    return "";
+}
+
+#ifdef __linux__
+/**
+ * @brief Minimal io_uring over the raw syscalls (no liburing dependency)
+ *
+ * One submission queue entry per in-flight read; completions are reaped
+ * and the slot resubmitted at the next offset until every block of every
+ * pass has been read.
+ */
+class Ring {
+public:
+    ~Ring() {
+        if (sqes_ != nullptr) munmap(sqes_, sqes_size_);
+        if (cq_ptr_ != nullptr && cq_ptr_ != sq_ptr_) munmap(cq_ptr_, cq_size_);
+        if (sq_ptr_ != nullptr) munmap(sq_ptr_, sq_size_);
+        if (fd_ >= 0) close(fd_);
+    }
+
+    std::string setup(unsigned entries) {
+        io_uring_params params = {};
+        fd_ = static_cast<int>(syscall(__NR_io_uring_setup, entries, &params));
+        if (fd_ < 0) {
+            return errno_text("io_uring_setup");
+        }
+
+        sq_size_ = params.sq_off.array + params.sq_entries * sizeof(unsigned);
+        cq_size_ = params.cq_off.cqes + params.cq_entries * sizeof(io_uring_cqe);
+        bool single_mmap = (params.features & IORING_FEAT_SINGLE_MMAP) != 0;
+        if (single_mmap) {
+            sq_size_ = cq_size_ = std::max(sq_size_, cq_size_);
+        }
+        sq_ptr_ = map(sq_size_, IORING_OFF_SQ_RING);
+        cq_ptr_ = single_mmap ? sq_ptr_ : map(cq_size_, IORING_OFF_CQ_RING);
+        sqes_size_ = params.sq_entries * sizeof(io_uring_sqe);
+        sqes_ = static_cast<io_uring_sqe*>(map(sqes_size_, IORING_OFF_SQES));
+        if (sq_ptr_ == nullptr || cq_ptr_ == nullptr || sqes_ == nullptr) {
+            return errno_text("io_uring mmap");
+        }
+
+        auto* sq = static_cast<uint8_t*>(sq_ptr_);
+        auto* cq = static_cast<uint8_t*>(cq_ptr_);
+        sq_tail_ = reinterpret_cast<unsigned*>(sq + params.sq_off.tail);
+        sq_mask_ = *reinterpret_cast<unsigned*>(sq + params.sq_off.ring_mask);
+        sq_array_ = reinterpret_cast<unsigned*>(sq + params.sq_off.array);
+        cq_head_ = reinterpret_cast<unsigned*>(cq + params.cq_off.head);
+        cq_tail_ = reinterpret_cast<unsigned*>(cq + params.cq_off.tail);
+        cq_mask_ = *reinterpret_cast<unsigned*>(cq + params.cq_off.ring_mask);
+        cqes_ = reinterpret_cast<io_uring_cqe*>(cq + params.cq_off.cqes);
+        return "";
+    }
+
+    bool register_buffers(const std::vector<iovec>& buffers) {
+        return syscall(__NR_io_uring_register, fd_, IORING_REGISTER_BUFFERS, buffers.data(),
+                       static_cast<unsigned>(buffers.size())) == 0;
+    }
+
+    bool register_file(int file_fd) {
+        return syscall(__NR_io_uring_register, fd_, IORING_REGISTER_FILES, &file_fd, 1u) == 0;
+    }
+
+    // Only written by this thread; the kernel reads the tail with acquire semantics
+    io_uring_sqe* next_sqe() {
+        unsigned tail = *sq_tail_ + pending_;
+        unsigned index = tail & sq_mask_;
+        sq_array_[index] = index;
+        ++pending_;
+        io_uring_sqe* sqe = &sqes_[index];
+        std::memset(sqe, 0, sizeof(*sqe));
+        return sqe;
+    }
+
+    // Publish pending entries and wait for at least one completion
+    bool submit_and_wait() {
+        __atomic_store_n(sq_tail_, *sq_tail_ + pending_, __ATOMIC_RELEASE);
+        unsigned to_submit = pending_;
+        pending_ = 0;
+        return syscall(__NR_io_uring_enter, fd_, to_submit, 1u, IORING_ENTER_GETEVENTS, nullptr, 0) >= 0;
+    }
+
+    // Completed entries since the last call: (user_data, result) pairs
+    template <typename Handler>
+    void reap(Handler handler) {
+        unsigned head = *cq_head_;
+        unsigned tail = __atomic_load_n(cq_tail_, __ATOMIC_ACQUIRE);
+        for (; head != tail; ++head) {
+            const io_uring_cqe& cqe = cqes_[head & cq_mask_];
+            handler(cqe.user_data, cqe.res);
+        }
+        __atomic_store_n(cq_head_, head, __ATOMIC_RELEASE);
+    }
+
+private:
+    void* map(size_t size, off_t offset) {
+        void* ptr = mmap(nullptr, size, PROT_READ | PROT_WRITE, MAP_SHARED | MAP_POPULATE, fd_, offset);
+        return ptr == MAP_FAILED ? nullptr : ptr;
+    }
+
+    int fd_ = -1;
+    void* sq_ptr_ = nullptr;
+    void* cq_ptr_ = nullptr;
+    io_uring_sqe* sqes_ = nullptr;
+    size_t sq_size_ = 0;
+    size_t cq_size_ = 0;
+    size_t sqes_size_ = 0;
+    unsigned* sq_tail_ = nullptr;
+    unsigned sq_mask_ = 0;
+    unsigned* sq_array_ = nullptr;
+    unsigned* cq_head_ = nullptr;
+    unsigned* cq_tail_ = nullptr;
+    unsigned cq_mask_ = 0;
+    io_uring_cqe* cqes_ = nullptr;
+    unsigned pending_ = 0;
+};
+#endif  // __linux__
+
+/**
+ * @brief io_uring path: queue_depth reads in flight, one registered buffer each
+ */
+std::string read_uring(int fd, const Config& config, uint8_t* buffers, size_t& blocks, std::string& note) {
+#ifdef __linux__
+    Ring ring;
+    std::string error = ring.setup(static_cast<unsigned>(config.queue_depth));
+    if (!error.empty()) {
+        return error;
+    }
+
+    std::vector<iovec> iovecs(config.queue_depth);
+    for (size_t slot = 0; slot < config.queue_depth; ++slot) {
+        iovecs[slot] = {buffers + slot * config.block_size, config.block_size};
+    }
+    // Registration pins the pages; RLIMIT_MEMLOCK can refuse it, plain READ still works
+    bool fixed_buffers = ring.register_buffers(iovecs);
+    bool fixed_file = ring.register_file(fd);
+    if (!fixed_buffers || !fixed_file) {
+        note = std::string(fixed_buffers ? "" : "buffers not registered") +
+               (!fixed_buffers && !fixed_file ? ", " : "") + (fixed_file ? "" : "file not registered");
+    }
+
+    size_t blocks_per_pass = config.file_size / config.block_size;
+    size_t total = blocks_per_pass * config.passes;
+    size_t submitted = 0;
+    size_t completed = 0;
+    int failure = 0;
+
+    auto submit = [&](size_t slot) {
+        io_uring_sqe* sqe = ring.next_sqe();
+        sqe->opcode = fixed_buffers ? IORING_OP_READ_FIXED : IORING_OP_READ;
+        sqe->fd = fixed_file ? 0 : fd;
+        sqe->flags = fixed_file ? IOSQE_FIXED_FILE : 0;
+        sqe->off = (submitted % blocks_per_pass) * config.block_size;
+        sqe->addr = reinterpret_cast<uint64_t>(iovecs[slot].iov_base);
+        sqe->len = static_cast<uint32_t>(config.block_size);
+        sqe->buf_index = static_cast<uint16_t>(slot);
+        sqe->user_data = slot;
+        ++submitted;
+    };
+
+    for (size_t slot = 0; slot < config.queue_depth && submitted < total; ++slot) {
+        submit(slot);
+    }
+    while (completed < total) {
+        if (!ring.submit_and_wait()) {
+            return errno_text("io_uring_enter");
+        }
+        ring.reap([&](uint64_t slot, int res) {
+            ++completed;
+            if (res != static_cast<int>(config.block_size)) {
+                failure = (res < 0) ? -res : EIO;
+            } else if (submitted < total) {
+                submit(static_cast<size_t>(slot));
+            }
+        });
+        if (failure != 0) {
+            return std::string("io_uring read: ") + std::strerror(failure);
+        }
+    }
+    blocks = completed;
+    return "";
+#else
+    (void)fd; (void)config; (void)buffers; (void)blocks; (void)note;
+    return "io_uring requires Linux";
+#endif
+}
+
+}  // namespace
+
+std::string method_to_string(Method method) {
+    switch (method) {
+        case Method::READ: return "read";
+        case Method::PREAD: return "pread";
+        case Method::DIRECT: return "direct";
+        case Method::MMAP: return "mmap";
+        case Method::IO_URING: return "io_uring";
+        case Method::IO_URING_DIRECT: return "io_uring_direct";
+    }
+    return "read";
+}
+
+std::vector<Method> parse_methods(const std::string& list) {
+    if (list == "all") {
+        return ALL_METHODS;
+    }
+
+    std::vector<Method> methods;
+    std::stringstream names(list);
+    std::string name;
+    while (std::getline(names, name, ',')) {
+        auto match = std::find_if(ALL_METHODS.begin(), ALL_METHODS.end(),
+                                  [&name](Method method) { return method_to_string(method) == name; });
+        if (match == ALL_METHODS.end()) {
+            throw ArgumentError("Invalid I/O method '" + name +
+                                "'. Valid methods: read, pread, direct, mmap, io_uring, io_uring_direct, all");
+        }
+        if (std::find(methods.begin(), methods.end(), *match) == methods.end()) {
+            methods.push_back(*match);
+        }
+    }
+    if (methods.empty()) {
+        throw ArgumentError("No I/O methods given");
+    }
+    return methods;
+}
+
+std::vector<size_t> parse_block_sizes(const std::string& list) {
+    std::vector<size_t> sizes;
+    std::stringstream items(list);
+    std::string item;
+    while (std::getline(items, item, ',')) {
+        size_t multiplier = 1;
+        std::string digits = item;
+        if (!digits.empty() && (digits.back() == 'k' || digits.back() == 'K')) {
+            multiplier = 1024;
+            digits.pop_back();
+        } else if (!digits.empty() && (digits.back() == 'm' || digits.back() == 'M')) {
+            multiplier = 1024 * 1024;
+            digits.pop_back();
+        }
+        if (digits.empty() || digits.find_first_not_of("0123456789") != std::string::npos) {
+            throw ArgumentError("Invalid block size '" + item + "'. Expected bytes with an optional k or m suffix");
+        }
+        size_t size = std::stoull(digits) * multiplier;
+        if (size == 0 || size % 4096 != 0 || size > 64 * 1024 * 1024) {
+            throw ArgumentError("Block size '" + item + "' must be a multiple of 4k up to 64m");
+        }
+        sizes.push_back(size);
+    }
+    if (sizes.empty()) {
+        throw ArgumentError("No block sizes given");
+    }
+    return sizes;
+}
+
+std::vector<size_t> parse_queue_depths(const std::string& list) {
+    std::vector<size_t> depths;
+    std::stringstream items(list);
+    std::string item;
+    while (std::getline(items, item, ',')) {
+        if (item.empty() || item.size() > 4 || item.find_first_not_of("0123456789") != std::string::npos ||
+            std::stoul(item) == 0 || std::stoul(item) > 4096) {
+            throw ArgumentError("Invalid queue depth '" + item + "'. Depths must be between 1 and 4096");
+        }
+        depths.push_back(std::stoul(item));
+    }
+    if (depths.empty()) {
+        throw ArgumentError("No queue depths given");
+    }
+    return depths;
+}
+
+bool uses_block_size(Method method) {
+    return method != Method::MMAP;
+}
+
+bool uses_queue_depth(Method method) {
+    return method == Method::IO_URING || method == Method::IO_URING_DIRECT;
+}
+
+std::string create_test_file(const std::string& directory, size_t size) {
+    std::string path_text = directory + "/memory_bandwidth_io.XXXXXX";
+    std::vector<char> path(path_text.begin(), path_text.end());
+    path.push_back('\0');
+    int fd = mkstemp(path.data());
+    if (fd < 0) {
+        throw BenchmarkError("Failed to create an I/O test file in " + directory + ": " + std::strerror(errno));
+    }
+
+    const size_t chunk_size = std::min<size_t>(size, 1 << 20);
+    AlignedBuffer chunk(chunk_size, 4096);
+    for (size_t written = 0; written < size;) {
+        size_t bytes = std::min(chunk_size, size - written);
+        ssize_t result = write(fd, chunk.data(), bytes);
+        if (result <= 0) {
+            int error = errno;
+            close(fd);
+            unlink(path.data());
+            throw BenchmarkError("Failed to write the I/O test file " + std::string(path.data()) + ": " +
+                                 std::strerror(error));
+        }
+        written += static_cast<size_t>(result);
+    }
+    fsync(fd);
+    close(fd);
+    return path.data();
+}
+
+void remove_test_file(const std::string& path) noexcept {
+    unlink(path.c_str());
+}
+
+double estimate_core_clock_ghz() {
+    // Eight dependent adds per iteration keep the chain, not the loop, the bottleneck.
+    // The step is opaque to the compiler and a register operand, which recent
+    // cores cannot fold at rename the way they fold add-immediate chains.
+    constexpr uint64_t ITERATIONS = 20'000'000;
+    double best_seconds = 0.0;
+    for (int attempt = 0; attempt < 3; ++attempt) {
+        uint64_t value = 0;
+        uint64_t step = 1;
+        __asm__ __volatile__("" : "+r"(step));
+        auto start = std::chrono::steady_clock::now();
+        for (uint64_t i = 0; i < ITERATIONS; ++i) {
+            for (int add = 0; add < 8; ++add) {
+                value += step;
+                __asm__ __volatile__("" : "+r"(value));
+            }
+        }
+        double seconds = std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count();
+        if (attempt == 0 || seconds < best_seconds) {
+            best_seconds = seconds;
+        }
+    }
+    return best_seconds > 0.0 ? (ITERATIONS * 8.0) / (best_seconds * 1e9) : 0.0;
+}
+
+Result run(Method method, const Config& config, double clock_ghz) {
+    if (config.file_size == 0 || (uses_block_size(method) && config.block_size == 0)) {
+        return unavailable(method, config, "empty file or zero block size");
+    }
+
+    bool direct = (method == Method::DIRECT || method == Method::IO_URING_DIRECT);
+    int fd = open_for_reading(config.path, direct);
+    if (fd < 0) {
+        // tmpfs and some FUSE file systems reject O_DIRECT with EINVAL
+        return unavailable(method, config, errno_text(direct ? "open with O_DIRECT" : "open"));
+    }
+
+    size_t depth = uses_queue_depth(method) ? std::max<size_t>(1, config.queue_depth) : 1;
+    Config effective = config;
+    effective.queue_depth = depth;
+    std::unique_ptr<AlignedBuffer> buffers;
+    if (method != Method::MMAP) {
+        buffers = std::make_unique<AlignedBuffer>(config.block_size * depth, config.alignment);
+    }
+
+    std::string note;
+    std::string error;
+    size_t blocks = 0;
+    double cpu_start = thread_cpu_seconds();
+    auto start = std::chrono::steady_clock::now();
+    switch (method) {
+        case Method::READ:
+        case Method::PREAD:
+        case Method::DIRECT:
+            error = read_blocks(method == Method::DIRECT ? Method::PREAD : method, fd, effective, buffers->data(),
+                                blocks);
+            break;
+        case Method::MMAP:
+            error = read_mapped(fd, effective, blocks);
+            break;
+        case Method::IO_URING:
+        case Method::IO_URING_DIRECT:
+            error = read_uring(fd, effective, buffers->data(), blocks, note);
+            break;
+    }
+    double seconds = std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count();
+    double cpu_seconds = thread_cpu_seconds() - cpu_start;
+    close(fd);
+
+    if (!error.empty()) {
+        return unavailable(method, effective, error);
+    }
+
+    Result result;
+    result.method = method;
+    result.block_size = uses_block_size(method) ? config.block_size : 0;
+    result.queue_depth = depth;
+    result.available = true;
+    result.note = note;
+    size_t bytes_per_pass = uses_block_size(method) ? (config.file_size / config.block_size) * config.block_size
+                                                    : config.file_size;
+    size_t bytes = bytes_per_pass * config.passes;
+    result.stats = calculate_stats(bytes, seconds, blocks);
+    result.cpu_seconds = cpu_seconds;
+    result.cycles_per_byte = bytes > 0 ? cpu_seconds * clock_ghz * 1e9 / bytes : 0.0;
+    return result;
+}
+
+}  // namespace IoTests
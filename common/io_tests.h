@@ -0,0 +1,127 @@
+#ifndef IO_TESTS_H
+#define IO_TESTS_H
+
+#include <cstddef>
+#include <string>
+#include <vector>
+
+#include "test_patterns.h"
+
+/**
+ * @brief I/O-path bandwidth tests over a file
+ *
+ * Reads the same file through each path a storage reader could use:
+ * buffered read(), pread() into a reused aligned buffer, O_DIRECT pread
+ * into an AlignedBuffer, a read kernel over an mmap of the file, and
+ * io_uring READ_FIXED with registered buffers and a fixed file at a given
+ * queue depth (buffered and O_DIRECT). Each result reports GB/s and the
+ * CPU cycles spent per byte, in user space and the kernel, so the copy and
+ * syscall cost of each path can be set against memory bandwidth.
+ */
+namespace IoTests {
+
+/**
+ * @brief Path the file is read through
+ */
+enum class Method {
+    READ,             ///< read() of consecutive blocks through the page cache
+    PREAD,            ///< pread() of each block into the same aligned buffer
+    DIRECT,           ///< pread() with O_DIRECT (F_NOCACHE on macOS): no page cache
+    MMAP,             ///< Sequential read kernel over a read-only shared mapping
+    IO_URING,         ///< io_uring READ_FIXED, registered buffers and fixed file, page cache
+    IO_URING_DIRECT   ///< As IO_URING, file opened with O_DIRECT
+};
+
+/**
+ * @brief Parameters of one measurement
+ */
+struct Config {
+    std::string path;          ///< File to read (created by create_test_file)
+    size_t file_size = 0;      ///< Bytes read per pass
+    size_t block_size = 0;     ///< Bytes per read call or submission (unused by MMAP)
+    size_t queue_depth = 1;    ///< Reads in flight (io_uring only; synchronous paths are always 1)
+    size_t passes = 1;         ///< Times the whole file is read
+    size_t alignment = 4096;   ///< Buffer alignment (O_DIRECT needs the logical block size)
+};
+
+/**
+ * @brief Outcome of one measurement
+ */
+struct Result {
+    Method method = Method::READ;
+    size_t block_size = 0;
+    size_t queue_depth = 1;
+    bool available = false;     ///< false: the path is unsupported here (reason in note)
+    std::string note;
+    PerformanceStats stats{0.0, 0.0, 0, 0.0};  ///< Bandwidth, latency per block, bytes and wall time
+    double cpu_seconds = 0.0;   ///< User plus system time of the reading thread
+    double cycles_per_byte = 0.0;  ///< cpu_seconds at the estimated core clock per byte read
+};
+
+/**
+ * @brief Command-line name ("read", "pread", "direct", "mmap", "io_uring", "io_uring_direct")
+ */
+std::string method_to_string(Method method);
+
+/**
+ * @brief Parse a comma-separated method list, or "all"
+ * @throws ArgumentError if a name is unknown or the list is empty
+ */
+std::vector<Method> parse_methods(const std::string& list);
+
+/**
+ * @brief Parse a comma-separated block size list ("4k,128k,1m")
+ *
+ * Sizes take an optional k or m suffix and must be multiples of 4 KB, so
+ * every block satisfies O_DIRECT alignment.
+ *
+ * @throws ArgumentError on a malformed or misaligned size
+ */
+std::vector<size_t> parse_block_sizes(const std::string& list);
+
+/**
+ * @brief Parse a comma-separated queue depth list ("1,8,32"), each 1-4096
+ * @throws ArgumentError on a malformed or out-of-range depth
+ */
+std::vector<size_t> parse_queue_depths(const std::string& list);
+
+/**
+ * @brief Whether block size and queue depth apply to a method
+ */
+bool uses_block_size(Method method);
+bool uses_queue_depth(Method method);
+
+/**
+ * @brief Create a file of the given size filled with the buffer test pattern
+ *
+ * The file is written and fsynced, so later buffered reads start with it
+ * in the page cache and O_DIRECT reads find it on the device.
+ *
+ * @param directory Directory to create the file in
+ * @return Path of the created file (remove with remove_test_file)
+ * @throws BenchmarkError if the file cannot be created or written
+ */
+std::string create_test_file(const std::string& directory, size_t size);
+void remove_test_file(const std::string& path) noexcept;
+
+/**
+ * @brief Estimate the core clock from a chain of dependent adds (one per cycle)
+ *
+ * Run once before the measurements; turns CPU time into cycles without the
+ * kernel-mode counter access perf_event_paranoid usually denies.
+ */
+double estimate_core_clock_ghz();
+
+/**
+ * @brief Read the file through one path
+ *
+ * Never throws for an unsupported path (no io_uring, file system without
+ * O_DIRECT): the result is returned with available false and a note.
+ *
+ * @param clock_ghz Core clock used to convert CPU time to cycles
+ */
+Result run(Method method, const Config& config, double clock_ghz);
+
+}  // namespace IoTests
+
+#endif  // IO_TESTS_H
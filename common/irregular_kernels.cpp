@@ -0,0 +1,411 @@
+#include "irregular_kernels.h"
+#include "errors.h"
+
+#include <algorithm>
+#include <cmath>
+#include <cstring>
+#include <limits>
+#include <utility>
+#include <vector>
+
+namespace IrregularKernels {
+
+namespace {
+
+constexpr size_t ALIGNMENT = 64;
+constexpr size_t CHUNK = BenchmarkConstants::SELL_CHUNK_ROWS;
+constexpr uint64_t GOLDEN = 0x9E3779B97F4A7C15ULL;
+constexpr size_t VERIFY_SAMPLES = 1024;
+
+// splitmix64 finalizer
+uint64_t mix64(uint64_t x) {
+    x ^= x >> 30;
+    x *= 0xBF58476D1CE4E5B9ULL;
+    x ^= x >> 27;
+    x *= 0x94D049BB133111EBULL;
+    x ^= x >> 31;
+    return x;
+}
+
+size_t fast_range(uint64_t value, size_t n) {
+    return static_cast<size_t>((static_cast<unsigned __int128>(value) * n) >> 64);
+}
+
+size_t align_up(size_t bytes) {
+    return (bytes + ALIGNMENT - 1) / ALIGNMENT * ALIGNMENT;
+}
+
+uint64_t row_key(const MatrixSpec& spec, size_t row) {
+    return mix64(spec.seed + row * GOLDEN);
+}
+
+// Integer-valued, so every product and sum of a row is exact
+double value_of(uint32_t column) {
+    return 1.0 + static_cast<double>(column & 1);
+}
+
+size_t parse_count(const std::string& text, size_t min, size_t max, const std::string& option) {
+    unsigned long value = 0;
+    bool valid = !text.empty() && text[0] != '-' && text[0] != '+';
+    if (valid) {
+        try {
+            size_t parsed = 0;
+            value = std::stoul(text, &parsed);
+            valid = parsed == text.size();
+        } catch (const std::exception&) {
+            valid = false;
+        }
+    }
+    if (!valid || value < min || value > max) {
+        throw ArgumentError("Invalid " + option + " '" + text + "'. Valid values: " + std::to_string(min) + "-" +
+                            std::to_string(max));
+    }
+    return static_cast<size_t>(value);
+}
+
+/**
+ * @brief Byte offsets of consecutive 64-byte aligned arrays
+ */
+struct Layout {
+    size_t offsets[6] = {};
+    size_t total = 0;
+
+    explicit Layout(std::initializer_list<size_t> sizes) {
+        size_t i = 0;
+        for (size_t size : sizes) {
+            offsets[i++] = total;
+            total += align_up(size);
+        }
+    }
+};
+
+Layout csr_layout(size_t rows, size_t nonzeros) {
+    return Layout({nonzeros * sizeof(double), rows * sizeof(double), rows * sizeof(double),
+                   nonzeros * sizeof(uint32_t), (rows + 1) * sizeof(uint32_t)});
+}
+
+Layout sell_layout(size_t rows, size_t chunks, size_t stored) {
+    return Layout({stored * sizeof(double), rows * sizeof(double), chunks * CHUNK * sizeof(double),
+                   stored * sizeof(uint32_t), (chunks + 1) * sizeof(uint32_t), chunks * CHUNK * sizeof(uint32_t)});
+}
+
+/**
+ * @brief Rows of one sort window ordered longest first (ties by row), padded with empty rows to whole chunks
+ */
+void sort_window(const MatrixSpec& spec, size_t first, std::vector<std::pair<size_t, size_t>>& order) {
+    size_t last = std::min(spec.rows, first + BenchmarkConstants::SELL_SORT_WINDOW);
+    order.clear();
+    for (size_t row = first; row < last; ++row) {
+        order.emplace_back(row_length(spec, row), row);
+    }
+    std::stable_sort(order.begin(), order.end(),
+                     [](const auto& a, const auto& b) { return a.first > b.first; });
+    // Only the last window can be partial; its padding rows write y past spec.rows
+    for (size_t pad = spec.rows; order.size() % CHUNK != 0; ++pad) {
+        order.emplace_back(0, pad);
+    }
+}
+
+// Entries of a SELL matrix including padding; rows is the only input the window order depends on
+size_t sell_stored(const MatrixSpec& spec) {
+    size_t stored = 0;
+    std::vector<std::pair<size_t, size_t>> order;
+    for (size_t first = 0; first < spec.rows; first += BenchmarkConstants::SELL_SORT_WINDOW) {
+        sort_window(spec, first, order);
+        for (size_t chunk = 0; chunk < order.size(); chunk += CHUNK) {
+            stored += order[chunk].first * CHUNK;
+        }
+    }
+    return stored;
+}
+
+size_t total_nonzeros(const MatrixSpec& spec) {
+    size_t nonzeros = 0;
+    for (size_t row = 0; row < spec.rows; ++row) {
+        nonzeros += row_length(spec, row);
+    }
+    return nonzeros;
+}
+
+}  // namespace
+
+Matrix parse_matrix(const std::string& name) {
+    if (name == "banded") {
+        return Matrix::BANDED;
+    }
+    if (name == "powerlaw") {
+        return Matrix::POWER_LAW;
+    }
+    throw ArgumentError("Unknown --matrix '" + name + "' (expected banded or powerlaw)");
+}
+
+std::string matrix_to_string(Matrix matrix) {
+    return matrix == Matrix::BANDED ? "banded" : "powerlaw";
+}
+
+size_t parse_row_nnz(const std::string& text) {
+    return parse_count(text, BenchmarkConstants::SPMV_MIN_ROW_NNZ, BenchmarkConstants::SPMV_MAX_ROW_NNZ, "--row-nnz");
+}
+
+size_t parse_block(const std::string& text) {
+    return parse_count(text, BenchmarkConstants::STENCIL_MIN_BLOCK, BenchmarkConstants::STENCIL_MAX_BLOCK,
+                       "--stencil-block");
+}
+
+size_t row_length(const MatrixSpec& spec, size_t row) {
+    if (spec.matrix == Matrix::BANDED) {
+        return std::min(spec.row_nnz, spec.rows);
+    }
+    // Pareto with shape 2 and scale row_nnz / 2: mean row_nnz, a few rows thousands long
+    double uniform = (static_cast<double>(row_key(spec, row) >> 11) + 1.0) * 0x1.0p-53;
+    double scale = std::max(1.0, static_cast<double>(spec.row_nnz) / 2.0);
+    double length = std::floor(scale / std::sqrt(uniform));
+    return std::min(spec.rows, static_cast<size_t>(std::max(1.0, std::min(length, static_cast<double>(spec.rows)))));
+}
+
+void row_columns(const MatrixSpec& spec, size_t row, uint32_t* columns) {
+    size_t length = row_length(spec, row);
+    if (spec.matrix == Matrix::BANDED) {
+        size_t first = (row + spec.rows - length / 2) % spec.rows;
+        for (size_t j = 0; j < length; ++j) {
+            columns[j] = static_cast<uint32_t>((first + j) % spec.rows);
+        }
+        return;
+    }
+    uint64_t key = row_key(spec, row);
+    for (size_t j = 0; j < length; ++j) {
+        columns[j] = static_cast<uint32_t>(fast_range(mix64(key + j + 1), spec.rows));
+    }
+    std::sort(columns, columns + length);
+}
+
+size_t spmv_bytes(size_t rows, size_t nonzeros) {
+    return nonzeros * (sizeof(double) + sizeof(uint32_t)) + rows * (sizeof(uint32_t) + 2 * sizeof(double));
+}
+
+Csr build_csr(uint8_t* base, size_t bytes, const Config& config, uint64_t seed) {
+    Csr matrix;
+    matrix.spec.matrix = config.matrix;
+    matrix.spec.row_nnz = config.row_nnz;
+    matrix.spec.seed = seed;
+
+    // 32-bit offsets and columns, as SpMV libraries use; powerlaw totals vary, so shrink until the matrix fits
+    size_t rows = bytes / (spmv_bytes(1, config.row_nnz) + sizeof(uint32_t));
+    rows = std::min<size_t>(rows, std::numeric_limits<uint32_t>::max() / config.row_nnz / 2);
+    for (; rows > 0; rows = rows * 15 / 16) {
+        matrix.spec.rows = rows;
+        matrix.nonzeros = total_nonzeros(matrix.spec);
+        if (matrix.nonzeros <= std::numeric_limits<uint32_t>::max() &&
+            csr_layout(rows, matrix.nonzeros).total <= bytes) {
+            break;
+        }
+    }
+    matrix.spec.rows = rows;
+    if (rows == 0) {
+        return matrix;
+    }
+
+    Layout layout = csr_layout(rows, matrix.nonzeros);
+    matrix.values = reinterpret_cast<double*>(base + layout.offsets[0]);
+    matrix.x = reinterpret_cast<double*>(base + layout.offsets[1]);
+    matrix.y = reinterpret_cast<double*>(base + layout.offsets[2]);
+    matrix.columns = reinterpret_cast<uint32_t*>(base + layout.offsets[3]);
+    matrix.row_ptr = reinterpret_cast<uint32_t*>(base + layout.offsets[4]);
+
+    size_t offset = 0;
+    for (size_t row = 0; row < rows; ++row) {
+        matrix.row_ptr[row] = static_cast<uint32_t>(offset);
+        row_columns(matrix.spec, row, matrix.columns + offset);
+        size_t end = offset + row_length(matrix.spec, row);
+        for (; offset < end; ++offset) {
+            matrix.values[offset] = value_of(matrix.columns[offset]);
+        }
+        matrix.x[row] = static_cast<double>(row);
+        matrix.y[row] = 0.0;
+    }
+    matrix.row_ptr[rows] = static_cast<uint32_t>(offset);
+    return matrix;
+}
+
+void spmv_csr(const Csr& matrix) {
+    const uint32_t* __restrict row_ptr = matrix.row_ptr;
+    const uint32_t* __restrict columns = matrix.columns;
+    const double* __restrict values = matrix.values;
+    const double* __restrict x = matrix.x;
+    double* __restrict y = matrix.y;
+    for (size_t row = 0; row < matrix.spec.rows; ++row) {
+        double sum = 0.0;
+        for (uint32_t p = row_ptr[row]; p < row_ptr[row + 1]; ++p) {
+            sum += values[p] * x[columns[p]];
+        }
+        y[row] = sum;
+    }
+}
+
+Sell build_sell(uint8_t* base, size_t bytes, const Config& config, uint64_t seed) {
+    Sell matrix;
+    matrix.spec.matrix = config.matrix;
+    matrix.spec.row_nnz = config.row_nnz;
+    matrix.spec.seed = seed;
+
+    // Estimated from CSR plus the permutation; padding is found by sorting, so shrink until the matrix fits
+    size_t rows = bytes / (spmv_bytes(1, config.row_nnz) + 2 * sizeof(uint32_t));
+    rows = std::min<size_t>(rows, std::numeric_limits<uint32_t>::max() / config.row_nnz / 2);
+    for (; rows > 0; rows = rows * 15 / 16) {
+        matrix.spec.rows = rows;
+        matrix.chunks = (rows + CHUNK - 1) / CHUNK;
+        matrix.stored = sell_stored(matrix.spec);
+        if (matrix.stored <= std::numeric_limits<uint32_t>::max() &&
+            sell_layout(rows, matrix.chunks, matrix.stored).total <= bytes) {
+            break;
+        }
+    }
+    matrix.spec.rows = rows;
+    if (rows == 0) {
+        return matrix;
+    }
+
+    Layout layout = sell_layout(rows, matrix.chunks, matrix.stored);
+    matrix.values = reinterpret_cast<double*>(base + layout.offsets[0]);
+    matrix.x = reinterpret_cast<double*>(base + layout.offsets[1]);
+    matrix.y = reinterpret_cast<double*>(base + layout.offsets[2]);
+    matrix.columns = reinterpret_cast<uint32_t*>(base + layout.offsets[3]);
+    matrix.chunk_ptr = reinterpret_cast<uint32_t*>(base + layout.offsets[4]);
+    matrix.permutation = reinterpret_cast<uint32_t*>(base + layout.offsets[5]);
+
+    std::vector<std::pair<size_t, size_t>> order;
+    std::vector<uint32_t> columns;
+    size_t chunk = 0;
+    size_t offset = 0;
+    for (size_t first = 0; first < rows; first += BenchmarkConstants::SELL_SORT_WINDOW) {
+        sort_window(matrix.spec, first, order);
+        for (size_t slot = 0; slot < order.size(); slot += CHUNK, ++chunk) {
+            size_t width = order[slot].first;
+            matrix.chunk_ptr[chunk] = static_cast<uint32_t>(offset);
+            for (size_t lane = 0; lane < CHUNK; ++lane) {
+                auto [length, row] = order[slot + lane];
+                matrix.permutation[chunk * CHUNK + lane] = static_cast<uint32_t>(row);
+                columns.resize(std::max(columns.size(), length));
+                if (length > 0) {
+                    row_columns(matrix.spec, row, columns.data());
+                }
+                for (size_t j = 0; j < width; ++j) {
+                    size_t entry = offset + j * CHUNK + lane;
+                    matrix.columns[entry] = j < length ? columns[j] : 0;
+                    matrix.values[entry] = j < length ? value_of(columns[j]) : 0.0;
+                }
+            }
+            offset += width * CHUNK;
+        }
+    }
+    matrix.chunk_ptr[matrix.chunks] = static_cast<uint32_t>(offset);
+    matrix.nonzeros = total_nonzeros(matrix.spec);
+    for (size_t row = 0; row < rows; ++row) {
+        matrix.x[row] = static_cast<double>(row);
+    }
+    std::fill(matrix.y, matrix.y + matrix.chunks * CHUNK, 0.0);
+    return matrix;
+}
+
+void spmv_sell(const Sell& matrix) {
+    const uint32_t* __restrict chunk_ptr = matrix.chunk_ptr;
+    const uint32_t* __restrict permutation = matrix.permutation;
+    const uint32_t* __restrict columns = matrix.columns;
+    const double* __restrict values = matrix.values;
+    const double* __restrict x = matrix.x;
+    double* __restrict y = matrix.y;
+    for (size_t chunk = 0; chunk < matrix.chunks; ++chunk) {
+        double sums[CHUNK] = {};
+        for (uint32_t entry = chunk_ptr[chunk]; entry < chunk_ptr[chunk + 1]; entry += CHUNK) {
+            for (size_t lane = 0; lane < CHUNK; ++lane) {
+                sums[lane] += values[entry + lane] * x[columns[entry + lane]];
+            }
+        }
+        for (size_t lane = 0; lane < CHUNK; ++lane) {
+            y[permutation[chunk * CHUNK + lane]] = sums[lane];
+        }
+    }
+}
+
+bool verify_spmv(const MatrixSpec& spec, const double* y) {
+    std::vector<uint32_t> columns;
+    for (size_t row = 0; row < spec.rows; ++row) {
+        size_t length = row_length(spec, row);
+        columns.resize(std::max(columns.size(), length));
+        row_columns(spec, row, columns.data());
+        double expected = 0.0;
+        for (size_t j = 0; j < length; ++j) {
+            expected += value_of(columns[j]) * static_cast<double>(columns[j]);
+        }
+        if (y[row] != expected) {
+            return false;
+        }
+    }
+    return true;
+}
+
+Grid build_grid(uint8_t* base, size_t bytes, uint64_t seed) {
+    Grid grid;
+    size_t points = bytes / 2 / sizeof(double);
+    size_t edge = static_cast<size_t>(std::cbrt(static_cast<double>(points)));
+    while (edge > 0 && 2 * align_up(edge * edge * edge * sizeof(double)) > bytes) {
+        --edge;
+    }
+    while (2 * align_up((edge + 1) * (edge + 1) * (edge + 1) * sizeof(double)) <= bytes) {
+        ++edge;
+    }
+    if (edge < 3) {
+        return grid;
+    }
+    grid.nx = grid.ny = grid.nz = edge;
+    size_t count = edge * edge * edge;
+    grid.in = reinterpret_cast<double*>(base);
+    grid.out = reinterpret_cast<double*>(base + align_up(count * sizeof(double)));
+    for (size_t p = 0; p < count; ++p) {
+        grid.in[p] = static_cast<double>(mix64(seed + p) >> 11) * 0x1.0p-53;
+    }
+    std::memcpy(grid.out, grid.in, count * sizeof(double));
+    return grid;
+}
+
+void stencil_pass(const double* in, double* out, size_t nx, size_t ny, size_t nz, size_t block) {
+    const double* __restrict src = in;
+    double* __restrict dst = out;
+    const size_t plane = nx * ny;
+    const size_t tile = block > 0 ? block : ny;
+    for (size_t j_first = 1; j_first < ny - 1; j_first += tile) {
+        size_t j_end = std::min(j_first + tile, ny - 1);
+        for (size_t k = 1; k < nz - 1; ++k) {
+            for (size_t j = j_first; j < j_end; ++j) {
+                size_t row = k * plane + j * nx;
+                for (size_t i = 1; i < nx - 1; ++i) {
+                    size_t p = row + i;
+                    dst[p] = STENCIL_CENTRE * src[p] +
+                             STENCIL_NEIGHBOUR * (src[p - 1] + src[p + 1] + src[p - nx] + src[p + nx] +
+                                                  src[p - plane] + src[p + plane]);
+                }
+            }
+        }
+    }
+}
+
+bool verify_stencil(const double* in, const double* out, size_t nx, size_t ny, size_t nz, uint64_t seed) {
+    const size_t plane = nx * ny;
+    for (size_t sample = 0; sample < VERIFY_SAMPLES; ++sample) {
+        uint64_t key = mix64(seed + sample * GOLDEN);
+        size_t i = 1 + fast_range(key, nx - 2);
+        size_t j = 1 + fast_range(mix64(key + 1), ny - 2);
+        size_t k = 1 + fast_range(mix64(key + 2), nz - 2);
+        size_t p = k * plane + j * nx + i;
+        double expected = STENCIL_CENTRE * in[p] +
+                          STENCIL_NEIGHBOUR * (in[p - 1] + in[p + 1] + in[p - nx] + in[p + nx] + in[p - plane] +
+                                               in[p + plane]);
+        // The sweep may be vectorized with fused multiply-adds
+        if (std::fabs(out[p] - expected) > 1e-12) {
+            return false;
+        }
+    }
+    return true;
+}
+
+}  // namespace IrregularKernels
@@ -0,0 +1,205 @@
+#ifndef IRREGULAR_KERNELS_H
+#define IRREGULAR_KERNELS_H
+
+#include <cstddef>
+#include <cstdint>
+#include <string>
+
+#include "constants.h"
+
+/**
+ * @brief Sparse matrix-vector products and a 3D stencil as memory benchmarks
+ *
+ * Graph ranking and simulation codes spend their time in these loops: a
+ * sparse matrix times a vector (SpMV), which streams the matrix and loads
+ * the vector at the column indices, and a 7-point stencil sweep, which
+ * streams a grid and reuses its neighbouring planes from cache. Each thread
+ * builds its own synthetic matrix or grid in its slice before timing.
+ * Bandwidth is effective: only the bytes the algorithm must move, so it can
+ * be read against the triad bandwidth of the same working set.
+ */
+namespace IrregularKernels {
+
+/**
+ * @brief Shape of the synthetic matrices
+ */
+enum class Matrix {
+    BANDED,    ///< row_nnz contiguous columns centred on the diagonal (wrapped at the edges)
+    POWER_LAW  ///< Pareto-distributed row lengths with uniform random columns, as in web and social graphs
+};
+
+/**
+ * @brief Parse --matrix: banded or powerlaw
+ * @throws ArgumentError on anything else
+ */
+Matrix parse_matrix(const std::string& name);
+
+/**
+ * @brief Matrix as passed to --matrix and reported in results
+ */
+std::string matrix_to_string(Matrix matrix);
+
+/**
+ * @brief Parse --row-nnz: nonzeros per row (the mean for powerlaw), SPMV_MIN_ROW_NNZ to SPMV_MAX_ROW_NNZ
+ * @throws ArgumentError if the value is malformed or out of range
+ */
+size_t parse_row_nnz(const std::string& text);
+
+/**
+ * @brief Parse --stencil-block: rows of a cache-blocking tile, STENCIL_MIN_BLOCK to STENCIL_MAX_BLOCK
+ * @throws ArgumentError if the value is malformed or out of range
+ */
+size_t parse_block(const std::string& text);
+
+/**
+ * @brief Settings of the irregular patterns
+ */
+struct Config {
+    Matrix matrix = Matrix::BANDED;
+    size_t row_nnz = BenchmarkConstants::SPMV_DEFAULT_ROW_NNZ;
+    size_t block = 0;  ///< Stencil tile rows (0: unblocked sweep)
+};
+
+/**
+ * @brief Work of one thread's passes, for the rates bandwidth does not give
+ */
+struct Work {
+    size_t flops = 0;     ///< Useful floating-point operations (2 per nonzero, 8 per stencil point)
+    size_t nonzeros = 0;  ///< Nonzeros multiplied
+    size_t stored = 0;    ///< Entries multiplied including SELL padding (nonzeros for CSR)
+};
+
+/// Flops of one nonzero (multiply and add) and of one stencil point (2 multiplies, 6 adds)
+constexpr size_t SPMV_FLOPS_PER_NONZERO = 2;
+constexpr size_t STENCIL_FLOPS_PER_POINT = 8;
+
+/**
+ * @brief The synthetic matrix of one slice: every row and column follows from it
+ */
+struct MatrixSpec {
+    Matrix matrix = Matrix::BANDED;
+    size_t rows = 0;     ///< Square: columns index the same range
+    size_t row_nnz = 0;
+    uint64_t seed = 0;
+};
+
+/**
+ * @brief Nonzeros of a row (row_nnz when banded; at least 1, at most rows)
+ */
+size_t row_length(const MatrixSpec& spec, size_t row);
+
+/**
+ * @brief Write the row_length(spec, row) column indices of a row, ascending for powerlaw
+ */
+void row_columns(const MatrixSpec& spec, size_t row, uint32_t* columns);
+
+/**
+ * @brief Effective bytes of one product: each nonzero's value and column once, and per row its pointer, x and y
+ */
+size_t spmv_bytes(size_t rows, size_t nonzeros);
+
+/**
+ * @brief Compressed sparse row matrix and its vectors, laid out over a byte range
+ *
+ * The values are 1 for even columns and 2 for odd ones and x[j] = j, so
+ * every y[i] is an exact integer that verify_spmv recomputes from the spec.
+ */
+struct Csr {
+    MatrixSpec spec;
+    size_t nonzeros = 0;
+    uint32_t* row_ptr = nullptr;  ///< rows + 1 offsets into columns and values
+    uint32_t* columns = nullptr;
+    double* values = nullptr;
+    double* x = nullptr;
+    double* y = nullptr;
+};
+
+/**
+ * @brief Build the largest matrix of config's shape that fits [base, base + bytes)
+ * @param base 64-byte aligned
+ * @return spec.rows 0 if the range is too small
+ */
+Csr build_csr(uint8_t* base, size_t bytes, const Config& config, uint64_t seed);
+
+/**
+ * @brief y = A x, one row at a time
+ */
+void spmv_csr(const Csr& matrix);
+
+/**
+ * @brief SELL-C-sigma matrix: rows sorted by length within windows of SELL_SORT_WINDOW, in chunks of SELL_CHUNK_ROWS
+ *
+ * Each chunk stores its rows column-major, padded to its longest row, so
+ * the C rows of a chunk advance together one entry at a time: a vector of
+ * C products per step, with gathers of x where the kernel has them.
+ */
+struct Sell {
+    MatrixSpec spec;
+    size_t nonzeros = 0;
+    size_t stored = 0;              ///< Entries including padding (value 0, column 0)
+    size_t chunks = 0;
+    uint32_t* chunk_ptr = nullptr;  ///< chunks + 1 offsets into columns and values; a chunk's width is its span / C
+    uint32_t* permutation = nullptr;///< Row of each sorted position (chunks * C, padding rows past spec.rows)
+    uint32_t* columns = nullptr;
+    double* values = nullptr;
+    double* x = nullptr;
+    double* y = nullptr;            ///< chunks * C entries, the padding rows' at the end
+};
+
+/**
+ * @brief Build the largest SELL matrix of config's shape that fits [base, base + bytes)
+ * @param base 64-byte aligned
+ * @return spec.rows 0 if the range is too small
+ */
+Sell build_sell(uint8_t* base, size_t bytes, const Config& config, uint64_t seed);
+
+/**
+ * @brief y = A x, one chunk at a time
+ */
+void spmv_sell(const Sell& matrix);
+
+/**
+ * @brief Whether y holds A x for the spec's matrix and x[j] = j
+ */
+bool verify_spmv(const MatrixSpec& spec, const double* y);
+
+/**
+ * @brief Two nx * ny * nz grids of doubles (x fastest), laid out over a byte range
+ */
+struct Grid {
+    double* in = nullptr;
+    double* out = nullptr;
+    size_t nx = 0;
+    size_t ny = 0;
+    size_t nz = 0;
+
+    size_t interior() const { return (nx - 2) * (ny - 2) * (nz - 2); }
+};
+
+/**
+ * @brief Largest cube pair that fits [base, base + bytes), both filled with the same pseudo-random field
+ *
+ * The boundary layer is never written, so it stays the same in both grids.
+ *
+ * @return nx 0 if the range is too small for one interior point
+ */
+Grid build_grid(uint8_t* base, size_t bytes, uint64_t seed);
+
+/// Centre and neighbour weights: they sum to 1, so the field stays bounded over any number of sweeps
+constexpr double STENCIL_CENTRE = 0.25;
+constexpr double STENCIL_NEIGHBOUR = 0.125;
+
+/**
+ * @brief One Jacobi sweep of the 7-point stencil from in to out over the interior
+ * @param block Tile rows in y, swept plane by plane so three planes of a tile stay cached (0: whole planes)
+ */
+void stencil_pass(const double* in, double* out, size_t nx, size_t ny, size_t nz, size_t block);
+
+/**
+ * @brief Whether pseudo-randomly sampled interior points of out hold one sweep of in
+ */
+bool verify_stencil(const double* in, const double* out, size_t nx, size_t ny, size_t nz, uint64_t seed);
+
+}  // namespace IrregularKernels
+
+#endif  // IRREGULAR_KERNELS_H
@@ -0,0 +1,238 @@
+#include "json.h"
+#include "errors.h"
+
+#include <cmath>
+#include <cstdio>
+#include <cstdlib>
+
+namespace Json {
+
+namespace {
+
+class Parser {
+  public:
+    explicit Parser(const std::string& text) : text_(text) {}
+
+    Value document() {
+        Value value = parse_value();
+        skip_whitespace();
+        if (pos_ != text_.size()) {
+            fail("trailing characters");
+        }
+        return value;
+    }
+
+  private:
+    const std::string& text_;
+    size_t pos_ = 0;
+
+    [[noreturn]] void fail(const std::string& what) const {
+        throw ConfigurationError("Malformed JSON at byte " + std::to_string(pos_) + ": " + what);
+    }
+
+    void skip_whitespace() {
+        while (pos_ < text_.size() &&
+               (text_[pos_] == ' ' || text_[pos_] == '\t' || text_[pos_] == '\n' || text_[pos_] == '\r')) {
+            ++pos_;
+        }
+    }
+
+    bool consume(const char* word) {
+        size_t length = std::char_traits<char>::length(word);
+        if (text_.compare(pos_, length, word) == 0) {
+            pos_ += length;
+            return true;
+        }
+        return false;
+    }
+
+    void expect(char c) {
+        skip_whitespace();
+        if (pos_ >= text_.size() || text_[pos_] != c) {
+            fail(std::string("expected '") + c + "'");
+        }
+        ++pos_;
+    }
+
+    // Consume the comma before another member or element
+    bool next_element() {
+        skip_whitespace();
+        if (pos_ < text_.size() && text_[pos_] == ',') {
+            ++pos_;
+            return true;
+        }
+        return false;
+    }
+
+    Value parse_value() {
+        skip_whitespace();
+        if (pos_ >= text_.size()) {
+            fail("unexpected end of input");
+        }
+        Value value;
+        char c = text_[pos_];
+        if (c == '{') {
+            value.type = Value::Type::OBJECT;
+            ++pos_;
+            skip_whitespace();
+            if (pos_ < text_.size() && text_[pos_] == '}') {
+                ++pos_;
+                return value;
+            }
+            do {
+                skip_whitespace();
+                std::string key = parse_string();
+                expect(':');
+                value.members.emplace_back(key, parse_value());
+            } while (next_element());
+            expect('}');
+        } else if (c == '[') {
+            value.type = Value::Type::ARRAY;
+            ++pos_;
+            skip_whitespace();
+            if (pos_ < text_.size() && text_[pos_] == ']') {
+                ++pos_;
+                return value;
+            }
+            do {
+                value.items.push_back(parse_value());
+            } while (next_element());
+            expect(']');
+        } else if (c == '"') {
+            value.type = Value::Type::STRING;
+            value.string = parse_string();
+        } else if (consume("true")) {
+            value.type = Value::Type::BOOL;
+            value.boolean = true;
+        } else if (consume("false")) {
+            value.type = Value::Type::BOOL;
+        } else if (consume("null")) {
+            value.type = Value::Type::NULL_VALUE;
+        } else {
+            const char* start = text_.c_str() + pos_;
+            char* end = nullptr;
+            value.type = Value::Type::NUMBER;
+            value.number = std::strtod(start, &end);
+            if (end == start || !std::isfinite(value.number)) {
+                fail("expected a value");
+            }
+            pos_ += static_cast<size_t>(end - start);
+        }
+        return value;
+    }
+
+    std::string parse_string() {
+        if (pos_ >= text_.size() || text_[pos_] != '"') {
+            fail("expected a string");
+        }
+        ++pos_;
+        std::string result;
+        while (pos_ < text_.size() && text_[pos_] != '"') {
+            char c = text_[pos_++];
+            if (c != '\\') {
+                result += c;
+                continue;
+            }
+            if (pos_ >= text_.size()) {
+                break;
+            }
+            char escaped = text_[pos_++];
+            switch (escaped) {
+                case 'n': result += '\n'; break;
+                case 'r': result += '\r'; break;
+                case 't': result += '\t'; break;
+                case 'b': result += '\b'; break;
+                case 'f': result += '\f'; break;
+                case 'u': {
+                    if (pos_ + 4 > text_.size()) {
+                        fail("truncated \\u escape");
+                    }
+                    unsigned long code = std::strtoul(text_.substr(pos_, 4).c_str(), nullptr, 16);
+                    result += code < 0x80 ? static_cast<char>(code) : '?';
+                    pos_ += 4;
+                    break;
+                }
+                default: result += escaped; break;  // \" \\ \/
+            }
+        }
+        if (pos_ >= text_.size()) {
+            fail("unterminated string");
+        }
+        ++pos_;
+        return result;
+    }
+};
+
+}  // namespace
+
+std::string quote(const std::string& text) {
+    std::string quoted = "\"";
+    for (char c : text) {
+        switch (c) {
+            case '"': quoted += "\\\""; break;
+            case '\\': quoted += "\\\\"; break;
+            case '\n': quoted += "\\n"; break;
+            case '\r': quoted += "\\r"; break;
+            case '\t': quoted += "\\t"; break;
+            default:
+                if (static_cast<unsigned char>(c) < 0x20) {
+                    char escaped[8];
+                    std::snprintf(escaped, sizeof(escaped), "\\u%04x", static_cast<unsigned>(c));
+                    quoted += escaped;
+                } else {
+                    quoted += c;
+                }
+        }
+    }
+    return quoted + "\"";
+}
+
+std::string number(double value) {
+    if (!std::isfinite(value)) {
+        return "null";
+    }
+    char text[32];
+    std::snprintf(text, sizeof(text), "%.10g", value);
+    return text;
+}
+
+Object& Object::add_raw(const std::string& key, const std::string& json) {
+    if (!text_.empty()) {
+        text_ += ",";
+    }
+    text_ += quote(key) + ":" + json;
+    return *this;
+}
+
+std::string array(const std::vector<std::string>& values) {
+    std::string json = "[";
+    for (size_t i = 0; i < values.size(); ++i) {
+        json += (i > 0 ? "," : "") + values[i];
+    }
+    return json + "]";
+}
+
+const Value* Value::find(const std::string& key) const {
+    for (const auto& member : members) {
+        if (member.first == key) {
+            return &member.second;
+        }
+    }
+    return nullptr;
+}
+
+std::string Value::get_string(const std::string& key, const std::string& fallback) const {
+    const Value* value = find(key);
+    return value && value->type == Type::STRING ? value->string : fallback;
+}
+
+double Value::get_number(const std::string& key, double fallback) const {
+    const Value* value = find(key);
+    return value && value->type == Type::NUMBER ? value->number : fallback;
+}
+
+Value parse(const std::string& text) {
+    return Parser(text).document();
+}
+
+}  // namespace Json
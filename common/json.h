@@ -0,0 +1,86 @@
+#ifndef JSON_H
+#define JSON_H
+
+#include <cstddef>
+#include <cstdint>
+#include <string>
+#include <utility>
+#include <vector>
+
+/**
+ * @brief Minimal JSON writing and reading for files the tool reads back
+ *
+ * The report formats are written for people and concatenate their JSON by
+ * hand. Records and baselines are written for programs, so their strings
+ * are escaped and their numbers kept finite here, and baselines are read
+ * back with the small parser below (objects, arrays, strings, numbers,
+ * booleans and null; \u escapes outside ASCII are kept as '?').
+ */
+namespace Json {
+
+/**
+ * @brief String as a quoted, escaped JSON string
+ */
+std::string quote(const std::string& text);
+
+/**
+ * @brief Number with ten significant digits; null for NaN and infinity, which JSON lacks
+ */
+std::string number(double value);
+
+/**
+ * @brief Single-line object builder; keys are kept in insertion order
+ */
+class Object {
+  public:
+    Object& add_string(const std::string& key, const std::string& value) { return add_raw(key, quote(value)); }
+    Object& add_number(const std::string& key, double value) { return add_raw(key, number(value)); }
+    Object& add_count(const std::string& key, uint64_t value) { return add_raw(key, std::to_string(value)); }
+    Object& add_bool(const std::string& key, bool value) { return add_raw(key, value ? "true" : "false"); }
+    Object& add_raw(const std::string& key, const std::string& json);
+
+    std::string str() const { return "{" + text_ + "}"; }
+
+  private:
+    std::string text_;
+};
+
+/**
+ * @brief Comma-separated JSON values in brackets
+ */
+std::string array(const std::vector<std::string>& values);
+
+/**
+ * @brief Parsed JSON value
+ */
+struct Value {
+    enum class Type { NULL_VALUE, BOOL, NUMBER, STRING, ARRAY, OBJECT };
+
+    Type type = Type::NULL_VALUE;
+    bool boolean = false;
+    double number = 0.0;
+    std::string string;
+    std::vector<Value> items;                            ///< Elements of an array
+    std::vector<std::pair<std::string, Value>> members;  ///< Members of an object, in file order
+
+    /**
+     * @brief Member of an object (nullptr if absent or not an object)
+     */
+    const Value* find(const std::string& key) const;
+
+    /**
+     * @brief Member as a string or number, or the fallback if absent or of another type
+     */
+    std::string get_string(const std::string& key, const std::string& fallback = "") const;
+    double get_number(const std::string& key, double fallback = 0.0) const;
+};
+
+/**
+ * @brief Parse one JSON document
+ * @throws ConfigurationError on malformed input, with the byte offset of the error
+ */
+Value parse(const std::string& text);
+
+}  // namespace Json
+
+#endif  // JSON_H
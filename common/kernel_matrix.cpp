@@ -0,0 +1,262 @@
+#include "kernel_matrix.h"
+#include "errors.h"
+
+#include <cstdio>
+#include <cstring>
+#include <type_traits>
+
+// Each kernel moves exactly the elements its shape names: the compiler must
+// not re-vectorize the narrow ones, and must unroll the element loop fully
+#if defined(__clang__)
+#define SHAPE_KERNEL
+#define SHAPE_LOOP _Pragma("clang loop vectorize(disable) interleave(disable)")
+#define SHAPE_UNROLL _Pragma("unroll")
+#elif defined(__GNUC__)
+#define SHAPE_KERNEL __attribute__((optimize("no-tree-vectorize")))
+#define SHAPE_LOOP
+#define SHAPE_UNROLL _Pragma("GCC unroll 8")
+#else
+#define SHAPE_KERNEL
+#define SHAPE_LOOP
+#define SHAPE_UNROLL
+#endif
+
+namespace KernelMatrix {
+
+namespace {
+
+// Generic vector of W bytes; single-lane for 4- and 8-byte elements
+template <typename Lane, size_t W>
+struct Vector {
+    typedef Lane type __attribute__((vector_size(W)));
+};
+
+// 4-byte elements are 32-bit words; wider ones are 64-bit lanes
+template <size_t W>
+using Lane = typename std::conditional<W == 4, uint32_t, uint64_t>::type;
+
+template <typename V>
+SHAPE_KERNEL inline V load(const void* address) {
+    V value;
+    std::memcpy(&value, address, sizeof(V));
+    return value;
+}
+
+template <typename V>
+SHAPE_KERNEL inline void store(void* address, const V& value) {
+    std::memcpy(address, &value, sizeof(V));
+}
+
+template <size_t W, size_t U, size_t A>
+SHAPE_KERNEL uint64_t read_shape(const uint8_t* data, size_t bytes) {
+    using L = Lane<W>;
+    using V = typename Vector<L, W>::type;
+    V sums[A] = {};
+    size_t i = 0;
+    SHAPE_LOOP
+    for (; i + U * W <= bytes; i += U * W) {
+        SHAPE_UNROLL
+        for (size_t u = 0; u < U; ++u) {
+            sums[u % A] += load<V>(data + i + u * W);
+        }
+    }
+    SHAPE_LOOP
+    for (; i + W <= bytes; i += W) {
+        sums[0] += load<V>(data + i);
+    }
+    L sum = 0;
+    for (size_t a = 0; a < A; ++a) {
+        for (size_t lane = 0; lane < W / sizeof(L); ++lane) {
+            sum += sums[a][lane];
+        }
+    }
+    SHAPE_LOOP
+    for (; i + sizeof(L) <= bytes; i += sizeof(L)) {
+        sum += load<L>(data + i);
+    }
+    return sum;
+}
+
+template <size_t W, size_t U>
+SHAPE_KERNEL void write_shape(uint8_t* data, size_t bytes, uint64_t pattern) {
+    using L = Lane<W>;
+    using V = typename Vector<L, W>::type;
+    // 4-byte elements alternate the pattern's low and high halves, as memory holds them
+    L halves[2] = {};
+    std::memcpy(halves, &pattern, sizeof(pattern));
+    const V even = V{} + static_cast<L>(W == 4 ? halves[0] : pattern);
+    const V odd = V{} + static_cast<L>(W == 4 ? halves[1] : pattern);
+    size_t i = 0;
+    SHAPE_LOOP
+    for (; i + U * W <= bytes; i += U * W) {
+        SHAPE_UNROLL
+        for (size_t u = 0; u < U; ++u) {
+            if constexpr (W == 4 && U % 2 == 1) {
+                store(data + i + u * W, ((i + u * W) & 4) ? odd : even);
+            } else {
+                store(data + i + u * W, (u % 2 == 1) ? odd : even);
+            }
+        }
+    }
+    SHAPE_LOOP
+    for (; i + W <= bytes; i += W) {
+        store(data + i, (i & 4) ? odd : even);
+    }
+    SHAPE_LOOP
+    for (; i + sizeof(uint64_t) <= bytes; i += sizeof(uint64_t)) {
+        store(data + i, pattern);
+    }
+}
+
+template <size_t W, size_t U>
+SHAPE_KERNEL void triad_shape(double* a, const double* b, const double* c, double scalar, size_t count) {
+    using V = typename Vector<double, W>::type;
+    constexpr size_t N = W / sizeof(double);
+    const V s = V{} + scalar;
+    size_t i = 0;
+    SHAPE_LOOP
+    for (; i + U * N <= count; i += U * N) {
+        SHAPE_UNROLL
+        for (size_t u = 0; u < U; ++u) {
+            store(a + i + u * N, load<V>(b + i + u * N) + s * load<V>(c + i + u * N));
+        }
+    }
+    SHAPE_LOOP
+    for (; i + N <= count; i += N) {
+        store(a + i, load<V>(b + i) + s * load<V>(c + i));
+    }
+    SHAPE_LOOP
+    for (; i < count; ++i) {
+        a[i] = b[i] + scalar * c[i];
+    }
+}
+
+template <size_t W, size_t U, size_t A>
+void add_read(std::vector<Kernel>& table) {
+    if constexpr (U % A == 0) {
+        Kernel kernel;
+        kernel.family = Family::READ;
+        kernel.shape = {W, U, A};
+        kernel.read = read_shape<W, U, A>;
+        table.push_back(kernel);
+    }
+}
+
+template <size_t W, size_t U>
+void add_unroll(std::vector<Kernel>& table) {
+    add_read<W, U, 1>(table);
+    add_read<W, U, 2>(table);
+    add_read<W, U, 4>(table);
+    add_read<W, U, 8>(table);
+
+    Kernel write;
+    write.family = Family::WRITE;
+    write.shape = {W, U, 1};
+    write.write = write_shape<W, U>;
+    table.push_back(write);
+
+    if constexpr (W >= sizeof(double)) {
+        Kernel triad;
+        triad.family = Family::TRIAD;
+        triad.shape = {W, U, 1};
+        triad.triad = triad_shape<W, U>;
+        table.push_back(triad);
+    }
+}
+
+template <size_t W>
+void add_width(std::vector<Kernel>& table) {
+    add_unroll<W, 1>(table);
+    add_unroll<W, 2>(table);
+    add_unroll<W, 4>(table);
+    add_unroll<W, 8>(table);
+}
+
+}  // namespace
+
+std::string family_to_string(Family family) {
+    switch (family) {
+        case Family::READ: return "read";
+        case Family::WRITE: return "write";
+        case Family::TRIAD: return "triad";
+    }
+    return "unknown";
+}
+
+std::string shape_to_string(const Shape& shape) {
+    return "w" + std::to_string(shape.element_bytes) + "u" + std::to_string(shape.unroll) + "a" +
+           std::to_string(shape.accumulators);
+}
+
+Shape parse_shape(const std::string& text) {
+    Shape shape;
+    int consumed = 0;
+    if (std::sscanf(text.c_str(), "w%zuu%zua%zu%n", &shape.element_bytes, &shape.unroll, &shape.accumulators,
+                    &consumed) != 3 ||
+        static_cast<size_t>(consumed) != text.size() || shape.element_bytes == 0) {
+        throw ConfigurationError("Invalid kernel shape '" + text + "'. Expected w<bytes>u<unroll>a<accumulators>, "
+                                 "e.g. w32u4a2");
+    }
+    return shape;
+}
+
+const std::vector<Kernel>& all() {
+    static const std::vector<Kernel> table = [] {
+        std::vector<Kernel> kernels;
+        add_width<4>(kernels);
+        add_width<8>(kernels);
+        add_width<16>(kernels);
+        add_width<32>(kernels);
+        add_width<64>(kernels);
+        return kernels;
+    }();
+    return table;
+}
+
+std::vector<Shape> shapes(Family family) {
+    std::vector<Shape> found;
+    for (const auto& kernel : all()) {
+        if (kernel.family == family) {
+            found.push_back(kernel.shape);
+        }
+    }
+    return found;
+}
+
+const Kernel* find(Family family, const Shape& shape) {
+    for (const auto& kernel : all()) {
+        if (kernel.family == family && kernel.shape == shape) {
+            return &kernel;
+        }
+    }
+    return nullptr;
+}
+
+uint64_t reference_read(size_t element_bytes, const uint8_t* data, size_t bytes) {
+    if (element_bytes == 4) {
+        uint32_t sum = 0;
+        for (size_t i = 0; i + sizeof(uint32_t) <= bytes; i += sizeof(uint32_t)) {
+            uint32_t word;
+            std::memcpy(&word, data + i, sizeof(word));
+            sum += word;
+        }
+        return sum;
+    }
+    uint64_t sum = 0;
+    for (size_t i = 0; i + sizeof(uint64_t) <= bytes; i += sizeof(uint64_t)) {
+        uint64_t word;
+        std::memcpy(&word, data + i, sizeof(word));
+        sum += word;
+    }
+    return sum;
+}
+
+std::string working_set_level(const CacheInfo& cache_info, size_t footprint_bytes, size_t num_threads) {
+    size_t per_thread = footprint_bytes / (num_threads > 0 ? num_threads : 1);
+    if (cache_info.l1_data_size > 0 && per_thread <= cache_info.l1_data_size) return "L1";
+    if (cache_info.l2_size > 0 && per_thread <= cache_info.l2_size) return "L2";
+    if (cache_info.l3_size > 0 && footprint_bytes <= cache_info.l3_size) return "L3";
+    return "DRAM";
+}
+
+}  // namespace KernelMatrix
@@ -0,0 +1,116 @@
+#ifndef KERNEL_MATRIX_H
+#define KERNEL_MATRIX_H
+
+#include <cstddef>
+#include <cstdint>
+#include <string>
+#include <vector>
+
+#include "memory_types.h"
+#include "simd_kernels.h"
+
+/**
+ * @brief Read, write and triad loops instantiated over every loop shape (--tune)
+ *
+ * The SimdKernels loops have one shape per instruction set: four vectors of
+ * the widest width into four accumulators. Which shape is fastest depends on
+ * the core and on the level the working set lives in: L1 wants enough
+ * independent adds to hide their latency, DRAM enough loads in flight, and
+ * some cores split their widest vectors. Each kernel here is compiled from
+ * one template for an element width (4 to 64 bytes; the compiler splits
+ * widths wider than the build's vectors), an unroll factor and, for the
+ * reductions, a number of independent accumulators. --tune measures every
+ * shape at every level and stores the fastest with the host's calibrated
+ * peak; later runs with the automatic kernel run the tuned shapes.
+ */
+namespace KernelMatrix {
+
+/**
+ * @brief Kernel families with a tuned shape
+ */
+enum class Family {
+    READ,   ///< sequential_read: a checksum over the range
+    WRITE,  ///< sequential_write with temporal stores
+    TRIAD   ///< triad with temporal stores
+};
+
+std::string family_to_string(Family family);
+
+/**
+ * @brief Loop shape of one instantiation
+ */
+struct Shape {
+    size_t element_bytes = 0;  ///< Bytes per load or store: 4, 8, 16, 32 or 64 (0: no shape)
+    size_t unroll = 0;         ///< Elements per loop iteration
+    size_t accumulators = 0;   ///< Independent sums of a read (1 for write and triad: nothing is carried)
+
+    bool valid() const { return element_bytes != 0; }
+    bool operator==(const Shape& other) const {
+        return element_bytes == other.element_bytes && unroll == other.unroll && accumulators == other.accumulators;
+    }
+};
+
+/**
+ * @brief Shape as stored and reported: w<element bytes>u<unroll>a<accumulators>, e.g. w32u4a2
+ */
+std::string shape_to_string(const Shape& shape);
+
+/**
+ * @brief Parse shape_to_string's form
+ * @throws ConfigurationError if the text is malformed
+ */
+Shape parse_shape(const std::string& text);
+
+/**
+ * @brief One instantiation; only the pointer of its family is set
+ *
+ * Read and write ranges are multiples of 8 bytes starting 8-byte aligned.
+ * A read returns the sum of the range's 64-bit words modulo 2^64, or of its
+ * 32-bit words modulo 2^32 for 4-byte elements (see reference_read). A
+ * write leaves the range filled with the 64-bit pattern whatever the width.
+ */
+struct Kernel {
+    Family family = Family::READ;
+    Shape shape;
+    SimdKernels::ReadKernel read = nullptr;
+    SimdKernels::WriteKernel write = nullptr;
+    SimdKernels::TriadKernel triad = nullptr;
+};
+
+/**
+ * @brief Every instantiation, by family, element width, unroll and accumulators
+ *
+ * Unrolls are 1, 2, 4 and 8; reads take 1, 2, 4 or 8 accumulators dividing
+ * the unroll. Triad runs on doubles, so its elements are 8 bytes or wider.
+ */
+const std::vector<Kernel>& all();
+
+/**
+ * @brief Shapes of a family, in all() order
+ */
+std::vector<Shape> shapes(Family family);
+
+/**
+ * @brief Instantiation of a shape (nullptr if the family has none)
+ */
+const Kernel* find(Family family, const Shape& shape);
+
+/**
+ * @brief Checksum a read kernel of element_bytes returns over the range, from plain scalar loads
+ */
+uint64_t reference_read(size_t element_bytes, const uint8_t* data, size_t bytes);
+
+/**
+ * @brief Level a pattern's arrays live in: "L1", "L2", "L3" or "DRAM"
+ *
+ * Each thread's share is held against the private L1 and L2, the whole
+ * footprint against the shared L3.
+ *
+ * @param footprint_bytes Bytes of every array of the pattern
+ * @param num_threads Threads the arrays are split over
+ */
+std::string working_set_level(const CacheInfo& cache_info, size_t footprint_bytes, size_t num_threads);
+
+}  // namespace KernelMatrix
+
+#endif  // KERNEL_MATRIX_H
@@ -0,0 +1,290 @@
+#include "mapping_tests.h"
+#include "constants.h"
+#include "errors.h"
+#include "worker_pool.h"
+
+#include <algorithm>
+#include <atomic>
+#include <cerrno>
+#include <chrono>
+#include <cstring>
+#include <sstream>
+#include <thread>
+#include <sys/mman.h>
+#include <sys/resource.h>
+#include <unistd.h>
+
+// Older C library headers lack it; the kernel reports EINVAL before 6.1
+#if defined(__linux__) && !defined(MADV_COLLAPSE)
+#define MADV_COLLAPSE 25
+#endif
+
+namespace MappingTests {
+
+namespace {
+
+using Clock = std::chrono::steady_clock;
+
+// One repetition
+struct Sample {
+    double seconds = 0.0;
+    uint64_t minor_faults = 0;
+    size_t calls = 0;
+    bool available = true;
+    std::string note;
+};
+
+uint64_t minor_faults() {
+    struct rusage usage;
+    getrusage(RUSAGE_SELF, &usage);
+    return static_cast<uint64_t>(usage.ru_minflt);
+}
+
+size_t round_up(size_t value, size_t granule) {
+    return (value + granule - 1) / granule * granule;
+}
+
+// Anonymous mapping aligned on a huge page, so THP and partial unmaps start at a 2 MB boundary
+uint8_t* map_aligned(size_t bytes, int extra_flags) {
+    const size_t huge = BenchmarkConstants::MAPPING_HUGE_PAGE;
+    void* raw = mmap(nullptr, bytes + huge, PROT_READ | PROT_WRITE, MAP_PRIVATE | MAP_ANONYMOUS | extra_flags, -1, 0);
+    if (raw == MAP_FAILED) {
+        throw MemoryError("mmap of " + std::to_string(bytes) + " bytes failed: " + std::strerror(errno));
+    }
+    uintptr_t start = reinterpret_cast<uintptr_t>(raw);
+    uintptr_t aligned = round_up(start, huge);
+    if (aligned > start) {
+        munmap(raw, aligned - start);
+    }
+    size_t tail = (start + bytes + huge) - (aligned + bytes);
+    if (tail > 0) {
+        munmap(reinterpret_cast<void*>(aligned + bytes), tail);
+    }
+    return reinterpret_cast<uint8_t*>(aligned);
+}
+
+void touch(uint8_t* begin, uint8_t* end, size_t page) {
+    volatile uint8_t* p = begin;
+    for (; p < end; p += page) {
+        *p = 1;
+    }
+}
+
+// Threads touch their slices; thread 0 then times the operation while the others stay runnable
+Sample measure_threaded(Operation op, size_t bytes, const std::vector<size_t>& cpus,
+                        const CoherenceTests::PinFunction& pin) {
+    const size_t page = page_bytes();
+    const size_t num_threads = cpus.size();
+    const size_t pages = bytes / page;
+    uint8_t* region = map_aligned(bytes, 0);
+
+    SpinBarrier barrier(num_threads);
+    std::atomic<bool> done(false);
+    Sample sample;
+    std::vector<std::thread> threads;
+    for (size_t t = 0; t < num_threads; ++t) {
+        threads.emplace_back([&, t] {
+            if (pin) {
+                pin(cpus[t]);
+            }
+            uint8_t* begin = region + (pages * t / num_threads) * page;
+            uint8_t* end = region + (pages * (t + 1) / num_threads) * page;
+            if (op != Operation::FIRST_TOUCH) {
+                touch(begin, end, page);
+            }
+
+            barrier.arrive_and_wait();
+            uint64_t faults = (t == 0) ? minor_faults() : 0;
+            auto start = Clock::now();
+            if (op == Operation::FIRST_TOUCH) {
+                touch(begin, end, page);
+                barrier.arrive_and_wait();  // Until the slowest slice is in
+            } else if (t == 0) {
+                if (op == Operation::DONTNEED) {
+                    madvise(region, bytes, MADV_DONTNEED);
+                    sample.calls = 1;
+                } else {
+                    const size_t chunk = BenchmarkConstants::MAPPING_UNMAP_CHUNK;
+                    for (size_t offset = 0; offset < bytes; offset += chunk) {
+                        munmap(region + offset, std::min(chunk, bytes - offset));
+                    }
+                    sample.calls = (bytes + chunk - 1) / chunk;
+                }
+                done.store(true, std::memory_order_release);
+            } else {
+                // Runnable but off the mapping: the CPU stays one the shootdown has to reach
+                while (!done.load(std::memory_order_acquire)) {
+                    std::this_thread::yield();
+                }
+            }
+            if (t == 0) {
+                sample.seconds = std::chrono::duration<double>(Clock::now() - start).count();
+                sample.minor_faults = minor_faults() - faults;
+            }
+        });
+    }
+    for (auto& thread : threads) {
+        thread.join();
+    }
+    if (op != Operation::MUNMAP) {
+        munmap(region, bytes);
+    }
+    return sample;
+}
+
+Sample measure_populate(size_t bytes) {
+    Sample sample;
+#ifdef MAP_POPULATE
+    const size_t page = page_bytes();
+    uint64_t faults = minor_faults();
+    auto start = Clock::now();
+    uint8_t* region = map_aligned(bytes, MAP_POPULATE);
+    touch(region, region + bytes, page);
+    sample.seconds = std::chrono::duration<double>(Clock::now() - start).count();
+    sample.minor_faults = minor_faults() - faults;
+    sample.calls = 1;
+    munmap(region, bytes);
+#else
+    (void)bytes;
+    sample.available = false;
+    sample.note = "MAP_POPULATE is Linux-only";
+#endif
+    return sample;
+}
+
+Sample measure_collapse(size_t bytes) {
+    Sample sample;
+#if defined(__linux__)
+    const size_t page = page_bytes();
+    uint8_t* region = map_aligned(bytes, 0);
+    // Faulted in as base pages, then made eligible again: MADV_COLLAPSE refuses VM_NOHUGEPAGE
+    madvise(region, bytes, MADV_NOHUGEPAGE);
+    touch(region, region + bytes, page);
+    madvise(region, bytes, MADV_HUGEPAGE);
+
+    uint64_t faults = minor_faults();
+    auto start = Clock::now();
+    int status = madvise(region, bytes, MADV_COLLAPSE);
+    sample.seconds = std::chrono::duration<double>(Clock::now() - start).count();
+    sample.minor_faults = minor_faults() - faults;
+    sample.calls = 1;
+    if (status != 0) {
+        int error = errno;
+        sample.available = false;
+        sample.note = std::string("MADV_COLLAPSE failed: ") + std::strerror(error) +
+                      (error == EINVAL ? " (needs Linux 6.1 and THP not set to never)" : "");
+    }
+    munmap(region, bytes);
+#else
+    (void)bytes;
+    sample.available = false;
+    sample.note = "MADV_COLLAPSE is Linux-only";
+#endif
+    return sample;
+}
+
+template <typename T>
+T median_of(std::vector<T> values) {
+    std::sort(values.begin(), values.end());
+    return values[values.size() / 2];
+}
+
+}  // namespace
+
+std::string operation_to_string(Operation op) {
+    switch (op) {
+        case Operation::FIRST_TOUCH:
+            return "first_touch";
+        case Operation::POPULATE:
+            return "populate";
+        case Operation::DONTNEED:
+            return "dontneed";
+        case Operation::THP_COLLAPSE:
+            return "thp_collapse";
+        case Operation::MUNMAP:
+            return "munmap";
+    }
+    return "first_touch";
+}
+
+std::vector<Operation> parse_operations(const std::string& list) {
+    const std::vector<Operation> all = {Operation::FIRST_TOUCH, Operation::POPULATE, Operation::DONTNEED,
+                                        Operation::THP_COLLAPSE, Operation::MUNMAP};
+    if (list == "all") {
+        return all;
+    }
+    std::vector<Operation> ops;
+    std::stringstream stream(list);
+    std::string name;
+    while (std::getline(stream, name, ',')) {
+        auto it = std::find_if(all.begin(), all.end(), [&](Operation op) { return operation_to_string(op) == name; });
+        if (it == all.end()) {
+            throw ArgumentError("Unknown mapping operation '" + name +
+                                "' (expected first_touch, populate, dontneed, thp_collapse, munmap or all)");
+        }
+        if (std::find(ops.begin(), ops.end(), *it) == ops.end()) {
+            ops.push_back(*it);
+        }
+    }
+    if (ops.empty()) {
+        throw ArgumentError("--mapping-ops needs at least one operation");
+    }
+    return ops;
+}
+
+bool uses_threads(Operation op) {
+    return op == Operation::FIRST_TOUCH || op == Operation::DONTNEED || op == Operation::MUNMAP;
+}
+
+size_t page_bytes() {
+    long page = sysconf(_SC_PAGESIZE);
+    return page > 0 ? static_cast<size_t>(page) : 4 * BenchmarkConstants::KB;
+}
+
+Result run(Operation op, size_t bytes, size_t repetitions, const std::vector<size_t>& cpus,
+           const CoherenceTests::PinFunction& pin) {
+    if (cpus.empty()) {
+        throw ConfigurationError("Mapping tests need at least one thread");
+    }
+    bytes = round_up(std::max<size_t>(bytes, 1), BenchmarkConstants::MAPPING_HUGE_PAGE);
+    std::vector<size_t> placement = uses_threads(op) ? cpus : std::vector<size_t>{cpus.front()};
+
+    std::vector<double> seconds;
+    std::vector<uint64_t> faults;
+    Result result;
+    result.op = op;
+    result.num_threads = placement.size();
+    result.bytes = bytes;
+    result.pages = bytes / page_bytes();
+    for (size_t i = 0; i < std::max<size_t>(repetitions, 1); ++i) {
+        Sample sample;
+        if (op == Operation::POPULATE) {
+            sample = measure_populate(bytes);
+        } else if (op == Operation::THP_COLLAPSE) {
+            sample = measure_collapse(bytes);
+        } else {
+            sample = measure_threaded(op, bytes, placement, pin);
+        }
+        if (!sample.available) {
+            result.available = false;
+            result.note = sample.note;
+            return result;
+        }
+        seconds.push_back(sample.seconds);
+        faults.push_back(sample.minor_faults);
+        result.calls = sample.calls;
+    }
+
+    result.seconds = median_of(seconds);
+    result.minor_faults = median_of(faults);
+    if (result.seconds > 0.0) {
+        result.ns_per_page = result.seconds * 1e9 / static_cast<double>(result.pages);
+        result.pages_per_second = static_cast<double>(result.pages) / result.seconds;
+    }
+    if (result.calls > 0) {
+        result.us_per_call = result.seconds * 1e6 / static_cast<double>(result.calls);
+    }
+    return result;
+}
+
+}  // namespace MappingTests
@@ -0,0 +1,94 @@
+#ifndef MAPPING_TESTS_H
+#define MAPPING_TESTS_H
+
+#include <cstddef>
+#include <cstdint>
+#include <string>
+#include <vector>
+
+#include "coherence_tests.h"
+
+/**
+ * @brief Cost of creating, populating and tearing down mappings
+ *
+ * The bandwidth tests allocate and fault in their buffers before timing,
+ * yet process startup and scale-out are dominated by exactly that work:
+ * minor faults on the first touch of fresh anonymous memory, the
+ * alternative of MAP_POPULATE, giving pages back with MADV_DONTNEED,
+ * collapsing 4 KB pages into transparent huge pages, and munmap, whose TLB
+ * shootdown interrupts reach every other core the process runs on. Each
+ * operation is timed on a fresh mapping of --size bytes; the multi-threaded
+ * ones place one thread per CPU entry, each touching its own slice first,
+ * so the threads that keep running while one of them reclaims or unmaps
+ * are the cores a shootdown must reach.
+ */
+namespace MappingTests {
+
+/**
+ * @brief Operation a measurement times
+ */
+enum class Operation {
+    FIRST_TOUCH,   ///< Every thread writes one byte per page of its slice of a fresh mapping
+    POPULATE,      ///< mmap with MAP_POPULATE, then the same touch (which takes no fault)
+    DONTNEED,      ///< madvise(MADV_DONTNEED) of the whole touched mapping, the other threads running
+    THP_COLLAPSE,  ///< madvise(MADV_COLLAPSE) of a touched 4 KB-page mapping into 2 MB pages
+    MUNMAP         ///< munmap of the touched mapping in MAPPING_UNMAP_CHUNK calls, the other threads running
+};
+
+/**
+ * @brief Outcome of one operation at one thread count
+ */
+struct Result {
+    Operation op = Operation::FIRST_TOUCH;
+    size_t num_threads = 0;
+    bool available = true;
+    std::string note;               ///< Why the operation is unavailable
+    size_t bytes = 0;               ///< Mapping size
+    size_t pages = 0;               ///< Base pages of the mapping
+    size_t calls = 0;               ///< System calls the timed region made (0: none, faults only)
+    double seconds = 0.0;           ///< Median over the repetitions
+    double ns_per_page = 0.0;
+    double pages_per_second = 0.0;
+    double us_per_call = 0.0;       ///< Wall time per system call (calls > 0)
+    uint64_t minor_faults = 0;      ///< Of the process over the timed region, median
+};
+
+/**
+ * @brief Command-line name ("first_touch", "populate", "dontneed", "thp_collapse", "munmap")
+ */
+std::string operation_to_string(Operation op);
+
+/**
+ * @brief Parse --mapping-ops: a comma-separated list or "all"
+ * @throws ArgumentError if a name is unknown or the list is empty
+ */
+std::vector<Operation> parse_operations(const std::string& list);
+
+/**
+ * @brief Whether an operation runs at every thread count (false: single-threaded)
+ */
+bool uses_threads(Operation op);
+
+/**
+ * @brief Base page size of anonymous mappings
+ */
+size_t page_bytes();
+
+/**
+ * @brief Time one operation, repetitions times, on one thread per CPU entry
+ *
+ * Never throws for an operation the platform lacks (MAP_POPULATE and
+ * MADV_COLLAPSE are Linux-only; MADV_COLLAPSE needs Linux 6.1): the result
+ * is returned with available false and a note.
+ *
+ * @param bytes Mapping size, rounded up to whole 2 MB pages
+ * @param pin Pins each thread (empty: no pinning)
+ * @throws ConfigurationError if cpus is empty
+ * @throws MemoryError if a mapping cannot be created
+ */
+Result run(Operation op, size_t bytes, size_t repetitions, const std::vector<size_t>& cpus,
+           const CoherenceTests::PinFunction& pin);
+
+}  // namespace MappingTests
+
+#endif  // MAPPING_TESTS_H
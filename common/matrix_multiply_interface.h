@@ -2,8 +2,11 @@
 #define MATRIX_MULTIPLY_INTERFACE_H
 
 #include <cstddef>
+#include <cstdint>
 #include <atomic>
+#include <cstring>
 #include <string>
+#include <vector>
 
 /**
  * @brief Platform-agnostic matrix multiplication interface
@@ -14,6 +17,30 @@
 
 namespace MatrixMultiply {
 
+/**
+ * @brief Operand precision of a matrix multiplication
+ *
+ * FP64 and FP32 accumulate in their own precision, BF16 and FP16 in FP32,
+ * and INT8 in INT32.
+ */
+enum class MatrixPrecision {
+    FP64,
+    FP32,
+    BF16,
+    FP16,
+    INT8
+};
+
+/// bfloat16 storage: the upper 16 bits of an IEEE binary32
+struct BFloat16 {
+    uint16_t bits;
+};
+
+/// IEEE binary16 storage
+struct Float16 {
+    uint16_t bits;
+};
+
 /**
  * @brief Matrix multiplication performance statistics
  */
@@ -25,6 +52,7 @@ struct MatrixPerformanceStats {
     double time_seconds;        ///< Total time taken for test in seconds
     size_t operations;          ///< Total number of operations performed
     std::string acceleration;   ///< Hardware acceleration used ("AMX", "NEON", "AVX512", etc.)
+    double arithmetic_intensity;  ///< Operations per byte of operand traffic (FLOP/byte, OP/byte for INT8)
 };
 
 /**
@@ -37,6 +65,7 @@ struct MatrixConfig {
     size_t iterations;  ///< Number of iterations to run
     bool use_double;    ///< Use double precision (false = single precision)
     bool transpose_b;   ///< Transpose B matrix for better cache locality
+    MatrixPrecision precision = MatrixPrecision::FP32;  ///< Operand precision (FP64 when use_double is set)
 };
 
 /**
@@ -63,10 +92,44 @@ public:
     
     // Check if this multiplier is available on current hardware
     virtual bool is_available() const = 0;
+
+    /**
+     * @brief Reduced-precision products (C is FP32, or INT32 for INT8)
+     *
+     * The defaults widen the operands while packing and run the portable
+     * blocked kernel; platforms override them with native instructions.
+     * The acceleration name in the returned stats says which path ran.
+     */
+    virtual MatrixPerformanceStats multiply_bf16(
+        float* C, const BFloat16* A, const BFloat16* B,
+        const MatrixConfig& config,
+        const std::atomic<bool>& stop_flag);
+
+    virtual MatrixPerformanceStats multiply_fp16(
+        float* C, const Float16* A, const Float16* B,
+        const MatrixConfig& config,
+        const std::atomic<bool>& stop_flag);
+
+    virtual MatrixPerformanceStats multiply_int8(
+        int32_t* C, const int8_t* A, const int8_t* B,
+        const MatrixConfig& config,
+        const std::atomic<bool>& stop_flag);
+
+    /**
+     * @brief Dispatch on config.precision to the typed multiply functions
+     *
+     * A and B must hold elements of the operand type of the precision and C
+     * elements of its accumulate type. use_double selects FP64 regardless
+     * of config.precision.
+     */
+    MatrixPerformanceStats multiply(void* C, const void* A, const void* B,
+                                    const MatrixConfig& config,
+                                    const std::atomic<bool>& stop_flag);
 };
 
 // Utility functions
 MatrixConfig create_matrix_config(size_t size, size_t iterations = 10, bool use_double = false);
+MatrixConfig create_matrix_config(size_t size, size_t iterations, MatrixPrecision precision);
 size_t calculate_matrix_memory_footprint(const MatrixConfig& config);
 
 // Matrix initialization and validation
@@ -78,6 +141,108 @@ bool validate_matrix_result(const float* C_test, const float* C_reference,
 MatrixPerformanceStats calculate_matrix_stats(size_t bytes_processed, double time_seconds, 
                                              size_t operations, const std::string& acceleration);
 
+// Precision helpers
+std::string precision_to_string(MatrixPrecision precision);       ///< "FP64", "FP32", "BF16", "FP16", "INT8"
+std::string accumulate_to_string(MatrixPrecision precision);      ///< "FP64", "FP32" or "INT32"
+size_t precision_operand_size(MatrixPrecision precision);          ///< Bytes per A/B element
+size_t precision_accumulate_size(MatrixPrecision precision);       ///< Bytes per C element
+
+/**
+ * @brief Parse a comma-separated precision list ("all" selects every precision)
+ * @return false if any entry is not one of fp64, fp32, bf16, fp16, int8, all
+ */
+bool parse_precisions(const std::string& list, std::vector<MatrixPrecision>& precisions);
+
+/// Backend name for a product whose operands were widened to the accumulate type, e.g. "AVX-512 FMA (BF16 via FP32)"
+std::string converted_acceleration_name(const std::string& backend, MatrixPrecision precision);
+
+/**
+ * @brief Fill a matrix of the precision's operand type with random values
+ *
+ * Floating-point types get uniform values in [-1, 1] (rounded for BF16 and
+ * FP16); INT8 gets integers in [-64, 63] so INT32 sums of a few thousand
+ * products cannot overflow.
+ */
+void initialize_matrix_random(MatrixPrecision precision, void* matrix, size_t rows, size_t cols);
+
+// Conversions round to nearest even and keep NaNs quiet. They are inline
+// because the blocked driver calls them for every packed element.
+inline BFloat16 to_bfloat16(float value) {
+    uint32_t bits;
+    std::memcpy(&bits, &value, sizeof(bits));
+    if ((bits & 0x7FFFFFFFu) > 0x7F800000u) {
+        return {static_cast<uint16_t>((bits >> 16) | 0x40u)};
+    }
+    bits += 0x7FFFu + ((bits >> 16) & 1u);
+    return {static_cast<uint16_t>(bits >> 16)};
+}
+
+inline float to_float(BFloat16 value) {
+    uint32_t bits = static_cast<uint32_t>(value.bits) << 16;
+    float result;
+    std::memcpy(&result, &bits, sizeof(result));
+    return result;
+}
+
+inline Float16 to_float16(float value) {
+    uint32_t bits;
+    std::memcpy(&bits, &value, sizeof(bits));
+    uint16_t sign = static_cast<uint16_t>((bits >> 16) & 0x8000u);
+    uint32_t magnitude = bits & 0x7FFFFFFFu;
+
+    if (magnitude > 0x7F800000u) {
+        return {static_cast<uint16_t>(sign | 0x7E00u)};  // NaN
+    }
+    if (magnitude >= 0x477FF000u) {
+        return {static_cast<uint16_t>(sign | 0x7C00u)};  // Overflow (rounds past 65504) or infinity
+    }
+    if (magnitude < 0x38800000u) {
+        // Subnormal half: align the implicit-one mantissa to 2^-24 units and round
+        if (magnitude < 0x33000000u) {
+            return {sign};
+        }
+        uint32_t exponent = magnitude >> 23;
+        uint32_t mantissa = (magnitude & 0x7FFFFFu) | 0x800000u;
+        uint32_t shift = 126 - exponent;
+        uint32_t half = mantissa >> shift;
+        uint32_t remainder = mantissa & ((1u << shift) - 1);
+        uint32_t halfway = 1u << (shift - 1);
+        if (remainder > halfway || (remainder == halfway && (half & 1u))) {
+            ++half;
+        }
+        return {static_cast<uint16_t>(sign | half)};
+    }
+    // Normal: rebias the exponent, then round the 13 dropped mantissa bits
+    uint32_t rebased = magnitude - (112u << 23);
+    rebased += 0xFFFu + ((rebased >> 13) & 1u);
+    return {static_cast<uint16_t>(sign | (rebased >> 13))};
+}
+
+inline float to_float(Float16 value) {
+    uint32_t sign = static_cast<uint32_t>(value.bits & 0x8000u) << 16;
+    uint32_t exponent = (value.bits >> 10) & 0x1Fu;
+    uint32_t mantissa = value.bits & 0x3FFu;
+    uint32_t bits;
+    if (exponent == 0x1Fu) {
+        bits = sign | 0x7F800000u | (mantissa << 13);
+    } else if (exponent != 0) {
+        bits = sign | ((exponent + 112u) << 23) | (mantissa << 13);
+    } else if (mantissa == 0) {
+        bits = sign;
+    } else {
+        // Subnormal half: normalize into a binary32 exponent
+        exponent = 113;
+        while ((mantissa & 0x400u) == 0) {
+            mantissa <<= 1;
+            --exponent;
+        }
+        bits = sign | (exponent << 23) | ((mantissa & 0x3FFu) << 13);
+    }
+    float result;
+    std::memcpy(&result, &bits, sizeof(result));
+    return result;
+}
+
 } // namespace MatrixMultiply
 
 #endif // MATRIX_MULTIPLY_INTERFACE_H
\ No newline at end of file
@@ -1,17 +1,27 @@
 #include "matrix_multiply_interface.h"
+#include "blocked_gemm.h"
 #include <random>
 #include <cmath>
 #include <algorithm>
+#include <sstream>
 
 namespace MatrixMultiply {
 
 MatrixConfig create_matrix_config(size_t size, size_t iterations, bool use_double) {
-    return MatrixConfig{size, size, size, iterations, use_double, false};
+    return MatrixConfig{size, size, size, iterations, use_double, false,
+                        use_double ? MatrixPrecision::FP64 : MatrixPrecision::FP32};
+}
+
+MatrixConfig create_matrix_config(size_t size, size_t iterations, MatrixPrecision precision) {
+    return MatrixConfig{size, size, size, iterations, precision == MatrixPrecision::FP64, false, precision};
 }
 
 size_t calculate_matrix_memory_footprint(const MatrixConfig& config) {
-    size_t element_size = config.use_double ? sizeof(double) : sizeof(float);
-    return (config.M * config.K + config.K * config.N + config.M * config.N) * element_size;
+    if (config.use_double) {
+        return (config.M * config.K + config.K * config.N + config.M * config.N) * sizeof(double);
+    }
+    return (config.M * config.K + config.K * config.N) * precision_operand_size(config.precision) +
+           config.M * config.N * precision_accumulate_size(config.precision);
 }
 
 void initialize_matrix_random(float* matrix, size_t rows, size_t cols, float scale) {
@@ -34,6 +44,34 @@ void initialize_matrix_random(double* matrix, size_t rows, size_t cols, double s
     }
 }
 
+void initialize_matrix_random(MatrixPrecision precision, void* matrix, size_t rows, size_t cols) {
+    switch (precision) {
+        case MatrixPrecision::FP64:
+            initialize_matrix_random(static_cast<double*>(matrix), rows, cols, 1.0);
+            return;
+        case MatrixPrecision::FP32:
+            initialize_matrix_random(static_cast<float*>(matrix), rows, cols, 1.0f);
+            return;
+        default:
+            break;
+    }
+
+    std::random_device rd;
+    std::mt19937 gen(rd());
+    std::uniform_real_distribution<float> dis(-1.0f, 1.0f);
+    std::uniform_int_distribution<int> int_dis(-64, 63);
+
+    for (size_t i = 0; i < rows * cols; ++i) {
+        if (precision == MatrixPrecision::BF16) {
+            static_cast<BFloat16*>(matrix)[i] = to_bfloat16(dis(gen));
+        } else if (precision == MatrixPrecision::FP16) {
+            static_cast<Float16*>(matrix)[i] = to_float16(dis(gen));
+        } else {
+            static_cast<int8_t*>(matrix)[i] = static_cast<int8_t>(int_dis(gen));
+        }
+    }
+}
+
 bool validate_matrix_result(const float* C_test, const float* C_reference, 
                            size_t rows, size_t cols, float tolerance) {
     for (size_t i = 0; i < rows * cols; ++i) {
@@ -55,7 +93,132 @@ MatrixPerformanceStats calculate_matrix_stats(size_t bytes_processed, double tim
     stats.bandwidth_gbps = (time_seconds > 0) ? bytes_processed / (time_seconds * 1e9) : 0.0;
     stats.latency_ns = (operations > 0) ? (time_seconds * 1e9) / operations : 0.0;
     stats.acceleration = acceleration;
+    stats.arithmetic_intensity = (bytes_processed > 0) ? static_cast<double>(operations) / bytes_processed : 0.0;
     return stats;
 }
 
+std::string precision_to_string(MatrixPrecision precision) {
+    switch (precision) {
+        case MatrixPrecision::FP64: return "FP64";
+        case MatrixPrecision::FP32: return "FP32";
+        case MatrixPrecision::BF16: return "BF16";
+        case MatrixPrecision::FP16: return "FP16";
+        case MatrixPrecision::INT8: return "INT8";
+    }
+    return "FP32";
+}
+
+std::string accumulate_to_string(MatrixPrecision precision) {
+    switch (precision) {
+        case MatrixPrecision::FP64: return "FP64";
+        case MatrixPrecision::INT8: return "INT32";
+        default: return "FP32";
+    }
+}
+
+size_t precision_operand_size(MatrixPrecision precision) {
+    switch (precision) {
+        case MatrixPrecision::FP64: return sizeof(double);
+        case MatrixPrecision::FP32: return sizeof(float);
+        case MatrixPrecision::BF16: return sizeof(BFloat16);
+        case MatrixPrecision::FP16: return sizeof(Float16);
+        case MatrixPrecision::INT8: return sizeof(int8_t);
+    }
+    return sizeof(float);
+}
+
+size_t precision_accumulate_size(MatrixPrecision precision) {
+    switch (precision) {
+        case MatrixPrecision::FP64: return sizeof(double);
+        case MatrixPrecision::INT8: return sizeof(int32_t);
+        default: return sizeof(float);
+    }
+}
+
+bool parse_precisions(const std::string& list, std::vector<MatrixPrecision>& precisions) {
+    const std::vector<MatrixPrecision> all = {MatrixPrecision::FP64, MatrixPrecision::FP32, MatrixPrecision::BF16,
+                                              MatrixPrecision::FP16, MatrixPrecision::INT8};
+    std::vector<MatrixPrecision> parsed;
+    std::stringstream stream(list);
+    std::string item;
+    while (std::getline(stream, item, ',')) {
+        std::transform(item.begin(), item.end(), item.begin(), ::tolower);
+        if (item == "all") {
+            parsed = all;
+            continue;
+        }
+        auto match = std::find_if(all.begin(), all.end(), [&item](MatrixPrecision precision) {
+            std::string name = precision_to_string(precision);
+            std::transform(name.begin(), name.end(), name.begin(), ::tolower);
+            return name == item;
+        });
+        if (match == all.end()) {
+            return false;
+        }
+        if (std::find(parsed.begin(), parsed.end(), *match) == parsed.end()) {
+            parsed.push_back(*match);
+        }
+    }
+    if (parsed.empty()) {
+        return false;
+    }
+    precisions = parsed;
+    return true;
+}
+
+std::string converted_acceleration_name(const std::string& backend, MatrixPrecision precision) {
+    return backend + " (" + precision_to_string(precision) + " via " + accumulate_to_string(precision) + ")";
+}
+
+// Default reduced-precision paths: widen while packing, then run the
+// portable kernel in the accumulate type
+MatrixPerformanceStats MatrixMultiplier::multiply_bf16(
+    float* C, const BFloat16* A, const BFloat16* B,
+    const MatrixConfig& config,
+    const std::atomic<bool>& stop_flag) {
+    return BlockedGemm::portable_multiply(C, A, B, config, stop_flag, CacheInfo{},
+                                          converted_acceleration_name(BlockedGemm::PORTABLE_NAME,
+                                                                      MatrixPrecision::BF16));
+}
+
+MatrixPerformanceStats MatrixMultiplier::multiply_fp16(
+    float* C, const Float16* A, const Float16* B,
+    const MatrixConfig& config,
+    const std::atomic<bool>& stop_flag) {
+    return BlockedGemm::portable_multiply(C, A, B, config, stop_flag, CacheInfo{},
+                                          converted_acceleration_name(BlockedGemm::PORTABLE_NAME,
+                                                                      MatrixPrecision::FP16));
+}
+
+MatrixPerformanceStats MatrixMultiplier::multiply_int8(
+    int32_t* C, const int8_t* A, const int8_t* B,
+    const MatrixConfig& config,
+    const std::atomic<bool>& stop_flag) {
+    return BlockedGemm::portable_multiply(C, A, B, config, stop_flag, CacheInfo{},
+                                          converted_acceleration_name(BlockedGemm::PORTABLE_NAME,
+                                                                      MatrixPrecision::INT8));
+}
+
+MatrixPerformanceStats MatrixMultiplier::multiply(void* C, const void* A, const void* B,
+                                                  const MatrixConfig& config,
+                                                  const std::atomic<bool>& stop_flag) {
+    switch (config.use_double ? MatrixPrecision::FP64 : config.precision) {
+        case MatrixPrecision::FP64:
+            return multiply_double(static_cast<double*>(C), static_cast<const double*>(A),
+                                   static_cast<const double*>(B), config, stop_flag);
+        case MatrixPrecision::BF16:
+            return multiply_bf16(static_cast<float*>(C), static_cast<const BFloat16*>(A),
+                                 static_cast<const BFloat16*>(B), config, stop_flag);
+        case MatrixPrecision::FP16:
+            return multiply_fp16(static_cast<float*>(C), static_cast<const Float16*>(A),
+                                 static_cast<const Float16*>(B), config, stop_flag);
+        case MatrixPrecision::INT8:
+            return multiply_int8(static_cast<int32_t*>(C), static_cast<const int8_t*>(A),
+                                 static_cast<const int8_t*>(B), config, stop_flag);
+        default:
+            return multiply_float(static_cast<float*>(C), static_cast<const float*>(A),
+                                  static_cast<const float*>(B), config, stop_flag);
+    }
+}
+
 } // namespace MatrixMultiply
\ No newline at end of file
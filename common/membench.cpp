@@ -0,0 +1,150 @@
+#include "membench.h"
+#include "memory_bandwidth_tester.h"
+#include "calibration.h"
+#include "constants.h"
+#include "errors.h"
+#include "page_allocator.h"
+#include "pattern_registry.h"
+#include "simd_kernels.h"
+
+#include <algorithm>
+#include <chrono>
+
+namespace Membench {
+
+struct Engine::Impl {
+    KernelType kernel;
+    MemoryBandwidthTester tester;
+    bool configured = false;
+    ProbeConfig config;
+    TestPattern pattern = TestPattern::SEQUENTIAL_READ;
+    StorePolicy store_policy = StorePolicy::TEMPORAL;
+    size_t threads = 1;
+
+    Impl(KernelType kernel_type, PageMode pages)
+        : kernel(kernel_type), tester(OutputFormat::JSON, CPUAffinityType::DEFAULT, kernel_type, {}, pages) {}
+
+    void require_configured() const {
+        if (!configured) {
+            throw ConfigurationError("Engine has no probe; call configure() first");
+        }
+    }
+
+    ProbeResult result_from(const PerformanceStats& stats, size_t iterations, size_t repetitions,
+                            double ci_percent, double elapsed_seconds) const {
+        ProbeResult result;
+        result.test_name = tester.test_name_for(pattern, MatrixMultiply::MatrixPrecision::FP32);
+        result.kernel = tester.kernel_name_for(pattern);
+        result.store_policy = MemoryBandwidthTester::store_policy_name_for(pattern, store_policy);
+        result.threads = threads;
+        result.working_set_bytes = config.working_set_bytes;
+        result.iterations = iterations;
+        result.repetitions = repetitions;
+        result.bandwidth_gbps = stats.bandwidth_gbps;
+        result.latency_ns = stats.latency_ns;
+        result.ci_percent = ci_percent;
+        result.theoretical_bandwidth_gbps = tester.get_cached_system_info().memory_specs.theoretical_bandwidth_gbps;
+        if (result.theoretical_bandwidth_gbps > 0.0) {
+            result.efficiency_percent = stats.bandwidth_gbps / result.theoretical_bandwidth_gbps * 100.0;
+        }
+        result.elapsed_seconds = elapsed_seconds;
+        result.verified = stats.verified;
+        result.warnings = tester.validate_result(pattern, stats, threads);
+        return result;
+    }
+};
+
+Engine::Engine(const Options& options) {
+    KernelType kernel = SimdKernels::string_to_kernel_type(options.kernel);
+    PageMode pages = PageAllocator::string_to_page_mode(options.pages);
+    impl = std::make_unique<Impl>(kernel, pages);
+}
+
+Engine::~Engine() = default;
+
+void Engine::configure(const ProbeConfig& config) {
+    TestPattern pattern = PatternRegistry::parse(config.pattern);
+    if (pattern == TestPattern::MATRIX_MULTIPLY) {
+        throw ArgumentError("Pattern 'matrix_multiply' is compute-bound and cannot be probed by the engine");
+    }
+    size_t cpu_threads = std::max<size_t>(1, impl->tester.get_cached_system_info().cpu_threads);
+    if (config.threads > cpu_threads) {
+        throw ArgumentError("Probe threads must be 0 (all) to " + std::to_string(cpu_threads) + ", got " +
+                            std::to_string(config.threads));
+    }
+    if (config.working_set_bytes < BenchmarkConstants::MIN_WORKING_SET_SIZE) {
+        throw ArgumentError("Probe working set must be at least " +
+                            std::to_string(BenchmarkConstants::MIN_WORKING_SET_SIZE) + " bytes");
+    }
+    if (config.iterations == 0 && !(config.time_budget_seconds > 0.0)) {
+        throw ArgumentError("Probe needs a positive time budget or an iteration count");
+    }
+    std::vector<StorePolicy> policies = SimdKernels::parse_store_policies(config.store_policy, impl->kernel);
+    if (policies.size() != 1) {
+        throw ArgumentError("Probe runs a single store policy, got '" + config.store_policy + "'");
+    }
+    if (!SimdKernels::is_store_policy_supported(impl->kernel, policies.front())) {
+        throw ArgumentError("Store policy '" + config.store_policy + "' is not supported with this kernel on this CPU");
+    }
+
+    impl->configured = false;
+    size_t threads = MemoryBandwidthTester::threads_for(pattern, config.threads == 0 ? cpu_threads : config.threads);
+    if (!impl->tester.allocate_pattern_buffers({pattern}, config.working_set_bytes, threads)) {
+        throw MemoryError("Failed to allocate " + std::to_string(config.working_set_bytes) +
+                          " bytes for the probe");
+    }
+    impl->config = config;
+    impl->pattern = pattern;
+    impl->store_policy = policies.front();
+    impl->threads = threads;
+    impl->configured = true;
+}
+
+ProbeResult Engine::run() {
+    impl->require_configured();
+    if (impl->config.iterations == 0) {
+        return run_with_budget(impl->config.time_budget_seconds);
+    }
+    auto start = std::chrono::steady_clock::now();
+    PerformanceStats stats = impl->tester.run_test(impl->pattern, impl->config.iterations, impl->threads, false,
+                                                   impl->store_policy);
+    double elapsed = std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count();
+    return impl->result_from(stats, impl->config.iterations, 1, 0.0, elapsed);
+}
+
+ProbeResult Engine::run_with_budget(double seconds) {
+    if (!(seconds > 0.0)) {
+        throw ArgumentError("Probe time budget must be positive");
+    }
+    impl->require_configured();
+
+    // Calibration can start a repetition just before its own budget ends, and a
+    // repetition lasts up to two target samples: leave room for it in the caller's budget
+    Calibration::Settings settings;
+    settings.target_sample_seconds = seconds / 10.0;
+    settings.time_budget_seconds = seconds * 0.6;
+
+    auto start = std::chrono::steady_clock::now();
+    Calibration::Result calibrated = Calibration::measure([this](size_t iterations) {
+        return impl->tester.run_test(impl->pattern, iterations, impl->threads, false, impl->store_policy);
+    }, settings);
+    double elapsed = std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count();
+    return impl->result_from(calibrated.stats, calibrated.iterations, calibrated.repetitions,
+                             calibrated.ci_percent, elapsed);
+}
+
+HostInfo Engine::host() const {
+    const SystemInfo& system = impl->tester.get_cached_system_info();
+    HostInfo host;
+    host.cpu_name = system.cpu_name;
+    host.cpu_cores = system.cpu_cores;
+    host.cpu_threads = system.cpu_threads;
+    host.memory_type = system.memory_specs.type;
+    host.memory_speed_mtps = system.memory_specs.speed_mtps;
+    host.memory_channels = system.memory_specs.num_channels;
+    host.theoretical_bandwidth_gbps = system.memory_specs.theoretical_bandwidth_gbps;
+    host.kernel = SimdKernels::kernel_type_to_string(SimdKernels::resolve_kernel(impl->kernel));
+    return host;
+}
+
+}  // namespace Membench
@@ -0,0 +1,150 @@
+#ifndef MEMBENCH_H
+#define MEMBENCH_H
+
+#include <cstddef>
+#include <memory>
+#include <string>
+#include <vector>
+
+/**
+ * @brief Embeddable benchmark engine (libmembench)
+ *
+ * The measurement core of memory_bandwidth behind a small interface for
+ * schedulers, health checks and autotuners that probe a host from their own
+ * process. Only standard library types cross it, so callers do not depend on
+ * the internal headers and the layout of MemoryBandwidthTester can change
+ * without breaking them. Nothing is written to stdout or stderr: problems
+ * are reported as exceptions from errors.h and result warnings.
+ *
+ * Typical use:
+ *
+ *     Membench::Engine engine;
+ *     Membench::ProbeConfig probe;
+ *     probe.pattern = "triad";
+ *     engine.configure(probe);
+ *     Membench::ProbeResult result = engine.run_with_budget(0.1);
+ */
+namespace Membench {
+
+/**
+ * @brief Settings fixed for the lifetime of an engine
+ *
+ * Names are the ones of the matching command-line options.
+ */
+struct Options {
+    std::string kernel = "auto";    ///< --kernel
+    std::string pages = "default";  ///< --pages
+};
+
+/**
+ * @brief One measurement to run
+ */
+struct ProbeConfig {
+    std::string pattern = "sequential_read";       ///< --pattern name of a single pattern
+    size_t working_set_bytes = 64 * 1024 * 1024;   ///< Bytes allocated for all arrays of the pattern
+    size_t threads = 0;                            ///< 0: every logical CPU
+    size_t iterations = 0;                         ///< 0: fit the measurement into time_budget_seconds
+    double time_budget_seconds = 0.1;              ///< Budget of run() when iterations is 0
+    std::string store_policy = "temporal";         ///< --stores policy of write, copy and triad
+};
+
+/**
+ * @brief Outcome of one measurement
+ */
+struct ProbeResult {
+    std::string test_name;                   ///< Result name as memory_bandwidth reports it
+    std::string kernel;                      ///< Kernel or backend that ran the pattern
+    std::string store_policy;                ///< "-" for patterns without a store policy
+    size_t threads = 0;
+    size_t working_set_bytes = 0;
+    size_t iterations = 0;                   ///< Iterations of the reported repetition
+    size_t repetitions = 0;                  ///< Repetitions measured (1 with a fixed iteration count)
+    double bandwidth_gbps = 0.0;
+    double latency_ns = 0.0;
+    double ci_percent = 0.0;                 ///< 95% confidence half-width of the mean bandwidth (0: unknown)
+    double theoretical_bandwidth_gbps = 0.0;
+    double efficiency_percent = 0.0;         ///< Of the theoretical bandwidth (0 if it is unknown)
+    double elapsed_seconds = 0.0;            ///< Wall time of the whole measurement
+    bool verified = true;                    ///< Kernel output matched a reference
+    std::vector<std::string> warnings;       ///< Plausibility warnings (see ResultValidation)
+};
+
+/**
+ * @brief Host the engine measures
+ */
+struct HostInfo {
+    std::string cpu_name;
+    size_t cpu_cores = 0;
+    size_t cpu_threads = 0;
+    std::string memory_type;
+    size_t memory_speed_mtps = 0;
+    size_t memory_channels = 0;
+    double theoretical_bandwidth_gbps = 0.0;
+    std::string kernel;                      ///< Kernel --kernel resolved to
+};
+
+/**
+ * @brief Benchmark engine
+ *
+ * Construction detects the platform once (cache sizes, topology, memory
+ * specifications) and starts no measurement. configure() allocates and
+ * first-touches the arrays of a probe; they are kept for every following
+ * run, so repeated probes pay for page faults only once.
+ *
+ * An engine is not thread-safe: it runs one measurement at a time.
+ */
+class Engine {
+public:
+    /**
+     * @throws ArgumentError if a kernel or page mode name is unknown
+     * @throws PlatformError if the platform cannot be detected
+     */
+    explicit Engine(const Options& options = Options());
+    ~Engine();
+
+    Engine(const Engine&) = delete;
+    Engine& operator=(const Engine&) = delete;
+
+    /**
+     * @brief Validate a probe and allocate its arrays
+     * @throws ArgumentError if a value is out of range or the pattern is not a memory pattern
+     * @throws MemoryError if the working set cannot be allocated
+     */
+    void configure(const ProbeConfig& config);
+
+    /**
+     * @brief Run the configured probe
+     *
+     * A fixed iteration count runs once; otherwise the measurement is
+     * sized to time_budget_seconds like run_with_budget.
+     *
+     * @throws ConfigurationError if configure() has not succeeded yet
+     */
+    ProbeResult run();
+
+    /**
+     * @brief Run the configured probe within a time budget
+     *
+     * The iteration count is calibrated to a tenth of the budget and
+     * repetitions run until the bandwidth has converged or the budget is
+     * spent; the repetition with the median bandwidth is reported. Only a
+     * single iteration longer than the budget can exceed it.
+     *
+     * @throws ArgumentError if seconds is not positive
+     * @throws ConfigurationError if configure() has not succeeded yet
+     */
+    ProbeResult run_with_budget(double seconds);
+
+    /**
+     * @brief Host description gathered at construction
+     */
+    HostInfo host() const;
+
+private:
+    struct Impl;
+    std::unique_ptr<Impl> impl;
+};
+
+}  // namespace Membench
+
+#endif  // MEMBENCH_H
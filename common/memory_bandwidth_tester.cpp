@@ -0,0 +1,2073 @@
+#include "memory_bandwidth_tester.h"
+
+#include <algorithm>
+#include <cerrno>
+#include <chrono>
+#include <cmath>
+#include <cstring>
+#include <fstream>
+#include <iomanip>
+#include <iostream>
+#include <map>
+#include <random>
+#include <set>
+#include <sstream>
+#include <thread>
+#include <tuple>
+
+#include "standard_tests.h"
+#include "pattern_registry.h"
+#include "memory_utils.h"
+#include "constants.h"
+#include "errors.h"
+#include "result_validation.h"
+
+using namespace BenchmarkConstants;
+
+namespace {
+
+// Kernel family of the patterns that run tuned shapes
+bool tuned_family(TestPattern pattern, KernelMatrix::Family& family) {
+    switch (pattern) {
+        case TestPattern::SEQUENTIAL_READ: family = KernelMatrix::Family::READ; return true;
+        case TestPattern::SEQUENTIAL_WRITE: family = KernelMatrix::Family::WRITE; return true;
+        case TestPattern::TRIAD: family = KernelMatrix::Family::TRIAD; return true;
+        default: return false;
+    }
+}
+
+}  // namespace
+
+MemoryBandwidthTester::MemoryBandwidthTester(OutputFormat output_format, 
+                                             CPUAffinityType affinity_type,
+                                             KernelType kernel_type,
+                                             const PointerChase::ChaseConfig& chase,
+                                             PageMode pages)
+    : platform(create_platform_interface()),
+      cache_info(platform->get_core_specific_cache_info(affinity_type)),
+      working_sets(cache_info),
+      stop_flag(false),
+      formatter(output_format),
+      cache_line_size(platform->detect_cache_line_size()),
+      cached_system_info(platform->get_system_info()),
+      cpu_affinity(affinity_type),
+      kernel(SimdKernels::resolve_kernel(kernel_type)),
+      chase_config(chase),
+      page_mode(pages),
+      numa_thread_binding(false),
+      numa_cpu_node(0),
+      numa_topology(platform->detect_numa_topology()),
+      cpu_topology(platform->detect_cpu_topology()),
+      pinned_threads(0),
+      pinned_numa_binding(false),
+      pinned_numa_node(0) {}
+
+MemoryBandwidthTester::~MemoryBandwidthTester() {
+    cleanup_buffers();
+}
+
+bool MemoryBandwidthTester::allocate_buffers(size_t total_size, size_t num_buffers, size_t num_threads,
+                                             bool first_touch, size_t alignment) {
+    if(total_size == 0 || num_buffers == 0) {
+        throw MemoryError("Invalid buffer allocation parameters: total_size=" + 
+                        std::to_string(total_size) + ", num_buffers=" + std::to_string(num_buffers));
+    }
+
+    size_t buffer_size = MemoryUtils::calculate_buffer_size(total_size, num_buffers, cache_line_size);
+    if(buffer_size == 0) {
+        throw MemoryError("Buffer size too small: calculated size=" + std::to_string(buffer_size) + 
+                        " bytes, minimum required=" + std::to_string(MIN_BUFFER_SIZE) + " bytes");
+    }
+
+    cleanup_buffers();
+    current_buffer_size = buffer_size;
+    alignment = std::max(alignment, cache_line_size);
+
+    try {
+        buffers.reserve(num_buffers);
+        aligned_buffers.reserve(num_buffers);
+        
+        for(size_t i = 0; i < num_buffers; ++i) {
+            // Create aligned buffer using RAII - automatically handles alignment and initialization
+            if (file_backing.enabled()) {
+                buffers.emplace_back(buffer_size, alignment, file_backing, false);
+            } else {
+                buffers.emplace_back(buffer_size, alignment, page_mode, false);
+            }
+            
+            // Verify alignment was achieved
+            if (!buffers.back().is_aligned()) {
+                throw MemoryError("Failed to achieve cache line alignment for buffer " + std::to_string(i));
+            }
+            
+            // Store pointer for compatibility with existing test functions
+            aligned_buffers.push_back(buffers.back().data());
+        }
+    } catch (const std::bad_alloc& e) {
+        cleanup_buffers();
+        throw MemoryError("Failed to allocate buffer of size " + std::to_string(buffer_size) + " bytes: " + e.what());
+    } catch (const std::invalid_argument& e) {
+        cleanup_buffers();
+        throw MemoryError("Invalid buffer parameters: " + std::string(e.what()));
+    }
+
+    if(first_touch) {
+        first_touch_buffers(num_threads);
+    }
+    return true;
+}
+
+bool MemoryBandwidthTester::allocate_pattern_buffers(const std::vector<TestPattern>& patterns, size_t total_size,
+                                                     size_t num_threads, bool first_touch) {
+    size_t arrays = 1;
+    size_t alignment = 0;
+    for (TestPattern pattern : patterns) {
+        arrays = std::max(arrays, arrays_for(pattern));
+        alignment = std::max(alignment, PatternRegistry::get(pattern).alignment);
+    }
+    return allocate_buffers(footprint_for(total_size, arrays), arrays, num_threads, first_touch, alignment);
+}
+
+void MemoryBandwidthTester::first_touch_buffers(size_t num_threads) {
+    if(buffers.empty()) return;
+    num_threads = std::max<size_t>(1, num_threads);
+
+    pin_workers(num_threads);
+    pool.run(num_threads, [this, num_threads](size_t i) {
+        size_t start_offset, end_offset;
+        std::tie(start_offset, end_offset) = thread_slice(i, num_threads, current_buffer_size);
+        for(auto& buffer : buffers) {
+            buffer.initialize_pattern(start_offset, end_offset);
+        }
+    });
+}
+
+void MemoryBandwidthTester::cleanup_buffers() {
+    // RAII: AlignedBuffer destructors automatically handle memory cleanup
+    buffers.clear();
+    aligned_buffers.clear();
+}
+
+void MemoryBandwidthTester::set_calibration(const Calibration::Settings& settings) {
+    calibrating = true;
+    calibration_settings = settings;
+}
+
+bool MemoryBandwidthTester::enable_counters() {
+    counting = true;
+    uncore_counters = platform->create_uncore_counters();
+    if(uncore_counters && !uncore_counters->open()) {
+        uncore_counters.reset();
+    }
+    prepare_counters(1);
+    return uncore_counters != nullptr || thread_counters[0] != nullptr;
+}
+
+bool MemoryBandwidthTester::enable_energy() {
+    energy_meter = platform->create_energy_meter();
+    return energy_meter != nullptr;
+}
+
+std::string MemoryBandwidthTester::describe_energy() const {
+    return energy_meter ? energy_meter->describe() : "";
+}
+
+void MemoryBandwidthTester::set_file_backing(const FileOptions& options) {
+    file_backing = options;
+}
+
+void MemoryBandwidthTester::set_stream_counts(const StreamCounts& counts) {
+    stream_counts = counts;
+}
+
+void MemoryBandwidthTester::set_access_config(const AccessPatterns::AccessConfig& config) {
+    access_config = config;
+}
+
+void MemoryBandwidthTester::set_decode_bits(unsigned bits) {
+    decode_bits = bits;
+}
+
+void MemoryBandwidthTester::set_proxy_config(const ProxyKernels::Config& config) {
+    proxy_config = config;
+}
+
+void MemoryBandwidthTester::set_irregular_config(const IrregularKernels::Config& config) {
+    irregular_config = config;
+}
+
+void MemoryBandwidthTester::set_tuned_shapes(const std::vector<PeakCalibration::TunedShape>& shapes) {
+    tuned_kernels.clear();
+    for (const auto& tuned : shapes) {
+        const KernelMatrix::Kernel* match = nullptr;
+        for (TestPattern pattern : {TestPattern::SEQUENTIAL_READ, TestPattern::SEQUENTIAL_WRITE, TestPattern::TRIAD}) {
+            KernelMatrix::Family family;
+            if (tuned_family(pattern, family) && KernelMatrix::family_to_string(family) == tuned.family) {
+                match = KernelMatrix::find(family, KernelMatrix::parse_shape(tuned.shape));
+            }
+        }
+        if (match == nullptr) {
+            throw ConfigurationError("Tuned " + tuned.family + " shape '" + tuned.shape +
+                                     "' is not one of this build's kernel shapes; run --tune again");
+        }
+        tuned_kernels[{match->family, tuned.level}] = match;
+    }
+}
+
+void MemoryBandwidthTester::set_cold(ColdCache::Method method) {
+    cold = true;
+    cold_method = method;
+    evictors.clear();
+}
+
+std::string MemoryBandwidthTester::describe_cold() const {
+    if (!cold) {
+        return "";
+    }
+    if (cold_method == ColdCache::Method::FLUSH) {
+        return "flush with " + ColdCache::flush_instruction();
+    }
+    return "evict through a per-thread buffer (" +
+           std::to_string(ColdCache::eviction_bytes(cache_info, 1) / BenchmarkConstants::MB) + " MB on one thread)";
+}
+
+void MemoryBandwidthTester::set_placement(CpuTopologyUtils::Placement placement, const std::vector<size_t>& list) {
+    for(size_t cpu : list) {
+        if(CpuTopologyUtils::find_cpu(cpu_topology, cpu) == nullptr) {
+            throw ConfigurationError("CPU " + std::to_string(cpu) + " in --placement is not online");
+        }
+    }
+    placement_cpus = pins_single_cpus() ? CpuTopologyUtils::placement_order(cpu_topology, placement, list)
+                                        : std::vector<size_t>();
+    placement_name = CpuTopologyUtils::placement_to_string(placement);
+    pinned_threads = 0;
+}
+
+void MemoryBandwidthTester::set_ndjson_sink(Ndjson::Sink* sink) {
+    ndjson_sink = sink;
+}
+
+void MemoryBandwidthTester::record_result(const TestResult& result, const std::string& mode) const {
+    if(ndjson_sink) {
+        ndjson_sink->write(result, {mode, placement_name, describe_page_backing()});
+    }
+}
+
+const CpuTopology& MemoryBandwidthTester::get_cpu_topology() const {
+    return cpu_topology;
+}
+
+std::vector<size_t> MemoryBandwidthTester::worker_cpus(size_t num_threads) const {
+    std::vector<size_t> order = placement_cpus;
+    if(order.empty() && cpu_affinity != CPUAffinityType::DEFAULT) {
+        order = CpuTopologyUtils::cpus_of_type(cpu_topology, cpu_affinity);
+    }
+    std::vector<size_t> cpus;
+    size_t logical_cpus = std::max(1u, std::thread::hardware_concurrency());
+    for(size_t i = 0; i < num_threads; ++i) {
+        cpus.push_back(order.empty() ? i % logical_cpus : order[i % order.size()]);
+    }
+    return cpus;
+}
+
+void MemoryBandwidthTester::set_prefetch_distance(size_t distance) {
+    prefetch_distance = distance;
+}
+
+void MemoryBandwidthTester::set_hardware_prefetchers(bool enabled) {
+    if (enabled == !hardware_prefetchers_disabled) {
+        return;
+    }
+    if (!hardware_prefetchers) {
+        hardware_prefetchers = platform->create_prefetcher_control();
+        if (!hardware_prefetchers) {
+            throw PlatformError("Hardware prefetcher control is not supported on " +
+                                platform->get_platform_name() + " (Intel CPUs on Linux only)");
+        }
+    }
+    if (enabled) {
+        hardware_prefetchers->restore();
+    } else {
+        std::string error;
+        if (!hardware_prefetchers->disable(error)) {
+            throw PlatformError("Cannot disable the hardware prefetchers: " + error);
+        }
+    }
+    hardware_prefetchers_disabled = !enabled;
+}
+
+std::string MemoryBandwidthTester::describe_hardware_prefetchers() const {
+    return hardware_prefetchers ? hardware_prefetchers->describe() : "";
+}
+
+std::vector<IoTests::Result> MemoryBandwidthTester::run_io_paths(
+        const std::string& directory, size_t file_size, size_t passes, const std::vector<IoTests::Method>& methods,
+        const std::vector<size_t>& block_sizes, const std::vector<size_t>& queue_depths, double clock_ghz) {
+    std::vector<IoTests::Result> results;
+    std::string path = IoTests::create_test_file(directory, file_size);
+
+    IoTests::Config io_config;
+    io_config.path = path;
+    io_config.file_size = file_size;
+    io_config.passes = std::max<size_t>(1, passes);
+    io_config.alignment = std::max<size_t>(4096, cache_line_size);
+    for (IoTests::Method method : methods) {
+        std::vector<size_t> blocks = IoTests::uses_block_size(method) ? block_sizes : std::vector<size_t>{0};
+        std::vector<size_t> depths = IoTests::uses_queue_depth(method) ? queue_depths : std::vector<size_t>{1};
+        for (size_t block : blocks) {
+            for (size_t depth : depths) {
+                io_config.block_size = block;
+                io_config.queue_depth = depth;
+                results.push_back(IoTests::run(method, io_config, clock_ghz));
+            }
+        }
+    }
+
+    IoTests::remove_test_file(path);
+    return results;
+}
+
+TraceReplay::ReplayResult MemoryBandwidthTester::run_trace_replay(const TraceReplay::Trace& trace, size_t passes,
+                                                                  size_t num_threads) {
+    const TraceReplay::Summary& summary = trace.summary();
+    TraceReplay::ReplayResult result;
+    result.threads = std::max<size_t>(1, std::min(num_threads, summary.blocks));
+    result.passes = std::max<size_t>(1, passes);
+
+    // Records address whole 8-byte words; round the span up to keep the last one in the buffer
+    size_t span = std::max(static_cast<size_t>(summary.span_bytes), MIN_BUFFER_SIZE);
+    allocate_buffers((span + cache_line_size - 1) / cache_line_size * cache_line_size, 1, result.threads);
+    uint8_t* buffer = aligned_buffers[0];
+    pin_workers(result.threads);
+    std::vector<TraceReplay::Workspace> workspaces(result.threads);
+
+    std::vector<double> decode_seconds(result.threads, 0.0);
+    pool.run(result.threads, [&](size_t i) {
+        size_t first_block, last_block;
+        std::tie(first_block, last_block) = TraceReplay::block_slice(i, result.threads, summary.blocks);
+        decode_seconds[i] = TraceReplay::decode_only(trace, first_block, last_block, result.passes, workspaces[i]);
+    });
+
+    std::vector<PerformanceStats> thread_results(result.threads);
+    std::vector<ThreadTiming> timings = pool.run(result.threads, [&](size_t i) {
+        size_t first_block, last_block;
+        std::tie(first_block, last_block) = TraceReplay::block_slice(i, result.threads, summary.blocks);
+        thread_results[i] = TraceReplay::replay(trace, first_block, last_block, buffer, result.passes,
+                                                workspaces[i], stop_flag);
+    });
+    cleanup_buffers();
+
+    result.stats = aggregate_stats(thread_results, timings);
+    double records = static_cast<double>(summary.records) * result.passes;
+    double decode_total = 0.0, replay_total = 0.0;
+    for (size_t i = 0; i < result.threads; ++i) {
+        decode_total += decode_seconds[i];
+        replay_total += thread_results[i].time_seconds;
+    }
+    result.decode_ns_per_record = decode_total * 1e9 / records;
+    result.replay_ns_per_record = replay_total * 1e9 / records;
+    result.stats.latency_ns = result.replay_ns_per_record;
+    if (result.stats.time_seconds > 0.0 && summary.bytes() > 0) {
+        // Aggregate bytes over the window, in records at the trace's mean access size
+        result.accesses_per_second = result.stats.bandwidth_gbps * 1e9 / summary.bytes() * summary.records;
+    }
+    if (replay_total > 0.0) {
+        result.decode_percent = decode_total / replay_total * 100.0;
+    }
+    return result;
+}
+
+PerformanceStats MemoryBandwidthTester::run_test(TestPattern pattern, size_t iterations, size_t num_threads,
+                                                 bool cache_aware, StorePolicy store_policy,
+                                                 MatrixMultiply::MatrixPrecision precision) {
+    if(aligned_buffers.empty()) return {0.0, 0.0, 0, 0.0};
+
+    size_t buffer_size = current_buffer_size;
+    std::vector<PerformanceStats> thread_results(num_threads);
+
+    // Pinning happens outside the measurement; workers keep their affinity between runs
+    pin_workers(num_threads);
+    if (sample_rings.size() < num_threads) {
+        sample_rings.resize(num_threads);
+    }
+    for (auto& ring : sample_rings) {
+        ring.clear();
+    }
+    size_t matrix_size = 0;
+    std::vector<MatrixMultiply::MatrixPerformanceStats> matrix_results;
+    last_gemm_stats = GemmStats{};
+    last_calibration = CalibrationStats{};
+    last_counters = PerfCounters::CounterValues{};
+    last_page_faults = PageFaultStats{};
+    last_access = AccessStats{};
+    last_decode = DecodeStats{};
+    last_proxy = ProxyStats{};
+    last_irregular = IrregularStats{};
+    last_energy = EnergyStats{};
+    std::vector<AccessPatterns::LineTraffic> traffic(num_threads);
+    std::vector<IrregularKernels::Work> work(num_threads);
+    for (auto& buffer : buffers) {
+        buffer.reset_page_cache_state();
+    }
+    if (counting) {
+        prepare_counters(num_threads);
+        for (size_t i = 0; i < num_threads; ++i) {
+            if (thread_counters[i]) thread_counters[i]->reset();
+        }
+        if (uncore_counters) uncore_counters->reset();
+    }
+    PerfCounters::SharedRegion uncore_region(uncore_counters.get());
+    const PatternRegistry::Pattern& registered = PatternRegistry::get(pattern);
+    const KernelMatrix::Kernel* tuned = tuned_kernel_for(pattern, store_policy, buffer_size, num_threads);
+    last_tuned = tuned;
+    if (cold) {
+        if (!registered.cold) {
+            throw ConfigurationError("Pattern '" + registered.name + "' does not support cold passes");
+        }
+        ColdCache::Evictor prototype(cold_method, ColdCache::eviction_bytes(cache_info, num_threads));
+        if (evictors.size() != num_threads || evictors.front().buffer_bytes() != prototype.buffer_bytes()) {
+            evictors.assign(num_threads, prototype);
+        }
+    }
+    if (registered.run == nullptr) {
+        matrix_size = matrix_size_for(buffer_size, cache_aware);
+        prepare_matrices(matrix_size, precision, num_threads);
+        matrix_results.assign(num_threads, MatrixMultiply::MatrixPerformanceStats{});
+    }
+
+    struct rusage faults_before = {};
+    getrusage(RUSAGE_SELF, &faults_before);
+    EnergyMeter::Snapshot energy_before;
+    auto energy_start = std::chrono::steady_clock::now();
+    if (energy_meter) {
+        energy_before = energy_meter->snapshot();
+        energy_start = std::chrono::steady_clock::now();
+    }
+    std::vector<ThreadTiming> timings = pool.run(num_threads,
+        [this, &registered, iterations, &thread_results, buffer_size, cache_aware, num_threads,
+         store_policy, matrix_size, precision, &matrix_results, &uncore_region, &traffic, &work, tuned](size_t i) {
+            size_t start_offset, end_offset;
+            std::tie(start_offset, end_offset) = thread_slice(i, num_threads, buffer_size);
+            SampleRing* samples = &sample_rings[i];
+            if (counting) {
+                PerfCounters::attach_thread(thread_counters[i].get(), &uncore_region);
+            }
+
+            if (registered.run != nullptr) {
+                // Patterns whose arrays were not allocated report nothing rather than overrun
+                if (aligned_buffers.size() >= PatternRegistry::arrays(registered, stream_counts)) {
+                    PatternRegistry::KernelContext context;
+                    context.buffers = &aligned_buffers;
+                    context.buffer_size = buffer_size;
+                    context.start_offset = start_offset;
+                    context.end_offset = end_offset;
+                    context.iterations = iterations;
+                    context.stop_flag = &stop_flag;
+                    context.cache_aware = cache_aware;
+                    context.kernel = kernel;
+                    context.store_policy = store_policy;
+                    context.samples = samples;
+                    context.prefetch_distance = prefetch_distance;
+                    context.chase = &chase_config;
+                    context.access = &access_config;
+                    context.streams = &stream_counts;
+                    context.traffic = &traffic[i];
+                    context.decode_bits = decode_bits;
+                    context.proxy = &proxy_config;
+                    context.irregular = &irregular_config;
+                    context.work = &work[i];
+                    context.cold = cold ? &evictors[i] : nullptr;
+                    context.tuned = tuned;
+                    thread_results[i] = registered.run(context);
+                }
+            } else {
+                size_t row_start, row_end;
+                std::tie(row_start, row_end) = matrix_row_slice(i, num_threads, matrix_size);
+                if (row_start == row_end) {
+                    thread_results[i] = PerformanceStats{};
+                } else {
+                    MatrixMultiply::MatrixConfig matrix_config =
+                        MatrixMultiply::create_matrix_config(matrix_size, iterations, precision);
+                    matrix_config.M = row_end - row_start;
+
+                    // Bands start at a row, so offsets are in bytes of each operand's element type
+                    size_t a_offset = row_start * matrix_size * MatrixMultiply::precision_operand_size(precision);
+                    size_t c_offset = row_start * matrix_size * MatrixMultiply::precision_accumulate_size(precision);
+                    auto matrix_stats = StandardTests::matrix_multiply_test(
+                        reinterpret_cast<unsigned char*>(matrix_c.data()) + c_offset,
+                        reinterpret_cast<const unsigned char*>(matrix_a.data()) + a_offset,
+                        matrix_b.data(), matrix_config, matrix_multipliers[i].get(), cache_info, stop_flag);
+                    matrix_results[i] = matrix_stats;
+
+                    // Convert matrix stats to PerformanceStats for compatibility
+                    PerformanceStats stats;
+                    stats.bandwidth_gbps = matrix_stats.bandwidth_gbps;
+                    stats.latency_ns = matrix_stats.latency_ns;
+                    stats.bytes_processed = matrix_stats.bytes_processed;
+                    stats.time_seconds = matrix_stats.time_seconds;
+                    thread_results[i] = stats;
+                }
+            }
+            PerfCounters::attach_thread(nullptr, nullptr);
+        });
+
+    EnergyMeter::Snapshot energy_after;
+    double energy_seconds = 0.0;
+    if (energy_meter) {
+        energy_seconds = std::chrono::duration<double>(std::chrono::steady_clock::now() - energy_start).count();
+        energy_after = energy_meter->snapshot();
+    }
+    struct rusage faults_after = {};
+    getrusage(RUSAGE_SELF, &faults_after);
+
+    PerformanceStats aggregated = aggregate_stats(thread_results, timings);
+    record_sample_stats(thread_results, num_threads);
+    if (file_backing.enabled()) {
+        record_page_faults(faults_before, faults_after, WorkerPool::span_seconds(timings));
+    }
+    if (counting) {
+        for (size_t i = 0; i < num_threads; ++i) {
+            if (thread_counters[i]) last_counters += thread_counters[i]->read();
+        }
+        if (uncore_counters) last_counters += uncore_counters->read();
+    }
+    if (pattern == TestPattern::MATRIX_MULTIPLY) {
+        // One cooperative product: it is only finished when the last band is
+        aggregated.time_seconds = WorkerPool::span_seconds(timings);
+        aggregated.bandwidth_gbps = (aggregated.time_seconds > 0.0)
+            ? aggregated.bytes_processed / (aggregated.time_seconds * 1e9) : 0.0;
+        double accesses = static_cast<double>(aggregated.bytes_processed) / CacheConstants::DEFAULT_CACHE_LINE_SIZE;
+        aggregated.latency_ns = (accesses >= 1.0) ? (aggregated.time_seconds * 1e9) / accesses : 0.0;
+        record_gemm_stats(matrix_results, aggregated, matrix_size, precision);
+    }
+    if (cold) {
+        // Pool timings include the evictions; each kernel's own clock leaves them out
+        double slowest = 0.0;
+        for (const auto& result : thread_results) {
+            slowest = std::max(slowest, result.time_seconds);
+        }
+        aggregated.time_seconds = slowest;
+        aggregated.bandwidth_gbps = (slowest > 0.0) ? aggregated.bytes_processed / (slowest * 1e9) : 0.0;
+        double accesses = static_cast<double>(aggregated.bytes_processed) / CacheConstants::DEFAULT_CACHE_LINE_SIZE;
+        aggregated.latency_ns = (accesses >= 1.0) ? (slowest * 1e9) / accesses : 0.0;
+    }
+    if (pattern == TestPattern::LATENCY_CHASE) {
+        // Chains are walked independently; report the mean time per hop, not time per aggregate line
+        double latency_sum = 0.0;
+        for (const auto& result : thread_results) {
+            latency_sum += result.latency_ns;
+        }
+        aggregated.latency_ns = latency_sum / num_threads;
+    }
+    if (is_sparse(pattern)) {
+        record_access_stats(pattern, aggregated, traffic);
+    }
+    if (registered.encoded) {
+        record_decode_stats(pattern, aggregated);
+    }
+    if (registered.proxy) {
+        record_proxy_stats(pattern, aggregated);
+    }
+    if (registered.irregular) {
+        record_irregular_stats(pattern, aggregated, work, buffer_size, num_threads);
+    }
+    if (energy_meter) {
+        record_energy_stats(aggregated, energy_before, energy_after, energy_seconds);
+    }
+    return aggregated;
+}
+
+PerformanceStats MemoryBandwidthTester::run_calibrated_test(TestPattern pattern, size_t num_threads,
+                                                            StorePolicy store_policy,
+                                                            MatrixMultiply::MatrixPrecision precision) {
+    std::vector<RunDetails> runs;
+    Calibration::Result calibrated = Calibration::measure(
+        [&](size_t iterations) {
+            PerformanceStats stats = run_test(pattern, iterations, num_threads, true, store_policy, precision);
+            runs.push_back({last_bandwidth_distribution, last_bandwidth_samples, last_latency_distribution,
+                            last_thread_stats, last_gemm_stats, last_matrix_acceleration, last_counters,
+                            last_page_faults, last_access, last_decode, last_proxy, last_irregular, last_energy});
+            return stats;
+        },
+        calibration_settings);
+
+    const RunDetails& median = runs[calibrated.median_call];
+    last_bandwidth_distribution = median.bandwidth_distribution;
+    last_bandwidth_samples = median.bandwidth_samples;
+    last_latency_distribution = median.latency_distribution;
+    last_thread_stats = median.thread_stats;
+    last_gemm_stats = median.gemm;
+    last_matrix_acceleration = median.matrix_acceleration;
+    last_counters = median.counters;
+    last_page_faults = median.page_faults;
+    last_access = median.access;
+    last_decode = median.decode;
+    last_proxy = median.proxy;
+    last_irregular = median.irregular;
+    last_energy = median.energy;
+    last_calibration = {calibrated.iterations, calibrated.repetitions, calibrated.ci_percent,
+                        calibrated.converged};
+    return calibrated.stats;
+}
+
+std::vector<TestResult> MemoryBandwidthTester::run_cache_aware_test(
+        TestPattern pattern, size_t iterations, size_t num_threads, const std::vector<StorePolicy>& store_policies,
+        const std::vector<MatrixMultiply::MatrixPrecision>& precisions) {
+    std::vector<TestResult> results;
+    num_threads = threads_for(pattern, num_threads);
+    auto [sizes, descriptions] =
+        WorkingSetSizes::get_thread_aware_sizes(cache_info, num_threads, worker_cpus(num_threads));
+
+    for(size_t i = 0; i < sizes.size(); ++i) {
+        size_t working_set_size = sizes[i];
+        if(working_set_size < MIN_WORKING_SET_SIZE) continue;
+
+        try {
+            if(!allocate_pattern_buffers({pattern}, working_set_size, num_threads)) continue;
+        } catch (const MemoryError& e) {
+            // Skip this working set size if allocation fails
+            std::cerr << "Warning: " << e.what() << ". Skipping working set size." << std::endl;
+            continue;
+        }
+
+        size_t scaled_iterations;
+        if (pattern == TestPattern::MATRIX_MULTIPLY) {
+            // Matrix multiplication is computationally intensive, so use fewer iterations
+            scaled_iterations = std::max(static_cast<size_t>(1), iterations / 10);
+        } else if (pattern == TestPattern::LATENCY_CHASE) {
+            // Every chase pass already has a minimum hop count sized for small caches
+            scaled_iterations = iterations;
+        } else {
+            scaled_iterations = MemoryUtils::scale_iterations(iterations, working_set_size);
+        }
+
+        // Store policies and precisions for the same working set are reported side by side
+        for(StorePolicy store_policy : store_policies_for(pattern, store_policies)) {
+            for(MatrixMultiply::MatrixPrecision precision : precisions_for(pattern, precisions)) {
+                PerformanceStats stats = calibrating
+                    ? run_calibrated_test(pattern, num_threads, store_policy, precision)
+                    : run_test(pattern, scaled_iterations, num_threads, true, store_policy, precision);
+
+                TestResult result;
+                result.test_name = test_name_for(pattern, precision);
+                result.working_set_desc = descriptions[i];
+                result.stats = stats;
+                result.num_threads = num_threads;
+                result.pattern_name = get_pattern_name(pattern);
+                result.kernel_name = kernel_name_for(pattern);
+                result.store_policy = store_policy_name_for(pattern, store_policy);
+                result.warnings = validate_result(pattern, stats, num_threads);
+                attach_sample_stats(result);
+                record_result(result, "cache_hierarchy");
+
+                results.push_back(result);
+            }
+        }
+    }
+    return results;
+}
+
+std::vector<NumaMatrixEntry> MemoryBandwidthTester::run_numa_matrix(
+        TestPattern pattern, size_t iterations, size_t num_threads, size_t total_size, StorePolicy store_policy) {
+    std::vector<NumaMatrixEntry> entries;
+
+    for(const auto& memory_node : numa_topology.nodes) {
+        if(memory_node.memory_bytes == 0) continue;  // CPU-only node
+        if(total_size > memory_node.memory_bytes) {
+            std::cerr << "Warning: " << total_size << " bytes do not fit on NUMA node " << memory_node.id
+                      << ". Skipping memory node." << std::endl;
+            continue;
+        }
+
+        // Set the policy before the first touch so pages are placed, not migrated
+        allocate_pattern_buffers({pattern}, total_size, threads_for(pattern, num_threads), false);
+        for(auto& buffer : buffers) {
+            if(!platform->bind_memory_to_numa_node(buffer.data(), buffer.size(), memory_node.id)) {
+                cleanup_buffers();
+                throw PlatformError("Failed to bind test buffers to NUMA node " +
+                                    std::to_string(memory_node.id) + ": " + std::strerror(errno));
+            }
+        }
+        first_touch_buffers(threads_for(pattern, num_threads));
+
+        for(const auto& cpu_node : numa_topology.nodes) {
+            if(cpu_node.cpus.empty()) continue;  // Memory-only node (e.g. CXL)
+
+            size_t node_threads = std::min(threads_for(pattern, num_threads), cpu_node.cpus.size());
+            numa_thread_binding = true;
+            numa_cpu_node = cpu_node.id;
+            PerformanceStats stats = run_test(pattern, iterations, node_threads, false, store_policy);
+            numa_thread_binding = false;
+
+            entries.push_back({cpu_node.id, memory_node.id, node_threads, stats});
+        }
+    }
+    cleanup_buffers();
+    return entries;
+}
+
+std::vector<MemoryTiers::Point> MemoryBandwidthTester::run_memory_tiers(
+        TestPattern pattern, size_t iterations, size_t num_threads, size_t total_size, StorePolicy store_policy,
+        const std::vector<MemoryTiers::Ratio>& ratios) {
+    MemoryTiers::Tiers tiers = MemoryTiers::select_tiers(numa_topology);
+    const NumaNode* local = NumaUtils::find_node(numa_topology, tiers.local_node);
+    size_t node_threads = std::min(threads_for(pattern, num_threads), local->cpus.size());
+    std::vector<MemoryTiers::Point> points;
+
+    for(size_t far_node : tiers.far_nodes) {
+        const NumaNode* far = NumaUtils::find_node(numa_topology, far_node);
+        for(const auto& ratio : ratios) {
+            // Each node must hold its share of every buffer
+            double share = MemoryTiers::far_share(ratio);
+            if(total_size * (1.0 - share) > local->memory_bytes || total_size * share > far->memory_bytes) {
+                std::cerr << "Warning: " << total_size << " bytes at " << MemoryTiers::ratio_to_string(ratio)
+                          << " do not fit on NUMA nodes " << local->id << " and " << far_node
+                          << ". Skipping ratio." << std::endl;
+                continue;
+            }
+
+            MemoryTiers::Point point;
+            point.local_node = local->id;
+            point.far_node = far_node;
+            point.ratio = ratio;
+            point.num_threads = node_threads;
+
+            // Set the policy before the first touch so pages are placed, not migrated
+            allocate_pattern_buffers({pattern}, total_size, node_threads, false);
+            std::vector<NumaWeight> weights = MemoryTiers::weights_for(ratio, local->id, far_node);
+            for(auto& buffer : buffers) {
+                if(!platform->interleave_memory_across_numa_nodes(buffer.data(), buffer.size(), weights,
+                                                                  point.policy)) {
+                    cleanup_buffers();
+                    throw PlatformError("Failed to place test buffers at " + MemoryTiers::ratio_to_string(ratio) +
+                                        " on NUMA nodes " + std::to_string(local->id) + " and " +
+                                        std::to_string(far_node) + ": " + std::strerror(errno));
+                }
+            }
+            first_touch_buffers(node_threads);
+
+            size_t far_pages = 0;
+            size_t resident_pages = 0;
+            for(const auto& buffer : buffers) {
+                for(const auto& node_pages : NumaUtils::count_pages_by_node(buffer.data(), buffer.size())) {
+                    resident_pages += node_pages.second;
+                    if(node_pages.first == far_node) far_pages += node_pages.second;
+                }
+            }
+            if(resident_pages > 0) {
+                point.far_page_share = static_cast<double>(far_pages) / static_cast<double>(resident_pages);
+            }
+
+            numa_thread_binding = true;
+            numa_cpu_node = local->id;
+            point.stats = run_test(pattern, iterations, node_threads, false, store_policy);
+            numa_thread_binding = false;
+            points.push_back(point);
+        }
+    }
+    cleanup_buffers();
+    return points;
+}
+
+std::vector<size_t> MemoryBandwidthTester::core_to_core_cpus(const std::string& list) const {
+    std::vector<size_t> online;
+    for(const auto& node : numa_topology.nodes) {
+        online.insert(online.end(), node.cpus.begin(), node.cpus.end());
+    }
+    std::sort(online.begin(), online.end());
+    if(list.empty()) {
+        return online;
+    }
+
+    std::vector<size_t> cpus = NumaUtils::parse_id_list(list);
+    if(cpus.empty()) {
+        throw ConfigurationError("Invalid CPU list '" + list + "'. Expected a list such as 0-3,8");
+    }
+    for(size_t cpu : cpus) {
+        if(!std::binary_search(online.begin(), online.end(), cpu)) {
+            throw ConfigurationError("CPU " + std::to_string(cpu) + " in --cpus is not online");
+        }
+    }
+    std::sort(cpus.begin(), cpus.end());
+    cpus.erase(std::unique(cpus.begin(), cpus.end()), cpus.end());
+    return cpus;
+}
+
+bool MemoryBandwidthTester::pins_single_cpus() const {
+    return platform->supports_cpu_affinity() && platform->get_platform_name() != "macOS";
+}
+
+CoherenceTests::PinFunction MemoryBandwidthTester::cpu_pinning(size_t total_threads) const {
+    PlatformInterface* target = platform.get();
+    return [target, total_threads](size_t cpu) {
+        target->set_thread_affinity(cpu, CPUAffinityType::DEFAULT, total_threads);
+    };
+}
+
+std::vector<CoherenceTests::PingPongResult> MemoryBandwidthTester::run_core_to_core(const std::vector<size_t>& cpus) {
+    if(!pins_single_cpus()) {
+        return {};
+    }
+    return CoherenceTests::measure_core_to_core(cpus, BenchmarkConstants::PING_PONG_ROUND_TRIPS,
+                                                BenchmarkConstants::PING_PONG_BATCHES, cpu_pinning(cpus.size()));
+}
+
+std::vector<CoherenceTests::FalseSharingResult> MemoryBandwidthTester::run_false_sharing(
+        const std::vector<size_t>& cpus, size_t num_threads) {
+    CoherenceTests::PinFunction pin = pins_single_cpus() ? cpu_pinning(cpus.size()) : nullptr;
+    size_t max_threads = std::min(std::max<size_t>(num_threads, 2), CoherenceTests::MAX_PACKED_COUNTERS);
+
+    std::vector<CoherenceTests::FalseSharingResult> results;
+    for(size_t threads : BenchmarkConstants::FALSE_SHARING_THREADS) {
+        if(threads > max_threads) break;
+        std::vector<size_t> placement;
+        for(size_t t = 0; t < threads; ++t) {
+            placement.push_back(cpus[t % cpus.size()]);
+        }
+        for(auto layout : {CoherenceTests::CounterLayout::PACKED, CoherenceTests::CounterLayout::PADDED}) {
+            results.push_back(CoherenceTests::measure_false_sharing(
+                placement, BenchmarkConstants::FALSE_SHARING_INCREMENTS, layout, pin));
+        }
+    }
+    return results;
+}
+
+std::vector<AtomicTests::Result> MemoryBandwidthTester::run_atomics(size_t num_threads) {
+    std::vector<size_t> cpus = core_to_core_cpus("");
+    if(cpus.empty()) {
+        cpus.push_back(0);
+    }
+    CoherenceTests::PinFunction pin = pins_single_cpus() ? cpu_pinning(num_threads) : nullptr;
+
+    std::vector<AtomicTests::Result> results;
+    for(size_t threads : AtomicTests::thread_counts(num_threads)) {
+        std::vector<size_t> placement;
+        for(size_t t = 0; t < threads; ++t) {
+            placement.push_back(cpus[t % cpus.size()]);
+        }
+        for(auto op : {AtomicTests::Operation::FETCH_ADD, AtomicTests::Operation::CAS_LOOP}) {
+            for(auto ordering : {AtomicTests::Ordering::RELAXED, AtomicTests::Ordering::SEQ_CST}) {
+                for(auto sharing : {AtomicTests::Sharing::SHARED, AtomicTests::Sharing::PRIVATE}) {
+                    for(auto impl : AtomicTests::supported_implementations()) {
+                        AtomicTests::Config atomic_config;
+                        atomic_config.op = op;
+                        atomic_config.ordering = ordering;
+                        atomic_config.sharing = sharing;
+                        atomic_config.impl = impl;
+                        atomic_config.ops_per_thread = BenchmarkConstants::ATOMIC_OPS_PER_THREAD;
+                        results.push_back(AtomicTests::run(atomic_config, placement, pin));
+                    }
+                }
+            }
+        }
+    }
+    return results;
+}
+
+std::vector<MappingTests::Result> MemoryBandwidthTester::run_mapping_costs(
+        const std::vector<MappingTests::Operation>& ops, size_t bytes, size_t repetitions,
+        const std::vector<size_t>& thread_counts) {
+    std::vector<MappingTests::Result> results;
+    for(MappingTests::Operation op : ops) {
+        if(!MappingTests::uses_threads(op)) {
+            CoherenceTests::PinFunction pin = pins_single_cpus() ? cpu_pinning(1) : nullptr;
+            results.push_back(MappingTests::run(op, bytes, repetitions, worker_cpus(1), pin));
+        }
+    }
+    for(size_t threads : thread_counts) {
+        std::vector<size_t> cpus = worker_cpus(threads);
+        CoherenceTests::PinFunction pin = pins_single_cpus() ? cpu_pinning(threads) : nullptr;
+        for(MappingTests::Operation op : ops) {
+            if(MappingTests::uses_threads(op)) {
+                results.push_back(MappingTests::run(op, bytes, repetitions, cpus, pin));
+            }
+        }
+    }
+    return results;
+}
+
+std::vector<TlbSweep::Curve> MemoryBandwidthTester::run_tlb_sweep(const std::vector<PageMode>& modes,
+                                                                   size_t max_bytes, size_t repetitions) {
+    CoherenceTests::PinFunction pin = pins_single_cpus() ? cpu_pinning(1) : nullptr;
+    return TlbSweep::run(modes, max_bytes, repetitions, worker_cpus(1).front(), pin);
+}
+
+std::vector<CopySweep::Point> MemoryBandwidthTester::run_copy_sweep(
+        const std::vector<CopySweep::Operation>& operations,
+        const std::vector<CopySweep::Implementation>& implementations,
+        const std::vector<CopySweep::Alignment>& alignments, const std::vector<size_t>& sizes, size_t repetitions) {
+    CoherenceTests::PinFunction pin = pins_single_cpus() ? cpu_pinning(1) : nullptr;
+    return CopySweep::run(operations, implementations, alignments, sizes, repetitions, worker_cpus(1).front(), pin);
+}
+
+std::vector<RingTransfer::Result> MemoryBandwidthTester::run_ring_transfers(
+        const std::vector<RingTransfer::Kind>& kinds, const std::vector<size_t>& payloads,
+        const std::vector<size_t>& cpus, size_t repetitions) {
+    if(!pins_single_cpus()) {
+        return {};
+    }
+    return RingTransfer::run(kinds, payloads, cpus, cpu_topology, cache_info, repetitions, cpu_pinning(2));
+}
+
+std::vector<AllocatorBench::Result> MemoryBandwidthTester::run_allocator_bench(
+        const std::vector<AllocatorBench::AllocatorSpec>& allocators,
+        const std::vector<AllocatorBench::Workload>& workloads, const std::vector<size_t>& thread_counts) {
+    std::vector<AllocatorBench::Result> results;
+    for(size_t threads : thread_counts) {
+        std::vector<size_t> cpus = worker_cpus(threads);
+        CoherenceTests::PinFunction pin = pins_single_cpus() ? cpu_pinning(threads) : nullptr;
+        for(AllocatorBench::Workload workload : workloads) {
+            size_t ops = (workload == AllocatorBench::Workload::FRAGMENTATION)
+                             ? BenchmarkConstants::ALLOC_FRAGMENTATION_OPS
+                             : BenchmarkConstants::ALLOC_OPS_PER_THREAD;
+            for(const auto& allocator : allocators) {
+                results.push_back(AllocatorBench::run(allocator, workload, ops, cpus, pin));
+            }
+        }
+    }
+    return results;
+}
+
+std::vector<LoadedLatencyPoint> MemoryBandwidthTester::run_loaded_latency(TestPattern load_pattern, size_t iterations,
+                                                                          size_t num_threads, size_t total_size,
+                                                                          StorePolicy store_policy) {
+    std::vector<LoadedLatencyPoint> points;
+    size_t load_threads = (num_threads > 1) ? num_threads - 1 : 0;
+    if(load_threads == 0) {
+        std::cerr << "Warning: --loaded-latency needs at least 2 threads; reporting idle latency only"
+                  << std::endl;
+    }
+
+    // Source, destination and probe buffers
+    allocate_buffers(total_size, 3, num_threads);
+
+    points.push_back(measure_loaded_latency(load_pattern, iterations, 0, 0, store_policy));
+    if(load_threads > 0) {
+        for(size_t delay_spins : BenchmarkConstants::LOADED_LATENCY_DELAYS) {
+            points.push_back(
+                measure_loaded_latency(load_pattern, iterations, load_threads, delay_spins, store_policy));
+        }
+    }
+    cleanup_buffers();
+    return points;
+}
+
+std::vector<GpuBandwidth::Point> MemoryBandwidthTester::run_gpu_bandwidth(
+        const std::vector<GpuBandwidth::Kernel>& kernels, size_t num_threads, size_t total_size) {
+    std::unique_ptr<GpuBandwidth::Device> device = platform->create_gpu_device();
+    if(!device) {
+        throw PlatformError("--gpu needs a GPU that shares memory with the CPU (Apple Silicon with Metal); "
+                            "this platform has none");
+    }
+
+    // GPU a, b and c, then the CPU threads' source and destination; GPU buffers must be whole pages
+    size_t page = device->page_size();
+    allocate_buffers(total_size, 5, num_threads, true, page);
+    size_t array_bytes = current_buffer_size / page * page;
+    if(array_bytes == 0) {
+        cleanup_buffers();
+        throw MemoryError("--gpu arrays of " + std::to_string(current_buffer_size) +
+                          " bytes are smaller than one " + std::to_string(page) + "-byte page");
+    }
+
+    GpuBandwidth::Arrays arrays;
+    arrays.a = reinterpret_cast<float*>(aligned_buffers[0]);
+    arrays.b = reinterpret_cast<const float*>(aligned_buffers[1]);
+    arrays.c = reinterpret_cast<const float*>(aligned_buffers[2]);
+    arrays.count = array_bytes / sizeof(float);
+    GpuBandwidth::fill(arrays.a, reinterpret_cast<float*>(aligned_buffers[1]),
+                       reinterpret_cast<float*>(aligned_buffers[2]), arrays.count);
+
+    std::vector<GpuBandwidth::Point> points;
+    try {
+        for(GpuBandwidth::Kernel gpu_kernel : kernels) {
+            points.push_back(measure_gpu_bandwidth(*device, gpu_kernel, arrays, num_threads));
+        }
+    } catch (...) {
+        cleanup_buffers();
+        throw;
+    }
+    cleanup_buffers();
+    return points;
+}
+
+std::vector<Contention::ContentionPoint> MemoryBandwidthTester::run_contention(
+        TestPattern victim_pattern, Contention::Aggressor aggressor, size_t iterations, size_t victim_threads,
+        size_t num_threads, size_t total_size, const std::string& victim_schemata,
+        const std::string& aggressor_schemata, StorePolicy store_policy) {
+    size_t aggressor_threads = num_threads - victim_threads;
+    Contention::ResctrlGroup victim_group;
+    Contention::ResctrlGroup aggressor_group;
+    join_resctrl_group(victim_group, "membench_victim", victim_schemata, 0, victim_threads);
+    join_resctrl_group(aggressor_group, "membench_aggressor", aggressor_schemata, victim_threads, num_threads);
+
+    // Victim source and destination, aggressor source and destination
+    allocate_buffers(total_size, 4, num_threads);
+
+    std::vector<Contention::ContentionPoint> points;
+    points.push_back(measure_contention(victim_pattern, aggressor, iterations, victim_threads, 0, 0,
+                                        store_policy));
+    for(size_t delay_spins : BenchmarkConstants::LOADED_LATENCY_DELAYS) {
+        points.push_back(measure_contention(victim_pattern, aggressor, iterations, victim_threads,
+                                            aggressor_threads, delay_spins, store_policy));
+    }
+    cleanup_buffers();
+    Contention::annotate(points);
+    return points;
+}
+
+std::vector<Soak::Sample> MemoryBandwidthTester::run_soak(TestPattern pattern, size_t num_threads, size_t total_size,
+                                                          double duration_seconds, size_t interval_ms,
+                                                          StorePolicy store_policy) {
+    allocate_buffers(total_size, 2, num_threads);
+    size_t buffer_size = current_buffer_size;
+    pin_workers(num_threads);
+
+    std::vector<Soak::ProgressSlot> slots(num_threads);
+    std::atomic<bool> soak_stop(false);
+    std::vector<Soak::Sample> samples;
+    std::thread sampler([&]() {
+        samples = Soak::run_sampler(slots, worker_cpus(num_threads), duration_seconds, interval_ms, soak_stop);
+    });
+
+    try {
+        pool.run(num_threads, [&](size_t i) {
+            size_t start_offset, end_offset;
+            std::tie(start_offset, end_offset) = thread_slice(i, num_threads, buffer_size);
+            StandardTests::throttled_load_test(aligned_buffers[0], aligned_buffers[1], buffer_size, start_offset,
+                                               end_offset, pattern, 0, soak_stop, kernel, store_policy,
+                                               &slots[i].bytes);
+        });
+    } catch (...) {
+        soak_stop = true;
+        sampler.join();
+        throw;
+    }
+    sampler.join();
+    cleanup_buffers();
+    return samples;
+}
+
+std::vector<PrefetchPoint> MemoryBandwidthTester::run_prefetch_sweep(
+        TestPattern pattern, size_t iterations, size_t num_threads, size_t total_size,
+        PrefetchControl::HardwareMode hardware) {
+    std::vector<bool> disabled_states = {hardware_prefetchers_disabled};
+    if (hardware == PrefetchControl::HardwareMode::BOTH) {
+        disabled_states.push_back(true);
+    }
+
+    allocate_buffers(total_size, 1, num_threads);
+    size_t configured_distance = prefetch_distance;
+    std::vector<PrefetchPoint> points;
+    for (bool disabled : disabled_states) {
+        set_hardware_prefetchers(!disabled);
+        for (size_t distance : PrefetchControl::sweep_distances()) {
+            prefetch_distance = distance;
+            PerformanceStats stats = run_test(pattern, iterations, num_threads);
+            points.push_back({distance, disabled, stats.bandwidth_gbps, stats.latency_ns, 0.0});
+        }
+    }
+    if (hardware == PrefetchControl::HardwareMode::BOTH) {
+        set_hardware_prefetchers(true);
+    }
+    prefetch_distance = configured_distance;
+    cleanup_buffers();
+
+    double baseline = points.front().bandwidth_gbps;
+    for (auto& point : points) {
+        point.delta_percent = baseline > 0.0 ? (point.bandwidth_gbps / baseline - 1.0) * 100.0 : 0.0;
+    }
+    return points;
+}
+
+std::vector<ThreadScaling::ScalingPoint> MemoryBandwidthTester::run_thread_scaling(
+        TestPattern pattern, size_t iterations, const std::vector<size_t>& counts, StorePolicy store_policy,
+        MatrixMultiply::MatrixPrecision precision) {
+    std::vector<ThreadScaling::ScalingPoint> points;
+    for (size_t threads : counts) {
+        PerformanceStats stats = run_test(pattern, iterations, threads, false, store_policy, precision);
+        ThreadScaling::ScalingPoint point;
+        point.threads = threads;
+        point.bandwidth_gbps = stats.bandwidth_gbps;
+        point.latency_ns = stats.latency_ns;
+        point.energy_measured = last_energy.measured;
+        point.package_watts = last_energy.package_watts;
+        point.dram_watts = last_energy.dram_watts;
+        point.pj_per_byte = last_energy.pj_per_byte;
+        points.push_back(point);
+    }
+    ThreadScaling::annotate(points);
+    return points;
+}
+
+std::vector<PeakCalibration::Ceiling> MemoryBandwidthTester::run_peak_calibration(
+        size_t iterations, const std::vector<size_t>& counts, size_t total_size) {
+    const std::pair<const char*, TestPattern> families[] = {{"read", TestPattern::SEQUENTIAL_READ},
+                                                            {"write", TestPattern::SEQUENTIAL_WRITE},
+                                                            {"copy", TestPattern::COPY}};
+    if (!allocate_pattern_buffers({TestPattern::SEQUENTIAL_READ, TestPattern::SEQUENTIAL_WRITE, TestPattern::COPY},
+                                  total_size, counts.back())) {
+        throw MemoryError("Failed to allocate memory buffers for peak calibration with size " +
+                          std::to_string(total_size) + " bytes");
+    }
+    std::vector<StorePolicy> policies = SimdKernels::parse_store_policies("all", kernel);
+
+    std::vector<PeakCalibration::Ceiling> ceilings;
+    for (const auto& [family, pattern] : families) {
+        for (StorePolicy store_policy : store_policies_for(pattern, policies)) {
+            std::vector<ThreadScaling::ScalingPoint> points = run_thread_scaling(
+                pattern, iterations, counts, store_policy, MatrixMultiply::MatrixPrecision::FP32);
+            ceilings.push_back(PeakCalibration::best_point(
+                family, test_name_for(pattern, MatrixMultiply::MatrixPrecision::FP32), kernel_name_for(pattern),
+                store_policy_name_for(pattern, store_policy), points));
+        }
+    }
+    return PeakCalibration::best_per_family(ceilings);
+}
+
+std::vector<PeakCalibration::TunedShape> MemoryBandwidthTester::run_tune(size_t num_threads, size_t total_size) {
+    std::vector<std::pair<std::string, size_t>> levels;
+    if (cache_info.l1_data_size > 0) levels.push_back({"L1", cache_info.l1_data_size / 2 * num_threads});
+    if (cache_info.l2_size > 0) levels.push_back({"L2", cache_info.l2_size / 2 * num_threads});
+    if (cache_info.l3_size > 0) levels.push_back({"L3", cache_info.l3_size / 2});
+    levels.push_back({"DRAM", total_size});
+
+    std::string dram_level = KernelMatrix::working_set_level(cache_info, total_size, num_threads);
+    if (dram_level != "DRAM") {
+        std::cerr << "Warning: the " << total_size << "-byte working set fits in " << dram_level
+                  << "; no DRAM shape is tuned. Use a larger --size." << std::endl;
+    }
+
+    std::vector<PeakCalibration::TunedShape> tuned;
+    std::set<std::pair<KernelMatrix::Family, std::string>> measured;  // Includes levels the kernel's loop won
+    tuning = true;
+    for (TestPattern pattern : {TestPattern::SEQUENTIAL_READ, TestPattern::SEQUENTIAL_WRITE, TestPattern::TRIAD}) {
+        KernelMatrix::Family family = KernelMatrix::Family::READ;
+        tuned_family(pattern, family);
+        for (const auto& [name, level_size] : levels) {
+            if (level_size < MIN_WORKING_SET_SIZE * 4) continue;
+            try {
+                allocate_pattern_buffers({pattern}, level_size, num_threads);
+            } catch (const MemoryError& e) {
+                std::cerr << "Warning: " << e.what() << ". Skipping " << name << " tuning level." << std::endl;
+                continue;
+            }
+            // Levels are named as runs will look them up; a shared L3 no larger than the private caches adds none
+            std::string level = KernelMatrix::working_set_level(
+                cache_info, current_buffer_size * arrays_for(pattern), num_threads);
+            if (!measured.insert({family, level}).second) continue;
+            bool cache_aware = level != "DRAM";
+
+            std::vector<std::pair<double, const KernelMatrix::Kernel*>> ranked;
+            for (const auto& shape : KernelMatrix::shapes(family)) {
+                tuning_kernel = KernelMatrix::find(family, shape);
+                double bandwidth = measure_tuning(pattern, num_threads, cache_aware, false).bandwidth_gbps;
+                if (bandwidth > 0.0) ranked.push_back({bandwidth, tuning_kernel});
+            }
+            if (ranked.empty()) continue;
+            std::sort(ranked.begin(), ranked.end(),
+                      [](const auto& a, const auto& b) { return a.first > b.first; });
+            ranked.resize(std::min(ranked.size(), TUNE_FINALISTS));
+
+            PeakCalibration::TunedShape best;
+            best.family = KernelMatrix::family_to_string(family);
+            best.level = level;
+            best.threads = num_threads;
+            for (const auto& finalist : ranked) {
+                tuning_kernel = finalist.second;
+                double bandwidth = measure_tuning(pattern, num_threads, cache_aware, true).bandwidth_gbps;
+                if (bandwidth > best.bandwidth_gbps) {
+                    best.bandwidth_gbps = bandwidth;
+                    best.shape = KernelMatrix::shape_to_string(finalist.second->shape);
+                }
+            }
+            tuning_kernel = nullptr;
+            best.baseline_gbps = measure_tuning(pattern, num_threads, cache_aware, true).bandwidth_gbps;
+            // Where no shape beats the kernel's own loop, runs keep that loop
+            if (!best.shape.empty() && best.bandwidth_gbps > best.baseline_gbps) tuned.push_back(best);
+        }
+    }
+    tuning = false;
+    cleanup_buffers();
+    return tuned;
+}
+
+Roofline MemoryBandwidthTester::run_roofline(size_t iterations, size_t num_threads, size_t total_size,
+                                             const std::vector<MatrixMultiply::MatrixPrecision>& precisions) {
+    std::vector<std::pair<std::string, size_t>> levels;
+    if (cache_info.l1_data_size > 0) levels.push_back({"L1", cache_info.l1_data_size / 2 * num_threads});
+    if (cache_info.l2_size > 0) levels.push_back({"L2", cache_info.l2_size / 2 * num_threads});
+    if (cache_info.l3_size > 0) levels.push_back({"L3", cache_info.l3_size / 2});
+    levels.push_back({"DRAM", total_size});
+
+    Roofline roofline;
+    size_t previous_size = 0;
+    for (const auto& [level, level_size] : levels) {
+        // A shared L3 smaller than the private caches of all threads adds no new roof
+        if (level_size < MIN_WORKING_SET_SIZE * 4 || level_size <= previous_size) continue;
+        previous_size = level_size;
+
+        size_t scaled_iterations = MemoryUtils::scale_iterations(iterations, level_size);
+        try {
+            allocate_pattern_buffers({TestPattern::TRIAD}, level_size, num_threads);
+        } catch (const MemoryError& e) {
+            std::cerr << "Warning: " << e.what() << ". Skipping " << level << " roofline level." << std::endl;
+            continue;
+        }
+        PerformanceStats triad = calibrating
+            ? run_calibrated_test(TestPattern::TRIAD, num_threads, StorePolicy::TEMPORAL,
+                                  MatrixMultiply::MatrixPrecision::FP32)
+            : run_test(TestPattern::TRIAD, scaled_iterations, num_threads, true);
+        roofline.ceilings.push_back({level, "memory", triad.bandwidth_gbps, 0.0});
+
+        allocate_buffers(level_size, 1, num_threads);
+        for (size_t flops : BenchmarkConstants::ROOFLINE_FLOPS_PER_ELEMENT) {
+            size_t passes = std::max<size_t>(1, scaled_iterations * BenchmarkConstants::ROOFLINE_BYTES_PER_ELEMENT /
+                                                    std::max(flops, BenchmarkConstants::ROOFLINE_BYTES_PER_ELEMENT));
+            PerformanceStats stats = calibrating
+                ? Calibration::measure([&](size_t iterations) {
+                      return run_intensity_sweep_point(iterations, num_threads, flops);
+                  }, calibration_settings).stats
+                : run_intensity_sweep_point(passes, num_threads, flops);
+            double intensity = static_cast<double>(flops) / BenchmarkConstants::ROOFLINE_BYTES_PER_ELEMENT;
+            roofline.points.push_back({level, current_buffer_size, intensity, stats.bandwidth_gbps * intensity,
+                                       stats.bandwidth_gbps});
+        }
+    }
+
+    double fp64_peak = 0.0;
+    for (const auto& point : roofline.points) {
+        fp64_peak = std::max(fp64_peak, point.gflops);
+    }
+    for (auto& ceiling : roofline.ceilings) {
+        ceiling.ridge_intensity = (ceiling.value > 0.0) ? fp64_peak / ceiling.value : 0.0;
+    }
+    roofline.ceilings.push_back({"FP64 FMA (roofline kernel)", "compute", fp64_peak, 0.0});
+
+    // GEMM sizes its own matrices; the last level's buffers only keep run_test going
+    size_t gemm_iterations = std::max(static_cast<size_t>(1), iterations / 10);
+    for (MatrixMultiply::MatrixPrecision precision : precisions) {
+        run_test(TestPattern::MATRIX_MULTIPLY, gemm_iterations, num_threads, false, StorePolicy::TEMPORAL,
+                 precision);
+        if (last_gemm_stats.gops > 0.0) {
+            roofline.ceilings.push_back({"GEMM " + last_gemm_stats.precision + " (" + last_matrix_acceleration + ")",
+                                         "compute", last_gemm_stats.gops, 0.0});
+        }
+    }
+    cleanup_buffers();
+    return roofline;
+}
+
+WorkingSetSweep MemoryBandwidthTester::run_working_set_sweep(size_t max_size, size_t steps_per_octave,
+                                                             size_t iterations) {
+    WorkingSetSweep sweep;
+    sweep.steps_per_octave = steps_per_octave;
+
+    for (size_t size : WorkingSetSizes::get_sweep_sizes(max_size, steps_per_octave)) {
+        try {
+            if (!allocate_buffers(size, 1, 1)) continue;
+        } catch (const MemoryError& e) {
+            std::cerr << "Warning: " << e.what() << ". Skipping working set size." << std::endl;
+            continue;
+        }
+
+        PerformanceStats read = calibrating
+            ? run_calibrated_test(TestPattern::SEQUENTIAL_READ, 1, StorePolicy::TEMPORAL,
+                                  MatrixMultiply::MatrixPrecision::FP32)
+            : run_test(TestPattern::SEQUENTIAL_READ, MemoryUtils::scale_iterations(iterations, size), 1, true);
+        PerformanceStats chase = calibrating
+            ? run_calibrated_test(TestPattern::LATENCY_CHASE, 1, StorePolicy::TEMPORAL,
+                                  MatrixMultiply::MatrixPrecision::FP32)
+            : run_test(TestPattern::LATENCY_CHASE, iterations, 1, true);
+        sweep.points.push_back({current_buffer_size, read.bandwidth_gbps, chase.latency_ns});
+    }
+    cleanup_buffers();
+
+    std::vector<size_t> sizes;
+    std::vector<double> bandwidth;
+    std::vector<double> latency;
+    for (const auto& point : sweep.points) {
+        sizes.push_back(point.working_set_bytes);
+        bandwidth.push_back(point.bandwidth_gbps);
+        latency.push_back(point.latency_ns);
+    }
+    sweep.bandwidth_knees = CacheBoundaries::detect_knees(sizes, bandwidth, CacheBoundaries::Curve::BANDWIDTH);
+    sweep.latency_knees = CacheBoundaries::detect_knees(sizes, latency, CacheBoundaries::Curve::LATENCY);
+    sweep.capacities = CacheBoundaries::match_levels(cache_info, sweep.bandwidth_knees, sweep.latency_knees);
+    return sweep;
+}
+
+std::vector<StorePolicy> MemoryBandwidthTester::store_policies_for(TestPattern pattern,
+                                                                   const std::vector<StorePolicy>& store_policies) {
+    if (uses_store_policy(pattern) && !store_policies.empty()) {
+        return store_policies;
+    }
+    return {StorePolicy::TEMPORAL};
+}
+
+std::vector<MatrixMultiply::MatrixPrecision> MemoryBandwidthTester::precisions_for(
+    TestPattern pattern, const std::vector<MatrixMultiply::MatrixPrecision>& precisions) {
+    if (pattern == TestPattern::MATRIX_MULTIPLY && !precisions.empty()) {
+        return precisions;
+    }
+    return {MatrixMultiply::MatrixPrecision::FP32};
+}
+
+std::string MemoryBandwidthTester::test_name_for(TestPattern pattern, MatrixMultiply::MatrixPrecision precision) const {
+    if (pattern == TestPattern::MATRIX_MULTIPLY) {
+        return get_pattern_name(pattern) + " " + MatrixMultiply::precision_to_string(precision);
+    }
+    if (pattern == TestPattern::STREAMS) {
+        return get_pattern_name(pattern) + " " + stream_counts_to_string(stream_counts);
+    }
+    std::string name = get_pattern_name(pattern);
+    if (is_sparse(pattern)) {
+        name += " " + std::to_string(access_config.element_bytes) + "B";
+    }
+    if (PatternRegistry::get(pattern).encoded) {
+        name += " " + std::to_string(decode_bits) + "b";
+    }
+    if (pattern == TestPattern::HASH_PROBE) {
+        name += " (" + ProxyKernels::probe_to_string(proxy_config.probe) + ", " +
+                std::to_string(static_cast<int>(proxy_config.load_factor * 100.0 + 0.5)) + "% full, batch " +
+                std::to_string(proxy_config.batch) + ")";
+    } else if (pattern == TestPattern::MULTIWAY_MERGE) {
+        name += " " + std::to_string(proxy_config.merge_ways) + "-way";
+    } else if (pattern == TestPattern::SPMV_CSR || pattern == TestPattern::SPMV_SELL) {
+        name += " " + IrregularKernels::matrix_to_string(irregular_config.matrix) + " " +
+                std::to_string(irregular_config.row_nnz) + "/row";
+    } else if (pattern == TestPattern::STENCIL_7PT && irregular_config.block > 0) {
+        name += " (block " + std::to_string(irregular_config.block) + ")";
+    }
+    if (prefetch_distance > 0 && PrefetchControl::supports_pattern(pattern)) {
+        name += " (prefetch " + PrefetchControl::distance_to_string(prefetch_distance) + ")";
+    }
+    return name;
+}
+
+size_t MemoryBandwidthTester::arrays_for(TestPattern pattern) const {
+    return PatternRegistry::arrays(PatternRegistry::get(pattern), stream_counts);
+}
+
+size_t MemoryBandwidthTester::footprint_for(size_t total_size, size_t arrays) {
+    return total_size / std::max(BenchmarkConstants::DEFAULT_BUFFER_SPLIT, arrays) * arrays;
+}
+
+std::string MemoryBandwidthTester::store_policy_name_for(TestPattern pattern, StorePolicy store_policy) {
+    return uses_store_policy(pattern) ? SimdKernels::store_policy_to_string(store_policy) : "-";
+}
+
+size_t MemoryBandwidthTester::threads_for(TestPattern pattern, size_t num_threads) {
+    return PatternRegistry::get(pattern).single_thread ? 1 : num_threads;
+}
+
+bool MemoryBandwidthTester::is_sparse(TestPattern pattern) {
+    return PatternRegistry::get(pattern).sparse;
+}
+
+bool MemoryBandwidthTester::uses_store_policy(TestPattern pattern) {
+    return PatternRegistry::get(pattern).store_policy;
+}
+
+std::string MemoryBandwidthTester::kernel_name_for(TestPattern pattern) const {
+    switch(PatternRegistry::get(pattern).variants) {
+        case PatternRegistry::KernelVariants::CHASE:
+            return "chase:" + PointerChase::chase_mode_to_string(chase_config);
+        case PatternRegistry::KernelVariants::SCALAR:
+            return SimdKernels::kernel_type_to_string(KernelType::SCALAR);
+        case PatternRegistry::KernelVariants::GATHER:
+            return SimdKernels::kernel_type_to_string(
+                SimdKernels::has_hardware_gather(kernel) ? kernel : KernelType::SCALAR);
+        case PatternRegistry::KernelVariants::SCATTER:
+            return SimdKernels::kernel_type_to_string(
+                SimdKernels::has_hardware_scatter(kernel) ? kernel : KernelType::SCALAR);
+        case PatternRegistry::KernelVariants::DECODE:
+            return SimdKernels::kernel_type_to_string(
+                SimdKernels::has_simd_decode(kernel) ? kernel : KernelType::SCALAR);
+        case PatternRegistry::KernelVariants::GEMM: {
+            if (!last_matrix_acceleration.empty()) {
+                return last_matrix_acceleration;
+            }
+            auto multiplier = platform->create_matrix_multiplier();
+            if (multiplier && multiplier->is_available()) {
+                return multiplier->get_acceleration_name();
+            }
+            return StandardTests::PORTABLE_GEMM_NAME;
+        }
+        default: {
+            KernelMatrix::Family family;
+            if (last_tuned != nullptr && tuned_family(pattern, family) && family == last_tuned->family) {
+                return "tuned:" + KernelMatrix::shape_to_string(last_tuned->shape);
+            }
+            return SimdKernels::kernel_type_to_string(kernel);
+        }
+    }
+}
+
+void MemoryBandwidthTester::print_cache_results(const std::string& pattern_name,
+                                                const std::vector<TestResult>& results) {
+    std::cout << formatter.format_cache_aware_results(pattern_name, results, cached_system_info.memory_specs);
+}
+
+const SystemInfo& MemoryBandwidthTester::get_cached_system_info() const {
+    return cached_system_info;
+}
+
+void MemoryBandwidthTester::set_calibrated_peak(double bandwidth_gbps, const std::string& recorded) {
+    cached_system_info.memory_specs.calibrated_bandwidth_gbps = bandwidth_gbps;
+    cached_system_info.memory_specs.calibrated_on = recorded;
+}
+
+const NumaTopology& MemoryBandwidthTester::get_numa_topology() const {
+    return numa_topology;
+}
+
+std::string MemoryBandwidthTester::describe_page_backing() const {
+    std::string description = "requested " + PageAllocator::page_mode_to_string(page_mode);
+    if (!buffers.empty()) {
+        description += ", obtained " + PageAllocator::describe_backing(buffers.front().page_backing());
+    }
+    if (file_backing.enabled()) {
+        description = "file mapping in " + file_backing.directory + " (" +
+                      (file_backing.populate ? std::string("MAP_POPULATE") :
+                                               PageAllocator::file_cache_to_string(file_backing.cache) + " page cache") +
+                      ", madvise " + PageAllocator::file_advice_to_string(file_backing.advice) + ")";
+    }
+    return description;
+}
+
+std::vector<std::string> MemoryBandwidthTester::validate_result(TestPattern pattern, const PerformanceStats& stats,
+                                                                size_t num_threads) const {
+    if (pattern == TestPattern::MATRIX_MULTIPLY) {
+        return {};  // GEMM allocates its own matrices; its bandwidth is derived from FLOPs
+    }
+
+    // Bytes each thread keeps live across all buffers the pattern touches
+    size_t total_bytes = current_buffer_size * arrays_for(pattern);
+    size_t bytes_per_thread = total_bytes / std::max<size_t>(1, num_threads);
+    return ResultValidation::validate(stats, bytes_per_thread, total_bytes, num_threads, cache_info,
+                                      cached_system_info.memory_specs);
+}
+
+void MemoryBandwidthTester::attach_sample_stats(TestResult& result) const {
+    result.bandwidth_distribution = last_bandwidth_distribution;
+    result.bandwidth_samples = last_bandwidth_samples;
+    result.latency_distribution = last_latency_distribution;
+    result.thread_stats = last_thread_stats;
+    result.gemm = last_gemm_stats;
+    result.calibration = last_calibration;
+    result.counters = last_counters;
+    result.page_faults = last_page_faults;
+    result.access = last_access;
+    result.decode = last_decode;
+    result.proxy = last_proxy;
+    result.irregular = last_irregular;
+    result.energy = last_energy;
+}
+
+size_t MemoryBandwidthTester::matrix_size_for(size_t buffer_size, bool cache_aware) {
+    if (!cache_aware || buffer_size == 0) {
+        return 1024;
+    }
+    // Sized as FP32 for every precision, so results at one working set share a shape
+    size_t elements = buffer_size / sizeof(float);
+    size_t matrix_size = static_cast<size_t>(std::sqrt(elements / 3.0));
+    return std::min(std::max(matrix_size, static_cast<size_t>(8)), static_cast<size_t>(512));
+}
+
+void MemoryBandwidthTester::prepare_matrices(size_t matrix_size, MatrixMultiply::MatrixPrecision precision,
+                                             size_t num_threads) {
+    size_t elements = matrix_size * matrix_size;
+    if (matrix_edge != matrix_size || matrix_precision != precision) {
+        auto words = [elements](size_t element_size) {
+            return (elements * element_size + sizeof(uint64_t) - 1) / sizeof(uint64_t);
+        };
+        matrix_a.assign(words(MatrixMultiply::precision_operand_size(precision)), 0);
+        matrix_b.assign(words(MatrixMultiply::precision_operand_size(precision)), 0);
+        matrix_c.assign(words(MatrixMultiply::precision_accumulate_size(precision)), 0);
+        MatrixMultiply::initialize_matrix_random(precision, matrix_a.data(), matrix_size, matrix_size);
+        MatrixMultiply::initialize_matrix_random(precision, matrix_b.data(), matrix_size, matrix_size);
+        matrix_edge = matrix_size;
+        matrix_precision = precision;
+    }
+    while (matrix_multipliers.size() < num_threads) {
+        matrix_multipliers.push_back(platform->create_matrix_multiplier());
+    }
+}
+
+std::pair<size_t, size_t> MemoryBandwidthTester::matrix_row_slice(size_t thread_id, size_t num_threads, size_t rows) {
+    size_t blocks = (rows + BenchmarkConstants::MATRIX_ROW_BLOCK - 1) / BenchmarkConstants::MATRIX_ROW_BLOCK;
+    size_t start = blocks * thread_id / num_threads * BenchmarkConstants::MATRIX_ROW_BLOCK;
+    size_t end = blocks * (thread_id + 1) / num_threads * BenchmarkConstants::MATRIX_ROW_BLOCK;
+    return {std::min(start, rows), std::min(end, rows)};
+}
+
+std::pair<size_t, size_t> MemoryBandwidthTester::thread_slice(size_t thread_id, size_t num_threads,
+                                                              size_t buffer_size) {
+    size_t bytes_per_thread = buffer_size / num_threads;
+    size_t start_offset = thread_id * bytes_per_thread;
+    size_t end_offset = (thread_id == num_threads - 1) ? buffer_size : (thread_id + 1) * bytes_per_thread;
+    return {start_offset, end_offset};
+}
+
+void MemoryBandwidthTester::pin_workers(size_t num_threads) {
+    if (pinned_threads == num_threads && pinned_numa_binding == numa_thread_binding &&
+        (!numa_thread_binding || pinned_numa_node == numa_cpu_node)) {
+        return;
+    }
+    pool.run(num_threads, [this, num_threads](size_t i) {
+        if (numa_thread_binding) {
+            platform->bind_thread_to_numa_node(i, numa_cpu_node);
+        } else if (!placement_cpus.empty()) {
+            platform->set_thread_affinity(placement_cpus[i % placement_cpus.size()], CPUAffinityType::DEFAULT,
+                                          num_threads);
+        } else {
+            platform->set_thread_affinity(i, cpu_affinity, num_threads);
+        }
+    });
+    pinned_threads = num_threads;
+    pinned_numa_binding = numa_thread_binding;
+    pinned_numa_node = numa_cpu_node;
+}
+
+void MemoryBandwidthTester::prepare_counters(size_t num_threads) {
+    size_t first = thread_counters.size();
+    if (first >= num_threads) {
+        return;
+    }
+    thread_counters.resize(num_threads);
+    for (size_t i = first; i < num_threads; ++i) {
+        thread_counters[i] = platform->create_thread_counters();
+    }
+    pool.run(num_threads, [this, first](size_t i) {
+        if (i >= first && thread_counters[i] && !thread_counters[i]->open()) {
+            thread_counters[i].reset();
+        }
+    });
+}
+
+LoadedLatencyPoint MemoryBandwidthTester::measure_loaded_latency(
+        TestPattern load_pattern, size_t iterations, size_t load_threads, size_t delay_spins,
+        StorePolicy store_policy) {
+    size_t num_threads = load_threads + 1;
+    size_t buffer_size = current_buffer_size;
+    size_t probe_bytes = std::min(buffer_size, BenchmarkConstants::LOADED_LATENCY_PROBE_BYTES);
+    std::vector<PerformanceStats> thread_results(num_threads);
+    std::atomic<bool> load_stop(false);
+
+    pin_workers(num_threads);
+    if (sample_rings.empty()) {
+        sample_rings.resize(1);
+    }
+    sample_rings[0].clear();
+
+    pool.run(num_threads, [&](size_t i) {
+        if (i == 0) {
+            try {
+                thread_results[0] = StandardTests::latency_chase_test(
+                    aligned_buffers[2], probe_bytes, 0, probe_bytes, iterations, stop_flag, chase_config,
+                    &sample_rings[0]);
+            } catch (...) {
+                load_stop = true;
+                throw;
+            }
+            load_stop = true;
+            return;
+        }
+
+        size_t start_offset, end_offset;
+        std::tie(start_offset, end_offset) = thread_slice(i - 1, load_threads, buffer_size);
+        thread_results[i] = StandardTests::throttled_load_test(
+            aligned_buffers[0], aligned_buffers[1], buffer_size, start_offset, end_offset, load_pattern,
+            delay_spins, load_stop, kernel, store_policy);
+    });
+
+    LoadedLatencyPoint point{};
+    point.load_threads = load_threads;
+    point.delay_spins = delay_spins;
+    for (size_t i = 1; i < num_threads; ++i) {
+        point.bandwidth_gbps += thread_results[i].bandwidth_gbps;
+    }
+    point.latency_ns = thread_results[0].latency_ns;
+    point.latency_distribution = SampleStats::summarize(sample_rings[0].latency_samples());
+    return point;
+}
+
+void MemoryBandwidthTester::join_resctrl_group(Contention::ResctrlGroup& group, const std::string& name,
+                                               const std::string& schemata, size_t first, size_t last) {
+    if(schemata.empty()) {
+        return;
+    }
+    std::string error;
+    if(!group.create(name, Contention::parse_schemata(schemata), error)) {
+        throw PlatformError("Cannot create resctrl group " + name + ": " + error);
+    }
+    std::vector<std::string> errors(last);
+    pool.run(last, [&](size_t i) {
+        if(i >= first) {
+            group.add_thread(Contention::current_thread_id(), errors[i]);
+        }
+    });
+    for(const std::string& thread_error : errors) {
+        if(!thread_error.empty()) {
+            throw PlatformError("Cannot join resctrl group " + name + ": " + thread_error);
+        }
+    }
+}
+
+Contention::ContentionPoint MemoryBandwidthTester::measure_contention(
+        TestPattern victim_pattern, Contention::Aggressor aggressor, size_t iterations, size_t victim_threads,
+        size_t aggressor_threads, size_t delay_spins, StorePolicy store_policy) {
+    size_t num_threads = victim_threads + aggressor_threads;
+    size_t buffer_size = current_buffer_size;
+    std::vector<PerformanceStats> thread_results(num_threads);
+    std::atomic<size_t> victims_running(victim_threads);
+    std::atomic<bool> aggressor_stop(false);
+
+    pin_workers(num_threads);
+    if (sample_rings.size() < victim_threads) {
+        sample_rings.resize(victim_threads);
+    }
+
+    pool.run(num_threads, [&](size_t i) {
+        size_t start_offset, end_offset;
+        if (i >= victim_threads) {
+            std::tie(start_offset, end_offset) = thread_slice(i - victim_threads, aggressor_threads, buffer_size);
+            thread_results[i] = Contention::run_aggressor(
+                aggressor, aligned_buffers[2], aligned_buffers[3], buffer_size, start_offset,
+                end_offset, delay_spins, aggressor_stop, kernel, store_policy);
+            return;
+        }
+
+        std::tie(start_offset, end_offset) = thread_slice(i, victim_threads, buffer_size);
+        SampleRing* samples = &sample_rings[i];
+        samples->clear();
+        try {
+            switch (victim_pattern) {
+                case TestPattern::SEQUENTIAL_WRITE:
+                    thread_results[i] = StandardTests::sequential_write_test(
+                        aligned_buffers[0], buffer_size, start_offset, end_offset, iterations, stop_flag,
+                        kernel, store_policy, samples);
+                    break;
+                case TestPattern::COPY:
+                    thread_results[i] = StandardTests::copy_test(
+                        aligned_buffers[0], aligned_buffers[1], buffer_size, start_offset, end_offset,
+                        iterations, stop_flag, kernel, store_policy, samples);
+                    break;
+                case TestPattern::RANDOM_READ:
+                    thread_results[i] = StandardTests::random_access_test(
+                        aligned_buffers[0], buffer_size, start_offset, end_offset, iterations, false,
+                        stop_flag, samples, prefetch_distance);
+                    break;
+                case TestPattern::LATENCY_CHASE:
+                    thread_results[i] = StandardTests::latency_chase_test(
+                        aligned_buffers[0], buffer_size, start_offset, end_offset, iterations, stop_flag,
+                        chase_config, samples);
+                    break;
+                default:
+                    thread_results[i] = StandardTests::sequential_read_test(
+                        aligned_buffers[0], buffer_size, start_offset, end_offset, iterations, stop_flag,
+                        false, kernel, samples, prefetch_distance);
+                    break;
+            }
+        } catch (...) {
+            aggressor_stop = true;
+            throw;
+        }
+        if (victims_running.fetch_sub(1) == 1) {
+            aggressor_stop = true;
+        }
+    });
+
+    Contention::ContentionPoint point;
+    point.aggressor_threads = aggressor_threads;
+    point.delay_spins = delay_spins;
+    for (size_t i = 0; i < num_threads; ++i) {
+        if (i < victim_threads) {
+            point.victim_gbps += thread_results[i].bandwidth_gbps;
+            point.victim_latency_ns += thread_results[i].latency_ns / static_cast<double>(victim_threads);
+        } else {
+            point.aggressor_gbps += thread_results[i].bandwidth_gbps;
+        }
+    }
+    return point;
+}
+
+GpuBandwidth::Point MemoryBandwidthTester::measure_gpu_bandwidth(
+        GpuBandwidth::Device& device, GpuBandwidth::Kernel gpu_kernel, const GpuBandwidth::Arrays& arrays,
+        size_t num_threads) {
+    const size_t array_bytes = arrays.count * sizeof(float);
+    const double bytes_per_iteration = static_cast<double>(GpuBandwidth::traffic_factor(gpu_kernel) * array_bytes);
+    GpuBandwidth::Point point;
+    point.kernel = gpu_kernel;
+    point.device = device.name();
+    point.array_bytes = array_bytes;
+    point.cpu_threads = num_threads;
+
+    auto run_gpu = [&](size_t iterations, GpuBandwidth::Timing& timing, std::string& error) {
+        return device.run(gpu_kernel, arrays, iterations, timing, error) && timing.seconds > 0.0;
+    };
+    auto kernel_failed = [&](const std::string& error) {
+        return BenchmarkError("GPU " + GpuBandwidth::kernel_to_string(gpu_kernel) + " kernel failed on " +
+                              device.name() + ": " + (error.empty() ? "no GPU time reported" : error));
+    };
+
+    // CPU threads stream until stop is set, each over its slice of buffers 3 and 4
+    size_t buffer_size = current_buffer_size;
+    pin_workers(num_threads);
+    auto stream_cpu = [&](std::atomic<bool>& stop) {
+        std::vector<PerformanceStats> thread_results(num_threads);
+        pool.run(num_threads, [&](size_t i) {
+            size_t start_offset, end_offset;
+            std::tie(start_offset, end_offset) = thread_slice(i, num_threads, buffer_size);
+            thread_results[i] = Contention::run_aggressor(GpuBandwidth::cpu_traffic(gpu_kernel), aligned_buffers[3],
+                                                          aligned_buffers[4], buffer_size, start_offset, end_offset,
+                                                          0, stop, kernel);
+        });
+        double gbps = 0.0;
+        for(const auto& result : thread_results) {
+            gbps += result.bandwidth_gbps;
+        }
+        return gbps;
+    };
+
+    // GPU alone, calibrated from a single iteration
+    GpuBandwidth::Timing timing;
+    std::string error;
+    if(!run_gpu(1, timing, error)) {
+        throw kernel_failed(error);
+    }
+    point.gpu_iterations = std::max<size_t>(
+        1, static_cast<size_t>(std::ceil(BenchmarkConstants::GPU_MIN_SECONDS / timing.seconds)));
+    if(!run_gpu(point.gpu_iterations, timing, error)) {
+        throw kernel_failed(error);
+    }
+    point.gpu_alone_gbps = bytes_per_iteration * point.gpu_iterations / timing.seconds / 1e9;
+    point.verified = GpuBandwidth::verify(gpu_kernel, arrays, timing.read_sum);
+    const double window_seconds = timing.seconds;
+
+    // CPU alone for as long as the GPU ran alone
+    std::atomic<bool> cpu_stop(false);
+    std::thread timer([&]() {
+        std::this_thread::sleep_for(std::chrono::duration<double>(window_seconds));
+        cpu_stop = true;
+    });
+    try {
+        point.cpu_alone_gbps = stream_cpu(cpu_stop);
+    } catch (...) {
+        timer.join();
+        throw;
+    }
+    timer.join();
+
+    // Both: the CPU threads ramp up first and stop when the kernel completes
+    cpu_stop = false;
+    bool gpu_ok = false;
+    GpuBandwidth::Timing shared_timing;
+    std::thread gpu([&]() {
+        std::this_thread::sleep_for(std::chrono::milliseconds(BenchmarkConstants::GPU_CPU_RAMP_MS));
+        gpu_ok = run_gpu(point.gpu_iterations, shared_timing, error);
+        cpu_stop = true;
+    });
+    try {
+        point.cpu_shared_gbps = stream_cpu(cpu_stop);
+    } catch (...) {
+        gpu.join();
+        throw;
+    }
+    gpu.join();
+    if(!gpu_ok) {
+        throw kernel_failed(error);
+    }
+    point.gpu_shared_gbps = bytes_per_iteration * point.gpu_iterations / shared_timing.seconds / 1e9;
+    point.verified = point.verified && GpuBandwidth::verify(gpu_kernel, arrays, shared_timing.read_sum);
+    return point;
+}
+
+PerformanceStats MemoryBandwidthTester::run_intensity_sweep_point(
+        size_t passes, size_t num_threads, size_t flops_per_element) {
+    size_t buffer_size = current_buffer_size;
+    std::vector<PerformanceStats> thread_results(num_threads);
+
+    pin_workers(num_threads);
+    std::vector<ThreadTiming> timings = pool.run(num_threads, [&](size_t i) {
+        size_t start_offset, end_offset;
+        std::tie(start_offset, end_offset) = thread_slice(i, num_threads, buffer_size);
+        thread_results[i] = StandardTests::arithmetic_intensity_test(
+            aligned_buffers[0], buffer_size, start_offset, end_offset, passes, flops_per_element, stop_flag);
+    });
+    return aggregate_stats(thread_results, timings);
+}
+
+void MemoryBandwidthTester::record_access_stats(TestPattern pattern, PerformanceStats& aggregated,
+                                                const std::vector<AccessPatterns::LineTraffic>& traffic) {
+    AccessPatterns::LineTraffic total;
+    for (const auto& thread_traffic : traffic) {
+        total += thread_traffic;
+    }
+    double accesses = static_cast<double>(aggregated.bytes_processed) / access_config.element_bytes;
+    if (accesses >= 1.0) {
+        aggregated.latency_ns = aggregated.time_seconds * 1e9 / accesses;
+    }
+
+    last_access.measured = true;
+    last_access.element_bytes = access_config.element_bytes;
+    last_access.layout = (pattern == TestPattern::STRIDED_READ)
+        ? "stride:" + std::to_string(access_config.stride_bytes)
+        : AccessPatterns::distribution_to_string(access_config);
+    last_access.useful_gbps = aggregated.bandwidth_gbps;
+    last_access.line_gbps = (aggregated.bytes_processed > 0)
+        ? aggregated.bandwidth_gbps * total.line_bytes / aggregated.bytes_processed : 0.0;
+    last_access.line_use = (total.line_bytes > 0)
+        ? static_cast<double>(total.used_bytes) / total.line_bytes : 0.0;
+}
+
+void MemoryBandwidthTester::record_decode_stats(TestPattern pattern, PerformanceStats& aggregated) {
+    EncodedScans::Encoding encoding = PatternRegistry::get(pattern).encoding;
+    double values = static_cast<double>(aggregated.bytes_processed) * 8.0 / decode_bits;
+    if (values >= 1.0) {
+        aggregated.latency_ns = aggregated.time_seconds * 1e9 / values;
+    }
+
+    last_decode.measured = true;
+    last_decode.encoding = EncodedScans::encoding_to_string(encoding);
+    last_decode.bits = decode_bits;
+    last_decode.expansion = EncodedScans::expansion(encoding, decode_bits);
+    last_decode.values_per_second = (aggregated.time_seconds > 0.0) ? values / aggregated.time_seconds : 0.0;
+    last_decode.output_gbps = aggregated.bandwidth_gbps * last_decode.expansion;
+}
+
+void MemoryBandwidthTester::record_proxy_stats(TestPattern pattern, PerformanceStats& aggregated) {
+    last_proxy.measured = true;
+    if (pattern == TestPattern::HASH_PROBE) {
+        last_proxy.unit = "lookups";
+        last_proxy.bytes_per_operation = ProxyKernels::LOOKUP_BYTES;
+    } else {
+        last_proxy.unit = "keys";
+        last_proxy.bytes_per_operation = (pattern == TestPattern::RADIX_PARTITION)
+            ? ProxyKernels::PARTITION_BYTES_PER_KEY : ProxyKernels::MERGE_BYTES_PER_KEY;
+    }
+
+    double operations = static_cast<double>(aggregated.bytes_processed) / last_proxy.bytes_per_operation;
+    if (operations >= 1.0) {
+        aggregated.latency_ns = aggregated.time_seconds * 1e9 / operations;
+    }
+    last_proxy.per_second = (aggregated.time_seconds > 0.0) ? operations / aggregated.time_seconds : 0.0;
+}
+
+void MemoryBandwidthTester::record_irregular_stats(TestPattern pattern, PerformanceStats& aggregated,
+                                                   const std::vector<IrregularKernels::Work>& work,
+                                                   size_t buffer_size, size_t num_threads) {
+    IrregularKernels::Work total;
+    for (const auto& thread_work : work) {
+        total.flops += thread_work.flops;
+        total.nonzeros += thread_work.nonzeros;
+        total.stored += thread_work.stored;
+    }
+    if (pattern != TestPattern::STENCIL_7PT && total.nonzeros > 0) {
+        aggregated.latency_ns = aggregated.time_seconds * 1e9 / total.nonzeros;
+    } else if (pattern == TestPattern::STENCIL_7PT && total.flops > 0) {
+        aggregated.latency_ns = aggregated.time_seconds * 1e9 /
+            (static_cast<double>(total.flops) / IrregularKernels::STENCIL_FLOPS_PER_POINT);
+    }
+
+    last_irregular.measured = true;
+    last_irregular.gflops = (aggregated.time_seconds > 0.0) ? total.flops / (aggregated.time_seconds * 1e9) : 0.0;
+    last_irregular.triad_gbps = triad_roofline(buffer_size, num_threads);
+    last_irregular.triad_percent = (last_irregular.triad_gbps > 0.0)
+        ? aggregated.bandwidth_gbps / last_irregular.triad_gbps * 100.0 : 0.0;
+    last_irregular.padding_percent = (total.nonzeros > 0)
+        ? static_cast<double>(total.stored - total.nonzeros) / total.nonzeros * 100.0 : 0.0;
+}
+
+double MemoryBandwidthTester::triad_roofline(size_t buffer_size, size_t num_threads) {
+    auto key = std::make_pair(buffer_size, num_threads);
+    auto cached = triad_rooflines.find(key);
+    if (cached != triad_rooflines.end()) {
+        return cached->second;
+    }
+    // Three arrays over the bytes the kernel itself ran over
+    size_t third = buffer_size / 3 / CacheConstants::DEFAULT_CACHE_LINE_SIZE * CacheConstants::DEFAULT_CACHE_LINE_SIZE;
+    if (third == 0 || aligned_buffers.empty()) {
+        return 0.0;
+    }
+    uint8_t* a = aligned_buffers[0];
+    const uint8_t* b = a + third;
+    const uint8_t* c = a + 2 * third;
+
+    // The bytes hold whatever the last pattern left (indices and values after
+    // spmv); read as doubles most are denormal and the triad would run on FP assists
+    pool.run(num_threads, [&](size_t i) {
+        size_t start_offset, end_offset;
+        std::tie(start_offset, end_offset) = thread_slice(i, num_threads, third);
+        for (size_t array = 0; array < 3; ++array) {
+            double* values = reinterpret_cast<double*>(a + array * third + start_offset);
+            std::fill(values, values + (end_offset - start_offset) / sizeof(double), 1.0);
+        }
+    });
+
+    PerformanceStats triad;
+    for (size_t iterations = 1;; iterations *= 2) {
+        std::vector<PerformanceStats> thread_results(num_threads);
+        std::vector<ThreadTiming> timings = pool.run(num_threads, [&](size_t i) {
+            size_t start_offset, end_offset;
+            std::tie(start_offset, end_offset) = thread_slice(i, num_threads, third);
+            thread_results[i] = StandardTests::triad_test(a, b, c, third, start_offset, end_offset, iterations,
+                                                          stop_flag, kernel, StorePolicy::TEMPORAL);
+        });
+        triad = aggregate_stats(thread_results, timings);
+        if (triad.time_seconds >= BenchmarkConstants::ROOFLINE_MIN_SECONDS || stop_flag) {
+            break;
+        }
+    }
+    triad_rooflines[key] = triad.bandwidth_gbps;
+    return triad.bandwidth_gbps;
+}
+
+const KernelMatrix::Kernel* MemoryBandwidthTester::tuned_kernel_for(TestPattern pattern, StorePolicy store_policy,
+                                                                    size_t buffer_size, size_t num_threads) const {
+    if (tuning) {
+        return tuning_kernel;
+    }
+    KernelMatrix::Family family;
+    if (tuned_kernels.empty() || !tuned_family(pattern, family) || store_policy != StorePolicy::TEMPORAL ||
+        (family == KernelMatrix::Family::READ && prefetch_distance > 0)) {
+        return nullptr;
+    }
+    std::string level = KernelMatrix::working_set_level(
+        cache_info, buffer_size * arrays_for(pattern), num_threads);
+    auto found = tuned_kernels.find({family, level});
+    return (found != tuned_kernels.end()) ? found->second : nullptr;
+}
+
+PerformanceStats MemoryBandwidthTester::measure_tuning(TestPattern pattern, size_t num_threads, bool cache_aware,
+                                                       bool repeat) {
+    PerformanceStats best;
+    size_t iterations = 1;
+    for (;; iterations *= 2) {
+        best = run_test(pattern, iterations, num_threads, cache_aware);
+        if (!best.verified) return {};
+        if (best.time_seconds >= TUNE_MIN_SECONDS || stop_flag) break;
+    }
+    for (size_t r = 1; repeat && r < TUNE_REPETITIONS && !stop_flag; ++r) {
+        PerformanceStats stats = run_test(pattern, iterations, num_threads, cache_aware);
+        if (!stats.verified) return {};
+        if (stats.bandwidth_gbps > best.bandwidth_gbps) best = stats;
+    }
+    return best;
+}
+
+void MemoryBandwidthTester::record_energy_stats(const PerformanceStats& aggregated,
+                                                const EnergyMeter::Snapshot& before,
+                                                const EnergyMeter::Snapshot& after, double seconds) {
+    EnergyMeter::Energy energy = energy_meter->between(before, after);
+    double joules = energy.package_joules + energy.dram_joules;
+    // RAPL updates about once a millisecond; a region shorter than that can read no change at all
+    if ((!energy.package && !energy.dram) || joules <= 0.0 || seconds <= 0.0) {
+        return;
+    }
+    last_energy.measured = true;
+    last_energy.has_dram = energy.dram;
+    last_energy.package_joules = energy.package_joules;
+    last_energy.dram_joules = energy.dram_joules;
+    last_energy.seconds = seconds;
+    last_energy.package_watts = energy.package_joules / seconds;
+    last_energy.dram_watts = energy.dram_joules / seconds;
+    last_energy.pj_per_byte = (aggregated.bytes_processed > 0)
+        ? joules * 1e12 / static_cast<double>(aggregated.bytes_processed) : 0.0;
+}
+
+void MemoryBandwidthTester::record_page_faults(const struct rusage& before, const struct rusage& after,
+                                               double seconds) {
+    last_page_faults.measured = true;
+    last_page_faults.minor_faults = static_cast<uint64_t>(after.ru_minflt - before.ru_minflt);
+    last_page_faults.major_faults = static_cast<uint64_t>(after.ru_majflt - before.ru_majflt);
+    uint64_t total = last_page_faults.minor_faults + last_page_faults.major_faults;
+    last_page_faults.faults_per_second = (seconds > 0.0) ? total / seconds : 0.0;
+}
+
+void MemoryBandwidthTester::record_gemm_stats(const std::vector<MatrixMultiply::MatrixPerformanceStats>& matrix_results,
+                                              const PerformanceStats& aggregated, size_t matrix_size,
+                                              MatrixMultiply::MatrixPrecision precision) {
+    size_t operations = 0;
+    std::string acceleration;
+    for (const auto& band : matrix_results) {
+        operations += band.operations;
+        if (acceleration.empty()) {
+            acceleration = band.acceleration;
+        }
+    }
+    auto overall = MatrixMultiply::calculate_matrix_stats(aggregated.bytes_processed, aggregated.time_seconds,
+                                                          operations, acceleration);
+
+    last_gemm_stats.precision = MatrixMultiply::precision_to_string(precision);
+    last_gemm_stats.accumulate = MatrixMultiply::accumulate_to_string(precision);
+    last_gemm_stats.matrix_size = matrix_size;
+    last_gemm_stats.gops = overall.gflops;
+    last_gemm_stats.arithmetic_intensity = overall.arithmetic_intensity;
+    last_matrix_acceleration = acceleration;
+}
+
+void MemoryBandwidthTester::record_sample_stats(const std::vector<PerformanceStats>& thread_results,
+                                                size_t num_threads) {
+    std::vector<double> all_bandwidth, all_latency;
+    last_thread_stats.assign(num_threads, ThreadStats{});
+
+    for (size_t i = 0; i < num_threads; ++i) {
+        std::vector<double> bandwidth = sample_rings[i].bandwidth_samples();
+        std::vector<double> latency = sample_rings[i].latency_samples();
+        all_bandwidth.insert(all_bandwidth.end(), bandwidth.begin(), bandwidth.end());
+        all_latency.insert(all_latency.end(), latency.begin(), latency.end());
+
+        last_thread_stats[i].thread_id = i;
+        last_thread_stats[i].stats = thread_results[i];
+        last_thread_stats[i].bandwidth = SampleStats::summarize(std::move(bandwidth));
+        last_thread_stats[i].latency = SampleStats::summarize(std::move(latency));
+    }
+    last_bandwidth_samples = all_bandwidth;
+    last_bandwidth_distribution = SampleStats::summarize(std::move(all_bandwidth));
+    last_latency_distribution = SampleStats::summarize(std::move(all_latency));
+}
+
+PerformanceStats MemoryBandwidthTester::aggregate_stats(const std::vector<PerformanceStats>& thread_results,
+                                                        const std::vector<ThreadTiming>& timings) {
+    PerformanceStats aggregated{};
+
+    for(const auto& result : thread_results) {
+        aggregated.bytes_processed += result.bytes_processed;
+        aggregated.verified = aggregated.verified && result.verified;
+    }
+
+    double window = WorkerPool::overlap_seconds(timings);
+    double bytes_in_window = 0.0;
+    if(window > 0.0) {
+        for(size_t i = 0; i < thread_results.size() && i < timings.size(); ++i) {
+            double duration = std::chrono::duration<double>(timings[i].end - timings[i].start).count();
+            if(duration > 0.0) {
+                bytes_in_window += thread_results[i].bytes_processed * (window / duration);
+            }
+        }
+    } else {
+        window = WorkerPool::span_seconds(timings);
+        bytes_in_window = static_cast<double>(aggregated.bytes_processed);
+    }
+    aggregated.time_seconds = window;
+
+    if(window > 0.0) {
+        aggregated.bandwidth_gbps = bytes_in_window / (window * 1e9);
+    }
+
+    if(bytes_in_window > 0.0) {
+        size_t cache_line_size = CacheConstants::DEFAULT_CACHE_LINE_SIZE;
+        double accesses = bytes_in_window / cache_line_size;
+        if(accesses >= 1.0) {
+            aggregated.latency_ns = (window * 1e9) / accesses;
+        } else {
+            aggregated.latency_ns = 0.0;
+        }
+    } else {
+        aggregated.latency_ns = 0.0;
+    }
+
+    return aggregated;
+}
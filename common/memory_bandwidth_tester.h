@@ -0,0 +1,1040 @@
+#ifndef MEMORY_BANDWIDTH_TESTER_H
+#define MEMORY_BANDWIDTH_TESTER_H
+
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <map>
+#include <memory>
+#include <string>
+#include <utility>
+#include <vector>
+#include <sys/resource.h>
+
+#include "memory_types.h"
+#include "platform_interface.h"
+#include "working_sets.h"
+#include "output_formatter.h"
+#include "matrix_multiply_interface.h"
+#include "test_patterns.h"
+#include "aligned_buffer.h"
+#include "simd_kernels.h"
+#include "pointer_chase.h"
+#include "access_patterns.h"
+#include "encoded_scans.h"
+#include "proxy_kernels.h"
+#include "irregular_kernels.h"
+#include "kernel_matrix.h"
+#include "cold_cache.h"
+#include "prefetch_control.h"
+#include "atomic_tests.h"
+#include "allocator_bench.h"
+#include "thread_scaling.h"
+#include "contention.h"
+#include "soak.h"
+#include "cpu_topology.h"
+#include "coherence_tests.h"
+#include "numa_utils.h"
+#include "page_allocator.h"
+#include "worker_pool.h"
+#include "sample_stats.h"
+#include "calibration.h"
+#include "perf_counters.h"
+#include "io_tests.h"
+#include "mapping_tests.h"
+#include "tlb_sweep.h"
+#include "copy_sweep.h"
+#include "memory_tiers.h"
+#include "gpu_bandwidth.h"
+#include "ring_transfer.h"
+#include "trace_replay.h"
+#include "ndjson_sink.h"
+#include "peak_calibration.h"
+
+/**
+ * @brief Memory Bandwidth Tester class
+ */
+class MemoryBandwidthTester {
+private:
+    std::unique_ptr<PlatformInterface> platform;
+    CacheInfo cache_info;
+    WorkingSetSizes working_sets;
+    std::vector<AlignedBuffer> buffers;
+    std::vector<uint8_t*> aligned_buffers; // Keep for compatibility with existing test functions
+    size_t current_buffer_size;
+    std::atomic<bool> stop_flag;
+    OutputFormatter formatter;
+    size_t cache_line_size;
+    SystemInfo cached_system_info;
+    CPUAffinityType cpu_affinity;
+    KernelType kernel;  // Resolved once so every result reports the kernel that actually ran
+    PointerChase::ChaseConfig chase_config;
+    PageMode page_mode;  // Page backing requested for every buffer
+    bool numa_thread_binding;  // When set, run_test binds threads to numa_cpu_node instead of cpu_affinity
+    size_t numa_cpu_node;
+    NumaTopology numa_topology;
+    CpuTopology cpu_topology;
+    WorkerPool pool;  // Persistent workers; worker i always runs thread i of a test
+    size_t pinned_threads;  // Affinity the pool was last pinned with (0: not pinned)
+    bool pinned_numa_binding;
+    size_t pinned_numa_node;
+    std::vector<size_t> placement_cpus;  // When non-empty, worker i is pinned to placement_cpus[i % size]
+    std::string placement_name = CpuTopologyUtils::placement_to_string(CpuTopologyUtils::Placement::DEFAULT);
+    Ndjson::Sink* ndjson_sink = nullptr;  // Receives every result as it completes (nullptr: no records)
+    std::vector<SampleRing> sample_rings;  // One per worker, allocated before measurements start
+    std::vector<ThreadStats> last_thread_stats;  // Per-thread breakdown of the last run_test
+    DistributionStats last_bandwidth_distribution;
+    std::vector<double> last_bandwidth_samples;  // Pooled samples behind last_bandwidth_distribution
+    DistributionStats last_latency_distribution;
+    // Shared operands of the cooperative GEMM; worker i computes a band of rows of C.
+    // Elements are of matrix_precision's operand (A, B) and accumulate (C) types;
+    // 64-bit words keep every element type aligned.
+    std::vector<uint64_t> matrix_a;
+    std::vector<uint64_t> matrix_b;
+    std::vector<uint64_t> matrix_c;
+    size_t matrix_edge = 0;
+    MatrixMultiply::MatrixPrecision matrix_precision = MatrixMultiply::MatrixPrecision::FP32;
+    std::vector<std::unique_ptr<MatrixMultiply::MatrixMultiplier>> matrix_multipliers;  // One per worker
+    GemmStats last_gemm_stats;  // Compute metrics of the last matrix multiply run (matrix_size 0 otherwise)
+    std::string last_matrix_acceleration;  // Backend that ran the last matrix multiply
+    bool calibrating = false;  // Time-budgeted iteration counts instead of scale_iterations
+    Calibration::Settings calibration_settings;
+    CalibrationStats last_calibration;  // How the last calibrated result was measured (repetitions 0 otherwise)
+    bool counting = false;  // Hardware counters around every measured region
+    std::vector<std::unique_ptr<PerfCounters::CounterGroup>> thread_counters;  // One per worker, opened by it
+    std::unique_ptr<PerfCounters::CounterGroup> uncore_counters;  // Memory controllers (nullptr: unavailable)
+    PerfCounters::CounterValues last_counters;  // Counters of the last run_test (empty if not counted)
+    std::unique_ptr<EnergyMeter::Meter> energy_meter;  // Package and DRAM energy (nullptr: not sampled)
+    EnergyStats last_energy;  // Energy of the last run_test (measured false if not sampled)
+    FileOptions file_backing;  // Buffers map a temporary file when enabled (page_mode is then unused)
+    PageFaultStats last_page_faults;  // Faults of the last run_test over file-backed buffers
+    StreamCounts stream_counts;  // Arrays read and written by the STREAMS pattern
+    AccessPatterns::AccessConfig access_config;  // Element size, stride and index distribution of sparse patterns
+    AccessStats last_access;  // Useful and line bandwidth of the last sparse run_test
+    unsigned decode_bits = EncodedScans::DEFAULT_BITS;  // Packed value width of the decode patterns
+    DecodeStats last_decode;  // Decoded output of the last encoded-scan run_test
+    ProxyKernels::Config proxy_config;  // Probe, load factor, batch and merge ways of the proxy patterns
+    ProxyStats last_proxy;  // Operation rate of the last proxy run_test
+    IrregularKernels::Config irregular_config;  // Matrix shape, row length and stencil tile of the irregular patterns
+    IrregularStats last_irregular;  // Flop rate and triad share of the last irregular run_test
+    std::map<std::pair<size_t, size_t>, double> triad_rooflines;  // Triad GB/s by (buffer size, threads)
+    std::map<std::pair<KernelMatrix::Family, std::string>, const KernelMatrix::Kernel*> tuned_kernels;  // By family and level (--tune)
+    const KernelMatrix::Kernel* tuning_kernel = nullptr;  // Shape run_tune is measuring; tuned_kernels are off while set
+    bool tuning = false;
+    const KernelMatrix::Kernel* last_tuned = nullptr;  // Shape the last run_test ran (nullptr: the kernel's loop)
+    bool cold = false;  // Evict before every pass of the patterns that support it (--cold)
+    ColdCache::Method cold_method = ColdCache::Method::FLUSH;
+    std::vector<ColdCache::Evictor> evictors;  // One per worker, sized for the last thread count
+    size_t prefetch_distance = 0;  // Software prefetch distance of the read, strided and random patterns (0: none)
+    // Created on first use; restores the hardware prefetchers when the tester is destroyed
+    std::unique_ptr<PrefetchControl::HardwarePrefetchers> hardware_prefetchers;
+    bool hardware_prefetchers_disabled = false;
+
+public:
+    MemoryBandwidthTester(OutputFormat output_format = OutputFormat::MARKDOWN, 
+                         CPUAffinityType affinity_type = CPUAffinityType::DEFAULT,
+                         KernelType kernel_type = KernelType::AUTO,
+                         const PointerChase::ChaseConfig& chase = {},
+                         PageMode pages = PageMode::DEFAULT);
+
+    ~MemoryBandwidthTester();
+
+    /**
+     * @brief Allocate cache-aligned memory buffers for testing
+     * 
+     * Buffers are created untouched and then initialized by first_touch_buffers,
+     * so each page is faulted in by the thread that will later access it.
+     *
+     * @param total_size Total memory to allocate across all buffers
+     * @param num_buffers Number of separate buffers to create
+     * @param num_threads Thread count of the tests that will use the buffers
+     * @param first_touch Initialize now; pass false to set a memory policy first
+     * @param alignment Buffer alignment in bytes (raised to at least a cache line)
+     * @return true if allocation succeeded, throws MemoryError on failure
+     */
+    bool allocate_buffers(size_t total_size, size_t num_buffers, size_t num_threads = 1, bool first_touch = true,
+                          size_t alignment = 0);
+
+    /**
+     * @brief Allocate the arrays a set of patterns shares out of a working set
+     *
+     * As many arrays as the widest pattern needs (footprint_for), aligned as
+     * its kernels prefer; a read-only run allocates one array, not four.
+     */
+    bool allocate_pattern_buffers(const std::vector<TestPattern>& patterns, size_t total_size, size_t num_threads,
+                                  bool first_touch = true);
+
+    /**
+     * @brief Write the test pattern in parallel, one slice per test thread
+     *
+     * Thread i is pinned exactly as run_test pins it and touches the same
+     * [start, end) slice of every buffer that run_test will hand it, so
+     * under first-touch placement each page lands on the node of the thread
+     * that measures it.
+     *
+     * @param num_threads Thread count of the tests that will use the buffers
+     */
+    void first_touch_buffers(size_t num_threads);
+
+    /**
+     * @brief Clean up allocated memory buffers
+     * 
+     * Uses RAII pattern - AlignedBuffer destructors automatically handle cleanup
+     */
+    void cleanup_buffers();
+
+    /**
+     * @brief Calibrate iteration counts of cache-sized measurements within a time budget
+     *
+     * Replaces MemoryUtils::scale_iterations in the cache-aware and roofline
+     * modes; the base iteration count is then ignored there.
+     */
+    void set_calibration(const Calibration::Settings& settings);
+
+    /**
+     * @brief Count hardware events around every measured region
+     *
+     * Thread counters are opened lazily by each pool worker; memory
+     * controller counters usually need CAP_PERFMON or perf_event_paranoid
+     * <= 0 and are simply absent otherwise.
+     *
+     * @return false if neither thread nor memory-controller counters can be opened here
+     */
+    bool enable_counters();
+
+    /**
+     * @brief Read package and DRAM energy counters around every measured region
+     *
+     * powercap energy_uj and the RAPL MSRs need root on current Linux
+     * kernels; the counters are simply absent otherwise.
+     *
+     * @return false if the platform exposes no readable energy counter
+     */
+    bool enable_energy();
+
+    /**
+     * @brief Energy counters in use, for run notes (empty if not sampled)
+     */
+    std::string describe_energy() const;
+
+    /**
+     * @brief Back every buffer with a shared mapping of a temporary file
+     *
+     * The existing kernels then run over page-cache pages. Before each
+     * run_test the mapping is returned to the requested page-cache state,
+     * and the page faults taken while measuring are reported with the result.
+     */
+    void set_file_backing(const FileOptions& options);
+
+    /**
+     * @brief Arrays read and written per element by the STREAMS pattern
+     */
+    void set_stream_counts(const StreamCounts& counts);
+
+    /**
+     * @brief Element size, stride and index distribution of the strided, gather and scatter patterns
+     */
+    void set_access_config(const AccessPatterns::AccessConfig& config);
+
+    /**
+     * @brief Packed value width of the decode_bitpack, decode_delta and decode_dict patterns
+     */
+    void set_decode_bits(unsigned bits);
+
+    /**
+     * @brief Probe, load factor and batch of hash_probe, and the ways of merge
+     */
+    void set_proxy_config(const ProxyKernels::Config& config);
+
+    /**
+     * @brief Matrix shape and row length of spmv_csr and spmv_sell, and the tile of stencil
+     */
+    void set_irregular_config(const IrregularKernels::Config& config);
+
+    /**
+     * @brief Run the tuned loop shapes of read, write and triad at the levels they were tuned for
+     *
+     * Applies with temporal stores and without a software prefetch distance;
+     * other runs keep the kernel's own loops.
+     *
+     * @throws ConfigurationError if a shape is not one of this build's KernelMatrix shapes
+     */
+    void set_tuned_shapes(const std::vector<PeakCalibration::TunedShape>& shapes);
+
+    /**
+     * @brief Evict the working set before every pass, outside the timed window
+     *
+     * Applies to the patterns the registry marks cold; run_test rejects the
+     * others. Each kernel subtracts the time of its evictions, so results
+     * are the bandwidth and latency of passes that start from memory.
+     */
+    void set_cold(ColdCache::Method method);
+
+    /**
+     * @brief Cold-pass method, for run notes (empty if passes run warm)
+     */
+    std::string describe_cold() const;
+
+    /**
+     * @brief Place worker i on the i-th CPU of a topology-ordered list instead of logical CPU i
+     *
+     * Ignored where threads cannot be pinned to single CPUs. Set before
+     * allocating buffers so first touch runs on the same CPUs as the tests.
+     *
+     * @param list CPUs of a LIST placement
+     * @throws ConfigurationError if the list names a CPU that is not online
+     */
+    void set_placement(CpuTopologyUtils::Placement placement, const std::vector<size_t>& list = {});
+
+    void set_ndjson_sink(Ndjson::Sink* sink);
+
+    /**
+     * @brief Stream a finished result to the NDJSON sink, if any
+     *
+     * Must be called while the buffers of that result are still allocated,
+     * so the record reports the page backing it actually ran on.
+     *
+     * @param mode "large_memory" or "cache_hierarchy"
+     */
+    void record_result(const TestResult& result, const std::string& mode) const;
+
+    const CpuTopology& get_cpu_topology() const;
+
+    /**
+     * @brief CPU each of num_threads workers runs on, as pin_workers places them
+     *
+     * Where threads are not pinned to single CPUs (macOS) this is the
+     * logical order the scheduler is assumed to follow.
+     */
+    std::vector<size_t> worker_cpus(size_t num_threads) const;
+
+    /**
+     * @brief Software prefetch distance in bytes for the patterns that support it (0: none)
+     */
+    void set_prefetch_distance(size_t distance);
+
+    /**
+     * @brief Switch the hardware prefetchers of every CPU off, or back to their original state
+     *
+     * @throws PlatformError if the platform cannot control them or the switch fails
+     */
+    void set_hardware_prefetchers(bool enabled);
+
+    /**
+     * @brief What the prefetcher control toggles ("MSR 0x1a4 mask 0xf on 8 CPUs"; empty before first use)
+     */
+    std::string describe_hardware_prefetchers() const;
+
+    /**
+     * @brief Read one file through every requested I/O path
+     *
+     * The file is created once and fsynced, so buffered paths start from a
+     * warm page cache; every block size is combined with every queue depth
+     * for io_uring and measured once for the synchronous paths. Runs on the
+     * calling thread, outside the worker pool.
+     *
+     * @param directory Where the file is created (removed afterwards)
+     * @param file_size Bytes per pass
+     * @param passes Times each path reads the whole file
+     * @param clock_ghz Estimated core clock for cycles per byte
+     */
+    std::vector<IoTests::Result> run_io_paths(const std::string& directory, size_t file_size, size_t passes,
+                                              const std::vector<IoTests::Method>& methods,
+                                              const std::vector<size_t>& block_sizes,
+                                              const std::vector<size_t>& queue_depths, double clock_ghz);
+
+    /**
+     * @brief Replay a trace over a working set as large as its span
+     *
+     * Threads replay contiguous runs of blocks (at most one thread per
+     * block), each decoding into its own workspace allocated before timing.
+     * A decode-only pass over the same slices measures what decoding alone
+     * costs per record.
+     *
+     * @param passes Times each thread replays its slice
+     */
+    TraceReplay::ReplayResult run_trace_replay(const TraceReplay::Trace& trace, size_t passes, size_t num_threads);
+
+    /**
+     * @brief Execute a memory bandwidth test with specified parameters
+     * 
+     * @param pattern Test pattern to execute (sequential read/write, random, STREAM kernels, streams)
+     * @param iterations Number of test iterations to run
+     * @param num_threads Number of threads to use for the test
+     * @param cache_aware Whether to run cache-hierarchy-aware variant
+     * @param store_policy Store policy for write, copy and triad
+     * @return PerformanceStats containing bandwidth, latency, and timing results
+     */
+    PerformanceStats run_test(TestPattern pattern, size_t iterations, size_t num_threads, bool cache_aware = false,
+                              StorePolicy store_policy = StorePolicy::TEMPORAL,
+                              MatrixMultiply::MatrixPrecision precision = MatrixMultiply::MatrixPrecision::FP32);
+
+    /**
+     * @brief Cache-aware run_test with a calibrated iteration count
+     *
+     * Reports the repetition with the median bandwidth; its sample
+     * distributions, per-thread breakdown, GEMM metrics and counters are restored so
+     * attach_sample_stats describes the same run.
+     */
+    PerformanceStats run_calibrated_test(TestPattern pattern, size_t num_threads, StorePolicy store_policy,
+                                         MatrixMultiply::MatrixPrecision precision);
+
+    std::vector<TestResult> run_cache_aware_test(TestPattern pattern, size_t iterations, size_t num_threads,
+                                                 const std::vector<StorePolicy>& store_policies = {StorePolicy::TEMPORAL},
+                                                 const std::vector<MatrixMultiply::MatrixPrecision>& precisions =
+                                                     {MatrixMultiply::MatrixPrecision::FP32});
+
+    /**
+     * @brief Measure a pattern for every (CPU node, memory node) pair
+     *
+     * Buffers are bound to each memory node in turn with mbind before they
+     * are first touched, then the pattern runs once per CPU node with its
+     * threads pinned to that node.
+     * Each CPU node runs min(num_threads, cpus on node) threads so remote
+     * and local cells are compared at the same thread count per node.
+     *
+     * @param pattern Test pattern to execute (matrix multiply is not supported)
+     * @param iterations Number of test iterations to run
+     * @param num_threads Requested number of threads per CPU node
+     * @param total_size Total memory to allocate across all buffers
+     * @param store_policy Store policy for write, copy and triad
+     * @return One entry per measured node pair
+     * @throws PlatformError if the platform cannot bind memory to a node
+     */
+    std::vector<NumaMatrixEntry> run_numa_matrix(TestPattern pattern, size_t iterations, size_t num_threads,
+                                                 size_t total_size,
+                                                 StorePolicy store_policy = StorePolicy::TEMPORAL);
+
+    /**
+     * @brief Bandwidth of one pattern at each local:far page ratio
+     *
+     * Threads are bound to the local tier and the buffers are placed at
+     * each ratio before they are first touched, interleaved page by page
+     * where the kernel supports weights. The share of pages that actually
+     * landed on the far node is measured after placement.
+     *
+     * @param pattern Test pattern to execute (matrix multiply is not supported)
+     * @param num_threads Requested number of threads, capped at the local node's CPUs
+     * @param total_size Total memory to allocate across all buffers
+     * @param ratios LOCAL:FAR ratios, each run against every far node
+     * @return One point per far node and ratio
+     * @throws PlatformError if there is no second tier or the buffers cannot be placed
+     */
+    std::vector<MemoryTiers::Point> run_memory_tiers(TestPattern pattern, size_t iterations, size_t num_threads,
+                                                     size_t total_size, StorePolicy store_policy,
+                                                     const std::vector<MemoryTiers::Ratio>& ratios);
+
+    /**
+     * @brief GPU kernels over unified memory, alone and against CPU threads streaming the same traffic
+     *
+     * The GPU arrays and the CPU threads' own source and destination are five
+     * page-aligned buffers out of the working set. Each kernel's iteration
+     * count is calibrated to GPU_MIN_SECONDS; the CPU threads then stream for
+     * as long as the GPU ran alone, and finally both run at once, the CPU
+     * threads starting GPU_CPU_RAMP_MS before the kernel and stopping when it
+     * completes.
+     *
+     * @param kernels Kernels to run, in order
+     * @param num_threads CPU threads of the CPU-alone and shared runs
+     * @param total_size Total memory to allocate across all buffers
+     * @return One point per kernel
+     * @throws PlatformError if the platform has no GPU backend over unified memory
+     * @throws BenchmarkError if a kernel fails on the GPU
+     */
+    std::vector<GpuBandwidth::Point> run_gpu_bandwidth(const std::vector<GpuBandwidth::Kernel>& kernels,
+                                                       size_t num_threads, size_t total_size);
+
+    /**
+     * @brief CPUs of a core-to-core run: a kernel CPU list such as "0-7,64-71", or every online CPU if empty
+     * @throws ConfigurationError if the list is malformed or names a CPU that is not online
+     */
+    std::vector<size_t> core_to_core_cpus(const std::string& list) const;
+
+    /**
+     * @brief Whether threads can be pinned to one CPU each (core-type affinity on macOS cannot)
+     */
+    bool pins_single_cpus() const;
+
+    /**
+     * @brief Pin function placing the calling thread on one CPU through set_thread_affinity
+     */
+    CoherenceTests::PinFunction cpu_pinning(size_t total_threads) const;
+
+    /**
+     * @brief One-way cache-line transfer latency between every ordered pair of CPUs
+     *
+     * @param cpus CPUs to pair
+     * @return Row-major matrix; empty if threads cannot be pinned to single CPUs
+     */
+    std::vector<CoherenceTests::PingPongResult> run_core_to_core(const std::vector<size_t>& cpus);
+
+    /**
+     * @brief Packed against padded counters at each FALSE_SHARING_THREADS count up to num_threads
+     *
+     * Thread t runs on cpus[t % cpus.size()], so the counters are contended
+     * from the first CPUs of the list (unpinned where pinning is unavailable).
+     *
+     * @param cpus CPUs the threads are placed on, in order
+     * @param num_threads Largest thread count (at least 2 are always run)
+     * @return Packed and padded result for each thread count
+     */
+    std::vector<CoherenceTests::FalseSharingResult> run_false_sharing(const std::vector<size_t>& cpus,
+                                                                      size_t num_threads);
+
+    /**
+     * @brief Every atomic operation, ordering, sharing and implementation at each thread count up to num_threads
+     *
+     * Thread t runs on the t-th online CPU (wrapping when num_threads exceeds
+     * them), unpinned where pinning is unavailable.
+     *
+     * @param num_threads Largest thread count of the scaling run
+     */
+    std::vector<AtomicTests::Result> run_atomics(size_t num_threads);
+
+    /**
+     * @brief Every mapping operation over a fresh mapping of bytes at each thread count
+     *
+     * Single-threaded operations run once, before the thread counts. Threads
+     * run on worker_cpus, pinned where single-CPU pinning is available.
+     */
+    std::vector<MappingTests::Result> run_mapping_costs(const std::vector<MappingTests::Operation>& ops,
+                                                        size_t bytes, size_t repetitions,
+                                                        const std::vector<size_t>& thread_counts);
+
+    /**
+     * @brief TLB reach sweep of every page size on the first worker CPU
+     *
+     * Pinned where single-CPU pinning is available.
+     *
+     * @param max_bytes Largest span of a sweep (--size)
+     */
+    std::vector<TlbSweep::Curve> run_tlb_sweep(const std::vector<PageMode>& modes, size_t max_bytes,
+                                               size_t repetitions);
+
+    /**
+     * @brief memcpy/memset size-class sweep on the first worker CPU
+     *
+     * Runs unpinned where threads cannot be pinned to single CPUs.
+     */
+    std::vector<CopySweep::Point> run_copy_sweep(const std::vector<CopySweep::Operation>& operations,
+                                                 const std::vector<CopySweep::Implementation>& implementations,
+                                                 const std::vector<CopySweep::Alignment>& alignments,
+                                                 const std::vector<size_t>& sizes, size_t repetitions);
+
+    /**
+     * @brief Ring transfers of every kind and payload between every pair of cpus
+     *
+     * Pairs are labelled with the closest cache level they share, from the
+     * CPU topology and the L2 sharing lists.
+     *
+     * @param cpus CPUs to pair
+     * @return Empty if threads cannot be pinned to single CPUs
+     */
+    std::vector<RingTransfer::Result> run_ring_transfers(const std::vector<RingTransfer::Kind>& kinds,
+                                                         const std::vector<size_t>& payloads,
+                                                         const std::vector<size_t>& cpus, size_t repetitions);
+
+    /**
+     * @brief Every allocator on every workload at each thread count
+     *
+     * Threads run on worker_cpus, pinned where single-CPU pinning is available.
+     * Fragmentation replaces ALLOC_FRAGMENTATION_OPS objects per thread;
+     * churn and producer/consumer run ALLOC_OPS_PER_THREAD pairs.
+     */
+    std::vector<AllocatorBench::Result> run_allocator_bench(const std::vector<AllocatorBench::AllocatorSpec>& allocators,
+                                                            const std::vector<AllocatorBench::Workload>& workloads,
+                                                            const std::vector<size_t>& thread_counts);
+
+    /**
+     * @brief Measure probe latency against increasing bandwidth load
+     *
+     * Worker 0 runs the pointer-chase probe while workers 1..num_threads-1
+     * stream the load pattern through throttled delay loops. The first point
+     * is the probe alone; the rest sweep LOADED_LATENCY_DELAYS from lightest
+     * to heaviest load.
+     *
+     * @param load_pattern SEQUENTIAL_READ, SEQUENTIAL_WRITE or COPY
+     * @param iterations Number of timed probe passes per point
+     * @param num_threads Probe thread plus load threads
+     * @param total_size Total memory to allocate across all buffers
+     * @param store_policy Store policy for write and copy load
+     * @return Idle point followed by one point per delay
+     */
+    std::vector<LoadedLatencyPoint> run_loaded_latency(TestPattern load_pattern, size_t iterations,
+                                                       size_t num_threads, size_t total_size,
+                                                       StorePolicy store_policy = StorePolicy::TEMPORAL);
+
+    /**
+     * @brief Measure victim slowdown against increasing aggressor load
+     *
+     * Workers 0..victim_threads-1 run the victim pattern over buffers 0 and 1
+     * while the remaining workers run the throttled aggressor over buffers 2
+     * and 3, so the groups share only the memory system. The first point is
+     * the victims alone; the rest sweep LOADED_LATENCY_DELAYS from lightest
+     * to heaviest load. With resctrl schemata, each group is placed in its
+     * own resctrl control group for the whole curve.
+     *
+     * @param victim_pattern Pattern run by the victims (Contention::supports_victim)
+     * @param iterations Victim passes per point
+     * @param victim_threads Victim group size, below num_threads
+     * @param total_size Total memory to allocate across all buffers
+     * @param victim_schemata Limits of the victim group (empty: no resctrl group)
+     * @param aggressor_schemata Limits of the aggressor group (empty: no resctrl group)
+     * @return Victims-alone point followed by one annotated point per delay
+     * @throws PlatformError if a resctrl group cannot be created or joined
+     */
+    std::vector<Contention::ContentionPoint> run_contention(TestPattern victim_pattern, Contention::Aggressor aggressor,
+                                                            size_t iterations, size_t victim_threads,
+                                                            size_t num_threads, size_t total_size,
+                                                            const std::string& victim_schemata = "",
+                                                            const std::string& aggressor_schemata = "",
+                                                            StorePolicy store_policy = StorePolicy::TEMPORAL);
+
+    /**
+     * @brief Stream one pattern until the deadline and sample its bandwidth over time
+     *
+     * Every worker runs the unthrottled load generator over its slice and
+     * publishes its byte count through its own progress slot; a sampler
+     * thread turns the slots into one aggregate GB/s sample per interval,
+     * with core frequency and temperatures, and stops the workers at the
+     * deadline.
+     *
+     * @param pattern SEQUENTIAL_READ, SEQUENTIAL_WRITE, COPY or RANDOM_READ
+     * @param duration_seconds Length of the soak
+     * @param interval_ms Sampling period
+     * @return One sample per interval
+     */
+    std::vector<Soak::Sample> run_soak(TestPattern pattern, size_t num_threads, size_t total_size,
+                                       double duration_seconds, size_t interval_ms,
+                                       StorePolicy store_policy = StorePolicy::TEMPORAL);
+
+    /**
+     * @brief Sweep software prefetch distances, optionally with the hardware prefetchers off
+     *
+     * Every distance of PrefetchControl::sweep_distances runs with the
+     * hardware prefetchers as they are, then, for BOTH, again with them
+     * switched off (they are restored afterwards). The first point, no
+     * software prefetch with the hardware prefetchers as they are, is the
+     * baseline of every delta.
+     *
+     * @param pattern Sequential read, strided read or a random pattern
+     * @param iterations Number of test iterations per point
+     * @param num_threads Number of threads to use
+     * @param total_size Working set
+     * @param hardware DEFAULT and OFF keep the current state; BOTH measures on and off
+     * @return One point per configuration
+     * @throws PlatformError if BOTH is requested and the prefetchers cannot be switched
+     */
+    std::vector<PrefetchPoint> run_prefetch_sweep(TestPattern pattern, size_t iterations, size_t num_threads,
+                                                  size_t total_size, PrefetchControl::HardwareMode hardware);
+
+    /**
+     * @brief Run one pattern at each thread count over the buffers already allocated
+     *
+     * Buffers must have been allocated (and first-touched) for the largest
+     * count, so every point measures the same pages.
+     *
+     * @param pattern Memory access pattern to test
+     * @param iterations Number of test iterations per point
+     * @param counts Thread counts in ascending order
+     * @param store_policy Store policy of the write, copy and triad patterns
+     * @param precision Element type of the matrix multiply
+     * @return One annotated point per thread count
+     */
+    std::vector<ThreadScaling::ScalingPoint> run_thread_scaling(TestPattern pattern, size_t iterations,
+                                                                const std::vector<size_t>& counts,
+                                                                StorePolicy store_policy,
+                                                                MatrixMultiply::MatrixPrecision precision);
+
+    /**
+     * @brief Measure the practical peak bandwidth of this host
+     *
+     * Read, write and copy run at every thread count with every store policy
+     * the kernel supports, over buffers first touched by the largest count;
+     * the best point of each family is its ceiling.
+     *
+     * @param iterations Number of test iterations per point
+     * @param counts Thread counts to try, ascending
+     * @param total_size Working set
+     * @return Ceiling of each family
+     * @throws MemoryError if the buffers cannot be allocated
+     */
+    std::vector<PeakCalibration::Ceiling> run_peak_calibration(size_t iterations, const std::vector<size_t>& counts,
+                                                               size_t total_size);
+
+    /**
+     * @brief Find the fastest loop shape of read, write and triad at every working-set level
+     *
+     * Levels are sized as the roofline's (half of L1, L2 and L3, and the
+     * DRAM working set). Every KernelMatrix shape of a family runs until it
+     * lasts TUNE_MIN_SECONDS; the TUNE_FINALISTS fastest and the automatic
+     * kernel's own loop then run TUNE_REPETITIONS more times, and the best
+     * run of each decides. Shapes whose results do not verify are dropped,
+     * and so are levels where no shape beats the kernel's own loop.
+     *
+     * @param num_threads Threads of every measurement
+     * @param total_size DRAM working set
+     * @return Fastest shape per family and level
+     */
+    std::vector<PeakCalibration::TunedShape> run_tune(size_t num_threads, size_t total_size);
+
+    /**
+     * @brief Measure a per-machine roofline
+     *
+     * For L1, L2 and L3 (half of each cache, per thread for private levels)
+     * and for the DRAM working set, triad gives the memory ceiling and
+     * arithmetic_intensity_test sweeps ROOFLINE_FLOPS_PER_ELEMENT. Passes
+     * are calibrated when a time budget is set; with fixed iterations they
+     * shrink beyond 1 FLOP/byte so compute-bound points do not dominate the
+     * run time. Compute ceilings are the FP64 peak of the sweep and one GEMM run
+     * per requested precision.
+     *
+     * @param iterations Number of test iterations to run
+     * @param num_threads Number of threads to use for every kernel
+     * @param total_size Working set of the DRAM level
+     * @param precisions GEMM precisions to report compute ceilings for
+     * @return Ceilings and points (levels that cannot be allocated are skipped)
+     */
+    Roofline run_roofline(size_t iterations, size_t num_threads, size_t total_size,
+                          const std::vector<MatrixMultiply::MatrixPrecision>& precisions);
+
+    /**
+     * @brief Sweep geometric working sets and locate the cache boundaries
+     *
+     * Every working set from WorkingSetSizes::get_sweep_sizes is measured
+     * with a sequential read and a latency chase on one thread, so private
+     * levels are not multiplied by the thread count. Knees of the two curves
+     * are then attributed to the detected cache levels.
+     *
+     * @param max_size Largest working set
+     * @param steps_per_octave Working sets per doubling
+     * @param iterations Number of test iterations to run (scaled per size)
+     * @return Points, knees and effective capacities (sizes that cannot be allocated are skipped)
+     */
+    WorkingSetSweep run_working_set_sweep(size_t max_size, size_t steps_per_octave, size_t iterations);
+
+    /**
+     * @brief Store policies to run for a pattern
+     *
+     * Only write, copy and triad store through the policy-specific kernels;
+     * every other pattern runs once.
+     */
+    static std::vector<StorePolicy> store_policies_for(TestPattern pattern,
+                                                       const std::vector<StorePolicy>& store_policies);
+
+    /**
+     * @brief Operand precisions to run for a pattern (only matrix multiply has several)
+     */
+    static std::vector<MatrixMultiply::MatrixPrecision> precisions_for(
+        TestPattern pattern, const std::vector<MatrixMultiply::MatrixPrecision>& precisions);
+
+    /**
+     * @brief Result name, with the operand precision appended for matrix multiply
+     *        the array counts for streams and the element size for sparse patterns ("Gather 8B"),
+     *        and the software prefetch distance where one applies ("Sequential Read (prefetch 512 B)")
+     */
+    std::string test_name_for(TestPattern pattern, MatrixMultiply::MatrixPrecision precision) const;
+
+    /**
+     * @brief Arrays a pattern reads or writes (buffer 0 onwards)
+     */
+    size_t arrays_for(TestPattern pattern) const;
+
+    /**
+     * @brief Bytes to allocate for a number of arrays out of a working set
+     *
+     * Each array keeps the size it has always had, a quarter of the working
+     * set, so results stay comparable; patterns with more arrays divide the
+     * working set between all of them instead of growing past it.
+     */
+    static size_t footprint_for(size_t total_size, size_t arrays);
+
+    /**
+     * @brief Store policy label for a result ("-" for patterns without a store policy)
+     */
+    static std::string store_policy_name_for(TestPattern pattern, StorePolicy store_policy);
+
+    /**
+     * @brief Thread count a pattern actually runs with
+     *
+     * The latency chase is a single dependent chain: extra threads would load
+     * the memory system and turn idle latency into loaded latency.
+     */
+    static size_t threads_for(TestPattern pattern, size_t num_threads);
+
+    /**
+     * @brief Patterns that use part of each cache line and report useful next to line bandwidth
+     */
+    static bool is_sparse(TestPattern pattern);
+
+    static bool uses_store_policy(TestPattern pattern);
+
+    /**
+     * @brief Name of the kernel or backend that runs a given pattern
+     *
+     * Random access and strided reads are latency-bound and stay scalar;
+     * gather and scatter report the kernel only where it has hardware
+     * gather or scatter instructions; the latency chase reports its chain
+     * layout; matrix multiply reports the GEMM backend of
+     * its last run (which depends on the precision) instead of the SIMD
+     * kernel. Read, write and triad report the tuned shape their last run
+     * used, as tuned:<shape>.
+     */
+    std::string kernel_name_for(TestPattern pattern) const;
+
+
+    void print_cache_results(const std::string& pattern_name, const std::vector<TestResult>& results);
+
+    const SystemInfo& get_cached_system_info() const;
+
+    /**
+     * @brief Report efficiency against a calibrated peak as well as the theoretical one
+     */
+    void set_calibrated_peak(double bandwidth_gbps, const std::string& recorded);
+
+    const NumaTopology& get_numa_topology() const;
+
+    /**
+     * @brief Requested and obtained page backing of the current buffers
+     *
+     * Read back from the kernel after initialization, since THP is only a
+     * hint and may leave part or all of a buffer on base pages.
+     */
+    std::string describe_page_backing() const;
+
+    /**
+     * @brief Check a run_test result against the ceiling of the level its working set lands in
+     *
+     * Must be called while the buffers of that run are still allocated.
+     *
+     * @return Validation warnings (empty if the result is plausible)
+     */
+    std::vector<std::string> validate_result(TestPattern pattern, const PerformanceStats& stats,
+                                             size_t num_threads) const;
+
+    /**
+     * @brief Copy the sample distributions, per-thread breakdown and GEMM
+     *        compute metrics of the last run_test into a result
+     */
+    void attach_sample_stats(TestResult& result) const;
+
+private:
+    /**
+     * @brief Side results of one run_test, kept while calibration picks the reported repetition
+     */
+    struct RunDetails {
+        DistributionStats bandwidth_distribution;
+        std::vector<double> bandwidth_samples;
+        DistributionStats latency_distribution;
+        std::vector<ThreadStats> thread_stats;
+        GemmStats gemm;
+        std::string matrix_acceleration;
+        PerfCounters::CounterValues counters;
+        PageFaultStats page_faults;
+        AccessStats access;
+        DecodeStats decode;
+        ProxyStats proxy;
+        IrregularStats irregular;
+        EnergyStats energy;
+    };
+
+    /**
+     * @brief Edge of the square matrices used for MATRIX_MULTIPLY
+     *
+     * Cache-aware runs size A, B and C together to the working set, since
+     * all threads cooperate on one product (capped at 512 so small caches
+     * don't turn into long compute runs); other modes use 1024.
+     */
+    static size_t matrix_size_for(size_t buffer_size, bool cache_aware);
+
+    /**
+     * @brief Allocate the shared GEMM operands and one multiplier per worker
+     *
+     * Operands are only regenerated when the size or precision changes;
+     * multipliers keep their packing buffers across runs.
+     */
+    void prepare_matrices(size_t matrix_size, MatrixMultiply::MatrixPrecision precision, size_t num_threads);
+
+    /**
+     * @brief Rows [start, end) of C computed by one thread
+     *
+     * Rows are handed out in whole blocks of MATRIX_ROW_BLOCK so bands line
+     * up with register and tile blocks; with more threads than blocks the
+     * surplus threads get an empty band.
+     */
+    static std::pair<size_t, size_t> matrix_row_slice(size_t thread_id, size_t num_threads, size_t rows);
+
+    /**
+     * @brief Byte range [start, end) of each buffer owned by a thread
+     *
+     * Shared by run_test and first_touch_buffers so pages are first touched
+     * by the thread that measures them. The last thread takes the remainder.
+     */
+    static std::pair<size_t, size_t> thread_slice(size_t thread_id, size_t num_threads, size_t buffer_size);
+
+    /**
+     * @brief Pin pool workers for a run of num_threads threads
+     *
+     * Affinity syscalls run as a separate, unmeasured pool task and only when
+     * the thread count or NUMA binding changed since the last pinning.
+     */
+    void pin_workers(size_t num_threads);
+
+    /**
+     * @brief Open thread counters on the first num_threads workers
+     *
+     * Per-thread perf events count the thread that opens them, so each
+     * worker opens its own group in an unmeasured pool task. Groups that
+     * fail to open stay null and are not retried.
+     */
+    void prepare_counters(size_t num_threads);
+
+    /**
+     * @brief One loaded-latency point: probe on worker 0, throttled load on the rest
+     *
+     * Load threads run until the probe finishes, so the load covers the whole
+     * probe measurement; the chain is built while the load ramps up.
+     */
+    LoadedLatencyPoint measure_loaded_latency(TestPattern load_pattern, size_t iterations, size_t load_threads,
+                                              size_t delay_spins, StorePolicy store_policy);
+
+    /**
+     * @brief Create a resctrl group and move workers [first, last) into it
+     *
+     * Does nothing without schemata. Workers stay in the group until it is
+     * removed, when the kernel returns them to the default group.
+     */
+    void join_resctrl_group(Contention::ResctrlGroup& group, const std::string& name, const std::string& schemata,
+                            size_t first, size_t last);
+
+    /**
+     * @brief One contention point: victims on the first workers, throttled aggressors on the rest
+     *
+     * Aggressors run until the last victim finishes its passes, so the load
+     * covers the whole victim measurement.
+     */
+    Contention::ContentionPoint measure_contention(TestPattern victim_pattern, Contention::Aggressor aggressor,
+                                                   size_t iterations, size_t victim_threads,
+                                                   size_t aggressor_threads, size_t delay_spins,
+                                                   StorePolicy store_policy);
+
+    /**
+     * @brief One --gpu point over arrays wrapped from buffers 0 to 2, CPU traffic over buffers 3 and 4
+     */
+    GpuBandwidth::Point measure_gpu_bandwidth(GpuBandwidth::Device& device, GpuBandwidth::Kernel gpu_kernel,
+                                              const GpuBandwidth::Arrays& arrays, size_t num_threads);
+
+    /**
+     * @brief One roofline point: every thread runs the intensity kernel over its slice of buffer 0
+     */
+    PerformanceStats run_intensity_sweep_point(size_t passes, size_t num_threads, size_t flops_per_element);
+
+    /**
+     * @brief Useful and cache-line bandwidth of a sparse run
+     *
+     * Bytes processed are element bytes, so aggregated bandwidth is already the
+     * useful rate; line bytes are scaled by the same window. Latency is the
+     * time per access across all threads rather than per 64-byte line.
+     */
+    void record_access_stats(TestPattern pattern, PerformanceStats& aggregated,
+                             const std::vector<AccessPatterns::LineTraffic>& traffic);
+
+    /**
+     * @brief Decoded values and bytes of an encoded-scan run
+     *
+     * Bytes processed are packed bytes, so the value count follows from the
+     * width; latency becomes the time per decoded value across all threads.
+     */
+    void record_decode_stats(TestPattern pattern, PerformanceStats& aggregated);
+
+    /**
+     * @brief Lookups or keys per second of a proxy run
+     *
+     * Each pattern counts a fixed number of bytes per operation, so the
+     * operation count follows from the bytes; latency becomes the time per
+     * lookup or key across all threads.
+     */
+    void record_proxy_stats(TestPattern pattern, PerformanceStats& aggregated);
+
+    /**
+     * @brief Flop rate of an irregular run and its share of triad over the same working set
+     *
+     * Latency becomes the time per nonzero or stencil point across all threads.
+     * The triad reference is measured once per buffer size and thread count.
+     */
+    void record_irregular_stats(TestPattern pattern, PerformanceStats& aggregated,
+                                const std::vector<IrregularKernels::Work>& work, size_t buffer_size,
+                                size_t num_threads);
+
+    /**
+     * @brief Triad bandwidth over the first buffer split in three, run until ROOFLINE_MIN_SECONDS
+     */
+    double triad_roofline(size_t buffer_size, size_t num_threads);
+
+    /**
+     * @brief Loop shape a run of a pattern uses (nullptr: the kernel's own loop)
+     *
+     * The shape run_tune is measuring, else the tuned shape of the pattern's
+     * family at the level its arrays live in.
+     */
+    const KernelMatrix::Kernel* tuned_kernel_for(TestPattern pattern, StorePolicy store_policy, size_t buffer_size,
+                                                 size_t num_threads) const;
+
+    /**
+     * @brief Run a pattern until it lasts TUNE_MIN_SECONDS, then best of TUNE_REPETITIONS at that count if asked
+     * @return Best run (bandwidth 0 if any run failed verification)
+     */
+    PerformanceStats measure_tuning(TestPattern pattern, size_t num_threads, bool cache_aware, bool repeat);
+
+    /**
+     * @brief Average power and energy per byte between two energy readings
+     */
+    void record_energy_stats(const PerformanceStats& aggregated, const EnergyMeter::Snapshot& before,
+                             const EnergyMeter::Snapshot& after, double seconds);
+
+    /**
+     * @brief Page faults the process took during a measured run over file-backed buffers
+     *
+     * getrusage counts the whole process, but nothing else runs while the
+     * pool measures, so the delta is the faults of the kernels themselves.
+     */
+    void record_page_faults(const struct rusage& before, const struct rusage& after, double seconds);
+
+    /**
+     * @brief Overall GEMM compute metrics of a cooperative product
+     *
+     * Operations and traffic are summed over the row bands and divided by
+     * the span of the run, like the bandwidth of the aggregated result.
+     */
+    void record_gemm_stats(const std::vector<MatrixMultiply::MatrixPerformanceStats>& matrix_results,
+                           const PerformanceStats& aggregated, size_t matrix_size,
+                           MatrixMultiply::MatrixPrecision precision);
+
+    /**
+     * @brief Summarize the per-iteration samples of every thread after a run
+     *
+     * Runs after the measurement so sorting never disturbs timed loops.
+     * Pooled distributions mix the samples of all threads; patterns that do
+     * not record samples (matrix multiply) leave them empty.
+     */
+    void record_sample_stats(const std::vector<PerformanceStats>& thread_results, size_t num_threads);
+
+    /**
+     * @brief Aggregates performance statistics from multiple threads
+     * 
+     * Combines thread-level performance statistics into a single aggregate result.
+     * Bandwidth is measured over the window in which every thread was running:
+     * each thread contributes the bytes it moved inside that window (at its own
+     * average rate), so ramp-up and stragglers do not dilute the result. If the
+     * threads never overlapped, the full span from first start to last end is
+     * used instead. Latency is calculated based on cache line accesses.
+     * 
+     * @param thread_results Vector of performance statistics from individual threads
+     * @param timings Per-thread start/end timestamps from the worker pool
+     * @return Aggregated performance statistics with combined metrics
+     */
+    PerformanceStats aggregate_stats(const std::vector<PerformanceStats>& thread_results,
+                                     const std::vector<ThreadTiming>& timings);
+};
+
+#endif  // MEMORY_BANDWIDTH_TESTER_H
@@ -0,0 +1,425 @@
+#include "memory_detection.h"
+
+#include <algorithm>
+#include <cctype>
+#include <fstream>
+#include <set>
+
+#ifdef __linux__
+#include <dirent.h>
+#endif
+
+namespace MemoryDetection {
+
+namespace {
+
+constexpr uint8_t SMBIOS_MEMORY_DEVICE = 17;
+constexpr uint8_t SMBIOS_END_OF_TABLE = 127;
+// The SMBIOS table is a few KB; anything larger is not one
+constexpr size_t SMBIOS_MAX_TABLE_BYTES = 1024 * 1024;
+
+uint16_t read_word(const std::vector<uint8_t>& table, size_t offset) {
+    return static_cast<uint16_t>(table[offset] | (table[offset + 1] << 8));
+}
+
+uint32_t read_dword(const std::vector<uint8_t>& table, size_t offset) {
+    return static_cast<uint32_t>(read_word(table, offset)) | (static_cast<uint32_t>(read_word(table, offset + 2)) << 16);
+}
+
+// Width field: 0 and 0xFFFF are unknown
+size_t width(uint16_t value) {
+    return value == 0xFFFF ? 0 : value;
+}
+
+// Speed field with its 32-bit extension (0xFFFF: the speed is in the extension)
+size_t speed(const std::vector<uint8_t>& table, size_t start, uint8_t length, size_t offset, size_t extended) {
+    if (length < offset + 2) {
+        return 0;
+    }
+    uint16_t value = read_word(table, start + offset);
+    if (value != 0xFFFF) {
+        return value;
+    }
+    return length >= extended + 4 ? read_dword(table, start + extended) & 0x7FFFFFFF : 0;
+}
+
+// Alphanumeric runs of a locator, upper-cased ("P0_Node0_Channel0" -> P0, NODE0, CHANNEL0)
+std::vector<std::string> tokens(const std::string& text) {
+    std::vector<std::string> result;
+    std::string current;
+    for (char c : text) {
+        if (std::isalnum(static_cast<unsigned char>(c))) {
+            current += static_cast<char>(std::toupper(static_cast<unsigned char>(c)));
+        } else if (!current.empty()) {
+            result.push_back(current);
+            current.clear();
+        }
+    }
+    if (!current.empty()) {
+        result.push_back(current);
+    }
+    return result;
+}
+
+bool all_digits(const std::string& text) {
+    return !text.empty() && std::all_of(text.begin(), text.end(),
+                                        [](char c) { return std::isdigit(static_cast<unsigned char>(c)) != 0; });
+}
+
+// Strip a prefix, returning what follows it ("" if the token does not start with it)
+bool strip_prefix(const std::string& token, const std::string& prefix, std::string& rest) {
+    if (token.compare(0, prefix.size(), prefix) != 0) {
+        return false;
+    }
+    rest = token.substr(prefix.size());
+    return true;
+}
+
+// The EDAC root is a parameter, so reads are not confined to the SafeFileUtils roots
+bool read_line(const std::string& path, std::string& line) {
+    std::ifstream file(path);
+    if (!file.is_open() || !std::getline(file, line)) {
+        return false;
+    }
+    line.erase(line.find_last_not_of(" \t\r\n") + 1);
+    return true;
+}
+
+std::string edac_memory_type(const std::string& text) {
+    size_t pos = text.find("LPDDR");
+    if (pos == std::string::npos) {
+        pos = text.find("DDR");
+    }
+    if (pos == std::string::npos) {
+        return "";
+    }
+    return text.substr(pos);
+}
+
+std::vector<std::string> list_directory(const std::string& root, const std::string& prefix) {
+    std::vector<std::string> names;
+#ifdef __linux__
+    DIR* dir = opendir(root.c_str());
+    if (dir == nullptr) {
+        return names;
+    }
+    while (dirent* entry = readdir(dir)) {
+        std::string name = entry->d_name;
+        if (name.compare(0, prefix.size(), prefix) == 0 && all_digits(name.substr(prefix.size()))) {
+            names.push_back(name);
+        }
+    }
+    closedir(dir);
+    std::sort(names.begin(), names.end());
+#else
+    (void)root;
+    (void)prefix;
+#endif
+    return names;
+}
+
+}  // namespace
+
+std::string smbios_memory_type(uint8_t type) {
+    switch (type) {
+        case 0x12: return "DDR";
+        case 0x13: return "DDR2";
+        case 0x18: return "DDR3";
+        case 0x1A: return "DDR4";
+        case 0x1B: return "LPDDR";
+        case 0x1C: return "LPDDR2";
+        case 0x1D: return "LPDDR3";
+        case 0x1E: return "LPDDR4";
+        case 0x20: return "HBM";
+        case 0x21: return "HBM2";
+        case 0x22: return "DDR5";
+        case 0x23: return "LPDDR5";
+        case 0x24: return "HBM3";
+        default: return "";
+    }
+}
+
+std::vector<MemoryDevice> parse_smbios_memory_devices(const std::vector<uint8_t>& table) {
+    std::vector<MemoryDevice> devices;
+    size_t start = 0;
+    while (start + 4 <= table.size()) {
+        uint8_t type = table[start];
+        uint8_t length = table[start + 1];
+        if (length < 4 || start + length > table.size()) {
+            break;
+        }
+
+        // The formatted area is followed by its strings, ended by an empty string
+        std::vector<std::string> strings;
+        size_t end = start + length;
+        while (end < table.size() && table[end] != 0) {
+            size_t terminator = end;
+            while (terminator < table.size() && table[terminator] != 0) {
+                ++terminator;
+            }
+            strings.emplace_back(table.begin() + static_cast<std::ptrdiff_t>(end),
+                                 table.begin() + static_cast<std::ptrdiff_t>(terminator));
+            end = terminator + 1;
+        }
+        end = strings.empty() ? end + 2 : end + 1;
+        if (end > table.size()) {
+            break;
+        }
+
+        if (type == SMBIOS_MEMORY_DEVICE && length >= 0x15) {
+            auto string_at = [&](size_t offset) {
+                uint8_t index = table[start + offset];
+                return index > 0 && index <= strings.size() ? strings[index - 1] : std::string();
+            };
+            MemoryDevice device;
+            device.array_handle = read_word(table, start + 0x04);
+            device.total_width_bits = width(read_word(table, start + 0x08));
+            device.data_width_bits = width(read_word(table, start + 0x0A));
+            uint16_t size = read_word(table, start + 0x0C);
+            if (size == 0x7FFF && length >= 0x20) {
+                device.size_mb = read_dword(table, start + 0x1C) & 0x7FFFFFFF;
+            } else if (size != 0xFFFF) {
+                // Bit 15 set: the size is in KB
+                device.size_mb = (size & 0x8000) ? (size & 0x7FFF) / 1024 : size;
+            }
+            device.populated = size != 0;
+            device.locator = string_at(0x10);
+            device.bank_locator = string_at(0x11);
+            device.type = smbios_memory_type(table[start + 0x12]);
+            device.speed_mtps = speed(table, start, length, 0x15, 0x54);
+            device.configured_speed_mtps = speed(table, start, length, 0x20, 0x58);
+            devices.push_back(device);
+        }
+
+        if (type == SMBIOS_END_OF_TABLE) {
+            break;
+        }
+        start = end;
+    }
+    return devices;
+}
+
+std::string channel_of(const MemoryDevice& device) {
+    std::vector<std::string> parts = tokens(device.bank_locator + " " + device.locator);
+    std::string qualifiers;
+    std::string channel;
+    for (size_t i = 0; i < parts.size(); ++i) {
+        const std::string& token = parts[i];
+        const std::string next = i + 1 < parts.size() ? parts[i + 1] : std::string();
+        std::string rest;
+        if (strip_prefix(token, "CHANNEL", rest)) {
+            channel = !rest.empty() ? rest : next;
+            continue;
+        }
+        if (strip_prefix(token, "DIMM", rest)) {
+            // "DIMMA1" or "DIMM A1": the letter is the channel; "DIMM0" is a slot
+            const std::string& slot = !rest.empty() ? rest : next;
+            if (channel.empty() && slot.size() >= 2 && std::isalpha(static_cast<unsigned char>(slot[0])) &&
+                all_digits(slot.substr(1))) {
+                channel = slot.substr(0, 1);
+            }
+            continue;
+        }
+        for (const char* prefix : {"SOCKET", "CPU", "NODE", "CONTROLLER", "P"}) {
+            if (strip_prefix(token, prefix, rest) && (all_digits(rest) || (rest.empty() && all_digits(next)))) {
+                qualifiers += std::string(prefix) + (rest.empty() ? next : rest) + "/";
+                break;
+            }
+        }
+    }
+    return channel.empty() ? std::string() : qualifiers + "channel " + channel;
+}
+
+bool layout_from_devices(const std::vector<MemoryDevice>& devices, MemoryLayout& layout) {
+    MemoryLayout result;
+    std::set<std::string> channels;
+    std::set<uint16_t> arrays;
+    size_t total_mb = 0;
+    for (const auto& device : devices) {
+        if (!device.populated || device.type.empty()) {
+            continue;
+        }
+        if (result.type.empty()) {
+            result.type = device.type;
+            result.data_width_bits = device.data_width_bits;
+            result.total_width_bits = device.total_width_bits;
+        }
+        size_t speed_mtps = device.configured_speed_mtps > 0 ? device.configured_speed_mtps : device.speed_mtps;
+        if (speed_mtps > 0 && (result.speed_mtps == 0 || speed_mtps < result.speed_mtps)) {
+            result.speed_mtps = speed_mtps;
+        }
+        std::string channel = channel_of(device);
+        if (channel.empty()) {
+            channel = "slot " + device.bank_locator + "/" + device.locator + "/" + std::to_string(result.devices);
+        }
+        channels.insert(std::to_string(device.array_handle) + "|" + channel);
+        arrays.insert(device.array_handle);
+        total_mb += device.size_mb;
+        ++result.devices;
+    }
+    if (result.devices == 0) {
+        return false;
+    }
+    result.channels = channels.size();
+    result.sockets = arrays.size();
+    result.total_size_gb = total_mb / 1024;
+    result.source = "SMBIOS";
+    layout = result;
+    return true;
+}
+
+bool read_smbios_layout(MemoryLayout& layout, const std::string& path) {
+    std::ifstream file(path, std::ios::binary);
+    if (!file.is_open()) {
+        return false;
+    }
+    std::vector<uint8_t> table;
+    char byte;
+    while (table.size() < SMBIOS_MAX_TABLE_BYTES && file.get(byte)) {
+        table.push_back(static_cast<uint8_t>(byte));
+    }
+    return layout_from_devices(parse_smbios_memory_devices(table), layout);
+}
+
+bool read_edac_layout(MemoryLayout& layout, const std::string& root) {
+    MemoryLayout result;
+    std::set<std::string> channels;
+    std::set<std::string> controllers;
+    size_t total_mb = 0;
+    for (const auto& controller : list_directory(root, "mc")) {
+        std::string controller_path = root + "/" + controller;
+        for (const auto& dimm : list_directory(controller_path, "dimm")) {
+            std::string dimm_path = controller_path + "/" + dimm;
+            std::string size_text, type_text, location;
+            size_t size_mb = 0;
+            if (read_line(dimm_path + "/size", size_text)) {
+                try {
+                    size_mb = std::stoul(size_text);
+                } catch (const std::exception&) {
+                }
+            }
+            if (size_mb == 0) {
+                continue;  // Empty slot
+            }
+            read_line(dimm_path + "/dimm_mem_type", type_text);
+            read_line(dimm_path + "/dimm_location", location);
+            if (result.type.empty()) {
+                result.type = edac_memory_type(type_text);
+            }
+
+            // "channel 1 slot 0", "csrow 0 channel 1"
+            std::vector<std::string> parts = tokens(location);
+            std::string channel = dimm;
+            for (size_t i = 0; i + 1 < parts.size(); ++i) {
+                if (parts[i] == "CHANNEL") {
+                    channel = "channel " + parts[i + 1];
+                }
+            }
+            channels.insert(controller + "|" + channel);
+            controllers.insert(controller);
+            total_mb += size_mb;
+            ++result.devices;
+        }
+    }
+    if (result.devices == 0 || result.type.empty()) {
+        return false;
+    }
+    result.channels = channels.size();
+    result.sockets = controllers.size();
+    result.total_size_gb = total_mb / 1024;
+    result.source = "EDAC";
+    layout = result;
+    return true;
+}
+
+void apply_layout(const MemoryLayout& layout, MemorySpecs& specs) {
+    specs.type = layout.type;
+    if (layout.speed_mtps > 0) {
+        specs.speed_mtps = layout.speed_mtps;
+        specs.speed_detected = true;
+    }
+    if (layout.data_width_bits > 0) {
+        specs.data_width_bits = layout.data_width_bits;
+        specs.data_width_detected = true;
+    }
+    if (layout.total_width_bits > 0) {
+        specs.total_width_bits = layout.total_width_bits;
+        specs.total_width_detected = true;
+    }
+    if (layout.total_size_gb > 0) {
+        specs.total_size_gb = layout.total_size_gb;
+    }
+    specs.num_channels = layout.channels;
+    specs.num_channels_detected = true;
+    // An assumed speed would make every efficiency figure up (EDAC gives none)
+    specs.theoretical_bandwidth_gbps = specs.speed_detected
+        ? (static_cast<double>(specs.speed_mtps) * specs.data_width_bits * specs.num_channels) / 8.0 / 1000.0
+        : -1.0;
+    specs.detection_source = layout.source;
+    if (layout.sockets > 1) {
+        specs.detection_source += " (" + std::to_string(layout.sockets) + " sockets)";
+    }
+}
+
+bool detect(MemorySpecs& specs) {
+    MemoryLayout layout;
+    if (!read_smbios_layout(layout) && !read_edac_layout(layout)) {
+        return false;
+    }
+    apply_layout(layout, specs);
+    return true;
+}
+
+bool apple_chip_memory(const std::string& brand, size_t performance_cores, AppleChipMemory& memory) {
+    // Published memory interfaces; binned Max parts drop a quarter of the bus
+    struct Chip {
+        const char* name;
+        const char* type;
+        size_t speed_mtps;
+        size_t bus_width_bits;
+        size_t binned_performance_cores;  ///< P-cores of the binned part (0: not binned)
+        size_t binned_bus_width_bits;
+    };
+    static const Chip chips[] = {
+        {"M1", "LPDDR4X", 4266, 128, 0, 0},
+        {"M1 Pro", "LPDDR5", 6400, 256, 0, 0},
+        {"M1 Max", "LPDDR5", 6400, 512, 0, 0},
+        {"M1 Ultra", "LPDDR5", 6400, 1024, 0, 0},
+        {"M2", "LPDDR5", 6400, 128, 0, 0},
+        {"M2 Pro", "LPDDR5", 6400, 256, 0, 0},
+        {"M2 Max", "LPDDR5", 6400, 512, 0, 0},
+        {"M2 Ultra", "LPDDR5", 6400, 1024, 0, 0},
+        {"M3", "LPDDR5", 6400, 128, 0, 0},
+        {"M3 Pro", "LPDDR5", 6400, 192, 0, 0},
+        {"M3 Max", "LPDDR5", 6400, 512, 10, 384},
+        {"M3 Ultra", "LPDDR5", 6400, 1024, 0, 0},
+        {"M4", "LPDDR5X", 7500, 128, 0, 0},
+        {"M4 Pro", "LPDDR5X", 8533, 256, 0, 0},
+        {"M4 Max", "LPDDR5X", 8533, 512, 10, 384},
+        {"M5", "LPDDR5X", 9600, 128, 0, 0},
+    };
+
+    // "Apple M3 Max" -> "M3 Max"
+    size_t pos = brand.find("Apple ");
+    if (pos == std::string::npos) {
+        return false;
+    }
+    std::string chip = brand.substr(pos + 6);
+    chip.erase(chip.find_last_not_of(" \t\r\n") + 1);
+    for (const auto& known : chips) {
+        if (chip != known.name) {
+            continue;
+        }
+        memory.chip = known.name;
+        memory.type = known.type;
+        memory.speed_mtps = known.speed_mtps;
+        memory.bus_width_bits = known.binned_performance_cores > 0 && performance_cores > 0 &&
+                                        performance_cores <= known.binned_performance_cores
+                                    ? known.binned_bus_width_bits
+                                    : known.bus_width_bits;
+        return true;
+    }
+    return false;
+}
+
+}  // namespace MemoryDetection
@@ -0,0 +1,143 @@
+#ifndef MEMORY_DETECTION_H
+#define MEMORY_DETECTION_H
+
+#include <cstddef>
+#include <cstdint>
+#include <string>
+#include <vector>
+
+#include "memory_types.h"
+
+/**
+ * @brief Memory type, speed and channel detection from firmware tables
+ *
+ * The theoretical peak every efficiency figure divides by is speed x bus
+ * width x populated channels, so guessing any one of them makes "percent of
+ * peak" meaningless. On Linux the SMBIOS structure table is read directly
+ * from /sys/firmware/dmi/tables/DMI and every type 17 (Memory Device)
+ * structure decoded: populated devices are grouped into channels by their
+ * physical memory array (one per socket) and the channel named in their
+ * locators, and the peak uses the lowest configured speed, since every
+ * channel runs at the speed of its slowest DIMM. The table is readable by
+ * root only; otherwise the EDAC memory controllers in sysfs give the type
+ * and channels, without a speed. On Apple Silicon the chip name selects the
+ * published memory configuration of that chip.
+ */
+namespace MemoryDetection {
+
+/**
+ * @brief One SMBIOS type 17 structure
+ */
+struct MemoryDevice {
+    uint16_t array_handle = 0;       ///< Physical memory array (type 16) the device belongs to
+    std::string locator;             ///< Device locator ("DIMM_A1", "P0 CHANNEL A")
+    std::string bank_locator;        ///< Bank locator ("BANK 0", "P0_Node0_Channel0_Dimm0")
+    std::string type;                ///< "DDR4", "LPDDR5", ... ("" if not a DRAM type)
+    bool populated = false;          ///< A module is installed in the slot
+    size_t size_mb = 0;              ///< 0 if the slot is empty or the size unknown
+    size_t data_width_bits = 0;      ///< 0 if unknown
+    size_t total_width_bits = 0;     ///< Including ECC, 0 if unknown
+    size_t speed_mtps = 0;           ///< Rated speed, 0 if unknown
+    size_t configured_speed_mtps = 0;  ///< Speed the controller runs the device at, 0 if unknown
+};
+
+/**
+ * @brief Populated memory summarized for the theoretical peak
+ */
+struct MemoryLayout {
+    std::string type;
+    size_t speed_mtps = 0;         ///< Lowest configured speed of the populated devices (0: unknown)
+    size_t data_width_bits = 0;    ///< Data width of one channel (0: unknown)
+    size_t total_width_bits = 0;   ///< Width of one channel including ECC (0: unknown)
+    size_t channels = 0;           ///< Populated channels over all sockets
+    size_t sockets = 0;            ///< Memory arrays or controllers with populated channels
+    size_t devices = 0;            ///< Populated DIMMs or memory devices
+    size_t total_size_gb = 0;
+    std::string source;            ///< "SMBIOS", "EDAC"
+};
+
+/**
+ * @brief Memory configuration of an Apple Silicon chip
+ */
+struct AppleChipMemory {
+    std::string chip;           ///< "M3 Max"
+    std::string type;           ///< "LPDDR5"
+    size_t speed_mtps = 0;
+    size_t bus_width_bits = 0;  ///< Width of the whole unified memory interface
+};
+
+/**
+ * @brief SMBIOS memory type byte as a name ("" for non-DRAM and unknown types)
+ */
+std::string smbios_memory_type(uint8_t type);
+
+/**
+ * @brief Decode every type 17 structure of a raw SMBIOS structure table
+ *
+ * Parsing stops at the end-of-table structure or at the first structure
+ * that does not fit in the table.
+ */
+std::vector<MemoryDevice> parse_smbios_memory_devices(const std::vector<uint8_t>& table);
+
+/**
+ * @brief Channel a device sits on, from its locators ("" when they name none)
+ *
+ * Recognizes "Channel A"/"Channel0" with the socket, node or controller
+ * ("CPU1", "P0", "Node0", "Controller0") named in either locator, and
+ * "DIMM_A1"/"DIMMA1" slot names, whose letter is the channel. Vendors that
+ * name slots by socket only ("A1", "B2") get "" and one channel per DIMM.
+ */
+std::string channel_of(const MemoryDevice& device);
+
+/**
+ * @brief Summarize the populated devices
+ *
+ * Devices of one array and channel count once (several DIMMs per channel
+ * share its bus); a device whose locators name no channel is its own channel.
+ *
+ * @return false if no populated device has a DRAM type
+ */
+bool layout_from_devices(const std::vector<MemoryDevice>& devices, MemoryLayout& layout);
+
+/**
+ * @brief Layout from the SMBIOS table at path
+ * @return false if the table cannot be read (non-root) or describes no DRAM
+ */
+bool read_smbios_layout(MemoryLayout& layout, const std::string& path = "/sys/firmware/dmi/tables/DMI");
+
+/**
+ * @brief Layout from the EDAC memory controllers under root (mc0/dimm0/...)
+ *
+ * Each populated DIMM's dimm_location names its channel; the speed stays 0.
+ *
+ * @return false if no EDAC driver is loaded
+ */
+bool read_edac_layout(MemoryLayout& layout, const std::string& root = "/sys/devices/system/edac/mc");
+
+/**
+ * @brief Overwrite the fields of specs the layout detected, and recompute the theoretical peak
+ *
+ * The peak is N/A (-1) unless the speed was detected.
+ */
+void apply_layout(const MemoryLayout& layout, MemorySpecs& specs);
+
+/**
+ * @brief Detect the layout of this host (SMBIOS, then EDAC) and apply it to specs
+ * @return false if neither source was available; specs are left unchanged
+ */
+bool detect(MemorySpecs& specs);
+
+/**
+ * @brief Memory configuration of an Apple chip from its brand string ("Apple M3 Max")
+ *
+ * Binned Max parts have a narrower interface than the full chip; they are
+ * told apart by their number of performance cores.
+ *
+ * @param performance_cores hw.perflevel0.physicalcpu (0 if unknown: the full chip is assumed)
+ * @return false if the chip is not known
+ */
+bool apple_chip_memory(const std::string& brand, size_t performance_cores, AppleChipMemory& memory);
+
+}  // namespace MemoryDetection
+
+#endif  // MEMORY_DETECTION_H
@@ -0,0 +1,151 @@
+#include "memory_tiers.h"
+#include "constants.h"
+#include "errors.h"
+#include "numa_utils.h"
+
+#include <algorithm>
+#include <cstdint>
+#include <numeric>
+#include <sstream>
+
+namespace MemoryTiers {
+
+namespace {
+
+size_t parse_weight(const std::string& text, const std::string& item) {
+    if (text.empty() || text.size() > 3 || text.find_first_not_of("0123456789") != std::string::npos ||
+        std::stoul(text) > BenchmarkConstants::NUMA_MAX_INTERLEAVE_WEIGHT) {
+        throw ArgumentError("Invalid --tier-ratios pair '" + item + "'. Expected LOCAL:FAR weights from 0 to " +
+                            std::to_string(BenchmarkConstants::NUMA_MAX_INTERLEAVE_WEIGHT));
+    }
+    return std::stoul(text);
+}
+
+// SLIT distance from one node to another, or the largest value when unknown
+size_t distance_between(const NumaTopology& topology, size_t from_node, size_t to_node) {
+    const NumaNode* from = NumaUtils::find_node(topology, from_node);
+    for (size_t i = 0; from != nullptr && i < topology.nodes.size() && i < from->distances.size(); ++i) {
+        if (topology.nodes[i].id == to_node) {
+            return from->distances[i];
+        }
+    }
+    return SIZE_MAX;
+}
+
+}  // namespace
+
+std::string ratio_to_string(const Ratio& ratio) {
+    return std::to_string(ratio.local_weight) + ":" + std::to_string(ratio.far_weight);
+}
+
+std::string placement_to_string(const Ratio& ratio) {
+    if (ratio.far_weight == 0) return "local";
+    if (ratio.local_weight == 0) return "far";
+    return "interleave";
+}
+
+double far_share(const Ratio& ratio) {
+    size_t total = ratio.local_weight + ratio.far_weight;
+    return total == 0 ? 0.0 : static_cast<double>(ratio.far_weight) / static_cast<double>(total);
+}
+
+std::vector<Ratio> parse_ratios(const std::string& list) {
+    std::vector<Ratio> ratios;
+    std::stringstream stream(list);
+    std::string item;
+    while (std::getline(stream, item, ',')) {
+        size_t colon = item.find(':');
+        if (colon == std::string::npos) {
+            throw ArgumentError("Invalid --tier-ratios pair '" + item + "'. Expected LOCAL:FAR such as 3:1");
+        }
+        Ratio ratio;
+        ratio.local_weight = parse_weight(item.substr(0, colon), item);
+        ratio.far_weight = parse_weight(item.substr(colon + 1), item);
+        size_t divisor = std::gcd(ratio.local_weight, ratio.far_weight);
+        if (divisor == 0) {
+            throw ArgumentError("Invalid --tier-ratios pair '" + item + "': both weights are zero");
+        }
+        ratio.local_weight /= divisor;
+        ratio.far_weight /= divisor;
+
+        auto same = [&ratio](const Ratio& known) {
+            return known.local_weight == ratio.local_weight && known.far_weight == ratio.far_weight;
+        };
+        if (std::find_if(ratios.begin(), ratios.end(), same) == ratios.end()) {
+            ratios.push_back(ratio);
+        }
+    }
+    if (ratios.empty()) {
+        throw ArgumentError("--tier-ratios needs at least one LOCAL:FAR pair");
+    }
+    return ratios;
+}
+
+Tiers select_tiers(const NumaTopology& topology) {
+    const NumaNode* local = nullptr;
+    for (const auto& node : topology.nodes) {
+        if (!node.cpus.empty() && node.memory_bytes > 0) {
+            local = &node;
+            break;
+        }
+    }
+    if (local == nullptr) {
+        throw PlatformError("No NUMA node has both CPUs and memory to act as the local tier");
+    }
+
+    Tiers tiers;
+    tiers.local_node = local->id;
+    for (const auto& node : topology.nodes) {
+        if (NumaUtils::is_memory_only(node)) {
+            tiers.far_nodes.push_back(node.id);
+        }
+    }
+    tiers.memory_only = !tiers.far_nodes.empty();
+    if (!tiers.memory_only) {
+        // No CXL: the far tier is a remote socket's memory
+        for (const auto& node : topology.nodes) {
+            if (node.id != local->id && node.memory_bytes > 0) {
+                tiers.far_nodes.push_back(node.id);
+            }
+        }
+    }
+    if (tiers.far_nodes.empty()) {
+        throw PlatformError("Memory tiers need a second NUMA node with memory; only node " +
+                            std::to_string(local->id) + " has any");
+    }
+
+    std::stable_sort(tiers.far_nodes.begin(), tiers.far_nodes.end(), [&](size_t a, size_t b) {
+        return distance_between(topology, local->id, a) < distance_between(topology, local->id, b);
+    });
+    return tiers;
+}
+
+std::vector<NumaWeight> weights_for(const Ratio& ratio, size_t local_node, size_t far_node) {
+    std::vector<NumaWeight> weights;
+    if (ratio.local_weight > 0) {
+        weights.push_back({local_node, ratio.local_weight});
+    }
+    if (ratio.far_weight > 0) {
+        weights.push_back({far_node, ratio.far_weight});
+    }
+    return weights;
+}
+
+std::vector<size_t> best_points(const std::vector<Point>& points) {
+    std::vector<size_t> best;
+    for (size_t i = 0; i < points.size(); ++i) {
+        if (!points[i].stats.verified) {
+            continue;
+        }
+        auto current = std::find_if(best.begin(), best.end(),
+                                    [&](size_t index) { return points[index].far_node == points[i].far_node; });
+        if (current == best.end()) {
+            best.push_back(i);
+        } else if (points[i].stats.bandwidth_gbps > points[*current].stats.bandwidth_gbps) {
+            *current = i;
+        }
+    }
+    return best;
+}
+
+}  // namespace MemoryTiers
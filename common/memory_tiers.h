@@ -0,0 +1,98 @@
+#ifndef MEMORY_TIERS_H
+#define MEMORY_TIERS_H
+
+#include <cstddef>
+#include <string>
+#include <vector>
+
+#include "memory_types.h"
+#include "test_patterns.h"
+
+/**
+ * @brief Bandwidth of local memory, far memory and weighted mixes of both
+ *
+ * CXL Type-3 expanders show up as NUMA nodes with memory and no CPUs.
+ * Their bandwidth adds to local DRAM only when traffic is spread over
+ * both, and the best split depends on the relative bandwidth of the two
+ * tiers, not on capacity. A tier run binds its threads to the local node
+ * and places the buffers at each LOCAL:FAR page ratio in turn: 1:0 is
+ * local only, 0:1 far only, anything else a weighted interleave. The ratio
+ * with the highest bandwidth is the weight to give the far tier.
+ */
+namespace MemoryTiers {
+
+/**
+ * @brief Pages placed on the local and far node per interleave round
+ */
+struct Ratio {
+    size_t local_weight = 1;
+    size_t far_weight = 0;
+};
+
+/**
+ * @brief Ratio as reported in results ("3:1")
+ */
+std::string ratio_to_string(const Ratio& ratio);
+
+/**
+ * @brief Placement a ratio stands for ("local", "far" or "interleave")
+ */
+std::string placement_to_string(const Ratio& ratio);
+
+/**
+ * @brief Share of the pages a ratio places on the far node (0 to 1)
+ */
+double far_share(const Ratio& ratio);
+
+/**
+ * @brief Parse --tier-ratios: comma-separated LOCAL:FAR weights ("1:0,3:1,1:1,0:1")
+ *
+ * Weights run from 0 to NUMA_MAX_INTERLEAVE_WEIGHT and at least one of a
+ * pair is positive. Ratios are reduced ("2:2" is "1:1") and duplicates
+ * dropped, keeping the first.
+ *
+ * @throws ArgumentError on a malformed or out-of-range pair, or an empty list
+ */
+std::vector<Ratio> parse_ratios(const std::string& list);
+
+/**
+ * @brief Node pair a tier run measures
+ */
+struct Tiers {
+    size_t local_node = 0;            ///< Lowest-numbered node with CPUs and memory; test threads run here
+    std::vector<size_t> far_nodes;    ///< Memory-only nodes, or else every other node with memory, nearest first
+    bool memory_only = false;         ///< Whether far_nodes are memory-only (CXL) rather than remote sockets
+};
+
+/**
+ * @brief Pick the local node and the far nodes of a topology
+ * @throws PlatformError if no node has both CPUs and memory, or no second node has memory
+ */
+Tiers select_tiers(const NumaTopology& topology);
+
+/**
+ * @brief Interleave weights of a ratio over a local and a far node (zero weights omitted)
+ */
+std::vector<NumaWeight> weights_for(const Ratio& ratio, size_t local_node, size_t far_node);
+
+/**
+ * @brief One ratio over one local/far node pair
+ */
+struct Point {
+    size_t local_node = 0;
+    size_t far_node = 0;
+    Ratio ratio;
+    std::string policy;              ///< Kernel policy that placed the pages (NumaUtils::interleave_memory)
+    double far_page_share = -1.0;    ///< Measured share of resident pages on far_node (negative: unknown)
+    size_t num_threads = 0;
+    PerformanceStats stats = {};
+};
+
+/**
+ * @brief Index of the highest-bandwidth verified point of each far node, in first-seen order
+ */
+std::vector<size_t> best_points(const std::vector<Point>& points);
+
+}  // namespace MemoryTiers
+
+#endif  // MEMORY_TIERS_H
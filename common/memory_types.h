@@ -10,6 +10,9 @@
  *
  * Contains detailed information about the CPU cache hierarchy
  * including sizes, associativity, and line sizes for all cache levels.
+ * Sizes are those of one instance; the sharing lists say which CPUs share
+ * each instance (one L3 per CCX on Zen, one L2 per cluster on Apple
+ * Silicon and many Arm parts).
  */
 struct CacheInfo {
     size_t l1_data_size;         ///< L1 data cache size in bytes (per core)
@@ -23,6 +26,9 @@ struct CacheInfo {
     size_t l1_line_size;         ///< L1 cache line size in bytes
     size_t l2_line_size;         ///< L2 cache line size in bytes
     size_t l3_line_size;         ///< L3 cache line size in bytes
+    std::vector<std::vector<size_t>> l1d_sharing = {};  ///< CPUs of each L1 data cache instance (empty: unknown)
+    std::vector<std::vector<size_t>> l2_sharing = {};   ///< CPUs of each L2 instance (empty: unknown)
+    std::vector<std::vector<size_t>> l3_sharing = {};   ///< CPUs of each L3/SLC instance (empty: unknown)
 };
 
 /**
@@ -45,6 +51,10 @@ struct MemorySpecs {
     bool num_channels_detected;         ///< Whether number of channels was detected from system
     bool is_unified_memory;             ///< Whether using unified memory architecture (Apple Silicon)
     std::string architecture;           ///< Memory architecture description
+    bool speed_detected = false;        ///< Whether the speed was detected rather than assumed
+    std::string detection_source;       ///< Where type, speed and channels came from ("SMBIOS", "EDAC", ""= defaults)
+    double calibrated_bandwidth_gbps = 0.0;  ///< Measured practical peak of this host in GB/s (0: not calibrated)
+    std::string calibrated_on;          ///< UTC time the calibrated peak was measured
 };
 
 /**
@@ -64,13 +74,92 @@ struct SystemInfo {
     CacheInfo cache_info;      ///< Cache information
 };
 
+/**
+ * @brief HMAT performance of a memory node as seen from its nearest initiators
+ *
+ * Read from /sys/devices/system/node/nodeN/access0/initiators; all zero
+ * when the firmware publishes no HMAT, which is common outside CXL systems.
+ */
+struct NumaAccess {
+    size_t read_bandwidth_mbps = 0;   ///< MB/s
+    size_t write_bandwidth_mbps = 0;  ///< MB/s
+    size_t read_latency_ns = 0;
+    size_t write_latency_ns = 0;
+};
+
+/**
+ * @brief NUMA node information structure
+ *
+ * Describes one node from /sys/devices/system/node. Memory-only nodes
+ * (e.g. CXL expanders) have no CPUs; CPU-only nodes have no memory.
+ */
+struct NumaNode {
+    size_t id;                     ///< Kernel node number
+    std::vector<size_t> cpus;      ///< Logical CPUs attached to this node
+    size_t memory_bytes;           ///< Total memory attached to this node in bytes
+    std::vector<size_t> distances; ///< SLIT distances to every node, indexed like NumaTopology::nodes
+    NumaAccess access;             ///< HMAT attributes (zero if not published)
+};
+
+/**
+ * @brief Share of an interleaved allocation placed on one node
+ */
+struct NumaWeight {
+    size_t node_id;  ///< Kernel node number
+    size_t weight;   ///< Pages placed on the node per interleave round (1..NUMA_MAX_INTERLEAVE_WEIGHT)
+};
+
+/**
+ * @brief NUMA topology structure
+ *
+ * Systems without NUMA support report a single node holding every CPU.
+ */
+struct NumaTopology {
+    std::vector<NumaNode> nodes;  ///< Online nodes in ascending id order
+    bool binding_supported;       ///< Whether threads and memory can be bound to nodes
+};
+
 /**
  * @brief CPU affinity types for heterogeneous architectures
  */
 enum class CPUAffinityType {
     DEFAULT,    ///< No specific affinity
-    P_CORES,    ///< Performance cores only (Apple Silicon)
-    E_CORES     ///< Efficiency cores only (Apple Silicon)
+    P_CORES,    ///< Performance cores only (Apple Silicon, Intel hybrid, Arm big.LITTLE)
+    E_CORES     ///< Efficiency cores only (Apple Silicon, Intel hybrid, Arm big.LITTLE)
+};
+
+/**
+ * @brief Position of one logical CPU in the package / die / cluster / core / SMT hierarchy
+ *
+ * Indices are dense (0 to count-1) across the whole system, so two CPUs
+ * with the same core share a physical core even on different packages'
+ * identical sysfs core_id values.
+ */
+struct CpuLocation {
+    size_t cpu;      ///< Logical CPU number
+    size_t package;  ///< Physical package (socket)
+    size_t die;      ///< Die, unique across packages
+    size_t cluster;  ///< Last-level cache domain (CCX on AMD, cluster on Arm), unique across packages
+    size_t core;     ///< Physical core, unique across packages
+    size_t smt;      ///< Hardware thread within the core (0: first sibling)
+    size_t node;     ///< NUMA node
+    CPUAffinityType core_type;  ///< P_CORES or E_CORES on heterogeneous parts, DEFAULT when all cores are alike
+};
+
+/**
+ * @brief CPU topology structure
+ *
+ * Systems that expose no topology report every logical CPU as its own
+ * core on one package, with detected false.
+ */
+struct CpuTopology {
+    std::vector<CpuLocation> cpus;  ///< Online CPUs in ascending cpu order
+    size_t packages;                ///< Physical packages
+    size_t dies;                    ///< Dies over all packages
+    size_t clusters;                ///< Last-level cache domains over all packages
+    size_t physical_cores;          ///< Physical cores over all packages
+    bool hybrid;                    ///< Whether both performance and efficiency cores were found
+    bool detected;                  ///< Whether the hierarchy was read from the OS
 };
 
 /**
@@ -0,0 +1,272 @@
+#include "ndjson_sink.h"
+#include "constants.h"
+#include "errors.h"
+#include "json.h"
+#include "output_formatter.h"
+
+#include <algorithm>
+#include <chrono>
+#include <cstdio>
+#include <ctime>
+
+#include <sys/utsname.h>
+#include <unistd.h>
+
+namespace Ndjson {
+
+namespace {
+
+using Json::Object;
+using Json::quote;
+
+size_t get_count(const Json::Value& value, const std::string& key) {
+    return static_cast<size_t>(std::max(0.0, value.get_number(key)));
+}
+
+std::string distribution(const DistributionStats& dist) {
+    if (dist.count == 0) {
+        return "null";
+    }
+    return Object()
+        .add_count("count", dist.count)
+        .add_number("min", dist.min)
+        .add_number("median", dist.median)
+        .add_number("p95", dist.p95)
+        .add_number("p99", dist.p99)
+        .add_number("max", dist.max)
+        .add_number("mean", dist.mean)
+        .add_number("cv", dist.cv)
+        .str();
+}
+
+std::string per_thread(const std::vector<ThreadStats>& threads) {
+    std::string json = "[";
+    for (size_t i = 0; i < threads.size(); ++i) {
+        json += (i > 0 ? "," : "") + Object()
+                                         .add_count("thread_id", threads[i].thread_id)
+                                         .add_number("bandwidth_gbps", threads[i].stats.bandwidth_gbps)
+                                         .add_number("latency_ns", threads[i].stats.latency_ns)
+                                         .add_count("bytes_processed", threads[i].stats.bytes_processed)
+                                         .add_raw("bandwidth_distribution", distribution(threads[i].bandwidth))
+                                         .add_raw("latency_distribution", distribution(threads[i].latency))
+                                         .str();
+    }
+    return json + "]";
+}
+
+std::string gemm(const GemmStats& stats) {
+    if (stats.matrix_size == 0) {
+        return "null";
+    }
+    return Object()
+        .add_string("precision", stats.precision)
+        .add_string("accumulate", stats.accumulate)
+        .add_count("matrix_size", stats.matrix_size)
+        .add_number("gops", stats.gops)
+        .add_number("arithmetic_intensity", stats.arithmetic_intensity)
+        .str();
+}
+
+std::string calibration(const CalibrationStats& stats) {
+    if (stats.repetitions == 0) {
+        return "null";
+    }
+    return Object()
+        .add_count("iterations", stats.iterations)
+        .add_count("repetitions", stats.repetitions)
+        .add_number("ci_percent", stats.ci_percent)
+        .add_bool("converged", stats.converged)
+        .str();
+}
+
+std::string counters(const PerfCounters::CounterValues& values) {
+    if (values.empty()) {
+        return "null";
+    }
+    Object object;
+    for (size_t i = 0; i < PerfCounters::COUNTER_COUNT; ++i) {
+        auto counter = static_cast<PerfCounters::Counter>(i);
+        if (values.has(counter)) {
+            object.add_count(PerfCounters::counter_name(counter), values.get(counter));
+        }
+    }
+    return object.str();
+}
+
+std::string page_faults(const PageFaultStats& stats) {
+    if (!stats.measured) {
+        return "null";
+    }
+    return Object()
+        .add_count("minor_faults", stats.minor_faults)
+        .add_count("major_faults", stats.major_faults)
+        .add_number("faults_per_second", stats.faults_per_second)
+        .str();
+}
+
+std::string access(const AccessStats& stats) {
+    if (!stats.measured) {
+        return "null";
+    }
+    return Object()
+        .add_count("element_bytes", stats.element_bytes)
+        .add_string("layout", stats.layout)
+        .add_number("useful_gbps", stats.useful_gbps)
+        .add_number("line_gbps", stats.line_gbps)
+        .add_number("line_use", stats.line_use)
+        .str();
+}
+
+std::string warnings(const std::vector<std::string>& messages) {
+    std::string json = "[";
+    for (size_t i = 0; i < messages.size(); ++i) {
+        json += (i > 0 ? "," : "") + quote(messages[i]);
+    }
+    return json + "]";
+}
+
+}  // namespace
+
+HostFingerprint host_fingerprint(const SystemInfo& sys_info) {
+    HostFingerprint host;
+    char hostname[256] = {};
+    if (gethostname(hostname, sizeof(hostname) - 1) == 0) {
+        host.hostname = hostname;
+    }
+    struct utsname name = {};
+    if (uname(&name) == 0) {
+        host.os = name.sysname;
+        host.os_release = name.release;
+        host.arch = name.machine;
+    }
+    host.cpu_name = sys_info.cpu_name;
+    host.cpu_cores = sys_info.cpu_cores;
+    host.cpu_threads = sys_info.cpu_threads;
+    host.total_ram_gb = sys_info.total_ram_gb;
+    host.memory_type = sys_info.memory_specs.type;
+    host.memory_speed_mtps = sys_info.memory_specs.speed_mtps;
+    host.memory_channels = sys_info.memory_specs.num_channels;
+    host.theoretical_bandwidth_gbps = sys_info.memory_specs.theoretical_bandwidth_gbps;
+    host.l1_data_bytes = sys_info.cache_info.l1_data_size;
+    host.l2_bytes = sys_info.cache_info.l2_size;
+    host.l3_bytes = sys_info.cache_info.l3_size;
+    host.cache_line_bytes = sys_info.cache_line_size;
+    return host;
+}
+
+std::string host_to_json(const HostFingerprint& host) {
+    return Object()
+        .add_string("hostname", host.hostname)
+        .add_string("os", host.os)
+        .add_string("os_release", host.os_release)
+        .add_string("arch", host.arch)
+        .add_string("cpu_name", host.cpu_name)
+        .add_count("cpu_cores", host.cpu_cores)
+        .add_count("cpu_threads", host.cpu_threads)
+        .add_count("total_ram_gb", host.total_ram_gb)
+        .add_string("memory_type", host.memory_type)
+        .add_count("memory_speed_mtps", host.memory_speed_mtps)
+        .add_count("memory_channels", host.memory_channels)
+        .add_number("theoretical_bandwidth_gbps", host.theoretical_bandwidth_gbps)
+        .add_count("l1_data_bytes", host.l1_data_bytes)
+        .add_count("l2_bytes", host.l2_bytes)
+        .add_count("l3_bytes", host.l3_bytes)
+        .add_count("cache_line_bytes", host.cache_line_bytes)
+        .str();
+}
+
+HostFingerprint host_from_json(const Json::Value& value) {
+    HostFingerprint host;
+    host.hostname = value.get_string("hostname");
+    host.os = value.get_string("os");
+    host.os_release = value.get_string("os_release");
+    host.arch = value.get_string("arch");
+    host.cpu_name = value.get_string("cpu_name");
+    host.cpu_cores = get_count(value, "cpu_cores");
+    host.cpu_threads = get_count(value, "cpu_threads");
+    host.total_ram_gb = get_count(value, "total_ram_gb");
+    host.memory_type = value.get_string("memory_type");
+    host.memory_speed_mtps = get_count(value, "memory_speed_mtps");
+    host.memory_channels = get_count(value, "memory_channels");
+    host.theoretical_bandwidth_gbps = value.get_number("theoretical_bandwidth_gbps");
+    host.l1_data_bytes = get_count(value, "l1_data_bytes");
+    host.l2_bytes = get_count(value, "l2_bytes");
+    host.l3_bytes = get_count(value, "l3_bytes");
+    host.cache_line_bytes = get_count(value, "cache_line_bytes");
+    return host;
+}
+
+std::string utc_timestamp() {
+    auto now = std::chrono::system_clock::now();
+    std::time_t seconds = std::chrono::system_clock::to_time_t(now);
+    auto millis = std::chrono::duration_cast<std::chrono::milliseconds>(now.time_since_epoch()).count() % 1000;
+    std::tm utc = {};
+    gmtime_r(&seconds, &utc);
+    char text[64];
+    std::snprintf(text, sizeof(text), "%04d-%02d-%02dT%02d:%02d:%02d.%03dZ", utc.tm_year + 1900, utc.tm_mon + 1,
+                  utc.tm_mday, utc.tm_hour, utc.tm_min, utc.tm_sec, static_cast<int>(millis));
+    return text;
+}
+
+std::string format_result(const HostFingerprint& host, const std::string& run_id, uint64_t sequence,
+                          const std::string& timestamp, const TestResult& result, const RecordContext& context) {
+    return Object()
+        .add_count("schema_version", BenchmarkConstants::NDJSON_SCHEMA_VERSION)
+        .add_string("record", "result")
+        .add_string("run_id", run_id)
+        .add_count("sequence", sequence)
+        .add_string("timestamp", timestamp)
+        .add_raw("host", host_to_json(host))
+        .add_string("mode", context.mode)
+        .add_string("test_name", result.test_name)
+        .add_string("pattern", result.pattern_name)
+        .add_string("working_set", result.working_set_desc)
+        .add_string("kernel", result.kernel_name)
+        .add_string("store_policy", result.store_policy)
+        .add_count("threads", result.num_threads)
+        .add_string("placement", context.placement)
+        .add_string("pages", context.pages)
+        .add_number("bandwidth_gbps", result.stats.bandwidth_gbps)
+        .add_number("latency_ns", result.stats.latency_ns)
+        .add_count("bytes_processed", result.stats.bytes_processed)
+        .add_number("time_seconds", result.stats.time_seconds)
+        .add_bool("verified", result.stats.verified)
+        .add_raw("bandwidth_distribution", distribution(result.bandwidth_distribution))
+        .add_raw("latency_distribution", distribution(result.latency_distribution))
+        .add_raw("per_thread", per_thread(result.thread_stats))
+        .add_raw("gemm", gemm(result.gemm))
+        .add_raw("calibration", calibration(result.calibration))
+        .add_raw("counters", counters(result.counters))
+        .add_raw("page_faults", page_faults(result.page_faults))
+        .add_raw("access", access(result.access))
+        .add_raw("warnings", warnings(result.warnings))
+        .str();
+}
+
+void Sink::open(const std::string& path, const HostFingerprint& host) {
+    out_.open(path, std::ios::out | std::ios::app);
+    if (!out_) {
+        throw ConfigurationError("Cannot open --ndjson file " + path + " for appending");
+    }
+    path_ = path;
+    host_ = host;
+    run_id_ = host.hostname + "-" + std::to_string(getpid()) + "-" +
+              std::to_string(std::chrono::duration_cast<std::chrono::seconds>(
+                                 std::chrono::system_clock::now().time_since_epoch())
+                                 .count());
+    sequence_ = 0;
+}
+
+void Sink::write(const TestResult& result, const RecordContext& context) {
+    if (!out_.is_open()) {
+        return;
+    }
+    out_ << format_result(host_, run_id_, sequence_, utc_timestamp(), result, context) << '\n';
+    out_.flush();  // Reaches the kernel before the next measurement, so a killed job keeps it
+    if (!out_) {
+        throw BenchmarkError("Failed to write NDJSON record " + std::to_string(sequence_) + " to " + path_);
+    }
+    ++sequence_;
+}
+
+}  // namespace Ndjson
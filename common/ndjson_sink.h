@@ -0,0 +1,124 @@
+#ifndef NDJSON_SINK_H
+#define NDJSON_SINK_H
+
+#include <cstddef>
+#include <cstdint>
+#include <fstream>
+#include <string>
+
+#include "memory_types.h"
+
+struct TestResult;
+
+namespace Json {
+struct Value;
+}
+
+/**
+ * @brief Streaming result records for fleet collection (--ndjson FILE)
+ *
+ * The report formats are built once every pattern and size has finished,
+ * so a job killed half way leaves nothing behind. The sink instead appends
+ * one self-contained JSON object per measurement to a file as soon as the
+ * measurement completes, and flushes it to the kernel before the next one
+ * starts. Every record carries the schema version, the host fingerprint,
+ * the kernel, placement and page backing that produced it and the full
+ * statistics of the result. Every key is always present: sections that do
+ * not apply to a result are null, so collectors can ingest records without
+ * knowing which options the run used.
+ */
+namespace Ndjson {
+
+/**
+ * @brief Identity of the machine a record was measured on
+ */
+struct HostFingerprint {
+    std::string hostname;
+    std::string os;              ///< uname sysname ("Linux", "Darwin")
+    std::string os_release;      ///< uname release (kernel version)
+    std::string arch;            ///< uname machine ("x86_64", "aarch64", "arm64")
+    std::string cpu_name;
+    size_t cpu_cores = 0;
+    size_t cpu_threads = 0;
+    size_t total_ram_gb = 0;
+    std::string memory_type;
+    size_t memory_speed_mtps = 0;
+    size_t memory_channels = 0;
+    double theoretical_bandwidth_gbps = 0.0;
+    size_t l1_data_bytes = 0;
+    size_t l2_bytes = 0;
+    size_t l3_bytes = 0;
+    size_t cache_line_bytes = 0;
+};
+
+/**
+ * @brief How a result was produced, beyond what TestResult records
+ */
+struct RecordContext {
+    std::string mode;       ///< "large_memory" or "cache_hierarchy"
+    std::string placement;  ///< Thread placement policy ("default", "compact", ...)
+    std::string pages;      ///< Requested and obtained page backing of the buffers
+};
+
+/**
+ * @brief Fingerprint of this host: uname and hostname, plus the detected system information
+ */
+HostFingerprint host_fingerprint(const SystemInfo& sys_info);
+
+/**
+ * @brief Fingerprint as a single-line JSON object, as in the records
+ */
+std::string host_to_json(const HostFingerprint& host);
+
+/**
+ * @brief Fingerprint read back from its JSON object; absent fields stay empty or 0
+ */
+HostFingerprint host_from_json(const Json::Value& value);
+
+/**
+ * @brief Current UTC time as RFC 3339 with milliseconds ("2026-01-31T12:00:00.250Z")
+ */
+std::string utc_timestamp();
+
+/**
+ * @brief One record as a single line of JSON, without the trailing newline
+ *
+ * @param run_id Identifies the run the record belongs to
+ * @param sequence Position of the record in its run, from 0, so collectors can spot missing records
+ */
+std::string format_result(const HostFingerprint& host, const std::string& run_id, uint64_t sequence,
+                          const std::string& timestamp, const TestResult& result, const RecordContext& context);
+
+/**
+ * @brief Appends records to a file, one line each, flushed per record
+ */
+class Sink {
+  public:
+    /**
+     * @brief Open path for appending; records of earlier runs are kept
+     * @throws ConfigurationError if the file cannot be opened
+     */
+    void open(const std::string& path, const HostFingerprint& host);
+
+    bool is_open() const { return out_.is_open(); }
+
+    /**
+     * @brief Write and flush one record
+     * @throws BenchmarkError if the record cannot be written (disk full, file removed)
+     */
+    void write(const TestResult& result, const RecordContext& context);
+
+    uint64_t records_written() const { return sequence_; }
+    const std::string& run_id() const { return run_id_; }
+
+  private:
+    std::ofstream out_;
+    std::string path_;
+    HostFingerprint host_;
+    std::string run_id_;  ///< hostname-pid-start time, unique per run on a host
+    uint64_t sequence_ = 0;
+};
+
+}  // namespace Ndjson
+
+#endif  // NDJSON_SINK_H
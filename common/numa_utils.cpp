@@ -0,0 +1,444 @@
+#include "numa_utils.h"
+#include "constants.h"
+#include "safe_file_utils.h"
+#include <algorithm>
+#include <cstdint>
+#include <sstream>
+#include <thread>
+
+#ifdef __linux__
+#include <fcntl.h>
+#include <linux/mempolicy.h>
+#include <pthread.h>
+#include <sched.h>
+#include <sys/syscall.h>
+#include <unistd.h>
+
+#ifndef MPOL_WEIGHTED_INTERLEAVE
+#define MPOL_WEIGHTED_INTERLEAVE 6  // Linux 6.9; older uapi headers lack it
+#endif
+#endif
+
+namespace NumaUtils {
+
+namespace {
+
+const std::string NODE_SYSFS_ROOT = "/sys/devices/system/node/";
+
+bool parse_size(const std::string& text, size_t& value) {
+    if (text.empty() || text.find_first_not_of("0123456789") != std::string::npos) {
+        return false;
+    }
+    try {
+        value = static_cast<size_t>(std::stoull(text));
+    } catch (const std::exception&) {
+        return false;
+    }
+    return true;
+}
+
+NumaTopology single_node_topology() {
+    NumaTopology topology;
+    topology.binding_supported = false;
+
+    NumaNode node;
+    node.id = 0;
+    size_t cpu_count = std::max(1u, std::thread::hardware_concurrency());
+    for (size_t cpu = 0; cpu < cpu_count; ++cpu) {
+        node.cpus.push_back(cpu);
+    }
+    node.memory_bytes = 0;
+    node.distances = {10};
+    topology.nodes.push_back(node);
+    return topology;
+}
+
+// Raw reads and writes: tests point read_access at a temporary tree, and the
+// interleave weights live under /sys/kernel, both outside the SafeFileUtils roots
+bool read_attribute(const std::string& path, std::string& value) {
+#ifdef __linux__
+    int fd = open(path.c_str(), O_RDONLY);
+    if (fd < 0) {
+        return false;
+    }
+    char buffer[64] = {};
+    ssize_t length = read(fd, buffer, sizeof(buffer) - 1);
+    close(fd);
+    if (length <= 0) {
+        return false;
+    }
+    value.assign(buffer, static_cast<size_t>(length));
+    value.erase(value.find_last_not_of(" \t\r\n") + 1);
+    return !value.empty();
+#else
+    (void)path;
+    (void)value;
+    return false;
+#endif
+}
+
+#ifdef __linux__
+const std::string WEIGHTED_INTERLEAVE_SYSFS = "/sys/kernel/mm/mempolicy/weighted_interleave/";
+
+constexpr size_t BITS_PER_MASK_WORD = sizeof(unsigned long) * 8;
+constexpr size_t MAX_NODES = 1024;
+
+bool write_attribute(const std::string& path, const std::string& value) {
+    int fd = open(path.c_str(), O_WRONLY);
+    if (fd < 0) {
+        return false;
+    }
+    ssize_t written = write(fd, value.data(), value.size());
+    close(fd);
+    return written == static_cast<ssize_t>(value.size());
+}
+
+// mbind needs a page-aligned start; only rebind whole pages inside the range
+bool whole_pages(void* addr, size_t length, uintptr_t& start, uintptr_t& end) {
+    if (addr == nullptr || length == 0) {
+        return false;
+    }
+    size_t page_size = static_cast<size_t>(sysconf(_SC_PAGESIZE));
+    uintptr_t first = reinterpret_cast<uintptr_t>(addr);
+    start = (first + page_size - 1) & ~(page_size - 1);
+    end = (first + length) & ~(page_size - 1);
+    return end > start;
+}
+
+bool mbind_nodes(uintptr_t start, uintptr_t end, int mode, const std::vector<size_t>& node_ids) {
+    unsigned long nodemask[MAX_NODES / BITS_PER_MASK_WORD] = {};
+    for (size_t node_id : node_ids) {
+        if (node_id >= MAX_NODES) {
+            return false;
+        }
+        nodemask[node_id / BITS_PER_MASK_WORD] |= 1UL << (node_id % BITS_PER_MASK_WORD);
+    }
+    long rc = syscall(SYS_mbind, reinterpret_cast<void*>(start), end - start, mode, nodemask, MAX_NODES,
+                      MPOL_MF_MOVE | MPOL_MF_STRICT);
+    return rc == 0;
+}
+
+// Fault every page in under the range's policy without changing its contents
+void fault_in(uintptr_t start, uintptr_t end) {
+    size_t page_size = static_cast<size_t>(sysconf(_SC_PAGESIZE));
+    for (uintptr_t page = start; page < end; page += page_size) {
+        volatile uint8_t* byte = reinterpret_cast<volatile uint8_t*>(page);
+        *byte = *byte;
+    }
+}
+
+// Weights are global: set ours, place the range, then put the previous ones back
+bool weighted_interleave(uintptr_t start, uintptr_t end, const std::vector<NumaWeight>& weights) {
+    std::vector<std::pair<std::string, std::string>> previous;
+    std::string automatic;
+    bool restore_automatic = read_attribute(WEIGHTED_INTERLEAVE_SYSFS + "auto", automatic) && automatic == "true";
+
+    bool applied = true;
+    std::vector<size_t> node_ids;
+    for (const auto& weight : weights) {
+        std::string path = WEIGHTED_INTERLEAVE_SYSFS + "node" + std::to_string(weight.node_id);
+        std::string value;
+        if (!read_attribute(path, value) || !write_attribute(path, std::to_string(weight.weight))) {
+            applied = false;
+            break;
+        }
+        previous.emplace_back(path, value);
+        node_ids.push_back(weight.node_id);
+    }
+    if (applied && mbind_nodes(start, end, MPOL_WEIGHTED_INTERLEAVE, node_ids)) {
+        fault_in(start, end);
+    } else {
+        applied = false;
+    }
+
+    for (const auto& entry : previous) {
+        write_attribute(entry.first, entry.second);
+    }
+    if (restore_automatic) {
+        write_attribute(WEIGHTED_INTERLEAVE_SYSFS + "auto", "true");  // Writing a weight turned it off
+    }
+    return applied;
+}
+
+// Consecutive ranges bound in weighted round-robin order: weight pages of the first node, then the next
+bool range_interleave(uintptr_t start, uintptr_t end, const std::vector<NumaWeight>& weights) {
+    const uintptr_t range = BenchmarkConstants::TIER_RANGE_BYTES;
+    uintptr_t position = start;
+    while (position < end) {
+        for (const auto& weight : weights) {
+            for (size_t i = 0; i < weight.weight && position < end; ++i) {
+                uintptr_t next = std::min(end, position + range);
+                if (!mbind_nodes(position, next, MPOL_BIND, {weight.node_id})) {
+                    return false;
+                }
+                position = next;
+            }
+        }
+    }
+    return true;
+}
+
+// "Node 0 MemTotal:        4816632 kB"
+size_t read_node_memory_bytes(size_t node_id) {
+    std::vector<std::string> lines;
+    std::string path = NODE_SYSFS_ROOT + "node" + std::to_string(node_id) + "/meminfo";
+    if (!SafeFileUtils::read_all_lines(path, lines)) {
+        return 0;
+    }
+    for (const auto& line : lines) {
+        size_t key_pos = line.find("MemTotal:");
+        if (key_pos == std::string::npos) {
+            continue;
+        }
+        std::istringstream iss(line.substr(key_pos + 9));
+        size_t kb = 0;
+        if (iss >> kb) {
+            return kb * 1024;
+        }
+    }
+    return 0;
+}
+
+std::vector<size_t> read_node_distances(size_t node_id) {
+    std::vector<size_t> distances;
+    std::string line;
+    std::string path = NODE_SYSFS_ROOT + "node" + std::to_string(node_id) + "/distance";
+    if (!SafeFileUtils::read_single_line(path, line)) {
+        return distances;
+    }
+    std::istringstream iss(line);
+    size_t distance = 0;
+    while (iss >> distance) {
+        distances.push_back(distance);
+    }
+    return distances;
+}
+#endif
+
+}  // namespace
+
+std::vector<size_t> parse_id_list(const std::string& list) {
+    std::vector<size_t> ids;
+    std::stringstream ss(list);
+    std::string range;
+
+    while (std::getline(ss, range, ',')) {
+        // Tolerate the trailing newline/whitespace sysfs files carry
+        range.erase(0, range.find_first_not_of(" \t\r\n"));
+        range.erase(range.find_last_not_of(" \t\r\n") + 1);
+        if (range.empty()) {
+            continue;
+        }
+
+        size_t dash = range.find('-');
+        size_t first = 0;
+        size_t last = 0;
+        if (dash == std::string::npos) {
+            if (!parse_size(range, first)) {
+                return {};
+            }
+            last = first;
+        } else if (!parse_size(range.substr(0, dash), first) ||
+                   !parse_size(range.substr(dash + 1), last) || last < first) {
+            return {};
+        }
+
+        for (size_t id = first; id <= last; ++id) {
+            ids.push_back(id);
+        }
+    }
+    return ids;
+}
+
+NumaTopology detect_topology() {
+#ifdef __linux__
+    std::string online;
+    if (!SafeFileUtils::read_single_line(NODE_SYSFS_ROOT + "online", online)) {
+        return single_node_topology();
+    }
+
+    std::vector<size_t> node_ids = parse_id_list(online);
+    if (node_ids.empty()) {
+        return single_node_topology();
+    }
+
+    NumaTopology topology;
+    topology.binding_supported = true;
+    for (size_t node_id : node_ids) {
+        NumaNode node;
+        node.id = node_id;
+
+        std::string cpulist;
+        if (SafeFileUtils::read_single_line(NODE_SYSFS_ROOT + "node" + std::to_string(node_id) + "/cpulist",
+                                            cpulist)) {
+            node.cpus = parse_id_list(cpulist);
+        }
+        node.memory_bytes = read_node_memory_bytes(node_id);
+        node.distances = read_node_distances(node_id);
+        node.access = read_access(NODE_SYSFS_ROOT + "node" + std::to_string(node_id));
+        topology.nodes.push_back(node);
+    }
+    return topology;
+#else
+    return single_node_topology();
+#endif
+}
+
+const NumaNode* find_node(const NumaTopology& topology, size_t node_id) {
+    for (const auto& node : topology.nodes) {
+        if (node.id == node_id) {
+            return &node;
+        }
+    }
+    return nullptr;
+}
+
+const NumaTopology& get_topology() {
+    static const NumaTopology topology = detect_topology();
+    return topology;
+}
+
+bool bind_thread_to_node(size_t thread_id, size_t node_id) {
+#ifdef __linux__
+    const NumaNode* node = find_node(get_topology(), node_id);
+    if (node == nullptr || node->cpus.empty()) {
+        return false;
+    }
+
+    size_t cpu = node->cpus[thread_id % node->cpus.size()];
+    if (cpu >= CPU_SETSIZE) {
+        return false;
+    }
+
+    cpu_set_t cpuset;
+    CPU_ZERO(&cpuset);
+    CPU_SET(cpu, &cpuset);
+    return pthread_setaffinity_np(pthread_self(), sizeof(cpu_set_t), &cpuset) == 0;
+#else
+    (void)thread_id;
+    (void)node_id;
+    return false;
+#endif
+}
+
+bool bind_memory_to_node(void* addr, size_t length, size_t node_id) {
+#ifdef __linux__
+    uintptr_t start = 0;
+    uintptr_t end = 0;
+    return whole_pages(addr, length, start, end) && mbind_nodes(start, end, MPOL_BIND, {node_id});
+#else
+    (void)addr;
+    (void)length;
+    (void)node_id;
+    return false;
+#endif
+}
+
+bool interleave_memory(void* addr, size_t length, const std::vector<NumaWeight>& weights, std::string& policy) {
+    std::vector<NumaWeight> placed;
+    for (const auto& weight : weights) {
+        bool repeated = std::any_of(weights.begin(), weights.end(), [&weight](const NumaWeight& other) {
+            return &other != &weight && other.node_id == weight.node_id;
+        });
+        if (weight.weight > BenchmarkConstants::NUMA_MAX_INTERLEAVE_WEIGHT || repeated) {
+            return false;
+        }
+        if (weight.weight > 0) {
+            placed.push_back(weight);
+        }
+    }
+    if (placed.empty()) {
+        return false;
+    }
+    if (placed.size() == 1) {
+        policy = "bind";
+        return bind_memory_to_node(addr, length, placed[0].node_id);
+    }
+
+#ifdef __linux__
+    uintptr_t start = 0;
+    uintptr_t end = 0;
+    if (!whole_pages(addr, length, start, end)) {
+        return false;
+    }
+
+    bool equal = std::all_of(placed.begin(), placed.end(),
+                             [&placed](const NumaWeight& weight) { return weight.weight == placed[0].weight; });
+    if (equal) {
+        std::vector<size_t> node_ids;
+        for (const auto& weight : placed) {
+            node_ids.push_back(weight.node_id);
+        }
+        policy = "interleave";
+        return mbind_nodes(start, end, MPOL_INTERLEAVE, node_ids);
+    }
+    if (weighted_interleave(start, end, placed)) {
+        policy = "weighted-interleave";
+        return true;
+    }
+    policy = "range-interleave";
+    return range_interleave(start, end, placed);
+#else
+    return false;
+#endif
+}
+
+std::map<size_t, size_t> count_pages_by_node(const void* addr, size_t length) {
+    std::map<size_t, size_t> pages;
+#ifdef __linux__
+    uintptr_t start = 0;
+    uintptr_t end = 0;
+    if (!whole_pages(const_cast<void*>(addr), length, start, end)) {
+        return pages;
+    }
+
+    // Batches bound the page and status arrays for multi-gigabyte ranges
+    constexpr size_t BATCH_PAGES = 4096;
+    size_t page_size = static_cast<size_t>(sysconf(_SC_PAGESIZE));
+    std::vector<void*> batch;
+    std::vector<int> status;
+    for (uintptr_t page = start; page < end;) {
+        batch.clear();
+        for (; page < end && batch.size() < BATCH_PAGES; page += page_size) {
+            batch.push_back(reinterpret_cast<void*>(page));
+        }
+        status.assign(batch.size(), -1);
+        if (syscall(SYS_move_pages, 0, batch.size(), batch.data(), nullptr, status.data(), 0) != 0) {
+            return {};
+        }
+        for (int node : status) {
+            if (node >= 0) {  // Negative: not faulted in (-ENOENT) or not movable
+                ++pages[static_cast<size_t>(node)];
+            }
+        }
+    }
+#else
+    (void)addr;
+    (void)length;
+#endif
+    return pages;
+}
+
+NumaAccess read_access(const std::string& node_dir) {
+    NumaAccess access;
+    const std::string base = node_dir + "/access0/initiators/";
+    const std::pair<const char*, size_t*> attributes[] = {
+        {"read_bandwidth", &access.read_bandwidth_mbps},
+        {"write_bandwidth", &access.write_bandwidth_mbps},
+        {"read_latency", &access.read_latency_ns},
+        {"write_latency", &access.write_latency_ns},
+    };
+    for (const auto& attribute : attributes) {
+        std::string value;
+        if (!read_attribute(base + attribute.first, value) || !parse_size(value, *attribute.second)) {
+            *attribute.second = 0;
+        }
+    }
+    return access;
+}
+
+bool is_memory_only(const NumaNode& node) {
+    return node.cpus.empty() && node.memory_bytes > 0;
+}
+
+}  // namespace NumaUtils
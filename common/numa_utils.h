@@ -0,0 +1,121 @@
+#ifndef NUMA_UTILS_H
+#define NUMA_UTILS_H
+
+#include <cstddef>
+#include <map>
+#include <string>
+#include <vector>
+#include "memory_types.h"
+
+/**
+ * @brief Linux NUMA topology detection and binding helpers
+ *
+ * Topology is read from /sys/devices/system/node and binding uses the
+ * mbind/sched_setaffinity system calls directly, so no libnuma dependency
+ * is needed. On non-Linux systems every function degrades to a single node
+ * and the bind calls report failure.
+ */
+namespace NumaUtils {
+
+    /**
+     * @brief Parse a kernel CPU/node list such as "0-3,8,10-11"
+     *
+     * @param list List string as found in sysfs cpulist/online files
+     * @return Expanded ids in the order given; empty if the list is malformed
+     */
+    std::vector<size_t> parse_id_list(const std::string& list);
+
+    /**
+     * @brief Detect the NUMA topology of the running system
+     *
+     * Falls back to a single node with every logical CPU when sysfs offers
+     * no node information (non-NUMA kernels, containers, non-Linux hosts).
+     *
+     * @return Detected topology, never empty
+     */
+    NumaTopology detect_topology();
+
+    /**
+     * @brief Topology detected once per process
+     *
+     * Node membership does not change while a benchmark runs, so the hot
+     * per-thread binding path reads this instead of re-parsing sysfs.
+     */
+    const NumaTopology& get_topology();
+
+    /**
+     * @brief Pin the calling thread to one CPU of a NUMA node
+     *
+     * Threads are spread round-robin over the node's CPUs by thread_id.
+     *
+     * @param thread_id Index of the calling thread within its test
+     * @param node_id Node to bind to
+     * @return true if the affinity was applied
+     */
+    bool bind_thread_to_node(size_t thread_id, size_t node_id);
+
+    /**
+     * @brief Bind and migrate a memory range to a NUMA node
+     *
+     * The range is shrunk to whole pages so neighbouring allocations are
+     * never rebound. Pages already touched are migrated (MPOL_MF_MOVE).
+     *
+     * @param addr Start of the range
+     * @param length Length of the range in bytes
+     * @param node_id Node to bind to
+     * @return true if every page in the range now lives on the node
+     */
+    bool bind_memory_to_node(void* addr, size_t length, size_t node_id);
+
+    /**
+     * @brief Interleave a memory range over several nodes in proportion to their weights
+     *
+     * Equal weights use MPOL_INTERLEAVE. Unequal ones use
+     * MPOL_WEIGHTED_INTERLEAVE (Linux 6.9+): the weights are written to
+     * /sys/kernel/mm/mempolicy/weighted_interleave, the range is faulted in
+     * under the policy and the previous weights are restored, since they
+     * are system-wide. Where that is unavailable (older kernels, no write
+     * access) consecutive TIER_RANGE_BYTES ranges are bound to the nodes in
+     * weighted round-robin order. One node with a weight is a plain bind.
+     * Contents are preserved; pages already touched are migrated.
+     *
+     * @param addr Start of the range
+     * @param length Length of the range in bytes
+     * @param weights Nodes and weights, each node once; zero weights are skipped
+     * @param policy Set to the policy applied: "bind", "interleave", "weighted-interleave" or "range-interleave"
+     * @return true if every page in the range was placed
+     */
+    bool interleave_memory(void* addr, size_t length, const std::vector<NumaWeight>& weights, std::string& policy);
+
+    /**
+     * @brief Count the resident pages of a range by node
+     *
+     * Asks move_pages where each page lives without moving it; pages not
+     * faulted in yet are not counted.
+     *
+     * @return Pages per node id; empty on failure or non-Linux hosts
+     */
+    std::map<size_t, size_t> count_pages_by_node(const void* addr, size_t length);
+
+    /**
+     * @brief Read the HMAT attributes of one node
+     *
+     * @param node_dir Node directory, such as /sys/devices/system/node/node2
+     * @return Attributes from node_dir/access0/initiators; zero where a file is missing
+     */
+    NumaAccess read_access(const std::string& node_dir);
+
+    /**
+     * @brief Whether a node has memory but no CPUs (CXL Type-3 expanders, flat-mode HBM)
+     */
+    bool is_memory_only(const NumaNode& node);
+
+    /**
+     * @brief Find a node by kernel id
+     * @return Pointer into topology.nodes, or nullptr if not present
+     */
+    const NumaNode* find_node(const NumaTopology& topology, size_t node_id);
+
+}  // namespace NumaUtils
+
+#endif  // NUMA_UTILS_H
@@ -1,12 +1,412 @@
 #include "output_formatter.h"
 #include "output_formatter_utils.h"
 #include "constants.h"
+#include "json.h"
+#include "prefetch_control.h"
 
 #include <algorithm>
+#include <cmath>
+#include <cstdlib>
 #include <iomanip>
 #include <iostream>
 #include <sstream>
 
+namespace {
+
+// Distribution columns appended to the test result and cache-aware CSV tables
+const char* const CSV_DISTRIBUTION_HEADER =
+    "Bandwidth Min (GB/s),Bandwidth Median (GB/s),Bandwidth P95 (GB/s),Bandwidth P99 (GB/s),Bandwidth Max "
+    "(GB/s),Bandwidth CV,Latency Min (ns),Latency Median (ns),Latency P95 (ns),Latency P99 (ns),Latency Max "
+    "(ns),Latency CV,Warnings";
+
+// Bandwidth distribution columns of the per-thread CSV table
+const char* const CSV_THREAD_DISTRIBUTION_HEADER =
+    "Bandwidth Min (GB/s),Bandwidth Median (GB/s),Bandwidth P95 (GB/s),Bandwidth P99 (GB/s),Bandwidth Max "
+    "(GB/s),Bandwidth CV";
+
+std::string format_json_distribution(const DistributionStats& dist, int precision) {
+    std::stringstream ss;
+    ss << std::fixed << std::setprecision(precision) << "{\"samples\": " << dist.count << ", \"min\": " << dist.min
+       << ", \"median\": " << dist.median << ", \"p95\": " << dist.p95 << ", \"p99\": " << dist.p99
+       << ", \"max\": " << dist.max << ", \"cv\": " << std::setprecision(4) << dist.cv << "}";
+    return ss.str();
+}
+
+// Separator row of a markdown table, each rule as wide as its padded column title
+std::string markdown_rule(const std::vector<std::string>& columns) {
+    std::string rule = "|";
+    for(const auto& column : columns) {
+        rule += std::string(column.size() + 2, '-') + "|";
+    }
+    return rule + "\n";
+}
+
+// Change from first to last as "-12.5%" or "+0.3%" (a drop is negative)
+std::string format_change_percent(double drop_percent) {
+    double change = std::fabs(drop_percent) < 0.05 ? 0.0 : -drop_percent;
+    std::stringstream ss;
+    ss << (change > 0.0 ? "+" : "") << std::fixed << std::setprecision(1) << change << "%";
+    return ss.str();
+}
+
+// Highest bandwidth on a loaded-latency curve (reference for utilization)
+double peak_load_bandwidth(const std::vector<LoadedLatencyPoint>& points) {
+    double peak = 0.0;
+    for(const auto& point : points) {
+        peak = std::max(peak, point.bandwidth_gbps);
+    }
+    return peak;
+}
+
+double load_utilization_percent(const LoadedLatencyPoint& point, double peak) {
+    return peak > 0.0 ? (point.bandwidth_gbps / peak) * 100.0 : 0.0;
+}
+
+// Clock offset of an agent, marked when it skews the common start
+std::string format_clock_offset(const Fleet::HostRun& host) {
+    if(!host.accepted)
+        return "-";
+    std::stringstream ss;
+    ss << (host.clock_offset_ms > 0.0 ? "+" : "") << std::fixed << std::setprecision(1) << host.clock_offset_ms;
+    if(std::fabs(host.clock_offset_ms) > BenchmarkConstants::FLEET_MAX_SKEW_MS)
+        ss << " (skewed)";
+    return ss.str();
+}
+
+std::string fleet_host_status(const Fleet::HostRun& host) {
+    if(!host.accepted)
+        return "failed: " + host.message;
+    if(host.exit_code == 0)
+        return "ok";
+    std::string status = host.exit_code < 0 ? std::string("incomplete") : "exit " + std::to_string(host.exit_code);
+    return host.message.empty() ? status : status + ": " + host.message;
+}
+
+std::string fleet_metric_unit(const std::string& metric) {
+    return metric == "latency_ns" ? "ns" : "GB/s";
+}
+
+// Bandwidth of the local-only point measured against the same far node (0 if none)
+double local_only_bandwidth(const std::vector<MemoryTiers::Point>& points, size_t far_node) {
+    for(const auto& point : points) {
+        if(point.far_node == far_node && point.ratio.far_weight == 0)
+            return point.stats.bandwidth_gbps;
+    }
+    return 0.0;
+}
+
+// Index of the fastest configuration of a prefetch sweep (0 if empty)
+size_t best_prefetch_point(const std::vector<PrefetchPoint>& points) {
+    size_t best = 0;
+    for(size_t i = 1; i < points.size(); ++i) {
+        if(points[i].bandwidth_gbps > points[best].bandwidth_gbps) {
+            best = i;
+        }
+    }
+    return best;
+}
+
+const char* hardware_prefetch_label(const PrefetchPoint& point) {
+    return point.hardware_disabled ? "off" : "on";
+}
+
+// Time per increment of a false-sharing run over the padded run with as many threads (0 without one)
+double false_sharing_slowdown(const std::vector<CoherenceTests::FalseSharingResult>& results,
+                              const CoherenceTests::FalseSharingResult& result) {
+    for(const auto& padded : results) {
+        if(padded.layout == CoherenceTests::CounterLayout::PADDED && padded.num_threads == result.num_threads &&
+           padded.ns_per_increment > 0.0) {
+            return result.ns_per_increment / padded.ns_per_increment;
+        }
+    }
+    return 0.0;
+}
+
+// Bandwidth of a tuned shape over the automatic kernel on the same working set, in percent (0 without one)
+double tuning_gain_percent(const PeakCalibration::TunedShape& shape) {
+    return (shape.baseline_gbps > 0.0) ? (shape.bandwidth_gbps / shape.baseline_gbps - 1.0) * 100.0 : 0.0;
+}
+
+// Total throughput of an atomic run over the single-thread run of the same configuration (0 without one)
+double atomic_scaling(const std::vector<AtomicTests::Result>& results, const AtomicTests::Result& result) {
+    for(const auto& single : results) {
+        if(single.num_threads == 1 && single.config.op == result.config.op &&
+           single.config.ordering == result.config.ordering && single.config.sharing == result.config.sharing &&
+           single.config.impl == result.config.impl && single.total_mops > 0.0) {
+            return result.total_mops / single.total_mops;
+        }
+    }
+    return 0.0;
+}
+
+// JSON member listing a result's validation warnings (empty if there are none)
+std::string format_json_warnings(const TestResult& result, const std::string& indent) {
+    if(result.warnings.empty()) {
+        return "";
+    }
+    std::stringstream ss;
+    ss << ",\n" << indent << "\"warnings\": [";
+    for(size_t i = 0; i < result.warnings.size(); ++i) {
+        ss << "\"" << result.warnings[i] << "\"";
+        if(i < result.warnings.size() - 1)
+            ss << ", ";
+    }
+    ss << "]";
+    return ss.str();
+}
+
+// JSON member with a matrix multiply result's compute metrics (empty for other patterns)
+std::string format_json_gemm(const TestResult& result, const std::string& indent) {
+    if(result.gemm.matrix_size == 0) {
+        return "";
+    }
+    std::stringstream ss;
+    ss << ",\n"
+       << indent << "\"gemm\": {\"precision\": \"" << result.gemm.precision << "\", \"accumulate\": \""
+       << result.gemm.accumulate << "\", \"matrix_size\": " << result.gemm.matrix_size
+       << ", \"gops\": " << std::fixed << std::setprecision(2) << result.gemm.gops
+       << ", \"arithmetic_intensity\": " << result.gemm.arithmetic_intensity << "}";
+    return ss.str();
+}
+
+// JSON member describing a calibrated measurement (empty for fixed iteration counts)
+std::string format_json_calibration(const TestResult& result, const std::string& indent) {
+    if(result.calibration.repetitions == 0) {
+        return "";
+    }
+    std::stringstream ss;
+    ss << ",\n"
+       << indent << "\"calibration\": {\"iterations\": " << result.calibration.iterations
+       << ", \"repetitions\": " << result.calibration.repetitions << ", \"ci95_percent\": " << std::fixed
+       << std::setprecision(2) << result.calibration.ci_percent
+       << ", \"converged\": " << (result.calibration.converged ? "true" : "false") << "}";
+    return ss.str();
+}
+
+// Measured DRAM traffic per byte the kernel nominally moves (0 if not measured)
+double dram_traffic_ratio(const TestResult& result) {
+    if(!result.counters.has_dram_bytes() || result.stats.bytes_processed == 0) {
+        return 0.0;
+    }
+    return static_cast<double>(result.counters.dram_bytes()) / result.stats.bytes_processed;
+}
+
+// JSON member with a result's hardware counters (empty if none were counted)
+std::string format_json_counters(const TestResult& result, const std::string& indent) {
+    if(result.counters.empty()) {
+        return "";
+    }
+    std::stringstream ss;
+    ss << ",\n" << indent << "\"counters\": {";
+    bool first = true;
+    for(size_t i = 0; i < PerfCounters::COUNTER_COUNT; ++i) {
+        auto counter = static_cast<PerfCounters::Counter>(i);
+        if(!result.counters.has(counter)) {
+            continue;
+        }
+        ss << (first ? "" : ", ") << "\"" << PerfCounters::counter_name(counter)
+           << "\": " << result.counters.get(counter);
+        first = false;
+    }
+    if(result.counters.has_dram_bytes()) {
+        ss << ", \"dram_bytes_per_nominal_byte\": " << std::fixed << std::setprecision(3)
+           << dram_traffic_ratio(result);
+    }
+    ss << "}";
+    return ss.str();
+}
+
+// JSON member with a file-backed result's page faults (empty otherwise)
+std::string format_json_page_faults(const TestResult& result, const std::string& indent) {
+    if(!result.page_faults.measured) {
+        return "";
+    }
+    std::stringstream ss;
+    ss << ",\n"
+       << indent << "\"page_faults\": {\"minor\": " << result.page_faults.minor_faults
+       << ", \"major\": " << result.page_faults.major_faults << ", \"faults_per_second\": " << std::fixed
+       << std::setprecision(0) << result.page_faults.faults_per_second << "}";
+    return ss.str();
+}
+
+// JSON member with a sparse result's useful and line bandwidth (empty otherwise)
+std::string format_json_access(const TestResult& result, const std::string& indent) {
+    if(!result.access.measured) {
+        return "";
+    }
+    std::stringstream ss;
+    ss << ",\n"
+       << indent << "\"access\": {\"element_bytes\": " << result.access.element_bytes << ", \"layout\": \""
+       << result.access.layout << "\", \"useful_gbps\": " << std::fixed << std::setprecision(2)
+       << result.access.useful_gbps << ", \"line_gbps\": " << result.access.line_gbps
+       << ", \"line_use\": " << std::setprecision(3) << result.access.line_use << "}";
+    return ss.str();
+}
+
+bool has_access(const std::vector<TestResult>& results) {
+    return std::any_of(results.begin(), results.end(),
+                       [](const TestResult& result) { return result.access.measured; });
+}
+
+// JSON member with an encoded scan's decoded values and bytes (empty otherwise)
+std::string format_json_decode(const TestResult& result, const std::string& indent) {
+    if(!result.decode.measured) {
+        return "";
+    }
+    std::stringstream ss;
+    ss << ",\n"
+       << indent << "\"decode\": {\"encoding\": \"" << result.decode.encoding
+       << "\", \"bits\": " << result.decode.bits << ", \"values_per_second\": " << std::fixed
+       << std::setprecision(0) << result.decode.values_per_second
+       << ", \"output_gbps\": " << std::setprecision(2) << result.decode.output_gbps
+       << ", \"expansion\": " << result.decode.expansion << "}";
+    return ss.str();
+}
+
+bool has_decode(const std::vector<TestResult>& results) {
+    return std::any_of(results.begin(), results.end(),
+                       [](const TestResult& result) { return result.decode.measured; });
+}
+
+// JSON member with a proxy pattern's lookups or keys per second (empty otherwise)
+std::string format_json_proxy(const TestResult& result, const std::string& indent) {
+    if(!result.proxy.measured) {
+        return "";
+    }
+    std::stringstream ss;
+    ss << ",\n"
+       << indent << "\"proxy\": {\"unit\": \"" << result.proxy.unit << "\", \"per_second\": " << std::fixed
+       << std::setprecision(0) << result.proxy.per_second
+       << ", \"bytes_per_operation\": " << result.proxy.bytes_per_operation << "}";
+    return ss.str();
+}
+
+bool has_proxy(const std::vector<TestResult>& results) {
+    return std::any_of(results.begin(), results.end(),
+                       [](const TestResult& result) { return result.proxy.measured; });
+}
+
+// JSON member with an irregular pattern's flop rate and triad share (empty otherwise)
+std::string format_json_irregular(const TestResult& result, const std::string& indent) {
+    if(!result.irregular.measured) {
+        return "";
+    }
+    std::stringstream ss;
+    ss << ",\n"
+       << indent << "\"irregular\": {\"gflops\": " << std::fixed << std::setprecision(3) << result.irregular.gflops
+       << ", \"triad_gbps\": " << std::setprecision(2) << result.irregular.triad_gbps
+       << ", \"triad_percent\": " << std::setprecision(1) << result.irregular.triad_percent
+       << ", \"padding_percent\": " << result.irregular.padding_percent << "}";
+    return ss.str();
+}
+
+bool has_irregular(const std::vector<TestResult>& results) {
+    return std::any_of(results.begin(), results.end(),
+                       [](const TestResult& result) { return result.irregular.measured; });
+}
+
+// JSON member with the package and DRAM energy of a sampled result (empty otherwise)
+std::string format_json_energy(const TestResult& result, const std::string& indent) {
+    if(!result.energy.measured) {
+        return "";
+    }
+    std::stringstream ss;
+    ss << ",\n"
+       << indent << "\"energy\": {\"package_joules\": " << std::fixed << std::setprecision(3)
+       << result.energy.package_joules;
+    if(result.energy.has_dram) {
+        ss << ", \"dram_joules\": " << result.energy.dram_joules;
+    }
+    ss << ", \"seconds\": " << std::setprecision(4) << result.energy.seconds << ", \"package_watts\": "
+       << std::setprecision(2) << result.energy.package_watts;
+    if(result.energy.has_dram) {
+        ss << ", \"dram_watts\": " << result.energy.dram_watts;
+    }
+    ss << ", \"pj_per_byte\": " << result.energy.pj_per_byte << "}";
+    return ss.str();
+}
+
+bool has_energy(const std::vector<TestResult>& results) {
+    return std::any_of(results.begin(), results.end(),
+                       [](const TestResult& result) { return result.energy.measured; });
+}
+
+bool has_energy(const std::vector<ThreadScaling::ScalingPoint>& points) {
+    return std::any_of(points.begin(), points.end(),
+                       [](const ThreadScaling::ScalingPoint& point) { return point.energy_measured; });
+}
+
+bool has_page_faults(const std::vector<TestResult>& results) {
+    return std::any_of(results.begin(), results.end(),
+                       [](const TestResult& result) { return result.page_faults.measured; });
+}
+
+bool has_counters(const std::vector<TestResult>& results) {
+    return std::any_of(results.begin(), results.end(),
+                       [](const TestResult& result) { return !result.counters.empty(); });
+}
+
+// Counter value for a table cell ("-" if it was not counted)
+std::string counter_cell(const PerfCounters::CounterValues& counters, PerfCounters::Counter counter) {
+    return counters.has(counter) ? std::to_string(counters.get(counter)) : "-";
+}
+
+std::string ipc_cell(const PerfCounters::CounterValues& counters) {
+    using PerfCounters::Counter;
+    if(!counters.has(Counter::CYCLES) || !counters.has(Counter::INSTRUCTIONS) || counters.get(Counter::CYCLES) == 0) {
+        return "-";
+    }
+    std::stringstream ss;
+    ss << std::fixed << std::setprecision(2)
+       << static_cast<double>(counters.get(Counter::INSTRUCTIONS)) / counters.get(Counter::CYCLES);
+    return ss.str();
+}
+
+bool has_gemm_stats(const std::vector<TestResult>& results) {
+    return std::any_of(results.begin(), results.end(),
+                       [](const TestResult& result) { return result.gemm.matrix_size > 0; });
+}
+
+// Quoted CSV field with a result's validation warnings
+std::string format_csv_warnings(const TestResult& result) {
+    std::string joined;
+    for(const auto& warning : result.warnings) {
+        if(!joined.empty())
+            joined += "; ";
+        joined += warning;
+    }
+    return "\"" + joined + "\"";
+}
+
+std::string format_csv_distribution(const DistributionStats& dist, int precision) {
+    if(dist.count == 0) {
+        return ",,,,,";
+    }
+    std::stringstream ss;
+    ss << std::fixed << std::setprecision(precision) << dist.min << "," << dist.median << "," << dist.p95 << ","
+       << dist.p99 << "," << dist.max << "," << std::setprecision(4) << dist.cv;
+    return ss.str();
+}
+
+// Share of the calibrated peak of this host ("N/A" until --calibrate has stored one)
+std::string calibrated_efficiency_display(const TestResult& result, const MemorySpecs& mem_specs) {
+    double calibrated = mem_specs.calibrated_bandwidth_gbps;
+    return OutputFormatterUtils::format_efficiency_display(
+        calibrated > 0 ? result.stats.bandwidth_gbps / calibrated * 100.0 : -1.0, calibrated);
+}
+
+std::string calibrated_efficiency_json(const TestResult& result, const MemorySpecs& mem_specs) {
+    if(mem_specs.calibrated_bandwidth_gbps <= 0) {
+        return "null";
+    }
+    std::stringstream ss;
+    ss << std::fixed << std::setprecision(1)
+       << result.stats.bandwidth_gbps / mem_specs.calibrated_bandwidth_gbps * 100.0;
+    return ss.str();
+}
+
+}  // namespace
+
 OutputFormatter::OutputFormatter(OutputFormat format) : format_(format) {}
 
 std::string OutputFormatter::format_system_info(const SystemInfo& sys_info) {
@@ -71,6 +471,15 @@ std::string OutputFormatter::format_test_results(const std::vector<TestResult>&
             for(const auto& result : results) {
                 ss << format_markdown_test_result(result, mem_specs);
             }
+            ss << format_markdown_warnings(results);
+            ss << format_markdown_gemm_compute(results);
+            ss << format_markdown_counters(results);
+            ss << format_markdown_page_faults(results);
+            ss << format_markdown_access(results);
+            ss << format_markdown_decode(results);
+            ss << format_markdown_proxy(results);
+            ss << format_markdown_irregular(results);
+            ss << format_markdown_energy(results);
             break;
         case OutputFormat::JSON:
             ss << "[\n";
@@ -86,6 +495,15 @@ std::string OutputFormatter::format_test_results(const std::vector<TestResult>&
             for(const auto& result : results) {
                 ss << format_csv_test_result(result, mem_specs);
             }
+            ss << format_csv_thread_breakdown(results);
+            ss << format_csv_gemm_compute(results);
+            ss << format_csv_counters(results);
+            ss << format_csv_page_faults(results);
+            ss << format_csv_access(results);
+            ss << format_csv_decode(results);
+            ss << format_csv_proxy(results);
+            ss << format_csv_irregular(results);
+            ss << format_csv_energy(results);
             break;
     }
 
@@ -107,274 +525,3438 @@ std::string OutputFormatter::format_cache_aware_results(const std::string& patte
     }
 }
 
-std::string OutputFormatter::format_completion_message() {
+std::string OutputFormatter::format_numa_matrix(const std::string& pattern_name,
+                                                const std::string& working_set_desc,
+                                                const std::vector<NumaMatrixEntry>& entries) {
     switch(format_) {
         case OutputFormat::MARKDOWN:
-            return "\n## Test Complete\n\nAll memory bandwidth tests have been completed "
-                   "successfully.\n";
+            return format_markdown_numa_matrix(pattern_name, working_set_desc, entries);
         case OutputFormat::JSON:
-            return "\n{\n  \"status\": \"complete\",\n  \"message\": \"All memory bandwidth tests "
-                   "have been completed successfully.\"\n}\n";
+            return format_json_numa_matrix(pattern_name, working_set_desc, entries);
         case OutputFormat::CSV:
-            return "\n# Test Complete\n# All memory bandwidth tests have been completed "
-                   "successfully.\n";
+            return format_csv_numa_matrix(pattern_name, working_set_desc, entries);
         default:
-            return "\n## Test Complete\n\nAll memory bandwidth tests have been completed "
-                   "successfully.\n";
+            return format_markdown_numa_matrix(pattern_name, working_set_desc, entries);
     }
 }
 
-// Markdown formatting methods
-std::string OutputFormatter::format_markdown_system_info(const SystemInfo& sys_info) {
-    std::string result;
-    result += OutputFormatterUtils::format_basic_system_info(sys_info);
-    result += OutputFormatterUtils::format_memory_specifications(sys_info.memory_specs);
-    result += OutputFormatterUtils::format_cache_information(sys_info.cache_info, sys_info.memory_specs);
-    return result;
+std::string OutputFormatter::format_memory_tiers(const std::string& pattern_name,
+                                                 const std::string& working_set_desc,
+                                                 const std::vector<MemoryTiers::Point>& points) {
+    switch(format_) {
+        case OutputFormat::MARKDOWN:
+            return format_markdown_memory_tiers(pattern_name, working_set_desc, points);
+        case OutputFormat::JSON:
+            return format_json_memory_tiers(pattern_name, working_set_desc, points);
+        case OutputFormat::CSV:
+            return format_csv_memory_tiers(pattern_name, working_set_desc, points);
+        default:
+            return format_markdown_memory_tiers(pattern_name, working_set_desc, points);
+    }
 }
 
-std::string OutputFormatter::format_markdown_system_info_without_cache(const SystemInfo& sys_info) {
-    std::string result;
-    result += OutputFormatterUtils::format_basic_system_info(sys_info);
-    result += OutputFormatterUtils::format_memory_specifications(sys_info.memory_specs);
-    return result;
+std::string OutputFormatter::format_gpu_bandwidth(const std::string& working_set_desc,
+                                                  const std::vector<GpuBandwidth::Point>& points) {
+    switch(format_) {
+        case OutputFormat::MARKDOWN:
+            return format_markdown_gpu_bandwidth(working_set_desc, points);
+        case OutputFormat::JSON:
+            return format_json_gpu_bandwidth(working_set_desc, points);
+        case OutputFormat::CSV:
+            return format_csv_gpu_bandwidth(working_set_desc, points);
+        default:
+            return format_markdown_gpu_bandwidth(working_set_desc, points);
+    }
 }
 
-std::string OutputFormatter::format_markdown_header() {
-    return "## Test Results\n\n"
-           "| Test | Working Set | Threads | Bandwidth (Gb/s) | Latency (ns) | Efficiency (%) |\n"
-           "|------|-------------|---------|------------------|--------------|----------------|\n";
+std::string OutputFormatter::format_loaded_latency(const std::string& pattern_name,
+                                                   const std::string& working_set_desc,
+                                                   const std::vector<LoadedLatencyPoint>& points) {
+    switch(format_) {
+        case OutputFormat::MARKDOWN:
+            return format_markdown_loaded_latency(pattern_name, working_set_desc, points);
+        case OutputFormat::JSON:
+            return format_json_loaded_latency(pattern_name, working_set_desc, points);
+        case OutputFormat::CSV:
+            return format_csv_loaded_latency(pattern_name, working_set_desc, points);
+        default:
+            return format_markdown_loaded_latency(pattern_name, working_set_desc, points);
+    }
 }
 
-std::string OutputFormatter::format_markdown_test_result(const TestResult& result,
-                                                         const MemorySpecs& mem_specs) {
-    double efficiency =
-        calculate_efficiency(result.stats.bandwidth_gbps, mem_specs.theoretical_bandwidth_gbps);
-    bool suspicious = validate_test_result(result, mem_specs);
-
-    std::stringstream ss;
-    ss << "| " << result.test_name << " | " << result.working_set_desc << " | "
-       << result.num_threads << " | " << std::fixed << std::setprecision(2)
-       << (result.stats.bandwidth_gbps * 8.0);
-
-    // Add warning indicator for suspicious results
-    if(suspicious) {
-        ss << " ⚠️";
+std::string OutputFormatter::format_prefetch_sweep(const std::string& pattern_name,
+                                                   const std::string& working_set_desc,
+                                                   const std::vector<PrefetchPoint>& points) {
+    switch(format_) {
+        case OutputFormat::MARKDOWN:
+            return format_markdown_prefetch_sweep(pattern_name, working_set_desc, points);
+        case OutputFormat::JSON:
+            return format_json_prefetch_sweep(pattern_name, working_set_desc, points);
+        case OutputFormat::CSV:
+            return format_csv_prefetch_sweep(pattern_name, working_set_desc, points);
+        default:
+            return format_markdown_prefetch_sweep(pattern_name, working_set_desc, points);
     }
-
-    ss << " | " << std::fixed << std::setprecision(1) << result.stats.latency_ns << " | ";
-
-    // Handle efficiency display
-    ss << OutputFormatterUtils::format_efficiency_display(efficiency, mem_specs.theoretical_bandwidth_gbps);
-    ss << " |\n";
-
-    return ss.str();
 }
 
-std::string OutputFormatter::format_markdown_cache_aware_results(
-    const std::string& pattern_name, const std::vector<TestResult>& results,
-    const MemorySpecs& mem_specs) {
-    std::stringstream ss;
-    ss << "### " << pattern_name << " (Cache-Aware)\n\n";
-    ss << "| Working Set | Threads | Bandwidth (Gb/s) | Latency (ns) | Efficiency (%) |\n";
-    ss << "|-------------|---------|------------------|--------------|----------------|\n";
-
-    for(const auto& result : results) {
-        double efficiency =
-            calculate_efficiency(result.stats.bandwidth_gbps, mem_specs.theoretical_bandwidth_gbps);
+std::string OutputFormatter::format_thread_scaling(const std::string& pattern_name,
+                                                   const std::string& working_set_desc,
+                                                   const std::string& placement,
+                                                   const std::vector<ThreadScaling::ScalingPoint>& points) {
+    switch(format_) {
+        case OutputFormat::MARKDOWN:
+            return format_markdown_thread_scaling(pattern_name, working_set_desc, placement, points);
+        case OutputFormat::JSON:
+            return format_json_thread_scaling(pattern_name, working_set_desc, placement, points);
+        case OutputFormat::CSV:
+            return format_csv_thread_scaling(pattern_name, working_set_desc, placement, points);
+        default:
+            return format_markdown_thread_scaling(pattern_name, working_set_desc, placement, points);
+    }
+}
 
-        ss << "| " << result.working_set_desc << " | " << result.num_threads << " | " << std::fixed
-           << std::setprecision(2) << (result.stats.bandwidth_gbps * 8.0) << " | " << std::fixed
-           << std::setprecision(1) << result.stats.latency_ns << " | ";
+std::string OutputFormatter::format_contention(const std::string& victim_name, const std::string& aggressor,
+                                               const std::string& working_set_desc,
+                                               const std::vector<Contention::ContentionPoint>& points) {
+    switch(format_) {
+        case OutputFormat::MARKDOWN:
+            return format_markdown_contention(victim_name, aggressor, working_set_desc, points);
+        case OutputFormat::JSON:
+            return format_json_contention(victim_name, aggressor, working_set_desc, points);
+        case OutputFormat::CSV:
+            return format_csv_contention(victim_name, aggressor, working_set_desc, points);
+        default:
+            return format_markdown_contention(victim_name, aggressor, working_set_desc, points);
+    }
+}
 
-        // Handle efficiency display
-        ss << OutputFormatterUtils::format_efficiency_display(efficiency, mem_specs.theoretical_bandwidth_gbps);
-        ss << " |\n";
+std::string OutputFormatter::format_soak(const std::string& pattern_name, const std::string& working_set_desc,
+                                         const Soak::Summary& summary, const std::vector<Soak::Sample>& samples) {
+    switch(format_) {
+        case OutputFormat::MARKDOWN:
+            return format_markdown_soak(pattern_name, working_set_desc, summary, samples);
+        case OutputFormat::JSON:
+            return format_json_soak(pattern_name, working_set_desc, summary, samples);
+        case OutputFormat::CSV:
+            return format_csv_soak(pattern_name, working_set_desc, summary, samples);
+        default:
+            return format_markdown_soak(pattern_name, working_set_desc, summary, samples);
     }
-    ss << "\n";
+}
 
-    return ss.str();
+std::string OutputFormatter::format_baseline_comparison(const std::string& baseline_desc,
+                                                        const std::vector<std::string>& host_changes,
+                                                        const std::vector<Baseline::Comparison>& comparisons) {
+    switch(format_) {
+        case OutputFormat::MARKDOWN:
+            return format_markdown_baseline_comparison(baseline_desc, host_changes, comparisons);
+        case OutputFormat::JSON:
+            return format_json_baseline_comparison(baseline_desc, host_changes, comparisons);
+        case OutputFormat::CSV:
+            return format_csv_baseline_comparison(baseline_desc, host_changes, comparisons);
+        default:
+            return format_markdown_baseline_comparison(baseline_desc, host_changes, comparisons);
+    }
 }
 
-// JSON formatting methods
-std::string OutputFormatter::format_json_system_info(const SystemInfo& sys_info) {
+std::string OutputFormatter::format_fleet_report(const Fleet::Report& report) {
+    switch(format_) {
+        case OutputFormat::MARKDOWN:
+            return format_markdown_fleet_report(report);
+        case OutputFormat::JSON:
+            return format_json_fleet_report(report);
+        case OutputFormat::CSV:
+            return format_csv_fleet_report(report);
+        default:
+            return format_markdown_fleet_report(report);
+    }
+}
+
+std::string OutputFormatter::format_peak_calibration(const PeakCalibration::HostPeak& peak,
+                                                     const MemorySpecs& mem_specs) {
+    switch(format_) {
+        case OutputFormat::MARKDOWN:
+            return format_markdown_peak_calibration(peak, mem_specs);
+        case OutputFormat::JSON:
+            return format_json_peak_calibration(peak, mem_specs);
+        case OutputFormat::CSV:
+            return format_csv_peak_calibration(peak, mem_specs);
+        default:
+            return format_markdown_peak_calibration(peak, mem_specs);
+    }
+}
+
+std::string OutputFormatter::format_tuning(const PeakCalibration::HostPeak& peak) {
+    switch(format_) {
+        case OutputFormat::MARKDOWN:
+            return format_markdown_tuning(peak);
+        case OutputFormat::JSON:
+            return format_json_tuning(peak);
+        case OutputFormat::CSV:
+            return format_csv_tuning(peak);
+        default:
+            return format_markdown_tuning(peak);
+    }
+}
+
+std::string OutputFormatter::format_core_to_core(const std::vector<size_t>& cpus,
+                                                 const std::vector<CoherenceTests::PingPongResult>& matrix) {
+    switch(format_) {
+        case OutputFormat::MARKDOWN:
+            return format_markdown_core_to_core(cpus, matrix);
+        case OutputFormat::JSON:
+            return format_json_core_to_core(cpus, matrix);
+        case OutputFormat::CSV:
+            return format_csv_core_to_core(cpus, matrix);
+        default:
+            return format_markdown_core_to_core(cpus, matrix);
+    }
+}
+
+std::string OutputFormatter::format_false_sharing(const std::vector<CoherenceTests::FalseSharingResult>& results) {
+    switch(format_) {
+        case OutputFormat::MARKDOWN:
+            return format_markdown_false_sharing(results);
+        case OutputFormat::JSON:
+            return format_json_false_sharing(results);
+        case OutputFormat::CSV:
+            return format_csv_false_sharing(results);
+        default:
+            return format_markdown_false_sharing(results);
+    }
+}
+
+std::string OutputFormatter::format_atomics(const std::string& std_atomics,
+                                            const std::vector<AtomicTests::Result>& results) {
+    switch(format_) {
+        case OutputFormat::MARKDOWN:
+            return format_markdown_atomics(std_atomics, results);
+        case OutputFormat::JSON:
+            return format_json_atomics(std_atomics, results);
+        case OutputFormat::CSV:
+            return format_csv_atomics(std_atomics, results);
+        default:
+            return format_markdown_atomics(std_atomics, results);
+    }
+}
+
+std::string OutputFormatter::format_allocator_results(const std::vector<AllocatorBench::Result>& results) {
+    switch(format_) {
+        case OutputFormat::MARKDOWN:
+            return format_markdown_allocator_results(results);
+        case OutputFormat::JSON:
+            return format_json_allocator_results(results);
+        case OutputFormat::CSV:
+            return format_csv_allocator_results(results);
+        default:
+            return format_markdown_allocator_results(results);
+    }
+}
+
+std::string OutputFormatter::format_roofline(const std::string& working_set_desc, const Roofline& roofline) {
+    switch(format_) {
+        case OutputFormat::MARKDOWN:
+            return format_markdown_roofline(working_set_desc, roofline);
+        case OutputFormat::JSON:
+            return format_json_roofline(working_set_desc, roofline);
+        case OutputFormat::CSV:
+            return format_csv_roofline(working_set_desc, roofline);
+        default:
+            return format_markdown_roofline(working_set_desc, roofline);
+    }
+}
+
+std::string OutputFormatter::format_working_set_sweep(const WorkingSetSweep& sweep) {
+    switch(format_) {
+        case OutputFormat::MARKDOWN:
+            return format_markdown_working_set_sweep(sweep);
+        case OutputFormat::JSON:
+            return format_json_working_set_sweep(sweep);
+        case OutputFormat::CSV:
+            return format_csv_working_set_sweep(sweep);
+        default:
+            return format_markdown_working_set_sweep(sweep);
+    }
+}
+
+std::string OutputFormatter::format_io_results(size_t file_size, double clock_ghz,
+                                               const std::vector<IoTests::Result>& results) {
+    switch(format_) {
+        case OutputFormat::MARKDOWN:
+            return format_markdown_io_results(file_size, clock_ghz, results);
+        case OutputFormat::JSON:
+            return format_json_io_results(file_size, clock_ghz, results);
+        case OutputFormat::CSV:
+            return format_csv_io_results(file_size, clock_ghz, results);
+        default:
+            return format_markdown_io_results(file_size, clock_ghz, results);
+    }
+}
+
+std::string OutputFormatter::format_mapping_results(const std::vector<MappingTests::Result>& results) {
+    switch(format_) {
+        case OutputFormat::MARKDOWN:
+            return format_markdown_mapping_results(results);
+        case OutputFormat::JSON:
+            return format_json_mapping_results(results);
+        case OutputFormat::CSV:
+            return format_csv_mapping_results(results);
+        default:
+            return format_markdown_mapping_results(results);
+    }
+}
+
+std::string OutputFormatter::format_tlb_results(const std::vector<TlbSweep::Curve>& curves) {
+    switch(format_) {
+        case OutputFormat::MARKDOWN:
+            return format_markdown_tlb_results(curves);
+        case OutputFormat::JSON:
+            return format_json_tlb_results(curves);
+        case OutputFormat::CSV:
+            return format_csv_tlb_results(curves);
+        default:
+            return format_markdown_tlb_results(curves);
+    }
+}
+
+std::string OutputFormatter::format_copy_sweep(const std::vector<CopySweep::Point>& points) {
+    switch(format_) {
+        case OutputFormat::MARKDOWN:
+            return format_markdown_copy_sweep(points);
+        case OutputFormat::JSON:
+            return format_json_copy_sweep(points);
+        case OutputFormat::CSV:
+            return format_csv_copy_sweep(points);
+        default:
+            return format_markdown_copy_sweep(points);
+    }
+}
+
+std::string OutputFormatter::format_ring_results(const std::vector<RingTransfer::Result>& results) {
+    switch(format_) {
+        case OutputFormat::MARKDOWN:
+            return format_markdown_ring_results(results);
+        case OutputFormat::JSON:
+            return format_json_ring_results(results);
+        case OutputFormat::CSV:
+            return format_csv_ring_results(results);
+        default:
+            return format_markdown_ring_results(results);
+    }
+}
+
+std::string OutputFormatter::format_trace_replay(const std::string& path, const TraceReplay::Summary& summary,
+                                                 const TraceReplay::ReplayResult& result) {
+    switch(format_) {
+        case OutputFormat::MARKDOWN:
+            return format_markdown_trace_replay(path, summary, result);
+        case OutputFormat::JSON:
+            return format_json_trace_replay(path, summary, result);
+        case OutputFormat::CSV:
+            return format_csv_trace_replay(path, summary, result);
+        default:
+            return format_markdown_trace_replay(path, summary, result);
+    }
+}
+
+std::string OutputFormatter::format_completion_message() {
+    switch(format_) {
+        case OutputFormat::MARKDOWN:
+            return "\n## Test Complete\n\nAll memory bandwidth tests have been completed "
+                   "successfully.\n";
+        case OutputFormat::JSON:
+            return "\n{\n  \"status\": \"complete\",\n  \"message\": \"All memory bandwidth tests "
+                   "have been completed successfully.\"\n}\n";
+        case OutputFormat::CSV:
+            return "\n# Test Complete\n# All memory bandwidth tests have been completed "
+                   "successfully.\n";
+        default:
+            return "\n## Test Complete\n\nAll memory bandwidth tests have been completed "
+                   "successfully.\n";
+    }
+}
+
+// Markdown formatting methods
+std::string OutputFormatter::format_markdown_system_info(const SystemInfo& sys_info) {
+    std::string result;
+    result += OutputFormatterUtils::format_basic_system_info(sys_info);
+    result += OutputFormatterUtils::format_memory_specifications(sys_info.memory_specs);
+    result += OutputFormatterUtils::format_cache_information(sys_info.cache_info, sys_info.memory_specs);
+    return result;
+}
+
+std::string OutputFormatter::format_markdown_system_info_without_cache(const SystemInfo& sys_info) {
+    std::string result;
+    result += OutputFormatterUtils::format_basic_system_info(sys_info);
+    result += OutputFormatterUtils::format_memory_specifications(sys_info.memory_specs);
+    return result;
+}
+
+std::string OutputFormatter::format_markdown_header() {
+    return "## Test Results\n\n"
+           "| Test | Working Set | Threads | Kernel | Stores | Bandwidth (Gb/s) | Latency (ns) | Efficiency (%) | "
+           "Of Calibrated (%) |\n"
+           "|------|-------------|---------|--------|--------|------------------|--------------|----------------|"
+           "-------------------|\n";
+}
+
+std::string OutputFormatter::format_markdown_test_result(const TestResult& result,
+                                                         const MemorySpecs& mem_specs) {
+    double efficiency =
+        calculate_efficiency(result.stats.bandwidth_gbps, mem_specs.theoretical_bandwidth_gbps);
+    bool suspicious = validate_test_result(result, mem_specs);
+
+    std::stringstream ss;
+    ss << "| " << result.test_name << " | " << result.working_set_desc << " | "
+       << result.num_threads << " | " << result.kernel_name << " | " << result.store_policy
+       << " | " << std::fixed << std::setprecision(2)
+       << (result.stats.bandwidth_gbps * 8.0);
+
+    // Add warning indicator for suspicious results
+    if(suspicious) {
+        ss << " ⚠️";
+    }
+
+    ss << " | " << std::fixed << std::setprecision(1) << result.stats.latency_ns << " | ";
+
+    // Handle efficiency display
+    ss << OutputFormatterUtils::format_efficiency_display(efficiency, mem_specs.theoretical_bandwidth_gbps);
+    ss << " | " << calibrated_efficiency_display(result, mem_specs);
+    ss << " |\n";
+
+    return ss.str();
+}
+
+std::string OutputFormatter::format_markdown_cache_aware_results(
+    const std::string& pattern_name, const std::vector<TestResult>& results,
+    const MemorySpecs& mem_specs) {
+    std::stringstream ss;
+    ss << "### " << pattern_name << " (Cache-Aware)\n\n";
+    ss << "| Working Set | Threads | Kernel | Stores | Bandwidth (Gb/s) | Latency (ns) | Efficiency (%) | "
+          "Of Calibrated (%) |\n";
+    ss << "|-------------|---------|--------|--------|------------------|--------------|----------------|"
+          "-------------------|\n";
+
+    for(const auto& result : results) {
+        double efficiency =
+            calculate_efficiency(result.stats.bandwidth_gbps, mem_specs.theoretical_bandwidth_gbps);
+
+        ss << "| " << result.working_set_desc << " | " << result.num_threads << " | "
+           << result.kernel_name << " | " << result.store_policy << " | " << std::fixed
+           << std::setprecision(2) << (result.stats.bandwidth_gbps * 8.0);
+        if(!result.warnings.empty()) {
+            ss << " ⚠️";
+        }
+        ss << " | " << std::fixed << std::setprecision(1) << result.stats.latency_ns << " | ";
+
+        // Handle efficiency display
+        ss << OutputFormatterUtils::format_efficiency_display(efficiency, mem_specs.theoretical_bandwidth_gbps);
+        ss << " | " << calibrated_efficiency_display(result, mem_specs);
+        ss << " |\n";
+    }
+    ss << format_markdown_warnings(results);
+    ss << format_markdown_gemm_compute(results);
+    ss << format_markdown_counters(results);
+    ss << format_markdown_page_faults(results);
+    ss << format_markdown_access(results);
+    ss << format_markdown_decode(results);
+    ss << format_markdown_proxy(results);
+    ss << format_markdown_irregular(results);
+    ss << format_markdown_energy(results);
+    ss << "\n";
+
+    return ss.str();
+}
+
+std::string OutputFormatter::format_markdown_numa_matrix(const std::string& pattern_name,
+                                                         const std::string& working_set_desc,
+                                                         const std::vector<NumaMatrixEntry>& entries) {
+    std::vector<size_t> cpu_nodes;
+    std::vector<size_t> memory_nodes;
+    for(const auto& entry : entries) {
+        if(std::find(cpu_nodes.begin(), cpu_nodes.end(), entry.cpu_node) == cpu_nodes.end())
+            cpu_nodes.push_back(entry.cpu_node);
+        if(std::find(memory_nodes.begin(), memory_nodes.end(), entry.memory_node) == memory_nodes.end())
+            memory_nodes.push_back(entry.memory_node);
+    }
+    std::sort(cpu_nodes.begin(), cpu_nodes.end());
+    std::sort(memory_nodes.begin(), memory_nodes.end());
+
+    auto find_entry = [&entries](size_t cpu_node, size_t memory_node) -> const NumaMatrixEntry* {
+        for(const auto& entry : entries) {
+            if(entry.cpu_node == cpu_node && entry.memory_node == memory_node)
+                return &entry;
+        }
+        return nullptr;
+    };
+
+    std::stringstream ss;
+    ss << "### " << pattern_name << " NUMA Matrix (" << working_set_desc << ")\n\n";
+    ss << "Rows: CPU node, columns: memory node\n\n";
+
+    const char* titles[] = {"Bandwidth (Gb/s)", "Latency (ns)"};
+    for(int table = 0; table < 2; ++table) {
+        std::vector<std::string> columns = {titles[table]};
+        for(size_t memory_node : memory_nodes)
+            columns.push_back("Mem " + std::to_string(memory_node));
+        for(const auto& column : columns)
+            ss << "| " << column << " ";
+        ss << "|\n" << markdown_rule(columns);
+
+        for(size_t cpu_node : cpu_nodes) {
+            ss << "| CPU " << cpu_node << " |";
+            for(size_t memory_node : memory_nodes) {
+                const NumaMatrixEntry* entry = find_entry(cpu_node, memory_node);
+                if(entry == nullptr) {
+                    ss << " - |";
+                } else if(table == 0) {
+                    ss << " " << std::fixed << std::setprecision(2) << (entry->stats.bandwidth_gbps * 8.0) << " |";
+                } else {
+                    ss << " " << std::fixed << std::setprecision(1) << entry->stats.latency_ns << " |";
+                }
+            }
+            ss << "\n";
+        }
+        ss << "\n";
+    }
+
+    return ss.str();
+}
+
+std::string OutputFormatter::format_markdown_memory_tiers(const std::string& pattern_name,
+                                                          const std::string& working_set_desc,
+                                                          const std::vector<MemoryTiers::Point>& points) {
+    std::vector<size_t> best = MemoryTiers::best_points(points);
+
+    std::stringstream ss;
+    ss << "### " << pattern_name << " Memory Tiers (" << working_set_desc << ")\n\n";
+    ss << "| Local | Far | Ratio | Placement | Policy | Far Pages (%) | Threads | Bandwidth (GB/s) | vs Local | "
+          "Latency (ns) |\n";
+    ss << "|-------|-----|-------|-----------|--------|---------------|---------|------------------|----------|"
+          "--------------|\n";
+    for(size_t i = 0; i < points.size(); ++i) {
+        const MemoryTiers::Point& point = points[i];
+        double local = local_only_bandwidth(points, point.far_node);
+        bool fastest = std::find(best.begin(), best.end(), i) != best.end();
+
+        ss << "| " << point.local_node << " | " << point.far_node << " | "
+           << MemoryTiers::ratio_to_string(point.ratio) << (fastest ? " **best**" : "") << " | "
+           << MemoryTiers::placement_to_string(point.ratio) << " | " << point.policy << " | ";
+        if(point.far_page_share >= 0.0)
+            ss << std::fixed << std::setprecision(1) << (point.far_page_share * 100.0);
+        else
+            ss << "-";
+        ss << " | " << point.num_threads << " | " << std::fixed << std::setprecision(2)
+           << point.stats.bandwidth_gbps << " | ";
+        if(local > 0.0)
+            ss << std::fixed << std::setprecision(2) << (point.stats.bandwidth_gbps / local) << "x";
+        else
+            ss << "-";
+        ss << " | " << std::fixed << std::setprecision(1) << point.stats.latency_ns << " |\n";
+    }
+    ss << "\n";
+
+    for(size_t index : best) {
+        const MemoryTiers::Point& point = points[index];
+        ss << "Fastest ratio for node " << point.far_node << ": " << MemoryTiers::ratio_to_string(point.ratio)
+           << " local:far (" << std::fixed << std::setprecision(0) << (MemoryTiers::far_share(point.ratio) * 100.0)
+           << "% far) at " << std::setprecision(2) << point.stats.bandwidth_gbps << " GB/s\n";
+    }
+    if(!best.empty())
+        ss << "\n";
+
+    return ss.str();
+}
+
+std::string OutputFormatter::format_markdown_gpu_bandwidth(const std::string& working_set_desc,
+                                                           const std::vector<GpuBandwidth::Point>& points) {
+    std::stringstream ss;
+    ss << "### GPU Unified Memory (" << working_set_desc << ")\n\n";
+    if(!points.empty())
+        ss << "GPU: " << points.front().device << ", " << points.front().cpu_threads << " CPU threads\n\n";
+    ss << "| Kernel | Array | GPU Alone (GB/s) | CPU Alone (GB/s) | GPU Shared (GB/s) | CPU Shared (GB/s) | "
+          "GPU Kept (%) | CPU Kept (%) | Combined (GB/s) | vs Solo Sum | Verified |\n";
+    ss << "|--------|-------|------------------|------------------|-------------------|-------------------|"
+          "--------------|--------------|-----------------|-------------|----------|\n";
+    for(const auto& point : points) {
+        double combined = point.gpu_shared_gbps + point.cpu_shared_gbps;
+        double solo_sum = point.gpu_alone_gbps + point.cpu_alone_gbps;
+        ss << "| " << GpuBandwidth::kernel_to_string(point.kernel) << " | "
+           << OutputFormatterUtils::format_byte_size(point.array_bytes) << " | " << std::fixed << std::setprecision(2) << point.gpu_alone_gbps << " | " << point.cpu_alone_gbps
+           << " | " << point.gpu_shared_gbps << " | " << point.cpu_shared_gbps << " | " << std::setprecision(1)
+           << GpuBandwidth::retained_percent(point.gpu_shared_gbps, point.gpu_alone_gbps) << " | "
+           << GpuBandwidth::retained_percent(point.cpu_shared_gbps, point.cpu_alone_gbps) << " | "
+           << std::setprecision(2) << combined << " | ";
+        if(solo_sum > 0.0)
+            ss << std::fixed << std::setprecision(2) << (combined / solo_sum) << "x";
+        else
+            ss << "-";
+        ss << " | " << (point.verified ? "yes" : "**no**") << " |\n";
+    }
+    ss << "\n";
+
+    return ss.str();
+}
+
+// JSON formatting methods
+std::string OutputFormatter::format_json_system_info(const SystemInfo& sys_info) {
+    std::stringstream ss;
+    ss << "{\n"
+       << "  \"system_info\": {\n"
+       << "    \"cpu_name\": \"" << sys_info.cpu_name << "\",\n"
+       << "    \"total_ram_gb\": " << sys_info.total_ram_gb << ",\n"
+       << "    \"available_ram_gb\": " << sys_info.available_ram_gb << ",\n"
+       << "    \"cpu_cores\": " << sys_info.cpu_cores << ",\n"
+       << "    \"cpu_threads\": " << sys_info.cpu_threads << ",\n"
+       << "    \"cache_line_size\": " << sys_info.cache_line_size << ",\n"
+       << "    \"memory_specs\": {\n"
+       << "      \"type\": \"" << sys_info.memory_specs.type << "\",\n"
+       << "      \"speed_mtps\": " << sys_info.memory_specs.speed_mtps << ",\n"
+       << "      \"data_width_bits\": " << sys_info.memory_specs.data_width_bits << ",\n"
+       << "      \"total_width_bits\": " << sys_info.memory_specs.total_width_bits << ",\n"
+       << "      \"num_channels\": " << sys_info.memory_specs.num_channels << ",\n"
+       << "      \"num_channels_detected\": " << (sys_info.memory_specs.num_channels_detected ? "true" : "false") << ",\n"
+       << "      \"speed_detected\": " << (sys_info.memory_specs.speed_detected ? "true" : "false") << ",\n"
+       << "      \"detection_source\": \"" << sys_info.memory_specs.detection_source << "\",\n"
+       << "      \"theoretical_bandwidth_gbps\": " << std::fixed << std::setprecision(1)
+       << sys_info.memory_specs.theoretical_bandwidth_gbps << ",\n"
+       << "      \"calibrated_bandwidth_gbps\": " << sys_info.memory_specs.calibrated_bandwidth_gbps << ",\n"
+       << "      \"calibrated_on\": \"" << sys_info.memory_specs.calibrated_on << "\"\n"
+       << "    },\n"
+       << "    \"cache_info\": {\n"
+       << "      \"l1_data_size\": " << sys_info.cache_info.l1_data_size << ",\n"
+       << "      \"l1_instruction_size\": " << sys_info.cache_info.l1_instruction_size << ",\n"
+       << "      \"l2_size\": " << sys_info.cache_info.l2_size << ",\n"
+       << "      \"l3_size\": " << sys_info.cache_info.l3_size << ",\n"
+       << "      \"l1_line_size\": " << sys_info.cache_info.l1_line_size << "\n"
+       << "    }\n"
+       << "  }\n"
+       << "}\n";
+
+    return ss.str();
+}
+
+std::string OutputFormatter::format_json_header() {
+    return "{\n  \"test_results\": [\n";
+}
+
+std::string OutputFormatter::format_json_test_result(const TestResult& result,
+                                                     const MemorySpecs& mem_specs) {
+    double efficiency =
+        calculate_efficiency(result.stats.bandwidth_gbps, mem_specs.theoretical_bandwidth_gbps);
+
+    std::stringstream ss;
+    ss << "    {\n"
+       << "      \"test_name\": \"" << result.test_name << "\",\n"
+       << "      \"working_set_desc\": \"" << result.working_set_desc << "\",\n"
+       << "      \"bandwidth_gbps\": " << std::fixed << std::setprecision(2)
+       << result.stats.bandwidth_gbps << ",\n"
+       << "      \"bandwidth_gb_s\": " << std::fixed << std::setprecision(2)
+       << (result.stats.bandwidth_gbps * 8.0) << ",\n"
+       << "      \"latency_ns\": " << std::fixed << std::setprecision(1) << result.stats.latency_ns
+       << ",\n"
+       << "      \"efficiency_percent\": " << std::fixed << std::setprecision(1) << efficiency
+       << ",\n"
+       << "      \"calibrated_efficiency_percent\": " << calibrated_efficiency_json(result, mem_specs) << ",\n"
+       << "      \"num_threads\": " << result.num_threads << ",\n"
+       << "      \"pattern_name\": \"" << result.pattern_name << "\",\n"
+       << "      \"kernel\": \"" << result.kernel_name << "\",\n"
+       << "      \"store_policy\": \"" << result.store_policy << "\""
+       << format_json_sample_stats(result, "      ") << format_json_gemm(result, "      ")
+       << format_json_calibration(result, "      ") << format_json_counters(result, "      ")
+       << format_json_page_faults(result, "      ") << format_json_access(result, "      ")
+       << format_json_decode(result, "      ") << format_json_proxy(result, "      ")
+       << format_json_irregular(result, "      ")
+       << format_json_energy(result, "      ")
+       << format_json_warnings(result, "      ") << "\n"
+       << "    }";
+
+    return ss.str();
+}
+
+std::string OutputFormatter::format_json_cache_aware_results(const std::string& pattern_name,
+                                                             const std::vector<TestResult>& results,
+                                                             const MemorySpecs& mem_specs) {
+    std::stringstream ss;
+    ss << "  {\n"
+       << "    \"pattern_name\": \"" << pattern_name << "\",\n"
+       << "    \"cache_aware\": true,\n"
+       << "    \"results\": [\n";
+
+    for(size_t i = 0; i < results.size(); ++i) {
+        double efficiency = calculate_efficiency(results[i].stats.bandwidth_gbps,
+                                                 mem_specs.theoretical_bandwidth_gbps);
+
+        ss << "      {\n"
+           << "        \"working_set_desc\": \"" << results[i].working_set_desc << "\",\n"
+           << "        \"kernel\": \"" << results[i].kernel_name << "\",\n"
+           << "        \"store_policy\": \"" << results[i].store_policy << "\",\n"
+           << "        \"bandwidth_gbps\": " << std::fixed << std::setprecision(2)
+           << results[i].stats.bandwidth_gbps << ",\n"
+           << "        \"bandwidth_gb_s\": " << std::fixed << std::setprecision(2)
+           << (results[i].stats.bandwidth_gbps * 8.0) << ",\n"
+           << "        \"latency_ns\": " << std::fixed << std::setprecision(1)
+           << results[i].stats.latency_ns << ",\n"
+           << "        \"efficiency_percent\": " << std::fixed << std::setprecision(1) << efficiency << ",\n"
+           << "        \"calibrated_efficiency_percent\": " << calibrated_efficiency_json(results[i], mem_specs)
+           << format_json_sample_stats(results[i], "        ") << format_json_gemm(results[i], "        ")
+           << format_json_calibration(results[i], "        ") << format_json_counters(results[i], "        ")
+           << format_json_page_faults(results[i], "        ") << format_json_access(results[i], "        ")
+           << format_json_decode(results[i], "        ") << format_json_proxy(results[i], "        ")
+           << format_json_irregular(results[i], "        ")
+           << format_json_energy(results[i], "        ")
+           << format_json_warnings(results[i], "        ")
+           << "\n"
+           << "      }";
+
+        if(i < results.size() - 1)
+            ss << ",";
+        ss << "\n";
+    }
+
+    ss << "    ]\n"
+       << "  }";
+
+    return ss.str();
+}
+
+std::string OutputFormatter::format_markdown_loaded_latency(const std::string& pattern_name,
+                                                            const std::string& working_set_desc,
+                                                            const std::vector<LoadedLatencyPoint>& points) {
+    double peak = peak_load_bandwidth(points);
+
+    std::stringstream ss;
+    ss << "### " << pattern_name << " Loaded Latency (" << working_set_desc << ")\n\n";
+    ss << "| Delay (spins) | Load Threads | Bandwidth (GB/s) | Utilization (%) | Latency (ns) | P99 Latency (ns) |\n";
+    ss << "|---------------|--------------|------------------|-----------------|--------------|------------------|\n";
+
+    for(const auto& point : points) {
+        if(point.load_threads == 0) {
+            ss << "| idle | 0 | - | - |";
+        } else {
+            ss << "| " << point.delay_spins << " | " << point.load_threads << " | " << std::fixed
+               << std::setprecision(2) << point.bandwidth_gbps << " | " << std::setprecision(1)
+               << load_utilization_percent(point, peak) << " |";
+        }
+        ss << " " << std::fixed << std::setprecision(1) << point.latency_ns << " | "
+           << point.latency_distribution.p99 << " |\n";
+    }
+    ss << "\n";
+
+    return ss.str();
+}
+
+std::string OutputFormatter::format_markdown_prefetch_sweep(const std::string& pattern_name,
+                                                            const std::string& working_set_desc,
+                                                            const std::vector<PrefetchPoint>& points) {
+    std::stringstream ss;
+    ss << "### " << pattern_name << " Prefetch Sweep (" << working_set_desc << ")\n\n";
+    ss << "| Software Prefetch | Hardware Prefetchers | Bandwidth (GB/s) | Latency (ns) | Delta vs Baseline (%) |\n";
+    ss << "|-------------------|----------------------|------------------|--------------|-----------------------|\n";
+
+    for(size_t i = 0; i < points.size(); ++i) {
+        const PrefetchPoint& point = points[i];
+        ss << "| " << PrefetchControl::distance_to_string(point.distance_bytes) << " | "
+           << hardware_prefetch_label(point) << " | " << std::fixed << std::setprecision(2) << point.bandwidth_gbps
+           << " | " << point.latency_ns << " | ";
+        if(i == 0) {
+            ss << "baseline";
+        } else {
+            ss << std::showpos << std::setprecision(1) << point.delta_percent << std::noshowpos;
+        }
+        ss << " |\n";
+    }
+    if(!points.empty()) {
+        const PrefetchPoint& best = points[best_prefetch_point(points)];
+        ss << "\nBest: software prefetch " << PrefetchControl::distance_to_string(best.distance_bytes)
+           << ", hardware prefetchers " << hardware_prefetch_label(best) << " (" << std::fixed << std::showpos
+           << std::setprecision(1) << best.delta_percent << std::noshowpos << "% vs baseline)\n";
+    }
+    ss << "\n";
+
+    return ss.str();
+}
+
+std::string OutputFormatter::format_markdown_thread_scaling(
+    const std::string& pattern_name, const std::string& working_set_desc, const std::string& placement,
+    const std::vector<ThreadScaling::ScalingPoint>& points) {
+    std::stringstream ss;
+    bool energy = has_energy(points);
+    ss << "### " << pattern_name << " Thread Scaling (" << working_set_desc << ", " << placement << " placement)\n\n";
+    ss << "| Threads | Bandwidth (GB/s) | Latency (ns) | Speedup | Per Thread (GB/s) | Efficiency (%) |";
+    if(energy) ss << " Package (W) | DRAM (W) | pJ/byte |";
+    ss << "\n|---------|------------------|--------------|---------|-------------------|----------------|";
+    if(energy) ss << "-------------|----------|---------|";
+    ss << "\n";
+
+    for(const auto& point : points) {
+        double per_thread = point.threads > 0 ? point.bandwidth_gbps / static_cast<double>(point.threads) : 0.0;
+        ss << "| " << point.threads << " | " << std::fixed << std::setprecision(2) << point.bandwidth_gbps << " | "
+           << point.latency_ns << " | " << point.speedup << "x | " << per_thread << " | " << std::setprecision(1)
+           << point.efficiency * 100.0 << " |";
+        if(energy && point.energy_measured) {
+            ss << " " << point.package_watts << " | " << point.dram_watts << " | " << point.pj_per_byte << " |";
+        } else if(energy) {
+            ss << " - | - | - |";
+        }
+        ss << "\n";
+    }
+    size_t saturation = ThreadScaling::saturation_index(points);
+    if(saturation < points.size()) {
+        double peak = 0.0;
+        for(const auto& point : points) {
+            peak = std::max(peak, point.bandwidth_gbps);
+        }
+        ss << "\nSaturates at " << points[saturation].threads << " threads: " << std::fixed << std::setprecision(2)
+           << points[saturation].bandwidth_gbps << " GB/s, within " << std::setprecision(0)
+           << (1.0 - ThreadScaling::SATURATION_FRACTION) * 100.0 << "% of the " << std::setprecision(2) << peak
+           << " GB/s peak\n";
+    }
+    size_t optimal = ThreadScaling::energy_optimal_index(points);
+    if(optimal < points.size()) {
+        ss << "Least energy per byte at " << points[optimal].threads << " threads: " << std::fixed
+           << std::setprecision(1) << points[optimal].pj_per_byte << " pJ/byte at " << std::setprecision(2)
+           << points[optimal].bandwidth_gbps << " GB/s\n";
+    }
+    ss << "\n";
+
+    return ss.str();
+}
+
+std::string OutputFormatter::format_markdown_contention(
+    const std::string& victim_name, const std::string& aggressor, const std::string& working_set_desc,
+    const std::vector<Contention::ContentionPoint>& points) {
+    std::stringstream ss;
+    ss << "### " << victim_name << " under " << aggressor << " Contention (" << working_set_desc << ")\n\n";
+    ss << "| Aggressor Threads | Delay (spins) | Aggressor (GB/s) | Victim (GB/s) | Victim Latency (ns) | Slowdown |\n";
+    ss << "|-------------------|---------------|------------------|---------------|---------------------|----------|\n";
+
+    const Contention::ContentionPoint* worst = nullptr;
+    for(const auto& point : points) {
+        ss << "| " << point.aggressor_threads << " | "
+           << (point.aggressor_threads == 0 ? std::string("alone") : std::to_string(point.delay_spins)) << " | "
+           << std::fixed << std::setprecision(2) << point.aggressor_gbps << " | " << point.victim_gbps << " | "
+           << point.victim_latency_ns << " | " << point.slowdown << "x |\n";
+        if(point.aggressor_threads > 0 && (worst == nullptr || point.slowdown > worst->slowdown)) {
+            worst = &point;
+        }
+    }
+    if(worst != nullptr) {
+        ss << "\nWorst slowdown " << std::fixed << std::setprecision(2) << worst->slowdown << "x at "
+           << worst->aggressor_gbps << " GB/s of aggressor traffic\n";
+    }
+    ss << "\n";
+
+    return ss.str();
+}
+
+std::string OutputFormatter::format_markdown_soak(const std::string& pattern_name,
+                                                  const std::string& working_set_desc, const Soak::Summary& summary,
+                                                  const std::vector<Soak::Sample>& samples) {
+    bool has_frequency = summary.first_mhz > 0.0;
+    bool has_cpu_temperature = summary.max_cpu_temperature_c > 0.0;
+    bool has_dimm_temperature = summary.max_dimm_temperature_c > 0.0;
+
+    std::stringstream ss;
+    ss << "### " << pattern_name << " Soak (" << working_set_desc << ", "
+       << Soak::duration_to_string(std::round(summary.duration_seconds * 10.0) / 10.0) << ", " << summary.samples
+       << " samples)\n\n";
+    ss << std::fixed << std::setprecision(2) << "Bandwidth: mean " << summary.mean_gbps << " GB/s, min "
+       << summary.min_gbps << ", max " << summary.max_gbps << "; first window " << summary.first_gbps
+       << " GB/s, last window " << summary.last_gbps << " GB/s (" << format_change_percent(summary.decay_percent)
+       << ")\n";
+    if(has_frequency) {
+        ss << "Frequency: " << std::setprecision(0) << summary.first_mhz << " MHz to " << summary.last_mhz
+           << " MHz (" << format_change_percent(summary.frequency_drop_percent) << ")\n";
+    }
+    if(has_cpu_temperature || has_dimm_temperature) {
+        ss << "Peak temperature:" << std::setprecision(1);
+        if(has_cpu_temperature) ss << " CPU " << summary.max_cpu_temperature_c << " C";
+        if(has_dimm_temperature) ss << (has_cpu_temperature ? "," : "") << " DIMM " << summary.max_dimm_temperature_c << " C";
+        ss << "\n";
+    }
+    if(summary.throttled) {
+        ss << "\n**Throttling detected**: bandwidth or frequency dropped by "
+           << std::setprecision(0) << BenchmarkConstants::SOAK_THROTTLE_PERCENT << "% or more over the run\n";
+    }
+
+    ss << "\n| Elapsed | Bandwidth (GB/s) |";
+    if(has_frequency) ss << " Frequency (MHz) |";
+    if(has_cpu_temperature) ss << " CPU (C) |";
+    if(has_dimm_temperature) ss << " DIMM (C) |";
+    ss << "\n|---------|------------------|";
+    if(has_frequency) ss << "-----------------|";
+    if(has_cpu_temperature) ss << "---------|";
+    if(has_dimm_temperature) ss << "----------|";
+    ss << "\n";
+    for(const auto& row : Soak::downsample(samples, BenchmarkConstants::SOAK_TABLE_ROWS)) {
+        ss << "| " << Soak::duration_to_string(std::round(row.elapsed_seconds * 10.0) / 10.0) << " | "
+           << std::setprecision(2) << row.bandwidth_gbps << " |";
+        if(has_frequency) ss << " " << std::setprecision(0) << row.frequency_mhz << " |";
+        if(has_cpu_temperature) ss << " " << std::setprecision(1) << row.cpu_temperature_c << " |";
+        if(has_dimm_temperature) ss << " " << std::setprecision(1) << row.dimm_temperature_c << " |";
+        ss << "\n";
+    }
+    ss << "\n";
+
+    return ss.str();
+}
+
+std::string OutputFormatter::format_markdown_baseline_comparison(
+    const std::string& baseline_desc, const std::vector<std::string>& host_changes,
+    const std::vector<Baseline::Comparison>& comparisons) {
+    std::stringstream ss;
+    ss << "### Baseline Comparison (" << baseline_desc << ")\n\n";
+    if(!host_changes.empty()) {
+        ss << "Host changes since the baseline:\n";
+        for(const auto& change : host_changes) {
+            ss << "- " << change << "\n";
+        }
+        ss << "\n";
+    }
+    ss << "| Test | Working Set | Kernel | Threads | Baseline (GB/s) | Current (GB/s) | Change | p-value | Verdict |\n";
+    ss << "|------|-------------|--------|---------|-----------------|----------------|--------|---------|---------|\n";
+
+    for(const auto& comparison : comparisons) {
+        const Baseline::Entry& entry = comparison.current;
+        ss << "| " << entry.test_name << " | " << entry.working_set << " | " << entry.kernel << " | "
+           << entry.threads << " | ";
+        if(comparison.verdict == Baseline::Verdict::NEW) {
+            ss << "- | " << std::fixed << std::setprecision(2) << comparison.current_gbps << " | - | - | ";
+        } else {
+            ss << std::fixed << std::setprecision(2) << comparison.baseline_gbps << " | " << comparison.current_gbps
+               << " | " << format_change_percent(-comparison.change_percent) << " | ";
+            if(comparison.tested) {
+                ss << std::setprecision(4) << comparison.p_value << " | ";
+            } else {
+                ss << "- | ";
+            }
+        }
+        ss << (comparison.verdict == Baseline::Verdict::REGRESSED ? "**regressed**"
+                                                                   : Baseline::verdict_to_string(comparison.verdict))
+           << " |\n";
+    }
+
+    size_t regressions = Baseline::count(comparisons, Baseline::Verdict::REGRESSED);
+    size_t inconclusive = Baseline::count(comparisons, Baseline::Verdict::INCONCLUSIVE);
+    ss << "\n";
+    if(regressions > 0) {
+        ss << "**" << regressions << " significant regression" << (regressions == 1 ? "" : "s") << "**";
+    } else {
+        ss << "No significant regressions";
+    }
+    ss << " (median drop of " << std::setprecision(0) << BenchmarkConstants::BASELINE_REGRESSION_PERCENT
+       << "% or more at p < " << std::setprecision(2) << BenchmarkConstants::BASELINE_SIGNIFICANCE << ")\n\n";
+    if(inconclusive > 0) {
+        ss << inconclusive << " inconclusive: changed by " << std::setprecision(0)
+           << BenchmarkConstants::BASELINE_REGRESSION_PERCENT << "% or more with fewer than "
+           << BenchmarkConstants::BASELINE_MIN_SAMPLES << " samples on a side to test; rerun with more iterations\n\n";
+    }
+
+    return ss.str();
+}
+
+std::string OutputFormatter::format_markdown_fleet_report(const Fleet::Report& report) {
+    std::stringstream ss;
+    ss << "### Fleet Report (" << report.fleet_id << ")\n\n";
+    ss << "| Agent | Host | SKU | Records | Clock Offset (ms) | Status |\n";
+    ss << "|-------|------|-----|---------|-------------------|--------|\n";
+    for(const auto& host : report.hosts) {
+        ss << "| " << host.endpoint << " | " << (host.hostname.empty() ? "-" : host.hostname) << " | "
+           << (host.sku.empty() ? "-" : host.sku) << " | " << host.records << " | " << format_clock_offset(host)
+           << " | " << fleet_host_status(host) << " |\n";
+    }
+
+    ss << "\n| SKU | Test | Hosts | Min | p10 | Median | p90 | Max | Unit |\n";
+    ss << "|-----|------|-------|-----|-----|--------|-----|-----|------|\n";
+    for(const auto& summary : report.summaries) {
+        ss << "| " << summary.sku << " | " << summary.test << " | " << summary.hosts << " | " << std::fixed
+           << std::setprecision(2) << summary.min << " | " << summary.p10 << " | " << summary.median << " | "
+           << summary.p90 << " | " << summary.max << " | " << fleet_metric_unit(summary.metric) << " |\n";
+    }
+    ss << "\n";
+
+    if(report.outliers.empty()) {
+        ss << "No outlier hosts";
+    } else {
+        ss << "| Outlier Host | SKU | Test | Value | SKU Median | Deviation | Robust z |\n";
+        ss << "|--------------|-----|------|-------|------------|-----------|----------|\n";
+        for(const auto& outlier : report.outliers) {
+            ss << "| **" << outlier.hostname << "** | " << outlier.sku << " | " << outlier.test << " | " << std::fixed
+               << std::setprecision(2) << outlier.value << " " << fleet_metric_unit(outlier.metric) << " | "
+               << outlier.median << " | " << format_change_percent(-outlier.deviation_percent) << " | "
+               << std::setprecision(1) << outlier.robust_z << " |\n";
+        }
+        ss << "\n**" << report.outliers.size() << " outlier result" << (report.outliers.size() == 1 ? "" : "s")
+           << "**";
+    }
+    ss << " (" << std::setprecision(1) << BenchmarkConstants::FLEET_OUTLIER_MADS << " scaled MADs and "
+       << std::setprecision(0) << BenchmarkConstants::FLEET_OUTLIER_MIN_PERCENT
+       << "% from the SKU median, with at least " << BenchmarkConstants::FLEET_OUTLIER_MIN_HOSTS
+       << " hosts per SKU)\n\n";
+
+    return ss.str();
+}
+
+std::string OutputFormatter::format_markdown_peak_calibration(const PeakCalibration::HostPeak& peak,
+                                                              const MemorySpecs& mem_specs) {
+    double theoretical = mem_specs.theoretical_bandwidth_gbps;
+    std::stringstream ss;
+    ss << "### Calibrated Peak (" << peak.working_set << ", recorded " << peak.recorded << ")\n\n";
+    ss << "| Family | Test | Kernel | Stores | Best Threads | Bandwidth (GB/s) | Of Theoretical (%) |\n";
+    ss << "|--------|------|--------|--------|--------------|------------------|--------------------|\n";
+
+    for(const auto& ceiling : peak.ceilings) {
+        ss << "| " << ceiling.family << " | " << ceiling.test_name << " | " << ceiling.kernel << " | "
+           << ceiling.store_policy << " | " << ceiling.threads << " | " << std::fixed << std::setprecision(2)
+           << ceiling.bandwidth_gbps << " | "
+           << OutputFormatterUtils::format_efficiency_display(calculate_efficiency(ceiling.bandwidth_gbps,
+                                                                                   theoretical),
+                                                              theoretical)
+           << " |\n";
+    }
+
+    ss << "\nCalibrated peak: **" << std::fixed << std::setprecision(2) << peak.peak_gbps() << " GB/s**";
+    if(theoretical > 0) {
+        ss << ", " << std::setprecision(1) << calculate_efficiency(peak.peak_gbps(), theoretical)
+           << "% of the theoretical " << theoretical << " GB/s";
+    }
+    ss << "\n\n";
+
+    return ss.str();
+}
+
+std::string OutputFormatter::format_markdown_tuning(const PeakCalibration::HostPeak& peak) {
+    std::stringstream ss;
+    ss << "### Tuned Kernel Shapes (recorded " << peak.tuned << ")\n\n";
+    ss << "| Family | Level | Threads | Shape | Bandwidth (GB/s) | Auto Kernel (GB/s) | Gain (%) |\n";
+    ss << "|--------|-------|---------|-------|------------------|--------------------|----------|\n";
+
+    for(const auto& shape : peak.shapes) {
+        ss << "| " << shape.family << " | " << shape.level << " | " << shape.threads << " | " << shape.shape
+           << " | " << std::fixed << std::setprecision(2) << shape.bandwidth_gbps << " | " << shape.baseline_gbps
+           << " | " << std::setprecision(1) << tuning_gain_percent(shape) << " |\n";
+    }
+
+    ss << "\nShape w<bytes>u<unroll>a<accumulators>: element width, elements per loop iteration and independent "
+       << "sums. Runs with the automatic kernel, temporal stores and no software prefetch use these shapes; "
+       << "levels without a row keep the kernel's own loop.\n\n";
+
+    return ss.str();
+}
+
+std::string OutputFormatter::format_markdown_core_to_core(const std::vector<size_t>& cpus,
+                                                          const std::vector<CoherenceTests::PingPongResult>& matrix) {
+    std::stringstream ss;
+    ss << "### Core-to-Core Transfer Latency\n\n";
+    ss << "One-way latency (ns) of a cache line bounced between two pinned threads. "
+       << "Rows: initiating CPU, columns: responding CPU\n\n";
+
+    std::vector<std::string> columns = {"ns"};
+    for(size_t cpu : cpus)
+        columns.push_back("CPU " + std::to_string(cpu));
+    for(const auto& column : columns)
+        ss << "| " << column << " ";
+    ss << "|\n" << markdown_rule(columns);
+
+    for(size_t row = 0; row < cpus.size(); ++row) {
+        ss << "| CPU " << cpus[row] << " |";
+        for(size_t col = 0; col < cpus.size(); ++col) {
+            size_t index = row * cpus.size() + col;
+            if(row == col || index >= matrix.size() || matrix[index].round_trips == 0) {
+                ss << " - |";
+            } else {
+                ss << " " << std::fixed << std::setprecision(1) << matrix[index].one_way_ns << " |";
+            }
+        }
+        ss << "\n";
+    }
+
+    CoherenceTests::MatrixSummary summary = CoherenceTests::summarize(matrix);
+    if(summary.pairs > 0) {
+        ss << "\nFastest: CPU " << summary.fastest.cpu_a << " -> CPU " << summary.fastest.cpu_b << " "
+           << std::fixed << std::setprecision(1) << summary.fastest.one_way_ns << " ns, median " << summary.median_ns
+           << " ns, slowest: CPU " << summary.slowest.cpu_a << " -> CPU " << summary.slowest.cpu_b << " "
+           << summary.slowest.one_way_ns << " ns";
+        if(summary.fastest.one_way_ns > 0.0) {
+            ss << " (" << std::setprecision(1) << (summary.slowest.one_way_ns / summary.fastest.one_way_ns)
+               << "x the fastest)";
+        }
+        ss << "\n";
+    }
+    ss << "\n";
+
+    return ss.str();
+}
+
+std::string OutputFormatter::format_markdown_false_sharing(
+    const std::vector<CoherenceTests::FalseSharingResult>& results) {
+    std::stringstream ss;
+    ss << "### False Sharing\n\n";
+    ss << "Each thread increments its own counter: all counters on one cache line (packed) or each on its own "
+       << "(padded)\n\n";
+    ss << "| Counters | Threads | ns per Increment | Total (M increments/s) | Slowdown vs Padded | Verified |\n";
+    ss << "|----------|---------|------------------|------------------------|--------------------|----------|\n";
+
+    for(const auto& result : results) {
+        double slowdown = false_sharing_slowdown(results, result);
+        ss << "| " << CoherenceTests::layout_to_string(result.layout) << " | " << result.num_threads << " | "
+           << std::fixed << std::setprecision(2) << result.ns_per_increment << " | " << std::setprecision(1)
+           << result.total_mops << " | ";
+        if(slowdown > 0.0) {
+            ss << std::setprecision(2) << slowdown << "x";
+        } else {
+            ss << "-";
+        }
+        ss << " | " << (result.verified ? "yes" : "NO") << " |\n";
+    }
+    ss << "\n";
+
+    return ss.str();
+}
+
+std::string OutputFormatter::format_markdown_atomics(const std::string& std_atomics,
+                                                     const std::vector<AtomicTests::Result>& results) {
+    std::stringstream ss;
+    ss << "### Atomic Throughput\n\n";
+    ss << "std::atomic compiled as: " << std_atomics << "\n\n";
+    ss << "| Operation | Ordering | Line | Implementation | Threads | Total (Mops/s) | ns/op per Thread | "
+       << "Scaling vs 1 Thread | Verified |\n";
+    ss << "|-----------|----------|------|----------------|---------|----------------|------------------|"
+          "---------------------|----------|\n";
+
+    for(const auto& result : results) {
+        ss << "| " << AtomicTests::operation_to_string(result.config.op) << " | "
+           << AtomicTests::ordering_to_string(result.config.ordering) << " | "
+           << AtomicTests::sharing_to_string(result.config.sharing) << " | "
+           << AtomicTests::implementation_to_string(result.config.impl) << " | " << result.num_threads << " | "
+           << std::fixed << std::setprecision(1) << result.total_mops << " | " << std::setprecision(2)
+           << result.ns_per_op << " | " << atomic_scaling(results, result) << "x | "
+           << (result.verified ? "yes" : "NO") << " |\n";
+    }
+    ss << "\n";
+
+    return ss.str();
+}
+
+std::string OutputFormatter::format_markdown_allocator_results(const std::vector<AllocatorBench::Result>& results) {
+    using OutputFormatterUtils::format_byte_size;
+    std::stringstream ss;
+    ss << "### Allocator Benchmark\n\n";
+    ss << "| Workload | Allocator | Threads | Pairs | Total (Mops/s) | ns/Pair per Thread | Live Set | RSS Growth | "
+       << "Note |\n";
+    ss << "|----------|-----------|---------|-------|----------------|--------------------|----------|------------|"
+          "------|\n";
+
+    for(const auto& result : results) {
+        ss << "| " << AllocatorBench::workload_to_string(result.workload) << " | " << result.allocator << " | "
+           << result.num_threads << " | ";
+        if(result.available) {
+            std::string growth = format_byte_size(static_cast<size_t>(std::llabs(result.rss_growth_bytes)));
+            ss << result.ops << " | " << std::fixed << std::setprecision(1) << result.total_mops << " | "
+               << std::setprecision(2) << result.ns_per_op << " | " << format_byte_size(result.live_bytes) << " | "
+               << (result.rss_growth_bytes < 0 ? "-" : "") << growth << " | |\n";
+        } else {
+            ss << "- | - | - | - | - | " << result.note << " |\n";
+        }
+    }
+    ss << "\n";
+
+    return ss.str();
+}
+
+std::string OutputFormatter::format_markdown_roofline(const std::string& working_set_desc,
+                                                     const Roofline& roofline) {
+    std::stringstream ss;
+    ss << "### Roofline (" << working_set_desc << ")\n\n";
+    ss << "| Ceiling | Type | Value | Ridge (FLOP/byte) |\n";
+    ss << "|---------|------|-------|-------------------|\n";
+    for(const auto& ceiling : roofline.ceilings) {
+        bool memory = ceiling.kind == "memory";
+        ss << "| " << ceiling.name << " | " << ceiling.kind << " | " << std::fixed << std::setprecision(2)
+           << ceiling.value << (memory ? " GB/s" : " GFLOP/s") << " | ";
+        if(memory) {
+            ss << std::setprecision(3) << ceiling.ridge_intensity;
+        } else {
+            ss << "-";
+        }
+        ss << " |\n";
+    }
+
+    ss << "\n| Level | Working Set (KB) | Intensity (FLOP/byte) | GFLOP/s | Bandwidth (GB/s) |\n";
+    ss << "|-------|------------------|-----------------------|---------|------------------|\n";
+    for(const auto& point : roofline.points) {
+        ss << "| " << point.level << " | " << (point.working_set_bytes / 1024) << " | " << std::fixed << std::setprecision(4) << point.arithmetic_intensity << " | "
+           << std::setprecision(2) << point.gflops << " | " << point.bandwidth_gbps << " |\n";
+    }
+    ss << "\n";
+
+    return ss.str();
+}
+
+std::string OutputFormatter::format_markdown_working_set_sweep(const WorkingSetSweep& sweep) {
+    using OutputFormatterUtils::format_byte_size;
+    auto size_or_dash = [](size_t bytes) { return bytes > 0 ? format_byte_size(bytes) : std::string("-"); };
+
+    std::stringstream ss;
+    ss << "### Working-Set Sweep (log2:" << sweep.steps_per_octave << ")\n\n";
+    ss << "| Working Set | Bandwidth (GB/s) | Latency (ns) |\n";
+    ss << "|-------------|------------------|--------------|\n";
+    for(const auto& point : sweep.points) {
+        ss << "| " << format_byte_size(point.working_set_bytes) << " | " << std::fixed << std::setprecision(2)
+           << point.bandwidth_gbps << " | " << std::setprecision(1) << point.latency_ns << " |\n";
+    }
+
+    ss << "\n#### Effective Cache Capacity\n\n";
+    ss << "| Level | Reported | Bandwidth Knee | Latency Knee |\n";
+    ss << "|-------|----------|----------------|--------------|\n";
+    for(const auto& capacity : sweep.capacities) {
+        ss << "| " << capacity.level << " | " << size_or_dash(capacity.reported_bytes) << " | "
+           << size_or_dash(capacity.bandwidth_bytes) << " | " << size_or_dash(capacity.latency_bytes) << " |\n";
+    }
+    ss << "\n";
+
+    return ss.str();
+}
+
+std::string OutputFormatter::format_markdown_io_results(size_t file_size, double clock_ghz,
+                                                        const std::vector<IoTests::Result>& results) {
+    using OutputFormatterUtils::format_byte_size;
+    std::stringstream ss;
+    ss << "### I/O Paths (" << format_byte_size(file_size) << " file, core clock ~" << std::fixed
+       << std::setprecision(2) << clock_ghz << " GHz)\n\n";
+    ss << "| Method | Block | Queue Depth | Bandwidth (GB/s) | Latency/Block (us) | Cycles/Byte | Note |\n";
+    ss << "|--------|-------|-------------|------------------|--------------------|-------------|------|\n";
+    for(const auto& result : results) {
+        std::string block = result.block_size > 0 ? format_byte_size(result.block_size) : std::string("-");
+        ss << "| " << IoTests::method_to_string(result.method) << " | " << block << " | " << result.queue_depth
+           << " | ";
+        if(result.available) {
+            ss << std::fixed << std::setprecision(2) << result.stats.bandwidth_gbps << " | " << std::setprecision(1)
+               << result.stats.latency_ns / 1000.0 << " | " << std::setprecision(3) << result.cycles_per_byte;
+        } else {
+            ss << "- | - | -";
+        }
+        ss << " | " << (result.note.empty() ? "-" : result.note) << " |\n";
+    }
+    ss << "\n";
+
+    return ss.str();
+}
+
+std::string OutputFormatter::format_markdown_mapping_results(const std::vector<MappingTests::Result>& results) {
+    using OutputFormatterUtils::format_byte_size;
+    std::stringstream ss;
+    ss << "### Mapping Costs (" << format_byte_size(MappingTests::page_bytes()) << " pages)\n\n";
+    ss << "| Operation | Threads | Mapping | Time (ms) | ns/Page | Mpages/s | us/Call | Minor Faults | Note |\n";
+    ss << "|-----------|---------|---------|-----------|---------|----------|---------|--------------|------|\n";
+    for(const auto& result : results) {
+        ss << "| " << MappingTests::operation_to_string(result.op) << " | " << result.num_threads << " | "
+           << format_byte_size(result.bytes) << " | ";
+        if(result.available) {
+            ss << std::fixed << std::setprecision(2) << result.seconds * 1e3 << " | " << std::setprecision(1)
+               << result.ns_per_page << " | " << std::setprecision(2) << result.pages_per_second / 1e6 << " | ";
+            if(result.calls > 0) {
+                ss << std::setprecision(1) << result.us_per_call;
+            } else {
+                ss << "-";
+            }
+            ss << " | " << result.minor_faults << " | |\n";
+        } else {
+            ss << "- | - | - | - | - | " << result.note << " |\n";
+        }
+    }
+    ss << "\n";
+
+    return ss.str();
+}
+
+std::string OutputFormatter::format_markdown_tlb_results(const std::vector<TlbSweep::Curve>& curves) {
+    using OutputFormatterUtils::format_byte_size;
+    std::stringstream ss;
+    for(const auto& curve : curves) {
+        ss << "### TLB Reach (" << format_byte_size(curve.page_bytes) << " pages, "
+           << PageAllocator::page_mode_to_string(curve.mode) << ")\n\n";
+        if(!curve.available) {
+            ss << "Unavailable: " << curve.note << "\n\n";
+            continue;
+        }
+        ss << "Backing: " << curve.backing << "; baseline: "
+           << (curve.baseline_backing.empty() ? "none" : curve.baseline_backing) << "\n";
+        if(!curve.note.empty()) {
+            ss << "Note: " << curve.note << "\n";
+        }
+        ss << "\n| Pages | Span | Latency (ns) | Baseline (ns) | Page Walk (ns) |\n";
+        ss << "|-------|------|--------------|---------------|----------------|\n";
+        for(const auto& point : curve.points) {
+            ss << "| " << point.pages << " | " << format_byte_size(point.span_bytes) << " | " << std::fixed
+               << std::setprecision(2) << point.latency_ns << " | ";
+            if(point.baseline_ns > 0.0) {
+                ss << point.baseline_ns << " | " << point.walk_ns << " |\n";
+            } else {
+                ss << "- | - |\n";
+            }
+        }
+
+        ss << "\n| Level | Entries | Reach | Latency Before (ns) | Latency After (ns) |\n";
+        ss << "|-------|---------|-------|---------------------|--------------------|\n";
+        for(const auto& level : curve.levels) {
+            ss << "| " << level.name << " | " << level.entries << " | " << format_byte_size(level.reach_bytes)
+               << " | " << std::fixed << std::setprecision(2) << level.before_ns << " | " << level.after_ns
+               << " |\n";
+        }
+        if(curve.levels.empty()) {
+            ss << "| none detected | - | - | - | - |\n";
+        }
+        if(!curve.baseline_backing.empty()) {
+            ss << "\nPage walk at " << curve.points.back().pages << " pages: " << std::fixed << std::setprecision(2)
+               << curve.page_walk_ns << " ns\n";
+        }
+        ss << "\n";
+    }
+
+    return ss.str();
+}
+
+std::string OutputFormatter::format_markdown_copy_sweep(const std::vector<CopySweep::Point>& points) {
+    using OutputFormatterUtils::format_byte_size;
+    std::stringstream ss;
+    ss << "### Copy Size Classes\n\n";
+    ss << "One call repeated on warm buffers; GB/s counts the bytes written. A range ends where another "
+       << "implementation is faster by " << std::fixed << std::setprecision(0)
+       << BenchmarkConstants::MEMCPY_CROSSOVER_MARGIN * 100 << "% or more; (NO) marks a call whose result did "
+       << "not verify\n\n";
+
+    ss << "| Operation | Alignment | Sizes | Fastest | Peak (GB/s) |\n";
+    ss << "|-----------|-----------|-------|---------|-------------|\n";
+    for(const auto& crossover : CopySweep::crossovers(points)) {
+        ss << "| " << CopySweep::operation_to_string(crossover.operation) << " | "
+           << CopySweep::alignment_to_string(crossover.alignment) << " | " << format_byte_size(crossover.from_bytes)
+           << " - " << format_byte_size(crossover.to_bytes) << " | " << crossover.implementation << " | "
+           << std::setprecision(2) << crossover.peak_gbps << " |\n";
+    }
+
+    // One table per operation and alignment: sizes down, implementations across
+    size_t begin = 0;
+    while(begin < points.size()) {
+        const CopySweep::Point& first = points[begin];
+        size_t end = begin;
+        std::vector<std::string> implementations;
+        std::vector<size_t> sizes;
+        while(end < points.size() && points[end].operation == first.operation &&
+              points[end].alignment.source_offset == first.alignment.source_offset &&
+              points[end].alignment.destination_offset == first.alignment.destination_offset) {
+            if(std::find(implementations.begin(), implementations.end(), points[end].implementation) ==
+               implementations.end()) {
+                implementations.push_back(points[end].implementation);
+            }
+            if(std::find(sizes.begin(), sizes.end(), points[end].bytes) == sizes.end()) {
+                sizes.push_back(points[end].bytes);
+            }
+            ++end;
+        }
+        std::sort(sizes.begin(), sizes.end());
+
+        ss << "\n#### " << CopySweep::operation_to_string(first.operation) << ", "
+           << CopySweep::alignment_to_string(first.alignment) << " (GB/s)\n\n";
+        std::vector<std::string> columns = {"Size"};
+        columns.insert(columns.end(), implementations.begin(), implementations.end());
+        for(const auto& column : columns) {
+            ss << "| " << column << " ";
+        }
+        ss << "|\n" << markdown_rule(columns);
+        for(size_t bytes : sizes) {
+            ss << "| " << format_byte_size(bytes) << " |";
+            for(const auto& implementation : implementations) {
+                auto match = std::find_if(points.begin() + begin, points.begin() + end,
+                                          [&](const CopySweep::Point& point) {
+                                              return point.bytes == bytes && point.implementation == implementation;
+                                          });
+                if(match == points.begin() + end) {
+                    ss << " - |";
+                } else {
+                    ss << " " << std::setprecision(2) << match->bandwidth_gbps << (match->verified ? "" : " (NO)") << " |";
+                }
+            }
+            ss << "\n";
+        }
+        begin = end;
+    }
+    ss << "\n";
+
+    return ss.str();
+}
+
+std::string OutputFormatter::format_markdown_ring_results(const std::vector<RingTransfer::Result>& results) {
+    using OutputFormatterUtils::format_byte_size;
+    std::stringstream ss;
+    ss << "### Ring Transfers\n\n";
+    ss << "Messages streamed from the lower-numbered CPU of each pair to the other through one ring; handoff is "
+       << "the one-way latency of a single message returned through a second ring\n\n";
+
+    ss << "| Ring | Payload | Shared | Pairs | Median (GB/s) | Median Handoff (ns) |\n";
+    ss << "|------|---------|--------|-------|---------------|---------------------|\n";
+    for(const auto& summary : RingTransfer::summarize(results)) {
+        ss << "| " << RingTransfer::kind_to_string(summary.kind) << " | " << format_byte_size(summary.payload_bytes)
+           << " | " << RingTransfer::relation_to_string(summary.relation) << " | " << summary.pairs << " | "
+           << std::fixed << std::setprecision(2) << summary.median_gbps << " | " << std::setprecision(1)
+           << summary.median_handoff_ns << " |\n";
+    }
+
+    ss << "\n| Ring | Payload | Producer | Consumer | Shared | Slots | Bandwidth (GB/s) | Mmsg/s | Handoff (ns) | "
+          "Verified |\n";
+    ss << "|------|---------|----------|----------|--------|-------|------------------|--------|--------------|"
+          "----------|\n";
+    for(const auto& result : results) {
+        ss << "| " << RingTransfer::kind_to_string(result.kind) << " | " << format_byte_size(result.payload_bytes)
+           << " | CPU " << result.producer_cpu << " | CPU " << result.consumer_cpu << " | "
+           << RingTransfer::relation_to_string(result.relation) << " | " << result.slots << " | " << std::fixed
+           << std::setprecision(2) << result.bandwidth_gbps << " | " << result.messages_per_second / 1e6 << " | "
+           << std::setprecision(1) << result.handoff_ns << " | " << (result.verified ? "yes" : "NO") << " |\n";
+    }
+    ss << "\n";
+
+    return ss.str();
+}
+
+std::string OutputFormatter::format_markdown_trace_replay(const std::string& path,
+                                                          const TraceReplay::Summary& summary,
+                                                          const TraceReplay::ReplayResult& result) {
+    using OutputFormatterUtils::format_byte_size;
+    std::stringstream ss;
+    ss << "### Trace Replay (" << path << ", " << summary.records << " records over "
+       << format_byte_size(summary.span_bytes) << ")\n\n";
+    ss << "| Reads | Writes | Bytes/Pass | Threads | Passes | Bandwidth (GB/s) | Maccesses/s | ns/Access | "
+          "Decode (ns/record) | Decode Share |\n";
+    ss << "|-------|--------|------------|---------|--------|------------------|-------------|-----------|"
+          "--------------------|--------------|\n";
+    ss << "| " << summary.reads << " | " << summary.writes << " | " << format_byte_size(summary.bytes()) << " | "
+       << result.threads << " | " << result.passes << " | " << std::fixed << std::setprecision(2)
+       << result.stats.bandwidth_gbps << " | " << result.accesses_per_second / 1e6 << " | "
+       << result.replay_ns_per_record << " | " << result.decode_ns_per_record << " | " << std::setprecision(1)
+       << result.decode_percent << "% |\n\n";
+
+    return ss.str();
+}
+
+std::string OutputFormatter::format_json_numa_matrix(const std::string& pattern_name,
+                                                     const std::string& working_set_desc,
+                                                     const std::vector<NumaMatrixEntry>& entries) {
+    std::stringstream ss;
+    ss << "  {\n"
+       << "    \"pattern_name\": \"" << pattern_name << "\",\n"
+       << "    \"numa_matrix\": true,\n"
+       << "    \"working_set_desc\": \"" << working_set_desc << "\",\n"
+       << "    \"results\": [\n";
+
+    for(size_t i = 0; i < entries.size(); ++i) {
+        ss << "      {\n"
+           << "        \"cpu_node\": " << entries[i].cpu_node << ",\n"
+           << "        \"memory_node\": " << entries[i].memory_node << ",\n"
+           << "        \"num_threads\": " << entries[i].num_threads << ",\n"
+           << "        \"bandwidth_gbps\": " << std::fixed << std::setprecision(2)
+           << entries[i].stats.bandwidth_gbps << ",\n"
+           << "        \"bandwidth_gb_s\": " << std::fixed << std::setprecision(2)
+           << (entries[i].stats.bandwidth_gbps * 8.0) << ",\n"
+           << "        \"latency_ns\": " << std::fixed << std::setprecision(1)
+           << entries[i].stats.latency_ns << "\n"
+           << "      }";
+
+        if(i < entries.size() - 1)
+            ss << ",";
+        ss << "\n";
+    }
+
+    ss << "    ]\n"
+       << "  }";
+
+    return ss.str();
+}
+
+std::string OutputFormatter::format_json_memory_tiers(const std::string& pattern_name,
+                                                      const std::string& working_set_desc,
+                                                      const std::vector<MemoryTiers::Point>& points) {
+    std::vector<size_t> best = MemoryTiers::best_points(points);
+
+    std::stringstream ss;
+    ss << "  {\n"
+       << "    \"pattern_name\": \"" << pattern_name << "\",\n"
+       << "    \"memory_tiers\": true,\n"
+       << "    \"working_set_desc\": \"" << working_set_desc << "\",\n"
+       << "    \"results\": [\n";
+
+    for(size_t i = 0; i < points.size(); ++i) {
+        const MemoryTiers::Point& point = points[i];
+        ss << "      {\"local_node\": " << point.local_node << ", \"far_node\": " << point.far_node
+           << ", \"local_weight\": " << point.ratio.local_weight << ", \"far_weight\": " << point.ratio.far_weight
+           << ", \"placement\": \"" << MemoryTiers::placement_to_string(point.ratio) << "\", \"policy\": \""
+           << point.policy << "\", \"far_page_share\": ";
+        if(point.far_page_share >= 0.0)
+            ss << std::fixed << std::setprecision(4) << point.far_page_share;
+        else
+            ss << "null";
+        ss << ", \"num_threads\": " << point.num_threads << ", \"bandwidth_gbps\": " << std::fixed
+           << std::setprecision(2) << point.stats.bandwidth_gbps << ", \"latency_ns\": " << std::setprecision(1)
+           << point.stats.latency_ns << ", \"best\": "
+           << (std::find(best.begin(), best.end(), i) != best.end() ? "true" : "false") << "}";
+        if(i < points.size() - 1)
+            ss << ",";
+        ss << "\n";
+    }
+
+    ss << "    ]\n"
+       << "  }";
+
+    return ss.str();
+}
+
+std::string OutputFormatter::format_json_gpu_bandwidth(const std::string& working_set_desc,
+                                                       const std::vector<GpuBandwidth::Point>& points) {
+    std::stringstream ss;
+    ss << "  {\n"
+       << "    \"gpu_bandwidth\": true,\n"
+       << "    \"working_set_desc\": \"" << working_set_desc << "\",\n"
+       << "    \"device\": \"" << (points.empty() ? "" : points.front().device) << "\",\n"
+       << "    \"results\": [\n";
+
+    for(size_t i = 0; i < points.size(); ++i) {
+        const GpuBandwidth::Point& point = points[i];
+        ss << "      {\"kernel\": \"" << GpuBandwidth::kernel_to_string(point.kernel) << "\", \"array_bytes\": "
+           << point.array_bytes << ", \"gpu_iterations\": " << point.gpu_iterations << ", \"cpu_threads\": "
+           << point.cpu_threads << ", \"gpu_alone_gbps\": " << std::fixed << std::setprecision(2)
+           << point.gpu_alone_gbps << ", \"cpu_alone_gbps\": " << point.cpu_alone_gbps
+           << ", \"gpu_shared_gbps\": " << point.gpu_shared_gbps << ", \"cpu_shared_gbps\": "
+           << point.cpu_shared_gbps << ", \"gpu_retained_percent\": " << std::setprecision(1)
+           << GpuBandwidth::retained_percent(point.gpu_shared_gbps, point.gpu_alone_gbps)
+           << ", \"cpu_retained_percent\": "
+           << GpuBandwidth::retained_percent(point.cpu_shared_gbps, point.cpu_alone_gbps)
+           << ", \"verified\": " << (point.verified ? "true" : "false") << "}";
+        if(i < points.size() - 1)
+            ss << ",";
+        ss << "\n";
+    }
+
+    ss << "    ]\n"
+       << "  }";
+
+    return ss.str();
+}
+
+std::string OutputFormatter::format_json_loaded_latency(const std::string& pattern_name,
+                                                        const std::string& working_set_desc,
+                                                        const std::vector<LoadedLatencyPoint>& points) {
+    double peak = peak_load_bandwidth(points);
+
+    std::stringstream ss;
+    ss << "  {\n"
+       << "    \"pattern_name\": \"" << pattern_name << "\",\n"
+       << "    \"loaded_latency\": true,\n"
+       << "    \"working_set_desc\": \"" << working_set_desc << "\",\n"
+       << "    \"results\": [\n";
+
+    for(size_t i = 0; i < points.size(); ++i) {
+        ss << "      {\n"
+           << "        \"load_threads\": " << points[i].load_threads << ",\n"
+           << "        \"delay_spins\": " << points[i].delay_spins << ",\n"
+           << "        \"bandwidth_gbps\": " << std::fixed << std::setprecision(2) << points[i].bandwidth_gbps
+           << ",\n"
+           << "        \"utilization_percent\": " << std::fixed << std::setprecision(1)
+           << load_utilization_percent(points[i], peak) << ",\n"
+           << "        \"latency_ns\": " << std::fixed << std::setprecision(1) << points[i].latency_ns << ",\n"
+           << "        \"latency_stats\": " << format_json_distribution(points[i].latency_distribution, 1) << "\n"
+           << "      }";
+
+        if(i < points.size() - 1)
+            ss << ",";
+        ss << "\n";
+    }
+
+    ss << "    ]\n"
+       << "  }";
+
+    return ss.str();
+}
+
+std::string OutputFormatter::format_json_prefetch_sweep(const std::string& pattern_name,
+                                                        const std::string& working_set_desc,
+                                                        const std::vector<PrefetchPoint>& points) {
+    std::stringstream ss;
+    ss << "  {\n"
+       << "    \"pattern_name\": \"" << pattern_name << "\",\n"
+       << "    \"prefetch_sweep\": true,\n"
+       << "    \"working_set_desc\": \"" << working_set_desc << "\",\n";
+    if(!points.empty()) {
+        const PrefetchPoint& best = points[best_prefetch_point(points)];
+        ss << "    \"best\": {\"distance_bytes\": " << best.distance_bytes << ", \"hardware_prefetchers\": \""
+           << hardware_prefetch_label(best) << "\", \"delta_percent\": " << std::fixed << std::setprecision(1)
+           << best.delta_percent << "},\n";
+    }
+    ss << "    \"results\": [\n";
+
+    for(size_t i = 0; i < points.size(); ++i) {
+        ss << "      {\n"
+           << "        \"distance_bytes\": " << points[i].distance_bytes << ",\n"
+           << "        \"hardware_prefetchers\": \"" << hardware_prefetch_label(points[i]) << "\",\n"
+           << "        \"bandwidth_gbps\": " << std::fixed << std::setprecision(2) << points[i].bandwidth_gbps
+           << ",\n"
+           << "        \"latency_ns\": " << points[i].latency_ns << ",\n"
+           << "        \"delta_percent\": " << std::setprecision(1) << points[i].delta_percent << "\n"
+           << "      }";
+
+        if(i < points.size() - 1)
+            ss << ",";
+        ss << "\n";
+    }
+
+    ss << "    ]\n"
+       << "  }";
+
+    return ss.str();
+}
+
+std::string OutputFormatter::format_json_thread_scaling(
+    const std::string& pattern_name, const std::string& working_set_desc, const std::string& placement,
+    const std::vector<ThreadScaling::ScalingPoint>& points) {
+    std::stringstream ss;
+    ss << "  {\n"
+       << "    \"pattern_name\": \"" << pattern_name << "\",\n"
+       << "    \"thread_scaling\": true,\n"
+       << "    \"working_set_desc\": \"" << working_set_desc << "\",\n"
+       << "    \"placement\": \"" << placement << "\",\n";
+    size_t saturation = ThreadScaling::saturation_index(points);
+    if(saturation < points.size()) {
+        ss << "    \"saturation_threads\": " << points[saturation].threads << ",\n";
+    }
+    size_t optimal = ThreadScaling::energy_optimal_index(points);
+    if(optimal < points.size()) {
+        ss << "    \"energy_optimal_threads\": " << points[optimal].threads << ",\n";
+    }
+    ss << "    \"results\": [\n";
+
+    for(size_t i = 0; i < points.size(); ++i) {
+        ss << "      {\n"
+           << "        \"threads\": " << points[i].threads << ",\n"
+           << "        \"bandwidth_gbps\": " << std::fixed << std::setprecision(2) << points[i].bandwidth_gbps
+           << ",\n"
+           << "        \"latency_ns\": " << points[i].latency_ns << ",\n"
+           << "        \"speedup\": " << points[i].speedup << ",\n"
+           << "        \"efficiency\": " << std::setprecision(3) << points[i].efficiency;
+        if(points[i].energy_measured) {
+            ss << ",\n"
+               << "        \"package_watts\": " << std::setprecision(2) << points[i].package_watts << ",\n"
+               << "        \"dram_watts\": " << points[i].dram_watts << ",\n"
+               << "        \"pj_per_byte\": " << points[i].pj_per_byte;
+        }
+        ss << "\n"
+           << "      }";
+
+        if(i < points.size() - 1)
+            ss << ",";
+        ss << "\n";
+    }
+
+    ss << "    ]\n"
+       << "  }";
+
+    return ss.str();
+}
+
+std::string OutputFormatter::format_json_contention(
+    const std::string& victim_name, const std::string& aggressor, const std::string& working_set_desc,
+    const std::vector<Contention::ContentionPoint>& points) {
+    std::stringstream ss;
+    ss << "  {\n"
+       << "    \"pattern_name\": \"" << victim_name << "\",\n"
+       << "    \"contention\": true,\n"
+       << "    \"aggressor\": \"" << aggressor << "\",\n"
+       << "    \"working_set_desc\": \"" << working_set_desc << "\",\n"
+       << "    \"results\": [\n";
+
+    for(size_t i = 0; i < points.size(); ++i) {
+        ss << "      {\n"
+           << "        \"aggressor_threads\": " << points[i].aggressor_threads << ",\n"
+           << "        \"delay_spins\": " << points[i].delay_spins << ",\n"
+           << "        \"aggressor_gbps\": " << std::fixed << std::setprecision(2) << points[i].aggressor_gbps
+           << ",\n"
+           << "        \"victim_gbps\": " << points[i].victim_gbps << ",\n"
+           << "        \"victim_latency_ns\": " << points[i].victim_latency_ns << ",\n"
+           << "        \"slowdown\": " << std::setprecision(3) << points[i].slowdown << "\n"
+           << "      }";
+
+        if(i < points.size() - 1)
+            ss << ",";
+        ss << "\n";
+    }
+
+    ss << "    ]\n"
+       << "  }";
+
+    return ss.str();
+}
+
+std::string OutputFormatter::format_json_soak(const std::string& pattern_name,
+                                              const std::string& working_set_desc, const Soak::Summary& summary,
+                                              const std::vector<Soak::Sample>& samples) {
+    std::stringstream ss;
+    ss << "  {\n"
+       << "    \"pattern_name\": \"" << pattern_name << "\",\n"
+       << "    \"soak\": true,\n"
+       << "    \"working_set_desc\": \"" << working_set_desc << "\",\n"
+       << std::fixed << std::setprecision(2)
+       << "    \"duration_seconds\": " << summary.duration_seconds << ",\n"
+       << "    \"mean_gbps\": " << summary.mean_gbps << ",\n"
+       << "    \"min_gbps\": " << summary.min_gbps << ",\n"
+       << "    \"max_gbps\": " << summary.max_gbps << ",\n"
+       << "    \"first_window_gbps\": " << summary.first_gbps << ",\n"
+       << "    \"last_window_gbps\": " << summary.last_gbps << ",\n"
+       << "    \"decay_percent\": " << summary.decay_percent << ",\n"
+       << "    \"first_window_mhz\": " << summary.first_mhz << ",\n"
+       << "    \"last_window_mhz\": " << summary.last_mhz << ",\n"
+       << "    \"frequency_drop_percent\": " << summary.frequency_drop_percent << ",\n"
+       << "    \"max_cpu_temperature_c\": " << summary.max_cpu_temperature_c << ",\n"
+       << "    \"max_dimm_temperature_c\": " << summary.max_dimm_temperature_c << ",\n"
+       << "    \"throttled\": " << (summary.throttled ? "true" : "false") << ",\n"
+       << "    \"samples\": [\n";
+
+    // One line per sample: a 24-hour run at 100 ms has close to a million
+    for(size_t i = 0; i < samples.size(); ++i) {
+        const Soak::Sample& sample = samples[i];
+        ss << "      {\"elapsed_seconds\": " << std::setprecision(3) << sample.elapsed_seconds
+           << ", \"bandwidth_gbps\": " << std::setprecision(2) << sample.bandwidth_gbps
+           << ", \"frequency_mhz\": " << std::setprecision(0) << sample.frequency_mhz
+           << ", \"cpu_temperature_c\": " << std::setprecision(1) << sample.cpu_temperature_c
+           << ", \"dimm_temperature_c\": " << sample.dimm_temperature_c << "}";
+        if(i < samples.size() - 1)
+            ss << ",";
+        ss << "\n";
+    }
+
+    ss << "    ]\n"
+       << "  }";
+
+    return ss.str();
+}
+
+std::string OutputFormatter::format_json_baseline_comparison(
+    const std::string& baseline_desc, const std::vector<std::string>& host_changes,
+    const std::vector<Baseline::Comparison>& comparisons) {
+    std::stringstream ss;
+    ss << "  {\n"
+       << "    \"baseline_comparison\": true,\n"
+       << "    \"baseline\": \"" << baseline_desc << "\",\n"
+       << "    \"host_changes\": [";
+    for(size_t i = 0; i < host_changes.size(); ++i) {
+        ss << (i > 0 ? ", " : "") << "\"" << host_changes[i] << "\"";
+    }
+    ss << "],\n"
+       << "    \"regressions\": " << Baseline::count(comparisons, Baseline::Verdict::REGRESSED) << ",\n"
+       << "    \"inconclusive\": " << Baseline::count(comparisons, Baseline::Verdict::INCONCLUSIVE) << ",\n"
+       << "    \"results\": [\n";
+
+    for(size_t i = 0; i < comparisons.size(); ++i) {
+        const Baseline::Comparison& comparison = comparisons[i];
+        ss << "      {\n"
+           << "        \"test_name\": \"" << comparison.current.test_name << "\",\n"
+           << "        \"working_set_desc\": \"" << comparison.current.working_set << "\",\n"
+           << "        \"kernel\": \"" << comparison.current.kernel << "\",\n"
+           << "        \"store_policy\": \"" << comparison.current.store_policy << "\",\n"
+           << "        \"num_threads\": " << comparison.current.threads << ",\n"
+           << "        \"baseline_gbps\": " << std::fixed << std::setprecision(2) << comparison.baseline_gbps
+           << ",\n"
+           << "        \"current_gbps\": " << comparison.current_gbps << ",\n"
+           << "        \"change_percent\": " << comparison.change_percent << ",\n"
+           << "        \"p_value\": " << std::setprecision(6) << comparison.p_value << ",\n"
+           << "        \"tested\": " << (comparison.tested ? "true" : "false") << ",\n"
+           << "        \"verdict\": \"" << Baseline::verdict_to_string(comparison.verdict) << "\"\n"
+           << "      }";
+
+        if(i < comparisons.size() - 1)
+            ss << ",";
+        ss << "\n";
+    }
+
+    ss << "    ]\n"
+       << "  }";
+
+    return ss.str();
+}
+
+std::string OutputFormatter::format_json_fleet_report(const Fleet::Report& report) {
+    std::stringstream ss;
+    ss << "  {\n"
+       << "    \"fleet_report\": true,\n"
+       << "    \"fleet_id\": " << Json::quote(report.fleet_id) << ",\n"
+       << "    \"start_unix_ms\": " << report.start_unix_ms << ",\n"
+       << "    \"hosts\": [\n";
+    for(size_t i = 0; i < report.hosts.size(); ++i) {
+        const Fleet::HostRun& host = report.hosts[i];
+        ss << "      {\"endpoint\": " << Json::quote(host.endpoint) << ", \"hostname\": " << Json::quote(host.hostname)
+           << ", \"sku\": " << Json::quote(host.sku) << ", \"accepted\": " << (host.accepted ? "true" : "false")
+           << ", \"exit_code\": " << host.exit_code << ", \"records\": " << host.records
+           << ", \"clock_offset_ms\": " << std::fixed << std::setprecision(1) << host.clock_offset_ms
+           << ", \"message\": " << Json::quote(host.message) << "}";
+        if(i < report.hosts.size() - 1)
+            ss << ",";
+        ss << "\n";
+    }
+    ss << "    ],\n"
+       << "    \"summaries\": [\n";
+    for(size_t i = 0; i < report.summaries.size(); ++i) {
+        const Fleet::Summary& summary = report.summaries[i];
+        ss << "      {\"sku\": " << Json::quote(summary.sku) << ", \"test\": " << Json::quote(summary.test)
+           << ", \"metric\": \"" << summary.metric << "\", \"hosts\": " << summary.hosts << ", \"min\": "
+           << std::fixed << std::setprecision(2) << summary.min << ", \"p10\": " << summary.p10
+           << ", \"median\": " << summary.median << ", \"p90\": " << summary.p90 << ", \"max\": " << summary.max
+           << "}";
+        if(i < report.summaries.size() - 1)
+            ss << ",";
+        ss << "\n";
+    }
+    ss << "    ],\n"
+       << "    \"outliers\": [\n";
+    for(size_t i = 0; i < report.outliers.size(); ++i) {
+        const Fleet::Outlier& outlier = report.outliers[i];
+        ss << "      {\"hostname\": " << Json::quote(outlier.hostname) << ", \"sku\": " << Json::quote(outlier.sku)
+           << ", \"test\": " << Json::quote(outlier.test) << ", \"metric\": \"" << outlier.metric
+           << "\", \"value\": " << std::fixed << std::setprecision(2) << outlier.value
+           << ", \"median\": " << outlier.median << ", \"deviation_percent\": " << outlier.deviation_percent
+           << ", \"robust_z\": " << outlier.robust_z << "}";
+        if(i < report.outliers.size() - 1)
+            ss << ",";
+        ss << "\n";
+    }
+    ss << "    ]\n"
+       << "  }";
+
+    return ss.str();
+}
+
+std::string OutputFormatter::format_json_peak_calibration(const PeakCalibration::HostPeak& peak,
+                                                          const MemorySpecs& mem_specs) {
+    double theoretical = mem_specs.theoretical_bandwidth_gbps;
+    std::stringstream ss;
+    ss << "  {\n"
+       << "    \"peak_calibration\": true,\n"
+       << "    \"working_set_desc\": \"" << peak.working_set << "\",\n"
+       << "    \"recorded\": \"" << peak.recorded << "\",\n"
+       << "    \"host_key\": \"" << peak.host_key << "\",\n"
+       << "    \"theoretical_bandwidth_gbps\": " << std::fixed << std::setprecision(2) << theoretical << ",\n"
+       << "    \"calibrated_bandwidth_gbps\": " << peak.peak_gbps() << ",\n"
+       << "    \"ceilings\": [\n";
+
+    for(size_t i = 0; i < peak.ceilings.size(); ++i) {
+        const PeakCalibration::Ceiling& ceiling = peak.ceilings[i];
+        ss << "      {\n"
+           << "        \"family\": \"" << ceiling.family << "\",\n"
+           << "        \"test_name\": \"" << ceiling.test_name << "\",\n"
+           << "        \"kernel\": \"" << ceiling.kernel << "\",\n"
+           << "        \"store_policy\": \"" << ceiling.store_policy << "\",\n"
+           << "        \"num_threads\": " << ceiling.threads << ",\n"
+           << "        \"bandwidth_gbps\": " << std::setprecision(2) << ceiling.bandwidth_gbps << ",\n"
+           << "        \"efficiency_percent\": " << std::setprecision(1)
+           << calculate_efficiency(ceiling.bandwidth_gbps, theoretical) << "\n"
+           << "      }";
+
+        if(i < peak.ceilings.size() - 1)
+            ss << ",";
+        ss << "\n";
+    }
+
+    ss << "    ]\n"
+       << "  }";
+
+    return ss.str();
+}
+
+std::string OutputFormatter::format_json_tuning(const PeakCalibration::HostPeak& peak) {
+    std::stringstream ss;
+    ss << "  {\n"
+       << "    \"kernel_tuning\": true,\n"
+       << "    \"recorded\": \"" << peak.tuned << "\",\n"
+       << "    \"host_key\": \"" << peak.host_key << "\",\n"
+       << "    \"shapes\": [\n";
+
+    for(size_t i = 0; i < peak.shapes.size(); ++i) {
+        const PeakCalibration::TunedShape& shape = peak.shapes[i];
+        ss << "      {\n"
+           << "        \"family\": \"" << shape.family << "\",\n"
+           << "        \"level\": \"" << shape.level << "\",\n"
+           << "        \"num_threads\": " << shape.threads << ",\n"
+           << "        \"shape\": \"" << shape.shape << "\",\n"
+           << "        \"bandwidth_gbps\": " << std::fixed << std::setprecision(2) << shape.bandwidth_gbps << ",\n"
+           << "        \"baseline_gbps\": " << shape.baseline_gbps << ",\n"
+           << "        \"gain_percent\": " << std::setprecision(1) << tuning_gain_percent(shape) << "\n"
+           << "      }";
+
+        if(i < peak.shapes.size() - 1)
+            ss << ",";
+        ss << "\n";
+    }
+
+    ss << "    ]\n"
+       << "  }";
+
+    return ss.str();
+}
+
+std::string OutputFormatter::format_json_core_to_core(const std::vector<size_t>& cpus,
+                                                      const std::vector<CoherenceTests::PingPongResult>& matrix) {
+    CoherenceTests::MatrixSummary summary = CoherenceTests::summarize(matrix);
+
+    std::stringstream ss;
+    ss << "  {\n"
+       << "    \"core_to_core\": true,\n"
+       << "    \"cpus\": [";
+    for(size_t i = 0; i < cpus.size(); ++i) {
+        ss << cpus[i] << (i < cpus.size() - 1 ? ", " : "");
+    }
+    ss << "],\n";
+    if(summary.pairs > 0) {
+        ss << std::fixed << std::setprecision(1)
+           << "    \"fastest\": {\"cpu_a\": " << summary.fastest.cpu_a << ", \"cpu_b\": " << summary.fastest.cpu_b
+           << ", \"one_way_ns\": " << summary.fastest.one_way_ns << "},\n"
+           << "    \"median_ns\": " << summary.median_ns << ",\n"
+           << "    \"slowest\": {\"cpu_a\": " << summary.slowest.cpu_a << ", \"cpu_b\": " << summary.slowest.cpu_b
+           << ", \"one_way_ns\": " << summary.slowest.one_way_ns << "},\n";
+    }
+    // Rows follow "cpus"; the diagonal is null
+    ss << "    \"one_way_ns\": [\n";
+    for(size_t row = 0; row < cpus.size(); ++row) {
+        ss << "      [";
+        for(size_t col = 0; col < cpus.size(); ++col) {
+            size_t index = row * cpus.size() + col;
+            if(row == col || index >= matrix.size() || matrix[index].round_trips == 0) {
+                ss << "null";
+            } else {
+                ss << std::fixed << std::setprecision(1) << matrix[index].one_way_ns;
+            }
+            if(col < cpus.size() - 1)
+                ss << ", ";
+        }
+        ss << "]" << (row < cpus.size() - 1 ? "," : "") << "\n";
+    }
+    ss << "    ]\n"
+       << "  }";
+
+    return ss.str();
+}
+
+std::string OutputFormatter::format_json_false_sharing(const std::vector<CoherenceTests::FalseSharingResult>& results) {
+    std::stringstream ss;
+    ss << "  {\n"
+       << "    \"false_sharing\": true,\n"
+       << "    \"results\": [\n";
+
+    for(size_t i = 0; i < results.size(); ++i) {
+        const auto& result = results[i];
+        ss << "      {\n"
+           << "        \"layout\": \"" << CoherenceTests::layout_to_string(result.layout) << "\",\n"
+           << "        \"num_threads\": " << result.num_threads << ",\n"
+           << "        \"increments_per_thread\": " << result.increments_per_thread << ",\n"
+           << "        \"ns_per_increment\": " << std::fixed << std::setprecision(2) << result.ns_per_increment
+           << ",\n"
+           << "        \"total_mops\": " << std::setprecision(1) << result.total_mops << ",\n"
+           << "        \"slowdown_vs_padded\": " << std::setprecision(2) << false_sharing_slowdown(results, result)
+           << ",\n"
+           << "        \"verified\": " << (result.verified ? "true" : "false") << "\n"
+           << "      }";
+
+        if(i < results.size() - 1)
+            ss << ",";
+        ss << "\n";
+    }
+
+    ss << "    ]\n"
+       << "  }";
+
+    return ss.str();
+}
+
+std::string OutputFormatter::format_json_atomics(const std::string& std_atomics,
+                                                 const std::vector<AtomicTests::Result>& results) {
+    std::stringstream ss;
+    ss << "  {\n"
+       << "    \"atomics\": true,\n"
+       << "    \"std_atomics\": \"" << std_atomics << "\",\n"
+       << "    \"results\": [\n";
+
+    for(size_t i = 0; i < results.size(); ++i) {
+        const auto& result = results[i];
+        ss << "      {\n"
+           << "        \"operation\": \"" << AtomicTests::operation_to_string(result.config.op) << "\",\n"
+           << "        \"ordering\": \"" << AtomicTests::ordering_to_string(result.config.ordering) << "\",\n"
+           << "        \"line\": \"" << AtomicTests::sharing_to_string(result.config.sharing) << "\",\n"
+           << "        \"implementation\": \"" << AtomicTests::implementation_to_string(result.config.impl) << "\",\n"
+           << "        \"num_threads\": " << result.num_threads << ",\n"
+           << "        \"ops_per_thread\": " << result.config.ops_per_thread << ",\n"
+           << "        \"total_mops\": " << std::fixed << std::setprecision(1) << result.total_mops << ",\n"
+           << "        \"ns_per_op\": " << std::setprecision(2) << result.ns_per_op << ",\n"
+           << "        \"scaling_vs_single_thread\": " << atomic_scaling(results, result) << ",\n"
+           << "        \"verified\": " << (result.verified ? "true" : "false") << "\n"
+           << "      }";
+
+        if(i < results.size() - 1)
+            ss << ",";
+        ss << "\n";
+    }
+
+    ss << "    ]\n"
+       << "  }";
+
+    return ss.str();
+}
+
+std::string OutputFormatter::format_json_allocator_results(const std::vector<AllocatorBench::Result>& results) {
+    std::stringstream ss;
+    ss << "  {\n"
+       << "    \"allocators\": true,\n"
+       << "    \"results\": [\n";
+
+    for(size_t i = 0; i < results.size(); ++i) {
+        const auto& result = results[i];
+        ss << "      {\n"
+           << "        \"workload\": \"" << AllocatorBench::workload_to_string(result.workload) << "\",\n"
+           << "        \"allocator\": " << Json::quote(result.allocator) << ",\n"
+           << "        \"num_threads\": " << result.num_threads << ",\n"
+           << "        \"available\": " << (result.available ? "true" : "false") << ",\n";
+        if(result.available) {
+            ss << "        \"pairs\": " << result.ops << ",\n"
+               << "        \"total_mops\": " << std::fixed << std::setprecision(1) << result.total_mops << ",\n"
+               << "        \"ns_per_op\": " << std::setprecision(2) << result.ns_per_op << ",\n"
+               << "        \"live_bytes\": " << result.live_bytes << ",\n"
+               << "        \"rss_growth_bytes\": " << result.rss_growth_bytes << "\n";
+        } else {
+            ss << "        \"note\": " << Json::quote(result.note) << "\n";
+        }
+        ss << "      }";
+
+        if(i < results.size() - 1)
+            ss << ",";
+        ss << "\n";
+    }
+
+    ss << "    ]\n"
+       << "  }";
+
+    return ss.str();
+}
+
+std::string OutputFormatter::format_json_roofline(const std::string& working_set_desc, const Roofline& roofline) {
+    std::stringstream ss;
+    ss << "  {\n"
+       << "    \"roofline\": true,\n"
+       << "    \"working_set_desc\": \"" << working_set_desc << "\",\n"
+       << "    \"ceilings\": [\n";
+
+    for(size_t i = 0; i < roofline.ceilings.size(); ++i) {
+        const RooflineCeiling& ceiling = roofline.ceilings[i];
+        ss << "      {\n"
+           << "        \"name\": \"" << ceiling.name << "\",\n"
+           << "        \"kind\": \"" << ceiling.kind << "\",\n"
+           << "        \"value\": " << std::fixed << std::setprecision(2) << ceiling.value << ",\n"
+           << "        \"unit\": \"" << (ceiling.kind == "memory" ? "GB/s" : "GFLOP/s") << "\",\n"
+           << "        \"ridge_intensity\": " << std::setprecision(3) << ceiling.ridge_intensity << "\n"
+           << "      }";
+
+        if(i < roofline.ceilings.size() - 1)
+            ss << ",";
+        ss << "\n";
+    }
+
+    ss << "    ],\n"
+       << "    \"points\": [\n";
+
+    for(size_t i = 0; i < roofline.points.size(); ++i) {
+        const RooflinePoint& point = roofline.points[i];
+        ss << "      {\n"
+           << "        \"level\": \"" << point.level << "\",\n"
+           << "        \"working_set_bytes\": " << point.working_set_bytes << ",\n"
+           << "        \"arithmetic_intensity\": " << std::fixed << std::setprecision(4)
+           << point.arithmetic_intensity << ",\n"
+           << "        \"gflops\": " << std::setprecision(2) << point.gflops << ",\n"
+           << "        \"bandwidth_gbps\": " << point.bandwidth_gbps << "\n"
+           << "      }";
+
+        if(i < roofline.points.size() - 1)
+            ss << ",";
+        ss << "\n";
+    }
+
+    ss << "    ]\n"
+       << "  }";
+
+    return ss.str();
+}
+
+std::string OutputFormatter::format_json_working_set_sweep(const WorkingSetSweep& sweep) {
+    auto format_knees = [](const std::vector<CacheBoundaries::Knee>& knees, int precision) {
+        std::stringstream ks;
+        ks << "[";
+        for(size_t i = 0; i < knees.size(); ++i) {
+            ks << (i > 0 ? ", " : "") << "{\"capacity_bytes\": " << knees[i].capacity_bytes << ", \"before\": "
+               << std::fixed << std::setprecision(precision) << knees[i].before << ", \"after\": " << knees[i].after
+               << "}";
+        }
+        ks << "]";
+        return ks.str();
+    };
+
+    std::stringstream ss;
+    ss << "  {\n"
+       << "    \"working_set_sweep\": true,\n"
+       << "    \"steps_per_octave\": " << sweep.steps_per_octave << ",\n"
+       << "    \"points\": [\n";
+
+    for(size_t i = 0; i < sweep.points.size(); ++i) {
+        const SweepPoint& point = sweep.points[i];
+        ss << "      {\"working_set_bytes\": " << point.working_set_bytes << ", \"bandwidth_gbps\": " << std::fixed
+           << std::setprecision(2) << point.bandwidth_gbps << ", \"latency_ns\": " << std::setprecision(1)
+           << point.latency_ns << "}";
+        if(i < sweep.points.size() - 1)
+            ss << ",";
+        ss << "\n";
+    }
+
+    ss << "    ],\n"
+       << "    \"capacities\": [\n";
+    for(size_t i = 0; i < sweep.capacities.size(); ++i) {
+        const CacheBoundaries::EffectiveCapacity& capacity = sweep.capacities[i];
+        ss << "      {\"level\": \"" << capacity.level << "\", \"reported_bytes\": " << capacity.reported_bytes
+           << ", \"bandwidth_knee_bytes\": " << capacity.bandwidth_bytes
+           << ", \"latency_knee_bytes\": " << capacity.latency_bytes << "}";
+        if(i < sweep.capacities.size() - 1)
+            ss << ",";
+        ss << "\n";
+    }
+
+    ss << "    ],\n"
+       << "    \"bandwidth_knees\": " << format_knees(sweep.bandwidth_knees, 2) << ",\n"
+       << "    \"latency_knees\": " << format_knees(sweep.latency_knees, 1) << "\n"
+       << "  }";
+
+    return ss.str();
+}
+
+// CSV formatting methods
+std::string OutputFormatter::format_csv_system_info(const SystemInfo& sys_info) {
+    std::stringstream ss;
+    ss << "# System Information\n"
+       << "CPU," << sys_info.cpu_name << "\n"
+       << "Total RAM (GB)," << sys_info.total_ram_gb << "\n"
+       << "Available RAM (GB)," << sys_info.available_ram_gb << "\n"
+       << "Physical CPU Cores," << sys_info.cpu_cores << "\n"
+       << "Logical CPU Threads," << sys_info.cpu_threads << "\n"
+       << "Cache Line Size (bytes)," << sys_info.cache_line_size << "\n"
+       << "Memory Type," << sys_info.memory_specs.type << "\n"
+       << "Memory Speed (MT/s)," << sys_info.memory_specs.speed_mtps
+       << (sys_info.memory_specs.speed_detected ? "" : " (assumed)") << "\n"
+       << "Memory Detected From," << sys_info.memory_specs.detection_source << "\n"
+       << "Data Width (bits)," << sys_info.memory_specs.data_width_bits << "\n"
+       << "Total Width (bits)," << sys_info.memory_specs.total_width_bits << "\n"
+       << "Channels," << sys_info.memory_specs.num_channels;
+    if(sys_info.memory_specs.is_virtualized) {
+        if(sys_info.memory_specs.num_channels == 0) {
+            ss << " (cannot detect)";
+        } else {
+            ss << " (estimated)";
+        }
+    } else if(!sys_info.memory_specs.num_channels_detected) {
+        ss << " (not detected)";
+    }
+    ss << "\n"
+       << "Theoretical Bandwidth (GB/s)," << std::fixed << std::setprecision(1)
+       << sys_info.memory_specs.theoretical_bandwidth_gbps << "\n"
+       << "Theoretical Bandwidth (Gb/s)," << std::fixed << std::setprecision(1)
+       << (sys_info.memory_specs.theoretical_bandwidth_gbps * 8.0) << "\n"
+       << "Calibrated Bandwidth (GB/s)," << sys_info.memory_specs.calibrated_bandwidth_gbps << "\n"
+       << "L1 Data Cache (KB)," << (sys_info.cache_info.l1_data_size / 1024) << "\n"
+       << "L1 Instruction Cache (KB)," << (sys_info.cache_info.l1_instruction_size / 1024) << "\n"
+       << "L2 Cache (KB)," << (sys_info.cache_info.l2_size / 1024) << "\n"
+       << "L3 Cache (MB)," << (sys_info.cache_info.l3_size / (1024 * 1024)) << "\n"
+       << "Cache Line Size (bytes)," << sys_info.cache_info.l1_line_size << "\n\n";
+
+    return ss.str();
+}
+
+std::string OutputFormatter::format_csv_header() {
+    return "# Test Results\n"
+           "Test,Working Set,Threads,Kernel,Stores,Bandwidth (GB/s),Bandwidth (Gb/s),Latency (ns),Efficiency "
+           "(%),Of Calibrated (%)," +
+           std::string(CSV_DISTRIBUTION_HEADER) + "\n";
+}
+
+std::string OutputFormatter::format_csv_test_result(const TestResult& result,
+                                                    const MemorySpecs& mem_specs) {
+    double efficiency =
+        calculate_efficiency(result.stats.bandwidth_gbps, mem_specs.theoretical_bandwidth_gbps);
+
+    std::stringstream ss;
+    ss << "\"" << result.test_name << "\","
+       << "\"" << result.working_set_desc << "\"," << result.num_threads << ","
+       << result.kernel_name << "," << result.store_policy << "," << std::fixed
+       << std::setprecision(2) << result.stats.bandwidth_gbps << "," << std::fixed
+       << std::setprecision(2) << (result.stats.bandwidth_gbps * 8.0) << "," << std::fixed
+       << std::setprecision(1) << result.stats.latency_ns << ",";
+    
+    // Handle efficiency display
+    ss << OutputFormatterUtils::format_efficiency_display(efficiency, mem_specs.theoretical_bandwidth_gbps);
+    ss << "," << calibrated_efficiency_display(result, mem_specs);
+    ss << "," << format_csv_distribution_columns(result);
+    ss << "\n";
+
+    return ss.str();
+}
+
+std::string OutputFormatter::format_csv_cache_aware_results(const std::string& pattern_name,
+                                                            const std::vector<TestResult>& results,
+                                                            const MemorySpecs& mem_specs) {
+    std::stringstream ss;
+    ss << "# " << pattern_name << " (Cache-Aware)\n"
+       << "Working Set,Threads,Kernel,Stores,Bandwidth (GB/s),Bandwidth (Gb/s),Latency (ns),Efficiency (%),"
+       << "Of Calibrated (%)," << CSV_DISTRIBUTION_HEADER << "\n";
+
+    for(const auto& result : results) {
+        double efficiency =
+            calculate_efficiency(result.stats.bandwidth_gbps, mem_specs.theoretical_bandwidth_gbps);
+
+        ss << "\"" << result.working_set_desc << "\"," << result.num_threads << ","
+           << result.kernel_name << "," << result.store_policy << "," << std::fixed
+           << std::setprecision(2) << result.stats.bandwidth_gbps << "," << std::fixed
+           << std::setprecision(2) << (result.stats.bandwidth_gbps * 8.0) << "," << std::fixed
+           << std::setprecision(1) << result.stats.latency_ns << ",";
+        
+        // Handle efficiency display
+        ss << OutputFormatterUtils::format_efficiency_display(efficiency, mem_specs.theoretical_bandwidth_gbps);
+        ss << "," << calibrated_efficiency_display(result, mem_specs);
+        ss << "," << format_csv_distribution_columns(result);
+        ss << "\n";
+    }
+    ss << "\n";
+    ss << format_csv_thread_breakdown(results);
+    ss << format_csv_gemm_compute(results);
+    ss << format_csv_counters(results);
+    ss << format_csv_page_faults(results);
+    ss << format_csv_access(results);
+    ss << format_csv_decode(results);
+    ss << format_csv_proxy(results);
+    ss << format_csv_irregular(results);
+    ss << format_csv_energy(results);
+
+    return ss.str();
+}
+
+std::string OutputFormatter::format_csv_numa_matrix(const std::string& pattern_name,
+                                                    const std::string& working_set_desc,
+                                                    const std::vector<NumaMatrixEntry>& entries) {
+    std::stringstream ss;
+    ss << "# " << pattern_name << " NUMA Matrix (" << working_set_desc << ")\n"
+       << "CPU Node,Memory Node,Threads,Bandwidth (GB/s),Bandwidth (Gb/s),Latency (ns)\n";
+
+    for(const auto& entry : entries) {
+        ss << entry.cpu_node << "," << entry.memory_node << "," << entry.num_threads << ","
+           << std::fixed << std::setprecision(2) << entry.stats.bandwidth_gbps << "," << std::fixed
+           << std::setprecision(2) << (entry.stats.bandwidth_gbps * 8.0) << "," << std::fixed
+           << std::setprecision(1) << entry.stats.latency_ns << "\n";
+    }
+    ss << "\n";
+
+    return ss.str();
+}
+
+std::string OutputFormatter::format_csv_memory_tiers(const std::string& pattern_name,
+                                                     const std::string& working_set_desc,
+                                                     const std::vector<MemoryTiers::Point>& points) {
+    std::vector<size_t> best = MemoryTiers::best_points(points);
+
+    std::stringstream ss;
+    ss << "# " << pattern_name << " Memory Tiers (" << working_set_desc << ")\n"
+       << "Local Node,Far Node,Local Weight,Far Weight,Placement,Policy,Far Pages (%),Threads,Bandwidth (GB/s),"
+          "Latency (ns),Best\n";
+    for(size_t i = 0; i < points.size(); ++i) {
+        const MemoryTiers::Point& point = points[i];
+        ss << point.local_node << "," << point.far_node << "," << point.ratio.local_weight << ","
+           << point.ratio.far_weight << "," << MemoryTiers::placement_to_string(point.ratio) << "," << point.policy
+           << ",";
+        if(point.far_page_share >= 0.0)
+            ss << std::fixed << std::setprecision(1) << (point.far_page_share * 100.0);
+        ss << "," << point.num_threads << "," << std::fixed << std::setprecision(2) << point.stats.bandwidth_gbps
+           << "," << std::setprecision(1) << point.stats.latency_ns << ","
+           << (std::find(best.begin(), best.end(), i) != best.end() ? "yes" : "no") << "\n";
+    }
+    ss << "\n";
+
+    return ss.str();
+}
+
+std::string OutputFormatter::format_csv_gpu_bandwidth(const std::string& working_set_desc,
+                                                      const std::vector<GpuBandwidth::Point>& points) {
+    std::stringstream ss;
+    ss << "# GPU Unified Memory (" << working_set_desc << ")\n"
+       << "Kernel,Device,Array (bytes),GPU Iterations,CPU Threads,GPU Alone (GB/s),CPU Alone (GB/s),"
+          "GPU Shared (GB/s),CPU Shared (GB/s),GPU Kept (%),CPU Kept (%),Verified\n";
+    for(const auto& point : points) {
+        ss << GpuBandwidth::kernel_to_string(point.kernel) << "," << point.device << "," << point.array_bytes << ","
+           << point.gpu_iterations << "," << point.cpu_threads << "," << std::fixed << std::setprecision(2)
+           << point.gpu_alone_gbps << "," << point.cpu_alone_gbps << "," << point.gpu_shared_gbps << ","
+           << point.cpu_shared_gbps << "," << std::setprecision(1)
+           << GpuBandwidth::retained_percent(point.gpu_shared_gbps, point.gpu_alone_gbps) << ","
+           << GpuBandwidth::retained_percent(point.cpu_shared_gbps, point.cpu_alone_gbps) << ","
+           << (point.verified ? "yes" : "no") << "\n";
+    }
+    ss << "\n";
+
+    return ss.str();
+}
+
+std::string OutputFormatter::format_csv_loaded_latency(const std::string& pattern_name,
+                                                       const std::string& working_set_desc,
+                                                       const std::vector<LoadedLatencyPoint>& points) {
+    double peak = peak_load_bandwidth(points);
+
+    std::stringstream ss;
+    ss << "# " << pattern_name << " Loaded Latency (" << working_set_desc << ")\n"
+       << "Delay (spins),Load Threads,Bandwidth (GB/s),Utilization (%),Latency (ns),Latency Median (ns),"
+       << "Latency P99 (ns)\n";
+
+    for(const auto& point : points) {
+        ss << point.delay_spins << "," << point.load_threads << "," << std::fixed << std::setprecision(2)
+           << point.bandwidth_gbps << "," << std::setprecision(1) << load_utilization_percent(point, peak) << ","
+           << point.latency_ns << "," << point.latency_distribution.median << ","
+           << point.latency_distribution.p99 << "\n";
+    }
+    ss << "\n";
+
+    return ss.str();
+}
+
+std::string OutputFormatter::format_csv_prefetch_sweep(const std::string& pattern_name,
+                                                       const std::string& working_set_desc,
+                                                       const std::vector<PrefetchPoint>& points) {
+    size_t best = best_prefetch_point(points);
+
+    std::stringstream ss;
+    ss << "# " << pattern_name << " Prefetch Sweep (" << working_set_desc << ")\n"
+       << "Software Prefetch (B),Hardware Prefetchers,Bandwidth (GB/s),Latency (ns),Delta (%),Best\n";
+
+    for(size_t i = 0; i < points.size(); ++i) {
+        ss << points[i].distance_bytes << "," << hardware_prefetch_label(points[i]) << "," << std::fixed
+           << std::setprecision(2) << points[i].bandwidth_gbps << "," << points[i].latency_ns << ","
+           << std::setprecision(1) << points[i].delta_percent << "," << (i == best ? 1 : 0) << "\n";
+    }
+    ss << "\n";
+
+    return ss.str();
+}
+
+std::string OutputFormatter::format_csv_thread_scaling(
+    const std::string& pattern_name, const std::string& working_set_desc, const std::string& placement,
+    const std::vector<ThreadScaling::ScalingPoint>& points) {
+    size_t saturation = ThreadScaling::saturation_index(points);
+    size_t optimal = ThreadScaling::energy_optimal_index(points);
+    bool energy = has_energy(points);
+
+    std::stringstream ss;
+    ss << "# " << pattern_name << " Thread Scaling (" << working_set_desc << ", " << placement << " placement)\n"
+       << "Threads,Bandwidth (GB/s),Latency (ns),Speedup,Efficiency,Saturation";
+    if(energy) ss << ",Package (W),DRAM (W),pJ/byte,Energy Optimal";
+    ss << "\n";
+
+    for(size_t i = 0; i < points.size(); ++i) {
+        ss << points[i].threads << "," << std::fixed << std::setprecision(2) << points[i].bandwidth_gbps << ","
+           << points[i].latency_ns << "," << points[i].speedup << "," << std::setprecision(3) << points[i].efficiency
+           << "," << (i == saturation ? 1 : 0);
+        if(energy) {
+            ss << "," << std::setprecision(2);
+            if(points[i].energy_measured) {
+                ss << points[i].package_watts << "," << points[i].dram_watts << "," << points[i].pj_per_byte;
+            } else {
+                ss << ",,";
+            }
+            ss << "," << (i == optimal ? 1 : 0);
+        }
+        ss << "\n";
+    }
+    ss << "\n";
+
+    return ss.str();
+}
+
+std::string OutputFormatter::format_csv_contention(
+    const std::string& victim_name, const std::string& aggressor, const std::string& working_set_desc,
+    const std::vector<Contention::ContentionPoint>& points) {
+    std::stringstream ss;
+    ss << "# " << victim_name << " under " << aggressor << " Contention (" << working_set_desc << ")\n"
+       << "Aggressor Threads,Delay (spins),Aggressor (GB/s),Victim (GB/s),Victim Latency (ns),Slowdown\n";
+
+    for(const auto& point : points) {
+        ss << point.aggressor_threads << "," << point.delay_spins << "," << std::fixed << std::setprecision(2)
+           << point.aggressor_gbps << "," << point.victim_gbps << "," << point.victim_latency_ns << ","
+           << std::setprecision(3) << point.slowdown << "\n";
+    }
+    ss << "\n";
+
+    return ss.str();
+}
+
+std::string OutputFormatter::format_csv_soak(const std::string& pattern_name,
+                                             const std::string& working_set_desc, const Soak::Summary& summary,
+                                             const std::vector<Soak::Sample>& samples) {
+    std::stringstream ss;
+    ss << "# " << pattern_name << " Soak (" << working_set_desc << "): " << std::fixed << std::setprecision(2)
+       << "first window " << summary.first_gbps << " GB/s, last window " << summary.last_gbps << " GB/s, decay "
+       << summary.decay_percent << "%, frequency drop " << summary.frequency_drop_percent << "%, throttled "
+       << (summary.throttled ? 1 : 0) << "\n"
+       << "Elapsed (s),Bandwidth (GB/s),Frequency (MHz),CPU Temperature (C),DIMM Temperature (C)\n";
+
+    // A missing sensor reading is an empty field, never 0 C
+    auto temperature = [](double celsius) {
+        std::stringstream field;
+        if(celsius > 0.0) field << std::fixed << std::setprecision(1) << celsius;
+        return field.str();
+    };
+    for(const auto& sample : samples) {
+        ss << std::setprecision(3) << sample.elapsed_seconds << "," << std::setprecision(2) << sample.bandwidth_gbps
+           << "," << std::setprecision(0) << sample.frequency_mhz << "," << temperature(sample.cpu_temperature_c)
+           << "," << temperature(sample.dimm_temperature_c) << "\n";
+    }
+    ss << "\n";
+
+    return ss.str();
+}
+
+std::string OutputFormatter::format_csv_baseline_comparison(
+    const std::string& baseline_desc, const std::vector<std::string>& host_changes,
+    const std::vector<Baseline::Comparison>& comparisons) {
+    std::stringstream ss;
+    ss << "# Baseline Comparison (" << baseline_desc << "): "
+       << Baseline::count(comparisons, Baseline::Verdict::REGRESSED) << " regressions, "
+       << Baseline::count(comparisons, Baseline::Verdict::INCONCLUSIVE) << " inconclusive\n";
+    for(const auto& change : host_changes) {
+        ss << "# Host change: " << change << "\n";
+    }
+    ss << "Test,Working Set,Kernel,Store Policy,Threads,Baseline (GB/s),Current (GB/s),Change (%),p-value,Verdict\n";
+
+    for(const auto& comparison : comparisons) {
+        const Baseline::Entry& entry = comparison.current;
+        ss << entry.test_name << "," << entry.working_set << "," << entry.kernel << "," << entry.store_policy << ","
+           << entry.threads << "," << std::fixed << std::setprecision(2) << comparison.baseline_gbps << ","
+           << comparison.current_gbps << "," << comparison.change_percent << "," << std::setprecision(6)
+           << comparison.p_value << "," << Baseline::verdict_to_string(comparison.verdict) << "\n";
+    }
+    ss << "\n";
+
+    return ss.str();
+}
+
+std::string OutputFormatter::format_csv_fleet_report(const Fleet::Report& report) {
+    std::stringstream ss;
+    ss << "# Fleet Report (" << report.fleet_id << "): " << report.hosts.size() << " agents, "
+       << report.outliers.size() << " outliers\n";
+    for(const auto& host : report.hosts) {
+        ss << "# Agent " << host.endpoint << " (" << (host.hostname.empty() ? "-" : host.hostname) << "): "
+           << host.records << " records, clock offset " << format_clock_offset(host) << " ms, "
+           << fleet_host_status(host) << "\n";
+    }
+    ss << "SKU,Test,Metric,Hosts,Min,p10,Median,p90,Max\n";
+    for(const auto& summary : report.summaries) {
+        ss << summary.sku << "," << summary.test << "," << summary.metric << "," << summary.hosts << ","
+           << std::fixed << std::setprecision(2) << summary.min << "," << summary.p10 << "," << summary.median << ","
+           << summary.p90 << "," << summary.max << "\n";
+    }
+    ss << "\n";
+    if(!report.outliers.empty()) {
+        ss << "Outlier Host,SKU,Test,Metric,Value,SKU Median,Deviation (%),Robust z\n";
+        for(const auto& outlier : report.outliers) {
+            ss << outlier.hostname << "," << outlier.sku << "," << outlier.test << "," << outlier.metric << ","
+               << std::fixed << std::setprecision(2) << outlier.value << "," << outlier.median << ","
+               << outlier.deviation_percent << "," << outlier.robust_z << "\n";
+        }
+        ss << "\n";
+    }
+
+    return ss.str();
+}
+
+std::string OutputFormatter::format_csv_peak_calibration(const PeakCalibration::HostPeak& peak,
+                                                         const MemorySpecs& mem_specs) {
+    double theoretical = mem_specs.theoretical_bandwidth_gbps;
+    std::stringstream ss;
+    ss << "# Calibrated Peak (" << peak.working_set << ", recorded " << peak.recorded << "): " << std::fixed
+       << std::setprecision(2) << peak.peak_gbps() << " GB/s\n"
+       << "Family,Test,Kernel,Store Policy,Threads,Bandwidth (GB/s),Efficiency (%)\n";
+
+    for(const auto& ceiling : peak.ceilings) {
+        ss << ceiling.family << ",\"" << ceiling.test_name << "\"," << ceiling.kernel << "," << ceiling.store_policy
+           << "," << ceiling.threads << "," << std::setprecision(2) << ceiling.bandwidth_gbps << ","
+           << OutputFormatterUtils::format_efficiency_display(calculate_efficiency(ceiling.bandwidth_gbps,
+                                                                                   theoretical),
+                                                              theoretical)
+           << "\n";
+    }
+    ss << "\n";
+
+    return ss.str();
+}
+
+std::string OutputFormatter::format_csv_tuning(const PeakCalibration::HostPeak& peak) {
+    std::stringstream ss;
+    ss << "# Tuned Kernel Shapes (recorded " << peak.tuned << ")\n"
+       << "Family,Level,Threads,Shape,Bandwidth (GB/s),Auto Kernel (GB/s),Gain (%)\n";
+
+    for(const auto& shape : peak.shapes) {
+        ss << shape.family << "," << shape.level << "," << shape.threads << "," << shape.shape << "," << std::fixed
+           << std::setprecision(2) << shape.bandwidth_gbps << "," << shape.baseline_gbps << ","
+           << std::setprecision(1) << tuning_gain_percent(shape) << "\n";
+    }
+    ss << "\n";
+
+    return ss.str();
+}
+
+std::string OutputFormatter::format_csv_core_to_core(const std::vector<size_t>& cpus,
+                                                     const std::vector<CoherenceTests::PingPongResult>& matrix) {
+    std::stringstream ss;
+    ss << "# Core-to-Core Transfer Latency (one-way ns; rows: initiating CPU, columns: responding CPU)\n"
+       << "CPU";
+    for(size_t cpu : cpus)
+        ss << "," << cpu;
+    ss << "\n";
+
+    for(size_t row = 0; row < cpus.size(); ++row) {
+        ss << cpus[row];
+        for(size_t col = 0; col < cpus.size(); ++col) {
+            size_t index = row * cpus.size() + col;
+            ss << ",";
+            if(row != col && index < matrix.size() && matrix[index].round_trips > 0) {
+                ss << std::fixed << std::setprecision(1) << matrix[index].one_way_ns;
+            }
+        }
+        ss << "\n";
+    }
+    ss << "\n";
+
+    return ss.str();
+}
+
+std::string OutputFormatter::format_csv_false_sharing(const std::vector<CoherenceTests::FalseSharingResult>& results) {
+    std::stringstream ss;
+    ss << "# False Sharing\n"
+       << "Counters,Threads,Increments per Thread,ns per Increment,Total (M increments/s),Slowdown vs Padded,Verified\n";
+
+    for(const auto& result : results) {
+        ss << CoherenceTests::layout_to_string(result.layout) << "," << result.num_threads << ","
+           << result.increments_per_thread << "," << std::fixed << std::setprecision(2) << result.ns_per_increment
+           << "," << std::setprecision(1) << result.total_mops << "," << std::setprecision(2)
+           << false_sharing_slowdown(results, result) << "," << (result.verified ? "true" : "false") << "\n";
+    }
+    ss << "\n";
+
+    return ss.str();
+}
+
+std::string OutputFormatter::format_csv_atomics(const std::string& std_atomics,
+                                                const std::vector<AtomicTests::Result>& results) {
+    std::stringstream ss;
+    ss << "# Atomic Throughput (std::atomic: " << std_atomics << ")\n"
+       << "Operation,Ordering,Line,Implementation,Threads,Ops per Thread,Total (Mops/s),ns per Op,"
+       << "Scaling vs 1 Thread,Verified\n";
+
+    for(const auto& result : results) {
+        ss << AtomicTests::operation_to_string(result.config.op) << ","
+           << AtomicTests::ordering_to_string(result.config.ordering) << ","
+           << AtomicTests::sharing_to_string(result.config.sharing) << ","
+           << AtomicTests::implementation_to_string(result.config.impl) << "," << result.num_threads << ","
+           << result.config.ops_per_thread << "," << std::fixed << std::setprecision(1) << result.total_mops << ","
+           << std::setprecision(2) << result.ns_per_op << "," << atomic_scaling(results, result) << ","
+           << (result.verified ? "true" : "false") << "\n";
+    }
+    ss << "\n";
+
+    return ss.str();
+}
+
+std::string OutputFormatter::format_csv_allocator_results(const std::vector<AllocatorBench::Result>& results) {
+    std::stringstream ss;
+    ss << "# Allocator Benchmark\n"
+       << "Workload,Allocator,Threads,Pairs,Total (Mops/s),ns per Pair,Live Set (bytes),RSS Growth (bytes),Note\n";
+
+    for(const auto& result : results) {
+        ss << AllocatorBench::workload_to_string(result.workload) << ",\"" << result.allocator << "\","
+           << result.num_threads << ",";
+        if(result.available) {
+            ss << result.ops << "," << std::fixed << std::setprecision(1) << result.total_mops << ","
+               << std::setprecision(2) << result.ns_per_op << "," << result.live_bytes << ","
+               << result.rss_growth_bytes << ",";
+        } else {
+            ss << ",,,,,";
+        }
+        ss << "\"" << result.note << "\"\n";
+    }
+    ss << "\n";
+
+    return ss.str();
+}
+
+std::string OutputFormatter::format_csv_roofline(const std::string& working_set_desc, const Roofline& roofline) {
+    std::stringstream ss;
+    ss << "# Roofline Ceilings (" << working_set_desc << ")\n"
+       << "Ceiling,Type,Value,Unit,Ridge Intensity (FLOP/byte)\n";
+    for(const auto& ceiling : roofline.ceilings) {
+        ss << "\"" << ceiling.name << "\"," << ceiling.kind << "," << std::fixed << std::setprecision(2) << ceiling.value << ","
+           << (ceiling.kind == "memory" ? "GB/s" : "GFLOP/s") << "," << std::setprecision(3)
+           << ceiling.ridge_intensity << "\n";
+    }
+
+    ss << "\n# Roofline Points (" << working_set_desc << ")\n"
+       << "Level,Working Set (bytes),Arithmetic Intensity (FLOP/byte),GFLOP/s,Bandwidth (GB/s)\n";
+    for(const auto& point : roofline.points) {
+        ss << point.level << "," << point.working_set_bytes << "," << std::fixed << std::setprecision(4)
+           << point.arithmetic_intensity << "," << std::setprecision(2) << point.gflops << ","
+           << point.bandwidth_gbps << "\n";
+    }
+    ss << "\n";
+
+    return ss.str();
+}
+
+std::string OutputFormatter::format_json_io_results(size_t file_size, double clock_ghz,
+                                                    const std::vector<IoTests::Result>& results) {
+    std::stringstream ss;
+    ss << "  {\n"
+       << "    \"io_paths\": true,\n"
+       << "    \"file_bytes\": " << file_size << ",\n"
+       << "    \"core_clock_ghz\": " << std::fixed << std::setprecision(2) << clock_ghz << ",\n"
+       << "    \"results\": [\n";
+
+    for(size_t i = 0; i < results.size(); ++i) {
+        const IoTests::Result& result = results[i];
+        ss << "      {\"method\": \"" << IoTests::method_to_string(result.method)
+           << "\", \"block_bytes\": " << result.block_size << ", \"queue_depth\": " << result.queue_depth
+           << ", \"available\": " << (result.available ? "true" : "false");
+        if(result.available) {
+            ss << ", \"bandwidth_gbps\": " << std::fixed << std::setprecision(2) << result.stats.bandwidth_gbps
+               << ", \"latency_ns\": " << std::setprecision(1) << result.stats.latency_ns
+               << ", \"cpu_seconds\": " << std::setprecision(6) << result.cpu_seconds
+               << ", \"cycles_per_byte\": " << std::setprecision(3) << result.cycles_per_byte;
+        }
+        if(!result.note.empty()) {
+            ss << ", \"note\": \"" << result.note << "\"";
+        }
+        ss << "}";
+        if(i < results.size() - 1)
+            ss << ",";
+        ss << "\n";
+    }
+
+    ss << "    ]\n"
+       << "  }";
+
+    return ss.str();
+}
+
+std::string OutputFormatter::format_csv_io_results(size_t file_size, double clock_ghz,
+                                                   const std::vector<IoTests::Result>& results) {
+    std::stringstream ss;
+    ss << "# I/O Paths (file " << file_size << " bytes, core clock " << std::fixed << std::setprecision(2)
+       << clock_ghz << " GHz)\n"
+       << "Method,Block (bytes),Queue Depth,Bandwidth (GB/s),Latency (ns),Cycles/Byte,Note\n";
+    for(const auto& result : results) {
+        ss << IoTests::method_to_string(result.method) << "," << result.block_size << "," << result.queue_depth
+           << ",";
+        if(result.available) {
+            ss << std::fixed << std::setprecision(2) << result.stats.bandwidth_gbps << "," << std::setprecision(1)
+               << result.stats.latency_ns << "," << std::setprecision(3) << result.cycles_per_byte;
+        } else {
+            ss << ",,";
+        }
+        ss << ",\"" << result.note << "\"\n";
+    }
+    ss << "\n";
+
+    return ss.str();
+}
+
+std::string OutputFormatter::format_json_mapping_results(const std::vector<MappingTests::Result>& results) {
+    std::stringstream ss;
+    ss << "  {\n"
+       << "    \"mapping\": true,\n"
+       << "    \"page_bytes\": " << MappingTests::page_bytes() << ",\n"
+       << "    \"results\": [\n";
+
+    for(size_t i = 0; i < results.size(); ++i) {
+        const MappingTests::Result& result = results[i];
+        ss << "      {\"operation\": \"" << MappingTests::operation_to_string(result.op)
+           << "\", \"num_threads\": " << result.num_threads << ", \"bytes\": " << result.bytes
+           << ", \"available\": " << (result.available ? "true" : "false");
+        if(result.available) {
+            ss << ", \"pages\": " << result.pages << ", \"calls\": " << result.calls << ", \"seconds\": "
+               << std::fixed << std::setprecision(6) << result.seconds << ", \"ns_per_page\": "
+               << std::setprecision(1) << result.ns_per_page << ", \"pages_per_second\": " << std::setprecision(0)
+               << result.pages_per_second << ", \"us_per_call\": " << std::setprecision(2) << result.us_per_call
+               << ", \"minor_faults\": " << result.minor_faults;
+        } else {
+            ss << ", \"note\": " << Json::quote(result.note);
+        }
+        ss << "}";
+        if(i < results.size() - 1)
+            ss << ",";
+        ss << "\n";
+    }
+
+    ss << "    ]\n"
+       << "  }";
+
+    return ss.str();
+}
+
+std::string OutputFormatter::format_json_tlb_results(const std::vector<TlbSweep::Curve>& curves) {
+    std::stringstream ss;
+    ss << "  {\n"
+       << "    \"tlb\": true,\n"
+       << "    \"curves\": [\n";
+
+    for(size_t i = 0; i < curves.size(); ++i) {
+        const TlbSweep::Curve& curve = curves[i];
+        ss << "      {\n"
+           << "        \"pages\": \"" << PageAllocator::page_mode_to_string(curve.mode) << "\",\n"
+           << "        \"page_bytes\": " << curve.page_bytes << ",\n"
+           << "        \"available\": " << (curve.available ? "true" : "false") << ",\n"
+           << "        \"note\": " << Json::quote(curve.note);
+        if(curve.available) {
+            ss << ",\n"
+               << "        \"backing\": " << Json::quote(curve.backing) << ",\n"
+               << "        \"baseline_backing\": " << Json::quote(curve.baseline_backing) << ",\n"
+               << "        \"page_walk_ns\": " << std::fixed << std::setprecision(2) << curve.page_walk_ns << ",\n"
+               << "        \"points\": [\n";
+            for(size_t p = 0; p < curve.points.size(); ++p) {
+                const TlbSweep::Point& point = curve.points[p];
+                ss << "          {\"pages\": " << point.pages << ", \"span_bytes\": " << point.span_bytes
+                   << ", \"latency_ns\": " << std::fixed << std::setprecision(2) << point.latency_ns
+                   << ", \"baseline_ns\": " << point.baseline_ns << ", \"walk_ns\": " << point.walk_ns << "}";
+                if(p < curve.points.size() - 1)
+                    ss << ",";
+                ss << "\n";
+            }
+            ss << "        ],\n"
+               << "        \"levels\": [\n";
+            for(size_t l = 0; l < curve.levels.size(); ++l) {
+                const TlbSweep::Level& level = curve.levels[l];
+                ss << "          {\"level\": " << Json::quote(level.name) << ", \"entries\": " << level.entries
+                   << ", \"reach_bytes\": " << level.reach_bytes << ", \"before_ns\": " << std::fixed
+                   << std::setprecision(2) << level.before_ns << ", \"after_ns\": " << level.after_ns << "}";
+                if(l < curve.levels.size() - 1)
+                    ss << ",";
+                ss << "\n";
+            }
+            ss << "        ]";
+        }
+        ss << "\n      }";
+        if(i < curves.size() - 1)
+            ss << ",";
+        ss << "\n";
+    }
+
+    ss << "    ]\n"
+       << "  }";
+
+    return ss.str();
+}
+
+std::string OutputFormatter::format_json_copy_sweep(const std::vector<CopySweep::Point>& points) {
+    std::stringstream ss;
+    ss << "  {\n"
+       << "    \"memcpy\": true,\n"
+       << "    \"results\": [\n";
+
+    for(size_t i = 0; i < points.size(); ++i) {
+        const CopySweep::Point& point = points[i];
+        ss << "      {\"operation\": \"" << CopySweep::operation_to_string(point.operation)
+           << "\", \"implementation\": \"" << point.implementation << "\", \"source_offset\": "
+           << point.alignment.source_offset << ", \"destination_offset\": " << point.alignment.destination_offset
+           << ", \"bytes\": " << point.bytes << ", \"calls\": " << point.calls << ", \"ns_per_call\": " << std::fixed
+           << std::setprecision(2) << point.ns_per_call << ", \"bandwidth_gbps\": " << point.bandwidth_gbps
+           << ", \"verified\": " << (point.verified ? "true" : "false") << "}";
+        if(i < points.size() - 1)
+            ss << ",";
+        ss << "\n";
+    }
+
+    std::vector<CopySweep::Crossover> crossovers = CopySweep::crossovers(points);
+    ss << "    ],\n"
+       << "    \"crossovers\": [\n";
+    for(size_t i = 0; i < crossovers.size(); ++i) {
+        const CopySweep::Crossover& crossover = crossovers[i];
+        ss << "      {\"operation\": \"" << CopySweep::operation_to_string(crossover.operation)
+           << "\", \"source_offset\": " << crossover.alignment.source_offset << ", \"destination_offset\": "
+           << crossover.alignment.destination_offset << ", \"from_bytes\": " << crossover.from_bytes
+           << ", \"to_bytes\": " << crossover.to_bytes << ", \"implementation\": \"" << crossover.implementation
+           << "\", \"peak_gbps\": " << std::fixed << std::setprecision(2) << crossover.peak_gbps << "}";
+        if(i < crossovers.size() - 1)
+            ss << ",";
+        ss << "\n";
+    }
+    ss << "    ]\n"
+       << "  }";
+
+    return ss.str();
+}
+
+std::string OutputFormatter::format_json_ring_results(const std::vector<RingTransfer::Result>& results) {
+    std::stringstream ss;
+    ss << "  {\n"
+       << "    \"rings\": true,\n"
+       << "    \"results\": [\n";
+
+    for(size_t i = 0; i < results.size(); ++i) {
+        const RingTransfer::Result& result = results[i];
+        ss << "      {\"kind\": \"" << RingTransfer::kind_to_string(result.kind) << "\", \"producer_cpu\": "
+           << result.producer_cpu << ", \"consumer_cpu\": " << result.consumer_cpu << ", \"shared\": \""
+           << RingTransfer::relation_to_string(result.relation) << "\", \"payload_bytes\": " << result.payload_bytes
+           << ", \"slots\": " << result.slots << ", \"messages\": " << result.messages << ", \"seconds\": "
+           << std::fixed << std::setprecision(6) << result.seconds << ", \"bandwidth_gbps\": "
+           << std::setprecision(2) << result.bandwidth_gbps << ", \"messages_per_second\": " << std::setprecision(0)
+           << result.messages_per_second << ", \"handoff_ns\": " << std::setprecision(1) << result.handoff_ns
+           << ", \"verified\": " << (result.verified ? "true" : "false") << "}";
+        if(i < results.size() - 1)
+            ss << ",";
+        ss << "\n";
+    }
+
+    std::vector<RingTransfer::RelationSummary> summaries = RingTransfer::summarize(results);
+    ss << "    ],\n"
+       << "    \"by_shared_level\": [\n";
+    for(size_t i = 0; i < summaries.size(); ++i) {
+        const RingTransfer::RelationSummary& summary = summaries[i];
+        ss << "      {\"kind\": \"" << RingTransfer::kind_to_string(summary.kind) << "\", \"payload_bytes\": "
+           << summary.payload_bytes << ", \"shared\": \"" << RingTransfer::relation_to_string(summary.relation)
+           << "\", \"pairs\": " << summary.pairs << ", \"median_gbps\": " << std::fixed << std::setprecision(2)
+           << summary.median_gbps << ", \"median_handoff_ns\": " << std::setprecision(1)
+           << summary.median_handoff_ns << "}";
+        if(i < summaries.size() - 1)
+            ss << ",";
+        ss << "\n";
+    }
+    ss << "    ]\n"
+       << "  }";
+
+    return ss.str();
+}
+
+std::string OutputFormatter::format_json_trace_replay(const std::string& path, const TraceReplay::Summary& summary,
+                                                      const TraceReplay::ReplayResult& result) {
+    std::stringstream ss;
+    ss << "  {\n"
+       << "    \"trace_replay\": true,\n"
+       << "    \"trace\": " << Json::quote(path) << ",\n"
+       << "    \"records\": " << summary.records << ",\n"
+       << "    \"reads\": " << summary.reads << ",\n"
+       << "    \"writes\": " << summary.writes << ",\n"
+       << "    \"bytes_per_pass\": " << summary.bytes() << ",\n"
+       << "    \"span_bytes\": " << summary.span_bytes << ",\n"
+       << "    \"num_threads\": " << result.threads << ",\n"
+       << "    \"passes\": " << result.passes << ",\n"
+       << "    \"bandwidth_gbps\": " << std::fixed << std::setprecision(2) << result.stats.bandwidth_gbps << ",\n"
+       << "    \"accesses_per_second\": " << std::setprecision(0) << result.accesses_per_second << ",\n"
+       << "    \"latency_ns\": " << std::setprecision(2) << result.replay_ns_per_record << ",\n"
+       << "    \"decode_ns_per_record\": " << result.decode_ns_per_record << ",\n"
+       << "    \"decode_percent\": " << std::setprecision(1) << result.decode_percent << "\n"
+       << "  }";
+
+    return ss.str();
+}
+
+std::string OutputFormatter::format_csv_mapping_results(const std::vector<MappingTests::Result>& results) {
+    std::stringstream ss;
+    ss << "# Mapping Costs (page " << MappingTests::page_bytes() << " bytes)\n"
+       << "Operation,Threads,Mapping (bytes),Pages,Calls,Time (s),ns per Page,Pages/s,us per Call,Minor Faults,Note\n";
+    for(const auto& result : results) {
+        ss << MappingTests::operation_to_string(result.op) << "," << result.num_threads << "," << result.bytes << ",";
+        if(result.available) {
+            ss << result.pages << "," << result.calls << "," << std::fixed << std::setprecision(6) << result.seconds
+               << "," << std::setprecision(1) << result.ns_per_page << "," << std::setprecision(0)
+               << result.pages_per_second << "," << std::setprecision(2) << result.us_per_call << ","
+               << result.minor_faults;
+        } else {
+            ss << ",,,,,,";
+        }
+        ss << ",\"" << result.note << "\"\n";
+    }
+    ss << "\n";
+
+    return ss.str();
+}
+
+std::string OutputFormatter::format_csv_tlb_results(const std::vector<TlbSweep::Curve>& curves) {
+    std::stringstream ss;
+    ss << "# TLB Reach\n"
+       << "Pages,Page Size (bytes),Page Count,Span (bytes),Latency (ns),Baseline (ns),Page Walk (ns),Note\n";
+    for(const auto& curve : curves) {
+        std::string name = PageAllocator::page_mode_to_string(curve.mode);
+        if(!curve.available) {
+            ss << name << "," << curve.page_bytes << ",,,,,,\"" << curve.note << "\"\n";
+            continue;
+        }
+        for(const auto& point : curve.points) {
+            ss << name << "," << curve.page_bytes << "," << point.pages << "," << point.span_bytes << ","
+               << std::fixed << std::setprecision(2) << point.latency_ns << "," << point.baseline_ns << ","
+               << point.walk_ns << ",\"" << curve.note << "\"\n";
+        }
+    }
+
+    ss << "\n# TLB Levels\n"
+       << "Pages,Level,Entries,Reach (bytes),Latency Before (ns),Latency After (ns)\n";
+    for(const auto& curve : curves) {
+        for(const auto& level : curve.levels) {
+            ss << PageAllocator::page_mode_to_string(curve.mode) << "," << level.name << "," << level.entries << ","
+               << level.reach_bytes << "," << std::fixed << std::setprecision(2) << level.before_ns << ","
+               << level.after_ns << "\n";
+        }
+    }
+    ss << "\n";
+
+    return ss.str();
+}
+
+std::string OutputFormatter::format_csv_copy_sweep(const std::vector<CopySweep::Point>& points) {
+    std::stringstream ss;
+    ss << "# Fastest Copy Implementation by Size\n"
+       << "Operation,Source Offset,Destination Offset,From (bytes),To (bytes),Implementation,Peak Bandwidth (GB/s)\n";
+    for(const auto& crossover : CopySweep::crossovers(points)) {
+        ss << CopySweep::operation_to_string(crossover.operation) << "," << crossover.alignment.source_offset << ","
+           << crossover.alignment.destination_offset << "," << crossover.from_bytes << "," << crossover.to_bytes
+           << "," << crossover.implementation << "," << std::fixed << std::setprecision(2) << crossover.peak_gbps
+           << "\n";
+    }
+
+    ss << "\n# Copy Size Classes\n"
+       << "Operation,Implementation,Source Offset,Destination Offset,Size (bytes),Calls,ns/call,Bandwidth (GB/s),"
+          "Verified\n";
+    for(const auto& point : points) {
+        ss << CopySweep::operation_to_string(point.operation) << "," << point.implementation << ","
+           << point.alignment.source_offset << "," << point.alignment.destination_offset << "," << point.bytes << ","
+           << point.calls << "," << std::fixed << std::setprecision(2) << point.ns_per_call << ","
+           << point.bandwidth_gbps << "," << (point.verified ? "yes" : "no") << "\n";
+    }
+
+    return ss.str();
+}
+
+std::string OutputFormatter::format_csv_ring_results(const std::vector<RingTransfer::Result>& results) {
+    std::stringstream ss;
+    ss << "# Ring Transfers by Shared Level\n"
+       << "Ring,Payload (bytes),Shared,Pairs,Median Bandwidth (GB/s),Median Handoff (ns)\n";
+    for(const auto& summary : RingTransfer::summarize(results)) {
+        ss << RingTransfer::kind_to_string(summary.kind) << "," << summary.payload_bytes << ","
+           << RingTransfer::relation_to_string(summary.relation) << "," << summary.pairs << "," << std::fixed
+           << std::setprecision(2) << summary.median_gbps << "," << std::setprecision(1) << summary.median_handoff_ns
+           << "\n";
+    }
+
+    ss << "\n# Ring Transfers\n"
+       << "Ring,Payload (bytes),Producer CPU,Consumer CPU,Shared,Slots,Messages,Time (s),Bandwidth (GB/s),"
+          "Messages/s,Handoff (ns),Verified\n";
+    for(const auto& result : results) {
+        ss << RingTransfer::kind_to_string(result.kind) << "," << result.payload_bytes << "," << result.producer_cpu
+           << "," << result.consumer_cpu << "," << RingTransfer::relation_to_string(result.relation) << ","
+           << result.slots << "," << result.messages << "," << std::fixed << std::setprecision(6) << result.seconds
+           << "," << std::setprecision(2) << result.bandwidth_gbps << "," << std::setprecision(0)
+           << result.messages_per_second << "," << std::setprecision(1) << result.handoff_ns << ","
+           << (result.verified ? "yes" : "no") << "\n";
+    }
+    ss << "\n";
+
+    return ss.str();
+}
+
+std::string OutputFormatter::format_csv_trace_replay(const std::string& path, const TraceReplay::Summary& summary,
+                                                     const TraceReplay::ReplayResult& result) {
+    std::stringstream ss;
+    ss << "# Trace Replay (" << path << ")\n"
+       << "Records,Reads,Writes,Bytes/Pass,Span (bytes),Threads,Passes,Bandwidth (GB/s),Accesses/s,ns/Access,"
+          "Decode (ns/record),Decode Share (%)\n"
+       << summary.records << "," << summary.reads << "," << summary.writes << "," << summary.bytes() << ","
+       << summary.span_bytes << "," << result.threads << "," << result.passes << "," << std::fixed
+       << std::setprecision(2) << result.stats.bandwidth_gbps << "," << std::setprecision(0)
+       << result.accesses_per_second << "," << std::setprecision(2) << result.replay_ns_per_record << ","
+       << result.decode_ns_per_record << "," << std::setprecision(1) << result.decode_percent << "\n\n";
+
+    return ss.str();
+}
+
+std::string OutputFormatter::format_csv_working_set_sweep(const WorkingSetSweep& sweep) {
+    std::stringstream ss;
+    ss << "# Working-Set Sweep (log2:" << sweep.steps_per_octave << ")\n"
+       << "Working Set (bytes),Bandwidth (GB/s),Latency (ns)\n";
+    for(const auto& point : sweep.points) {
+        ss << point.working_set_bytes << "," << std::fixed << std::setprecision(2) << point.bandwidth_gbps << ","
+           << std::setprecision(1) << point.latency_ns << "\n";
+    }
+
+    ss << "\n# Effective Cache Capacity\n"
+       << "Level,Reported (bytes),Bandwidth Knee (bytes),Latency Knee (bytes)\n";
+    for(const auto& capacity : sweep.capacities) {
+        ss << capacity.level << "," << capacity.reported_bytes << "," << capacity.bandwidth_bytes << ","
+           << capacity.latency_bytes << "\n";
+    }
+    ss << "\n";
+
+    return ss.str();
+}
+
+std::string OutputFormatter::format_json_sample_stats(const TestResult& result, const std::string& indent) {
+    if(result.bandwidth_distribution.count == 0 && result.thread_stats.empty()) {
+        return "";
+    }
+
+    std::stringstream ss;
+    ss << ",\n"
+       << indent << "\"bandwidth_stats\": " << format_json_distribution(result.bandwidth_distribution, 2) << ",\n"
+       << indent << "\"latency_stats\": " << format_json_distribution(result.latency_distribution, 1) << ",\n"
+       << indent << "\"threads\": [";
+
+    for(size_t i = 0; i < result.thread_stats.size(); ++i) {
+        const ThreadStats& thread = result.thread_stats[i];
+        ss << "\n"
+           << indent << "  {\"thread_id\": " << thread.thread_id << ", \"bandwidth_gbps\": " << std::fixed
+           << std::setprecision(2) << thread.stats.bandwidth_gbps << ", \"latency_ns\": " << std::setprecision(1)
+           << thread.stats.latency_ns << ", \"bytes_processed\": " << thread.stats.bytes_processed
+           << ", \"time_seconds\": " << std::setprecision(6) << thread.stats.time_seconds
+           << ", \"bandwidth_stats\": " << format_json_distribution(thread.bandwidth, 2)
+           << ", \"latency_stats\": " << format_json_distribution(thread.latency, 1) << "}";
+        if(i < result.thread_stats.size() - 1)
+            ss << ",";
+    }
+    if(!result.thread_stats.empty()) {
+        ss << "\n" << indent;
+    }
+    ss << "]";
+
+    return ss.str();
+}
+
+std::string OutputFormatter::format_csv_distribution_columns(const TestResult& result) {
+    return format_csv_distribution(result.bandwidth_distribution, 2) + "," +
+           format_csv_distribution(result.latency_distribution, 1) + "," + format_csv_warnings(result);
+}
+
+std::string OutputFormatter::format_markdown_warnings(const std::vector<TestResult>& results) {
+    std::stringstream ss;
+    for(const auto& result : results) {
+        for(const auto& warning : result.warnings) {
+            ss << "- ⚠️ " << result.test_name << " (" << result.working_set_desc << ", " << result.num_threads
+               << " threads): " << warning << "\n";
+        }
+    }
+    if(ss.tellp() == 0) {
+        return "";
+    }
+    return "\n" + ss.str();
+}
+
+std::string OutputFormatter::format_csv_thread_breakdown(const std::vector<TestResult>& results) {
+    bool any_threads = false;
+    for(const auto& result : results) {
+        any_threads = any_threads || !result.thread_stats.empty();
+    }
+    if(!any_threads) {
+        return "";
+    }
+
+    std::stringstream ss;
+    ss << "# Per-Thread Results\n"
+       << "Test,Working Set,Kernel,Stores,Thread,Bandwidth (GB/s),Latency (ns),Bytes,Time (s),"
+       << CSV_THREAD_DISTRIBUTION_HEADER << "\n";
+
+    for(const auto& result : results) {
+        for(const auto& thread : result.thread_stats) {
+            ss << "\"" << result.test_name << "\",\"" << result.working_set_desc << "\"," << result.kernel_name << ","
+               << result.store_policy << "," << thread.thread_id << "," << std::fixed << std::setprecision(2)
+               << thread.stats.bandwidth_gbps << "," << std::setprecision(1) << thread.stats.latency_ns << ","
+               << thread.stats.bytes_processed << "," << std::setprecision(6) << thread.stats.time_seconds << ","
+               << format_csv_distribution(thread.bandwidth, 2) << "\n";
+        }
+    }
+    ss << "\n";
+
+    return ss.str();
+}
+
+std::string OutputFormatter::format_markdown_gemm_compute(const std::vector<TestResult>& results) {
+    if(!has_gemm_stats(results)) {
+        return "";
+    }
+
     std::stringstream ss;
-    ss << "{\n"
-       << "  \"system_info\": {\n"
-       << "    \"cpu_name\": \"" << sys_info.cpu_name << "\",\n"
-       << "    \"total_ram_gb\": " << sys_info.total_ram_gb << ",\n"
-       << "    \"available_ram_gb\": " << sys_info.available_ram_gb << ",\n"
-       << "    \"cpu_cores\": " << sys_info.cpu_cores << ",\n"
-       << "    \"cpu_threads\": " << sys_info.cpu_threads << ",\n"
-       << "    \"cache_line_size\": " << sys_info.cache_line_size << ",\n"
-       << "    \"memory_specs\": {\n"
-       << "      \"type\": \"" << sys_info.memory_specs.type << "\",\n"
-       << "      \"speed_mtps\": " << sys_info.memory_specs.speed_mtps << ",\n"
-       << "      \"data_width_bits\": " << sys_info.memory_specs.data_width_bits << ",\n"
-       << "      \"total_width_bits\": " << sys_info.memory_specs.total_width_bits << ",\n"
-       << "      \"num_channels\": " << sys_info.memory_specs.num_channels << ",\n"
-       << "      \"num_channels_detected\": " << (sys_info.memory_specs.num_channels_detected ? "true" : "false") << ",\n"
-       << "      \"theoretical_bandwidth_gbps\": " << std::fixed << std::setprecision(1)
-       << sys_info.memory_specs.theoretical_bandwidth_gbps << "\n"
-       << "    },\n"
-       << "    \"cache_info\": {\n"
-       << "      \"l1_data_size\": " << sys_info.cache_info.l1_data_size << ",\n"
-       << "      \"l1_instruction_size\": " << sys_info.cache_info.l1_instruction_size << ",\n"
-       << "      \"l2_size\": " << sys_info.cache_info.l2_size << ",\n"
-       << "      \"l3_size\": " << sys_info.cache_info.l3_size << ",\n"
-       << "      \"l1_line_size\": " << sys_info.cache_info.l1_line_size << "\n"
-       << "    }\n"
-       << "  }\n"
-       << "}\n";
+    ss << "\n#### Matrix Multiply Compute\n\n"
+       << "| Test | Working Set | Precision | Accumulate | Backend | Threads | Size | Throughput (G ops/s) | "
+          "Intensity (ops/byte) |\n"
+       << "|------|-------------|-----------|------------|---------|---------|------|----------------------|"
+          "----------------------|\n";
+    for(const auto& result : results) {
+        if(result.gemm.matrix_size == 0) {
+            continue;
+        }
+        ss << "| " << result.test_name << " | " << result.working_set_desc << " | " << result.gemm.precision
+           << " | " << result.gemm.accumulate << " | " << result.kernel_name << " | " << result.num_threads
+           << " | " << result.gemm.matrix_size << " | " << std::fixed << std::setprecision(2) << result.gemm.gops
+           << " | " << result.gemm.arithmetic_intensity << " |\n";
+    }
 
     return ss.str();
 }
 
-std::string OutputFormatter::format_json_header() {
-    return "{\n  \"test_results\": [\n";
+std::string OutputFormatter::format_csv_gemm_compute(const std::vector<TestResult>& results) {
+    if(!has_gemm_stats(results)) {
+        return "";
+    }
+
+    std::stringstream ss;
+    ss << "# Matrix Multiply Compute\n"
+       << "Test,Working Set,Precision,Accumulate,Backend,Threads,Size,Throughput (G ops/s),Intensity (ops/byte)\n";
+    for(const auto& result : results) {
+        if(result.gemm.matrix_size == 0) {
+            continue;
+        }
+        ss << "\"" << result.test_name << "\",\"" << result.working_set_desc << "\"," << result.gemm.precision << ","
+           << result.gemm.accumulate << ",\"" << result.kernel_name << "\"," << result.num_threads << ","
+           << result.gemm.matrix_size << "," << std::fixed << std::setprecision(2) << result.gemm.gops << ","
+           << result.gemm.arithmetic_intensity << "\n";
+    }
+    ss << "\n";
+
+    return ss.str();
 }
 
-std::string OutputFormatter::format_json_test_result(const TestResult& result,
-                                                     const MemorySpecs& mem_specs) {
-    double efficiency =
-        calculate_efficiency(result.stats.bandwidth_gbps, mem_specs.theoretical_bandwidth_gbps);
+std::string OutputFormatter::format_markdown_counters(const std::vector<TestResult>& results) {
+    using PerfCounters::Counter;
+    if(!has_counters(results)) {
+        return "";
+    }
 
     std::stringstream ss;
-    ss << "    {\n"
-       << "      \"test_name\": \"" << result.test_name << "\",\n"
-       << "      \"working_set_desc\": \"" << result.working_set_desc << "\",\n"
-       << "      \"bandwidth_gbps\": " << std::fixed << std::setprecision(2)
-       << result.stats.bandwidth_gbps << ",\n"
-       << "      \"bandwidth_gb_s\": " << std::fixed << std::setprecision(2)
-       << (result.stats.bandwidth_gbps * 8.0) << ",\n"
-       << "      \"latency_ns\": " << std::fixed << std::setprecision(1) << result.stats.latency_ns
-       << ",\n"
-       << "      \"efficiency_percent\": " << std::fixed << std::setprecision(1) << efficiency
-       << ",\n"
-       << "      \"num_threads\": " << result.num_threads << ",\n"
-       << "      \"pattern_name\": \"" << result.pattern_name << "\"\n"
-       << "    }";
+    ss << "\n#### Hardware Counters\n\n"
+       << "| Test | Working Set | Threads | IPC | LLC Misses | LLC-Miss Loads | dTLB Misses | DRAM Read (bytes) | "
+          "DRAM Write (bytes) | DRAM / Nominal |\n"
+       << "|------|-------------|---------|-----|------------|----------------|-------------|-------------------|"
+          "--------------------|----------------|\n";
+    for(const auto& result : results) {
+        if(result.counters.empty()) {
+            continue;
+        }
+        std::stringstream ratio;
+        if(result.counters.has_dram_bytes()) {
+            ratio << std::fixed << std::setprecision(2) << dram_traffic_ratio(result) << "x";
+        } else {
+            ratio << "-";
+        }
+        ss << "| " << result.test_name << " | " << result.working_set_desc << " | " << result.num_threads << " | "
+           << ipc_cell(result.counters) << " | " << counter_cell(result.counters, Counter::LLC_MISSES) << " | "
+           << counter_cell(result.counters, Counter::LLC_MISS_LOADS) << " | "
+           << counter_cell(result.counters, Counter::DTLB_MISSES) << " | "
+           << counter_cell(result.counters, Counter::DRAM_READ_BYTES) << " | "
+           << counter_cell(result.counters, Counter::DRAM_WRITE_BYTES) << " | " << ratio.str() << " |\n";
+    }
 
     return ss.str();
 }
 
-std::string OutputFormatter::format_json_cache_aware_results(const std::string& pattern_name,
-                                                             const std::vector<TestResult>& results,
-                                                             const MemorySpecs& mem_specs) {
+std::string OutputFormatter::format_markdown_page_faults(const std::vector<TestResult>& results) {
+    if(!has_page_faults(results)) {
+        return "";
+    }
+
     std::stringstream ss;
-    ss << "  {\n"
-       << "    \"pattern_name\": \"" << pattern_name << "\",\n"
-       << "    \"cache_aware\": true,\n"
-       << "    \"results\": [\n";
+    ss << "\n#### Page Faults\n\n"
+       << "| Test | Working Set | Threads | Minor Faults | Major Faults | Faults/s |\n"
+       << "|------|-------------|---------|--------------|--------------|----------|\n";
+    for(const auto& result : results) {
+        if(!result.page_faults.measured) {
+            continue;
+        }
+        ss << "| " << result.test_name << " | " << result.working_set_desc << " | " << result.num_threads << " | "
+           << result.page_faults.minor_faults << " | " << result.page_faults.major_faults << " | " << std::fixed
+           << std::setprecision(0) << result.page_faults.faults_per_second << " |\n";
+    }
 
-    for(size_t i = 0; i < results.size(); ++i) {
-        double efficiency = calculate_efficiency(results[i].stats.bandwidth_gbps,
-                                                 mem_specs.theoretical_bandwidth_gbps);
+    return ss.str();
+}
 
-        ss << "      {\n"
-           << "        \"working_set_desc\": \"" << results[i].working_set_desc << "\",\n"
-           << "        \"bandwidth_gbps\": " << std::fixed << std::setprecision(2)
-           << results[i].stats.bandwidth_gbps << ",\n"
-           << "        \"bandwidth_gb_s\": " << std::fixed << std::setprecision(2)
-           << (results[i].stats.bandwidth_gbps * 8.0) << ",\n"
-           << "        \"latency_ns\": " << std::fixed << std::setprecision(1)
-           << results[i].stats.latency_ns << ",\n"
-           << "        \"efficiency_percent\": " << std::fixed << std::setprecision(1) << efficiency
-           << "\n"
-           << "      }";
+std::string OutputFormatter::format_csv_page_faults(const std::vector<TestResult>& results) {
+    if(!has_page_faults(results)) {
+        return "";
+    }
 
-        if(i < results.size() - 1)
-            ss << ",";
-        ss << "\n";
+    std::stringstream ss;
+    ss << "# Page Faults\n"
+       << "Test,Working Set,Threads,Minor Faults,Major Faults,Faults/s\n";
+    for(const auto& result : results) {
+        if(!result.page_faults.measured) {
+            continue;
+        }
+        ss << "\"" << result.test_name << "\",\"" << result.working_set_desc << "\"," << result.num_threads << ","
+           << result.page_faults.minor_faults << "," << result.page_faults.major_faults << "," << std::fixed
+           << std::setprecision(0) << result.page_faults.faults_per_second << "\n";
     }
+    ss << "\n";
 
-    ss << "    ]\n"
-       << "  }";
+    return ss.str();
+}
+
+std::string OutputFormatter::format_markdown_access(const std::vector<TestResult>& results) {
+    if(!has_access(results)) {
+        return "";
+    }
+
+    std::stringstream ss;
+    ss << "\n#### Sparse Access\n\n"
+       << "| Test | Working Set | Threads | Element | Layout | Useful (GB/s) | Lines (GB/s) | Line Use |\n"
+       << "|------|-------------|---------|---------|--------|---------------|--------------|----------|\n";
+    for(const auto& result : results) {
+        if(!result.access.measured) {
+            continue;
+        }
+        ss << "| " << result.test_name << " | " << result.working_set_desc << " | " << result.num_threads << " | "
+           << result.access.element_bytes << " B | " << result.access.layout << " | " << std::fixed
+           << std::setprecision(2) << result.access.useful_gbps << " | " << result.access.line_gbps << " | "
+           << std::setprecision(1) << (result.access.line_use * 100.0) << "% |\n";
+    }
 
     return ss.str();
 }
 
-// CSV formatting methods
-std::string OutputFormatter::format_csv_system_info(const SystemInfo& sys_info) {
+std::string OutputFormatter::format_csv_access(const std::vector<TestResult>& results) {
+    if(!has_access(results)) {
+        return "";
+    }
+
     std::stringstream ss;
-    ss << "# System Information\n"
-       << "CPU," << sys_info.cpu_name << "\n"
-       << "Total RAM (GB)," << sys_info.total_ram_gb << "\n"
-       << "Available RAM (GB)," << sys_info.available_ram_gb << "\n"
-       << "Physical CPU Cores," << sys_info.cpu_cores << "\n"
-       << "Logical CPU Threads," << sys_info.cpu_threads << "\n"
-       << "Cache Line Size (bytes)," << sys_info.cache_line_size << "\n"
-       << "Memory Type," << sys_info.memory_specs.type << "\n"
-       << "Memory Speed (MT/s)," << sys_info.memory_specs.speed_mtps << "\n"
-       << "Data Width (bits)," << sys_info.memory_specs.data_width_bits << "\n"
-       << "Total Width (bits)," << sys_info.memory_specs.total_width_bits << "\n"
-       << "Channels," << sys_info.memory_specs.num_channels;
-    if(sys_info.memory_specs.is_virtualized) {
-        if(sys_info.memory_specs.num_channels == 0) {
-            ss << " (cannot detect)";
-        } else {
-            ss << " (estimated)";
+    ss << "# Sparse Access\n"
+       << "Test,Working Set,Threads,Element (B),Layout,Useful (GB/s),Lines (GB/s),Line Use\n";
+    for(const auto& result : results) {
+        if(!result.access.measured) {
+            continue;
         }
-    } else if(!sys_info.memory_specs.num_channels_detected) {
-        ss << " (not detected)";
+        ss << "\"" << result.test_name << "\",\"" << result.working_set_desc << "\"," << result.num_threads << ","
+           << result.access.element_bytes << "," << result.access.layout << "," << std::fixed << std::setprecision(2)
+           << result.access.useful_gbps << "," << result.access.line_gbps << "," << std::setprecision(3)
+           << result.access.line_use << "\n";
     }
-    ss << "\n"
-       << "Theoretical Bandwidth (GB/s)," << std::fixed << std::setprecision(1)
-       << sys_info.memory_specs.theoretical_bandwidth_gbps << "\n"
-       << "Theoretical Bandwidth (Gb/s)," << std::fixed << std::setprecision(1)
-       << (sys_info.memory_specs.theoretical_bandwidth_gbps * 8.0) << "\n"
-       << "L1 Data Cache (KB)," << (sys_info.cache_info.l1_data_size / 1024) << "\n"
-       << "L1 Instruction Cache (KB)," << (sys_info.cache_info.l1_instruction_size / 1024) << "\n"
-       << "L2 Cache (KB)," << (sys_info.cache_info.l2_size / 1024) << "\n"
-       << "L3 Cache (MB)," << (sys_info.cache_info.l3_size / (1024 * 1024)) << "\n"
-       << "Cache Line Size (bytes)," << sys_info.cache_info.l1_line_size << "\n\n";
+    ss << "\n";
 
     return ss.str();
 }
 
-std::string OutputFormatter::format_csv_header() {
-    return "# Test Results\n"
-           "Test,Working Set,Threads,Bandwidth (GB/s),Bandwidth (Gb/s),Latency (ns),Efficiency "
-           "(%)\n";
+std::string OutputFormatter::format_markdown_decode(const std::vector<TestResult>& results) {
+    if(!has_decode(results)) {
+        return "";
+    }
+
+    std::stringstream ss;
+    ss << "\n#### Decoded Output\n\n"
+       << "| Test | Working Set | Threads | Encoding | Bits | Packed (GB/s) | Gvalues/s | Decoded (GB/s) | Expansion |\n"
+       << "|------|-------------|---------|----------|------|---------------|-----------|----------------|-----------|\n";
+    for(const auto& result : results) {
+        if(!result.decode.measured) {
+            continue;
+        }
+        ss << "| " << result.test_name << " | " << result.working_set_desc << " | " << result.num_threads << " | "
+           << result.decode.encoding << " | " << result.decode.bits << " | " << std::fixed << std::setprecision(2)
+           << result.stats.bandwidth_gbps << " | " << (result.decode.values_per_second / 1e9) << " | "
+           << result.decode.output_gbps << " | " << std::setprecision(1) << result.decode.expansion << "x |\n";
+    }
+
+    return ss.str();
 }
 
-std::string OutputFormatter::format_csv_test_result(const TestResult& result,
-                                                    const MemorySpecs& mem_specs) {
-    double efficiency =
-        calculate_efficiency(result.stats.bandwidth_gbps, mem_specs.theoretical_bandwidth_gbps);
+std::string OutputFormatter::format_csv_decode(const std::vector<TestResult>& results) {
+    if(!has_decode(results)) {
+        return "";
+    }
 
     std::stringstream ss;
-    ss << "\"" << result.test_name << "\","
-       << "\"" << result.working_set_desc << "\"," << result.num_threads << "," << std::fixed
-       << std::setprecision(2) << result.stats.bandwidth_gbps << "," << std::fixed
-       << std::setprecision(2) << (result.stats.bandwidth_gbps * 8.0) << "," << std::fixed
-       << std::setprecision(1) << result.stats.latency_ns << ",";
-    
-    // Handle efficiency display
-    ss << OutputFormatterUtils::format_efficiency_display(efficiency, mem_specs.theoretical_bandwidth_gbps);
+    ss << "# Decoded Output\n"
+       << "Test,Working Set,Threads,Encoding,Bits,Packed (GB/s),Values/s,Decoded (GB/s),Expansion\n";
+    for(const auto& result : results) {
+        if(!result.decode.measured) {
+            continue;
+        }
+        ss << "\"" << result.test_name << "\",\"" << result.working_set_desc << "\"," << result.num_threads << ","
+           << result.decode.encoding << "," << result.decode.bits << "," << std::fixed << std::setprecision(2)
+           << result.stats.bandwidth_gbps << "," << std::setprecision(0) << result.decode.values_per_second << ","
+           << std::setprecision(2) << result.decode.output_gbps << "," << result.decode.expansion << "\n";
+    }
     ss << "\n";
 
     return ss.str();
 }
 
-std::string OutputFormatter::format_csv_cache_aware_results(const std::string& pattern_name,
-                                                            const std::vector<TestResult>& results,
-                                                            const MemorySpecs& mem_specs) {
+std::string OutputFormatter::format_markdown_proxy(const std::vector<TestResult>& results) {
+    if(!has_proxy(results)) {
+        return "";
+    }
+
     std::stringstream ss;
-    ss << "# " << pattern_name << " (Cache-Aware)\n"
-       << "Working Set,Threads,Bandwidth (GB/s),Bandwidth (Gb/s),Latency (ns),Efficiency (%)\n";
+    ss << "\n#### Application Proxies\n\n"
+       << "| Test | Working Set | Threads | Bandwidth (GB/s) | Rate | Bytes/Op | ns/Op |\n"
+       << "|------|-------------|---------|------------------|------|----------|-------|\n";
+    for(const auto& result : results) {
+        if(!result.proxy.measured) {
+            continue;
+        }
+        ss << "| " << result.test_name << " | " << result.working_set_desc << " | " << result.num_threads << " | "
+           << std::fixed << std::setprecision(2) << result.stats.bandwidth_gbps << " | "
+           << (result.proxy.per_second / 1e6) << " M" << result.proxy.unit << "/s | "
+           << result.proxy.bytes_per_operation << " | " << result.stats.latency_ns << " |\n";
+    }
+
+    return ss.str();
+}
+
+std::string OutputFormatter::format_csv_proxy(const std::vector<TestResult>& results) {
+    if(!has_proxy(results)) {
+        return "";
+    }
 
+    std::stringstream ss;
+    ss << "# Application Proxies\n"
+       << "Test,Working Set,Threads,Bandwidth (GB/s),Unit,Per Second,Bytes/Op,ns/Op\n";
     for(const auto& result : results) {
-        double efficiency =
-            calculate_efficiency(result.stats.bandwidth_gbps, mem_specs.theoretical_bandwidth_gbps);
+        if(!result.proxy.measured) {
+            continue;
+        }
+        ss << "\"" << result.test_name << "\",\"" << result.working_set_desc << "\"," << result.num_threads << ","
+           << std::fixed << std::setprecision(2) << result.stats.bandwidth_gbps << "," << result.proxy.unit << ","
+           << std::setprecision(0) << result.proxy.per_second << "," << result.proxy.bytes_per_operation << ","
+           << std::setprecision(2) << result.stats.latency_ns << "\n";
+    }
+    ss << "\n";
 
-        ss << "\"" << result.working_set_desc << "\"," << result.num_threads << "," << std::fixed
-           << std::setprecision(2) << result.stats.bandwidth_gbps << "," << std::fixed
-           << std::setprecision(2) << (result.stats.bandwidth_gbps * 8.0) << "," << std::fixed
-           << std::setprecision(1) << result.stats.latency_ns << ",";
-        
-        // Handle efficiency display
-        ss << OutputFormatterUtils::format_efficiency_display(efficiency, mem_specs.theoretical_bandwidth_gbps);
+    return ss.str();
+}
+
+std::string OutputFormatter::format_markdown_irregular(const std::vector<TestResult>& results) {
+    if(!has_irregular(results)) {
+        return "";
+    }
+
+    std::stringstream ss;
+    ss << "\n#### Irregular Compute\n\n"
+       << "| Test | Working Set | Threads | Effective (GB/s) | GFLOP/s | Triad (GB/s) | Of Triad | Padding |\n"
+       << "|------|-------------|---------|------------------|---------|--------------|----------|---------|\n";
+    for(const auto& result : results) {
+        if(!result.irregular.measured) {
+            continue;
+        }
+        ss << "| " << result.test_name << " | " << result.working_set_desc << " | " << result.num_threads << " | "
+           << std::fixed << std::setprecision(2) << result.stats.bandwidth_gbps << " | " << result.irregular.gflops
+           << " | " << result.irregular.triad_gbps << " | " << std::setprecision(1)
+           << result.irregular.triad_percent << "% | " << result.irregular.padding_percent << "% |\n";
+    }
+
+    return ss.str();
+}
+
+std::string OutputFormatter::format_csv_irregular(const std::vector<TestResult>& results) {
+    if(!has_irregular(results)) {
+        return "";
+    }
+
+    std::stringstream ss;
+    ss << "# Irregular Compute\n"
+       << "Test,Working Set,Threads,Effective (GB/s),GFLOP/s,Triad (GB/s),Of Triad (%),Padding (%)\n";
+    for(const auto& result : results) {
+        if(!result.irregular.measured) {
+            continue;
+        }
+        ss << "\"" << result.test_name << "\",\"" << result.working_set_desc << "\"," << result.num_threads << ","
+           << std::fixed << std::setprecision(2) << result.stats.bandwidth_gbps << ","
+           << std::setprecision(3) << result.irregular.gflops << "," << std::setprecision(2)
+           << result.irregular.triad_gbps << "," << std::setprecision(1) << result.irregular.triad_percent << ","
+           << result.irregular.padding_percent << "\n";
+    }
+    ss << "\n";
+
+    return ss.str();
+}
+
+std::string OutputFormatter::format_markdown_energy(const std::vector<TestResult>& results) {
+    if(!has_energy(results)) {
+        return "";
+    }
+
+    std::stringstream ss;
+    ss << "\n#### Energy\n\n"
+       << "| Test | Working Set | Threads | Bandwidth (GB/s) | Package (W) | DRAM (W) | pJ/byte |\n"
+       << "|------|-------------|---------|------------------|-------------|----------|---------|\n";
+    for(const auto& result : results) {
+        if(!result.energy.measured) {
+            continue;
+        }
+        ss << "| " << result.test_name << " | " << result.working_set_desc << " | " << result.num_threads << " | "
+           << std::fixed << std::setprecision(2) << result.stats.bandwidth_gbps << " | "
+           << std::setprecision(1) << result.energy.package_watts << " | ";
+        if(result.energy.has_dram) {
+            ss << result.energy.dram_watts;
+        } else {
+            ss << "-";
+        }
+        ss << " | " << result.energy.pj_per_byte << " |\n";
+    }
+
+    return ss.str();
+}
+
+std::string OutputFormatter::format_csv_energy(const std::vector<TestResult>& results) {
+    if(!has_energy(results)) {
+        return "";
+    }
+
+    std::stringstream ss;
+    ss << "# Energy\n"
+       << "Test,Working Set,Threads,Bandwidth (GB/s),Package (J),DRAM (J),Seconds,Package (W),DRAM (W),pJ/byte\n";
+    for(const auto& result : results) {
+        if(!result.energy.measured) {
+            continue;
+        }
+        ss << "\"" << result.test_name << "\",\"" << result.working_set_desc << "\"," << result.num_threads << ","
+           << std::fixed << std::setprecision(2) << result.stats.bandwidth_gbps << "," << std::setprecision(3)
+           << result.energy.package_joules << ",";
+        if(result.energy.has_dram) ss << result.energy.dram_joules;
+        ss << "," << std::setprecision(4) << result.energy.seconds << "," << std::setprecision(2)
+           << result.energy.package_watts << ",";
+        if(result.energy.has_dram) ss << result.energy.dram_watts;
+        ss << "," << result.energy.pj_per_byte << "\n";
+    }
+    ss << "\n";
+
+    return ss.str();
+}
+
+std::string OutputFormatter::format_csv_counters(const std::vector<TestResult>& results) {
+    using PerfCounters::Counter;
+    if(!has_counters(results)) {
+        return "";
+    }
+
+    std::stringstream ss;
+    ss << "# Hardware Counters\n"
+       << "Test,Working Set,Threads,Cycles,Instructions,LLC Misses,LLC-Miss Loads,dTLB Misses,DRAM Read (bytes),"
+          "DRAM Write (bytes),DRAM / Nominal\n";
+    for(const auto& result : results) {
+        if(result.counters.empty()) {
+            continue;
+        }
+        // Uncounted values are left empty so the columns stay numeric
+        auto cell = [&result](Counter counter) {
+            return result.counters.has(counter) ? std::to_string(result.counters.get(counter)) : std::string();
+        };
+        ss << "\"" << result.test_name << "\",\"" << result.working_set_desc << "\"," << result.num_threads << ","
+           << cell(Counter::CYCLES) << "," << cell(Counter::INSTRUCTIONS) << "," << cell(Counter::LLC_MISSES) << ","
+           << cell(Counter::LLC_MISS_LOADS) << "," << cell(Counter::DTLB_MISSES) << ","
+           << cell(Counter::DRAM_READ_BYTES) << "," << cell(Counter::DRAM_WRITE_BYTES) << ",";
+        if(result.counters.has_dram_bytes()) {
+            ss << std::fixed << std::setprecision(3) << dram_traffic_ratio(result);
+        }
         ss << "\n";
     }
     ss << "\n";
@@ -426,18 +4008,18 @@ bool OutputFormatter::validate_test_result(const TestResult& result,
         suspicious = true;
     }
 
-    // 2. Bandwidth exceeds theoretical limits
-    if(result.stats.bandwidth_gbps > mem_specs.theoretical_bandwidth_gbps) {
+    // 2. Unrealistically low latency
+    if(result.stats.latency_ns < BenchmarkConstants::MIN_LATENCY_NS) {
         suspicious = true;
     }
 
-    // 3. Unrealistically low latency
-    if(result.stats.latency_ns < BenchmarkConstants::MIN_LATENCY_NS) {
+    // 3. Zero or negative values
+    if(result.stats.bandwidth_gbps <= 0.0 || result.stats.latency_ns <= 0.0) {
         suspicious = true;
     }
 
-    // 4. Zero or negative values
-    if(result.stats.bandwidth_gbps <= 0.0 || result.stats.latency_ns <= 0.0) {
+    // 4. Level-aware bandwidth ceilings and kernel verification (see ResultValidation)
+    if(!result.warnings.empty()) {
         suspicious = true;
     }
 
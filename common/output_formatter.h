@@ -6,6 +6,26 @@
 
 #include "memory_types.h"
 #include "test_patterns.h"
+#include "sample_stats.h"
+#include "cache_boundaries.h"
+#include "perf_counters.h"
+#include "io_tests.h"
+#include "mapping_tests.h"
+#include "tlb_sweep.h"
+#include "copy_sweep.h"
+#include "memory_tiers.h"
+#include "gpu_bandwidth.h"
+#include "ring_transfer.h"
+#include "trace_replay.h"
+#include "coherence_tests.h"
+#include "atomic_tests.h"
+#include "allocator_bench.h"
+#include "thread_scaling.h"
+#include "contention.h"
+#include "soak.h"
+#include "baseline.h"
+#include "fleet.h"
+#include "peak_calibration.h"
 
 /**
  * @brief Output format enumeration
@@ -18,6 +38,96 @@ enum class OutputFormat {
     CSV        ///< CSV format
 };
 
+/**
+ * @brief Compute-side metrics of a matrix multiply result
+ */
+struct GemmStats {
+    std::string precision;        ///< Operand precision ("FP64", "FP32", "BF16", "FP16", "INT8")
+    std::string accumulate;       ///< Accumulate type ("FP64", "FP32", "INT32")
+    size_t matrix_size = 0;       ///< Edge of the square matrices (0: not a matrix multiply result)
+    double gops = 0.0;            ///< Multiply-add throughput (G FLOP/s, G OP/s for INT8)
+    double arithmetic_intensity = 0.0;  ///< Operations per byte of operand traffic
+};
+
+/**
+ * @brief How a time-budgeted result was measured
+ */
+struct CalibrationStats {
+    size_t iterations = 0;    ///< Calibrated iterations per repetition
+    size_t repetitions = 0;   ///< Repetitions measured (0: fixed iteration count, not calibrated)
+    double ci_percent = 0.0;  ///< 95% confidence half-width of the mean bandwidth (% of mean)
+    bool converged = false;   ///< Confidence target reached within the time budget
+};
+
+/**
+ * @brief Page faults taken by the measured region of a file-backed result
+ */
+struct PageFaultStats {
+    bool measured = false;         ///< Result ran over a file mapping
+    uint64_t minor_faults = 0;     ///< Faults served from the page cache
+    uint64_t major_faults = 0;     ///< Faults that had to read the file
+    double faults_per_second = 0.0;  ///< Minor plus major faults per second of measured time
+};
+
+/**
+ * @brief Useful versus cache-line traffic of a strided, gather or scatter result
+ */
+struct AccessStats {
+    bool measured = false;      ///< Result ran a sparse access pattern
+    size_t element_bytes = 0;   ///< Bytes used per access
+    std::string layout;         ///< Stride or index distribution ("stride:256", "zipf:0.99")
+    double useful_gbps = 0.0;   ///< Element bytes per second
+    double line_gbps = 0.0;     ///< Bytes of the distinct cache lines those accesses touch per second
+    double line_use = 0.0;      ///< Share of the touched lines' bytes the accesses read or wrote (0-1)
+};
+
+/**
+ * @brief Decoded output of an encoded-scan result
+ */
+struct DecodeStats {
+    bool measured = false;          ///< Result ran a decode pattern
+    std::string encoding;           ///< "bitpack", "delta" or "dict"
+    unsigned bits = 0;              ///< Width of a packed value
+    double values_per_second = 0.0; ///< Decoded values per second
+    double output_gbps = 0.0;       ///< Decoded bytes per second (4 per value, 8 for dictionary values)
+    double expansion = 0.0;         ///< Decoded bytes per packed byte
+};
+
+/**
+ * @brief Operation rate of an application-proxy result
+ */
+struct ProxyStats {
+    bool measured = false;            ///< Result ran a proxy pattern
+    std::string unit;                 ///< "lookups" or "keys"
+    double per_second = 0.0;          ///< Lookups or keys per second
+    size_t bytes_per_operation = 0;   ///< Bytes the bandwidth counts per lookup or key
+};
+
+/**
+ * @brief Flop rate of an irregular pattern and its effective bandwidth against triad
+ */
+struct IrregularStats {
+    bool measured = false;            ///< Result ran an irregular pattern
+    double gflops = 0.0;              ///< Useful GFLOP/s (2 per nonzero, 8 per stencil point)
+    double triad_gbps = 0.0;          ///< Triad over the same bytes and threads
+    double triad_percent = 0.0;       ///< Effective bandwidth as a percentage of triad_gbps
+    double padding_percent = 0.0;     ///< SELL entries multiplied beyond the nonzeros (0 for CSR and stencil)
+};
+
+/**
+ * @brief Package and DRAM energy of a result's measured regions
+ */
+struct EnergyStats {
+    bool measured = false;        ///< Energy counters were read around the region
+    bool has_dram = false;        ///< A DRAM domain was among them
+    double package_joules = 0.0;
+    double dram_joules = 0.0;
+    double seconds = 0.0;         ///< Time between the two readings
+    double package_watts = 0.0;   ///< Average package power over that time
+    double dram_watts = 0.0;      ///< Average DRAM power (0 without a DRAM domain)
+    double pj_per_byte = 0.0;     ///< Package plus DRAM energy per byte processed, in picojoules
+};
+
 /**
  * @brief Test result structure for output formatting
  *
@@ -30,6 +140,103 @@ struct TestResult {
     PerformanceStats stats;        ///< Performance statistics
     size_t num_threads;            ///< Number of threads used
     std::string pattern_name;      ///< Pattern name
+    std::string kernel_name;       ///< Kernel or backend that ran the inner loop
+    std::string store_policy;      ///< Store policy for write-side patterns ("-" otherwise)
+    DistributionStats bandwidth_distribution;  ///< Per-iteration bandwidth samples of all threads (GB/s)
+    DistributionStats latency_distribution;    ///< Per-iteration latency samples of all threads (ns)
+    std::vector<double> bandwidth_samples;     ///< The per-iteration bandwidth samples themselves (GB/s), for baselines
+    std::vector<ThreadStats> thread_stats;     ///< Per-thread breakdown (empty if not recorded)
+    std::vector<std::string> warnings;         ///< Validation warnings (empty if the result is plausible)
+    GemmStats gemm;                            ///< Matrix multiply compute metrics (matrix_size 0 otherwise)
+    CalibrationStats calibration;              ///< Calibration of time-budgeted runs (repetitions 0 otherwise)
+    PerfCounters::CounterValues counters;      ///< Hardware counters of the measured regions (empty if not counted)
+    PageFaultStats page_faults;                ///< Page faults of file-backed runs (measured false otherwise)
+    AccessStats access;                        ///< Useful and line bandwidth of sparse patterns (measured false otherwise)
+    DecodeStats decode;                        ///< Decoded output of encoded scans (measured false otherwise)
+    ProxyStats proxy;                          ///< Lookups or keys per second of proxy patterns (measured false otherwise)
+    IrregularStats irregular;                  ///< GFLOP/s and triad share of irregular patterns (measured false otherwise)
+    EnergyStats energy;                        ///< Package and DRAM energy (measured false if not sampled)
+};
+
+/**
+ * @brief One cell of a NUMA bandwidth/latency matrix
+ */
+struct NumaMatrixEntry {
+    size_t cpu_node;         ///< Node the test threads were bound to
+    size_t memory_node;      ///< Node the buffers were bound to
+    size_t num_threads;      ///< Number of threads used
+    PerformanceStats stats;  ///< Performance statistics
+};
+
+/**
+ * @brief One point of a loaded-latency curve
+ */
+struct LoadedLatencyPoint {
+    size_t load_threads;     ///< Threads generating traffic (0: idle probe)
+    size_t delay_spins;      ///< Pause instructions between two load chunks
+    double bandwidth_gbps;   ///< Bandwidth achieved by the load threads
+    double latency_ns;       ///< Mean probe latency per dependent load
+    DistributionStats latency_distribution;  ///< Per-pass probe latency (ns)
+};
+
+/**
+ * @brief One configuration of a prefetch sweep
+ */
+struct PrefetchPoint {
+    size_t distance_bytes;   ///< Software prefetch distance (0: none)
+    bool hardware_disabled;  ///< Hardware prefetchers were switched off (otherwise left as configured)
+    double bandwidth_gbps;   ///< Achieved bandwidth
+    double latency_ns;       ///< Mean time per access
+    double delta_percent;    ///< Bandwidth change against the first point, the baseline
+};
+
+/**
+ * @brief Roof of a roofline: a bandwidth (memory) or a peak rate (compute)
+ */
+struct RooflineCeiling {
+    std::string name;        ///< Cache level, or compute source and backend
+    std::string kind;        ///< "memory" (value in GB/s) or "compute" (value in GFLOP/s)
+    double value;            ///< Bandwidth or peak rate
+    double ridge_intensity;  ///< FLOP/byte where this memory roof meets the FP64 compute roof (0 for compute)
+};
+
+/**
+ * @brief One measured point of the arithmetic-intensity sweep
+ */
+struct RooflinePoint {
+    std::string level;            ///< Cache level the working set is sized for
+    size_t working_set_bytes;     ///< Total bytes streamed by all threads
+    double arithmetic_intensity;  ///< FLOP per byte of the kernel
+    double gflops;                ///< Achieved FP64 GFLOP/s
+    double bandwidth_gbps;        ///< Achieved bandwidth (GB/s)
+};
+
+/**
+ * @brief Ceilings and sweep points of one roofline
+ */
+struct Roofline {
+    std::vector<RooflineCeiling> ceilings;
+    std::vector<RooflinePoint> points;
+};
+
+/**
+ * @brief One working set of a --sweep run
+ */
+struct SweepPoint {
+    size_t working_set_bytes;  ///< Working set of the single sweep thread
+    double bandwidth_gbps;     ///< Sequential read bandwidth (GB/s)
+    double latency_ns;         ///< Pointer-chase latency (ns)
+};
+
+/**
+ * @brief Curves, knees and effective capacities of a --sweep run
+ */
+struct WorkingSetSweep {
+    size_t steps_per_octave = 0;
+    std::vector<SweepPoint> points;
+    std::vector<CacheBoundaries::Knee> bandwidth_knees;
+    std::vector<CacheBoundaries::Knee> latency_knees;
+    std::vector<CacheBoundaries::EffectiveCapacity> capacities;
 };
 
 /**
@@ -88,6 +295,306 @@ class OutputFormatter {
                                            const std::vector<TestResult>& results,
                                            const MemorySpecs& mem_specs);
 
+    /**
+     * @brief Formats a NUMA matrix for one pattern
+     *
+     * Rows are CPU nodes and columns are memory nodes, so the diagonal is
+     * node-local traffic and everything else crosses the interconnect.
+     *
+     * @param pattern_name Name of the test pattern
+     * @param working_set_desc Working set description
+     * @param entries One entry per (CPU node, memory node) pair
+     * @return Formatted bandwidth and latency matrices
+     */
+    std::string format_numa_matrix(const std::string& pattern_name, const std::string& working_set_desc,
+                                   const std::vector<NumaMatrixEntry>& entries);
+
+    /**
+     * @brief Formats the local:far ratio curve of one pattern
+     *
+     * Each far node gets its curve, with bandwidth relative to local-only
+     * placement and the fastest ratio called out.
+     *
+     * @param pattern_name Name of the test pattern
+     * @param working_set_desc Working set description
+     * @param points One point per far node and ratio
+     * @return Formatted tier curves
+     */
+    std::string format_memory_tiers(const std::string& pattern_name, const std::string& working_set_desc,
+                                    const std::vector<MemoryTiers::Point>& points);
+
+    /**
+     * @brief Formats the GPU unified-memory run of one working set
+     *
+     * Each kernel gets the GPU and CPU bandwidth alone and shared, the share
+     * of its solo bandwidth each side keeps, and the combined bandwidth
+     * against the sum of the two solo runs.
+     *
+     * @param working_set_desc Working set description
+     * @param points One point per kernel
+     * @return Formatted GPU results
+     */
+    std::string format_gpu_bandwidth(const std::string& working_set_desc,
+                                     const std::vector<GpuBandwidth::Point>& points);
+
+    /**
+     * @brief Formats a loaded-latency curve for one load pattern
+     *
+     * Each row pairs the bandwidth the load threads achieved with the probe
+     * latency under that load; utilization is relative to the highest
+     * bandwidth on the curve.
+     *
+     * @param pattern_name Name of the load pattern
+     * @param working_set_desc Working set description
+     * @param points Idle point first, then increasing load
+     * @return Formatted curve
+     */
+    std::string format_loaded_latency(const std::string& pattern_name, const std::string& working_set_desc,
+                                      const std::vector<LoadedLatencyPoint>& points);
+
+    /**
+     * @brief Formats a prefetch sweep for one pattern
+     *
+     * Rows are software prefetch distances, with the hardware prefetchers
+     * as configured and, if they were toggled, switched off; each row
+     * reports its bandwidth change against the first row, and the fastest
+     * configuration is called out.
+     *
+     * @param pattern_name Name of the pattern
+     * @param working_set_desc Working set description
+     * @param points Baseline (no software prefetch, hardware prefetchers as configured) first
+     * @return Formatted sweep
+     */
+    std::string format_prefetch_sweep(const std::string& pattern_name, const std::string& working_set_desc,
+                                      const std::vector<PrefetchPoint>& points);
+
+    /**
+     * @brief Formats a thread-count scaling curve
+     *
+     * Each row reports speedup and per-thread efficiency against the first
+     * row, and the saturation point (the first count within
+     * ThreadScaling::SATURATION_FRACTION of the peak) is called out.
+     *
+     * @param pattern_name Name of the pattern
+     * @param working_set_desc Working set description
+     * @param placement Thread placement of the runs
+     * @param points Annotated points in ascending thread order
+     * @return Formatted curve
+     */
+    std::string format_thread_scaling(const std::string& pattern_name, const std::string& working_set_desc,
+                                      const std::string& placement,
+                                      const std::vector<ThreadScaling::ScalingPoint>& points);
+
+    /**
+     * @brief Formats a contention curve: victim slowdown against aggressor intensity
+     *
+     * Each row pairs the bandwidth the aggressors injected with the victims'
+     * bandwidth, time per access and slowdown against the victims running
+     * alone; the worst slowdown is called out.
+     *
+     * @param victim_name Name of the victim pattern
+     * @param aggressor Aggressor traffic (Contention::aggressor_to_string)
+     * @param working_set_desc Working set description
+     * @param points Victims alone first, then increasing aggressor load
+     * @return Formatted curve
+     */
+    std::string format_contention(const std::string& victim_name, const std::string& aggressor,
+                                  const std::string& working_set_desc,
+                                  const std::vector<Contention::ContentionPoint>& points);
+
+    /**
+     * @brief Formats a soak run: its summary then its bandwidth time series
+     *
+     * Markdown averages the series down to SOAK_TABLE_ROWS rows; JSON and
+     * CSV keep every sample so decay curves can be plotted at full
+     * resolution. Sensors that were not available are left out (markdown)
+     * or reported as 0.
+     *
+     * @param pattern_name Name of the pattern
+     * @param working_set_desc Working set description
+     * @param summary Soak::summarize of the samples
+     * @param samples One sample per interval
+     * @return Formatted soak result
+     */
+    std::string format_soak(const std::string& pattern_name, const std::string& working_set_desc,
+                            const Soak::Summary& summary, const std::vector<Soak::Sample>& samples);
+
+    /**
+     * @brief Formats a comparison of the current results with a stored baseline
+     *
+     * One row per current result with the baseline and current median
+     * bandwidth, the change, the Mann-Whitney p-value and the verdict,
+     * preceded by the fingerprint fields that changed since the baseline
+     * (a kernel update, a lost memory channel) and followed by the count of
+     * regressions.
+     *
+     * @param baseline_desc Host and time the baseline was recorded
+     * @param host_changes Baseline::find_match differences
+     * @param comparisons Baseline::compare_all of the current results
+     * @return Formatted comparison
+     */
+    std::string format_baseline_comparison(const std::string& baseline_desc,
+                                           const std::vector<std::string>& host_changes,
+                                           const std::vector<Baseline::Comparison>& comparisons);
+
+    /**
+     * @brief Formats the fleet report of a --coordinate run
+     *
+     * One row per agent with its record count, exit status and clock
+     * offset, the spread of every test over the hosts of each SKU, and the
+     * hosts that sit far from their SKU's median, largest deviation first.
+     *
+     * @param report Fleet::coordinate result
+     * @return Formatted report
+     */
+    std::string format_fleet_report(const Fleet::Report& report);
+
+    /**
+     * @brief Formats the ceilings of a peak calibration
+     *
+     * One row per kernel family with the kernel, store policy and thread
+     * count of its best point and that point's share of the theoretical
+     * peak, followed by the calibrated peak (the best family) later runs
+     * report their efficiency against.
+     *
+     * @param peak Calibration of this host
+     * @param mem_specs Memory specifications for the theoretical peak
+     * @return Formatted calibration
+     */
+    std::string format_peak_calibration(const PeakCalibration::HostPeak& peak, const MemorySpecs& mem_specs);
+
+    /**
+     * @brief Formats kernel shape tuning results (--tune)
+     *
+     * One row per kernel family and working-set level with the fastest loop
+     * shape, its bandwidth and its gain over the automatic kernel's own loop.
+     *
+     * @param peak Host entry whose shapes were just tuned
+     * @return Formatted tuning
+     */
+    std::string format_tuning(const PeakCalibration::HostPeak& peak);
+
+    /**
+     * @brief Formats a core-to-core transfer latency matrix
+     *
+     * Rows are the initiating CPU, columns the responding CPU, cells the
+     * one-way latency in ns; the fastest, median and slowest pairs follow.
+     *
+     * @param cpus CPUs of the matrix, in row order
+     * @param matrix Row-major cells from CoherenceTests::measure_core_to_core
+     * @return Formatted matrix
+     */
+    std::string format_core_to_core(const std::vector<size_t>& cpus,
+                                    const std::vector<CoherenceTests::PingPongResult>& matrix);
+
+    /**
+     * @brief Formats false-sharing runs, packed counters next to padded ones
+     *
+     * Each packed row reports its slowdown against the padded row with the
+     * same thread count.
+     *
+     * @param results Runs of CoherenceTests::measure_false_sharing
+     * @return Formatted comparison
+     */
+    std::string format_false_sharing(const std::vector<CoherenceTests::FalseSharingResult>& results);
+
+    /**
+     * @brief Formats atomic read-modify-write throughput runs
+     *
+     * Each row reports its total throughput against the single-thread row
+     * of the same operation, ordering, line and implementation.
+     *
+     * @param std_atomics How std::atomic was compiled (AtomicTests::describe_std_atomics)
+     * @param results Runs of AtomicTests::run
+     * @return Formatted table
+     */
+    std::string format_atomics(const std::string& std_atomics, const std::vector<AtomicTests::Result>& results);
+
+    /**
+     * @brief Formats allocator benchmark runs
+     *
+     * @param results Runs of AllocatorBench::run; skipped runs are listed with their reason
+     * @return Formatted table
+     */
+    std::string format_allocator_results(const std::vector<AllocatorBench::Result>& results);
+
+    /**
+     * @brief Formats a per-machine roofline
+     *
+     * Memory ceilings come first (one per cache level and DRAM), then the
+     * compute ceilings; points follow level by level in increasing
+     * intensity.
+     *
+     * @param working_set_desc Working set description of the DRAM level
+     * @param roofline Ceilings and sweep points
+     * @return Formatted roofline
+     */
+    std::string format_roofline(const std::string& working_set_desc, const Roofline& roofline);
+
+    /**
+     * @brief Formats a working-set sweep with its knees
+     *
+     * The curves come first, then the effective capacity of each reported
+     * cache level next to its detected size, then every knee found.
+     *
+     * @param sweep Sweep points, knees and matched capacities
+     * @return Formatted sweep
+     */
+    std::string format_working_set_sweep(const WorkingSetSweep& sweep);
+
+    /**
+     * @brief Formats the I/O-path comparison of an --io run
+     *
+     * @param file_size Bytes of the file read by every method
+     * @param clock_ghz Estimated core clock used for cycles per byte
+     * @param results One result per method, block size and queue depth
+     * @return Formatted comparison; unavailable paths are listed with their reason
+     */
+    std::string format_io_results(size_t file_size, double clock_ghz, const std::vector<IoTests::Result>& results);
+
+    /**
+     * @brief Formats the mapping operations of a --mapping run
+     *
+     * @param results One result per operation and thread count; unavailable operations are listed with their reason
+     * @return Formatted table
+     */
+    std::string format_mapping_results(const std::vector<MappingTests::Result>& results);
+
+    /**
+     * @brief Formats the page-size sweeps of a --tlb run
+     *
+     * @param curves One curve per page size; unavailable page sizes are listed with their reason
+     * @return Latency per page count, detected TLB levels and the page-walk latency of each page size
+     */
+    std::string format_tlb_results(const std::vector<TlbSweep::Curve>& curves);
+
+    /**
+     * @brief Formats a --memcpy size-class sweep
+     *
+     * @param points One point per operation, alignment, implementation and size
+     * @return Fastest implementation by size class, then the rates at every size
+     */
+    std::string format_copy_sweep(const std::vector<CopySweep::Point>& points);
+
+    /**
+     * @brief Formats the pair transfers of a --rings run
+     *
+     * @param results One result per pair, kind and payload size
+     * @return Medians by the cache level each pair shares, then every pair
+     */
+    std::string format_ring_results(const std::vector<RingTransfer::Result>& results);
+
+    /**
+     * @brief Formats the replay of a --trace file
+     *
+     * @param path Trace file
+     * @param summary Access mix of the trace
+     * @param result Bandwidth, access rate and decode share of the replay
+     * @return Formatted replay
+     */
+    std::string format_trace_replay(const std::string& path, const TraceReplay::Summary& summary,
+                                    const TraceReplay::ReplayResult& result);
+
     /**
      * @brief Formats test completion message
      * @return Formatted completion message
@@ -121,6 +628,232 @@ class OutputFormatter {
                                                const std::vector<TestResult>& results,
                                                const MemorySpecs& mem_specs);
 
+    /**
+     * @brief JSON members for sample distributions and per-thread results
+     * @return Empty if the result carries no samples, else members prefixed with ",\n"
+     */
+    std::string format_json_sample_stats(const TestResult& result, const std::string& indent);
+
+    /**
+     * @brief Trailing CSV columns for the bandwidth and latency distributions
+     */
+    std::string format_csv_distribution_columns(const TestResult& result);
+
+    /**
+     * @brief CSV section with one row per thread of every result (empty if none recorded)
+     */
+    std::string format_csv_thread_breakdown(const std::vector<TestResult>& results);
+
+    /**
+     * @brief Markdown list of the validation warnings of every result (empty if none)
+     */
+    std::string format_markdown_warnings(const std::vector<TestResult>& results);
+
+    /**
+     * @brief Precision, throughput and arithmetic intensity of every matrix multiply result
+     * @return Empty if no result carries GEMM metrics
+     */
+    std::string format_markdown_gemm_compute(const std::vector<TestResult>& results);
+    std::string format_csv_gemm_compute(const std::vector<TestResult>& results);
+
+    /**
+     * @brief Hardware counters of every counted result, with measured DRAM bytes per nominal byte
+     * @return Empty if no result carries counters
+     */
+    std::string format_markdown_counters(const std::vector<TestResult>& results);
+    std::string format_csv_counters(const std::vector<TestResult>& results);
+
+    /**
+     * @brief Minor and major page faults, and fault rate, of every file-backed result
+     * @return Empty if no result ran over a file mapping
+     */
+    std::string format_markdown_page_faults(const std::vector<TestResult>& results);
+    std::string format_csv_page_faults(const std::vector<TestResult>& results);
+
+    /**
+     * @brief Useful versus cache-line bandwidth of every strided, gather and scatter result
+     * @return Empty if no result ran a sparse pattern
+     */
+    std::string format_markdown_access(const std::vector<TestResult>& results);
+    std::string format_csv_access(const std::vector<TestResult>& results);
+    std::string format_markdown_decode(const std::vector<TestResult>& results);
+    std::string format_csv_decode(const std::vector<TestResult>& results);
+
+    /**
+     * @brief Lookups or keys per second of every hash_probe, radix_partition and merge result
+     * @return Empty if no result ran a proxy pattern
+     */
+    std::string format_markdown_proxy(const std::vector<TestResult>& results);
+    std::string format_csv_proxy(const std::vector<TestResult>& results);
+
+    /**
+     * @brief GFLOP/s and triad share of every spmv_csr, spmv_sell and stencil result
+     * @return Empty if no result ran an irregular pattern
+     */
+    std::string format_markdown_irregular(const std::vector<TestResult>& results);
+    std::string format_csv_irregular(const std::vector<TestResult>& results);
+
+    /**
+     * @brief Average power and energy per byte of every result sampled with --energy
+     * @return Empty if no result was sampled
+     */
+    std::string format_markdown_energy(const std::vector<TestResult>& results);
+    std::string format_csv_energy(const std::vector<TestResult>& results);
+
+    std::string format_markdown_numa_matrix(const std::string& pattern_name,
+                                            const std::string& working_set_desc,
+                                            const std::vector<NumaMatrixEntry>& entries);
+    std::string format_json_numa_matrix(const std::string& pattern_name,
+                                        const std::string& working_set_desc,
+                                        const std::vector<NumaMatrixEntry>& entries);
+    std::string format_csv_numa_matrix(const std::string& pattern_name,
+                                       const std::string& working_set_desc,
+                                       const std::vector<NumaMatrixEntry>& entries);
+
+    std::string format_markdown_memory_tiers(const std::string& pattern_name,
+                                             const std::string& working_set_desc,
+                                             const std::vector<MemoryTiers::Point>& points);
+    std::string format_json_memory_tiers(const std::string& pattern_name,
+                                         const std::string& working_set_desc,
+                                         const std::vector<MemoryTiers::Point>& points);
+    std::string format_csv_memory_tiers(const std::string& pattern_name,
+                                        const std::string& working_set_desc,
+                                        const std::vector<MemoryTiers::Point>& points);
+
+    std::string format_markdown_gpu_bandwidth(const std::string& working_set_desc,
+                                              const std::vector<GpuBandwidth::Point>& points);
+    std::string format_json_gpu_bandwidth(const std::string& working_set_desc,
+                                          const std::vector<GpuBandwidth::Point>& points);
+    std::string format_csv_gpu_bandwidth(const std::string& working_set_desc,
+                                         const std::vector<GpuBandwidth::Point>& points);
+
+    std::string format_markdown_loaded_latency(const std::string& pattern_name,
+                                               const std::string& working_set_desc,
+                                               const std::vector<LoadedLatencyPoint>& points);
+    std::string format_json_loaded_latency(const std::string& pattern_name,
+                                           const std::string& working_set_desc,
+                                           const std::vector<LoadedLatencyPoint>& points);
+    std::string format_csv_loaded_latency(const std::string& pattern_name,
+                                          const std::string& working_set_desc,
+                                          const std::vector<LoadedLatencyPoint>& points);
+
+    std::string format_markdown_prefetch_sweep(const std::string& pattern_name,
+                                               const std::string& working_set_desc,
+                                               const std::vector<PrefetchPoint>& points);
+    std::string format_json_prefetch_sweep(const std::string& pattern_name,
+                                           const std::string& working_set_desc,
+                                           const std::vector<PrefetchPoint>& points);
+    std::string format_csv_prefetch_sweep(const std::string& pattern_name,
+                                          const std::string& working_set_desc,
+                                          const std::vector<PrefetchPoint>& points);
+
+    std::string format_markdown_thread_scaling(const std::string& pattern_name, const std::string& working_set_desc,
+                                               const std::string& placement,
+                                               const std::vector<ThreadScaling::ScalingPoint>& points);
+    std::string format_json_thread_scaling(const std::string& pattern_name, const std::string& working_set_desc,
+                                           const std::string& placement,
+                                           const std::vector<ThreadScaling::ScalingPoint>& points);
+    std::string format_csv_thread_scaling(const std::string& pattern_name, const std::string& working_set_desc,
+                                          const std::string& placement,
+                                          const std::vector<ThreadScaling::ScalingPoint>& points);
+
+    std::string format_markdown_contention(const std::string& victim_name, const std::string& aggressor,
+                                           const std::string& working_set_desc,
+                                           const std::vector<Contention::ContentionPoint>& points);
+    std::string format_json_contention(const std::string& victim_name, const std::string& aggressor,
+                                       const std::string& working_set_desc,
+                                       const std::vector<Contention::ContentionPoint>& points);
+    std::string format_csv_contention(const std::string& victim_name, const std::string& aggressor,
+                                      const std::string& working_set_desc,
+                                      const std::vector<Contention::ContentionPoint>& points);
+
+    std::string format_markdown_soak(const std::string& pattern_name, const std::string& working_set_desc,
+                                     const Soak::Summary& summary, const std::vector<Soak::Sample>& samples);
+    std::string format_json_soak(const std::string& pattern_name, const std::string& working_set_desc,
+                                 const Soak::Summary& summary, const std::vector<Soak::Sample>& samples);
+    std::string format_csv_soak(const std::string& pattern_name, const std::string& working_set_desc,
+                                const Soak::Summary& summary, const std::vector<Soak::Sample>& samples);
+
+    std::string format_markdown_fleet_report(const Fleet::Report& report);
+    std::string format_json_fleet_report(const Fleet::Report& report);
+    std::string format_csv_fleet_report(const Fleet::Report& report);
+
+    std::string format_markdown_baseline_comparison(const std::string& baseline_desc,
+                                                    const std::vector<std::string>& host_changes,
+                                                    const std::vector<Baseline::Comparison>& comparisons);
+    std::string format_json_baseline_comparison(const std::string& baseline_desc,
+                                                const std::vector<std::string>& host_changes,
+                                                const std::vector<Baseline::Comparison>& comparisons);
+    std::string format_csv_baseline_comparison(const std::string& baseline_desc,
+                                               const std::vector<std::string>& host_changes,
+                                               const std::vector<Baseline::Comparison>& comparisons);
+
+    std::string format_markdown_peak_calibration(const PeakCalibration::HostPeak& peak,
+                                                 const MemorySpecs& mem_specs);
+    std::string format_json_peak_calibration(const PeakCalibration::HostPeak& peak, const MemorySpecs& mem_specs);
+    std::string format_csv_peak_calibration(const PeakCalibration::HostPeak& peak, const MemorySpecs& mem_specs);
+
+    std::string format_markdown_tuning(const PeakCalibration::HostPeak& peak);
+    std::string format_json_tuning(const PeakCalibration::HostPeak& peak);
+    std::string format_csv_tuning(const PeakCalibration::HostPeak& peak);
+
+    std::string format_markdown_core_to_core(const std::vector<size_t>& cpus,
+                                             const std::vector<CoherenceTests::PingPongResult>& matrix);
+    std::string format_json_core_to_core(const std::vector<size_t>& cpus,
+                                         const std::vector<CoherenceTests::PingPongResult>& matrix);
+    std::string format_csv_core_to_core(const std::vector<size_t>& cpus,
+                                        const std::vector<CoherenceTests::PingPongResult>& matrix);
+
+    std::string format_markdown_false_sharing(const std::vector<CoherenceTests::FalseSharingResult>& results);
+    std::string format_json_false_sharing(const std::vector<CoherenceTests::FalseSharingResult>& results);
+    std::string format_csv_false_sharing(const std::vector<CoherenceTests::FalseSharingResult>& results);
+
+    std::string format_markdown_atomics(const std::string& std_atomics, const std::vector<AtomicTests::Result>& results);
+    std::string format_json_atomics(const std::string& std_atomics, const std::vector<AtomicTests::Result>& results);
+    std::string format_csv_atomics(const std::string& std_atomics, const std::vector<AtomicTests::Result>& results);
+
+    std::string format_markdown_allocator_results(const std::vector<AllocatorBench::Result>& results);
+    std::string format_json_allocator_results(const std::vector<AllocatorBench::Result>& results);
+    std::string format_csv_allocator_results(const std::vector<AllocatorBench::Result>& results);
+
+    std::string format_markdown_roofline(const std::string& working_set_desc, const Roofline& roofline);
+    std::string format_json_roofline(const std::string& working_set_desc, const Roofline& roofline);
+    std::string format_csv_roofline(const std::string& working_set_desc, const Roofline& roofline);
+
+    std::string format_markdown_working_set_sweep(const WorkingSetSweep& sweep);
+    std::string format_json_working_set_sweep(const WorkingSetSweep& sweep);
+    std::string format_csv_working_set_sweep(const WorkingSetSweep& sweep);
+
+    std::string format_markdown_io_results(size_t file_size, double clock_ghz,
+                                           const std::vector<IoTests::Result>& results);
+    std::string format_json_io_results(size_t file_size, double clock_ghz,
+                                       const std::vector<IoTests::Result>& results);
+    std::string format_csv_io_results(size_t file_size, double clock_ghz,
+                                      const std::vector<IoTests::Result>& results);
+
+    std::string format_markdown_mapping_results(const std::vector<MappingTests::Result>& results);
+    std::string format_json_mapping_results(const std::vector<MappingTests::Result>& results);
+    std::string format_csv_mapping_results(const std::vector<MappingTests::Result>& results);
+
+    std::string format_markdown_tlb_results(const std::vector<TlbSweep::Curve>& curves);
+    std::string format_json_tlb_results(const std::vector<TlbSweep::Curve>& curves);
+    std::string format_csv_tlb_results(const std::vector<TlbSweep::Curve>& curves);
+
+    std::string format_markdown_copy_sweep(const std::vector<CopySweep::Point>& points);
+    std::string format_json_copy_sweep(const std::vector<CopySweep::Point>& points);
+    std::string format_csv_copy_sweep(const std::vector<CopySweep::Point>& points);
+
+    std::string format_markdown_ring_results(const std::vector<RingTransfer::Result>& results);
+    std::string format_json_ring_results(const std::vector<RingTransfer::Result>& results);
+    std::string format_csv_ring_results(const std::vector<RingTransfer::Result>& results);
+
+    std::string format_markdown_trace_replay(const std::string& path, const TraceReplay::Summary& summary,
+                                             const TraceReplay::ReplayResult& result);
+    std::string format_json_trace_replay(const std::string& path, const TraceReplay::Summary& summary,
+                                         const TraceReplay::ReplayResult& result);
+    std::string format_csv_trace_replay(const std::string& path, const TraceReplay::Summary& summary,
+                                        const TraceReplay::ReplayResult& result);
+
     /**
      * @brief Calculates efficiency percentage
      * @param bandwidth_gbps Achieved bandwidth in GB/s
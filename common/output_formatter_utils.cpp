@@ -1,5 +1,7 @@
 #include "output_formatter_utils.h"
 
+#include <cmath>
+
 namespace OutputFormatterUtils {
 
 std::string format_basic_system_info(const SystemInfo& sys_info) {
@@ -35,18 +37,19 @@ std::string format_memory_specifications(const MemorySpecs& mem_specs) {
 
     // Handle speed display
     if(mem_specs.speed_mtps > 0) {
-        ss << "- **Speed:** " << mem_specs.speed_mtps << " MT/s ✓\n";
+        ss << "- **Speed:** " << mem_specs.speed_mtps << " MT/s" << (mem_specs.speed_detected ? " ✓" : " (assumed)")
+           << "\n";
     } else {
         ss << "- **Speed:** Not available from system APIs\n";
     }
 
-    // Data width - detected from dmidecode or Apple Silicon specifications
+    // Data width - detected from SMBIOS or Apple Silicon specifications
     ss << "- **Data Width:** " << mem_specs.data_width_bits << " bits";
     if(mem_specs.data_width_detected)
         ss << " ✓";
     ss << "\n";
 
-    // Total width - detected from dmidecode or estimated
+    // Total width - detected from SMBIOS or estimated
     ss << "- **Total Width:** " << mem_specs.total_width_bits << " bits";
     if(mem_specs.total_width_detected)
         ss << " ✓";
@@ -66,21 +69,36 @@ std::string format_memory_specifications(const MemorySpecs& mem_specs) {
     // Note: No checkmark for hardcoded values, even if they're correct
     ss << "\n";
 
+    if(!mem_specs.detection_source.empty()) {
+        ss << "- **Detected From:** " << mem_specs.detection_source << "\n";
+    }
+
     // Handle theoretical bandwidth display
     if(mem_specs.theoretical_bandwidth_gbps < 0) {
-        ss << "- **Theoretical Bandwidth:** N/A (virtualized environment - channels not accessible)\n\n";
+        ss << "- **Theoretical Bandwidth:** N/A (virtualized environment - channels not accessible)\n";
     } else if(mem_specs.theoretical_bandwidth_gbps > 0) {
         ss << "- **Theoretical Bandwidth:** " << std::fixed << std::setprecision(1)
            << mem_specs.theoretical_bandwidth_gbps << " GB/s ("
            << (mem_specs.theoretical_bandwidth_gbps * 8.0) << " Gb/s)";
-        if(mem_specs.speed_mtps > 0 && mem_specs.data_width_bits > 0) {
+        if(mem_specs.speed_detected && mem_specs.num_channels_detected && mem_specs.data_width_bits > 0) {
             ss << " ✓";
         }
-        ss << "\n\n";
+        ss << "\n";
     } else {
-        ss << "- **Theoretical Bandwidth:** Not calculated (speed unknown)\n\n";
+        ss << "- **Theoretical Bandwidth:** Not calculated (speed unknown)\n";
     }
 
+    if(mem_specs.calibrated_bandwidth_gbps > 0) {
+        ss << "- **Calibrated Peak:** " << std::fixed << std::setprecision(1) << mem_specs.calibrated_bandwidth_gbps
+           << " GB/s";
+        if(mem_specs.theoretical_bandwidth_gbps > 0) {
+            ss << ", " << (mem_specs.calibrated_bandwidth_gbps / mem_specs.theoretical_bandwidth_gbps * 100.0)
+               << "% of theoretical";
+        }
+        ss << " (measured " << mem_specs.calibrated_on << ")\n";
+    }
+    ss << "\n";
+
     return ss.str();
 }
 
@@ -92,13 +110,20 @@ std::string format_cache_information(const CacheInfo& cache_info, const MemorySp
     ss << "- **L1 Instruction Cache:** " << (cache_info.l1_instruction_size / 1024)
        << " KB per core ✓\n";
     
+    // Shared caches with several instances (clusters, CCXs) give the size of one instance
+    auto instances = [](const std::vector<std::vector<size_t>>& sharing) {
+        return sharing.size() > 1 ? " (" + std::to_string(sharing.size()) + " instances)" : std::string();
+    };
+
     // Handle L2 cache display based on architecture
     if(mem_specs.is_unified_memory) {
-        ss << "- **L2 Cache:** " << (cache_info.l2_size / 1024) << " KB shared ✓\n";
+        ss << "- **L2 Cache:** " << (cache_info.l2_size / 1024) << " KB shared" << instances(cache_info.l2_sharing)
+           << " ✓\n";
         ss << "- **System Level Cache (SLC):** " << (cache_info.l3_size / (1024 * 1024)) << " MB shared ✓\n";
     } else {
         ss << "- **L2 Cache:** " << (cache_info.l2_size / 1024) << " KB per core ✓\n";
-        ss << "- **L3 Cache:** " << (cache_info.l3_size / (1024 * 1024)) << " MB shared ✓\n";
+        ss << "- **L3 Cache:** " << (cache_info.l3_size / (1024 * 1024)) << " MB shared"
+           << instances(cache_info.l3_sharing) << " ✓\n";
     }
     
     ss << "- **Cache Line Size:** " << cache_info.l1_line_size << " bytes ✓\n\n";
@@ -123,4 +148,22 @@ bool is_memory_type_detected(const std::string& memory_type) {
             memory_type.find("DDR") != std::string::npos);
 }
 
+std::string format_byte_size(size_t bytes) {
+    static const char* const units[] = {"B", "KB", "MB", "GB"};
+    double value = static_cast<double>(bytes);
+    size_t unit = 0;
+    while(value >= 1024.0 && unit < 3) {
+        value /= 1024.0;
+        ++unit;
+    }
+
+    std::stringstream ss;
+    if(value == std::floor(value)) {
+        ss << static_cast<size_t>(value) << units[unit];
+    } else {
+        ss << std::fixed << std::setprecision(1) << value << units[unit];
+    }
+    return ss.str();
+}
+
 } // namespace OutputFormatterUtils
\ No newline at end of file
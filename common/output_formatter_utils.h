@@ -56,6 +56,17 @@ namespace OutputFormatterUtils {
      */
     bool is_memory_type_detected(const std::string& memory_type);
 
+    /**
+     * @brief Format a byte count with the largest fitting binary unit
+     *
+     * Whole values print without decimals ("48KB"), others with one
+     * ("1.5MB").
+     *
+     * @param bytes Size in bytes
+     * @return Formatted size ("B", "KB", "MB" or "GB")
+     */
+    std::string format_byte_size(size_t bytes);
+
 } // namespace OutputFormatterUtils
 
 #endif // OUTPUT_FORMATTER_UTILS_H
\ No newline at end of file
@@ -0,0 +1,400 @@
+#include "page_allocator.h"
+#include "errors.h"
+#include "safe_file_utils.h"
+
+#include <cerrno>
+#include <cstdint>
+#include <cstdlib>
+#include <cstring>
+#include <sstream>
+
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <unistd.h>
+
+#ifdef __APPLE__
+#include <mach/vm_statistics.h>
+#endif
+
+namespace PageAllocator {
+
+namespace {
+
+constexpr size_t SIZE_2M = 2ULL * 1024 * 1024;
+constexpr size_t SIZE_1G = 1024ULL * 1024 * 1024;
+// smaps carries ~25 lines per mapping; large processes exceed the default line cap
+constexpr size_t SMAPS_MAX_LINES = 1 << 20;
+
+size_t round_up(size_t value, size_t multiple) {
+    return (value + multiple - 1) / multiple * multiple;
+}
+
+std::string format_page_size(size_t bytes) {
+    if (bytes >= SIZE_1G && bytes % SIZE_1G == 0) {
+        return std::to_string(bytes / SIZE_1G) + "G";
+    }
+    if (bytes >= 1024 * 1024 && bytes % (1024 * 1024) == 0) {
+        return std::to_string(bytes / (1024 * 1024)) + "M";
+    }
+    return std::to_string(bytes / 1024) + "K";
+}
+
+void* map_anonymous(size_t length, int extra_flags, int fd_flags) {
+#ifdef __linux__
+    (void)fd_flags;
+    return mmap(nullptr, length, PROT_READ | PROT_WRITE, MAP_PRIVATE | MAP_ANONYMOUS | extra_flags, -1, 0);
+#else
+    // macOS passes superpage requests through the fd argument of anonymous mappings
+    (void)extra_flags;
+    return mmap(nullptr, length, PROT_READ | PROT_WRITE, MAP_PRIVATE | MAP_ANON, fd_flags, 0);
+#endif
+}
+
+std::string hugetlb_hint(size_t page_size) {
+    return " (reserve pages with: echo N > /sys/kernel/mm/hugepages/hugepages-" +
+           std::to_string(page_size / 1024) + "kB/nr_hugepages)";
+}
+
+#ifdef __linux__
+// "KernelPageSize:        4 kB"
+size_t parse_kb_field(const std::string& line) {
+    size_t colon = line.find(':');
+    if (colon == std::string::npos) {
+        return 0;
+    }
+    std::istringstream iss(line.substr(colon + 1));
+    size_t kb = 0;
+    iss >> kb;
+    return kb * 1024;
+}
+#endif
+
+}  // namespace
+
+Allocation allocate(size_t size, size_t alignment, PageMode mode) {
+    if (size == 0) {
+        throw MemoryError("Buffer size cannot be zero");
+    }
+    if (size > SIZE_MAX - SIZE_1G) {
+        throw MemoryError("Buffer size would cause overflow");
+    }
+
+    Allocation allocation;
+    allocation.mode = mode;
+    size_t page_size = static_cast<size_t>(sysconf(_SC_PAGESIZE));
+
+    switch (mode) {
+        case PageMode::DEFAULT: {
+            // Over-allocate and align by hand, as the heap only guarantees max_align_t
+            allocation.length = size + alignment;
+            allocation.base = std::malloc(allocation.length);
+            if (allocation.base == nullptr) {
+                throw MemoryError("Failed to allocate " + std::to_string(allocation.length) + " bytes");
+            }
+            uintptr_t addr = reinterpret_cast<uintptr_t>(allocation.base);
+            allocation.usable = reinterpret_cast<void*>((addr + alignment - 1) & ~(alignment - 1));
+            return allocation;
+        }
+
+        case PageMode::SMALL: {
+            allocation.length = round_up(size, page_size);
+            allocation.base = map_anonymous(allocation.length, 0, -1);
+            if (allocation.base == MAP_FAILED) {
+                throw MemoryError("mmap of " + std::to_string(allocation.length) + " bytes failed: " +
+                                  std::strerror(errno));
+            }
+#ifdef __linux__
+            // Keep THP "always" mode from promoting the range behind our back
+            madvise(allocation.base, allocation.length, MADV_NOHUGEPAGE);
+#endif
+            allocation.usable = allocation.base;
+            return allocation;
+        }
+
+        case PageMode::THP: {
+#ifdef __linux__
+            // Map 2 MB of slack so the usable range starts on a huge page boundary
+            size_t usable_length = round_up(size, SIZE_2M);
+            allocation.length = usable_length + SIZE_2M;
+            allocation.base = map_anonymous(allocation.length, 0, -1);
+            if (allocation.base == MAP_FAILED) {
+                throw MemoryError("mmap of " + std::to_string(allocation.length) + " bytes failed: " +
+                                  std::strerror(errno));
+            }
+            uintptr_t addr = reinterpret_cast<uintptr_t>(allocation.base);
+            allocation.usable = reinterpret_cast<void*>((addr + SIZE_2M - 1) & ~(SIZE_2M - 1));
+            if (madvise(allocation.usable, usable_length, MADV_HUGEPAGE) != 0) {
+                int error = errno;
+                release(allocation);
+                throw MemoryError(std::string("madvise(MADV_HUGEPAGE) failed: ") + std::strerror(error) +
+                                  " (is /sys/kernel/mm/transparent_hugepage/enabled set to never?)");
+            }
+            return allocation;
+#else
+            throw MemoryError("Transparent huge pages are only available on Linux; use --pages=2m for superpages");
+#endif
+        }
+
+        case PageMode::HUGE_2M: {
+            allocation.length = round_up(size, SIZE_2M);
+#ifdef __linux__
+            allocation.base = map_anonymous(allocation.length, MAP_HUGETLB | (21 << MAP_HUGE_SHIFT), -1);
+#elif defined(__APPLE__)
+            allocation.base = map_anonymous(allocation.length, 0, VM_FLAGS_SUPERPAGE_SIZE_2MB);
+#else
+            allocation.base = MAP_FAILED;
+            errno = ENOTSUP;
+#endif
+            if (allocation.base == MAP_FAILED) {
+                throw MemoryError("Failed to map " + std::to_string(allocation.length) + " bytes of 2M pages: " +
+                                  std::strerror(errno) +
+#ifdef __linux__
+                                  hugetlb_hint(SIZE_2M)
+#else
+                                  std::string(" (superpages are not supported on every Mac)")
+#endif
+                );
+            }
+            allocation.usable = allocation.base;
+            return allocation;
+        }
+
+        case PageMode::HUGE_1G: {
+#ifdef __linux__
+            allocation.length = round_up(size, SIZE_1G);
+            allocation.base = map_anonymous(allocation.length, MAP_HUGETLB | (30 << MAP_HUGE_SHIFT), -1);
+            if (allocation.base == MAP_FAILED) {
+                throw MemoryError("Failed to map " + std::to_string(allocation.length) + " bytes of 1G pages: " +
+                                  std::strerror(errno) + hugetlb_hint(SIZE_1G));
+            }
+            allocation.usable = allocation.base;
+            return allocation;
+#else
+            throw MemoryError("1G pages are only available on Linux");
+#endif
+        }
+    }
+    throw MemoryError("Unknown page mode");
+}
+
+Allocation allocate_file(size_t size, const FileOptions& options) {
+    if (size == 0) {
+        throw MemoryError("Buffer size cannot be zero");
+    }
+
+    std::string path = options.directory + "/memory_bandwidth.XXXXXX";
+    std::vector<char> path_template(path.begin(), path.end());
+    path_template.push_back('\0');
+    int fd = mkstemp(path_template.data());
+    if (fd < 0) {
+        throw MemoryError("Failed to create a backing file in " + options.directory + ": " + std::strerror(errno));
+    }
+    unlink(path_template.data());  // Only the descriptor keeps the file alive
+
+    Allocation allocation;
+    allocation.fd = fd;
+    allocation.length = round_up(size, static_cast<size_t>(sysconf(_SC_PAGESIZE)));
+    if (ftruncate(fd, static_cast<off_t>(allocation.length)) != 0) {
+        int error = errno;
+        close(fd);
+        throw MemoryError("Failed to size the backing file to " + std::to_string(allocation.length) + " bytes: " +
+                          std::strerror(error));
+    }
+
+    int flags = MAP_SHARED;
+#ifdef MAP_POPULATE
+    if (options.populate) {
+        flags |= MAP_POPULATE;
+    }
+#endif
+    allocation.base = mmap(nullptr, allocation.length, PROT_READ | PROT_WRITE, flags, fd, 0);
+    if (allocation.base == MAP_FAILED) {
+        int error = errno;
+        close(fd);
+        throw MemoryError("mmap of the " + std::to_string(allocation.length) + "-byte backing file failed: " +
+                          std::strerror(error));
+    }
+    allocation.usable = allocation.base;
+
+    int advice = MADV_NORMAL;
+    switch (options.advice) {
+        case FileAdvice::SEQUENTIAL: advice = MADV_SEQUENTIAL; break;
+        case FileAdvice::RANDOM: advice = MADV_RANDOM; break;
+        case FileAdvice::WILLNEED: advice = MADV_WILLNEED; break;
+        case FileAdvice::NORMAL: break;
+    }
+    madvise(allocation.base, allocation.length, advice);
+    return allocation;
+}
+
+void reset_file_pages(const Allocation& allocation, const FileOptions& options) {
+    if (allocation.fd < 0 || options.populate) {
+        return;
+    }
+    if (options.cache == FileCache::COLD) {
+        // Dirty pages cannot be evicted; write the pattern back first
+        msync(allocation.base, allocation.length, MS_SYNC);
+    }
+    madvise(allocation.base, allocation.length, MADV_DONTNEED);
+    if (options.cache == FileCache::COLD) {
+#ifdef __linux__
+        posix_fadvise(allocation.fd, 0, static_cast<off_t>(allocation.length), POSIX_FADV_DONTNEED);
+#else
+        msync(allocation.base, allocation.length, MS_INVALIDATE);
+#endif
+    }
+    if (options.advice == FileAdvice::WILLNEED) {
+        madvise(allocation.base, allocation.length, MADV_WILLNEED);
+    }
+}
+
+void release(Allocation& allocation) noexcept {
+    if (allocation.base == nullptr) {
+        return;
+    }
+    if (allocation.fd >= 0) {
+        munmap(allocation.base, allocation.length);
+        close(allocation.fd);
+        allocation.fd = -1;
+    } else if (allocation.mode == PageMode::DEFAULT) {
+        std::free(allocation.base);
+    } else {
+        munmap(allocation.base, allocation.length);
+    }
+    allocation.base = nullptr;
+    allocation.usable = nullptr;
+    allocation.length = 0;
+}
+
+PageReport query_backing(const void* addr, PageMode mode) {
+    PageReport report;
+#ifdef __linux__
+    (void)mode;
+    std::vector<std::string> lines;
+    if (!SafeFileUtils::read_all_lines("/proc/self/smaps", lines, SMAPS_MAX_LINES)) {
+        return report;
+    }
+
+    uintptr_t target = reinterpret_cast<uintptr_t>(addr);
+    bool in_mapping = false;
+    for (const auto& line : lines) {
+        // Mapping headers start with "start-end perms ..."; field lines start with a name
+        size_t dash = line.find('-');
+        size_t space = line.find(' ');
+        if (dash != std::string::npos && space != std::string::npos && dash < space &&
+            line.find_first_not_of("0123456789abcdef") == dash) {
+            if (in_mapping) {
+                break;  // Finished the mapping we were looking for
+            }
+            uintptr_t start = std::strtoull(line.substr(0, dash).c_str(), nullptr, 16);
+            uintptr_t end = std::strtoull(line.substr(dash + 1, space - dash - 1).c_str(), nullptr, 16);
+            in_mapping = target >= start && target < end;
+            continue;
+        }
+        if (!in_mapping) {
+            continue;
+        }
+        if (line.rfind("KernelPageSize:", 0) == 0) {
+            report.kernel_page_size = parse_kb_field(line);
+            report.available = true;
+        } else if (line.rfind("Rss:", 0) == 0) {
+            report.resident_bytes = parse_kb_field(line);
+        } else if (line.rfind("AnonHugePages:", 0) == 0) {
+            report.anon_huge_bytes = parse_kb_field(line);
+        }
+    }
+#else
+    (void)addr;
+    report.available = true;
+    report.kernel_page_size = (mode == PageMode::HUGE_2M) ? SIZE_2M : static_cast<size_t>(sysconf(_SC_PAGESIZE));
+#endif
+    return report;
+}
+
+std::string describe_backing(const PageReport& report) {
+    if (!report.available) {
+        return "unknown";
+    }
+    if (report.kernel_page_size >= SIZE_2M) {
+        return format_page_size(report.kernel_page_size) + " hugetlb";
+    }
+    std::string description = format_page_size(report.kernel_page_size);
+    if (report.anon_huge_bytes > 0 && report.resident_bytes > 0) {
+        size_t percent = report.anon_huge_bytes * 100 / report.resident_bytes;
+        description += " + " + std::to_string(percent) + "% 2M THP";
+    }
+    return description;
+}
+
+std::string page_mode_to_string(PageMode mode) {
+    switch (mode) {
+        case PageMode::DEFAULT:
+            return "default";
+        case PageMode::SMALL:
+            return "4k";
+        case PageMode::THP:
+            return "thp";
+        case PageMode::HUGE_2M:
+            return "2m";
+        case PageMode::HUGE_1G:
+            return "1g";
+    }
+    return "default";
+}
+
+PageMode string_to_page_mode(const std::string& name) {
+    for (PageMode mode : {PageMode::DEFAULT, PageMode::SMALL, PageMode::THP, PageMode::HUGE_2M, PageMode::HUGE_1G}) {
+        if (page_mode_to_string(mode) == name) {
+            return mode;
+        }
+    }
+
+    std::string valid;
+    for (const auto& mode_name : get_page_mode_names()) {
+        if (!valid.empty()) valid += ", ";
+        valid += mode_name;
+    }
+    throw ArgumentError("Invalid page size '" + name + "'. Valid page sizes: " + valid);
+}
+
+std::string file_advice_to_string(FileAdvice advice) {
+    switch (advice) {
+        case FileAdvice::NORMAL:
+            return "normal";
+        case FileAdvice::SEQUENTIAL:
+            return "sequential";
+        case FileAdvice::RANDOM:
+            return "random";
+        case FileAdvice::WILLNEED:
+            return "willneed";
+    }
+    return "normal";
+}
+
+std::string file_cache_to_string(FileCache cache) {
+    return cache == FileCache::COLD ? "cold" : "warm";
+}
+
+FileAdvice string_to_file_advice(const std::string& name) {
+    for (FileAdvice advice : {FileAdvice::NORMAL, FileAdvice::SEQUENTIAL, FileAdvice::RANDOM, FileAdvice::WILLNEED}) {
+        if (file_advice_to_string(advice) == name) {
+            return advice;
+        }
+    }
+    throw ArgumentError("Invalid madvise mode '" + name + "'. Valid modes: normal, sequential, random, willneed");
+}
+
+FileCache string_to_file_cache(const std::string& name) {
+    for (FileCache cache : {FileCache::WARM, FileCache::COLD}) {
+        if (file_cache_to_string(cache) == name) {
+            return cache;
+        }
+    }
+    throw ArgumentError("Invalid page cache state '" + name + "'. Valid states: warm, cold");
+}
+
+std::vector<std::string> get_page_mode_names() {
+    return {"default", "4k", "thp", "2m", "1g"};
+}
+
+}  // namespace PageAllocator
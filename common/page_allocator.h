@@ -0,0 +1,170 @@
+#ifndef PAGE_ALLOCATOR_H
+#define PAGE_ALLOCATOR_H
+
+#include <cstddef>
+#include <string>
+#include <vector>
+
+/**
+ * @brief Page size requested for benchmark buffers
+ *
+ * Beyond the reach of the L2 TLB, every random or chased access with 4 KB
+ * pages also pays for a page walk. Huge pages move that boundary out by
+ * 512x (2 MB) or 262144x (1 GB).
+ */
+enum class PageMode {
+    DEFAULT,  ///< Heap allocation; the system decides (legacy behavior)
+    SMALL,    ///< mmap with transparent huge pages disabled: base pages only
+    THP,      ///< mmap aligned to 2 MB with MADV_HUGEPAGE (Linux)
+    HUGE_2M,  ///< hugetlbfs 2 MB pages (Linux) or VM_FLAGS_SUPERPAGE_SIZE_2MB (macOS)
+    HUGE_1G   ///< hugetlbfs 1 GB pages (Linux)
+};
+
+/**
+ * @brief Access advice applied to file-backed buffers with madvise
+ */
+enum class FileAdvice {
+    NORMAL,      ///< Kernel default readahead
+    SEQUENTIAL,  ///< MADV_SEQUENTIAL: aggressive readahead, pages dropped behind
+    RANDOM,      ///< MADV_RANDOM: no readahead
+    WILLNEED     ///< MADV_WILLNEED: start reading the whole range before each measurement
+};
+
+/**
+ * @brief Page-cache state a file-backed buffer is returned to before each measurement
+ */
+enum class FileCache {
+    WARM,  ///< Page tables dropped, file pages kept: every first access is a minor fault
+    COLD   ///< Also written back and evicted: first accesses are major faults served by readahead
+};
+
+/**
+ * @brief Backing file of file-backed buffers (disabled while directory is empty)
+ */
+struct FileOptions {
+    std::string directory;  ///< Where the (immediately unlinked) file is created: tmpfs, disk or DAX mount
+    bool populate = false;  ///< MAP_POPULATE and keep page tables: the pre-populated baseline
+    FileAdvice advice = FileAdvice::NORMAL;
+    FileCache cache = FileCache::WARM;
+
+    bool enabled() const { return !directory.empty(); }
+};
+
+/**
+ * @brief Allocation backends for AlignedBuffer
+ *
+ * Every mode other than DEFAULT maps anonymous memory directly, so the
+ * mapping is page aligned and released with munmap. File-backed buffers
+ * are shared mappings of a temporary file and go through the page cache.
+ */
+namespace PageAllocator {
+
+/**
+ * @brief A live allocation and what is needed to release it
+ */
+struct Allocation {
+    void* base = nullptr;     ///< Start of the mapping (or heap block)
+    size_t length = 0;        ///< Bytes mapped, including alignment slack
+    void* usable = nullptr;   ///< First byte available to the caller
+    PageMode mode = PageMode::DEFAULT;  ///< Backend that produced the allocation
+    int fd = -1;              ///< Backing file of a file mapping (-1 for anonymous memory)
+};
+
+/**
+ * @brief Page backing observed for a range after it was touched
+ */
+struct PageReport {
+    bool available = false;       ///< Whether the kernel reported anything for the range
+    size_t kernel_page_size = 0;  ///< Page size of the mapping in bytes (2M/1G for hugetlbfs)
+    size_t resident_bytes = 0;    ///< Resident bytes in the mapping
+    size_t anon_huge_bytes = 0;   ///< Bytes backed by transparent huge pages
+};
+
+/**
+ * @brief Allocate a buffer with the requested page backing
+ *
+ * @param size Bytes required by the caller
+ * @param alignment Alignment of the usable pointer (power of two)
+ * @param mode Page mode
+ * @return Allocation to pass to release()
+ * @throws MemoryError if the backend is unavailable or out of pages
+ */
+Allocation allocate(size_t size, size_t alignment, PageMode mode);
+
+/**
+ * @brief Map a temporary file of the given size
+ *
+ * The file is created in options.directory and unlinked at once, so it
+ * disappears with the mapping. The advice is applied to the whole range.
+ *
+ * @throws MemoryError if the file cannot be created, sized or mapped
+ */
+Allocation allocate_file(size_t size, const FileOptions& options);
+
+/**
+ * @brief Return a file mapping to the requested page-cache state
+ *
+ * Drops the page tables of the range (and writes back and evicts the
+ * file pages for FileCache::COLD), then reissues MADV_WILLNEED. Populated
+ * mappings and anonymous memory are left as they are.
+ */
+void reset_file_pages(const Allocation& allocation, const FileOptions& options);
+
+/**
+ * @brief Command-line names of the file advice and cache modes
+ */
+std::string file_advice_to_string(FileAdvice advice);
+std::string file_cache_to_string(FileCache cache);
+
+/**
+ * @brief Parse a command-line file advice ("normal", "sequential", "random", "willneed")
+ * @throws ArgumentError if the name is unknown
+ */
+FileAdvice string_to_file_advice(const std::string& name);
+
+/**
+ * @brief Parse a command-line page-cache state ("warm", "cold")
+ * @throws ArgumentError if the name is unknown
+ */
+FileCache string_to_file_cache(const std::string& name);
+
+/**
+ * @brief Release an allocation returned by allocate() or allocate_file()
+ */
+void release(Allocation& allocation) noexcept;
+
+/**
+ * @brief Read back how a range is actually backed
+ *
+ * Uses /proc/self/smaps on Linux. Other systems report the mode that was
+ * requested, since they either honor it or fail the allocation.
+ *
+ * @param addr Any address inside the allocation (must already be touched)
+ * @param mode Mode the allocation was made with
+ */
+PageReport query_backing(const void* addr, PageMode mode);
+
+/**
+ * @brief Human-readable page backing such as "2M hugetlb" or "4K + 98% THP"
+ */
+std::string describe_backing(const PageReport& report);
+
+/**
+ * @brief Convert page mode to its command-line name
+ */
+std::string page_mode_to_string(PageMode mode);
+
+/**
+ * @brief Parse a command-line page mode
+ * @throws ArgumentError if the name is unknown
+ */
+PageMode string_to_page_mode(const std::string& name);
+
+/**
+ * @brief All page mode names accepted on the command line
+ */
+std::vector<std::string> get_page_mode_names();
+
+}  // namespace PageAllocator
+
+#endif  // PAGE_ALLOCATOR_H
@@ -0,0 +1,332 @@
+#include "pattern_registry.h"
+#include "standard_tests.h"
+#include "errors.h"
+
+
+namespace PatternRegistry {
+
+namespace {
+
+// Widest vector the streaming kernels load and store (AVX-512); nontemporal stores need it
+constexpr size_t VECTOR_ALIGNMENT = 64;
+
+uint8_t* buffer(const KernelContext& c, size_t index) {
+    return (*c.buffers)[index];
+}
+
+PerformanceStats run_sequential_read(const KernelContext& c) {
+    return StandardTests::sequential_read_test(buffer(c, 0), c.buffer_size, c.start_offset, c.end_offset,
+                                               c.iterations, *c.stop_flag, c.cache_aware, c.kernel, c.samples,
+                                               c.prefetch_distance, c.cold, c.tuned);
+}
+
+PerformanceStats run_sequential_write(const KernelContext& c) {
+    return StandardTests::sequential_write_test(buffer(c, 0), c.buffer_size, c.start_offset, c.end_offset,
+                                                c.iterations, *c.stop_flag, c.kernel, c.store_policy, c.samples,
+                                                c.cold, c.tuned);
+}
+
+PerformanceStats run_random(const KernelContext& c, bool is_write) {
+    return StandardTests::random_access_test(buffer(c, 0), c.buffer_size, c.start_offset, c.end_offset,
+                                             c.iterations, is_write, *c.stop_flag, c.samples, c.prefetch_distance,
+                                             c.cold);
+}
+
+PerformanceStats run_random_read(const KernelContext& c) {
+    return run_random(c, false);
+}
+
+PerformanceStats run_random_write(const KernelContext& c) {
+    return run_random(c, true);
+}
+
+PerformanceStats run_copy(const KernelContext& c) {
+    return StandardTests::copy_test(buffer(c, 0), buffer(c, 1), c.buffer_size, c.start_offset, c.end_offset,
+                                    c.iterations, *c.stop_flag, c.kernel, c.store_policy, c.samples, c.cold);
+}
+
+PerformanceStats run_scale(const KernelContext& c) {
+    return StandardTests::scale_test(buffer(c, 0), buffer(c, 1), c.buffer_size, c.start_offset, c.end_offset,
+                                     c.iterations, *c.stop_flag, c.kernel, c.samples, c.cold);
+}
+
+PerformanceStats run_add(const KernelContext& c) {
+    return StandardTests::add_test(buffer(c, 0), buffer(c, 1), buffer(c, 2), c.buffer_size, c.start_offset,
+                                   c.end_offset, c.iterations, *c.stop_flag, c.kernel, c.samples, c.cold);
+}
+
+PerformanceStats run_triad(const KernelContext& c) {
+    return StandardTests::triad_test(buffer(c, 0), buffer(c, 1), buffer(c, 2), c.buffer_size, c.start_offset,
+                                     c.end_offset, c.iterations, *c.stop_flag, c.kernel, c.store_policy, c.samples,
+                                     c.cold, c.tuned);
+}
+
+PerformanceStats run_streams(const KernelContext& c) {
+    // Destinations first: buffer 0 is rewritten before anything reads it
+    std::vector<uint8_t*> dst(c.buffers->begin(), c.buffers->begin() + c.streams->writes);
+    std::vector<const uint8_t*> src(c.buffers->begin() + c.streams->writes,
+                                    c.buffers->begin() + c.streams->arrays());
+    return StandardTests::streams_test(src, dst, c.buffer_size, c.start_offset, c.end_offset, c.iterations,
+                                       *c.stop_flag, c.kernel, c.samples);
+}
+
+PerformanceStats run_latency_chase(const KernelContext& c) {
+    return StandardTests::latency_chase_test(buffer(c, 0), c.buffer_size, c.start_offset, c.end_offset,
+                                             c.iterations, *c.stop_flag, *c.chase, c.samples, c.cold);
+}
+
+PerformanceStats run_strided(const KernelContext& c) {
+    return StandardTests::strided_read_test(buffer(c, 0), c.buffer_size, c.start_offset, c.end_offset,
+                                            c.iterations, *c.stop_flag, *c.access, c.samples, c.traffic,
+                                            c.prefetch_distance);
+}
+
+PerformanceStats run_gather(const KernelContext& c, bool is_write) {
+    return StandardTests::gather_test(buffer(c, 0), c.buffer_size, c.start_offset, c.end_offset, c.iterations,
+                                      is_write, *c.stop_flag, *c.access, c.kernel, c.samples, c.traffic);
+}
+
+PerformanceStats run_gather_read(const KernelContext& c) {
+    return run_gather(c, false);
+}
+
+PerformanceStats run_scatter(const KernelContext& c) {
+    return run_gather(c, true);
+}
+
+PerformanceStats run_decode(const KernelContext& c, EncodedScans::Encoding encoding) {
+    return StandardTests::decode_scan_test(buffer(c, 0), c.buffer_size, c.start_offset, c.end_offset,
+                                           c.iterations, *c.stop_flag, encoding, c.decode_bits, c.kernel,
+                                           c.samples);
+}
+
+PerformanceStats run_decode_bitpack(const KernelContext& c) {
+    return run_decode(c, EncodedScans::Encoding::BITPACK);
+}
+
+PerformanceStats run_decode_delta(const KernelContext& c) {
+    return run_decode(c, EncodedScans::Encoding::DELTA);
+}
+
+PerformanceStats run_decode_dict(const KernelContext& c) {
+    return run_decode(c, EncodedScans::Encoding::DICTIONARY);
+}
+
+PerformanceStats run_hash_probe(const KernelContext& c) {
+    return StandardTests::hash_probe_test(buffer(c, 0), c.buffer_size, c.start_offset, c.end_offset, c.iterations,
+                                          *c.stop_flag, *c.proxy, c.samples);
+}
+
+PerformanceStats run_radix_partition(const KernelContext& c) {
+    return StandardTests::radix_partition_test(buffer(c, 0), buffer(c, 1), c.buffer_size, c.start_offset,
+                                               c.end_offset, c.iterations, *c.stop_flag, c.samples);
+}
+
+PerformanceStats run_merge(const KernelContext& c) {
+    return StandardTests::merge_test(buffer(c, 0), buffer(c, 1), c.buffer_size, c.start_offset, c.end_offset,
+                                     c.iterations, *c.stop_flag, *c.proxy, c.samples);
+}
+
+PerformanceStats run_spmv(const KernelContext& c, bool sell) {
+    return StandardTests::spmv_test(buffer(c, 0), c.buffer_size, c.start_offset, c.end_offset, c.iterations,
+                                    *c.stop_flag, sell, *c.irregular, c.samples, c.work);
+}
+
+PerformanceStats run_spmv_csr(const KernelContext& c) {
+    return run_spmv(c, false);
+}
+
+PerformanceStats run_spmv_sell(const KernelContext& c) {
+    return run_spmv(c, true);
+}
+
+PerformanceStats run_stencil(const KernelContext& c) {
+    return StandardTests::stencil_test(buffer(c, 0), c.buffer_size, c.start_offset, c.end_offset, c.iterations,
+                                       *c.stop_flag, *c.irregular, c.samples, c.work);
+}
+
+Pattern dense(TestPattern id, const std::string& name, size_t reads, size_t writes, bool store_policy,
+              Kernel run) {
+    Pattern pattern;
+    pattern.id = id;
+    pattern.name = name;
+    pattern.arrays = reads + writes;
+    pattern.reads = reads;
+    pattern.writes = writes;
+    pattern.alignment = VECTOR_ALIGNMENT;
+    pattern.store_policy = store_policy;
+    pattern.in_all = true;
+    pattern.cold = true;
+    pattern.run = run;
+    return pattern;
+}
+
+// Single-array patterns of scattered accesses, run by scalar or index-driven kernels
+Pattern scattered(TestPattern id, const std::string& name, bool is_write, KernelVariants variants, Kernel run) {
+    Pattern pattern;
+    pattern.id = id;
+    pattern.name = name;
+    pattern.reads = is_write ? 0 : 1;
+    pattern.writes = is_write ? 1 : 0;
+    pattern.variants = variants;
+    pattern.run = run;
+    return pattern;
+}
+
+std::vector<Pattern> builtin_patterns() {
+    std::vector<Pattern> patterns;
+    patterns.push_back(dense(TestPattern::SEQUENTIAL_READ, "sequential_read", 1, 0, false, run_sequential_read));
+    patterns.push_back(dense(TestPattern::SEQUENTIAL_WRITE, "sequential_write", 0, 1, true, run_sequential_write));
+
+    Pattern random_read = scattered(TestPattern::RANDOM_READ, "random_read", false, KernelVariants::SCALAR,
+                                    run_random_read);
+    random_read.in_all = true;
+    random_read.cold = true;
+    patterns.push_back(random_read);
+    Pattern random_write = scattered(TestPattern::RANDOM_WRITE, "random_write", true, KernelVariants::SCALAR,
+                                     run_random_write);
+    random_write.in_all = true;
+    random_write.cold = true;
+    patterns.push_back(random_write);
+
+    patterns.push_back(dense(TestPattern::COPY, "copy", 1, 1, true, run_copy));
+    patterns.push_back(dense(TestPattern::SCALE, "scale", 1, 1, false, run_scale));
+    patterns.push_back(dense(TestPattern::ADD, "add", 2, 1, false, run_add));
+    patterns.push_back(dense(TestPattern::TRIAD, "triad", 2, 1, true, run_triad));
+
+    // The tester multiplies matrices of its own; the buffer only sizes them
+    Pattern gemm;
+    gemm.id = TestPattern::MATRIX_MULTIPLY;
+    gemm.name = "matrix_multiply";
+    gemm.variants = KernelVariants::GEMM;
+    gemm.in_all = true;
+    patterns.push_back(gemm);
+
+    // One dependent chain: extra threads would turn idle latency into loaded latency
+    Pattern chase = scattered(TestPattern::LATENCY_CHASE, "latency_chase", false, KernelVariants::CHASE,
+                              run_latency_chase);
+    chase.single_thread = true;
+    chase.in_all = true;
+    chase.cold = true;
+    patterns.push_back(chase);
+
+    Pattern streams = dense(TestPattern::STREAMS, "streams", 0, 0, false, run_streams);
+    streams.in_all = false;
+    streams.cold = false;
+    patterns.push_back(streams);
+
+    Pattern strided = scattered(TestPattern::STRIDED_READ, "strided", false, KernelVariants::SCALAR, run_strided);
+    strided.sparse = true;
+    patterns.push_back(strided);
+    Pattern gather = scattered(TestPattern::GATHER, "gather", false, KernelVariants::GATHER, run_gather_read);
+    gather.alignment = VECTOR_ALIGNMENT;
+    gather.sparse = true;
+    patterns.push_back(gather);
+    Pattern scatter = scattered(TestPattern::SCATTER, "scatter", true, KernelVariants::SCATTER, run_scatter);
+    scatter.alignment = VECTOR_ALIGNMENT;
+    scatter.sparse = true;
+    patterns.push_back(scatter);
+
+    // Column scans: the vector decoders load a full register per group of values
+    Pattern bitpack = scattered(TestPattern::DECODE_BITPACK, "decode_bitpack", false, KernelVariants::DECODE,
+                                run_decode_bitpack);
+    bitpack.encoding = EncodedScans::Encoding::BITPACK;
+    Pattern delta = scattered(TestPattern::DECODE_DELTA, "decode_delta", false, KernelVariants::DECODE,
+                              run_decode_delta);
+    delta.encoding = EncodedScans::Encoding::DELTA;
+    Pattern dict = scattered(TestPattern::DECODE_DICT, "decode_dict", false, KernelVariants::DECODE,
+                             run_decode_dict);
+    dict.encoding = EncodedScans::Encoding::DICTIONARY;
+    for (Pattern* decode : {&bitpack, &delta, &dict}) {
+        decode->alignment = VECTOR_ALIGNMENT;
+        decode->encoded = true;
+        patterns.push_back(*decode);
+    }
+
+    // Application proxies: the inputs are built in the arrays before timing, so --cold does not apply
+    Pattern hash_probe = scattered(TestPattern::HASH_PROBE, "hash_probe", false, KernelVariants::SCALAR,
+                                   run_hash_probe);
+    Pattern partition = dense(TestPattern::RADIX_PARTITION, "radix_partition", 2, 1, false, run_radix_partition);
+    partition.arrays = 2;  // The source is read twice, by the histogram and by the scatter
+    Pattern merge = dense(TestPattern::MULTIWAY_MERGE, "merge", 1, 1, false, run_merge);
+    for (Pattern* proxy : {&hash_probe, &partition, &merge}) {
+        proxy->variants = KernelVariants::SCALAR;
+        proxy->in_all = false;
+        proxy->cold = false;
+        proxy->proxy = true;
+        patterns.push_back(*proxy);
+    }
+
+    // Irregular compute: each slice holds its matrix and vectors, or both stencil grids
+    Pattern csr = scattered(TestPattern::SPMV_CSR, "spmv_csr", false, KernelVariants::SCALAR, run_spmv_csr);
+    Pattern sell = scattered(TestPattern::SPMV_SELL, "spmv_sell", false, KernelVariants::SCALAR, run_spmv_sell);
+    Pattern stencil = scattered(TestPattern::STENCIL_7PT, "stencil", false, KernelVariants::SCALAR, run_stencil);
+    for (Pattern* irregular : {&csr, &sell, &stencil}) {
+        irregular->irregular = true;
+        patterns.push_back(*irregular);
+    }
+    return patterns;
+}
+
+}  // namespace
+
+const std::vector<Pattern>& all() {
+    // Built on first use: static registration objects in an archive are dropped unless referenced
+    static const std::vector<Pattern> patterns = builtin_patterns();
+    return patterns;
+}
+
+const Pattern& get(TestPattern pattern) {
+    for (const auto& registered : all()) {
+        if (registered.id == pattern) {
+            return registered;
+        }
+    }
+    throw ConfigurationError("Pattern '" + get_pattern_name(pattern) + "' is not registered");
+}
+
+const Pattern* find(const std::string& name) {
+    for (const auto& registered : all()) {
+        if (registered.name == name) {
+            return &registered;
+        }
+    }
+    return nullptr;
+}
+
+TestPattern parse(const std::string& name) {
+    const Pattern* pattern = find(name);
+    if (pattern == nullptr) {
+        throw ArgumentError("Unknown pattern '" + name + "'");
+    }
+    return pattern->id;
+}
+
+std::vector<std::string> names() {
+    std::vector<std::string> result;
+    for (const auto& registered : all()) {
+        result.push_back(registered.name);
+    }
+    return result;
+}
+
+std::vector<TestPattern> defaults() {
+    std::vector<TestPattern> result;
+    for (const auto& registered : all()) {
+        if (registered.in_all) {
+            result.push_back(registered.id);
+        }
+    }
+    return result;
+}
+
+size_t arrays(const Pattern& pattern, const StreamCounts& streams) {
+    return pattern.arrays == 0 ? streams.arrays() : pattern.arrays;
+}
+
+size_t bytes_per_pass(const Pattern& pattern, size_t buffer_size, const StreamCounts& streams) {
+    size_t arrays_moved = pattern.arrays == 0 ? streams.arrays() : pattern.reads + pattern.writes;
+    return buffer_size * arrays_moved;
+}
+
+}  // namespace PatternRegistry
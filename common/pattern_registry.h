@@ -0,0 +1,146 @@
+#ifndef PATTERN_REGISTRY_H
+#define PATTERN_REGISTRY_H
+
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <string>
+#include <vector>
+
+#include "test_patterns.h"
+#include "simd_kernels.h"
+#include "pointer_chase.h"
+#include "access_patterns.h"
+#include "encoded_scans.h"
+#include "proxy_kernels.h"
+#include "irregular_kernels.h"
+#include "kernel_matrix.h"
+#include "cold_cache.h"
+
+class SampleRing;
+
+/**
+ * @brief Self-describing test patterns
+ *
+ * Every pattern is one entry of the registry: its command-line name, the
+ * arrays it reads and writes per element, the buffer alignment its kernels
+ * want, which kernel variants run it and the function that runs one thread's
+ * slice. The tester, the argument parser and the allocator read these
+ * properties instead of switching on TestPattern, so adding a pattern means
+ * adding its enum value, its get_pattern_name and one entry in
+ * pattern_registry.cpp.
+ */
+namespace PatternRegistry {
+
+/**
+ * @brief Which kernel runs a pattern, for result labels
+ */
+enum class KernelVariants {
+    SELECTED,  ///< The --kernel (scalar, SSE2, AVX2, AVX-512, NEON, SVE)
+    SCALAR,    ///< Latency-bound: always the scalar loop
+    GATHER,    ///< Hardware gather where the kernel has it, else scalar
+    SCATTER,   ///< Hardware scatter where the kernel has it, else scalar
+    DECODE,    ///< Vector decoders where the kernel has them, else scalar
+    CHASE,     ///< Pointer chase in the --chase mode
+    GEMM       ///< Platform matrix multiplier (run by the tester, which owns the matrices)
+};
+
+/**
+ * @brief Everything one thread needs to run its slice of a pattern
+ */
+struct KernelContext {
+    const std::vector<uint8_t*>* buffers = nullptr;  ///< Arrays of the pattern, buffer 0 first
+    size_t buffer_size = 0;                          ///< Bytes of each array
+    size_t start_offset = 0;                         ///< Slice of this thread within each array
+    size_t end_offset = 0;
+    size_t iterations = 0;
+    const std::atomic<bool>* stop_flag = nullptr;
+    bool cache_aware = false;
+    KernelType kernel = KernelType::AUTO;
+    StorePolicy store_policy = StorePolicy::TEMPORAL;
+    SampleRing* samples = nullptr;
+    size_t prefetch_distance = 0;
+    const PointerChase::ChaseConfig* chase = nullptr;
+    const AccessPatterns::AccessConfig* access = nullptr;
+    const StreamCounts* streams = nullptr;
+    AccessPatterns::LineTraffic* traffic = nullptr;  ///< Useful and line bytes of sparse patterns
+    unsigned decode_bits = EncodedScans::DEFAULT_BITS;  ///< Packed value width of encoded scans
+    const ProxyKernels::Config* proxy = nullptr;     ///< Probe, load factor, batch and ways of proxy patterns
+    const IrregularKernels::Config* irregular = nullptr;  ///< Matrix shape and stencil tile of irregular patterns
+    IrregularKernels::Work* work = nullptr;          ///< Flops and nonzeros of irregular patterns
+    ColdCache::Evictor* cold = nullptr;              ///< Evicts before every pass (--cold; nullptr: warm)
+    const KernelMatrix::Kernel* tuned = nullptr;     ///< Loop shape of read, write and triad (--tune; nullptr: the kernel's)
+};
+
+using Kernel = PerformanceStats (*)(const KernelContext& context);
+
+/**
+ * @brief Properties of one pattern
+ */
+struct Pattern {
+    TestPattern id = TestPattern::SEQUENTIAL_READ;
+    std::string name;              ///< --pattern name
+    size_t arrays = 1;             ///< Arrays to allocate (0: --streams R:W decides)
+    size_t reads = 0;              ///< Arrays read per element, as the kernel accounts its bytes
+    size_t writes = 0;             ///< Arrays written per element
+    size_t alignment = 0;          ///< Buffer alignment the kernels want in bytes (0: a cache line)
+    KernelVariants variants = KernelVariants::SELECTED;
+    bool store_policy = false;     ///< Stores through the policy-specific kernels (--stores)
+    bool sparse = false;           ///< Uses part of each line: reports useful next to line bandwidth
+    bool encoded = false;          ///< Decodes a packed column: reports values/s and decoded bandwidth
+    EncodedScans::Encoding encoding = EncodedScans::Encoding::BITPACK;  ///< Column layout of encoded scans
+    bool proxy = false;            ///< Application proxy: reports lookups/s or keys/s next to bandwidth
+    bool irregular = false;        ///< SpMV or stencil: reports flops and effective bandwidth against triad
+    bool single_thread = false;    ///< Runs on one thread whatever --threads says
+    bool cold = false;             ///< Kernel can evict its arrays between passes (--cold)
+    bool in_all = false;           ///< Part of --pattern all
+    Kernel run = nullptr;          ///< nullptr: run by the tester itself (matrix multiply)
+};
+
+/**
+ * @brief Every pattern, in --help and --pattern all order
+ */
+const std::vector<Pattern>& all();
+
+/**
+ * @brief Properties of a pattern
+ */
+const Pattern& get(TestPattern pattern);
+
+/**
+ * @brief Pattern with a --pattern name (nullptr if none)
+ */
+const Pattern* find(const std::string& name);
+
+/**
+ * @brief Parse a --pattern name of a single pattern
+ * @throws ArgumentError if the name is unknown
+ */
+TestPattern parse(const std::string& name);
+
+/**
+ * @brief --pattern names of every pattern
+ */
+std::vector<std::string> names();
+
+/**
+ * @brief Patterns --pattern all runs, in registry order
+ */
+std::vector<TestPattern> defaults();
+
+/**
+ * @brief Arrays a pattern needs (StreamCounts for the streams pattern)
+ */
+size_t arrays(const Pattern& pattern, const StreamCounts& streams);
+
+/**
+ * @brief Bytes a dense pattern moves per pass over arrays of buffer_size bytes
+ *
+ * Each array read or written counts once, as the kernels account it
+ * (copy moves two arrays, triad three).
+ */
+size_t bytes_per_pass(const Pattern& pattern, size_t buffer_size, const StreamCounts& streams);
+
+}  // namespace PatternRegistry
+
+#endif  // PATTERN_REGISTRY_H
@@ -0,0 +1,244 @@
+#include "peak_calibration.h"
+#include "constants.h"
+#include "errors.h"
+#include "json.h"
+#include "safe_file_utils.h"
+
+#include <algorithm>
+#include <cstdio>
+#include <cstdlib>
+#include <fstream>
+#include <sstream>
+
+namespace PeakCalibration {
+
+namespace {
+
+std::string ceiling_to_json(const Ceiling& ceiling) {
+    return Json::Object()
+        .add_string("family", ceiling.family)
+        .add_string("test_name", ceiling.test_name)
+        .add_string("kernel", ceiling.kernel)
+        .add_string("store_policy", ceiling.store_policy)
+        .add_count("threads", ceiling.threads)
+        .add_number("bandwidth_gbps", ceiling.bandwidth_gbps)
+        .str();
+}
+
+Ceiling ceiling_from_json(const Json::Value& value) {
+    Ceiling ceiling;
+    ceiling.family = value.get_string("family");
+    ceiling.test_name = value.get_string("test_name");
+    ceiling.kernel = value.get_string("kernel");
+    ceiling.store_policy = value.get_string("store_policy");
+    ceiling.threads = static_cast<size_t>(std::max(0.0, value.get_number("threads")));
+    ceiling.bandwidth_gbps = value.get_number("bandwidth_gbps");
+    return ceiling;
+}
+
+std::string shape_to_json(const TunedShape& shape) {
+    return Json::Object()
+        .add_string("family", shape.family)
+        .add_string("level", shape.level)
+        .add_string("shape", shape.shape)
+        .add_count("threads", shape.threads)
+        .add_number("bandwidth_gbps", shape.bandwidth_gbps)
+        .add_number("baseline_gbps", shape.baseline_gbps)
+        .str();
+}
+
+TunedShape shape_from_json(const Json::Value& value) {
+    TunedShape shape;
+    shape.family = value.get_string("family");
+    shape.level = value.get_string("level");
+    shape.shape = value.get_string("shape");
+    shape.threads = static_cast<size_t>(std::max(0.0, value.get_number("threads")));
+    shape.bandwidth_gbps = value.get_number("bandwidth_gbps");
+    shape.baseline_gbps = value.get_number("baseline_gbps");
+    return shape;
+}
+
+}  // namespace
+
+double HostPeak::peak_gbps() const {
+    double peak = 0.0;
+    for (const auto& ceiling : ceilings) {
+        peak = std::max(peak, ceiling.bandwidth_gbps);
+    }
+    return peak;
+}
+
+std::string default_path() {
+    const char* cache_home = std::getenv("XDG_CACHE_HOME");
+    if (cache_home && cache_home[0] != '\0') {
+        return std::string(cache_home) + "/memory-benchmarks/peaks.json";
+    }
+    const char* home = std::getenv("HOME");
+    if (home && home[0] != '\0') {
+        return std::string(home) + "/.cache/memory-benchmarks/peaks.json";
+    }
+    return "";
+}
+
+Ceiling best_point(const std::string& family, const std::string& test_name, const std::string& kernel,
+                   const std::string& store_policy, const std::vector<ThreadScaling::ScalingPoint>& points) {
+    Ceiling ceiling;
+    ceiling.family = family;
+    ceiling.test_name = test_name;
+    ceiling.kernel = kernel;
+    ceiling.store_policy = store_policy;
+    for (const auto& point : points) {
+        if (point.bandwidth_gbps > ceiling.bandwidth_gbps) {
+            ceiling.threads = point.threads;
+            ceiling.bandwidth_gbps = point.bandwidth_gbps;
+        }
+    }
+    return ceiling;
+}
+
+std::vector<Ceiling> best_per_family(const std::vector<Ceiling>& ceilings) {
+    std::vector<Ceiling> best;
+    for (const auto& ceiling : ceilings) {
+        auto same = std::find_if(best.begin(), best.end(),
+                                 [&](const Ceiling& kept) { return kept.family == ceiling.family; });
+        if (same == best.end()) {
+            best.push_back(ceiling);
+        } else if (ceiling.bandwidth_gbps > same->bandwidth_gbps) {
+            *same = ceiling;
+        }
+    }
+    return best;
+}
+
+Store load(const std::string& path) {
+    Store store;
+    std::ifstream file(path);
+    if (!file) {
+        return store;
+    }
+    std::stringstream text;
+    text << file.rdbuf();
+
+    Json::Value root;
+    try {
+        root = Json::parse(text.str());
+    } catch (const ConfigurationError& e) {
+        throw ConfigurationError("Peak file " + path + " is not valid JSON: " + e.what());
+    }
+    const Json::Value* hosts = root.find("hosts");
+    if (!root.find("peak_version") || !hosts || hosts->type != Json::Value::Type::ARRAY) {
+        throw ConfigurationError("Peak file " + path + " has no peak_version and hosts array");
+    }
+    double version = root.get_number("peak_version");
+    if (version > static_cast<double>(BenchmarkConstants::PEAK_CALIBRATION_VERSION)) {
+        throw ConfigurationError("Peak file " + path + " is version " + Json::number(version) +
+                                 "; this build reads up to version " +
+                                 std::to_string(BenchmarkConstants::PEAK_CALIBRATION_VERSION));
+    }
+
+    for (const auto& item : hosts->items) {
+        HostPeak host;
+        host.host_key = item.get_string("host_key");
+        host.pages = item.get_string("pages");
+        host.recorded = item.get_string("recorded");
+        host.working_set = item.get_string("working_set");
+        if (const Json::Value* fingerprint = item.find("host")) {
+            host.host = Ndjson::host_from_json(*fingerprint);
+        }
+        if (const Json::Value* ceilings = item.find("ceilings")) {
+            for (const auto& ceiling : ceilings->items) {
+                host.ceilings.push_back(ceiling_from_json(ceiling));
+            }
+        }
+        // Written since --tune; older files have no shapes
+        host.tuned = item.get_string("tuned");
+        if (const Json::Value* shapes = item.find("shapes")) {
+            for (const auto& shape : shapes->items) {
+                host.shapes.push_back(shape_from_json(shape));
+            }
+        }
+        store.hosts.push_back(host);
+    }
+    return store;
+}
+
+void save(const std::string& path, const Store& store) {
+    std::string directory;
+    if (!SafeFileUtils::make_parent_directories(path, directory)) {
+        throw ConfigurationError("Cannot create directory " + directory + " for peak file " + path);
+    }
+    std::string temporary = path + ".tmp";
+    {
+        std::ofstream file(temporary, std::ios::out | std::ios::trunc);
+        file << "{\n"
+             << "  \"peak_version\": " << BenchmarkConstants::PEAK_CALIBRATION_VERSION << ",\n"
+             << "  \"hosts\": [";
+        for (size_t h = 0; h < store.hosts.size(); ++h) {
+            const HostPeak& host = store.hosts[h];
+            file << (h > 0 ? "," : "") << "\n"
+                 << "    {\n"
+                 << "      \"host_key\": " << Json::quote(host.host_key) << ",\n"
+                 << "      \"recorded\": " << Json::quote(host.recorded) << ",\n"
+                 << "      \"pages\": " << Json::quote(host.pages) << ",\n"
+                 << "      \"working_set\": " << Json::quote(host.working_set) << ",\n"
+                 << "      \"host\": " << Ndjson::host_to_json(host.host) << ",\n"
+                 << "      \"peak_gbps\": " << Json::number(host.peak_gbps()) << ",\n"
+                 << "      \"ceilings\": [";
+            for (size_t i = 0; i < host.ceilings.size(); ++i) {
+                file << (i > 0 ? "," : "") << "\n        " << ceiling_to_json(host.ceilings[i]);
+            }
+            file << "\n      ]";
+            if (!host.shapes.empty()) {
+                file << ",\n      \"tuned\": " << Json::quote(host.tuned) << ",\n"
+                     << "      \"shapes\": [";
+                for (size_t i = 0; i < host.shapes.size(); ++i) {
+                    file << (i > 0 ? "," : "") << "\n        " << shape_to_json(host.shapes[i]);
+                }
+                file << "\n      ]";
+            }
+            file << "\n    }";
+        }
+        file << "\n  ]\n"
+             << "}\n";
+        file.flush();
+        if (!file) {
+            std::remove(temporary.c_str());
+            throw ConfigurationError("Cannot write peak file " + temporary);
+        }
+    }
+    if (std::rename(temporary.c_str(), path.c_str()) != 0) {
+        std::remove(temporary.c_str());
+        throw ConfigurationError("Cannot replace peak file " + path);
+    }
+}
+
+void upsert(Store& store, const HostPeak& host) {
+    HostPeak merged = host;
+    if (const HostPeak* stored = find(store, host.host_key)) {
+        if (merged.ceilings.empty()) {
+            merged.ceilings = stored->ceilings;
+            merged.recorded = stored->recorded;
+            merged.working_set = stored->working_set;
+        }
+        if (merged.shapes.empty()) {
+            merged.shapes = stored->shapes;
+            merged.tuned = stored->tuned;
+        }
+    }
+    store.hosts.erase(std::remove_if(store.hosts.begin(), store.hosts.end(),
+                                     [&](const HostPeak& stored) { return stored.host_key == host.host_key; }),
+                      store.hosts.end());
+    store.hosts.push_back(merged);
+}
+
+const HostPeak* find(const Store& store, const std::string& host_key) {
+    const HostPeak* match = nullptr;
+    for (const auto& stored : store.hosts) {
+        if (stored.host_key == host_key) {
+            match = &stored;
+        }
+    }
+    return match;
+}
+
+}  // namespace PeakCalibration
@@ -0,0 +1,127 @@
+#ifndef PEAK_CALIBRATION_H
+#define PEAK_CALIBRATION_H
+
+#include <cstddef>
+#include <string>
+#include <vector>
+
+#include "ndjson_sink.h"
+#include "thread_scaling.h"
+
+/**
+ * @brief Measured practical bandwidth ceilings per host (--calibrate, --peak-file)
+ *
+ * Speed x width x channels is an upper bound no kernel reaches: refresh,
+ * bank conflicts and read/write turnarounds keep the best streams well below
+ * it, by a margin that differs between platforms. Calibration runs the best
+ * kernel of each family (read, write and copy, each with every store policy
+ * the kernel supports) at every thread count of a sweep, and stores the best
+ * point of each family per host. Later runs on a host with the same key
+ * report their efficiency against both the theoretical and the calibrated
+ * peak, which gives health checks a denominator that is reachable and stable
+ * across runs. Tuning (--tune) stores the fastest loop shape of read, write
+ * and triad per working-set level next to them.
+ */
+namespace PeakCalibration {
+
+/**
+ * @brief Best point of one kernel family
+ */
+struct Ceiling {
+    std::string family;        ///< "read", "write", "copy"
+    std::string test_name;
+    std::string kernel;
+    std::string store_policy;
+    size_t threads = 0;
+    double bandwidth_gbps = 0.0;
+};
+
+/**
+ * @brief Fastest loop shape of one kernel family at one working-set level (--tune)
+ */
+struct TunedShape {
+    std::string family;        ///< KernelMatrix::family_to_string: "read", "write", "triad"
+    std::string level;         ///< KernelMatrix::working_set_level: "L1", "L2", "L3", "DRAM"
+    std::string shape;         ///< KernelMatrix::shape_to_string
+    size_t threads = 0;
+    double bandwidth_gbps = 0.0;
+    double baseline_gbps = 0.0;  ///< The automatic kernel's own loop over the same working set
+};
+
+/**
+ * @brief Calibration of one host
+ */
+struct HostPeak {
+    std::string host_key;      ///< Baseline::host_key of the host
+    Ndjson::HostFingerprint host;
+    std::string pages;         ///< Requested page mode
+    std::string recorded;      ///< UTC time the ceilings were measured
+    std::string working_set;
+    std::vector<Ceiling> ceilings;
+    std::vector<TunedShape> shapes;  ///< Empty until --tune runs on the host
+    std::string tuned;               ///< UTC time the shapes were measured
+
+    /**
+     * @brief Highest ceiling of every family (0 without ceilings)
+     */
+    double peak_gbps() const;
+};
+
+/**
+ * @brief Contents of a peak file
+ */
+struct Store {
+    std::vector<HostPeak> hosts;
+};
+
+/**
+ * @brief Peak file used without --peak-file
+ *
+ * $XDG_CACHE_HOME/memory-benchmarks/peaks.json, or ~/.cache/memory-benchmarks/peaks.json.
+ *
+ * @return "" if neither XDG_CACHE_HOME nor HOME is set
+ */
+std::string default_path();
+
+/**
+ * @brief Best point of a scaling curve as the ceiling of a family
+ */
+Ceiling best_point(const std::string& family, const std::string& test_name, const std::string& kernel,
+                   const std::string& store_policy, const std::vector<ThreadScaling::ScalingPoint>& points);
+
+/**
+ * @brief Highest ceiling of each family, in the order the families first appear
+ */
+std::vector<Ceiling> best_per_family(const std::vector<Ceiling>& ceilings);
+
+/**
+ * @brief Read a peak file; a file that does not exist yet is an empty store
+ * @throws ConfigurationError if the file is malformed or of a newer version
+ */
+Store load(const std::string& path);
+
+/**
+ * @brief Write a store, creating missing directories and replacing the file only once it is complete
+ * @throws ConfigurationError if the file cannot be written
+ */
+void save(const std::string& path, const Store& store);
+
+/**
+ * @brief Add a host, replacing an entry with the same host key
+ *
+ * The replaced entry's ceilings or shapes are kept when the new one has
+ * none, so calibrating and tuning a host do not undo each other.
+ */
+void upsert(Store& store, const HostPeak& host);
+
+/**
+ * @brief Calibration of the host with this key (nullptr if none)
+ *
+ * Only an exact key matches: a peak measured with other DIMMs, another
+ * kernel or other pages says nothing about this configuration.
+ */
+const HostPeak* find(const Store& store, const std::string& host_key);
+
+}  // namespace PeakCalibration
+
+#endif  // PEAK_CALIBRATION_H
@@ -0,0 +1,357 @@
+#include "perf_counters.h"
+#include "numa_utils.h"
+
+#include <fstream>
+#include <sstream>
+
+#ifdef __linux__
+#include <dirent.h>
+#include <linux/perf_event.h>
+#include <sys/ioctl.h>
+#include <sys/syscall.h>
+#include <unistd.h>
+#endif
+
+namespace PerfCounters {
+
+namespace {
+
+thread_local CounterGroup* attached_group = nullptr;
+thread_local SharedRegion* attached_shared = nullptr;
+
+bool parse_number(const std::string& text, uint64_t& value) {
+    if (text.empty()) {
+        return false;
+    }
+    try {
+        size_t consumed = 0;
+        value = std::stoull(text, &consumed, 0);  // Accepts 0x prefixes
+        return consumed == text.size();
+    } catch (const std::exception&) {
+        return false;
+    }
+}
+
+/**
+ * @brief Deposit the low bits of value into the bit ranges of a format ("config:0-7,32-35")
+ */
+bool deposit_bits(const std::string& format, uint64_t value, uint64_t& config) {
+    const std::string prefix = "config:";
+    if (format.compare(0, prefix.size(), prefix) != 0) {
+        return false;  // config1/config2 terms are not used by the events we open
+    }
+
+    std::stringstream ranges(format.substr(prefix.size()));
+    std::string range;
+    while (std::getline(ranges, range, ',')) {
+        uint64_t low = 0;
+        uint64_t high = 0;
+        size_t dash = range.find('-');
+        if (!parse_number(range.substr(0, dash), low)) {
+            return false;
+        }
+        high = low;
+        if (dash != std::string::npos && !parse_number(range.substr(dash + 1), high)) {
+            return false;
+        }
+        if (high < low || high > 63) {
+            return false;
+        }
+        for (uint64_t bit = low; bit <= high; ++bit) {
+            if (value & 1u) {
+                config |= uint64_t{1} << bit;
+            }
+            value >>= 1;
+        }
+    }
+    return true;
+}
+
+#ifdef __linux__
+const std::string PMU_SYSFS_ROOT = "/sys/bus/event_source/devices/";
+
+// PMU directories resolve outside the SafeFileUtils whitelist (/sys/devices/<pmu>)
+bool read_sysfs_line(const std::string& path, std::string& line) {
+    std::ifstream file(path);
+    if (!file.is_open() || !std::getline(file, line)) {
+        return false;
+    }
+    while (!line.empty() && (line.back() == '\n' || line.back() == ' ')) {
+        line.pop_back();
+    }
+    return true;
+}
+
+long perf_event_open(perf_event_attr* attr, pid_t pid, int cpu, int group_fd, unsigned long flags) {
+    return syscall(__NR_perf_event_open, attr, pid, cpu, group_fd, flags);
+}
+
+/**
+ * @brief Individually opened perf events, read with multiplexing correction
+ */
+class PerfEventGroup : public CounterGroup {
+public:
+    explicit PerfEventGroup(const std::vector<EventSpec>& events) : events_(events) {}
+
+    ~PerfEventGroup() override {
+        for (const auto& event : open_) {
+            close(event.fd);
+        }
+    }
+
+    PerfEventGroup(const PerfEventGroup&) = delete;
+    PerfEventGroup& operator=(const PerfEventGroup&) = delete;
+
+    bool open() override {
+        for (const auto& spec : events_) {
+            perf_event_attr attr = {};
+            attr.size = sizeof(attr);
+            attr.type = spec.type;
+            attr.config = spec.config;
+            attr.disabled = 1;
+            attr.read_format = PERF_FORMAT_TOTAL_TIME_ENABLED | PERF_FORMAT_TOTAL_TIME_RUNNING;
+            if (spec.cpu < 0) {
+                // Thread counters only see the benchmark's own user-space work
+                attr.exclude_kernel = 1;
+                attr.exclude_hv = 1;
+            }
+            pid_t pid = (spec.cpu < 0) ? 0 : -1;
+            long fd = perf_event_open(&attr, pid, spec.cpu, -1, PERF_FLAG_FD_CLOEXEC);
+            if (fd >= 0) {
+                open_.push_back({spec, static_cast<int>(fd)});
+            }
+        }
+        return !open_.empty();
+    }
+
+    void start() override {
+        for (const auto& event : open_) {
+            ioctl(event.fd, PERF_EVENT_IOC_ENABLE, 0);
+        }
+    }
+
+    void stop() override {
+        for (const auto& event : open_) {
+            ioctl(event.fd, PERF_EVENT_IOC_DISABLE, 0);
+        }
+    }
+
+    void reset() override {
+        for (const auto& event : open_) {
+            ioctl(event.fd, PERF_EVENT_IOC_RESET, 0);
+        }
+    }
+
+    CounterValues read() override {
+        CounterValues values;
+        for (const auto& event : open_) {
+            struct {
+                uint64_t value;
+                uint64_t time_enabled;
+                uint64_t time_running;
+            } data = {};
+            if (::read(event.fd, &data, sizeof(data)) != static_cast<ssize_t>(sizeof(data))) {
+                continue;
+            }
+            double count = static_cast<double>(data.value);
+            if (data.time_running > 0 && data.time_running < data.time_enabled) {
+                count *= static_cast<double>(data.time_enabled) / data.time_running;
+            }
+            uint64_t previous = values.has(event.spec.counter) ? values.get(event.spec.counter) : 0;
+            values.set(event.spec.counter, previous + static_cast<uint64_t>(count * event.spec.scale));
+        }
+        return values;
+    }
+
+private:
+    struct OpenEvent {
+        EventSpec spec;
+        int fd;
+    };
+
+    std::vector<EventSpec> events_;
+    std::vector<OpenEvent> open_;
+};
+#endif  // __linux__
+
+}  // namespace
+
+std::string counter_name(Counter counter) {
+    switch (counter) {
+        case Counter::CYCLES: return "cycles";
+        case Counter::INSTRUCTIONS: return "instructions";
+        case Counter::LLC_MISSES: return "llc_misses";
+        case Counter::LLC_MISS_LOADS: return "llc_miss_loads";
+        case Counter::DTLB_MISSES: return "dtlb_misses";
+        case Counter::DRAM_READ_BYTES: return "dram_read_bytes";
+        case Counter::DRAM_WRITE_BYTES: return "dram_write_bytes";
+        default: return "unknown";
+    }
+}
+
+CounterValues& CounterValues::operator+=(const CounterValues& other) {
+    for (size_t i = 0; i < COUNTER_COUNT; ++i) {
+        values[i] += other.values[i];
+    }
+    counted |= other.counted;
+    return *this;
+}
+
+std::vector<EventSpec> generic_core_events() {
+#ifdef __linux__
+    const uint64_t dtlb_read_miss = PERF_COUNT_HW_CACHE_DTLB | (PERF_COUNT_HW_CACHE_OP_READ << 8) |
+                                    (PERF_COUNT_HW_CACHE_RESULT_MISS << 16);
+    return {
+        {Counter::CYCLES, PERF_TYPE_HARDWARE, PERF_COUNT_HW_CPU_CYCLES},
+        {Counter::INSTRUCTIONS, PERF_TYPE_HARDWARE, PERF_COUNT_HW_INSTRUCTIONS},
+        {Counter::LLC_MISSES, PERF_TYPE_HARDWARE, PERF_COUNT_HW_CACHE_MISSES},
+        {Counter::DTLB_MISSES, PERF_TYPE_HW_CACHE, dtlb_read_miss},
+    };
+#else
+    return {};
+#endif
+}
+
+bool encode_sysfs_event(const std::string& event, const std::vector<std::pair<std::string, std::string>>& format_fields,
+                        uint64_t& config) {
+    config = 0;
+    std::stringstream terms(event);
+    std::string term;
+    while (std::getline(terms, term, ',')) {
+        size_t equals = term.find('=');
+        std::string name = term.substr(0, equals);
+        uint64_t value = 1;  // A bare term sets its field to 1
+        if (equals != std::string::npos && !parse_number(term.substr(equals + 1), value)) {
+            return false;
+        }
+
+        bool known = false;
+        for (const auto& [field, format] : format_fields) {
+            if (field == name) {
+                if (!deposit_bits(format, value, config)) {
+                    return false;
+                }
+                known = true;
+                break;
+            }
+        }
+        if (!known) {
+            return false;
+        }
+    }
+    return true;
+}
+
+std::vector<EventSpec> sysfs_uncore_events(const std::string& pmu_prefix, const std::string& read_event,
+                                           const std::string& write_event, double bytes_per_count) {
+    std::vector<EventSpec> events;
+#ifdef __linux__
+    DIR* dir = opendir(PMU_SYSFS_ROOT.c_str());
+    if (dir == nullptr) {
+        return events;
+    }
+
+    std::vector<std::string> pmus;
+    while (dirent* entry = readdir(dir)) {
+        std::string name = entry->d_name;
+        if (name.compare(0, pmu_prefix.size(), pmu_prefix) == 0) {
+            pmus.push_back(name);
+        }
+    }
+    closedir(dir);
+
+    for (const auto& pmu : pmus) {
+        std::string root = PMU_SYSFS_ROOT + pmu + "/";
+        std::string type_text;
+        std::string cpumask;
+        uint64_t type = 0;
+        if (!read_sysfs_line(root + "type", type_text) || !parse_number(type_text, type)) {
+            continue;
+        }
+        std::vector<size_t> cpus = read_sysfs_line(root + "cpumask", cpumask) ? NumaUtils::parse_id_list(cpumask)
+                                                                               : std::vector<size_t>{0};
+
+        for (const auto& [name, counter] : {std::make_pair(read_event, Counter::DRAM_READ_BYTES),
+                                            std::make_pair(write_event, Counter::DRAM_WRITE_BYTES)}) {
+            std::string event;
+            if (!read_sysfs_line(root + "events/" + name, event)) {
+                continue;
+            }
+
+            // Formats of the terms this event uses
+            std::vector<std::pair<std::string, std::string>> format_fields;
+            std::stringstream terms(event);
+            std::string term;
+            while (std::getline(terms, term, ',')) {
+                std::string field = term.substr(0, term.find('='));
+                std::string format;
+                if (read_sysfs_line(root + "format/" + field, format)) {
+                    format_fields.push_back({field, format});
+                }
+            }
+
+            uint64_t config = 0;
+            if (!encode_sysfs_event(event, format_fields, config)) {
+                continue;
+            }
+            for (size_t cpu : cpus) {
+                events.push_back({counter, static_cast<uint32_t>(type), config, static_cast<int>(cpu),
+                                  bytes_per_count});
+            }
+        }
+    }
+#else
+    (void)pmu_prefix; (void)read_event; (void)write_event; (void)bytes_per_count;
+#endif
+    return events;
+}
+
+std::unique_ptr<CounterGroup> create_perf_event_group(const std::vector<EventSpec>& events) {
+#ifdef __linux__
+    if (!events.empty()) {
+        return std::make_unique<PerfEventGroup>(events);
+    }
+#else
+    (void)events;
+#endif
+    return nullptr;
+}
+
+void SharedRegion::enter() {
+    std::lock_guard<std::mutex> lock(mutex_);
+    if (active_++ == 0 && group_ != nullptr) {
+        group_->start();
+    }
+}
+
+void SharedRegion::leave() {
+    std::lock_guard<std::mutex> lock(mutex_);
+    if (active_ > 0 && --active_ == 0 && group_ != nullptr) {
+        group_->stop();
+    }
+}
+
+void attach_thread(CounterGroup* thread_group, SharedRegion* shared) {
+    attached_group = thread_group;
+    attached_shared = shared;
+}
+
+void region_begin() {
+    if (attached_shared != nullptr) {
+        attached_shared->enter();
+    }
+    if (attached_group != nullptr) {
+        attached_group->start();
+    }
+}
+
+void region_end() {
+    if (attached_group != nullptr) {
+        attached_group->stop();
+    }
+    if (attached_shared != nullptr) {
+        attached_shared->leave();
+    }
+}
+
+}  // namespace PerfCounters
@@ -0,0 +1,189 @@
+#ifndef PERF_COUNTERS_H
+#define PERF_COUNTERS_H
+
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <vector>
+
+/**
+ * @brief Optional hardware performance counters around measured regions
+ *
+ * Bandwidth is otherwise derived from wall time and the bytes a kernel is
+ * nominally expected to move. Counters report what the hardware actually
+ * did: last-level cache and dTLB misses per thread, and DRAM traffic from
+ * the memory controllers where the platform exposes it, so read-for-
+ * ownership or prefetcher traffic shows up as measured bytes.
+ *
+ * Platforms create the groups (PlatformInterface::create_thread_counters
+ * and create_uncore_counters); StandardTests brackets each timed loop with
+ * region_begin / region_end, which act on the groups attached to the
+ * calling thread and do nothing when none are.
+ */
+namespace PerfCounters {
+
+/**
+ * @brief Quantities a counter group may report
+ */
+enum class Counter : size_t {
+    CYCLES,            ///< Core clock cycles
+    INSTRUCTIONS,      ///< Retired instructions
+    LLC_MISSES,        ///< Last-level cache misses (generic event)
+    LLC_MISS_LOADS,    ///< Retired loads that missed the last-level cache (mem_load_retired.l3_miss and equivalents)
+    DTLB_MISSES,       ///< Data TLB load misses
+    DRAM_READ_BYTES,   ///< Bytes read by the memory controllers (uncore CAS counts x line size)
+    DRAM_WRITE_BYTES,  ///< Bytes written by the memory controllers
+    COUNT
+};
+
+constexpr size_t COUNTER_COUNT = static_cast<size_t>(Counter::COUNT);
+
+/**
+ * @brief Snake-case name used in JSON and CSV output ("llc_misses")
+ */
+std::string counter_name(Counter counter);
+
+/**
+ * @brief Values of a region; only counters a group could open are present
+ */
+struct CounterValues {
+    std::array<uint64_t, COUNTER_COUNT> values{};
+    uint32_t counted = 0;  ///< Bit i set: values[i] was measured
+
+    bool has(Counter counter) const { return (counted >> static_cast<size_t>(counter)) & 1u; }
+    uint64_t get(Counter counter) const { return values[static_cast<size_t>(counter)]; }
+    bool empty() const { return counted == 0; }
+
+    void set(Counter counter, uint64_t value) {
+        values[static_cast<size_t>(counter)] = value;
+        counted |= 1u << static_cast<size_t>(counter);
+    }
+
+    /**
+     * @brief Sum of both regions; a counter is present if either measured it
+     */
+    CounterValues& operator+=(const CounterValues& other);
+
+    /**
+     * @brief DRAM read plus write bytes (0 if the memory controllers were not counted)
+     */
+    uint64_t dram_bytes() const { return get(Counter::DRAM_READ_BYTES) + get(Counter::DRAM_WRITE_BYTES); }
+    bool has_dram_bytes() const { return has(Counter::DRAM_READ_BYTES) || has(Counter::DRAM_WRITE_BYTES); }
+};
+
+/**
+ * @brief A set of counters that can be started, stopped and read
+ *
+ * Per-thread groups count the thread that called open(); system-wide
+ * groups (memory controllers) count every core. Values accumulate across
+ * start/stop pairs until reset().
+ */
+class CounterGroup {
+public:
+    virtual ~CounterGroup() = default;
+
+    /**
+     * @brief Open the counters; per-thread groups must be opened by the thread they count
+     * @return true if at least one counter is available
+     */
+    virtual bool open() = 0;
+    virtual void start() = 0;
+    virtual void stop() = 0;
+    virtual void reset() = 0;
+    virtual CounterValues read() = 0;
+};
+
+/**
+ * @brief One Linux perf event
+ */
+struct EventSpec {
+    Counter counter;
+    uint32_t type;        ///< perf_event_attr.type (PERF_TYPE_*, or a dynamic PMU type from sysfs)
+    uint64_t config;      ///< perf_event_attr.config
+    int cpu = -1;         ///< -1: the opening thread on any CPU; >= 0: every task on that CPU (uncore)
+    double scale = 1.0;   ///< Multiplier from counts to the reported unit
+};
+
+/**
+ * @brief Cycles, instructions, LLC misses and dTLB load misses as generic perf events
+ */
+std::vector<EventSpec> generic_core_events();
+
+/**
+ * @brief Memory-controller CAS events of every sysfs PMU whose name starts with a prefix
+ *
+ * Each PMU is opened on the CPUs listed in its cpumask (one per socket).
+ * Event encodings are read from the PMU's events/ and format/ directories,
+ * so nothing model-specific is compiled in.
+ *
+ * @param pmu_prefix PMU name prefix ("uncore_imc")
+ * @param read_event Event name counting read CAS commands ("cas_count_read")
+ * @param write_event Event name counting write CAS commands ("cas_count_write")
+ * @param bytes_per_count Bytes moved per count (one cache line per CAS)
+ * @return Events found (empty if the PMU is absent)
+ */
+std::vector<EventSpec> sysfs_uncore_events(const std::string& pmu_prefix, const std::string& read_event,
+                                           const std::string& write_event, double bytes_per_count);
+
+/**
+ * @brief Encode a sysfs event string ("event=0x04,umask=0x03") with a PMU's format/ bit layout
+ *
+ * @param event Comma-separated term=value list
+ * @param format_fields Format of each term ("config:0-7", "config:8-15,32-35")
+ * @param config Encoded perf_event_attr.config
+ * @return false if a term is unknown or does not target config
+ */
+bool encode_sysfs_event(const std::string& event, const std::vector<std::pair<std::string, std::string>>& format_fields,
+                        uint64_t& config);
+
+/**
+ * @brief perf_event_open group of the given events (nullptr outside Linux or if events is empty)
+ *
+ * Events are opened individually, so an event the PMU rejects is simply
+ * absent from the values; counts are scaled for multiplexing.
+ */
+std::unique_ptr<CounterGroup> create_perf_event_group(const std::vector<EventSpec>& events);
+
+/**
+ * @brief System-wide group shared by the threads of one run
+ *
+ * The group runs while at least one thread is inside its measured region,
+ * so setup work outside StandardTests' timed loops is not counted.
+ */
+class SharedRegion {
+public:
+    explicit SharedRegion(CounterGroup* group) : group_(group) {}
+
+    void enter();
+    void leave();
+
+private:
+    CounterGroup* group_;
+    std::mutex mutex_;
+    size_t active_ = 0;
+};
+
+/**
+ * @brief Attach groups to the calling thread (nullptr detaches)
+ *
+ * @param thread_group Counters of this thread
+ * @param shared System-wide counters shared with the other threads of the run
+ */
+void attach_thread(CounterGroup* thread_group, SharedRegion* shared);
+
+/**
+ * @brief Start the counters attached to the calling thread (no-op without any)
+ */
+void region_begin();
+
+/**
+ * @brief Stop the counters attached to the calling thread (no-op without any)
+ */
+void region_end();
+
+}  // namespace PerfCounters
+
+#endif  // PERF_COUNTERS_H
@@ -1,4 +1,5 @@
 #include "platform_interface.h"
+#include "system_probe.h"
 #include "errors.h"
 #include <memory>
 
@@ -13,7 +14,9 @@
     #endif
 #endif
 
-std::unique_ptr<PlatformInterface> create_platform_interface() {
+namespace {
+
+std::unique_ptr<PlatformInterface> create_native_platform() {
 #ifdef __APPLE__
     return std::make_unique<MacOSPlatform>();
 #elif defined(__linux__)
@@ -29,4 +32,16 @@ std::unique_ptr<PlatformInterface> create_platform_interface() {
     // Unsupported operating system
     throw PlatformError("Unsupported operating system. Only macOS and Linux are supported.");
 #endif
-}
\ No newline at end of file
+}
+
+}  // namespace
+
+SystemProbe::Probe& SystemProbe::shared() {
+    static Probe probe(create_native_platform());
+    return probe;
+}
+
+std::unique_ptr<PlatformInterface> create_platform_interface() {
+    // Every platform shares one probe, so the host is detected once per process
+    return std::make_unique<SystemProbe::CachedPlatform>(create_native_platform(), SystemProbe::shared());
+}
@@ -3,6 +3,10 @@
 
 #include "memory_types.h"
 #include "matrix_multiply_interface.h"
+#include "energy_meter.h"
+#include "gpu_bandwidth.h"
+#include "perf_counters.h"
+#include "prefetch_control.h"
 #include <string>
 #include <utility>
 #include <memory>
@@ -29,6 +33,16 @@ public:
     virtual size_t get_max_threads_for_affinity(CPUAffinityType affinity_type) = 0;
     virtual void set_thread_affinity(size_t thread_id, CPUAffinityType affinity_type, size_t total_threads) = 0;
     virtual bool validate_thread_count(size_t num_threads, CPUAffinityType affinity_type, std::string& error_msg) = 0;
+
+    // NUMA methods
+    virtual NumaTopology detect_numa_topology() = 0;
+    virtual bool bind_thread_to_numa_node(size_t thread_id, size_t node_id) = 0;
+    virtual bool bind_memory_to_numa_node(void* addr, size_t length, size_t node_id) = 0;
+    virtual bool interleave_memory_across_numa_nodes(void* addr, size_t length, const std::vector<NumaWeight>& weights,
+                                                     std::string& policy) = 0;
+
+    // CPU topology (package, die, LLC domain, core and SMT of every online CPU)
+    virtual CpuTopology detect_cpu_topology() = 0;
     
     // Platform identification
     virtual std::string get_platform_name() = 0;
@@ -36,10 +50,27 @@ public:
     
     // Matrix multiplication
     virtual std::unique_ptr<MatrixMultiply::MatrixMultiplier> create_matrix_multiplier() = 0;
+
+    // Hardware performance counters (nullptr when the platform exposes none)
+    virtual std::unique_ptr<PerfCounters::CounterGroup> create_thread_counters() = 0;
+    virtual std::unique_ptr<PerfCounters::CounterGroup> create_uncore_counters() = 0;
+
+    // Hardware prefetcher control (nullptr when the platform cannot toggle them)
+    virtual std::unique_ptr<PrefetchControl::HardwarePrefetchers> create_prefetcher_control() = 0;
+
+    // Package and DRAM energy counters (nullptr when the platform exposes none)
+    virtual std::unique_ptr<EnergyMeter::Meter> create_energy_meter() = 0;
+
+    // GPU compute over unified memory (nullptr when the platform has no backend)
+    virtual std::unique_ptr<GpuBandwidth::Device> create_gpu_device() = 0;
 };
 
 /**
  * @brief Factory function to create platform-specific implementation
+ *
+ * Detection calls are answered by the shared SystemProbe, so every platform
+ * created in a process detects the host once between them.
+ *
  * @return Pointer to platform-specific implementation
  */
 std::unique_ptr<PlatformInterface> create_platform_interface();
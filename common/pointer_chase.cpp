@@ -0,0 +1,168 @@
+#include "pointer_chase.h"
+#include "errors.h"
+
+#include <algorithm>
+#include <random>
+#include <vector>
+
+namespace PointerChase {
+
+namespace {
+
+void link(uint8_t* base, size_t from_node, size_t to_node) {
+    *reinterpret_cast<uint8_t**>(base + from_node * NODE_SIZE) = base + to_node * NODE_SIZE;
+}
+
+// Link nodes in the given visit order and close the cycle
+void link_sequence(uint8_t* base, const std::vector<size_t>& order) {
+    for (size_t i = 0; i < order.size(); ++i) {
+        link(base, order[i], order[(i + 1) % order.size()]);
+    }
+}
+
+}  // namespace
+
+std::vector<size_t> single_cycle(size_t count, uint64_t seed) {
+    // Sattolo's algorithm: a uniformly random permutation that is a single cycle
+    std::mt19937_64 gen(seed);
+    std::vector<size_t> next(count);
+    for (size_t i = 0; i < count; ++i) {
+        next[i] = i;
+    }
+    for (size_t i = count; i-- > 1;) {
+        std::uniform_int_distribution<size_t> pick(0, i - 1);
+        std::swap(next[i], next[pick(gen)]);
+    }
+    return next;
+}
+
+size_t build_chain(uint8_t* base, size_t bytes, const ChaseConfig& config, uint64_t seed) {
+    size_t node_count = bytes / NODE_SIZE;
+    if (base == nullptr || node_count < 2) {
+        return 0;
+    }
+
+    std::mt19937_64 gen(seed);
+
+    switch (config.mode) {
+        case ChaseMode::RANDOM: {
+            std::vector<size_t> next = single_cycle(node_count, seed);
+            for (size_t i = 0; i < node_count; ++i) {
+                link(base, i, next[i]);
+            }
+            return node_count;
+        }
+
+        case ChaseMode::PAGE_LOCAL: {
+            const size_t nodes_per_page = PAGE_SIZE_BYTES / NODE_SIZE;
+            size_t page_count = (node_count + nodes_per_page - 1) / nodes_per_page;
+
+            std::vector<size_t> pages(page_count);
+            for (size_t p = 0; p < page_count; ++p) {
+                pages[p] = p;
+            }
+            std::shuffle(pages.begin(), pages.end(), gen);
+
+            std::vector<size_t> order;
+            order.reserve(node_count);
+            std::vector<size_t> lines;
+            for (size_t page : pages) {
+                size_t first = page * nodes_per_page;
+                size_t last = std::min(first + nodes_per_page, node_count);
+                lines.clear();
+                for (size_t node = first; node < last; ++node) {
+                    lines.push_back(node);
+                }
+                std::shuffle(lines.begin(), lines.end(), gen);
+                order.insert(order.end(), lines.begin(), lines.end());
+            }
+            link_sequence(base, order);
+            return node_count;
+        }
+
+        case ChaseMode::STRIDE: {
+            size_t stride_nodes = std::max<size_t>(1, config.stride_bytes / NODE_SIZE);
+            std::vector<size_t> order;
+            for (size_t node = 0; node < node_count; node += stride_nodes) {
+                order.push_back(node);
+            }
+            if (order.size() < 2) {
+                return 0;
+            }
+            link_sequence(base, order);
+            return order.size();
+        }
+    }
+    return 0;
+}
+
+const void* chase(const void* start, size_t hops) {
+    const void* p = start;
+    // Unrolled so loop overhead stays off the dependent-load critical path
+    while (hops >= 8) {
+        p = *static_cast<const void* const*>(p);
+        p = *static_cast<const void* const*>(p);
+        p = *static_cast<const void* const*>(p);
+        p = *static_cast<const void* const*>(p);
+        p = *static_cast<const void* const*>(p);
+        p = *static_cast<const void* const*>(p);
+        p = *static_cast<const void* const*>(p);
+        p = *static_cast<const void* const*>(p);
+        hops -= 8;
+    }
+    while (hops > 0) {
+        p = *static_cast<const void* const*>(p);
+        --hops;
+    }
+    return p;
+}
+
+ChaseConfig parse_chase_mode(const std::string& str) {
+    ChaseConfig config;
+    if (str == "random") {
+        config.mode = ChaseMode::RANDOM;
+        return config;
+    }
+    if (str == "page") {
+        config.mode = ChaseMode::PAGE_LOCAL;
+        return config;
+    }
+
+    const std::string stride_prefix = "stride:";
+    if (str.rfind(stride_prefix, 0) == 0) {
+        std::string value = str.substr(stride_prefix.size());
+        size_t stride = 0;
+        try {
+            size_t parsed = 0;
+            stride = std::stoul(value, &parsed);
+            if (parsed != value.size()) {
+                stride = 0;
+            }
+        } catch (const std::exception&) {
+            stride = 0;
+        }
+        if (stride == 0 || stride % NODE_SIZE != 0) {
+            throw ArgumentError("Invalid chase stride '" + value + "'. Stride must be a positive multiple of " +
+                                std::to_string(NODE_SIZE) + " bytes");
+        }
+        config.mode = ChaseMode::STRIDE;
+        config.stride_bytes = stride;
+        return config;
+    }
+
+    throw ArgumentError("Invalid chase mode '" + str + "'. Valid chase modes: random, page, stride:BYTES");
+}
+
+std::string chase_mode_to_string(const ChaseConfig& config) {
+    switch (config.mode) {
+        case ChaseMode::RANDOM:
+            return "random";
+        case ChaseMode::PAGE_LOCAL:
+            return "page";
+        case ChaseMode::STRIDE:
+            return "stride:" + std::to_string(config.stride_bytes);
+    }
+    return "random";
+}
+
+}  // namespace PointerChase
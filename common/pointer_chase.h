@@ -0,0 +1,86 @@
+#ifndef POINTER_CHASE_H
+#define POINTER_CHASE_H
+
+#include <cstddef>
+#include <cstdint>
+#include <string>
+#include <vector>
+
+/**
+ * @brief Dependent-load pointer chains for load-to-use latency
+ *
+ * Each node of a chain is one cache line whose first word holds the address
+ * of the next node, so every load depends on the previous one and the CPU
+ * cannot overlap misses. Time per hop is then true access latency for the
+ * level of the hierarchy the working set lands in.
+ */
+namespace PointerChase {
+
+/**
+ * @brief Order in which a chain visits the cache lines of its working set
+ */
+enum class ChaseMode {
+    RANDOM,      ///< Single random cycle over every line (Sattolo shuffle): defeats prefetchers and TLB reach
+    PAGE_LOCAL,  ///< Random lines within each 4 KB page, pages in random order: separates cache from TLB misses
+    STRIDE       ///< Fixed forward stride, wrapping at the end: shows what the prefetchers recover
+};
+
+/**
+ * @brief Chain layout selected on the command line
+ */
+struct ChaseConfig {
+    ChaseMode mode = ChaseMode::RANDOM;  ///< Visit order
+    size_t stride_bytes = 0;             ///< Distance between nodes in STRIDE mode (multiple of a cache line)
+};
+
+/// Size of one chain node; nodes never share a cache line
+constexpr size_t NODE_SIZE = 64;
+/// Page size the PAGE_LOCAL mode keeps its inner walks within
+constexpr size_t PAGE_SIZE_BYTES = 4096;
+
+/**
+ * @brief Link a cyclic chain through a buffer
+ *
+ * Writes one pointer per visited node. Every chain is a single cycle, so
+ * starting anywhere walks all nodes before returning.
+ *
+ * @param base Start of the working set (NODE_SIZE aligned)
+ * @param bytes Working set size in bytes
+ * @param config Chain layout
+ * @param seed Seed for the shuffles (same seed, same chain)
+ * @return Number of nodes in the chain (0 if the range holds fewer than two nodes)
+ */
+size_t build_chain(uint8_t* base, size_t bytes, const ChaseConfig& config, uint64_t seed);
+
+/**
+ * @brief Successors of a uniformly random single cycle over count items (Sattolo's algorithm)
+ *
+ * Following next[i] from any item visits all count items before returning.
+ *
+ * @param seed Seed of the shuffle (same seed, same cycle)
+ * @return next, with next[i] the item after i (empty if count is 0)
+ */
+std::vector<size_t> single_cycle(size_t count, uint64_t seed);
+
+/**
+ * @brief Follow a chain for a number of dependent hops
+ * @param start Any node of a chain built by build_chain
+ * @param hops Number of loads to perform
+ * @return Node reached after the last hop (feed it back in to continue)
+ */
+const void* chase(const void* start, size_t hops);
+
+/**
+ * @brief Parse a chase mode: "random", "page" or "stride:BYTES"
+ * @throws ArgumentError if the mode is unknown or the stride is invalid
+ */
+ChaseConfig parse_chase_mode(const std::string& str);
+
+/**
+ * @brief Command-line form of a chase configuration
+ */
+std::string chase_mode_to_string(const ChaseConfig& config);
+
+}  // namespace PointerChase
+
+#endif  // POINTER_CHASE_H
@@ -0,0 +1,218 @@
+#include "prefetch_control.h"
+#include "errors.h"
+#include "numa_utils.h"
+#include "safe_file_utils.h"
+
+#include <cerrno>
+#include <cstring>
+#include <sstream>
+
+#ifdef __linux__
+#include <csignal>
+#include <fcntl.h>
+#include <unistd.h>
+#endif
+
+namespace PrefetchControl {
+
+namespace {
+
+constexpr size_t LINE_BYTES = 64;
+constexpr size_t MAX_SWEEP_DISTANCE_BYTES = 8192;
+
+#ifdef __linux__
+const std::string CPU_ONLINE_PATH = "/sys/devices/system/cpu/online";
+const int RESTORE_SIGNALS[] = {SIGINT, SIGTERM, SIGHUP};
+
+/**
+ * @brief One register on every online CPU, with the values read before the first write
+ */
+class MsrPrefetchers : public HardwarePrefetchers {
+public:
+    MsrPrefetchers(uint32_t msr, uint64_t disable_mask) : msr_(msr), disable_mask_(disable_mask) {}
+
+    ~MsrPrefetchers() override {
+        restore();
+        if (active_ == this) {
+            for (int sig : RESTORE_SIGNALS) {
+                std::signal(sig, SIG_DFL);
+            }
+            active_ = nullptr;
+        }
+        for (int fd : fds_) {
+            close(fd);
+        }
+    }
+
+    bool disable(std::string& error) override {
+        if (!open_all(error)) {
+            return false;
+        }
+        if (!saved_) {
+            for (size_t i = 0; i < fds_.size(); ++i) {
+                if (pread(fds_[i], &original_[i], sizeof(uint64_t), msr_) != sizeof(uint64_t)) {
+                    error = "cannot read MSR on CPU " + std::to_string(cpus_[i]) + ": " + std::strerror(errno);
+                    return false;
+                }
+            }
+            saved_ = true;
+            install_restore_handlers(this);
+        }
+        for (size_t i = 0; i < fds_.size(); ++i) {
+            uint64_t value = original_[i] | disable_mask_;
+            if (pwrite(fds_[i], &value, sizeof(value), msr_) != sizeof(value)) {
+                error = "cannot write MSR on CPU " + std::to_string(cpus_[i]) + ": " + std::strerror(errno);
+                restore();
+                return false;
+            }
+        }
+        return true;
+    }
+
+    void restore() override {
+        if (!saved_) {
+            return;
+        }
+        write_original();
+    }
+
+    std::string describe() const override {
+        std::stringstream ss;
+        ss << "MSR 0x" << std::hex << msr_ << " mask 0x" << disable_mask_ << std::dec;
+        if (!fds_.empty()) {
+            ss << " on " << fds_.size() << " CPUs";
+        }
+        return ss.str();
+    }
+
+    // Async-signal-safe: pwrite only, into buffers sized before the handler was installed
+    void write_original() const {
+        for (size_t i = 0; i < fds_.size(); ++i) {
+            ssize_t written = pwrite(fds_[i], &original_[i], sizeof(uint64_t), msr_);
+            (void)written;  // Nothing better to do from a destructor or signal handler
+        }
+    }
+
+private:
+    bool open_all(std::string& error) {
+        if (!fds_.empty()) {
+            return true;
+        }
+        std::string online;
+        std::vector<size_t> cpus;
+        if (SafeFileUtils::read_single_line(CPU_ONLINE_PATH, online)) {
+            cpus = NumaUtils::parse_id_list(online);
+        }
+        if (cpus.empty()) {
+            error = "cannot list the online CPUs from " + CPU_ONLINE_PATH;
+            return false;
+        }
+
+        std::vector<int> fds;
+        for (size_t cpu : cpus) {
+            std::string path = "/dev/cpu/" + std::to_string(cpu) + "/msr";
+            int fd = open(path.c_str(), O_RDWR);
+            if (fd < 0) {
+                error = "cannot open " + path + ": " + std::strerror(errno) +
+                        " (needs root and the msr driver: modprobe msr)";
+                for (int opened : fds) {
+                    close(opened);
+                }
+                return false;
+            }
+            fds.push_back(fd);
+        }
+        cpus_ = cpus;
+        fds_ = fds;
+        original_.assign(fds_.size(), 0);
+        return true;
+    }
+
+    static void install_restore_handlers(MsrPrefetchers* control);
+    static void restore_and_reraise(int sig);
+
+    static MsrPrefetchers* active_;
+
+    uint32_t msr_;
+    uint64_t disable_mask_;
+    std::vector<size_t> cpus_;
+    std::vector<int> fds_;
+    std::vector<uint64_t> original_;
+    bool saved_ = false;
+};
+
+MsrPrefetchers* MsrPrefetchers::active_ = nullptr;
+
+void MsrPrefetchers::install_restore_handlers(MsrPrefetchers* control) {
+    active_ = control;
+    for (int sig : RESTORE_SIGNALS) {
+        std::signal(sig, restore_and_reraise);
+    }
+}
+
+void MsrPrefetchers::restore_and_reraise(int sig) {
+    if (active_ != nullptr) {
+        active_->write_original();
+    }
+    std::signal(sig, SIG_DFL);
+    std::raise(sig);
+}
+#endif  // __linux__
+
+}  // namespace
+
+size_t parse_distance(const std::string& str) {
+    size_t distance = 0;
+    bool parsed = !str.empty() && str[0] != '-' && str[0] != '+';
+    if (parsed) {
+        try {
+            size_t consumed = 0;
+            distance = std::stoul(str, &consumed);
+            parsed = consumed == str.size();
+        } catch (const std::exception&) {
+            parsed = false;
+        }
+    }
+    if (!parsed || distance < MIN_DISTANCE_BYTES || distance > MAX_DISTANCE_BYTES || distance % LINE_BYTES != 0) {
+        throw ArgumentError("Invalid prefetch distance '" + str + "'. Distance must be a multiple of " +
+                            std::to_string(LINE_BYTES) + " bytes between " + std::to_string(MIN_DISTANCE_BYTES) +
+                            " and " + std::to_string(MAX_DISTANCE_BYTES) + ", or sweep");
+    }
+    return distance;
+}
+
+std::vector<size_t> sweep_distances() {
+    std::vector<size_t> distances = {0};
+    for (size_t distance = MIN_DISTANCE_BYTES; distance <= MAX_SWEEP_DISTANCE_BYTES; distance *= 2) {
+        distances.push_back(distance);
+    }
+    return distances;
+}
+
+HardwareMode parse_hardware_mode(const std::string& str) {
+    if (str == "on") return HardwareMode::DEFAULT;
+    if (str == "off") return HardwareMode::OFF;
+    if (str == "both") return HardwareMode::BOTH;
+    throw ArgumentError("Invalid hardware prefetch mode '" + str + "'. Valid modes: on, off, both");
+}
+
+std::string distance_to_string(size_t distance_bytes) {
+    return distance_bytes == 0 ? "none" : std::to_string(distance_bytes) + " B";
+}
+
+bool supports_pattern(TestPattern pattern) {
+    return pattern == TestPattern::SEQUENTIAL_READ || pattern == TestPattern::STRIDED_READ ||
+           pattern == TestPattern::RANDOM_READ || pattern == TestPattern::RANDOM_WRITE;
+}
+
+std::unique_ptr<HardwarePrefetchers> create_msr_prefetchers(uint32_t msr, uint64_t disable_mask) {
+#ifdef __linux__
+    return std::make_unique<MsrPrefetchers>(msr, disable_mask);
+#else
+    (void)msr;
+    (void)disable_mask;
+    return nullptr;
+#endif
+}
+
+}  // namespace PrefetchControl
@@ -0,0 +1,119 @@
+#ifndef PREFETCH_CONTROL_H
+#define PREFETCH_CONTROL_H
+
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <string>
+#include <vector>
+
+#include "test_patterns.h"
+
+/**
+ * @brief Software prefetch distances and hardware prefetcher control
+ *
+ * The sequential, strided and random patterns otherwise leave prefetching
+ * entirely to the hardware. A software prefetch distance makes their inner
+ * loops prefetch that many bytes ahead (the random patterns: that many
+ * bytes' worth of cache lines ahead in their visit order), and a sweep over
+ * distances shows which one a scan should be tuned to. Where the platform
+ * exposes the hardware prefetchers (Intel MSR 0x1A4 on Linux, as root),
+ * they can be turned off around a run to measure what they contribute.
+ */
+namespace PrefetchControl {
+
+/// Smallest software prefetch distance: one cache line
+constexpr size_t MIN_DISTANCE_BYTES = 64;
+/// Largest software prefetch distance accepted by --prefetch
+constexpr size_t MAX_DISTANCE_BYTES = 16384;
+
+/**
+ * @brief What --hw-prefetch does with the hardware prefetchers
+ */
+enum class HardwareMode {
+    DEFAULT,  ///< Leave them as the firmware configured them
+    OFF,      ///< Disable them for the whole run
+    BOTH      ///< Prefetch sweep only: measure every distance with them on and off
+};
+
+/**
+ * @brief Parse a software prefetch distance in bytes
+ *
+ * The distance must be a multiple of the 64-byte line between
+ * MIN_DISTANCE_BYTES and MAX_DISTANCE_BYTES.
+ *
+ * @throws ArgumentError if the distance is malformed or out of range
+ */
+size_t parse_distance(const std::string& str);
+
+/**
+ * @brief Distances of a prefetch sweep: 0 (no software prefetch, the baseline), then 64 B to 8 KB in powers of two
+ */
+std::vector<size_t> sweep_distances();
+
+/**
+ * @brief Parse --hw-prefetch: on, off, both
+ * @throws ArgumentError for any other value
+ */
+HardwareMode parse_hardware_mode(const std::string& str);
+
+/**
+ * @brief Distance as reported in results ("none", "512 B")
+ */
+std::string distance_to_string(size_t distance_bytes);
+
+/**
+ * @brief Whether a pattern has a software-prefetching inner loop
+ *
+ * Sequential read, strided read and both random patterns do; the other
+ * patterns ignore the distance.
+ */
+bool supports_pattern(TestPattern pattern);
+
+/**
+ * @brief Hardware prefetchers of every CPU, switched off and back on as a unit
+ *
+ * Implementations save the original state when they first disable the
+ * prefetchers and write it back on restore(), on destruction, and on
+ * SIGINT, SIGTERM or SIGHUP, so an interrupted run never leaves a machine
+ * with its prefetchers off.
+ */
+class HardwarePrefetchers {
+public:
+    virtual ~HardwarePrefetchers() = default;
+
+    /**
+     * @brief Disable the prefetchers on every CPU
+     * @param error Receives the reason on failure (nothing is changed then)
+     * @return true if every CPU was switched
+     */
+    virtual bool disable(std::string& error) = 0;
+
+    /**
+     * @brief Restore the state saved by the first disable() (no-op before it)
+     */
+    virtual void restore() = 0;
+
+    /**
+     * @brief What is toggled, for run notes ("MSR 0x1a4 mask 0xf on 64 CPUs")
+     */
+    virtual std::string describe() const = 0;
+};
+
+/**
+ * @brief Prefetcher control through a model-specific register on every online CPU
+ *
+ * Uses /dev/cpu/N/msr (Linux, msr driver loaded, root or CAP_SYS_RAWIO):
+ * disabling sets disable_mask in the register, restoring writes back the
+ * value read before.
+ *
+ * @param msr Register address (Intel MSR_MISC_FEATURE_CONTROL is 0x1A4)
+ * @param disable_mask Bits that disable prefetchers when set (0xF on Intel: L2 streamer,
+ *        L2 adjacent line, L1 next line, L1 IP stride)
+ * @return Control, or nullptr outside Linux
+ */
+std::unique_ptr<HardwarePrefetchers> create_msr_prefetchers(uint32_t msr, uint64_t disable_mask);
+
+}  // namespace PrefetchControl
+
+#endif  // PREFETCH_CONTROL_H
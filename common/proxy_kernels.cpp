@@ -0,0 +1,397 @@
+#include "proxy_kernels.h"
+#include "errors.h"
+
+#include <algorithm>
+#include <cstring>
+
+#if defined(__SSE2__)
+#include <emmintrin.h>
+#elif defined(__aarch64__)
+#include <arm_neon.h>
+#endif
+
+namespace ProxyKernels {
+
+namespace {
+
+constexpr uint8_t EMPTY_TAG = 0x80;
+constexpr uint64_t HASH_MULTIPLIER = 0x9E3779B97F4A7C15ULL;
+constexpr size_t LINE_KEYS = 64 / sizeof(uint64_t);
+
+// splitmix64 finalizer: a bijection, so distinct inputs give distinct keys
+uint64_t mix64(uint64_t x) {
+    x ^= x >> 30;
+    x *= 0xBF58476D1CE4E5B9ULL;
+    x ^= x >> 27;
+    x *= 0x94D049BB133111EBULL;
+    x ^= x >> 31;
+    return x;
+}
+
+// Maps a 64-bit value onto [0, n) with its high bits, without a division
+size_t fast_range(uint64_t value, size_t n) {
+    return static_cast<size_t>((static_cast<unsigned __int128>(value) * n) >> 64);
+}
+
+// Home position from the high bits, tag from the low ones, so the two stay independent
+uint64_t hash_key(uint64_t key) {
+    return key * HASH_MULTIPLIER;
+}
+
+uint8_t tag_of(uint64_t hash) {
+    return static_cast<uint8_t>(hash & 0x7F);
+}
+
+/**
+ * @brief Slots of a group whose tag equals byte, one bit per slot in steps of MATCH_STRIDE
+ *
+ * SSE2 and NEON compare the 16 tags in one instruction; NEON has no
+ * movemask, so its mask keeps one bit of each 4-bit lane.
+ */
+#if defined(__SSE2__)
+constexpr unsigned MATCH_STRIDE = 1;
+uint64_t match(const uint8_t* group, uint8_t byte) {
+    __m128i tags = _mm_loadu_si128(reinterpret_cast<const __m128i*>(group));
+    return static_cast<uint64_t>(_mm_movemask_epi8(_mm_cmpeq_epi8(tags, _mm_set1_epi8(static_cast<char>(byte)))));
+}
+#elif defined(__aarch64__)
+constexpr unsigned MATCH_STRIDE = 4;
+uint64_t match(const uint8_t* group, uint8_t byte) {
+    uint8x16_t equal = vceqq_u8(vld1q_u8(group), vdupq_n_u8(byte));
+    uint8x8_t nibbles = vshrn_n_u16(vreinterpretq_u16_u8(equal), 4);
+    return vget_lane_u64(vreinterpret_u64_u8(nibbles), 0) & 0x8888888888888888ULL;
+}
+#else
+constexpr unsigned MATCH_STRIDE = 1;
+uint64_t match(const uint8_t* group, uint8_t byte) {
+    uint64_t mask = 0;
+    for (size_t i = 0; i < GROUP_SLOTS; ++i) {
+        mask |= static_cast<uint64_t>(group[i] == byte) << i;
+    }
+    return mask;
+}
+#endif
+
+size_t first_slot(uint64_t mask) {
+    return static_cast<size_t>(__builtin_ctzll(mask)) / MATCH_STRIDE;
+}
+
+size_t parse_count(const std::string& text, size_t min, size_t max, const std::string& option) {
+    unsigned long value = 0;
+    bool valid = !text.empty() && text[0] != '-' && text[0] != '+';
+    if (valid) {
+        try {
+            size_t parsed = 0;
+            value = std::stoul(text, &parsed);
+            valid = parsed == text.size();
+        } catch (const std::exception&) {
+            valid = false;
+        }
+    }
+    if (!valid || value < min || value > max) {
+        throw ArgumentError("Invalid " + option + " '" + text + "'. Valid values: " + std::to_string(min) + "-" +
+                            std::to_string(max));
+    }
+    return static_cast<size_t>(value);
+}
+
+// Slot of key, or capacity if it is not in the table
+size_t find_linear(const Table& table, uint64_t key, size_t home) {
+    size_t slot = home;
+    for (;;) {
+        uint64_t stored = table.slots[2 * slot];
+        if (stored == key) {
+            return slot;
+        }
+        if (stored == 0) {
+            return table.capacity;
+        }
+        slot = (slot + 1 == table.capacity) ? 0 : slot + 1;
+    }
+}
+
+size_t find_group(const Table& table, uint64_t key, size_t home, uint8_t tag) {
+    const size_t groups = table.capacity / GROUP_SLOTS;
+    size_t group = home / GROUP_SLOTS;
+    for (;;) {
+        const uint8_t* tags = table.tags + group * GROUP_SLOTS;
+        for (uint64_t mask = match(tags, tag); mask != 0; mask &= mask - 1) {
+            size_t slot = group * GROUP_SLOTS + first_slot(mask);
+            if (table.slots[2 * slot] == key) {
+                return slot;
+            }
+        }
+        if (match(tags, EMPTY_TAG) != 0) {
+            return table.capacity;
+        }
+        group = (group + 1 == groups) ? 0 : group + 1;
+    }
+}
+
+}  // namespace
+
+Probe parse_probe(const std::string& name) {
+    if (name == "linear") {
+        return Probe::LINEAR;
+    }
+    if (name == "group") {
+        return Probe::GROUP;
+    }
+    throw ArgumentError("Unknown --probe '" + name + "' (expected linear or group)");
+}
+
+std::string probe_to_string(Probe probe) {
+    return probe == Probe::LINEAR ? "linear" : "group";
+}
+
+double parse_load_factor(const std::string& text) {
+    double value = 0.0;
+    bool valid = !text.empty() && text[0] != '-' && text[0] != '+';
+    if (valid) {
+        try {
+            size_t parsed = 0;
+            value = std::stod(text, &parsed);
+            valid = parsed == text.size();
+        } catch (const std::exception&) {
+            valid = false;
+        }
+    }
+    if (!valid || value < BenchmarkConstants::HASH_MIN_LOAD_FACTOR ||
+        value > BenchmarkConstants::HASH_MAX_LOAD_FACTOR) {
+        throw ArgumentError("Invalid --load-factor '" + text + "'. Valid values: " +
+                            std::to_string(BenchmarkConstants::HASH_MIN_LOAD_FACTOR).substr(0, 4) + "-" +
+                            std::to_string(BenchmarkConstants::HASH_MAX_LOAD_FACTOR).substr(0, 4));
+    }
+    return value;
+}
+
+size_t parse_batch(const std::string& text) {
+    return parse_count(text, 1, BenchmarkConstants::HASH_MAX_BATCH, "--hash-batch");
+}
+
+size_t parse_merge_ways(const std::string& text) {
+    return parse_count(text, 2, BenchmarkConstants::MERGE_MAX_WAYS, "--merge-ways");
+}
+
+Table table_layout(uint8_t* base, size_t bytes, Probe probe) {
+    Table table;
+    size_t bytes_per_slot = SLOT_BYTES + (probe == Probe::GROUP ? 1 : 0);
+    table.capacity = bytes / bytes_per_slot / GROUP_SLOTS * GROUP_SLOTS;
+    if (table.capacity == 0) {
+        return table;
+    }
+    // Tags first: capacity is a multiple of 16, so the slots stay 16-byte aligned
+    if (probe == Probe::GROUP) {
+        table.tags = base;
+        base += table.capacity;
+    }
+    table.slots = reinterpret_cast<uint64_t*>(base);
+    return table;
+}
+
+uint64_t key_at(size_t index) {
+    return mix64(static_cast<uint64_t>(index) + 1);
+}
+
+void build(Table& table, Probe probe, double load_factor) {
+    std::memset(table.slots, 0, table.capacity * SLOT_BYTES);
+    if (probe == Probe::GROUP) {
+        std::memset(table.tags, EMPTY_TAG, table.capacity);
+    }
+    table.keys = static_cast<size_t>(static_cast<double>(table.capacity) * load_factor);
+    const size_t groups = table.capacity / GROUP_SLOTS;
+
+    for (size_t i = 0; i < table.keys; ++i) {
+        uint64_t key = key_at(i);
+        uint64_t hash = hash_key(key);
+        size_t slot = fast_range(hash, table.capacity);
+        if (probe == Probe::LINEAR) {
+            while (table.slots[2 * slot] != 0) {
+                slot = (slot + 1 == table.capacity) ? 0 : slot + 1;
+            }
+        } else {
+            size_t group = slot / GROUP_SLOTS;
+            uint64_t empty;
+            while ((empty = match(table.tags + group * GROUP_SLOTS, EMPTY_TAG)) == 0) {
+                group = (group + 1 == groups) ? 0 : group + 1;
+            }
+            slot = group * GROUP_SLOTS + first_slot(empty);
+            table.tags[slot] = tag_of(hash);
+        }
+        table.slots[2 * slot] = key;
+        table.slots[2 * slot + 1] = i;
+    }
+}
+
+ProbeResult probe_pass(const Table& table, Probe probe, size_t lookups, size_t batch, uint64_t seed) {
+    ProbeResult result;
+    if (table.keys == 0) {
+        return result;
+    }
+    batch = std::clamp<size_t>(batch, 1, BenchmarkConstants::HASH_MAX_BATCH);
+    uint64_t keys[BenchmarkConstants::HASH_MAX_BATCH];
+    uint64_t hashes[BenchmarkConstants::HASH_MAX_BATCH];
+
+    for (size_t first = 0; first < lookups; first += batch) {
+        size_t count = std::min(batch, lookups - first);
+        // Hash the whole batch and start its misses before the first probe waits on one
+        for (size_t k = 0; k < count; ++k) {
+            size_t index = fast_range(mix64(seed + first + k), table.keys);
+            result.expected_sum += index;
+            keys[k] = key_at(index);
+            hashes[k] = hash_key(keys[k]);
+            if (batch > 1) {
+                size_t home = fast_range(hashes[k], table.capacity);
+                if (probe == Probe::GROUP) {
+                    __builtin_prefetch(table.tags + home / GROUP_SLOTS * GROUP_SLOTS, 0, 3);
+                    __builtin_prefetch(table.slots + 2 * (home / GROUP_SLOTS * GROUP_SLOTS), 0, 3);
+                } else {
+                    __builtin_prefetch(table.slots + 2 * home, 0, 3);
+                }
+            }
+        }
+        for (size_t k = 0; k < count; ++k) {
+            size_t home = fast_range(hashes[k], table.capacity);
+            size_t slot = probe == Probe::LINEAR ? find_linear(table, keys[k], home)
+                                                 : find_group(table, keys[k], home, tag_of(hashes[k]));
+            if (slot < table.capacity) {
+                ++result.found;
+                result.value_sum += table.slots[2 * slot + 1];
+            }
+        }
+    }
+    return result;
+}
+
+void fill_random_keys(uint64_t* keys, size_t count, uint64_t seed) {
+    for (size_t i = 0; i < count; ++i) {
+        keys[i] = mix64(seed + i);
+    }
+}
+
+void partition_pass(const uint64_t* src, uint64_t* dst, size_t count, unsigned shift) {
+    size_t offsets[RADIX_PARTITIONS] = {};
+    for (size_t i = 0; i < count; ++i) {
+        ++offsets[(src[i] >> shift) & (RADIX_PARTITIONS - 1)];
+    }
+    size_t start = 0;
+    for (size_t& offset : offsets) {
+        size_t size = offset;
+        offset = start;
+        start += size;
+    }
+
+    alignas(64) uint64_t lines[RADIX_PARTITIONS][LINE_KEYS];
+    size_t filled[RADIX_PARTITIONS] = {};
+    for (size_t i = 0; i < count; ++i) {
+        uint64_t key = src[i];
+        size_t partition = (key >> shift) & (RADIX_PARTITIONS - 1);
+        lines[partition][filled[partition]] = key;
+        if (++filled[partition] == LINE_KEYS) {
+            std::memcpy(dst + offsets[partition], lines[partition], sizeof(lines[partition]));
+            offsets[partition] += LINE_KEYS;
+            filled[partition] = 0;
+        }
+    }
+    for (size_t partition = 0; partition < RADIX_PARTITIONS; ++partition) {
+        std::memcpy(dst + offsets[partition], lines[partition], filled[partition] * sizeof(uint64_t));
+    }
+}
+
+bool is_partitioned(const uint64_t* src, const uint64_t* dst, size_t count, unsigned shift) {
+    uint64_t src_sum = 0, dst_sum = 0, src_xor = 0, dst_xor = 0;
+    size_t previous = 0;
+    for (size_t i = 0; i < count; ++i) {
+        size_t digit = (dst[i] >> shift) & (RADIX_PARTITIONS - 1);
+        if (digit < previous) {
+            return false;
+        }
+        previous = digit;
+        src_sum += src[i];
+        dst_sum += dst[i];
+        src_xor ^= src[i];
+        dst_xor ^= dst[i];
+    }
+    return src_sum == dst_sum && src_xor == dst_xor;
+}
+
+size_t fill_sorted_runs(uint64_t* keys, size_t count, size_t ways, uint64_t seed) {
+    size_t run_keys = count / ways;
+    for (size_t run = 0; run < ways; ++run) {
+        // Starts below 2^56 and gaps below 2^16 keep every run clear of overflow
+        uint64_t key = mix64(seed + run) >> 8;
+        for (size_t i = 0; i < run_keys; ++i) {
+            key += 1 + (mix64(seed ^ (run * run_keys + i)) & 0xFFFF);
+            keys[run * run_keys + i] = key;
+        }
+    }
+    return run_keys * ways;
+}
+
+void merge_pass(const uint64_t* src, uint64_t* dst, size_t count, size_t ways) {
+    ways = std::clamp<size_t>(ways, 1, BenchmarkConstants::MERGE_MAX_WAYS);
+    const size_t run_keys = count / ways;
+    if (run_keys == 0) {
+        return;
+    }
+    const uint64_t* heads[BenchmarkConstants::MERGE_MAX_WAYS];
+    const uint64_t* ends[BenchmarkConstants::MERGE_MAX_WAYS];
+    size_t heap[BenchmarkConstants::MERGE_MAX_WAYS];
+    size_t size = ways;
+    for (size_t run = 0; run < ways; ++run) {
+        heads[run] = src + run * run_keys;
+        ends[run] = heads[run] + run_keys;
+        heap[run] = run;
+    }
+
+    auto sift_down = [&](size_t node) {
+        size_t run = heap[node];
+        uint64_t key = *heads[run];
+        for (;;) {
+            size_t child = 2 * node + 1;
+            if (child >= size) {
+                break;
+            }
+            if (child + 1 < size && *heads[heap[child + 1]] < *heads[heap[child]]) {
+                ++child;
+            }
+            if (*heads[heap[child]] >= key) {
+                break;
+            }
+            heap[node] = heap[child];
+            node = child;
+        }
+        heap[node] = run;
+    };
+    for (size_t node = size / 2; node-- > 0;) {
+        sift_down(node);
+    }
+
+    uint64_t* out = dst;
+    while (size > 0) {
+        size_t run = heap[0];
+        *out++ = *heads[run]++;
+        if (heads[run] == ends[run]) {
+            heap[0] = heap[--size];
+        }
+        if (size > 0) {
+            sift_down(0);
+        }
+    }
+}
+
+bool is_merged(const uint64_t* src, const uint64_t* dst, size_t count) {
+    uint64_t src_sum = 0, dst_sum = 0, src_xor = 0, dst_xor = 0;
+    for (size_t i = 0; i < count; ++i) {
+        if (i > 0 && dst[i] < dst[i - 1]) {
+            return false;
+        }
+        src_sum += src[i];
+        dst_sum += dst[i];
+        src_xor ^= src[i];
+        dst_xor ^= dst[i];
+    }
+    return src_sum == dst_sum && src_xor == dst_xor;
+}
+
+}  // namespace ProxyKernels
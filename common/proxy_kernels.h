@@ -0,0 +1,172 @@
+#ifndef PROXY_KERNELS_H
+#define PROXY_KERNELS_H
+
+#include <cstddef>
+#include <cstdint>
+#include <string>
+
+#include "constants.h"
+
+/**
+ * @brief Hash-table probes, radix partitioning and multi-way merges as memory benchmarks
+ *
+ * Streams and random lines bracket what services do; these kernels are the
+ * inner loops of joins, group-bys and sorts, so a result in lookups or keys
+ * per second ranks machines the way those workloads would. Each thread
+ * works on its own slice: a hash table it builds and then probes, a column
+ * of 64-bit keys it partitions by one radix digit into the second array, or
+ * sorted runs it merges into the second array. Building the inputs happens
+ * before the clock starts.
+ */
+namespace ProxyKernels {
+
+/**
+ * @brief Probe sequence of the open-addressing table
+ */
+enum class Probe {
+    LINEAR,  ///< Slot after slot from the home slot, comparing keys
+    GROUP    ///< Swiss-table style: 16 one-byte tags compared at once, keys only on a tag match
+};
+
+/**
+ * @brief Parse --probe: linear or group
+ * @throws ArgumentError on anything else
+ */
+Probe parse_probe(const std::string& name);
+
+/**
+ * @brief Probe as passed to --probe and reported in results
+ */
+std::string probe_to_string(Probe probe);
+
+/**
+ * @brief Parse --load-factor: share of the slots filled, HASH_MIN_LOAD_FACTOR to HASH_MAX_LOAD_FACTOR
+ * @throws ArgumentError if the value is malformed or out of range
+ */
+double parse_load_factor(const std::string& text);
+
+/**
+ * @brief Parse --hash-batch: lookups hashed and prefetched together, 1 to HASH_MAX_BATCH
+ * @throws ArgumentError if the value is malformed or out of range
+ */
+size_t parse_batch(const std::string& text);
+
+/**
+ * @brief Parse --merge-ways: sorted runs merged at once, 2 to MERGE_MAX_WAYS
+ * @throws ArgumentError if the value is malformed or out of range
+ */
+size_t parse_merge_ways(const std::string& text);
+
+/**
+ * @brief Settings of the proxy patterns
+ */
+struct Config {
+    Probe probe = Probe::GROUP;
+    double load_factor = BenchmarkConstants::HASH_DEFAULT_LOAD_FACTOR;
+    size_t batch = BenchmarkConstants::HASH_DEFAULT_BATCH;  ///< 1 probes each key as it is hashed, without prefetch
+    size_t merge_ways = BenchmarkConstants::MERGE_DEFAULT_WAYS;
+};
+
+/// Bytes of a slot: a 64-bit key and a 64-bit value
+constexpr size_t SLOT_BYTES = 16;
+/// Slots of one tag group
+constexpr size_t GROUP_SLOTS = 16;
+/// Bits of the digit a radix pass partitions on
+constexpr unsigned RADIX_BITS = 8;
+constexpr size_t RADIX_PARTITIONS = size_t(1) << RADIX_BITS;
+
+/**
+ * @brief Bytes one lookup is accounted for (its slot), and one key for a partition pass or a merge
+ *
+ * A partition pass reads its keys twice, for the histogram and the scatter,
+ * and writes them once; a merge reads and writes each key once.
+ */
+constexpr size_t LOOKUP_BYTES = SLOT_BYTES;
+constexpr size_t PARTITION_BYTES_PER_KEY = 3 * sizeof(uint64_t);
+constexpr size_t MERGE_BYTES_PER_KEY = 2 * sizeof(uint64_t);
+
+/**
+ * @brief Open-addressing table laid out over a byte range
+ *
+ * Group tables keep one tag byte per slot in front of the slots. Keys are
+ * never 0, which marks an empty slot.
+ */
+struct Table {
+    uint8_t* tags = nullptr;      ///< GROUP only: 7-bit tag of each slot's hash, or EMPTY_TAG
+    uint64_t* slots = nullptr;    ///< Key then value, capacity pairs
+    size_t capacity = 0;          ///< Slots, a multiple of GROUP_SLOTS
+    size_t keys = 0;              ///< Keys inserted by build
+};
+
+/**
+ * @brief Table over [base, base + bytes); capacity 0 if the range is too small for one group
+ * @param base 16-byte aligned
+ */
+Table table_layout(uint8_t* base, size_t bytes, Probe probe);
+
+/**
+ * @brief Clear the table and insert capacity * load_factor keys, key_at(i) with value i
+ */
+void build(Table& table, Probe probe, double load_factor);
+
+/**
+ * @brief Distinct non-zero key of index i (a bijective 64-bit mix)
+ */
+uint64_t key_at(size_t index);
+
+/**
+ * @brief Outcome of one probe pass
+ */
+struct ProbeResult {
+    size_t found = 0;            ///< Lookups that found their key
+    uint64_t value_sum = 0;      ///< Values of the keys found
+    uint64_t expected_sum = 0;   ///< Indices of the keys looked up: value_sum when every lookup hit
+};
+
+/**
+ * @brief Look up `lookups` keys drawn pseudo-randomly from the inserted ones
+ * @param seed Varies the keys between passes
+ */
+ProbeResult probe_pass(const Table& table, Probe probe, size_t lookups, size_t batch, uint64_t seed);
+
+/**
+ * @brief Fill keys with pseudo-random 64-bit values
+ */
+void fill_random_keys(uint64_t* keys, size_t count, uint64_t seed);
+
+/**
+ * @brief Scatter src into dst by the RADIX_BITS-wide digit at shift, stable within a partition
+ *
+ * A histogram pass sizes the partitions, then keys go through one
+ * cache-line buffer per partition and are written out a line at a time,
+ * as software write-combining partitioners do.
+ */
+void partition_pass(const uint64_t* src, uint64_t* dst, size_t count, unsigned shift);
+
+/**
+ * @brief Whether dst is src partitioned on the digit at shift (same keys, digits ascending)
+ */
+bool is_partitioned(const uint64_t* src, const uint64_t* dst, size_t count, unsigned shift);
+
+/**
+ * @brief Write `ways` ascending runs of count / ways pseudo-random keys each, one after the other
+ * @return Keys written (count rounded down to a multiple of ways)
+ */
+size_t fill_sorted_runs(uint64_t* keys, size_t count, size_t ways, uint64_t seed);
+
+/**
+ * @brief Merge the `ways` equal runs of src (as fill_sorted_runs lays them out) into dst
+ *
+ * The run heads sit in a binary min-heap, so each key costs one
+ * log2(ways)-deep sift.
+ */
+void merge_pass(const uint64_t* src, uint64_t* dst, size_t count, size_t ways);
+
+/**
+ * @brief Whether dst is ascending and holds the same keys as src
+ */
+bool is_merged(const uint64_t* src, const uint64_t* dst, size_t count);
+
+}  // namespace ProxyKernels
+
+#endif  // PROXY_KERNELS_H
@@ -0,0 +1,99 @@
+#include "result_validation.h"
+
+#include <algorithm>
+#include <iomanip>
+#include <sstream>
+
+#include "constants.h"
+
+namespace ResultValidation {
+
+namespace {
+
+std::string format_gbps(double value) {
+    std::stringstream ss;
+    ss << std::fixed << std::setprecision(1) << value << " GB/s";
+    return ss.str();
+}
+
+}  // namespace
+
+std::string memory_level_to_string(MemoryLevel level) {
+    switch (level) {
+        case MemoryLevel::L1:
+            return "L1";
+        case MemoryLevel::L2:
+            return "L2";
+        case MemoryLevel::L3:
+            return "L3";
+        case MemoryLevel::DRAM:
+        default:
+            return "DRAM";
+    }
+}
+
+MemoryLevel classify_working_set(size_t bytes_per_thread, size_t total_bytes, const CacheInfo& cache_info) {
+    if (cache_info.l1_data_size > 0 && bytes_per_thread <= cache_info.l1_data_size) {
+        return MemoryLevel::L1;
+    }
+    if (cache_info.l2_size > 0 && bytes_per_thread <= cache_info.l2_size) {
+        return MemoryLevel::L2;
+    }
+    if (cache_info.l3_size > 0 && total_bytes <= cache_info.l3_size) {
+        return MemoryLevel::L3;
+    }
+    return MemoryLevel::DRAM;
+}
+
+double bandwidth_ceiling_gbps(MemoryLevel level, size_t num_threads, const MemorySpecs& mem_specs) {
+    using namespace BenchmarkConstants;
+    double threads = static_cast<double>(std::max<size_t>(1, num_threads));
+
+    switch (level) {
+        case MemoryLevel::L1:
+            return L1_BYTES_PER_CYCLE * MAX_CORE_CLOCK_GHZ * threads;
+        case MemoryLevel::L2:
+            return L2_BYTES_PER_CYCLE * MAX_CORE_CLOCK_GHZ * threads;
+        case MemoryLevel::L3:
+            return L3_BYTES_PER_CYCLE * MAX_CORE_CLOCK_GHZ * threads;
+        case MemoryLevel::DRAM:
+        default:
+            // Negative theoretical bandwidth marks virtualized hosts without usable specs
+            if (mem_specs.theoretical_bandwidth_gbps <= 0.0) {
+                return 0.0;
+            }
+            return mem_specs.theoretical_bandwidth_gbps * DRAM_CEILING_TOLERANCE;
+    }
+}
+
+std::vector<std::string> validate(const PerformanceStats& stats, size_t bytes_per_thread, size_t total_bytes,
+                                  size_t num_threads, const CacheInfo& cache_info, const MemorySpecs& mem_specs) {
+    std::vector<std::string> warnings;
+
+    if (!stats.verified) {
+        warnings.push_back("kernel output did not verify; loads or stores may have been optimized away");
+    }
+
+    if (stats.bytes_processed > 0 && stats.time_seconds <= 0.0) {
+        warnings.push_back("measured time is zero; the run is too short for the clock resolution");
+        return warnings;
+    }
+
+    MemoryLevel level = classify_working_set(bytes_per_thread, total_bytes, cache_info);
+    double ceiling = bandwidth_ceiling_gbps(level, num_threads, mem_specs);
+    if (ceiling > 0.0 && stats.bandwidth_gbps > ceiling) {
+        warnings.push_back("bandwidth " + format_gbps(stats.bandwidth_gbps) + " exceeds the " +
+                           memory_level_to_string(level) + " ceiling of " + format_gbps(ceiling));
+    }
+
+    if (stats.latency_ns > 0.0 && stats.latency_ns < BenchmarkConstants::MIN_LATENCY_NS) {
+        std::stringstream ss;
+        ss << "latency " << std::fixed << std::setprecision(2) << stats.latency_ns
+           << " ns is below the plausible minimum of " << BenchmarkConstants::MIN_LATENCY_NS << " ns";
+        warnings.push_back(ss.str());
+    }
+
+    return warnings;
+}
+
+}  // namespace ResultValidation
@@ -0,0 +1,73 @@
+#ifndef RESULT_VALIDATION_H
+#define RESULT_VALIDATION_H
+
+#include <cstddef>
+#include <string>
+#include <vector>
+
+#include "memory_types.h"
+#include "test_patterns.h"
+
+/**
+ * @brief Plausibility checks for measured results
+ *
+ * Results are never rewritten. A measurement that exceeds the ceiling of
+ * the level its working set lands in, or whose kernel output failed
+ * verification, carries a warning so the number can be investigated
+ * instead of silently trusted or silently capped.
+ */
+namespace ResultValidation {
+
+/**
+ * @brief Level of the memory hierarchy a working set is served from
+ */
+enum class MemoryLevel {
+    L1,   ///< Fits the per-core L1 data cache
+    L2,   ///< Fits the per-core L2
+    L3,   ///< Fits the shared L3
+    DRAM  ///< Larger than every cache level
+};
+
+/**
+ * @brief Short name of a level ("L1", "L2", "L3", "DRAM")
+ */
+std::string memory_level_to_string(MemoryLevel level);
+
+/**
+ * @brief Level a working set lands in
+ * @param bytes_per_thread Footprint of one thread across all buffers it touches
+ * @param total_bytes Footprint of all threads
+ * @param cache_info Detected cache sizes (levels reported as 0 are skipped)
+ */
+MemoryLevel classify_working_set(size_t bytes_per_thread, size_t total_bytes, const CacheInfo& cache_info);
+
+/**
+ * @brief Upper bound on plausible bandwidth for a level
+ *
+ * Cache ceilings assume the widest per-core load/store paths at the highest
+ * shipping clock, so only physically impossible results exceed them. The
+ * DRAM ceiling is the theoretical peak plus measurement headroom.
+ *
+ * @param level Level the working set lands in
+ * @param num_threads Threads sharing the measurement (each on its own core)
+ * @param mem_specs Detected memory specifications
+ * @return Ceiling in GB/s, or 0 if none is known (DRAM with undetected specs)
+ */
+double bandwidth_ceiling_gbps(MemoryLevel level, size_t num_threads, const MemorySpecs& mem_specs);
+
+/**
+ * @brief Check one measurement
+ * @param stats Aggregated statistics of the measurement
+ * @param bytes_per_thread Footprint of one thread across all buffers it touches
+ * @param total_bytes Footprint of all threads
+ * @param num_threads Threads used for the measurement
+ * @param cache_info Detected cache sizes
+ * @param mem_specs Detected memory specifications
+ * @return Human-readable warnings (empty if the result is plausible)
+ */
+std::vector<std::string> validate(const PerformanceStats& stats, size_t bytes_per_thread, size_t total_bytes,
+                                  size_t num_threads, const CacheInfo& cache_info, const MemorySpecs& mem_specs);
+
+}  // namespace ResultValidation
+
+#endif  // RESULT_VALIDATION_H
@@ -0,0 +1,524 @@
+#include "ring_transfer.h"
+#include "constants.h"
+#include "errors.h"
+#include "worker_pool.h"
+
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <cstdint>
+#include <cstring>
+#include <map>
+#include <new>
+#include <sstream>
+#include <thread>
+#include <tuple>
+
+#if defined(__x86_64__) || defined(__i386__)
+#include <immintrin.h>
+#endif
+
+namespace RingTransfer {
+
+namespace {
+
+using Clock = std::chrono::steady_clock;
+using CoherenceTests::PADDED_SLOT_BYTES;
+
+constexpr size_t LINE_BYTES = 64;
+constexpr size_t STAMP_BYTES = sizeof(uint64_t);
+
+// Spins before a waiter yields: only a descheduled partner keeps a slot busy this long
+constexpr size_t SPIN_LIMIT = 1 << 14;
+
+inline void cpu_relax() {
+#if defined(__x86_64__) || defined(__i386__)
+    _mm_pause();
+#elif defined(__aarch64__)
+    asm volatile("yield" ::: "memory");
+#endif
+}
+
+template <typename Attempt>
+void spin_until(Attempt attempt) {
+    size_t spins = 0;
+    while (!attempt()) {
+        if (++spins < SPIN_LIMIT) {
+            cpu_relax();
+        } else {
+            std::this_thread::yield();
+        }
+    }
+}
+
+size_t round_up(size_t value, size_t granule) {
+    return (value + granule - 1) / granule * granule;
+}
+
+// The message number in the first and last word: a torn or stale copy fails one of the two
+void stamp(uint8_t* payload, size_t bytes, uint64_t sequence) {
+    std::memcpy(payload, &sequence, STAMP_BYTES);
+    std::memcpy(payload + bytes - STAMP_BYTES, &sequence, STAMP_BYTES);
+}
+
+bool stamped(const uint8_t* payload, size_t bytes, uint64_t sequence) {
+    uint64_t first;
+    uint64_t last;
+    std::memcpy(&first, payload, STAMP_BYTES);
+    std::memcpy(&last, payload + bytes - STAMP_BYTES, STAMP_BYTES);
+    return first == sequence && last == sequence;
+}
+
+// Power-of-two count of line-aligned slots
+class SlotArray {
+public:
+    SlotArray(size_t slots, size_t stride) : storage_(slots * stride + LINE_BYTES), stride_(stride), mask_(slots - 1) {
+        uintptr_t raw = reinterpret_cast<uintptr_t>(storage_.data());
+        base_ = storage_.data() + (round_up(raw, LINE_BYTES) - raw);
+    }
+
+    uint8_t* slot(uint64_t index) { return base_ + static_cast<size_t>(index & mask_) * stride_; }
+
+private:
+    std::vector<uint8_t> storage_;
+    uint8_t* base_ = nullptr;
+    size_t stride_;
+    uint64_t mask_;
+};
+
+// Each index on its own padded slot, next to the owner's cached copy of the other one: a full or empty check
+// only reads the other core's line when the cached copy says the ring may be full or empty
+class SpscRing {
+public:
+    SpscRing(size_t slots, size_t payload_bytes)
+        : slots_(slots, round_up(payload_bytes, LINE_BYTES)), capacity_(slots), payload_bytes_(payload_bytes) {}
+
+    bool try_push(const uint8_t* source, uint64_t sequence) {
+        uint64_t head = producer_.head.load(std::memory_order_relaxed);
+        if (head - producer_.cached_tail == capacity_) {
+            producer_.cached_tail = consumer_.tail.load(std::memory_order_acquire);
+            if (head - producer_.cached_tail == capacity_) {
+                return false;
+            }
+        }
+        uint8_t* slot = slots_.slot(head);
+        std::memcpy(slot, source, payload_bytes_);
+        stamp(slot, payload_bytes_, sequence);
+        producer_.head.store(head + 1, std::memory_order_release);
+        return true;
+    }
+
+    bool try_pop(uint8_t* destination) {
+        uint64_t tail = consumer_.tail.load(std::memory_order_relaxed);
+        if (tail == consumer_.cached_head) {
+            consumer_.cached_head = producer_.head.load(std::memory_order_acquire);
+            if (tail == consumer_.cached_head) {
+                return false;
+            }
+        }
+        std::memcpy(destination, slots_.slot(tail), payload_bytes_);
+        consumer_.tail.store(tail + 1, std::memory_order_release);
+        return true;
+    }
+
+private:
+    struct alignas(PADDED_SLOT_BYTES) ProducerSide {
+        std::atomic<uint64_t> head{0};
+        uint64_t cached_tail = 0;
+    };
+    struct alignas(PADDED_SLOT_BYTES) ConsumerSide {
+        std::atomic<uint64_t> tail{0};
+        uint64_t cached_head = 0;
+    };
+
+    ProducerSide producer_;
+    ConsumerSide consumer_;
+    SlotArray slots_;
+    uint64_t capacity_;
+    size_t payload_bytes_;
+};
+
+// Bounded MPMC queue after Vyukov: positions are claimed by compare-exchange, and the sequence word at the
+// start of each slot says whether the slot is free for the position's producer or full for its consumer
+class MpmcRing {
+public:
+    MpmcRing(size_t slots, size_t payload_bytes)
+        : slots_(slots, round_up(STAMP_BYTES + payload_bytes, LINE_BYTES)), capacity_(slots),
+          payload_bytes_(payload_bytes) {
+        for (uint64_t i = 0; i < capacity_; ++i) {
+            new (slots_.slot(i)) std::atomic<uint64_t>(i);
+        }
+    }
+
+    bool try_push(const uint8_t* source, uint64_t sequence) {
+        uint64_t position = enqueue_.position.load(std::memory_order_relaxed);
+        for (;;) {
+            uint8_t* slot = slots_.slot(position);
+            int64_t lag = static_cast<int64_t>(slot_sequence(slot).load(std::memory_order_acquire) - position);
+            if (lag == 0) {
+                if (enqueue_.position.compare_exchange_weak(position, position + 1, std::memory_order_relaxed)) {
+                    std::memcpy(slot + STAMP_BYTES, source, payload_bytes_);
+                    stamp(slot + STAMP_BYTES, payload_bytes_, sequence);
+                    slot_sequence(slot).store(position + 1, std::memory_order_release);
+                    return true;
+                }
+            } else if (lag < 0) {
+                return false;  // Full: the slot still holds the message of the previous lap
+            } else {
+                position = enqueue_.position.load(std::memory_order_relaxed);
+            }
+        }
+    }
+
+    bool try_pop(uint8_t* destination) {
+        uint64_t position = dequeue_.position.load(std::memory_order_relaxed);
+        for (;;) {
+            uint8_t* slot = slots_.slot(position);
+            int64_t lag = static_cast<int64_t>(slot_sequence(slot).load(std::memory_order_acquire) - (position + 1));
+            if (lag == 0) {
+                if (dequeue_.position.compare_exchange_weak(position, position + 1, std::memory_order_relaxed)) {
+                    std::memcpy(destination, slot + STAMP_BYTES, payload_bytes_);
+                    slot_sequence(slot).store(position + capacity_, std::memory_order_release);
+                    return true;
+                }
+            } else if (lag < 0) {
+                return false;  // Empty: the producer of this position has not published yet
+            } else {
+                position = dequeue_.position.load(std::memory_order_relaxed);
+            }
+        }
+    }
+
+private:
+    struct alignas(PADDED_SLOT_BYTES) Position {
+        std::atomic<uint64_t> position{0};
+    };
+
+    static std::atomic<uint64_t>& slot_sequence(uint8_t* slot) {
+        return *std::launder(reinterpret_cast<std::atomic<uint64_t>*>(slot));
+    }
+
+    Position enqueue_;
+    Position dequeue_;
+    SlotArray slots_;
+    uint64_t capacity_;
+    size_t payload_bytes_;
+};
+
+double median_of(std::vector<double> values) {
+    if (values.empty()) {
+        return 0.0;
+    }
+    std::sort(values.begin(), values.end());
+    size_t mid = values.size() / 2;
+    return (values.size() % 2 == 1) ? values[mid] : (values[mid - 1] + values[mid]) / 2.0;
+}
+
+// Median seconds for the consumer to receive every message of a run; run 0 warms the ring and is discarded
+template <typename Ring>
+double stream(size_t payload_bytes, size_t producer_cpu, size_t consumer_cpu, size_t messages, size_t repetitions,
+              const CoherenceTests::PinFunction& pin, bool& verified) {
+    Ring ring(slot_count(payload_bytes), payload_bytes);
+    SpinBarrier barrier(2);
+    std::vector<double> seconds;
+    bool in_order = true;
+    bool drained = true;
+
+    std::thread producer([&] {
+        if (pin) {
+            pin(producer_cpu);
+        }
+        std::vector<uint8_t> source(payload_bytes, 0x5A);
+        uint64_t sequence = 0;
+        for (size_t run = 0; run <= repetitions; ++run) {
+            barrier.arrive_and_wait();
+            for (size_t i = 0; i < messages; ++i, ++sequence) {
+                spin_until([&] { return ring.try_push(source.data(), sequence); });
+            }
+        }
+    });
+    std::thread consumer([&] {
+        if (pin) {
+            pin(consumer_cpu);
+        }
+        std::vector<uint8_t> destination(payload_bytes);
+        uint64_t sequence = 0;
+        for (size_t run = 0; run <= repetitions; ++run) {
+            barrier.arrive_and_wait();
+            auto start = Clock::now();
+            for (size_t i = 0; i < messages; ++i, ++sequence) {
+                spin_until([&] { return ring.try_pop(destination.data()); });
+                in_order = in_order && stamped(destination.data(), payload_bytes, sequence);
+            }
+            if (run > 0) {
+                seconds.push_back(std::chrono::duration<double>(Clock::now() - start).count());
+            }
+        }
+        drained = !ring.try_pop(destination.data());
+    });
+    producer.join();
+    consumer.join();
+
+    verified = in_order && drained;
+    return median_of(seconds);
+}
+
+// Median one-way ns of a message sent through one ring and returned through another
+template <typename Ring>
+double handoff(size_t payload_bytes, size_t producer_cpu, size_t consumer_cpu, size_t round_trips,
+               size_t repetitions, const CoherenceTests::PinFunction& pin, bool& verified) {
+    Ring forward(slot_count(payload_bytes), payload_bytes);
+    Ring back(slot_count(payload_bytes), payload_bytes);
+    SpinBarrier barrier(2);
+    std::vector<double> one_way_ns;
+    bool initiator_ok = true;
+    bool responder_ok = true;
+
+    std::thread responder([&] {
+        if (pin) {
+            pin(consumer_cpu);
+        }
+        std::vector<uint8_t> message(payload_bytes);
+        uint64_t sequence = 0;
+        barrier.arrive_and_wait();
+        for (size_t i = 0; i < (repetitions + 1) * round_trips; ++i, ++sequence) {
+            spin_until([&] { return forward.try_pop(message.data()); });
+            responder_ok = responder_ok && stamped(message.data(), payload_bytes, sequence);
+            spin_until([&] { return back.try_push(message.data(), sequence); });
+        }
+    });
+    std::thread initiator([&] {
+        if (pin) {
+            pin(producer_cpu);
+        }
+        std::vector<uint8_t> message(payload_bytes, 0x5A);
+        uint64_t sequence = 0;
+        barrier.arrive_and_wait();
+        for (size_t run = 0; run <= repetitions; ++run) {
+            auto start = Clock::now();
+            for (size_t i = 0; i < round_trips; ++i, ++sequence) {
+                spin_until([&] { return forward.try_push(message.data(), sequence); });
+                spin_until([&] { return back.try_pop(message.data()); });
+                initiator_ok = initiator_ok && stamped(message.data(), payload_bytes, sequence);
+            }
+            double ns = std::chrono::duration<double, std::nano>(Clock::now() - start).count();
+            if (run > 0) {
+                one_way_ns.push_back(ns / (2.0 * static_cast<double>(round_trips)));
+            }
+        }
+    });
+    initiator.join();
+    responder.join();
+
+    verified = initiator_ok && responder_ok;
+    return median_of(one_way_ns);
+}
+
+template <typename Ring>
+void measure_with(Result& result, size_t repetitions, const CoherenceTests::PinFunction& pin) {
+    bool streamed = false;
+    bool handed_off = false;
+    result.seconds = stream<Ring>(result.payload_bytes, result.producer_cpu, result.consumer_cpu, result.messages,
+                                  repetitions, pin, streamed);
+    size_t round_trips = std::min(result.messages, BenchmarkConstants::RING_HANDOFF_ROUND_TRIPS);
+    result.handoff_ns = handoff<Ring>(result.payload_bytes, result.producer_cpu, result.consumer_cpu, round_trips,
+                                      repetitions, pin, handed_off);
+    result.verified = streamed && handed_off;
+}
+
+}  // namespace
+
+std::string kind_to_string(Kind kind) {
+    return kind == Kind::MPMC ? "mpmc" : "spsc";
+}
+
+std::string relation_to_string(Relation relation) {
+    switch (relation) {
+        case Relation::SMT:
+            return "smt";
+        case Relation::L2:
+            return "l2";
+        case Relation::LLC:
+            return "llc";
+        case Relation::PACKAGE:
+            return "package";
+        case Relation::REMOTE:
+            return "remote";
+    }
+    return "llc";
+}
+
+std::vector<Kind> parse_kinds(const std::string& list) {
+    std::vector<Kind> kinds;
+    std::stringstream stream(list);
+    std::string name;
+    while (std::getline(stream, name, ',')) {
+        Kind kind;
+        if (name == "spsc") {
+            kind = Kind::SPSC;
+        } else if (name == "mpmc") {
+            kind = Kind::MPMC;
+        } else {
+            throw ArgumentError("Unknown ring kind '" + name + "' (expected spsc or mpmc)");
+        }
+        if (std::find(kinds.begin(), kinds.end(), kind) == kinds.end()) {
+            kinds.push_back(kind);
+        }
+    }
+    if (kinds.empty()) {
+        throw ArgumentError("--ring-kinds needs at least one kind");
+    }
+    return kinds;
+}
+
+std::vector<size_t> parse_payloads(const std::string& list) {
+    std::vector<size_t> payloads;
+    std::stringstream items(list);
+    std::string item;
+    while (std::getline(items, item, ',')) {
+        size_t multiplier = 1;
+        std::string digits = item;
+        if (!digits.empty() && (digits.back() == 'k' || digits.back() == 'K')) {
+            multiplier = BenchmarkConstants::KB;
+            digits.pop_back();
+        }
+        if (digits.empty() || digits.size() > 6 || digits.find_first_not_of("0123456789") != std::string::npos) {
+            throw ArgumentError("Invalid ring payload '" + item + "'. Expected bytes with an optional k suffix");
+        }
+        size_t bytes = std::stoull(digits) * multiplier;
+        if (bytes < STAMP_BYTES || bytes % STAMP_BYTES != 0 || bytes > BenchmarkConstants::RING_MAX_PAYLOAD) {
+            throw ArgumentError("Ring payload '" + item + "' must be a multiple of 8 bytes from 8 to " +
+                                std::to_string(BenchmarkConstants::RING_MAX_PAYLOAD / BenchmarkConstants::KB) + "k");
+        }
+        if (std::find(payloads.begin(), payloads.end(), bytes) == payloads.end()) {
+            payloads.push_back(bytes);
+        }
+    }
+    if (payloads.empty()) {
+        throw ArgumentError("--ring-payload needs at least one size");
+    }
+    return payloads;
+}
+
+Relation classify(const CpuTopology& topology, const CacheInfo& cache, size_t cpu_a, size_t cpu_b) {
+    auto locate = [&](size_t cpu) -> const CpuLocation* {
+        for (const auto& location : topology.cpus) {
+            if (location.cpu == cpu) {
+                return &location;
+            }
+        }
+        return nullptr;
+    };
+    const CpuLocation* a = locate(cpu_a);
+    const CpuLocation* b = locate(cpu_b);
+    if (a == nullptr || b == nullptr) {
+        return Relation::PACKAGE;  // Offline or undetected: nothing closer can be claimed
+    }
+    if (a->core == b->core) {
+        return Relation::SMT;
+    }
+    for (const auto& instance : cache.l2_sharing) {
+        if (std::find(instance.begin(), instance.end(), cpu_a) != instance.end()) {
+            if (std::find(instance.begin(), instance.end(), cpu_b) != instance.end()) {
+                return Relation::L2;
+            }
+            break;
+        }
+    }
+    if (a->cluster == b->cluster) {
+        return Relation::LLC;
+    }
+    return a->package == b->package ? Relation::PACKAGE : Relation::REMOTE;
+}
+
+size_t slot_count(size_t payload_bytes) {
+    size_t wanted = BenchmarkConstants::RING_BYTES / std::max<size_t>(payload_bytes, 1);
+    size_t slots = BenchmarkConstants::RING_MIN_SLOTS;
+    while (slots < wanted && slots < BenchmarkConstants::RING_MAX_SLOTS) {
+        slots *= 2;
+    }
+    return slots;
+}
+
+Result measure(Kind kind, size_t payload_bytes, size_t producer_cpu, size_t consumer_cpu, size_t messages,
+               size_t repetitions, const CoherenceTests::PinFunction& pin) {
+    if (producer_cpu == consumer_cpu) {
+        throw ConfigurationError("A ring transfer needs two different CPUs, got CPU " + std::to_string(producer_cpu) +
+                                 " twice");
+    }
+    Result result;
+    result.kind = kind;
+    result.producer_cpu = producer_cpu;
+    result.consumer_cpu = consumer_cpu;
+    result.payload_bytes = payload_bytes;
+    result.slots = slot_count(payload_bytes);
+    result.messages = messages;
+    if (messages == 0 || payload_bytes < STAMP_BYTES) {
+        return result;
+    }
+    repetitions = std::max<size_t>(repetitions, 1);
+
+    if (kind == Kind::SPSC) {
+        measure_with<SpscRing>(result, repetitions, pin);
+    } else {
+        measure_with<MpmcRing>(result, repetitions, pin);
+    }
+    if (result.seconds > 0.0) {
+        result.messages_per_second = static_cast<double>(messages) / result.seconds;
+        result.bandwidth_gbps = result.messages_per_second * static_cast<double>(payload_bytes) / 1e9;
+    }
+    return result;
+}
+
+std::vector<Result> run(const std::vector<Kind>& kinds, const std::vector<size_t>& payloads,
+                        const std::vector<size_t>& cpus, const CpuTopology& topology, const CacheInfo& cache,
+                        size_t repetitions, const CoherenceTests::PinFunction& pin) {
+    if (cpus.size() < 2) {
+        throw ConfigurationError("Ring transfers need at least two CPUs");
+    }
+    std::vector<Result> results;
+    for (size_t i = 0; i < cpus.size(); ++i) {
+        for (size_t j = i + 1; j < cpus.size(); ++j) {
+            Relation relation = classify(topology, cache, cpus[i], cpus[j]);
+            for (Kind kind : kinds) {
+                for (size_t payload : payloads) {
+                    size_t messages = std::max(BenchmarkConstants::RING_TRANSFER_BYTES / payload,
+                                               BenchmarkConstants::RING_MIN_MESSAGES);
+                    Result result = measure(kind, payload, cpus[i], cpus[j], messages, repetitions, pin);
+                    result.relation = relation;
+                    results.push_back(result);
+                }
+            }
+        }
+    }
+    return results;
+}
+
+std::vector<RelationSummary> summarize(const std::vector<Result>& results) {
+    // Keyed by kind, then payload size, then relation from the closest out
+    std::map<std::tuple<int, size_t, int>, std::pair<std::vector<double>, std::vector<double>>> groups;
+    for (const auto& result : results) {
+        if (result.seconds <= 0.0) {
+            continue;
+        }
+        auto& group = groups[std::make_tuple(static_cast<int>(result.kind), result.payload_bytes,
+                                             static_cast<int>(result.relation))];
+        group.first.push_back(result.bandwidth_gbps);
+        group.second.push_back(result.handoff_ns);
+    }
+
+    std::vector<RelationSummary> summaries;
+    for (const auto& entry : groups) {
+        RelationSummary summary;
+        summary.kind = static_cast<Kind>(std::get<0>(entry.first));
+        summary.payload_bytes = std::get<1>(entry.first);
+        summary.relation = static_cast<Relation>(std::get<2>(entry.first));
+        summary.pairs = entry.second.first.size();
+        summary.median_gbps = median_of(entry.second.first);
+        summary.median_handoff_ns = median_of(entry.second.second);
+        summaries.push_back(summary);
+    }
+    return summaries;
+}
+
+}  // namespace RingTransfer
@@ -0,0 +1,155 @@
+#ifndef RING_TRANSFER_H
+#define RING_TRANSFER_H
+
+#include <cstddef>
+#include <string>
+#include <vector>
+
+#include "coherence_tests.h"
+#include "memory_types.h"
+
+/**
+ * @brief Producer/consumer transfers through shared-memory rings
+ *
+ * The bandwidth patterns give every thread a private slice; a pipeline
+ * instead hands batches from one pinned stage to the next through a ring,
+ * and every payload line, and the head and tail indices, then travel
+ * between the two cores. How fast depends on what the pair shares: an L2
+ * (SMT siblings, Arm clusters), a last-level cache, a package, or nothing
+ * but the socket interconnect. A lock-free SPSC ring and a bounded MPMC
+ * ring (per-slot sequence numbers, so any number of producers and
+ * consumers can share it) carry payloads of a given size between two
+ * pinned threads; each pair of CPUs is measured for streaming bandwidth
+ * and for the handoff latency of a single message, and labelled with the
+ * closest level of the topology the pair shares.
+ */
+namespace RingTransfer {
+
+/**
+ * @brief Ring algorithm
+ */
+enum class Kind {
+    SPSC,  ///< One producer, one consumer: plain loads and stores of head and tail
+    MPMC   ///< Bounded multi-producer multi-consumer: compare-exchange on the positions, a sequence per slot
+};
+
+/**
+ * @brief Closest level of the topology two CPUs share
+ */
+enum class Relation {
+    SMT,      ///< Hardware threads of one physical core
+    L2,       ///< Different cores sharing an L2 instance (Arm clusters)
+    LLC,      ///< Different L2s under one last-level cache (a CCX, a monolithic L3)
+    PACKAGE,  ///< Different last-level caches of one package
+    REMOTE    ///< Different packages
+};
+
+/**
+ * @brief Kind as reported in results ("spsc", "mpmc")
+ */
+std::string kind_to_string(Kind kind);
+
+/**
+ * @brief Relation as reported in results ("smt", "l2", "llc", "package", "remote")
+ */
+std::string relation_to_string(Relation relation);
+
+/**
+ * @brief Parse --ring-kinds: spsc, mpmc or both, comma-separated
+ * @throws ArgumentError on an unknown name or an empty list
+ */
+std::vector<Kind> parse_kinds(const std::string& list);
+
+/**
+ * @brief Parse --ring-payload: comma-separated sizes with an optional k suffix ("64,256,4k")
+ *
+ * Sizes are multiples of 8 bytes from 8 to RING_MAX_PAYLOAD, so the
+ * sequence stamp fits in the first and last word of every payload.
+ *
+ * @throws ArgumentError on a malformed or out-of-range size
+ */
+std::vector<size_t> parse_payloads(const std::string& list);
+
+/**
+ * @brief Closest level two CPUs share
+ *
+ * SMT, LLC, PACKAGE and REMOTE come from the topology; L2 from the L2
+ * sharing lists of cache, when sysfs reported them.
+ */
+Relation classify(const CpuTopology& topology, const CacheInfo& cache, size_t cpu_a, size_t cpu_b);
+
+/**
+ * @brief Slots of a ring carrying payload_bytes: RING_BYTES worth, clamped to RING_MIN_SLOTS-RING_MAX_SLOTS
+ *
+ * Always a power of two.
+ */
+size_t slot_count(size_t payload_bytes);
+
+/**
+ * @brief Outcome of one kind and payload size on one pair
+ */
+struct Result {
+    Kind kind = Kind::SPSC;
+    size_t producer_cpu = 0;
+    size_t consumer_cpu = 0;
+    Relation relation = Relation::LLC;
+    size_t payload_bytes = 0;
+    size_t slots = 0;                  ///< Ring capacity in messages
+    size_t messages = 0;               ///< Messages per timed run
+    double seconds = 0.0;              ///< Median time by the consumer to receive every message
+    double bandwidth_gbps = 0.0;       ///< Payload bytes received per second, in GB/s
+    double messages_per_second = 0.0;
+    double handoff_ns = 0.0;           ///< Median half round trip of one message through a pair of rings
+    bool verified = false;             ///< Every message arrived once, in order, with its stamp intact
+};
+
+/**
+ * @brief Stream messages from a producer to a consumer through one ring
+ *
+ * The producer copies each payload into the next free slot, stamping its
+ * message number into the first and last word; the consumer copies it out
+ * and checks the stamp. One warm-up run is discarded. The handoff latency
+ * sends one message at a time to a responder that returns it through a
+ * second ring, so neither ring ever holds more than one message.
+ *
+ * @param messages Messages per timed run (handoffs: at most RING_HANDOFF_ROUND_TRIPS)
+ * @param repetitions Timed runs; the result is their median
+ * @param pin Pins each thread (empty: no pinning)
+ * @throws ConfigurationError if producer_cpu and consumer_cpu are the same CPU
+ */
+Result measure(Kind kind, size_t payload_bytes, size_t producer_cpu, size_t consumer_cpu, size_t messages,
+               size_t repetitions, const CoherenceTests::PinFunction& pin);
+
+/**
+ * @brief Every kind and payload size on every pair of cpus
+ *
+ * The lower-numbered CPU of each pair produces. Each run transfers
+ * RING_TRANSFER_BYTES, and at least RING_MIN_MESSAGES messages.
+ *
+ * @param cpus CPUs to pair (at least two)
+ * @return Pair by pair, then kind, then payload size
+ */
+std::vector<Result> run(const std::vector<Kind>& kinds, const std::vector<size_t>& payloads,
+                        const std::vector<size_t>& cpus, const CpuTopology& topology, const CacheInfo& cache,
+                        size_t repetitions, const CoherenceTests::PinFunction& pin);
+
+/**
+ * @brief Median over the pairs of one relation, for one kind and payload size
+ */
+struct RelationSummary {
+    Kind kind = Kind::SPSC;
+    Relation relation = Relation::LLC;
+    size_t payload_bytes = 0;
+    size_t pairs = 0;
+    double median_gbps = 0.0;
+    double median_handoff_ns = 0.0;
+};
+
+/**
+ * @brief Group results by kind, payload size and relation, closest relation first
+ */
+std::vector<RelationSummary> summarize(const std::vector<Result>& results);
+
+}  // namespace RingTransfer
+
+#endif  // RING_TRANSFER_H
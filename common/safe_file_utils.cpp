@@ -6,11 +6,15 @@
 #include <limits.h>
 #include <unistd.h>
 #include <cstdlib>
+#include <cerrno>
 
 const std::vector<std::string> SafeFileUtils::ALLOWED_SYSTEM_PATHS = {
     "/proc/cpuinfo",
     "/proc/meminfo", 
     "/sys/devices/system/cpu/",
+    "/sys/devices/system/node/",
+    "/sys/devices/cpu_core/",  // Intel hybrid perf PMUs list the CPUs of each core type
+    "/sys/devices/cpu_atom/",
     "/sys/class/dmi/id/",
     "/sys/fs/cgroup/"
 };
@@ -43,14 +47,22 @@ bool SafeFileUtils::is_safe_path(const std::string& file_path) {
     // Check if canonical path starts with any allowed system path
     for (const auto& allowed_path : ALLOWED_SYSTEM_PATHS) {
         if (canonical_path.find(allowed_path) == 0) {
-            // Ensure it's either an exact match or the next character is '/'
+            // Ensure it's either an exact match, a directory entry (whitelisted
+            // directories end with '/'), or the next character is '/'
             if (canonical_path.length() == allowed_path.length() || 
+                allowed_path.back() == '/' ||
                 canonical_path[allowed_path.length()] == '/') {
                 return true;
             }
         }
     }
     
+    // The process's own /proc entries (/proc/self resolves to /proc/<pid>)
+    std::string own_proc = "/proc/" + std::to_string(getpid()) + "/";
+    if (canonical_path.find(own_proc) == 0) {
+        return true;
+    }
+    
     return false;
 }
 
@@ -194,4 +206,15 @@ bool SafeFileUtils::find_pattern(const std::string& file_path, const std::string
     
     file.close();
     return false;
-}
\ No newline at end of file
+}
+
+bool SafeFileUtils::make_parent_directories(const std::string& file_path, std::string& failed_directory) {
+    for (size_t slash = file_path.find('/', 1); slash != std::string::npos; slash = file_path.find('/', slash + 1)) {
+        std::string directory = file_path.substr(0, slash);
+        if (mkdir(directory.c_str(), 0755) != 0 && errno != EEXIST) {
+            failed_directory = directory;
+            return false;
+        }
+    }
+    return true;
+}
@@ -66,6 +66,7 @@ public:
      * - Null byte injection prevention
      * - Canonical path resolution to prevent symlink attacks
      * - Whitelist validation against allowed system paths
+     * - The process's own /proc/<pid>/ entries (e.g. /proc/self/smaps)
      * 
      * @param file_path Path to validate
      * @return true if path is safe, false otherwise
@@ -80,6 +81,15 @@ public:
      */
     static std::string sanitize_input(const std::string& input);
 
+    /**
+     * @brief Create every missing directory above a file path (mkdir -p of its parent)
+     * 
+     * @param file_path Path of the file to be written
+     * @param failed_directory Output for the directory that could not be created
+     * @return true if the parent directory exists now, false otherwise
+     */
+    static bool make_parent_directories(const std::string& file_path, std::string& failed_directory);
+
 private:
     /**
      * @brief Check if file size is within safe limits
@@ -0,0 +1,101 @@
+#include "sample_stats.h"
+
+#include <algorithm>
+#include <cmath>
+
+SampleRing::SampleRing(size_t capacity) : samples_(std::max<size_t>(1, capacity)), next_(0), count_(0) {}
+
+void SampleRing::clear() noexcept {
+    next_ = 0;
+    count_ = 0;
+}
+
+void SampleRing::record(double seconds, size_t bytes, size_t operations) noexcept {
+    samples_[next_] = {seconds, bytes, operations};
+    next_ = (next_ + 1) % samples_.size();
+    if (count_ < samples_.size()) {
+        ++count_;
+    }
+}
+
+size_t SampleRing::batch_size(size_t iterations) const noexcept {
+    return std::max<size_t>(1, (iterations + samples_.size() - 1) / samples_.size());
+}
+
+std::vector<IterationSample> SampleRing::samples() const {
+    std::vector<IterationSample> ordered;
+    ordered.reserve(count_);
+    size_t first = (count_ < samples_.size()) ? 0 : next_;
+    for (size_t i = 0; i < count_; ++i) {
+        ordered.push_back(samples_[(first + i) % samples_.size()]);
+    }
+    return ordered;
+}
+
+std::vector<double> SampleRing::bandwidth_samples() const {
+    std::vector<double> values;
+    values.reserve(count_);
+    for (const auto& sample : samples()) {
+        if (sample.seconds > 0.0) {
+            values.push_back(sample.bytes / (sample.seconds * 1e9));
+        }
+    }
+    return values;
+}
+
+std::vector<double> SampleRing::latency_samples() const {
+    std::vector<double> values;
+    values.reserve(count_);
+    for (const auto& sample : samples()) {
+        if (sample.operations > 0) {
+            values.push_back((sample.seconds * 1e9) / sample.operations);
+        }
+    }
+    return values;
+}
+
+namespace SampleStats {
+
+double percentile(const std::vector<double>& sorted, double fraction) {
+    if (sorted.size() == 1) {
+        return sorted.front();
+    }
+    double rank = fraction * (sorted.size() - 1);
+    size_t lower = static_cast<size_t>(std::floor(rank));
+    size_t upper = std::min(lower + 1, sorted.size() - 1);
+    double weight = rank - lower;
+    return sorted[lower] + (sorted[upper] - sorted[lower]) * weight;
+}
+
+DistributionStats summarize(std::vector<double> values) {
+    DistributionStats stats;
+    if (values.empty()) {
+        return stats;
+    }
+
+    std::sort(values.begin(), values.end());
+    stats.count = values.size();
+    stats.min = values.front();
+    stats.max = values.back();
+    stats.median = percentile(values, 0.50);
+    stats.p95 = percentile(values, 0.95);
+    stats.p99 = percentile(values, 0.99);
+
+    double sum = 0.0;
+    for (double value : values) {
+        sum += value;
+    }
+    stats.mean = sum / values.size();
+
+    if (values.size() > 1 && stats.mean != 0.0) {
+        double squares = 0.0;
+        for (double value : values) {
+            squares += (value - stats.mean) * (value - stats.mean);
+        }
+        double stddev = std::sqrt(squares / (values.size() - 1));
+        stats.cv = stddev / stats.mean;
+    }
+    return stats;
+}
+
+}  // namespace SampleStats
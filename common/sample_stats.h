@@ -0,0 +1,110 @@
+#ifndef SAMPLE_STATS_H
+#define SAMPLE_STATS_H
+
+#include <cstddef>
+#include <vector>
+
+#include "test_patterns.h"
+
+/**
+ * @brief Summary of a distribution of per-iteration samples
+ */
+struct DistributionStats {
+    size_t count = 0;     ///< Number of samples
+    double min = 0.0;     ///< Smallest sample
+    double median = 0.0;  ///< 50th percentile
+    double p95 = 0.0;     ///< 95th percentile
+    double p99 = 0.0;     ///< 99th percentile
+    double max = 0.0;     ///< Largest sample
+    double mean = 0.0;    ///< Arithmetic mean
+    double cv = 0.0;      ///< Coefficient of variation (sample stddev / mean)
+};
+
+/**
+ * @brief One thread's share of a measurement
+ */
+struct ThreadStats {
+    size_t thread_id = 0;            ///< Worker index (slice of the buffers it measured)
+    PerformanceStats stats{};        ///< Totals reported by the thread's test function
+    DistributionStats bandwidth;     ///< Per-iteration bandwidth of this thread (GB/s)
+    DistributionStats latency;       ///< Per-iteration latency of this thread (ns)
+};
+
+/**
+ * @brief One timed batch of iterations
+ */
+struct IterationSample {
+    double seconds = 0.0;    ///< Wall-clock time of the batch
+    size_t bytes = 0;        ///< Bytes moved by the batch
+    size_t operations = 0;   ///< Operations (cache lines, hops, elements) in the batch
+};
+
+/**
+ * @brief Fixed-capacity ring of iteration samples for one thread
+ *
+ * Storage is allocated once, so recording inside a timed loop never
+ * allocates. When full, the oldest sample is overwritten.
+ */
+class SampleRing {
+public:
+    /// Default number of samples kept per thread and measurement
+    static constexpr size_t DEFAULT_CAPACITY = 1024;
+
+    explicit SampleRing(size_t capacity = DEFAULT_CAPACITY);
+
+    /**
+     * @brief Discard all samples (capacity is kept)
+     */
+    void clear() noexcept;
+
+    /**
+     * @brief Append a sample, overwriting the oldest one when full
+     */
+    void record(double seconds, size_t bytes, size_t operations) noexcept;
+
+    /**
+     * @brief Iterations per sample so that a run of `iterations` fits the ring
+     */
+    size_t batch_size(size_t iterations) const noexcept;
+
+    size_t size() const noexcept { return count_; }
+    size_t capacity() const noexcept { return samples_.size(); }
+
+    /**
+     * @brief Samples in recording order (oldest first)
+     */
+    std::vector<IterationSample> samples() const;
+
+    /**
+     * @brief Bandwidth of every sample in GB/s
+     */
+    std::vector<double> bandwidth_samples() const;
+
+    /**
+     * @brief Latency of every sample in ns per operation
+     */
+    std::vector<double> latency_samples() const;
+
+private:
+    std::vector<IterationSample> samples_;
+    size_t next_;
+    size_t count_;
+};
+
+namespace SampleStats {
+
+/**
+ * @brief Percentile of sorted values with linear interpolation between ranks
+ * @param sorted Values in ascending order (must not be empty)
+ * @param fraction Percentile as a fraction in [0, 1]
+ */
+double percentile(const std::vector<double>& sorted, double fraction);
+
+/**
+ * @brief Summarize a set of samples (all zeros for an empty set)
+ */
+DistributionStats summarize(std::vector<double> values);
+
+}  // namespace SampleStats
+
+#endif  // SAMPLE_STATS_H
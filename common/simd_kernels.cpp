@@ -0,0 +1,2192 @@
+#include "simd_kernels.h"
+#include "cpu_features.h"
+#include "errors.h"
+
+#include <algorithm>
+#include <cstring>
+
+#if defined(__x86_64__) || defined(__amd64__)
+#include <immintrin.h>
+#define SIMD_KERNELS_X86 1
+#endif
+
+#if defined(__aarch64__)
+#include <arm_neon.h>
+#define SIMD_KERNELS_NEON 1
+#if defined(__ARM_FEATURE_SVE)
+#include <arm_sve.h>
+#define SIMD_KERNELS_SVE 1
+#endif
+#endif
+
+// Keep the scalar kernels scalar even under -O3 -march=native
+#if defined(__clang__)
+#define SCALAR_KERNEL
+#define SCALAR_LOOP _Pragma("clang loop vectorize(disable) interleave(disable)")
+#elif defined(__GNUC__)
+#define SCALAR_KERNEL __attribute__((optimize("no-tree-vectorize")))
+#define SCALAR_LOOP
+#else
+#define SCALAR_KERNEL
+#define SCALAR_LOOP
+#endif
+
+namespace SimdKernels {
+
+namespace {
+
+/**
+ * Kernel structure shared by every instruction set:
+ *
+ * - Main loop moves four vectors per iteration into four independent
+ *   accumulators, so the read kernels are not serialized on a single add
+ *   chain and can keep enough loads in flight to saturate the memory system.
+ * - A single-vector loop and an 8-byte scalar loop handle the tail, so any
+ *   multiple of 8 bytes is processed exactly.
+ */
+
+constexpr size_t PREFETCH_LINE_BYTES = 64;
+
+/**
+ * @brief Software-prefetch the lines of [ahead, ahead + bytes) for reading
+ *
+ * The read kernels are templated on whether they prefetch, so the plain
+ * read kernels compile to exactly the loops they had before; the
+ * prefetching variants issue one prefetch per line their unrolled
+ * iteration consumes, distance bytes ahead of it.
+ */
+inline void prefetch_lines(const uint8_t* current, size_t distance, size_t bytes) {
+    uintptr_t ahead = reinterpret_cast<uintptr_t>(current) + distance;
+    for (size_t line = 0; line < bytes; line += PREFETCH_LINE_BYTES) {
+        __builtin_prefetch(reinterpret_cast<const void*>(ahead + line), 0, 3);
+    }
+}
+
+// ---------------------------------------------------------------------------
+// Scalar
+// ---------------------------------------------------------------------------
+
+template <bool PREFETCH>
+SCALAR_KERNEL uint64_t read_scalar_impl(const uint8_t* data, size_t bytes, size_t distance) {
+    const uint64_t* p = reinterpret_cast<const uint64_t*>(data);
+    size_t n = bytes / sizeof(uint64_t);
+    uint64_t s0 = 0, s1 = 0, s2 = 0, s3 = 0;
+    size_t i = 0;
+    SCALAR_LOOP
+    for (; i + 8 <= n; i += 8) {
+        if constexpr (PREFETCH) {
+            prefetch_lines(data + i * sizeof(uint64_t), distance, 8 * sizeof(uint64_t));
+        }
+        s0 += p[i] + p[i + 4];
+        s1 += p[i + 1] + p[i + 5];
+        s2 += p[i + 2] + p[i + 6];
+        s3 += p[i + 3] + p[i + 7];
+    }
+    SCALAR_LOOP
+    for (; i < n; ++i) {
+        s0 += p[i];
+    }
+    return s0 + s1 + s2 + s3;
+}
+
+SCALAR_KERNEL uint64_t read_scalar(const uint8_t* data, size_t bytes) {
+    return read_scalar_impl<false>(data, bytes, 0);
+}
+
+SCALAR_KERNEL uint64_t read_prefetch_scalar(const uint8_t* data, size_t bytes, size_t distance) {
+    return read_scalar_impl<true>(data, bytes, distance);
+}
+
+SCALAR_KERNEL void write_scalar(uint8_t* data, size_t bytes, uint64_t pattern) {
+    uint64_t* p = reinterpret_cast<uint64_t*>(data);
+    size_t n = bytes / sizeof(uint64_t);
+    SCALAR_LOOP
+    for (size_t i = 0; i < n; ++i) {
+        p[i] = pattern;
+    }
+}
+
+SCALAR_KERNEL void copy_scalar(uint8_t* dst, const uint8_t* src, size_t bytes) {
+    uint64_t* d = reinterpret_cast<uint64_t*>(dst);
+    const uint64_t* s = reinterpret_cast<const uint64_t*>(src);
+    size_t n = bytes / sizeof(uint64_t);
+    SCALAR_LOOP
+    for (size_t i = 0; i < n; ++i) {
+        d[i] = s[i];
+    }
+}
+
+SCALAR_KERNEL void triad_scalar(double* a, const double* b, const double* c, double scalar,
+                                size_t count) {
+    SCALAR_LOOP
+    for (size_t i = 0; i < count; ++i) {
+        a[i] = b[i] + scalar * c[i];
+    }
+}
+
+SCALAR_KERNEL void scale_scalar(double* a, const double* b, double scalar, size_t count) {
+    SCALAR_LOOP
+    for (size_t i = 0; i < count; ++i) {
+        a[i] = scalar * b[i];
+    }
+}
+
+SCALAR_KERNEL void add_scalar(double* a, const double* b, const double* c, size_t count) {
+    SCALAR_LOOP
+    for (size_t i = 0; i < count; ++i) {
+        a[i] = b[i] + c[i];
+    }
+}
+
+/**
+ * @brief Elements [begin, end) of the multi-stream kernel, one element at a time
+ *
+ * Shared by every instruction set for the tail after its vector loop.
+ */
+SCALAR_KERNEL double streams_range(double* const* dst, size_t dst_count, const double* const* src,
+                                   size_t src_count, double fill, size_t begin, size_t end) {
+    double checksum = 0.0;
+    SCALAR_LOOP
+    for (size_t i = begin; i < end; ++i) {
+        double v = (src_count > 0) ? src[0][i] : fill;
+        for (size_t r = 1; r < src_count; ++r) {
+            v += src[r][i];
+        }
+        for (size_t w = 0; w < dst_count; ++w) {
+            dst[w][i] = v;
+        }
+        checksum += v;
+    }
+    return checksum;
+}
+
+double streams_scalar(double* const* dst, size_t dst_count, const double* const* src, size_t src_count,
+                      double fill, size_t count) {
+    return streams_range(dst, dst_count, src, src_count, fill, 0, count);
+}
+
+SCALAR_KERNEL uint64_t gather_scalar(const uint8_t* base, const uint32_t* indices, size_t count,
+                                     size_t element_bytes) {
+    if (element_bytes == 4) {
+        const uint32_t* p = reinterpret_cast<const uint32_t*>(base);
+        uint32_t sum = 0;
+        SCALAR_LOOP
+        for (size_t i = 0; i < count; ++i) {
+            sum += p[indices[i]];
+        }
+        return sum;
+    }
+    const uint64_t* p = reinterpret_cast<const uint64_t*>(base);
+    uint64_t sum = 0;
+    if (element_bytes == 8) {
+        SCALAR_LOOP
+        for (size_t i = 0; i < count; ++i) {
+            sum += p[indices[i]];
+        }
+        return sum;
+    }
+    SCALAR_LOOP
+    for (size_t i = 0; i < count; ++i) {
+        const uint64_t* line = p + static_cast<size_t>(indices[i]) * 8;
+        sum += (line[0] + line[1]) + (line[2] + line[3]) + (line[4] + line[5]) + (line[6] + line[7]);
+    }
+    return sum;
+}
+
+SCALAR_KERNEL void scatter_scalar(uint8_t* base, const uint32_t* indices, size_t count,
+                                  size_t element_bytes, uint64_t pattern) {
+    if (element_bytes == 4) {
+        uint32_t* p = reinterpret_cast<uint32_t*>(base);
+        SCALAR_LOOP
+        for (size_t i = 0; i < count; ++i) {
+            p[indices[i]] = static_cast<uint32_t>(pattern);
+        }
+        return;
+    }
+    uint64_t* p = reinterpret_cast<uint64_t*>(base);
+    if (element_bytes == 8) {
+        SCALAR_LOOP
+        for (size_t i = 0; i < count; ++i) {
+            p[indices[i]] = pattern;
+        }
+        return;
+    }
+    SCALAR_LOOP
+    for (size_t i = 0; i < count; ++i) {
+        uint64_t* line = p + static_cast<size_t>(indices[i]) * 8;
+        for (size_t w = 0; w < 8; ++w) {
+            line[w] = pattern;
+        }
+    }
+}
+
+/**
+ * Decoders read value i from bit i * bits of the packed column through an
+ * 8-byte window (scalar) or one register per group of 8 or 16 values
+ * (vector), so each reads up to 62 bytes past its last value. The last
+ * DECODE_TAIL_VALUES values, 64 * bits bytes, always cover that reach: they
+ * are decoded from a zero-padded copy and no byte past the column is read.
+ */
+constexpr size_t DECODE_TAIL_VALUES = 512;
+constexpr size_t DECODE_PAD_BYTES = 64;
+
+template <typename Body>
+uint64_t decode_padded(const uint8_t* packed, size_t count, unsigned bits, Body body) {
+    size_t tail = std::min(count, DECODE_TAIL_VALUES);
+    size_t head = count - tail;
+    uint64_t sum = (head > 0) ? body(packed, head) : 0;
+
+    alignas(64) uint8_t padded[DECODE_TAIL_VALUES * 4 + DECODE_PAD_BYTES];
+    size_t tail_bytes = tail * bits / 8;
+    std::memcpy(padded, packed + head * bits / 8, tail_bytes);
+    std::memset(padded + tail_bytes, 0, DECODE_PAD_BYTES);
+    return sum + body(padded, tail);
+}
+
+inline uint32_t value_mask(unsigned bits) {
+    return (bits >= 32) ? 0xFFFFFFFFu : (1u << bits) - 1;
+}
+
+// Little-endian window: bit 0 of the column is bit 0 of its first byte
+inline uint32_t unpack_one(const uint8_t* packed, size_t i, unsigned bits, uint32_t mask) {
+    size_t bit = i * bits;
+    uint64_t window;
+    std::memcpy(&window, packed + bit / 8, sizeof(window));
+    return static_cast<uint32_t>(window >> (bit % 8)) & mask;
+}
+
+SCALAR_KERNEL uint64_t unpack_scalar_range(const uint8_t* packed, size_t count, unsigned bits) {
+    const uint32_t mask = value_mask(bits);
+    uint64_t sum = 0;
+    SCALAR_LOOP
+    for (size_t i = 0; i < count; ++i) {
+        sum += unpack_one(packed, i, bits, mask);
+    }
+    return sum;
+}
+
+SCALAR_KERNEL uint64_t delta_scalar_range(const uint8_t* packed, size_t count, unsigned bits, uint32_t& base) {
+    const uint32_t mask = value_mask(bits);
+    uint32_t value = base;
+    uint64_t sum = 0;
+    SCALAR_LOOP
+    for (size_t i = 0; i < count; ++i) {
+        value += unpack_one(packed, i, bits, mask);
+        sum += value;
+    }
+    base = value;
+    return sum;
+}
+
+SCALAR_KERNEL uint64_t dict_scalar_range(const uint8_t* packed, size_t count, unsigned bits,
+                                         const uint64_t* dictionary) {
+    const uint32_t mask = value_mask(bits);
+    uint64_t sum = 0;
+    SCALAR_LOOP
+    for (size_t i = 0; i < count; ++i) {
+        sum += dictionary[unpack_one(packed, i, bits, mask)];
+    }
+    return sum;
+}
+
+uint64_t unpack_scalar(const uint8_t* packed, size_t count, unsigned bits) {
+    return decode_padded(packed, count, bits,
+                         [bits](const uint8_t* p, size_t n) { return unpack_scalar_range(p, n, bits); });
+}
+
+uint64_t delta_scalar(const uint8_t* packed, size_t count, unsigned bits, uint32_t& base) {
+    return decode_padded(packed, count, bits,
+                         [bits, &base](const uint8_t* p, size_t n) { return delta_scalar_range(p, n, bits, base); });
+}
+
+uint64_t dict_scalar(const uint8_t* packed, size_t count, unsigned bits, const uint64_t* dictionary) {
+    return decode_padded(packed, count, bits, [bits, dictionary](const uint8_t* p, size_t n) {
+        return dict_scalar_range(p, n, bits, dictionary);
+    });
+}
+
+#ifdef SIMD_KERNELS_X86
+// ---------------------------------------------------------------------------
+// SSE2 (128-bit)
+// ---------------------------------------------------------------------------
+
+uint64_t horizontal_sum_128(__m128i v) {
+    uint64_t lanes[2];
+    _mm_storeu_si128(reinterpret_cast<__m128i*>(lanes), v);
+    return lanes[0] + lanes[1];
+}
+
+template <bool PREFETCH>
+__attribute__((target("sse2"))) uint64_t read_sse2_impl(const uint8_t* data, size_t bytes, size_t distance) {
+    const __m128i* p = reinterpret_cast<const __m128i*>(data);
+    size_t n = bytes / sizeof(__m128i);
+    __m128i a0 = _mm_setzero_si128(), a1 = _mm_setzero_si128();
+    __m128i a2 = _mm_setzero_si128(), a3 = _mm_setzero_si128();
+    size_t i = 0;
+    for (; i + 4 <= n; i += 4) {
+        if constexpr (PREFETCH) {
+            prefetch_lines(data + i * sizeof(__m128i), distance, 4 * sizeof(__m128i));
+        }
+        a0 = _mm_add_epi64(a0, _mm_loadu_si128(p + i));
+        a1 = _mm_add_epi64(a1, _mm_loadu_si128(p + i + 1));
+        a2 = _mm_add_epi64(a2, _mm_loadu_si128(p + i + 2));
+        a3 = _mm_add_epi64(a3, _mm_loadu_si128(p + i + 3));
+    }
+    for (; i < n; ++i) {
+        a0 = _mm_add_epi64(a0, _mm_loadu_si128(p + i));
+    }
+    uint64_t sum = horizontal_sum_128(_mm_add_epi64(_mm_add_epi64(a0, a1), _mm_add_epi64(a2, a3)));
+    return sum + read_scalar(data + n * sizeof(__m128i), bytes - n * sizeof(__m128i));
+}
+
+__attribute__((target("sse2"))) uint64_t read_sse2(const uint8_t* data, size_t bytes) {
+    return read_sse2_impl<false>(data, bytes, 0);
+}
+
+__attribute__((target("sse2"))) uint64_t read_prefetch_sse2(const uint8_t* data, size_t bytes, size_t distance) {
+    return read_sse2_impl<true>(data, bytes, distance);
+}
+
+__attribute__((target("sse2"))) void write_sse2(uint8_t* data, size_t bytes, uint64_t pattern) {
+    __m128i* p = reinterpret_cast<__m128i*>(data);
+    size_t n = bytes / sizeof(__m128i);
+    const __m128i v = _mm_set1_epi64x(static_cast<long long>(pattern));
+    size_t i = 0;
+    for (; i + 4 <= n; i += 4) {
+        _mm_storeu_si128(p + i, v);
+        _mm_storeu_si128(p + i + 1, v);
+        _mm_storeu_si128(p + i + 2, v);
+        _mm_storeu_si128(p + i + 3, v);
+    }
+    for (; i < n; ++i) {
+        _mm_storeu_si128(p + i, v);
+    }
+    write_scalar(data + n * sizeof(__m128i), bytes - n * sizeof(__m128i), pattern);
+}
+
+__attribute__((target("sse2"))) void copy_sse2(uint8_t* dst, const uint8_t* src, size_t bytes) {
+    __m128i* d = reinterpret_cast<__m128i*>(dst);
+    const __m128i* s = reinterpret_cast<const __m128i*>(src);
+    size_t n = bytes / sizeof(__m128i);
+    size_t i = 0;
+    for (; i + 4 <= n; i += 4) {
+        __m128i v0 = _mm_loadu_si128(s + i);
+        __m128i v1 = _mm_loadu_si128(s + i + 1);
+        __m128i v2 = _mm_loadu_si128(s + i + 2);
+        __m128i v3 = _mm_loadu_si128(s + i + 3);
+        _mm_storeu_si128(d + i, v0);
+        _mm_storeu_si128(d + i + 1, v1);
+        _mm_storeu_si128(d + i + 2, v2);
+        _mm_storeu_si128(d + i + 3, v3);
+    }
+    for (; i < n; ++i) {
+        _mm_storeu_si128(d + i, _mm_loadu_si128(s + i));
+    }
+    copy_scalar(dst + n * sizeof(__m128i), src + n * sizeof(__m128i), bytes - n * sizeof(__m128i));
+}
+
+__attribute__((target("sse2"))) void triad_sse2(double* a, const double* b, const double* c,
+                                                double scalar, size_t count) {
+    const __m128d s = _mm_set1_pd(scalar);
+    size_t i = 0;
+    for (; i + 8 <= count; i += 8) {
+        _mm_storeu_pd(a + i, _mm_add_pd(_mm_loadu_pd(b + i), _mm_mul_pd(s, _mm_loadu_pd(c + i))));
+        _mm_storeu_pd(a + i + 2,
+                      _mm_add_pd(_mm_loadu_pd(b + i + 2), _mm_mul_pd(s, _mm_loadu_pd(c + i + 2))));
+        _mm_storeu_pd(a + i + 4,
+                      _mm_add_pd(_mm_loadu_pd(b + i + 4), _mm_mul_pd(s, _mm_loadu_pd(c + i + 4))));
+        _mm_storeu_pd(a + i + 6,
+                      _mm_add_pd(_mm_loadu_pd(b + i + 6), _mm_mul_pd(s, _mm_loadu_pd(c + i + 6))));
+    }
+    triad_scalar(a + i, b + i, c + i, scalar, count - i);
+}
+
+__attribute__((target("sse2"))) void scale_sse2(double* a, const double* b,
+                                                double scalar, size_t count) {
+    const __m128d s = _mm_set1_pd(scalar);
+    size_t i = 0;
+    for (; i + 8 <= count; i += 8) {
+        _mm_storeu_pd(a + i, _mm_mul_pd(s, _mm_loadu_pd(b + i)));
+        _mm_storeu_pd(a + i + 2, _mm_mul_pd(s, _mm_loadu_pd(b + i + 2)));
+        _mm_storeu_pd(a + i + 4, _mm_mul_pd(s, _mm_loadu_pd(b + i + 4)));
+        _mm_storeu_pd(a + i + 6, _mm_mul_pd(s, _mm_loadu_pd(b + i + 6)));
+    }
+    scale_scalar(a + i, b + i, scalar, count - i);
+}
+
+__attribute__((target("sse2"))) void add_sse2(double* a, const double* b,
+                                              const double* c, size_t count) {
+    size_t i = 0;
+    for (; i + 8 <= count; i += 8) {
+        _mm_storeu_pd(a + i, _mm_add_pd(_mm_loadu_pd(b + i), _mm_loadu_pd(c + i)));
+        _mm_storeu_pd(a + i + 2, _mm_add_pd(_mm_loadu_pd(b + i + 2), _mm_loadu_pd(c + i + 2)));
+        _mm_storeu_pd(a + i + 4, _mm_add_pd(_mm_loadu_pd(b + i + 4), _mm_loadu_pd(c + i + 4)));
+        _mm_storeu_pd(a + i + 6, _mm_add_pd(_mm_loadu_pd(b + i + 6), _mm_loadu_pd(c + i + 6)));
+    }
+    add_scalar(a + i, b + i, c + i, count - i);
+}
+
+__attribute__((target("sse2"))) double streams_sse2(double* const* dst, size_t dst_count,
+                                                    const double* const* src, size_t src_count,
+                                                    double fill, size_t count) {
+    const __m128d f = _mm_set1_pd(fill);
+    __m128d c0 = _mm_setzero_pd(), c1 = _mm_setzero_pd();
+    __m128d c2 = _mm_setzero_pd(), c3 = _mm_setzero_pd();
+    size_t i = 0;
+    for (; i + 8 <= count; i += 8) {
+        __m128d v0 = f, v1 = f, v2 = f, v3 = f;
+        if (src_count > 0) {
+            v0 = _mm_loadu_pd(src[0] + i);
+            v1 = _mm_loadu_pd(src[0] + i + 2);
+            v2 = _mm_loadu_pd(src[0] + i + 4);
+            v3 = _mm_loadu_pd(src[0] + i + 6);
+        }
+        for (size_t r = 1; r < src_count; ++r) {
+            v0 = _mm_add_pd(v0, _mm_loadu_pd(src[r] + i));
+            v1 = _mm_add_pd(v1, _mm_loadu_pd(src[r] + i + 2));
+            v2 = _mm_add_pd(v2, _mm_loadu_pd(src[r] + i + 4));
+            v3 = _mm_add_pd(v3, _mm_loadu_pd(src[r] + i + 6));
+        }
+        for (size_t w = 0; w < dst_count; ++w) {
+            _mm_storeu_pd(dst[w] + i, v0);
+            _mm_storeu_pd(dst[w] + i + 2, v1);
+            _mm_storeu_pd(dst[w] + i + 4, v2);
+            _mm_storeu_pd(dst[w] + i + 6, v3);
+        }
+        if (dst_count == 0) {
+            c0 = _mm_add_pd(c0, v0);
+            c1 = _mm_add_pd(c1, v1);
+            c2 = _mm_add_pd(c2, v2);
+            c3 = _mm_add_pd(c3, v3);
+        }
+    }
+    double lanes[2];
+    _mm_storeu_pd(lanes, _mm_add_pd(_mm_add_pd(c0, c1), _mm_add_pd(c2, c3)));
+    return lanes[0] + lanes[1] + streams_range(dst, dst_count, src, src_count, fill, i, count);
+}
+
+// ---------------------------------------------------------------------------
+// AVX2 (256-bit)
+// ---------------------------------------------------------------------------
+
+template <bool PREFETCH>
+__attribute__((target("avx2"))) uint64_t read_avx2_impl(const uint8_t* data, size_t bytes, size_t distance) {
+    const __m256i* p = reinterpret_cast<const __m256i*>(data);
+    size_t n = bytes / sizeof(__m256i);
+    __m256i a0 = _mm256_setzero_si256(), a1 = _mm256_setzero_si256();
+    __m256i a2 = _mm256_setzero_si256(), a3 = _mm256_setzero_si256();
+    size_t i = 0;
+    for (; i + 4 <= n; i += 4) {
+        if constexpr (PREFETCH) {
+            prefetch_lines(data + i * sizeof(__m256i), distance, 4 * sizeof(__m256i));
+        }
+        a0 = _mm256_add_epi64(a0, _mm256_loadu_si256(p + i));
+        a1 = _mm256_add_epi64(a1, _mm256_loadu_si256(p + i + 1));
+        a2 = _mm256_add_epi64(a2, _mm256_loadu_si256(p + i + 2));
+        a3 = _mm256_add_epi64(a3, _mm256_loadu_si256(p + i + 3));
+    }
+    for (; i < n; ++i) {
+        a0 = _mm256_add_epi64(a0, _mm256_loadu_si256(p + i));
+    }
+    __m256i total = _mm256_add_epi64(_mm256_add_epi64(a0, a1), _mm256_add_epi64(a2, a3));
+    __m128i folded = _mm_add_epi64(_mm256_castsi256_si128(total), _mm256_extracti128_si256(total, 1));
+    uint64_t sum = horizontal_sum_128(folded);
+    return sum + read_scalar(data + n * sizeof(__m256i), bytes - n * sizeof(__m256i));
+}
+
+__attribute__((target("avx2"))) uint64_t read_avx2(const uint8_t* data, size_t bytes) {
+    return read_avx2_impl<false>(data, bytes, 0);
+}
+
+__attribute__((target("avx2"))) uint64_t read_prefetch_avx2(const uint8_t* data, size_t bytes, size_t distance) {
+    return read_avx2_impl<true>(data, bytes, distance);
+}
+
+__attribute__((target("avx2"))) void write_avx2(uint8_t* data, size_t bytes, uint64_t pattern) {
+    __m256i* p = reinterpret_cast<__m256i*>(data);
+    size_t n = bytes / sizeof(__m256i);
+    const __m256i v = _mm256_set1_epi64x(static_cast<long long>(pattern));
+    size_t i = 0;
+    for (; i + 4 <= n; i += 4) {
+        _mm256_storeu_si256(p + i, v);
+        _mm256_storeu_si256(p + i + 1, v);
+        _mm256_storeu_si256(p + i + 2, v);
+        _mm256_storeu_si256(p + i + 3, v);
+    }
+    for (; i < n; ++i) {
+        _mm256_storeu_si256(p + i, v);
+    }
+    write_scalar(data + n * sizeof(__m256i), bytes - n * sizeof(__m256i), pattern);
+}
+
+__attribute__((target("avx2"))) void copy_avx2(uint8_t* dst, const uint8_t* src, size_t bytes) {
+    __m256i* d = reinterpret_cast<__m256i*>(dst);
+    const __m256i* s = reinterpret_cast<const __m256i*>(src);
+    size_t n = bytes / sizeof(__m256i);
+    size_t i = 0;
+    for (; i + 4 <= n; i += 4) {
+        __m256i v0 = _mm256_loadu_si256(s + i);
+        __m256i v1 = _mm256_loadu_si256(s + i + 1);
+        __m256i v2 = _mm256_loadu_si256(s + i + 2);
+        __m256i v3 = _mm256_loadu_si256(s + i + 3);
+        _mm256_storeu_si256(d + i, v0);
+        _mm256_storeu_si256(d + i + 1, v1);
+        _mm256_storeu_si256(d + i + 2, v2);
+        _mm256_storeu_si256(d + i + 3, v3);
+    }
+    for (; i < n; ++i) {
+        _mm256_storeu_si256(d + i, _mm256_loadu_si256(s + i));
+    }
+    copy_scalar(dst + n * sizeof(__m256i), src + n * sizeof(__m256i), bytes - n * sizeof(__m256i));
+}
+
+__attribute__((target("avx2,fma"))) void triad_avx2(double* a, const double* b, const double* c,
+                                                    double scalar, size_t count) {
+    const __m256d s = _mm256_set1_pd(scalar);
+    size_t i = 0;
+    for (; i + 16 <= count; i += 16) {
+        _mm256_storeu_pd(a + i, _mm256_fmadd_pd(s, _mm256_loadu_pd(c + i), _mm256_loadu_pd(b + i)));
+        _mm256_storeu_pd(a + i + 4,
+                         _mm256_fmadd_pd(s, _mm256_loadu_pd(c + i + 4), _mm256_loadu_pd(b + i + 4)));
+        _mm256_storeu_pd(a + i + 8,
+                         _mm256_fmadd_pd(s, _mm256_loadu_pd(c + i + 8), _mm256_loadu_pd(b + i + 8)));
+        _mm256_storeu_pd(a + i + 12,
+                         _mm256_fmadd_pd(s, _mm256_loadu_pd(c + i + 12), _mm256_loadu_pd(b + i + 12)));
+    }
+    triad_scalar(a + i, b + i, c + i, scalar, count - i);
+}
+
+__attribute__((target("avx2,fma"))) void scale_avx2(double* a, const double* b,
+                                                    double scalar, size_t count) {
+    const __m256d s = _mm256_set1_pd(scalar);
+    size_t i = 0;
+    for (; i + 16 <= count; i += 16) {
+        _mm256_storeu_pd(a + i, _mm256_mul_pd(s, _mm256_loadu_pd(b + i)));
+        _mm256_storeu_pd(a + i + 4, _mm256_mul_pd(s, _mm256_loadu_pd(b + i + 4)));
+        _mm256_storeu_pd(a + i + 8, _mm256_mul_pd(s, _mm256_loadu_pd(b + i + 8)));
+        _mm256_storeu_pd(a + i + 12, _mm256_mul_pd(s, _mm256_loadu_pd(b + i + 12)));
+    }
+    scale_scalar(a + i, b + i, scalar, count - i);
+}
+
+__attribute__((target("avx2,fma"))) void add_avx2(double* a, const double* b,
+                                                  const double* c, size_t count) {
+    size_t i = 0;
+    for (; i + 16 <= count; i += 16) {
+        _mm256_storeu_pd(a + i, _mm256_add_pd(_mm256_loadu_pd(b + i), _mm256_loadu_pd(c + i)));
+        _mm256_storeu_pd(a + i + 4,
+                         _mm256_add_pd(_mm256_loadu_pd(b + i + 4), _mm256_loadu_pd(c + i + 4)));
+        _mm256_storeu_pd(a + i + 8,
+                         _mm256_add_pd(_mm256_loadu_pd(b + i + 8), _mm256_loadu_pd(c + i + 8)));
+        _mm256_storeu_pd(a + i + 12,
+                         _mm256_add_pd(_mm256_loadu_pd(b + i + 12), _mm256_loadu_pd(c + i + 12)));
+    }
+    add_scalar(a + i, b + i, c + i, count - i);
+}
+
+__attribute__((target("avx2,fma"))) double streams_avx2(double* const* dst, size_t dst_count,
+                                                        const double* const* src, size_t src_count,
+                                                        double fill, size_t count) {
+    const __m256d f = _mm256_set1_pd(fill);
+    __m256d c0 = _mm256_setzero_pd(), c1 = _mm256_setzero_pd();
+    __m256d c2 = _mm256_setzero_pd(), c3 = _mm256_setzero_pd();
+    size_t i = 0;
+    for (; i + 16 <= count; i += 16) {
+        __m256d v0 = f, v1 = f, v2 = f, v3 = f;
+        if (src_count > 0) {
+            v0 = _mm256_loadu_pd(src[0] + i);
+            v1 = _mm256_loadu_pd(src[0] + i + 4);
+            v2 = _mm256_loadu_pd(src[0] + i + 8);
+            v3 = _mm256_loadu_pd(src[0] + i + 12);
+        }
+        for (size_t r = 1; r < src_count; ++r) {
+            v0 = _mm256_add_pd(v0, _mm256_loadu_pd(src[r] + i));
+            v1 = _mm256_add_pd(v1, _mm256_loadu_pd(src[r] + i + 4));
+            v2 = _mm256_add_pd(v2, _mm256_loadu_pd(src[r] + i + 8));
+            v3 = _mm256_add_pd(v3, _mm256_loadu_pd(src[r] + i + 12));
+        }
+        for (size_t w = 0; w < dst_count; ++w) {
+            _mm256_storeu_pd(dst[w] + i, v0);
+            _mm256_storeu_pd(dst[w] + i + 4, v1);
+            _mm256_storeu_pd(dst[w] + i + 8, v2);
+            _mm256_storeu_pd(dst[w] + i + 12, v3);
+        }
+        if (dst_count == 0) {
+            c0 = _mm256_add_pd(c0, v0);
+            c1 = _mm256_add_pd(c1, v1);
+            c2 = _mm256_add_pd(c2, v2);
+            c3 = _mm256_add_pd(c3, v3);
+        }
+    }
+    double lanes[4];
+    _mm256_storeu_pd(lanes, _mm256_add_pd(_mm256_add_pd(c0, c1), _mm256_add_pd(c2, c3)));
+    return lanes[0] + lanes[1] + lanes[2] + lanes[3] +
+           streams_range(dst, dst_count, src, src_count, fill, i, count);
+}
+
+__attribute__((target("avx2"))) uint64_t gather_avx2(const uint8_t* base, const uint32_t* indices,
+                                                     size_t count, size_t element_bytes) {
+    __m256i a0 = _mm256_setzero_si256(), a1 = _mm256_setzero_si256();
+    size_t i = 0;
+    if (element_bytes == 4) {
+        const int* p = reinterpret_cast<const int*>(base);
+        for (; i + 16 <= count; i += 16) {
+            __m256i i0 = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(indices + i));
+            __m256i i1 = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(indices + i + 8));
+            a0 = _mm256_add_epi32(a0, _mm256_i32gather_epi32(p, i0, 4));
+            a1 = _mm256_add_epi32(a1, _mm256_i32gather_epi32(p, i1, 4));
+        }
+        uint32_t lanes[8];
+        _mm256_storeu_si256(reinterpret_cast<__m256i*>(lanes), _mm256_add_epi32(a0, a1));
+        uint32_t sum = 0;
+        for (uint32_t lane : lanes) {
+            sum += lane;
+        }
+        return static_cast<uint32_t>(sum + gather_scalar(base, indices + i, count - i, 4));
+    }
+    if (element_bytes == 8) {
+        const long long* p = reinterpret_cast<const long long*>(base);
+        for (; i + 8 <= count; i += 8) {
+            __m128i i0 = _mm_loadu_si128(reinterpret_cast<const __m128i*>(indices + i));
+            __m128i i1 = _mm_loadu_si128(reinterpret_cast<const __m128i*>(indices + i + 4));
+            a0 = _mm256_add_epi64(a0, _mm256_i32gather_epi64(p, i0, 8));
+            a1 = _mm256_add_epi64(a1, _mm256_i32gather_epi64(p, i1, 8));
+        }
+    } else {
+        // Whole lines: two full-width loads per element, no gather needed
+        for (; i < count; ++i) {
+            const __m256i* line = reinterpret_cast<const __m256i*>(base + static_cast<size_t>(indices[i]) * 64);
+            a0 = _mm256_add_epi64(a0, _mm256_loadu_si256(line));
+            a1 = _mm256_add_epi64(a1, _mm256_loadu_si256(line + 1));
+        }
+    }
+    uint64_t lanes[4];
+    _mm256_storeu_si256(reinterpret_cast<__m256i*>(lanes), _mm256_add_epi64(a0, a1));
+    return lanes[0] + lanes[1] + lanes[2] + lanes[3] +
+           gather_scalar(base, indices + i, count - i, element_bytes);
+}
+
+/**
+ * Lanes of one group of 8 values, bits bytes apart: value j starts at bit
+ * j * bits, so it is the dword pair (lo, lo + 1) around that bit shifted
+ * right by its offset within lo. Shifts of 32 give zero, so a value that
+ * ends on a dword boundary takes nothing from the next one.
+ */
+struct Avx2Unpacker {
+    __m256i lo, hi, shift, carry, mask;
+};
+
+__attribute__((target("avx2"))) Avx2Unpacker make_unpacker_avx2(unsigned bits) {
+    alignas(32) int lo[8], shift[8];
+    for (unsigned j = 0; j < 8; ++j) {
+        lo[j] = static_cast<int>(j * bits / 32);
+        shift[j] = static_cast<int>(j * bits % 32);
+    }
+    Avx2Unpacker u;
+    u.lo = _mm256_load_si256(reinterpret_cast<const __m256i*>(lo));
+    u.hi = _mm256_add_epi32(u.lo, _mm256_set1_epi32(1));
+    u.shift = _mm256_load_si256(reinterpret_cast<const __m256i*>(shift));
+    u.carry = _mm256_sub_epi32(_mm256_set1_epi32(32), u.shift);
+    u.mask = _mm256_set1_epi32(static_cast<int>(value_mask(bits)));
+    return u;
+}
+
+__attribute__((target("avx2"))) inline __m256i unpack8_avx2(const uint8_t* group, const Avx2Unpacker& u) {
+    __m256i words = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(group));
+    __m256i lo = _mm256_srlv_epi32(_mm256_permutevar8x32_epi32(words, u.lo), u.shift);
+    __m256i hi = _mm256_sllv_epi32(_mm256_permutevar8x32_epi32(words, u.hi), u.carry);
+    return _mm256_and_si256(_mm256_or_si256(lo, hi), u.mask);
+}
+
+// Widen eight 32-bit values into the 64-bit lanes of acc
+__attribute__((target("avx2"))) inline __m256i add_widened_avx2(__m256i acc, __m256i values) {
+    acc = _mm256_add_epi64(acc, _mm256_and_si256(values, _mm256_set1_epi64x(0xFFFFFFFFLL)));
+    return _mm256_add_epi64(acc, _mm256_srli_epi64(values, 32));
+}
+
+__attribute__((target("avx2"))) inline uint64_t sum_lanes_avx2(__m256i acc) {
+    uint64_t lanes[4];
+    _mm256_storeu_si256(reinterpret_cast<__m256i*>(lanes), acc);
+    return lanes[0] + lanes[1] + lanes[2] + lanes[3];
+}
+
+__attribute__((target("avx2"))) uint64_t unpack_avx2_range(const uint8_t* packed, size_t count, unsigned bits) {
+    const Avx2Unpacker u = make_unpacker_avx2(bits);
+    __m256i a0 = _mm256_setzero_si256(), a1 = _mm256_setzero_si256();
+    for (size_t i = 0; i < count; i += 16) {
+        a0 = add_widened_avx2(a0, unpack8_avx2(packed, u));
+        a1 = add_widened_avx2(a1, unpack8_avx2(packed + bits, u));
+        packed += 2 * bits;
+    }
+    return sum_lanes_avx2(_mm256_add_epi64(a0, a1));
+}
+
+__attribute__((target("avx2"))) uint64_t delta_avx2_range(const uint8_t* packed, size_t count, unsigned bits,
+                                                          uint32_t& base) {
+    const Avx2Unpacker u = make_unpacker_avx2(bits);
+    const __m256i last = _mm256_set1_epi32(7);
+    __m256i running = _mm256_set1_epi32(static_cast<int>(base));
+    __m256i acc = _mm256_setzero_si256();
+    for (size_t i = 0; i < count; i += 8) {
+        // Prefix sum within each 128-bit half, then carry the low half's total into the high one
+        __m256i x = unpack8_avx2(packed, u);
+        x = _mm256_add_epi32(x, _mm256_slli_si256(x, 4));
+        x = _mm256_add_epi32(x, _mm256_slli_si256(x, 8));
+        __m256i low_total = _mm256_permutevar8x32_epi32(x, _mm256_set1_epi32(3));
+        x = _mm256_add_epi32(x, _mm256_blend_epi32(_mm256_setzero_si256(), low_total, 0xF0));
+        x = _mm256_add_epi32(x, running);
+        running = _mm256_permutevar8x32_epi32(x, last);
+        acc = add_widened_avx2(acc, x);
+        packed += bits;
+    }
+    base = static_cast<uint32_t>(_mm256_cvtsi256_si32(running));
+    return sum_lanes_avx2(acc);
+}
+
+__attribute__((target("avx2"))) uint64_t dict_avx2_range(const uint8_t* packed, size_t count, unsigned bits,
+                                                         const uint64_t* dictionary) {
+    const Avx2Unpacker u = make_unpacker_avx2(bits);
+    const long long* table = reinterpret_cast<const long long*>(dictionary);
+    __m256i a0 = _mm256_setzero_si256(), a1 = _mm256_setzero_si256();
+    for (size_t i = 0; i < count; i += 8) {
+        __m256i codes = unpack8_avx2(packed, u);
+        a0 = _mm256_add_epi64(a0, _mm256_i32gather_epi64(table, _mm256_castsi256_si128(codes), 8));
+        a1 = _mm256_add_epi64(a1, _mm256_i32gather_epi64(table, _mm256_extracti128_si256(codes, 1), 8));
+        packed += bits;
+    }
+    return sum_lanes_avx2(_mm256_add_epi64(a0, a1));
+}
+
+uint64_t unpack_avx2(const uint8_t* packed, size_t count, unsigned bits) {
+    return decode_padded(packed, count, bits,
+                         [bits](const uint8_t* p, size_t n) { return unpack_avx2_range(p, n, bits); });
+}
+
+uint64_t delta_avx2(const uint8_t* packed, size_t count, unsigned bits, uint32_t& base) {
+    return decode_padded(packed, count, bits,
+                         [bits, &base](const uint8_t* p, size_t n) { return delta_avx2_range(p, n, bits, base); });
+}
+
+uint64_t dict_avx2(const uint8_t* packed, size_t count, unsigned bits, const uint64_t* dictionary) {
+    return decode_padded(packed, count, bits, [bits, dictionary](const uint8_t* p, size_t n) {
+        return dict_avx2_range(p, n, bits, dictionary);
+    });
+}
+
+// ---------------------------------------------------------------------------
+// AVX-512 (512-bit)
+// ---------------------------------------------------------------------------
+
+template <bool PREFETCH>
+__attribute__((target("avx512f"))) uint64_t read_avx512_impl(const uint8_t* data, size_t bytes, size_t distance) {
+    const __m512i* p = reinterpret_cast<const __m512i*>(data);
+    size_t n = bytes / sizeof(__m512i);
+    __m512i a0 = _mm512_setzero_si512(), a1 = _mm512_setzero_si512();
+    __m512i a2 = _mm512_setzero_si512(), a3 = _mm512_setzero_si512();
+    size_t i = 0;
+    for (; i + 4 <= n; i += 4) {
+        if constexpr (PREFETCH) {
+            prefetch_lines(data + i * sizeof(__m512i), distance, 4 * sizeof(__m512i));
+        }
+        a0 = _mm512_add_epi64(a0, _mm512_loadu_si512(p + i));
+        a1 = _mm512_add_epi64(a1, _mm512_loadu_si512(p + i + 1));
+        a2 = _mm512_add_epi64(a2, _mm512_loadu_si512(p + i + 2));
+        a3 = _mm512_add_epi64(a3, _mm512_loadu_si512(p + i + 3));
+    }
+    for (; i < n; ++i) {
+        a0 = _mm512_add_epi64(a0, _mm512_loadu_si512(p + i));
+    }
+    __m512i total = _mm512_add_epi64(_mm512_add_epi64(a0, a1), _mm512_add_epi64(a2, a3));
+    // Fold by hand; _mm512_reduce_add_epi64 trips -Wuninitialized on GCC 12
+    uint64_t lanes[8];
+    _mm512_storeu_si512(lanes, total);
+    uint64_t sum = 0;
+    for (uint64_t lane : lanes) {
+        sum += lane;
+    }
+    return sum + read_scalar(data + n * sizeof(__m512i), bytes - n * sizeof(__m512i));
+}
+
+__attribute__((target("avx512f"))) uint64_t read_avx512(const uint8_t* data, size_t bytes) {
+    return read_avx512_impl<false>(data, bytes, 0);
+}
+
+__attribute__((target("avx512f"))) uint64_t read_prefetch_avx512(const uint8_t* data, size_t bytes,
+                                                                 size_t distance) {
+    return read_avx512_impl<true>(data, bytes, distance);
+}
+
+__attribute__((target("avx512f"))) void write_avx512(uint8_t* data, size_t bytes,
+                                                     uint64_t pattern) {
+    __m512i* p = reinterpret_cast<__m512i*>(data);
+    size_t n = bytes / sizeof(__m512i);
+    const __m512i v = _mm512_set1_epi64(static_cast<long long>(pattern));
+    size_t i = 0;
+    for (; i + 4 <= n; i += 4) {
+        _mm512_storeu_si512(p + i, v);
+        _mm512_storeu_si512(p + i + 1, v);
+        _mm512_storeu_si512(p + i + 2, v);
+        _mm512_storeu_si512(p + i + 3, v);
+    }
+    for (; i < n; ++i) {
+        _mm512_storeu_si512(p + i, v);
+    }
+    write_scalar(data + n * sizeof(__m512i), bytes - n * sizeof(__m512i), pattern);
+}
+
+__attribute__((target("avx512f"))) void copy_avx512(uint8_t* dst, const uint8_t* src,
+                                                    size_t bytes) {
+    __m512i* d = reinterpret_cast<__m512i*>(dst);
+    const __m512i* s = reinterpret_cast<const __m512i*>(src);
+    size_t n = bytes / sizeof(__m512i);
+    size_t i = 0;
+    for (; i + 4 <= n; i += 4) {
+        __m512i v0 = _mm512_loadu_si512(s + i);
+        __m512i v1 = _mm512_loadu_si512(s + i + 1);
+        __m512i v2 = _mm512_loadu_si512(s + i + 2);
+        __m512i v3 = _mm512_loadu_si512(s + i + 3);
+        _mm512_storeu_si512(d + i, v0);
+        _mm512_storeu_si512(d + i + 1, v1);
+        _mm512_storeu_si512(d + i + 2, v2);
+        _mm512_storeu_si512(d + i + 3, v3);
+    }
+    for (; i < n; ++i) {
+        _mm512_storeu_si512(d + i, _mm512_loadu_si512(s + i));
+    }
+    copy_scalar(dst + n * sizeof(__m512i), src + n * sizeof(__m512i), bytes - n * sizeof(__m512i));
+}
+
+__attribute__((target("avx512f"))) void triad_avx512(double* a, const double* b, const double* c,
+                                                     double scalar, size_t count) {
+    const __m512d s = _mm512_set1_pd(scalar);
+    size_t i = 0;
+    for (; i + 32 <= count; i += 32) {
+        _mm512_storeu_pd(a + i, _mm512_fmadd_pd(s, _mm512_loadu_pd(c + i), _mm512_loadu_pd(b + i)));
+        _mm512_storeu_pd(a + i + 8,
+                         _mm512_fmadd_pd(s, _mm512_loadu_pd(c + i + 8), _mm512_loadu_pd(b + i + 8)));
+        _mm512_storeu_pd(a + i + 16,
+                         _mm512_fmadd_pd(s, _mm512_loadu_pd(c + i + 16), _mm512_loadu_pd(b + i + 16)));
+        _mm512_storeu_pd(a + i + 24,
+                         _mm512_fmadd_pd(s, _mm512_loadu_pd(c + i + 24), _mm512_loadu_pd(b + i + 24)));
+    }
+    triad_scalar(a + i, b + i, c + i, scalar, count - i);
+}
+
+__attribute__((target("avx512f"))) void scale_avx512(double* a, const double* b,
+                                                     double scalar, size_t count) {
+    const __m512d s = _mm512_set1_pd(scalar);
+    size_t i = 0;
+    for (; i + 32 <= count; i += 32) {
+        _mm512_storeu_pd(a + i, _mm512_mul_pd(s, _mm512_loadu_pd(b + i)));
+        _mm512_storeu_pd(a + i + 8, _mm512_mul_pd(s, _mm512_loadu_pd(b + i + 8)));
+        _mm512_storeu_pd(a + i + 16, _mm512_mul_pd(s, _mm512_loadu_pd(b + i + 16)));
+        _mm512_storeu_pd(a + i + 24, _mm512_mul_pd(s, _mm512_loadu_pd(b + i + 24)));
+    }
+    scale_scalar(a + i, b + i, scalar, count - i);
+}
+
+__attribute__((target("avx512f"))) void add_avx512(double* a, const double* b,
+                                                   const double* c, size_t count) {
+    size_t i = 0;
+    for (; i + 32 <= count; i += 32) {
+        _mm512_storeu_pd(a + i, _mm512_add_pd(_mm512_loadu_pd(b + i), _mm512_loadu_pd(c + i)));
+        _mm512_storeu_pd(a + i + 8,
+                         _mm512_add_pd(_mm512_loadu_pd(b + i + 8), _mm512_loadu_pd(c + i + 8)));
+        _mm512_storeu_pd(a + i + 16,
+                         _mm512_add_pd(_mm512_loadu_pd(b + i + 16), _mm512_loadu_pd(c + i + 16)));
+        _mm512_storeu_pd(a + i + 24,
+                         _mm512_add_pd(_mm512_loadu_pd(b + i + 24), _mm512_loadu_pd(c + i + 24)));
+    }
+    add_scalar(a + i, b + i, c + i, count - i);
+}
+
+__attribute__((target("avx512f"))) double streams_avx512(double* const* dst, size_t dst_count,
+                                                         const double* const* src, size_t src_count,
+                                                         double fill, size_t count) {
+    const __m512d f = _mm512_set1_pd(fill);
+    __m512d c0 = _mm512_setzero_pd(), c1 = _mm512_setzero_pd();
+    __m512d c2 = _mm512_setzero_pd(), c3 = _mm512_setzero_pd();
+    size_t i = 0;
+    for (; i + 32 <= count; i += 32) {
+        __m512d v0 = f, v1 = f, v2 = f, v3 = f;
+        if (src_count > 0) {
+            v0 = _mm512_loadu_pd(src[0] + i);
+            v1 = _mm512_loadu_pd(src[0] + i + 8);
+            v2 = _mm512_loadu_pd(src[0] + i + 16);
+            v3 = _mm512_loadu_pd(src[0] + i + 24);
+        }
+        for (size_t r = 1; r < src_count; ++r) {
+            v0 = _mm512_add_pd(v0, _mm512_loadu_pd(src[r] + i));
+            v1 = _mm512_add_pd(v1, _mm512_loadu_pd(src[r] + i + 8));
+            v2 = _mm512_add_pd(v2, _mm512_loadu_pd(src[r] + i + 16));
+            v3 = _mm512_add_pd(v3, _mm512_loadu_pd(src[r] + i + 24));
+        }
+        for (size_t w = 0; w < dst_count; ++w) {
+            _mm512_storeu_pd(dst[w] + i, v0);
+            _mm512_storeu_pd(dst[w] + i + 8, v1);
+            _mm512_storeu_pd(dst[w] + i + 16, v2);
+            _mm512_storeu_pd(dst[w] + i + 24, v3);
+        }
+        if (dst_count == 0) {
+            c0 = _mm512_add_pd(c0, v0);
+            c1 = _mm512_add_pd(c1, v1);
+            c2 = _mm512_add_pd(c2, v2);
+            c3 = _mm512_add_pd(c3, v3);
+        }
+    }
+    double lanes[8];
+    _mm512_storeu_pd(lanes, _mm512_add_pd(_mm512_add_pd(c0, c1), _mm512_add_pd(c2, c3)));
+    double checksum = 0.0;
+    for (double lane : lanes) {
+        checksum += lane;
+    }
+    return checksum + streams_range(dst, dst_count, src, src_count, fill, i, count);
+}
+
+__attribute__((target("avx512f"))) uint64_t gather_avx512(const uint8_t* base, const uint32_t* indices,
+                                                          size_t count, size_t element_bytes) {
+    // Masked forms with a zeroed source: no dependency on the previous contents of the destination
+    const __m512i zero = _mm512_setzero_si512();
+    __m512i a0 = zero, a1 = zero;
+    size_t i = 0;
+    if (element_bytes == 4) {
+        for (; i + 32 <= count; i += 32) {
+            __m512i i0 = _mm512_loadu_si512(indices + i);
+            __m512i i1 = _mm512_loadu_si512(indices + i + 16);
+            a0 = _mm512_add_epi32(a0, _mm512_mask_i32gather_epi32(zero, 0xFFFF, i0, base, 4));
+            a1 = _mm512_add_epi32(a1, _mm512_mask_i32gather_epi32(zero, 0xFFFF, i1, base, 4));
+        }
+        uint32_t lanes[16];
+        _mm512_storeu_si512(lanes, _mm512_add_epi32(a0, a1));
+        uint32_t sum = 0;
+        for (uint32_t lane : lanes) {
+            sum += lane;
+        }
+        return static_cast<uint32_t>(sum + gather_scalar(base, indices + i, count - i, 4));
+    }
+    if (element_bytes == 8) {
+        for (; i + 16 <= count; i += 16) {
+            __m256i i0 = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(indices + i));
+            __m256i i1 = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(indices + i + 8));
+            a0 = _mm512_add_epi64(a0, _mm512_mask_i32gather_epi64(zero, 0xFF, i0, base, 8));
+            a1 = _mm512_add_epi64(a1, _mm512_mask_i32gather_epi64(zero, 0xFF, i1, base, 8));
+        }
+    } else {
+        // Whole lines: one full-width load per element
+        for (; i + 2 <= count; i += 2) {
+            a0 = _mm512_add_epi64(a0, _mm512_loadu_si512(base + static_cast<size_t>(indices[i]) * 64));
+            a1 = _mm512_add_epi64(a1, _mm512_loadu_si512(base + static_cast<size_t>(indices[i + 1]) * 64));
+        }
+    }
+    uint64_t lanes[8];
+    _mm512_storeu_si512(lanes, _mm512_add_epi64(a0, a1));
+    uint64_t sum = 0;
+    for (uint64_t lane : lanes) {
+        sum += lane;
+    }
+    return sum + gather_scalar(base, indices + i, count - i, element_bytes);
+}
+
+__attribute__((target("avx512f"))) void scatter_avx512(uint8_t* base, const uint32_t* indices,
+                                                       size_t count, size_t element_bytes,
+                                                       uint64_t pattern) {
+    size_t i = 0;
+    if (element_bytes == 4) {
+        const __m512i v = _mm512_set1_epi32(static_cast<int>(pattern));
+        for (; i + 16 <= count; i += 16) {
+            _mm512_i32scatter_epi32(base, _mm512_loadu_si512(indices + i), v, 4);
+        }
+    } else if (element_bytes == 8) {
+        const __m512i v = _mm512_set1_epi64(static_cast<long long>(pattern));
+        for (; i + 8 <= count; i += 8) {
+            __m256i idx = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(indices + i));
+            _mm512_i32scatter_epi64(base, idx, v, 8);
+        }
+    } else {
+        const __m512i v = _mm512_set1_epi64(static_cast<long long>(pattern));
+        for (; i < count; ++i) {
+            _mm512_storeu_si512(base + static_cast<size_t>(indices[i]) * 64, v);
+        }
+    }
+    scatter_scalar(base, indices + i, count - i, element_bytes, pattern);
+}
+
+// Lanes of one group of 16 values, 2 * bits bytes apart (see Avx2Unpacker). The decoders use
+// zero-masked forms with a full mask: once inlined, GCC 12 warns on the undefined source of the plain ones
+constexpr __mmask16 ALL_LANES = 0xFFFF;
+
+struct Avx512Unpacker {
+    __m512i lo, hi, shift, carry, mask;
+};
+
+__attribute__((target("avx512f"))) Avx512Unpacker make_unpacker_avx512(unsigned bits) {
+    alignas(64) int lo[16], shift[16];
+    for (unsigned j = 0; j < 16; ++j) {
+        lo[j] = static_cast<int>(j * bits / 32);
+        shift[j] = static_cast<int>(j * bits % 32);
+    }
+    Avx512Unpacker u;
+    u.lo = _mm512_load_si512(lo);
+    u.hi = _mm512_add_epi32(u.lo, _mm512_set1_epi32(1));
+    u.shift = _mm512_load_si512(shift);
+    u.carry = _mm512_sub_epi32(_mm512_set1_epi32(32), u.shift);
+    u.mask = _mm512_set1_epi32(static_cast<int>(value_mask(bits)));
+    return u;
+}
+
+__attribute__((target("avx512f"))) inline __m512i unpack16_avx512(const uint8_t* group, const Avx512Unpacker& u) {
+    __m512i words = _mm512_loadu_si512(group);
+    __m512i lo = _mm512_maskz_permutexvar_epi32(ALL_LANES, u.lo, words);
+    __m512i hi = _mm512_maskz_permutexvar_epi32(ALL_LANES, u.hi, words);
+    lo = _mm512_maskz_srlv_epi32(ALL_LANES, lo, u.shift);
+    hi = _mm512_maskz_sllv_epi32(ALL_LANES, hi, u.carry);
+    return _mm512_and_si512(_mm512_or_si512(lo, hi), u.mask);
+}
+
+__attribute__((target("avx512f"))) inline __m512i add_widened_avx512(__m512i acc, __m512i values) {
+    acc = _mm512_add_epi64(acc, _mm512_and_si512(values, _mm512_set1_epi64(0xFFFFFFFFLL)));
+    return _mm512_add_epi64(acc, _mm512_maskz_srli_epi64(0xFF, values, 32));
+}
+
+__attribute__((target("avx512f"))) inline uint64_t sum_lanes_avx512(__m512i acc) {
+    uint64_t lanes[8];
+    _mm512_storeu_si512(lanes, acc);
+    uint64_t sum = 0;
+    for (uint64_t lane : lanes) {
+        sum += lane;
+    }
+    return sum;
+}
+
+__attribute__((target("avx512f"))) uint64_t unpack_avx512_range(const uint8_t* packed, size_t count,
+                                                                unsigned bits) {
+    const Avx512Unpacker u = make_unpacker_avx512(bits);
+    __m512i a0 = _mm512_setzero_si512(), a1 = _mm512_setzero_si512();
+    for (size_t i = 0; i < count; i += 32) {
+        a0 = add_widened_avx512(a0, unpack16_avx512(packed, u));
+        a1 = add_widened_avx512(a1, unpack16_avx512(packed + 2 * bits, u));
+        packed += 4 * bits;
+    }
+    return sum_lanes_avx512(_mm512_add_epi64(a0, a1));
+}
+
+__attribute__((target("avx512f"))) uint64_t delta_avx512_range(const uint8_t* packed, size_t count,
+                                                               unsigned bits, uint32_t& base) {
+    const Avx512Unpacker u = make_unpacker_avx512(bits);
+    const __m512i zero = _mm512_setzero_si512();
+    const __m512i last = _mm512_set1_epi32(15);
+    __m512i running = _mm512_set1_epi32(static_cast<int>(base));
+    __m512i acc = zero;
+    for (size_t i = 0; i < count; i += 16) {
+        // Log-step prefix sum: lane j adds lane j - k, lanes below k shift in zeros
+        __m512i x = unpack16_avx512(packed, u);
+        x = _mm512_add_epi32(x, _mm512_maskz_alignr_epi32(ALL_LANES, x, zero, 15));
+        x = _mm512_add_epi32(x, _mm512_maskz_alignr_epi32(ALL_LANES, x, zero, 14));
+        x = _mm512_add_epi32(x, _mm512_maskz_alignr_epi32(ALL_LANES, x, zero, 12));
+        x = _mm512_add_epi32(x, _mm512_maskz_alignr_epi32(ALL_LANES, x, zero, 8));
+        x = _mm512_add_epi32(x, running);
+        running = _mm512_maskz_permutexvar_epi32(ALL_LANES, last, x);
+        acc = add_widened_avx512(acc, x);
+        packed += 2 * bits;
+    }
+    alignas(64) uint32_t lanes[16];
+    _mm512_store_si512(lanes, running);
+    base = lanes[0];
+    return sum_lanes_avx512(acc);
+}
+
+__attribute__((target("avx512f"))) uint64_t dict_avx512_range(const uint8_t* packed, size_t count,
+                                                              unsigned bits, const uint64_t* dictionary) {
+    const Avx512Unpacker u = make_unpacker_avx512(bits);
+    const __m512i zero = _mm512_setzero_si512();
+    __m512i a0 = zero, a1 = zero;
+    for (size_t i = 0; i < count; i += 16) {
+        __m512i codes = unpack16_avx512(packed, u);
+        __m256i low = _mm512_maskz_extracti64x4_epi64(0xF, codes, 0);
+        __m256i high = _mm512_maskz_extracti64x4_epi64(0xF, codes, 1);
+        a0 = _mm512_add_epi64(a0, _mm512_mask_i32gather_epi64(zero, 0xFF, low, dictionary, 8));
+        a1 = _mm512_add_epi64(a1, _mm512_mask_i32gather_epi64(zero, 0xFF, high, dictionary, 8));
+        packed += 2 * bits;
+    }
+    return sum_lanes_avx512(_mm512_add_epi64(a0, a1));
+}
+
+uint64_t unpack_avx512(const uint8_t* packed, size_t count, unsigned bits) {
+    return decode_padded(packed, count, bits,
+                         [bits](const uint8_t* p, size_t n) { return unpack_avx512_range(p, n, bits); });
+}
+
+uint64_t delta_avx512(const uint8_t* packed, size_t count, unsigned bits, uint32_t& base) {
+    return decode_padded(packed, count, bits, [bits, &base](const uint8_t* p, size_t n) {
+        return delta_avx512_range(p, n, bits, base);
+    });
+}
+
+uint64_t dict_avx512(const uint8_t* packed, size_t count, unsigned bits, const uint64_t* dictionary) {
+    return decode_padded(packed, count, bits, [bits, dictionary](const uint8_t* p, size_t n) {
+        return dict_avx512_range(p, n, bits, dictionary);
+    });
+}
+#endif  // SIMD_KERNELS_X86
+
+#ifdef SIMD_KERNELS_NEON
+// ---------------------------------------------------------------------------
+// NEON (128-bit)
+// ---------------------------------------------------------------------------
+
+template <bool PREFETCH>
+uint64_t read_neon_impl(const uint8_t* data, size_t bytes, size_t distance) {
+    const uint64_t* p = reinterpret_cast<const uint64_t*>(data);
+    size_t n = bytes / sizeof(uint64_t);
+    uint64x2_t a0 = vdupq_n_u64(0), a1 = vdupq_n_u64(0);
+    uint64x2_t a2 = vdupq_n_u64(0), a3 = vdupq_n_u64(0);
+    size_t i = 0;
+    for (; i + 8 <= n; i += 8) {
+        if constexpr (PREFETCH) {
+            prefetch_lines(data + i * sizeof(uint64_t), distance, 8 * sizeof(uint64_t));
+        }
+        a0 = vaddq_u64(a0, vld1q_u64(p + i));
+        a1 = vaddq_u64(a1, vld1q_u64(p + i + 2));
+        a2 = vaddq_u64(a2, vld1q_u64(p + i + 4));
+        a3 = vaddq_u64(a3, vld1q_u64(p + i + 6));
+    }
+    for (; i + 2 <= n; i += 2) {
+        a0 = vaddq_u64(a0, vld1q_u64(p + i));
+    }
+    uint64_t sum = vaddvq_u64(vaddq_u64(vaddq_u64(a0, a1), vaddq_u64(a2, a3)));
+    return sum + read_scalar(data + i * sizeof(uint64_t), bytes - i * sizeof(uint64_t));
+}
+
+uint64_t read_neon(const uint8_t* data, size_t bytes) {
+    return read_neon_impl<false>(data, bytes, 0);
+}
+
+uint64_t read_prefetch_neon(const uint8_t* data, size_t bytes, size_t distance) {
+    return read_neon_impl<true>(data, bytes, distance);
+}
+
+void write_neon(uint8_t* data, size_t bytes, uint64_t pattern) {
+    uint64_t* p = reinterpret_cast<uint64_t*>(data);
+    size_t n = bytes / sizeof(uint64_t);
+    const uint64x2_t v = vdupq_n_u64(pattern);
+    size_t i = 0;
+    for (; i + 8 <= n; i += 8) {
+        vst1q_u64(p + i, v);
+        vst1q_u64(p + i + 2, v);
+        vst1q_u64(p + i + 4, v);
+        vst1q_u64(p + i + 6, v);
+    }
+    for (; i + 2 <= n; i += 2) {
+        vst1q_u64(p + i, v);
+    }
+    write_scalar(data + i * sizeof(uint64_t), bytes - i * sizeof(uint64_t), pattern);
+}
+
+void copy_neon(uint8_t* dst, const uint8_t* src, size_t bytes) {
+    uint64_t* d = reinterpret_cast<uint64_t*>(dst);
+    const uint64_t* s = reinterpret_cast<const uint64_t*>(src);
+    size_t n = bytes / sizeof(uint64_t);
+    size_t i = 0;
+    for (; i + 8 <= n; i += 8) {
+        uint64x2_t v0 = vld1q_u64(s + i);
+        uint64x2_t v1 = vld1q_u64(s + i + 2);
+        uint64x2_t v2 = vld1q_u64(s + i + 4);
+        uint64x2_t v3 = vld1q_u64(s + i + 6);
+        vst1q_u64(d + i, v0);
+        vst1q_u64(d + i + 2, v1);
+        vst1q_u64(d + i + 4, v2);
+        vst1q_u64(d + i + 6, v3);
+    }
+    for (; i + 2 <= n; i += 2) {
+        vst1q_u64(d + i, vld1q_u64(s + i));
+    }
+    copy_scalar(dst + i * sizeof(uint64_t), src + i * sizeof(uint64_t), bytes - i * sizeof(uint64_t));
+}
+
+void triad_neon(double* a, const double* b, const double* c, double scalar, size_t count) {
+    size_t i = 0;
+    for (; i + 8 <= count; i += 8) {
+        vst1q_f64(a + i, vfmaq_n_f64(vld1q_f64(b + i), vld1q_f64(c + i), scalar));
+        vst1q_f64(a + i + 2, vfmaq_n_f64(vld1q_f64(b + i + 2), vld1q_f64(c + i + 2), scalar));
+        vst1q_f64(a + i + 4, vfmaq_n_f64(vld1q_f64(b + i + 4), vld1q_f64(c + i + 4), scalar));
+        vst1q_f64(a + i + 6, vfmaq_n_f64(vld1q_f64(b + i + 6), vld1q_f64(c + i + 6), scalar));
+    }
+    triad_scalar(a + i, b + i, c + i, scalar, count - i);
+}
+
+void scale_neon(double* a, const double* b, double scalar, size_t count) {
+    size_t i = 0;
+    for (; i + 8 <= count; i += 8) {
+        vst1q_f64(a + i, vmulq_n_f64(vld1q_f64(b + i), scalar));
+        vst1q_f64(a + i + 2, vmulq_n_f64(vld1q_f64(b + i + 2), scalar));
+        vst1q_f64(a + i + 4, vmulq_n_f64(vld1q_f64(b + i + 4), scalar));
+        vst1q_f64(a + i + 6, vmulq_n_f64(vld1q_f64(b + i + 6), scalar));
+    }
+    scale_scalar(a + i, b + i, scalar, count - i);
+}
+
+void add_neon(double* a, const double* b, const double* c, size_t count) {
+    size_t i = 0;
+    for (; i + 8 <= count; i += 8) {
+        vst1q_f64(a + i, vaddq_f64(vld1q_f64(b + i), vld1q_f64(c + i)));
+        vst1q_f64(a + i + 2, vaddq_f64(vld1q_f64(b + i + 2), vld1q_f64(c + i + 2)));
+        vst1q_f64(a + i + 4, vaddq_f64(vld1q_f64(b + i + 4), vld1q_f64(c + i + 4)));
+        vst1q_f64(a + i + 6, vaddq_f64(vld1q_f64(b + i + 6), vld1q_f64(c + i + 6)));
+    }
+    add_scalar(a + i, b + i, c + i, count - i);
+}
+
+double streams_neon(double* const* dst, size_t dst_count, const double* const* src, size_t src_count,
+                    double fill, size_t count) {
+    const float64x2_t f = vdupq_n_f64(fill);
+    float64x2_t c0 = vdupq_n_f64(0.0), c1 = vdupq_n_f64(0.0);
+    float64x2_t c2 = vdupq_n_f64(0.0), c3 = vdupq_n_f64(0.0);
+    size_t i = 0;
+    for (; i + 8 <= count; i += 8) {
+        float64x2_t v0 = f, v1 = f, v2 = f, v3 = f;
+        if (src_count > 0) {
+            v0 = vld1q_f64(src[0] + i);
+            v1 = vld1q_f64(src[0] + i + 2);
+            v2 = vld1q_f64(src[0] + i + 4);
+            v3 = vld1q_f64(src[0] + i + 6);
+        }
+        for (size_t r = 1; r < src_count; ++r) {
+            v0 = vaddq_f64(v0, vld1q_f64(src[r] + i));
+            v1 = vaddq_f64(v1, vld1q_f64(src[r] + i + 2));
+            v2 = vaddq_f64(v2, vld1q_f64(src[r] + i + 4));
+            v3 = vaddq_f64(v3, vld1q_f64(src[r] + i + 6));
+        }
+        for (size_t w = 0; w < dst_count; ++w) {
+            vst1q_f64(dst[w] + i, v0);
+            vst1q_f64(dst[w] + i + 2, v1);
+            vst1q_f64(dst[w] + i + 4, v2);
+            vst1q_f64(dst[w] + i + 6, v3);
+        }
+        if (dst_count == 0) {
+            c0 = vaddq_f64(c0, v0);
+            c1 = vaddq_f64(c1, v1);
+            c2 = vaddq_f64(c2, v2);
+            c3 = vaddq_f64(c3, v3);
+        }
+    }
+    double checksum = vaddvq_f64(vaddq_f64(vaddq_f64(c0, c1), vaddq_f64(c2, c3)));
+    return checksum + streams_range(dst, dst_count, src, src_count, fill, i, count);
+}
+#endif  // SIMD_KERNELS_NEON
+
+#ifdef SIMD_KERNELS_SVE
+// ---------------------------------------------------------------------------
+// SVE (vector length agnostic; predicated tails need no scalar cleanup)
+// ---------------------------------------------------------------------------
+
+template <bool PREFETCH>
+uint64_t read_sve_impl(const uint8_t* data, size_t bytes, size_t distance) {
+    const uint64_t* p = reinterpret_cast<const uint64_t*>(data);
+    size_t n = bytes / sizeof(uint64_t);
+    const size_t vl = svcntd();
+    const svbool_t all = svptrue_b64();
+    svuint64_t a0 = svdup_n_u64(0), a1 = svdup_n_u64(0);
+    svuint64_t a2 = svdup_n_u64(0), a3 = svdup_n_u64(0);
+    size_t i = 0;
+    for (; i + 4 * vl <= n; i += 4 * vl) {
+        if constexpr (PREFETCH) {
+            prefetch_lines(data + i * sizeof(uint64_t), distance, 4 * vl * sizeof(uint64_t));
+        }
+        a0 = svadd_u64_x(all, a0, svld1_u64(all, p + i));
+        a1 = svadd_u64_x(all, a1, svld1_u64(all, p + i + vl));
+        a2 = svadd_u64_x(all, a2, svld1_u64(all, p + i + 2 * vl));
+        a3 = svadd_u64_x(all, a3, svld1_u64(all, p + i + 3 * vl));
+    }
+    for (; i < n; i += vl) {
+        svbool_t pg = svwhilelt_b64_u64(i, n);
+        a0 = svadd_u64_m(pg, a0, svld1_u64(pg, p + i));
+    }
+    svuint64_t total = svadd_u64_x(all, svadd_u64_x(all, a0, a1), svadd_u64_x(all, a2, a3));
+    return svaddv_u64(all, total);
+}
+
+uint64_t read_sve(const uint8_t* data, size_t bytes) {
+    return read_sve_impl<false>(data, bytes, 0);
+}
+
+uint64_t read_prefetch_sve(const uint8_t* data, size_t bytes, size_t distance) {
+    return read_sve_impl<true>(data, bytes, distance);
+}
+
+void write_sve(uint8_t* data, size_t bytes, uint64_t pattern) {
+    uint64_t* p = reinterpret_cast<uint64_t*>(data);
+    size_t n = bytes / sizeof(uint64_t);
+    const size_t vl = svcntd();
+    const svuint64_t v = svdup_n_u64(pattern);
+    for (size_t i = 0; i < n; i += vl) {
+        svst1_u64(svwhilelt_b64_u64(i, n), p + i, v);
+    }
+}
+
+void copy_sve(uint8_t* dst, const uint8_t* src, size_t bytes) {
+    const size_t vl = svcntb();
+    for (size_t i = 0; i < bytes; i += vl) {
+        svbool_t pg = svwhilelt_b8_u64(i, bytes);
+        svst1_u8(pg, dst + i, svld1_u8(pg, src + i));
+    }
+}
+
+void triad_sve(double* a, const double* b, const double* c, double scalar, size_t count) {
+    const size_t vl = svcntd();
+    for (size_t i = 0; i < count; i += vl) {
+        svbool_t pg = svwhilelt_b64_u64(i, count);
+        svfloat64_t result = svmla_n_f64_x(pg, svld1_f64(pg, b + i), svld1_f64(pg, c + i), scalar);
+        svst1_f64(pg, a + i, result);
+    }
+}
+
+void scale_sve(double* a, const double* b, double scalar, size_t count) {
+    const size_t vl = svcntd();
+    for (size_t i = 0; i < count; i += vl) {
+        svbool_t pg = svwhilelt_b64_u64(i, count);
+        svst1_f64(pg, a + i, svmul_n_f64_x(pg, svld1_f64(pg, b + i), scalar));
+    }
+}
+
+void add_sve(double* a, const double* b, const double* c, size_t count) {
+    const size_t vl = svcntd();
+    for (size_t i = 0; i < count; i += vl) {
+        svbool_t pg = svwhilelt_b64_u64(i, count);
+        svst1_f64(pg, a + i, svadd_f64_x(pg, svld1_f64(pg, b + i), svld1_f64(pg, c + i)));
+    }
+}
+
+double streams_sve(double* const* dst, size_t dst_count, const double* const* src, size_t src_count,
+                   double fill, size_t count) {
+    const size_t vl = svcntd();
+    const svbool_t all = svptrue_b64();
+    svfloat64_t checksum = svdup_n_f64(0.0);
+    for (size_t i = 0; i < count; i += vl) {
+        svbool_t pg = svwhilelt_b64_u64(i, count);
+        svfloat64_t v = (src_count > 0) ? svld1_f64(pg, src[0] + i) : svdup_n_f64(fill);
+        for (size_t r = 1; r < src_count; ++r) {
+            v = svadd_f64_x(pg, v, svld1_f64(pg, src[r] + i));
+        }
+        for (size_t w = 0; w < dst_count; ++w) {
+            svst1_f64(pg, dst[w] + i, v);
+        }
+        if (dst_count == 0) {
+            checksum = svadd_f64_m(pg, checksum, v);
+        }
+    }
+    return svaddv_f64(all, checksum);
+}
+
+uint64_t gather_sve(const uint8_t* base, const uint32_t* indices, size_t count, size_t element_bytes) {
+    if (element_bytes == 4) {
+        const uint32_t* p = reinterpret_cast<const uint32_t*>(base);
+        const size_t vl = svcntw();
+        svuint32_t acc = svdup_n_u32(0);
+        for (size_t i = 0; i < count; i += vl) {
+            svbool_t pg = svwhilelt_b32_u64(i, count);
+            svuint32_t idx = svld1_u32(pg, indices + i);
+            acc = svadd_u32_m(pg, acc, svld1_gather_u32index_u32(pg, p, idx));
+        }
+        return static_cast<uint32_t>(svaddv_u32(svptrue_b32(), acc));
+    }
+    if (element_bytes == 8) {
+        const uint64_t* p = reinterpret_cast<const uint64_t*>(base);
+        const size_t vl = svcntd();
+        svuint64_t acc = svdup_n_u64(0);
+        for (size_t i = 0; i < count; i += vl) {
+            svbool_t pg = svwhilelt_b64_u64(i, count);
+            svuint64_t idx = svld1uw_u64(pg, indices + i);
+            acc = svadd_u64_m(pg, acc, svld1_gather_u64index_u64(pg, p, idx));
+        }
+        return svaddv_u64(svptrue_b64(), acc);
+    }
+    return gather_scalar(base, indices, count, element_bytes);
+}
+
+void scatter_sve(uint8_t* base, const uint32_t* indices, size_t count, size_t element_bytes,
+                 uint64_t pattern) {
+    if (element_bytes == 4) {
+        uint32_t* p = reinterpret_cast<uint32_t*>(base);
+        const size_t vl = svcntw();
+        const svuint32_t v = svdup_n_u32(static_cast<uint32_t>(pattern));
+        for (size_t i = 0; i < count; i += vl) {
+            svbool_t pg = svwhilelt_b32_u64(i, count);
+            svst1_scatter_u32index_u32(pg, p, svld1_u32(pg, indices + i), v);
+        }
+        return;
+    }
+    if (element_bytes == 8) {
+        uint64_t* p = reinterpret_cast<uint64_t*>(base);
+        const size_t vl = svcntd();
+        const svuint64_t v = svdup_n_u64(pattern);
+        for (size_t i = 0; i < count; i += vl) {
+            svbool_t pg = svwhilelt_b64_u64(i, count);
+            svst1_scatter_u64index_u64(pg, p, svld1uw_u64(pg, indices + i), v);
+        }
+        return;
+    }
+    scatter_scalar(base, indices, count, element_bytes, pattern);
+}
+#endif  // SIMD_KERNELS_SVE
+
+// ---------------------------------------------------------------------------
+// Store policy kernels
+//
+// Streaming stores need a destination aligned to the vector width, so each
+// kernel stores a short temporal head up to that boundary, streams the body
+// and finishes the tail with temporal stores. Streaming and zeroing stores
+// are weakly ordered; every kernel fences before returning.
+// ---------------------------------------------------------------------------
+
+/**
+ * @brief Bytes needed to advance ptr to the next align boundary, capped at bytes
+ */
+size_t bytes_to_alignment(const void* ptr, size_t align, size_t bytes) {
+    size_t misalignment = reinterpret_cast<uintptr_t>(ptr) & (align - 1);
+    size_t head = misalignment ? align - misalignment : 0;
+    return head < bytes ? head : bytes;
+}
+
+#ifdef SIMD_KERNELS_X86
+void write_scalar_nt(uint8_t* data, size_t bytes, uint64_t pattern) {
+    long long* p = reinterpret_cast<long long*>(data);
+    size_t n = bytes / sizeof(uint64_t);
+    for (size_t i = 0; i < n; ++i) {
+        _mm_stream_si64(p + i, static_cast<long long>(pattern));
+    }
+    _mm_sfence();
+}
+
+void copy_scalar_nt(uint8_t* dst, const uint8_t* src, size_t bytes) {
+    long long* d = reinterpret_cast<long long*>(dst);
+    const long long* s = reinterpret_cast<const long long*>(src);
+    size_t n = bytes / sizeof(uint64_t);
+    for (size_t i = 0; i < n; ++i) {
+        _mm_stream_si64(d + i, s[i]);
+    }
+    _mm_sfence();
+}
+
+void triad_scalar_nt(double* a, const double* b, const double* c, double scalar, size_t count) {
+    long long* out = reinterpret_cast<long long*>(a);
+    for (size_t i = 0; i < count; ++i) {
+        double value = b[i] + scalar * c[i];
+        long long bits;
+        std::memcpy(&bits, &value, sizeof(bits));
+        _mm_stream_si64(out + i, bits);
+    }
+    _mm_sfence();
+}
+
+__attribute__((target("sse2"))) void write_sse2_nt(uint8_t* data, size_t bytes,
+                                                   uint64_t pattern) {
+    size_t head = bytes_to_alignment(data, sizeof(__m128i), bytes);
+    write_scalar(data, head, pattern);
+    __m128i* p = reinterpret_cast<__m128i*>(data + head);
+    size_t n = (bytes - head) / sizeof(__m128i);
+    const __m128i v = _mm_set1_epi64x(static_cast<long long>(pattern));
+    size_t i = 0;
+    for (; i + 4 <= n; i += 4) {
+        _mm_stream_si128(p + i, v);
+        _mm_stream_si128(p + i + 1, v);
+        _mm_stream_si128(p + i + 2, v);
+        _mm_stream_si128(p + i + 3, v);
+    }
+    for (; i < n; ++i) {
+        _mm_stream_si128(p + i, v);
+    }
+    size_t done = head + n * sizeof(__m128i);
+    write_scalar(data + done, bytes - done, pattern);
+    _mm_sfence();
+}
+
+__attribute__((target("sse2"))) void copy_sse2_nt(uint8_t* dst, const uint8_t* src,
+                                                  size_t bytes) {
+    size_t head = bytes_to_alignment(dst, sizeof(__m128i), bytes);
+    copy_scalar(dst, src, head);
+    __m128i* d = reinterpret_cast<__m128i*>(dst + head);
+    const __m128i* s = reinterpret_cast<const __m128i*>(src + head);
+    size_t n = (bytes - head) / sizeof(__m128i);
+    size_t i = 0;
+    for (; i + 4 <= n; i += 4) {
+        __m128i v0 = _mm_loadu_si128(s + i);
+        __m128i v1 = _mm_loadu_si128(s + i + 1);
+        __m128i v2 = _mm_loadu_si128(s + i + 2);
+        __m128i v3 = _mm_loadu_si128(s + i + 3);
+        _mm_stream_si128(d + i, v0);
+        _mm_stream_si128(d + i + 1, v1);
+        _mm_stream_si128(d + i + 2, v2);
+        _mm_stream_si128(d + i + 3, v3);
+    }
+    for (; i < n; ++i) {
+        _mm_stream_si128(d + i, _mm_loadu_si128(s + i));
+    }
+    size_t done = head + n * sizeof(__m128i);
+    copy_scalar(dst + done, src + done, bytes - done);
+    _mm_sfence();
+}
+
+__attribute__((target("sse2"))) void triad_sse2_nt(double* a, const double* b, const double* c,
+                                                   double scalar, size_t count) {
+    size_t head = bytes_to_alignment(a, sizeof(__m128d), count * sizeof(double)) / sizeof(double);
+    triad_scalar(a, b, c, scalar, head);
+    const __m128d s = _mm_set1_pd(scalar);
+    size_t i = head;
+    for (; i + 4 <= count; i += 4) {
+        _mm_stream_pd(a + i, _mm_add_pd(_mm_loadu_pd(b + i), _mm_mul_pd(s, _mm_loadu_pd(c + i))));
+        _mm_stream_pd(a + i + 2,
+                      _mm_add_pd(_mm_loadu_pd(b + i + 2), _mm_mul_pd(s, _mm_loadu_pd(c + i + 2))));
+    }
+    triad_scalar(a + i, b + i, c + i, scalar, count - i);
+    _mm_sfence();
+}
+
+__attribute__((target("avx2"))) void write_avx2_nt(uint8_t* data, size_t bytes,
+                                                   uint64_t pattern) {
+    size_t head = bytes_to_alignment(data, sizeof(__m256i), bytes);
+    write_scalar(data, head, pattern);
+    __m256i* p = reinterpret_cast<__m256i*>(data + head);
+    size_t n = (bytes - head) / sizeof(__m256i);
+    const __m256i v = _mm256_set1_epi64x(static_cast<long long>(pattern));
+    size_t i = 0;
+    for (; i + 4 <= n; i += 4) {
+        _mm256_stream_si256(p + i, v);
+        _mm256_stream_si256(p + i + 1, v);
+        _mm256_stream_si256(p + i + 2, v);
+        _mm256_stream_si256(p + i + 3, v);
+    }
+    for (; i < n; ++i) {
+        _mm256_stream_si256(p + i, v);
+    }
+    size_t done = head + n * sizeof(__m256i);
+    write_scalar(data + done, bytes - done, pattern);
+    _mm_sfence();
+}
+
+__attribute__((target("avx2"))) void copy_avx2_nt(uint8_t* dst, const uint8_t* src,
+                                                  size_t bytes) {
+    size_t head = bytes_to_alignment(dst, sizeof(__m256i), bytes);
+    copy_scalar(dst, src, head);
+    __m256i* d = reinterpret_cast<__m256i*>(dst + head);
+    const __m256i* s = reinterpret_cast<const __m256i*>(src + head);
+    size_t n = (bytes - head) / sizeof(__m256i);
+    size_t i = 0;
+    for (; i + 4 <= n; i += 4) {
+        __m256i v0 = _mm256_loadu_si256(s + i);
+        __m256i v1 = _mm256_loadu_si256(s + i + 1);
+        __m256i v2 = _mm256_loadu_si256(s + i + 2);
+        __m256i v3 = _mm256_loadu_si256(s + i + 3);
+        _mm256_stream_si256(d + i, v0);
+        _mm256_stream_si256(d + i + 1, v1);
+        _mm256_stream_si256(d + i + 2, v2);
+        _mm256_stream_si256(d + i + 3, v3);
+    }
+    for (; i < n; ++i) {
+        _mm256_stream_si256(d + i, _mm256_loadu_si256(s + i));
+    }
+    size_t done = head + n * sizeof(__m256i);
+    copy_scalar(dst + done, src + done, bytes - done);
+    _mm_sfence();
+}
+
+__attribute__((target("avx2,fma"))) void triad_avx2_nt(double* a, const double* b,
+                                                       const double* c, double scalar,
+                                                       size_t count) {
+    size_t head = bytes_to_alignment(a, sizeof(__m256d), count * sizeof(double)) / sizeof(double);
+    triad_scalar(a, b, c, scalar, head);
+    const __m256d s = _mm256_set1_pd(scalar);
+    size_t i = head;
+    for (; i + 8 <= count; i += 8) {
+        _mm256_stream_pd(a + i, _mm256_fmadd_pd(s, _mm256_loadu_pd(c + i), _mm256_loadu_pd(b + i)));
+        _mm256_stream_pd(a + i + 4,
+                         _mm256_fmadd_pd(s, _mm256_loadu_pd(c + i + 4), _mm256_loadu_pd(b + i + 4)));
+    }
+    triad_scalar(a + i, b + i, c + i, scalar, count - i);
+    _mm_sfence();
+}
+
+__attribute__((target("avx512f"))) void write_avx512_nt(uint8_t* data, size_t bytes,
+                                                        uint64_t pattern) {
+    size_t head = bytes_to_alignment(data, sizeof(__m512i), bytes);
+    write_scalar(data, head, pattern);
+    __m512i* p = reinterpret_cast<__m512i*>(data + head);
+    size_t n = (bytes - head) / sizeof(__m512i);
+    const __m512i v = _mm512_set1_epi64(static_cast<long long>(pattern));
+    size_t i = 0;
+    for (; i + 4 <= n; i += 4) {
+        _mm512_stream_si512(p + i, v);
+        _mm512_stream_si512(p + i + 1, v);
+        _mm512_stream_si512(p + i + 2, v);
+        _mm512_stream_si512(p + i + 3, v);
+    }
+    for (; i < n; ++i) {
+        _mm512_stream_si512(p + i, v);
+    }
+    size_t done = head + n * sizeof(__m512i);
+    write_scalar(data + done, bytes - done, pattern);
+    _mm_sfence();
+}
+
+__attribute__((target("avx512f"))) void copy_avx512_nt(uint8_t* dst, const uint8_t* src,
+                                                       size_t bytes) {
+    size_t head = bytes_to_alignment(dst, sizeof(__m512i), bytes);
+    copy_scalar(dst, src, head);
+    __m512i* d = reinterpret_cast<__m512i*>(dst + head);
+    const __m512i* s = reinterpret_cast<const __m512i*>(src + head);
+    size_t n = (bytes - head) / sizeof(__m512i);
+    size_t i = 0;
+    for (; i + 4 <= n; i += 4) {
+        __m512i v0 = _mm512_loadu_si512(s + i);
+        __m512i v1 = _mm512_loadu_si512(s + i + 1);
+        __m512i v2 = _mm512_loadu_si512(s + i + 2);
+        __m512i v3 = _mm512_loadu_si512(s + i + 3);
+        _mm512_stream_si512(d + i, v0);
+        _mm512_stream_si512(d + i + 1, v1);
+        _mm512_stream_si512(d + i + 2, v2);
+        _mm512_stream_si512(d + i + 3, v3);
+    }
+    for (; i < n; ++i) {
+        _mm512_stream_si512(d + i, _mm512_loadu_si512(s + i));
+    }
+    size_t done = head + n * sizeof(__m512i);
+    copy_scalar(dst + done, src + done, bytes - done);
+    _mm_sfence();
+}
+
+__attribute__((target("avx512f"))) void triad_avx512_nt(double* a, const double* b,
+                                                        const double* c, double scalar,
+                                                        size_t count) {
+    size_t head = bytes_to_alignment(a, sizeof(__m512d), count * sizeof(double)) / sizeof(double);
+    triad_scalar(a, b, c, scalar, head);
+    const __m512d s = _mm512_set1_pd(scalar);
+    size_t i = head;
+    for (; i + 16 <= count; i += 16) {
+        _mm512_stream_pd(a + i, _mm512_fmadd_pd(s, _mm512_loadu_pd(c + i), _mm512_loadu_pd(b + i)));
+        _mm512_stream_pd(a + i + 8,
+                         _mm512_fmadd_pd(s, _mm512_loadu_pd(c + i + 8), _mm512_loadu_pd(b + i + 8)));
+    }
+    triad_scalar(a + i, b + i, c + i, scalar, count - i);
+    _mm_sfence();
+}
+
+// CLZERO: claim each destination line without reading it, then fill it
+constexpr size_t CLZERO_LINE = 64;
+
+__attribute__((target("clzero"))) void write_clzero(uint8_t* data, size_t bytes,
+                                                    uint64_t pattern) {
+    size_t head = bytes_to_alignment(data, CLZERO_LINE, bytes);
+    write_scalar(data, head, pattern);
+    size_t i = head;
+    for (; i + CLZERO_LINE <= bytes; i += CLZERO_LINE) {
+        _mm_clzero(data + i);
+        uint64_t* line = reinterpret_cast<uint64_t*>(data + i);
+        for (size_t j = 0; j < CLZERO_LINE / sizeof(uint64_t); ++j) {
+            line[j] = pattern;
+        }
+    }
+    write_scalar(data + i, bytes - i, pattern);
+    _mm_sfence();
+}
+
+__attribute__((target("clzero"))) void copy_clzero(uint8_t* dst, const uint8_t* src,
+                                                   size_t bytes) {
+    size_t head = bytes_to_alignment(dst, CLZERO_LINE, bytes);
+    copy_scalar(dst, src, head);
+    size_t i = head;
+    for (; i + CLZERO_LINE <= bytes; i += CLZERO_LINE) {
+        _mm_clzero(dst + i);
+        std::memcpy(dst + i, src + i, CLZERO_LINE);
+    }
+    copy_scalar(dst + i, src + i, bytes - i);
+    _mm_sfence();
+}
+
+__attribute__((target("clzero"))) void triad_clzero(double* a, const double* b, const double* c,
+                                                    double scalar, size_t count) {
+    constexpr size_t per_line = CLZERO_LINE / sizeof(double);
+    size_t head = bytes_to_alignment(a, CLZERO_LINE, count * sizeof(double)) / sizeof(double);
+    triad_scalar(a, b, c, scalar, head);
+    size_t i = head;
+    for (; i + per_line <= count; i += per_line) {
+        _mm_clzero(a + i);
+        for (size_t j = i; j < i + per_line; ++j) {
+            a[j] = b[j] + scalar * c[j];
+        }
+    }
+    triad_scalar(a + i, b + i, c + i, scalar, count - i);
+    _mm_sfence();
+}
+#endif  // SIMD_KERNELS_X86
+
+#ifdef SIMD_KERNELS_NEON
+// STNP has no ACLE intrinsic; store register pairs with a non-temporal hint
+inline void store_pair_nt(void* dst, uint64x2_t lo, uint64x2_t hi) {
+    asm volatile("stnp %q[lo], %q[hi], [%[dst]]"
+                 :
+                 : [lo] "w"(lo), [hi] "w"(hi), [dst] "r"(dst)
+                 : "memory");
+}
+
+void write_neon_nt(uint8_t* data, size_t bytes, uint64_t pattern) {
+    const uint64x2_t v = vdupq_n_u64(pattern);
+    size_t i = 0;
+    for (; i + 64 <= bytes; i += 64) {
+        store_pair_nt(data + i, v, v);
+        store_pair_nt(data + i + 32, v, v);
+    }
+    write_scalar(data + i, bytes - i, pattern);
+    asm volatile("dmb ishst" ::: "memory");
+}
+
+void copy_neon_nt(uint8_t* dst, const uint8_t* src, size_t bytes) {
+    const uint64_t* s = reinterpret_cast<const uint64_t*>(src);
+    size_t i = 0;
+    for (; i + 64 <= bytes; i += 64) {
+        const uint64_t* line = s + i / sizeof(uint64_t);
+        uint64x2_t v0 = vld1q_u64(line);
+        uint64x2_t v1 = vld1q_u64(line + 2);
+        uint64x2_t v2 = vld1q_u64(line + 4);
+        uint64x2_t v3 = vld1q_u64(line + 6);
+        store_pair_nt(dst + i, v0, v1);
+        store_pair_nt(dst + i + 32, v2, v3);
+    }
+    copy_scalar(dst + i, src + i, bytes - i);
+    asm volatile("dmb ishst" ::: "memory");
+}
+
+void triad_neon_nt(double* a, const double* b, const double* c, double scalar, size_t count) {
+    size_t i = 0;
+    for (; i + 4 <= count; i += 4) {
+        float64x2_t r0 = vfmaq_n_f64(vld1q_f64(b + i), vld1q_f64(c + i), scalar);
+        float64x2_t r1 = vfmaq_n_f64(vld1q_f64(b + i + 2), vld1q_f64(c + i + 2), scalar);
+        store_pair_nt(a + i, vreinterpretq_u64_f64(r0), vreinterpretq_u64_f64(r1));
+    }
+    triad_scalar(a + i, b + i, c + i, scalar, count - i);
+    asm volatile("dmb ishst" ::: "memory");
+}
+
+// DC ZVA: zero each destination block without reading it, then fill it
+inline void dc_zva(void* block) {
+    asm volatile("dc zva, %0" : : "r"(block) : "memory");
+}
+
+void write_dczva(uint8_t* data, size_t bytes, uint64_t pattern) {
+    const size_t block = CpuFeatureDetection::get_cpu_features().dc_zva_block_size;
+    size_t head = bytes_to_alignment(data, block, bytes);
+    write_scalar(data, head, pattern);
+    size_t i = head;
+    for (; i + block <= bytes; i += block) {
+        dc_zva(data + i);
+        write_neon(data + i, block, pattern);
+    }
+    write_scalar(data + i, bytes - i, pattern);
+    asm volatile("dmb ishst" ::: "memory");
+}
+
+void copy_dczva(uint8_t* dst, const uint8_t* src, size_t bytes) {
+    const size_t block = CpuFeatureDetection::get_cpu_features().dc_zva_block_size;
+    size_t head = bytes_to_alignment(dst, block, bytes);
+    copy_scalar(dst, src, head);
+    size_t i = head;
+    for (; i + block <= bytes; i += block) {
+        dc_zva(dst + i);
+        copy_neon(dst + i, src + i, block);
+    }
+    copy_scalar(dst + i, src + i, bytes - i);
+    asm volatile("dmb ishst" ::: "memory");
+}
+
+void triad_dczva(double* a, const double* b, const double* c, double scalar, size_t count) {
+    const size_t block = CpuFeatureDetection::get_cpu_features().dc_zva_block_size;
+    const size_t per_block = block / sizeof(double);
+    size_t head = bytes_to_alignment(a, block, count * sizeof(double)) / sizeof(double);
+    triad_scalar(a, b, c, scalar, head);
+    size_t i = head;
+    for (; i + per_block <= count; i += per_block) {
+        dc_zva(a + i);
+        triad_neon(a + i, b + i, c + i, scalar, per_block);
+    }
+    triad_scalar(a + i, b + i, c + i, scalar, count - i);
+    asm volatile("dmb ishst" ::: "memory");
+}
+#endif  // SIMD_KERNELS_NEON
+
+#ifdef SIMD_KERNELS_SVE
+void write_sve_nt(uint8_t* data, size_t bytes, uint64_t pattern) {
+    uint64_t* p = reinterpret_cast<uint64_t*>(data);
+    size_t n = bytes / sizeof(uint64_t);
+    const size_t vl = svcntd();
+    const svuint64_t v = svdup_n_u64(pattern);
+    for (size_t i = 0; i < n; i += vl) {
+        svstnt1_u64(svwhilelt_b64_u64(i, n), p + i, v);
+    }
+    asm volatile("dmb ishst" ::: "memory");
+}
+
+void copy_sve_nt(uint8_t* dst, const uint8_t* src, size_t bytes) {
+    const size_t vl = svcntb();
+    for (size_t i = 0; i < bytes; i += vl) {
+        svbool_t pg = svwhilelt_b8_u64(i, bytes);
+        svstnt1_u8(pg, dst + i, svld1_u8(pg, src + i));
+    }
+    asm volatile("dmb ishst" ::: "memory");
+}
+
+void triad_sve_nt(double* a, const double* b, const double* c, double scalar, size_t count) {
+    const size_t vl = svcntd();
+    for (size_t i = 0; i < count; i += vl) {
+        svbool_t pg = svwhilelt_b64_u64(i, count);
+        svfloat64_t result = svmla_n_f64_x(pg, svld1_f64(pg, b + i), svld1_f64(pg, c + i), scalar);
+        svstnt1_f64(pg, a + i, result);
+    }
+    asm volatile("dmb ishst" ::: "memory");
+}
+#endif  // SIMD_KERNELS_SVE
+
+const KernelSet SCALAR_KERNELS = {KernelType::SCALAR, "scalar", read_scalar, read_prefetch_scalar,
+                                  write_scalar, copy_scalar, triad_scalar, scale_scalar, add_scalar,
+                                  streams_scalar, gather_scalar, scatter_scalar, unpack_scalar, delta_scalar,
+                                  dict_scalar};
+#ifdef SIMD_KERNELS_X86
+const KernelSet SSE2_KERNELS = {KernelType::SSE2, "sse2", read_sse2, read_prefetch_sse2, write_sse2,
+                                copy_sse2, triad_sse2, scale_sse2, add_sse2, streams_sse2, gather_scalar,
+                                scatter_scalar, unpack_scalar, delta_scalar, dict_scalar};
+const KernelSet AVX2_KERNELS = {KernelType::AVX2, "avx2", read_avx2, read_prefetch_avx2, write_avx2,
+                                copy_avx2, triad_avx2, scale_avx2, add_avx2, streams_avx2, gather_avx2,
+                                scatter_scalar, unpack_avx2, delta_avx2, dict_avx2};
+const KernelSet AVX512_KERNELS = {KernelType::AVX512, "avx512", read_avx512, read_prefetch_avx512,
+                                  write_avx512, copy_avx512, triad_avx512, scale_avx512, add_avx512,
+                                  streams_avx512, gather_avx512, scatter_avx512, unpack_avx512, delta_avx512,
+                                  dict_avx512};
+#endif
+#ifdef SIMD_KERNELS_NEON
+const KernelSet NEON_KERNELS = {KernelType::NEON, "neon", read_neon, read_prefetch_neon, write_neon,
+                                copy_neon, triad_neon, scale_neon, add_neon, streams_neon, gather_scalar,
+                                scatter_scalar, unpack_scalar, delta_scalar, dict_scalar};
+#endif
+#ifdef SIMD_KERNELS_SVE
+const KernelSet SVE_KERNELS = {KernelType::SVE, "sve", read_sve, read_prefetch_sve, write_sve, copy_sve,
+                               triad_sve, scale_sve, add_sve, streams_sve, gather_sve, scatter_sve,
+                               unpack_scalar, delta_scalar, dict_scalar};
+#endif
+
+/**
+ * @brief Look up the compiled-in kernel table for a concrete type
+ * @return Pointer to the table, or nullptr if not compiled for this target
+ */
+const KernelSet* find_kernel_set(KernelType type) {
+    switch (type) {
+        case KernelType::SCALAR:
+            return &SCALAR_KERNELS;
+#ifdef SIMD_KERNELS_X86
+        case KernelType::SSE2:
+            return &SSE2_KERNELS;
+        case KernelType::AVX2:
+            return &AVX2_KERNELS;
+        case KernelType::AVX512:
+            return &AVX512_KERNELS;
+#endif
+#ifdef SIMD_KERNELS_NEON
+        case KernelType::NEON:
+            return &NEON_KERNELS;
+#endif
+#ifdef SIMD_KERNELS_SVE
+        case KernelType::SVE:
+            return &SVE_KERNELS;
+#endif
+        default:
+            return nullptr;
+    }
+}
+
+#ifdef SIMD_KERNELS_X86
+const StoreKernels SCALAR_NT_KERNELS = {StorePolicy::NONTEMPORAL, write_scalar_nt, copy_scalar_nt,
+                                        triad_scalar_nt};
+const StoreKernels SSE2_NT_KERNELS = {StorePolicy::NONTEMPORAL, write_sse2_nt, copy_sse2_nt,
+                                      triad_sse2_nt};
+const StoreKernels AVX2_NT_KERNELS = {StorePolicy::NONTEMPORAL, write_avx2_nt, copy_avx2_nt,
+                                      triad_avx2_nt};
+const StoreKernels AVX512_NT_KERNELS = {StorePolicy::NONTEMPORAL, write_avx512_nt, copy_avx512_nt,
+                                        triad_avx512_nt};
+const StoreKernels CLZERO_KERNELS = {StorePolicy::CLZERO, write_clzero, copy_clzero,
+                                     triad_clzero};
+#endif
+#ifdef SIMD_KERNELS_NEON
+const StoreKernels NEON_NT_KERNELS = {StorePolicy::NONTEMPORAL, write_neon_nt, copy_neon_nt,
+                                      triad_neon_nt};
+const StoreKernels DCZVA_KERNELS = {StorePolicy::DC_ZVA, write_dczva, copy_dczva, triad_dczva};
+#endif
+#ifdef SIMD_KERNELS_SVE
+const StoreKernels SVE_NT_KERNELS = {StorePolicy::NONTEMPORAL, write_sve_nt, copy_sve_nt,
+                                     triad_sve_nt};
+#endif
+
+/**
+ * @brief Look up the compiled-in store kernels for a concrete kernel and policy
+ * @return Store kernels, or nullptr if the combination is not compiled in
+ *
+ * TEMPORAL is not handled here; it uses the regular KernelSet entries.
+ */
+const StoreKernels* find_store_kernels(KernelType type, StorePolicy policy) {
+    switch (policy) {
+        case StorePolicy::NONTEMPORAL:
+            switch (type) {
+#ifdef SIMD_KERNELS_X86
+                case KernelType::SCALAR:
+                    return &SCALAR_NT_KERNELS;
+                case KernelType::SSE2:
+                    return &SSE2_NT_KERNELS;
+                case KernelType::AVX2:
+                    return &AVX2_NT_KERNELS;
+                case KernelType::AVX512:
+                    return &AVX512_NT_KERNELS;
+#endif
+#ifdef SIMD_KERNELS_NEON
+                case KernelType::NEON:
+                    return &NEON_NT_KERNELS;
+#endif
+#ifdef SIMD_KERNELS_SVE
+                case KernelType::SVE:
+                    return &SVE_NT_KERNELS;
+#endif
+                default:
+                    return nullptr;
+            }
+#ifdef SIMD_KERNELS_X86
+        case StorePolicy::CLZERO:
+            return &CLZERO_KERNELS;
+#endif
+#ifdef SIMD_KERNELS_NEON
+        case StorePolicy::DC_ZVA:
+            return &DCZVA_KERNELS;
+#endif
+        default:
+            return nullptr;
+    }
+}
+
+}  // namespace
+
+bool is_kernel_supported(KernelType type) {
+    if (type == KernelType::AUTO) {
+        return true;
+    }
+    if (find_kernel_set(type) == nullptr) {
+        return false;
+    }
+
+    const CpuFeatures& features = CpuFeatureDetection::get_cpu_features();
+    switch (type) {
+        case KernelType::SCALAR:
+            return true;
+        case KernelType::SSE2:
+            return features.sse2;
+        case KernelType::AVX2:
+            return features.avx2 && features.fma;
+        case KernelType::AVX512:
+            return features.avx512f;
+        case KernelType::NEON:
+            return features.neon;
+        case KernelType::SVE:
+            return features.sve;
+        default:
+            return false;
+    }
+}
+
+KernelType resolve_kernel(KernelType requested) {
+    if (requested == KernelType::AUTO) {
+        // Widest vectors first; SVE is preferred over NEON when present
+        static const KernelType preference[] = {KernelType::AVX512, KernelType::AVX2,
+                                                KernelType::SSE2,   KernelType::SVE,
+                                                KernelType::NEON,   KernelType::SCALAR};
+        for (KernelType candidate : preference) {
+            if (is_kernel_supported(candidate)) {
+                return candidate;
+            }
+        }
+        return KernelType::SCALAR;
+    }
+
+    if (!is_kernel_supported(requested)) {
+        throw ConfigurationError("Kernel '" + kernel_type_to_string(requested) +
+                                 "' is not supported on this CPU (available: " +
+                                 CpuFeatureDetection::describe_cpu_features() + ")");
+    }
+    return requested;
+}
+
+const KernelSet& get_kernel_set(KernelType requested) {
+    return *find_kernel_set(resolve_kernel(requested));
+}
+
+bool has_hardware_gather(KernelType requested) {
+    KernelType type = resolve_kernel(requested);
+    return type == KernelType::AVX2 || type == KernelType::AVX512 || type == KernelType::SVE;
+}
+
+bool has_hardware_scatter(KernelType requested) {
+    KernelType type = resolve_kernel(requested);
+    return type == KernelType::AVX512 || type == KernelType::SVE;
+}
+
+bool has_simd_decode(KernelType requested) {
+    KernelType type = resolve_kernel(requested);
+    return type == KernelType::AVX2 || type == KernelType::AVX512;
+}
+
+std::vector<KernelType> get_supported_kernels() {
+    std::vector<KernelType> kernels;
+    for (KernelType type : {KernelType::SCALAR, KernelType::SSE2, KernelType::AVX2,
+                            KernelType::AVX512, KernelType::NEON, KernelType::SVE}) {
+        if (is_kernel_supported(type)) {
+            kernels.push_back(type);
+        }
+    }
+    return kernels;
+}
+
+std::string kernel_type_to_string(KernelType type) {
+    switch (type) {
+        case KernelType::AUTO:
+            return "auto";
+        case KernelType::SCALAR:
+            return "scalar";
+        case KernelType::SSE2:
+            return "sse2";
+        case KernelType::AVX2:
+            return "avx2";
+        case KernelType::AVX512:
+            return "avx512";
+        case KernelType::NEON:
+            return "neon";
+        case KernelType::SVE:
+            return "sve";
+        default:
+            return "unknown";
+    }
+}
+
+KernelType string_to_kernel_type(const std::string& name) {
+    for (KernelType type : {KernelType::AUTO, KernelType::SCALAR, KernelType::SSE2,
+                            KernelType::AVX2, KernelType::AVX512, KernelType::NEON,
+                            KernelType::SVE}) {
+        if (kernel_type_to_string(type) == name) {
+            return type;
+        }
+    }
+    throw ArgumentError("Unknown kernel '" + name + "'");
+}
+
+std::vector<std::string> get_kernel_names() {
+    return {"auto", "scalar", "sse2", "avx2", "avx512", "neon", "sve"};
+}
+
+bool is_store_policy_supported(KernelType kernel, StorePolicy policy) {
+    if (!is_kernel_supported(kernel)) {
+        return false;
+    }
+    KernelType resolved = resolve_kernel(kernel);
+    if (policy == StorePolicy::TEMPORAL) {
+        return true;
+    }
+    if (find_store_kernels(resolved, policy) == nullptr) {
+        return false;
+    }
+
+    const CpuFeatures& features = CpuFeatureDetection::get_cpu_features();
+    switch (policy) {
+        case StorePolicy::NONTEMPORAL:
+            return true;
+        case StorePolicy::CLZERO:
+            return features.clzero;
+        case StorePolicy::DC_ZVA:
+            // Zeroing kernels store through the NEON kernels inside each block
+            return features.dc_zva && features.neon && features.dc_zva_block_size >= 16;
+        default:
+            return false;
+    }
+}
+
+StoreKernels get_store_kernels(KernelType kernel, StorePolicy policy) {
+    if (!is_store_policy_supported(kernel, policy)) {
+        throw ConfigurationError("Store policy '" + store_policy_to_string(policy) +
+                                 "' is not supported with kernel '" +
+                                 kernel_type_to_string(resolve_kernel(kernel)) +
+                                 "' on this CPU (available: " +
+                                 CpuFeatureDetection::describe_cpu_features() + ")");
+    }
+
+    if (policy == StorePolicy::TEMPORAL) {
+        const KernelSet& kernels = get_kernel_set(kernel);
+        return {StorePolicy::TEMPORAL, kernels.write, kernels.copy, kernels.triad};
+    }
+    return *find_store_kernels(resolve_kernel(kernel), policy);
+}
+
+std::string store_policy_to_string(StorePolicy policy) {
+    switch (policy) {
+        case StorePolicy::TEMPORAL:
+            return "temporal";
+        case StorePolicy::NONTEMPORAL:
+            return "nontemporal";
+        case StorePolicy::CLZERO:
+            return "clzero";
+        case StorePolicy::DC_ZVA:
+            return "dczva";
+        default:
+            return "unknown";
+    }
+}
+
+StorePolicy string_to_store_policy(const std::string& name) {
+    for (StorePolicy policy : {StorePolicy::TEMPORAL, StorePolicy::NONTEMPORAL,
+                               StorePolicy::CLZERO, StorePolicy::DC_ZVA}) {
+        if (store_policy_to_string(policy) == name) {
+            return policy;
+        }
+    }
+    throw ArgumentError("Unknown store policy '" + name + "'");
+}
+
+std::vector<StorePolicy> parse_store_policies(const std::string& list, KernelType kernel) {
+    std::vector<StorePolicy> policies;
+
+    if (list == "all") {
+        for (StorePolicy policy : {StorePolicy::TEMPORAL, StorePolicy::NONTEMPORAL,
+                                   StorePolicy::CLZERO, StorePolicy::DC_ZVA}) {
+            if (is_store_policy_supported(kernel, policy)) {
+                policies.push_back(policy);
+            }
+        }
+        return policies;
+    }
+
+    size_t start = 0;
+    while (start <= list.size()) {
+        size_t comma = list.find(',', start);
+        std::string item = list.substr(start, comma == std::string::npos ? std::string::npos
+                                                                         : comma - start);
+        if (!item.empty()) {
+            StorePolicy policy = string_to_store_policy(item);
+            if (std::find(policies.begin(), policies.end(), policy) == policies.end()) {
+                policies.push_back(policy);
+            }
+        }
+        if (comma == std::string::npos) {
+            break;
+        }
+        start = comma + 1;
+    }
+
+    if (policies.empty()) {
+        throw ArgumentError("No store policies given");
+    }
+    return policies;
+}
+
+std::vector<std::string> get_store_policy_names() {
+    return {"temporal", "nontemporal", "clzero", "dczva", "all"};
+}
+
+}  // namespace SimdKernels
@@ -0,0 +1,249 @@
+#ifndef SIMD_KERNELS_H
+#define SIMD_KERNELS_H
+
+#include <cstddef>
+#include <cstdint>
+#include <string>
+#include <vector>
+
+/**
+ * @brief Instruction set used by the bandwidth kernels
+ *
+ * AUTO selects the widest kernel the running CPU supports. SCALAR is a
+ * plain 64-bit loop with compiler auto-vectorization disabled, so it can be
+ * used as a true core-bound baseline.
+ */
+enum class KernelType {
+    AUTO,    ///< Best kernel available at runtime
+    SCALAR,  ///< Portable 64-bit scalar loop
+    SSE2,    ///< x86 128-bit vectors
+    AVX2,    ///< x86 256-bit vectors (with FMA for triad)
+    AVX512,  ///< x86 512-bit vectors
+    NEON,    ///< ARM Advanced SIMD 128-bit vectors
+    SVE      ///< ARM scalable vectors
+};
+
+/**
+ * @brief How the write, copy and triad kernels store to the destination
+ *
+ * Regular (temporal) stores are write-allocate: every destination line is
+ * first read into the cache (an RFO), so reported write bandwidth includes
+ * that hidden read traffic. The other policies avoid the RFO and measure
+ * what the memory system can actually absorb.
+ */
+enum class StorePolicy {
+    TEMPORAL,     ///< Regular write-allocate stores
+    NONTEMPORAL,  ///< Streaming stores that bypass the cache (movnt / stnp / stnt1)
+    CLZERO,       ///< AMD: allocate each line with CLZERO, then store into it
+    DC_ZVA        ///< ARM: allocate each block with DC ZVA, then store into it
+};
+
+/**
+ * @brief Hand-vectorized memory kernels selected at runtime
+ *
+ * Each KernelSet bundles the inner loops for one instruction set. The
+ * StandardTests patterns own alignment, iteration and timing; the kernels
+ * only stream over an already-validated range.
+ */
+namespace SimdKernels {
+
+/// Sum a range of 64-bit words and return the checksum
+using ReadKernel = uint64_t (*)(const uint8_t* data, size_t bytes);
+/**
+ * Read with software prefetch: same checksum as ReadKernel, and every cache
+ * line distance bytes ahead of the current one is prefetched (prefetcht0 /
+ * prfm pldl1keep) before it is loaded. Prefetches never fault, so lines
+ * past the end of the range are prefetched harmlessly.
+ */
+using ReadPrefetchKernel = uint64_t (*)(const uint8_t* data, size_t bytes, size_t distance);
+/// Fill a range with a 64-bit pattern
+using WriteKernel = void (*)(uint8_t* data, size_t bytes, uint64_t pattern);
+/// Copy a range from src to dst (ranges must not overlap)
+using CopyKernel = void (*)(uint8_t* dst, const uint8_t* src, size_t bytes);
+/// STREAM triad: a[i] = b[i] + scalar * c[i]
+using TriadKernel = void (*)(double* a, const double* b, const double* c, double scalar,
+                             size_t count);
+/// STREAM scale: a[i] = scalar * b[i]
+using ScaleKernel = void (*)(double* a, const double* b, double scalar, size_t count);
+/// STREAM add: a[i] = b[i] + c[i]
+using AddKernel = void (*)(double* a, const double* b, const double* c, size_t count);
+/**
+ * Multi-stream: v = src[0][i] + ... + src[src_count-1][i] (fill when src_count is 0),
+ * stored to dst[0][i] ... dst[dst_count-1][i]. Arrays must not overlap.
+ * Returns the sum of every v when dst_count is 0, so read-only streams stay live.
+ */
+using StreamsKernel = double (*)(double* const* dst, size_t dst_count, const double* const* src,
+                                 size_t src_count, double fill, size_t count);
+/**
+ * Gather: sum base[indices[i]] over elements of element_bytes (4, 8 or 64).
+ * 4-byte elements are summed modulo 2^32. Indices must be below 2^31.
+ */
+using GatherKernel = uint64_t (*)(const uint8_t* base, const uint32_t* indices, size_t count,
+                                  size_t element_bytes);
+/// Scatter: fill each element base[indices[i]] with the pattern (low 32 bits for 4-byte elements)
+using ScatterKernel = void (*)(uint8_t* base, const uint32_t* indices, size_t count,
+                               size_t element_bytes, uint64_t pattern);
+/**
+ * Bit-unpack: sum count values of bits (1-32) packed LSB first, without gaps,
+ * from packed (count * bits / 8 bytes; count a multiple of 64). No byte past
+ * the packed values is read.
+ */
+using UnpackKernel = uint64_t (*)(const uint8_t* packed, size_t count, unsigned bits);
+/**
+ * Delta decode: the packed values are differences; value i is base plus
+ * deltas 0..i modulo 2^32. Returns the sum of the values; base becomes the
+ * last value, so consecutive calls continue one column.
+ */
+using DeltaKernel = uint64_t (*)(const uint8_t* packed, size_t count, unsigned bits, uint32_t& base);
+/// Dictionary decode: sum dictionary[code] over packed codes of bits (1-16) bits
+using DictKernel = uint64_t (*)(const uint8_t* packed, size_t count, unsigned bits, const uint64_t* dictionary);
+
+/**
+ * @brief Function table for one instruction set
+ */
+struct KernelSet {
+    KernelType type;    ///< Instruction set implemented by this table
+    const char* name;   ///< Short name used on the command line and in results
+    ReadKernel read;    ///< Sequential read kernel
+    ReadPrefetchKernel read_prefetch;  ///< Sequential read kernel with software prefetch
+    WriteKernel write;  ///< Sequential write kernel
+    CopyKernel copy;    ///< Copy kernel
+    TriadKernel triad;  ///< Triad kernel
+    ScaleKernel scale;  ///< Scale kernel (temporal stores only)
+    AddKernel add;      ///< Add kernel (temporal stores only)
+    StreamsKernel streams;  ///< R-read, W-write stream kernel (temporal stores only)
+    GatherKernel gather;    ///< Index-driven loads
+    ScatterKernel scatter;  ///< Index-driven stores
+    UnpackKernel unpack;    ///< Bit-unpacking scan
+    DeltaKernel delta;      ///< Bit-unpacking and prefix-sum scan
+    DictKernel dict;        ///< Bit-unpacking and dictionary-lookup scan
+};
+
+/**
+ * @brief Store-side kernels for one instruction set and store policy
+ */
+struct StoreKernels {
+    StorePolicy policy;  ///< Store policy implemented by these kernels
+    WriteKernel write;   ///< Sequential write kernel
+    CopyKernel copy;     ///< Copy kernel
+    TriadKernel triad;   ///< Triad kernel
+};
+
+/**
+ * @brief Check whether a kernel can run on this CPU
+ * @param type Kernel type to check (AUTO is always supported)
+ * @return true if the kernel is compiled in and the CPU supports it
+ */
+bool is_kernel_supported(KernelType type);
+
+/**
+ * @brief Resolve AUTO to a concrete kernel and validate explicit requests
+ * @param requested Requested kernel type
+ * @return Concrete kernel type that will run
+ * @throws ConfigurationError if an explicit kernel is not supported
+ */
+KernelType resolve_kernel(KernelType requested);
+
+/**
+ * @brief Get the function table for a kernel
+ * @param requested Requested kernel type (AUTO is resolved)
+ * @return Kernel table for the resolved type
+ * @throws ConfigurationError if an explicit kernel is not supported
+ */
+const KernelSet& get_kernel_set(KernelType requested);
+
+/**
+ * @brief Whether a kernel's gather or scatter uses hardware gather/scatter instructions
+ *
+ * Kernels without them fall back to scalar loads and stores for 4- and
+ * 8-byte elements; 64-byte elements are whole lines and use plain vector
+ * loads and stores where the kernel has them.
+ *
+ * @param requested Requested kernel type (AUTO is resolved)
+ */
+bool has_hardware_gather(KernelType requested);
+bool has_hardware_scatter(KernelType requested);
+
+/**
+ * @brief Whether a kernel's unpack, delta and dict decoders are vectorized
+ *
+ * Kernels without them run the scalar decoders.
+ *
+ * @param requested Requested kernel type (AUTO is resolved)
+ */
+bool has_simd_decode(KernelType requested);
+
+/**
+ * @brief List concrete kernels supported on this CPU, narrowest first
+ */
+std::vector<KernelType> get_supported_kernels();
+
+/**
+ * @brief Convert kernel type to its command-line name
+ */
+std::string kernel_type_to_string(KernelType type);
+
+/**
+ * @brief Parse a command-line kernel name
+ * @throws ArgumentError if the name is unknown
+ */
+KernelType string_to_kernel_type(const std::string& name);
+
+/**
+ * @brief All kernel names accepted on the command line
+ */
+std::vector<std::string> get_kernel_names();
+
+/**
+ * @brief Check whether a store policy is available for a kernel on this CPU
+ * @param kernel Kernel type (AUTO is resolved first)
+ * @param policy Store policy to check
+ * @return true if the policy is compiled in and supported by the CPU
+ */
+bool is_store_policy_supported(KernelType kernel, StorePolicy policy);
+
+/**
+ * @brief Get the write/copy/triad kernels for a kernel and store policy
+ *
+ * CLZERO and DC_ZVA are implemented once per architecture rather than per
+ * vector width, since the zeroing instruction dominates; they are selected
+ * regardless of the requested kernel.
+ *
+ * @param kernel Kernel type (AUTO is resolved first)
+ * @param policy Store policy
+ * @return Store kernels for the combination
+ * @throws ConfigurationError if the combination is not supported
+ */
+StoreKernels get_store_kernels(KernelType kernel, StorePolicy policy);
+
+/**
+ * @brief Convert store policy to its command-line name
+ */
+std::string store_policy_to_string(StorePolicy policy);
+
+/**
+ * @brief Parse a command-line store policy name
+ * @throws ArgumentError if the name is unknown
+ */
+StorePolicy string_to_store_policy(const std::string& name);
+
+/**
+ * @brief Parse a comma-separated store policy list
+ *
+ * "all" expands to every policy supported with the given kernel.
+ *
+ * @param list Comma-separated policy names, or "all"
+ * @param kernel Kernel the policies will run with
+ * @return Policies in the order given, without duplicates
+ * @throws ArgumentError if a name is unknown or the list is empty
+ */
+std::vector<StorePolicy> parse_store_policies(const std::string& list, KernelType kernel);
+
+/**
+ * @brief All store policy names accepted on the command line
+ */
+std::vector<std::string> get_store_policy_names();
+
+}  // namespace SimdKernels
+
+#endif  // SIMD_KERNELS_H
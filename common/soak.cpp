@@ -0,0 +1,346 @@
+#include "soak.h"
+#include "constants.h"
+#include "errors.h"
+#include "safe_file_utils.h"
+
+#include <algorithm>
+#include <cctype>
+#include <chrono>
+#include <cmath>
+#include <fstream>
+#include <sstream>
+#include <thread>
+
+#ifdef __linux__
+#include <dirent.h>
+#endif
+
+namespace Soak {
+
+namespace {
+
+using Clock = std::chrono::steady_clock;
+
+const std::string CPU_SYSFS_ROOT = "/sys/devices/system/cpu/";
+const char* const CPU_SENSORS[] = {"coretemp", "k10temp", "zenpower", "cpu_thermal"};
+const char* const DIMM_SENSORS[] = {"jc42", "spd5118"};
+
+// hwmon and thermal zones resolve to device paths all over /sys/devices, outside the SafeFileUtils roots
+bool read_sensor_line(const std::string& path, std::string& line) {
+    std::ifstream file(path);
+    if (!file.is_open() || !std::getline(file, line)) {
+        return false;
+    }
+    while (!line.empty() && (line.back() == '\n' || line.back() == ' ')) {
+        line.pop_back();
+    }
+    return true;
+}
+
+// Hottest millidegree reading among the given files, in degrees (0 if none)
+double hottest(const std::vector<std::string>& paths) {
+    double hottest_c = 0.0;
+    for (const auto& path : paths) {
+        std::string text;
+        if (!read_sensor_line(path, text)) {
+            continue;
+        }
+        try {
+            hottest_c = std::max(hottest_c, std::stod(text) / 1000.0);
+        } catch (const std::exception&) {
+        }
+    }
+    return hottest_c;
+}
+
+std::vector<std::string> list_directory(const std::string& root, const std::string& prefix) {
+    std::vector<std::string> names;
+#ifdef __linux__
+    DIR* dir = opendir(root.c_str());
+    if (dir == nullptr) {
+        return names;
+    }
+    while (dirent* entry = readdir(dir)) {
+        std::string name = entry->d_name;
+        if (name.compare(0, prefix.size(), prefix) == 0) {
+            names.push_back(name);
+        }
+    }
+    closedir(dir);
+    std::sort(names.begin(), names.end());
+#else
+    (void)root;
+    (void)prefix;
+#endif
+    return names;
+}
+
+uint64_t total_bytes(const std::vector<ProgressSlot>& slots) {
+    uint64_t bytes = 0;
+    for (const auto& slot : slots) {
+        bytes += slot.bytes.load(std::memory_order_relaxed);
+    }
+    return bytes;
+}
+
+double percent_drop(double first, double last) {
+    return first > 0.0 ? (first - last) / first * 100.0 : 0.0;
+}
+
+}  // namespace
+
+double parse_duration(const std::string& str) {
+    double seconds = 0.0;
+    bool parsed = !str.empty() && str[0] != '-' && str[0] != '+';
+    if (parsed) {
+        try {
+            size_t consumed = 0;
+            seconds = std::stod(str, &consumed);
+            std::string suffix = str.substr(consumed);
+            if (suffix == "m") {
+                seconds *= 60.0;
+            } else if (suffix == "h") {
+                seconds *= 3600.0;
+            } else if (!suffix.empty() && suffix != "s") {
+                parsed = false;
+            }
+        } catch (const std::exception&) {
+            parsed = false;
+        }
+    }
+    if (!parsed || !std::isfinite(seconds) || seconds <= 0.0) {
+        throw ArgumentError("Invalid duration '" + str + "'. Expected seconds or a number with s, m or h, such as "
+                            "30s, 10m or 24h");
+    }
+    return seconds;
+}
+
+size_t parse_interval(const std::string& str) {
+    size_t interval_ms = 0;
+    bool parsed = !str.empty() && std::all_of(str.begin(), str.end(), ::isdigit);
+    if (parsed) {
+        try {
+            interval_ms = std::stoul(str);
+        } catch (const std::exception&) {
+            parsed = false;
+        }
+    }
+    if (!parsed || interval_ms < BenchmarkConstants::SOAK_MIN_INTERVAL_MS ||
+        interval_ms > BenchmarkConstants::SOAK_MAX_INTERVAL_MS) {
+        throw ArgumentError("Invalid sample interval '" + str + "'. Expected milliseconds from " +
+                            std::to_string(BenchmarkConstants::SOAK_MIN_INTERVAL_MS) + " to " +
+                            std::to_string(BenchmarkConstants::SOAK_MAX_INTERVAL_MS));
+    }
+    return interval_ms;
+}
+
+double parse_cpuinfo_mhz(const std::vector<std::string>& lines) {
+    double total = 0.0;
+    size_t count = 0;
+    for (const auto& line : lines) {
+        if (line.compare(0, 7, "cpu MHz") != 0) {
+            continue;
+        }
+        size_t colon = line.find(':');
+        if (colon == std::string::npos) {
+            continue;
+        }
+        try {
+            total += std::stod(line.substr(colon + 1));
+            ++count;
+        } catch (const std::exception&) {
+        }
+    }
+    return count > 0 ? total / static_cast<double>(count) : 0.0;
+}
+
+double read_frequency_mhz(const std::vector<size_t>& cpus) {
+    double total_khz = 0.0;
+    size_t count = 0;
+    for (size_t cpu : cpus) {
+        std::string text;
+        if (!SafeFileUtils::read_single_line(CPU_SYSFS_ROOT + "cpu" + std::to_string(cpu) +
+                                             "/cpufreq/scaling_cur_freq", text)) {
+            continue;
+        }
+        try {
+            total_khz += std::stod(text);
+            ++count;
+        } catch (const std::exception&) {
+        }
+    }
+    if (count > 0) {
+        return total_khz / static_cast<double>(count) / 1000.0;
+    }
+
+    std::vector<std::string> lines;
+    if (SafeFileUtils::read_all_lines("/proc/cpuinfo", lines)) {
+        return parse_cpuinfo_mhz(lines);
+    }
+    return 0.0;
+}
+
+void read_temperatures(double& cpu_c, double& dimm_c, const std::string& hwmon_root,
+                       const std::string& thermal_root) {
+    std::vector<std::string> cpu_inputs;
+    std::vector<std::string> dimm_inputs;
+    for (const auto& device : list_directory(hwmon_root, "hwmon")) {
+        std::string base = hwmon_root + device + "/";
+        std::string name;
+        if (!read_sensor_line(base + "name", name)) {
+            continue;
+        }
+        std::vector<std::string>* inputs = nullptr;
+        for (const char* sensor : CPU_SENSORS) {
+            if (name == sensor) inputs = &cpu_inputs;
+        }
+        for (const char* sensor : DIMM_SENSORS) {
+            if (name == sensor) inputs = &dimm_inputs;
+        }
+        if (inputs == nullptr) {
+            continue;
+        }
+        for (const auto& input : list_directory(base, "temp")) {
+            if (input.size() > 6 && input.compare(input.size() - 6, 6, "_input") == 0) {
+                inputs->push_back(base + input);
+            }
+        }
+    }
+
+    cpu_c = hottest(cpu_inputs);
+    if (cpu_c == 0.0) {
+        std::vector<std::string> zones;
+        for (const auto& zone : list_directory(thermal_root, "thermal_zone")) {
+            zones.push_back(thermal_root + zone + "/temp");
+        }
+        cpu_c = hottest(zones);
+    }
+    dimm_c = hottest(dimm_inputs);
+}
+
+std::vector<Sample> run_sampler(const std::vector<ProgressSlot>& slots, const std::vector<size_t>& cpus,
+                                double duration_seconds, size_t interval_ms, std::atomic<bool>& stop_flag) {
+    // Waits are sliced so an external stop or the deadline is noticed promptly at long intervals
+    constexpr auto MAX_WAIT = std::chrono::milliseconds(100);
+
+    std::vector<Sample> samples;
+    auto start = Clock::now();
+    auto deadline = start + std::chrono::duration_cast<Clock::duration>(std::chrono::duration<double>(duration_seconds));
+    auto interval = std::chrono::milliseconds(interval_ms);
+    auto last_time = start;
+    uint64_t last_bytes = total_bytes(slots);
+
+    while (!stop_flag.load(std::memory_order_relaxed)) {
+        auto target = std::min(last_time + interval, deadline);
+        for (auto now = Clock::now(); now < target && !stop_flag.load(std::memory_order_relaxed);
+             now = Clock::now()) {
+            std::this_thread::sleep_for(std::min<Clock::duration>(target - now, MAX_WAIT));
+        }
+        if (stop_flag.load(std::memory_order_relaxed)) {
+            break;
+        }
+
+        auto now = Clock::now();
+        uint64_t bytes = total_bytes(slots);
+        double seconds = std::chrono::duration<double>(now - last_time).count();
+
+        Sample sample;
+        sample.elapsed_seconds = std::chrono::duration<double>(now - start).count();
+        sample.bandwidth_gbps = seconds > 0.0 ? static_cast<double>(bytes - last_bytes) / seconds / 1e9 : 0.0;
+        sample.frequency_mhz = read_frequency_mhz(cpus);
+        read_temperatures(sample.cpu_temperature_c, sample.dimm_temperature_c);
+        samples.push_back(sample);
+
+        last_time = now;
+        last_bytes = bytes;
+        if (now >= deadline) {
+            break;
+        }
+    }
+    stop_flag = true;
+    return samples;
+}
+
+Summary summarize(const std::vector<Sample>& samples) {
+    Summary summary;
+    summary.samples = samples.size();
+    if (samples.empty()) {
+        return summary;
+    }
+
+    size_t window = std::max<size_t>(1, static_cast<size_t>(
+        std::lround(static_cast<double>(samples.size()) * BenchmarkConstants::SOAK_WINDOW_FRACTION)));
+    double first_mhz = 0.0;
+    double last_mhz = 0.0;
+    summary.min_gbps = samples.front().bandwidth_gbps;
+    for (size_t i = 0; i < samples.size(); ++i) {
+        const Sample& sample = samples[i];
+        summary.mean_gbps += sample.bandwidth_gbps;
+        summary.min_gbps = std::min(summary.min_gbps, sample.bandwidth_gbps);
+        summary.max_gbps = std::max(summary.max_gbps, sample.bandwidth_gbps);
+        summary.max_cpu_temperature_c = std::max(summary.max_cpu_temperature_c, sample.cpu_temperature_c);
+        summary.max_dimm_temperature_c = std::max(summary.max_dimm_temperature_c, sample.dimm_temperature_c);
+        if (i < window) {
+            summary.first_gbps += sample.bandwidth_gbps;
+            first_mhz += sample.frequency_mhz;
+        }
+        if (i >= samples.size() - window) {
+            summary.last_gbps += sample.bandwidth_gbps;
+            last_mhz += sample.frequency_mhz;
+        }
+    }
+    double n = static_cast<double>(samples.size());
+    double w = static_cast<double>(window);
+    summary.duration_seconds = samples.back().elapsed_seconds;
+    summary.mean_gbps /= n;
+    summary.first_gbps /= w;
+    summary.last_gbps /= w;
+    summary.first_mhz = first_mhz / w;
+    summary.last_mhz = last_mhz / w;
+    summary.decay_percent = percent_drop(summary.first_gbps, summary.last_gbps);
+    summary.frequency_drop_percent = percent_drop(summary.first_mhz, summary.last_mhz);
+    summary.throttled = summary.decay_percent >= BenchmarkConstants::SOAK_THROTTLE_PERCENT ||
+                        summary.frequency_drop_percent >= BenchmarkConstants::SOAK_THROTTLE_PERCENT;
+    return summary;
+}
+
+std::vector<Sample> downsample(const std::vector<Sample>& samples, size_t max_points) {
+    if (max_points == 0 || samples.size() <= max_points) {
+        return samples;
+    }
+    size_t bucket = (samples.size() + max_points - 1) / max_points;
+    std::vector<Sample> rows;
+    for (size_t first = 0; first < samples.size(); first += bucket) {
+        size_t last = std::min(samples.size(), first + bucket);
+        double count = static_cast<double>(last - first);
+        Sample row;
+        for (size_t i = first; i < last; ++i) {
+            row.bandwidth_gbps += samples[i].bandwidth_gbps / count;
+            row.frequency_mhz += samples[i].frequency_mhz / count;
+            row.cpu_temperature_c += samples[i].cpu_temperature_c / count;
+            row.dimm_temperature_c += samples[i].dimm_temperature_c / count;
+        }
+        row.elapsed_seconds = samples[last - 1].elapsed_seconds;
+        rows.push_back(row);
+    }
+    return rows;
+}
+
+std::string duration_to_string(double seconds) {
+    if (seconds < 60.0 && seconds != std::floor(seconds)) {
+        std::ostringstream ss;
+        ss << seconds << "s";
+        return ss.str();
+    }
+    size_t total = static_cast<size_t>(std::llround(seconds));
+    size_t hours = total / 3600;
+    size_t minutes = total % 3600 / 60;
+    size_t secs = total % 60;
+    std::string text;
+    if (hours > 0) text += std::to_string(hours) + "h";
+    if (minutes > 0) text += (text.empty() ? "" : " ") + std::to_string(minutes) + "m";
+    if (secs > 0 || text.empty()) text += (text.empty() ? "" : " ") + std::to_string(secs) + "s";
+    return text;
+}
+
+}  // namespace Soak
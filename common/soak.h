@@ -0,0 +1,140 @@
+#ifndef SOAK_H
+#define SOAK_H
+
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <string>
+#include <vector>
+
+/**
+ * @brief Soak runs: bandwidth over time and throttling detection
+ *
+ * A fixed-iteration run reports one average, which hides DIMM thermal
+ * throttling and core frequency drops that set in after minutes. In a soak
+ * run each worker streams its pattern until a deadline and publishes the
+ * bytes it has moved through its own cache-line-sized progress slot; a
+ * sampler thread reads every slot at a fixed interval and records the
+ * aggregate GB/s with the mean core frequency of the worker CPUs and the
+ * hottest CPU and DIMM sensors. The series is summarized by comparing its
+ * first and last windows.
+ */
+namespace Soak {
+
+/**
+ * @brief Bytes moved so far by one worker, written only by it
+ *
+ * Padded to a cache line so the sampler's loads and the other workers'
+ * stores never share a line with it.
+ */
+struct alignas(64) ProgressSlot {
+    std::atomic<uint64_t> bytes{0};
+};
+
+/**
+ * @brief One sampling interval of a soak run
+ *
+ * Sensors that are not available read 0.
+ */
+struct Sample {
+    double elapsed_seconds = 0.0;        ///< End of the interval since the run started
+    double bandwidth_gbps = 0.0;         ///< Aggregate bandwidth over the interval
+    double frequency_mhz = 0.0;          ///< Mean current frequency of the worker CPUs
+    double cpu_temperature_c = 0.0;      ///< Hottest CPU package or core sensor (0: no reading)
+    double dimm_temperature_c = 0.0;     ///< Hottest DIMM sensor (jc42 / spd5118 hwmon; 0: no reading)
+};
+
+/**
+ * @brief Overall picture of a soak series
+ */
+struct Summary {
+    size_t samples = 0;
+    double duration_seconds = 0.0;
+    double mean_gbps = 0.0;
+    double min_gbps = 0.0;
+    double max_gbps = 0.0;
+    double first_gbps = 0.0;             ///< Mean bandwidth of the first SOAK_WINDOW_FRACTION of samples
+    double last_gbps = 0.0;              ///< Mean bandwidth of the last SOAK_WINDOW_FRACTION of samples
+    double decay_percent = 0.0;          ///< Bandwidth lost from the first to the last window
+    double first_mhz = 0.0;              ///< Mean frequency of the first window (0: unavailable)
+    double last_mhz = 0.0;               ///< Mean frequency of the last window
+    double frequency_drop_percent = 0.0; ///< Frequency lost from the first to the last window
+    double max_cpu_temperature_c = 0.0;
+    double max_dimm_temperature_c = 0.0;
+    bool throttled = false;              ///< Bandwidth or frequency dropped by SOAK_THROTTLE_PERCENT or more
+};
+
+/**
+ * @brief Parse --duration: seconds, or a number with an s, m or h suffix ("90", "30s", "10m", "24h")
+ * @throws ArgumentError if the duration is malformed or not positive
+ */
+double parse_duration(const std::string& str);
+
+/**
+ * @brief Parse --sample-interval in milliseconds (SOAK_MIN_INTERVAL_MS to SOAK_MAX_INTERVAL_MS)
+ * @throws ArgumentError if the interval is malformed or out of range
+ */
+size_t parse_interval(const std::string& str);
+
+/**
+ * @brief Mean "cpu MHz" of /proc/cpuinfo lines (0 if none)
+ */
+double parse_cpuinfo_mhz(const std::vector<std::string>& lines);
+
+/**
+ * @brief Mean current frequency of the given CPUs in MHz
+ *
+ * Reads cpufreq/scaling_cur_freq, falling back to /proc/cpuinfo where
+ * cpufreq is absent (most VMs).
+ *
+ * @return 0 if neither source is available
+ */
+double read_frequency_mhz(const std::vector<size_t>& cpus);
+
+/**
+ * @brief Hottest CPU and DIMM temperatures in degrees Celsius
+ *
+ * CPU: hwmon sensors of coretemp, k10temp, zenpower or cpu_thermal, else
+ * the hottest thermal zone. DIMM: hwmon sensors of jc42 and spd5118.
+ *
+ * @param hwmon_root Directory of hwmonN entries
+ * @param thermal_root Directory of thermal_zoneN entries
+ */
+void read_temperatures(double& cpu_c, double& dimm_c, const std::string& hwmon_root = "/sys/class/hwmon/",
+                       const std::string& thermal_root = "/sys/class/thermal/");
+
+/**
+ * @brief Sample the progress slots until the duration elapses, then set stop_flag
+ *
+ * Runs on its own thread next to the workers. Returns early, with the
+ * samples taken so far, if stop_flag is set by someone else.
+ *
+ * @param slots One slot per worker
+ * @param cpus CPUs the workers run on, for the frequency reading
+ * @param duration_seconds Length of the run
+ * @param interval_ms Sampling period
+ */
+std::vector<Sample> run_sampler(const std::vector<ProgressSlot>& slots, const std::vector<size_t>& cpus,
+                                double duration_seconds, size_t interval_ms, std::atomic<bool>& stop_flag);
+
+/**
+ * @brief Compare the first and last windows of a series and flag throttling
+ */
+Summary summarize(const std::vector<Sample>& samples);
+
+/**
+ * @brief Average consecutive samples down to at most max_points rows
+ *
+ * Each row carries the elapsed time of its last sample and the mean of
+ * every other field; series of max_points or fewer are returned unchanged.
+ */
+std::vector<Sample> downsample(const std::vector<Sample>& samples, size_t max_points);
+
+/**
+ * @brief Duration as reported in results ("24h", "10m", "1m 30s", "45s")
+ */
+std::string duration_to_string(double seconds);
+
+}  // namespace Soak
+
+#endif  // SOAK_H
@@ -2,8 +2,11 @@
 
 #include <algorithm>
 #include <chrono>
+#include <cmath>
 #include <cstring>
+#include <initializer_list>
 #include <random>
+#include <utility>
 #include <vector>
 #ifdef __x86_64__
 #include <immintrin.h>  // For SIMD operations on x86
@@ -14,7 +17,18 @@
 #include "memory_utils.h"
 #include "constants.h"
 #include "matrix_multiply_interface.h"
-#include "platform_interface.h"
+#include "blocked_gemm.h"
+#include "simd_kernels.h"
+#include "pointer_chase.h"
+#include "access_patterns.h"
+#include "encoded_scans.h"
+#include "proxy_kernels.h"
+#include "irregular_kernels.h"
+#include "kernel_matrix.h"
+#include "sample_stats.h"
+#include "errors.h"
+#include "perf_counters.h"
+#include "cycle_timer.h"
 
 namespace StandardTests {
 
@@ -28,17 +42,245 @@ inline void memory_barrier() {
     __sync_synchronize();
 }
 
+namespace {
+
+/**
+ * @brief Times batches of iterations into a SampleRing
+ *
+ * Iterations are grouped so a run never records more samples than the ring
+ * holds, and the clock is only read at batch boundaries. Without a ring
+ * every call is a no-op.
+ */
+class IterationSampler {
+public:
+    using Clock = CycleTimer::Clock;
+
+    IterationSampler(SampleRing* ring, size_t iterations, size_t bytes_per_iteration,
+                     size_t operations_per_iteration, Clock::time_point start)
+        : ring_(ring),
+          batch_(ring ? ring->batch_size(iterations) : 0),
+          bytes_per_iteration_(bytes_per_iteration),
+          operations_per_iteration_(operations_per_iteration),
+          batch_start_(start),
+          in_batch_(0) {}
+
+    void iteration_done() {
+        if (ring_ == nullptr) return;
+        if (++in_batch_ == batch_) {
+            Clock::time_point now = Clock::now();
+            record(now);
+            batch_start_ = now;
+        }
+    }
+
+    // Leave time spent off the clock (cold-pass evictions) out of the current batch
+    void exclude(Clock::duration paused) {
+        batch_start_ += paused;
+    }
+
+    // Flush a trailing partial batch (e.g. after stop_flag) at the run's end time
+    void finish(Clock::time_point end) {
+        if (ring_ != nullptr && in_batch_ > 0) {
+            record(end);
+        }
+    }
+
+private:
+    void record(Clock::time_point now) {
+        double seconds = CycleTimer::elapsed_seconds(batch_start_, now);
+        ring_->record(seconds, bytes_per_iteration_ * in_batch_, operations_per_iteration_ * in_batch_);
+        in_batch_ = 0;
+    }
+
+    SampleRing* ring_;
+    size_t batch_;
+    size_t bytes_per_iteration_;
+    size_t operations_per_iteration_;
+    Clock::time_point batch_start_;
+    size_t in_batch_;
+};
+
+/**
+ * @brief Evicts a kernel's arrays before each pass, off the clock (--cold)
+ *
+ * The first eviction runs on construction, before the kernel starts its
+ * clock. Later ones stop the counters, and their time is taken out of the
+ * sampler's batch and reported by excluded_seconds() for the kernel to
+ * subtract. Without an evictor every call is a no-op.
+ */
+class ColdPasses {
+public:
+    using Clock = IterationSampler::Clock;
+
+    ColdPasses(ColdCache::Evictor* evictor, std::initializer_list<std::pair<const void*, size_t>> ranges)
+        : evictor_(evictor), ranges_(ranges), excluded_(Clock::duration::zero()) {
+        evict();
+    }
+
+    void between(IterationSampler& sampler) {
+        if (evictor_ == nullptr) return;
+        PerfCounters::region_end();
+        Clock::time_point paused = Clock::now();
+        evict();
+        Clock::duration spent = Clock::now() - paused;
+        excluded_ += spent;
+        sampler.exclude(spent);
+        PerfCounters::region_begin();
+    }
+
+    double excluded_seconds() const {
+        return std::chrono::duration<double>(excluded_).count();
+    }
+
+private:
+    void evict() {
+        if (evictor_ == nullptr) return;
+        evictor_->begin();
+        for (const auto& range : ranges_) {
+            evictor_->evict(range.first, range.second);
+        }
+    }
+
+    ColdCache::Evictor* evictor_;
+    std::vector<std::pair<const void*, size_t>> ranges_;
+    Clock::duration excluded_;
+};
+
+/**
+ * @brief Busy-wait for a number of pause instructions without touching memory
+ */
+inline void spin_delay(size_t spins) {
+    for (size_t i = 0; i < spins; ++i) {
+#if defined(__x86_64__) || defined(__i386__)
+        _mm_pause();
+#elif defined(__aarch64__)
+        asm volatile("yield" ::: "memory");
+#else
+        asm volatile("" ::: "memory");
+#endif
+    }
+}
+
+/*
+ * Output spot checks. They run after the timed loop and only prove that the
+ * first and last stores of the range landed, which is what a kernel whose
+ * work was optimized away or truncated gets wrong.
+ */
+bool stores_landed(const uint8_t* data, size_t bytes, uint64_t pattern) {
+    uint64_t first, last;
+    std::memcpy(&first, data, sizeof(first));
+    std::memcpy(&last, data + bytes - sizeof(last), sizeof(last));
+    return first == pattern && last == pattern;
+}
+
+bool copy_landed(const uint8_t* dst, const uint8_t* src, size_t bytes) {
+    size_t line = std::min(bytes, DEFAULT_CACHE_LINE_SIZE);
+    return std::memcmp(dst, src, line) == 0 && std::memcmp(dst + bytes - line, src + bytes - line, line) == 0;
+}
+
+bool element_ok(double actual, double expected, double tolerance = 1e-12) {
+    if (std::isnan(expected)) {
+        return std::isnan(actual);  // Random initial bits may encode NaN
+    }
+    // FMA and separate multiply-add (or a reordered sum) differ in the last bits
+    return actual == expected || std::abs(actual - expected) <= tolerance * std::max(1.0, std::abs(expected));
+}
+
+bool triad_element_ok(double a, double b, double c, double scalar) {
+    return element_ok(a, b + scalar * c);
+}
+
+/**
+ * @brief Whole doubles of [start_offset, end_offset)
+ */
+std::pair<size_t, size_t> double_range(size_t start_offset, size_t end_offset) {
+    size_t aligned_start = (start_offset + sizeof(double) - 1) & ~(sizeof(double) - 1);
+    size_t aligned_end = end_offset & ~(sizeof(double) - 1);
+    return {aligned_start, aligned_end};
+}
+
+/**
+ * @brief One pass of the roofline kernel: FLOPS operations per element
+ *
+ * The fixed-size block is scalarized into vector registers, so the FMA
+ * chains run without touching memory between the load and the store.
+ */
+template <size_t FLOPS>
+void intensity_pass(double* a, size_t num_elements) {
+    constexpr size_t BLOCK = BenchmarkConstants::ROOFLINE_BLOCK_ELEMENTS;
+    const double alpha = 0.999999;  // Contracting map: values stay finite for any chain length
+    const double beta = 1e-6;
+
+    size_t i = 0;
+    for (; i + BLOCK <= num_elements; i += BLOCK) {
+        double v[BLOCK];
+        for (size_t l = 0; l < BLOCK; ++l) {
+            v[l] = a[i + l];
+        }
+        if constexpr (FLOPS == 1) {
+            for (size_t l = 0; l < BLOCK; ++l) {
+                v[l] += beta;
+            }
+        } else {
+            for (size_t f = 0; f < FLOPS / 2; ++f) {
+                for (size_t l = 0; l < BLOCK; ++l) {
+                    v[l] = v[l] * alpha + beta;
+                }
+            }
+        }
+        for (size_t l = 0; l < BLOCK; ++l) {
+            a[i + l] = v[l];
+        }
+    }
+    for (; i < num_elements; ++i) {
+        double v = a[i];
+        if constexpr (FLOPS == 1) {
+            v += beta;
+        } else {
+            for (size_t f = 0; f < FLOPS / 2; ++f) {
+                v = v * alpha + beta;
+            }
+        }
+        a[i] = v;
+    }
+}
+
+using IntensityPass = void (*)(double*, size_t);
+
+IntensityPass intensity_pass_for(size_t flops_per_element) {
+    switch (flops_per_element) {
+        case 1: return intensity_pass<1>;
+        case 2: return intensity_pass<2>;
+        case 4: return intensity_pass<4>;
+        case 8: return intensity_pass<8>;
+        case 16: return intensity_pass<16>;
+        case 32: return intensity_pass<32>;
+        case 64: return intensity_pass<64>;
+        case 128: return intensity_pass<128>;
+        case 256: return intensity_pass<256>;
+        case 512: return intensity_pass<512>;
+        case 1024: return intensity_pass<1024>;
+        default: return nullptr;
+    }
+}
+
+}  // namespace
+
 /**
  * @brief Natural sequential read test - let the system work as designed
  * 
- * Uses cache-line aligned array operations. No cache flushing or interference.
- * Let hardware prefetchers, cache policies, and memory controllers work naturally.
+ * Uses cache-line aligned array operations. No cache flushing or interference
+ * unless cold passes are requested. Let hardware prefetchers, cache policies,
+ * and memory controllers work naturally; a prefetch distance adds software
+ * prefetches on top of them.
  */
 PerformanceStats sequential_read_test(const uint8_t* buffer, size_t buffer_size,
                                       size_t start_offset, size_t end_offset, size_t iterations,
-                                      const std::atomic<bool>& stop_flag, bool cache_aware) {
+                                      const std::atomic<bool>& stop_flag, bool cache_aware,
+                                      KernelType kernel, SampleRing* samples, size_t prefetch_distance,
+                                      ColdCache::Evictor* cold, const KernelMatrix::Kernel* tuned) {
     (void)buffer_size;  // Unused
-    (void)cache_aware;  // No special cache handling needed - let system work naturally
+    (void)cache_aware;  // Only sizes the working set; cold passes come from cold
     
     /**
      * Memory Alignment Algorithm for Optimal Cache Performance
@@ -70,50 +312,68 @@ PerformanceStats sequential_read_test(const uint8_t* buffer, size_t buffer_size,
     }
     
     size_t working_set_size = aligned_end - aligned_start;
-    
-    auto start_time = std::chrono::high_resolution_clock::now();
+    const SimdKernels::KernelSet& kernels = SimdKernels::get_kernel_set(kernel);
+    const uint8_t* data = buffer + aligned_start;
+
+    // Checksum is carried across iterations and published once at the end,
+    // so the loads stay live without a volatile store per cache line
+    uint64_t checksum = 0;
 
+    ColdPasses cold_passes(cold, {{data, working_set_size}});
+    PerfCounters::region_begin();
+    auto start_time = CycleTimer::Clock::now();
+    IterationSampler sampler(samples, iterations, working_set_size, working_set_size / DEFAULT_CACHE_LINE_SIZE,
+                             start_time);
+
+    size_t passes = 0;
     for(size_t iter = 0; iter < iterations && !stop_flag; ++iter) {
-        // Natural streaming read - process cache lines efficiently
-        volatile uint64_t sum = 0;  // Prevent compiler optimization
-        const uint64_t* data = reinterpret_cast<const uint64_t*>(buffer + aligned_start);
-        size_t num_elements = working_set_size / sizeof(uint64_t);
-        
-        // Read in cache-line chunks (8 uint64_t = 64 bytes)
-        // Ensure we don't read past the end of the buffer
-        size_t full_chunks = num_elements / 8;
-        for(size_t i = 0; i < full_chunks * 8; i += 8) {
-            // Read entire cache line naturally
-            sum += data[i] + data[i+1] + data[i+2] + data[i+3] +
-                   data[i+4] + data[i+5] + data[i+6] + data[i+7];
-        }
-        
-        // Handle remaining elements (if any)
-        for(size_t i = full_chunks * 8; i < num_elements; i++) {
-            sum += data[i];
+        if (iter > 0) cold_passes.between(sampler);
+        if (tuned != nullptr) {
+            checksum += tuned->read(data, working_set_size);
+        } else {
+            checksum += (prefetch_distance > 0) ? kernels.read_prefetch(data, working_set_size, prefetch_distance)
+                                                : kernels.read(data, working_set_size);
         }
-        
+        ++passes;
+
         // Ensure compiler doesn't optimize away the work
         __sync_synchronize();
+        sampler.iteration_done();
     }
 
-    auto end_time = std::chrono::high_resolution_clock::now();
-    double time_seconds = std::chrono::duration<double>(end_time - start_time).count();
+    auto end_time = CycleTimer::Clock::now();
+    PerfCounters::region_end();
+    sampler.finish(end_time);
+    double time_seconds =
+        CycleTimer::elapsed_seconds(start_time, end_time) - cold_passes.excluded_seconds();
+
+    volatile uint64_t sink = checksum;
+    (void)sink;
     
     size_t bytes_processed = working_set_size * iterations;
     size_t operations = (working_set_size / DEFAULT_CACHE_LINE_SIZE) * iterations;
 
-    return calculate_stats(bytes_processed, time_seconds, operations);
+    // One untimed scalar pass: a kernel that skipped or truncated loads cannot reproduce the sum
+    uint64_t expected = (tuned != nullptr)
+        ? KernelMatrix::reference_read(tuned->shape.element_bytes, data, working_set_size) * passes
+        : SimdKernels::get_kernel_set(KernelType::SCALAR).read(data, working_set_size) * passes;
+
+    PerformanceStats stats = calculate_stats(bytes_processed, time_seconds, operations);
+    stats.verified = (checksum == expected);
+    return stats;
 }
 
 /**
  * @brief Natural sequential write test - let the system work as designed
  * 
- * Uses cache-line aligned array operations. No cache flushing or interference.
+ * Uses cache-line aligned array operations. No cache flushing or interference
+ * unless cold passes are requested.
  */
 PerformanceStats sequential_write_test(uint8_t* buffer, size_t buffer_size, size_t start_offset,
                                        size_t end_offset, size_t iterations,
-                                       const std::atomic<bool>& stop_flag) {
+                                       const std::atomic<bool>& stop_flag, KernelType kernel,
+                                       StorePolicy store_policy, SampleRing* samples,
+                                       ColdCache::Evictor* cold, const KernelMatrix::Kernel* tuned) {
     (void)buffer_size;  // Unused
     
     // Align to cache line boundaries for optimal access
@@ -124,56 +384,104 @@ PerformanceStats sequential_write_test(uint8_t* buffer, size_t buffer_size, size
     }
     
     size_t working_set_size = MemoryUtils::calculate_working_set_size(aligned_start, aligned_end);
+    const SimdKernels::StoreKernels stores = SimdKernels::get_store_kernels(kernel, store_policy);
 
-    auto start_time = std::chrono::high_resolution_clock::now();
+    ColdPasses cold_passes(cold, {{buffer + aligned_start, working_set_size}});
+    PerfCounters::region_begin();
+    auto start_time = CycleTimer::Clock::now();
+    IterationSampler sampler(samples, iterations, working_set_size, working_set_size / DEFAULT_CACHE_LINE_SIZE,
+                             start_time);
 
+    uint64_t last_pattern = 0;
+    size_t passes = 0;
     for(size_t iter = 0; iter < iterations && !stop_flag; ++iter) {
-        // Natural streaming write - process cache lines efficiently
-        uint64_t* data = reinterpret_cast<uint64_t*>(buffer + aligned_start);
-        size_t num_elements = working_set_size / sizeof(uint64_t);
+        if (iter > 0) cold_passes.between(sampler);
+        // New pattern per iteration so every pass really stores to memory
         uint64_t pattern = BenchmarkConstants::TEST_PATTERN_BASE + iter;
-        
-        // Write in cache-line chunks
-        // Ensure we don't write past the end of the buffer
-        size_t full_chunks = num_elements / BenchmarkConstants::CACHE_LINE_ELEMENTS_UINT64;
-        for(size_t i = 0; i < full_chunks * BenchmarkConstants::CACHE_LINE_ELEMENTS_UINT64; i += BenchmarkConstants::CACHE_LINE_ELEMENTS_UINT64) {
-            // Write entire cache line naturally
-            data[i] = pattern + i;
-            data[i+1] = pattern + i + 1;
-            data[i+2] = pattern + i + 2;
-            data[i+3] = pattern + i + 3;
-            data[i+4] = pattern + i + 4;
-            data[i+5] = pattern + i + 5;
-            data[i+6] = pattern + i + 6;
-            data[i+7] = pattern + i + 7;
-        }
-        
-        // Handle remaining elements (if any)
-        for(size_t i = full_chunks * BenchmarkConstants::CACHE_LINE_ELEMENTS_UINT64; i < num_elements; i++) {
-            data[i] = pattern + i;
+        if (tuned != nullptr) {
+            tuned->write(buffer + aligned_start, working_set_size, pattern);
+        } else {
+            stores.write(buffer + aligned_start, working_set_size, pattern);
         }
-        
+        last_pattern = pattern;
+        ++passes;
+
         __sync_synchronize();
+        sampler.iteration_done();
     }
 
-    auto end_time = std::chrono::high_resolution_clock::now();
-    double time_seconds = std::chrono::duration<double>(end_time - start_time).count();
+    auto end_time = CycleTimer::Clock::now();
+    PerfCounters::region_end();
+    sampler.finish(end_time);
+    double time_seconds =
+        CycleTimer::elapsed_seconds(start_time, end_time) - cold_passes.excluded_seconds();
     
     size_t bytes_processed = working_set_size * iterations;
     size_t operations = (working_set_size / DEFAULT_CACHE_LINE_SIZE) * iterations;
 
-    return calculate_stats(bytes_processed, time_seconds, operations);
+    PerformanceStats stats = calculate_stats(bytes_processed, time_seconds, operations);
+    stats.verified = (passes == 0) || stores_landed(buffer + aligned_start, working_set_size, last_pattern);
+    return stats;
 }
 
+namespace {
+
+/**
+ * @brief One random pass over whole cache lines, optionally prefetching ahead in visit order
+ *
+ * The prefetch index wraps to the start of the list, so the first lines of
+ * the next pass are in flight when a pass ends, as they are mid-pass.
+ */
+template <bool PREFETCH>
+void random_pass(uint8_t* buffer, const std::vector<size_t>& lines, size_t lines_ahead, bool is_write,
+                 uint64_t pattern) {
+    const size_t count = lines.size();
+    size_t ahead = lines_ahead;
+    if (is_write) {
+        // Random write - full cache lines
+        for(size_t k = 0; k < count; ++k) {
+            if constexpr (PREFETCH) {
+                __builtin_prefetch(buffer + lines[ahead], 1, 3);
+                ahead = (ahead + 1 == count) ? 0 : ahead + 1;
+            }
+            size_t addr = lines[k];
+            uint64_t* cache_line = reinterpret_cast<uint64_t*>(buffer + addr);
+            // Write entire cache line
+            for(size_t i = 0; i < BenchmarkConstants::CACHE_LINE_ELEMENTS_UINT64; ++i) {
+                cache_line[i] = pattern + addr + i;
+            }
+        }
+    } else {
+        // Random read - full cache lines
+        volatile uint64_t sum = 0;
+        for(size_t k = 0; k < count; ++k) {
+            if constexpr (PREFETCH) {
+                __builtin_prefetch(buffer + lines[ahead], 0, 3);
+                ahead = (ahead + 1 == count) ? 0 : ahead + 1;
+            }
+            const uint64_t* cache_line = reinterpret_cast<const uint64_t*>(buffer + lines[k]);
+            // Read entire cache line
+            for(size_t i = 0; i < BenchmarkConstants::CACHE_LINE_ELEMENTS_UINT64; ++i) {
+                sum += cache_line[i];
+            }
+        }
+    }
+}
+
+}  // namespace
+
 /**
  * @brief Natural random access test - realistic scatter/gather patterns
  * 
- * Uses cache-line aligned random access. No cache flushing.
+ * Uses cache-line aligned random access. No cache flushing unless cold passes
+ * are requested, which evict the visit order along with the lines.
  * This simulates real workloads with poor locality.
  */
 PerformanceStats random_access_test(uint8_t* buffer, size_t buffer_size, size_t start_offset,
                                     size_t end_offset, size_t iterations, bool is_write,
-                                    const std::atomic<bool>& stop_flag) {
+                                    const std::atomic<bool>& stop_flag, SampleRing* samples,
+                                    size_t prefetch_distance,
+                                    ColdCache::Evictor* cold) {
     (void)buffer_size;  // Unused
     
     // Align to cache line boundaries
@@ -194,36 +502,34 @@ PerformanceStats random_access_test(uint8_t* buffer, size_t buffer_size, size_t
     std::mt19937 gen(rd());
     std::shuffle(cache_line_indices.begin(), cache_line_indices.end(), gen);
 
-    auto start_time = std::chrono::high_resolution_clock::now();
+    ColdPasses cold_passes(cold, {{buffer + aligned_start, aligned_end - aligned_start},
+                                  {cache_line_indices.data(), cache_line_indices.size() * sizeof(size_t)}});
+    PerfCounters::region_begin();
+    auto start_time = CycleTimer::Clock::now();
+    IterationSampler sampler(samples, iterations, cache_line_indices.size() * DEFAULT_CACHE_LINE_SIZE,
+                             cache_line_indices.size(), start_time);
+
+    // Lines ahead in visit order; a whole pass ahead would prefetch the current line
+    size_t lines_ahead = std::min(prefetch_distance / DEFAULT_CACHE_LINE_SIZE, cache_line_indices.size() - 1);
 
     for(size_t iter = 0; iter < iterations && !stop_flag; ++iter) {
-        if (is_write) {
-            // Random write - full cache lines
-            uint64_t pattern = BenchmarkConstants::TEST_PATTERN_BASE + iter;
-            for(size_t addr : cache_line_indices) {
-                uint64_t* cache_line = reinterpret_cast<uint64_t*>(buffer + addr);
-                // Write entire cache line
-                for(size_t i = 0; i < BenchmarkConstants::CACHE_LINE_ELEMENTS_UINT64; ++i) {
-                    cache_line[i] = pattern + addr + i;
-                }
-            }
+        if (iter > 0) cold_passes.between(sampler);
+        uint64_t pattern = BenchmarkConstants::TEST_PATTERN_BASE + iter;
+        if (lines_ahead > 0) {
+            random_pass<true>(buffer, cache_line_indices, lines_ahead, is_write, pattern);
         } else {
-            // Random read - full cache lines
-            volatile uint64_t sum = 0;
-            for(size_t addr : cache_line_indices) {
-                const uint64_t* cache_line = reinterpret_cast<const uint64_t*>(buffer + addr);
-                // Read entire cache line
-                for(size_t i = 0; i < BenchmarkConstants::CACHE_LINE_ELEMENTS_UINT64; ++i) {
-                    sum += cache_line[i];
-                }
-            }
+            random_pass<false>(buffer, cache_line_indices, 0, is_write, pattern);
         }
         
         __sync_synchronize();
+        sampler.iteration_done();
     }
 
-    auto end_time = std::chrono::high_resolution_clock::now();
-    double time_seconds = std::chrono::duration<double>(end_time - start_time).count();
+    auto end_time = CycleTimer::Clock::now();
+    PerfCounters::region_end();
+    sampler.finish(end_time);
+    double time_seconds =
+        CycleTimer::elapsed_seconds(start_time, end_time) - cold_passes.excluded_seconds();
     
     size_t bytes_processed = cache_line_indices.size() * DEFAULT_CACHE_LINE_SIZE * iterations;
     size_t operations = cache_line_indices.size() * iterations;
@@ -231,6 +537,66 @@ PerformanceStats random_access_test(uint8_t* buffer, size_t buffer_size, size_t
     return calculate_stats(bytes_processed, time_seconds, operations);
 }
 
+/**
+ * @brief Serial dependent-load chase over a cyclic chain
+ *
+ * Each pass walks at least MIN_CHASE_HOPS hops so L1-sized chains are timed
+ * over many cycles, and at most MAX_CHASE_HOPS so DRAM-sized chains stay
+ * within a bounded time per pass. One untimed pass warms caches and TLBs;
+ * cold passes then evict the chain again.
+ */
+PerformanceStats latency_chase_test(uint8_t* buffer, size_t buffer_size, size_t start_offset,
+                                    size_t end_offset, size_t iterations,
+                                    const std::atomic<bool>& stop_flag,
+                                    const PointerChase::ChaseConfig& chase_config, SampleRing* samples,
+                                    ColdCache::Evictor* cold) {
+    if (!MemoryUtils::validate_memory_operation(start_offset, end_offset, buffer_size, DEFAULT_CACHE_LINE_SIZE)) {
+        return {0.0, 0.0, 0, 0.0};
+    }
+
+    auto [aligned_start, aligned_end] = MemoryUtils::align_to_cache_lines(start_offset, end_offset, DEFAULT_CACHE_LINE_SIZE);
+    if (aligned_end <= aligned_start) {
+        return {0.0, 0.0, 0, 0.0};
+    }
+
+    uint8_t* base = buffer + aligned_start;
+    size_t node_count = PointerChase::build_chain(base, aligned_end - aligned_start, chase_config,
+                                                  static_cast<uint64_t>(aligned_start) ^ BenchmarkConstants::TEST_PATTERN_BASE);
+    if (node_count == 0) {
+        return {0.0, 0.0, 0, 0.0};
+    }
+
+    size_t hops_per_pass = std::min(std::max(node_count, BenchmarkConstants::MIN_CHASE_HOPS),
+                                    BenchmarkConstants::MAX_CHASE_HOPS);
+    const void* position = PointerChase::chase(base, std::min(node_count, BenchmarkConstants::MAX_CHASE_HOPS));
+
+    size_t passes = 0;
+    ColdPasses cold_passes(cold, {{base, aligned_end - aligned_start}});
+    PerfCounters::region_begin();
+    auto start_time = CycleTimer::Clock::now();
+    IterationSampler sampler(samples, iterations, hops_per_pass * DEFAULT_CACHE_LINE_SIZE, hops_per_pass, start_time);
+
+    for(size_t iter = 0; iter < iterations && !stop_flag; ++iter) {
+        if (iter > 0) cold_passes.between(sampler);
+        position = PointerChase::chase(position, hops_per_pass);
+        ++passes;
+        sampler.iteration_done();
+    }
+
+    auto end_time = CycleTimer::Clock::now();
+    PerfCounters::region_end();
+    sampler.finish(end_time);
+    double time_seconds =
+        CycleTimer::elapsed_seconds(start_time, end_time) - cold_passes.excluded_seconds();
+
+    // Publish the final node so the chain cannot be optimized away
+    volatile const void* sink = position;
+    (void)sink;
+
+    size_t hops = hops_per_pass * passes;
+    return calculate_stats(hops * DEFAULT_CACHE_LINE_SIZE, time_seconds, hops);
+}
+
 /**
  * @brief Natural memory copy test - let memcpy work efficiently
  * 
@@ -238,7 +604,9 @@ PerformanceStats random_access_test(uint8_t* buffer, size_t buffer_size, size_t
  */
 PerformanceStats copy_test(const uint8_t* src_buffer, uint8_t* dst_buffer, size_t buffer_size,
                            size_t start_offset, size_t end_offset, size_t iterations,
-                           const std::atomic<bool>& stop_flag) {
+                           const std::atomic<bool>& stop_flag, KernelType kernel,
+                           StorePolicy store_policy, SampleRing* samples,
+                           ColdCache::Evictor* cold) {
     // SECURITY: Validate memory operation parameters to prevent buffer overflow
     if (!MemoryUtils::validate_memory_operation(start_offset, end_offset, buffer_size, DEFAULT_CACHE_LINE_SIZE)) {
         // Return error stats for invalid parameters
@@ -253,27 +621,144 @@ PerformanceStats copy_test(const uint8_t* src_buffer, uint8_t* dst_buffer, size_
     }
     
     size_t working_set_size = MemoryUtils::calculate_working_set_size(aligned_start, aligned_end);
+    // Bounds were validated above; the kernel copies exactly this range
+    const SimdKernels::StoreKernels stores = SimdKernels::get_store_kernels(kernel, store_policy);
 
-    auto start_time = std::chrono::high_resolution_clock::now();
+    ColdPasses cold_passes(cold, {{src_buffer + aligned_start, working_set_size},
+                                  {dst_buffer + aligned_start, working_set_size}});
+    PerfCounters::region_begin();
+    auto start_time = CycleTimer::Clock::now();
+    IterationSampler sampler(samples, iterations, working_set_size * 2, working_set_size / DEFAULT_CACHE_LINE_SIZE,
+                             start_time);
 
+    size_t passes = 0;
     for(size_t iter = 0; iter < iterations && !stop_flag; ++iter) {
-        // SECURITY: Use safe memory copy with bounds checking
-        if (!MemoryUtils::safe_memory_copy(dst_buffer, buffer_size,
-                                          src_buffer, buffer_size,
-                                          aligned_start, working_set_size)) {
-            // Memory copy failed - abort benchmark
-            return {0.0, 0.0, 0, 0.0};
-        }
+        if (iter > 0) cold_passes.between(sampler);
+        stores.copy(dst_buffer + aligned_start, src_buffer + aligned_start, working_set_size);
+        ++passes;
         __sync_synchronize();
+        sampler.iteration_done();
     }
 
-    auto end_time = std::chrono::high_resolution_clock::now();
-    double time_seconds = std::chrono::duration<double>(end_time - start_time).count();
+    auto end_time = CycleTimer::Clock::now();
+    PerfCounters::region_end();
+    sampler.finish(end_time);
+    double time_seconds =
+        CycleTimer::elapsed_seconds(start_time, end_time) - cold_passes.excluded_seconds();
     
     size_t bytes_processed = working_set_size * iterations * 2;  // Read + Write
     size_t operations = (working_set_size / DEFAULT_CACHE_LINE_SIZE) * iterations;
 
-    return calculate_stats(bytes_processed, time_seconds, operations);
+    PerformanceStats stats = calculate_stats(bytes_processed, time_seconds, operations);
+    stats.verified = (passes == 0) ||
+                     copy_landed(dst_buffer + aligned_start, src_buffer + aligned_start, working_set_size);
+    return stats;
+}
+
+/**
+ * @brief STREAM Scale test - A[i] = scalar * B[i]
+ */
+PerformanceStats scale_test(uint8_t* a_buffer, const uint8_t* b_buffer, size_t buffer_size,
+                            size_t start_offset, size_t end_offset, size_t iterations,
+                            const std::atomic<bool>& stop_flag, KernelType kernel,
+                            SampleRing* samples,
+                            ColdCache::Evictor* cold) {
+    (void)buffer_size;  // Unused
+
+    auto [aligned_start, aligned_end] = double_range(start_offset, end_offset);
+    if (aligned_end <= aligned_start) {
+        return {0.0, 0.0, 0, 0.0};
+    }
+
+    size_t working_set_size = aligned_end - aligned_start;
+    size_t num_elements = working_set_size / sizeof(double);
+    double* a = reinterpret_cast<double*>(a_buffer + aligned_start);
+    const double* b = reinterpret_cast<const double*>(b_buffer + aligned_start);
+    const double scalar = 3.14159;
+    const SimdKernels::KernelSet& kernels = SimdKernels::get_kernel_set(kernel);
+
+    ColdPasses cold_passes(cold, {{a, working_set_size}, {b, working_set_size}});
+    PerfCounters::region_begin();
+    auto start_time = CycleTimer::Clock::now();
+    IterationSampler sampler(samples, iterations, working_set_size * 2, num_elements, start_time);
+
+    size_t passes = 0;
+    for(size_t iter = 0; iter < iterations && !stop_flag; ++iter) {
+        if (iter > 0) cold_passes.between(sampler);
+        kernels.scale(a, b, scalar, num_elements);
+        ++passes;
+
+        __sync_synchronize();
+        sampler.iteration_done();
+    }
+
+    auto end_time = CycleTimer::Clock::now();
+    PerfCounters::region_end();
+    sampler.finish(end_time);
+    double time_seconds =
+        CycleTimer::elapsed_seconds(start_time, end_time) - cold_passes.excluded_seconds();
+
+    size_t bytes_processed = working_set_size * iterations * 2;  // Read B, Write A
+    size_t operations = num_elements * iterations;
+
+    PerformanceStats stats = calculate_stats(bytes_processed, time_seconds, operations);
+    size_t last = num_elements - 1;
+    stats.verified = (passes == 0) ||
+                     (element_ok(a[0], scalar * b[0]) && element_ok(a[last], scalar * b[last]));
+    return stats;
+}
+
+/**
+ * @brief STREAM Add test - A[i] = B[i] + C[i]
+ */
+PerformanceStats add_test(uint8_t* a_buffer, const uint8_t* b_buffer, const uint8_t* c_buffer,
+                          size_t buffer_size, size_t start_offset, size_t end_offset,
+                          size_t iterations, const std::atomic<bool>& stop_flag, KernelType kernel,
+                          SampleRing* samples,
+                          ColdCache::Evictor* cold) {
+    (void)buffer_size;  // Unused
+
+    auto [aligned_start, aligned_end] = double_range(start_offset, end_offset);
+    if (aligned_end <= aligned_start) {
+        return {0.0, 0.0, 0, 0.0};
+    }
+
+    size_t working_set_size = aligned_end - aligned_start;
+    size_t num_elements = working_set_size / sizeof(double);
+    double* a = reinterpret_cast<double*>(a_buffer + aligned_start);
+    const double* b = reinterpret_cast<const double*>(b_buffer + aligned_start);
+    const double* c = reinterpret_cast<const double*>(c_buffer + aligned_start);
+    const SimdKernels::KernelSet& kernels = SimdKernels::get_kernel_set(kernel);
+
+    ColdPasses cold_passes(cold, {{a, working_set_size}, {b, working_set_size}, {c, working_set_size}});
+    PerfCounters::region_begin();
+    auto start_time = CycleTimer::Clock::now();
+    IterationSampler sampler(samples, iterations, working_set_size * 3, num_elements, start_time);
+
+    size_t passes = 0;
+    for(size_t iter = 0; iter < iterations && !stop_flag; ++iter) {
+        if (iter > 0) cold_passes.between(sampler);
+        kernels.add(a, b, c, num_elements);
+        ++passes;
+
+        __sync_synchronize();
+        sampler.iteration_done();
+    }
+
+    auto end_time = CycleTimer::Clock::now();
+    PerfCounters::region_end();
+    sampler.finish(end_time);
+    double time_seconds =
+        CycleTimer::elapsed_seconds(start_time, end_time) - cold_passes.excluded_seconds();
+
+    size_t bytes_processed = working_set_size * iterations * 3;  // Read B, Read C, Write A
+    size_t operations = num_elements * iterations;
+
+    PerformanceStats stats = calculate_stats(bytes_processed, time_seconds, operations);
+    size_t last = num_elements - 1;
+    stats.verified = (passes == 0) ||
+                     (element_ok(a[0], b[0] + c[0]) && element_ok(a[last], b[last] + c[last]));
+    return stats;
 }
 
 /**
@@ -283,15 +768,14 @@ PerformanceStats copy_test(const uint8_t* src_buffer, uint8_t* dst_buffer, size_
  * Let the system handle memory access patterns naturally.
  */
 PerformanceStats triad_test(uint8_t* a_buffer, const uint8_t* b_buffer, const uint8_t* c_buffer,
-                            const uint8_t* d_buffer, size_t buffer_size, size_t start_offset,
-                            size_t end_offset, size_t iterations,
-                            const std::atomic<bool>& stop_flag) {
+                            size_t buffer_size, size_t start_offset, size_t end_offset,
+                            size_t iterations, const std::atomic<bool>& stop_flag, KernelType kernel,
+                            StorePolicy store_policy, SampleRing* samples,
+                            ColdCache::Evictor* cold, const KernelMatrix::Kernel* tuned) {
     (void)buffer_size;  // Unused
-    (void)d_buffer;     // Use scalar instead
     
-    // Align to cache line boundaries and work with doubles for realistic computation
-    size_t aligned_start = (start_offset + sizeof(double) - 1) & ~(sizeof(double) - 1);
-    size_t aligned_end = end_offset & ~(sizeof(double) - 1);
+    // Work with whole doubles for realistic computation
+    auto [aligned_start, aligned_end] = double_range(start_offset, end_offset);
     
     if (aligned_end <= aligned_start) {
         return {0.0, 0.0, 0, 0.0};
@@ -305,97 +789,886 @@ PerformanceStats triad_test(uint8_t* a_buffer, const uint8_t* b_buffer, const ui
     const double* b = reinterpret_cast<const double*>(b_buffer + aligned_start);
     const double* c = reinterpret_cast<const double*>(c_buffer + aligned_start);
     const double scalar = 3.14159;
+    const SimdKernels::StoreKernels stores = SimdKernels::get_store_kernels(kernel, store_policy);
 
-    auto start_time = std::chrono::high_resolution_clock::now();
+    ColdPasses cold_passes(cold, {{a, working_set_size}, {b, working_set_size}, {c, working_set_size}});
+    PerfCounters::region_begin();
+    auto start_time = CycleTimer::Clock::now();
+    IterationSampler sampler(samples, iterations, working_set_size * 3, num_elements, start_time);
 
+    size_t passes = 0;
     for(size_t iter = 0; iter < iterations && !stop_flag; ++iter) {
-        // Natural vectorized triad: A[i] = B[i] + scalar * C[i]
-        // Process in chunks that fit cache lines naturally
-        for(size_t i = 0; i < num_elements; i += 8) {  // 8 doubles = 64 bytes
-            size_t chunk_end = std::min(i + 8, num_elements);
-            for(size_t j = i; j < chunk_end; ++j) {
-                a[j] = b[j] + scalar * c[j];
-            }
+        if (iter > 0) cold_passes.between(sampler);
+        // A[i] = B[i] + scalar * C[i]
+        if (tuned != nullptr) {
+            tuned->triad(a, b, c, scalar, num_elements);
+        } else {
+            stores.triad(a, b, c, scalar, num_elements);
         }
+        ++passes;
         
         __sync_synchronize();
+        sampler.iteration_done();
     }
 
-    auto end_time = std::chrono::high_resolution_clock::now();
-    double time_seconds = std::chrono::duration<double>(end_time - start_time).count();
+    auto end_time = CycleTimer::Clock::now();
+    PerfCounters::region_end();
+    sampler.finish(end_time);
+    double time_seconds =
+        CycleTimer::elapsed_seconds(start_time, end_time) - cold_passes.excluded_seconds();
     
     size_t bytes_processed = working_set_size * iterations * 3;  // Read B, Read C, Write A
     size_t operations = num_elements * iterations;
 
-    return calculate_stats(bytes_processed, time_seconds, operations);
+    PerformanceStats stats = calculate_stats(bytes_processed, time_seconds, operations);
+    size_t last = num_elements - 1;
+    stats.verified = (passes == 0) || num_elements == 0 ||
+                     (triad_element_ok(a[0], b[0], c[0], scalar) &&
+                      triad_element_ok(a[last], b[last], c[last], scalar));
+    return stats;
+}
+
+/**
+ * @brief Multi-stream test - every element of R sources summed into W destinations
+ *
+ * All arrays advance together, so the prefetchers and the memory controller
+ * see R + W concurrent sequential streams, as a columnar scan over R input
+ * and W output columns does.
+ */
+PerformanceStats streams_test(const std::vector<const uint8_t*>& src_buffers,
+                              const std::vector<uint8_t*>& dst_buffers, size_t buffer_size,
+                              size_t start_offset, size_t end_offset, size_t iterations,
+                              const std::atomic<bool>& stop_flag, KernelType kernel,
+                              SampleRing* samples) {
+    (void)buffer_size;  // Unused
+
+    auto [aligned_start, aligned_end] = double_range(start_offset, end_offset);
+    if (aligned_end <= aligned_start || (src_buffers.empty() && dst_buffers.empty())) {
+        return {0.0, 0.0, 0, 0.0};
+    }
+
+    size_t working_set_size = aligned_end - aligned_start;
+    size_t num_elements = working_set_size / sizeof(double);
+    size_t arrays = src_buffers.size() + dst_buffers.size();
+    std::vector<const double*> src;
+    std::vector<double*> dst;
+    for (const uint8_t* buffer : src_buffers) {
+        src.push_back(reinterpret_cast<const double*>(buffer + aligned_start));
+    }
+    for (uint8_t* buffer : dst_buffers) {
+        dst.push_back(reinterpret_cast<double*>(buffer + aligned_start));
+    }
+    const double fill = 3.14159;
+    const SimdKernels::KernelSet& kernels = SimdKernels::get_kernel_set(kernel);
+
+    // Read-only streams carry their sum across iterations, like sequential_read_test
+    double checksum = 0.0;
+
+    PerfCounters::region_begin();
+    auto start_time = CycleTimer::Clock::now();
+    IterationSampler sampler(samples, iterations, working_set_size * arrays, num_elements, start_time);
+
+    size_t passes = 0;
+    for(size_t iter = 0; iter < iterations && !stop_flag; ++iter) {
+        checksum += kernels.streams(dst.data(), dst.size(), src.data(), src.size(), fill, num_elements);
+        ++passes;
+
+        __sync_synchronize();
+        sampler.iteration_done();
+    }
+
+    auto end_time = CycleTimer::Clock::now();
+    PerfCounters::region_end();
+    sampler.finish(end_time);
+    double time_seconds = CycleTimer::elapsed_seconds(start_time, end_time);
+
+    volatile double sink = checksum;
+    (void)sink;
+
+    size_t bytes_processed = working_set_size * iterations * arrays;  // R reads + W writes
+    size_t operations = num_elements * iterations;
+
+    PerformanceStats stats = calculate_stats(bytes_processed, time_seconds, operations);
+    if (passes == 0) {
+        return stats;
+    }
+    if (dst.empty()) {
+        // Vector lanes sum in a different order than the scalar reference
+        double expected = SimdKernels::get_kernel_set(KernelType::SCALAR)
+                              .streams(nullptr, 0, src.data(), src.size(), fill, num_elements) * passes;
+        stats.verified = element_ok(checksum, expected, 1e-6);
+        return stats;
+    }
+    for (size_t index : {size_t{0}, num_elements - 1}) {
+        double expected = src.empty() ? fill : src[0][index];
+        for (size_t r = 1; r < src.size(); ++r) {
+            expected += src[r][index];
+        }
+        for (const double* array : dst) {
+            stats.verified = stats.verified && element_ok(array[index], expected);
+        }
+    }
+    return stats;
+}
+
+namespace {
+
+/**
+ * @brief Sum of one strided pass, four independent accumulators
+ */
+template <size_t ELEMENT, bool PREFETCH>
+uint64_t strided_sum(const uint8_t* data, size_t accesses, size_t stride, size_t distance) {
+    auto load = [](const uint8_t* p) -> uint64_t {
+        if constexpr (ELEMENT == 4) {
+            return *reinterpret_cast<const uint32_t*>(p);
+        } else if constexpr (ELEMENT == 8) {
+            return *reinterpret_cast<const uint64_t*>(p);
+        } else {
+            const uint64_t* w = reinterpret_cast<const uint64_t*>(p);
+            return (w[0] + w[1]) + (w[2] + w[3]) + (w[4] + w[5]) + (w[6] + w[7]);
+        }
+    };
+
+    uint64_t s0 = 0, s1 = 0, s2 = 0, s3 = 0;
+    size_t i = 0;
+    for (; i + 4 <= accesses; i += 4) {
+        if constexpr (PREFETCH) {
+            // Prefetches never fault, so the last distance bytes need no bounds check
+            for (size_t k = 0; k < 4; ++k) {
+                __builtin_prefetch(reinterpret_cast<const void*>(
+                                       reinterpret_cast<uintptr_t>(data + (i + k) * stride) + distance),
+                                   0, 3);
+            }
+        }
+        s0 += load(data + i * stride);
+        s1 += load(data + (i + 1) * stride);
+        s2 += load(data + (i + 2) * stride);
+        s3 += load(data + (i + 3) * stride);
+    }
+    for (; i < accesses; ++i) {
+        s0 += load(data + i * stride);
+    }
+    return s0 + s1 + s2 + s3;
+}
+
+template <bool PREFETCH>
+uint64_t strided_pass_impl(const uint8_t* data, size_t accesses, size_t stride, size_t element_bytes,
+                           size_t distance) {
+    switch (element_bytes) {
+        case 4:
+            return strided_sum<4, PREFETCH>(data, accesses, stride, distance);
+        case 8:
+            return strided_sum<8, PREFETCH>(data, accesses, stride, distance);
+        default:
+            return strided_sum<64, PREFETCH>(data, accesses, stride, distance);
+    }
+}
+
+uint64_t strided_pass(const uint8_t* data, size_t accesses, size_t stride, size_t element_bytes,
+                      size_t distance = 0) {
+    return (distance > 0) ? strided_pass_impl<true>(data, accesses, stride, element_bytes, distance)
+                          : strided_pass_impl<false>(data, accesses, stride, element_bytes, 0);
+}
+
+bool element_landed(const uint8_t* base, uint32_t index, size_t element_bytes, uint64_t pattern) {
+    const uint8_t* element = base + static_cast<size_t>(index) * element_bytes;
+    if (element_bytes == 4) {
+        uint32_t value;
+        std::memcpy(&value, element, sizeof(value));
+        return value == static_cast<uint32_t>(pattern);
+    }
+    return stores_landed(element, element_bytes, pattern);
+}
+
+}  // namespace
+
+/**
+ * @brief Strided read test - element loads at a fixed stride
+ */
+PerformanceStats strided_read_test(const uint8_t* buffer, size_t buffer_size, size_t start_offset,
+                                   size_t end_offset, size_t iterations,
+                                   const std::atomic<bool>& stop_flag,
+                                   const AccessPatterns::AccessConfig& access_config,
+                                   SampleRing* samples, AccessPatterns::LineTraffic* traffic,
+                                   size_t prefetch_distance) {
+    (void)buffer_size;  // Unused
+
+    auto [aligned_start, aligned_end] = MemoryUtils::align_to_cache_lines(start_offset, end_offset, DEFAULT_CACHE_LINE_SIZE);
+    if (aligned_end <= aligned_start) {
+        return {0.0, 0.0, 0, 0.0};
+    }
+
+    size_t working_set_size = aligned_end - aligned_start;
+    const size_t element_bytes = access_config.element_bytes;
+    const size_t stride = access_config.stride_bytes;
+    size_t accesses = AccessPatterns::strided_accesses(working_set_size, stride, element_bytes);
+    if (accesses == 0) {
+        return {0.0, 0.0, 0, 0.0};
+    }
+    const uint8_t* data = buffer + aligned_start;
+
+    uint64_t checksum = 0;
+    PerfCounters::region_begin();
+    auto start_time = CycleTimer::Clock::now();
+    IterationSampler sampler(samples, iterations, accesses * element_bytes, accesses, start_time);
+
+    size_t passes = 0;
+    for(size_t iter = 0; iter < iterations && !stop_flag; ++iter) {
+        checksum += strided_pass(data, accesses, stride, element_bytes, prefetch_distance);
+        ++passes;
+
+        __sync_synchronize();
+        sampler.iteration_done();
+    }
+
+    auto end_time = CycleTimer::Clock::now();
+    PerfCounters::region_end();
+    sampler.finish(end_time);
+    double time_seconds = CycleTimer::elapsed_seconds(start_time, end_time);
+
+    volatile uint64_t sink = checksum;
+    (void)sink;
+
+    size_t bytes_processed = accesses * element_bytes * iterations;
+    size_t operations = accesses * iterations;
+    if (traffic != nullptr) {
+        AccessPatterns::LineTraffic pass = AccessPatterns::strided_traffic(working_set_size, stride, element_bytes);
+        *traffic = {pass.line_bytes * iterations, pass.used_bytes * iterations};
+    }
+
+    PerformanceStats stats = calculate_stats(bytes_processed, time_seconds, operations);
+    stats.verified = (checksum == strided_pass(data, accesses, stride, element_bytes) * passes);
+    return stats;
+}
+
+/**
+ * @brief Gather/scatter test - element accesses at precomputed indices
+ *
+ * Indices are seeded from the range offset, so every thread draws its own
+ * list and repeated runs see the same one.
+ */
+PerformanceStats gather_test(uint8_t* buffer, size_t buffer_size, size_t start_offset, size_t end_offset,
+                             size_t iterations, bool is_write, const std::atomic<bool>& stop_flag,
+                             const AccessPatterns::AccessConfig& access_config, KernelType kernel,
+                             SampleRing* samples, AccessPatterns::LineTraffic* traffic) {
+    (void)buffer_size;  // Unused
+
+    auto [aligned_start, aligned_end] = MemoryUtils::align_to_cache_lines(start_offset, end_offset, DEFAULT_CACHE_LINE_SIZE);
+    if (aligned_end <= aligned_start) {
+        return {0.0, 0.0, 0, 0.0};
+    }
+
+    size_t working_set_size = aligned_end - aligned_start;
+    const size_t element_bytes = access_config.element_bytes;
+    size_t count = std::min(working_set_size / DEFAULT_CACHE_LINE_SIZE, AccessPatterns::MAX_INDICES_PER_PASS);
+    std::vector<uint32_t> indices = AccessPatterns::build_indices(
+        working_set_size / element_bytes, count, access_config,
+        static_cast<uint64_t>(aligned_start) ^ BenchmarkConstants::TEST_PATTERN_BASE);
+    if (indices.empty()) {
+        return {0.0, 0.0, 0, 0.0};
+    }
+
+    uint8_t* base = buffer + aligned_start;
+    const SimdKernels::KernelSet& kernels = SimdKernels::get_kernel_set(kernel);
+    uint64_t checksum = 0;
+    uint64_t last_pattern = 0;
+
+    PerfCounters::region_begin();
+    auto start_time = CycleTimer::Clock::now();
+    IterationSampler sampler(samples, iterations, count * element_bytes, count, start_time);
+
+    size_t passes = 0;
+    for(size_t iter = 0; iter < iterations && !stop_flag; ++iter) {
+        if (is_write) {
+            last_pattern = BenchmarkConstants::TEST_PATTERN_BASE + iter;
+            kernels.scatter(base, indices.data(), count, element_bytes, last_pattern);
+        } else {
+            checksum += kernels.gather(base, indices.data(), count, element_bytes);
+        }
+        ++passes;
+
+        __sync_synchronize();
+        sampler.iteration_done();
+    }
+
+    auto end_time = CycleTimer::Clock::now();
+    PerfCounters::region_end();
+    sampler.finish(end_time);
+    double time_seconds = CycleTimer::elapsed_seconds(start_time, end_time);
+
+    volatile uint64_t sink = checksum;
+    (void)sink;
+
+    size_t bytes_processed = count * element_bytes * iterations;
+    size_t operations = count * iterations;
+    if (traffic != nullptr) {
+        AccessPatterns::LineTraffic pass = AccessPatterns::count_traffic(indices, element_bytes);
+        *traffic = {pass.line_bytes * iterations, pass.used_bytes * iterations};
+    }
+
+    PerformanceStats stats = calculate_stats(bytes_processed, time_seconds, operations);
+    if (passes > 0) {
+        if (is_write) {
+            stats.verified = element_landed(base, indices.front(), element_bytes, last_pattern) &&
+                             element_landed(base, indices.back(), element_bytes, last_pattern);
+        } else {
+            // Untimed scalar pass: the reference for a hardware gather
+            const SimdKernels::KernelSet& scalar = SimdKernels::get_kernel_set(KernelType::SCALAR);
+            stats.verified = (checksum == scalar.gather(base, indices.data(), count, element_bytes) * passes);
+        }
+    }
+    return stats;
+}
+
+PerformanceStats decode_scan_test(const uint8_t* buffer, size_t buffer_size, size_t start_offset,
+                                  size_t end_offset, size_t iterations, const std::atomic<bool>& stop_flag,
+                                  EncodedScans::Encoding encoding, unsigned bits, KernelType kernel,
+                                  SampleRing* samples) {
+    (void)buffer_size;  // Unused
+
+    // Whole groups, counted from the start of the buffer so slices tile one column
+    const size_t group = EncodedScans::group_bytes(bits);
+    if (group == 0) {
+        return {0.0, 0.0, 0, 0.0};
+    }
+    size_t aligned_start = (start_offset + group - 1) / group * group;
+    size_t aligned_end = end_offset / group * group;
+    if (aligned_end <= aligned_start) {
+        return {0.0, 0.0, 0, 0.0};
+    }
+
+    size_t packed_bytes = aligned_end - aligned_start;
+    size_t count = packed_bytes / group * EncodedScans::GROUP_VALUES;
+    const uint8_t* packed = buffer + aligned_start;
+    std::vector<uint64_t> dictionary;
+    if (encoding == EncodedScans::Encoding::DICTIONARY) {
+        dictionary = EncodedScans::build_dictionary(bits, BenchmarkConstants::TEST_PATTERN_BASE);
+    }
+
+    // One pass of the selected (or scalar) decoder; deltas restart from zero every pass
+    auto decode = [&](const SimdKernels::KernelSet& kernels) -> uint64_t {
+        switch (encoding) {
+            case EncodedScans::Encoding::DELTA: {
+                uint32_t base = 0;
+                return kernels.delta(packed, count, bits, base);
+            }
+            case EncodedScans::Encoding::DICTIONARY:
+                return kernels.dict(packed, count, bits, dictionary.data());
+            case EncodedScans::Encoding::BITPACK:
+            default:
+                return kernels.unpack(packed, count, bits);
+        }
+    };
+    const SimdKernels::KernelSet& kernels = SimdKernels::get_kernel_set(kernel);
+    uint64_t checksum = 0;
+
+    PerfCounters::region_begin();
+    auto start_time = CycleTimer::Clock::now();
+    IterationSampler sampler(samples, iterations, packed_bytes, count, start_time);
+
+    size_t passes = 0;
+    for(size_t iter = 0; iter < iterations && !stop_flag; ++iter) {
+        checksum += decode(kernels);
+        ++passes;
+
+        __sync_synchronize();
+        sampler.iteration_done();
+    }
+
+    auto end_time = CycleTimer::Clock::now();
+    PerfCounters::region_end();
+    sampler.finish(end_time);
+    double time_seconds = CycleTimer::elapsed_seconds(start_time, end_time);
+
+    volatile uint64_t sink = checksum;
+    (void)sink;
+
+    size_t bytes_processed = packed_bytes * iterations;
+    size_t operations = count * iterations;
+
+    // Untimed scalar pass: a vector decoder that dropped or misplaced a value cannot reproduce the sum
+    PerformanceStats stats = calculate_stats(bytes_processed, time_seconds, operations);
+    if (passes > 0) {
+        stats.verified = (checksum == decode(SimdKernels::get_kernel_set(KernelType::SCALAR)) * passes);
+    }
+    return stats;
+}
+
+namespace {
+
+// Slice trimmed to whole cache lines: tables and key columns start on a line
+std::pair<size_t, size_t> line_slice(size_t start_offset, size_t end_offset) {
+    size_t aligned_start = (start_offset + DEFAULT_CACHE_LINE_SIZE - 1) / DEFAULT_CACHE_LINE_SIZE *
+                           DEFAULT_CACHE_LINE_SIZE;
+    size_t aligned_end = end_offset / DEFAULT_CACHE_LINE_SIZE * DEFAULT_CACHE_LINE_SIZE;
+    return {aligned_start, std::max(aligned_start, aligned_end)};
+}
+
+}  // namespace
+
+PerformanceStats hash_probe_test(uint8_t* buffer, size_t buffer_size, size_t start_offset, size_t end_offset,
+                                 size_t iterations, const std::atomic<bool>& stop_flag,
+                                 const ProxyKernels::Config& config, SampleRing* samples) {
+    (void)buffer_size;  // Unused
+
+    auto [aligned_start, aligned_end] = line_slice(start_offset, end_offset);
+    ProxyKernels::Table table =
+        ProxyKernels::table_layout(buffer + aligned_start, aligned_end - aligned_start, config.probe);
+    if (table.capacity == 0) {
+        return {0.0, 0.0, 0, 0.0};
+    }
+    ProxyKernels::build(table, config.probe, config.load_factor);
+    const size_t lookups = table.keys;
+    if (lookups == 0) {
+        return {0.0, 0.0, 0, 0.0};
+    }
+    const size_t pass_bytes = lookups * ProxyKernels::LOOKUP_BYTES;
+    bool all_found = true;
+    uint64_t checksum = 0;
+
+    PerfCounters::region_begin();
+    auto start_time = CycleTimer::Clock::now();
+    IterationSampler sampler(samples, iterations, pass_bytes, lookups, start_time);
+
+    size_t passes = 0;
+    for(size_t iter = 0; iter < iterations && !stop_flag; ++iter) {
+        ProxyKernels::ProbeResult result =
+            ProxyKernels::probe_pass(table, config.probe, lookups, config.batch, iter * lookups);
+        all_found &= (result.found == lookups && result.value_sum == result.expected_sum);
+        checksum += result.value_sum;
+        ++passes;
+
+        __sync_synchronize();
+        sampler.iteration_done();
+    }
+
+    auto end_time = CycleTimer::Clock::now();
+    PerfCounters::region_end();
+    sampler.finish(end_time);
+    double time_seconds = CycleTimer::elapsed_seconds(start_time, end_time);
+
+    volatile uint64_t sink = checksum;
+    (void)sink;
+
+    PerformanceStats stats = calculate_stats(pass_bytes * iterations, time_seconds, lookups * iterations);
+    if (passes > 0) {
+        stats.verified = all_found;
+    }
+    return stats;
+}
+
+PerformanceStats radix_partition_test(uint8_t* src_buffer, uint8_t* dst_buffer, size_t buffer_size,
+                                      size_t start_offset, size_t end_offset, size_t iterations,
+                                      const std::atomic<bool>& stop_flag, SampleRing* samples) {
+    (void)buffer_size;  // Unused
+
+    auto [aligned_start, aligned_end] = line_slice(start_offset, end_offset);
+    const size_t count = (aligned_end - aligned_start) / sizeof(uint64_t);
+    if (count == 0) {
+        return {0.0, 0.0, 0, 0.0};
+    }
+    uint64_t* src = reinterpret_cast<uint64_t*>(src_buffer + aligned_start);
+    uint64_t* dst = reinterpret_cast<uint64_t*>(dst_buffer + aligned_start);
+    ProxyKernels::fill_random_keys(src, count, BenchmarkConstants::TEST_PATTERN_BASE + aligned_start);
+    const size_t pass_bytes = count * ProxyKernels::PARTITION_BYTES_PER_KEY;
+    constexpr unsigned DIGITS = 64 / ProxyKernels::RADIX_BITS;
+
+    PerfCounters::region_begin();
+    auto start_time = CycleTimer::Clock::now();
+    IterationSampler sampler(samples, iterations, pass_bytes, count, start_time);
+
+    // Each pass partitions on the next digit, as the passes of an LSD radix sort do
+    size_t passes = 0;
+    for(size_t iter = 0; iter < iterations && !stop_flag; ++iter) {
+        ProxyKernels::partition_pass(src, dst, count, static_cast<unsigned>(iter % DIGITS) * ProxyKernels::RADIX_BITS);
+        ++passes;
+
+        __sync_synchronize();
+        sampler.iteration_done();
+    }
+
+    auto end_time = CycleTimer::Clock::now();
+    PerfCounters::region_end();
+    sampler.finish(end_time);
+    double time_seconds = CycleTimer::elapsed_seconds(start_time, end_time);
+
+    PerformanceStats stats = calculate_stats(pass_bytes * iterations, time_seconds, count * iterations);
+    if (passes > 0) {
+        unsigned shift = static_cast<unsigned>((passes - 1) % DIGITS) * ProxyKernels::RADIX_BITS;
+        stats.verified = ProxyKernels::is_partitioned(src, dst, count, shift);
+    }
+    return stats;
+}
+
+PerformanceStats merge_test(uint8_t* src_buffer, uint8_t* dst_buffer, size_t buffer_size, size_t start_offset,
+                            size_t end_offset, size_t iterations, const std::atomic<bool>& stop_flag,
+                            const ProxyKernels::Config& config, SampleRing* samples) {
+    (void)buffer_size;  // Unused
+
+    auto [aligned_start, aligned_end] = line_slice(start_offset, end_offset);
+    uint64_t* src = reinterpret_cast<uint64_t*>(src_buffer + aligned_start);
+    uint64_t* dst = reinterpret_cast<uint64_t*>(dst_buffer + aligned_start);
+    const size_t count = ProxyKernels::fill_sorted_runs(src, (aligned_end - aligned_start) / sizeof(uint64_t),
+                                                        config.merge_ways,
+                                                        BenchmarkConstants::TEST_PATTERN_BASE + aligned_start);
+    if (count == 0) {
+        return {0.0, 0.0, 0, 0.0};
+    }
+    const size_t pass_bytes = count * ProxyKernels::MERGE_BYTES_PER_KEY;
+
+    PerfCounters::region_begin();
+    auto start_time = CycleTimer::Clock::now();
+    IterationSampler sampler(samples, iterations, pass_bytes, count, start_time);
+
+    size_t passes = 0;
+    for(size_t iter = 0; iter < iterations && !stop_flag; ++iter) {
+        ProxyKernels::merge_pass(src, dst, count, config.merge_ways);
+        ++passes;
+
+        __sync_synchronize();
+        sampler.iteration_done();
+    }
+
+    auto end_time = CycleTimer::Clock::now();
+    PerfCounters::region_end();
+    sampler.finish(end_time);
+    double time_seconds = CycleTimer::elapsed_seconds(start_time, end_time);
+
+    PerformanceStats stats = calculate_stats(pass_bytes * iterations, time_seconds, count * iterations);
+    if (passes > 0) {
+        stats.verified = ProxyKernels::is_merged(src, dst, count);
+    }
+    return stats;
+}
+
+PerformanceStats spmv_test(uint8_t* buffer, size_t buffer_size, size_t start_offset, size_t end_offset,
+                           size_t iterations, const std::atomic<bool>& stop_flag, bool sell,
+                           const IrregularKernels::Config& config, SampleRing* samples,
+                           IrregularKernels::Work* work) {
+    (void)buffer_size;  // Unused
+
+    auto [aligned_start, aligned_end] = line_slice(start_offset, end_offset);
+    uint8_t* base = buffer + aligned_start;
+    size_t bytes = aligned_end - aligned_start;
+    uint64_t seed = BenchmarkConstants::TEST_PATTERN_BASE + aligned_start;
+    IrregularKernels::Csr csr;
+    IrregularKernels::Sell sell_matrix;
+    if (sell) {
+        sell_matrix = IrregularKernels::build_sell(base, bytes, config, seed);
+    } else {
+        csr = IrregularKernels::build_csr(base, bytes, config, seed);
+    }
+    const IrregularKernels::MatrixSpec& spec = sell ? sell_matrix.spec : csr.spec;
+    if (spec.rows == 0) {
+        return {0.0, 0.0, 0, 0.0};
+    }
+    const size_t nonzeros = sell ? sell_matrix.nonzeros : csr.nonzeros;
+    const size_t pass_bytes = IrregularKernels::spmv_bytes(spec.rows, nonzeros);
+
+    PerfCounters::region_begin();
+    auto start_time = CycleTimer::Clock::now();
+    IterationSampler sampler(samples, iterations, pass_bytes, nonzeros, start_time);
+
+    size_t passes = 0;
+    for(size_t iter = 0; iter < iterations && !stop_flag; ++iter) {
+        if (sell) {
+            IrregularKernels::spmv_sell(sell_matrix);
+        } else {
+            IrregularKernels::spmv_csr(csr);
+        }
+        ++passes;
+
+        __sync_synchronize();
+        sampler.iteration_done();
+    }
+
+    auto end_time = CycleTimer::Clock::now();
+    PerfCounters::region_end();
+    sampler.finish(end_time);
+    double time_seconds = CycleTimer::elapsed_seconds(start_time, end_time);
+
+    if (work != nullptr) {
+        work->flops += nonzeros * IrregularKernels::SPMV_FLOPS_PER_NONZERO * iterations;
+        work->nonzeros += nonzeros * iterations;
+        work->stored += (sell ? sell_matrix.stored : nonzeros) * iterations;
+    }
+    PerformanceStats stats = calculate_stats(pass_bytes * iterations, time_seconds, nonzeros * iterations);
+    if (passes > 0) {
+        stats.verified = IrregularKernels::verify_spmv(spec, sell ? sell_matrix.y : csr.y);
+    }
+    return stats;
+}
+
+PerformanceStats stencil_test(uint8_t* buffer, size_t buffer_size, size_t start_offset, size_t end_offset,
+                              size_t iterations, const std::atomic<bool>& stop_flag,
+                              const IrregularKernels::Config& config, SampleRing* samples,
+                              IrregularKernels::Work* work) {
+    (void)buffer_size;  // Unused
+
+    auto [aligned_start, aligned_end] = line_slice(start_offset, end_offset);
+    IrregularKernels::Grid grid = IrregularKernels::build_grid(buffer + aligned_start, aligned_end - aligned_start,
+                                                               BenchmarkConstants::TEST_PATTERN_BASE + aligned_start);
+    if (grid.nx == 0) {
+        return {0.0, 0.0, 0, 0.0};
+    }
+    const size_t points = grid.interior();
+    const size_t pass_bytes = points * 2 * sizeof(double);
+    double* in = grid.in;
+    double* out = grid.out;
+
+    PerfCounters::region_begin();
+    auto start_time = CycleTimer::Clock::now();
+    IterationSampler sampler(samples, iterations, pass_bytes, points, start_time);
+
+    size_t passes = 0;
+    for(size_t iter = 0; iter < iterations && !stop_flag; ++iter) {
+        IrregularKernels::stencil_pass(in, out, grid.nx, grid.ny, grid.nz, config.block);
+        std::swap(in, out);
+        ++passes;
+
+        __sync_synchronize();
+        sampler.iteration_done();
+    }
+
+    auto end_time = CycleTimer::Clock::now();
+    PerfCounters::region_end();
+    sampler.finish(end_time);
+    double time_seconds = CycleTimer::elapsed_seconds(start_time, end_time);
+
+    if (work != nullptr) {
+        work->flops += points * IrregularKernels::STENCIL_FLOPS_PER_POINT * iterations;
+    }
+    // The last sweep read out and wrote in, since they swapped after it
+    PerformanceStats stats = calculate_stats(pass_bytes * iterations, time_seconds, points * iterations);
+    if (passes > 0) {
+        stats.verified = IrregularKernels::verify_stencil(out, in, grid.nx, grid.ny, grid.nz, aligned_start);
+    }
+    return stats;
+}
+
+/**
+ * @brief Throttled load for loaded latency - chunks of traffic separated by pause loops
+ *
+ * Chunks wrap around the range, so the load keeps streaming from memory for
+ * as long as the probe needs it.
+ */
+PerformanceStats throttled_load_test(const uint8_t* src_buffer, uint8_t* dst_buffer, size_t buffer_size,
+                                     size_t start_offset, size_t end_offset, TestPattern pattern,
+                                     size_t delay_spins, const std::atomic<bool>& stop_flag,
+                                     KernelType kernel, StorePolicy store_policy,
+                                     std::atomic<uint64_t>* progress) {
+    if (!MemoryUtils::validate_memory_operation(start_offset, end_offset, buffer_size, DEFAULT_CACHE_LINE_SIZE)) {
+        return {0.0, 0.0, 0, 0.0};
+    }
+
+    auto [aligned_start, aligned_end] = MemoryUtils::align_to_cache_lines(start_offset, end_offset, DEFAULT_CACHE_LINE_SIZE);
+    if (aligned_end <= aligned_start) {
+        return {0.0, 0.0, 0, 0.0};
+    }
+
+    const SimdKernels::KernelSet& kernels = SimdKernels::get_kernel_set(kernel);
+    const SimdKernels::StoreKernels stores = SimdKernels::get_store_kernels(kernel, store_policy);
+    size_t chunk = std::min(BenchmarkConstants::LOAD_CHUNK_BYTES, aligned_end - aligned_start);
+
+    uint64_t checksum = 0;
+    size_t bytes_processed = 0;
+    size_t offset = aligned_start;
+    size_t lines = (aligned_end - aligned_start) / DEFAULT_CACHE_LINE_SIZE;
+    uint64_t random_state = BenchmarkConstants::TEST_PATTERN_BASE ^ aligned_start;
+
+    PerfCounters::region_begin();
+    auto start_time = CycleTimer::Clock::now();
+
+    // At least one chunk, so a load stopped before it was scheduled still reports work
+    do {
+        size_t length = std::min(chunk, aligned_end - offset);
+        switch (pattern) {
+            case TestPattern::RANDOM_READ:
+                for (size_t n = 0; n < chunk / DEFAULT_CACHE_LINE_SIZE; ++n) {
+                    // xorshift64: the next line does not depend on the previous load
+                    random_state ^= random_state << 13;
+                    random_state ^= random_state >> 7;
+                    random_state ^= random_state << 17;
+                    size_t line = static_cast<size_t>(random_state % lines);
+                    checksum += *reinterpret_cast<const volatile uint64_t*>(
+                        src_buffer + aligned_start + line * DEFAULT_CACHE_LINE_SIZE);
+                }
+                bytes_processed += chunk;
+                break;
+            case TestPattern::SEQUENTIAL_WRITE:
+                stores.write(dst_buffer + offset, length, BenchmarkConstants::TEST_PATTERN_BASE + offset);
+                bytes_processed += length;
+                break;
+            case TestPattern::COPY:
+                stores.copy(dst_buffer + offset, src_buffer + offset, length);
+                bytes_processed += length * 2;  // Read + Write
+                break;
+            default:
+                checksum += kernels.read(src_buffer + offset, length);
+                bytes_processed += length;
+                break;
+        }
+
+        offset += length;
+        if (offset >= aligned_end) {
+            offset = aligned_start;
+        }
+        if (progress != nullptr) {
+            progress->store(bytes_processed, std::memory_order_relaxed);
+        }
+        spin_delay(delay_spins);
+    } while (!stop_flag.load(std::memory_order_relaxed));
+    memory_barrier();
+
+    auto end_time = CycleTimer::Clock::now();
+    PerfCounters::region_end();
+    double time_seconds = CycleTimer::elapsed_seconds(start_time, end_time);
+
+    volatile uint64_t sink = checksum;
+    (void)sink;
+
+    return calculate_stats(bytes_processed, time_seconds, bytes_processed / DEFAULT_CACHE_LINE_SIZE);
+}
+
+/**
+ * @brief Throttled atomic generator - relaxed fetch_add on one word per cache line
+ */
+PerformanceStats throttled_atomic_test(uint8_t* buffer, size_t buffer_size, size_t start_offset,
+                                       size_t end_offset, size_t delay_spins, const std::atomic<bool>& stop_flag) {
+    if (!MemoryUtils::validate_memory_operation(start_offset, end_offset, buffer_size, DEFAULT_CACHE_LINE_SIZE)) {
+        return {0.0, 0.0, 0, 0.0};
+    }
+
+    auto [aligned_start, aligned_end] = MemoryUtils::align_to_cache_lines(start_offset, end_offset, DEFAULT_CACHE_LINE_SIZE);
+    if (aligned_end <= aligned_start) {
+        return {0.0, 0.0, 0, 0.0};
+    }
+
+    size_t chunk_lines = BenchmarkConstants::LOAD_CHUNK_BYTES / DEFAULT_CACHE_LINE_SIZE;
+    size_t operations = 0;
+    size_t offset = aligned_start;
+
+    PerfCounters::region_begin();
+    auto start_time = CycleTimer::Clock::now();
+
+    do {
+        for (size_t n = 0; n < chunk_lines; ++n) {
+            __atomic_fetch_add(reinterpret_cast<uint64_t*>(buffer + offset), 1, __ATOMIC_RELAXED);
+            offset += DEFAULT_CACHE_LINE_SIZE;
+            if (offset >= aligned_end) {
+                offset = aligned_start;
+            }
+        }
+        operations += chunk_lines;
+        spin_delay(delay_spins);
+    } while (!stop_flag.load(std::memory_order_relaxed));
+    memory_barrier();
+
+    auto end_time = CycleTimer::Clock::now();
+    PerfCounters::region_end();
+    double time_seconds = CycleTimer::elapsed_seconds(start_time, end_time);
+
+    return calculate_stats(operations * DEFAULT_CACHE_LINE_SIZE, time_seconds, operations);
+}
+
+/**
+ * @brief Roofline kernel - in-place FP64 updates with a fixed FLOP count per element
+ */
+PerformanceStats arithmetic_intensity_test(uint8_t* buffer, size_t buffer_size, size_t start_offset,
+                                           size_t end_offset, size_t iterations, size_t flops_per_element,
+                                           const std::atomic<bool>& stop_flag) {
+    (void)buffer_size;  // Unused
+
+    IntensityPass pass = intensity_pass_for(flops_per_element);
+    if (!pass) {
+        throw TestError("Unsupported roofline FLOP count per element: " + std::to_string(flops_per_element));
+    }
+
+    size_t aligned_start = (start_offset + sizeof(double) - 1) & ~(sizeof(double) - 1);
+    size_t aligned_end = end_offset & ~(sizeof(double) - 1);
+    if (aligned_end <= aligned_start) {
+        return {0.0, 0.0, 0, 0.0};
+    }
+
+    size_t num_elements = (aligned_end - aligned_start) / sizeof(double);
+    double* a = reinterpret_cast<double*>(buffer + aligned_start);
+
+    PerfCounters::region_begin();
+    auto start_time = CycleTimer::Clock::now();
+    size_t passes = 0;
+    for (size_t iter = 0; iter < iterations && !stop_flag; ++iter) {
+        pass(a, num_elements);
+        ++passes;
+        memory_barrier();
+    }
+    auto end_time = CycleTimer::Clock::now();
+    PerfCounters::region_end();
+    double time_seconds = CycleTimer::elapsed_seconds(start_time, end_time);
+
+    size_t bytes_processed = num_elements * BenchmarkConstants::ROOFLINE_BYTES_PER_ELEMENT * passes;
+    return calculate_stats(bytes_processed, time_seconds, num_elements * passes);
 }
 
 /**
  * @brief Matrix multiplication test using platform-specific hardware acceleration
  */
-MatrixMultiply::MatrixPerformanceStats matrix_multiply_test(
+namespace {
+
+MatrixMultiply::MatrixPerformanceStats run_matrix_multiply(
+    void* C, const void* A, const void* B,
     const MatrixMultiply::MatrixConfig& matrix_config,
+    MatrixMultiply::MatrixMultiplier* multiplier,
+    const CacheInfo& cache_info,
     const std::atomic<bool>& stop_flag) {
-    
-    // Use platform-specific matrix multiplier
-    auto platform = create_platform_interface();
-    auto multiplier = platform->create_matrix_multiplier();
-    
+    using MatrixMultiply::MatrixPrecision;
+    using MatrixMultiply::BlockedGemm::portable_multiply;
+
     if (multiplier && multiplier->is_available()) {
-        const size_t M = matrix_config.M;
-        const size_t K = matrix_config.K;
-        const size_t N = matrix_config.N;
-        
-        // Allocate matrices
-        std::vector<float> A(M * K);
-        std::vector<float> B(K * N);
-        std::vector<float> C(M * N);
-        
-        // Initialize matrices with random data
-        MatrixMultiply::initialize_matrix_random(A.data(), M, K, 1.0f);
-        MatrixMultiply::initialize_matrix_random(B.data(), K, N, 1.0f);
-        
-        return multiplier->multiply_float(C.data(), A.data(), B.data(), matrix_config, stop_flag);
+        return multiplier->multiply(C, A, B, matrix_config, stop_flag);
     }
-    
-    // Fallback implementation for platforms without optimized matrix multiplication
-    const size_t M = matrix_config.M;
-    const size_t K = matrix_config.K;
-    const size_t N = matrix_config.N;
-    
-    // Allocate matrices
-    std::vector<float> A(M * K);
-    std::vector<float> B(K * N);
-    std::vector<float> C(M * N);
-    
-    // Initialize matrices with random data
-    MatrixMultiply::initialize_matrix_random(A.data(), M, K, 1.0f);
-    MatrixMultiply::initialize_matrix_random(B.data(), K, N, 1.0f);
-    
-    // Clear result matrix
-    std::memset(C.data(), 0, M * N * sizeof(float));
-    
-    auto start_time = std::chrono::high_resolution_clock::now();
-    
-    // Simple matrix multiplication fallback
-    for (size_t iter = 0; iter < matrix_config.iterations && !stop_flag; ++iter) {
-        for (size_t i = 0; i < M; ++i) {
-            for (size_t k = 0; k < K; ++k) {
-                float a_ik = A[i * K + k];
-                for (size_t j = 0; j < N; ++j) {
-                    C[i * N + j] += a_ik * B[k * N + j];
-                }
-            }
-        }
+
+    // Portable fallback: the same packed, cache-blocked driver as the SIMD
+    // backends with a compiler-vectorized micro-kernel
+    MatrixPrecision precision = matrix_config.use_double ? MatrixPrecision::FP64 : matrix_config.precision;
+    std::string converted = MatrixMultiply::converted_acceleration_name(PORTABLE_GEMM_NAME, precision);
+    switch (precision) {
+        case MatrixPrecision::FP64:
+            return portable_multiply(static_cast<double*>(C), static_cast<const double*>(A),
+                                     static_cast<const double*>(B), matrix_config, stop_flag, cache_info,
+                                     PORTABLE_GEMM_NAME);
+        case MatrixPrecision::BF16:
+            return portable_multiply(static_cast<float*>(C), static_cast<const MatrixMultiply::BFloat16*>(A),
+                                     static_cast<const MatrixMultiply::BFloat16*>(B), matrix_config, stop_flag,
+                                     cache_info, converted);
+        case MatrixPrecision::FP16:
+            return portable_multiply(static_cast<float*>(C), static_cast<const MatrixMultiply::Float16*>(A),
+                                     static_cast<const MatrixMultiply::Float16*>(B), matrix_config, stop_flag,
+                                     cache_info, converted);
+        case MatrixPrecision::INT8:
+            return portable_multiply(static_cast<int32_t*>(C), static_cast<const int8_t*>(A),
+                                     static_cast<const int8_t*>(B), matrix_config, stop_flag, cache_info,
+                                     converted);
+        default:
+            return portable_multiply(static_cast<float*>(C), static_cast<const float*>(A),
+                                     static_cast<const float*>(B), matrix_config, stop_flag, cache_info,
+                                     PORTABLE_GEMM_NAME);
     }
-    
-    auto end_time = std::chrono::high_resolution_clock::now();
-    double time_seconds = std::chrono::duration<double>(end_time - start_time).count();
-    
-    size_t operations = 2 * M * N * K * matrix_config.iterations;
-    size_t bytes_processed = (M * K + K * N + M * N) * sizeof(float) * matrix_config.iterations;
-    
-    return MatrixMultiply::calculate_matrix_stats(bytes_processed, time_seconds, operations, "Scalar fallback");
+}
+
+}  // namespace
+
+MatrixMultiply::MatrixPerformanceStats matrix_multiply_test(
+    void* C, const void* A, const void* B,
+    const MatrixMultiply::MatrixConfig& matrix_config,
+    MatrixMultiply::MatrixMultiplier* multiplier,
+    const CacheInfo& cache_info,
+    const std::atomic<bool>& stop_flag) {
+    // Backends time themselves, so the counted region also covers clearing C
+    PerfCounters::region_begin();
+    MatrixMultiply::MatrixPerformanceStats stats =
+        run_matrix_multiply(C, A, B, matrix_config, multiplier, cache_info, stop_flag);
+    PerfCounters::region_end();
+    return stats;
 }
 
 }  // namespace StandardTests
\ No newline at end of file
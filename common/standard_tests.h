@@ -4,16 +4,33 @@
 #include <atomic>
 #include <cstddef>
 #include <cstdint>
+#include <vector>
 
 #include "test_patterns.h"
+#include "memory_types.h"
 #include "matrix_multiply_interface.h"
+#include "blocked_gemm.h"
+#include "simd_kernels.h"
+#include "pointer_chase.h"
+#include "access_patterns.h"
+#include "encoded_scans.h"
+#include "proxy_kernels.h"
+#include "irregular_kernels.h"
+#include "kernel_matrix.h"
+#include "cold_cache.h"
+
+class SampleRing;
 
 /**
  * @brief Standard memory bandwidth test routines
  *
  * This module contains implementations of standard memory bandwidth tests
- * including sequential read/write, random access, copy, and STREAM triad operations.
+ * including sequential read/write, random access, copy, the STREAM scale, add and triad
+ * operations, multi-stream passes over many arrays, and strided and gather/scatter
+ * accesses of partial cache lines.
  * These tests provide baseline memory performance measurements.
+ * Each timed region is bracketed by PerfCounters::region_begin/region_end,
+ * so hardware counters attached to the calling thread cover exactly it.
  */
 namespace StandardTests {
 
@@ -29,11 +46,21 @@ namespace StandardTests {
  * @param end_offset Ending offset within the buffer
  * @param iterations Number of iterations to perform
  * @param stop_flag Atomic flag to signal test termination
+ * @param cache_aware Whether the working set was sized for a cache level
+ * @param kernel SIMD kernel used for the inner loop (AUTO picks the widest supported)
+ * @param samples Optional ring that receives per-iteration samples (batched to its capacity)
+ * @param prefetch_distance Software prefetch this many bytes ahead (0: hardware prefetchers only)
+ * @param cold Optional evictor run before every pass, off the clock (--cold)
+ * @param tuned Optional loop shape run instead of the kernel's loop (--tune; not with a prefetch distance)
  * @return PerformanceStats containing test results
  */
 PerformanceStats sequential_read_test(const uint8_t* buffer, size_t buffer_size,
                                       size_t start_offset, size_t end_offset, size_t iterations,
-                                      const std::atomic<bool>& stop_flag, bool cache_aware = false);
+                                      const std::atomic<bool>& stop_flag, bool cache_aware = false,
+                                      KernelType kernel = KernelType::AUTO,
+                                      SampleRing* samples = nullptr, size_t prefetch_distance = 0,
+                                      ColdCache::Evictor* cold = nullptr,
+                                      const KernelMatrix::Kernel* tuned = nullptr);
 
 /**
  * @brief Sequential write test implementation
@@ -47,11 +74,21 @@ PerformanceStats sequential_read_test(const uint8_t* buffer, size_t buffer_size,
  * @param end_offset Ending offset within the buffer
  * @param iterations Number of iterations to perform
  * @param stop_flag Atomic flag to signal test termination
+ * @param kernel SIMD kernel used for the inner loop (AUTO picks the widest supported)
+ * @param store_policy Temporal, streaming or zero-allocating stores
+ * @param samples Optional ring that receives per-iteration samples (batched to its capacity)
+ * @param cold Optional evictor run before every pass, off the clock (--cold)
+ * @param tuned Optional loop shape run instead of the kernel's loop (--tune; temporal stores only)
  * @return PerformanceStats containing test results
  */
 PerformanceStats sequential_write_test(uint8_t* buffer, size_t buffer_size, size_t start_offset,
                                        size_t end_offset, size_t iterations,
-                                       const std::atomic<bool>& stop_flag);
+                                       const std::atomic<bool>& stop_flag,
+                                       KernelType kernel = KernelType::AUTO,
+                                       StorePolicy store_policy = StorePolicy::TEMPORAL,
+                                       SampleRing* samples = nullptr,
+                                       ColdCache::Evictor* cold = nullptr,
+                                       const KernelMatrix::Kernel* tuned = nullptr);
 
 /**
  * @brief Random access test implementation
@@ -67,11 +104,43 @@ PerformanceStats sequential_write_test(uint8_t* buffer, size_t buffer_size, size
  * @param iterations Number of iterations to perform
  * @param is_write Whether to perform write (true) or read (false) operations
  * @param stop_flag Atomic flag to signal test termination
+ * @param samples Optional ring that receives per-iteration samples (batched to its capacity)
+ * @param prefetch_distance Software prefetch the line visited prefetch_distance / 64 lines later
+ *        (0: none); the visit order is fixed before timing, so the prefetch address is known
+ * @param cold Optional evictor run before every pass, off the clock (--cold)
  * @return PerformanceStats containing test results
  */
 PerformanceStats random_access_test(uint8_t* buffer, size_t buffer_size, size_t start_offset,
                                     size_t end_offset, size_t iterations, bool is_write,
-                                    const std::atomic<bool>& stop_flag);
+                                    const std::atomic<bool>& stop_flag, SampleRing* samples = nullptr,
+                                    size_t prefetch_distance = 0,
+                                    ColdCache::Evictor* cold = nullptr);
+
+/**
+ * @brief Pointer-chasing latency test implementation
+ *
+ * Links the range into a cyclic chain of cache lines and times a serial
+ * chain of dependent loads. Unlike random_access_test, no two loads can be
+ * in flight at once, so latency_ns is load-to-use latency per hop for the
+ * cache level (or DRAM) the range fits in.
+ *
+ * @param buffer Pointer to the memory buffer (the chain overwrites the range)
+ * @param buffer_size Size of the buffer in bytes
+ * @param start_offset Starting offset within the buffer
+ * @param end_offset Ending offset within the buffer
+ * @param iterations Number of timed passes (each pass is at least MIN_CHASE_HOPS hops)
+ * @param stop_flag Atomic flag to signal test termination
+ * @param chase_config Chain layout (random, page-local or strided)
+ * @param samples Optional ring that receives per-iteration samples (batched to its capacity)
+ * @param cold Optional evictor run before every pass, off the clock (--cold)
+ * @return PerformanceStats with latency_ns in nanoseconds per hop
+ */
+PerformanceStats latency_chase_test(uint8_t* buffer, size_t buffer_size, size_t start_offset,
+                                    size_t end_offset, size_t iterations,
+                                    const std::atomic<bool>& stop_flag,
+                                    const PointerChase::ChaseConfig& chase_config = {},
+                                    SampleRing* samples = nullptr,
+                                    ColdCache::Evictor* cold = nullptr);
 
 /**
  * @brief Memory copy test implementation
@@ -87,49 +156,435 @@ PerformanceStats random_access_test(uint8_t* buffer, size_t buffer_size, size_t
  * @param end_offset Ending offset within the buffers
  * @param iterations Number of iterations to perform
  * @param stop_flag Atomic flag to signal test termination
+ * @param kernel SIMD kernel used for the inner loop (AUTO picks the widest supported)
+ * @param store_policy Temporal, streaming or zero-allocating stores
+ * @param samples Optional ring that receives per-iteration samples (batched to its capacity)
+ * @param cold Optional evictor run before every pass, off the clock (--cold)
  * @return PerformanceStats containing test results
  */
 PerformanceStats copy_test(const uint8_t* src_buffer, uint8_t* dst_buffer, size_t buffer_size,
                            size_t start_offset, size_t end_offset, size_t iterations,
-                           const std::atomic<bool>& stop_flag);
+                           const std::atomic<bool>& stop_flag,
+                           KernelType kernel = KernelType::AUTO,
+                           StorePolicy store_policy = StorePolicy::TEMPORAL,
+                           SampleRing* samples = nullptr,
+                           ColdCache::Evictor* cold = nullptr);
+
+/**
+ * @brief STREAM Scale test implementation
+ *
+ * Performs STREAM Scale operation: A[i] = scalar * B[i], counted as two
+ * arrays of traffic like copy. Always uses temporal stores.
+ *
+ * @param a_buffer Pointer to buffer A (destination)
+ * @param b_buffer Pointer to buffer B (source)
+ * @param buffer_size Size of the buffers in bytes
+ * @param start_offset Starting offset within the buffers
+ * @param end_offset Ending offset within the buffers
+ * @param iterations Number of iterations to perform
+ * @param stop_flag Atomic flag to signal test termination
+ * @param kernel SIMD kernel used for the inner loop (AUTO picks the widest supported)
+ * @param samples Optional ring that receives per-iteration samples (batched to its capacity)
+ * @param cold Optional evictor run before every pass, off the clock (--cold)
+ * @return PerformanceStats containing test results
+ */
+PerformanceStats scale_test(uint8_t* a_buffer, const uint8_t* b_buffer, size_t buffer_size,
+                            size_t start_offset, size_t end_offset, size_t iterations,
+                            const std::atomic<bool>& stop_flag,
+                            KernelType kernel = KernelType::AUTO,
+                            SampleRing* samples = nullptr,
+                            ColdCache::Evictor* cold = nullptr);
+
+/**
+ * @brief STREAM Add test implementation
+ *
+ * Performs STREAM Add operation: A[i] = B[i] + C[i], counted as three
+ * arrays of traffic like triad. Always uses temporal stores.
+ *
+ * @param a_buffer Pointer to buffer A (destination)
+ * @param b_buffer Pointer to buffer B (source)
+ * @param c_buffer Pointer to buffer C (source)
+ * @param buffer_size Size of the buffers in bytes
+ * @param start_offset Starting offset within the buffers
+ * @param end_offset Ending offset within the buffers
+ * @param iterations Number of iterations to perform
+ * @param stop_flag Atomic flag to signal test termination
+ * @param kernel SIMD kernel used for the inner loop (AUTO picks the widest supported)
+ * @param samples Optional ring that receives per-iteration samples (batched to its capacity)
+ * @param cold Optional evictor run before every pass, off the clock (--cold)
+ * @return PerformanceStats containing test results
+ */
+PerformanceStats add_test(uint8_t* a_buffer, const uint8_t* b_buffer, const uint8_t* c_buffer,
+                          size_t buffer_size, size_t start_offset, size_t end_offset,
+                          size_t iterations, const std::atomic<bool>& stop_flag,
+                          KernelType kernel = KernelType::AUTO,
+                          SampleRing* samples = nullptr,
+                          ColdCache::Evictor* cold = nullptr);
 
 /**
  * @brief STREAM Triad test implementation
  *
- * Performs STREAM Triad operation: A[i] = B[i] + C[i] * D[i].
+ * Performs STREAM Triad operation: A[i] = B[i] + scalar * C[i].
  * This is a standard memory bandwidth benchmark that measures
  * the performance of mixed read/write operations with arithmetic.
  *
  * @param a_buffer Pointer to buffer A (destination)
  * @param b_buffer Pointer to buffer B (source)
  * @param c_buffer Pointer to buffer C (source)
- * @param d_buffer Pointer to buffer D (source)
  * @param buffer_size Size of the buffers in bytes
  * @param start_offset Starting offset within the buffers
  * @param end_offset Ending offset within the buffers
  * @param iterations Number of iterations to perform
  * @param stop_flag Atomic flag to signal test termination
+ * @param kernel SIMD kernel used for the inner loop (AUTO picks the widest supported)
+ * @param store_policy Temporal, streaming or zero-allocating stores
+ * @param samples Optional ring that receives per-iteration samples (batched to its capacity)
+ * @param cold Optional evictor run before every pass, off the clock (--cold)
+ * @param tuned Optional loop shape run instead of the kernel's loop (--tune; temporal stores only)
  * @return PerformanceStats containing test results
  */
 PerformanceStats triad_test(uint8_t* a_buffer, const uint8_t* b_buffer, const uint8_t* c_buffer,
-                            const uint8_t* d_buffer, size_t buffer_size, size_t start_offset,
-                            size_t end_offset, size_t iterations,
-                            const std::atomic<bool>& stop_flag);
+                            size_t buffer_size, size_t start_offset, size_t end_offset,
+                            size_t iterations, const std::atomic<bool>& stop_flag,
+                            KernelType kernel = KernelType::AUTO,
+                            StorePolicy store_policy = StorePolicy::TEMPORAL,
+                            SampleRing* samples = nullptr,
+                            ColdCache::Evictor* cold = nullptr,
+                            const KernelMatrix::Kernel* tuned = nullptr);
+
+/**
+ * @brief Multi-stream test: read R arrays and write W arrays in one pass
+ *
+ * Each element of the range is loaded from every source array, summed, and
+ * stored to every destination array, so one pass moves (R + W) arrays of
+ * traffic through as many concurrent streams. With no destinations the sum
+ * is kept as a checksum (a columnar scan over R columns); with no sources a
+ * constant is stored (W output columns). Always uses temporal stores.
+ *
+ * @param src_buffers Source arrays (R, may be empty)
+ * @param dst_buffers Destination arrays (W, may be empty; not empty if src_buffers is)
+ * @param buffer_size Size of every array in bytes
+ * @param start_offset Starting offset within the arrays
+ * @param end_offset Ending offset within the arrays
+ * @param iterations Number of iterations to perform
+ * @param stop_flag Atomic flag to signal test termination
+ * @param kernel SIMD kernel used for the inner loop (AUTO picks the widest supported)
+ * @param samples Optional ring that receives per-iteration samples (batched to its capacity)
+ * @return PerformanceStats containing test results
+ */
+PerformanceStats streams_test(const std::vector<const uint8_t*>& src_buffers,
+                              const std::vector<uint8_t*>& dst_buffers, size_t buffer_size,
+                              size_t start_offset, size_t end_offset, size_t iterations,
+                              const std::atomic<bool>& stop_flag,
+                              KernelType kernel = KernelType::AUTO,
+                              SampleRing* samples = nullptr);
+
+/**
+ * @brief Strided read test: load element_bytes every stride_bytes
+ *
+ * Scalar loads (whole lines for 64-byte elements) walk the range at a fixed
+ * stride. Bandwidth counts only the element bytes loaded; traffic
+ * receives the cache-line bytes the same passes touch, so the two show how
+ * much of each line a strided scan actually uses.
+ *
+ * @param buffer Pointer to the memory buffer
+ * @param buffer_size Size of the buffer in bytes
+ * @param start_offset Starting offset within the buffer
+ * @param end_offset Ending offset within the buffer
+ * @param iterations Number of iterations to perform
+ * @param stop_flag Atomic flag to signal test termination
+ * @param access_config Element size and stride
+ * @param samples Optional ring that receives per-iteration samples (batched to its capacity)
+ * @param traffic Optional: receives the line and element bytes touched over all iterations
+ * @param prefetch_distance Software prefetch this many bytes ahead of every access (0: none)
+ * @return PerformanceStats in element bytes, latency per access
+ */
+PerformanceStats strided_read_test(const uint8_t* buffer, size_t buffer_size, size_t start_offset,
+                                   size_t end_offset, size_t iterations,
+                                   const std::atomic<bool>& stop_flag,
+                                   const AccessPatterns::AccessConfig& access_config,
+                                   SampleRing* samples = nullptr,
+                                   AccessPatterns::LineTraffic* traffic = nullptr,
+                                   size_t prefetch_distance = 0);
+
+/**
+ * @brief Gather or scatter test: element accesses at indices drawn from a distribution
+ *
+ * Draws one index per cache line of the range (at most
+ * AccessPatterns::MAX_INDICES_PER_PASS) before timing, then loads (gather)
+ * or stores (scatter) element_bytes at each index with the kernel's gather
+ * or scatter, hardware instructions where the kernel has them. Bandwidth
+ * counts every element access; traffic receives the distinct line and
+ * element bytes the indices touch per pass, times the iterations.
+ *
+ * @param buffer Pointer to the memory buffer
+ * @param buffer_size Size of the buffer in bytes
+ * @param start_offset Starting offset within the buffer
+ * @param end_offset Ending offset within the buffer
+ * @param iterations Number of iterations to perform
+ * @param is_write Scatter (true) or gather (false)
+ * @param stop_flag Atomic flag to signal test termination
+ * @param access_config Element size and index distribution
+ * @param kernel SIMD kernel providing the gather and scatter (AUTO picks the widest supported)
+ * @param samples Optional ring that receives per-iteration samples (batched to its capacity)
+ * @param traffic Optional: receives the line and element bytes touched over all iterations
+ * @return PerformanceStats in element bytes, latency per access
+ */
+PerformanceStats gather_test(uint8_t* buffer, size_t buffer_size, size_t start_offset, size_t end_offset,
+                             size_t iterations, bool is_write, const std::atomic<bool>& stop_flag,
+                             const AccessPatterns::AccessConfig& access_config,
+                             KernelType kernel = KernelType::AUTO, SampleRing* samples = nullptr,
+                             AccessPatterns::LineTraffic* traffic = nullptr);
+
+/**
+ * @brief Encoded scan test: decode a bit-packed, delta or dictionary column
+ *
+ * The range, trimmed to whole groups of EncodedScans::GROUP_VALUES values,
+ * is read as one column of bits-wide values and decoded with the kernel's
+ * unpack, delta or dict decoder, vectorized where the kernel has one. Each
+ * slice is its own column: delta decoding starts from zero, and the
+ * dictionary (2^bits 64-bit values) is built before timing. Bandwidth counts
+ * the packed bytes read; the decoded values per second follow from it.
+ *
+ * @param buffer Pointer to the memory buffer holding the packed column
+ * @param buffer_size Size of the buffer in bytes
+ * @param start_offset Starting offset within the buffer
+ * @param end_offset Ending offset within the buffer
+ * @param iterations Number of iterations to perform
+ * @param stop_flag Atomic flag to signal test termination
+ * @param encoding Bit-packed values, deltas or dictionary codes
+ * @param bits Width of a packed value (1-32, 1-16 for dictionary codes)
+ * @param kernel SIMD kernel providing the decoders (AUTO picks the widest supported)
+ * @param samples Optional ring that receives per-iteration samples (batched to its capacity)
+ * @return PerformanceStats in packed bytes, latency per decoded value
+ */
+PerformanceStats decode_scan_test(const uint8_t* buffer, size_t buffer_size, size_t start_offset,
+                                  size_t end_offset, size_t iterations, const std::atomic<bool>& stop_flag,
+                                  EncodedScans::Encoding encoding, unsigned bits,
+                                  KernelType kernel = KernelType::AUTO, SampleRing* samples = nullptr);
+
+/**
+ * @brief Hash probe test: look up keys in an open-addressing table built over the range
+ *
+ * The slice holds one table (ProxyKernels::table_layout), filled to the
+ * load factor before timing. Every pass looks up as many keys as the table
+ * holds, drawn pseudo-randomly and different each pass, in batches that are
+ * hashed and prefetched together. Bandwidth counts one slot per lookup; the
+ * lookups per second follow from it.
+ *
+ * @param buffer Pointer to the memory buffer holding the tables
+ * @param buffer_size Size of the buffer in bytes
+ * @param start_offset Starting offset within the buffer
+ * @param end_offset Ending offset within the buffer
+ * @param iterations Number of iterations to perform
+ * @param stop_flag Atomic flag to signal test termination
+ * @param config Probe sequence, load factor and batch
+ * @param samples Optional ring that receives per-iteration samples (batched to its capacity)
+ * @return PerformanceStats in slot bytes, latency per lookup; verified if every lookup found its value
+ */
+PerformanceStats hash_probe_test(uint8_t* buffer, size_t buffer_size, size_t start_offset, size_t end_offset,
+                                 size_t iterations, const std::atomic<bool>& stop_flag,
+                                 const ProxyKernels::Config& config, SampleRing* samples = nullptr);
+
+/**
+ * @brief Radix partition test: scatter 64-bit keys into 256 partitions by one digit
+ *
+ * The source slice is filled with pseudo-random keys before timing. Each
+ * pass partitions it into the destination slice on the next 8-bit digit,
+ * through software write-combining buffers. Bandwidth counts the two reads
+ * and one write of every key.
+ *
+ * @param src_buffer Buffer holding the keys
+ * @param dst_buffer Buffer receiving the partitions
+ * @param buffer_size Size of each buffer in bytes
+ * @param start_offset Starting offset within the buffers
+ * @param end_offset Ending offset within the buffers
+ * @param iterations Number of iterations to perform
+ * @param stop_flag Atomic flag to signal test termination
+ * @param samples Optional ring that receives per-iteration samples (batched to its capacity)
+ * @return PerformanceStats in bytes moved, latency per key; verified if the last pass is a partitioning
+ */
+PerformanceStats radix_partition_test(uint8_t* src_buffer, uint8_t* dst_buffer, size_t buffer_size,
+                                      size_t start_offset, size_t end_offset, size_t iterations,
+                                      const std::atomic<bool>& stop_flag, SampleRing* samples = nullptr);
+
+/**
+ * @brief Merge test: merge sorted runs of 64-bit keys into one
+ *
+ * The source slice is filled with config.merge_ways ascending runs before
+ * timing; each pass merges them into the destination slice. Bandwidth counts
+ * one read and one write of every key.
+ *
+ * @param src_buffer Buffer holding the runs
+ * @param dst_buffer Buffer receiving the merged keys
+ * @param buffer_size Size of each buffer in bytes
+ * @param start_offset Starting offset within the buffers
+ * @param end_offset Ending offset within the buffers
+ * @param iterations Number of iterations to perform
+ * @param stop_flag Atomic flag to signal test termination
+ * @param config Number of runs merged at once
+ * @param samples Optional ring that receives per-iteration samples (batched to its capacity)
+ * @return PerformanceStats in bytes moved, latency per key; verified if the output is sorted
+ */
+PerformanceStats merge_test(uint8_t* src_buffer, uint8_t* dst_buffer, size_t buffer_size, size_t start_offset,
+                            size_t end_offset, size_t iterations, const std::atomic<bool>& stop_flag,
+                            const ProxyKernels::Config& config, SampleRing* samples = nullptr);
+
+/**
+ * @brief SpMV test: multiply a synthetic sparse matrix by a vector, y = A x
+ *
+ * The slice holds one matrix, CSR or SELL-C-sigma, with its x and y vectors,
+ * built before timing in config's shape. Bandwidth is effective: each
+ * nonzero's value and column once and each row's pointer, x and y entries
+ * (IrregularKernels::spmv_bytes), the same for both formats, so SELL's
+ * padding shows as lost bandwidth.
+ *
+ * @param buffer Pointer to the memory buffer holding the matrices
+ * @param buffer_size Size of the buffer in bytes
+ * @param start_offset Starting offset within the buffer
+ * @param end_offset Ending offset within the buffer
+ * @param iterations Number of iterations to perform
+ * @param stop_flag Atomic flag to signal test termination
+ * @param sell SELL-C-sigma rather than CSR
+ * @param config Matrix shape and nonzeros per row
+ * @param samples Optional ring that receives per-iteration samples (batched to its capacity)
+ * @param work Optional: receives the flops, nonzeros and stored entries of the passes
+ * @return PerformanceStats in effective bytes, latency per nonzero; verified if y = A x after the last pass
+ */
+PerformanceStats spmv_test(uint8_t* buffer, size_t buffer_size, size_t start_offset, size_t end_offset,
+                           size_t iterations, const std::atomic<bool>& stop_flag, bool sell,
+                           const IrregularKernels::Config& config, SampleRing* samples = nullptr,
+                           IrregularKernels::Work* work = nullptr);
+
+/**
+ * @brief Stencil test: Jacobi sweeps of a 3D 7-point stencil between two grids
+ *
+ * The slice holds an input and an output cube, filled before timing; each
+ * pass sweeps one into the other, then they swap. Bandwidth is effective:
+ * one read and one write of every interior point.
+ *
+ * @param buffer Pointer to the memory buffer holding the grids
+ * @param buffer_size Size of the buffer in bytes
+ * @param start_offset Starting offset within the buffer
+ * @param end_offset Ending offset within the buffer
+ * @param iterations Number of iterations to perform
+ * @param stop_flag Atomic flag to signal test termination
+ * @param config Tile rows of the blocked sweep (0: unblocked)
+ * @param samples Optional ring that receives per-iteration samples (batched to its capacity)
+ * @param work Optional: receives the flops of the passes
+ * @return PerformanceStats in effective bytes, latency per point; verified if sampled points hold the last sweep
+ */
+PerformanceStats stencil_test(uint8_t* buffer, size_t buffer_size, size_t start_offset, size_t end_offset,
+                              size_t iterations, const std::atomic<bool>& stop_flag,
+                              const IrregularKernels::Config& config, SampleRing* samples = nullptr,
+                              IrregularKernels::Work* work = nullptr);
+
+/**
+ * @brief Throttled load generator for loaded-latency measurements
+ *
+ * Streams over the range in LOAD_CHUNK_BYTES chunks with the sequential read,
+ * write or copy kernel and spins delay_spins pause instructions after every
+ * chunk, so the delay sets the injection rate. Runs at least one chunk, then
+ * until stop_flag is set.
+ * RANDOM_READ chunks load LOAD_CHUNK_BYTES worth of independent cache lines
+ * at pseudo-random offsets of the range, defeating the prefetchers.
+ *
+ * @param src_buffer Buffer read by SEQUENTIAL_READ and COPY
+ * @param dst_buffer Buffer written by SEQUENTIAL_WRITE and COPY
+ * @param buffer_size Size of the buffers in bytes
+ * @param start_offset Starting offset within the buffers
+ * @param end_offset Ending offset within the buffers
+ * @param pattern SEQUENTIAL_READ, SEQUENTIAL_WRITE, COPY or RANDOM_READ (anything else reads)
+ * @param delay_spins Pause instructions between two chunks (0: unthrottled)
+ * @param stop_flag Atomic flag that ends the load
+ * @param kernel SIMD kernel used for the chunks (AUTO picks the widest supported)
+ * @param store_policy Temporal, streaming or zero-allocating stores for write and copy
+ * @param progress Optional: receives the bytes processed so far after every chunk (relaxed stores)
+ * @return PerformanceStats with the bandwidth the load achieved
+ */
+PerformanceStats throttled_load_test(const uint8_t* src_buffer, uint8_t* dst_buffer, size_t buffer_size,
+                                     size_t start_offset, size_t end_offset, TestPattern pattern,
+                                     size_t delay_spins, const std::atomic<bool>& stop_flag,
+                                     KernelType kernel = KernelType::AUTO,
+                                     StorePolicy store_policy = StorePolicy::TEMPORAL,
+                                     std::atomic<uint64_t>* progress = nullptr);
+
+/**
+ * @brief Throttled atomic read-modify-write generator
+ *
+ * Issues relaxed fetch_add on the first word of successive cache lines of
+ * the range, LOAD_CHUNK_BYTES / 64 lines per chunk, with delay_spins pause
+ * instructions after every chunk. Every operation is counted as one 64-byte
+ * line, so the bandwidth compares with that of the other load generators.
+ * Runs at least one chunk, then until stop_flag is set.
+ *
+ * @param buffer Buffer whose lines are updated (64-bit aligned)
+ * @param buffer_size Size of the buffer in bytes
+ * @param start_offset Starting offset within the buffer
+ * @param end_offset Ending offset within the buffer
+ * @param delay_spins Pause instructions between two chunks (0: unthrottled)
+ * @param stop_flag Atomic flag that ends the load
+ * @return PerformanceStats at 64 bytes per operation
+ */
+PerformanceStats throttled_atomic_test(uint8_t* buffer, size_t buffer_size, size_t start_offset,
+                                       size_t end_offset, size_t delay_spins, const std::atomic<bool>& stop_flag);
+
+/**
+ * @brief Arithmetic-intensity kernel for roofline measurements
+ *
+ * Updates every double of the range in place with flops_per_element
+ * floating-point operations: one add, or flops_per_element / 2 chained
+ * FMAs, interleaved over ROOFLINE_BLOCK_ELEMENTS independent elements so
+ * FMA latency is hidden. Each element is read and written once per pass,
+ * so the intensity is flops_per_element / ROOFLINE_BYTES_PER_ELEMENT
+ * FLOP/byte and GFLOP/s is bandwidth_gbps times that intensity.
+ *
+ * @param buffer Buffer updated in place
+ * @param buffer_size Size of the buffer in bytes
+ * @param start_offset Starting offset within the buffer
+ * @param end_offset Ending offset within the buffer
+ * @param iterations Number of passes over the range
+ * @param flops_per_element One of ROOFLINE_FLOPS_PER_ELEMENT
+ * @param stop_flag Atomic flag to signal test termination
+ * @return PerformanceStats with bytes read plus written
+ * @throws TestError if flops_per_element is not a supported count
+ */
+PerformanceStats arithmetic_intensity_test(uint8_t* buffer, size_t buffer_size, size_t start_offset,
+                                           size_t end_offset, size_t iterations, size_t flops_per_element,
+                                           const std::atomic<bool>& stop_flag);
+
+/// Acceleration name reported by matrix_multiply_test without a platform multiplier
+constexpr const char* PORTABLE_GEMM_NAME = MatrixMultiply::BlockedGemm::PORTABLE_NAME;
 
 /**
  * @brief Matrix multiplication test using hardware acceleration
  * 
- * Performs C = A * B matrix multiplication using platform-specific
- * hardware acceleration (Apple AMX, ARM Neoverse, Intel AMX).
- * This test measures GFLOPS and memory bandwidth for compute-intensive workloads.
+ * Computes C += A * B with the platform multiplier (Apple AMX via
+ * Accelerate, Intel AMX/AVX-512, ARM SVE/NEON). Without one, a portable
+ * cache-blocked GEMM with blocking derived from cache_info is used.
+ * Matrices are row-major, so a thread can compute a contiguous band of
+ * rows of a shared product by passing A and C offset to its first row and
+ * matrix_config.M set to its row count; B is shared by all threads.
+ * C is cleared before the first iteration.
+ *
+ * Operands hold elements of matrix_config.precision (FP64 if use_double)
+ * and C elements of its accumulate type; reduced precisions without a
+ * native path are widened while packing.
  * 
- * @param matrix_config Matrix dimensions and configuration
- * @param iterations Number of iterations to perform
+ * @param C Result rows (M x N)
+ * @param A Input rows (M x K)
+ * @param B Full right-hand matrix (K x N)
+ * @param matrix_config Dimensions of this slice, iteration count and precision
+ * @param multiplier Platform multiplier owned by the calling thread, or nullptr
+ * @param cache_info Cache sizes used to block the portable fallback
  * @param stop_flag Atomic flag to signal test termination
  * @return MatrixPerformanceStats containing specialized matrix test results
  */
 MatrixMultiply::MatrixPerformanceStats matrix_multiply_test(
+    void* C, const void* A, const void* B,
     const MatrixMultiply::MatrixConfig& matrix_config,
+    MatrixMultiply::MatrixMultiplier* multiplier,
+    const CacheInfo& cache_info,
     const std::atomic<bool>& stop_flag);
 
 }  // namespace StandardTests
@@ -10,8 +10,8 @@ void SystemInfoDisplay::print_system_info(
     auto base_info = platform->get_system_info();
     OutputFormatter formatter(format);
     
-    if (platform->get_platform_name() == "macOS" && affinity_type == CPUAffinityType::DEFAULT) {
-        print_macos_heterogeneous_info(platform, base_info, formatter, show_build_info);
+    if (is_heterogeneous(platform) && affinity_type == CPUAffinityType::DEFAULT) {
+        print_heterogeneous_info(platform, base_info, formatter, show_build_info);
     } else {
         // Handle core-specific affinity types
         if (affinity_type != CPUAffinityType::DEFAULT) {
@@ -61,8 +61,8 @@ void SystemInfoDisplay::print_cached_system_info(
         
         std::cout << formatter.format_system_info(core_specific_info);
     } else {
-        // Default mode - show P/E core breakdown for Apple Silicon
-        if (platform->get_platform_name() == "macOS") {
+        // Default mode - show P/E core breakdown on heterogeneous parts
+        if (is_heterogeneous(platform)) {
             SystemInfo enhanced_info = cached_info;
             size_t p_cores = platform->get_max_threads_for_affinity(CPUAffinityType::P_CORES);
             size_t e_cores = platform->get_max_threads_for_affinity(CPUAffinityType::E_CORES);
@@ -74,7 +74,12 @@ void SystemInfoDisplay::print_cached_system_info(
     }
 }
 
-void SystemInfoDisplay::print_macos_heterogeneous_info(
+bool SystemInfoDisplay::is_heterogeneous(const std::unique_ptr<PlatformInterface>& platform) {
+    return platform->get_platform_name() == "macOS" ||
+           platform->get_max_threads_for_affinity(CPUAffinityType::E_CORES) > 0;
+}
+
+void SystemInfoDisplay::print_heterogeneous_info(
     const std::unique_ptr<PlatformInterface>& platform,
     const SystemInfo& base_info,
     OutputFormatter& formatter,
@@ -106,7 +111,9 @@ void SystemInfoDisplay::print_macos_heterogeneous_info(
         std::cout << "- **L2 Cache:** " << (e_cache.l2_size / 1024) << " KB per core ✓\n\n";
         
         std::cout << "### Shared Cache\n";
-        std::cout << "- **System Level Cache (SLC):** " << (p_cache.l3_size / (1024 * 1024)) << " MB shared ✓\n";
+        std::cout << (platform->get_platform_name() == "macOS" ? "- **System Level Cache (SLC):** "
+                                                               : "- **L3 Cache:** ")
+                  << (p_cache.l3_size / (1024 * 1024)) << " MB shared ✓\n";
         std::cout << "- **Cache Line Size:** " << platform->detect_cache_line_size() << " bytes ✓\n\n";
     } else {
         // For benchmark runs, show standard system info
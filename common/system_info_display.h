@@ -46,9 +46,17 @@ public:
 
 private:
     /**
-     * @brief Display macOS heterogeneous architecture information
+     * @brief Whether the platform mixes performance and efficiency cores
+     *
+     * Apple Silicon always does; Linux hosts when the CPU topology finds
+     * Intel hybrid or Arm big.LITTLE core types.
      */
-    static void print_macos_heterogeneous_info(
+    static bool is_heterogeneous(const std::unique_ptr<PlatformInterface>& platform);
+
+    /**
+     * @brief Display heterogeneous architecture information (P-cores and E-cores)
+     */
+    static void print_heterogeneous_info(
         const std::unique_ptr<PlatformInterface>& platform,
         const SystemInfo& base_info,
         OutputFormatter& formatter,
@@ -0,0 +1,473 @@
+#include "system_probe.h"
+#include "constants.h"
+#include "errors.h"
+#include "json.h"
+#include "safe_file_utils.h"
+
+#include <algorithm>
+#include <cstdio>
+#include <fstream>
+#include <sstream>
+#include <vector>
+
+#ifdef __linux__
+#include <sys/sysinfo.h>
+#endif
+#ifdef __APPLE__
+#include <sys/sysctl.h>
+#endif
+
+namespace SystemProbe {
+
+namespace {
+
+std::string affinity_key(CPUAffinityType affinity) {
+    switch (affinity) {
+        case CPUAffinityType::P_CORES:
+            return "p_cores";
+        case CPUAffinityType::E_CORES:
+            return "e_cores";
+        case CPUAffinityType::DEFAULT:
+            break;
+    }
+    return "default";
+}
+
+size_t get_count(const Json::Value& value, const std::string& key) {
+    return static_cast<size_t>(std::max(0.0, value.get_number(key)));
+}
+
+bool get_bool(const Json::Value& value, const std::string& key) {
+    const Json::Value* member = value.find(key);
+    return member && member->type == Json::Value::Type::BOOL && member->boolean;
+}
+
+std::string sharing_to_json(const std::vector<std::vector<size_t>>& sharing) {
+    std::vector<std::string> instances;
+    for (const auto& cpus : sharing) {
+        std::vector<std::string> ids;
+        for (size_t cpu : cpus) {
+            ids.push_back(std::to_string(cpu));
+        }
+        instances.push_back(Json::array(ids));
+    }
+    return Json::array(instances);
+}
+
+std::vector<std::vector<size_t>> sharing_from_json(const Json::Value& value, const std::string& key) {
+    std::vector<std::vector<size_t>> sharing;
+    if (const Json::Value* instances = value.find(key)) {
+        for (const auto& instance : instances->items) {
+            std::vector<size_t> cpus;
+            for (const auto& cpu : instance.items) {
+                cpus.push_back(static_cast<size_t>(std::max(0.0, cpu.number)));
+            }
+            sharing.push_back(cpus);
+        }
+    }
+    return sharing;
+}
+
+std::string cache_to_json(const CacheInfo& cache) {
+    return Json::Object()
+        .add_count("l1_data_size", cache.l1_data_size)
+        .add_count("l1_instruction_size", cache.l1_instruction_size)
+        .add_count("l2_size", cache.l2_size)
+        .add_count("l3_size", cache.l3_size)
+        .add_count("l1d_assoc", cache.l1d_assoc)
+        .add_count("l1i_assoc", cache.l1i_assoc)
+        .add_count("l2_assoc", cache.l2_assoc)
+        .add_count("l3_assoc", cache.l3_assoc)
+        .add_count("l1_line_size", cache.l1_line_size)
+        .add_count("l2_line_size", cache.l2_line_size)
+        .add_count("l3_line_size", cache.l3_line_size)
+        .add_raw("l1d_sharing", sharing_to_json(cache.l1d_sharing))
+        .add_raw("l2_sharing", sharing_to_json(cache.l2_sharing))
+        .add_raw("l3_sharing", sharing_to_json(cache.l3_sharing))
+        .str();
+}
+
+CacheInfo cache_from_json(const Json::Value& value) {
+    CacheInfo cache = {};
+    cache.l1_data_size = get_count(value, "l1_data_size");
+    cache.l1_instruction_size = get_count(value, "l1_instruction_size");
+    cache.l2_size = get_count(value, "l2_size");
+    cache.l3_size = get_count(value, "l3_size");
+    cache.l1d_assoc = get_count(value, "l1d_assoc");
+    cache.l1i_assoc = get_count(value, "l1i_assoc");
+    cache.l2_assoc = get_count(value, "l2_assoc");
+    cache.l3_assoc = get_count(value, "l3_assoc");
+    cache.l1_line_size = get_count(value, "l1_line_size");
+    cache.l2_line_size = get_count(value, "l2_line_size");
+    cache.l3_line_size = get_count(value, "l3_line_size");
+    cache.l1d_sharing = sharing_from_json(value, "l1d_sharing");
+    cache.l2_sharing = sharing_from_json(value, "l2_sharing");
+    cache.l3_sharing = sharing_from_json(value, "l3_sharing");
+    return cache;
+}
+
+// Detected fields only: the calibrated peak is attached per run
+std::string memory_to_json(const MemorySpecs& specs) {
+    return Json::Object()
+        .add_string("type", specs.type)
+        .add_count("speed_mtps", specs.speed_mtps)
+        .add_count("data_width_bits", specs.data_width_bits)
+        .add_count("total_width_bits", specs.total_width_bits)
+        .add_count("total_size_gb", specs.total_size_gb)
+        .add_count("num_channels", specs.num_channels)
+        .add_number("theoretical_bandwidth_gbps", specs.theoretical_bandwidth_gbps)
+        .add_bool("is_virtualized", specs.is_virtualized)
+        .add_bool("data_width_detected", specs.data_width_detected)
+        .add_bool("total_width_detected", specs.total_width_detected)
+        .add_bool("num_channels_detected", specs.num_channels_detected)
+        .add_bool("is_unified_memory", specs.is_unified_memory)
+        .add_string("architecture", specs.architecture)
+        .add_bool("speed_detected", specs.speed_detected)
+        .add_string("detection_source", specs.detection_source)
+        .str();
+}
+
+MemorySpecs memory_from_json(const Json::Value& value) {
+    MemorySpecs specs = {};
+    specs.type = value.get_string("type");
+    specs.speed_mtps = get_count(value, "speed_mtps");
+    specs.data_width_bits = get_count(value, "data_width_bits");
+    specs.total_width_bits = get_count(value, "total_width_bits");
+    specs.total_size_gb = get_count(value, "total_size_gb");
+    specs.num_channels = get_count(value, "num_channels");
+    specs.theoretical_bandwidth_gbps = value.get_number("theoretical_bandwidth_gbps");
+    specs.is_virtualized = get_bool(value, "is_virtualized");
+    specs.data_width_detected = get_bool(value, "data_width_detected");
+    specs.total_width_detected = get_bool(value, "total_width_detected");
+    specs.num_channels_detected = get_bool(value, "num_channels_detected");
+    specs.is_unified_memory = get_bool(value, "is_unified_memory");
+    specs.architecture = value.get_string("architecture");
+    specs.speed_detected = get_bool(value, "speed_detected");
+    specs.detection_source = value.get_string("detection_source");
+    return specs;
+}
+
+template <typename T>
+std::shared_future<T> ready(const T& value) {
+    std::promise<T> promise;
+    promise.set_value(value);
+    return promise.get_future().share();
+}
+
+}  // namespace
+
+std::string boot_id() {
+#ifdef __linux__
+    std::ifstream file("/proc/sys/kernel/random/boot_id");
+    std::string id;
+    if (std::getline(file, id)) {
+        return id;
+    }
+#elif defined(__APPLE__)
+    char id[64] = {};
+    size_t size = sizeof(id);
+    if (sysctlbyname("kern.bootsessionuuid", id, &size, nullptr, 0) == 0) {
+        return std::string(id);
+    }
+#endif
+    return "";
+}
+
+Probe::Probe(std::unique_ptr<PlatformInterface> native) : native_(std::move(native)) {}
+
+template <typename T, typename Detect>
+void Probe::launch(std::shared_future<T>& slot, Detect detect, std::launch policy) {
+    if (!slot.valid()) {
+        slot = std::async(policy, [this, detect]() {
+            ++detections_;
+            return detect();
+        }).share();
+    }
+}
+
+template <typename T, typename Detect>
+const T& Probe::resolve(std::shared_future<T>& slot, Detect detect, std::launch policy) {
+    std::shared_future<T> future;
+    {
+        std::lock_guard<std::mutex> lock(mutex_);
+        launch(slot, detect, policy);
+        future = slot;
+    }
+    // The slot keeps the shared state, so the reference outlives this copy
+    return future.get();
+}
+
+void Probe::start(CPUAffinityType affinity) {
+    // Deferred items run on the caller that first needs them; these run now, side by side
+    PlatformInterface* native = native_.get();
+    std::lock_guard<std::mutex> lock(mutex_);
+    std::shared_future<CacheInfo>* core_cache = &core_caches_[affinity];
+    launch(system_info_, [native]() { return native->get_system_info(); });
+    launch(*core_cache, [native, affinity]() { return native->get_core_specific_cache_info(affinity); });
+    launch(numa_topology_, [native]() { return native->detect_numa_topology(); });
+    launch(cpu_topology_, [native]() { return native->detect_cpu_topology(); });
+}
+
+const SystemInfo& Probe::system_info() {
+    PlatformInterface* native = native_.get();
+    return resolve(system_info_, [native]() { return native->get_system_info(); }, std::launch::deferred);
+}
+
+const CacheInfo& Probe::core_cache_info(CPUAffinityType affinity) {
+    PlatformInterface* native = native_.get();
+    std::shared_future<CacheInfo>* slot;
+    {
+        std::lock_guard<std::mutex> lock(mutex_);
+        slot = &core_caches_[affinity];
+    }
+    return resolve(*slot, [native, affinity]() { return native->get_core_specific_cache_info(affinity); },
+                   std::launch::deferred);
+}
+
+const std::pair<std::string, std::string>& Probe::processor_info() {
+    PlatformInterface* native = native_.get();
+    return resolve(processor_info_, [native]() { return native->detect_processor_info(); }, std::launch::deferred);
+}
+
+const NumaTopology& Probe::numa_topology() {
+    PlatformInterface* native = native_.get();
+    return resolve(numa_topology_, [native]() { return native->detect_numa_topology(); }, std::launch::deferred);
+}
+
+const CpuTopology& Probe::cpu_topology() {
+    PlatformInterface* native = native_.get();
+    return resolve(cpu_topology_, [native]() { return native->detect_cpu_topology(); }, std::launch::deferred);
+}
+
+bool Probe::load(const std::string& path, const std::string& boot) {
+    std::ifstream file(path);
+    if (!file || boot.empty()) {
+        return false;
+    }
+    std::stringstream text;
+    text << file.rdbuf();
+    SystemInfo info = {};
+    std::map<CPUAffinityType, CacheInfo> core_caches;
+    if (!from_json(text.str(), boot, info, core_caches)) {
+        return false;
+    }
+#ifdef __linux__
+    struct sysinfo si;
+    if (sysinfo(&si) == 0) {
+        info.available_ram_gb = si.freeram * si.mem_unit / (1024 * 1024 * 1024);
+    }
+#endif
+
+    std::lock_guard<std::mutex> lock(mutex_);
+    if (!system_info_.valid()) {
+        system_info_ = ready(info);
+    }
+    for (const auto& entry : core_caches) {
+        std::shared_future<CacheInfo>& slot = core_caches_[entry.first];
+        if (!slot.valid()) {
+            slot = ready(entry.second);
+        }
+    }
+    return true;
+}
+
+void Probe::save(const std::string& path, const std::string& boot) {
+    SystemInfo info = system_info();
+    std::map<CPUAffinityType, std::shared_future<CacheInfo>> slots;
+    {
+        std::lock_guard<std::mutex> lock(mutex_);
+        slots = core_caches_;
+    }
+    std::map<CPUAffinityType, CacheInfo> core_caches;
+    for (const auto& entry : slots) {
+        if (entry.second.valid()) {
+            core_caches[entry.first] = entry.second.get();
+        }
+    }
+
+    std::string directory;
+    if (!SafeFileUtils::make_parent_directories(path, directory)) {
+        throw ConfigurationError("Cannot create directory " + directory + " for system cache " + path);
+    }
+    std::string temporary = path + ".tmp";
+    {
+        std::ofstream file(temporary, std::ios::out | std::ios::trunc);
+        file << to_json(boot, info, core_caches) << "\n";
+        file.flush();
+        if (!file) {
+            std::remove(temporary.c_str());
+            throw ConfigurationError("Cannot write system cache " + temporary);
+        }
+    }
+    if (std::rename(temporary.c_str(), path.c_str()) != 0) {
+        std::remove(temporary.c_str());
+        throw ConfigurationError("Cannot replace system cache " + path);
+    }
+}
+
+std::string to_json(const std::string& boot, const SystemInfo& info,
+                    const std::map<CPUAffinityType, CacheInfo>& core_caches) {
+    std::vector<std::string> caches;
+    for (const auto& entry : core_caches) {
+        caches.push_back(Json::Object()
+                             .add_string("affinity", affinity_key(entry.first))
+                             .add_raw("cache_info", cache_to_json(entry.second))
+                             .str());
+    }
+    std::string system = Json::Object()
+                             .add_count("total_ram_gb", info.total_ram_gb)
+                             .add_count("cpu_cores", info.cpu_cores)
+                             .add_count("cpu_threads", info.cpu_threads)
+                             .add_count("cache_line_size", info.cache_line_size)
+                             .add_string("cpu_name", info.cpu_name)
+                             .add_raw("memory_specs", memory_to_json(info.memory_specs))
+                             .add_raw("cache_info", cache_to_json(info.cache_info))
+                             .str();
+    return Json::Object()
+        .add_count("probe_version", BenchmarkConstants::SYSTEM_PROBE_VERSION)
+        .add_string("boot_id", boot)
+        .add_raw("system_info", system)
+        .add_raw("core_caches", Json::array(caches))
+        .str();
+}
+
+bool from_json(const std::string& text, const std::string& boot, SystemInfo& info,
+               std::map<CPUAffinityType, CacheInfo>& core_caches) {
+    Json::Value root;
+    try {
+        root = Json::parse(text);
+    } catch (const ConfigurationError&) {
+        return false;
+    }
+    const Json::Value* system = root.find("system_info");
+    if (root.get_number("probe_version") != static_cast<double>(BenchmarkConstants::SYSTEM_PROBE_VERSION) ||
+        root.get_string("boot_id") != boot || boot.empty() || !system) {
+        return false;
+    }
+
+    info.total_ram_gb = get_count(*system, "total_ram_gb");
+    info.available_ram_gb = 0;
+    info.cpu_cores = get_count(*system, "cpu_cores");
+    info.cpu_threads = get_count(*system, "cpu_threads");
+    info.cache_line_size = get_count(*system, "cache_line_size");
+    info.cpu_name = system->get_string("cpu_name");
+    if (const Json::Value* specs = system->find("memory_specs")) {
+        info.memory_specs = memory_from_json(*specs);
+    }
+    if (const Json::Value* cache = system->find("cache_info")) {
+        info.cache_info = cache_from_json(*cache);
+    }
+    core_caches.clear();
+    if (const Json::Value* caches = root.find("core_caches")) {
+        for (const auto& entry : caches->items) {
+            const Json::Value* cache = entry.find("cache_info");
+            if (!cache) {
+                continue;
+            }
+            for (CPUAffinityType affinity : {CPUAffinityType::DEFAULT, CPUAffinityType::P_CORES,
+                                             CPUAffinityType::E_CORES}) {
+                if (entry.get_string("affinity") == affinity_key(affinity)) {
+                    core_caches[affinity] = cache_from_json(*cache);
+                }
+            }
+        }
+    }
+    return true;
+}
+
+CachedPlatform::CachedPlatform(std::unique_ptr<PlatformInterface> native, Probe& probe)
+    : native_(std::move(native)), probe_(probe) {}
+
+std::pair<std::string, std::string> CachedPlatform::detect_processor_info() {
+    return probe_.processor_info();
+}
+
+// Every platform fills the system information from its own line size, memory and cache detection
+size_t CachedPlatform::detect_cache_line_size() {
+    return probe_.system_info().cache_line_size;
+}
+
+CacheInfo CachedPlatform::detect_cache_info() {
+    return probe_.system_info().cache_info;
+}
+
+CacheInfo CachedPlatform::get_core_specific_cache_info(CPUAffinityType affinity_type) {
+    return probe_.core_cache_info(affinity_type);
+}
+
+MemorySpecs CachedPlatform::get_memory_specs() {
+    return probe_.system_info().memory_specs;
+}
+
+SystemInfo CachedPlatform::get_system_info() {
+    return probe_.system_info();
+}
+
+NumaTopology CachedPlatform::detect_numa_topology() {
+    return probe_.numa_topology();
+}
+
+CpuTopology CachedPlatform::detect_cpu_topology() {
+    return probe_.cpu_topology();
+}
+
+size_t CachedPlatform::get_max_threads_for_affinity(CPUAffinityType affinity_type) {
+    return native_->get_max_threads_for_affinity(affinity_type);
+}
+
+void CachedPlatform::set_thread_affinity(size_t thread_id, CPUAffinityType affinity_type, size_t total_threads) {
+    native_->set_thread_affinity(thread_id, affinity_type, total_threads);
+}
+
+bool CachedPlatform::validate_thread_count(size_t num_threads, CPUAffinityType affinity_type,
+                                           std::string& error_msg) {
+    return native_->validate_thread_count(num_threads, affinity_type, error_msg);
+}
+
+bool CachedPlatform::bind_thread_to_numa_node(size_t thread_id, size_t node_id) {
+    return native_->bind_thread_to_numa_node(thread_id, node_id);
+}
+
+bool CachedPlatform::bind_memory_to_numa_node(void* addr, size_t length, size_t node_id) {
+    return native_->bind_memory_to_numa_node(addr, length, node_id);
+}
+
+bool CachedPlatform::interleave_memory_across_numa_nodes(void* addr, size_t length,
+                                                         const std::vector<NumaWeight>& weights,
+                                                         std::string& policy) {
+    return native_->interleave_memory_across_numa_nodes(addr, length, weights, policy);
+}
+
+std::string CachedPlatform::get_platform_name() {
+    return native_->get_platform_name();
+}
+
+bool CachedPlatform::supports_cpu_affinity() {
+    return native_->supports_cpu_affinity();
+}
+
+std::unique_ptr<MatrixMultiply::MatrixMultiplier> CachedPlatform::create_matrix_multiplier() {
+    return native_->create_matrix_multiplier();
+}
+
+std::unique_ptr<PerfCounters::CounterGroup> CachedPlatform::create_thread_counters() {
+    return native_->create_thread_counters();
+}
+
+std::unique_ptr<PerfCounters::CounterGroup> CachedPlatform::create_uncore_counters() {
+    return native_->create_uncore_counters();
+}
+
+std::unique_ptr<PrefetchControl::HardwarePrefetchers> CachedPlatform::create_prefetcher_control() {
+    return native_->create_prefetcher_control();
+}
+
+std::unique_ptr<EnergyMeter::Meter> CachedPlatform::create_energy_meter() {
+    return native_->create_energy_meter();
+}
+
+std::unique_ptr<GpuBandwidth::Device> CachedPlatform::create_gpu_device() {
+    return native_->create_gpu_device();
+}
+
+}  // namespace SystemProbe
@@ -0,0 +1,151 @@
+#ifndef SYSTEM_PROBE_H
+#define SYSTEM_PROBE_H
+
+#include <atomic>
+#include <cstddef>
+#include <future>
+#include <map>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <utility>
+
+#include "platform_interface.h"
+
+/**
+ * @brief One shared, lazily populated probe of the host (--system-cache)
+ *
+ * The tester, the argument parser and the system display each hold a
+ * platform, and each used to read /proc/cpuinfo, the sysfs cache and
+ * topology trees and SMBIOS on its own. Every platform from
+ * create_platform_interface now answers its detection calls from one probe:
+ * each item is detected once, on first use or in parallel from start(), and
+ * shared by every caller. The system information and core-type caches can
+ * also be kept in a file keyed by boot ID, so later runs of the same boot
+ * read them back instead of detecting them; the CPU and NUMA topologies
+ * that threads are placed and bound by are always read live.
+ */
+namespace SystemProbe {
+
+/**
+ * @brief Identifier of the running boot (/proc/sys/kernel/random/boot_id, kern.bootsessionuuid on macOS)
+ * @return "" if the OS publishes none
+ */
+std::string boot_id();
+
+/**
+ * @brief Detection results of one host, each computed at most once
+ *
+ * Safe to call from any thread: concurrent callers of an item that is still
+ * being detected wait for that one detection.
+ */
+class Probe {
+  public:
+    explicit Probe(std::unique_ptr<PlatformInterface> native);
+
+    /**
+     * @brief Start detecting every item not known yet, each on its own thread
+     * @param affinity Core type whose caches the run will ask for
+     */
+    void start(CPUAffinityType affinity);
+
+    const SystemInfo& system_info();
+    const CacheInfo& core_cache_info(CPUAffinityType affinity);
+    const std::pair<std::string, std::string>& processor_info();
+    const NumaTopology& numa_topology();
+    const CpuTopology& cpu_topology();
+
+    /**
+     * @brief Take the system information and core caches from a cache file written during this boot
+     *
+     * Available RAM is read live. A missing, malformed or stale file (another
+     * boot or layout version) leaves the probe to detect everything.
+     *
+     * @return Whether the file held this boot's probe
+     */
+    bool load(const std::string& path, const std::string& boot);
+
+    /**
+     * @brief Write the system information and every core cache detected so far, keyed by boot
+     * @throws ConfigurationError if the file cannot be written
+     */
+    void save(const std::string& path, const std::string& boot);
+
+    /// Items detected by the native platform so far (0 after a load, until something new is asked for)
+    size_t detections() const { return detections_; }
+
+  private:
+    // launch expects mutex_ held; resolve takes it and waits outside it
+    template <typename T, typename Detect>
+    void launch(std::shared_future<T>& slot, Detect detect, std::launch policy = std::launch::async);
+    template <typename T, typename Detect>
+    const T& resolve(std::shared_future<T>& slot, Detect detect, std::launch policy);
+
+    std::unique_ptr<PlatformInterface> native_;
+    std::mutex mutex_;
+    std::atomic<size_t> detections_{0};
+    std::shared_future<SystemInfo> system_info_;
+    std::map<CPUAffinityType, std::shared_future<CacheInfo>> core_caches_;
+    std::shared_future<std::pair<std::string, std::string>> processor_info_;
+    std::shared_future<NumaTopology> numa_topology_;
+    std::shared_future<CpuTopology> cpu_topology_;
+};
+
+/**
+ * @brief The process-wide probe, over the native platform of this build (defined with the platform factory)
+ */
+Probe& shared();
+
+/**
+ * @brief Probe contents as the cache file stores them
+ */
+std::string to_json(const std::string& boot, const SystemInfo& info,
+                    const std::map<CPUAffinityType, CacheInfo>& core_caches);
+
+/**
+ * @brief Read a cache file's contents back
+ * @return false if the text is malformed, of another layout version or of another boot
+ */
+bool from_json(const std::string& text, const std::string& boot, SystemInfo& info,
+               std::map<CPUAffinityType, CacheInfo>& core_caches);
+
+/**
+ * @brief Platform that answers detection from a probe and forwards everything else to its native platform
+ */
+class CachedPlatform : public PlatformInterface {
+  public:
+    CachedPlatform(std::unique_ptr<PlatformInterface> native, Probe& probe);
+
+    std::pair<std::string, std::string> detect_processor_info() override;
+    size_t detect_cache_line_size() override;
+    CacheInfo detect_cache_info() override;
+    CacheInfo get_core_specific_cache_info(CPUAffinityType affinity_type) override;
+    MemorySpecs get_memory_specs() override;
+    SystemInfo get_system_info() override;
+    NumaTopology detect_numa_topology() override;
+    CpuTopology detect_cpu_topology() override;
+
+    size_t get_max_threads_for_affinity(CPUAffinityType affinity_type) override;
+    void set_thread_affinity(size_t thread_id, CPUAffinityType affinity_type, size_t total_threads) override;
+    bool validate_thread_count(size_t num_threads, CPUAffinityType affinity_type, std::string& error_msg) override;
+    bool bind_thread_to_numa_node(size_t thread_id, size_t node_id) override;
+    bool bind_memory_to_numa_node(void* addr, size_t length, size_t node_id) override;
+    bool interleave_memory_across_numa_nodes(void* addr, size_t length, const std::vector<NumaWeight>& weights,
+                                             std::string& policy) override;
+    std::string get_platform_name() override;
+    bool supports_cpu_affinity() override;
+    std::unique_ptr<MatrixMultiply::MatrixMultiplier> create_matrix_multiplier() override;
+    std::unique_ptr<PerfCounters::CounterGroup> create_thread_counters() override;
+    std::unique_ptr<PerfCounters::CounterGroup> create_uncore_counters() override;
+    std::unique_ptr<PrefetchControl::HardwarePrefetchers> create_prefetcher_control() override;
+    std::unique_ptr<EnergyMeter::Meter> create_energy_meter() override;
+    std::unique_ptr<GpuBandwidth::Device> create_gpu_device() override;
+
+  private:
+    std::unique_ptr<PlatformInterface> native_;
+    Probe& probe_;
+};
+
+}  // namespace SystemProbe
+
+#endif  // SYSTEM_PROBE_H
@@ -1,4 +1,6 @@
 #include "test_patterns.h"
+#include "constants.h"
+#include "errors.h"
 
 #include <string>
 
@@ -27,6 +29,38 @@ std::string get_pattern_name(TestPattern pattern) {
             return "Triad";
         case TestPattern::MATRIX_MULTIPLY:
             return "Matrix Multiply (GEMM)";
+        case TestPattern::LATENCY_CHASE:
+            return "Latency Chase";
+        case TestPattern::SCALE:
+            return "Scale";
+        case TestPattern::ADD:
+            return "Add";
+        case TestPattern::STREAMS:
+            return "Streams";
+        case TestPattern::STRIDED_READ:
+            return "Strided Read";
+        case TestPattern::GATHER:
+            return "Gather";
+        case TestPattern::SCATTER:
+            return "Scatter";
+        case TestPattern::DECODE_BITPACK:
+            return "Decode Bitpack";
+        case TestPattern::DECODE_DELTA:
+            return "Decode Delta";
+        case TestPattern::DECODE_DICT:
+            return "Decode Dict";
+        case TestPattern::HASH_PROBE:
+            return "Hash Probe";
+        case TestPattern::RADIX_PARTITION:
+            return "Radix Partition";
+        case TestPattern::MULTIWAY_MERGE:
+            return "Multiway Merge";
+        case TestPattern::SPMV_CSR:
+            return "SpMV CSR";
+        case TestPattern::SPMV_SELL:
+            return "SpMV SELL-8-256";
+        case TestPattern::STENCIL_7PT:
+            return "Stencil 7-Point";
         default:
             return "Unknown";
     }
@@ -37,7 +71,8 @@ std::string get_pattern_name(TestPattern pattern) {
  *
  * Computes bandwidth and latency metrics from the raw bytes processed,
  * time taken, and number of operations. Includes safety checks to prevent
- * division by zero and invalid calculations.
+ * division by zero and invalid calculations. Values are reported as
+ * measured; ResultValidation flags implausible ones instead of rewriting them.
  *
  * @param bytes_processed Total number of bytes processed during test
  * @param time_seconds Total time taken for test in seconds
@@ -53,17 +88,6 @@ PerformanceStats calculate_stats(size_t bytes_processed, double time_seconds, si
     if(time_seconds > 0.0 && operations > 0) {
         stats.bandwidth_gbps = bytes_processed / (time_seconds * 1e9);
         stats.latency_ns = (time_seconds * 1e9) / operations;
-
-        // Validate bandwidth - should not exceed reasonable limits
-        // For DDR5-7200 in virtualized environment, max realistic bandwidth is much lower
-        // Virtualization overhead typically reduces bandwidth by 30-70%
-        constexpr double MAX_REALISTIC_BANDWIDTH_GBPS =
-            60.0;  // Conservative limit for virtualized DDR5-7200
-        if(stats.bandwidth_gbps > MAX_REALISTIC_BANDWIDTH_GBPS) {
-            // If bandwidth is unrealistically high, it might indicate measurement error
-            // Scale it down to a reasonable value
-            stats.bandwidth_gbps = MAX_REALISTIC_BANDWIDTH_GBPS;
-        }
     } else {
         stats.bandwidth_gbps = 0.0;
         stats.latency_ns = 0.0;
@@ -71,3 +95,45 @@ PerformanceStats calculate_stats(size_t bytes_processed, double time_seconds, si
 
     return stats;
 }
+
+/**
+ * @brief Parses the R:W argument of the multi-stream pattern
+ *
+ * @param text Two non-negative integers separated by a colon
+ * @return Stream counts
+ * @throws ArgumentError if the text is malformed, a side exceeds
+ *         MAX_STREAM_ARRAYS, or both sides are zero
+ */
+StreamCounts parse_stream_counts(const std::string& text) {
+    const std::string expected = "Invalid stream count '" + text + "'. Expected R:W, each 0-" +
+                                 std::to_string(BenchmarkConstants::MAX_STREAM_ARRAYS) + " (e.g. 8:2)";
+    size_t colon = text.find(':');
+    if (colon == std::string::npos) {
+        throw ArgumentError(expected);
+    }
+
+    size_t sides[2] = {0, 0};
+    const std::string parts[2] = {text.substr(0, colon), text.substr(colon + 1)};
+    for (size_t i = 0; i < 2; ++i) {
+        if (parts[i].empty() || parts[i].find_first_not_of("0123456789") != std::string::npos ||
+            parts[i].size() > 3) {
+            throw ArgumentError(expected);
+        }
+        sides[i] = std::stoul(parts[i]);
+        if (sides[i] > BenchmarkConstants::MAX_STREAM_ARRAYS) {
+            throw ArgumentError(expected);
+        }
+    }
+    if (sides[0] + sides[1] == 0) {
+        throw ArgumentError("Invalid stream count '" + text + "'. At least one array must be read or written");
+    }
+
+    StreamCounts counts;
+    counts.reads = sides[0];
+    counts.writes = sides[1];
+    return counts;
+}
+
+std::string stream_counts_to_string(const StreamCounts& counts) {
+    return std::to_string(counts.reads) + "R:" + std::to_string(counts.writes) + "W";
+}
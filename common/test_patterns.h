@@ -16,8 +16,24 @@ enum class TestPattern {
     RANDOM_READ,       ///< Random read access pattern
     RANDOM_WRITE,      ///< Random write access pattern
     COPY,              ///< Memory copy operation (read from one buffer, write to another)
-    TRIAD,             ///< STREAM Triad operation (A[i] = B[i] + C[i] * D[i])
-    MATRIX_MULTIPLY    ///< Matrix multiplication with hardware acceleration (GEMM)
+    TRIAD,             ///< STREAM Triad operation (A[i] = B[i] + scalar * C[i])
+    MATRIX_MULTIPLY,   ///< Matrix multiplication with hardware acceleration (GEMM)
+    LATENCY_CHASE,     ///< Serial dependent loads through a cyclic pointer chain (load-to-use latency)
+    SCALE,             ///< STREAM Scale operation (A[i] = scalar * B[i])
+    ADD,               ///< STREAM Add operation (A[i] = B[i] + C[i])
+    STREAMS,           ///< R source arrays summed into W destination arrays (--streams R:W)
+    STRIDED_READ,      ///< Loads of --element bytes every --stride bytes
+    GATHER,            ///< Index-driven loads of --element bytes (--index distribution)
+    SCATTER,           ///< Index-driven stores of --element bytes (--index distribution)
+    DECODE_BITPACK,    ///< Scan of a column of --bits-wide packed values
+    DECODE_DELTA,      ///< Scan of packed deltas, prefix-summed into values
+    DECODE_DICT,       ///< Scan of packed dictionary codes, looked up into 64-bit values
+    HASH_PROBE,        ///< Lookups in an open-addressing hash table (--probe, --load-factor, --hash-batch)
+    RADIX_PARTITION,   ///< Radix-sort partitioning pass of 64-bit keys into 256 partitions
+    MULTIWAY_MERGE,    ///< Merge of --merge-ways sorted runs of 64-bit keys
+    SPMV_CSR,          ///< Sparse matrix-vector product of a compressed-sparse-row matrix (--matrix, --row-nnz)
+    SPMV_SELL,         ///< Sparse matrix-vector product of a SELL-C-sigma matrix (--matrix, --row-nnz)
+    STENCIL_7PT        ///< Jacobi sweep of a 3D 7-point stencil (--stencil-block)
 };
 
 /**
@@ -31,10 +47,37 @@ struct PerformanceStats {
     double latency_ns;       ///< Memory access latency in nanoseconds
     size_t bytes_processed;  ///< Total bytes processed during test
     double time_seconds;     ///< Total time taken for test in seconds
+    bool verified = true;    ///< Kernel output matched a reference (false: work may have been elided)
+};
+
+/**
+ * @brief Source and destination array counts of the STREAMS pattern
+ */
+struct StreamCounts {
+    size_t reads = 4;   ///< Arrays read per element (R)
+    size_t writes = 1;  ///< Arrays written per element (W)
+
+    size_t arrays() const { return reads + writes; }
 };
 
 // Function declarations
 std::string get_pattern_name(TestPattern pattern);
+
 PerformanceStats calculate_stats(size_t bytes_processed, double time_seconds, size_t operations);
 
+/**
+ * @brief Parse an "R:W" stream count ("8:2", "12:0")
+ *
+ * Each side is 0 to BenchmarkConstants::MAX_STREAM_ARRAYS and at least one
+ * array must be touched.
+ *
+ * @throws ArgumentError on a malformed or out-of-range count
+ */
+StreamCounts parse_stream_counts(const std::string& text);
+
+/**
+ * @brief Label used in result names ("8R:2W")
+ */
+std::string stream_counts_to_string(const StreamCounts& counts);
+
 #endif  // TEST_PATTERNS_H
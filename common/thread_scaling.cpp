@@ -0,0 +1,75 @@
+#include "thread_scaling.h"
+#include "errors.h"
+#include "numa_utils.h"
+
+#include <algorithm>
+
+namespace ThreadScaling {
+
+bool is_thread_sweep(const std::string& value) {
+    return value == "sweep" || value.find(',') != std::string::npos;
+}
+
+std::vector<size_t> parse_thread_counts(const std::string& str, size_t max_threads) {
+    std::vector<size_t> counts;
+    if (str == "sweep") {
+        for (size_t threads = 1; threads < max_threads; threads *= 2) {
+            counts.push_back(threads);
+        }
+        if (max_threads > 0) {
+            counts.push_back(max_threads);
+        }
+        return counts;
+    }
+
+    counts = NumaUtils::parse_id_list(str);
+    std::sort(counts.begin(), counts.end());
+    counts.erase(std::unique(counts.begin(), counts.end()), counts.end());
+    if (counts.empty() || counts.front() == 0) {
+        throw ArgumentError("Invalid thread counts '" + str + "'. Expected sweep or a list such as 1,2,4,8");
+    }
+    return counts;
+}
+
+void annotate(std::vector<ScalingPoint>& points) {
+    if (points.empty() || points.front().bandwidth_gbps <= 0.0 || points.front().threads == 0) {
+        return;
+    }
+    const ScalingPoint& first = points.front();
+    double first_per_thread = first.bandwidth_gbps / static_cast<double>(first.threads);
+    for (auto& point : points) {
+        point.speedup = point.bandwidth_gbps / first.bandwidth_gbps;
+        point.efficiency = point.threads > 0
+                               ? point.bandwidth_gbps / static_cast<double>(point.threads) / first_per_thread
+                               : 0.0;
+    }
+}
+
+size_t saturation_index(const std::vector<ScalingPoint>& points) {
+    double peak = 0.0;
+    for (const auto& point : points) {
+        peak = std::max(peak, point.bandwidth_gbps);
+    }
+    if (peak <= 0.0) {
+        return points.size();
+    }
+    for (size_t i = 0; i < points.size(); ++i) {
+        if (points[i].bandwidth_gbps >= SATURATION_FRACTION * peak) {
+            return i;
+        }
+    }
+    return points.size();
+}
+
+size_t energy_optimal_index(const std::vector<ScalingPoint>& points) {
+    size_t best = points.size();
+    for (size_t i = 0; i < points.size(); ++i) {
+        if (points[i].energy_measured && points[i].pj_per_byte > 0.0 &&
+            (best == points.size() || points[i].pj_per_byte < points[best].pj_per_byte)) {
+            best = i;
+        }
+    }
+    return best;
+}
+
+}  // namespace ThreadScaling
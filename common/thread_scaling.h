@@ -0,0 +1,78 @@
+#ifndef THREAD_SCALING_H
+#define THREAD_SCALING_H
+
+#include <cstddef>
+#include <string>
+#include <vector>
+
+/**
+ * @brief Thread-count scaling sweeps
+ *
+ * A memory-bound pattern gains bandwidth with every thread until the
+ * memory controllers saturate; past that point extra workers only queue.
+ * A scaling sweep runs each pattern at several thread counts over the same
+ * buffers and reports where the curve flattens. Threads are placed by a
+ * CpuTopologyUtils policy (compact by default), so the curve of one socket
+ * is not mixed with the bandwidth of another.
+ */
+namespace ThreadScaling {
+
+/// A point is saturated once it reaches this fraction of the sweep's peak bandwidth
+constexpr double SATURATION_FRACTION = 0.95;
+
+/**
+ * @brief Whether a --threads value asks for a scaling sweep ("sweep" or a comma-separated list)
+ */
+bool is_thread_sweep(const std::string& value);
+
+/**
+ * @brief Thread counts of a sweep
+ *
+ * "sweep" yields 1, 2, 4, ... below max_threads, then max_threads itself.
+ * A list such as "1,2,4,8" yields its counts in ascending order without
+ * duplicates, independent of max_threads.
+ *
+ * @throws ArgumentError if the list is malformed or contains 0
+ */
+std::vector<size_t> parse_thread_counts(const std::string& str, size_t max_threads);
+
+/**
+ * @brief One thread count of a scaling curve
+ */
+struct ScalingPoint {
+    size_t threads = 0;
+    double bandwidth_gbps = 0.0;  ///< Total bandwidth of the run
+    double latency_ns = 0.0;      ///< Mean time per access
+    double speedup = 0.0;         ///< Bandwidth over the first point's
+    double efficiency = 0.0;      ///< Bandwidth per thread over the first point's
+    bool energy_measured = false; ///< Energy counters were read around the run
+    double package_watts = 0.0;   ///< Average package power
+    double dram_watts = 0.0;      ///< Average DRAM power (0 without a DRAM domain)
+    double pj_per_byte = 0.0;     ///< Package plus DRAM energy per byte, in picojoules
+};
+
+/**
+ * @brief Fill in speedup and efficiency against the first point
+ */
+void annotate(std::vector<ScalingPoint>& points);
+
+/**
+ * @brief Index of the first point reaching SATURATION_FRACTION of the peak bandwidth
+ *
+ * @return points.size() if there are no points or none has any bandwidth
+ */
+size_t saturation_index(const std::vector<ScalingPoint>& points);
+
+/**
+ * @brief Index of the point moving a byte with the least energy
+ *
+ * Memory-bound patterns usually reach it well below the largest count:
+ * past saturation every extra core adds power but no bandwidth.
+ *
+ * @return points.size() if no point has a positive energy per byte
+ */
+size_t energy_optimal_index(const std::vector<ScalingPoint>& points);
+
+}  // namespace ThreadScaling
+
+#endif  // THREAD_SCALING_H
@@ -0,0 +1,288 @@
+#include "tlb_sweep.h"
+#include "cache_boundaries.h"
+#include "constants.h"
+#include "cycle_timer.h"
+#include "errors.h"
+#include "pointer_chase.h"
+
+#include <algorithm>
+#include <chrono>
+#include <cmath>
+#include <exception>
+#include <sstream>
+#include <thread>
+#include <unistd.h>
+
+namespace TlbSweep {
+
+namespace {
+
+using Clock = CycleTimer::Clock;
+
+// A mapped buffer and the backend that produced it (HUGE_2M may fall back to THP)
+struct Buffer {
+    PageAllocator::Allocation allocation;
+    size_t bytes = 0;
+    bool mapped = false;
+    std::string note;
+
+    ~Buffer() {
+        if (mapped) {
+            PageAllocator::release(allocation);
+        }
+    }
+};
+
+void map_buffer(Buffer& buffer, PageMode mode, size_t bytes) {
+    const size_t alignment = PointerChase::NODE_SIZE;
+    try {
+        buffer.allocation = PageAllocator::allocate(bytes, alignment, mode);
+    } catch (const MemoryError& e) {
+        if (mode != PageMode::HUGE_2M) {
+            throw;
+        }
+        // hugetlb pages are rarely reserved; THP gives the same page size where it can
+        buffer.allocation = PageAllocator::allocate(bytes, alignment, PageMode::THP);
+        buffer.note = std::string("2m hugetlb unavailable, using THP: ") + e.what();
+    }
+    buffer.bytes = bytes;
+    buffer.mapped = true;
+}
+
+// Median ns per hop of repetitions timed passes over a warm chain
+double measure(const void* start, size_t pages, size_t repetitions) {
+    size_t hops = std::min(std::max(pages * BenchmarkConstants::TLB_HOPS_PER_PAGE, BenchmarkConstants::MIN_CHASE_HOPS),
+                           BenchmarkConstants::MAX_CHASE_HOPS);
+    const void* position = PointerChase::chase(start, pages);
+
+    std::vector<double> samples;
+    for (size_t i = 0; i < std::max<size_t>(repetitions, 1); ++i) {
+        auto begin = Clock::now();
+        position = PointerChase::chase(position, hops);
+        double seconds = CycleTimer::elapsed_seconds(begin, Clock::now());
+        samples.push_back(seconds * 1e9 / static_cast<double>(hops));
+    }
+
+    // Publish the final node so the chain cannot be optimized away
+    volatile const void* sink = position;
+    (void)sink;
+
+    std::sort(samples.begin(), samples.end());
+    return samples[samples.size() / 2];
+}
+
+std::string page_size_name(size_t bytes) {
+    if (bytes >= BenchmarkConstants::GB) {
+        return std::to_string(bytes / BenchmarkConstants::GB) + "G";
+    }
+    if (bytes >= BenchmarkConstants::MB) {
+        return std::to_string(bytes / BenchmarkConstants::MB) + "M";
+    }
+    return std::to_string(bytes / BenchmarkConstants::KB) + "K";
+}
+
+Curve sweep(PageMode mode, const std::vector<PageMode>& modes, size_t max_bytes, size_t repetitions) {
+    Curve curve;
+    curve.mode = mode;
+    curve.page_bytes = page_bytes(mode);
+    const size_t cap = (mode == PageMode::SMALL) ? BenchmarkConstants::TLB_MAX_SMALL_PAGES
+                                                 : BenchmarkConstants::TLB_MAX_HUGE_PAGES;
+    const size_t max_pages = std::min(max_bytes / curve.page_bytes, cap);
+    if (max_pages < BenchmarkConstants::TLB_MIN_PAGES) {
+        curve.available = false;
+        curve.note = "--size holds fewer than " + std::to_string(BenchmarkConstants::TLB_MIN_PAGES) + " pages of " +
+                     page_size_name(curve.page_bytes);
+        return curve;
+    }
+    const size_t bytes = max_pages * curve.page_bytes;
+
+    Buffer buffer;
+    try {
+        map_buffer(buffer, mode, bytes);
+    } catch (const MemoryError& e) {
+        curve.available = false;
+        curve.note = e.what();
+        return curve;
+    }
+    curve.note = buffer.note;
+
+    // The largest larger page size that maps; base pages fall back to THP when none does
+    std::vector<PageMode> candidates;
+    for (PageMode other : modes) {
+        if (page_bytes(other) > curve.page_bytes) {
+            candidates.insert(candidates.begin(), other);
+        }
+    }
+    if (mode == PageMode::SMALL && std::find(candidates.begin(), candidates.end(), PageMode::THP) == candidates.end()) {
+        candidates.push_back(PageMode::THP);
+    }
+    Buffer baseline;
+    for (PageMode other : candidates) {
+        try {
+            map_buffer(baseline, other, bytes);
+            break;
+        } catch (const MemoryError&) {
+            continue;
+        }
+    }
+
+    uint8_t* base = static_cast<uint8_t*>(buffer.allocation.usable);
+    uint8_t* baseline_base = baseline.mapped ? static_cast<uint8_t*>(baseline.allocation.usable) : nullptr;
+    for (size_t pages : page_counts(max_pages)) {
+        Point point;
+        point.pages = pages;
+        point.span_bytes = pages * curve.page_bytes;
+        point.latency_ns = measure(build_chain(base, pages, curve.page_bytes, pages), pages, repetitions);
+        if (baseline_base != nullptr) {
+            point.baseline_ns =
+                measure(build_chain(baseline_base, pages, curve.page_bytes, pages), pages, repetitions);
+            point.walk_ns = std::max(0.0, point.latency_ns - point.baseline_ns);
+        }
+        curve.points.push_back(point);
+    }
+
+    // Every page of both buffers has been touched by the largest chain
+    curve.backing = PageAllocator::describe_backing(
+        PageAllocator::query_backing(buffer.allocation.usable, buffer.allocation.mode));
+    if (baseline.mapped) {
+        curve.baseline_backing = PageAllocator::describe_backing(
+            PageAllocator::query_backing(baseline.allocation.usable, baseline.allocation.mode));
+    }
+    curve.levels = detect_levels(curve.points, curve.page_bytes);
+    curve.page_walk_ns = curve.points.back().walk_ns;
+    return curve;
+}
+
+}  // namespace
+
+std::vector<PageMode> parse_page_modes(const std::string& list) {
+    std::vector<PageMode> modes;
+    std::stringstream stream(list);
+    std::string name;
+    while (std::getline(stream, name, ',')) {
+        PageMode mode = PageAllocator::string_to_page_mode(name);
+        if (mode == PageMode::DEFAULT) {
+            throw ArgumentError("--tlb-pages takes 4k, thp, 2m or 1g: the heap gives no control over the page size");
+        }
+        if (std::find(modes.begin(), modes.end(), mode) == modes.end()) {
+            modes.push_back(mode);
+        }
+    }
+    if (modes.empty()) {
+        throw ArgumentError("--tlb-pages needs at least one page size");
+    }
+    // Enumerators are declared in increasing page size
+    std::sort(modes.begin(), modes.end());
+    return modes;
+}
+
+size_t page_bytes(PageMode mode) {
+    switch (mode) {
+        case PageMode::DEFAULT:
+        case PageMode::SMALL: {
+            long page = sysconf(_SC_PAGESIZE);
+            return page > 0 ? static_cast<size_t>(page) : 4 * BenchmarkConstants::KB;
+        }
+        case PageMode::THP:
+        case PageMode::HUGE_2M:
+            return 2 * BenchmarkConstants::MB;
+        case PageMode::HUGE_1G:
+            return BenchmarkConstants::GB;
+    }
+    return 4 * BenchmarkConstants::KB;
+}
+
+std::vector<size_t> page_counts(size_t max_pages) {
+    std::vector<size_t> counts;
+    const double steps = static_cast<double>(BenchmarkConstants::TLB_STEPS_PER_OCTAVE);
+    for (size_t step = 0;; ++step) {
+        double exact = BenchmarkConstants::TLB_MIN_PAGES * std::exp2(static_cast<double>(step) / steps);
+        if (exact > static_cast<double>(max_pages) * (1.0 + 1e-9)) {
+            break;
+        }
+        size_t pages = static_cast<size_t>(std::llround(exact));
+        if (counts.empty() || pages > counts.back()) {
+            counts.push_back(pages);
+        }
+    }
+    return counts;
+}
+
+const void* build_chain(uint8_t* base, size_t pages, size_t stride, uint64_t seed) {
+    const size_t node = PointerChase::NODE_SIZE;
+    if (base == nullptr || pages < 2 || stride < node) {
+        return nullptr;
+    }
+
+    // A hashed line per page: on contiguous huge pages a line that repeated every few pages would
+    // fold the chain onto a fraction of the cache sets and pass conflict misses off as page walks
+    const size_t lines = stride / node;
+    auto address = [&](size_t page) {
+        uint64_t z = static_cast<uint64_t>(page) + 0x9E3779B97F4A7C15ULL;
+        z = (z ^ (z >> 30)) * 0xBF58476D1CE4E5B9ULL;
+        z = (z ^ (z >> 27)) * 0x94D049BB133111EBULL;
+        z ^= z >> 31;
+        return base + page * stride + static_cast<size_t>(z % lines) * node;
+    };
+
+    std::vector<size_t> next = PointerChase::single_cycle(pages, seed);
+    for (size_t i = 0; i < pages; ++i) {
+        *reinterpret_cast<uint8_t**>(address(i)) = address(next[i]);
+    }
+    return address(0);
+}
+
+std::vector<Level> detect_levels(const std::vector<Point>& points, size_t page_bytes) {
+    // The ratio cancels the cache misses both chains take; without a baseline it is latency alone
+    bool baselined = !points.empty() && std::all_of(points.begin(), points.end(),
+                                                    [](const Point& point) { return point.baseline_ns > 0.0; });
+    std::vector<size_t> sizes;
+    std::vector<double> values;
+    for (const auto& point : points) {
+        sizes.push_back(point.pages);
+        values.push_back(baselined ? point.latency_ns / point.baseline_ns : point.latency_ns);
+    }
+
+    const char* names[] = {"L1 dTLB", "STLB"};
+    std::vector<Level> levels;
+    for (const auto& knee : CacheBoundaries::detect_knees(sizes, values, CacheBoundaries::Curve::LATENCY)) {
+        auto it = std::find(sizes.begin(), sizes.end(), knee.capacity_bytes);
+        if (it == sizes.end()) {
+            continue;
+        }
+        size_t index = static_cast<size_t>(it - sizes.begin());
+        Level level;
+        level.name = levels.size() < 2 ? names[levels.size()] : "unattributed";
+        level.entries = knee.capacity_bytes;
+        level.reach_bytes = level.entries * page_bytes;
+        level.before_ns = points[index].latency_ns;
+        level.after_ns = points[std::min(index + 1, points.size() - 1)].latency_ns;
+        levels.push_back(level);
+    }
+    return levels;
+}
+
+std::vector<Curve> run(const std::vector<PageMode>& modes, size_t max_bytes, size_t repetitions, size_t cpu,
+                       const CoherenceTests::PinFunction& pin) {
+    std::vector<Curve> curves;
+    std::exception_ptr error;
+    std::thread worker([&] {
+        try {
+            if (pin) {
+                pin(cpu);
+            }
+            for (PageMode mode : modes) {
+                curves.push_back(sweep(mode, modes, max_bytes, repetitions));
+            }
+        } catch (...) {
+            error = std::current_exception();
+        }
+    });
+    worker.join();
+    if (error) {
+        std::rethrow_exception(error);
+    }
+    return curves;
+}
+
+}  // namespace TlbSweep
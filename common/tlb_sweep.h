@@ -0,0 +1,123 @@
+#ifndef TLB_SWEEP_H
+#define TLB_SWEEP_H
+
+#include <cstddef>
+#include <cstdint>
+#include <string>
+#include <vector>
+
+#include "coherence_tests.h"
+#include "page_allocator.h"
+
+/**
+ * @brief TLB reach from page-stride pointer chasing
+ *
+ * A chain with one node per page touches a single cache line of each page,
+ * so the number of pages it spans, not its bytes, decides whether every
+ * hop still hits the L1 dTLB, the second-level TLB (STLB), or pays for a
+ * page walk. Each page size is swept over a geometric range of page
+ * counts; the same chain laid over a buffer of larger pages touches the
+ * same lines with almost no TLB misses, and the difference between the
+ * two is the time spent translating. Knees of that ratio give the entry
+ * counts of each TLB level, and their product with the page size tells
+ * how much memory a level covers: the working set past which hugepages
+ * pay off.
+ */
+namespace TlbSweep {
+
+/**
+ * @brief Chase latency over one page count
+ */
+struct Point {
+    size_t pages = 0;           ///< Chain nodes, one per page
+    size_t span_bytes = 0;      ///< pages times the page size
+    double latency_ns = 0.0;    ///< Median ns per hop
+    double baseline_ns = 0.0;   ///< Same lines on larger pages (0: no baseline buffer covers the span)
+    double walk_ns = 0.0;       ///< latency_ns - baseline_ns, clamped at 0 (0 without a baseline)
+};
+
+/**
+ * @brief End of a plateau of the translation cost, in pages
+ */
+struct Level {
+    std::string name;           ///< "L1 dTLB", "STLB", or "unattributed" for later knees
+    size_t entries = 0;         ///< Largest page count still on the plateau
+    size_t reach_bytes = 0;     ///< entries times the page size
+    double before_ns = 0.0;     ///< Latency at the last point of the plateau
+    double after_ns = 0.0;      ///< Latency at the next point
+};
+
+/**
+ * @brief Sweep of one page size
+ */
+struct Curve {
+    PageMode mode = PageMode::SMALL;
+    size_t page_bytes = 0;          ///< Chain stride: one node per page
+    bool available = true;
+    std::string note;               ///< Why the page size is unavailable, or the fallback taken
+    std::string backing;            ///< Observed backing of the chain (PageAllocator::describe_backing)
+    std::string baseline_backing;   ///< Backing of the baseline buffer (empty: no baseline)
+    std::vector<Point> points;
+    std::vector<Level> levels;      ///< Knees of latency / baseline, or of latency alone without a baseline
+    double page_walk_ns = 0.0;      ///< walk_ns at the largest page count: a miss in every TLB level
+};
+
+/**
+ * @brief Parse --tlb-pages: a comma-separated list of 4k, thp, 2m and 1g
+ *
+ * Returned in increasing page size, duplicates removed.
+ *
+ * @throws ArgumentError if a name is unknown, "default", or the list is empty
+ */
+std::vector<PageMode> parse_page_modes(const std::string& list);
+
+/**
+ * @brief Page size of a mode: the base page for SMALL, 2 MB for THP and HUGE_2M, 1 GB for HUGE_1G
+ */
+size_t page_bytes(PageMode mode);
+
+/**
+ * @brief Geometric page counts from TLB_MIN_PAGES to max_pages, TLB_STEPS_PER_OCTAVE per octave
+ */
+std::vector<size_t> page_counts(size_t max_pages);
+
+/**
+ * @brief Link one node per page of stride bytes into a single random cycle
+ *
+ * The node of page i sits at a line of its page hashed from i, the same
+ * for every buffer, so the chain spreads over the cache sets instead of
+ * aliasing on a few of them, whatever the physical layout of the pages.
+ *
+ * @param base Start of at least pages * stride bytes
+ * @return First node of the cycle (nullptr if pages < 2 or stride < one node)
+ */
+const void* build_chain(uint8_t* base, size_t pages, size_t stride, uint64_t seed);
+
+/**
+ * @brief Name the knees of a translation-cost curve, smallest first
+ *
+ * @param points Sweep of one page size, in increasing page counts
+ * @param page_bytes Page size the reach is computed with
+ */
+std::vector<Level> detect_levels(const std::vector<Point>& points, size_t page_bytes);
+
+/**
+ * @brief Sweep every page size, optionally pinned to one CPU
+ *
+ * Each page size gets a buffer of up to max_bytes (the 4 KB sweep stops at
+ * TLB_MAX_SMALL_PAGES, the others at TLB_MAX_HUGE_PAGES). A 2 MB hugetlb
+ * buffer that cannot be mapped falls back to THP; a page size that cannot
+ * be mapped at all, or of which max_bytes holds fewer than two pages, is
+ * returned unavailable with a note. The baseline of a page size is a
+ * buffer of the largest larger page size requested that can be mapped;
+ * base pages fall back to a THP buffer when none can.
+ *
+ * @param repetitions Timed passes per point (median reported)
+ * @param pin Pins the measuring thread to cpu (empty: no pinning)
+ */
+std::vector<Curve> run(const std::vector<PageMode>& modes, size_t max_bytes, size_t repetitions, size_t cpu,
+                       const CoherenceTests::PinFunction& pin);
+
+}  // namespace TlbSweep
+
+#endif  // TLB_SWEEP_H
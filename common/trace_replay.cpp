@@ -0,0 +1,395 @@
+#include "trace_replay.h"
+#include "constants.h"
+#include "errors.h"
+
+#include <algorithm>
+#include <cctype>
+#include <cerrno>
+#include <chrono>
+#include <cstdlib>
+#include <cstring>
+#include <fstream>
+#include <limits>
+#include <random>
+#include <sstream>
+
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+
+using namespace BenchmarkConstants;
+
+namespace TraceReplay {
+
+namespace {
+
+const char TRACE_MAGIC[8] = {'M', 'B', 'T', 'R', 'A', 'C', 'E', '\0'};
+
+size_t block_records(const Summary& summary, size_t block) {
+    return std::min(TRACE_BLOCK_RECORDS, summary.records - block * TRACE_BLOCK_RECORDS);
+}
+
+// Reads or writes the 8-byte words covering each decoded record
+void access_block(const Workspace& workspace, size_t count, uint8_t* buffer, uint64_t value,
+                  uint64_t& checksum) {
+    uint64_t* words = reinterpret_cast<uint64_t*>(buffer);
+    for (size_t i = 0; i < count; ++i) {
+        uint64_t first = workspace.offsets[i] >> 3;
+        uint64_t last = (workspace.offsets[i] + workspace.sizes[i] - 1) >> 3;
+        if (workspace.writes[i]) {
+            for (uint64_t word = first; word <= last; ++word) {
+                words[word] = value;
+            }
+        } else {
+            for (uint64_t word = first; word <= last; ++word) {
+                checksum += words[word];
+            }
+        }
+    }
+}
+
+bool parse_address(const std::string& token, uint64_t& address) {
+    const char* text = token.c_str();
+    char* end = nullptr;
+    errno = 0;
+    address = std::strtoull(text, &end, 16);
+    return errno == 0 && end != text && *end == '\0' && address != 0;
+}
+
+std::string trim(const std::string& line) {
+    size_t first = line.find_first_not_of(" \t\r");
+    if (first == std::string::npos) {
+        return "";
+    }
+    return line.substr(first, line.find_last_not_of(" \t\r") - first + 1);
+}
+
+void tally(Summary& summary, const Access& access) {
+    summary.records++;
+    if (access.write) {
+        summary.writes++;
+        summary.write_bytes += access.size;
+    } else {
+        summary.reads++;
+        summary.read_bytes += access.size;
+    }
+}
+
+}  // namespace
+
+Trace::Trace(const std::string& path) : path_(path) {
+    int fd = open(path.c_str(), O_RDONLY | O_CLOEXEC);
+    if (fd < 0) {
+        throw ConfigurationError("Cannot open trace '" + path + "': " + std::strerror(errno));
+    }
+    struct stat st = {};
+    if (fstat(fd, &st) != 0 || st.st_size < static_cast<off_t>(sizeof(FileHeader))) {
+        close(fd);
+        throw ConfigurationError("'" + path + "' is not a trace: shorter than the trace header");
+    }
+    mapping_size_ = static_cast<size_t>(st.st_size);
+    mapping_ = mmap(nullptr, mapping_size_, PROT_READ, MAP_PRIVATE, fd, 0);
+    close(fd);
+    if (mapping_ == MAP_FAILED) {
+        mapping_ = nullptr;
+        throw ConfigurationError("Cannot map trace '" + path + "': " + std::strerror(errno));
+    }
+    // Every pass streams the whole file; read it ahead now rather than fault it in while timing
+    madvise(mapping_, mapping_size_, MADV_WILLNEED);
+
+    FileHeader header;
+    std::memcpy(&header, mapping_, sizeof(header));
+    std::string error;
+    if (std::memcmp(header.magic, TRACE_MAGIC, sizeof(TRACE_MAGIC)) != 0) {
+        error = "'" + path + "' is not a trace: bad magic";
+    } else if (header.version != TRACE_VERSION) {
+        error = "Trace '" + path + "' has version " + std::to_string(header.version) + ", this build reads version " +
+                std::to_string(TRACE_VERSION);
+    } else if (header.record_count == 0 || header.span_bytes == 0) {
+        error = "Trace '" + path + "' holds no records";
+    } else if ((mapping_size_ - sizeof(FileHeader)) / sizeof(Record) != header.record_count ||
+               (mapping_size_ - sizeof(FileHeader)) % sizeof(Record) != 0) {
+        error = "Trace '" + path + "' is truncated: its header declares " + std::to_string(header.record_count) +
+                " records, the file holds " + std::to_string((mapping_size_ - sizeof(FileHeader)) / sizeof(Record));
+    }
+    if (!error.empty()) {
+        munmap(mapping_, mapping_size_);
+        throw ConfigurationError(error);
+    }
+
+    // One validating pass: every record stays in the span and every block gets its starting offset
+    records_ = reinterpret_cast<const Record*>(static_cast<const uint8_t*>(mapping_) + sizeof(FileHeader));
+    summary_.span_bytes = header.span_bytes;
+    summary_.blocks = (header.record_count + TRACE_BLOCK_RECORDS - 1) / TRACE_BLOCK_RECORDS;
+    block_bases_.reserve(summary_.blocks);
+    int64_t offset = 0;
+    for (size_t i = 0; i < header.record_count; ++i) {
+        if (i % TRACE_BLOCK_RECORDS == 0) {
+            block_bases_.push_back(static_cast<uint64_t>(offset));
+        }
+        const Record& record = records_[i];
+        offset += record.delta;
+        if (offset < 0 || record.size == 0 || record.op > 1 ||
+            static_cast<uint64_t>(offset) + record.size > header.span_bytes) {
+            std::string message = "Record " + std::to_string(i) + " of trace '" + path + "' is invalid: " +
+                                  std::to_string(record.size) + " bytes at offset " + std::to_string(offset) +
+                                  ", op " + std::to_string(record.op) + ", span " +
+                                  std::to_string(header.span_bytes);
+            munmap(mapping_, mapping_size_);
+            throw ConfigurationError(message);
+        }
+        tally(summary_, Access{static_cast<uint64_t>(offset), record.size, record.op == 1});
+    }
+    summary_.records = header.record_count;
+}
+
+Trace::~Trace() {
+    if (mapping_ != nullptr) {
+        munmap(mapping_, mapping_size_);
+    }
+}
+
+Workspace::Workspace()
+    : offsets(TRACE_BLOCK_RECORDS), sizes(TRACE_BLOCK_RECORDS), writes(TRACE_BLOCK_RECORDS) {}
+
+void decode_block(const Record* records, size_t count, uint64_t base, Workspace& workspace) {
+    uint64_t* offsets = workspace.offsets.data();
+    uint16_t* sizes = workspace.sizes.data();
+    uint8_t* writes = workspace.writes.data();
+
+    // Field unpack: independent per record, so the compiler vectorizes it
+    for (size_t i = 0; i < count; ++i) {
+        offsets[i] = static_cast<uint64_t>(static_cast<int64_t>(records[i].delta));
+        sizes[i] = records[i].size;
+        writes[i] = records[i].op;
+    }
+    // Running sum of the deltas: the only loop-carried dependency, one add per record
+    uint64_t offset = base;
+    for (size_t i = 0; i < count; ++i) {
+        offset += offsets[i];
+        offsets[i] = offset;
+    }
+}
+
+std::pair<size_t, size_t> block_slice(size_t thread_index, size_t num_threads, size_t blocks) {
+    size_t per_thread = blocks / num_threads;
+    size_t remainder = blocks % num_threads;
+    size_t first = thread_index * per_thread + std::min(thread_index, remainder);
+    return {first, first + per_thread + (thread_index < remainder ? 1 : 0)};
+}
+
+PerformanceStats replay(const Trace& trace, size_t first_block, size_t last_block, uint8_t* buffer,
+                        size_t iterations, Workspace& workspace, const std::atomic<bool>& stop_flag) {
+    const Summary& summary = trace.summary();
+    size_t records = 0;
+    uint64_t bytes = 0;
+    for (size_t block = first_block; block < last_block; ++block) {
+        size_t count = block_records(summary, block);
+        const Record* block_start = trace.records() + block * TRACE_BLOCK_RECORDS;
+        for (size_t i = 0; i < count; ++i) {
+            bytes += block_start[i].size;
+        }
+        records += count;
+    }
+    if (records == 0) {
+        return PerformanceStats{};
+    }
+
+    uint64_t checksum = 0;
+    size_t passes = 0;
+    auto start = std::chrono::high_resolution_clock::now();
+    for (; passes < iterations && !stop_flag.load(std::memory_order_relaxed); ++passes) {
+        uint64_t value = TEST_PATTERN_BASE + passes;
+        for (size_t block = first_block; block < last_block; ++block) {
+            size_t count = block_records(summary, block);
+            decode_block(trace.records() + block * TRACE_BLOCK_RECORDS, count, trace.block_base(block), workspace);
+            access_block(workspace, count, buffer, value, checksum);
+        }
+    }
+    auto end = std::chrono::high_resolution_clock::now();
+    volatile uint64_t sink = checksum;
+    (void)sink;
+
+    double seconds = std::chrono::duration<double>(end - start).count();
+    return calculate_stats(bytes * passes, seconds, records * passes);
+}
+
+double decode_only(const Trace& trace, size_t first_block, size_t last_block, size_t iterations,
+                   Workspace& workspace) {
+    const Summary& summary = trace.summary();
+    uint64_t checksum = 0;
+    auto start = std::chrono::high_resolution_clock::now();
+    for (size_t pass = 0; pass < iterations; ++pass) {
+        for (size_t block = first_block; block < last_block; ++block) {
+            size_t count = block_records(summary, block);
+            decode_block(trace.records() + block * TRACE_BLOCK_RECORDS, count, trace.block_base(block), workspace);
+            checksum += workspace.offsets[count - 1] + workspace.sizes[count / 2] + workspace.writes[0];
+        }
+    }
+    auto end = std::chrono::high_resolution_clock::now();
+    volatile uint64_t sink = checksum;
+    (void)sink;
+    return std::chrono::duration<double>(end - start).count();
+}
+
+Source parse_source(const std::string& str) {
+    Source source;
+    size_t colon = str.find(':');
+    std::string kind = str.substr(0, colon);
+    if (colon != std::string::npos && colon + 1 < str.size() && (kind == "perf" || kind == "histogram")) {
+        source.kind = (kind == "perf") ? Source::Kind::PERF : Source::Kind::HISTOGRAM;
+        source.path = str.substr(colon + 1);
+        return source;
+    }
+    throw ArgumentError("Invalid trace source '" + str + "'. Use perf:FILE (perf script -F event,addr output) "
+                        "or histogram:FILE (ADDRESS COUNT [r|w [SIZE]] lines)");
+}
+
+std::vector<Access> parse_perf_script(std::istream& in, ConvertStats& stats) {
+    std::vector<Access> accesses;
+    std::string line;
+    while (std::getline(in, line)) {
+        stats.lines++;
+        line = trim(line);
+        if (line.empty() || line[0] == '#') {
+            continue;
+        }
+        size_t split = line.find_last_of(" \t");
+        std::string address_field = (split == std::string::npos) ? line : line.substr(split + 1);
+        uint64_t address = 0;
+        if (!parse_address(address_field, address)) {
+            stats.skipped++;
+            continue;
+        }
+        if (accesses.size() >= TRACE_MAX_CONVERT_RECORDS) {
+            throw ConfigurationError("perf samples exceed " + std::to_string(TRACE_MAX_CONVERT_RECORDS) +
+                                     " records; record fewer samples or raise the sampling period");
+        }
+        std::string event = (split == std::string::npos) ? std::string() : line.substr(0, split);
+        std::transform(event.begin(), event.end(), event.begin(),
+                       [](unsigned char c) { return static_cast<char>(std::tolower(c)); });
+        accesses.push_back({address, TRACE_SAMPLE_ACCESS_BYTES, event.find("store") != std::string::npos});
+    }
+    return accesses;
+}
+
+std::vector<Access> parse_histogram(std::istream& in, ConvertStats& stats) {
+    std::vector<Access> accesses;
+    std::string line;
+    while (std::getline(in, line)) {
+        stats.lines++;
+        line = trim(line);
+        if (line.empty() || line[0] == '#') {
+            continue;
+        }
+        std::istringstream fields(line);
+        std::string address_field, op_field = "r";
+        unsigned long long count = 0, size = TRACE_SAMPLE_ACCESS_BYTES;
+        uint64_t address = 0;
+        if (!(fields >> address_field >> count) || !parse_address(address_field, address) || count == 0) {
+            stats.skipped++;
+            continue;
+        }
+        if (fields >> op_field) {
+            fields >> size;
+        }
+        if ((op_field != "r" && op_field != "w") || size == 0 || size > std::numeric_limits<uint16_t>::max()) {
+            stats.skipped++;
+            continue;
+        }
+        if (count > TRACE_MAX_CONVERT_RECORDS - accesses.size()) {
+            throw ConfigurationError("Histogram counts exceed " + std::to_string(TRACE_MAX_CONVERT_RECORDS) +
+                                     " records; scale the counts down");
+        }
+        accesses.insert(accesses.end(), count, Access{address, static_cast<uint16_t>(size), op_field == "w"});
+    }
+    std::mt19937_64 gen(TRACE_SHUFFLE_SEED);
+    std::shuffle(accesses.begin(), accesses.end(), gen);
+    return accesses;
+}
+
+uint64_t compact_pages(std::vector<Access>& accesses, size_t& pages) {
+    std::vector<uint64_t> page_numbers;
+    page_numbers.reserve(accesses.size());
+    for (const auto& access : accesses) {
+        page_numbers.push_back(access.offset / TRACE_PAGE_BYTES);
+    }
+    std::sort(page_numbers.begin(), page_numbers.end());
+    page_numbers.erase(std::unique(page_numbers.begin(), page_numbers.end()), page_numbers.end());
+
+    uint64_t span = 0;
+    for (auto& access : accesses) {
+        uint64_t page = std::lower_bound(page_numbers.begin(), page_numbers.end(), access.offset / TRACE_PAGE_BYTES) -
+                        page_numbers.begin();
+        access.offset = page * TRACE_PAGE_BYTES + access.offset % TRACE_PAGE_BYTES;
+        span = std::max(span, access.offset + access.size);
+    }
+    pages = page_numbers.size();
+    return (span + TRACE_PAGE_BYTES - 1) / TRACE_PAGE_BYTES * TRACE_PAGE_BYTES;
+}
+
+void write_trace(const std::string& path, const std::vector<Access>& accesses, uint64_t span_bytes) {
+    std::ofstream out(path, std::ios::binary | std::ios::trunc);
+    if (!out) {
+        throw ConfigurationError("Cannot create trace '" + path + "'");
+    }
+    FileHeader header = {};
+    std::memcpy(header.magic, TRACE_MAGIC, sizeof(TRACE_MAGIC));
+    header.version = TRACE_VERSION;
+    header.record_count = accesses.size();
+    header.span_bytes = span_bytes;
+    out.write(reinterpret_cast<const char*>(&header), sizeof(header));
+
+    std::vector<Record> block;
+    block.reserve(TRACE_BLOCK_RECORDS);
+    uint64_t previous = 0;
+    for (size_t i = 0; i < accesses.size(); ++i) {
+        const Access& access = accesses[i];
+        if (access.size == 0 || access.offset + access.size > span_bytes) {
+            throw ConfigurationError("Access " + std::to_string(i) + " of " + std::to_string(access.size) +
+                                     " bytes at offset " + std::to_string(access.offset) + " leaves the " +
+                                     std::to_string(span_bytes) + "-byte span");
+        }
+        int64_t delta = static_cast<int64_t>(access.offset) - static_cast<int64_t>(previous);
+        if (delta < std::numeric_limits<int32_t>::min() || delta > std::numeric_limits<int32_t>::max()) {
+            throw ConfigurationError("Access " + std::to_string(i) + " jumps " + std::to_string(delta) +
+                                     " bytes from the previous one; trace records encode jumps up to 2 GiB");
+        }
+        block.push_back({static_cast<int32_t>(delta), access.size, static_cast<uint8_t>(access.write ? 1 : 0), 0});
+        previous = access.offset;
+        if (block.size() == TRACE_BLOCK_RECORDS || i + 1 == accesses.size()) {
+            out.write(reinterpret_cast<const char*>(block.data()), block.size() * sizeof(Record));
+            block.clear();
+        }
+    }
+    out.flush();
+    if (!out) {
+        throw ConfigurationError("Failed to write trace '" + path + "'");
+    }
+}
+
+ConvertStats convert(const Source& source, const std::string& output_path) {
+    std::ifstream in(source.path);
+    if (!in) {
+        throw ConfigurationError("Cannot read '" + source.path + "'");
+    }
+    ConvertStats stats;
+    std::vector<Access> accesses = (source.kind == Source::Kind::PERF) ? parse_perf_script(in, stats)
+                                                                       : parse_histogram(in, stats);
+    if (accesses.empty()) {
+        throw ConfigurationError("'" + source.path + "' holds no addresses (" + std::to_string(stats.skipped) +
+                                 " lines skipped)");
+    }
+    uint64_t span = compact_pages(accesses, stats.pages);
+    write_trace(output_path, accesses, span);
+
+    for (const auto& access : accesses) {
+        tally(stats.summary, access);
+    }
+    stats.summary.span_bytes = span;
+    stats.summary.blocks = (accesses.size() + TRACE_BLOCK_RECORDS - 1) / TRACE_BLOCK_RECORDS;
+    return stats;
+}
+
+}  // namespace TraceReplay
@@ -0,0 +1,242 @@
+#ifndef TRACE_REPLAY_H
+#define TRACE_REPLAY_H
+
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <iosfwd>
+#include <string>
+#include <utility>
+#include <vector>
+
+#include "test_patterns.h"
+
+/**
+ * @brief Replay of recorded access patterns
+ *
+ * A trace is a file of fixed-size records, each an access of a number of
+ * bytes at an offset of the working set, read or written. Offsets are
+ * delta-encoded against the previous record, so a record is 8 bytes and a
+ * trace of a service's access mix stays small enough to stream from the page
+ * cache while it is replayed. The file is memory-mapped and validated once;
+ * workers then decode it block by block into a small per-thread workspace
+ * allocated before timing (a vectorizable unpack followed by the running sum
+ * of the deltas) and issue the accesses over an AlignedBuffer as large as the
+ * trace span. Decoding alone is timed separately so its share of the replay
+ * is reported next to the bandwidth.
+ *
+ * The converters build traces from `perf script -F event,addr` output of
+ * `perf mem record` samples or from an address histogram. Sampled virtual
+ * addresses are compacted: the distinct 4 KB pages are renumbered densely in
+ * address order, which keeps in-page offsets and page order but drops the
+ * gaps between mappings.
+ */
+namespace TraceReplay {
+
+/**
+ * @brief File header, little-endian as written by the host
+ */
+struct FileHeader {
+    char magic[8];            ///< "MBTRACE\0"
+    uint32_t version;         ///< TRACE_VERSION
+    uint32_t reserved;
+    uint64_t record_count;
+    uint64_t span_bytes;      ///< Working set the offsets address
+};
+
+/**
+ * @brief One encoded access
+ */
+struct Record {
+    int32_t delta;            ///< Offset minus the previous record's offset (the first: minus 0)
+    uint16_t size;            ///< Bytes accessed, 1 to 65535
+    uint8_t op;               ///< 0: read, 1: write
+    uint8_t reserved;
+};
+
+static_assert(sizeof(FileHeader) == 32, "trace header layout");
+static_assert(sizeof(Record) == 8, "trace record layout");
+
+/**
+ * @brief One access before encoding
+ */
+struct Access {
+    uint64_t offset = 0;
+    uint16_t size = 0;
+    bool write = false;
+};
+
+/**
+ * @brief Access mix of a trace
+ */
+struct Summary {
+    size_t records = 0;
+    size_t reads = 0;
+    size_t writes = 0;
+    uint64_t read_bytes = 0;
+    uint64_t write_bytes = 0;
+    uint64_t span_bytes = 0;
+    size_t blocks = 0;        ///< TRACE_BLOCK_RECORDS blocks, the unit threads split the trace by
+
+    uint64_t bytes() const { return read_bytes + write_bytes; }
+};
+
+/**
+ * @brief Read-only mapping of a validated trace file
+ */
+class Trace {
+public:
+    /**
+     * @brief Map and validate a trace
+     * @throws ConfigurationError if the file cannot be mapped, is not a trace of this version,
+     *         or a record leaves the span
+     */
+    explicit Trace(const std::string& path);
+    ~Trace();
+
+    Trace(const Trace&) = delete;
+    Trace& operator=(const Trace&) = delete;
+
+    const std::string& path() const { return path_; }
+    const Summary& summary() const { return summary_; }
+    const Record* records() const { return records_; }
+
+    /**
+     * @brief Absolute offset the deltas of a block start from
+     */
+    uint64_t block_base(size_t block) const { return block_bases_[block]; }
+
+private:
+    std::string path_;
+    void* mapping_ = nullptr;
+    size_t mapping_size_ = 0;
+    const Record* records_ = nullptr;
+    std::vector<uint64_t> block_bases_;
+    Summary summary_;
+};
+
+/**
+ * @brief Decoded records of one block, structure of arrays
+ *
+ * Allocated once per worker; replaying allocates nothing.
+ */
+struct Workspace {
+    std::vector<uint64_t> offsets;
+    std::vector<uint16_t> sizes;
+    std::vector<uint8_t> writes;
+
+    Workspace();
+};
+
+/**
+ * @brief Decode records into absolute offsets, sizes and operations
+ *
+ * @param count Records to decode, at most TRACE_BLOCK_RECORDS
+ * @param base Offset the first delta is applied to
+ */
+void decode_block(const Record* records, size_t count, uint64_t base, Workspace& workspace);
+
+/**
+ * @brief Blocks [first, last) of one thread's contiguous share of the trace
+ */
+std::pair<size_t, size_t> block_slice(size_t thread_index, size_t num_threads, size_t blocks);
+
+/**
+ * @brief Replay blocks [first_block, last_block) over buffer, iterations times
+ *
+ * Each record reads or writes the 8-byte words covering its bytes. Bytes
+ * processed are the record sizes; latency is nanoseconds per access.
+ *
+ * @param buffer Working set of at least the trace span rounded up to 8 bytes
+ */
+PerformanceStats replay(const Trace& trace, size_t first_block, size_t last_block, uint8_t* buffer,
+                        size_t iterations, Workspace& workspace, const std::atomic<bool>& stop_flag);
+
+/**
+ * @brief Decode the same blocks as replay without touching the working set
+ * @return Seconds spent decoding
+ */
+double decode_only(const Trace& trace, size_t first_block, size_t last_block, size_t iterations,
+                   Workspace& workspace);
+
+/**
+ * @brief Replay of a trace on a number of threads
+ */
+struct ReplayResult {
+    PerformanceStats stats;
+    size_t threads = 0;                ///< Threads used: at most one per block
+    size_t passes = 0;
+    double accesses_per_second = 0.0;  ///< Aggregate record rate
+    double decode_ns_per_record = 0.0; ///< Per thread, decoding alone
+    double replay_ns_per_record = 0.0; ///< Per thread, decoding and accessing
+    double decode_percent = 0.0;       ///< Share of the replay spent decoding
+};
+
+/**
+ * @brief Where a conversion reads from (--trace-convert perf:FILE or histogram:FILE)
+ */
+struct Source {
+    enum class Kind { PERF, HISTOGRAM };
+    Kind kind = Kind::PERF;
+    std::string path;
+};
+
+/**
+ * @brief Outcome of a conversion
+ */
+struct ConvertStats {
+    size_t lines = 0;
+    size_t skipped = 0;                ///< Lines without a usable address
+    size_t pages = 0;                  ///< Distinct 4 KB pages the samples touched
+    Summary summary;
+};
+
+/**
+ * @brief Parse --trace-convert
+ * @throws ArgumentError if the source is not perf:FILE or histogram:FILE
+ */
+Source parse_source(const std::string& str);
+
+/**
+ * @brief Addresses of `perf script -F event,addr` lines
+ *
+ * The last field of a line is its hexadecimal address; events naming a
+ * store are writes, everything else a read. Accesses are
+ * TRACE_SAMPLE_ACCESS_BYTES wide, since samples carry no width.
+ *
+ * @return Raw addresses, not yet compacted
+ */
+std::vector<Access> parse_perf_script(std::istream& in, ConvertStats& stats);
+
+/**
+ * @brief Addresses of histogram lines "ADDRESS COUNT [r|w [SIZE]]"
+ *
+ * Each address is repeated COUNT times and the whole expansion shuffled
+ * with a fixed seed, since a histogram records no order.
+ *
+ * @throws ConfigurationError if the expansion exceeds TRACE_MAX_CONVERT_RECORDS
+ */
+std::vector<Access> parse_histogram(std::istream& in, ConvertStats& stats);
+
+/**
+ * @brief Renumber the distinct pages of raw addresses densely, in address order
+ * @return Span of the compacted offsets, in whole pages
+ */
+uint64_t compact_pages(std::vector<Access>& accesses, size_t& pages);
+
+/**
+ * @brief Encode accesses into a trace file
+ * @throws ConfigurationError if an access leaves the span, two consecutive offsets are more
+ *         than 2 GiB apart, or the file cannot be written
+ */
+void write_trace(const std::string& path, const std::vector<Access>& accesses, uint64_t span_bytes);
+
+/**
+ * @brief Convert a source into a trace file at output_path
+ * @throws ConfigurationError if the source cannot be read or holds no address
+ */
+ConvertStats convert(const Source& source, const std::string& output_path);
+
+}  // namespace TraceReplay
+
+#endif  // TRACE_REPLAY_H
@@ -0,0 +1,167 @@
+#include "worker_pool.h"
+
+#include <algorithm>
+
+#if defined(__x86_64__) || defined(__i386__)
+#include <immintrin.h>
+#endif
+
+namespace {
+
+// Spins before a waiter starts yielding its time slice (~10-50 us of pause)
+constexpr size_t SPIN_LIMIT = 1 << 14;
+
+inline void cpu_relax() {
+#if defined(__x86_64__) || defined(__i386__)
+    _mm_pause();
+#elif defined(__aarch64__)
+    asm volatile("yield" ::: "memory");
+#endif
+}
+
+}  // namespace
+
+SpinBarrier::SpinBarrier(size_t count) : count_(count), remaining_(count), generation_(0) {}
+
+void SpinBarrier::reset(size_t count) {
+    count_ = count;
+    remaining_.store(count, std::memory_order_relaxed);
+}
+
+void SpinBarrier::arrive_and_wait() {
+    size_t generation = generation_.load(std::memory_order_acquire);
+    if (remaining_.fetch_sub(1, std::memory_order_acq_rel) == 1) {
+        // Last arrival re-arms the barrier, then releases everyone
+        remaining_.store(count_, std::memory_order_relaxed);
+        generation_.fetch_add(1, std::memory_order_release);
+        return;
+    }
+
+    size_t spins = 0;
+    while (generation_.load(std::memory_order_acquire) == generation) {
+        if (++spins < SPIN_LIMIT) {
+            cpu_relax();
+        } else {
+            std::this_thread::yield();
+        }
+    }
+}
+
+WorkerPool::~WorkerPool() {
+    {
+        std::lock_guard<std::mutex> lock(mutex_);
+        shutdown_ = true;
+    }
+    dispatch_cv_.notify_all();
+    for (auto& worker : workers_) {
+        worker.join();
+    }
+}
+
+std::vector<ThreadTiming> WorkerPool::run(size_t num_threads, const Task& task) {
+    if (num_threads == 0) {
+        return {};
+    }
+    grow(num_threads);
+
+    {
+        std::lock_guard<std::mutex> lock(mutex_);
+        task_ = &task;
+        active_threads_ = num_threads;
+        pending_ = num_threads;
+        error_ = nullptr;
+        timings_.assign(num_threads, ThreadTiming{});
+        start_barrier_.reset(num_threads);
+        ++generation_;
+    }
+    dispatch_cv_.notify_all();
+
+    {
+        std::unique_lock<std::mutex> lock(mutex_);
+        done_cv_.wait(lock, [this] { return pending_ == 0; });
+        task_ = nullptr;
+    }
+
+    if (error_) {
+        std::rethrow_exception(error_);
+    }
+    return timings_;
+}
+
+double WorkerPool::overlap_seconds(const std::vector<ThreadTiming>& timings) {
+    if (timings.empty()) {
+        return 0.0;
+    }
+    auto latest_start = timings.front().start;
+    auto earliest_end = timings.front().end;
+    for (const auto& timing : timings) {
+        latest_start = std::max(latest_start, timing.start);
+        earliest_end = std::min(earliest_end, timing.end);
+    }
+    double overlap = std::chrono::duration<double>(earliest_end - latest_start).count();
+    return std::max(0.0, overlap);
+}
+
+double WorkerPool::span_seconds(const std::vector<ThreadTiming>& timings) {
+    if (timings.empty()) {
+        return 0.0;
+    }
+    auto earliest_start = timings.front().start;
+    auto latest_end = timings.front().end;
+    for (const auto& timing : timings) {
+        earliest_start = std::min(earliest_start, timing.start);
+        latest_end = std::max(latest_end, timing.end);
+    }
+    return std::chrono::duration<double>(latest_end - earliest_start).count();
+}
+
+void WorkerPool::grow(size_t num_threads) {
+    size_t generation;
+    {
+        std::lock_guard<std::mutex> lock(mutex_);
+        generation = generation_;
+    }
+    // New workers only react to dispatches issued after they were created
+    while (workers_.size() < num_threads) {
+        size_t thread_id = workers_.size();
+        workers_.emplace_back([this, thread_id, generation] { worker_loop(thread_id, generation); });
+    }
+}
+
+void WorkerPool::worker_loop(size_t thread_id, size_t seen_generation) {
+    for (;;) {
+        const Task* task = nullptr;
+        {
+            std::unique_lock<std::mutex> lock(mutex_);
+            dispatch_cv_.wait(lock, [&] { return shutdown_ || generation_ != seen_generation; });
+            if (shutdown_) {
+                return;
+            }
+            seen_generation = generation_;
+            if (thread_id >= active_threads_) {
+                continue;  // Not part of this run
+            }
+            task = task_;
+        }
+
+        // Wake-ups from the condition variable are staggered; the barrier lines them up
+        start_barrier_.arrive_and_wait();
+        ThreadTiming timing;
+        timing.start = std::chrono::high_resolution_clock::now();
+        try {
+            (*task)(thread_id);
+        } catch (...) {
+            std::lock_guard<std::mutex> lock(mutex_);
+            if (!error_) {
+                error_ = std::current_exception();
+            }
+        }
+        timing.end = std::chrono::high_resolution_clock::now();
+        timings_[thread_id] = timing;  // Each worker owns its own slot
+
+        std::lock_guard<std::mutex> lock(mutex_);
+        if (--pending_ == 0) {
+            done_cv_.notify_one();
+        }
+    }
+}
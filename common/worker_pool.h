@@ -0,0 +1,114 @@
+#ifndef WORKER_POOL_H
+#define WORKER_POOL_H
+
+#include <atomic>
+#include <chrono>
+#include <condition_variable>
+#include <cstddef>
+#include <exception>
+#include <functional>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+/**
+ * @brief Reusable barrier whose waiters spin instead of sleeping
+ *
+ * Release latency is a few hundred nanoseconds rather than a futex wake-up
+ * per thread, so every participant leaves within a narrow window. Waiters
+ * yield after a bounded number of spins so oversubscribed runs still progress.
+ */
+class SpinBarrier {
+public:
+    explicit SpinBarrier(size_t count = 1);
+
+    /**
+     * @brief Set the number of participants (only while no thread is waiting)
+     */
+    void reset(size_t count);
+
+    /**
+     * @brief Block until all participants have arrived
+     */
+    void arrive_and_wait();
+
+private:
+    size_t count_;
+    std::atomic<size_t> remaining_;
+    std::atomic<size_t> generation_;
+};
+
+/**
+ * @brief Wall-clock interval one worker spent in a task
+ */
+struct ThreadTiming {
+    std::chrono::high_resolution_clock::time_point start;  ///< Taken right after the start barrier released
+    std::chrono::high_resolution_clock::time_point end;    ///< Taken when the task returned
+};
+
+/**
+ * @brief Persistent pool of worker threads for measurements
+ *
+ * Workers are created once and reused, so thread creation, affinity
+ * syscalls and stack faults stay out of measured time. Each run releases
+ * its workers from a common spin barrier and records per-thread timestamps;
+ * callers derive bandwidth from the interval in which all of them overlap.
+ * Worker i always serves thread_id i, so affinity set by one run persists.
+ */
+class WorkerPool {
+public:
+    using Task = std::function<void(size_t thread_id)>;
+
+    WorkerPool() = default;
+    ~WorkerPool();
+
+    WorkerPool(const WorkerPool&) = delete;
+    WorkerPool& operator=(const WorkerPool&) = delete;
+
+    /**
+     * @brief Run a task on workers 0..num_threads-1 and wait for all of them
+     *
+     * Grows the pool on first use of a larger thread count.
+     *
+     * @param num_threads Number of workers to run the task on
+     * @param task Called once per worker with its thread id
+     * @return Per-thread start/end timestamps, indexed by thread id
+     * @throws Rethrows the first exception raised by a task
+     */
+    std::vector<ThreadTiming> run(size_t num_threads, const Task& task);
+
+    /**
+     * @brief Number of workers created so far
+     */
+    size_t size() const noexcept { return workers_.size(); }
+
+    /**
+     * @brief Length of the interval in which every thread was running
+     * @return max(0, earliest end - latest start) in seconds
+     */
+    static double overlap_seconds(const std::vector<ThreadTiming>& timings);
+
+    /**
+     * @brief Length of the interval from the first start to the last end in seconds
+     */
+    static double span_seconds(const std::vector<ThreadTiming>& timings);
+
+private:
+    void grow(size_t num_threads);
+    void worker_loop(size_t thread_id, size_t seen_generation);
+
+    std::vector<std::thread> workers_;
+    std::mutex mutex_;
+    std::condition_variable dispatch_cv_;
+    std::condition_variable done_cv_;
+    const Task* task_ = nullptr;
+    size_t active_threads_ = 0;
+    size_t generation_ = 0;
+    size_t pending_ = 0;
+    bool shutdown_ = false;
+    SpinBarrier start_barrier_;
+    std::vector<ThreadTiming> timings_;
+    std::exception_ptr error_;
+};
+
+#endif  // WORKER_POOL_H
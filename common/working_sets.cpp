@@ -1,6 +1,8 @@
 #include "working_sets.h"
 #include "constants.h"
+#include "errors.h"
 #include <algorithm>
+#include <cmath>
 
 using namespace BenchmarkConstants;
 
@@ -101,16 +103,32 @@ WorkingSetSizes::WorkingSetSizes(const CacheInfo& cache_info) {
     }
 }
 
+size_t WorkingSetSizes::threads_per_instance(const std::vector<std::vector<size_t>>& sharing,
+                                             const std::vector<size_t>& thread_cpus, size_t fallback) {
+    if(sharing.empty() || thread_cpus.empty()) {
+        return std::max<size_t>(fallback, 1);
+    }
+    size_t busiest = 1;
+    for(const auto& instance : sharing) {
+        size_t threads = static_cast<size_t>(std::count_if(thread_cpus.begin(), thread_cpus.end(), [&instance](size_t cpu) {
+            return std::find(instance.begin(), instance.end(), cpu) != instance.end();
+        }));
+        busiest = std::max(busiest, threads);
+    }
+    return busiest;
+}
+
 std::pair<std::vector<size_t>, std::vector<std::string>> 
-WorkingSetSizes::get_thread_aware_sizes(const CacheInfo& cache_info, size_t num_threads) {
+WorkingSetSizes::get_thread_aware_sizes(const CacheInfo& cache_info, size_t num_threads,
+                                        const std::vector<size_t>& thread_cpus) {
     const size_t min_size = MIN_WORKING_SET_SIZE;
     const size_t max_size = MAX_WORKING_SET_SIZE;
 
     std::vector<size_t> sizes;
     std::vector<std::string> descriptions;
 
-    // L1 cache working sets - L1 is per-core, give full cache to each thread
-    size_t l1_per_thread = cache_info.l1_data_size;
+    // L1 cache working sets - per-core, split only between SMT siblings
+    size_t l1_per_thread = cache_info.l1_data_size / threads_per_instance(cache_info.l1d_sharing, thread_cpus, 1);
     if(l1_per_thread / WORKING_SET_FRACTIONS[1] >= min_size) {
         sizes.push_back(l1_per_thread / 4);
         descriptions.push_back("1/4 L1 per thread");
@@ -124,8 +142,8 @@ WorkingSetSizes::get_thread_aware_sizes(const CacheInfo& cache_info, size_t num_
         descriptions.push_back("L1 per thread");
     }
 
-    // L2 cache working sets - L2 is per-core on Apple Silicon, give full cache to each thread
-    size_t l2_per_thread = cache_info.l2_size;
+    // L2 cache working sets - per-core on most x86 parts, per-cluster on Apple Silicon and many Arm parts
+    size_t l2_per_thread = cache_info.l2_size / threads_per_instance(cache_info.l2_sharing, thread_cpus, 1);
     if(l2_per_thread / WORKING_SET_FRACTIONS[1] >= min_size) {
         sizes.push_back(l2_per_thread / 4);
         descriptions.push_back("1/4 L2 per thread");
@@ -139,8 +157,9 @@ WorkingSetSizes::get_thread_aware_sizes(const CacheInfo& cache_info, size_t num_
         descriptions.push_back("L2 per thread");
     }
 
-    // SLC/L3 cache working sets - shared cache, split across threads
-    size_t l3_per_thread = cache_info.l3_size / num_threads;
+    // SLC/L3 cache working sets - shared cache, split across the threads of one instance (one CCX on Zen)
+    size_t l3_per_thread =
+        cache_info.l3_size / threads_per_instance(cache_info.l3_sharing, thread_cpus, num_threads);
     if(l3_per_thread / WORKING_SET_FRACTIONS[1] >= min_size) {
         sizes.push_back(l3_per_thread / 4);
         descriptions.push_back("1/4 SLC per thread");
@@ -187,4 +206,46 @@ WorkingSetSizes::get_thread_aware_sizes(const CacheInfo& cache_info, size_t num_
     }
 
     return {sizes, descriptions};
-}
\ No newline at end of file
+}
+
+std::vector<size_t> WorkingSetSizes::get_sweep_sizes(size_t max_size, size_t steps_per_octave) {
+    std::vector<size_t> sizes;
+    if(steps_per_octave == 0) {
+        return sizes;
+    }
+
+    const size_t line = CacheConstants::DEFAULT_CACHE_LINE_SIZE;
+    for(size_t step = 0;; ++step) {
+        double exact = MIN_WORKING_SET_SIZE * std::exp2(static_cast<double>(step) / steps_per_octave);
+        if(exact > static_cast<double>(max_size) * (1.0 + 1e-9)) {
+            break;
+        }
+        size_t size = std::min(static_cast<size_t>(exact), max_size) / line * line;
+        if(sizes.empty() || size > sizes.back()) {
+            sizes.push_back(size);
+        }
+    }
+    return sizes;
+}
+
+size_t WorkingSetSizes::parse_sweep(const std::string& spec) {
+    const std::string prefix = "log2:";
+    size_t steps = 0;
+    if(spec.rfind(prefix, 0) == 0) {
+        std::string value = spec.substr(prefix.size());
+        try {
+            size_t parsed = 0;
+            steps = std::stoul(value, &parsed);
+            if(parsed != value.size()) {
+                steps = 0;
+            }
+        } catch (const std::exception&) {
+            steps = 0;
+        }
+    }
+    if(steps == 0 || steps > SWEEP_MAX_STEPS_PER_OCTAVE) {
+        throw ArgumentError("Invalid sweep '" + spec + "'. Expected log2:STEPS with 1 to " +
+                            std::to_string(SWEEP_MAX_STEPS_PER_OCTAVE) + " steps per octave");
+    }
+    return steps;
+}
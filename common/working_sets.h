@@ -25,12 +25,52 @@ public:
 
     /**
      * @brief Get working set sizes adjusted for thread count
+     *
+     * Each "per thread" size is one cache instance divided by the threads
+     * that share it. With thread_cpus and the sharing lists of cache_info,
+     * that is the busiest instance under the actual placement (eight
+     * threads on one CCX split its L3 eight ways whatever the thread
+     * total); without them L1 and L2 are taken as private and L3 as one
+     * instance shared by every thread.
+     *
      * @param cache_info Reference to cache information structure
      * @param num_threads Number of threads to use
+     * @param thread_cpus CPU each thread runs on (empty: unknown)
      * @return Pair of sizes and descriptions adjusted for thread count
      */
     static std::pair<std::vector<size_t>, std::vector<std::string>> 
-    get_thread_aware_sizes(const CacheInfo& cache_info, size_t num_threads);
+    get_thread_aware_sizes(const CacheInfo& cache_info, size_t num_threads,
+                           const std::vector<size_t>& thread_cpus = {});
+
+    /**
+     * @brief Threads sharing the busiest instance of a cache level
+     * @param sharing CPUs of each instance (CacheInfo::l2_sharing, ...)
+     * @param thread_cpus CPU each thread runs on
+     * @param fallback Returned when sharing or thread_cpus is empty
+     * @return At least 1
+     */
+    static size_t threads_per_instance(const std::vector<std::vector<size_t>>& sharing,
+                                       const std::vector<size_t>& thread_cpus, size_t fallback);
+
+    /**
+     * @brief Geometric ladder of working sets for the --sweep mode
+     *
+     * Sizes grow by 2^(1/steps_per_octave) from MIN_WORKING_SET_SIZE up to
+     * and including max_size, rounded down to whole cache lines; steps that
+     * round to the same size are emitted once.
+     *
+     * @param max_size Largest working set in bytes
+     * @param steps_per_octave Sizes per doubling
+     * @return Sizes in increasing order
+     */
+    static std::vector<size_t> get_sweep_sizes(size_t max_size, size_t steps_per_octave);
+
+    /**
+     * @brief Parse a --sweep specification ("log2:STEPS")
+     * @return Steps per octave
+     * @throws ArgumentError if the specification is malformed or out of range
+     */
+    static size_t parse_sweep(const std::string& spec);
 };
 
 #endif  // WORKING_SETS_H
\ No newline at end of file
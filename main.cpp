@@ -1,5 +1,6 @@
 #include <algorithm>
 #include <atomic>
+#include <cerrno>
 #include <chrono>
 #include <cmath>
 #include <cstdint>
@@ -12,13 +13,17 @@
 #include <random>
 #include <sstream>
 #include <thread>
+#include <tuple>
+#include <utility>
 #include <vector>
+#include <sys/resource.h>
 
 // Common includes
 #include "common/memory_types.h"
 #include "common/platform_interface.h"
 #include "common/working_sets.h"
 #include "common/output_formatter.h"
+#include "common/output_formatter_utils.h"
 #include "common/standard_tests.h"
 #include "common/matrix_multiply_interface.h"
 #include "common/test_patterns.h"
@@ -28,6 +33,45 @@
 #include "common/constants.h"
 #include "common/errors.h"
 #include "common/aligned_buffer.h"
+#include "common/simd_kernels.h"
+#include "common/pointer_chase.h"
+#include "common/access_patterns.h"
+#include "common/encoded_scans.h"
+#include "common/proxy_kernels.h"
+#include "common/irregular_kernels.h"
+#include "common/kernel_matrix.h"
+#include "common/cold_cache.h"
+#include "common/cycle_timer.h"
+#include "common/prefetch_control.h"
+#include "common/atomic_tests.h"
+#include "common/allocator_bench.h"
+#include "common/thread_scaling.h"
+#include "common/contention.h"
+#include "common/soak.h"
+#include "common/cpu_topology.h"
+#include "common/coherence_tests.h"
+#include "common/numa_utils.h"
+#include "common/page_allocator.h"
+#include "common/worker_pool.h"
+#include "common/sample_stats.h"
+#include "common/calibration.h"
+#include "common/result_validation.h"
+#include "common/perf_counters.h"
+#include "common/io_tests.h"
+#include "common/mapping_tests.h"
+#include "common/tlb_sweep.h"
+#include "common/ring_transfer.h"
+#include "common/copy_sweep.h"
+#include "common/memory_tiers.h"
+#include "common/gpu_bandwidth.h"
+#include "common/trace_replay.h"
+#include "common/ndjson_sink.h"
+#include "common/fleet.h"
+#include "common/baseline.h"
+#include "common/peak_calibration.h"
+#include "common/system_probe.h"
+#include "common/memory_bandwidth_tester.h"
+#include "common/pattern_registry.h"
 
 using namespace BenchmarkConstants;
 
@@ -54,323 +98,13 @@ std::string format_memory_size(double size_gb) {
     return result + "GB";
 }
 
-/**
- * @brief Memory Bandwidth Tester class
- */
-class MemoryBandwidthTester {
-private:
-    std::unique_ptr<PlatformInterface> platform;
-    CacheInfo cache_info;
-    WorkingSetSizes working_sets;
-    std::vector<AlignedBuffer> buffers;
-    std::vector<uint8_t*> aligned_buffers; // Keep for compatibility with existing test functions
-    size_t current_buffer_size;
-    std::atomic<bool> stop_flag;
-    OutputFormatter formatter;
-    size_t cache_line_size;
-    SystemInfo cached_system_info;
-    CPUAffinityType cpu_affinity;
-
-public:
-    MemoryBandwidthTester(OutputFormat output_format = OutputFormat::MARKDOWN, 
-                         CPUAffinityType affinity_type = CPUAffinityType::DEFAULT)
-        : platform(create_platform_interface()),
-          cache_info(platform->get_core_specific_cache_info(affinity_type)),
-          working_sets(cache_info),
-          stop_flag(false),
-          formatter(output_format),
-          cache_line_size(platform->detect_cache_line_size()),
-          cached_system_info(platform->get_system_info()),
-          cpu_affinity(affinity_type) {}
-
-    ~MemoryBandwidthTester() {
-        cleanup_buffers();
-    }
-
-    /**
-     * @brief Allocate cache-aligned memory buffers for testing
-     * 
-     * @param total_size Total memory to allocate across all buffers
-     * @param num_buffers Number of separate buffers to create
-     * @return true if allocation succeeded, throws MemoryError on failure
-     */
-    bool allocate_buffers(size_t total_size, size_t num_buffers) {
-        if(total_size == 0 || num_buffers == 0) {
-            throw MemoryError("Invalid buffer allocation parameters: total_size=" + 
-                            std::to_string(total_size) + ", num_buffers=" + std::to_string(num_buffers));
-        }
-
-        size_t buffer_size = MemoryUtils::calculate_buffer_size(total_size, num_buffers, cache_line_size);
-        if(buffer_size == 0) {
-            throw MemoryError("Buffer size too small: calculated size=" + std::to_string(buffer_size) + 
-                            " bytes, minimum required=" + std::to_string(MIN_BUFFER_SIZE) + " bytes");
-        }
-
-        cleanup_buffers();
-        current_buffer_size = buffer_size;
-
-        try {
-            buffers.reserve(num_buffers);
-            aligned_buffers.reserve(num_buffers);
-            
-            for(size_t i = 0; i < num_buffers; ++i) {
-                // Create aligned buffer using RAII - automatically handles alignment and initialization
-                buffers.emplace_back(buffer_size, cache_line_size);
-                
-                // Verify alignment was achieved
-                if (!buffers.back().is_aligned()) {
-                    throw MemoryError("Failed to achieve cache line alignment for buffer " + std::to_string(i));
-                }
-                
-                // Store pointer for compatibility with existing test functions
-                aligned_buffers.push_back(buffers.back().data());
-            }
-        } catch (const std::bad_alloc& e) {
-            cleanup_buffers();
-            throw MemoryError("Failed to allocate buffer of size " + std::to_string(buffer_size) + " bytes: " + e.what());
-        } catch (const std::invalid_argument& e) {
-            cleanup_buffers();
-            throw MemoryError("Invalid buffer parameters: " + std::string(e.what()));
-        }
-        return true;
-    }
-
-    /**
-     * @brief Clean up allocated memory buffers
-     * 
-     * Uses RAII pattern - AlignedBuffer destructors automatically handle cleanup
-     */
-    void cleanup_buffers() {
-        // RAII: AlignedBuffer destructors automatically handle memory cleanup
-        buffers.clear();
-        aligned_buffers.clear();
-    }
-
-    /**
-     * @brief Execute a memory bandwidth test with specified parameters
-     * 
-     * @param pattern Test pattern to execute (sequential read/write, random, copy, triad)
-     * @param iterations Number of test iterations to run
-     * @param num_threads Number of threads to use for the test
-     * @param cache_aware Whether to run cache-hierarchy-aware variant
-     * @return PerformanceStats containing bandwidth, latency, and timing results
-     */
-    PerformanceStats run_test(TestPattern pattern, size_t iterations, size_t num_threads, bool cache_aware = false) {
-        if(aligned_buffers.empty()) return {0.0, 0.0, 0, 0.0};
-
-        size_t buffer_size = current_buffer_size;
-        size_t bytes_per_thread = buffer_size / num_threads;
-
-        std::vector<std::thread> threads;
-        std::vector<PerformanceStats> thread_results(num_threads);
-
-        auto start_time = std::chrono::high_resolution_clock::now();
-
-        for(size_t i = 0; i < num_threads; ++i) {
-            size_t start_offset = i * bytes_per_thread;
-            size_t end_offset = (i == num_threads - 1) ? buffer_size : (i + 1) * bytes_per_thread;
-
-            threads.emplace_back([this, pattern, start_offset, end_offset, iterations, i,
-                                  &thread_results, buffer_size, cache_aware, num_threads]() {
-                // Set thread affinity
-                platform->set_thread_affinity(i, cpu_affinity, num_threads);
-
-                switch(pattern) {
-                    case TestPattern::SEQUENTIAL_READ:
-                        thread_results[i] = StandardTests::sequential_read_test(
-                            aligned_buffers[0], buffer_size, start_offset, end_offset, iterations,
-                            stop_flag, cache_aware);
-                        break;
-                    case TestPattern::SEQUENTIAL_WRITE:
-                        thread_results[i] = StandardTests::sequential_write_test(
-                            aligned_buffers[0], buffer_size, start_offset, end_offset, iterations,
-                            stop_flag);
-                        break;
-                    case TestPattern::RANDOM_READ:
-                        thread_results[i] = StandardTests::random_access_test(
-                            aligned_buffers[0], buffer_size, start_offset, end_offset, iterations,
-                            false, stop_flag);
-                        break;
-                    case TestPattern::RANDOM_WRITE:
-                        thread_results[i] = StandardTests::random_access_test(
-                            aligned_buffers[0], buffer_size, start_offset, end_offset, iterations,
-                            true, stop_flag);
-                        break;
-                    case TestPattern::COPY:
-                        if(aligned_buffers.size() >= 2) {
-                            thread_results[i] = StandardTests::copy_test(
-                                aligned_buffers[0], aligned_buffers[1], buffer_size, start_offset,
-                                end_offset, iterations, stop_flag);
-                        }
-                        break;
-                    case TestPattern::TRIAD:
-                        if(aligned_buffers.size() >= 4) {
-                            thread_results[i] = StandardTests::triad_test(
-                                aligned_buffers[0], aligned_buffers[1], aligned_buffers[2],
-                                aligned_buffers[3], buffer_size, start_offset, end_offset,
-                                iterations, stop_flag);
-                        }
-                        break;
-                    case TestPattern::MATRIX_MULTIPLY: {
-                        // Matrix multiplication uses different parameters
-                        size_t matrix_size;
-                        if (cache_aware && buffer_size > 0) {
-                            // In cache-aware mode, calculate matrix size based on working set
-                            // Each matrix needs M*K + K*N + M*N elements (3 matrices total)
-                            // Assuming square matrices (M=K=N), that's 3*N^2 elements
-                            // Working set is divided among threads, and we want 3 matrices to fit
-                            size_t bytes_per_matrix_set = buffer_size / num_threads;
-                            size_t elements_per_matrix_set = bytes_per_matrix_set / sizeof(float);
-                            matrix_size = static_cast<size_t>(std::sqrt(elements_per_matrix_set / 3.0));
-                            // Ensure minimum matrix size for meaningful computation
-                            matrix_size = std::max(matrix_size, static_cast<size_t>(8));
-                            // Cap at reasonable size to prevent excessive computation for small caches
-                            matrix_size = std::min(matrix_size, static_cast<size_t>(512));
-                        } else {
-                            matrix_size = 1024;  // Default matrix size for non-cache-aware mode
-                        }
-                        
-                        MatrixMultiply::MatrixConfig matrix_config = 
-                            MatrixMultiply::create_matrix_config(matrix_size, iterations, false);
-                        
-                        auto matrix_stats = StandardTests::matrix_multiply_test(matrix_config, stop_flag);
-                        
-                        // Convert matrix stats to PerformanceStats for compatibility
-                        PerformanceStats stats;
-                        stats.bandwidth_gbps = matrix_stats.bandwidth_gbps;
-                        stats.latency_ns = matrix_stats.latency_ns;
-                        stats.bytes_processed = matrix_stats.bytes_processed;
-                        stats.time_seconds = matrix_stats.time_seconds;
-                        thread_results[i] = stats;
-                        break;
-                    }
-                }
-            });
-        }
-
-        for(auto& thread : threads) {
-            thread.join();
-        }
-
-        auto end_time = std::chrono::high_resolution_clock::now();
-        double total_time = std::chrono::duration<double>(end_time - start_time).count();
-
-        return aggregate_stats(thread_results, total_time);
-    }
-
-    std::vector<TestResult> run_cache_aware_test(TestPattern pattern, size_t iterations, size_t num_threads) {
-        std::vector<TestResult> results;
-        auto [sizes, descriptions] = WorkingSetSizes::get_thread_aware_sizes(cache_info, num_threads);
-
-        for(size_t i = 0; i < sizes.size(); ++i) {
-            size_t working_set_size = sizes[i];
-            if(working_set_size < MIN_WORKING_SET_SIZE) continue;
-
-            try {
-                if(!allocate_buffers(working_set_size, 4)) continue;
-            } catch (const MemoryError& e) {
-                // Skip this working set size if allocation fails
-                std::cerr << "Warning: " << e.what() << ". Skipping working set size." << std::endl;
-                continue;
-            }
-
-            size_t scaled_iterations;
-            if (pattern == TestPattern::MATRIX_MULTIPLY) {
-                // Matrix multiplication is computationally intensive, so use fewer iterations
-                scaled_iterations = std::max(static_cast<size_t>(1), iterations / 10);
-            } else {
-                scaled_iterations = MemoryUtils::scale_iterations(iterations, working_set_size);
-            }
-
-            PerformanceStats stats = run_test(pattern, scaled_iterations, num_threads, true);
-
-            TestResult result;
-            result.test_name = get_pattern_name(pattern);
-            result.working_set_desc = descriptions[i];
-            result.stats = stats;
-            result.num_threads = num_threads;
-            result.pattern_name = get_pattern_name(pattern);
-
-            results.push_back(result);
-        }
-        return results;
-    }
-
-
-    void print_cache_results(const std::string& pattern_name, const std::vector<TestResult>& results) {
-        std::cout << formatter.format_cache_aware_results(pattern_name, results, cached_system_info.memory_specs);
-    }
-
-    const SystemInfo& get_cached_system_info() const {
-        return cached_system_info;
-    }
-
-private:
-    /**
-     * @brief Aggregates performance statistics from multiple threads
-     * 
-     * Combines thread-level performance statistics into a single aggregate result.
-     * Calculates total bytes processed across all threads and computes aggregate
-     * bandwidth based on total time. Latency is calculated based on cache line
-     * accesses and total execution time.
-     * 
-     * @param thread_results Vector of performance statistics from individual threads
-     * @param total_time Total execution time in seconds for the entire test
-     * @return Aggregated performance statistics with combined metrics
-     */
-    PerformanceStats aggregate_stats(const std::vector<PerformanceStats>& thread_results, double total_time) {
-        PerformanceStats aggregated{};
-        aggregated.time_seconds = total_time;
-
-        for(const auto& result : thread_results) {
-            aggregated.bytes_processed += result.bytes_processed;
-        }
-
-        if(total_time > 0.0) {
-            aggregated.bandwidth_gbps = aggregated.bytes_processed / (total_time * 1e9);
-        }
-
-        if(aggregated.bytes_processed > 0) {
-            size_t cache_line_size = CacheConstants::DEFAULT_CACHE_LINE_SIZE;
-            size_t accesses = aggregated.bytes_processed / cache_line_size;
-            if(accesses > 0) {
-                aggregated.latency_ns = (total_time * 1e9) / accesses;
-            } else {
-                aggregated.latency_ns = 0.0;
-            }
-        } else {
-            aggregated.latency_ns = 0.0;
-        }
-
-        return aggregated;
-    }
-};
-
-
 std::vector<TestPattern> parse_patterns(const std::string& pattern_str) {
     std::vector<TestPattern> patterns;
     
     if(pattern_str == "all") {
-        patterns = {TestPattern::SEQUENTIAL_READ, TestPattern::SEQUENTIAL_WRITE,
-                    TestPattern::RANDOM_READ, TestPattern::RANDOM_WRITE,
-                    TestPattern::COPY, TestPattern::TRIAD, TestPattern::MATRIX_MULTIPLY};
+        patterns = PatternRegistry::defaults();
     } else {
-        static const std::map<std::string, TestPattern> pattern_map = {
-            {"sequential_read", TestPattern::SEQUENTIAL_READ},
-            {"sequential_write", TestPattern::SEQUENTIAL_WRITE},
-            {"random_read", TestPattern::RANDOM_READ},
-            {"random_write", TestPattern::RANDOM_WRITE},
-            {"copy", TestPattern::COPY},
-            {"triad", TestPattern::TRIAD},
-            {"matrix_multiply", TestPattern::MATRIX_MULTIPLY}
-        };
-        
-        auto it = pattern_map.find(pattern_str);
-        if (it != pattern_map.end()) {
-            patterns.push_back(it->second);
-        } else {
-            throw ArgumentError("Unknown pattern '" + pattern_str + "'");
-        }
+        patterns.push_back(PatternRegistry::parse(pattern_str));
     }
     return patterns;
 }
@@ -387,6 +121,12 @@ int main(int argc, char* argv[]) {
             return 0;
         }
         
+        // The host is detected in the background while the run is set up, unless this boot's probe is on file
+        SystemProbe::Probe& probe = SystemProbe::shared();
+        std::string boot = SystemProbe::boot_id();
+        bool probe_cached = !config.system_cache.empty() && probe.load(config.system_cache, boot);
+        probe.start(config.cpu_affinity);
+        
         if (config.show_info) {
             std::cout << "Memory Bandwidth Test Tool - System Information\n\n";
             auto platform = create_platform_interface();
@@ -395,49 +135,723 @@ int main(int argc, char* argv[]) {
             return 0;
         }
 
-        // Platform-specific CPU affinity validation
-        if (config.cpu_affinity == CPUAffinityType::P_CORES && config.num_threads > 12) {
-            std::cerr << "Error: P-cores are limited to 12 threads (requested: " << config.num_threads << ")" << std::endl;
-            return 1;
+        // Converting a trace measures nothing: it only prepares the file a later --trace run replays
+        if (!config.trace_convert_str.empty()) {
+            TraceReplay::Source source = TraceReplay::parse_source(config.trace_convert_str);
+            TraceReplay::ConvertStats stats = TraceReplay::convert(source, config.trace_path);
+            std::cout << "Converted " << stats.summary.records << " accesses from " << source.path << " into "
+                      << config.trace_path << ": " << stats.summary.reads << " reads, " << stats.summary.writes
+                      << " writes over " << stats.pages << " pages ("
+                      << OutputFormatterUtils::format_byte_size(stats.summary.span_bytes) << "), " << stats.skipped
+                      << " lines skipped\n";
+            return 0;
+        }
+
+        // An agent runs what its coordinator sends and a coordinator measures nothing itself
+        if (!config.agent_port_str.empty()) {
+            if (!Fleet::forwarded_args(argc, argv).empty()) {
+                throw ArgumentError("--agent takes its run options from the coordinator; give it only --agent PORT.");
+            }
+            Fleet::Validator validate = [&](const std::vector<std::string>& args) -> std::string {
+                std::vector<char*> arguments = {argv[0]};
+                for (const auto& arg : args) {
+                    arguments.push_back(const_cast<char*>(arg.c_str()));
+                }
+                try {
+                    ArgumentParser(argv[0], "").parse(static_cast<int>(arguments.size()), arguments.data());
+                } catch (const std::exception& e) {
+                    return e.what();
+                }
+                return "";
+            };
+            Fleet::serve(Fleet::parse_port(config.agent_port_str, "--agent"), Fleet::executable_path(argv[0]),
+                         validate);
+            return 0;
         }
-        if (config.cpu_affinity == CPUAffinityType::E_CORES && config.num_threads > 4) {
-            std::cerr << "Error: E-cores are limited to 4 threads (requested: " << config.num_threads << ")" << std::endl;
-            return 1;
+        if (!config.coordinate_str.empty()) {
+            std::vector<Fleet::Endpoint> agents = Fleet::parse_endpoints(config.coordinate_str);
+            std::cerr << "Coordinating a fleet run on " << agents.size() << " agent" << (agents.size() == 1 ? "" : "s")
+                      << "\n";
+            Fleet::Report report = Fleet::coordinate(agents, Fleet::forwarded_args(argc, argv), config.ndjson_path);
+            OutputFormatter formatter(string_to_format(config.format_str));
+            std::cout << formatter.format_fleet_report(report);
+            bool all_ok = std::all_of(report.hosts.begin(), report.hosts.end(),
+                                      [](const Fleet::HostRun& host) { return host.accepted && host.exit_code == 0; });
+            return all_ok ? 0 : 1;
+        }
+
+        // Platform-specific CPU affinity validation against the detected core types
+        if (config.cpu_affinity != CPUAffinityType::DEFAULT) {
+            auto platform = create_platform_interface();
+            std::string error_msg;
+            if (!platform->validate_thread_count(config.num_threads, config.cpu_affinity, error_msg)) {
+                std::cerr << "Error: " << error_msg << std::endl;
+                return 1;
+            }
         }
 
         OutputFormat output_format = string_to_format(config.format_str);
-        MemoryBandwidthTester tester(output_format, config.cpu_affinity);
+        KernelType kernel = SimdKernels::string_to_kernel_type(config.kernel_str);
+        std::vector<StorePolicy> store_policies =
+            SimdKernels::parse_store_policies(config.store_policy_str, kernel);
+        std::vector<MatrixMultiply::MatrixPrecision> precisions;
+        MatrixMultiply::parse_precisions(config.precision_str, precisions);
+        PointerChase::ChaseConfig chase_config = PointerChase::parse_chase_mode(config.chase_str);
+        PageMode page_mode = PageAllocator::string_to_page_mode(config.pages_str);
+        MemoryBandwidthTester tester(output_format, config.cpu_affinity, kernel, chase_config, page_mode);
+        if(!config.iterations_set) {
+            Calibration::Settings calibration;
+            calibration.time_budget_seconds = config.time_budget_seconds;
+            tester.set_calibration(calibration);
+        }
+        if(!config.file_dir.empty()) {
+            FileOptions file;
+            file.directory = config.file_dir;
+            file.populate = config.file_populate;
+            if(!config.madvise_str.empty()) {
+                file.advice = PageAllocator::string_to_file_advice(config.madvise_str);
+            }
+            if(!config.file_cache_str.empty()) {
+                file.cache = PageAllocator::string_to_file_cache(config.file_cache_str);
+            }
+            tester.set_file_backing(file);
+        }
+        if(config.counters && !tester.enable_counters()) {
+            std::cerr << "Warning: hardware counters are not available (no PMU access or insufficient "
+                         "privileges); results are reported without them" << std::endl;
+        }
+        // Calibrate the cycle counter now rather than inside the first timed pass
+        CycleTimer::calibrate();
+        std::cerr << "Timer: " << CycleTimer::describe() << std::endl;
+        if(config.energy) {
+            if(tester.enable_energy()) {
+                std::cerr << "Energy counters: " << tester.describe_energy() << std::endl;
+            } else {
+                std::cerr << "Warning: energy counters are not available (powercap energy_uj and the RAPL MSRs "
+                             "need root on Linux); results are reported without them" << std::endl;
+            }
+        }
+        // A peak calibrated on this host configuration is the second efficiency denominator
+        std::string peak_path = config.peak_file.empty() ? PeakCalibration::default_path() : config.peak_file;
+        std::string host_key = Baseline::host_key(Ndjson::host_fingerprint(tester.get_cached_system_info()),
+                                                  PageAllocator::page_mode_to_string(page_mode));
+        if(!peak_path.empty() && !config.calibrate && !config.tune) {
+            try {
+                PeakCalibration::Store peaks = PeakCalibration::load(peak_path);
+                if(const PeakCalibration::HostPeak* peak = PeakCalibration::find(peaks, host_key)) {
+                    if(!peak->ceilings.empty()) {
+                        tester.set_calibrated_peak(peak->peak_gbps(), peak->recorded);
+                    }
+                    // Shapes were tuned against the automatic kernel; an explicit --kernel runs its own loops
+                    if(config.kernel_str == "auto" && !peak->shapes.empty()) {
+                        tester.set_tuned_shapes(peak->shapes);
+                        std::cerr << "Kernel shapes: tuned " << peak->tuned << std::endl;
+                    }
+                }
+            } catch (const ConfigurationError& e) {
+                if(!config.peak_file.empty()) {
+                    throw;
+                }
+                std::cerr << "Warning: " << e.what() << "; efficiency is reported against the theoretical peak only"
+                          << std::endl;
+            }
+        }
         auto platform = create_platform_interface();
 
         SystemInfoDisplay::print_cached_system_info(
             tester.get_cached_system_info(), platform, output_format, config.cpu_affinity);
+        if(probe_cached) {
+            std::cerr << "System probe: read from " << config.system_cache << std::endl;
+        } else if(!config.system_cache.empty() && !boot.empty()) {
+            try {
+                probe.save(config.system_cache, boot);
+            } catch (const ConfigurationError& e) {
+                std::cerr << "Warning: " << e.what() << "; the system is detected again next run" << std::endl;
+            }
+        }
 
         std::vector<TestPattern> patterns = parse_patterns(config.pattern_str);
+        if(!config.streams_str.empty()) {
+            tester.set_stream_counts(parse_stream_counts(config.streams_str));
+            if(config.pattern_str == "all") {
+                // Before the chase, which leaves pointers in buffer 0
+                auto chase = std::find(patterns.begin(), patterns.end(), TestPattern::LATENCY_CHASE);
+                patterns.insert(chase, TestPattern::STREAMS);
+            }
+        }
+        AccessPatterns::AccessConfig access_config;
+        if(!config.element_str.empty()) {
+            access_config.element_bytes = AccessPatterns::parse_element_size(config.element_str);
+        }
+        if(!config.stride_str.empty()) {
+            access_config.stride_bytes = AccessPatterns::parse_stride(config.stride_str, access_config.element_bytes);
+        }
+        if(!config.index_str.empty()) {
+            AccessPatterns::parse_distribution(config.index_str, access_config);
+        }
+        tester.set_access_config(access_config);
+        if(!config.bits_str.empty()) {
+            // Validated: a single decode pattern
+            tester.set_decode_bits(EncodedScans::parse_bits(config.bits_str,
+                                                            PatternRegistry::get(patterns.front()).encoding));
+        }
+        ProxyKernels::Config proxy_config;
+        if(!config.probe_str.empty()) {
+            proxy_config.probe = ProxyKernels::parse_probe(config.probe_str);
+        }
+        if(!config.load_factor_str.empty()) {
+            proxy_config.load_factor = ProxyKernels::parse_load_factor(config.load_factor_str);
+        }
+        if(!config.hash_batch_str.empty()) {
+            proxy_config.batch = ProxyKernels::parse_batch(config.hash_batch_str);
+        }
+        if(!config.merge_ways_str.empty()) {
+            proxy_config.merge_ways = ProxyKernels::parse_merge_ways(config.merge_ways_str);
+        }
+        tester.set_proxy_config(proxy_config);
+        IrregularKernels::Config irregular_config;
+        if(!config.matrix_str.empty()) {
+            irregular_config.matrix = IrregularKernels::parse_matrix(config.matrix_str);
+        }
+        if(!config.row_nnz_str.empty()) {
+            irregular_config.row_nnz = IrregularKernels::parse_row_nnz(config.row_nnz_str);
+        }
+        if(!config.stencil_block_str.empty()) {
+            irregular_config.block = IrregularKernels::parse_block(config.stencil_block_str);
+        }
+        tester.set_irregular_config(irregular_config);
+        if(!config.cold_str.empty()) {
+            // --pattern all keeps the patterns that can evict between passes
+            patterns.erase(std::remove_if(patterns.begin(), patterns.end(), [](TestPattern pattern) {
+                return !PatternRegistry::get(pattern).cold;
+            }), patterns.end());
+            tester.set_cold(ColdCache::parse_method(config.cold_str));
+            std::cerr << "Cold passes: " << tester.describe_cold() << ", outside the timed window" << std::endl;
+        }
+        bool prefetch_sweep = config.prefetch_str == "sweep";
+        if(!config.prefetch_str.empty() && !prefetch_sweep) {
+            tester.set_prefetch_distance(PrefetchControl::parse_distance(config.prefetch_str));
+        }
+        PrefetchControl::HardwareMode hardware_prefetch = PrefetchControl::parse_hardware_mode(config.hw_prefetch_str);
+        if(hardware_prefetch == PrefetchControl::HardwareMode::OFF) {
+            tester.set_hardware_prefetchers(false);
+            std::ostream& note_out = (output_format == OutputFormat::MARKDOWN) ? std::cout : std::cerr;
+            note_out << "Hardware prefetchers off (" << tester.describe_hardware_prefetchers()
+                     << "); restored on exit\n";
+        }
+        // A scaling sweep is only comparable across counts when each added thread lands on a known CPU
+        CpuTopologyUtils::Placement placement = CpuTopologyUtils::Placement::DEFAULT;
+        std::vector<size_t> placement_list;
+        if(!config.placement_str.empty()) {
+            placement = CpuTopologyUtils::parse_placement(config.placement_str);
+            if(placement == CpuTopologyUtils::Placement::LIST) {
+                placement_list = CpuTopologyUtils::parse_placement_list(config.placement_str);
+            }
+        } else if(!config.threads_str.empty()) {
+            placement = CpuTopologyUtils::Placement::COMPACT;
+        }
+        if(placement != CpuTopologyUtils::Placement::DEFAULT) {
+            if(!tester.pins_single_cpus()) {
+                std::cerr << "Warning: threads cannot be pinned to single CPUs on " << platform->get_platform_name()
+                          << "; --placement is ignored" << std::endl;
+            }
+            tester.set_placement(placement, placement_list);
+        }
         OutputFormatter formatter(output_format);
+        Ndjson::Sink ndjson_sink;
+        if(!config.ndjson_path.empty()) {
+            ndjson_sink.open(config.ndjson_path, Ndjson::host_fingerprint(tester.get_cached_system_info()));
+            tester.set_ndjson_sink(&ndjson_sink);
+            std::cerr << "Streaming results to " << config.ndjson_path << " (run " << ndjson_sink.run_id()
+                      << ")" << std::endl;
+        }
+        std::vector<TestResult> finished_results;  // Large-memory and cache-hierarchy results, for baselines
+
+        if(config.core_to_core) {
+            std::vector<size_t> cpus = tester.core_to_core_cpus(config.cpus_str);
+
+            std::cout << "\n=== CORE-TO-CORE MODE ===\n";
+            size_t sharing_threads = std::min(std::max<size_t>(config.num_threads, 2),
+                                              CoherenceTests::MAX_PACKED_COUNTERS);
+            std::cout << "Cache-line ping-pong between pinned threads on " << cpus.size()
+                      << " CPUs, then false sharing on up to " << sharing_threads << " threads\n\n";
+
+            if(!tester.pins_single_cpus()) {
+                std::cerr << "Warning: threads cannot be pinned to single CPUs on " << platform->get_platform_name()
+                          << "; skipping the core-to-core matrix, false sharing runs unpinned" << std::endl;
+            } else if(cpus.size() < 2) {
+                std::cerr << "Warning: the core-to-core matrix needs at least two CPUs" << std::endl;
+            } else {
+                std::cout << formatter.format_core_to_core(cpus, tester.run_core_to_core(cpus));
+            }
+            std::cout << formatter.format_false_sharing(tester.run_false_sharing(cpus, config.num_threads));
+        } else if(config.atomics) {
+            std::cout << "\n=== ATOMICS MODE ===\n";
+            std::cout << "fetch_add and compare-exchange increments from 1 to " << config.num_threads
+                      << " threads, on a shared line and on private lines\n";
+            std::cout << "\n";
+            if(!tester.pins_single_cpus()) {
+                std::cerr << "Warning: threads cannot be pinned to single CPUs on " << platform->get_platform_name()
+                          << "; atomic runs are unpinned" << std::endl;
+            }
+            std::cout << formatter.format_atomics(AtomicTests::describe_std_atomics(),
+                                                tester.run_atomics(config.num_threads));
+        } else if(!config.allocators_str.empty()) {
+            std::vector<AllocatorBench::AllocatorSpec> allocators = AllocatorBench::parse_allocators(config.allocators_str);
+            std::vector<AllocatorBench::Workload> workloads = AllocatorBench::parse_workloads(config.alloc_workloads_str);
+            std::vector<size_t> counts = config.threads_str.empty()
+                                             ? AtomicTests::thread_counts(config.num_threads)
+                                             : ThreadScaling::parse_thread_counts(config.threads_str, config.num_threads);
+            std::cout << "\n=== ALLOCATOR MODE ===\n";
+            std::cout << allocators.size() << " allocators, " << workloads.size() << " workloads at "
+                      << counts.size() << " thread counts from " << counts.front() << " to " << counts.back()
+                      << "\n\n";
+            if(!tester.pins_single_cpus()) {
+                std::cerr << "Warning: threads cannot be pinned to single CPUs on " << platform->get_platform_name()
+                          << "; allocator runs are unpinned" << std::endl;
+            }
+            std::cout << formatter.format_allocator_results(
+                tester.run_allocator_bench(allocators, workloads, counts));
+        } else if(config.numa_matrix) {
+            const NumaTopology& topology = tester.get_numa_topology();
+            if(!topology.binding_supported) {
+                throw PlatformError("NUMA binding is not supported on " + platform->get_platform_name());
+            }
 
-        if(config.cache_hierarchy) {
+            std::cout << "\n=== NUMA MATRIX MODE ===\n";
+            std::cout << "Threads bound to each CPU node, buffers bound to each memory node\n";
+            for(const auto& node : topology.nodes) {
+                std::cout << "Node " << node.id << ": " << node.cpus.size() << " CPUs, " << std::fixed
+                          << std::setprecision(1) << (node.memory_bytes / (1024.0 * 1024.0 * 1024.0))
+                          << " GB, distances";
+                for(size_t distance : node.distances) {
+                    std::cout << " " << distance;
+                }
+                std::cout << "\n";
+            }
+            std::cout << "\n";
+
+            for(double memory_size_gb : config.memory_sizes_gb) {
+                size_t total_size = static_cast<size_t>(memory_size_gb * 1024 * 1024 * 1024);
+
+                for(TestPattern pattern : patterns) {
+                    if(pattern == TestPattern::MATRIX_MULTIPLY) {
+                        continue;  // GEMM allocates its own matrices and cannot be placed per node
+                    }
+                    for(StorePolicy store_policy : MemoryBandwidthTester::store_policies_for(pattern, store_policies)) {
+                        std::vector<NumaMatrixEntry> entries = tester.run_numa_matrix(
+                            pattern, config.iterations, config.num_threads, total_size, store_policy);
+
+                        std::string title = get_pattern_name(pattern);
+                        if(store_policy != StorePolicy::TEMPORAL) {
+                            title += " (" + SimdKernels::store_policy_to_string(store_policy) + " stores)";
+                        }
+                        std::cout << formatter.format_numa_matrix(title, format_memory_size(memory_size_gb), entries);
+                    }
+                }
+            }
+        } else if(config.memory_tiers) {
+            const NumaTopology& topology = tester.get_numa_topology();
+            if(!topology.binding_supported) {
+                throw PlatformError("NUMA binding is not supported on " + platform->get_platform_name());
+            }
+            MemoryTiers::Tiers tiers = MemoryTiers::select_tiers(topology);
+            std::vector<MemoryTiers::Ratio> ratios = MemoryTiers::parse_ratios(config.tier_ratios_str);
+
+            std::cout << "\n=== MEMORY TIERS MODE ===\n";
+            std::cout << "Threads bound to node " << tiers.local_node << ", buffers placed at each local:far ratio over "
+                      << (tiers.memory_only ? "memory-only" : "remote") << " nodes\n";
+            for(const auto& node : topology.nodes) {
+                bool far = std::find(tiers.far_nodes.begin(), tiers.far_nodes.end(), node.id) != tiers.far_nodes.end();
+                if(node.id != tiers.local_node && !far) continue;
+
+                std::cout << "Node " << node.id << (far ? " (far)" : " (local)") << ": " << node.cpus.size()
+                          << " CPUs, " << std::fixed << std::setprecision(1)
+                          << (node.memory_bytes / (1024.0 * 1024.0 * 1024.0)) << " GB";
+                if(node.access.read_bandwidth_mbps > 0 || node.access.read_latency_ns > 0) {
+                    std::cout << ", HMAT read " << node.access.read_bandwidth_mbps << " MB/s "
+                              << node.access.read_latency_ns << " ns, write " << node.access.write_bandwidth_mbps
+                              << " MB/s " << node.access.write_latency_ns << " ns";
+                }
+                std::cout << "\n";
+            }
+            std::cout << "\n";
+
+            for(double memory_size_gb : config.memory_sizes_gb) {
+                size_t total_size = static_cast<size_t>(memory_size_gb * 1024 * 1024 * 1024);
+
+                for(TestPattern pattern : patterns) {
+                    if(pattern == TestPattern::MATRIX_MULTIPLY) {
+                        continue;  // GEMM allocates its own matrices and cannot be placed per node
+                    }
+                    for(StorePolicy store_policy : MemoryBandwidthTester::store_policies_for(pattern, store_policies)) {
+                        std::vector<MemoryTiers::Point> points = tester.run_memory_tiers(
+                            pattern, config.iterations, config.num_threads, total_size, store_policy, ratios);
+
+                        std::string title = get_pattern_name(pattern);
+                        if(store_policy != StorePolicy::TEMPORAL) {
+                            title += " (" + SimdKernels::store_policy_to_string(store_policy) + " stores)";
+                        }
+                        std::cout << formatter.format_memory_tiers(title, format_memory_size(memory_size_gb), points);
+                    }
+                }
+            }
+        } else if(config.gpu) {
+            std::vector<GpuBandwidth::Kernel> kernels = GpuBandwidth::parse_kernels(config.gpu_kernels_str);
+
+            std::cout << "\n=== GPU UNIFIED MEMORY MODE ===\n";
+            std::cout << "GPU kernels over buffers shared with the CPU, alone and with " << config.num_threads
+                      << " CPU threads streaming the same traffic\n\n";
+
+            for(double memory_size_gb : config.memory_sizes_gb) {
+                size_t total_size = static_cast<size_t>(memory_size_gb * 1024 * 1024 * 1024);
+                std::vector<GpuBandwidth::Point> points =
+                    tester.run_gpu_bandwidth(kernels, config.num_threads, total_size);
+                std::cout << formatter.format_gpu_bandwidth(format_memory_size(memory_size_gb), points);
+            }
+        } else if(config.loaded_latency) {
+            std::cout << "\n=== LOADED LATENCY MODE ===\n";
+            std::cout << "Thread 0 chases pointers while the other threads generate throttled load\n\n";
+
+            for(double memory_size_gb : config.memory_sizes_gb) {
+                size_t total_size = static_cast<size_t>(memory_size_gb * 1024 * 1024 * 1024);
+
+                for(TestPattern pattern : patterns) {
+                    if(pattern != TestPattern::SEQUENTIAL_READ && pattern != TestPattern::SEQUENTIAL_WRITE &&
+                       pattern != TestPattern::COPY) {
+                        continue;  // "all" selects every supported load pattern
+                    }
+                    for(StorePolicy store_policy : MemoryBandwidthTester::store_policies_for(pattern, store_policies)) {
+                        std::vector<LoadedLatencyPoint> points = tester.run_loaded_latency(
+                            pattern, config.iterations, config.num_threads, total_size, store_policy);
+
+                        std::string title = get_pattern_name(pattern);
+                        if(store_policy != StorePolicy::TEMPORAL) {
+                            title += " (" + SimdKernels::store_policy_to_string(store_policy) + " stores)";
+                        }
+                        std::cout << formatter.format_loaded_latency(title, format_memory_size(memory_size_gb),
+                                                                     points);
+                    }
+                }
+            }
+        } else if(config.contention) {
+            Contention::Aggressor aggressor = Contention::parse_aggressor(config.aggressor_str);
+            size_t aggressor_threads = config.num_threads - config.victim_threads;
+            std::cout << "\n=== CONTENTION MODE ===\n";
+            std::cout << config.victim_threads << " victim thread(s) run the pattern while " << aggressor_threads
+                      << " aggressor thread(s) generate throttled " << Contention::aggressor_to_string(aggressor)
+                      << " traffic on separate buffers\n";
+            if(!config.resctrl_victim_str.empty()) {
+                std::cout << "Victims in resctrl group membench_victim (" << config.resctrl_victim_str << ")\n";
+            }
+            if(!config.resctrl_aggressor_str.empty()) {
+                std::cout << "Aggressors in resctrl group membench_aggressor (" << config.resctrl_aggressor_str
+                          << ")\n";
+            }
+            std::cout << "\n";
+
+            for(double memory_size_gb : config.memory_sizes_gb) {
+                size_t total_size = static_cast<size_t>(memory_size_gb * 1024 * 1024 * 1024);
+
+                for(TestPattern pattern : patterns) {
+                    if(!Contention::supports_victim(pattern)) {
+                        continue;  // "all" selects every supported victim pattern
+                    }
+                    for(StorePolicy store_policy : MemoryBandwidthTester::store_policies_for(pattern, store_policies)) {
+                        std::vector<Contention::ContentionPoint> points = tester.run_contention(
+                            pattern, aggressor, config.iterations, config.victim_threads, config.num_threads,
+                            total_size, config.resctrl_victim_str, config.resctrl_aggressor_str, store_policy);
+
+                        std::string title = get_pattern_name(pattern);
+                        if(store_policy != StorePolicy::TEMPORAL) {
+                            title += " (" + SimdKernels::store_policy_to_string(store_policy) + " stores)";
+                        }
+                        std::cout << formatter.format_contention(title, Contention::aggressor_to_string(aggressor),
+                                                                 format_memory_size(memory_size_gb), points);
+                    }
+                }
+            }
+        } else if(!config.duration_str.empty()) {
+            double duration_seconds = Soak::parse_duration(config.duration_str);
+            size_t interval_ms = Soak::parse_interval(config.sample_interval_str);
+            std::cout << "\n=== SOAK MODE ===\n";
+            std::cout << "Each pattern streams for " << Soak::duration_to_string(duration_seconds)
+                      << "; aggregate bandwidth, core frequency and temperatures sampled every " << interval_ms
+                      << " ms\n\n";
+
+            for(double memory_size_gb : config.memory_sizes_gb) {
+                size_t total_size = static_cast<size_t>(memory_size_gb * 1024 * 1024 * 1024);
+
+                for(TestPattern pattern : patterns) {
+                    if(pattern != TestPattern::SEQUENTIAL_READ && pattern != TestPattern::SEQUENTIAL_WRITE &&
+                       pattern != TestPattern::COPY && pattern != TestPattern::RANDOM_READ) {
+                        continue;  // "all" selects every streaming pattern
+                    }
+                    for(StorePolicy store_policy : MemoryBandwidthTester::store_policies_for(pattern, store_policies)) {
+                        std::vector<Soak::Sample> samples = tester.run_soak(
+                            pattern, config.num_threads, total_size, duration_seconds, interval_ms, store_policy);
+
+                        std::string title = get_pattern_name(pattern);
+                        if(store_policy != StorePolicy::TEMPORAL) {
+                            title += " (" + SimdKernels::store_policy_to_string(store_policy) + " stores)";
+                        }
+                        std::cout << formatter.format_soak(title, format_memory_size(memory_size_gb),
+                                                           Soak::summarize(samples), samples);
+                    }
+                }
+            }
+        } else if(config.roofline) {
+            std::cout << "\n=== ROOFLINE MODE ===\n";
+            std::cout << "FP64 intensity sweep from 1/16 to 64 FLOP/byte; triad and GEMM give the ceilings\n\n";
+
+            for(double memory_size_gb : config.memory_sizes_gb) {
+                size_t total_size = static_cast<size_t>(memory_size_gb * 1024 * 1024 * 1024);
+                Roofline roofline = tester.run_roofline(config.iterations, config.num_threads, total_size, precisions);
+                std::cout << formatter.format_roofline(format_memory_size(memory_size_gb), roofline);
+            }
+        } else if(!config.sweep_str.empty()) {
+            size_t steps_per_octave = WorkingSetSizes::parse_sweep(config.sweep_str);
+            double max_size_gb = *std::max_element(config.memory_sizes_gb.begin(), config.memory_sizes_gb.end());
+
+            std::cout << "\n=== WORKING-SET SWEEP MODE ===\n";
+            std::cout << "Single-threaded sequential read and latency chase from 4KB to "
+                      << format_memory_size(max_size_gb) << ", " << steps_per_octave << " steps per octave\n\n";
+
+            WorkingSetSweep sweep = tester.run_working_set_sweep(
+                static_cast<size_t>(max_size_gb * 1024 * 1024 * 1024), steps_per_octave, config.iterations);
+            std::cout << formatter.format_working_set_sweep(sweep);
+        } else if(!config.io_dir.empty()) {
+            double file_size_gb = *std::max_element(config.memory_sizes_gb.begin(), config.memory_sizes_gb.end());
+            size_t file_size = static_cast<size_t>(file_size_gb * 1024 * 1024 * 1024);
+
+            std::cout << "\n=== I/O PATH MODE ===\n";
+            std::cout << "Reading a " << format_memory_size(file_size_gb) << " file in " << config.io_dir
+                      << " through each I/O path, " << config.iterations << " passes\n\n";
+
+            double clock_ghz = IoTests::estimate_core_clock_ghz();
+            std::vector<IoTests::Result> results = tester.run_io_paths(
+                config.io_dir, file_size, config.iterations, IoTests::parse_methods(config.io_methods_str),
+                IoTests::parse_block_sizes(config.io_block_str), IoTests::parse_queue_depths(config.io_depth_str),
+                clock_ghz);
+            std::cout << formatter.format_io_results(file_size, clock_ghz, results);
+        } else if(config.mapping) {
+            double mapping_size_gb = *std::max_element(config.memory_sizes_gb.begin(), config.memory_sizes_gb.end());
+            std::vector<MappingTests::Operation> ops = MappingTests::parse_operations(config.mapping_ops_str);
+            std::vector<size_t> counts = config.threads_str.empty()
+                                             ? AtomicTests::thread_counts(config.num_threads)
+                                             : ThreadScaling::parse_thread_counts(config.threads_str, config.num_threads);
+
+            std::cout << "\n=== MAPPING MODE ===\n";
+            std::cout << "Faulting in, reclaiming and unmapping fresh " << format_memory_size(mapping_size_gb)
+                      << " mappings at " << counts.size() << " thread counts from " << counts.front() << " to "
+                      << counts.back() << ", median of " << config.iterations << " repetitions\n\n";
+            if(!tester.pins_single_cpus()) {
+                std::cerr << "Warning: threads cannot be pinned to single CPUs on " << platform->get_platform_name()
+                          << "; mapping runs are unpinned" << std::endl;
+            }
+            std::cout << formatter.format_mapping_results(tester.run_mapping_costs(
+                ops, static_cast<size_t>(mapping_size_gb * 1024 * 1024 * 1024), config.iterations, counts));
+        } else if(config.tlb) {
+            double tlb_size_gb = *std::max_element(config.memory_sizes_gb.begin(), config.memory_sizes_gb.end());
+            std::vector<PageMode> modes = TlbSweep::parse_page_modes(config.tlb_pages_str);
+
+            std::cout << "\n=== TLB REACH MODE ===\n";
+            std::cout << "Chasing one line per page over up to " << format_memory_size(tlb_size_gb) << " of "
+                      << config.tlb_pages_str << " pages, median of " << config.iterations << " passes per point\n\n";
+            if(!tester.pins_single_cpus()) {
+                std::cerr << "Warning: threads cannot be pinned to single CPUs on " << platform->get_platform_name()
+                          << "; the TLB sweep is unpinned" << std::endl;
+            }
+            std::cout << formatter.format_tlb_results(tester.run_tlb_sweep(
+                modes, static_cast<size_t>(tlb_size_gb * 1024 * 1024 * 1024), config.iterations));
+        } else if(config.rings) {
+            std::vector<size_t> cpus = tester.core_to_core_cpus(config.cpus_str);
+            std::vector<RingTransfer::Kind> kinds = RingTransfer::parse_kinds(config.ring_kinds_str);
+            std::vector<size_t> payloads = RingTransfer::parse_payloads(config.ring_payload_str);
+
+            std::cout << "\n=== RING TRANSFER MODE ===\n";
+            std::cout << config.ring_kinds_str << " rings carrying " << config.ring_payload_str << "-byte messages between "
+                      << cpus.size() * (cpus.size() - 1) / 2 << " CPU pairs, median of " << config.iterations
+                      << " runs per transfer\n\n";
+            if(!tester.pins_single_cpus()) {
+                std::cerr << "Warning: threads cannot be pinned to single CPUs on " << platform->get_platform_name()
+                          << "; skipping the ring transfers" << std::endl;
+            } else if(cpus.size() < 2) {
+                std::cerr << "Warning: ring transfers need at least two CPUs" << std::endl;
+            } else {
+                std::cout << formatter.format_ring_results(
+                    tester.run_ring_transfers(kinds, payloads, cpus, config.iterations));
+            }
+        } else if(config.memcpy_sweep) {
+            std::pair<size_t, size_t> range = CopySweep::parse_size_range(config.memcpy_sizes_str);
+            std::vector<size_t> sizes = CopySweep::size_ladder(range.first, range.second);
+            std::vector<CopySweep::Implementation> implementations =
+                CopySweep::parse_implementations(config.memcpy_impls_str);
+            std::vector<CopySweep::Alignment> alignments = CopySweep::parse_alignments(config.memcpy_align_str);
+            std::vector<CopySweep::Operation> operations = CopySweep::parse_operations(config.memcpy_ops_str);
+
+            std::string names;
+            for(const auto& implementation : implementations) {
+                names += (names.empty() ? "" : ", ") + implementation.name;
+            }
+            std::cout << "\n=== COPY SIZE CLASS MODE ===\n";
+            std::cout << names << " over " << sizes.size() << " sizes from "
+                      << OutputFormatterUtils::format_byte_size(range.first) << " to "
+                      << OutputFormatterUtils::format_byte_size(range.second) << " at " << alignments.size()
+                      << " alignments, median of " << config.iterations << " runs per point\n\n";
+            if(!tester.pins_single_cpus()) {
+                std::cerr << "Warning: threads cannot be pinned to single CPUs on " << platform->get_platform_name()
+                          << "; the copy sweep is unpinned" << std::endl;
+            }
+            std::cout << formatter.format_copy_sweep(
+                tester.run_copy_sweep(operations, implementations, alignments, sizes, config.iterations));
+        } else if(!config.trace_path.empty()) {
+            TraceReplay::Trace trace(config.trace_path);
+            const TraceReplay::Summary& summary = trace.summary();
+            std::cout << "\n=== TRACE REPLAY MODE ===\n";
+            std::cout << "Replaying " << summary.records << " recorded accesses over a "
+                      << OutputFormatterUtils::format_byte_size(summary.span_bytes) << " working set, "
+                      << config.iterations << " passes\n\n";
+
+            TraceReplay::ReplayResult result = tester.run_trace_replay(trace, config.iterations, config.num_threads);
+            std::cout << formatter.format_trace_replay(config.trace_path, summary, result);
+        } else if(prefetch_sweep) {
+            std::cout << "\n=== PREFETCH SWEEP MODE ===\n";
+            std::cout << "Software prefetch distances from 64 B to 8 KB against no software prefetch";
+            if(hardware_prefetch == PrefetchControl::HardwareMode::BOTH) {
+                std::cout << ", with hardware prefetchers on and off";
+            }
+            std::cout << "\n\n";
+
+            for(double memory_size_gb : config.memory_sizes_gb) {
+                size_t total_size = static_cast<size_t>(memory_size_gb * 1024 * 1024 * 1024);
+
+                for(TestPattern pattern : patterns) {
+                    if(!PrefetchControl::supports_pattern(pattern)) {
+                        continue;  // "all" selects every pattern with a prefetching loop
+                    }
+                    std::vector<PrefetchPoint> points = tester.run_prefetch_sweep(
+                        pattern, config.iterations, config.num_threads, total_size, hardware_prefetch);
+                    std::cout << formatter.format_prefetch_sweep(tester.test_name_for(pattern, precisions.front()),
+                                                                 format_memory_size(memory_size_gb), points);
+                }
+            }
+        } else if(config.calibrate) {
+            if(peak_path.empty()) {
+                throw ConfigurationError("Neither XDG_CACHE_HOME nor HOME is set; name the file with --peak-file");
+            }
+            std::vector<size_t> counts = ThreadScaling::parse_thread_counts("sweep", config.num_threads);
+            double memory_size_gb = *std::max_element(config.memory_sizes_gb.begin(), config.memory_sizes_gb.end());
+            std::cout << "\n=== PEAK CALIBRATION MODE ===\n";
+            std::cout << "Read, write and copy with every supported store policy at " << counts.size()
+                      << " thread counts from " << counts.front() << " to " << counts.back() << " over "
+                      << format_memory_size(memory_size_gb) << "; the best point of each family is its ceiling\n\n";
+
+            PeakCalibration::HostPeak peak;
+            peak.host = Ndjson::host_fingerprint(tester.get_cached_system_info());
+            peak.pages = PageAllocator::page_mode_to_string(page_mode);
+            peak.host_key = host_key;
+            peak.working_set = format_memory_size(memory_size_gb);
+            peak.ceilings = tester.run_peak_calibration(
+                config.iterations, counts, static_cast<size_t>(memory_size_gb * 1024 * 1024 * 1024));
+            peak.recorded = Ndjson::utc_timestamp();
+            std::ostream& page_out = (output_format == OutputFormat::MARKDOWN) ? std::cout : std::cerr;
+            page_out << "Pages: " << tester.describe_page_backing() << "\n\n";
+            std::cout << formatter.format_peak_calibration(peak, tester.get_cached_system_info().memory_specs);
+
+            PeakCalibration::Store peaks = PeakCalibration::load(peak_path);
+            PeakCalibration::upsert(peaks, peak);
+            PeakCalibration::save(peak_path, peaks);
+            std::cerr << "Saved the calibrated peak to " << peak_path << " (host key " << host_key << ")"
+                      << std::endl;
+        } else if(config.tune) {
+            if(peak_path.empty()) {
+                throw ConfigurationError("Neither XDG_CACHE_HOME nor HOME is set; name the file with --peak-file");
+            }
+            double memory_size_gb = *std::max_element(config.memory_sizes_gb.begin(), config.memory_sizes_gb.end());
+            size_t shapes = KernelMatrix::shapes(KernelMatrix::Family::READ).size() +
+                            KernelMatrix::shapes(KernelMatrix::Family::WRITE).size() +
+                            KernelMatrix::shapes(KernelMatrix::Family::TRIAD).size();
+            std::cout << "\n=== KERNEL TUNING MODE ===\n";
+            std::cout << "Read, write and triad in " << shapes << " loop shapes at each cache level and over "
+                      << format_memory_size(memory_size_gb) << " on " << config.num_threads
+                      << " threads; the fastest shape of each level is kept\n\n";
+
+            PeakCalibration::HostPeak peak;
+            peak.host = Ndjson::host_fingerprint(tester.get_cached_system_info());
+            peak.pages = PageAllocator::page_mode_to_string(page_mode);
+            peak.host_key = host_key;
+            peak.shapes = tester.run_tune(config.num_threads,
+                                          static_cast<size_t>(memory_size_gb * 1024 * 1024 * 1024));
+            peak.tuned = Ndjson::utc_timestamp();
+            std::cout << formatter.format_tuning(peak);
+
+            PeakCalibration::Store peaks = PeakCalibration::load(peak_path);
+            PeakCalibration::upsert(peaks, peak);
+            PeakCalibration::save(peak_path, peaks);
+            std::cerr << "Saved the tuned kernel shapes to " << peak_path << " (host key " << host_key << ")"
+                      << std::endl;
+        } else if(!config.threads_str.empty()) {
+            std::vector<size_t> counts = ThreadScaling::parse_thread_counts(config.threads_str, config.num_threads);
+            std::cout << "\n=== THREAD SCALING MODE ===\n";
+            std::cout << "Every pattern at " << counts.size() << " thread counts from " << counts.front() << " to "
+                      << counts.back() << ", " << CpuTopologyUtils::placement_to_string(placement)
+                      << " placement, over the same buffers\n";
+            std::cout << "Topology: " << CpuTopologyUtils::describe(tester.get_cpu_topology()) << "\n\n";
+
+            for(double memory_size_gb : config.memory_sizes_gb) {
+                size_t total_size = static_cast<size_t>(memory_size_gb * 1024 * 1024 * 1024);
+                // First touch with the largest count, so every count reads pages placed the same way
+                if(!tester.allocate_pattern_buffers(patterns, total_size, counts.back())) {
+                    throw MemoryError("Failed to allocate memory buffers for thread scaling with size " +
+                                      std::to_string(memory_size_gb) + "GB");
+                }
+                std::ostream& page_out = (output_format == OutputFormat::MARKDOWN) ? std::cout : std::cerr;
+                page_out << "Pages: " << tester.describe_page_backing() << "\n\n";
+
+                for(TestPattern pattern : patterns) {
+                    if(MemoryBandwidthTester::threads_for(pattern, 2) == 1) {
+                        continue;  // The latency chase always runs on one thread
+                    }
+                    for(StorePolicy store_policy : MemoryBandwidthTester::store_policies_for(pattern, store_policies)) {
+                        for(MatrixMultiply::MatrixPrecision precision :
+                            MemoryBandwidthTester::precisions_for(pattern, precisions)) {
+                            std::vector<ThreadScaling::ScalingPoint> points = tester.run_thread_scaling(
+                                pattern, config.iterations, counts, store_policy, precision);
+                            std::string test_name = tester.test_name_for(pattern, precision);
+                            if(store_policies.size() > 1 && MemoryBandwidthTester::uses_store_policy(pattern)) {
+                                test_name += " " + SimdKernels::store_policy_to_string(store_policy);
+                            }
+                            std::cout << formatter.format_thread_scaling(
+                                test_name, format_memory_size(memory_size_gb),
+                                CpuTopologyUtils::placement_to_string(placement), points);
+                        }
+                    }
+                }
+            }
+        } else if(config.cache_hierarchy) {
             std::cout << "\n=== CACHE HIERARCHY MODE ===\n";
             std::cout << "Testing with working sets sized for L1, L2, L3 caches\n";
             std::cout << "No cache interference - demonstrating peak cache performance\n\n";
             
             for(TestPattern pattern : patterns) {
-                std::vector<TestResult> results = tester.run_cache_aware_test(pattern, config.iterations, config.num_threads);
+                std::vector<TestResult> results = tester.run_cache_aware_test(pattern, config.iterations, config.num_threads,
+                                                                             store_policies, precisions);
                 tester.print_cache_results(get_pattern_name(pattern), results);
+                finished_results.insert(finished_results.end(), results.begin(), results.end());
             }
         } else {
             std::cout << "\n=== LARGE MEMORY MODE ===\n";
             std::cout << "Testing with large working sets (>4GB) - Natural system performance\n";
             std::cout << "No cache interference - let hardware prefetchers and memory controllers work naturally\n\n";
             
-            std::cout << formatter.format_header();
             std::vector<TestResult> results;
 
             for(double memory_size_gb : config.memory_sizes_gb) {
                 size_t total_size = static_cast<size_t>(memory_size_gb * 1024 * 1024 * 1024);
-                size_t num_buffers = 4;
-
+                // Every pattern shares the buffers, so allocate the arrays of the widest one
                 try {
-                    if(!tester.allocate_buffers(total_size, num_buffers)) {
+                    if(!tester.allocate_pattern_buffers(patterns, total_size, config.num_threads)) {
                         throw MemoryError("Failed to allocate memory buffers for large-memory test with size " +
                                         std::to_string(memory_size_gb) + "GB");
                     }
@@ -445,26 +859,83 @@ int main(int argc, char* argv[]) {
                     std::cerr << "Error: " << e.what() << std::endl;
                     return 1;
                 }
+                // Above the table, which is printed once every size has run
+                std::ostream& page_out = (output_format == OutputFormat::MARKDOWN) ? std::cout : std::cerr;
+                page_out << "Pages";
+                if(config.memory_sizes_gb.size() > 1) {
+                    page_out << " (" << format_memory_size(memory_size_gb) << ")";
+                }
+                page_out << ": " << tester.describe_page_backing() << "\n\n";
 
                 for(TestPattern pattern : patterns) {
-                    PerformanceStats stats = tester.run_test(pattern, config.iterations, config.num_threads, false);
-
-                    TestResult result;
-                    result.test_name = get_pattern_name(pattern);
-                    result.working_set_desc = format_memory_size(memory_size_gb);
-                    result.stats = stats;
-                    result.num_threads = config.num_threads;
-                    result.pattern_name = get_pattern_name(pattern);
-
-                    results.push_back(result);
+                    for(StorePolicy store_policy : MemoryBandwidthTester::store_policies_for(pattern, store_policies)) {
+                        for(MatrixMultiply::MatrixPrecision precision :
+                            MemoryBandwidthTester::precisions_for(pattern, precisions)) {
+                            size_t num_threads = MemoryBandwidthTester::threads_for(pattern, config.num_threads);
+                            PerformanceStats stats = tester.run_test(pattern, config.iterations, num_threads,
+                                                                     false, store_policy, precision);
+
+                            TestResult result;
+                            result.test_name = tester.test_name_for(pattern, precision);
+                            result.working_set_desc = format_memory_size(memory_size_gb);
+                            result.stats = stats;
+                            result.num_threads = num_threads;
+                            result.pattern_name = get_pattern_name(pattern);
+                            result.kernel_name = tester.kernel_name_for(pattern);
+                            result.store_policy = MemoryBandwidthTester::store_policy_name_for(pattern, store_policy);
+                            result.warnings = tester.validate_result(pattern, stats, num_threads);
+                            tester.attach_sample_stats(result);
+                            tester.record_result(result, "large_memory");
+
+                            results.push_back(result);
+                        }
+                    }
                 }
             }
 
+            std::cout << formatter.format_header();
             std::cout << formatter.format_test_results(results, tester.get_cached_system_info().memory_specs);
+            finished_results = results;
+        }
+
+        int exit_code = 0;
+        if(!config.compare_path.empty() || !config.save_baseline_path.empty()) {
+            Baseline::HostBaseline current;
+            current.host = Ndjson::host_fingerprint(tester.get_cached_system_info());
+            current.pages = PageAllocator::page_mode_to_string(page_mode);
+            current.host_key = Baseline::host_key(current.host, current.pages);
+            current.recorded = Ndjson::utc_timestamp();
+            for(const auto& result : finished_results) {
+                current.entries.push_back(Baseline::entry_from(result));
+            }
+
+            // Compare before saving, so one invocation can check against and then replace the entry
+            if(!config.compare_path.empty()) {
+                Baseline::Store store = Baseline::load(config.compare_path);
+                std::vector<std::string> host_changes;
+                const Baseline::HostBaseline* baseline = Baseline::find_match(store, current, host_changes);
+                if(baseline == nullptr) {
+                    throw ConfigurationError("No baseline for this host in " + config.compare_path + " (host key " +
+                                             current.host_key + "); record one with --save-baseline");
+                }
+                std::vector<Baseline::Comparison> comparisons = Baseline::compare_all(*baseline, current.entries);
+                std::cout << formatter.format_baseline_comparison(
+                    baseline->host.hostname + ", recorded " + baseline->recorded, host_changes, comparisons);
+                if(Baseline::count(comparisons, Baseline::Verdict::REGRESSED) > 0) {
+                    exit_code = BASELINE_REGRESSION_EXIT_CODE;
+                }
+            }
+            if(!config.save_baseline_path.empty()) {
+                Baseline::Store store = Baseline::load(config.save_baseline_path);
+                Baseline::upsert(store, current);
+                Baseline::save(config.save_baseline_path, store);
+                std::cerr << "Saved " << current.entries.size() << " results to " << config.save_baseline_path
+                          << " (host key " << current.host_key << ")" << std::endl;
+            }
         }
 
         std::cout << formatter.format_completion_message();
-        return 0;
+        return exit_code;
         
     } catch (const ArgumentError& e) {
         std::cerr << "Error: " << e.what() << std::endl;
@@ -0,0 +1,252 @@
+#include "arm64_matrix_multiplier.h"
+#include "../../common/cpu_features.h"
+
+#include <arm_neon.h>
+
+#if defined(__ARM_FEATURE_SVE)
+#include <arm_sve.h>
+#define ARM64_MATRIX_SVE 1
+#endif
+
+namespace MatrixMultiply {
+
+namespace {
+
+// NEON register blocking: 8 rows x 2 vectors = 16 of the 32 V registers
+constexpr size_t NEON_MR = 8;
+constexpr size_t NEON_FLOAT_NR = 8;
+constexpr size_t NEON_DOUBLE_NR = 4;
+
+constexpr BlockedGemm::Blocking NEON_FLOAT_BLOCKING = {NEON_MR, NEON_FLOAT_NR, 128, 256, 2048};
+constexpr BlockedGemm::Blocking NEON_DOUBLE_BLOCKING = {NEON_MR, NEON_DOUBLE_NR, 128, 256, 1024};
+
+void neon_float_kernel(size_t kc, const float* a, const float* b, float* c, size_t ldc) {
+    float32x4_t acc[NEON_MR][2];
+    for (size_t i = 0; i < NEON_MR; ++i) {
+        acc[i][0] = vdupq_n_f32(0.0f);
+        acc[i][1] = vdupq_n_f32(0.0f);
+    }
+
+    for (size_t k = 0; k < kc; ++k) {
+        float32x4_t b0 = vld1q_f32(b);
+        float32x4_t b1 = vld1q_f32(b + 4);
+        for (size_t i = 0; i < NEON_MR; ++i) {
+            acc[i][0] = vfmaq_n_f32(acc[i][0], b0, a[i]);
+            acc[i][1] = vfmaq_n_f32(acc[i][1], b1, a[i]);
+        }
+        a += NEON_MR;
+        b += NEON_FLOAT_NR;
+    }
+
+    for (size_t i = 0; i < NEON_MR; ++i) {
+        float* row = c + i * ldc;
+        vst1q_f32(row, vaddq_f32(vld1q_f32(row), acc[i][0]));
+        vst1q_f32(row + 4, vaddq_f32(vld1q_f32(row + 4), acc[i][1]));
+    }
+}
+
+void neon_double_kernel(size_t kc, const double* a, const double* b, double* c, size_t ldc) {
+    float64x2_t acc[NEON_MR][2];
+    for (size_t i = 0; i < NEON_MR; ++i) {
+        acc[i][0] = vdupq_n_f64(0.0);
+        acc[i][1] = vdupq_n_f64(0.0);
+    }
+
+    for (size_t k = 0; k < kc; ++k) {
+        float64x2_t b0 = vld1q_f64(b);
+        float64x2_t b1 = vld1q_f64(b + 2);
+        for (size_t i = 0; i < NEON_MR; ++i) {
+            acc[i][0] = vfmaq_n_f64(acc[i][0], b0, a[i]);
+            acc[i][1] = vfmaq_n_f64(acc[i][1], b1, a[i]);
+        }
+        a += NEON_MR;
+        b += NEON_DOUBLE_NR;
+    }
+
+    for (size_t i = 0; i < NEON_MR; ++i) {
+        double* row = c + i * ldc;
+        vst1q_f64(row, vaddq_f64(vld1q_f64(row), acc[i][0]));
+        vst1q_f64(row + 2, vaddq_f64(vld1q_f64(row + 2), acc[i][1]));
+    }
+}
+
+#ifdef ARM64_MATRIX_SVE
+
+constexpr size_t SVE_MR = 8;
+
+template <typename T>
+struct SveOps;
+
+template <>
+struct SveOps<float> {
+    using vec = svfloat32_t;
+    static svbool_t all() { return svptrue_b32(); }
+    static size_t lanes() { return svcntw(); }
+    static vec zero() { return svdup_n_f32(0.0f); }
+};
+
+template <>
+struct SveOps<double> {
+    using vec = svfloat64_t;
+    static svbool_t all() { return svptrue_b64(); }
+    static size_t lanes() { return svcntd(); }
+    static vec zero() { return svdup_n_f64(0.0); }
+};
+
+// SVE vectors are sizeless and cannot live in arrays, so the 8x2
+// accumulator tile is spelled out row by row
+#define SVE_ROW_ZERO(i) vec c##i##0 = Ops::zero(), c##i##1 = Ops::zero();
+#define SVE_ROW_FMA(i)                             \
+    c##i##0 = svmla_x(pg, c##i##0, b0, a[i]);      \
+    c##i##1 = svmla_x(pg, c##i##1, b1, a[i]);
+#define SVE_ROW_STORE(i)                                                  \
+    svst1(pg, c + i * ldc, svadd_x(pg, svld1(pg, c + i * ldc), c##i##0)); \
+    svst1(pg, c + i * ldc + vl, svadd_x(pg, svld1(pg, c + i * ldc + vl), c##i##1));
+#define SVE_ROWS(op) op(0) op(1) op(2) op(3) op(4) op(5) op(6) op(7)
+
+template <typename T>
+void sve_kernel(size_t kc, const T* a, const T* b, T* c, size_t ldc) {
+    using Ops = SveOps<T>;
+    using vec = typename Ops::vec;
+    const svbool_t pg = Ops::all();
+    const size_t vl = Ops::lanes();
+
+    SVE_ROWS(SVE_ROW_ZERO)
+    for (size_t k = 0; k < kc; ++k) {
+        vec b0 = svld1(pg, b);
+        vec b1 = svld1(pg, b + vl);
+        SVE_ROWS(SVE_ROW_FMA)
+        a += SVE_MR;
+        b += 2 * vl;
+    }
+    SVE_ROWS(SVE_ROW_STORE)
+}
+
+#undef SVE_ROWS
+#undef SVE_ROW_STORE
+#undef SVE_ROW_FMA
+#undef SVE_ROW_ZERO
+
+template <typename T>
+BlockedGemm::Blocking sve_blocking() {
+    return {SVE_MR, 2 * SveOps<T>::lanes(), 128, 256, 2048};
+}
+
+#endif  // ARM64_MATRIX_SVE
+
+}  // namespace
+
+ARM64SVEMatrixMultiplier::ARM64SVEMatrixMultiplier() : sve_available_(false) {
+#ifdef ARM64_MATRIX_SVE
+    sve_available_ = CpuFeatureDetection::get_cpu_features().sve;
+#endif
+}
+
+MatrixPerformanceStats ARM64SVEMatrixMultiplier::multiply_float(
+    float* C, const float* A, const float* B,
+    const MatrixConfig& config,
+    const std::atomic<bool>& stop_flag) {
+#ifdef ARM64_MATRIX_SVE
+    return BlockedGemm::timed_multiply(C, A, B, config, stop_flag, sve_blocking<float>(), sve_kernel<float>,
+                                       float_workspace_, get_acceleration_name());
+#else
+    (void)C; (void)A; (void)B; (void)config; (void)stop_flag;
+    return calculate_matrix_stats(0, 0.0, 0, get_acceleration_name());
+#endif
+}
+
+MatrixPerformanceStats ARM64SVEMatrixMultiplier::multiply_double(
+    double* C, const double* A, const double* B,
+    const MatrixConfig& config,
+    const std::atomic<bool>& stop_flag) {
+#ifdef ARM64_MATRIX_SVE
+    return BlockedGemm::timed_multiply(C, A, B, config, stop_flag, sve_blocking<double>(), sve_kernel<double>,
+                                       double_workspace_, get_acceleration_name());
+#else
+    (void)C; (void)A; (void)B; (void)config; (void)stop_flag;
+    return calculate_matrix_stats(0, 0.0, 0, get_acceleration_name());
+#endif
+}
+
+MatrixPerformanceStats ARM64SVEMatrixMultiplier::multiply_bf16(
+    float* C, const BFloat16* A, const BFloat16* B,
+    const MatrixConfig& config,
+    const std::atomic<bool>& stop_flag) {
+#ifdef ARM64_MATRIX_SVE
+    return BlockedGemm::timed_multiply(C, A, B, config, stop_flag, sve_blocking<float>(), sve_kernel<float>,
+                                       float_workspace_,
+                                       converted_acceleration_name(get_acceleration_name(), MatrixPrecision::BF16));
+#else
+    return MatrixMultiplier::multiply_bf16(C, A, B, config, stop_flag);
+#endif
+}
+
+MatrixPerformanceStats ARM64SVEMatrixMultiplier::multiply_fp16(
+    float* C, const Float16* A, const Float16* B,
+    const MatrixConfig& config,
+    const std::atomic<bool>& stop_flag) {
+#ifdef ARM64_MATRIX_SVE
+    return BlockedGemm::timed_multiply(C, A, B, config, stop_flag, sve_blocking<float>(), sve_kernel<float>,
+                                       float_workspace_,
+                                       converted_acceleration_name(get_acceleration_name(), MatrixPrecision::FP16));
+#else
+    return MatrixMultiplier::multiply_fp16(C, A, B, config, stop_flag);
+#endif
+}
+
+std::string ARM64SVEMatrixMultiplier::get_acceleration_name() const {
+#ifdef ARM64_MATRIX_SVE
+    if (sve_available_) {
+        return "ARM SVE (" + std::to_string(svcntb() * 8) + "-bit)";
+    }
+#endif
+    return "ARM SVE";
+}
+
+bool ARM64SVEMatrixMultiplier::is_available() const {
+    return sve_available_;
+}
+
+MatrixPerformanceStats ARM64NeonMatrixMultiplier::multiply_float(
+    float* C, const float* A, const float* B,
+    const MatrixConfig& config,
+    const std::atomic<bool>& stop_flag) {
+    return BlockedGemm::timed_multiply(C, A, B, config, stop_flag, NEON_FLOAT_BLOCKING, neon_float_kernel,
+                                       float_workspace_, get_acceleration_name());
+}
+
+MatrixPerformanceStats ARM64NeonMatrixMultiplier::multiply_double(
+    double* C, const double* A, const double* B,
+    const MatrixConfig& config,
+    const std::atomic<bool>& stop_flag) {
+    return BlockedGemm::timed_multiply(C, A, B, config, stop_flag, NEON_DOUBLE_BLOCKING, neon_double_kernel,
+                                       double_workspace_, get_acceleration_name());
+}
+
+MatrixPerformanceStats ARM64NeonMatrixMultiplier::multiply_bf16(
+    float* C, const BFloat16* A, const BFloat16* B,
+    const MatrixConfig& config,
+    const std::atomic<bool>& stop_flag) {
+    return BlockedGemm::timed_multiply(C, A, B, config, stop_flag, NEON_FLOAT_BLOCKING, neon_float_kernel,
+                                       float_workspace_,
+                                       converted_acceleration_name(get_acceleration_name(), MatrixPrecision::BF16));
+}
+
+MatrixPerformanceStats ARM64NeonMatrixMultiplier::multiply_fp16(
+    float* C, const Float16* A, const Float16* B,
+    const MatrixConfig& config,
+    const std::atomic<bool>& stop_flag) {
+    return BlockedGemm::timed_multiply(C, A, B, config, stop_flag, NEON_FLOAT_BLOCKING, neon_float_kernel,
+                                       float_workspace_,
+                                       converted_acceleration_name(get_acceleration_name(), MatrixPrecision::FP16));
+}
+
+std::string ARM64NeonMatrixMultiplier::get_acceleration_name() const {
+    return "ARM NEON FMA";
+}
+
+bool ARM64NeonMatrixMultiplier::is_available() const {
+    return true;
+}
+
+} // namespace MatrixMultiply
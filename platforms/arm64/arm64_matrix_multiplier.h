@@ -0,0 +1,94 @@
+#ifndef ARM64_MATRIX_MULTIPLIER_H
+#define ARM64_MATRIX_MULTIPLIER_H
+
+#include "../../common/blocked_gemm.h"
+#include "../../common/matrix_multiply_interface.h"
+
+namespace MatrixMultiply {
+
+/**
+ * @brief Cache-blocked SVE matrix multiplier (Graviton3, Neoverse V1/V2, A64FX)
+ *
+ * Vector length agnostic: the micro-tile is 8 rows by two SVE vectors, so
+ * its width follows the hardware (16 floats on 256-bit SVE). Only available
+ * when the binary was built with SVE enabled and the CPU reports it.
+ * BF16 and FP16 operands are widened to FP32 while packing; INT8 uses the
+ * portable INT32 path.
+ */
+class ARM64SVEMatrixMultiplier : public MatrixMultiplier {
+public:
+    ARM64SVEMatrixMultiplier();
+    ~ARM64SVEMatrixMultiplier() override = default;
+
+    MatrixPerformanceStats multiply_float(
+        float* C, const float* A, const float* B,
+        const MatrixConfig& config,
+        const std::atomic<bool>& stop_flag) override;
+
+    MatrixPerformanceStats multiply_double(
+        double* C, const double* A, const double* B,
+        const MatrixConfig& config,
+        const std::atomic<bool>& stop_flag) override;
+
+    MatrixPerformanceStats multiply_bf16(
+        float* C, const BFloat16* A, const BFloat16* B,
+        const MatrixConfig& config,
+        const std::atomic<bool>& stop_flag) override;
+
+    MatrixPerformanceStats multiply_fp16(
+        float* C, const Float16* A, const Float16* B,
+        const MatrixConfig& config,
+        const std::atomic<bool>& stop_flag) override;
+
+    std::string get_acceleration_name() const override;
+    bool is_available() const override;
+
+private:
+    bool sve_available_;
+    BlockedGemm::Workspace<float> float_workspace_;
+    BlockedGemm::Workspace<double> double_workspace_;
+};
+
+/**
+ * @brief Cache-blocked NEON FMA matrix multiplier
+ *
+ * Advanced SIMD is mandatory on AArch64, so this is the fallback for cores
+ * without SVE (Graviton2, Neoverse N1, Ampere Altra). BF16 and FP16
+ * operands are widened to FP32 while packing.
+ */
+class ARM64NeonMatrixMultiplier : public MatrixMultiplier {
+public:
+    ARM64NeonMatrixMultiplier() = default;
+    ~ARM64NeonMatrixMultiplier() override = default;
+
+    MatrixPerformanceStats multiply_float(
+        float* C, const float* A, const float* B,
+        const MatrixConfig& config,
+        const std::atomic<bool>& stop_flag) override;
+
+    MatrixPerformanceStats multiply_double(
+        double* C, const double* A, const double* B,
+        const MatrixConfig& config,
+        const std::atomic<bool>& stop_flag) override;
+
+    MatrixPerformanceStats multiply_bf16(
+        float* C, const BFloat16* A, const BFloat16* B,
+        const MatrixConfig& config,
+        const std::atomic<bool>& stop_flag) override;
+
+    MatrixPerformanceStats multiply_fp16(
+        float* C, const Float16* A, const Float16* B,
+        const MatrixConfig& config,
+        const std::atomic<bool>& stop_flag) override;
+
+    std::string get_acceleration_name() const override;
+    bool is_available() const override;
+
+private:
+    BlockedGemm::Workspace<float> float_workspace_;
+    BlockedGemm::Workspace<double> double_workspace_;
+};
+
+} // namespace MatrixMultiply
+
+#endif // ARM64_MATRIX_MULTIPLIER_H
@@ -1,5 +1,9 @@
 #include "arm64_platform.h"
-#include "../common/safe_file_utils.h"
+#include "arm64_matrix_multiplier.h"
+#include "../../common/safe_file_utils.h"
+#include "../../common/numa_utils.h"
+#include "../../common/cpu_topology.h"
+#include "../../common/memory_detection.h"
 #include <thread>
 #include <cstdio>
 #include <fstream>
@@ -8,6 +12,7 @@
 #include <pthread.h>
 #include <sys/sysinfo.h>
 #include <unistd.h>  // for sysconf
+#include <linux/perf_event.h>
 #endif
 
 std::pair<std::string, std::string> ARM64Platform::detect_processor_info() {
@@ -183,99 +188,74 @@ CacheInfo ARM64Platform::detect_cache_info() {
     };
 
 #ifdef __linux__
-    // Try to get cache info from sysfs - ARM64 systems may have different organization
-    for (int cpu = 0; cpu < 8; ++cpu) {
-        for (int i = 0; i < 6; ++i) {
-            std::string level_path = "/sys/devices/system/cpu/cpu" + std::to_string(cpu) + "/cache/index" + std::to_string(i) + "/level";
-            std::string type_path = "/sys/devices/system/cpu/cpu" + std::to_string(cpu) + "/cache/index" + std::to_string(i) + "/type";
-            std::string size_path = "/sys/devices/system/cpu/cpu" + std::to_string(cpu) + "/cache/index" + std::to_string(i) + "/size";
-            
-            std::ifstream level_file(level_path);
-            std::ifstream type_file(type_path);
-            std::ifstream size_file(size_path);
-            
-            if (level_file.is_open() && type_file.is_open() && size_file.is_open()) {
-                int level;
-                std::string type;
-                std::string size_str;
-                
-                level_file >> level;
-                type_file >> type;
-                size_file >> size_str;
-                
-                size_t size_bytes = 0;
-                if (size_str.find("K") != std::string::npos) {
-                    size_t k_pos = size_str.find("K");
-                    size_bytes = std::stoul(size_str.substr(0, k_pos)) * 1024;
-                } else if (size_str.find("M") != std::string::npos) {
-                    size_t m_pos = size_str.find("M");
-                    size_bytes = std::stoul(size_str.substr(0, m_pos)) * 1024 * 1024;
-                }
-                
-                if (size_bytes > 0) {
-                    if (level == 1 && type == "Data") {
-                        info.l1_data_size = size_bytes;
-                    } else if (level == 1 && type == "Instruction") {
-                        info.l1_instruction_size = size_bytes;
-                    } else if (level == 2 && type == "Unified") {
-                        info.l2_size = size_bytes;
-                    } else if (level == 3 && type == "Unified") {
-                        info.l3_size = size_bytes;
-                    }
-                }
-            }
-        }
-    }
+    // Sizes of the first performance core (CPU 0 unless it is an E-core), sharing of every instance
+    const CpuTopology& topology = CpuTopologyUtils::get_topology();
+    std::vector<size_t> performance_cpus = CpuTopologyUtils::cpus_of_type(topology, CPUAffinityType::P_CORES);
+    CpuTopologyUtils::read_cache_sizes(performance_cpus.empty() ? 0 : performance_cpus.front(), info);
+    CpuTopologyUtils::read_cache_sharing(topology, info);
 #endif
 
     return info;
 }
 
 CacheInfo ARM64Platform::get_core_specific_cache_info(CPUAffinityType affinity_type) {
-    // ARM64 big.LITTLE could have different cache sizes for big vs little cores
-    // This would need platform-specific implementation for each SoC
     CacheInfo info = detect_cache_info();
-    
-    if (affinity_type == CPUAffinityType::P_CORES) {
-        // Big cores typically have larger caches
-        info.l1_data_size = 128 * 1024;      // 128KB L1D for big cores
-        info.l1_instruction_size = 128 * 1024; // 128KB L1I for big cores
-        info.l2_size = 1024 * 1024;          // 1MB L2 for big cores
-    } else if (affinity_type == CPUAffinityType::E_CORES) {
-        // Little cores have smaller caches
-        info.l1_data_size = 64 * 1024;       // 64KB L1D for little cores
-        info.l1_instruction_size = 64 * 1024; // 64KB L1I for little cores
-        info.l2_size = 256 * 1024;           // 256KB L2 for little cores
+    const CpuTopology& topology = CpuTopologyUtils::get_topology();
+    if (affinity_type == CPUAffinityType::DEFAULT || !topology.hybrid) {
+        return info;
+    }
+
+    // Caches of the first CPU of the requested core type
+    std::vector<size_t> cpus = CpuTopologyUtils::cpus_of_type(topology, affinity_type);
+    if (!cpus.empty()) {
+        CpuTopologyUtils::read_cache_sizes(cpus.front(), info);
     }
-    
     return info;
 }
 
 size_t ARM64Platform::get_max_threads_for_affinity(CPUAffinityType affinity_type) {
-    // This would need to be implemented based on the specific ARM64 SoC
-    // For now, return total threads for any affinity type
-    (void)affinity_type;
-    return std::thread::hardware_concurrency();
+    if (affinity_type == CPUAffinityType::DEFAULT) {
+        return std::thread::hardware_concurrency();
+    }
+    return CpuTopologyUtils::cpus_of_type(CpuTopologyUtils::get_topology(), affinity_type).size();
 }
 
 void ARM64Platform::set_thread_affinity(size_t thread_id, CPUAffinityType affinity_type, size_t total_threads) {
-    (void)affinity_type;
     (void)total_threads;
     
 #ifdef __linux__
-    // ARM64 big.LITTLE affinity would need platform-specific implementation
-    // For now, just set standard CPU affinity
+    // Thread i goes to logical CPU i, or to the i-th CPU of the requested core type
+    size_t cpu = thread_id % std::thread::hardware_concurrency();
+    if (affinity_type != CPUAffinityType::DEFAULT) {
+        std::vector<size_t> cpus = CpuTopologyUtils::cpus_of_type(CpuTopologyUtils::get_topology(), affinity_type);
+        if (!cpus.empty()) {
+            cpu = cpus[thread_id % cpus.size()];
+        }
+    }
     cpu_set_t cpuset;
     CPU_ZERO(&cpuset);
-    CPU_SET(thread_id % std::thread::hardware_concurrency(), &cpuset);
+    CPU_SET(cpu, &cpuset);
     pthread_setaffinity_np(pthread_self(), sizeof(cpu_set_t), &cpuset);
 #else
     (void)thread_id;
+    (void)affinity_type;
 #endif
 }
 
 bool ARM64Platform::validate_thread_count(size_t num_threads, CPUAffinityType affinity_type, std::string& error_msg) {
-    (void)affinity_type;  // ARM64 big.LITTLE would need platform-specific detection
+    if (affinity_type != CPUAffinityType::DEFAULT) {
+        std::string core_type = affinity_type == CPUAffinityType::P_CORES ? "P-cores" : "E-cores";
+        size_t core_threads = get_max_threads_for_affinity(affinity_type);
+        if (core_threads == 0) {
+            error_msg = "No " + core_type + " detected (this CPU does not mix performance and efficiency cores)";
+            return false;
+        }
+        if (num_threads > core_threads) {
+            error_msg = core_type + " are limited to " + std::to_string(core_threads) +
+                        " threads (requested: " + std::to_string(num_threads) + ")";
+            return false;
+        }
+    }
     
     // Basic sanity check
     size_t max_threads = std::thread::hardware_concurrency() * 2;  // Allow some oversubscription
@@ -288,6 +268,27 @@ bool ARM64Platform::validate_thread_count(size_t num_threads, CPUAffinityType af
     return true;
 }
 
+NumaTopology ARM64Platform::detect_numa_topology() {
+    return NumaUtils::detect_topology();
+}
+
+CpuTopology ARM64Platform::detect_cpu_topology() {
+    return CpuTopologyUtils::detect_topology(NumaUtils::get_topology());
+}
+
+bool ARM64Platform::bind_thread_to_numa_node(size_t thread_id, size_t node_id) {
+    return NumaUtils::bind_thread_to_node(thread_id, node_id);
+}
+
+bool ARM64Platform::bind_memory_to_numa_node(void* addr, size_t length, size_t node_id) {
+    return NumaUtils::bind_memory_to_node(addr, length, node_id);
+}
+
+bool ARM64Platform::interleave_memory_across_numa_nodes(void* addr, size_t length,
+                                                        const std::vector<NumaWeight>& weights, std::string& policy) {
+    return NumaUtils::interleave_memory(addr, length, weights, policy);
+}
+
 MemorySpecs ARM64Platform::get_memory_specs() {
     MemorySpecs specs;
     
@@ -304,6 +305,12 @@ MemorySpecs ARM64Platform::get_memory_specs() {
     specs.num_channels_detected = false;  // Not detected from system
     specs.is_unified_memory = false;
     specs.architecture = "ARM64 Architecture";
+#ifdef __linux__
+    // Installed memory as the kernel sees it, replaced by the SMBIOS or EDAC total when those can be read
+    struct sysinfo si;
+    specs.total_size_gb = (sysinfo(&si) == 0) ? si.totalram * si.mem_unit / (1024 * 1024 * 1024) : 0;
+#endif
+    MemoryDetection::detect(specs);  // SMBIOS on servers, EDAC where a driver is loaded
     
     return specs;
 }
@@ -311,8 +318,9 @@ MemorySpecs ARM64Platform::get_memory_specs() {
 SystemInfo ARM64Platform::get_system_info() {
     SystemInfo sys_info;
     
-    sys_info.cpu_cores = std::thread::hardware_concurrency();
-    sys_info.cpu_threads = std::thread::hardware_concurrency();
+    CpuTopology topology = detect_cpu_topology();
+    sys_info.cpu_cores = topology.physical_cores;
+    sys_info.cpu_threads = topology.cpus.size();
     sys_info.cache_line_size = detect_cache_line_size();
     
     auto [arch, model] = detect_processor_info();
@@ -332,3 +340,42 @@ SystemInfo ARM64Platform::get_system_info() {
     return sys_info;
 }
 
+std::unique_ptr<MatrixMultiply::MatrixMultiplier> ARM64Platform::create_matrix_multiplier() {
+    // SVE when both the build and the CPU support it, NEON otherwise
+    auto sve = std::make_unique<MatrixMultiply::ARM64SVEMatrixMultiplier>();
+    if (sve->is_available()) {
+        return sve;
+    }
+    return std::make_unique<MatrixMultiply::ARM64NeonMatrixMultiplier>();
+}
+
+std::unique_ptr<PerfCounters::CounterGroup> ARM64Platform::create_thread_counters() {
+#ifdef __linux__
+    // LL_CACHE_MISS_RD (0x37) is an Armv8.1 common PMU event
+    std::vector<PerfCounters::EventSpec> events = PerfCounters::generic_core_events();
+    events.push_back({PerfCounters::Counter::LLC_MISS_LOADS, PERF_TYPE_RAW, 0x37});
+    return PerfCounters::create_perf_event_group(events);
+#else
+    return nullptr;
+#endif
+}
+
+std::unique_ptr<PerfCounters::CounterGroup> ARM64Platform::create_uncore_counters() {
+    // Memory-controller PMUs (CMN, DMC-620) have no common event names to discover
+    return nullptr;
+}
+
+std::unique_ptr<PrefetchControl::HardwarePrefetchers> ARM64Platform::create_prefetcher_control() {
+    // Prefetcher controls (CPUACTLR_EL1 and similar) are implementation defined and EL1-only
+    return nullptr;
+}
+
+std::unique_ptr<EnergyMeter::Meter> ARM64Platform::create_energy_meter() {
+    // Arm servers rarely register RAPL-style powercap zones; SCMI and hwmon power sensors are not counters
+    return EnergyMeter::create_powercap_meter();
+}
+
+std::unique_ptr<GpuBandwidth::Device> ARM64Platform::create_gpu_device() {
+    // No compute API is assumed on Linux Arm boards
+    return nullptr;
+}
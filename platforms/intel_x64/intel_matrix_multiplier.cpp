@@ -0,0 +1,383 @@
+#include "intel_matrix_multiplier.h"
+#include "../../common/cpu_features.h"
+
+#include <immintrin.h>
+
+#include <algorithm>
+#include <chrono>
+#include <cstring>
+#include <type_traits>
+
+#ifdef __linux__
+#include <sys/syscall.h>
+#include <unistd.h>
+#endif
+
+namespace MatrixMultiply {
+
+namespace {
+
+// AVX-512 register blocking: 12 rows x 2 vectors = 24 ZMM accumulators,
+// leaving room for the two B vectors and the A broadcast
+constexpr size_t AVX512_MR = 12;
+constexpr size_t AVX512_FLOAT_NR = 32;
+constexpr size_t AVX512_DOUBLE_NR = 16;
+
+// KC x NR B micro-panel (32 KB float) stays in L1, MC x KC A block in L2
+constexpr BlockedGemm::Blocking AVX512_FLOAT_BLOCKING = {AVX512_MR, AVX512_FLOAT_NR, 120, 256, 4096};
+constexpr BlockedGemm::Blocking AVX512_DOUBLE_BLOCKING = {AVX512_MR, AVX512_DOUBLE_NR, 96, 256, 2048};
+
+__attribute__((target("avx512f")))
+void avx512_float_kernel(size_t kc, const float* a, const float* b, float* c, size_t ldc) {
+    __m512 acc[AVX512_MR][2];
+#pragma GCC unroll 12
+    for (size_t i = 0; i < AVX512_MR; ++i) {
+        acc[i][0] = _mm512_setzero_ps();
+        acc[i][1] = _mm512_setzero_ps();
+    }
+
+    for (size_t k = 0; k < kc; ++k) {
+        __m512 b0 = _mm512_loadu_ps(b);
+        __m512 b1 = _mm512_loadu_ps(b + 16);
+#pragma GCC unroll 12
+        for (size_t i = 0; i < AVX512_MR; ++i) {
+            __m512 ai = _mm512_set1_ps(a[i]);
+            acc[i][0] = _mm512_fmadd_ps(ai, b0, acc[i][0]);
+            acc[i][1] = _mm512_fmadd_ps(ai, b1, acc[i][1]);
+        }
+        a += AVX512_MR;
+        b += AVX512_FLOAT_NR;
+    }
+
+#pragma GCC unroll 12
+    for (size_t i = 0; i < AVX512_MR; ++i) {
+        float* row = c + i * ldc;
+        _mm512_storeu_ps(row, _mm512_add_ps(_mm512_loadu_ps(row), acc[i][0]));
+        _mm512_storeu_ps(row + 16, _mm512_add_ps(_mm512_loadu_ps(row + 16), acc[i][1]));
+    }
+}
+
+__attribute__((target("avx512f")))
+void avx512_double_kernel(size_t kc, const double* a, const double* b, double* c, size_t ldc) {
+    __m512d acc[AVX512_MR][2];
+#pragma GCC unroll 12
+    for (size_t i = 0; i < AVX512_MR; ++i) {
+        acc[i][0] = _mm512_setzero_pd();
+        acc[i][1] = _mm512_setzero_pd();
+    }
+
+    for (size_t k = 0; k < kc; ++k) {
+        __m512d b0 = _mm512_loadu_pd(b);
+        __m512d b1 = _mm512_loadu_pd(b + 8);
+#pragma GCC unroll 12
+        for (size_t i = 0; i < AVX512_MR; ++i) {
+            __m512d ai = _mm512_set1_pd(a[i]);
+            acc[i][0] = _mm512_fmadd_pd(ai, b0, acc[i][0]);
+            acc[i][1] = _mm512_fmadd_pd(ai, b1, acc[i][1]);
+        }
+        a += AVX512_MR;
+        b += AVX512_DOUBLE_NR;
+    }
+
+#pragma GCC unroll 12
+    for (size_t i = 0; i < AVX512_MR; ++i) {
+        double* row = c + i * ldc;
+        _mm512_storeu_pd(row, _mm512_add_pd(_mm512_loadu_pd(row), acc[i][0]));
+        _mm512_storeu_pd(row + 8, _mm512_add_pd(_mm512_loadu_pd(row + 8), acc[i][1]));
+    }
+}
+
+// AMX tiles are 16 rows of 64 bytes. A tiles hold 16 rows of 32 BF16 (or
+// 64 INT8) values; B tiles hold the same depth as VNNI groups of 2 (or 4)
+// consecutive k for 16 columns; C tiles hold 16x16 FP32 (or INT32). A 32x32
+// C block uses tiles 0-3.
+constexpr size_t AMX_TILE_ROWS = 16;
+constexpr size_t AMX_TILE_STRIDE = 64;
+constexpr size_t AMX_BLOCK = 2 * AMX_TILE_ROWS;
+
+template <typename E>
+constexpr size_t amx_tile_depth = AMX_TILE_STRIDE / sizeof(E);
+
+template <typename E>
+constexpr size_t amx_tile_elements = AMX_TILE_ROWS * amx_tile_depth<E>;
+
+template <typename E>
+constexpr size_t amx_vnni_group = 4 / sizeof(E);
+
+#ifdef __linux__
+constexpr int ARCH_REQ_XCOMP_PERM = 0x1023;
+constexpr int XFEATURE_XTILEDATA = 18;
+#endif
+
+/**
+ * @brief Tile configuration loaded by LDTILECFG (palette 1)
+ */
+struct alignas(64) TileConfig {
+    uint8_t palette_id;
+    uint8_t start_row;
+    uint8_t reserved[14];
+    uint16_t colsb[16];
+    uint8_t rows[16];
+};
+
+bool request_amx_permission() {
+#ifdef __linux__
+    // Permission is process-wide and only needs to be granted once
+    static const bool granted = syscall(SYS_arch_prctl, ARCH_REQ_XCOMP_PERM, XFEATURE_XTILEDATA) == 0;
+    return granted;
+#else
+    return false;
+#endif
+}
+
+/**
+ * @brief Pack A as [row block][k chunk] 16-row tiles, zero-padded
+ */
+template <typename E>
+void pack_a_tiles(const E* A, size_t M, size_t K, size_t Mp, size_t Kp, E* packed) {
+    constexpr size_t depth = amx_tile_depth<E>;
+    for (size_t i0 = 0; i0 < Mp; i0 += AMX_TILE_ROWS) {
+        for (size_t k0 = 0; k0 < Kp; k0 += depth) {
+            for (size_t r = 0; r < AMX_TILE_ROWS; ++r) {
+                size_t i = i0 + r;
+                for (size_t kk = 0; kk < depth; ++kk) {
+                    size_t k = k0 + kk;
+                    *packed++ = (i < M && k < K) ? A[i * K + k] : E{};
+                }
+            }
+        }
+    }
+}
+
+/**
+ * @brief Pack B as [column block][k chunk] VNNI tiles: row p holds the groups
+ *        (B[g*p][j] .. B[g*p+g-1][j]) for 16 consecutive columns j, zero-padded
+ */
+template <typename E>
+void pack_b_tiles(const E* B, size_t K, size_t N, size_t Kp, size_t Np, E* packed) {
+    constexpr size_t depth = amx_tile_depth<E>;
+    constexpr size_t group = amx_vnni_group<E>;
+    for (size_t j0 = 0; j0 < Np; j0 += AMX_TILE_ROWS) {
+        for (size_t k0 = 0; k0 < Kp; k0 += depth) {
+            for (size_t p = 0; p < depth / group; ++p) {
+                for (size_t jj = 0; jj < AMX_TILE_ROWS; ++jj) {
+                    size_t j = j0 + jj;
+                    for (size_t e = 0; e < group; ++e) {
+                        size_t k = k0 + group * p + e;
+                        *packed++ = (k < K && j < N) ? B[k * N + j] : E{};
+                    }
+                }
+            }
+        }
+    }
+}
+
+/**
+ * @brief C += packed A * packed B with TDPBF16PS or TDPBSSD (Mp, Np multiples of 32)
+ */
+template <typename E, typename Acc>
+__attribute__((target("amx-tile,amx-bf16,amx-int8")))
+void amx_gemm(Acc* C, const E* a, const E* b, size_t M, size_t N, size_t Mp, size_t Np, size_t k_chunks) {
+    TileConfig config = {};
+    config.palette_id = 1;
+    for (size_t t = 0; t < 8; ++t) {
+        config.rows[t] = AMX_TILE_ROWS;
+        config.colsb[t] = AMX_TILE_STRIDE;
+    }
+    _tile_loadconfig(&config);
+
+    const size_t panel = k_chunks * amx_tile_elements<E>;
+    alignas(64) Acc block[AMX_BLOCK * AMX_BLOCK];
+    const size_t block_stride = AMX_BLOCK * sizeof(Acc);
+
+    for (size_t i0 = 0; i0 < Mp; i0 += AMX_BLOCK) {
+        const E* a0 = a + (i0 / AMX_TILE_ROWS) * panel;
+        const E* a1 = a0 + panel;
+        for (size_t j0 = 0; j0 < Np; j0 += AMX_BLOCK) {
+            const E* b0 = b + (j0 / AMX_TILE_ROWS) * panel;
+            const E* b1 = b0 + panel;
+
+            _tile_zero(0);
+            _tile_zero(1);
+            _tile_zero(2);
+            _tile_zero(3);
+            for (size_t kc = 0; kc < k_chunks; ++kc) {
+                size_t offset = kc * amx_tile_elements<E>;
+                _tile_loadd(4, a0 + offset, AMX_TILE_STRIDE);
+                _tile_loadd(5, a1 + offset, AMX_TILE_STRIDE);
+                _tile_loadd(6, b0 + offset, AMX_TILE_STRIDE);
+                _tile_loadd(7, b1 + offset, AMX_TILE_STRIDE);
+                if constexpr (std::is_same_v<E, int8_t>) {
+                    _tile_dpbssd(0, 4, 6);
+                    _tile_dpbssd(1, 4, 7);
+                    _tile_dpbssd(2, 5, 6);
+                    _tile_dpbssd(3, 5, 7);
+                } else {
+                    _tile_dpbf16ps(0, 4, 6);
+                    _tile_dpbf16ps(1, 4, 7);
+                    _tile_dpbf16ps(2, 5, 6);
+                    _tile_dpbf16ps(3, 5, 7);
+                }
+            }
+            _tile_stored(0, block, block_stride);
+            _tile_stored(1, block + AMX_TILE_ROWS, block_stride);
+            _tile_stored(2, block + AMX_TILE_ROWS * AMX_BLOCK, block_stride);
+            _tile_stored(3, block + AMX_TILE_ROWS * AMX_BLOCK + AMX_TILE_ROWS, block_stride);
+
+            size_t rows = std::min(AMX_BLOCK, M - std::min(M, i0));
+            size_t cols = std::min(AMX_BLOCK, N - std::min(N, j0));
+            for (size_t i = 0; i < rows; ++i) {
+                Acc* c_row = C + (i0 + i) * N + j0;
+                for (size_t j = 0; j < cols; ++j) {
+                    c_row[j] += block[i * AMX_BLOCK + j];
+                }
+            }
+        }
+    }
+    _tile_release();
+}
+
+/**
+ * @brief Repack the operands into tiles and run amx_gemm config.iterations times
+ *
+ * Packing is inside the timed loop, like the blocked driver's, so every
+ * backend pays for its own operand layout.
+ */
+template <typename E, typename Acc>
+MatrixPerformanceStats amx_timed_multiply(Acc* C, const E* A, const E* B, const MatrixConfig& config,
+                                          const std::atomic<bool>& stop_flag, std::vector<E>& packed_a,
+                                          std::vector<E>& packed_b, const std::string& acceleration) {
+    const size_t M = config.M;
+    const size_t K = config.K;
+    const size_t N = config.N;
+    const size_t Mp = BlockedGemm::round_up(M, AMX_BLOCK);
+    const size_t Np = BlockedGemm::round_up(N, AMX_BLOCK);
+    const size_t Kp = BlockedGemm::round_up(K, amx_tile_depth<E>);
+
+    packed_a.resize(Mp * Kp);
+    packed_b.resize(Kp * Np);
+    memset(C, 0, M * N * sizeof(Acc));
+
+    size_t completed = 0;
+    auto start_time = std::chrono::high_resolution_clock::now();
+
+    for (size_t iter = 0; iter < config.iterations && !stop_flag; ++iter) {
+        pack_a_tiles(A, M, K, Mp, Kp, packed_a.data());
+        pack_b_tiles(B, K, N, Kp, Np, packed_b.data());
+        amx_gemm(C, packed_a.data(), packed_b.data(), M, N, Mp, Np, Kp / amx_tile_depth<E>);
+        ++completed;
+    }
+
+    auto end_time = std::chrono::high_resolution_clock::now();
+    double time_seconds = std::chrono::duration<double>(end_time - start_time).count();
+
+    size_t operations = 2 * M * N * K * completed;
+    size_t bytes_processed = ((M * K + K * N) * sizeof(E) + M * N * sizeof(Acc)) * completed;
+
+    return calculate_matrix_stats(bytes_processed, time_seconds, operations, acceleration);
+}
+
+}  // namespace
+
+IntelAVX512MatrixMultiplier::IntelAVX512MatrixMultiplier()
+    : avx512_available_(CpuFeatureDetection::get_cpu_features().avx512f) {}
+
+MatrixPerformanceStats IntelAVX512MatrixMultiplier::multiply_float(
+    float* C, const float* A, const float* B,
+    const MatrixConfig& config,
+    const std::atomic<bool>& stop_flag) {
+    return BlockedGemm::timed_multiply(C, A, B, config, stop_flag, AVX512_FLOAT_BLOCKING, avx512_float_kernel,
+                                       float_workspace_, get_acceleration_name());
+}
+
+MatrixPerformanceStats IntelAVX512MatrixMultiplier::multiply_double(
+    double* C, const double* A, const double* B,
+    const MatrixConfig& config,
+    const std::atomic<bool>& stop_flag) {
+    return BlockedGemm::timed_multiply(C, A, B, config, stop_flag, AVX512_DOUBLE_BLOCKING, avx512_double_kernel,
+                                       double_workspace_, get_acceleration_name());
+}
+
+MatrixPerformanceStats IntelAVX512MatrixMultiplier::multiply_bf16(
+    float* C, const BFloat16* A, const BFloat16* B,
+    const MatrixConfig& config,
+    const std::atomic<bool>& stop_flag) {
+    return BlockedGemm::timed_multiply(C, A, B, config, stop_flag, AVX512_FLOAT_BLOCKING, avx512_float_kernel,
+                                       float_workspace_,
+                                       converted_acceleration_name(get_acceleration_name(), MatrixPrecision::BF16));
+}
+
+MatrixPerformanceStats IntelAVX512MatrixMultiplier::multiply_fp16(
+    float* C, const Float16* A, const Float16* B,
+    const MatrixConfig& config,
+    const std::atomic<bool>& stop_flag) {
+    return BlockedGemm::timed_multiply(C, A, B, config, stop_flag, AVX512_FLOAT_BLOCKING, avx512_float_kernel,
+                                       float_workspace_,
+                                       converted_acceleration_name(get_acceleration_name(), MatrixPrecision::FP16));
+}
+
+std::string IntelAVX512MatrixMultiplier::get_acceleration_name() const {
+    return "AVX-512 FMA";
+}
+
+bool IntelAVX512MatrixMultiplier::is_available() const {
+    return avx512_available_;
+}
+
+IntelAMXMatrixMultiplier::IntelAMXMatrixMultiplier() : amx_available_(false), amx_int8_(false) {
+    const CpuFeatures& features = CpuFeatureDetection::get_cpu_features();
+    // FP32, FP64, FP16 and any non-AMX work go through the AVX-512 kernel
+    if (features.amx_tile && features.amx_bf16 && features.avx512f) {
+        amx_available_ = request_amx_permission();
+        amx_int8_ = amx_available_ && features.amx_int8;
+    }
+}
+
+MatrixPerformanceStats IntelAMXMatrixMultiplier::multiply_float(
+    float* C, const float* A, const float* B,
+    const MatrixConfig& config,
+    const std::atomic<bool>& stop_flag) {
+    // Tiles have no FP32 multiply; BF16 throughput is reported as BF16
+    return avx512_.multiply_float(C, A, B, config, stop_flag);
+}
+
+MatrixPerformanceStats IntelAMXMatrixMultiplier::multiply_double(
+    double* C, const double* A, const double* B,
+    const MatrixConfig& config,
+    const std::atomic<bool>& stop_flag) {
+    return avx512_.multiply_double(C, A, B, config, stop_flag);
+}
+
+MatrixPerformanceStats IntelAMXMatrixMultiplier::multiply_bf16(
+    float* C, const BFloat16* A, const BFloat16* B,
+    const MatrixConfig& config,
+    const std::atomic<bool>& stop_flag) {
+    return amx_timed_multiply(C, A, B, config, stop_flag, bf16_a_, bf16_b_, get_acceleration_name());
+}
+
+MatrixPerformanceStats IntelAMXMatrixMultiplier::multiply_fp16(
+    float* C, const Float16* A, const Float16* B,
+    const MatrixConfig& config,
+    const std::atomic<bool>& stop_flag) {
+    return avx512_.multiply_fp16(C, A, B, config, stop_flag);
+}
+
+MatrixPerformanceStats IntelAMXMatrixMultiplier::multiply_int8(
+    int32_t* C, const int8_t* A, const int8_t* B,
+    const MatrixConfig& config,
+    const std::atomic<bool>& stop_flag) {
+    if (!amx_int8_) {
+        return MatrixMultiplier::multiply_int8(C, A, B, config, stop_flag);
+    }
+    return amx_timed_multiply(C, A, B, config, stop_flag, int8_a_, int8_b_, "Intel AMX (INT8)");
+}
+
+std::string IntelAMXMatrixMultiplier::get_acceleration_name() const {
+    return "Intel AMX (BF16)";
+}
+
+bool IntelAMXMatrixMultiplier::is_available() const {
+    return amx_available_;
+}
+
+} // namespace MatrixMultiply
@@ -0,0 +1,113 @@
+#ifndef INTEL_MATRIX_MULTIPLIER_H
+#define INTEL_MATRIX_MULTIPLIER_H
+
+#include "../../common/blocked_gemm.h"
+#include "../../common/matrix_multiply_interface.h"
+
+#include <cstdint>
+#include <vector>
+
+namespace MatrixMultiply {
+
+/**
+ * @brief Cache-blocked AVX-512 FMA matrix multiplier
+ *
+ * Packs A and B into register-sized micro-panels and runs a 12x32 (float)
+ * or 12x16 (double) FMA micro-kernel, keeping 24 accumulators in ZMM
+ * registers. Available on any CPU that reports AVX-512F. BF16 and FP16
+ * operands are widened to FP32 while packing.
+ */
+class IntelAVX512MatrixMultiplier : public MatrixMultiplier {
+public:
+    IntelAVX512MatrixMultiplier();
+    ~IntelAVX512MatrixMultiplier() override = default;
+
+    MatrixPerformanceStats multiply_float(
+        float* C, const float* A, const float* B,
+        const MatrixConfig& config,
+        const std::atomic<bool>& stop_flag) override;
+
+    MatrixPerformanceStats multiply_double(
+        double* C, const double* A, const double* B,
+        const MatrixConfig& config,
+        const std::atomic<bool>& stop_flag) override;
+
+    MatrixPerformanceStats multiply_bf16(
+        float* C, const BFloat16* A, const BFloat16* B,
+        const MatrixConfig& config,
+        const std::atomic<bool>& stop_flag) override;
+
+    MatrixPerformanceStats multiply_fp16(
+        float* C, const Float16* A, const Float16* B,
+        const MatrixConfig& config,
+        const std::atomic<bool>& stop_flag) override;
+
+    std::string get_acceleration_name() const override;
+    bool is_available() const override;
+
+private:
+    bool avx512_available_;
+    BlockedGemm::Workspace<float> float_workspace_;
+    BlockedGemm::Workspace<double> double_workspace_;
+};
+
+/**
+ * @brief Intel AMX matrix multiplier (Sapphire Rapids and later)
+ *
+ * BF16 and INT8 operands are packed into tile-shaped panels: A as 16-row
+ * blocks of 64 bytes, B in the VNNI pair (BF16) or quad (INT8) layout
+ * TDPBF16PS and TDPBSSD expect. Each 32x32 block of C is accumulated in
+ * four FP32 or INT32 tiles while A and B tiles stream through the other
+ * four. FP64, FP32 and FP16 have no tile instruction here and run on the
+ * AVX-512 kernel, so each precision reports what it actually computed in.
+ *
+ * On Linux the process must be granted the XTILEDATA state component
+ * before the first tile instruction; is_available() is false if the
+ * kernel refuses.
+ */
+class IntelAMXMatrixMultiplier : public MatrixMultiplier {
+public:
+    IntelAMXMatrixMultiplier();
+    ~IntelAMXMatrixMultiplier() override = default;
+
+    MatrixPerformanceStats multiply_float(
+        float* C, const float* A, const float* B,
+        const MatrixConfig& config,
+        const std::atomic<bool>& stop_flag) override;
+
+    MatrixPerformanceStats multiply_double(
+        double* C, const double* A, const double* B,
+        const MatrixConfig& config,
+        const std::atomic<bool>& stop_flag) override;
+
+    MatrixPerformanceStats multiply_bf16(
+        float* C, const BFloat16* A, const BFloat16* B,
+        const MatrixConfig& config,
+        const std::atomic<bool>& stop_flag) override;
+
+    MatrixPerformanceStats multiply_fp16(
+        float* C, const Float16* A, const Float16* B,
+        const MatrixConfig& config,
+        const std::atomic<bool>& stop_flag) override;
+
+    MatrixPerformanceStats multiply_int8(
+        int32_t* C, const int8_t* A, const int8_t* B,
+        const MatrixConfig& config,
+        const std::atomic<bool>& stop_flag) override;
+
+    std::string get_acceleration_name() const override;
+    bool is_available() const override;
+
+private:
+    bool amx_available_;
+    bool amx_int8_;
+    IntelAVX512MatrixMultiplier avx512_;
+    std::vector<BFloat16> bf16_a_;
+    std::vector<BFloat16> bf16_b_;
+    std::vector<int8_t> int8_a_;
+    std::vector<int8_t> int8_b_;
+};
+
+} // namespace MatrixMultiply
+
+#endif // INTEL_MATRIX_MULTIPLIER_H
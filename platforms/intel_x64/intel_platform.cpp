@@ -1,5 +1,9 @@
 #include "intel_platform.h"
-#include "../common/safe_file_utils.h"
+#include "intel_matrix_multiplier.h"
+#include "../../common/safe_file_utils.h"
+#include "../../common/numa_utils.h"
+#include "../../common/cpu_topology.h"
+#include "../../common/memory_detection.h"
 #include <thread>
 #include <cstdio>
 #include <fstream>
@@ -11,6 +15,7 @@
 #include <sys/sysinfo.h>
 #include <cstring>
 #include <unistd.h>  // for sysconf
+#include <linux/perf_event.h>
 #endif
 
 std::pair<std::string, std::string> IntelPlatform::detect_processor_info() {
@@ -74,79 +79,74 @@ CacheInfo IntelPlatform::detect_cache_info() {
     };
 
 #ifdef __linux__
-    // Try to get cache info from sysfs
-    for (int i = 0; i < 4; ++i) {
-        std::string level_path = "/sys/devices/system/cpu/cpu0/cache/index" + std::to_string(i) + "/level";
-        std::string type_path = "/sys/devices/system/cpu/cpu0/cache/index" + std::to_string(i) + "/type";
-        std::string size_path = "/sys/devices/system/cpu/cpu0/cache/index" + std::to_string(i) + "/size";
-
-        std::ifstream level_file(level_path);
-        std::ifstream type_file(type_path);
-        std::ifstream size_file(size_path);
-
-        if (level_file.is_open() && type_file.is_open() && size_file.is_open()) {
-            int level;
-            std::string type;
-            std::string size_str;
-
-            level_file >> level;
-            type_file >> type;
-            size_file >> size_str;
-
-            size_t size_bytes = 0;
-            if (size_str.find("K") != std::string::npos) {
-                size_t k_pos = size_str.find("K");
-                size_bytes = std::stoul(size_str.substr(0, k_pos)) * 1024;
-            } else if (size_str.find("M") != std::string::npos) {
-                size_t m_pos = size_str.find("M");
-                size_bytes = std::stoul(size_str.substr(0, m_pos)) * 1024 * 1024;
-            }
-
-            if (size_bytes > 0) {
-                if (level == 1 && type == "Data") {
-                    info.l1_data_size = size_bytes;
-                } else if (level == 1 && type == "Instruction") {
-                    info.l1_instruction_size = size_bytes;
-                } else if (level == 2 && type == "Unified") {
-                    info.l2_size = size_bytes;
-                } else if (level == 3 && type == "Unified") {
-                    info.l3_size = size_bytes;
-                }
-            }
-        }
-    }
+    // Sizes of the first performance core (CPU 0 unless it is an E-core), sharing of every instance
+    const CpuTopology& topology = CpuTopologyUtils::get_topology();
+    std::vector<size_t> performance_cpus = CpuTopologyUtils::cpus_of_type(topology, CPUAffinityType::P_CORES);
+    CpuTopologyUtils::read_cache_sizes(performance_cpus.empty() ? 0 : performance_cpus.front(), info);
+    CpuTopologyUtils::read_cache_sharing(topology, info);
 #endif
 
     return info;
 }
 
 CacheInfo IntelPlatform::get_core_specific_cache_info(CPUAffinityType affinity_type) {
-    (void)affinity_type;  // Intel doesn't have heterogeneous cores like Apple Silicon
-    return detect_cache_info();
+    CacheInfo info = detect_cache_info();
+    const CpuTopology& topology = CpuTopologyUtils::get_topology();
+    if (affinity_type == CPUAffinityType::DEFAULT || !topology.hybrid) {
+        return info;
+    }
+
+    // Caches of the first CPU of the requested core type
+    std::vector<size_t> cpus = CpuTopologyUtils::cpus_of_type(topology, affinity_type);
+    if (!cpus.empty()) {
+        CpuTopologyUtils::read_cache_sizes(cpus.front(), info);
+    }
+    return info;
 }
 
 size_t IntelPlatform::get_max_threads_for_affinity(CPUAffinityType affinity_type) {
-    (void)affinity_type;  // Intel doesn't have P/E core distinction
-    return std::thread::hardware_concurrency();
+    if (affinity_type == CPUAffinityType::DEFAULT) {
+        return std::thread::hardware_concurrency();
+    }
+    return CpuTopologyUtils::cpus_of_type(CpuTopologyUtils::get_topology(), affinity_type).size();
 }
 
 void IntelPlatform::set_thread_affinity(size_t thread_id, CPUAffinityType affinity_type, size_t total_threads) {
-    (void)affinity_type;
     (void)total_threads;
     
 #ifdef __linux__
-    // Set standard CPU affinity on Linux
+    // Thread i goes to logical CPU i, or to the i-th CPU of the requested core type
+    size_t cpu = thread_id % std::thread::hardware_concurrency();
+    if (affinity_type != CPUAffinityType::DEFAULT) {
+        std::vector<size_t> cpus = CpuTopologyUtils::cpus_of_type(CpuTopologyUtils::get_topology(), affinity_type);
+        if (!cpus.empty()) {
+            cpu = cpus[thread_id % cpus.size()];
+        }
+    }
     cpu_set_t cpuset;
     CPU_ZERO(&cpuset);
-    CPU_SET(thread_id % std::thread::hardware_concurrency(), &cpuset);
+    CPU_SET(cpu, &cpuset);
     pthread_setaffinity_np(pthread_self(), sizeof(cpu_set_t), &cpuset);
 #else
-    (void)thread_id;  // No affinity support on other platforms
+    (void)thread_id;
+    (void)affinity_type;
 #endif
 }
 
 bool IntelPlatform::validate_thread_count(size_t num_threads, CPUAffinityType affinity_type, std::string& error_msg) {
-    (void)affinity_type;  // Intel doesn't have P/E core distinction, so no affinity-specific limits
+    if (affinity_type != CPUAffinityType::DEFAULT) {
+        std::string core_type = affinity_type == CPUAffinityType::P_CORES ? "P-cores" : "E-cores";
+        size_t core_threads = get_max_threads_for_affinity(affinity_type);
+        if (core_threads == 0) {
+            error_msg = "No " + core_type + " detected (this CPU does not mix performance and efficiency cores)";
+            return false;
+        }
+        if (num_threads > core_threads) {
+            error_msg = core_type + " are limited to " + std::to_string(core_threads) +
+                        " threads (requested: " + std::to_string(num_threads) + ")";
+            return false;
+        }
+    }
     
     // Basic sanity check
     size_t max_threads = std::thread::hardware_concurrency() * 2;  // Allow some oversubscription
@@ -159,6 +159,27 @@ bool IntelPlatform::validate_thread_count(size_t num_threads, CPUAffinityType af
     return true;
 }
 
+NumaTopology IntelPlatform::detect_numa_topology() {
+    return NumaUtils::detect_topology();
+}
+
+CpuTopology IntelPlatform::detect_cpu_topology() {
+    return CpuTopologyUtils::detect_topology(NumaUtils::get_topology());
+}
+
+bool IntelPlatform::bind_thread_to_numa_node(size_t thread_id, size_t node_id) {
+    return NumaUtils::bind_thread_to_node(thread_id, node_id);
+}
+
+bool IntelPlatform::bind_memory_to_numa_node(void* addr, size_t length, size_t node_id) {
+    return NumaUtils::bind_memory_to_node(addr, length, node_id);
+}
+
+bool IntelPlatform::interleave_memory_across_numa_nodes(void* addr, size_t length,
+                                                        const std::vector<NumaWeight>& weights, std::string& policy) {
+    return NumaUtils::interleave_memory(addr, length, weights, policy);
+}
+
 bool IntelPlatform::supports_cpu_affinity() {
 #ifdef __linux__
     return true;
@@ -219,7 +240,7 @@ MemorySpecs IntelPlatform::get_memory_specs() {
     // Detect virtualization
     bool is_virtualized = detect_virtualization();
     
-    // Default Intel platform specs - these would need to be detected
+    // Defaults, replaced by the SMBIOS or EDAC layout when it can be read
     specs.type = "DDR4";  // Common on Intel platforms
     specs.speed_mtps = 3200;
     specs.data_width_bits = 64;
@@ -228,9 +249,16 @@ MemorySpecs IntelPlatform::get_memory_specs() {
     specs.data_width_detected = false;
     specs.total_width_detected = false;
     specs.is_unified_memory = false;
+#ifdef __linux__
+    // Installed memory as the kernel sees it, replaced by the SMBIOS or EDAC total when those can be read
+    struct sysinfo si;
+    specs.total_size_gb = (sysinfo(&si) == 0) ? si.totalram * si.mem_unit / (1024 * 1024 * 1024) : 0;
+#endif
     
     // Handle channel detection based on virtualization
     if (is_virtualized) {
+        // The hypervisor's SMBIOS table still names the host's memory type and speed
+        MemoryDetection::detect(specs);
         specs.num_channels = 0;  // Cannot detect in virtualized environment
         specs.num_channels_detected = false;
         specs.theoretical_bandwidth_gbps = -1.0;  // N/A for virtualized systems
@@ -240,6 +268,7 @@ MemorySpecs IntelPlatform::get_memory_specs() {
         specs.num_channels_detected = false;  // Not detected from system
         specs.theoretical_bandwidth_gbps = (specs.speed_mtps * specs.data_width_bits * specs.num_channels) / 8.0 / 1000.0;
         specs.architecture = "Traditional NUMA Architecture";
+        MemoryDetection::detect(specs);
     }
     
     return specs;
@@ -249,8 +278,9 @@ SystemInfo IntelPlatform::get_system_info() {
     SystemInfo sys_info;
     
     // Basic system info
-    sys_info.cpu_cores = std::thread::hardware_concurrency();
-    sys_info.cpu_threads = std::thread::hardware_concurrency();
+    CpuTopology topology = detect_cpu_topology();
+    sys_info.cpu_cores = topology.physical_cores;
+    sys_info.cpu_threads = topology.cpus.size();
     sys_info.cache_line_size = detect_cache_line_size();
     
     auto [arch, model] = detect_processor_info();
@@ -272,4 +302,75 @@ SystemInfo IntelPlatform::get_system_info() {
 
 void IntelPlatform::detect_cache_associativity(CacheInfo& info) {
     (void)info;  // Placeholder - would implement cache associativity detection
-}
\ No newline at end of file
+}
+
+std::unique_ptr<MatrixMultiply::MatrixMultiplier> IntelPlatform::create_matrix_multiplier() {
+    // Prefer AMX tiles, then the AVX-512 FMA kernel; without either the
+    // portable loop in matrix_multiply_test is used
+    auto amx = std::make_unique<MatrixMultiply::IntelAMXMatrixMultiplier>();
+    if (amx->is_available()) {
+        return amx;
+    }
+    auto avx512 = std::make_unique<MatrixMultiply::IntelAVX512MatrixMultiplier>();
+    if (avx512->is_available()) {
+        return avx512;
+    }
+    return nullptr;
+}
+
+std::unique_ptr<PerfCounters::CounterGroup> IntelPlatform::create_thread_counters() {
+#ifdef __linux__
+    std::vector<PerfCounters::EventSpec> events = PerfCounters::generic_core_events();
+    // MEM_LOAD_RETIRED.L3_MISS (event 0xD1, umask 0x20) is an Intel encoding; AMD reuses the number
+    std::string vendor;
+    if (SafeFileUtils::find_pattern("/proc/cpuinfo", "vendor_id", vendor) &&
+        vendor.find("GenuineIntel") != std::string::npos) {
+        events.push_back({PerfCounters::Counter::LLC_MISS_LOADS, PERF_TYPE_RAW, 0x20d1});
+    }
+    return PerfCounters::create_perf_event_group(events);
+#else
+    return nullptr;
+#endif
+}
+
+std::unique_ptr<PerfCounters::CounterGroup> IntelPlatform::create_uncore_counters() {
+    // Integrated memory controllers count one 64-byte line per CAS command
+    std::vector<PerfCounters::EventSpec> events = PerfCounters::sysfs_uncore_events(
+        "uncore_imc", "cas_count_read", "cas_count_write", static_cast<double>(CacheConstants::DEFAULT_CACHE_LINE_SIZE));
+    return PerfCounters::create_perf_event_group(events);
+}
+
+std::unique_ptr<PrefetchControl::HardwarePrefetchers> IntelPlatform::create_prefetcher_control() {
+    // MSR_MISC_FEATURE_CONTROL: bits 0-3 disable the L2 streamer, L2 adjacent-line,
+    // L1 next-line and L1 IP-stride prefetchers. AMD uses other registers.
+    std::string vendor;
+    if (!SafeFileUtils::find_pattern("/proc/cpuinfo", "vendor_id", vendor) ||
+        vendor.find("GenuineIntel") == std::string::npos) {
+        return nullptr;
+    }
+    return PrefetchControl::create_msr_prefetchers(0x1A4, 0xF);
+}
+
+std::unique_ptr<EnergyMeter::Meter> IntelPlatform::create_energy_meter() {
+    // powercap knows the DRAM energy unit of each model; the raw MSRs give the package only
+    std::unique_ptr<EnergyMeter::Meter> meter = EnergyMeter::create_powercap_meter();
+    if (meter) {
+        return meter;
+    }
+    std::string vendor;
+    if (!SafeFileUtils::find_pattern("/proc/cpuinfo", "vendor_id", vendor)) {
+        return nullptr;
+    }
+    if (vendor.find("GenuineIntel") != std::string::npos) {
+        return EnergyMeter::create_rapl_msr_meter(0x606, 0x611);  // MSR_RAPL_POWER_UNIT, MSR_PKG_ENERGY_STATUS
+    }
+    if (vendor.find("AuthenticAMD") != std::string::npos) {
+        return EnergyMeter::create_rapl_msr_meter(0xC0010299, 0xC001029B);  // Zen: RAPL_PWR_UNIT, PKG_ENERGY_STAT
+    }
+    return nullptr;
+}
+
+std::unique_ptr<GpuBandwidth::Device> IntelPlatform::create_gpu_device() {
+    // Discrete GPUs do not share the CPU's memory; there is no integrated-GPU backend
+    return nullptr;
+}
@@ -24,6 +24,32 @@ public:
     size_t get_max_threads_for_affinity(CPUAffinityType affinity_type) override;
     void set_thread_affinity(size_t thread_id, CPUAffinityType affinity_type, size_t total_threads) override;
     bool validate_thread_count(size_t num_threads, CPUAffinityType affinity_type, std::string& error_msg) override;
+
+    // NUMA methods
+    NumaTopology detect_numa_topology() override;
+    bool bind_thread_to_numa_node(size_t thread_id, size_t node_id) override;
+    bool bind_memory_to_numa_node(void* addr, size_t length, size_t node_id) override;
+    bool interleave_memory_across_numa_nodes(void* addr, size_t length, const std::vector<NumaWeight>& weights,
+                                             std::string& policy) override;
+
+    // CPU topology
+    CpuTopology detect_cpu_topology() override;
+
+    // Matrix multiplication
+    std::unique_ptr<MatrixMultiply::MatrixMultiplier> create_matrix_multiplier() override;
+
+    // Hardware performance counters
+    std::unique_ptr<PerfCounters::CounterGroup> create_thread_counters() override;
+    std::unique_ptr<PerfCounters::CounterGroup> create_uncore_counters() override;
+
+    // Hardware prefetcher control
+    std::unique_ptr<PrefetchControl::HardwarePrefetchers> create_prefetcher_control() override;
+
+    // Energy counters
+    std::unique_ptr<EnergyMeter::Meter> create_energy_meter() override;
+
+    // GPU compute over unified memory
+    std::unique_ptr<GpuBandwidth::Device> create_gpu_device() override;
     
     // Platform identification
     std::string get_platform_name() override { return "Intel x64"; }
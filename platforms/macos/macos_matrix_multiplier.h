@@ -10,6 +10,7 @@ namespace MatrixMultiply {
  * 
  * Uses Apple's optimized BLAS routines which automatically dispatch to
  * Apple AMX (Matrix coprocessor) on M1/M2/M3 chips when beneficial.
+ * BF16, FP16 and INT8 use the portable path that widens while packing.
  */
 class MacOSMatrixMultiplier : public MatrixMultiplier {
 public:
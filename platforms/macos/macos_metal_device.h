@@ -0,0 +1,19 @@
+#ifndef MACOS_METAL_DEVICE_H
+#define MACOS_METAL_DEVICE_H
+
+#include <memory>
+
+#include "../../common/gpu_bandwidth.h"
+
+/**
+ * @brief Metal GPU that runs the --gpu kernels over CPU memory without copying
+ *
+ * The arrays are wrapped as shared-storage buffers in place
+ * (newBufferWithBytesNoCopy), so the GPU reads and writes the pages the CPU
+ * allocated. Only GPUs that report unified memory are used.
+ *
+ * @return nullptr without a Metal device or when the GPU has its own memory
+ */
+std::unique_ptr<GpuBandwidth::Device> create_metal_device();
+
+#endif  // MACOS_METAL_DEVICE_H
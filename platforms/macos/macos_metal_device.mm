@@ -0,0 +1,186 @@
+#include "macos_metal_device.h"
+#include "../../common/constants.h"
+
+#import <Foundation/Foundation.h>
+#import <Metal/Metal.h>
+
+#include <algorithm>
+#include <unistd.h>
+
+namespace {
+
+// float4 kernels with a grid-stride loop, so a fixed grid covers any array size
+const char* const KERNEL_SOURCE = R"(
+#include <metal_stdlib>
+using namespace metal;
+
+kernel void read_kernel(device const float4* b [[buffer(0)]],
+                        device float* partial [[buffer(1)]],
+                        constant uint& count [[buffer(2)]],
+                        uint id [[thread_position_in_grid]],
+                        uint grid [[threads_per_grid]]) {
+    float4 sum = 0.0f;
+    for (uint i = id; i < count; i += grid) {
+        sum += b[i];
+    }
+    partial[id] = sum.x + sum.y + sum.z + sum.w;
+}
+
+kernel void copy_kernel(device float4* a [[buffer(0)]],
+                        device const float4* b [[buffer(1)]],
+                        constant uint& count [[buffer(2)]],
+                        uint id [[thread_position_in_grid]],
+                        uint grid [[threads_per_grid]]) {
+    for (uint i = id; i < count; i += grid) {
+        a[i] = b[i];
+    }
+}
+
+kernel void triad_kernel(device float4* a [[buffer(0)]],
+                         device const float4* b [[buffer(1)]],
+                         device const float4* c [[buffer(2)]],
+                         constant uint& count [[buffer(3)]],
+                         constant float& scalar [[buffer(4)]],
+                         uint id [[thread_position_in_grid]],
+                         uint grid [[threads_per_grid]]) {
+    for (uint i = id; i < count; i += grid) {
+        a[i] = b[i] + scalar * c[i];
+    }
+}
+)";
+
+class MetalDevice : public GpuBandwidth::Device {
+  public:
+    MetalDevice(id<MTLDevice> device, id<MTLCommandQueue> queue, id<MTLComputePipelineState> read,
+                id<MTLComputePipelineState> copy, id<MTLComputePipelineState> triad)
+        : device_(device), queue_(queue), read_(read), copy_(copy), triad_(triad) {}
+
+    std::string name() const override { return std::string([[device_ name] UTF8String]); }
+
+    size_t page_size() const override { return static_cast<size_t>(getpagesize()); }
+
+    bool run(GpuBandwidth::Kernel kernel, const GpuBandwidth::Arrays& arrays, size_t iterations,
+             GpuBandwidth::Timing& timing, std::string& error) override {
+        @autoreleasepool {
+            const size_t vectors = arrays.count / 4;
+            const size_t bytes = arrays.count * sizeof(float);
+            if (vectors == 0 || vectors > UINT32_MAX) {
+                error = "GPU arrays must hold between 4 and 2^34 floats";
+                return false;
+            }
+
+            id<MTLComputePipelineState> pipeline = kernel == GpuBandwidth::Kernel::READ   ? read_
+                                                   : kernel == GpuBandwidth::Kernel::COPY ? copy_
+                                                                                          : triad_;
+            const NSUInteger grid = std::min<size_t>(vectors, BenchmarkConstants::GPU_GRID_THREADS);
+            const NSUInteger group = std::min<NSUInteger>(BenchmarkConstants::GPU_THREADGROUP_SIZE,
+                                                          [pipeline maxTotalThreadsPerThreadgroup]);
+
+            // Zero-copy: the buffers alias the caller's pages, which outlive the command buffer
+            id<MTLBuffer> a = wrap(arrays.a, bytes);
+            id<MTLBuffer> b = wrap(arrays.b, bytes);
+            id<MTLBuffer> c = wrap(arrays.c, bytes);
+            id<MTLBuffer> partial = [device_ newBufferWithLength:grid * sizeof(float)
+                                                         options:MTLResourceStorageModeShared];
+            if (a == nil || b == nil || c == nil || partial == nil) {
+                error = "Metal could not wrap the arrays as shared buffers";
+                return false;
+            }
+
+            const uint32_t count = static_cast<uint32_t>(vectors);
+            const float scalar = BenchmarkConstants::GPU_TRIAD_SCALAR;
+            id<MTLCommandBuffer> commands = [queue_ commandBuffer];
+            id<MTLComputeCommandEncoder> encoder = [commands computeCommandEncoder];
+            [encoder setComputePipelineState:pipeline];
+            if (kernel == GpuBandwidth::Kernel::READ) {
+                [encoder setBuffer:b offset:0 atIndex:0];
+                [encoder setBuffer:partial offset:0 atIndex:1];
+                [encoder setBytes:&count length:sizeof(count) atIndex:2];
+            } else {
+                [encoder setBuffer:a offset:0 atIndex:0];
+                [encoder setBuffer:b offset:0 atIndex:1];
+                if (kernel == GpuBandwidth::Kernel::COPY) {
+                    [encoder setBytes:&count length:sizeof(count) atIndex:2];
+                } else {
+                    [encoder setBuffer:c offset:0 atIndex:2];
+                    [encoder setBytes:&count length:sizeof(count) atIndex:3];
+                    [encoder setBytes:&scalar length:sizeof(scalar) atIndex:4];
+                }
+            }
+            for (size_t i = 0; i < iterations; ++i) {
+                [encoder dispatchThreads:MTLSizeMake(grid, 1, 1) threadsPerThreadgroup:MTLSizeMake(group, 1, 1)];
+            }
+            [encoder endEncoding];
+            [commands commit];
+            [commands waitUntilCompleted];
+
+            if ([commands status] != MTLCommandBufferStatusCompleted) {
+                NSError* failure = [commands error];
+                error = failure != nil ? std::string([[failure localizedDescription] UTF8String])
+                                       : std::string("Metal command buffer did not complete");
+                return false;
+            }
+
+            timing.seconds = [commands GPUEndTime] - [commands GPUStartTime];
+            timing.read_sum = 0.0;
+            if (kernel == GpuBandwidth::Kernel::READ) {
+                const float* sums = static_cast<const float*>([partial contents]);
+                for (NSUInteger i = 0; i < grid; ++i) {
+                    timing.read_sum += sums[i];
+                }
+            }
+            return true;
+        }
+    }
+
+  private:
+    id<MTLBuffer> wrap(const float* data, size_t bytes) const {
+        return [device_ newBufferWithBytesNoCopy:const_cast<float*>(data)
+                                          length:bytes
+                                         options:MTLResourceStorageModeShared
+                                     deallocator:nil];
+    }
+
+    id<MTLDevice> device_;
+    id<MTLCommandQueue> queue_;
+    id<MTLComputePipelineState> read_;
+    id<MTLComputePipelineState> copy_;
+    id<MTLComputePipelineState> triad_;
+};
+
+id<MTLComputePipelineState> pipeline(id<MTLDevice> device, id<MTLLibrary> library, NSString* function) {
+    id<MTLFunction> entry = [library newFunctionWithName:function];
+    if (entry == nil) {
+        return nil;
+    }
+    NSError* error = nil;
+    return [device newComputePipelineStateWithFunction:entry error:&error];
+}
+
+}  // namespace
+
+std::unique_ptr<GpuBandwidth::Device> create_metal_device() {
+    @autoreleasepool {
+        id<MTLDevice> device = MTLCreateSystemDefaultDevice();
+        if (device == nil || ![device hasUnifiedMemory]) {
+            return nullptr;
+        }
+
+        NSError* error = nil;
+        id<MTLLibrary> library = [device newLibraryWithSource:[NSString stringWithUTF8String:KERNEL_SOURCE]
+                                                      options:nil
+                                                        error:&error];
+        if (library == nil) {
+            return nullptr;
+        }
+
+        id<MTLComputePipelineState> read = pipeline(device, library, @"read_kernel");
+        id<MTLComputePipelineState> copy = pipeline(device, library, @"copy_kernel");
+        id<MTLComputePipelineState> triad = pipeline(device, library, @"triad_kernel");
+        id<MTLCommandQueue> queue = [device newCommandQueue];
+        if (read == nil || copy == nil || triad == nil || queue == nil) {
+            return nullptr;
+        }
+        return std::make_unique<MetalDevice>(device, queue, read, copy, triad);
+    }
+}
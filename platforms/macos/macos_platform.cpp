@@ -1,5 +1,9 @@
 #include "macos_platform.h"
 #include "macos_matrix_multiplier.h"
+#include "macos_metal_device.h"
+#include "../../common/numa_utils.h"
+#include "../../common/cpu_topology.h"
+#include "../../common/memory_detection.h"
 #include <mach/mach.h>
 #include <mach/mach_host.h>
 #include <mach/mach_init.h>
@@ -11,11 +15,242 @@
 #include <sys/sysctl.h>
 #include <sys/types.h>
 #include <unistd.h>
+#include <dlfcn.h>
+#include <CoreFoundation/CoreFoundation.h>
+#include <algorithm>
+#include <iterator>
 #include <thread>
 
 // Use centralized cache line size constants
 using CacheConstants::APPLE_CACHE_LINE_SIZE;
 
+namespace {
+
+/**
+ * @brief Fixed cycle and instruction counters of the calling thread from kperf
+ *
+ * kperf is a private framework, so it is loaded at run time; configuring
+ * the counters needs root, and open() fails otherwise.
+ */
+class KperfThreadCounters : public PerfCounters::CounterGroup {
+public:
+    ~KperfThreadCounters() override {
+        if (handle_ != nullptr) {
+            dlclose(handle_);
+        }
+    }
+
+    bool open() override {
+        handle_ = dlopen("/System/Library/PrivateFrameworks/kperf.framework/kperf", RTLD_LAZY);
+        if (handle_ == nullptr) {
+            return false;
+        }
+        auto set_counting = reinterpret_cast<int (*)(uint32_t)>(dlsym(handle_, "kpc_set_counting"));
+        auto set_thread_counting = reinterpret_cast<int (*)(uint32_t)>(dlsym(handle_, "kpc_set_thread_counting"));
+        get_counter_count_ = reinterpret_cast<uint32_t (*)(uint32_t)>(dlsym(handle_, "kpc_get_counter_count"));
+        get_thread_counters_ =
+            reinterpret_cast<int (*)(uint32_t, uint32_t, uint64_t*)>(dlsym(handle_, "kpc_get_thread_counters"));
+        if (!set_counting || !set_thread_counting || !get_counter_count_ || !get_thread_counters_) {
+            return false;
+        }
+        if (set_counting(KPC_CLASS_FIXED_MASK) != 0 || set_thread_counting(KPC_CLASS_FIXED_MASK) != 0) {
+            return false;
+        }
+        counter_count_ = std::min<uint32_t>(get_counter_count_(KPC_CLASS_FIXED_MASK), MAX_COUNTERS);
+        return counter_count_ >= 2;
+    }
+
+    void start() override { snapshot(start_); }
+
+    void stop() override {
+        uint64_t end[MAX_COUNTERS] = {};
+        snapshot(end);
+        for (uint32_t i = 0; i < counter_count_; ++i) {
+            total_[i] += end[i] - start_[i];
+        }
+    }
+
+    void reset() override { std::fill(std::begin(total_), std::end(total_), 0); }
+
+    PerfCounters::CounterValues read() override {
+        PerfCounters::CounterValues values;
+        if (counter_count_ >= 2) {
+#if defined(__arm64__)
+            values.set(PerfCounters::Counter::CYCLES, total_[0]);
+            values.set(PerfCounters::Counter::INSTRUCTIONS, total_[1]);
+#else
+            // Intel fixed counters: instructions retired, then core cycles
+            values.set(PerfCounters::Counter::INSTRUCTIONS, total_[0]);
+            values.set(PerfCounters::Counter::CYCLES, total_[1]);
+#endif
+        }
+        return values;
+    }
+
+private:
+    static constexpr uint32_t KPC_CLASS_FIXED_MASK = 1u;
+    static constexpr uint32_t MAX_COUNTERS = 8;
+
+    void snapshot(uint64_t* counters) {
+        if (get_thread_counters_ != nullptr) {
+            get_thread_counters_(0, counter_count_, counters);  // tid 0: the calling thread
+        }
+    }
+
+    void* handle_ = nullptr;
+    uint32_t (*get_counter_count_)(uint32_t) = nullptr;
+    int (*get_thread_counters_)(uint32_t, uint32_t, uint64_t*) = nullptr;
+    uint32_t counter_count_ = 0;
+    uint64_t start_[MAX_COUNTERS] = {};
+    uint64_t total_[MAX_COUNTERS] = {};
+};
+
+/**
+ * @brief CPU and DRAM energy channels of the IOReport "Energy Model" group
+ *
+ * libIOReport is private, so it is loaded at run time. powermetrics reads
+ * the same channels but needs root; subscribing to them does not. Channel
+ * values are cumulative, with their unit in the channel's unit label.
+ */
+class IOReportEnergy : public EnergyMeter::Meter {
+public:
+    ~IOReportEnergy() override {
+        if (samples_channels_ != nullptr) CFRelease(samples_channels_);
+        if (subscription_ != nullptr) CFRelease(subscription_);
+        if (channels_ != nullptr) CFRelease(channels_);
+        if (handle_ != nullptr) {
+            dlclose(handle_);
+        }
+    }
+
+    bool open() {
+        handle_ = dlopen("/usr/lib/libIOReport.dylib", RTLD_LAZY);
+        if (handle_ == nullptr) {
+            return false;
+        }
+        auto copy_channels_in_group = reinterpret_cast<CFDictionaryRef (*)(CFStringRef, CFStringRef, uint64_t,
+                                                                           uint64_t, uint64_t)>(
+            dlsym(handle_, "IOReportCopyChannelsInGroup"));
+        auto create_subscription = reinterpret_cast<CFTypeRef (*)(void*, CFMutableDictionaryRef,
+                                                                  CFMutableDictionaryRef*, uint64_t, CFTypeRef)>(
+            dlsym(handle_, "IOReportCreateSubscription"));
+        create_samples_ = reinterpret_cast<CFDictionaryRef (*)(CFTypeRef, CFMutableDictionaryRef, CFTypeRef)>(
+            dlsym(handle_, "IOReportCreateSamples"));
+        channel_name_ =
+            reinterpret_cast<CFStringRef (*)(CFDictionaryRef)>(dlsym(handle_, "IOReportChannelGetChannelName"));
+        unit_label_ = reinterpret_cast<CFStringRef (*)(CFDictionaryRef)>(dlsym(handle_, "IOReportChannelGetUnitLabel"));
+        integer_value_ =
+            reinterpret_cast<int64_t (*)(CFDictionaryRef, int32_t)>(dlsym(handle_, "IOReportSimpleGetIntegerValue"));
+        if (!copy_channels_in_group || !create_subscription || !create_samples_ || !channel_name_ || !unit_label_ ||
+            !integer_value_) {
+            return false;
+        }
+
+        CFDictionaryRef group = copy_channels_in_group(CFSTR("Energy Model"), nullptr, 0, 0, 0);
+        if (group == nullptr) {
+            return false;
+        }
+        channels_ = CFDictionaryCreateMutableCopy(kCFAllocatorDefault, CFDictionaryGetCount(group), group);
+        CFRelease(group);
+        subscription_ = create_subscription(nullptr, channels_, &samples_channels_, 0, nullptr);
+        if (subscription_ == nullptr || samples_channels_ == nullptr) {
+            return false;
+        }
+
+        CFDictionaryRef sample = create_samples_(subscription_, samples_channels_, nullptr);
+        if (sample == nullptr) {
+            return false;
+        }
+        for_each_channel(sample, [this](CFDictionaryRef channel) {
+            std::string name = to_string(channel_name_(channel));
+            double joules_per_unit = unit_joules(to_string(unit_label_(channel)));
+            if (joules_per_unit <= 0.0) {
+                return;
+            }
+            // Per-cluster and per-core channels are parts of "CPU Energy"
+            if (name == "CPU Energy") {
+                counters_.push_back({EnergyMeter::Domain::PACKAGE, name, joules_per_unit, 0});
+            } else if (name.compare(0, 4, "DRAM") == 0) {
+                counters_.push_back({EnergyMeter::Domain::DRAM, name, joules_per_unit, 0});
+            }
+        });
+        CFRelease(sample);
+        return !counters_.empty();
+    }
+
+    const std::vector<EnergyMeter::Counter>& counters() const override { return counters_; }
+
+    EnergyMeter::Snapshot snapshot() override {
+        EnergyMeter::Snapshot snapshot;
+        snapshot.values.assign(counters_.size(), 0);
+        CFDictionaryRef sample = create_samples_(subscription_, samples_channels_, nullptr);
+        if (sample == nullptr) {
+            return snapshot;
+        }
+        std::vector<bool> seen(counters_.size(), false);
+        for_each_channel(sample, [&](CFDictionaryRef channel) {
+            std::string name = to_string(channel_name_(channel));
+            for (size_t i = 0; i < counters_.size(); ++i) {
+                if (!seen[i] && counters_[i].name == name) {
+                    snapshot.values[i] = static_cast<uint64_t>(std::max<int64_t>(0, integer_value_(channel, 0)));
+                    seen[i] = true;
+                    break;
+                }
+            }
+        });
+        CFRelease(sample);
+        snapshot.valid = std::find(seen.begin(), seen.end(), false) == seen.end();
+        return snapshot;
+    }
+
+    std::string describe() const override {
+        std::string text = "IOReport Energy Model:";
+        for (size_t i = 0; i < counters_.size(); ++i) {
+            text += (i == 0 ? " " : ", ") + counters_[i].name;
+        }
+        return text;
+    }
+
+private:
+    template <typename Visit>
+    static void for_each_channel(CFDictionaryRef sample, Visit visit) {
+        auto channels = static_cast<CFArrayRef>(CFDictionaryGetValue(sample, CFSTR("IOReportChannels")));
+        if (channels == nullptr) {
+            return;
+        }
+        for (CFIndex i = 0; i < CFArrayGetCount(channels); ++i) {
+            visit(static_cast<CFDictionaryRef>(CFArrayGetValueAtIndex(channels, i)));
+        }
+    }
+
+    static std::string to_string(CFStringRef string) {
+        char buffer[128] = {};
+        if (string == nullptr || !CFStringGetCString(string, buffer, sizeof(buffer), kCFStringEncodingUTF8)) {
+            return "";
+        }
+        return buffer;
+    }
+
+    static double unit_joules(const std::string& label) {
+        if (label == "mJ") return 1e-3;
+        if (label == "uJ") return 1e-6;
+        if (label == "nJ") return 1e-9;
+        return 0.0;
+    }
+
+    void* handle_ = nullptr;
+    CFDictionaryRef (*create_samples_)(CFTypeRef, CFMutableDictionaryRef, CFTypeRef) = nullptr;
+    CFStringRef (*channel_name_)(CFDictionaryRef) = nullptr;
+    CFStringRef (*unit_label_)(CFDictionaryRef) = nullptr;
+    int64_t (*integer_value_)(CFDictionaryRef, int32_t) = nullptr;
+    CFMutableDictionaryRef channels_ = nullptr;
+    CFMutableDictionaryRef samples_channels_ = nullptr;
+    CFTypeRef subscription_ = nullptr;
+    std::vector<EnergyMeter::Counter> counters_;
+};
+
+}  // namespace
+
 std::pair<std::string, std::string> MacOSPlatform::detect_processor_info() {
     std::string arch = "";
     std::string model = "";
@@ -115,9 +350,45 @@ CacheInfo MacOSPlatform::detect_cache_info() {
         }
     }
 
+    detect_cache_sharing(info);
     return info;
 }
 
+void MacOSPlatform::detect_cache_sharing(CacheInfo& info) {
+    // Each cluster shares one L2; CPUs are numbered P-cores first, as set_thread_affinity does
+    size_t p_core_count, e_core_count;
+    get_macos_core_counts(p_core_count, e_core_count);
+    info.l2_sharing.clear();
+    size_t first_cpu = 0;
+    for (int level = 0; level < 2; ++level) {
+        size_t core_count = level == 0 ? p_core_count : e_core_count;
+        uint32_t cpus_per_l2 = 0;
+        size_t size = sizeof(cpus_per_l2);
+        std::string name = "hw.perflevel" + std::to_string(level) + ".cpusperl2";
+        if (sysctlbyname(name.c_str(), &cpus_per_l2, &size, nullptr, 0) != 0 || cpus_per_l2 == 0) {
+            cpus_per_l2 = static_cast<uint32_t>(std::max<size_t>(core_count, 1));
+        }
+        for (size_t cluster_start = 0; cluster_start < core_count; cluster_start += cpus_per_l2) {
+            std::vector<size_t> cluster;
+            for (size_t cpu = cluster_start; cpu < std::min<size_t>(cluster_start + cpus_per_l2, core_count); ++cpu) {
+                cluster.push_back(first_cpu + cpu);
+            }
+            info.l2_sharing.push_back(cluster);
+        }
+        first_cpu += core_count;
+    }
+
+    // The System Level Cache is shared by every core; L1 caches are private
+    info.l1d_sharing.clear();
+    info.l3_sharing.clear();
+    std::vector<size_t> all_cpus;
+    for (size_t cpu = 0; cpu < first_cpu; ++cpu) {
+        info.l1d_sharing.push_back({cpu});
+        all_cpus.push_back(cpu);
+    }
+    info.l3_sharing.push_back(all_cpus);
+}
+
 void MacOSPlatform::get_macos_core_counts(size_t& p_core_count, size_t& e_core_count) {
     uint32_t p_cores = 0, e_cores = 0;
     size_t size;
@@ -146,6 +417,7 @@ CacheInfo MacOSPlatform::get_core_specific_cache_info(CPUAffinityType affinity_t
     
     // Start with a fresh CacheInfo structure for core-specific detection
     CacheInfo info = {};
+    detect_cache_sharing(info);
     size_t cache_line_size = detect_cache_line_size();
     
     // Set cache line sizes
@@ -255,6 +527,37 @@ bool MacOSPlatform::validate_thread_count(size_t num_threads, CPUAffinityType af
     return true;
 }
 
+NumaTopology MacOSPlatform::detect_numa_topology() {
+    return NumaUtils::detect_topology();
+}
+
+CpuTopology MacOSPlatform::detect_cpu_topology() {
+    // No sysfs: every CPU reports as its own core (Apple Silicon has no SMT)
+    return CpuTopologyUtils::detect_topology(NumaUtils::get_topology());
+}
+
+bool MacOSPlatform::bind_thread_to_numa_node(size_t thread_id, size_t node_id) {
+    (void)thread_id;
+    (void)node_id;
+    return false;  // macOS exposes no NUMA binding API
+}
+
+bool MacOSPlatform::bind_memory_to_numa_node(void* addr, size_t length, size_t node_id) {
+    (void)addr;
+    (void)length;
+    (void)node_id;
+    return false;
+}
+
+bool MacOSPlatform::interleave_memory_across_numa_nodes(void* addr, size_t length,
+                                                        const std::vector<NumaWeight>& weights, std::string& policy) {
+    (void)addr;
+    (void)length;
+    (void)weights;
+    (void)policy;
+    return false;
+}
+
 void MacOSPlatform::set_thread_affinity(size_t thread_id, CPUAffinityType affinity_type, size_t total_threads) {
     (void)total_threads;  // Suppress unused parameter warning
     
@@ -290,19 +593,37 @@ MemorySpecs MacOSPlatform::get_memory_specs() {
         specs.total_size_gb = total_memory / (1024 * 1024 * 1024);
     }
     
-    // Apple Silicon unified memory defaults
-    specs.type = "LPDDR5";
-    specs.speed_mtps = 6400;  // M3 Max typical speed
-    specs.data_width_bits = 512;  // M3 Max has wide memory interface
-    specs.total_width_bits = 512;
-    specs.num_channels = 32;  // M3 Max has many memory channels
+    // Apple Silicon unified memory: the chip determines type, speed and bus width
+    size_t p_core_count, e_core_count;
+    get_macos_core_counts(p_core_count, e_core_count);
+    MemoryDetection::AppleChipMemory chip;
+    bool known_chip = MemoryDetection::apple_chip_memory(detect_processor_info().second, p_core_count, chip);
+    if (known_chip) {
+        specs.type = chip.type;
+        specs.speed_mtps = chip.speed_mtps;
+        specs.data_width_bits = chip.bus_width_bits;
+        specs.detection_source = chip.chip + " specifications";
+    } else {
+        // Unknown chip: M3 Max figures, flagged as not detected
+        specs.type = "LPDDR5";
+        specs.speed_mtps = 6400;
+        specs.data_width_bits = 512;
+    }
+    specs.total_width_bits = specs.data_width_bits;
+    specs.num_channels = specs.data_width_bits / 16;  // LPDDR4X/LPDDR5 channels are 16 bits wide
     specs.theoretical_bandwidth_gbps = (specs.speed_mtps * specs.data_width_bits) / 8.0 / 1000.0;
     specs.is_virtualized = false;
-    specs.data_width_detected = true;  // Apple Silicon specs are well-known
-    specs.total_width_detected = true; // Apple Silicon specs are well-known
-    specs.num_channels_detected = true; // Apple Silicon specs are well-known
+    specs.speed_detected = known_chip;
+    specs.data_width_detected = known_chip;
+    specs.total_width_detected = known_chip;
+    specs.num_channels_detected = known_chip;
     specs.is_unified_memory = true;
     specs.architecture = "Unified Memory Architecture (UMA) - Apple Silicon";
+    char model[64];
+    size_t model_size = sizeof(model);
+    if (sysctlbyname("hw.model", model, &model_size, nullptr, 0) == 0) {
+        specs.architecture += " (" + std::string(model) + ")";
+    }
     
     return specs;
 }
@@ -330,7 +651,13 @@ SystemInfo MacOSPlatform::get_system_info() {
     }
     
     // Get CPU information
-    sys_info.cpu_cores = std::thread::hardware_concurrency();
+    int physical_cpus = 0;
+    size = sizeof(physical_cpus);
+    if (sysctlbyname("hw.physicalcpu", &physical_cpus, &size, nullptr, 0) == 0 && physical_cpus > 0) {
+        sys_info.cpu_cores = static_cast<size_t>(physical_cpus);
+    } else {
+        sys_info.cpu_cores = std::thread::hardware_concurrency();
+    }
     sys_info.cpu_threads = std::thread::hardware_concurrency();
     sys_info.cache_line_size = detect_cache_line_size();
     
@@ -346,4 +673,32 @@ SystemInfo MacOSPlatform::get_system_info() {
 
 std::unique_ptr<MatrixMultiply::MatrixMultiplier> MacOSPlatform::create_matrix_multiplier() {
     return std::make_unique<MatrixMultiply::MacOSMatrixMultiplier>();
-}
\ No newline at end of file
+}
+
+std::unique_ptr<PerfCounters::CounterGroup> MacOSPlatform::create_thread_counters() {
+    return std::make_unique<KperfThreadCounters>();
+}
+
+std::unique_ptr<PerfCounters::CounterGroup> MacOSPlatform::create_uncore_counters() {
+    // The memory controllers of Apple Silicon are not exposed to user space
+    return nullptr;
+}
+
+std::unique_ptr<PrefetchControl::HardwarePrefetchers> MacOSPlatform::create_prefetcher_control() {
+    // Prefetcher configuration is not exposed to user space
+    return nullptr;
+}
+
+std::unique_ptr<EnergyMeter::Meter> MacOSPlatform::create_energy_meter() {
+    // Apple Silicon only: Intel Macs have no Energy Model group
+    auto meter = std::make_unique<IOReportEnergy>();
+    if (!meter->open()) {
+        return nullptr;
+    }
+    return meter;
+}
+
+std::unique_ptr<GpuBandwidth::Device> MacOSPlatform::create_gpu_device() {
+    // nullptr on Intel Macs: a discrete GPU would copy the buffers into its own memory
+    return create_metal_device();
+}
@@ -84,6 +84,314 @@ working_sets_result=$?
 total_failures=$((total_failures + working_sets_result))
 echo ""
 
+# Run SimdKernels tests
+echo "Running SimdKernels tests:"
+./tests/test_simd_kernels
+simd_kernels_result=$?
+total_failures=$((total_failures + simd_kernels_result))
+echo ""
+
+# Run NumaUtils tests
+echo "Running NumaUtils tests:"
+./tests/test_numa_utils
+numa_utils_result=$?
+total_failures=$((total_failures + numa_utils_result))
+echo ""
+
+# Run PointerChase tests
+echo "Running PointerChase tests:"
+./tests/test_pointer_chase
+pointer_chase_result=$?
+total_failures=$((total_failures + pointer_chase_result))
+echo ""
+
+# Run PageAllocator tests
+echo "Running PageAllocator tests:"
+./tests/test_page_allocator
+page_allocator_result=$?
+total_failures=$((total_failures + page_allocator_result))
+echo ""
+
+# Run WorkerPool tests
+echo "Running WorkerPool tests:"
+./tests/test_worker_pool
+worker_pool_result=$?
+total_failures=$((total_failures + worker_pool_result))
+echo ""
+
+# Run SampleStats tests
+echo "Running SampleStats tests:"
+./tests/test_sample_stats
+sample_stats_result=$?
+total_failures=$((total_failures + sample_stats_result))
+echo ""
+
+# Run Calibration tests
+echo "Running Calibration tests:"
+./tests/test_calibration
+calibration_result=$?
+total_failures=$((total_failures + calibration_result))
+echo ""
+
+# Run CacheBoundaries tests
+echo "Running CacheBoundaries tests:"
+./tests/test_cache_boundaries
+cache_boundaries_result=$?
+total_failures=$((total_failures + cache_boundaries_result))
+echo ""
+
+# Run PerfCounters tests
+echo "Running PerfCounters tests:"
+./tests/test_perf_counters
+perf_counters_result=$?
+total_failures=$((total_failures + perf_counters_result))
+echo ""
+
+# Run IoTests tests
+echo "Running IoTests tests:"
+./tests/test_io_tests
+io_tests_result=$?
+total_failures=$((total_failures + io_tests_result))
+echo ""
+
+# Run AccessPatterns tests
+echo "Running AccessPatterns tests:"
+./tests/test_access_patterns
+access_patterns_result=$?
+total_failures=$((total_failures + access_patterns_result))
+echo ""
+
+# Run EncodedScans tests
+echo "Running EncodedScans tests:"
+./tests/test_encoded_scans
+encoded_scans_result=$?
+total_failures=$((total_failures + encoded_scans_result))
+echo ""
+
+# Run PrefetchControl tests
+echo "Running PrefetchControl tests:"
+./tests/test_prefetch_control
+prefetch_control_result=$?
+total_failures=$((total_failures + prefetch_control_result))
+echo ""
+
+# Run CoherenceTests tests
+echo "Running CoherenceTests tests:"
+./tests/test_coherence_tests
+coherence_tests_result=$?
+total_failures=$((total_failures + coherence_tests_result))
+echo ""
+
+# Run AtomicTests tests
+echo "Running AtomicTests tests:"
+./tests/test_atomic_tests
+atomic_tests_result=$?
+total_failures=$((total_failures + atomic_tests_result))
+echo ""
+
+# Run ThreadScaling tests
+echo "Running ThreadScaling tests:"
+./tests/test_thread_scaling
+thread_scaling_result=$?
+total_failures=$((total_failures + thread_scaling_result))
+echo ""
+
+# Run CpuTopology tests
+echo "Running CpuTopology tests:"
+./tests/test_cpu_topology
+cpu_topology_result=$?
+total_failures=$((total_failures + cpu_topology_result))
+echo ""
+
+# Run MemoryDetection tests
+echo "Running MemoryDetection tests:"
+./tests/test_memory_detection
+memory_detection_result=$?
+total_failures=$((total_failures + memory_detection_result))
+echo ""
+
+# Run Contention tests
+echo "Running Contention tests:"
+./tests/test_contention
+contention_result=$?
+total_failures=$((total_failures + contention_result))
+echo ""
+
+# Run Soak tests
+echo "Running Soak tests:"
+./tests/test_soak
+soak_result=$?
+total_failures=$((total_failures + soak_result))
+echo ""
+
+# Run Json tests
+echo "Running Json tests:"
+./tests/test_json
+json_result=$?
+total_failures=$((total_failures + json_result))
+echo ""
+
+# Run NdjsonSink tests
+echo "Running NdjsonSink tests:"
+./tests/test_ndjson_sink
+ndjson_sink_result=$?
+total_failures=$((total_failures + ndjson_sink_result))
+echo ""
+
+# Run Baseline tests
+echo "Running Baseline tests:"
+./tests/test_baseline
+baseline_result=$?
+total_failures=$((total_failures + baseline_result))
+echo ""
+
+# Run PeakCalibration tests
+echo "Running PeakCalibration tests:"
+./tests/test_peak_calibration
+peak_calibration_result=$?
+total_failures=$((total_failures + peak_calibration_result))
+echo ""
+
+# Run PatternRegistry tests
+echo "Running PatternRegistry tests:"
+./tests/test_pattern_registry
+pattern_registry_result=$?
+total_failures=$((total_failures + pattern_registry_result))
+echo ""
+
+# Run Membench tests
+echo "Running Membench tests:"
+./tests/test_membench
+membench_result=$?
+total_failures=$((total_failures + membench_result))
+echo ""
+
+# Run TraceReplay tests
+echo "Running TraceReplay tests:"
+./tests/test_trace_replay
+trace_replay_result=$?
+total_failures=$((total_failures + trace_replay_result))
+echo ""
+
+# Run AllocatorBench tests
+echo "Running AllocatorBench tests:"
+./tests/test_allocator_bench
+allocator_bench_result=$?
+total_failures=$((total_failures + allocator_bench_result))
+echo ""
+
+# Run MappingTests tests
+echo "Running MappingTests tests:"
+./tests/test_mapping_tests
+mapping_tests_result=$?
+total_failures=$((total_failures + mapping_tests_result))
+echo ""
+
+# Run TlbSweep tests
+echo "Running TlbSweep tests:"
+./tests/test_tlb_sweep
+tlb_sweep_result=$?
+total_failures=$((total_failures + tlb_sweep_result))
+echo ""
+
+# Run RingTransfer tests
+echo "Running RingTransfer tests:"
+./tests/test_ring_transfer
+ring_transfer_result=$?
+total_failures=$((total_failures + ring_transfer_result))
+echo ""
+
+# Run EnergyMeter tests
+echo "Running EnergyMeter tests:"
+./tests/test_energy_meter
+energy_meter_result=$?
+total_failures=$((total_failures + energy_meter_result))
+echo ""
+
+# Run ColdCache tests
+echo "Running ColdCache tests:"
+./tests/test_cold_cache
+cold_cache_result=$?
+total_failures=$((total_failures + cold_cache_result))
+echo ""
+
+# Run CycleTimer tests
+echo "Running CycleTimer tests:"
+./tests/test_cycle_timer
+cycle_timer_result=$?
+total_failures=$((total_failures + cycle_timer_result))
+echo ""
+
+# Run CopySweep tests
+echo "Running CopySweep tests:"
+./tests/test_copy_sweep
+copy_sweep_result=$?
+total_failures=$((total_failures + copy_sweep_result))
+echo ""
+
+# Run MemoryTiers tests
+echo "Running MemoryTiers tests:"
+./tests/test_memory_tiers
+memory_tiers_result=$?
+total_failures=$((total_failures + memory_tiers_result))
+echo ""
+
+# Run Fleet tests
+echo "Running Fleet tests:"
+./tests/test_fleet
+fleet_result=$?
+total_failures=$((total_failures + fleet_result))
+echo ""
+
+# Run GpuBandwidth tests
+echo "Running GpuBandwidth tests:"
+./tests/test_gpu_bandwidth
+gpu_bandwidth_result=$?
+total_failures=$((total_failures + gpu_bandwidth_result))
+echo ""
+
+# Run ProxyKernels tests
+echo "Running ProxyKernels tests:"
+./tests/test_proxy_kernels
+proxy_kernels_result=$?
+total_failures=$((total_failures + proxy_kernels_result))
+echo ""
+
+# Run IrregularKernels tests
+echo "Running IrregularKernels tests:"
+./tests/test_irregular_kernels
+irregular_kernels_result=$?
+total_failures=$((total_failures + irregular_kernels_result))
+echo ""
+
+# Run SystemProbe tests
+echo "Running SystemProbe tests:"
+./tests/test_system_probe
+system_probe_result=$?
+total_failures=$((total_failures + system_probe_result))
+echo ""
+
+# Run KernelMatrix tests
+echo "Running KernelMatrix tests:"
+./tests/test_kernel_matrix
+kernel_matrix_result=$?
+total_failures=$((total_failures + kernel_matrix_result))
+echo ""
+
+# Run ResultValidation tests
+echo "Running ResultValidation tests:"
+./tests/test_result_validation
+result_validation_result=$?
+total_failures=$((total_failures + result_validation_result))
+echo ""
+
+# Run MatrixMultipliers tests
+echo "Running MatrixMultipliers tests:"
+./tests/test_matrix_multipliers
+matrix_multipliers_result=$?
+total_failures=$((total_failures + matrix_multipliers_result))
+echo ""
+
 if [ $total_failures -eq 0 ]; then
     echo "All tests passed! ✅"
 else
@@ -0,0 +1,142 @@
+#include "test_framework.h"
+#include "../common/access_patterns.h"
+#include "../common/errors.h"
+#include <algorithm>
+#include <string>
+#include <vector>
+
+using AccessPatterns::AccessConfig;
+using AccessPatterns::Distribution;
+
+void test_parse_element_and_stride() {
+    TestAssert::assert_equal_size_t(4, AccessPatterns::parse_element_size("4"));
+    TestAssert::assert_equal_size_t(64, AccessPatterns::parse_element_size("64"));
+    for (const char* bad : {"16", "0", "8b", "", "-8"}) {
+        try {
+            AccessPatterns::parse_element_size(bad);
+            ASSERT_TRUE(false);  // Should throw
+        } catch (const ArgumentError& e) {
+            std::string error_msg = e.what();
+            ASSERT_TRUE(error_msg.find("Invalid element size") != std::string::npos);
+        }
+    }
+
+    TestAssert::assert_equal_size_t(4, AccessPatterns::parse_stride("4", 4));
+    TestAssert::assert_equal_size_t(4096, AccessPatterns::parse_stride("4096", 8));
+    for (const char* bad : {"12", "4", "8192", "abc"}) {
+        try {
+            AccessPatterns::parse_stride(bad, 8);
+            ASSERT_TRUE(false);  // Should throw
+        } catch (const ArgumentError& e) {
+            std::string error_msg = e.what();
+            ASSERT_TRUE(error_msg.find("Invalid stride") != std::string::npos);
+        }
+    }
+}
+
+void test_parse_distribution() {
+    AccessConfig config;
+    AccessPatterns::parse_distribution("page", config);
+    ASSERT_TRUE(config.distribution == Distribution::PAGE_LOCAL);
+    TestAssert::assert_equal(std::string("page"), AccessPatterns::distribution_to_string(config));
+
+    AccessPatterns::parse_distribution("zipf:1.2", config);
+    ASSERT_TRUE(config.distribution == Distribution::ZIPF);
+    TestAssert::assert_equal(std::string("zipf:1.2"), AccessPatterns::distribution_to_string(config));
+
+    AccessPatterns::parse_distribution("uniform", config);
+    TestAssert::assert_equal(std::string("uniform"), AccessPatterns::distribution_to_string(config));
+
+    for (const char* bad : {"zipf:0", "zipf:x", "zipf:5", "skewed"}) {
+        try {
+            AccessPatterns::parse_distribution(bad, config);
+            ASSERT_TRUE(false);  // Should throw
+        } catch (const ArgumentError&) {
+        }
+    }
+}
+
+void test_indices_in_range() {
+    const size_t elements = 10000;
+    for (const char* dist : {"uniform", "zipf", "page"}) {
+        AccessConfig config;
+        AccessPatterns::parse_distribution(dist, config);
+        std::vector<uint32_t> indices = AccessPatterns::build_indices(elements, 5000, config, 42);
+        TestAssert::assert_equal_size_t(5000, indices.size());
+        ASSERT_TRUE(*std::max_element(indices.begin(), indices.end()) < elements);
+        // Same seed, same list
+        ASSERT_TRUE(indices == AccessPatterns::build_indices(elements, 5000, config, 42));
+    }
+    ASSERT_TRUE(AccessPatterns::build_indices(0, 10, AccessConfig{}, 1).empty());
+}
+
+void test_zipf_is_skewed() {
+    AccessConfig uniform;
+    AccessConfig zipf;
+    AccessPatterns::parse_distribution("zipf:0.99", zipf);
+
+    // Hot keys repeat, so a skewed list touches far fewer lines than a uniform one
+    const size_t elements = 1 << 20;
+    size_t uniform_lines = AccessPatterns::count_traffic(
+        AccessPatterns::build_indices(elements, 100000, uniform, 7), 8).line_bytes;
+    size_t zipf_lines = AccessPatterns::count_traffic(
+        AccessPatterns::build_indices(elements, 100000, zipf, 7), 8).line_bytes;
+    ASSERT_TRUE(zipf_lines * 2 < uniform_lines);
+}
+
+void test_page_local_stays_in_page() {
+    AccessConfig config;
+    config.element_bytes = 8;
+    AccessPatterns::parse_distribution("page", config);
+    const size_t per_page = AccessPatterns::PAGE_BYTES / config.element_bytes;
+    const size_t accesses_per_page = AccessPatterns::PAGE_BYTES / AccessPatterns::LINE_BYTES;
+
+    std::vector<uint32_t> indices = AccessPatterns::build_indices(per_page * 32, accesses_per_page * 32, config, 3);
+    std::vector<size_t> pages;
+    for (size_t block = 0; block < 32; ++block) {
+        size_t page = indices[block * accesses_per_page] / per_page;
+        for (size_t i = 0; i < accesses_per_page; ++i) {
+            ASSERT_TRUE(indices[block * accesses_per_page + i] / per_page == page);
+        }
+        pages.push_back(page);
+    }
+    // Every page is visited once per round
+    std::sort(pages.begin(), pages.end());
+    ASSERT_TRUE(std::unique(pages.begin(), pages.end()) == pages.end());
+}
+
+void test_line_counts() {
+    std::vector<uint32_t> indices = {0, 1, 7, 8, 8, 100};
+    // 8-byte elements: 0,1,7 share line 0; 8 is line 1; 100 is line 12; the repeated 8 counts once
+    AccessPatterns::LineTraffic traffic = AccessPatterns::count_traffic(indices, 8);
+    TestAssert::assert_equal_size_t(3 * 64, traffic.line_bytes);
+    TestAssert::assert_equal_size_t(5 * 8, traffic.used_bytes);
+    traffic = AccessPatterns::count_traffic(indices, 64);
+    TestAssert::assert_equal_size_t(5 * 64, traffic.line_bytes);
+    TestAssert::assert_equal_size_t(traffic.line_bytes, traffic.used_bytes);
+    TestAssert::assert_equal_size_t(0, AccessPatterns::count_traffic({}, 8).line_bytes);
+
+    TestAssert::assert_equal_size_t(64, AccessPatterns::strided_accesses(4096, 64, 8));
+    TestAssert::assert_equal_size_t(4096, AccessPatterns::strided_traffic(4096, 64, 8).line_bytes);
+    TestAssert::assert_equal_size_t(8, AccessPatterns::strided_accesses(4096, 512, 4));
+    traffic = AccessPatterns::strided_traffic(4096, 512, 4);
+    TestAssert::assert_equal_size_t(8 * 64, traffic.line_bytes);
+    TestAssert::assert_equal_size_t(8 * 4, traffic.used_bytes);
+    // Strides below a line still pull in every line they cross
+    TestAssert::assert_equal_size_t(128, AccessPatterns::strided_accesses(4096, 32, 8));
+    TestAssert::assert_equal_size_t(4096, AccessPatterns::strided_traffic(4096, 32, 8).line_bytes);
+    TestAssert::assert_equal_size_t(0, AccessPatterns::strided_accesses(4, 8, 8));
+}
+
+int main() {
+    TestFramework framework;
+
+    TEST_CASE("Parse element size and stride", test_parse_element_and_stride);
+    TEST_CASE("Parse index distribution", test_parse_distribution);
+    TEST_CASE("Indices stay in range", test_indices_in_range);
+    TEST_CASE("Zipf indices are skewed", test_zipf_is_skewed);
+    TEST_CASE("Page-local indices stay in a page", test_page_local_stays_in_page);
+    TEST_CASE("Line counts", test_line_counts);
+
+    return framework.run_all();
+}
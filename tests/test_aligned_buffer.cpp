@@ -29,6 +29,19 @@ void test_aligned_buffer_initialization() {
     }
 }
 
+void test_aligned_buffer_range_initialization() {
+    // Deferred initialization in uneven slices must match the full pattern
+    const size_t size = 10000;
+    AlignedBuffer buffer(size, 64, PageMode::DEFAULT, false);
+    buffer.initialize_pattern(0, 3);
+    buffer.initialize_pattern(3, 4099);
+    buffer.initialize_pattern(4099, size + 100);  // Clamped to the buffer size
+    
+    for (size_t i = 0; i < size; ++i) {
+        TestAssert::assert_equal(static_cast<uint8_t>(i & 0xFF), buffer[i]);
+    }
+}
+
 void test_aligned_buffer_move_constructor() {
     AlignedBuffer buffer1(512, 64);
     uint8_t* original_ptr = buffer1.data();
@@ -55,6 +68,23 @@ void test_aligned_buffer_move_assignment() {
     TestAssert::assert_equal_int(128, buffer2.alignment());
 }
 
+void test_aligned_buffer_page_mode() {
+    AlignedBuffer buffer(64 * 1024 + 100, 64, PageMode::SMALL);
+    ASSERT_TRUE(buffer.is_aligned());
+    ASSERT_TRUE(buffer.page_mode() == PageMode::SMALL);
+    
+    // mmap-backed buffers start on a page boundary and get the same pattern
+    uintptr_t addr = reinterpret_cast<uintptr_t>(buffer.data());
+    TestAssert::assert_equal_uintptr(0, addr % 4096);
+    TestAssert::assert_equal(static_cast<uint8_t>(200), buffer[200]);
+    
+    AlignedBuffer moved(std::move(buffer));
+    ASSERT_TRUE(moved.page_mode() == PageMode::SMALL);
+#ifdef __linux__
+    ASSERT_TRUE(moved.page_backing().available);
+#endif
+}
+
 void test_aligned_buffer_invalid_params() {
     try {
         AlignedBuffer buffer(0, 64);  // Zero size should throw
@@ -77,8 +107,10 @@ int main() {
     TEST_CASE("AlignedBuffer creation", test_aligned_buffer_creation);
     TEST_CASE("AlignedBuffer alignment", test_aligned_buffer_alignment);
     TEST_CASE("AlignedBuffer initialization", test_aligned_buffer_initialization);
+    TEST_CASE("AlignedBuffer range initialization", test_aligned_buffer_range_initialization);
     TEST_CASE("AlignedBuffer move constructor", test_aligned_buffer_move_constructor);
     TEST_CASE("AlignedBuffer move assignment", test_aligned_buffer_move_assignment);
+    TEST_CASE("AlignedBuffer page mode", test_aligned_buffer_page_mode);
     TEST_CASE("AlignedBuffer invalid parameters", test_aligned_buffer_invalid_params);
     
     return framework.run_all();
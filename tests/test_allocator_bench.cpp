@@ -0,0 +1,141 @@
+#include "test_framework.h"
+#include "../common/allocator_bench.h"
+#include "../common/errors.h"
+#include <algorithm>
+#include <mutex>
+#include <string>
+#include <vector>
+
+using AllocatorBench::Kind;
+using AllocatorBench::Workload;
+
+namespace {
+
+AllocatorBench::AllocatorSpec spec_of(const std::string& name) {
+    return AllocatorBench::parse_allocators(name).front();
+}
+
+template <typename Error, typename Fn>
+void expect_error(Fn&& fn, const std::string& text) {
+    try {
+        fn();
+        ASSERT_TRUE(false);  // Should throw
+    } catch (const Error& e) {
+        std::string error_msg = e.what();
+        ASSERT_TRUE(error_msg.find(text) != std::string::npos);
+    }
+}
+
+}  // namespace
+
+void test_parse_workloads() {
+    TestAssert::assert_equal_size_t(3, AllocatorBench::parse_workloads("all").size());
+    std::vector<Workload> workloads = AllocatorBench::parse_workloads("fragmentation,churn,fragmentation");
+    ASSERT_TRUE(workloads == std::vector<Workload>({Workload::FRAGMENTATION, Workload::CHURN}));
+    TestAssert::assert_equal(std::string("producer_consumer"),
+                             AllocatorBench::workload_to_string(Workload::PRODUCER_CONSUMER));
+
+    expect_error<ArgumentError>([] { AllocatorBench::parse_workloads("churn,slab"); }, "'slab'");
+    expect_error<ArgumentError>([] { AllocatorBench::parse_workloads(""); }, "at least one workload");
+}
+
+void test_parse_allocators() {
+    std::vector<AllocatorBench::AllocatorSpec> specs =
+        AllocatorBench::parse_allocators("system,arena,pool,lib:/opt/lib/libmimalloc.so");
+    TestAssert::assert_equal_size_t(4, specs.size());
+    ASSERT_TRUE(specs[0].kind == Kind::SYSTEM && specs[0].name.find("system") == 0);
+    ASSERT_TRUE(specs[1].kind == Kind::ARENA && specs[2].kind == Kind::POOL);
+    ASSERT_TRUE(specs[3].kind == Kind::LIBRARY);
+    TestAssert::assert_equal(std::string("/opt/lib/libmimalloc.so"), specs[3].path);
+
+    expect_error<ArgumentError>([] { AllocatorBench::parse_allocators("system,lib:"); }, "path of a shared library");
+    expect_error<ArgumentError>([] { AllocatorBench::parse_allocators("hoard"); }, "'hoard'");
+}
+
+void test_every_allocator_runs_churn() {
+    // Two unpinned threads, a few rounds each
+    for (const char* name : {"system", "arena", "pool"}) {
+        AllocatorBench::Result result = AllocatorBench::run(spec_of(name), Workload::CHURN, 5000, {0, 1}, nullptr);
+        ASSERT_TRUE(result.available);
+        TestAssert::assert_equal_size_t(2, result.num_threads);
+        TestAssert::assert_equal_size_t(10000, result.ops);
+        ASSERT_TRUE(result.total_mops > 0.0 && result.ns_per_op > 0.0);
+        TestAssert::assert_equal_size_t(0, result.live_bytes);
+    }
+}
+
+void test_producer_consumer_pairs_threads() {
+    // The consumer frees into the producer's pool through its remote list
+    for (const char* name : {"system", "pool"}) {
+        AllocatorBench::Result result =
+            AllocatorBench::run(spec_of(name), Workload::PRODUCER_CONSUMER, 20000, {0, 1, 2}, nullptr);
+        ASSERT_TRUE(result.available);
+        TestAssert::assert_equal_size_t(2, result.num_threads);  // The odd thread is dropped
+        TestAssert::assert_equal_size_t(20000, result.ops);
+        ASSERT_TRUE(result.ns_per_op > 0.0);
+    }
+
+    AllocatorBench::Result single = AllocatorBench::run(spec_of("pool"), Workload::PRODUCER_CONSUMER, 100, {0}, nullptr);
+    ASSERT_FALSE(single.available);
+    ASSERT_TRUE(single.note.find("2 threads") != std::string::npos);
+}
+
+void test_fragmentation_holds_a_live_set() {
+    AllocatorBench::Result result = AllocatorBench::run(spec_of("pool"), Workload::FRAGMENTATION, 2000, {0}, nullptr);
+    ASSERT_TRUE(result.available);
+    TestAssert::assert_equal_size_t(2000, result.ops);
+    ASSERT_TRUE(result.live_bytes > 0);
+
+    // The arena only reclaims memory when a churn round rewinds it
+    AllocatorBench::Result arena = AllocatorBench::run(spec_of("arena"), Workload::FRAGMENTATION, 2000, {0}, nullptr);
+    ASSERT_FALSE(arena.available);
+}
+
+void test_run_pins_each_thread() {
+    std::vector<size_t> pinned;
+    std::mutex mutex;
+    CoherenceTests::PinFunction pin = [&](size_t cpu) {
+        std::lock_guard<std::mutex> lock(mutex);
+        pinned.push_back(cpu);
+    };
+    AllocatorBench::run(spec_of("pool"), Workload::CHURN, 100, {4, 2, 9}, pin);
+    std::sort(pinned.begin(), pinned.end());
+    ASSERT_TRUE(pinned == std::vector<size_t>({2, 4, 9}));
+}
+
+void test_library_errors() {
+    expect_error<ConfigurationError>([] { AllocatorBench::run(spec_of("system"), Workload::CHURN, 10, {}, nullptr); },
+                                     "at least one thread");
+    expect_error<ConfigurationError>(
+        [] { AllocatorBench::run(spec_of("lib:/nonexistent/libnomalloc.so"), Workload::CHURN, 10, {0}, nullptr); },
+        "Cannot load allocator library");
+#if defined(__linux__) && defined(__GLIBC__)
+    // libm resolves malloc only through its libc dependency
+    expect_error<ConfigurationError>(
+        [] { AllocatorBench::run(spec_of("lib:libm.so.6"), Workload::CHURN, 10, {0}, nullptr); },
+        "does not define malloc and free");
+    AllocatorBench::Result libc = AllocatorBench::run(spec_of("lib:libc.so.6"), Workload::CHURN, 1000, {0}, nullptr);
+    ASSERT_TRUE(libc.available && libc.ops == 1000);
+#endif
+}
+
+void test_resident_bytes() {
+#if defined(__linux__) || defined(__APPLE__)
+    ASSERT_TRUE(AllocatorBench::resident_bytes() > 0);
+#endif
+}
+
+int main() {
+    TestFramework framework;
+
+    TEST_CASE("Parse workloads", test_parse_workloads);
+    TEST_CASE("Parse allocators", test_parse_allocators);
+    TEST_CASE("Every allocator runs churn", test_every_allocator_runs_churn);
+    TEST_CASE("Producer/consumer pairs threads", test_producer_consumer_pairs_threads);
+    TEST_CASE("Fragmentation holds a live set", test_fragmentation_holds_a_live_set);
+    TEST_CASE("Run pins each thread", test_run_pins_each_thread);
+    TEST_CASE("Library errors", test_library_errors);
+    TEST_CASE("Resident bytes", test_resident_bytes);
+
+    return framework.run_all();
+}
@@ -1,5 +1,8 @@
 #include "test_framework.h"
 #include "../common/argument_parser.h"
+#include <string>
+#include <utility>
+#include <vector>
 
 void test_help_argument() {
     ArgumentParser parser("test", "Test program");
@@ -77,6 +80,1213 @@ void test_format_argument() {
     TestAssert::assert_equal(std::string("json"), config.format_str);
 }
 
+void test_kernel_argument() {
+    ArgumentParser parser("test", "Test program");
+    
+    const char* argv[] = {"test", "--kernel", "scalar"};
+    BenchmarkConfig config = parser.parse(3, const_cast<char**>(argv));
+    
+    TestAssert::assert_equal(std::string("scalar"), config.kernel_str);
+}
+
+void test_inline_value_argument() {
+    ArgumentParser parser("test", "Test program");
+    
+    const char* argv[] = {"test", "--kernel=scalar", "--format=csv"};
+    BenchmarkConfig config = parser.parse(3, const_cast<char**>(argv));
+    
+    TestAssert::assert_equal(std::string("scalar"), config.kernel_str);
+    TestAssert::assert_equal(std::string("csv"), config.format_str);
+}
+
+void test_stores_argument() {
+    ArgumentParser parser("test", "Test program");
+    
+    const char* argv[] = {"test", "--stores", "temporal,nontemporal"};
+    BenchmarkConfig config = parser.parse(3, const_cast<char**>(argv));
+    
+    TestAssert::assert_equal(std::string("temporal,nontemporal"), config.store_policy_str);
+}
+
+void test_invalid_stores() {
+    ArgumentParser parser("test", "Test program");
+    
+    const char* argv[] = {"test", "--stores", "writeback"};
+    
+    try {
+        parser.parse(3, const_cast<char**>(argv));
+        ASSERT_TRUE(false);  // Should throw
+    } catch (const ArgumentError& e) {
+        // Expected
+        std::string error_msg = e.what();
+        ASSERT_TRUE(error_msg.find("Invalid store policy") != std::string::npos);
+    }
+}
+
+void test_precision_argument() {
+    ArgumentParser parser("test", "Test program");
+    
+    const char* argv[] = {"test", "--precision", "bf16,int8"};
+    BenchmarkConfig config = parser.parse(3, const_cast<char**>(argv));
+    
+    TestAssert::assert_equal(std::string("bf16,int8"), config.precision_str);
+}
+
+void test_invalid_precision() {
+    ArgumentParser parser("test", "Test program");
+    
+    const char* argv[] = {"test", "--precision", "fp8"};
+    
+    try {
+        parser.parse(3, const_cast<char**>(argv));
+        ASSERT_TRUE(false);  // Should throw
+    } catch (const ArgumentError& e) {
+        std::string error_msg = e.what();
+        ASSERT_TRUE(error_msg.find("Invalid precision") != std::string::npos);
+    }
+}
+
+void test_numa_matrix_argument() {
+    ArgumentParser parser("test", "Test program");
+    
+    const char* argv[] = {"test", "--numa-matrix", "--pattern", "sequential_read"};
+    BenchmarkConfig config = parser.parse(4, const_cast<char**>(argv));
+    
+    ASSERT_TRUE(config.numa_matrix);
+    ASSERT_FALSE(config.cache_hierarchy);
+}
+
+void test_numa_matrix_cache_hierarchy_exclusive() {
+    ArgumentParser parser("test", "Test program");
+    
+    const char* argv[] = {"test", "--numa-matrix", "--cache-hierarchy"};
+    
+    try {
+        parser.parse(3, const_cast<char**>(argv));
+        ASSERT_TRUE(false);  // Should throw
+    } catch (const ArgumentError& e) {
+        std::string error_msg = e.what();
+        ASSERT_TRUE(error_msg.find("mutually exclusive") != std::string::npos);
+    }
+}
+
+void test_loaded_latency_argument() {
+    ArgumentParser parser("test", "Test program");
+    
+    const char* argv[] = {"test", "--loaded-latency", "--pattern", "copy"};
+    BenchmarkConfig config = parser.parse(4, const_cast<char**>(argv));
+    
+    ASSERT_TRUE(config.loaded_latency);
+    TestAssert::assert_equal(std::string("copy"), config.pattern_str);
+}
+
+void test_loaded_latency_invalid_pattern() {
+    ArgumentParser parser("test", "Test program");
+    
+    const char* argv[] = {"test", "--loaded-latency", "--pattern", "triad"};
+    
+    try {
+        parser.parse(4, const_cast<char**>(argv));
+        ASSERT_TRUE(false);  // Should throw
+    } catch (const ArgumentError& e) {
+        std::string error_msg = e.what();
+        ASSERT_TRUE(error_msg.find("Valid load patterns") != std::string::npos);
+    }
+}
+
+void test_roofline_argument() {
+    ArgumentParser parser("test", "Test program");
+    
+    const char* argv[] = {"test", "--roofline", "--precision", "fp64"};
+    BenchmarkConfig config = parser.parse(4, const_cast<char**>(argv));
+    
+    ASSERT_TRUE(config.roofline);
+    TestAssert::assert_equal(std::string("fp64"), config.precision_str);
+}
+
+void test_roofline_conflicts() {
+    ArgumentParser parser("test", "Test program");
+    
+    const char* argv[] = {"test", "--roofline", "--loaded-latency"};
+    try {
+        parser.parse(3, const_cast<char**>(argv));
+        ASSERT_TRUE(false);  // Should throw
+    } catch (const ArgumentError& e) {
+        std::string error_msg = e.what();
+        ASSERT_TRUE(error_msg.find("--roofline cannot be combined") != std::string::npos);
+    }
+    
+    const char* pattern_argv[] = {"test", "--roofline", "--pattern", "copy"};
+    try {
+        parser.parse(4, const_cast<char**>(pattern_argv));
+        ASSERT_TRUE(false);  // Should throw
+    } catch (const ArgumentError& e) {
+        std::string error_msg = e.what();
+        ASSERT_TRUE(error_msg.find("mutually exclusive") != std::string::npos);
+    }
+}
+
+void test_sweep_argument() {
+    ArgumentParser parser("test", "Test program");
+    
+    const char* argv[] = {"test", "--sweep=log2:8", "--size", "1"};
+    BenchmarkConfig config = parser.parse(4, const_cast<char**>(argv));
+    
+    TestAssert::assert_equal(std::string("log2:8"), config.sweep_str);
+    
+    const char* invalid_argv[] = {"test", "--sweep", "linear:8"};
+    try {
+        parser.parse(3, const_cast<char**>(invalid_argv));
+        ASSERT_TRUE(false);  // Should throw
+    } catch (const ArgumentError& e) {
+        std::string error_msg = e.what();
+        ASSERT_TRUE(error_msg.find("Invalid sweep") != std::string::npos);
+    }
+    
+    const char* conflict_argv[] = {"test", "--sweep=log2:4", "--roofline"};
+    try {
+        parser.parse(3, const_cast<char**>(conflict_argv));
+        ASSERT_TRUE(false);  // Should throw
+    } catch (const ArgumentError& e) {
+        std::string error_msg = e.what();
+        ASSERT_TRUE(error_msg.find("--sweep cannot be combined") != std::string::npos);
+    }
+}
+
+void test_counters_argument() {
+    ArgumentParser parser("test", "Test program");
+    
+    const char* argv[] = {"test", "--counters", "--pattern", "copy"};
+    BenchmarkConfig config = parser.parse(4, const_cast<char**>(argv));
+    ASSERT_TRUE(config.counters);
+    
+    const char* conflict_argv[] = {"test", "--counters", "--roofline"};
+    try {
+        parser.parse(3, const_cast<char**>(conflict_argv));
+        ASSERT_TRUE(false);  // Should throw
+    } catch (const ArgumentError& e) {
+        std::string error_msg = e.what();
+        ASSERT_TRUE(error_msg.find("--counters is only supported") != std::string::npos);
+    }
+}
+
+void test_energy_argument() {
+    ArgumentParser parser("test", "Test program");
+
+    const char* argv[] = {"test", "--energy", "--threads", "sweep", "--pattern", "sequential_read"};
+    BenchmarkConfig config = parser.parse(6, const_cast<char**>(argv));
+    ASSERT_TRUE(config.energy);
+    ASSERT_FALSE(config.counters);
+
+    for (const char* mode : {"--roofline", "--tlb", "--calibrate"}) {
+        const char* conflict_argv[] = {"test", "--energy", mode};
+        try {
+            parser.parse(3, const_cast<char**>(conflict_argv));
+            ASSERT_TRUE(false);  // Should throw
+        } catch (const ArgumentError& e) {
+            std::string error_msg = e.what();
+            ASSERT_TRUE(error_msg.find("--energy is only supported") != std::string::npos);
+        }
+    }
+}
+
+void test_cold_argument() {
+    ArgumentParser parser("test", "Test program");
+
+    const char* argv[] = {"test", "--cold", "evict", "--cache-hierarchy"};
+    BenchmarkConfig config = parser.parse(4, const_cast<char**>(argv));
+    TestAssert::assert_equal(std::string("evict"), config.cold_str);
+    const char* pattern_argv[] = {"test", "--cold", "evict", "--pattern", "latency_chase"};
+    config = parser.parse(5, const_cast<char**>(pattern_argv));
+    TestAssert::assert_equal(std::string("latency_chase"), config.pattern_str);
+
+    const char* bad_argv[] = {"test", "--cold", "warm", "--pattern", "copy"};
+    try {
+        parser.parse(5, const_cast<char**>(bad_argv));
+        ASSERT_TRUE(false);  // Should throw
+    } catch (const ArgumentError& e) {
+        std::string error_msg = e.what();
+        ASSERT_TRUE(error_msg.find("Invalid --cold value") != std::string::npos);
+    }
+    for (const char* pattern : {"streams", "gather", "matrix_multiply"}) {
+        const char* unsupported_argv[] = {"test", "--cold", "evict", "--pattern", pattern};
+        try {
+            parser.parse(5, const_cast<char**>(unsupported_argv));
+            ASSERT_TRUE(false);  // Should throw
+        } catch (const ArgumentError& e) {
+            std::string error_msg = e.what();
+            ASSERT_TRUE(error_msg.find("--cold requires --pattern all or one of sequential_read") != std::string::npos);
+        }
+    }
+
+    const char* mode_argv[] = {"test", "--cold", "evict", "--pattern", "triad", "--loaded-latency"};
+    try {
+        parser.parse(6, const_cast<char**>(mode_argv));
+        ASSERT_TRUE(false);  // Should throw
+    } catch (const ArgumentError& e) {
+        std::string error_msg = e.what();
+        ASSERT_TRUE(error_msg.find("--cold is only supported") != std::string::npos);
+    }
+    const char* energy_argv[] = {"test", "--cold", "evict", "--pattern", "triad", "--energy"};
+    try {
+        parser.parse(6, const_cast<char**>(energy_argv));
+        ASSERT_TRUE(false);  // Should throw
+    } catch (const ArgumentError& e) {
+        std::string error_msg = e.what();
+        ASSERT_TRUE(error_msg.find("--cold cannot be combined with --energy") != std::string::npos);
+    }
+}
+
+void test_ndjson_argument() {
+    ArgumentParser parser("test", "Test program");
+    
+    const char* argv[] = {"test", "--ndjson", "results.ndjson", "--cache-hierarchy"};
+    BenchmarkConfig config = parser.parse(4, const_cast<char**>(argv));
+    TestAssert::assert_equal(std::string("results.ndjson"), config.ndjson_path);
+    ASSERT_TRUE(config.cache_hierarchy);
+    
+    const char* conflict_argv[] = {"test", "--ndjson", "results.ndjson", "--loaded-latency"};
+    try {
+        parser.parse(4, const_cast<char**>(conflict_argv));
+        ASSERT_TRUE(false);  // Should throw
+    } catch (const ArgumentError& e) {
+        std::string error_msg = e.what();
+        ASSERT_TRUE(error_msg.find("--ndjson is only supported") != std::string::npos);
+    }
+}
+
+void test_baseline_arguments() {
+    ArgumentParser parser("test", "Test program");
+    
+    const char* argv[] = {"test", "--save-baseline", "new.json", "--compare", "old.json", "--cache-hierarchy"};
+    BenchmarkConfig config = parser.parse(6, const_cast<char**>(argv));
+    TestAssert::assert_equal(std::string("new.json"), config.save_baseline_path);
+    TestAssert::assert_equal(std::string("old.json"), config.compare_path);
+    
+    const char* conflict_argv[] = {"test", "--compare", "old.json", "--loaded-latency"};
+    try {
+        parser.parse(4, const_cast<char**>(conflict_argv));
+        ASSERT_TRUE(false);  // Should throw
+    } catch (const ArgumentError& e) {
+        std::string error_msg = e.what();
+        ASSERT_TRUE(error_msg.find("--compare is only supported") != std::string::npos);
+    }
+}
+
+void test_system_cache_argument() {
+    ArgumentParser parser("test", "Test program");
+    
+    const char* plain_argv[] = {"test"};
+    TestAssert::assert_equal(std::string(""), parser.parse(1, const_cast<char**>(plain_argv)).system_cache);
+    
+    // Any run can keep its detection, whatever it measures
+    const char* argv[] = {"test", "--system-cache", "/tmp/probe.json", "--pattern", "triad", "--size", "0.1"};
+    BenchmarkConfig config = parser.parse(7, const_cast<char**>(argv));
+    TestAssert::assert_equal(std::string("/tmp/probe.json"), config.system_cache);
+}
+
+void test_calibrate_arguments() {
+    ArgumentParser parser("test", "Test program");
+    
+    const char* argv[] = {"test", "--calibrate", "--peak-file", "peaks.json", "--size", "4"};
+    BenchmarkConfig config = parser.parse(6, const_cast<char**>(argv));
+    ASSERT_TRUE(config.calibrate);
+    TestAssert::assert_equal(std::string("peaks.json"), config.peak_file);
+    
+    const char* mode_argv[] = {"test", "--calibrate", "--cache-hierarchy"};
+    try {
+        parser.parse(3, const_cast<char**>(mode_argv));
+        ASSERT_TRUE(false);  // Should throw
+    } catch (const ArgumentError& e) {
+        std::string error_msg = e.what();
+        ASSERT_TRUE(error_msg.find("--calibrate cannot be combined") != std::string::npos);
+    }
+    
+    const char* stores_argv[] = {"test", "--calibrate", "--stores", "nontemporal"};
+    try {
+        parser.parse(4, const_cast<char**>(stores_argv));
+        ASSERT_TRUE(false);  // Should throw
+    } catch (const ArgumentError& e) {
+        std::string error_msg = e.what();
+        ASSERT_TRUE(error_msg.find("mutually exclusive") != std::string::npos);
+    }
+}
+
+void test_file_backing_arguments() {
+    ArgumentParser parser("test", "Test program");
+    
+    const char* argv[] = {"test", "--file", "/dev/shm", "--madvise", "random", "--file-cache", "cold"};
+    BenchmarkConfig config = parser.parse(7, const_cast<char**>(argv));
+    TestAssert::assert_equal(std::string("/dev/shm"), config.file_dir);
+    TestAssert::assert_equal(std::string("random"), config.madvise_str);
+    TestAssert::assert_equal(std::string("cold"), config.file_cache_str);
+    ASSERT_FALSE(config.file_populate);
+    
+    const char* orphan_argv[] = {"test", "--madvise", "sequential"};
+    try {
+        parser.parse(3, const_cast<char**>(orphan_argv));
+        ASSERT_TRUE(false);  // Should throw
+    } catch (const ArgumentError& e) {
+        std::string error_msg = e.what();
+        ASSERT_TRUE(error_msg.find("require --file DIR") != std::string::npos);
+    }
+    
+    const char* populate_argv[] = {"test", "--file", "/tmp", "--file-populate", "--file-cache", "cold"};
+    try {
+        parser.parse(6, const_cast<char**>(populate_argv));
+        ASSERT_TRUE(false);  // Should throw
+    } catch (const ArgumentError& e) {
+        std::string error_msg = e.what();
+        ASSERT_TRUE(error_msg.find("mutually exclusive") != std::string::npos);
+    }
+    
+    const char* mode_argv[] = {"test", "--file", "/tmp", "--roofline"};
+    try {
+        parser.parse(4, const_cast<char**>(mode_argv));
+        ASSERT_TRUE(false);  // Should throw
+    } catch (const ArgumentError& e) {
+        std::string error_msg = e.what();
+        ASSERT_TRUE(error_msg.find("--file is only supported") != std::string::npos);
+    }
+}
+
+void test_io_arguments() {
+    ArgumentParser parser("test", "Test program");
+    
+    const char* argv[] = {"test", "--io", "/tmp", "--io-methods", "pread,io_uring", "--io-depth", "1,8"};
+    BenchmarkConfig config = parser.parse(7, const_cast<char**>(argv));
+    TestAssert::assert_equal(std::string("/tmp"), config.io_dir);
+    TestAssert::assert_equal(std::string("pread,io_uring"), config.io_methods_str);
+    TestAssert::assert_equal(std::string("1,8"), config.io_depth_str);
+    TestAssert::assert_equal(std::string("4k,128k,1m"), config.io_block_str);
+    
+    const char* orphan_argv[] = {"test", "--io-block", "64k"};
+    try {
+        parser.parse(3, const_cast<char**>(orphan_argv));
+        ASSERT_TRUE(false);  // Should throw
+    } catch (const ArgumentError& e) {
+        std::string error_msg = e.what();
+        ASSERT_TRUE(error_msg.find("require --io DIR") != std::string::npos);
+    }
+    
+    const char* block_argv[] = {"test", "--io", "/tmp", "--io-block", "1000"};
+    try {
+        parser.parse(5, const_cast<char**>(block_argv));
+        ASSERT_TRUE(false);  // Should throw
+    } catch (const ArgumentError& e) {
+        std::string error_msg = e.what();
+        ASSERT_TRUE(error_msg.find("multiple of 4k") != std::string::npos);
+    }
+    
+    const char* mode_argv[] = {"test", "--io", "/tmp", "--cache-hierarchy"};
+    try {
+        parser.parse(4, const_cast<char**>(mode_argv));
+        ASSERT_TRUE(false);  // Should throw
+    } catch (const ArgumentError& e) {
+        std::string error_msg = e.what();
+        ASSERT_TRUE(error_msg.find("--io cannot be combined") != std::string::npos);
+    }
+}
+
+void test_trace_arguments() {
+    ArgumentParser parser("test", "Test program");
+    
+    const char* argv[] = {"test", "--trace", "service.trace", "--trace-convert", "perf:samples.txt"};
+    BenchmarkConfig config = parser.parse(5, const_cast<char**>(argv));
+    TestAssert::assert_equal(std::string("service.trace"), config.trace_path);
+    TestAssert::assert_equal(std::string("perf:samples.txt"), config.trace_convert_str);
+    
+    const std::pair<std::vector<const char*>, std::string> cases[] = {
+        {{"test", "--trace-convert", "histogram:h.txt"}, "requires --trace"},
+        {{"test", "--trace", "t", "--trace-convert", "lbr:x"}, "Invalid trace source"},
+        {{"test", "--trace", "t", "--pattern", "copy"}, "mutually exclusive"},
+        {{"test", "--trace", "t", "--cache-hierarchy"}, "--trace cannot be combined"},
+        {{"test", "--trace", "t", "--ndjson", "out.ndjson"}, "--ndjson is only supported"},
+    };
+    for (const auto& failure : cases) {
+        try {
+            parser.parse(static_cast<int>(failure.first.size()), const_cast<char**>(failure.first.data()));
+            ASSERT_TRUE(false);  // Should throw
+        } catch (const ArgumentError& e) {
+            std::string error_msg = e.what();
+            ASSERT_TRUE(error_msg.find(failure.second) != std::string::npos);
+        }
+    }
+}
+
+void test_allocator_arguments() {
+    ArgumentParser parser("test", "Test program");
+    
+    const char* argv[] = {"test", "--allocators", "system,pool", "--alloc-workloads", "churn", "--threads", "1,2"};
+    BenchmarkConfig config = parser.parse(7, const_cast<char**>(argv));
+    TestAssert::assert_equal(std::string("system,pool"), config.allocators_str);
+    TestAssert::assert_equal(std::string("churn"), config.alloc_workloads_str);
+    TestAssert::assert_equal(std::string("1,2"), config.threads_str);
+    
+    const std::pair<std::vector<const char*>, std::string> cases[] = {
+        {{"test", "--alloc-workloads", "churn"}, "requires --allocators"},
+        {{"test", "--allocators", "system,slab"}, "Unknown allocator"},
+        {{"test", "--allocators", "pool", "--alloc-workloads", "bursty"}, "Unknown allocator workload"},
+        {{"test", "--allocators", "pool", "--pattern", "copy"}, "mutually exclusive"},
+        {{"test", "--allocators", "pool", "--atomics"}, "--allocators cannot be combined"},
+        {{"test", "--allocators", "pool", "--ndjson", "out.ndjson"}, "--ndjson is only supported"},
+    };
+    for (const auto& failure : cases) {
+        try {
+            parser.parse(static_cast<int>(failure.first.size()), const_cast<char**>(failure.first.data()));
+            ASSERT_TRUE(false);  // Should throw
+        } catch (const ArgumentError& e) {
+            std::string error_msg = e.what();
+            ASSERT_TRUE(error_msg.find(failure.second) != std::string::npos);
+        }
+    }
+}
+
+void test_mapping_arguments() {
+    ArgumentParser parser("test", "Test program");
+    
+    const char* argv[] = {"test", "--mapping", "--mapping-ops", "first_touch,munmap", "--size", "0.5"};
+    BenchmarkConfig config = parser.parse(6, const_cast<char**>(argv));
+    ASSERT_TRUE(config.mapping);
+    TestAssert::assert_equal(std::string("first_touch,munmap"), config.mapping_ops_str);
+    
+    const std::pair<std::vector<const char*>, std::string> cases[] = {
+        {{"test", "--mapping-ops", "munmap"}, "requires --mapping"},
+        {{"test", "--mapping", "--mapping-ops", "mremap"}, "Unknown mapping operation"},
+        {{"test", "--mapping", "--pattern", "copy"}, "mutually exclusive"},
+        {{"test", "--mapping", "--allocators", "pool"}, "cannot be combined"},
+        {{"test", "--mapping", "--save-baseline", "b.json"}, "--save-baseline is only supported"},
+    };
+    for (const auto& failure : cases) {
+        try {
+            parser.parse(static_cast<int>(failure.first.size()), const_cast<char**>(failure.first.data()));
+            ASSERT_TRUE(false);  // Should throw
+        } catch (const ArgumentError& e) {
+            std::string error_msg = e.what();
+            ASSERT_TRUE(error_msg.find(failure.second) != std::string::npos);
+        }
+    }
+}
+
+void test_tlb_arguments() {
+    ArgumentParser parser("test", "Test program");
+    
+    const char* argv[] = {"test", "--tlb", "--tlb-pages", "2m,4k", "--size", "0.5"};
+    BenchmarkConfig config = parser.parse(6, const_cast<char**>(argv));
+    ASSERT_TRUE(config.tlb);
+    TestAssert::assert_equal(std::string("2m,4k"), config.tlb_pages_str);
+    
+    const std::pair<std::vector<const char*>, std::string> cases[] = {
+        {{"test", "--tlb-pages", "4k"}, "requires --tlb"},
+        {{"test", "--tlb", "--tlb-pages", "4k,default"}, "--tlb-pages takes"},
+        {{"test", "--tlb", "--pattern", "copy"}, "mutually exclusive"},
+        {{"test", "--tlb", "--pages", "2m"}, "cannot be combined"},
+        {{"test", "--tlb", "--mapping"}, "cannot be combined"},
+        {{"test", "--tlb", "--ndjson", "r.ndjson"}, "--ndjson is only supported"},
+    };
+    for (const auto& failure : cases) {
+        try {
+            parser.parse(static_cast<int>(failure.first.size()), const_cast<char**>(failure.first.data()));
+            ASSERT_TRUE(false);  // Should throw
+        } catch (const ArgumentError& e) {
+            std::string error_msg = e.what();
+            ASSERT_TRUE(error_msg.find(failure.second) != std::string::npos);
+        }
+    }
+}
+
+void test_decode_arguments() {
+    ArgumentParser parser("test", "Test program");
+    
+    const char* argv[] = {"test", "--pattern", "decode_dict", "--bits", "12"};
+    BenchmarkConfig config = parser.parse(5, const_cast<char**>(argv));
+    TestAssert::assert_equal(std::string("12"), config.bits_str);
+    
+    // The hierarchy suite leaves the decode patterns out, so they sweep the cache levels on their own
+    const char* hierarchy_argv[] = {"test", "--cache-hierarchy", "--pattern", "decode_bitpack", "--bits", "32"};
+    config = parser.parse(6, const_cast<char**>(hierarchy_argv));
+    ASSERT_TRUE(config.cache_hierarchy);
+    
+    const std::pair<std::vector<const char*>, std::string> cases[] = {
+        {{"test", "--bits", "8"}, "requires --pattern decode_bitpack"},
+        {{"test", "--pattern", "copy", "--bits", "8"}, "requires --pattern decode_bitpack"},
+        {{"test", "--pattern", "decode_dict", "--bits", "17"}, "Valid widths: 1-16"},
+        {{"test", "--pattern", "decode_delta", "--bits", "0"}, "Valid widths: 1-32"},
+        {{"test", "--cache-hierarchy", "--pattern", "gather"}, "mutually exclusive"},
+    };
+    for (const auto& failure : cases) {
+        try {
+            parser.parse(static_cast<int>(failure.first.size()), const_cast<char**>(failure.first.data()));
+            ASSERT_TRUE(false);  // Should throw
+        } catch (const ArgumentError& e) {
+            std::string error_msg = e.what();
+            ASSERT_TRUE(error_msg.find(failure.second) != std::string::npos);
+        }
+    }
+}
+
+void test_proxy_arguments() {
+    ArgumentParser parser("test", "Test program");
+    
+    const char* argv[] = {"test", "--pattern", "hash_probe", "--probe", "linear", "--load-factor", "0.9",
+                          "--hash-batch", "1"};
+    BenchmarkConfig config = parser.parse(9, const_cast<char**>(argv));
+    TestAssert::assert_equal(std::string("linear"), config.probe_str);
+    TestAssert::assert_equal(std::string("0.9"), config.load_factor_str);
+    TestAssert::assert_equal(std::string("1"), config.hash_batch_str);
+    
+    // Table and run sizes follow the working-set ladder
+    const char* hierarchy_argv[] = {"test", "--cache-hierarchy", "--pattern", "merge", "--merge-ways", "16"};
+    config = parser.parse(6, const_cast<char**>(hierarchy_argv));
+    ASSERT_TRUE(config.cache_hierarchy);
+    TestAssert::assert_equal(std::string("16"), config.merge_ways_str);
+    
+    const std::pair<std::vector<const char*>, std::string> cases[] = {
+        {{"test", "--probe", "group"}, "require --pattern hash_probe"},
+        {{"test", "--pattern", "merge", "--load-factor", "0.5"}, "require --pattern hash_probe"},
+        {{"test", "--pattern", "hash_probe", "--merge-ways", "4"}, "requires --pattern merge"},
+        {{"test", "--pattern", "hash_probe", "--probe", "cuckoo"}, "Unknown --probe"},
+        {{"test", "--pattern", "hash_probe", "--load-factor", "1"}, "Invalid --load-factor"},
+        {{"test", "--pattern", "hash_probe", "--hash-batch", "0"}, "Invalid --hash-batch"},
+        {{"test", "--pattern", "merge", "--merge-ways", "65"}, "Invalid --merge-ways"},
+        {{"test", "--pattern", "radix_partition", "--cold"}, "--cold requires"},
+    };
+    for (const auto& failure : cases) {
+        try {
+            parser.parse(static_cast<int>(failure.first.size()), const_cast<char**>(failure.first.data()));
+            ASSERT_TRUE(false);  // Should throw
+        } catch (const ArgumentError& e) {
+            std::string error_msg = e.what();
+            ASSERT_TRUE(error_msg.find(failure.second) != std::string::npos);
+        }
+    }
+}
+
+void test_irregular_arguments() {
+    ArgumentParser parser("test", "Test program");
+    
+    const char* argv[] = {"test", "--pattern", "spmv_sell", "--matrix", "powerlaw", "--row-nnz", "32"};
+    BenchmarkConfig config = parser.parse(7, const_cast<char**>(argv));
+    TestAssert::assert_equal(std::string("powerlaw"), config.matrix_str);
+    TestAssert::assert_equal(std::string("32"), config.row_nnz_str);
+    
+    // Matrices and grids follow the working-set ladder
+    const char* hierarchy_argv[] = {"test", "--cache-hierarchy", "--pattern", "stencil", "--stencil-block", "16"};
+    config = parser.parse(6, const_cast<char**>(hierarchy_argv));
+    ASSERT_TRUE(config.cache_hierarchy);
+    TestAssert::assert_equal(std::string("16"), config.stencil_block_str);
+    
+    const std::pair<std::vector<const char*>, std::string> cases[] = {
+        {{"test", "--matrix", "banded"}, "require --pattern spmv_csr or spmv_sell"},
+        {{"test", "--pattern", "stencil", "--row-nnz", "8"}, "require --pattern spmv_csr or spmv_sell"},
+        {{"test", "--pattern", "spmv_csr", "--stencil-block", "8"}, "requires --pattern stencil"},
+        {{"test", "--pattern", "spmv_csr", "--matrix", "dense"}, "Unknown --matrix"},
+        {{"test", "--pattern", "spmv_csr", "--row-nnz", "1"}, "Invalid --row-nnz"},
+        {{"test", "--pattern", "stencil", "--stencil-block", "2"}, "Invalid --stencil-block"},
+    };
+    for (const auto& failure : cases) {
+        try {
+            parser.parse(static_cast<int>(failure.first.size()), const_cast<char**>(failure.first.data()));
+            ASSERT_TRUE(false);  // Should throw
+        } catch (const ArgumentError& e) {
+            std::string error_msg = e.what();
+            ASSERT_TRUE(error_msg.find(failure.second) != std::string::npos);
+        }
+    }
+}
+
+void test_ring_arguments() {
+    ArgumentParser parser("test", "Test program");
+    
+    const char* argv[] = {"test", "--rings", "--cpus", "0-1", "--ring-payload", "64,4k", "--ring-kinds", "spsc"};
+    BenchmarkConfig config = parser.parse(8, const_cast<char**>(argv));
+    ASSERT_TRUE(config.rings);
+    TestAssert::assert_equal(std::string("0-1"), config.cpus_str);
+    TestAssert::assert_equal(std::string("64,4k"), config.ring_payload_str);
+    TestAssert::assert_equal(std::string("spsc"), config.ring_kinds_str);
+    
+    const std::pair<std::vector<const char*>, std::string> cases[] = {
+        {{"test", "--ring-payload", "64"}, "require --rings"},
+        {{"test", "--rings", "--ring-payload", "12"}, "multiple of 8 bytes"},
+        {{"test", "--rings", "--ring-kinds", "lifo"}, "Unknown ring kind"},
+        {{"test", "--rings", "--pattern", "copy"}, "mutually exclusive"},
+        {{"test", "--rings", "--core-to-core"}, "cannot be combined"},
+        {{"test", "--rings", "--compare", "b.json"}, "--compare is only supported"},
+    };
+    for (const auto& failure : cases) {
+        try {
+            parser.parse(static_cast<int>(failure.first.size()), const_cast<char**>(failure.first.data()));
+            ASSERT_TRUE(false);  // Should throw
+        } catch (const ArgumentError& e) {
+            std::string error_msg = e.what();
+            ASSERT_TRUE(error_msg.find(failure.second) != std::string::npos);
+        }
+    }
+}
+
+void test_memcpy_arguments() {
+    ArgumentParser parser("test", "Test program");
+    
+    const char* argv[] = {"test", "--memcpy", "--memcpy-sizes", "64-64k", "--memcpy-impls", "libc,scalar",
+                          "--memcpy-align", "0:0,3:5", "--memcpy-ops", "copy"};
+    BenchmarkConfig config = parser.parse(10, const_cast<char**>(argv));
+    ASSERT_TRUE(config.memcpy_sweep);
+    TestAssert::assert_equal(std::string("64-64k"), config.memcpy_sizes_str);
+    TestAssert::assert_equal(std::string("libc,scalar"), config.memcpy_impls_str);
+    TestAssert::assert_equal(std::string("0:0,3:5"), config.memcpy_align_str);
+    TestAssert::assert_equal(std::string("copy"), config.memcpy_ops_str);
+    
+    const std::pair<std::vector<const char*>, std::string> cases[] = {
+        {{"test", "--memcpy-ops", "set"}, "require --memcpy"},
+        {{"test", "--memcpy", "--memcpy-sizes", "12-64"}, "multiple of 8 bytes"},
+        {{"test", "--memcpy", "--memcpy-sizes", "4k-64"}, "MIN is larger than MAX"},
+        {{"test", "--memcpy", "--memcpy-impls", "bcopy"}, "Unknown --memcpy-impls"},
+        {{"test", "--memcpy", "--memcpy-align", "64:0"}, "Invalid --memcpy-align"},
+        {{"test", "--memcpy", "--pattern", "copy"}, "mutually exclusive"},
+        {{"test", "--memcpy", "--tlb"}, "cannot be combined"},
+        {{"test", "--memcpy", "--compare", "b.json"}, "--compare is only supported"},
+    };
+    for (const auto& failure : cases) {
+        try {
+            parser.parse(static_cast<int>(failure.first.size()), const_cast<char**>(failure.first.data()));
+            ASSERT_TRUE(false);  // Should throw
+        } catch (const ArgumentError& e) {
+            std::string error_msg = e.what();
+            ASSERT_TRUE(error_msg.find(failure.second) != std::string::npos);
+        }
+    }
+}
+
+void test_tier_arguments() {
+    ArgumentParser parser("test", "Test program");
+    
+    const char* argv[] = {"test", "--tiers", "--pattern", "sequential_read", "--tier-ratios", "1:0,4:1,0:1"};
+    BenchmarkConfig config = parser.parse(6, const_cast<char**>(argv));
+    ASSERT_TRUE(config.memory_tiers);
+    TestAssert::assert_equal(std::string("sequential_read"), config.pattern_str);
+    TestAssert::assert_equal(std::string("1:0,4:1,0:1"), config.tier_ratios_str);
+    
+    const std::pair<std::vector<const char*>, std::string> cases[] = {
+        {{"test", "--tier-ratios", "1:1"}, "requires --tiers"},
+        {{"test", "--tiers", "--tier-ratios", "0:0"}, "both weights are zero"},
+        {{"test", "--tiers", "--tier-ratios", "256:1"}, "Invalid --tier-ratios"},
+        {{"test", "--tiers", "--numa-matrix"}, "cannot be combined"},
+        {{"test", "--tiers", "--memcpy"}, "cannot be combined"},
+        {{"test", "--tiers", "--ndjson", "r.ndjson"}, "--ndjson is only supported"},
+    };
+    for (const auto& failure : cases) {
+        try {
+            parser.parse(static_cast<int>(failure.first.size()), const_cast<char**>(failure.first.data()));
+            ASSERT_TRUE(false);  // Should throw
+        } catch (const ArgumentError& e) {
+            std::string error_msg = e.what();
+            ASSERT_TRUE(error_msg.find(failure.second) != std::string::npos);
+        }
+    }
+}
+
+void test_gpu_arguments() {
+    ArgumentParser parser("test", "Test program");
+    
+    const char* argv[] = {"test", "--gpu", "--gpu-kernels", "copy,triad", "--size", "2"};
+    BenchmarkConfig config = parser.parse(6, const_cast<char**>(argv));
+    ASSERT_TRUE(config.gpu);
+    TestAssert::assert_equal(std::string("copy,triad"), config.gpu_kernels_str);
+    
+    const std::pair<std::vector<const char*>, std::string> cases[] = {
+        {{"test", "--gpu-kernels", "read"}, "requires --gpu"},
+        {{"test", "--gpu", "--gpu-kernels", "scale"}, "Unknown --gpu-kernels kernel"},
+        {{"test", "--gpu", "--tiers"}, "cannot be combined"},
+        {{"test", "--gpu", "--pattern", "copy"}, "mutually exclusive"},
+        {{"test", "--gpu", "--ndjson", "r.ndjson"}, "--ndjson is only supported"},
+        {{"test", "--gpu", "--energy"}, "--energy is only supported"},
+    };
+    for (const auto& failure : cases) {
+        try {
+            parser.parse(static_cast<int>(failure.first.size()), const_cast<char**>(failure.first.data()));
+            ASSERT_TRUE(false);  // Should throw
+        } catch (const ArgumentError& e) {
+            std::string error_msg = e.what();
+            ASSERT_TRUE(error_msg.find(failure.second) != std::string::npos);
+        }
+    }
+}
+
+void test_fleet_arguments() {
+    ArgumentParser parser("test", "Test program");
+    
+    const char* argv[] = {"test", "--coordinate", "node1,node2:7600", "--pattern", "copy", "--ndjson", "fleet.ndjson"};
+    BenchmarkConfig config = parser.parse(7, const_cast<char**>(argv));
+    TestAssert::assert_equal(std::string("node1,node2:7600"), config.coordinate_str);
+    TestAssert::assert_equal(std::string("fleet.ndjson"), config.ndjson_path);
+    
+    const char* agent_argv[] = {"test", "--agent", "7531"};
+    config = parser.parse(3, const_cast<char**>(agent_argv));
+    TestAssert::assert_equal(std::string("7531"), config.agent_port_str);
+    
+    const std::pair<std::vector<const char*>, std::string> cases[] = {
+        {{"test", "--agent", "0"}, "Invalid --agent port"},
+        {{"test", "--agent", "7531", "--coordinate", "node1"}, "mutually exclusive"},
+        {{"test", "--coordinate", "node1:x"}, "Invalid --coordinate port"},
+        {{"test", "--coordinate", "node1", "--compare", "base.json"}, "cannot be combined"},
+        {{"test", "--coordinate", "node1", "--numa-matrix"}, "--coordinate is only supported"},
+    };
+    for (const auto& failure : cases) {
+        try {
+            parser.parse(static_cast<int>(failure.first.size()), const_cast<char**>(failure.first.data()));
+            ASSERT_TRUE(false);  // Should throw
+        } catch (const ArgumentError& e) {
+            std::string error_msg = e.what();
+            ASSERT_TRUE(error_msg.find(failure.second) != std::string::npos);
+        }
+    }
+}
+
+void test_streams_arguments() {
+    ArgumentParser parser("test", "Test program");
+    
+    const char* argv[] = {"test", "--pattern", "streams", "--streams", "8:2"};
+    BenchmarkConfig config = parser.parse(5, const_cast<char**>(argv));
+    TestAssert::assert_equal(std::string("streams"), config.pattern_str);
+    TestAssert::assert_equal(std::string("8:2"), config.streams_str);
+    
+    const char* hierarchy_argv[] = {"test", "--cache-hierarchy", "--streams", "12:0"};
+    config = parser.parse(4, const_cast<char**>(hierarchy_argv));
+    TestAssert::assert_equal(std::string("12:0"), config.streams_str);
+    
+    const char* bad_argv[] = {"test", "--streams", "20:1"};
+    try {
+        parser.parse(3, const_cast<char**>(bad_argv));
+        ASSERT_TRUE(false);  // Should throw
+    } catch (const ArgumentError& e) {
+        std::string error_msg = e.what();
+        ASSERT_TRUE(error_msg.find("Invalid stream count") != std::string::npos);
+    }
+    
+    const char* pattern_argv[] = {"test", "--pattern", "copy", "--streams", "4:1"};
+    try {
+        parser.parse(5, const_cast<char**>(pattern_argv));
+        ASSERT_TRUE(false);  // Should throw
+    } catch (const ArgumentError& e) {
+        std::string error_msg = e.what();
+        ASSERT_TRUE(error_msg.find("--streams requires --pattern all or streams") != std::string::npos);
+    }
+    
+    const char* mode_argv[] = {"test", "--streams", "4:1", "--roofline"};
+    try {
+        parser.parse(4, const_cast<char**>(mode_argv));
+        ASSERT_TRUE(false);  // Should throw
+    } catch (const ArgumentError& e) {
+        std::string error_msg = e.what();
+        ASSERT_TRUE(error_msg.find("--streams is only supported") != std::string::npos);
+    }
+}
+
+void test_sparse_access_arguments() {
+    ArgumentParser parser("test", "Test program");
+    
+    const char* argv[] = {"test", "--pattern", "gather", "--element", "4", "--index", "zipf:1.1"};
+    BenchmarkConfig config = parser.parse(7, const_cast<char**>(argv));
+    TestAssert::assert_equal(std::string("gather"), config.pattern_str);
+    TestAssert::assert_equal(std::string("4"), config.element_str);
+    TestAssert::assert_equal(std::string("zipf:1.1"), config.index_str);
+    
+    const char* strided_argv[] = {"test", "--pattern", "strided", "--element", "8", "--stride", "256"};
+    config = parser.parse(7, const_cast<char**>(strided_argv));
+    TestAssert::assert_equal(std::string("256"), config.stride_str);
+    
+    const char* bad_stride_argv[] = {"test", "--pattern", "strided", "--element", "64", "--stride", "96"};
+    try {
+        parser.parse(7, const_cast<char**>(bad_stride_argv));
+        ASSERT_TRUE(false);  // Should throw
+    } catch (const ArgumentError& e) {
+        std::string error_msg = e.what();
+        ASSERT_TRUE(error_msg.find("Invalid stride") != std::string::npos);
+    }
+    
+    const char* stride_pattern_argv[] = {"test", "--pattern", "gather", "--stride", "128"};
+    try {
+        parser.parse(5, const_cast<char**>(stride_pattern_argv));
+        ASSERT_TRUE(false);  // Should throw
+    } catch (const ArgumentError& e) {
+        std::string error_msg = e.what();
+        ASSERT_TRUE(error_msg.find("--stride requires --pattern strided") != std::string::npos);
+    }
+    
+    const char* index_pattern_argv[] = {"test", "--pattern", "strided", "--index", "page"};
+    try {
+        parser.parse(5, const_cast<char**>(index_pattern_argv));
+        ASSERT_TRUE(false);  // Should throw
+    } catch (const ArgumentError& e) {
+        std::string error_msg = e.what();
+        ASSERT_TRUE(error_msg.find("--index requires --pattern gather or scatter") != std::string::npos);
+    }
+    
+    const char* element_argv[] = {"test", "--element", "8"};
+    try {
+        parser.parse(3, const_cast<char**>(element_argv));
+        ASSERT_TRUE(false);  // Should throw
+    } catch (const ArgumentError& e) {
+        std::string error_msg = e.what();
+        ASSERT_TRUE(error_msg.find("--element requires") != std::string::npos);
+    }
+}
+
+void test_prefetch_arguments() {
+    ArgumentParser parser("test", "Test program");
+    
+    const char* argv[] = {"test", "--pattern", "sequential_read", "--prefetch", "512"};
+    BenchmarkConfig config = parser.parse(5, const_cast<char**>(argv));
+    TestAssert::assert_equal(std::string("512"), config.prefetch_str);
+    TestAssert::assert_equal(std::string("on"), config.hw_prefetch_str);
+    
+    const char* sweep_argv[] = {"test", "--prefetch", "sweep", "--hw-prefetch", "both"};
+    config = parser.parse(5, const_cast<char**>(sweep_argv));
+    TestAssert::assert_equal(std::string("sweep"), config.prefetch_str);
+    TestAssert::assert_equal(std::string("both"), config.hw_prefetch_str);
+    
+    const char* bad_distance_argv[] = {"test", "--prefetch", "100"};
+    try {
+        parser.parse(3, const_cast<char**>(bad_distance_argv));
+        ASSERT_TRUE(false);  // Should throw
+    } catch (const ArgumentError& e) {
+        std::string error_msg = e.what();
+        ASSERT_TRUE(error_msg.find("Invalid prefetch distance") != std::string::npos);
+    }
+    
+    const char* both_argv[] = {"test", "--prefetch", "256", "--hw-prefetch", "both"};
+    try {
+        parser.parse(5, const_cast<char**>(both_argv));
+        ASSERT_TRUE(false);  // Should throw
+    } catch (const ArgumentError& e) {
+        std::string error_msg = e.what();
+        ASSERT_TRUE(error_msg.find("--hw-prefetch both requires --prefetch sweep") != std::string::npos);
+    }
+    
+    const char* pattern_argv[] = {"test", "--pattern", "copy", "--prefetch", "256"};
+    try {
+        parser.parse(5, const_cast<char**>(pattern_argv));
+        ASSERT_TRUE(false);  // Should throw
+    } catch (const ArgumentError& e) {
+        std::string error_msg = e.what();
+        ASSERT_TRUE(error_msg.find("--prefetch requires --pattern") != std::string::npos);
+    }
+    
+    const char* mode_argv[] = {"test", "--cache-hierarchy", "--prefetch", "sweep"};
+    try {
+        parser.parse(4, const_cast<char**>(mode_argv));
+        ASSERT_TRUE(false);  // Should throw
+    } catch (const ArgumentError& e) {
+        std::string error_msg = e.what();
+        ASSERT_TRUE(error_msg.find("--prefetch sweep cannot be combined") != std::string::npos);
+    }
+}
+
+void test_core_to_core_arguments() {
+    ArgumentParser parser("test", "Test program");
+    
+    const char* argv[] = {"test", "--core-to-core", "--cpus", "0-3,8"};
+    BenchmarkConfig config = parser.parse(4, const_cast<char**>(argv));
+    ASSERT_TRUE(config.core_to_core);
+    TestAssert::assert_equal(std::string("0-3,8"), config.cpus_str);
+    
+    const char* cpus_argv[] = {"test", "--cpus", "0-3"};
+    try {
+        parser.parse(3, const_cast<char**>(cpus_argv));
+        ASSERT_TRUE(false);  // Should throw
+    } catch (const ArgumentError& e) {
+        std::string error_msg = e.what();
+        ASSERT_TRUE(error_msg.find("--cpus requires --core-to-core") != std::string::npos);
+    }
+    
+    const char* bad_list_argv[] = {"test", "--core-to-core", "--cpus", "3-1"};
+    try {
+        parser.parse(4, const_cast<char**>(bad_list_argv));
+        ASSERT_TRUE(false);  // Should throw
+    } catch (const ArgumentError& e) {
+        std::string error_msg = e.what();
+        ASSERT_TRUE(error_msg.find("Invalid CPU list") != std::string::npos);
+    }
+    
+    const char* mode_argv[] = {"test", "--core-to-core", "--numa-matrix"};
+    try {
+        parser.parse(3, const_cast<char**>(mode_argv));
+        ASSERT_TRUE(false);  // Should throw
+    } catch (const ArgumentError& e) {
+        std::string error_msg = e.what();
+        ASSERT_TRUE(error_msg.find("--core-to-core cannot be combined") != std::string::npos);
+    }
+}
+
+void test_thread_sweep_arguments() {
+    ArgumentParser parser("test", "Test program");
+    
+    const char* list_argv[] = {"test", "--threads", "2,1"};
+    BenchmarkConfig config = parser.parse(3, const_cast<char**>(list_argv));
+    TestAssert::assert_equal(std::string("2,1"), config.threads_str);
+    TestAssert::assert_equal_size_t(2, config.num_threads);
+    
+    const char* sweep_argv[] = {"test", "--threads", "sweep", "--placement", "scatter"};
+    config = parser.parse(5, const_cast<char**>(sweep_argv));
+    TestAssert::assert_equal(std::string("sweep"), config.threads_str);
+    TestAssert::assert_equal(std::string("scatter"), config.placement_str);
+    ASSERT_TRUE(config.num_threads > 0);
+    
+    const char* list_placement_argv[] = {"test", "--threads", "sweep", "--placement", "list:0"};
+    config = parser.parse(5, const_cast<char**>(list_placement_argv));
+    TestAssert::assert_equal(std::string("list:0"), config.placement_str);
+    
+    const char* placement_argv[] = {"test", "--placement", "spread"};
+    try {
+        parser.parse(3, const_cast<char**>(placement_argv));
+        ASSERT_TRUE(false);  // Should throw
+    } catch (const ArgumentError& e) {
+        std::string error_msg = e.what();
+        ASSERT_TRUE(error_msg.find("Invalid placement") != std::string::npos);
+    }
+    
+    const char* mode_argv[] = {"test", "--threads", "sweep", "--cache-hierarchy"};
+    try {
+        parser.parse(4, const_cast<char**>(mode_argv));
+        ASSERT_TRUE(false);  // Should throw
+    } catch (const ArgumentError& e) {
+        std::string error_msg = e.what();
+        ASSERT_TRUE(error_msg.find("cannot be combined with other modes") != std::string::npos);
+    }
+}
+
+void test_atomics_argument() {
+    ArgumentParser parser("test", "Test program");
+    
+    const char* argv[] = {"test", "--atomics"};
+    BenchmarkConfig config = parser.parse(2, const_cast<char**>(argv));
+    ASSERT_TRUE(config.atomics);
+    
+    const char* mode_argv[] = {"test", "--atomics", "--core-to-core"};
+    try {
+        parser.parse(3, const_cast<char**>(mode_argv));
+        ASSERT_TRUE(false);  // Should throw
+    } catch (const ArgumentError& e) {
+        std::string error_msg = e.what();
+        ASSERT_TRUE(error_msg.find("--atomics cannot be combined") != std::string::npos);
+    }
+    
+    const char* pattern_argv[] = {"test", "--atomics", "--pattern", "sequential_read"};
+    try {
+        parser.parse(4, const_cast<char**>(pattern_argv));
+        ASSERT_TRUE(false);  // Should throw
+    } catch (const ArgumentError& e) {
+        std::string error_msg = e.what();
+        ASSERT_TRUE(error_msg.find("--atomics and --pattern are mutually exclusive") != std::string::npos);
+    }
+}
+
+void test_contention_argument() {
+    ArgumentParser parser("test", "Test program");
+    
+    const char* argv[] = {"test", "--contention", "--threads", "2", "--aggressor", "atomics",
+                          "--pattern", "latency_chase", "--resctrl-aggressor", "MB:0=20"};
+    BenchmarkConfig config = parser.parse(10, const_cast<char**>(argv));
+    ASSERT_TRUE(config.contention);
+    TestAssert::assert_equal(std::string("atomics"), config.aggressor_str);
+    TestAssert::assert_equal_size_t(1, config.victim_threads);
+    TestAssert::assert_equal(std::string("MB:0=20"), config.resctrl_aggressor_str);
+    
+    const char* no_aggressor_argv[] = {"test", "--contention", "--threads", "1"};
+    try {
+        parser.parse(4, const_cast<char**>(no_aggressor_argv));
+        ASSERT_TRUE(false);  // Should throw
+    } catch (const ArgumentError& e) {
+        std::string error_msg = e.what();
+        ASSERT_TRUE(error_msg.find("leaves no aggressor thread") != std::string::npos);
+    }
+    
+    const char* pattern_argv[] = {"test", "--contention", "--threads", "2", "--pattern", "triad"};
+    try {
+        parser.parse(6, const_cast<char**>(pattern_argv));
+        ASSERT_TRUE(false);  // Should throw
+    } catch (const ArgumentError& e) {
+        std::string error_msg = e.what();
+        ASSERT_TRUE(error_msg.find("Invalid victim pattern") != std::string::npos);
+    }
+    
+    const char* schemata_argv[] = {"test", "--contention", "--threads", "2", "--resctrl-victim", "MB:0"};
+    try {
+        parser.parse(6, const_cast<char**>(schemata_argv));
+        ASSERT_TRUE(false);  // Should throw
+    } catch (const ArgumentError& e) {
+        std::string error_msg = e.what();
+        ASSERT_TRUE(error_msg.find("Invalid resctrl schemata") != std::string::npos);
+    }
+    
+    const char* orphan_argv[] = {"test", "--aggressor", "copy"};
+    try {
+        parser.parse(3, const_cast<char**>(orphan_argv));
+        ASSERT_TRUE(false);  // Should throw
+    } catch (const ArgumentError& e) {
+        std::string error_msg = e.what();
+        ASSERT_TRUE(error_msg.find("require --contention") != std::string::npos);
+    }
+    
+    const char* mode_argv[] = {"test", "--contention", "--threads", "2", "--loaded-latency"};
+    try {
+        parser.parse(5, const_cast<char**>(mode_argv));
+        ASSERT_TRUE(false);  // Should throw
+    } catch (const ArgumentError& e) {
+        std::string error_msg = e.what();
+        ASSERT_TRUE(error_msg.find("--contention cannot be combined") != std::string::npos);
+    }
+}
+
+void test_duration_argument() {
+    ArgumentParser parser("test", "Test program");
+    
+    const char* argv[] = {"test", "--duration", "10m", "--sample-interval", "250", "--pattern", "copy"};
+    BenchmarkConfig config = parser.parse(7, const_cast<char**>(argv));
+    TestAssert::assert_equal(std::string("10m"), config.duration_str);
+    TestAssert::assert_equal(std::string("250"), config.sample_interval_str);
+    
+    const char* bad_argv[] = {"test", "--duration", "10x"};
+    try {
+        parser.parse(3, const_cast<char**>(bad_argv));
+        ASSERT_TRUE(false);  // Should throw
+    } catch (const ArgumentError& e) {
+        std::string error_msg = e.what();
+        ASSERT_TRUE(error_msg.find("Invalid duration") != std::string::npos);
+    }
+    
+    const char* interval_argv[] = {"test", "--sample-interval", "500"};
+    try {
+        parser.parse(3, const_cast<char**>(interval_argv));
+        ASSERT_TRUE(false);  // Should throw
+    } catch (const ArgumentError& e) {
+        std::string error_msg = e.what();
+        ASSERT_TRUE(error_msg.find("--sample-interval requires --duration") != std::string::npos);
+    }
+    
+    const char* iterations_argv[] = {"test", "--duration", "1h", "--iterations", "5"};
+    try {
+        parser.parse(5, const_cast<char**>(iterations_argv));
+        ASSERT_TRUE(false);  // Should throw
+    } catch (const ArgumentError& e) {
+        std::string error_msg = e.what();
+        ASSERT_TRUE(error_msg.find("--duration and --iterations are mutually exclusive") != std::string::npos);
+    }
+    
+    const char* pattern_argv[] = {"test", "--duration", "1h", "--pattern", "triad"};
+    try {
+        parser.parse(5, const_cast<char**>(pattern_argv));
+        ASSERT_TRUE(false);  // Should throw
+    } catch (const ArgumentError& e) {
+        std::string error_msg = e.what();
+        ASSERT_TRUE(error_msg.find("Invalid soak pattern") != std::string::npos);
+    }
+    
+    const char* mode_argv[] = {"test", "--duration", "1h", "--roofline"};
+    try {
+        parser.parse(4, const_cast<char**>(mode_argv));
+        ASSERT_TRUE(false);  // Should throw
+    } catch (const ArgumentError& e) {
+        std::string error_msg = e.what();
+        ASSERT_TRUE(error_msg.find("--duration cannot be combined") != std::string::npos);
+    }
+}
+
+void test_time_budget_argument() {
+    ArgumentParser parser("test", "Test program");
+    
+    const char* argv[] = {"test", "--cache-hierarchy", "--time-budget", "0.5"};
+    BenchmarkConfig config = parser.parse(4, const_cast<char**>(argv));
+    
+    ASSERT_TRUE(config.time_budget_set);
+    ASSERT_FALSE(config.iterations_set);
+    ASSERT_TRUE(config.time_budget_seconds == 0.5);
+    
+    const char* invalid_argv[] = {"test", "--time-budget", "0"};
+    try {
+        parser.parse(3, const_cast<char**>(invalid_argv));
+        ASSERT_TRUE(false);  // Should throw
+    } catch (const ArgumentError& e) {
+        std::string error_msg = e.what();
+        ASSERT_TRUE(error_msg.find("greater than 0") != std::string::npos);
+    }
+}
+
+void test_time_budget_with_iterations() {
+    ArgumentParser parser("test", "Test program");
+    
+    const char* argv[] = {"test", "--iterations", "5", "--time-budget", "2"};
+    try {
+        parser.parse(5, const_cast<char**>(argv));
+        ASSERT_TRUE(false);  // Should throw
+    } catch (const ArgumentError& e) {
+        std::string error_msg = e.what();
+        ASSERT_TRUE(error_msg.find("mutually exclusive") != std::string::npos);
+    }
+}
+
+void test_chase_argument() {
+    ArgumentParser parser("test", "Test program");
+    
+    const char* argv[] = {"test", "--pattern", "latency_chase", "--chase=stride:128"};
+    BenchmarkConfig config = parser.parse(4, const_cast<char**>(argv));
+    
+    TestAssert::assert_equal(std::string("latency_chase"), config.pattern_str);
+    TestAssert::assert_equal(std::string("stride:128"), config.chase_str);
+}
+
+void test_invalid_chase() {
+    ArgumentParser parser("test", "Test program");
+    
+    const char* argv[] = {"test", "--chase", "zigzag"};
+    
+    try {
+        parser.parse(3, const_cast<char**>(argv));
+        ASSERT_TRUE(false);  // Should throw
+    } catch (const ArgumentError& e) {
+        std::string error_msg = e.what();
+        ASSERT_TRUE(error_msg.find("Invalid chase mode") != std::string::npos);
+    }
+}
+
+void test_pages_argument() {
+    ArgumentParser parser("test", "Test program");
+    
+    const char* argv[] = {"test", "--pages", "thp"};
+    BenchmarkConfig config = parser.parse(3, const_cast<char**>(argv));
+    
+    TestAssert::assert_equal(std::string("thp"), config.pages_str);
+}
+
+void test_invalid_pages() {
+    ArgumentParser parser("test", "Test program");
+    
+    const char* argv[] = {"test", "--pages", "64k"};
+    
+    try {
+        parser.parse(3, const_cast<char**>(argv));
+        ASSERT_TRUE(false);  // Should throw
+    } catch (const ArgumentError& e) {
+        std::string error_msg = e.what();
+        ASSERT_TRUE(error_msg.find("Invalid page size") != std::string::npos);
+    }
+}
+
+void test_invalid_kernel() {
+    ArgumentParser parser("test", "Test program");
+    
+    const char* argv[] = {"test", "--kernel", "mmx"};
+    
+    try {
+        parser.parse(3, const_cast<char**>(argv));
+        ASSERT_TRUE(false);  // Should throw
+    } catch (const ArgumentError& e) {
+        // Expected
+        std::string error_msg = e.what();
+        ASSERT_TRUE(error_msg.find("Invalid kernel") != std::string::npos);
+    }
+}
+
 void test_cache_hierarchy_mode() {
     ArgumentParser parser("test", "Test program");
     
@@ -158,6 +1368,55 @@ int main() {
     TEST_CASE("Threads argument", test_threads_argument);
     TEST_CASE("Pattern argument", test_pattern_argument);
     TEST_CASE("Format argument", test_format_argument);
+    TEST_CASE("Kernel argument", test_kernel_argument);
+    TEST_CASE("Inline value argument", test_inline_value_argument);
+    TEST_CASE("Invalid kernel", test_invalid_kernel);
+    TEST_CASE("Stores argument", test_stores_argument);
+    TEST_CASE("Invalid stores", test_invalid_stores);
+    TEST_CASE("Precision argument", test_precision_argument);
+    TEST_CASE("Invalid precision", test_invalid_precision);
+    TEST_CASE("NUMA matrix argument", test_numa_matrix_argument);
+    TEST_CASE("Chase argument", test_chase_argument);
+    TEST_CASE("Invalid chase", test_invalid_chase);
+    TEST_CASE("Pages argument", test_pages_argument);
+    TEST_CASE("Invalid pages", test_invalid_pages);
+    TEST_CASE("NUMA matrix excludes cache hierarchy", test_numa_matrix_cache_hierarchy_exclusive);
+    TEST_CASE("Loaded latency argument", test_loaded_latency_argument);
+    TEST_CASE("Loaded latency invalid pattern", test_loaded_latency_invalid_pattern);
+    TEST_CASE("Roofline argument", test_roofline_argument);
+    TEST_CASE("Roofline conflicts", test_roofline_conflicts);
+    TEST_CASE("Sweep argument", test_sweep_argument);
+    TEST_CASE("Counters argument", test_counters_argument);
+    TEST_CASE("Energy argument", test_energy_argument);
+    TEST_CASE("Cold argument", test_cold_argument);
+    TEST_CASE("NDJSON argument", test_ndjson_argument);
+    TEST_CASE("Baseline arguments", test_baseline_arguments);
+    TEST_CASE("Calibrate arguments", test_calibrate_arguments);
+    TEST_CASE("System cache argument", test_system_cache_argument);
+    TEST_CASE("File backing arguments", test_file_backing_arguments);
+    TEST_CASE("I/O arguments", test_io_arguments);
+    TEST_CASE("Trace arguments", test_trace_arguments);
+    TEST_CASE("Allocator arguments", test_allocator_arguments);
+    TEST_CASE("Mapping arguments", test_mapping_arguments);
+    TEST_CASE("TLB arguments", test_tlb_arguments);
+    TEST_CASE("Ring arguments", test_ring_arguments);
+    TEST_CASE("Memcpy arguments", test_memcpy_arguments);
+    TEST_CASE("Tier arguments", test_tier_arguments);
+    TEST_CASE("GPU arguments", test_gpu_arguments);
+    TEST_CASE("Fleet arguments", test_fleet_arguments);
+    TEST_CASE("Decode arguments", test_decode_arguments);
+    TEST_CASE("Proxy arguments", test_proxy_arguments);
+    TEST_CASE("Irregular arguments", test_irregular_arguments);
+    TEST_CASE("Streams arguments", test_streams_arguments);
+    TEST_CASE("Sparse access arguments", test_sparse_access_arguments);
+    TEST_CASE("Prefetch arguments", test_prefetch_arguments);
+    TEST_CASE("Core-to-core arguments", test_core_to_core_arguments);
+    TEST_CASE("Atomics argument", test_atomics_argument);
+    TEST_CASE("Contention argument", test_contention_argument);
+    TEST_CASE("Duration argument", test_duration_argument);
+    TEST_CASE("Thread sweep arguments", test_thread_sweep_arguments);
+    TEST_CASE("Time budget argument", test_time_budget_argument);
+    TEST_CASE("Time budget with iterations", test_time_budget_with_iterations);
     TEST_CASE("Cache hierarchy mode", test_cache_hierarchy_mode);
     TEST_CASE("Invalid argument", test_invalid_argument);
     TEST_CASE("Missing value", test_missing_value);
@@ -0,0 +1,110 @@
+#include "test_framework.h"
+#include "../common/atomic_tests.h"
+#include "../common/errors.h"
+#include <algorithm>
+#include <mutex>
+#include <string>
+#include <vector>
+
+using AtomicTests::Implementation;
+using AtomicTests::Operation;
+using AtomicTests::Ordering;
+using AtomicTests::Sharing;
+
+void test_every_configuration_counts_exactly() {
+    // Two unpinned threads on one CPU still interleave their read-modify-writes on the shared line
+    for (Implementation impl : AtomicTests::supported_implementations()) {
+        for (Operation op : {Operation::FETCH_ADD, Operation::CAS_LOOP}) {
+            for (Ordering ordering : {Ordering::RELAXED, Ordering::SEQ_CST}) {
+                for (Sharing sharing : {Sharing::SHARED, Sharing::PRIVATE}) {
+                    AtomicTests::Config config;
+                    config.op = op;
+                    config.ordering = ordering;
+                    config.sharing = sharing;
+                    config.impl = impl;
+                    config.ops_per_thread = 20000;
+                    AtomicTests::Result result = AtomicTests::run(config, {0, 1}, nullptr);
+                    TestAssert::assert_equal_size_t(2, result.num_threads);
+                    ASSERT_TRUE(result.verified);
+                    ASSERT_TRUE(result.total_mops > 0.0 && result.ns_per_op > 0.0);
+                }
+            }
+        }
+    }
+}
+
+void test_run_pins_each_thread() {
+    std::vector<size_t> pinned;
+    std::mutex mutex;
+    CoherenceTests::PinFunction pin = [&](size_t cpu) {
+        std::lock_guard<std::mutex> lock(mutex);
+        pinned.push_back(cpu);
+    };
+    AtomicTests::Config config;
+    config.ops_per_thread = 100;
+    AtomicTests::run(config, {4, 2, 9}, pin);
+    std::sort(pinned.begin(), pinned.end());
+    ASSERT_TRUE(pinned == std::vector<size_t>({2, 4, 9}));
+}
+
+void test_run_rejects_no_threads() {
+    AtomicTests::Config config;
+    config.ops_per_thread = 100;
+    try {
+        AtomicTests::run(config, {}, nullptr);
+        ASSERT_TRUE(false);  // Should throw
+    } catch (const ConfigurationError& e) {
+        std::string error_msg = e.what();
+        ASSERT_TRUE(error_msg.find("at least one thread") != std::string::npos);
+    }
+}
+
+void test_implementations() {
+    std::vector<Implementation> impls = AtomicTests::supported_implementations();
+    ASSERT_TRUE(!impls.empty() && impls[0] == Implementation::STD);
+#if !defined(__aarch64__)
+    TestAssert::assert_equal_size_t(1, impls.size());
+    AtomicTests::Config config;
+    config.impl = Implementation::LLSC;
+    config.ops_per_thread = 10;
+    try {
+        AtomicTests::run(config, {0}, nullptr);
+        ASSERT_TRUE(false);  // Should throw
+    } catch (const ConfigurationError& e) {
+        std::string error_msg = e.what();
+        ASSERT_TRUE(error_msg.find("'llsc' is not supported") != std::string::npos);
+    }
+#endif
+    ASSERT_FALSE(AtomicTests::describe_std_atomics().empty());
+}
+
+void test_names() {
+    TestAssert::assert_equal(std::string("fetch_add"), AtomicTests::operation_to_string(Operation::FETCH_ADD));
+    TestAssert::assert_equal(std::string("cas_loop"), AtomicTests::operation_to_string(Operation::CAS_LOOP));
+    TestAssert::assert_equal(std::string("relaxed"), AtomicTests::ordering_to_string(Ordering::RELAXED));
+    TestAssert::assert_equal(std::string("seq_cst"), AtomicTests::ordering_to_string(Ordering::SEQ_CST));
+    TestAssert::assert_equal(std::string("shared"), AtomicTests::sharing_to_string(Sharing::SHARED));
+    TestAssert::assert_equal(std::string("private"), AtomicTests::sharing_to_string(Sharing::PRIVATE));
+    TestAssert::assert_equal(std::string("lse"), AtomicTests::implementation_to_string(Implementation::LSE));
+    TestAssert::assert_equal(std::string("llsc"), AtomicTests::implementation_to_string(Implementation::LLSC));
+}
+
+void test_thread_counts() {
+    ASSERT_TRUE(AtomicTests::thread_counts(1) == std::vector<size_t>({1}));
+    ASSERT_TRUE(AtomicTests::thread_counts(8) == std::vector<size_t>({1, 2, 4, 8}));
+    ASSERT_TRUE(AtomicTests::thread_counts(12) == std::vector<size_t>({1, 2, 4, 8, 12}));
+    ASSERT_TRUE(AtomicTests::thread_counts(0).empty());
+}
+
+int main() {
+    TestFramework framework;
+
+    TEST_CASE("Every configuration counts exactly", test_every_configuration_counts_exactly);
+    TEST_CASE("Run pins each thread", test_run_pins_each_thread);
+    TEST_CASE("Run rejects no threads", test_run_rejects_no_threads);
+    TEST_CASE("Supported implementations", test_implementations);
+    TEST_CASE("Names", test_names);
+    TEST_CASE("Thread counts", test_thread_counts);
+
+    return framework.run_all();
+}
@@ -0,0 +1,231 @@
+#include "test_framework.h"
+#include "../common/baseline.h"
+#include "../common/errors.h"
+#include "../common/output_formatter.h"
+#include <cstdio>
+#include <fstream>
+#include <string>
+#include <unistd.h>
+#include <vector>
+
+using Baseline::Entry;
+using Baseline::Verdict;
+
+namespace {
+
+Entry entry(const std::string& test_name, const std::vector<double>& samples) {
+    Entry e;
+    e.test_name = test_name;
+    e.working_set = "1GB";
+    e.kernel = "avx2";
+    e.store_policy = "-";
+    e.threads = 4;
+    e.samples = samples;
+    e.bandwidth_gbps = samples.empty() ? 0.0 : samples.front();
+    return e;
+}
+
+// n samples around value, spread by +-1%
+std::vector<double> around(double value, size_t n) {
+    std::vector<double> samples;
+    for (size_t i = 0; i < n; ++i) {
+        samples.push_back(value * (0.99 + 0.02 * static_cast<double>(i) / static_cast<double>(n - 1)));
+    }
+    return samples;
+}
+
+Baseline::HostBaseline host(const std::string& hostname, size_t channels, const std::string& kernel) {
+    Baseline::HostBaseline h;
+    h.host.hostname = hostname;
+    h.host.cpu_name = "Test CPU";
+    h.host.memory_type = "DDR5";
+    h.host.memory_speed_mtps = 4800;
+    h.host.memory_channels = channels;
+    h.host.os_release = kernel;
+    h.pages = "default";
+    h.host_key = Baseline::host_key(h.host, h.pages);
+    h.recorded = "2026-01-31T12:00:00.000Z";
+    return h;
+}
+
+std::string temporary_path() {
+    char path_template[] = "/tmp/baseline_XXXXXX";
+    int fd = mkstemp(path_template);
+    close(fd);
+    std::remove(path_template);  // load treats a missing file as an empty store
+    return path_template;
+}
+
+}  // namespace
+
+void test_mann_whitney() {
+    // Fully separated sets of 10: U = 0, p well below 0.01
+    Baseline::MannWhitney separated = Baseline::mann_whitney(around(50.0, 10), around(100.0, 10));
+    ASSERT_TRUE(separated.u == 0.0);
+    ASSERT_TRUE(separated.z < -3.0);
+    ASSERT_TRUE(separated.p_value < 0.001);
+
+    // Interleaved sets are not significant
+    Baseline::MannWhitney mixed = Baseline::mann_whitney({1, 3, 5, 7, 9}, {2, 4, 6, 8, 10});
+    ASSERT_TRUE(mixed.p_value > 0.5);
+
+    // Identical samples: no variance, nothing to test
+    ASSERT_TRUE(Baseline::mann_whitney({5, 5, 5}, {5, 5, 5}).p_value == 1.0);
+    ASSERT_TRUE(Baseline::mann_whitney({}, {1, 2}).p_value == 1.0);
+}
+
+void test_compare_verdicts() {
+    Entry base = entry("Copy", around(100.0, 20));
+
+    Baseline::Comparison regressed = Baseline::compare(&base, entry("Copy", around(85.0, 20)));
+    ASSERT_TRUE(regressed.verdict == Verdict::REGRESSED);
+    ASSERT_TRUE(regressed.tested && regressed.p_value < 0.01);
+    ASSERT_TRUE(regressed.change_percent < -14.9 && regressed.change_percent > -15.1);
+
+    ASSERT_TRUE(Baseline::compare(&base, entry("Copy", around(115.0, 20))).verdict == Verdict::IMPROVED);
+    // 2% is significant with these tight samples but below the threshold
+    ASSERT_TRUE(Baseline::compare(&base, entry("Copy", around(98.0, 20))).verdict == Verdict::UNCHANGED);
+    ASSERT_TRUE(Baseline::compare(nullptr, entry("Copy", around(98.0, 20))).verdict == Verdict::NEW);
+
+    // Too few samples to test: a large drop is inconclusive, a small one unchanged
+    Entry few_base = entry("Copy", {100.0, 101.0, 102.0, 103.0, 104.0});
+    Baseline::Comparison few = Baseline::compare(&few_base, entry("Copy", {80.0, 81.0, 82.0, 83.0, 84.0}));
+    ASSERT_FALSE(few.tested);
+    ASSERT_TRUE(few.verdict == Verdict::INCONCLUSIVE);
+    ASSERT_TRUE(Baseline::compare(&few_base, entry("Copy", {99.0, 100.0})).verdict == Verdict::UNCHANGED);
+    TestAssert::assert_equal_size_t(0, Baseline::count({few}, Verdict::REGRESSED));
+
+    // The fewest samples that can reach p < 0.01: fully separated sets of BASELINE_MIN_SAMPLES
+    Entry least_base = entry("Copy", around(100.0, 6));
+    Baseline::Comparison least = Baseline::compare(&least_base, entry("Copy", around(85.0, 6)));
+    ASSERT_TRUE(least.tested && least.p_value < 0.01);
+    ASSERT_TRUE(least.verdict == Verdict::REGRESSED);
+}
+
+void test_compare_all() {
+    Baseline::HostBaseline stored = host("node-1", 8, "6.1");
+    stored.entries = {entry("Copy", around(100.0, 10)), entry("Triad", around(90.0, 10))};
+
+    Entry other_threads = entry("Copy", around(50.0, 10));
+    other_threads.threads = 8;  // Not the same result as the stored 4-thread copy
+    std::vector<Baseline::Comparison> comparisons =
+        Baseline::compare_all(stored, {entry("Copy", around(50.0, 10)), other_threads});
+    TestAssert::assert_equal_size_t(2, comparisons.size());
+    ASSERT_TRUE(comparisons[0].verdict == Verdict::REGRESSED);
+    ASSERT_TRUE(comparisons[1].verdict == Verdict::NEW);
+    TestAssert::assert_equal_size_t(1, Baseline::count(comparisons, Verdict::REGRESSED));
+}
+
+void test_find_match() {
+    Baseline::Store store;
+    Baseline::upsert(store, host("node-1", 8, "6.1"));
+    Baseline::upsert(store, host("node-2", 8, "6.5"));
+    std::vector<std::string> differences;
+
+    // The key is the configuration, not the machine: an identical host shares the baseline
+    Baseline::HostBaseline same = host("node-3", 8, "6.1");
+    ASSERT_TRUE(Baseline::find_match(store, same, differences) == &store.hosts[0]);
+    TestAssert::assert_equal_size_t(1, differences.size());
+    TestAssert::assert_equal(std::string("hostname: node-1 -> node-3"), differences[0]);
+
+    // A DIMM in the wrong slot changes the key; the same hostname is found and the change reported
+    Baseline::HostBaseline halved = host("node-2", 4, "6.5");
+    ASSERT_TRUE(Baseline::find_match(store, halved, differences) == &store.hosts[1]);
+    TestAssert::assert_equal_size_t(1, differences.size());
+    TestAssert::assert_equal(std::string("memory_channels: 8 -> 4"), differences[0]);
+
+    Baseline::HostBaseline unknown = host("node-9", 8, "6.8");
+    unknown.host.cpu_name = "Other CPU";
+    unknown.host_key = Baseline::host_key(unknown.host, unknown.pages);
+    ASSERT_TRUE(Baseline::find_match(store, unknown, differences) == nullptr);
+}
+
+void test_upsert_replaces_same_key() {
+    Baseline::Store store;
+    Baseline::HostBaseline first = host("node-1", 8, "6.1");
+    first.entries = {entry("Copy", {1.0})};
+    Baseline::upsert(store, first);
+    Baseline::HostBaseline second = host("node-1", 8, "6.1");
+    second.entries = {entry("Copy", {2.0}), entry("Triad", {3.0})};
+    Baseline::upsert(store, second);
+    Baseline::upsert(store, host("node-1", 8, "6.5"));
+
+    TestAssert::assert_equal_size_t(2, store.hosts.size());
+    TestAssert::assert_equal_size_t(2, store.hosts[0].entries.size());
+}
+
+void test_save_and_load() {
+    std::string path = temporary_path();
+    TestAssert::assert_equal_size_t(0, Baseline::load(path).hosts.size());
+
+    Baseline::Store store;
+    Baseline::HostBaseline stored = host("node-1", 8, "6.1");
+    stored.entries = {entry("Copy \"fast\"", {100.5, 99.25, 101.0}), entry("Triad", {})};
+    Baseline::upsert(store, stored);
+    Baseline::upsert(store, host("node-2", 12, "6.8"));
+    Baseline::save(path, store);
+
+    Baseline::Store loaded = Baseline::load(path);
+    TestAssert::assert_equal_size_t(2, loaded.hosts.size());
+    const Baseline::HostBaseline& first = loaded.hosts[0];
+    TestAssert::assert_equal(stored.host_key, first.host_key);
+    TestAssert::assert_equal(std::string("node-1"), first.host.hostname);
+    TestAssert::assert_equal_size_t(8, first.host.memory_channels);
+    TestAssert::assert_equal(std::string("2026-01-31T12:00:00.000Z"), first.recorded);
+    TestAssert::assert_equal_size_t(2, first.entries.size());
+    TestAssert::assert_equal(std::string("Copy \"fast\""), first.entries[0].test_name);
+    TestAssert::assert_equal(stored.entries[0].key(), first.entries[0].key());
+    TestAssert::assert_equal_size_t(3, first.entries[0].samples.size());
+    ASSERT_TRUE(first.entries[0].samples[1] == 99.25);
+    TestAssert::assert_equal_size_t(12, loaded.hosts[1].host.memory_channels);
+    std::remove(path.c_str());
+}
+
+void test_load_rejects_bad_files() {
+    std::string path = temporary_path();
+    for (const char* text : {"{\"hosts\": [", "{\"results\": []}", "{\"baseline_version\": 99, \"hosts\": []}"}) {
+        {
+            std::ofstream file(path);
+            file << text;
+        }
+        try {
+            Baseline::load(path);
+            ASSERT_TRUE(false);  // Should throw
+        } catch (const ConfigurationError& e) {
+            std::string error_msg = e.what();
+            ASSERT_TRUE(error_msg.find("Baseline " + path) != std::string::npos);
+        }
+    }
+    std::remove(path.c_str());
+}
+
+void test_entry_from_result() {
+    TestResult result;
+    result.test_name = "Sequential Read";
+    result.working_set_desc = "L2 (1MB per thread)";
+    result.kernel_name = "avx512";
+    result.store_policy = "-";
+    result.num_threads = 2;
+    result.stats = {42.0, 1.0, 1024, 0.1};
+    result.bandwidth_samples = {41.0, 42.0, 43.0};
+
+    Entry e = Baseline::entry_from(result);
+    TestAssert::assert_equal(std::string("Sequential Read|L2 (1MB per thread)|avx512|-|2"), e.key());
+    ASSERT_TRUE(e.bandwidth_gbps == 42.0);
+    TestAssert::assert_equal_size_t(3, e.samples.size());
+}
+
+int main() {
+    TestFramework framework;
+
+    TEST_CASE("Mann-Whitney U", test_mann_whitney);
+    TEST_CASE("Compare verdicts", test_compare_verdicts);
+    TEST_CASE("Compare all results", test_compare_all);
+    TEST_CASE("Find matching host", test_find_match);
+    TEST_CASE("Upsert replaces same key", test_upsert_replaces_same_key);
+    TEST_CASE("Save and load", test_save_and_load);
+    TEST_CASE("Load rejects bad files", test_load_rejects_bad_files);
+    TEST_CASE("Entry from result", test_entry_from_result);
+
+    return framework.run_all();
+}
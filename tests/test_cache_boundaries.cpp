@@ -0,0 +1,104 @@
+#include "test_framework.h"
+#include "../common/cache_boundaries.h"
+#include <vector>
+
+using CacheBoundaries::Curve;
+
+namespace {
+
+// 4KB to 64MB, two steps per octave
+std::vector<size_t> ladder() {
+    std::vector<size_t> sizes;
+    for (size_t size = 4096; size <= 64 * 1024 * 1024; size *= 2) {
+        sizes.push_back(size);
+        sizes.push_back(size + size / 2);
+    }
+    return sizes;
+}
+
+// Three plateaus with a one-step transition after 32KB and 1MB
+double latency_at(size_t size) {
+    if (size <= 32 * 1024) return 1.0;
+    if (size <= 48 * 1024) return 2.5;
+    if (size <= 1024 * 1024) return 4.0;
+    if (size <= 1536 * 1024) return 20.0;
+    return 80.0;
+}
+
+}  // namespace
+
+void test_latency_knees() {
+    std::vector<size_t> sizes = ladder();
+    std::vector<double> latency;
+    for (size_t size : sizes) {
+        latency.push_back(latency_at(size));
+    }
+
+    std::vector<CacheBoundaries::Knee> knees = CacheBoundaries::detect_knees(sizes, latency, Curve::LATENCY);
+
+    TestAssert::assert_equal_size_t(2, knees.size());
+    TestAssert::assert_equal_size_t(32 * 1024, knees[0].capacity_bytes);
+    ASSERT_TRUE(knees[0].before == 1.0);
+    ASSERT_TRUE(knees[0].after == 4.0);
+    TestAssert::assert_equal_size_t(1024 * 1024, knees[1].capacity_bytes);
+    ASSERT_TRUE(knees[1].after == 80.0);
+}
+
+void test_bandwidth_knees_ignore_noise() {
+    std::vector<size_t> sizes = ladder();
+    std::vector<double> bandwidth;
+    for (size_t i = 0; i < sizes.size(); ++i) {
+        double noise = (i % 2 == 0) ? 1.05 : 0.95;  // +-5% stays on the plateau
+        bandwidth.push_back(100.0 / latency_at(sizes[i]) * noise);
+    }
+
+    std::vector<CacheBoundaries::Knee> knees = CacheBoundaries::detect_knees(sizes, bandwidth, Curve::BANDWIDTH);
+
+    TestAssert::assert_equal_size_t(2, knees.size());
+    TestAssert::assert_equal_size_t(32 * 1024, knees[0].capacity_bytes);
+    ASSERT_TRUE(knees[0].before > 90.0 && knees[0].before < 110.0);
+}
+
+void test_flat_curve_has_no_knees() {
+    std::vector<size_t> sizes = ladder();
+    std::vector<double> flat(sizes.size(), 10.0);
+    flat[3] = 0.0;  // Failed point is skipped
+
+    ASSERT_TRUE(CacheBoundaries::detect_knees(sizes, flat, Curve::BANDWIDTH).empty());
+    ASSERT_TRUE(CacheBoundaries::detect_knees({}, {}, Curve::LATENCY).empty());
+}
+
+void test_match_levels() {
+    CacheInfo cache = {};
+    cache.l1_data_size = 48 * 1024;
+    cache.l2_size = 2 * 1024 * 1024;
+    cache.l3_size = 0;  // Undetected level is not reported
+
+    std::vector<CacheBoundaries::Knee> bandwidth = {{32 * 1024, 100.0, 50.0}, {1024 * 1024, 50.0, 10.0}};
+    std::vector<CacheBoundaries::Knee> latency = {{32 * 1024, 1.0, 4.0}, {256 * 1024 * 1024, 80.0, 120.0}};
+
+    std::vector<CacheBoundaries::EffectiveCapacity> capacities =
+        CacheBoundaries::match_levels(cache, bandwidth, latency);
+
+    TestAssert::assert_equal_size_t(3, capacities.size());
+    TestAssert::assert_equal(std::string("L1"), capacities[0].level);
+    TestAssert::assert_equal_size_t(32 * 1024, capacities[0].bandwidth_bytes);
+    TestAssert::assert_equal_size_t(32 * 1024, capacities[0].latency_bytes);
+    TestAssert::assert_equal(std::string("L2"), capacities[1].level);
+    TestAssert::assert_equal_size_t(1024 * 1024, capacities[1].bandwidth_bytes);
+    TestAssert::assert_equal_size_t(0, capacities[1].latency_bytes);  // 256MB is far from 2MB
+
+    TestAssert::assert_equal(std::string("unattributed"), capacities[2].level);
+    TestAssert::assert_equal_size_t(256 * 1024 * 1024, capacities[2].latency_bytes);
+}
+
+int main() {
+    TestFramework framework;
+
+    TEST_CASE("Latency knees", test_latency_knees);
+    TEST_CASE("Bandwidth knees ignore noise", test_bandwidth_knees_ignore_noise);
+    TEST_CASE("Flat curve has no knees", test_flat_curve_has_no_knees);
+    TEST_CASE("Match levels", test_match_levels);
+
+    return framework.run_all();
+}
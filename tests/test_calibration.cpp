@@ -0,0 +1,107 @@
+#include "test_framework.h"
+#include "../common/calibration.h"
+#include <cmath>
+#include <vector>
+
+namespace {
+
+// 1 ms and 1 MB per iteration, bandwidth cycling through the given values
+struct FakeKernel {
+    std::vector<double> bandwidths = {10.0};
+    std::vector<size_t> calls;
+
+    PerformanceStats operator()(size_t iterations) {
+        calls.push_back(iterations);
+        double bandwidth = bandwidths[(calls.size() - 1) % bandwidths.size()];
+        PerformanceStats stats{};
+        stats.time_seconds = iterations * 1e-3;
+        stats.bytes_processed = iterations * 1000000;
+        stats.bandwidth_gbps = bandwidth;
+        return stats;
+    }
+};
+
+}  // namespace
+
+void test_confidence_interval() {
+    ASSERT_TRUE(std::isinf(Calibration::confidence_interval_percent({5.0})));
+    ASSERT_TRUE(Calibration::confidence_interval_percent({5.0, 5.0, 5.0}) == 0.0);
+
+    // mean 10, stddev 2 / sqrt(3), n = 4, t = 3.182
+    double ci = Calibration::confidence_interval_percent({9.0, 11.0, 9.0, 11.0});
+    ASSERT_TRUE(std::abs(ci - 100.0 * 3.182 * (2.0 / std::sqrt(3.0)) / 2.0 / 10.0) < 1e-9);
+}
+
+void test_doubles_until_target() {
+    FakeKernel kernel;
+    Calibration::Settings settings;
+    settings.target_sample_seconds = 0.05;
+
+    Calibration::Result result = Calibration::measure(std::ref(kernel), settings);
+
+    // 1, 2, ... 32 ms are too short; 64 ms is the first long enough run
+    TestAssert::assert_equal_size_t(64, result.iterations);
+    TestAssert::assert_equal_size_t(1, kernel.calls[0]);
+    TestAssert::assert_equal_size_t(64, kernel.calls[6]);
+    ASSERT_TRUE(result.converged);
+    TestAssert::assert_equal_size_t(settings.min_repetitions, result.repetitions);
+    ASSERT_TRUE(result.ci_percent == 0.0);
+}
+
+void test_reports_median_repetition() {
+    FakeKernel kernel;
+    kernel.bandwidths = {10.0, 30.0, 20.0};  // Calibration run (single iteration) sees 10
+    Calibration::Settings settings;
+    settings.target_sample_seconds = 0.0;
+    settings.min_repetitions = 3;
+    settings.max_repetitions = 3;
+
+    Calibration::Result result = Calibration::measure(std::ref(kernel), settings);
+
+    TestAssert::assert_equal_size_t(3, result.repetitions);
+    ASSERT_TRUE(result.stats.bandwidth_gbps == 20.0);
+    TestAssert::assert_equal_size_t(2, result.median_call);
+    ASSERT_FALSE(result.converged);  // Spread far wider than 1%
+    ASSERT_TRUE(result.ci_percent > 1.0);
+}
+
+void test_budget_stops_repetitions() {
+    FakeKernel kernel;
+    kernel.bandwidths = {10.0, 20.0};
+    Calibration::Settings settings;
+    settings.target_sample_seconds = 0.0;
+    settings.time_budget_seconds = 0.0;
+
+    Calibration::Result result = Calibration::measure(std::ref(kernel), settings);
+
+    TestAssert::assert_equal_size_t(1, result.repetitions);
+    TestAssert::assert_equal_size_t(1, kernel.calls.size());
+    ASSERT_FALSE(result.converged);
+    ASSERT_TRUE(result.ci_percent == 0.0);  // Unknown with one repetition
+}
+
+void test_empty_run_ends_measurement() {
+    size_t calls = 0;
+    auto empty = [&calls](size_t) {
+        ++calls;
+        return PerformanceStats{};
+    };
+
+    Calibration::Result result = Calibration::measure(empty);
+
+    TestAssert::assert_equal_size_t(1, calls);
+    TestAssert::assert_equal_size_t(1, result.repetitions);
+    TestAssert::assert_equal_size_t(1, result.iterations);
+}
+
+int main() {
+    TestFramework framework;
+
+    TEST_CASE("Confidence interval", test_confidence_interval);
+    TEST_CASE("Doubles until target", test_doubles_until_target);
+    TEST_CASE("Reports median repetition", test_reports_median_repetition);
+    TEST_CASE("Budget stops repetitions", test_budget_stops_repetitions);
+    TEST_CASE("Empty run ends measurement", test_empty_run_ends_measurement);
+
+    return framework.run_all();
+}
@@ -0,0 +1,94 @@
+#include "test_framework.h"
+#include "../common/coherence_tests.h"
+#include "../common/errors.h"
+#include <mutex>
+#include <string>
+#include <vector>
+
+using CoherenceTests::CounterLayout;
+using CoherenceTests::PingPongResult;
+
+void test_ping_pong_unpinned() {
+    // Unpinned threads still exchange the line; on one CPU the waiters yield to each other
+    PingPongResult result = CoherenceTests::measure_ping_pong(0, 1, 50, 2, nullptr);
+    TestAssert::assert_equal_size_t(0, result.cpu_a);
+    TestAssert::assert_equal_size_t(1, result.cpu_b);
+    TestAssert::assert_equal_size_t(50, result.round_trips);
+    ASSERT_TRUE(result.one_way_ns > 0.0);
+    ASSERT_TRUE(result.min_one_way_ns > 0.0 && result.min_one_way_ns <= result.one_way_ns);
+
+    PingPongResult empty = CoherenceTests::measure_ping_pong(0, 1, 0, 2, nullptr);
+    ASSERT_TRUE(empty.one_way_ns == 0.0);
+}
+
+void test_core_to_core_matrix() {
+    std::vector<PingPongResult> matrix = CoherenceTests::measure_core_to_core({2, 5}, 10, 1, nullptr);
+    TestAssert::assert_equal_size_t(4, matrix.size());
+    ASSERT_TRUE(matrix[0].cpu_a == 2 && matrix[0].cpu_b == 2 && matrix[0].round_trips == 0);
+    ASSERT_TRUE(matrix[1].cpu_a == 2 && matrix[1].cpu_b == 5 && matrix[1].one_way_ns > 0.0);
+    ASSERT_TRUE(matrix[2].cpu_a == 5 && matrix[2].cpu_b == 2 && matrix[2].one_way_ns > 0.0);
+    ASSERT_TRUE(matrix[3].round_trips == 0);
+}
+
+void test_ping_pong_pins_both_threads() {
+    std::vector<size_t> pinned;
+    std::mutex mutex;
+    CoherenceTests::PinFunction pin = [&](size_t cpu) {
+        std::lock_guard<std::mutex> lock(mutex);
+        pinned.push_back(cpu);
+    };
+    CoherenceTests::measure_ping_pong(3, 7, 10, 1, pin);
+    TestAssert::assert_equal_size_t(2, pinned.size());
+    ASSERT_TRUE((pinned[0] == 3 && pinned[1] == 7) || (pinned[0] == 7 && pinned[1] == 3));
+}
+
+void test_summarize() {
+    std::vector<PingPongResult> matrix(4);
+    matrix[0] = {0, 0, 0.0, 0.0, 0};
+    matrix[1] = {0, 1, 40.0, 38.0, 100};
+    matrix[2] = {1, 0, 120.0, 110.0, 100};
+    matrix[3] = {1, 1, 0.0, 0.0, 0};
+
+    CoherenceTests::MatrixSummary summary = CoherenceTests::summarize(matrix);
+    TestAssert::assert_equal_size_t(2, summary.pairs);
+    ASSERT_TRUE(summary.fastest.cpu_a == 0 && summary.fastest.cpu_b == 1);
+    ASSERT_TRUE(summary.slowest.cpu_a == 1 && summary.slowest.cpu_b == 0);
+    ASSERT_TRUE(summary.median_ns == 80.0);
+
+    TestAssert::assert_equal_size_t(0, CoherenceTests::summarize({}).pairs);
+}
+
+void test_false_sharing_counts() {
+    for (CounterLayout layout : {CounterLayout::PACKED, CounterLayout::PADDED}) {
+        CoherenceTests::FalseSharingResult result = CoherenceTests::measure_false_sharing({0, 1}, 100000, layout,
+                                                                                          nullptr);
+        ASSERT_TRUE(result.layout == layout);
+        TestAssert::assert_equal_size_t(2, result.num_threads);
+        TestAssert::assert_equal_size_t(100000, result.increments_per_thread);
+        ASSERT_TRUE(result.verified);
+        ASSERT_TRUE(result.ns_per_increment > 0.0 && result.total_mops > 0.0);
+    }
+    TestAssert::assert_equal(std::string("packed"), CoherenceTests::layout_to_string(CounterLayout::PACKED));
+    TestAssert::assert_equal(std::string("padded"), CoherenceTests::layout_to_string(CounterLayout::PADDED));
+
+    std::vector<size_t> too_many(CoherenceTests::MAX_PACKED_COUNTERS + 1, 0);
+    try {
+        CoherenceTests::measure_false_sharing(too_many, 10, CounterLayout::PACKED, nullptr);
+        ASSERT_TRUE(false);  // Should throw
+    } catch (const ConfigurationError& e) {
+        std::string error_msg = e.what();
+        ASSERT_TRUE(error_msg.find("False sharing needs 1 to 8 threads") != std::string::npos);
+    }
+}
+
+int main() {
+    TestFramework framework;
+
+    TEST_CASE("Ping-pong without pinning", test_ping_pong_unpinned);
+    TEST_CASE("Core-to-core matrix", test_core_to_core_matrix);
+    TEST_CASE("Ping-pong pins both threads", test_ping_pong_pins_both_threads);
+    TEST_CASE("Summarize matrix", test_summarize);
+    TEST_CASE("False sharing counts", test_false_sharing_counts);
+
+    return framework.run_all();
+}
@@ -0,0 +1,104 @@
+#include "test_framework.h"
+#include "../common/cold_cache.h"
+#include "../common/standard_tests.h"
+#include "../common/constants.h"
+#include "../common/errors.h"
+#include <atomic>
+#include <chrono>
+#include <cstring>
+#include <string>
+#include <vector>
+
+using ColdCache::Method;
+
+void test_parse_methods() {
+    ASSERT_TRUE(ColdCache::parse_method("evict") == Method::EVICT);
+    TestAssert::assert_equal(std::string("flush"), ColdCache::method_to_string(Method::FLUSH));
+    TestAssert::assert_equal(std::string("evict"), ColdCache::method_to_string(Method::EVICT));
+    if (ColdCache::flush_supported()) {
+        ASSERT_TRUE(ColdCache::parse_method("flush") == Method::FLUSH);
+        ASSERT_TRUE(ColdCache::flush_instruction() != "none");
+    }
+
+    for (const char* bad : {"warm", "", "FLUSH"}) {
+        try {
+            ColdCache::parse_method(bad);
+            ASSERT_TRUE(false);  // Should throw
+        } catch (const ArgumentError&) {
+            ASSERT_TRUE(true);
+        }
+    }
+}
+
+void test_eviction_bytes() {
+    CacheInfo cache = {};
+    cache.l2_size = 2 * BenchmarkConstants::MB;
+    cache.l3_size = 32 * BenchmarkConstants::MB;
+    TestAssert::assert_equal_size_t(68 * BenchmarkConstants::MB, ColdCache::eviction_bytes(cache, 1));
+    TestAssert::assert_equal_size_t(12 * BenchmarkConstants::MB, ColdCache::eviction_bytes(cache, 8));
+    TestAssert::assert_equal_size_t(68 * BenchmarkConstants::MB, ColdCache::eviction_bytes(cache, 0));
+    TestAssert::assert_equal_size_t(BenchmarkConstants::COLD_EVICT_FALLBACK_BYTES,
+                                    ColdCache::eviction_bytes(CacheInfo{}, 4));
+
+    // Only the evict method keeps a buffer
+    TestAssert::assert_equal_size_t(0, ColdCache::Evictor(Method::FLUSH, 4096).buffer_bytes());
+    TestAssert::assert_equal_size_t(4096, ColdCache::Evictor(Method::EVICT, 4096).buffer_bytes());
+}
+
+void test_flush_keeps_contents() {
+    std::vector<uint8_t> data(64 * 1024 + 37);
+    for (size_t i = 0; i < data.size(); ++i) {
+        data[i] = static_cast<uint8_t>(i * 7);
+    }
+    std::vector<uint8_t> copy = data;
+    ColdCache::flush_range(data.data() + 3, data.size() - 3);  // Unaligned at both ends
+    ColdCache::flush_range(nullptr, 4096);
+    ColdCache::flush_range(data.data(), 0);
+    ASSERT_TRUE(std::memcmp(data.data(), copy.data(), data.size()) == 0);
+
+    ColdCache::Evictor evictor(Method::FLUSH, 0);
+    evictor.begin();
+    evictor.evict(data.data(), data.size());
+    ASSERT_TRUE(std::memcmp(data.data(), copy.data(), data.size()) == 0);
+}
+
+void test_kernels_leave_evictions_off_the_clock() {
+    const size_t buffer_size = 64 * 1024;
+    const size_t iterations = 20;
+    std::vector<uint8_t> buffer(buffer_size, 1);
+    std::atomic<bool> stop_flag{false};
+
+    // Streaming 32 MB per pass costs far more than reading 64 KB from memory
+    ColdCache::Evictor evictor(Method::EVICT, 32 * BenchmarkConstants::MB);
+    evictor.prepare();
+    auto start = std::chrono::steady_clock::now();
+    auto stats = StandardTests::sequential_read_test(buffer.data(), buffer_size, 0, buffer_size, iterations,
+                                                     stop_flag, true, KernelType::AUTO, nullptr, 0, &evictor);
+    double wall = std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count();
+    ASSERT_TRUE(stats.verified);
+    TestAssert::assert_equal_size_t(buffer_size * iterations, stats.bytes_processed);
+    ASSERT_TRUE(stats.time_seconds > 0.0);
+    ASSERT_TRUE(stats.time_seconds < wall / 2);
+
+    if (ColdCache::flush_supported()) {
+        ColdCache::Evictor flusher(Method::FLUSH, 0);
+        auto chase = StandardTests::latency_chase_test(buffer.data(), buffer_size, 0, buffer_size, 4, stop_flag,
+                                                       PointerChase::ChaseConfig{}, nullptr, &flusher);
+        ASSERT_TRUE(chase.latency_ns > 0.0);
+        std::vector<uint8_t> destination(buffer_size, 0);
+        auto copy = StandardTests::copy_test(buffer.data(), destination.data(), buffer_size, 0, buffer_size, 4,
+                                             stop_flag, KernelType::AUTO, StorePolicy::TEMPORAL, nullptr, &flusher);
+        ASSERT_TRUE(copy.verified && copy.time_seconds > 0.0);
+    }
+}
+
+int main() {
+    TestFramework framework;
+
+    TEST_CASE("Parse methods", test_parse_methods);
+    TEST_CASE("Eviction bytes", test_eviction_bytes);
+    TEST_CASE("Flush keeps contents", test_flush_keeps_contents);
+    TEST_CASE("Kernels leave evictions off the clock", test_kernels_leave_evictions_off_the_clock);
+
+    return framework.run_all();
+}
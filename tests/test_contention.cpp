@@ -0,0 +1,131 @@
+#include "test_framework.h"
+#include "../common/contention.h"
+#include "../common/errors.h"
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <cstdlib>
+#include <string>
+#include <thread>
+#include <vector>
+
+using Contention::Aggressor;
+using Contention::ContentionPoint;
+
+namespace {
+
+ContentionPoint point(size_t aggressor_threads, double victim_latency_ns) {
+    ContentionPoint p;
+    p.aggressor_threads = aggressor_threads;
+    p.victim_latency_ns = victim_latency_ns;
+    return p;
+}
+
+}  // namespace
+
+void test_parse_aggressor() {
+    for (Aggressor aggressor : {Aggressor::SEQUENTIAL_WRITE, Aggressor::SEQUENTIAL_READ, Aggressor::COPY,
+                                Aggressor::RANDOM_READ, Aggressor::ATOMICS}) {
+        ASSERT_TRUE(Contention::parse_aggressor(Contention::aggressor_to_string(aggressor)) == aggressor);
+    }
+
+    try {
+        Contention::parse_aggressor("triad");
+        ASSERT_TRUE(false);  // Should throw
+    } catch (const ArgumentError& e) {
+        std::string error_msg = e.what();
+        ASSERT_TRUE(error_msg.find("Invalid aggressor") != std::string::npos);
+    }
+}
+
+void test_supports_victim() {
+    ASSERT_TRUE(Contention::supports_victim(TestPattern::SEQUENTIAL_READ));
+    ASSERT_TRUE(Contention::supports_victim(TestPattern::COPY));
+    ASSERT_TRUE(Contention::supports_victim(TestPattern::LATENCY_CHASE));
+    ASSERT_FALSE(Contention::supports_victim(TestPattern::TRIAD));
+    ASSERT_FALSE(Contention::supports_victim(TestPattern::MATRIX_MULTIPLY));
+}
+
+void test_annotate() {
+    std::vector<ContentionPoint> points = {point(0, 80.0), point(3, 100.0), point(3, 200.0)};
+    Contention::annotate(points);
+    ASSERT_TRUE(points[0].slowdown == 1.0);
+    ASSERT_TRUE(points[1].slowdown == 1.25);
+    ASSERT_TRUE(points[2].slowdown == 2.5);
+
+    // Without a baseline there is nothing to compare against
+    std::vector<ContentionPoint> idle = {point(0, 0.0), point(1, 50.0)};
+    Contention::annotate(idle);
+    ASSERT_TRUE(idle[1].slowdown == 0.0);
+}
+
+void test_parse_schemata() {
+    TestAssert::assert_equal(std::string("MB:0=20\n"), Contention::parse_schemata("MB:0=20"));
+    TestAssert::assert_equal(std::string("MB:0=30;1=30\nL3:0=f;1=ff0\n"),
+                             Contention::parse_schemata("MB:0=30;1=30,L3:0=f;1=ff0"));
+
+    for (const char* bad : {"", "MB", "MB:", "MB:0", "MB:0=", "MB:x=20", "MB:0=ff", "L3:0=xyz", "XX:0=1",
+                            "MB:0=20,", "MB:0=20;"}) {
+        try {
+            Contention::parse_schemata(bad);
+            ASSERT_TRUE(false);  // Should throw
+        } catch (const ArgumentError& e) {
+            std::string error_msg = e.what();
+            ASSERT_TRUE(error_msg.find("Invalid resctrl schemata") != std::string::npos);
+        }
+    }
+}
+
+void test_run_aggressor() {
+    const size_t buffer_size = 1024 * 1024;
+    uint8_t* src = static_cast<uint8_t*>(std::aligned_alloc(64, buffer_size));
+    uint8_t* dst = static_cast<uint8_t*>(std::aligned_alloc(64, buffer_size));
+    ASSERT_TRUE(src != nullptr && dst != nullptr);
+    std::fill(src, src + buffer_size, 1);
+    std::fill(dst, dst + buffer_size, 0);
+
+    for (Aggressor aggressor : {Aggressor::SEQUENTIAL_WRITE, Aggressor::SEQUENTIAL_READ, Aggressor::COPY,
+                                Aggressor::RANDOM_READ, Aggressor::ATOMICS}) {
+        std::atomic<bool> stop(false);
+        std::thread timer([&stop]() {
+            std::this_thread::sleep_for(std::chrono::milliseconds(20));
+            stop = true;
+        });
+        PerformanceStats stats = Contention::run_aggressor(aggressor, src, dst, buffer_size, 0, buffer_size, 10,
+                                                           stop);
+        timer.join();
+        ASSERT_TRUE(stats.bandwidth_gbps > 0.0);
+        ASSERT_TRUE(stats.bytes_processed > 0);
+
+        // Stopped before it starts, as when the aggressor thread is scheduled late: one chunk still runs
+        std::atomic<bool> stopped(true);
+        stats = Contention::run_aggressor(aggressor, src, dst, buffer_size, 0, buffer_size, 10, stopped);
+        ASSERT_TRUE(stats.bandwidth_gbps > 0.0);
+        ASSERT_TRUE(stats.bytes_processed > 0);
+    }
+
+    std::free(src);
+    std::free(dst);
+}
+
+void test_resctrl_group_without_create() {
+    Contention::ResctrlGroup group;
+    std::string error;
+    ASSERT_FALSE(group.add_thread(Contention::current_thread_id(), error));
+    ASSERT_FALSE(error.empty());
+    TestAssert::assert_equal(std::string(""), group.describe());
+    group.remove();  // No-op before create
+}
+
+int main() {
+    TestFramework framework;
+
+    TEST_CASE("Parse aggressor", test_parse_aggressor);
+    TEST_CASE("Supported victim patterns", test_supports_victim);
+    TEST_CASE("Annotate slowdown", test_annotate);
+    TEST_CASE("Parse resctrl schemata", test_parse_schemata);
+    TEST_CASE("Aggressor loads", test_run_aggressor);
+    TEST_CASE("Resctrl group without create", test_resctrl_group_without_create);
+
+    return framework.run_all();
+}
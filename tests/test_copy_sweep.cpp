@@ -0,0 +1,165 @@
+#include "test_framework.h"
+#include "../common/copy_sweep.h"
+#include "../common/constants.h"
+#include "../common/errors.h"
+#include "../common/simd_kernels.h"
+#include <algorithm>
+#include <string>
+#include <vector>
+
+using CopySweep::Alignment;
+using CopySweep::Operation;
+using CopySweep::Point;
+
+namespace {
+
+Point point(const std::string& implementation, size_t bytes, double gbps) {
+    Point result;
+    result.implementation = implementation;
+    result.bytes = bytes;
+    result.bandwidth_gbps = gbps;
+    result.verified = true;
+    return result;
+}
+
+template <typename Parse>
+void expect_argument_error(Parse parse) {
+    try {
+        parse();
+        ASSERT_TRUE(false);  // Should throw
+    } catch (const ArgumentError&) {
+        ASSERT_TRUE(true);
+    }
+}
+
+}  // namespace
+
+void test_parse_lists() {
+    std::vector<Operation> operations = CopySweep::parse_operations("set,copy,set");
+    TestAssert::assert_equal_size_t(2, operations.size());
+    ASSERT_TRUE(operations[0] == Operation::SET && operations[1] == Operation::COPY);
+    TestAssert::assert_equal(std::string("set"), CopySweep::operation_to_string(Operation::SET));
+
+    std::vector<Alignment> alignments = CopySweep::parse_alignments("0:0,1:63,0:0");
+    TestAssert::assert_equal_size_t(2, alignments.size());
+    TestAssert::assert_equal_size_t(63, alignments[1].destination_offset);
+    TestAssert::assert_equal(std::string("src+1/dst+63"), CopySweep::alignment_to_string(alignments[1]));
+
+    std::pair<size_t, size_t> range = CopySweep::parse_size_range("16-64m");
+    TestAssert::assert_equal_size_t(16, range.first);
+    TestAssert::assert_equal_size_t(64 * BenchmarkConstants::MB, range.second);
+    range = CopySweep::parse_size_range("4k");
+    TestAssert::assert_equal_size_t(4096, range.first);
+    TestAssert::assert_equal_size_t(4096, range.second);
+
+    for (const char* bad : {"", "lol", "copy,move"}) {
+        expect_argument_error([&] { CopySweep::parse_operations(bad); });
+    }
+    for (const char* bad : {"", "1", "64:0", "0:-1", "a:b"}) {
+        expect_argument_error([&] { CopySweep::parse_alignments(bad); });
+    }
+    for (const char* bad : {"", "12-64", "0-64", "64-16", "16-2g", "16-x"}) {
+        expect_argument_error([&] { CopySweep::parse_size_range(bad); });
+    }
+}
+
+void test_parse_implementations() {
+    std::vector<CopySweep::Implementation> all = CopySweep::parse_implementations("all");
+    TestAssert::assert_equal_size_t(CopySweep::default_implementation_names().size(), all.size());
+    TestAssert::assert_equal(std::string("libc"), all.front().name);
+    for (const auto& implementation : all) {
+        ASSERT_TRUE(implementation.copy != nullptr && implementation.set != nullptr);
+        ASSERT_TRUE(implementation.name != "scalar");
+    }
+
+    std::vector<CopySweep::Implementation> listed = CopySweep::parse_implementations("scalar,libc,scalar");
+    TestAssert::assert_equal_size_t(2, listed.size());
+    ASSERT_FALSE(listed[0].nontemporal);
+    if (SimdKernels::is_store_policy_supported(KernelType::SCALAR, StorePolicy::NONTEMPORAL)) {
+        listed = CopySweep::parse_implementations("scalar-nt");
+        ASSERT_TRUE(listed[0].nontemporal);
+    }
+
+    for (const char* bad : {"", "bcopy", "auto", "libc-nt", "-nt"}) {
+        expect_argument_error([&] { CopySweep::parse_implementations(bad); });
+    }
+}
+
+void test_size_ladder() {
+    std::vector<size_t> expected = {16, 24, 32, 48, 64, 96, 128, 192, 256};
+    ASSERT_TRUE(CopySweep::size_ladder(16, 256) == expected);
+    expected = {40, 48, 64, 96, 104};
+    ASSERT_TRUE(CopySweep::size_ladder(40, 104) == expected);
+    expected = {8};
+    ASSERT_TRUE(CopySweep::size_ladder(8, 8) == expected);
+}
+
+void test_crossovers_skip_near_ties() {
+    std::vector<Point> points = {point("libc", 64, 10.0),   point("rep", 64, 4.0),
+                                 point("libc", 128, 20.0),  point("rep", 128, 20.5),   // Within the margin
+                                 point("libc", 256, 25.0),  point("rep", 256, 30.0),
+                                 point("libc", 512, 28.0),  point("rep", 512, 32.0),
+                                 point("libc", 1024, 32.0), point("rep", 1024, 31.0)}; // rep keeps the range
+    Point unverified = point("rep", 2048, 99.0);
+    unverified.verified = false;
+    points.push_back(unverified);
+    points.push_back(point("libc", 2048, 34.0));
+
+    std::vector<CopySweep::Crossover> ranges = CopySweep::crossovers(points);
+    TestAssert::assert_equal_size_t(3, ranges.size());
+    TestAssert::assert_equal(std::string("libc"), ranges[0].implementation);
+    TestAssert::assert_equal_size_t(64, ranges[0].from_bytes);
+    TestAssert::assert_equal_size_t(128, ranges[0].to_bytes);
+    TestAssert::assert_equal(std::string("rep"), ranges[1].implementation);
+    TestAssert::assert_equal_size_t(256, ranges[1].from_bytes);
+    TestAssert::assert_equal_size_t(1024, ranges[1].to_bytes);
+    ASSERT_TRUE(ranges[1].peak_gbps == 32.0);
+    TestAssert::assert_equal(std::string("libc"), ranges[2].implementation);  // rep did not verify at 2 KB
+    TestAssert::assert_equal_size_t(2048, ranges[2].from_bytes);
+
+    // Separate ranges per operation and alignment
+    Point set = point("libc", 64, 1.0);
+    set.operation = Operation::SET;
+    points.push_back(set);
+    ranges = CopySweep::crossovers(points);
+    TestAssert::assert_equal_size_t(4, ranges.size());
+    ASSERT_TRUE(ranges[3].operation == Operation::SET);
+}
+
+void test_every_implementation_copies_exactly() {
+    std::vector<CopySweep::Implementation> implementations = CopySweep::parse_implementations("all,scalar");
+    std::vector<Alignment> alignments = CopySweep::parse_alignments("0:0,1:0,7:13,0:63");
+    std::vector<size_t> sizes = CopySweep::size_ladder(8, 8 * BenchmarkConstants::KB);
+    std::vector<Point> points = CopySweep::run(CopySweep::parse_operations("copy,set"), implementations, alignments,
+                                               sizes, 1, 0, nullptr);
+    ASSERT_FALSE(points.empty());
+    bool nontemporal = false;
+    for (const Point& measured : points) {
+        ASSERT_TRUE(measured.verified);
+        ASSERT_TRUE(measured.ns_per_call > 0.0 && measured.bandwidth_gbps > 0.0);
+        ASSERT_TRUE(measured.calls >= BenchmarkConstants::MEMCPY_MIN_CALLS);
+        if (measured.operation == Operation::SET) {
+            TestAssert::assert_equal_size_t(0, measured.alignment.source_offset);
+        }
+        if (measured.implementation.find("-nt") != std::string::npos) {
+            nontemporal = true;
+            ASSERT_TRUE(measured.bytes >= BenchmarkConstants::MEMCPY_NT_MIN_BYTES);
+        }
+    }
+    bool any_nontemporal = std::any_of(implementations.begin(), implementations.end(),
+                                       [](const CopySweep::Implementation& i) { return i.nontemporal; });
+    ASSERT_TRUE(nontemporal == any_nontemporal);
+    ASSERT_FALSE(CopySweep::crossovers(points).empty());
+}
+
+int main() {
+    TestFramework framework;
+
+    TEST_CASE("Parse lists", test_parse_lists);
+    TEST_CASE("Parse implementations", test_parse_implementations);
+    TEST_CASE("Size ladder", test_size_ladder);
+    TEST_CASE("Crossovers skip near ties", test_crossovers_skip_near_ties);
+    TEST_CASE("Every implementation copies exactly", test_every_implementation_copies_exactly);
+
+    return framework.run_all();
+}
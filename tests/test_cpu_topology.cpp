@@ -0,0 +1,212 @@
+#include "test_framework.h"
+#include "../common/cpu_topology.h"
+#include "../common/errors.h"
+#include <algorithm>
+#include <string>
+#include <vector>
+
+using CpuTopologyUtils::Placement;
+using CpuTopologyUtils::SysfsCpu;
+
+namespace {
+
+SysfsCpu sysfs_cpu(size_t cpu, size_t package_id, size_t core_id, std::vector<size_t> llc_shared = {}) {
+    SysfsCpu entry;
+    entry.cpu = cpu;
+    entry.package_id = package_id;
+    entry.core_id = core_id;
+    entry.llc_shared = llc_shared;
+    return entry;
+}
+
+// Two packages of two SMT-2 cores, Linux numbering: CPUs 0-3 are the first
+// siblings of all cores, 4-7 the second; package 1's core_ids repeat package 0's
+CpuTopology two_socket_smt_topology() {
+    std::vector<SysfsCpu> cpus = {sysfs_cpu(0, 0, 0), sysfs_cpu(1, 0, 1), sysfs_cpu(2, 1, 0), sysfs_cpu(3, 1, 1),
+                                  sysfs_cpu(4, 0, 0), sysfs_cpu(5, 0, 1), sysfs_cpu(6, 1, 0), sysfs_cpu(7, 1, 1)};
+    NumaTopology numa;
+    numa.binding_supported = true;
+    numa.nodes.push_back({0, {0, 1, 4, 5}, 0, {10, 21}, {}});
+    numa.nodes.push_back({1, {2, 3, 6, 7}, 0, {21, 10}, {}});
+    return CpuTopologyUtils::build_topology(cpus, numa);
+}
+
+// One package of four cores split into two LLC domains (CCXs): cores 0-1 and 2-3
+CpuTopology two_ccx_topology() {
+    std::vector<SysfsCpu> cpus = {sysfs_cpu(0, 0, 0, {0, 1}), sysfs_cpu(1, 0, 1, {0, 1}),
+                                  sysfs_cpu(2, 0, 2, {2, 3}), sysfs_cpu(3, 0, 3, {2, 3})};
+    NumaTopology numa;
+    numa.binding_supported = false;
+    return CpuTopologyUtils::build_topology(cpus, numa);
+}
+
+// Alder Lake style: two SMT-2 P-cores (CPUs 0-3) and four E-cores (CPUs 4-7), typed by the perf PMUs
+CpuTopology hybrid_topology() {
+    std::vector<SysfsCpu> cpus = {sysfs_cpu(0, 0, 0), sysfs_cpu(1, 0, 0), sysfs_cpu(2, 0, 4), sysfs_cpu(3, 0, 4),
+                                  sysfs_cpu(4, 0, 8), sysfs_cpu(5, 0, 9), sysfs_cpu(6, 0, 10), sysfs_cpu(7, 0, 11)};
+    for (auto& cpu : cpus) {
+        cpu.core_type = cpu.cpu < 4 ? CPUAffinityType::P_CORES : CPUAffinityType::E_CORES;
+    }
+    return CpuTopologyUtils::build_topology(cpus, NumaTopology{});
+}
+
+}  // namespace
+
+void test_build_topology() {
+    CpuTopology topology = two_socket_smt_topology();
+    ASSERT_TRUE(topology.detected);
+    TestAssert::assert_equal_size_t(2, topology.packages);
+    TestAssert::assert_equal_size_t(2, topology.dies);
+    TestAssert::assert_equal_size_t(2, topology.clusters);  // One per package without LLC information
+    TestAssert::assert_equal_size_t(4, topology.physical_cores);
+    TestAssert::assert_equal_size_t(8, topology.cpus.size());
+
+    const CpuLocation* cpu6 = CpuTopologyUtils::find_cpu(topology, 6);
+    ASSERT_TRUE(cpu6 != nullptr);
+    TestAssert::assert_equal_size_t(1, cpu6->package);
+    TestAssert::assert_equal_size_t(2, cpu6->core);
+    TestAssert::assert_equal_size_t(1, cpu6->smt);
+    TestAssert::assert_equal_size_t(1, cpu6->node);
+    TestAssert::assert_equal_size_t(CpuTopologyUtils::find_cpu(topology, 2)->core, cpu6->core);
+    ASSERT_TRUE(CpuTopologyUtils::find_cpu(topology, 8) == nullptr);
+
+    CpuTopology ccx = two_ccx_topology();
+    TestAssert::assert_equal_size_t(2, ccx.clusters);
+    TestAssert::assert_equal_size_t(1, CpuTopologyUtils::find_cpu(ccx, 3)->cluster);
+}
+
+void test_placement_order() {
+    CpuTopology topology = two_socket_smt_topology();
+    ASSERT_TRUE(CpuTopologyUtils::placement_order(topology, Placement::COMPACT) ==
+                std::vector<size_t>({0, 1, 4, 5, 2, 3, 6, 7}));
+    ASSERT_TRUE(CpuTopologyUtils::placement_order(topology, Placement::SCATTER) ==
+                std::vector<size_t>({0, 2, 1, 3, 4, 6, 5, 7}));
+    ASSERT_TRUE(CpuTopologyUtils::placement_order(topology, Placement::ONE_PER_CORE) ==
+                std::vector<size_t>({0, 1, 2, 3}));
+    ASSERT_TRUE(CpuTopologyUtils::placement_order(topology, Placement::LIST, {5, 1}) ==
+                std::vector<size_t>({5, 1}));
+    ASSERT_TRUE(CpuTopologyUtils::placement_order(topology, Placement::DEFAULT).empty());
+
+    CpuTopology ccx = two_ccx_topology();
+    ASSERT_TRUE(CpuTopologyUtils::placement_order(ccx, Placement::PER_CCX) == std::vector<size_t>({0, 2, 1, 3}));
+    ASSERT_TRUE(CpuTopologyUtils::placement_order(ccx, Placement::COMPACT) == std::vector<size_t>({0, 1, 2, 3}));
+}
+
+void test_parse_placement() {
+    ASSERT_TRUE(CpuTopologyUtils::parse_placement("compact") == Placement::COMPACT);
+    ASSERT_TRUE(CpuTopologyUtils::parse_placement("scatter") == Placement::SCATTER);
+    ASSERT_TRUE(CpuTopologyUtils::parse_placement("one-per-core") == Placement::ONE_PER_CORE);
+    ASSERT_TRUE(CpuTopologyUtils::parse_placement("per-ccx") == Placement::PER_CCX);
+    ASSERT_TRUE(CpuTopologyUtils::parse_placement("list:0-2,8") == Placement::LIST);
+    ASSERT_TRUE(CpuTopologyUtils::parse_placement_list("list:6,0-2") == std::vector<size_t>({6, 0, 1, 2}));
+    TestAssert::assert_equal(std::string("one-per-core"), CpuTopologyUtils::placement_to_string(Placement::ONE_PER_CORE));
+    TestAssert::assert_equal(std::string("default"), CpuTopologyUtils::placement_to_string(Placement::DEFAULT));
+
+    try {
+        CpuTopologyUtils::parse_placement("spread");
+        ASSERT_TRUE(false);  // Should throw
+    } catch (const ArgumentError& e) {
+        std::string error_msg = e.what();
+        ASSERT_TRUE(error_msg.find("Valid placements: compact, scatter") != std::string::npos);
+    }
+
+    for (const char* bad : {"list:", "list:a,b"}) {
+        try {
+            CpuTopologyUtils::parse_placement(bad);
+            ASSERT_TRUE(false);  // Should throw
+        } catch (const ArgumentError& e) {
+            std::string error_msg = e.what();
+            ASSERT_TRUE(error_msg.find("Invalid placement list") != std::string::npos);
+        }
+    }
+}
+
+void test_core_types() {
+    CpuTopology hybrid = hybrid_topology();
+    ASSERT_TRUE(hybrid.hybrid);
+    TestAssert::assert_equal_size_t(6, hybrid.physical_cores);
+    ASSERT_TRUE(CpuTopologyUtils::cpus_of_type(hybrid, CPUAffinityType::P_CORES) == std::vector<size_t>({0, 2, 1, 3}));
+    ASSERT_TRUE(CpuTopologyUtils::cpus_of_type(hybrid, CPUAffinityType::E_CORES) == std::vector<size_t>({4, 5, 6, 7}));
+    TestAssert::assert_equal_size_t(8, CpuTopologyUtils::cpus_of_type(hybrid, CPUAffinityType::DEFAULT).size());
+
+    // big.LITTLE: the highest capacity makes performance cores, every lower one efficiency cores
+    std::vector<SysfsCpu> arm = {sysfs_cpu(0, 0, 0), sysfs_cpu(1, 0, 1), sysfs_cpu(2, 0, 2), sysfs_cpu(3, 0, 3)};
+    arm[0].capacity = 446;
+    arm[1].capacity = 446;
+    arm[2].capacity = 871;
+    arm[3].capacity = 1024;
+    CpuTopology big_little = CpuTopologyUtils::build_topology(arm, NumaTopology{});
+    ASSERT_TRUE(big_little.hybrid);
+    ASSERT_TRUE(CpuTopologyUtils::cpus_of_type(big_little, CPUAffinityType::P_CORES) == std::vector<size_t>({3}));
+    ASSERT_TRUE(CpuTopologyUtils::cpus_of_type(big_little, CPUAffinityType::E_CORES) ==
+                std::vector<size_t>({0, 1, 2}));
+
+    // Equal capacities, or none, leave every core a performance core
+    for (auto& cpu : arm) {
+        cpu.capacity = 1024;
+    }
+    CpuTopology uniform = CpuTopologyUtils::build_topology(arm, NumaTopology{});
+    ASSERT_FALSE(uniform.hybrid);
+    TestAssert::assert_equal_size_t(4, CpuTopologyUtils::cpus_of_type(uniform, CPUAffinityType::P_CORES).size());
+    ASSERT_TRUE(CpuTopologyUtils::cpus_of_type(uniform, CPUAffinityType::E_CORES).empty());
+    ASSERT_FALSE(two_socket_smt_topology().hybrid);
+}
+
+void test_read_cache_sizes() {
+    // Levels the host does not describe keep the caller's values
+    CacheInfo info = {};
+    info.l1_data_size = 1;
+    info.l2_size = 2;
+    CpuTopologyUtils::read_cache_sizes(0, info);
+    ASSERT_TRUE(info.l1_data_size > 0);
+    ASSERT_TRUE(info.l2_size > 0);
+
+    // Every instance is listed once; host-dependent, but CPU 0 is always in one L1D instance when any is known
+    CacheInfo shared = {};
+    CpuTopologyUtils::read_cache_sharing(CpuTopologyUtils::get_topology(), shared);
+    size_t instances_with_cpu0 = 0;
+    for (const auto& instance : shared.l1d_sharing) {
+        instances_with_cpu0 += std::count(instance.begin(), instance.end(), size_t{0});
+    }
+    ASSERT_TRUE(shared.l1d_sharing.empty() || instances_with_cpu0 == 1);
+
+    CacheInfo missing = {};
+    missing.l3_size = 3;
+    CpuTopologyUtils::read_cache_sizes(100000, missing);
+    TestAssert::assert_equal_size_t(3, missing.l3_size);
+}
+
+void test_describe() {
+    TestAssert::assert_equal(std::string("2 packages, 2 dies, 2 LLC domains, 4 cores, 8 threads"),
+                             CpuTopologyUtils::describe(two_socket_smt_topology()));
+
+    CpuTopology single = CpuTopologyUtils::build_topology({sysfs_cpu(0, 0, 0)}, NumaTopology{});
+    single.detected = false;
+    TestAssert::assert_equal(std::string("1 package, 1 die, 1 LLC domain, 1 core, 1 thread (not detected)"),
+                             CpuTopologyUtils::describe(single));
+}
+
+void test_detect_topology() {
+    // Whatever the host exposes, every online CPU is placed exactly once
+    CpuTopology topology = CpuTopologyUtils::detect_topology(NumaTopology{});
+    ASSERT_TRUE(!topology.cpus.empty());
+    ASSERT_TRUE(topology.physical_cores >= 1 && topology.physical_cores <= topology.cpus.size());
+    TestAssert::assert_equal_size_t(topology.cpus.size(),
+                                    CpuTopologyUtils::placement_order(topology, Placement::COMPACT).size());
+    TestAssert::assert_equal_size_t(topology.physical_cores,
+                                    CpuTopologyUtils::placement_order(topology, Placement::ONE_PER_CORE).size());
+}
+
+int main() {
+    TestFramework framework;
+
+    TEST_CASE("Build topology", test_build_topology);
+    TEST_CASE("Placement order", test_placement_order);
+    TEST_CASE("Parse placement", test_parse_placement);
+    TEST_CASE("Core types", test_core_types);
+    TEST_CASE("Read cache sizes", test_read_cache_sizes);
+    TEST_CASE("Describe topology", test_describe);
+    TEST_CASE("Detect topology", test_detect_topology);
+
+    return framework.run_all();
+}
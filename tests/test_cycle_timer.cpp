@@ -0,0 +1,66 @@
+#include "test_framework.h"
+#include "../common/cycle_timer.h"
+#include <chrono>
+#include <string>
+#include <thread>
+
+using CycleTimer::Clock;
+using CycleTimer::Source;
+
+void test_calibration_is_plausible() {
+    const CycleTimer::Calibration& timer = CycleTimer::calibrate();
+    ASSERT_TRUE(&timer == &CycleTimer::calibrate());  // Calibrated once
+    ASSERT_TRUE(timer.ticks_per_second >= 1e6 && timer.ticks_per_second <= 1e11);
+    ASSERT_TRUE(timer.resolution_ns > 0.0);
+    ASSERT_TRUE(timer.overhead_ns >= 0.0 && timer.overhead_ns < 100000.0);
+    ASSERT_TRUE(timer.tick_overhead_ns >= 0.0 && timer.tick_overhead_ns < 100000.0);
+
+    std::string text = CycleTimer::describe();
+    ASSERT_TRUE(text.find(CycleTimer::source_to_string(timer.source)) == 0);
+    ASSERT_TRUE(text.find("ns per read pair") != std::string::npos);
+    TestAssert::assert_equal(std::string("cntvct_el0"), CycleTimer::source_to_string(Source::CNTVCT));
+    TestAssert::assert_equal(std::string("mach_absolute_time"), CycleTimer::source_to_string(Source::MACH));
+}
+
+void test_clock_is_monotonic() {
+    Clock::time_point previous = Clock::now();
+    for (int i = 0; i < 100000; ++i) {
+        Clock::time_point now = Clock::now();
+        ASSERT_TRUE(now >= previous);
+        previous = now;
+    }
+}
+
+void test_clock_agrees_with_steady_clock() {
+    auto steady_start = std::chrono::steady_clock::now();
+    Clock::time_point start = Clock::now();
+    uint64_t start_ticks = CycleTimer::start_ticks();
+    std::this_thread::sleep_for(std::chrono::milliseconds(50));
+    uint64_t stop_ticks = CycleTimer::stop_ticks();
+    Clock::time_point end = Clock::now();
+    double steady = std::chrono::duration<double>(std::chrono::steady_clock::now() - steady_start).count();
+
+    double seconds = CycleTimer::elapsed_seconds(start, end);
+    ASSERT_TRUE(seconds > 0.045 && seconds <= steady * 1.01);
+    double ns = CycleTimer::ticks_to_ns(start_ticks, stop_ticks);
+    ASSERT_TRUE(ns > 45e6 && ns <= steady * 1.01e9);
+}
+
+void test_elapsed_never_negative() {
+    Clock::time_point now = Clock::now();
+    ASSERT_TRUE(CycleTimer::elapsed_seconds(now, now) == 0.0);
+    ASSERT_TRUE(CycleTimer::elapsed_seconds(now, now - std::chrono::microseconds(5)) == 0.0);
+    ASSERT_TRUE(CycleTimer::ticks_to_ns(1000, 1000) == 0.0);
+    ASSERT_TRUE(CycleTimer::ticks_to_ns(1000, 10) == 0.0);  // Stop before start
+}
+
+int main() {
+    TestFramework framework;
+
+    TEST_CASE("Calibration is plausible", test_calibration_is_plausible);
+    TEST_CASE("Clock is monotonic", test_clock_is_monotonic);
+    TEST_CASE("Clock agrees with steady_clock", test_clock_agrees_with_steady_clock);
+    TEST_CASE("Elapsed never negative", test_elapsed_never_negative);
+
+    return framework.run_all();
+}
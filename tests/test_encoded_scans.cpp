@@ -0,0 +1,57 @@
+#include "test_framework.h"
+#include "../common/encoded_scans.h"
+#include "../common/errors.h"
+#include <set>
+#include <string>
+#include <vector>
+
+using EncodedScans::Encoding;
+
+void test_parse_bits() {
+    TestAssert::assert_equal_size_t(1, EncodedScans::parse_bits("1", Encoding::BITPACK));
+    TestAssert::assert_equal_size_t(32, EncodedScans::parse_bits("32", Encoding::DELTA));
+    TestAssert::assert_equal_size_t(16, EncodedScans::parse_bits("16", Encoding::DICTIONARY));
+
+    const std::pair<std::string, Encoding> bad[] = {
+        {"0", Encoding::BITPACK}, {"33", Encoding::DELTA}, {"17", Encoding::DICTIONARY},
+        {"-4", Encoding::BITPACK}, {"8b", Encoding::BITPACK}, {"", Encoding::BITPACK},
+    };
+    for (const auto& input : bad) {
+        try {
+            EncodedScans::parse_bits(input.first, input.second);
+            ASSERT_TRUE(false);  // Should throw
+        } catch (const ArgumentError& e) {
+            std::string error_msg = e.what();
+            ASSERT_TRUE(error_msg.find("Valid widths: 1-") != std::string::npos);
+        }
+    }
+}
+
+void test_sizes() {
+    // A group is whole bytes at every width
+    for (unsigned bits = 1; bits <= EncodedScans::MAX_BITS; ++bits) {
+        TestAssert::assert_equal_size_t(EncodedScans::GROUP_VALUES * bits, EncodedScans::group_bytes(bits) * 8);
+    }
+    TestAssert::assert_equal_size_t(4, EncodedScans::output_bytes(Encoding::DELTA));
+    TestAssert::assert_equal_size_t(8, EncodedScans::output_bytes(Encoding::DICTIONARY));
+    ASSERT_TRUE(EncodedScans::expansion(Encoding::BITPACK, 8) == 4.0);
+    ASSERT_TRUE(EncodedScans::expansion(Encoding::DICTIONARY, 16) == 4.0);
+    TestAssert::assert_equal(std::string("dict"), EncodedScans::encoding_to_string(Encoding::DICTIONARY));
+}
+
+void test_build_dictionary() {
+    std::vector<uint64_t> dictionary = EncodedScans::build_dictionary(10, 42);
+    TestAssert::assert_equal_size_t(1024, dictionary.size());
+    ASSERT_TRUE(dictionary == EncodedScans::build_dictionary(10, 42));
+    ASSERT_TRUE(std::set<uint64_t>(dictionary.begin(), dictionary.end()).size() > 1000);
+}
+
+int main() {
+    TestFramework framework;
+
+    TEST_CASE("Parse bits", test_parse_bits);
+    TEST_CASE("Sizes", test_sizes);
+    TEST_CASE("Build dictionary", test_build_dictionary);
+
+    return framework.run_all();
+}
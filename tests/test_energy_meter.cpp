@@ -0,0 +1,108 @@
+#include "test_framework.h"
+#include "../common/energy_meter.h"
+#include <cstdlib>
+#include <fstream>
+#include <memory>
+#include <string>
+#include <sys/stat.h>
+#include <vector>
+
+using EnergyMeter::Counter;
+using EnergyMeter::Domain;
+using EnergyMeter::Snapshot;
+
+namespace {
+
+void write_file(const std::string& path, const std::string& text) {
+    std::ofstream file(path);
+    file << text << "\n";
+}
+
+void write_zone(const std::string& dir, const std::string& name, const std::string& energy_uj) {
+    mkdir(dir.c_str(), 0755);
+    write_file(dir + "/name", name);
+    write_file(dir + "/energy_uj", energy_uj);
+    write_file(dir + "/max_energy_range_uj", "262143328850");
+}
+
+}  // namespace
+
+void test_counter_delta_wraps_once() {
+    TestAssert::assert_equal_size_t(250, EnergyMeter::counter_delta(1000, 1250, 0));
+    TestAssert::assert_equal_size_t(15, EnergyMeter::counter_delta(4294967286ull, 5, 1ull << 32));
+    TestAssert::assert_equal_size_t(0, EnergyMeter::counter_delta(500, 100, 0));       // No range to wrap at
+    TestAssert::assert_equal_size_t(0, EnergyMeter::counter_delta(500, 100, 400));     // Past the range
+    TestAssert::assert_equal(std::string("dram"), EnergyMeter::domain_to_string(Domain::DRAM));
+}
+
+void test_energy_between_sums_domains() {
+    std::vector<Counter> counters = {{Domain::PACKAGE, "package-0", 1e-6, 0},
+                                     {Domain::PACKAGE, "package-1", 0.5, 1ull << 32},
+                                     {Domain::DRAM, "package-0/dram", 1e-6, 0}};
+    Snapshot begin{{1000000, 4294967295ull, 200000}, true};
+    Snapshot end{{3000000, 1, 700000}, true};
+    EnergyMeter::Energy energy = EnergyMeter::energy_between(counters, begin, end);
+    ASSERT_TRUE(energy.package && energy.dram);
+    ASSERT_TRUE(energy.package_joules == 2.0 + 1.0);  // Two counts of 0.5 J across the wrap
+    ASSERT_TRUE(energy.dram_joules == 0.5);
+
+    end.valid = false;
+    energy = EnergyMeter::energy_between(counters, begin, end);
+    ASSERT_FALSE(energy.package || energy.dram);
+    Snapshot short_end{{3000000}, true};
+    energy = EnergyMeter::energy_between(counters, begin, short_end);
+    ASSERT_FALSE(energy.package || energy.dram);
+}
+
+void test_powercap_meter_reads_package_and_dram_zones() {
+    char root_template[] = "/tmp/energy_powercap_XXXXXX";
+    ASSERT_TRUE(mkdtemp(root_template) != nullptr);
+    std::string root = root_template;
+    write_zone(root + "/intel-rapl:0", "package-0", "1000000");
+    write_zone(root + "/intel-rapl:0:0", "core", "900000");
+    write_zone(root + "/intel-rapl:0:1", "dram", "50000");
+    write_zone(root + "/intel-rapl:1", "package-1", "2000000");
+    write_zone(root + "/intel-rapl:2", "psys", "9000000");
+    write_zone(root + "/intel-rapl-mmio:0", "package-0", "1000000");  // Duplicates intel-rapl:0
+    mkdir((root + "/intel-rapl:3").c_str(), 0755);                    // No name, no counter
+
+    std::unique_ptr<EnergyMeter::Meter> meter = EnergyMeter::create_powercap_meter(root);
+    ASSERT_TRUE(meter != nullptr);
+    const std::vector<Counter>& counters = meter->counters();
+    TestAssert::assert_equal_size_t(3, counters.size());
+    TestAssert::assert_equal(std::string("package-0"), counters[0].name);
+    TestAssert::assert_equal(std::string("package-0/dram"), counters[1].name);
+    ASSERT_TRUE(counters[1].domain == Domain::DRAM);
+    TestAssert::assert_equal(std::string("package-1"), counters[2].name);
+    TestAssert::assert_equal_size_t(262143328850ull, counters[2].range);
+    TestAssert::assert_equal(std::string("powercap: package-0, package-0/dram, package-1"), meter->describe());
+
+    Snapshot before = meter->snapshot();
+    ASSERT_TRUE(before.valid);
+    write_file(root + "/intel-rapl:0/energy_uj", "4000000");
+    write_file(root + "/intel-rapl:0:1/energy_uj", "1050000");
+    write_file(root + "/intel-rapl:1/energy_uj", "262143328840");  // Wraps by the next reading
+    Snapshot middle = meter->snapshot();
+    write_file(root + "/intel-rapl:1/energy_uj", "1999990");
+    Snapshot after = meter->snapshot();
+
+    EnergyMeter::Energy energy = meter->between(middle, after);
+    ASSERT_TRUE(energy.package_joules > 2.0 - 1e-9 && energy.package_joules < 2.0 + 1e-9);
+    ASSERT_TRUE(energy.dram_joules == 0.0);
+    energy = meter->between(before, middle);
+    ASSERT_TRUE(energy.dram_joules > 1.0 - 1e-9 && energy.dram_joules < 1.0 + 1e-9);
+
+    ASSERT_TRUE(EnergyMeter::create_powercap_meter(root + "/missing") == nullptr);
+    std::string cleanup = "rm -rf " + root;
+    ASSERT_TRUE(std::system(cleanup.c_str()) == 0);
+}
+
+int main() {
+    TestFramework framework;
+
+    TEST_CASE("Counter delta wraps once", test_counter_delta_wraps_once);
+    TEST_CASE("Energy between sums domains", test_energy_between_sums_domains);
+    TEST_CASE("Powercap meter reads package and DRAM zones", test_powercap_meter_reads_package_and_dram_zones);
+
+    return framework.run_all();
+}
@@ -0,0 +1,157 @@
+#include "test_framework.h"
+#include "../common/fleet.h"
+#include "../common/constants.h"
+#include "../common/errors.h"
+#include "../common/json.h"
+#include <string>
+#include <vector>
+
+using Fleet::Sample;
+
+namespace {
+
+Sample sample(const std::string& hostname, const std::string& sku, double gbps) {
+    Sample result;
+    result.hostname = hostname;
+    result.sku = sku;
+    result.test = "Sequential Read 4GB avx2 temporal 8T";
+    result.metric = "bandwidth_gbps";
+    result.value = gbps;
+    return result;
+}
+
+std::string record(const std::string& hostname, double bandwidth_gbps, double latency_ns, bool verified) {
+    Ndjson::HostFingerprint host;
+    host.hostname = hostname;
+    host.cpu_name = "Xeon 6430";
+    host.memory_type = "DDR5";
+    host.memory_speed_mtps = 4800;
+    host.memory_channels = 8;
+    return Json::Object()
+        .add_string("record", "result")
+        .add_raw("host", Ndjson::host_to_json(host))
+        .add_string("test_name", "Copy")
+        .add_string("working_set", "1GB")
+        .add_string("kernel", "avx2")
+        .add_string("store_policy", "temporal")
+        .add_count("threads", 8)
+        .add_number("bandwidth_gbps", bandwidth_gbps)
+        .add_number("latency_ns", latency_ns)
+        .add_bool("verified", verified)
+        .str();
+}
+
+}  // namespace
+
+void test_parse_endpoints() {
+    std::vector<Fleet::Endpoint> endpoints = Fleet::parse_endpoints("node1,node2:7600,[fe80::1]:9000,::1,node1");
+    TestAssert::assert_equal_size_t(4, endpoints.size());  // The repeated node1 is dropped
+    TestAssert::assert_equal_size_t(BenchmarkConstants::FLEET_DEFAULT_PORT, endpoints[0].port);
+    TestAssert::assert_equal_size_t(7600, endpoints[1].port);
+    TestAssert::assert_equal(std::string("fe80::1"), endpoints[2].host);
+    TestAssert::assert_equal(std::string("[fe80::1]:9000"), Fleet::endpoint_to_string(endpoints[2]));
+    TestAssert::assert_equal(std::string("::1"), endpoints[3].host);
+    TestAssert::assert_equal_size_t(BenchmarkConstants::FLEET_DEFAULT_PORT, endpoints[3].port);
+
+    for (const char* bad : {"", "node1,", ":7531", "node1:0", "node1:65536", "node1:x", "[::1", "[::1]7531"}) {
+        try {
+            Fleet::parse_endpoints(bad);
+            ASSERT_TRUE(false);  // Should throw
+        } catch (const ArgumentError&) {
+            ASSERT_TRUE(true);
+        }
+    }
+}
+
+void test_forwarded_and_refused_options() {
+    const char* argv[] = {"membench", "--coordinate", "a,b", "--pattern", "copy", "--format=json",
+                          "--ndjson", "fleet.ndjson", "--size", "2", "--compare=base.json"};
+    std::vector<std::string> args = Fleet::forwarded_args(11, const_cast<char**>(argv));
+    std::vector<std::string> expected = {"--pattern", "copy", "--size", "2"};
+    ASSERT_TRUE(args == expected);
+    ASSERT_TRUE(Fleet::refused_option(args).empty());
+
+    for (const char* bad : {"--file", "--io=/tmp", "--trace", "--agent", "--peak-file",
+                            "--system-cache=/tmp/system.json", "--tune"}) {
+        std::vector<std::string> refused = {"--pattern", "copy", bad};
+        ASSERT_TRUE(Fleet::refused_option(refused).find(std::string(bad).substr(0, std::string(bad).find('='))) !=
+                    std::string::npos);
+    }
+}
+
+void test_run_spec_round_trip() {
+    Fleet::RunSpec spec;
+    spec.fleet_id = "coordinator-42-1700000000";
+    spec.args = {"--pattern", "copy", "--size", "0.5", "--cpus", "0,\"2\""};
+    spec.start_unix_ms = 1700000002000;
+
+    Fleet::RunSpec parsed = Fleet::spec_from_json(Json::parse(Fleet::spec_to_json(spec)));
+    TestAssert::assert_equal(spec.fleet_id, parsed.fleet_id);
+    ASSERT_TRUE(parsed.args == spec.args);
+    ASSERT_TRUE(parsed.start_unix_ms == spec.start_unix_ms);
+
+    for (const char* bad : {"{\"type\":\"done\"}", "{\"type\":\"run\",\"args\":[1],\"start_unix_ms\":0}",
+                            "{\"type\":\"run\",\"args\":[]}"}) {
+        try {
+            Fleet::spec_from_json(Json::parse(bad));
+            ASSERT_TRUE(false);  // Should throw
+        } catch (const ConfigurationError&) {
+            ASSERT_TRUE(true);
+        }
+    }
+}
+
+void test_sample_from_record() {
+    Sample parsed;
+    ASSERT_TRUE(Fleet::sample_from_record(Json::parse(record("web-1", 41.5, 0.0, true)), parsed));
+    TestAssert::assert_equal(std::string("web-1"), parsed.hostname);
+    TestAssert::assert_equal(std::string("Xeon 6430 DDR5-4800 x8"), parsed.sku);
+    TestAssert::assert_equal(std::string("Copy 1GB avx2 temporal 8T"), parsed.test);
+    TestAssert::assert_equal(std::string("bandwidth_gbps"), parsed.metric);
+
+    ASSERT_TRUE(Fleet::sample_from_record(Json::parse(record("web-1", 0.0, 95.0, true)), parsed));
+    TestAssert::assert_equal(std::string("latency_ns"), parsed.metric);
+    ASSERT_TRUE(parsed.value == 95.0);
+
+    ASSERT_FALSE(Fleet::sample_from_record(Json::parse(record("web-1", 41.5, 0.0, false)), parsed));
+    ASSERT_FALSE(Fleet::sample_from_record(Json::parse(record("web-1", 0.0, 0.0, true)), parsed));
+    ASSERT_FALSE(Fleet::sample_from_record(Json::parse("{\"type\":\"done\",\"exit_code\":0}"), parsed));
+}
+
+void test_summarize_flags_outliers_per_sku() {
+    std::vector<Sample> samples = {sample("a1", "A", 100.0), sample("a2", "A", 101.0), sample("a3", "A", 99.0),
+                                   sample("a4", "A", 100.5), sample("a5", "A", 80.0),  // One DIMM short
+                                   sample("b1", "B", 50.0),  sample("b2", "B", 50.2),  sample("b3", "B", 49.9),
+                                   sample("c1", "C", 10.0),  sample("c2", "C", 20.0)};    // Too few to judge
+    Fleet::Report report;
+    Fleet::summarize(samples, report);
+
+    TestAssert::assert_equal_size_t(3, report.summaries.size());
+    TestAssert::assert_equal(std::string("A"), report.summaries[0].sku);
+    TestAssert::assert_equal_size_t(5, report.summaries[0].hosts);
+    ASSERT_TRUE(report.summaries[0].median == 100.0);
+    ASSERT_TRUE(report.summaries[0].min == 80.0 && report.summaries[0].max == 101.0);
+    ASSERT_TRUE(report.summaries[0].p10 < report.summaries[0].median);
+
+    TestAssert::assert_equal_size_t(1, report.outliers.size());
+    TestAssert::assert_equal(std::string("a5"), report.outliers[0].hostname);
+    ASSERT_TRUE(report.outliers[0].deviation_percent == -20.0);
+    ASSERT_TRUE(report.outliers[0].robust_z > BenchmarkConstants::FLEET_OUTLIER_MADS);
+
+    // Identical hosts and a deviant inside the minimum distance flag nobody
+    Fleet::Report tight;
+    Fleet::summarize({sample("a1", "A", 100.0), sample("a2", "A", 100.0), sample("a3", "A", 104.0)}, tight);
+    ASSERT_TRUE(tight.outliers.empty());
+}
+
+int main() {
+    TestFramework framework;
+
+    TEST_CASE("Parse endpoints", test_parse_endpoints);
+    TEST_CASE("Forwarded and refused options", test_forwarded_and_refused_options);
+    TEST_CASE("Run spec round trip", test_run_spec_round_trip);
+    TEST_CASE("Sample from record", test_sample_from_record);
+    TEST_CASE("Summarize flags outliers per SKU", test_summarize_flags_outliers_per_sku);
+
+    return framework.run_all();
+}
@@ -0,0 +1,78 @@
+#include "test_framework.h"
+#include "../common/gpu_bandwidth.h"
+#include "../common/constants.h"
+#include "../common/errors.h"
+#include <string>
+#include <vector>
+
+using GpuBandwidth::Kernel;
+
+void test_parse_kernels() {
+    std::vector<Kernel> all = GpuBandwidth::parse_kernels("all");
+    TestAssert::assert_equal_size_t(3, all.size());
+    ASSERT_TRUE(all[0] == Kernel::READ && all[1] == Kernel::COPY && all[2] == Kernel::TRIAD);
+
+    std::vector<Kernel> picked = GpuBandwidth::parse_kernels("triad,copy,triad");
+    TestAssert::assert_equal_size_t(2, picked.size());  // The repeated triad is dropped
+    ASSERT_TRUE(picked[0] == Kernel::TRIAD && picked[1] == Kernel::COPY);
+    TestAssert::assert_equal(std::string("triad"), GpuBandwidth::kernel_to_string(picked[0]));
+
+    for (const char* bad : {"", "scale", "read,,copy", "READ"}) {
+        try {
+            GpuBandwidth::parse_kernels(bad);
+            ASSERT_TRUE(false);  // Should throw
+        } catch (const ArgumentError&) {
+            ASSERT_TRUE(true);
+        }
+    }
+}
+
+void test_kernel_traffic() {
+    TestAssert::assert_equal_size_t(1, GpuBandwidth::traffic_factor(Kernel::READ));
+    TestAssert::assert_equal_size_t(2, GpuBandwidth::traffic_factor(Kernel::COPY));
+    TestAssert::assert_equal_size_t(3, GpuBandwidth::traffic_factor(Kernel::TRIAD));
+    ASSERT_TRUE(GpuBandwidth::cpu_traffic(Kernel::READ) == Contention::Aggressor::SEQUENTIAL_READ);
+    ASSERT_TRUE(GpuBandwidth::cpu_traffic(Kernel::TRIAD) == Contention::Aggressor::COPY);
+}
+
+void test_verify() {
+    const size_t count = 1024;
+    std::vector<float> a(count), b(count), c(count);
+    GpuBandwidth::fill(a.data(), b.data(), c.data(), count);
+    GpuBandwidth::Arrays arrays;
+    arrays.a = a.data();
+    arrays.b = b.data();
+    arrays.c = c.data();
+    arrays.count = count;
+
+    ASSERT_TRUE(GpuBandwidth::verify(Kernel::READ, arrays, static_cast<double>(count)));
+    ASSERT_FALSE(GpuBandwidth::verify(Kernel::READ, arrays, count - 1.0));
+    ASSERT_FALSE(GpuBandwidth::verify(Kernel::COPY, arrays, 0.0));  // Nothing was copied yet
+
+    std::copy(b.begin(), b.end(), a.begin());
+    ASSERT_TRUE(GpuBandwidth::verify(Kernel::COPY, arrays, 0.0));
+    ASSERT_FALSE(GpuBandwidth::verify(Kernel::TRIAD, arrays, 0.0));
+
+    for (size_t i = 0; i < count; ++i) {
+        a[i] = b[i] + BenchmarkConstants::GPU_TRIAD_SCALAR * c[i];
+    }
+    ASSERT_TRUE(GpuBandwidth::verify(Kernel::TRIAD, arrays, 0.0));
+    a[count - 1] = 0.0f;
+    ASSERT_FALSE(GpuBandwidth::verify(Kernel::TRIAD, arrays, 0.0));
+}
+
+void test_retained_percent() {
+    ASSERT_TRUE(GpuBandwidth::retained_percent(75.0, 100.0) == 75.0);
+    ASSERT_TRUE(GpuBandwidth::retained_percent(10.0, 0.0) == 0.0);
+}
+
+int main() {
+    TestFramework framework;
+
+    TEST_CASE("Parse kernels", test_parse_kernels);
+    TEST_CASE("Kernel traffic", test_kernel_traffic);
+    TEST_CASE("Verify", test_verify);
+    TEST_CASE("Retained percent", test_retained_percent);
+
+    return framework.run_all();
+}
@@ -0,0 +1,137 @@
+#include "test_framework.h"
+#include "../common/io_tests.h"
+#include "../common/errors.h"
+#include <string>
+#include <vector>
+
+using IoTests::Method;
+
+namespace {
+
+constexpr size_t FILE_SIZE = 1024 * 1024;
+constexpr size_t BLOCK_SIZE = 64 * 1024;
+
+IoTests::Config make_config(const std::string& path) {
+    IoTests::Config config;
+    config.path = path;
+    config.file_size = FILE_SIZE;
+    config.block_size = BLOCK_SIZE;
+    config.queue_depth = 4;
+    config.passes = 2;
+    return config;
+}
+
+}  // namespace
+
+void test_method_names() {
+    std::vector<Method> all = IoTests::parse_methods("all");
+    TestAssert::assert_equal_size_t(6, all.size());
+    for (Method method : all) {
+        std::vector<Method> parsed = IoTests::parse_methods(IoTests::method_to_string(method));
+        ASSERT_TRUE(parsed.size() == 1 && parsed[0] == method);
+    }
+
+    std::vector<Method> list = IoTests::parse_methods("mmap,io_uring,mmap");
+    TestAssert::assert_equal_size_t(2, list.size());
+    ASSERT_TRUE(list[0] == Method::MMAP && list[1] == Method::IO_URING);
+
+    try {
+        IoTests::parse_methods("aio");
+        ASSERT_TRUE(false);  // Should throw
+    } catch (const ArgumentError& e) {
+        std::string error_msg = e.what();
+        ASSERT_TRUE(error_msg.find("Invalid I/O method 'aio'") != std::string::npos);
+    }
+}
+
+void test_method_parameters() {
+    ASSERT_FALSE(IoTests::uses_block_size(Method::MMAP));
+    ASSERT_TRUE(IoTests::uses_block_size(Method::PREAD));
+    ASSERT_TRUE(IoTests::uses_queue_depth(Method::IO_URING_DIRECT));
+    ASSERT_FALSE(IoTests::uses_queue_depth(Method::DIRECT));
+}
+
+void test_size_lists() {
+    std::vector<size_t> sizes = IoTests::parse_block_sizes("4k,128K,1m,8192");
+    TestAssert::assert_equal_size_t(4, sizes.size());
+    TestAssert::assert_equal_size_t(4096, sizes[0]);
+    TestAssert::assert_equal_size_t(128 * 1024, sizes[1]);
+    TestAssert::assert_equal_size_t(1024 * 1024, sizes[2]);
+    TestAssert::assert_equal_size_t(8192, sizes[3]);
+
+    std::vector<size_t> depths = IoTests::parse_queue_depths("1,32");
+    TestAssert::assert_equal_size_t(2, depths.size());
+    TestAssert::assert_equal_size_t(32, depths[1]);
+
+    for (const char* bad : {"1000", "4x", "", "128m"}) {
+        try {
+            IoTests::parse_block_sizes(bad);
+            ASSERT_TRUE(false);  // Should throw
+        } catch (const ArgumentError&) {
+        }
+    }
+    try {
+        IoTests::parse_queue_depths("0");
+        ASSERT_TRUE(false);  // Should throw
+    } catch (const ArgumentError& e) {
+        std::string error_msg = e.what();
+        ASSERT_TRUE(error_msg.find("between 1 and 4096") != std::string::npos);
+    }
+}
+
+void test_buffered_paths() {
+    std::string path = IoTests::create_test_file("/tmp", FILE_SIZE);
+    IoTests::Config config = make_config(path);
+
+    for (Method method : {Method::READ, Method::PREAD, Method::MMAP}) {
+        IoTests::Result result = IoTests::run(method, config, 3.0);
+        ASSERT_TRUE(result.available);
+        TestAssert::assert_equal_size_t(FILE_SIZE * 2, result.stats.bytes_processed);
+        ASSERT_TRUE(result.stats.bandwidth_gbps > 0.0);
+        ASSERT_TRUE(result.cycles_per_byte >= 0.0);
+        // Synchronous paths always have one read in flight
+        TestAssert::assert_equal_size_t(1, result.queue_depth);
+    }
+    IoTests::remove_test_file(path);
+}
+
+void test_optional_paths() {
+    // io_uring may be disabled and /tmp may reject O_DIRECT: either a result or a reason
+    std::string path = IoTests::create_test_file("/tmp", FILE_SIZE);
+    IoTests::Config config = make_config(path);
+
+    for (Method method : {Method::DIRECT, Method::IO_URING, Method::IO_URING_DIRECT}) {
+        IoTests::Result result = IoTests::run(method, config, 3.0);
+        if (result.available) {
+            TestAssert::assert_equal_size_t(FILE_SIZE * 2, result.stats.bytes_processed);
+        } else {
+            ASSERT_FALSE(result.note.empty());
+        }
+    }
+    IoTests::remove_test_file(path);
+}
+
+void test_missing_file() {
+    IoTests::Result result = IoTests::run(Method::PREAD, make_config("/nonexistent-memory-benchmarks-file"), 3.0);
+    ASSERT_FALSE(result.available);
+    ASSERT_TRUE(result.note.find("open") != std::string::npos);
+}
+
+void test_core_clock_estimate() {
+    double ghz = IoTests::estimate_core_clock_ghz();
+    ASSERT_TRUE(ghz > 0.1 && ghz < 10.0);
+}
+
+int main() {
+    TestFramework framework;
+
+    TEST_CASE("Method names", test_method_names);
+    TEST_CASE("Method parameters", test_method_parameters);
+    TEST_CASE("Block size and depth lists", test_size_lists);
+    TEST_CASE("Buffered paths", test_buffered_paths);
+    TEST_CASE("Optional paths", test_optional_paths);
+    TEST_CASE("Missing file", test_missing_file);
+    TEST_CASE("Core clock estimate", test_core_clock_estimate);
+
+    return framework.run_all();
+}
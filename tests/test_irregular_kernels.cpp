@@ -0,0 +1,126 @@
+#include "test_framework.h"
+#include "../common/irregular_kernels.h"
+#include "../common/constants.h"
+#include "../common/errors.h"
+#include <algorithm>
+#include <string>
+#include <vector>
+
+using IrregularKernels::Matrix;
+
+void test_parse_options() {
+    ASSERT_TRUE(IrregularKernels::parse_matrix("banded") == Matrix::BANDED);
+    ASSERT_TRUE(IrregularKernels::parse_matrix("powerlaw") == Matrix::POWER_LAW);
+    TestAssert::assert_equal(std::string("powerlaw"), IrregularKernels::matrix_to_string(Matrix::POWER_LAW));
+    TestAssert::assert_equal_size_t(2, IrregularKernels::parse_row_nnz("2"));
+    TestAssert::assert_equal_size_t(BenchmarkConstants::SPMV_MAX_ROW_NNZ, IrregularKernels::parse_row_nnz("128"));
+    TestAssert::assert_equal_size_t(32, IrregularKernels::parse_block("32"));
+
+    const std::vector<std::string> bad = {"1", "129", "-4", "16x", ""};
+    for (const auto& text : bad) {
+        try {
+            IrregularKernels::parse_row_nnz(text);
+            ASSERT_TRUE(false);  // Should throw
+        } catch (const ArgumentError& e) {
+            ASSERT_TRUE(std::string(e.what()).find("Valid values: 2-128") != std::string::npos);
+        }
+    }
+    for (const char* text : {"0", "3", "4097"}) {
+        try {
+            IrregularKernels::parse_block(text);
+            ASSERT_TRUE(false);  // Should throw
+        } catch (const ArgumentError&) {
+            ASSERT_TRUE(true);
+        }
+    }
+    try {
+        IrregularKernels::parse_matrix("dense");
+        ASSERT_TRUE(false);  // Should throw
+    } catch (const ArgumentError&) {
+        ASSERT_TRUE(true);
+    }
+}
+
+void test_synthetic_rows() {
+    IrregularKernels::MatrixSpec banded{Matrix::BANDED, 1000, 16, 1};
+    std::vector<uint32_t> columns(1000);
+    IrregularKernels::row_columns(banded, 0, columns.data());
+    TestAssert::assert_equal_size_t(16, IrregularKernels::row_length(banded, 0));
+    TestAssert::assert_equal_size_t(992, columns[0]);  // Wrapped around the first row
+    TestAssert::assert_equal_size_t(7, columns[15]);
+
+    // Power-law rows: mean near row_nnz, a long tail, ascending columns
+    IrregularKernels::MatrixSpec power{Matrix::POWER_LAW, 100000, 16, 1};
+    size_t total = 0, longest = 0;
+    for (size_t row = 0; row < power.rows; ++row) {
+        size_t length = IrregularKernels::row_length(power, row);
+        total += length;
+        longest = std::max(longest, length);
+    }
+    ASSERT_TRUE(total > 12 * power.rows && total < 20 * power.rows);
+    ASSERT_TRUE(longest > 20 * 16);
+    IrregularKernels::row_columns(power, 5, columns.data());
+    for (size_t j = 1; j < IrregularKernels::row_length(power, 5); ++j) {
+        ASSERT_TRUE(columns[j - 1] <= columns[j]);
+    }
+}
+
+void test_spmv_formats_agree() {
+    std::vector<uint64_t> storage(256 * 1024 / sizeof(uint64_t));
+    uint8_t* base = reinterpret_cast<uint8_t*>(storage.data());
+    const size_t bytes = storage.size() * sizeof(uint64_t);
+    for (Matrix shape : {Matrix::BANDED, Matrix::POWER_LAW}) {
+        IrregularKernels::Config config;
+        config.matrix = shape;
+
+        IrregularKernels::Csr csr = IrregularKernels::build_csr(base, bytes, config, 9);
+        ASSERT_TRUE(csr.spec.rows > 1000);
+        ASSERT_FALSE(IrregularKernels::verify_spmv(csr.spec, csr.y));  // Not multiplied yet
+        IrregularKernels::spmv_csr(csr);
+        ASSERT_TRUE(IrregularKernels::verify_spmv(csr.spec, csr.y));
+
+        IrregularKernels::Sell sell = IrregularKernels::build_sell(base, bytes, config, 9);
+        ASSERT_TRUE(sell.spec.rows > 1000);
+        ASSERT_TRUE(sell.stored >= sell.nonzeros);
+        TestAssert::assert_equal_size_t(0, sell.stored % BenchmarkConstants::SELL_CHUNK_ROWS);
+        IrregularKernels::spmv_sell(sell);
+        ASSERT_TRUE(IrregularKernels::verify_spmv(sell.spec, sell.y));
+        sell.y[sell.spec.rows / 2] += 1.0;
+        ASSERT_FALSE(IrregularKernels::verify_spmv(sell.spec, sell.y));
+    }
+    // Banded rows are all the same length: sorting leaves no padding
+    IrregularKernels::Sell banded = IrregularKernels::build_sell(base, bytes, IrregularKernels::Config{}, 9);
+    ASSERT_TRUE(banded.stored < banded.nonzeros + BenchmarkConstants::SELL_CHUNK_ROWS * 16);
+    ASSERT_TRUE(IrregularKernels::build_csr(base, 64, IrregularKernels::Config{}, 9).spec.rows == 0);
+}
+
+void test_stencil_blocking() {
+    std::vector<uint64_t> storage(2 * 20 * 20 * 20 + 64);
+    IrregularKernels::Grid grid =
+        IrregularKernels::build_grid(reinterpret_cast<uint8_t*>(storage.data()), storage.size() * 8, 5);
+    TestAssert::assert_equal_size_t(20, grid.nx);
+    TestAssert::assert_equal_size_t(18 * 18 * 18, grid.interior());
+
+    std::vector<double> reference(grid.nx * grid.ny * grid.nz);
+    IrregularKernels::stencil_pass(grid.in, grid.out, grid.nx, grid.ny, grid.nz, 0);
+    ASSERT_TRUE(IrregularKernels::verify_stencil(grid.in, grid.out, grid.nx, grid.ny, grid.nz, 3));
+    reference.assign(grid.out, grid.out + reference.size());
+
+    // Tiles that do not divide the interior give the same sweep
+    IrregularKernels::stencil_pass(grid.in, grid.out, grid.nx, grid.ny, grid.nz, 7);
+    ASSERT_TRUE(std::vector<double>(grid.out, grid.out + reference.size()) == reference);
+    // A second sweep from the same input is not a sweep of the output
+    ASSERT_FALSE(IrregularKernels::verify_stencil(grid.out, grid.out, grid.nx, grid.ny, grid.nz, 3));
+    ASSERT_TRUE(IrregularKernels::build_grid(reinterpret_cast<uint8_t*>(storage.data()), 200, 5).nx == 0);
+}
+
+int main() {
+    TestFramework framework;
+
+    TEST_CASE("Parse options", test_parse_options);
+    TEST_CASE("Synthetic rows", test_synthetic_rows);
+    TEST_CASE("SpMV formats agree", test_spmv_formats_agree);
+    TEST_CASE("Stencil blocking", test_stencil_blocking);
+
+    return framework.run_all();
+}
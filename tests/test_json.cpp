@@ -0,0 +1,63 @@
+#include "test_framework.h"
+#include "../common/json.h"
+#include "../common/errors.h"
+#include <cmath>
+#include <string>
+
+void test_quote_and_number() {
+    TestAssert::assert_equal(std::string("\"a\\\"b\\\\c\\nd\""), Json::quote("a\"b\\c\nd"));
+    TestAssert::assert_equal(std::string("\"\\u0001\""), Json::quote(std::string(1, '\x01')));
+    TestAssert::assert_equal(std::string("25.5"), Json::number(25.5));
+    TestAssert::assert_equal(std::string("null"), Json::number(std::nan("")));
+    TestAssert::assert_equal(std::string("null"), Json::number(INFINITY));
+}
+
+void test_object_builder() {
+    std::string json = Json::Object().add_string("name", "x").add_count("n", 3).add_bool("ok", true)
+                           .add_raw("list", Json::array({"1", "2"})).str();
+    TestAssert::assert_equal(std::string("{\"name\":\"x\",\"n\":3,\"ok\":true,\"list\":[1,2]}"), json);
+    TestAssert::assert_equal(std::string("{}"), Json::Object().str());
+}
+
+void test_parse() {
+    Json::Value root = Json::parse(" {\"a\": [1, 2.5e1, -3], \"b\": {\"c\": \"x\\ty\\u0041\"}, \"d\": true,"
+                                   " \"e\": null, \"f\": [], \"g\": {}} ");
+    ASSERT_TRUE(root.type == Json::Value::Type::OBJECT);
+    const Json::Value* a = root.find("a");
+    ASSERT_TRUE(a != nullptr && a->items.size() == 3);
+    ASSERT_TRUE(a->items[1].number == 25.0 && a->items[2].number == -3.0);
+    TestAssert::assert_equal(std::string("x\tyA"), root.find("b")->get_string("c"));
+    ASSERT_TRUE(root.find("d")->boolean);
+    ASSERT_TRUE(root.find("e")->type == Json::Value::Type::NULL_VALUE);
+    ASSERT_TRUE(root.find("f")->items.empty() && root.find("g")->members.empty());
+    ASSERT_TRUE(root.find("missing") == nullptr);
+    ASSERT_TRUE(root.get_number("missing", 7.0) == 7.0);
+
+    // What the builder writes, the parser reads back
+    Json::Value round = Json::parse(Json::Object().add_string("s", "q\"\\").add_number("v", 0.125).str());
+    TestAssert::assert_equal(std::string("q\"\\"), round.get_string("s"));
+    ASSERT_TRUE(round.get_number("v") == 0.125);
+}
+
+void test_parse_malformed() {
+    for (const char* bad : {"", "{", "[1,", "{\"a\" 1}", "{\"a\": 1,}", "\"open", "nul", "[1] x", "{a: 1}"}) {
+        try {
+            Json::parse(bad);
+            ASSERT_TRUE(false);  // Should throw
+        } catch (const ConfigurationError& e) {
+            std::string error_msg = e.what();
+            ASSERT_TRUE(error_msg.find("Malformed JSON at byte") != std::string::npos);
+        }
+    }
+}
+
+int main() {
+    TestFramework framework;
+
+    TEST_CASE("Quote and number", test_quote_and_number);
+    TEST_CASE("Object builder", test_object_builder);
+    TEST_CASE("Parse", test_parse);
+    TEST_CASE("Parse malformed", test_parse_malformed);
+
+    return framework.run_all();
+}
@@ -0,0 +1,115 @@
+#include "test_framework.h"
+#include "../common/kernel_matrix.h"
+#include "../common/errors.h"
+#include <cstring>
+#include <string>
+#include <vector>
+
+using KernelMatrix::Family;
+
+void test_instantiations() {
+    // Widths 4-64 by unrolls 1-8, reads by every accumulator count dividing the unroll; triad on doubles
+    TestAssert::assert_equal_size_t(50, KernelMatrix::shapes(Family::READ).size());
+    TestAssert::assert_equal_size_t(20, KernelMatrix::shapes(Family::WRITE).size());
+    TestAssert::assert_equal_size_t(16, KernelMatrix::shapes(Family::TRIAD).size());
+    for (const auto& kernel : KernelMatrix::all()) {
+        ASSERT_TRUE(kernel.shape.unroll % kernel.shape.accumulators == 0);
+        ASSERT_TRUE((kernel.read != nullptr) == (kernel.family == Family::READ));
+        ASSERT_TRUE((kernel.write != nullptr) == (kernel.family == Family::WRITE));
+        ASSERT_TRUE((kernel.triad != nullptr) == (kernel.family == Family::TRIAD));
+    }
+    ASSERT_TRUE(KernelMatrix::find(Family::READ, {64, 8, 4}) != nullptr);
+    ASSERT_TRUE(KernelMatrix::find(Family::READ, {64, 4, 8}) == nullptr);  // More sums than loads
+    ASSERT_TRUE(KernelMatrix::find(Family::TRIAD, {4, 2, 1}) == nullptr);
+}
+
+void test_shape_names() {
+    KernelMatrix::Shape shape{32, 4, 2};
+    TestAssert::assert_equal(std::string("w32u4a2"), KernelMatrix::shape_to_string(shape));
+    ASSERT_TRUE(KernelMatrix::parse_shape("w32u4a2") == shape);
+    for (const char* text : {"", "w32u4", "w32u4a2x", "32u4a2", "w0u1a1"}) {
+        try {
+            KernelMatrix::parse_shape(text);
+            ASSERT_TRUE(false);  // Should throw
+        } catch (const ConfigurationError&) {
+            ASSERT_TRUE(true);
+        }
+    }
+}
+
+void test_every_shape_computes() {
+    // Odd lengths leave tails for the single-vector and scalar loops of every shape
+    std::vector<uint64_t> words(1021);
+    for (size_t i = 0; i < words.size(); ++i) {
+        words[i] = (i + 1) * 0x9E3779B97F4A7C15ULL;
+    }
+    const uint8_t* data = reinterpret_cast<const uint8_t*>(words.data() + 1);
+    const size_t bytes = (words.size() - 1) * sizeof(uint64_t);
+    const uint64_t pattern = 0x1122334455667788ULL;
+
+    for (const auto& kernel : KernelMatrix::all()) {
+        if (kernel.read) {
+            ASSERT_TRUE(kernel.read(data, bytes) ==
+                        KernelMatrix::reference_read(kernel.shape.element_bytes, data, bytes));
+        }
+        if (kernel.write) {
+            std::vector<uint64_t> out(words.size() + 1, 0);
+            kernel.write(reinterpret_cast<uint8_t*>(out.data()), bytes, pattern);
+            size_t landed = 0;
+            for (size_t i = 0; i + 1 < words.size(); ++i) {
+                landed += (out[i] == pattern);
+            }
+            TestAssert::assert_equal_size_t(words.size() - 1, landed);
+            ASSERT_TRUE(out[words.size() - 1] == 0);  // Nothing past the range
+        }
+        if (kernel.triad) {
+            std::vector<double> a(words.size() + 1, -1.0), b(words.size()), c(words.size());
+            for (size_t i = 0; i < b.size(); ++i) {
+                b[i] = static_cast<double>(i);
+                c[i] = static_cast<double>(2 * i);
+            }
+            kernel.triad(a.data(), b.data(), c.data(), 0.5, b.size());
+            size_t correct = 0;
+            for (size_t i = 0; i < b.size(); ++i) {
+                correct += (a[i] == b[i] + 0.5 * c[i]);
+            }
+            TestAssert::assert_equal_size_t(b.size(), correct);
+            ASSERT_TRUE(a[b.size()] == -1.0);
+        }
+    }
+}
+
+void test_reference_read() {
+    uint32_t words[4] = {0xFFFFFFFFu, 2, 3, 4};
+    const uint8_t* data = reinterpret_cast<const uint8_t*>(words);
+    TestAssert::assert_equal_size_t(8, KernelMatrix::reference_read(4, data, sizeof(words)));  // Modulo 2^32
+    uint64_t halves[2];
+    std::memcpy(halves, words, sizeof(words));
+    ASSERT_TRUE(KernelMatrix::reference_read(64, data, sizeof(words)) == halves[0] + halves[1]);
+}
+
+void test_working_set_levels() {
+    CacheInfo cache = {32 * 1024, 32 * 1024, 1024 * 1024, 32 * 1024 * 1024, 8, 8, 16, 16, 64, 64, 64};
+    TestAssert::assert_equal(std::string("L1"), KernelMatrix::working_set_level(cache, 16 * 1024, 1));
+    TestAssert::assert_equal(std::string("L1"), KernelMatrix::working_set_level(cache, 128 * 1024, 8));
+    TestAssert::assert_equal(std::string("L2"), KernelMatrix::working_set_level(cache, 512 * 1024, 1));
+    TestAssert::assert_equal(std::string("L3"), KernelMatrix::working_set_level(cache, 16 * 1024 * 1024, 1));
+    // Private caches of every thread hold more than the shared L3 of one
+    TestAssert::assert_equal(std::string("L2"), KernelMatrix::working_set_level(cache, 48 * 1024 * 1024, 64));
+    TestAssert::assert_equal(std::string("DRAM"), KernelMatrix::working_set_level(cache, 64 * 1024 * 1024, 4));
+
+    CacheInfo unknown = {};
+    TestAssert::assert_equal(std::string("DRAM"), KernelMatrix::working_set_level(unknown, 1024, 1));
+}
+
+int main() {
+    TestFramework framework;
+
+    TEST_CASE("Instantiations", test_instantiations);
+    TEST_CASE("Shape names", test_shape_names);
+    TEST_CASE("Every shape computes", test_every_shape_computes);
+    TEST_CASE("Reference read", test_reference_read);
+    TEST_CASE("Working-set levels", test_working_set_levels);
+
+    return framework.run_all();
+}
@@ -0,0 +1,104 @@
+#include "test_framework.h"
+#include "../common/mapping_tests.h"
+#include "../common/constants.h"
+#include "../common/errors.h"
+#include <algorithm>
+#include <mutex>
+#include <string>
+#include <vector>
+
+using MappingTests::Operation;
+
+void test_parse_operations() {
+    TestAssert::assert_equal_size_t(5, MappingTests::parse_operations("all").size());
+    std::vector<Operation> ops = MappingTests::parse_operations("munmap,first_touch,munmap");
+    ASSERT_TRUE(ops == std::vector<Operation>({Operation::MUNMAP, Operation::FIRST_TOUCH}));
+    TestAssert::assert_equal(std::string("thp_collapse"), MappingTests::operation_to_string(Operation::THP_COLLAPSE));
+
+    for (const char* bad : {"first_touch,mremap", ""}) {
+        try {
+            MappingTests::parse_operations(bad);
+            ASSERT_TRUE(false);  // Should throw
+        } catch (const ArgumentError&) {
+            ASSERT_TRUE(true);
+        }
+    }
+}
+
+void test_first_touch_faults_every_page() {
+    // 4 MB over two unpinned threads: one fault per base page (or fewer where THP is always on)
+    MappingTests::Result result = MappingTests::run(Operation::FIRST_TOUCH, 3 * BenchmarkConstants::MB, 3, {0, 1},
+                                                    nullptr);
+    ASSERT_TRUE(result.available);
+    TestAssert::assert_equal_size_t(4 * BenchmarkConstants::MB, result.bytes);  // Rounded to whole 2 MB pages
+    TestAssert::assert_equal_size_t(result.bytes / MappingTests::page_bytes(), result.pages);
+    TestAssert::assert_equal_size_t(2, result.num_threads);
+    TestAssert::assert_equal_size_t(0, result.calls);
+    ASSERT_TRUE(result.seconds > 0.0 && result.ns_per_page > 0.0);
+    ASSERT_TRUE(result.minor_faults > 0 && result.minor_faults <= result.pages + 64);
+}
+
+void test_single_threaded_operations() {
+#if defined(__linux__)
+    MappingTests::Result populate = MappingTests::run(Operation::POPULATE, 2 * BenchmarkConstants::MB, 1, {0, 1},
+                                                      nullptr);
+    ASSERT_TRUE(populate.available);
+    TestAssert::assert_equal_size_t(1, populate.num_threads);  // The kernel populates on one thread
+    TestAssert::assert_equal_size_t(1, populate.calls);
+
+    // Available from Linux 6.1 with THP enabled; otherwise the reason is reported
+    MappingTests::Result collapse = MappingTests::run(Operation::THP_COLLAPSE, 2 * BenchmarkConstants::MB, 1, {0},
+                                                      nullptr);
+    ASSERT_TRUE(collapse.available || collapse.note.find("MADV_COLLAPSE") != std::string::npos);
+#else
+    MappingTests::Result populate = MappingTests::run(Operation::POPULATE, 2 * BenchmarkConstants::MB, 1, {0},
+                                                      nullptr);
+    ASSERT_FALSE(populate.available);
+#endif
+}
+
+void test_reclaim_and_unmap() {
+    MappingTests::Result dontneed = MappingTests::run(Operation::DONTNEED, 2 * BenchmarkConstants::MB, 2, {0, 1},
+                                                      nullptr);
+    ASSERT_TRUE(dontneed.available);
+    TestAssert::assert_equal_size_t(1, dontneed.calls);
+
+    MappingTests::Result unmap = MappingTests::run(Operation::MUNMAP, 2 * BenchmarkConstants::MB, 2, {0, 1, 2},
+                                                   nullptr);
+    ASSERT_TRUE(unmap.available);
+    TestAssert::assert_equal_size_t(3, unmap.num_threads);
+    TestAssert::assert_equal_size_t(2 * BenchmarkConstants::MB / BenchmarkConstants::MAPPING_UNMAP_CHUNK, unmap.calls);
+    ASSERT_TRUE(unmap.us_per_call > 0.0);
+}
+
+void test_run_pins_each_thread() {
+    std::vector<size_t> pinned;
+    std::mutex mutex;
+    CoherenceTests::PinFunction pin = [&](size_t cpu) {
+        std::lock_guard<std::mutex> lock(mutex);
+        pinned.push_back(cpu);
+    };
+    MappingTests::run(Operation::MUNMAP, 2 * BenchmarkConstants::MB, 1, {4, 2, 9}, pin);
+    std::sort(pinned.begin(), pinned.end());
+    ASSERT_TRUE(pinned == std::vector<size_t>({2, 4, 9}));
+
+    try {
+        MappingTests::run(Operation::FIRST_TOUCH, BenchmarkConstants::MB, 1, {}, nullptr);
+        ASSERT_TRUE(false);  // Should throw
+    } catch (const ConfigurationError& e) {
+        std::string error_msg = e.what();
+        ASSERT_TRUE(error_msg.find("at least one thread") != std::string::npos);
+    }
+}
+
+int main() {
+    TestFramework framework;
+
+    TEST_CASE("Parse operations", test_parse_operations);
+    TEST_CASE("First touch faults every page", test_first_touch_faults_every_page);
+    TEST_CASE("Single-threaded operations", test_single_threaded_operations);
+    TEST_CASE("Reclaim and unmap", test_reclaim_and_unmap);
+    TEST_CASE("Run pins each thread", test_run_pins_each_thread);
+
+    return framework.run_all();
+}
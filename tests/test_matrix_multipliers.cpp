@@ -0,0 +1,261 @@
+#include "test_framework.h"
+#include "../common/blocked_gemm.h"
+#include "../common/platform_interface.h"
+#include "../common/standard_tests.h"
+#include <atomic>
+#include <cmath>
+#include <string>
+#include <vector>
+
+namespace {
+
+// Deliberately not multiples of any register or tile block
+const size_t M = 45;
+const size_t K = 37;
+const size_t N = 53;
+
+template <typename T>
+std::vector<double> reference_product(const std::vector<T>& A, const std::vector<T>& B,
+                                      size_t m, size_t k, size_t n) {
+    std::vector<double> C(m * n, 0.0);
+    for (size_t i = 0; i < m; ++i) {
+        for (size_t p = 0; p < k; ++p) {
+            for (size_t j = 0; j < n; ++j) {
+                C[i * n + j] += static_cast<double>(A[i * k + p]) * B[p * n + j];
+            }
+        }
+    }
+    return C;
+}
+
+// Reference product of stored operands, widened the way the kernels widen them
+template <typename In>
+std::vector<double> widened_reference(const std::vector<In>& A, const std::vector<In>& B) {
+    std::vector<double> a(A.size()), b(B.size());
+    for (size_t i = 0; i < A.size(); ++i) {
+        a[i] = MatrixMultiply::BlockedGemm::widen<double>(A[i]);
+    }
+    for (size_t i = 0; i < B.size(); ++i) {
+        b[i] = MatrixMultiply::BlockedGemm::widen<double>(B[i]);
+    }
+    return reference_product(a, b, M, K, N);
+}
+
+template <typename T>
+double max_error(const std::vector<T>& C, const std::vector<double>& reference, double scale) {
+    double error = 0.0;
+    for (size_t i = 0; i < C.size(); ++i) {
+        error = std::max(error, std::abs(C[i] - scale * reference[i]));
+    }
+    return error;
+}
+
+void scalar_kernel_4x3(size_t kc, const double* a, const double* b, double* c, size_t ldc) {
+    for (size_t k = 0; k < kc; ++k) {
+        for (size_t i = 0; i < 4; ++i) {
+            for (size_t j = 0; j < 3; ++j) {
+                c[i * ldc + j] += a[k * 4 + i] * b[k * 3 + j];
+            }
+        }
+    }
+}
+
+}  // namespace
+
+void test_blocked_driver_edges() {
+    std::vector<double> A(M * K), B(K * N), C(M * N, 0.0);
+    MatrixMultiply::initialize_matrix_random(A.data(), M, K, 1.0);
+    MatrixMultiply::initialize_matrix_random(B.data(), K, N, 1.0);
+
+    // Small blocks force several packed panels and partial tiles on every edge
+    MatrixMultiply::BlockedGemm::Blocking blocking = {4, 3, 8, 10, 12};
+    MatrixMultiply::BlockedGemm::Workspace<double> workspace;
+    MatrixMultiply::BlockedGemm::multiply(C.data(), A.data(), B.data(), M, K, N, blocking,
+                                          scalar_kernel_4x3, workspace);
+
+    ASSERT_TRUE(max_error(C, reference_product(A, B, M, K, N), 1.0) < 1e-12);
+}
+
+void test_timed_multiply_counts_iterations() {
+    std::vector<double> A(M * K), B(K * N), C(M * N, 0.0);
+    MatrixMultiply::initialize_matrix_random(A.data(), M, K, 1.0);
+    MatrixMultiply::initialize_matrix_random(B.data(), K, N, 1.0);
+
+    MatrixMultiply::MatrixConfig config = {M, K, N, 3, true, false};
+    MatrixMultiply::BlockedGemm::Blocking blocking = {4, 3, 16, 16, 16};
+    MatrixMultiply::BlockedGemm::Workspace<double> workspace;
+    std::atomic<bool> stop_flag{false};
+    auto stats = MatrixMultiply::BlockedGemm::timed_multiply(C.data(), A.data(), B.data(), config, stop_flag,
+                                                             blocking, scalar_kernel_4x3, workspace, "scalar");
+
+    // C is cleared once, then accumulates every iteration
+    ASSERT_TRUE(max_error(C, reference_product(A, B, M, K, N), 3.0) < 1e-12);
+    TestAssert::assert_equal_size_t(2 * M * N * K * 3, stats.operations);
+    ASSERT_EQ(std::string("scalar"), stats.acceleration);
+
+    // A stop request before the first iteration reports no work
+    stop_flag = true;
+    stats = MatrixMultiply::BlockedGemm::timed_multiply(C.data(), A.data(), B.data(), config, stop_flag,
+                                                        blocking, scalar_kernel_4x3, workspace, "scalar");
+    TestAssert::assert_equal_size_t(0, stats.operations);
+}
+
+void test_blocking_for_cache() {
+    CacheInfo cache = {48 * 1024, 32 * 1024, 2 * 1024 * 1024, 32 * 1024 * 1024, 12, 8, 16, 16, 64, 64, 64};
+    auto blocking = MatrixMultiply::BlockedGemm::blocking_for_cache(cache, 12, 32, sizeof(float));
+
+    TestAssert::assert_equal_size_t(12, blocking.mr);
+    TestAssert::assert_equal_size_t(32, blocking.nr);
+    ASSERT_TRUE(blocking.kc * blocking.nr * sizeof(float) <= cache.l1_data_size / 2);
+    ASSERT_TRUE(blocking.mc * blocking.kc * sizeof(float) <= cache.l2_size / 2);
+    ASSERT_TRUE(blocking.mc % blocking.mr == 0);
+    ASSERT_TRUE(blocking.nc % blocking.nr == 0);
+
+    // Undetected caches still produce usable blocks
+    CacheInfo unknown = {};
+    auto fallback = MatrixMultiply::BlockedGemm::blocking_for_cache(unknown, 4, 16, sizeof(double));
+    ASSERT_TRUE(fallback.kc >= 16 && fallback.mc >= 4 && fallback.nc >= 16);
+}
+
+void test_portable_kernel() {
+    std::vector<float> A(M * K), B(K * N), C(M * N, 0.0f);
+    MatrixMultiply::initialize_matrix_random(A.data(), M, K, 1.0f);
+    MatrixMultiply::initialize_matrix_random(B.data(), K, N, 1.0f);
+
+    CacheInfo cache = {32 * 1024, 32 * 1024, 1024 * 1024, 8 * 1024 * 1024, 8, 8, 16, 16, 64, 64, 64};
+    auto blocking = MatrixMultiply::BlockedGemm::blocking_for_cache(
+        cache, MatrixMultiply::BlockedGemm::PORTABLE_MR, MatrixMultiply::BlockedGemm::PORTABLE_NR, sizeof(float));
+    MatrixMultiply::BlockedGemm::Workspace<float> workspace;
+    MatrixMultiply::BlockedGemm::multiply(C.data(), A.data(), B.data(), M, K, N, blocking,
+                                          MatrixMultiply::BlockedGemm::portable_kernel<float>, workspace);
+
+    ASSERT_TRUE(max_error(C, reference_product(A, B, M, K, N), 1.0) < 1e-4);
+}
+
+void test_platform_multiplier_float() {
+    auto platform = create_platform_interface();
+    auto multiplier = platform->create_matrix_multiplier();
+    if (!multiplier || !multiplier->is_available()) {
+        return;  // Portable fallback only; nothing platform-specific to check
+    }
+
+    std::vector<float> A(M * K), B(K * N), C(M * N, 0.0f);
+    MatrixMultiply::initialize_matrix_random(A.data(), M, K, 1.0f);
+    MatrixMultiply::initialize_matrix_random(B.data(), K, N, 1.0f);
+
+    MatrixMultiply::MatrixConfig config = {M, K, N, 2, false, false};
+    std::atomic<bool> stop_flag{false};
+    auto stats = multiplier->multiply_float(C.data(), A.data(), B.data(), config, stop_flag);
+
+    // BF16 inputs keep 8 significant bits; FP32 FMA is exact to ~1e-6 here
+    bool reduced_precision = stats.acceleration.find("BF16") != std::string::npos;
+    double tolerance = reduced_precision ? 0.1 : 1e-3;
+    ASSERT_TRUE(max_error(C, reference_product(A, B, M, K, N), 2.0) < tolerance);
+    TestAssert::assert_equal_size_t(2 * M * N * K * 2, stats.operations);
+    ASSERT_TRUE(stats.gflops > 0.0);
+    ASSERT_FALSE(stats.acceleration.empty());
+}
+
+void test_platform_multiplier_double() {
+    auto platform = create_platform_interface();
+    auto multiplier = platform->create_matrix_multiplier();
+    if (!multiplier || !multiplier->is_available()) {
+        return;
+    }
+
+    std::vector<double> A(M * K), B(K * N), C(M * N, 0.0);
+    MatrixMultiply::initialize_matrix_random(A.data(), M, K, 1.0);
+    MatrixMultiply::initialize_matrix_random(B.data(), K, N, 1.0);
+
+    MatrixMultiply::MatrixConfig config = {M, K, N, 1, true, false};
+    std::atomic<bool> stop_flag{false};
+    auto stats = multiplier->multiply_double(C.data(), A.data(), B.data(), config, stop_flag);
+
+    ASSERT_TRUE(max_error(C, reference_product(A, B, M, K, N), 1.0) < 1e-10);
+    TestAssert::assert_equal_size_t(2 * M * N * K, stats.operations);
+}
+
+void test_blocked_driver_widens_operands() {
+    std::vector<int8_t> A(M * K), B(K * N);
+    std::vector<int32_t> C(M * N, 0);
+    MatrixMultiply::initialize_matrix_random(MatrixMultiply::MatrixPrecision::INT8, A.data(), M, K);
+    MatrixMultiply::initialize_matrix_random(MatrixMultiply::MatrixPrecision::INT8, B.data(), K, N);
+
+    MatrixMultiply::MatrixConfig config = {M, K, N, 2, false, false, MatrixMultiply::MatrixPrecision::INT8};
+    std::atomic<bool> stop_flag{false};
+    auto stats = MatrixMultiply::BlockedGemm::portable_multiply(C.data(), A.data(), B.data(), config, stop_flag,
+                                                                CacheInfo{}, "portable");
+
+    // Integer products are exact
+    ASSERT_TRUE(max_error(C, widened_reference(A, B), 2.0) == 0.0);
+    // INT8 operands and an INT32 result per iteration
+    TestAssert::assert_equal_size_t(((M * K + K * N) + M * N * 4) * 2, stats.bytes_processed);
+    ASSERT_TRUE(stats.arithmetic_intensity > 0.0);
+}
+
+void test_portable_reduced_precision() {
+    std::vector<MatrixMultiply::BFloat16> A(M * K), B(K * N);
+    std::vector<float> C(M * N, 0.0f);
+    MatrixMultiply::initialize_matrix_random(MatrixMultiply::MatrixPrecision::BF16, A.data(), M, K);
+    MatrixMultiply::initialize_matrix_random(MatrixMultiply::MatrixPrecision::BF16, B.data(), K, N);
+
+    MatrixMultiply::MatrixConfig config = {M, K, N, 1, false, false, MatrixMultiply::MatrixPrecision::BF16};
+    std::atomic<bool> stop_flag{false};
+    auto stats = StandardTests::matrix_multiply_test(C.data(), A.data(), B.data(), config, nullptr, CacheInfo{},
+                                                     stop_flag);
+
+    // Widened BF16 products accumulate exactly enough in FP32 to match the reference
+    ASSERT_TRUE(max_error(C, widened_reference(A, B), 1.0) < 1e-4);
+    ASSERT_EQ(std::string("Blocked portable (BF16 via FP32)"), stats.acceleration);
+}
+
+void test_platform_multiplier_precisions() {
+    auto platform = create_platform_interface();
+    auto multiplier = platform->create_matrix_multiplier();
+    if (!multiplier || !multiplier->is_available()) {
+        return;
+    }
+    std::atomic<bool> stop_flag{false};
+
+    std::vector<MatrixMultiply::BFloat16> A16(M * K), B16(K * N);
+    std::vector<float> C(M * N, 0.0f);
+    MatrixMultiply::initialize_matrix_random(MatrixMultiply::MatrixPrecision::BF16, A16.data(), M, K);
+    MatrixMultiply::initialize_matrix_random(MatrixMultiply::MatrixPrecision::BF16, B16.data(), K, N);
+    MatrixMultiply::MatrixConfig config = {M, K, N, 1, false, false, MatrixMultiply::MatrixPrecision::BF16};
+    auto stats = multiplier->multiply(C.data(), A16.data(), B16.data(), config, stop_flag);
+    ASSERT_TRUE(max_error(C, widened_reference(A16, B16), 1.0) < 1e-4);
+    TestAssert::assert_equal_size_t(2 * M * N * K, stats.operations);
+
+    std::vector<MatrixMultiply::Float16> Ah(M * K), Bh(K * N);
+    MatrixMultiply::initialize_matrix_random(MatrixMultiply::MatrixPrecision::FP16, Ah.data(), M, K);
+    MatrixMultiply::initialize_matrix_random(MatrixMultiply::MatrixPrecision::FP16, Bh.data(), K, N);
+    config.precision = MatrixMultiply::MatrixPrecision::FP16;
+    multiplier->multiply(C.data(), Ah.data(), Bh.data(), config, stop_flag);
+    ASSERT_TRUE(max_error(C, widened_reference(Ah, Bh), 1.0) < 1e-4);
+
+    std::vector<int8_t> A8(M * K), B8(K * N);
+    std::vector<int32_t> C32(M * N, 0);
+    MatrixMultiply::initialize_matrix_random(MatrixMultiply::MatrixPrecision::INT8, A8.data(), M, K);
+    MatrixMultiply::initialize_matrix_random(MatrixMultiply::MatrixPrecision::INT8, B8.data(), K, N);
+    config.precision = MatrixMultiply::MatrixPrecision::INT8;
+    config.iterations = 3;
+    stats = multiplier->multiply(C32.data(), A8.data(), B8.data(), config, stop_flag);
+    ASSERT_TRUE(max_error(C32, widened_reference(A8, B8), 3.0) == 0.0);
+    ASSERT_FALSE(stats.acceleration.empty());
+}
+
+int main() {
+    TestFramework framework;
+
+    TEST_CASE("Blocked driver edges", test_blocked_driver_edges);
+    TEST_CASE("Timed multiply counts iterations", test_timed_multiply_counts_iterations);
+    TEST_CASE("Blocking for cache", test_blocking_for_cache);
+    TEST_CASE("Portable kernel", test_portable_kernel);
+    TEST_CASE("Platform multiplier float", test_platform_multiplier_float);
+    TEST_CASE("Platform multiplier double", test_platform_multiplier_double);
+    TEST_CASE("Blocked driver widens operands", test_blocked_driver_widens_operands);
+    TEST_CASE("Portable reduced precision", test_portable_reduced_precision);
+    TEST_CASE("Platform multiplier precisions", test_platform_multiplier_precisions);
+
+    return framework.run_all();
+}
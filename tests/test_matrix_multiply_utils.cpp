@@ -125,6 +125,8 @@ void test_calculate_matrix_stats() {
     
     double expected_latency = (0.5 * 1e9) / 1000000000; // (time * 1e9) / ops = 0.5 ns
     ASSERT_TRUE(std::abs(stats.latency_ns - expected_latency) < 1e-10);
+
+    ASSERT_TRUE(std::abs(stats.arithmetic_intensity - 1000.0) < 1e-10);  // ops / bytes
 }
 
 void test_calculate_matrix_stats_edge_cases() {
@@ -157,6 +159,74 @@ void test_matrix_config_edge_cases() {
     ASSERT_TRUE(large_footprint == 3000000 * sizeof(double));
 }
 
+void test_precision_helpers() {
+    MatrixConfig bf16 = create_matrix_config(100, 1, MatrixPrecision::BF16);
+    ASSERT_FALSE(bf16.use_double);
+    ASSERT_TRUE(bf16.precision == MatrixPrecision::BF16);
+    ASSERT_TRUE(create_matrix_config(100, 1, true).precision == MatrixPrecision::FP64);
+    // BF16 operands, FP32 result: 20000 * 2 + 10000 * 4 bytes
+    ASSERT_TRUE(calculate_matrix_memory_footprint(bf16) == 80000);
+    // INT8 operands, INT32 result: 20000 * 1 + 10000 * 4 bytes
+    ASSERT_TRUE(calculate_matrix_memory_footprint(create_matrix_config(100, 1, MatrixPrecision::INT8)) == 60000);
+
+    ASSERT_EQ(std::string("FP16"), precision_to_string(MatrixPrecision::FP16));
+    ASSERT_EQ(std::string("INT32"), accumulate_to_string(MatrixPrecision::INT8));
+    ASSERT_EQ(std::string("FP32"), accumulate_to_string(MatrixPrecision::BF16));
+    ASSERT_EQ(std::string("AVX-512 FMA (BF16 via FP32)"),
+              converted_acceleration_name("AVX-512 FMA", MatrixPrecision::BF16));
+}
+
+void test_parse_precisions() {
+    std::vector<MatrixPrecision> precisions;
+    ASSERT_TRUE(parse_precisions("bf16,INT8,bf16", precisions));
+    TestAssert::assert_equal_size_t(2, precisions.size());
+    ASSERT_TRUE(precisions[0] == MatrixPrecision::BF16);
+    ASSERT_TRUE(precisions[1] == MatrixPrecision::INT8);
+
+    ASSERT_TRUE(parse_precisions("all", precisions));
+    TestAssert::assert_equal_size_t(5, precisions.size());
+    ASSERT_TRUE(precisions[0] == MatrixPrecision::FP64);
+
+    // Rejected lists leave the previous selection untouched
+    ASSERT_FALSE(parse_precisions("fp8", precisions));
+    ASSERT_FALSE(parse_precisions("", precisions));
+    TestAssert::assert_equal_size_t(5, precisions.size());
+}
+
+void test_bfloat16_conversion() {
+    ASSERT_TRUE(to_bfloat16(1.0f).bits == 0x3F80);
+    ASSERT_TRUE(to_bfloat16(-2.0f).bits == 0xC000);
+    ASSERT_TRUE(to_float(to_bfloat16(0.15625f)) == 0.15625f);
+    // 1 + 2^-8 is halfway between 1 and 1 + 2^-7: ties go to the even mantissa
+    ASSERT_TRUE(to_bfloat16(1.0f + 1.0f / 256).bits == 0x3F80);
+    ASSERT_TRUE(to_bfloat16(1.0f + 3.0f / 256).bits == 0x3F82);
+    ASSERT_TRUE(std::isnan(to_float(to_bfloat16(std::nanf("")))));
+}
+
+void test_float16_conversion() {
+    ASSERT_TRUE(to_float16(1.0f).bits == 0x3C00);
+    ASSERT_TRUE(to_float16(-0.5f).bits == 0xB800);
+    ASSERT_TRUE(to_float16(65504.0f).bits == 0x7BFF);
+    ASSERT_TRUE(to_float16(70000.0f).bits == 0x7C00);  // Overflows to infinity
+    ASSERT_TRUE(to_float16(std::ldexp(1.0f, -24)).bits == 0x0001);  // Smallest subnormal
+    ASSERT_TRUE(to_float16(std::ldexp(1.0f, -26)).bits == 0x0000);
+    ASSERT_TRUE(to_float(Float16{0x0001}) == std::ldexp(1.0f, -24));
+    ASSERT_TRUE(to_float16(1.0f / 3).bits == 0x3555);
+    ASSERT_TRUE(std::abs(to_float(to_float16(1.0f / 3)) - 1.0f / 3) < 1e-3f);
+    ASSERT_TRUE(std::isnan(to_float(to_float16(std::nanf("")))));
+}
+
+void test_initialize_matrix_random_int8() {
+    std::vector<int8_t> matrix(1000);
+    initialize_matrix_random(MatrixPrecision::INT8, matrix.data(), 10, 100);
+    bool varied = false;
+    for (int8_t value : matrix) {
+        ASSERT_TRUE(value >= -64 && value <= 63);
+        varied = varied || value != matrix[0];
+    }
+    ASSERT_TRUE(varied);
+}
+
 int main() {
     TestFramework framework;
     
@@ -168,6 +238,11 @@ int main() {
     TEST_CASE("Calculate matrix stats", test_calculate_matrix_stats);
     TEST_CASE("Calculate matrix stats edge cases", test_calculate_matrix_stats_edge_cases);
     TEST_CASE("Matrix config edge cases", test_matrix_config_edge_cases);
+    TEST_CASE("Precision helpers", test_precision_helpers);
+    TEST_CASE("Parse precisions", test_parse_precisions);
+    TEST_CASE("BFloat16 conversion", test_bfloat16_conversion);
+    TEST_CASE("Float16 conversion", test_float16_conversion);
+    TEST_CASE("Initialize matrix random int8", test_initialize_matrix_random_int8);
     
     return framework.run_all();
 }
\ No newline at end of file
@@ -0,0 +1,138 @@
+#include "test_framework.h"
+#include "../common/membench.h"
+#include "../common/errors.h"
+#include <chrono>
+#include <iostream>
+#include <sstream>
+#include <string>
+
+namespace {
+
+const size_t PROBE_BYTES = 4 * 1024 * 1024;
+
+Membench::ProbeConfig probe(const std::string& pattern) {
+    Membench::ProbeConfig config;
+    config.pattern = pattern;
+    config.working_set_bytes = PROBE_BYTES;
+    config.threads = 1;
+    return config;
+}
+
+void expect_argument_error(Membench::Engine& engine, const Membench::ProbeConfig& config, const std::string& text) {
+    try {
+        engine.configure(config);
+        ASSERT_TRUE(false);  // Should throw
+    } catch (const ArgumentError& e) {
+        std::string error_msg = e.what();
+        ASSERT_TRUE(error_msg.find(text) != std::string::npos);
+    }
+}
+
+}  // namespace
+
+void test_engine_options() {
+    Membench::Options options;
+    options.kernel = "scalar";
+    Membench::Engine engine(options);
+    TestAssert::assert_equal(std::string("scalar"), engine.host().kernel);
+    ASSERT_TRUE(engine.host().cpu_threads >= 1);
+
+    options.kernel = "avx1024";
+    try {
+        Membench::Engine unknown(options);
+        ASSERT_TRUE(false);  // Should throw
+    } catch (const ArgumentError&) {
+        ASSERT_TRUE(true);
+    }
+}
+
+void test_configure_validation() {
+    Membench::Engine engine;
+    expect_argument_error(engine, probe("all"), "Unknown pattern");
+    expect_argument_error(engine, probe("matrix_multiply"), "compute-bound");
+
+    Membench::ProbeConfig threads = probe("copy");
+    threads.threads = engine.host().cpu_threads + 1;
+    expect_argument_error(engine, threads, "Probe threads");
+
+    Membench::ProbeConfig tiny = probe("copy");
+    tiny.working_set_bytes = 16;
+    expect_argument_error(engine, tiny, "working set");
+
+    Membench::ProbeConfig no_budget = probe("copy");
+    no_budget.time_budget_seconds = 0.0;
+    expect_argument_error(engine, no_budget, "time budget");
+
+    Membench::ProbeConfig policies = probe("copy");
+    policies.store_policy = "temporal,clzero";
+    expect_argument_error(engine, policies, "single store policy");
+}
+
+void test_run_requires_configure() {
+    Membench::Engine engine;
+    try {
+        engine.run();
+        ASSERT_TRUE(false);  // Should throw
+    } catch (const ConfigurationError& e) {
+        std::string error_msg = e.what();
+        ASSERT_TRUE(error_msg.find("configure()") != std::string::npos);
+    }
+}
+
+void test_fixed_iterations() {
+    Membench::Engine engine;
+    Membench::ProbeConfig config = probe("triad");
+    config.iterations = 2;
+    engine.configure(config);
+
+    Membench::ProbeResult result = engine.run();
+    TestAssert::assert_equal(std::string("Triad"), result.test_name);
+    TestAssert::assert_equal(std::string("temporal"), result.store_policy);
+    TestAssert::assert_equal_size_t(2, result.iterations);
+    TestAssert::assert_equal_size_t(1, result.repetitions);
+    TestAssert::assert_equal_size_t(1, result.threads);
+    TestAssert::assert_equal_size_t(PROBE_BYTES, result.working_set_bytes);
+    ASSERT_TRUE(result.bandwidth_gbps > 0.0);
+    ASSERT_TRUE(result.verified);
+}
+
+void test_probe_within_budget() {
+    // Startup and a probe must fit a scheduler's health-check slot and print nothing
+    std::stringstream captured;
+    std::streambuf* saved = std::cout.rdbuf(captured.rdbuf());
+    auto start = std::chrono::steady_clock::now();
+
+    Membench::Engine engine;
+    engine.configure(probe("sequential_read"));
+    Membench::ProbeResult result = engine.run_with_budget(0.1);
+
+    double elapsed = std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count();
+    std::cout.rdbuf(saved);
+
+    ASSERT_TRUE(captured.str().empty());
+    ASSERT_TRUE(result.bandwidth_gbps > 0.0);
+    ASSERT_TRUE(result.repetitions >= 1);
+    ASSERT_TRUE(result.elapsed_seconds <= 0.1);
+    ASSERT_TRUE(elapsed < 0.2);
+
+    // Buffers stay allocated: a second probe reuses them
+    ASSERT_TRUE(engine.run_with_budget(0.05).bandwidth_gbps > 0.0);
+    try {
+        engine.run_with_budget(0.0);
+        ASSERT_TRUE(false);  // Should throw
+    } catch (const ArgumentError&) {
+        ASSERT_TRUE(true);
+    }
+}
+
+int main() {
+    TestFramework framework;
+
+    TEST_CASE("Engine options", test_engine_options);
+    TEST_CASE("Configure validation", test_configure_validation);
+    TEST_CASE("Run requires configure", test_run_requires_configure);
+    TEST_CASE("Fixed iterations", test_fixed_iterations);
+    TEST_CASE("Probe within budget", test_probe_within_budget);
+
+    return framework.run_all();
+}
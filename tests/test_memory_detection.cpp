@@ -0,0 +1,292 @@
+#include "test_framework.h"
+#include "../common/memory_detection.h"
+#include <cstdio>
+#include <cstdlib>
+#include <fstream>
+#include <string>
+#include <sys/stat.h>
+#include <unistd.h>
+#include <vector>
+
+using MemoryDetection::MemoryDevice;
+using MemoryDetection::MemoryLayout;
+
+namespace {
+
+void put_word(std::vector<uint8_t>& table, size_t offset, uint16_t value) {
+    table[offset] = static_cast<uint8_t>(value & 0xFF);
+    table[offset + 1] = static_cast<uint8_t>(value >> 8);
+}
+
+// Append an SMBIOS 3.x type 17 structure (length 0x5C) with its two locator strings
+void add_memory_device(std::vector<uint8_t>& table, uint16_t array, uint16_t size_mb, uint8_t type,
+                       uint16_t speed, uint16_t configured_speed, const std::string& locator,
+                       const std::string& bank) {
+    std::vector<uint8_t> device(0x5C, 0);
+    device[0] = 17;
+    device[1] = 0x5C;
+    put_word(device, 0x04, array);
+    put_word(device, 0x08, 72);
+    put_word(device, 0x0A, 64);
+    put_word(device, 0x0C, size_mb);
+    device[0x10] = 1;
+    device[0x11] = 2;
+    device[0x12] = type;
+    put_word(device, 0x15, speed);
+    put_word(device, 0x20, configured_speed);
+    for (const auto& text : {locator, bank}) {
+        device.insert(device.end(), text.begin(), text.end());
+        device.push_back(0);
+    }
+    device.push_back(0);
+    table.insert(table.end(), device.begin(), device.end());
+}
+
+// A structure of another type without strings, and the end-of-table marker
+void add_structure(std::vector<uint8_t>& table, uint8_t type) {
+    std::vector<uint8_t> structure = {type, 4, 0, 0, 0, 0};
+    table.insert(table.end(), structure.begin(), structure.end());
+}
+
+MemoryDevice device(uint16_t array, const std::string& locator, const std::string& bank) {
+    MemoryDevice d;
+    d.array_handle = array;
+    d.locator = locator;
+    d.bank_locator = bank;
+    d.type = "DDR5";
+    d.populated = true;
+    d.size_mb = 32768;
+    d.data_width_bits = 64;
+    d.total_width_bits = 80;
+    d.configured_speed_mtps = 4800;
+    return d;
+}
+
+void write_file(const std::string& path, const std::string& text) {
+    std::ofstream file(path);
+    file << text << "\n";
+}
+
+}  // namespace
+
+void test_parse_smbios_memory_devices() {
+    std::vector<uint8_t> table;
+    add_structure(table, 16);
+    add_memory_device(table, 0x1000, 16384, 0x1A, 3200, 2933, "DIMM_A1", "NODE 0");
+    add_memory_device(table, 0x1000, 0, 0x02, 0, 0, "DIMM_A2", "NODE 0");  // empty slot
+    size_t extended = table.size();
+    add_memory_device(table, 0x1000, 0x7FFF, 0x22, 0xFFFF, 5600, "DIMM_B1", "NODE 0");
+    put_word(table, extended + 0x1E, 0x0004);  // Extended size 0x00040000 MB (256 GB)
+    put_word(table, extended + 0x54, 8000);    // Extended speed
+    add_structure(table, 127);
+    add_memory_device(table, 0x1000, 8192, 0x1A, 3200, 3200, "after end", "NODE 0");
+
+    std::vector<MemoryDevice> devices = MemoryDetection::parse_smbios_memory_devices(table);
+    TestAssert::assert_equal_size_t(3, devices.size());
+    TestAssert::assert_equal(std::string("DIMM_A1"), devices[0].locator);
+    TestAssert::assert_equal(std::string("NODE 0"), devices[0].bank_locator);
+    TestAssert::assert_equal(std::string("DDR4"), devices[0].type);
+    ASSERT_TRUE(devices[0].populated);
+    TestAssert::assert_equal_size_t(16384, devices[0].size_mb);
+    TestAssert::assert_equal_size_t(64, devices[0].data_width_bits);
+    TestAssert::assert_equal_size_t(72, devices[0].total_width_bits);
+    TestAssert::assert_equal_size_t(3200, devices[0].speed_mtps);
+    TestAssert::assert_equal_size_t(2933, devices[0].configured_speed_mtps);
+    ASSERT_FALSE(devices[1].populated);
+    TestAssert::assert_equal(std::string(""), devices[1].type);
+    TestAssert::assert_equal(std::string("DDR5"), devices[2].type);
+    TestAssert::assert_equal_size_t(262144, devices[2].size_mb);
+    TestAssert::assert_equal_size_t(8000, devices[2].speed_mtps);
+
+    // A truncated table yields the structures that fit
+    table.resize(0x5C + 6);
+    TestAssert::assert_equal_size_t(0, MemoryDetection::parse_smbios_memory_devices(table).size());
+    TestAssert::assert_equal_size_t(0, MemoryDetection::parse_smbios_memory_devices({}).size());
+}
+
+void test_channel_of() {
+    TestAssert::assert_equal(std::string("P0/channel A"), MemoryDetection::channel_of(device(1, "P0 CHANNEL A", "BANK 0")));
+    TestAssert::assert_equal(std::string("P0/NODE0/channel 1"),
+                             MemoryDetection::channel_of(device(1, "DIMM 0", "P0_Node0_Channel1_Dimm0")));
+    TestAssert::assert_equal(std::string("CONTROLLER1/channel B"),
+                             MemoryDetection::channel_of(device(1, "Controller1-ChannelB-DIMM0", "BANK 0")));
+    TestAssert::assert_equal(std::string("CPU1/channel C"), MemoryDetection::channel_of(device(1, "CPU1_DIMM_C2", "")));
+    TestAssert::assert_equal(std::string("P2/channel D"), MemoryDetection::channel_of(device(1, "P2-DIMMD1", "")));
+    TestAssert::assert_equal(std::string(""), MemoryDetection::channel_of(device(1, "A1", "")));
+    TestAssert::assert_equal(std::string(""), MemoryDetection::channel_of(device(1, "DIMM 0", "BANK 0")));
+}
+
+void test_layout_from_devices() {
+    // Two sockets of four channels; socket 0 has a second DIMM on channel A, socket 1 a slower one on F
+    std::vector<MemoryDevice> devices;
+    for (const char* channel : {"A", "B", "C", "D"}) {
+        devices.push_back(device(1, std::string("P0 CHANNEL ") + channel, "BANK 0"));
+        devices.push_back(device(2, std::string("P1 CHANNEL ") + channel, "BANK 0"));
+    }
+    devices.push_back(device(1, "P0 CHANNEL A", "BANK 1"));
+    MemoryDevice slow = device(2, "P1 CHANNEL F", "BANK 0");
+    slow.configured_speed_mtps = 4400;
+    devices.push_back(slow);
+    MemoryDevice empty = device(2, "P1 CHANNEL G", "BANK 0");
+    empty.populated = false;
+    devices.push_back(empty);
+
+    MemoryLayout layout;
+    ASSERT_TRUE(MemoryDetection::layout_from_devices(devices, layout));
+    TestAssert::assert_equal(std::string("DDR5"), layout.type);
+    TestAssert::assert_equal_size_t(9, layout.channels);
+    TestAssert::assert_equal_size_t(2, layout.sockets);
+    TestAssert::assert_equal_size_t(10, layout.devices);
+    TestAssert::assert_equal_size_t(4400, layout.speed_mtps);
+    TestAssert::assert_equal_size_t(320, layout.total_size_gb);
+    TestAssert::assert_equal(std::string("SMBIOS"), layout.source);
+
+    // Locators without channels: one channel per DIMM
+    ASSERT_TRUE(MemoryDetection::layout_from_devices({device(1, "A1", ""), device(1, "A2", "")}, layout));
+    TestAssert::assert_equal_size_t(2, layout.channels);
+
+    // A VM's synthetic "RAM" devices are not DRAM
+    MemoryDevice ram = device(1, "DIMM 0", "");
+    ram.type = "";
+    ASSERT_FALSE(MemoryDetection::layout_from_devices({ram}, layout));
+}
+
+void test_read_smbios_layout() {
+    char path_template[] = "/tmp/smbios_XXXXXX";
+    int fd = mkstemp(path_template);
+    ASSERT_TRUE(fd >= 0);
+    close(fd);
+    std::vector<uint8_t> table;
+    add_memory_device(table, 1, 16384, 0x1A, 3200, 3200, "ChannelA-DIMM0", "BANK 0");
+    add_memory_device(table, 1, 16384, 0x1A, 3200, 3200, "ChannelB-DIMM0", "BANK 2");
+    add_structure(table, 127);
+    {
+        std::ofstream file(path_template, std::ios::binary);
+        file.write(reinterpret_cast<const char*>(table.data()), static_cast<std::streamsize>(table.size()));
+    }
+
+    MemoryLayout layout;
+    ASSERT_TRUE(MemoryDetection::read_smbios_layout(layout, path_template));
+    TestAssert::assert_equal_size_t(2, layout.channels);
+    TestAssert::assert_equal_size_t(3200, layout.speed_mtps);
+    std::remove(path_template);
+    ASSERT_FALSE(MemoryDetection::read_smbios_layout(layout, path_template));
+}
+
+void test_read_edac_layout() {
+    char root_template[] = "/tmp/edac_XXXXXX";
+    ASSERT_TRUE(mkdtemp(root_template) != nullptr);
+    std::string root = root_template;
+    struct Dimm {
+        const char* path;
+        const char* size;
+        const char* location;
+    };
+    const Dimm dimms[] = {
+        {"/mc0/dimm0", "32768", "channel 0 slot 0"},
+        {"/mc0/dimm1", "32768", "channel 0 slot 1"},
+        {"/mc0/dimm2", "32768", "channel 1 slot 0"},
+        {"/mc0/dimm3", "0", "channel 2 slot 0"},
+        {"/mc1/dimm0", "32768", "channel 0 slot 0"},
+    };
+    mkdir((root + "/mc0").c_str(), 0755);
+    mkdir((root + "/mc1").c_str(), 0755);
+    for (const auto& dimm : dimms) {
+        std::string dir = root + dimm.path;
+        mkdir(dir.c_str(), 0755);
+        write_file(dir + "/size", dimm.size);
+        write_file(dir + "/dimm_mem_type", "Registered-DDR4");
+        write_file(dir + "/dimm_location", dimm.location);
+    }
+
+    MemoryLayout layout;
+    ASSERT_TRUE(MemoryDetection::read_edac_layout(layout, root));
+    TestAssert::assert_equal(std::string("DDR4"), layout.type);
+    TestAssert::assert_equal_size_t(3, layout.channels);
+    TestAssert::assert_equal_size_t(2, layout.sockets);
+    TestAssert::assert_equal_size_t(4, layout.devices);
+    TestAssert::assert_equal_size_t(0, layout.speed_mtps);
+    TestAssert::assert_equal(std::string("EDAC"), layout.source);
+    ASSERT_FALSE(MemoryDetection::read_edac_layout(layout, root + "/missing"));
+
+    std::string cleanup = "rm -rf " + root;
+    ASSERT_TRUE(std::system(cleanup.c_str()) == 0);
+}
+
+void test_apply_layout() {
+    MemorySpecs specs = {};
+    specs.type = "DDR4";
+    specs.speed_mtps = 3200;
+    specs.data_width_bits = 64;
+    specs.num_channels = 2;
+
+    MemoryLayout layout;
+    layout.type = "DDR5";
+    layout.speed_mtps = 4800;
+    layout.data_width_bits = 64;
+    layout.total_width_bits = 80;
+    layout.channels = 12;
+    layout.sockets = 2;
+    layout.source = "SMBIOS";
+    MemoryDetection::apply_layout(layout, specs);
+    TestAssert::assert_equal(std::string("DDR5"), specs.type);
+    ASSERT_TRUE(specs.speed_detected && specs.num_channels_detected && specs.total_width_detected);
+    ASSERT_TRUE(specs.theoretical_bandwidth_gbps > 460.7 && specs.theoretical_bandwidth_gbps < 460.9);
+    TestAssert::assert_equal(std::string("SMBIOS (2 sockets)"), specs.detection_source);
+
+    // EDAC knows no speed: the assumed speed stays, is not marked detected, and gives no peak
+    MemorySpecs edac_specs = {};
+    edac_specs.speed_mtps = 3200;
+    edac_specs.data_width_bits = 64;
+    layout.speed_mtps = 0;
+    layout.data_width_bits = 0;
+    layout.channels = 8;
+    layout.sockets = 1;
+    layout.source = "EDAC";
+    MemoryDetection::apply_layout(layout, edac_specs);
+    ASSERT_FALSE(edac_specs.speed_detected);
+    TestAssert::assert_equal_size_t(3200, edac_specs.speed_mtps);
+    TestAssert::assert_equal_size_t(8, edac_specs.num_channels);
+    ASSERT_TRUE(edac_specs.theoretical_bandwidth_gbps == -1.0);
+    TestAssert::assert_equal(std::string("EDAC"), edac_specs.detection_source);
+}
+
+void test_apple_chip_memory() {
+    MemoryDetection::AppleChipMemory memory;
+    ASSERT_TRUE(MemoryDetection::apple_chip_memory("Apple M1", 4, memory));
+    TestAssert::assert_equal(std::string("LPDDR4X"), memory.type);
+    TestAssert::assert_equal_size_t(4266, memory.speed_mtps);
+    TestAssert::assert_equal_size_t(128, memory.bus_width_bits);
+
+    ASSERT_TRUE(MemoryDetection::apple_chip_memory("Apple M3 Pro", 6, memory));
+    TestAssert::assert_equal_size_t(192, memory.bus_width_bits);
+
+    // Full and binned M3 Max
+    ASSERT_TRUE(MemoryDetection::apple_chip_memory("Apple M3 Max", 12, memory));
+    TestAssert::assert_equal_size_t(512, memory.bus_width_bits);
+    ASSERT_TRUE(MemoryDetection::apple_chip_memory("Apple M3 Max", 10, memory));
+    TestAssert::assert_equal_size_t(384, memory.bus_width_bits);
+    ASSERT_TRUE(MemoryDetection::apple_chip_memory("Apple M3 Max", 0, memory));
+    TestAssert::assert_equal_size_t(512, memory.bus_width_bits);
+
+    ASSERT_TRUE(MemoryDetection::apple_chip_memory("Apple M4 Pro", 10, memory));
+    TestAssert::assert_equal(std::string("M4 Pro"), memory.chip);
+    TestAssert::assert_equal_size_t(8533, memory.speed_mtps);
+
+    ASSERT_FALSE(MemoryDetection::apple_chip_memory("Apple M9 Hyper", 8, memory));
+    ASSERT_FALSE(MemoryDetection::apple_chip_memory("Intel(R) Core(TM) i9-9980HK", 8, memory));
+}
+
+int main() {
+    TestFramework framework;
+
+    TEST_CASE("Parse SMBIOS memory devices", test_parse_smbios_memory_devices);
+    TEST_CASE("Channel of a device", test_channel_of);
+    TEST_CASE("Layout from devices", test_layout_from_devices);
+    TEST_CASE("Read SMBIOS layout", test_read_smbios_layout);
+    TEST_CASE("Read EDAC layout", test_read_edac_layout);
+    TEST_CASE("Apply layout", test_apply_layout);
+    TEST_CASE("Apple chip memory", test_apple_chip_memory);
+
+    return framework.run_all();
+}
@@ -0,0 +1,124 @@
+#include "test_framework.h"
+#include "../common/memory_tiers.h"
+#include "../common/errors.h"
+#include <string>
+#include <vector>
+
+using MemoryTiers::Point;
+using MemoryTiers::Ratio;
+
+namespace {
+
+NumaNode node(size_t id, std::vector<size_t> cpus, size_t memory_bytes, std::vector<size_t> distances) {
+    NumaNode result;
+    result.id = id;
+    result.cpus = cpus;
+    result.memory_bytes = memory_bytes;
+    result.distances = distances;
+    return result;
+}
+
+Point point(size_t far_node, size_t local_weight, size_t far_weight, double gbps) {
+    Point result;
+    result.far_node = far_node;
+    result.ratio.local_weight = local_weight;
+    result.ratio.far_weight = far_weight;
+    result.stats.bandwidth_gbps = gbps;
+    return result;
+}
+
+}  // namespace
+
+void test_parse_ratios() {
+    std::vector<Ratio> ratios = MemoryTiers::parse_ratios("1:0,6:2,3:1,2:2,0:7");
+    TestAssert::assert_equal_size_t(4, ratios.size());  // 6:2 is 3:1, 0:7 is 0:1
+    TestAssert::assert_equal(std::string("3:1"), MemoryTiers::ratio_to_string(ratios[1]));
+    TestAssert::assert_equal(std::string("1:1"), MemoryTiers::ratio_to_string(ratios[2]));
+    TestAssert::assert_equal(std::string("0:1"), MemoryTiers::ratio_to_string(ratios[3]));
+
+    TestAssert::assert_equal(std::string("local"), MemoryTiers::placement_to_string(ratios[0]));
+    TestAssert::assert_equal(std::string("interleave"), MemoryTiers::placement_to_string(ratios[1]));
+    TestAssert::assert_equal(std::string("far"), MemoryTiers::placement_to_string(ratios[3]));
+    ASSERT_TRUE(MemoryTiers::far_share(ratios[1]) == 0.25);
+    ASSERT_TRUE(MemoryTiers::far_share(ratios[3]) == 1.0);
+
+    for (const char* bad : {"", "1", "0:0", "256:1", "1:-1", "a:b", "1:1:1"}) {
+        try {
+            MemoryTiers::parse_ratios(bad);
+            ASSERT_TRUE(false);  // Should throw
+        } catch (const ArgumentError&) {
+            ASSERT_TRUE(true);
+        }
+    }
+}
+
+void test_select_memory_only_tiers() {
+    NumaTopology topology;
+    topology.binding_supported = true;
+    topology.nodes = {node(0, {0, 1}, 64ULL << 30, {10, 21, 24, 14}),
+                      node(1, {2, 3}, 64ULL << 30, {21, 10, 14, 24}),
+                      node(2, {}, 128ULL << 30, {24, 14, 10, 26}),
+                      node(3, {}, 128ULL << 30, {14, 24, 26, 10})};
+
+    MemoryTiers::Tiers tiers = MemoryTiers::select_tiers(topology);
+    TestAssert::assert_equal_size_t(0, tiers.local_node);
+    ASSERT_TRUE(tiers.memory_only);
+    std::vector<size_t> expected = {3, 2};  // Nearest CXL node first; the remote socket is not a tier
+    ASSERT_TRUE(tiers.far_nodes == expected);
+}
+
+void test_select_remote_tiers() {
+    NumaTopology topology;
+    topology.nodes = {node(0, {}, 0, {10, 20, 20}),  // CPU-less and memory-less
+                      node(1, {0, 1}, 32ULL << 30, {20, 10, 20}),
+                      node(2, {2, 3}, 32ULL << 30, {20, 20, 10})};
+
+    MemoryTiers::Tiers tiers = MemoryTiers::select_tiers(topology);
+    TestAssert::assert_equal_size_t(1, tiers.local_node);
+    ASSERT_FALSE(tiers.memory_only);
+    std::vector<size_t> expected = {2};
+    ASSERT_TRUE(tiers.far_nodes == expected);
+
+    topology.nodes.pop_back();
+    try {
+        MemoryTiers::select_tiers(topology);
+        ASSERT_TRUE(false);  // Should throw
+    } catch (const PlatformError& e) {
+        ASSERT_TRUE(std::string(e.what()).find("second NUMA node") != std::string::npos);
+    }
+}
+
+void test_weights_skip_zero() {
+    std::vector<NumaWeight> weights = MemoryTiers::weights_for(Ratio{3, 1}, 0, 2);
+    TestAssert::assert_equal_size_t(2, weights.size());
+    TestAssert::assert_equal_size_t(2, weights[1].node_id);
+    TestAssert::assert_equal_size_t(1, weights[1].weight);
+
+    weights = MemoryTiers::weights_for(Ratio{0, 1}, 0, 2);
+    TestAssert::assert_equal_size_t(1, weights.size());
+    TestAssert::assert_equal_size_t(2, weights[0].node_id);
+}
+
+void test_best_points_per_far_node() {
+    std::vector<Point> points = {point(2, 1, 0, 40.0), point(2, 3, 1, 52.0), point(2, 1, 1, 46.0),
+                                 point(3, 1, 0, 41.0), point(3, 3, 1, 60.0), point(3, 1, 1, 44.0)};
+    points[4].stats.verified = false;  // The fastest point of node 3 did not verify
+
+    std::vector<size_t> best = MemoryTiers::best_points(points);
+    TestAssert::assert_equal_size_t(2, best.size());
+    TestAssert::assert_equal_size_t(1, best[0]);
+    TestAssert::assert_equal_size_t(5, best[1]);
+    ASSERT_TRUE(MemoryTiers::best_points({}).empty());
+}
+
+int main() {
+    TestFramework framework;
+
+    TEST_CASE("Parse ratios", test_parse_ratios);
+    TEST_CASE("Select memory-only tiers", test_select_memory_only_tiers);
+    TEST_CASE("Select remote tiers", test_select_remote_tiers);
+    TEST_CASE("Weights skip zero", test_weights_skip_zero);
+    TEST_CASE("Best points per far node", test_best_points_per_far_node);
+
+    return framework.run_all();
+}
@@ -0,0 +1,175 @@
+#include "test_framework.h"
+#include "../common/ndjson_sink.h"
+#include "../common/errors.h"
+#include "../common/output_formatter.h"
+#include <cmath>
+#include <cstdio>
+#include <cstdlib>
+#include <fstream>
+#include <string>
+#include <unistd.h>
+#include <vector>
+
+namespace {
+
+TestResult result(const std::string& test_name) {
+    TestResult r;
+    r.test_name = test_name;
+    r.working_set_desc = "1GB";
+    r.stats = {25.5, 2.5, 1024, 0.5};
+    r.num_threads = 2;
+    r.pattern_name = "sequential_read";
+    r.kernel_name = "avx2";
+    r.store_policy = "-";
+    return r;
+}
+
+Ndjson::HostFingerprint host() {
+    Ndjson::HostFingerprint h;
+    h.hostname = "node-17";
+    h.os = "Linux";
+    h.cpu_name = "Test CPU";
+    h.cpu_cores = 8;
+    return h;
+}
+
+std::vector<std::string> read_lines(const std::string& path) {
+    std::ifstream file(path);
+    std::vector<std::string> lines;
+    std::string line;
+    while (std::getline(file, line)) {
+        lines.push_back(line);
+    }
+    return lines;
+}
+
+bool contains(const std::string& text, const std::string& part) {
+    return text.find(part) != std::string::npos;
+}
+
+}  // namespace
+
+void test_format_result() {
+    Ndjson::RecordContext context = {"large_memory", "compact", "requested default, obtained 4KB"};
+    std::string line = Ndjson::format_result(host(), "node-17-1-2", 3, "2026-01-31T12:00:00.250Z",
+                                             result("Sequential Read"), context);
+
+    ASSERT_FALSE(contains(line, "\n"));
+    ASSERT_TRUE(line.front() == '{' && line.back() == '}');
+    ASSERT_TRUE(line.rfind("{\"schema_version\":1,\"record\":\"result\",\"run_id\":\"node-17-1-2\",\"sequence\":3,", 0) ==
+                0);
+    ASSERT_TRUE(contains(line, "\"host\":{\"hostname\":\"node-17\",\"os\":\"Linux\""));
+    ASSERT_TRUE(contains(line, "\"cpu_cores\":8"));
+    ASSERT_TRUE(contains(line, "\"mode\":\"large_memory\""));
+    ASSERT_TRUE(contains(line, "\"kernel\":\"avx2\""));
+    ASSERT_TRUE(contains(line, "\"threads\":2,\"placement\":\"compact\""));
+    ASSERT_TRUE(contains(line, "\"pages\":\"requested default, obtained 4KB\""));
+    ASSERT_TRUE(contains(line, "\"bandwidth_gbps\":25.5,\"latency_ns\":2.5,\"bytes_processed\":1024"));
+
+    // Sections a result does not have are null, never missing
+    for (const char* key : {"\"bandwidth_distribution\":null", "\"latency_distribution\":null", "\"gemm\":null",
+                            "\"calibration\":null", "\"counters\":null", "\"page_faults\":null",
+                            "\"access\":null", "\"per_thread\":[]", "\"warnings\":[]"}) {
+        ASSERT_TRUE(contains(line, key));
+    }
+}
+
+void test_format_result_sections() {
+    TestResult r = result("Matrix \"GEMM\"\\FP32");
+    r.bandwidth_distribution = {10, 20.0, 25.0, 26.0, 27.0, 28.0, 25.0, 0.05};
+    ThreadStats thread;
+    thread.thread_id = 1;
+    thread.stats = {12.5, 5.0, 512, 0.5};
+    r.thread_stats.push_back(thread);
+    r.gemm = {"FP32", "FP32", 1024, 150.0, 85.3};
+    r.counters.set(PerfCounters::Counter::LLC_MISSES, 4096);
+    r.warnings = {"exceeds\tDRAM peak"};
+    r.stats.latency_ns = std::nan("");
+
+    std::string line = Ndjson::format_result(host(), "run", 0, "t", r, {});
+    ASSERT_TRUE(contains(line, "\"test_name\":\"Matrix \\\"GEMM\\\"\\\\FP32\""));
+    ASSERT_TRUE(contains(line, "\"bandwidth_distribution\":{\"count\":10,\"min\":20,\"median\":25,"));
+    ASSERT_TRUE(contains(line, "\"per_thread\":[{\"thread_id\":1,\"bandwidth_gbps\":12.5,"));
+    ASSERT_TRUE(contains(line, "\"gemm\":{\"precision\":\"FP32\",\"accumulate\":\"FP32\",\"matrix_size\":1024,"));
+    ASSERT_TRUE(contains(line, "\"counters\":{\"llc_misses\":4096}"));
+    ASSERT_TRUE(contains(line, "\"warnings\":[\"exceeds\\tDRAM peak\"]"));
+    ASSERT_TRUE(contains(line, "\"latency_ns\":null"));  // JSON has no NaN
+}
+
+void test_utc_timestamp() {
+    std::string timestamp = Ndjson::utc_timestamp();
+    TestAssert::assert_equal_size_t(24, timestamp.size());
+    ASSERT_TRUE(timestamp[4] == '-' && timestamp[10] == 'T' && timestamp[19] == '.' && timestamp.back() == 'Z');
+}
+
+void test_host_fingerprint() {
+    SystemInfo info = {};
+    info.cpu_name = "Test CPU";
+    info.cpu_threads = 16;
+    info.memory_specs.type = "DDR5";
+    info.cache_info.l3_size = 32 * 1024 * 1024;
+
+    Ndjson::HostFingerprint fingerprint = Ndjson::host_fingerprint(info);
+    ASSERT_FALSE(fingerprint.hostname.empty());
+    ASSERT_FALSE(fingerprint.os.empty());
+    ASSERT_FALSE(fingerprint.arch.empty());
+    TestAssert::assert_equal(std::string("DDR5"), fingerprint.memory_type);
+    TestAssert::assert_equal_size_t(16, fingerprint.cpu_threads);
+    TestAssert::assert_equal_size_t(32 * 1024 * 1024, fingerprint.l3_bytes);
+}
+
+void test_sink_appends_and_flushes() {
+    char path_template[] = "/tmp/ndjson_sink_XXXXXX";
+    int fd = mkstemp(path_template);
+    ASSERT_TRUE(fd >= 0);
+    close(fd);
+    std::string path = path_template;
+
+    {
+        Ndjson::Sink sink;
+        sink.open(path, host());
+        ASSERT_TRUE(sink.is_open());
+        sink.write(result("Sequential Read"), {"large_memory", "default", "requested default"});
+        // Readable before the sink is closed, as after a kill
+        TestAssert::assert_equal_size_t(1, read_lines(path).size());
+        sink.write(result("Sequential Write"), {"large_memory", "default", "requested default"});
+        TestAssert::assert_equal_size_t(2, sink.records_written());
+        ASSERT_TRUE(sink.run_id().rfind("node-17-", 0) == 0);
+    }
+    {
+        Ndjson::Sink sink;
+        sink.open(path, host());
+        sink.write(result("Copy"), {"cache_hierarchy", "default", "requested default"});
+    }
+
+    std::vector<std::string> lines = read_lines(path);
+    TestAssert::assert_equal_size_t(3, lines.size());  // Earlier runs are kept
+    ASSERT_TRUE(contains(lines[1], "\"sequence\":1") && contains(lines[1], "Sequential Write"));
+    ASSERT_TRUE(contains(lines[2], "\"sequence\":0") && contains(lines[2], "\"mode\":\"cache_hierarchy\""));
+    std::remove(path.c_str());
+}
+
+void test_sink_open_failure() {
+    Ndjson::Sink sink;
+    try {
+        sink.open("/nonexistent-dir/results.ndjson", host());
+        ASSERT_TRUE(false);  // Should throw
+    } catch (const ConfigurationError& e) {
+        std::string error_msg = e.what();
+        ASSERT_TRUE(error_msg.find("Cannot open --ndjson file") != std::string::npos);
+    }
+    ASSERT_FALSE(sink.is_open());
+}
+
+int main() {
+    TestFramework framework;
+
+    TEST_CASE("Format result record", test_format_result);
+    TEST_CASE("Format result sections", test_format_result_sections);
+    TEST_CASE("UTC timestamp", test_utc_timestamp);
+    TEST_CASE("Host fingerprint", test_host_fingerprint);
+    TEST_CASE("Sink appends and flushes", test_sink_appends_and_flushes);
+    TEST_CASE("Sink open failure", test_sink_open_failure);
+
+    return framework.run_all();
+}
@@ -0,0 +1,174 @@
+#include "test_framework.h"
+#include "../common/numa_utils.h"
+#include <cstdlib>
+#include <fstream>
+#include <map>
+#include <string>
+#include <sys/stat.h>
+#include <vector>
+
+void test_parse_id_list() {
+    std::vector<size_t> ids = NumaUtils::parse_id_list("0-3,8,10-11\n");
+    std::vector<size_t> expected = {0, 1, 2, 3, 8, 10, 11};
+    ASSERT_TRUE(ids == expected);
+
+    TestAssert::assert_equal_size_t(1, NumaUtils::parse_id_list("5").size());
+    ASSERT_TRUE(NumaUtils::parse_id_list("").empty());
+}
+
+void test_parse_id_list_rejects_malformed() {
+    ASSERT_TRUE(NumaUtils::parse_id_list("a-b").empty());
+    ASSERT_TRUE(NumaUtils::parse_id_list("4-2").empty());
+    ASSERT_TRUE(NumaUtils::parse_id_list("1,-3").empty());
+}
+
+void test_topology_has_nodes() {
+    NumaTopology topology = NumaUtils::detect_topology();
+    ASSERT_FALSE(topology.nodes.empty());
+
+    // Every logical CPU belongs to some node
+    size_t cpu_count = 0;
+    for (const auto& node : topology.nodes) {
+        cpu_count += node.cpus.size();
+    }
+    ASSERT_TRUE(cpu_count > 0);
+
+    // SLIT distances are indexed by node and a node is closest to itself
+    for (size_t i = 0; i < topology.nodes.size(); ++i) {
+        const NumaNode& node = topology.nodes[i];
+        if (node.distances.size() == topology.nodes.size()) {
+            for (size_t distance : node.distances) {
+                ASSERT_TRUE(node.distances[i] <= distance);
+            }
+        }
+    }
+}
+
+void test_find_node() {
+    const NumaTopology& topology = NumaUtils::get_topology();
+    const NumaNode* first = NumaUtils::find_node(topology, topology.nodes[0].id);
+    ASSERT_TRUE(first != nullptr);
+    ASSERT_TRUE(first->id == topology.nodes[0].id);
+    ASSERT_TRUE(NumaUtils::find_node(topology, 100000) == nullptr);
+}
+
+void test_bind_memory_to_local_node() {
+    const NumaTopology& topology = NumaUtils::get_topology();
+    if (!topology.binding_supported) {
+        return;  // Nothing to bind on single-node fallbacks
+    }
+
+    // Pick a node that actually has memory
+    const NumaNode* target = nullptr;
+    for (const auto& node : topology.nodes) {
+        if (node.memory_bytes > 0) {
+            target = &node;
+            break;
+        }
+    }
+    if (target == nullptr) {
+        return;
+    }
+
+    std::vector<uint8_t> buffer(1024 * 1024, 0x5A);
+    ASSERT_TRUE(NumaUtils::bind_memory_to_node(buffer.data(), buffer.size(), target->id));
+
+    // Migration must not change contents
+    for (size_t i = 0; i < buffer.size(); i += 4096) {
+        ASSERT_TRUE(buffer[i] == 0x5A);
+    }
+
+    // Ranges smaller than a page cannot be bound
+    ASSERT_FALSE(NumaUtils::bind_memory_to_node(buffer.data() + 1, 16, target->id));
+}
+
+void test_read_access_attributes() {
+    char root_template[] = "/tmp/numa_hmat_XXXXXX";
+    ASSERT_TRUE(mkdtemp(root_template) != nullptr);
+    std::string root = root_template;
+    std::string initiators = root + "/node2/access0/initiators";
+    mkdir((root + "/node2").c_str(), 0755);
+    mkdir((root + "/node2/access0").c_str(), 0755);
+    mkdir(initiators.c_str(), 0755);
+    std::ofstream(initiators + "/read_bandwidth") << "32768\n";
+    std::ofstream(initiators + "/write_bandwidth") << "16384\n";
+    std::ofstream(initiators + "/read_latency") << "250\n";
+    std::ofstream(initiators + "/write_latency") << "bogus\n";
+
+    NumaAccess access = NumaUtils::read_access(root + "/node2");
+    TestAssert::assert_equal_size_t(32768, access.read_bandwidth_mbps);
+    TestAssert::assert_equal_size_t(16384, access.write_bandwidth_mbps);
+    TestAssert::assert_equal_size_t(250, access.read_latency_ns);
+    TestAssert::assert_equal_size_t(0, access.write_latency_ns);  // Malformed
+
+    access = NumaUtils::read_access(root + "/node7");  // No HMAT
+    ASSERT_TRUE(access.read_bandwidth_mbps == 0 && access.read_latency_ns == 0);
+
+    std::string cleanup = "rm -rf " + root;
+    ASSERT_TRUE(std::system(cleanup.c_str()) == 0);
+}
+
+void test_memory_only_nodes() {
+    NumaNode expander = {};
+    expander.memory_bytes = 1ULL << 30;
+    ASSERT_TRUE(NumaUtils::is_memory_only(expander));
+    expander.cpus = {0};
+    ASSERT_FALSE(NumaUtils::is_memory_only(expander));
+    NumaNode cpu_only = {};
+    ASSERT_FALSE(NumaUtils::is_memory_only(cpu_only));
+}
+
+void test_interleave_memory() {
+    std::vector<uint8_t> buffer(1024 * 1024, 0x5A);
+    std::string policy;
+    ASSERT_FALSE(NumaUtils::interleave_memory(buffer.data(), buffer.size(), {}, policy));
+    ASSERT_FALSE(NumaUtils::interleave_memory(buffer.data(), buffer.size(), {{0, 0}}, policy));
+    ASSERT_FALSE(NumaUtils::interleave_memory(buffer.data(), buffer.size(), {{0, 256}, {1, 1}}, policy));
+    ASSERT_FALSE(NumaUtils::interleave_memory(buffer.data(), buffer.size(), {{0, 3}, {0, 1}}, policy));
+
+    const NumaTopology& topology = NumaUtils::get_topology();
+    if (!topology.binding_supported) {
+        return;
+    }
+    const NumaNode* target = nullptr;
+    for (const auto& node : topology.nodes) {
+        if (node.memory_bytes > 0) {
+            target = &node;
+            break;
+        }
+    }
+    if (target == nullptr) {
+        return;
+    }
+
+    // One weighted node is a plain bind; zero weights are left out
+    ASSERT_TRUE(NumaUtils::interleave_memory(buffer.data(), buffer.size(), {{target->id, 3}, {100, 0}}, policy));
+    TestAssert::assert_equal(std::string("bind"), policy);
+    for (size_t i = 0; i < buffer.size(); i += 4096) {
+        ASSERT_TRUE(buffer[i] == 0x5A);
+    }
+
+    std::map<size_t, size_t> pages = NumaUtils::count_pages_by_node(buffer.data(), buffer.size());
+    size_t resident = 0;
+    for (const auto& node_pages : pages) {
+        resident += node_pages.second;
+    }
+    ASSERT_TRUE(resident > 0);
+    ASSERT_TRUE(pages[target->id] == resident);
+    ASSERT_TRUE(NumaUtils::count_pages_by_node(buffer.data() + 1, 16).empty());
+}
+
+int main() {
+    TestFramework framework;
+
+    TEST_CASE("Parse id list", test_parse_id_list);
+    TEST_CASE("Parse id list rejects malformed", test_parse_id_list_rejects_malformed);
+    TEST_CASE("Topology has nodes", test_topology_has_nodes);
+    TEST_CASE("Find node", test_find_node);
+    TEST_CASE("Bind memory to local node", test_bind_memory_to_local_node);
+    TEST_CASE("Read access attributes", test_read_access_attributes);
+    TEST_CASE("Memory-only nodes", test_memory_only_nodes);
+    TEST_CASE("Interleave memory", test_interleave_memory);
+
+    return framework.run_all();
+}
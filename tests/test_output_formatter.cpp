@@ -167,6 +167,962 @@ void test_special_characters_handling() {
     ASSERT_TRUE(output.find("}") != std::string::npos);
 }
 
+void test_numa_matrix_formatting() {
+    std::vector<NumaMatrixEntry> entries;
+    for (size_t cpu_node = 0; cpu_node < 2; ++cpu_node) {
+        for (size_t memory_node = 0; memory_node < 2; ++memory_node) {
+            NumaMatrixEntry entry = {};
+            entry.cpu_node = cpu_node;
+            entry.memory_node = memory_node;
+            entry.num_threads = 4;
+            entry.stats.bandwidth_gbps = (cpu_node == memory_node) ? 40.0 : 24.0;
+            entry.stats.latency_ns = (cpu_node == memory_node) ? 90.0 : 140.0;
+            entries.push_back(entry);
+        }
+    }
+
+    OutputFormatter md_formatter(OutputFormat::MARKDOWN);
+    std::string md_output = md_formatter.format_numa_matrix("sequential_read", "1GB", entries);
+    ASSERT_TRUE(md_output.find("| CPU 1 |") != std::string::npos);
+    ASSERT_TRUE(md_output.find("Mem 1") != std::string::npos);
+    ASSERT_TRUE(md_output.find("320.00") != std::string::npos);  // 40 GB/s local
+    ASSERT_TRUE(md_output.find("192.00") != std::string::npos);  // 24 GB/s remote
+    ASSERT_TRUE(md_output.find("140.0") != std::string::npos);
+
+    OutputFormatter json_formatter(OutputFormat::JSON);
+    std::string json_output = json_formatter.format_numa_matrix("sequential_read", "1GB", entries);
+    ASSERT_TRUE(json_output.find("\"memory_node\": 1") != std::string::npos);
+
+    OutputFormatter csv_formatter(OutputFormat::CSV);
+    std::string csv_output = csv_formatter.format_numa_matrix("sequential_read", "1GB", entries);
+    ASSERT_TRUE(csv_output.find("1,0,4,24.00") != std::string::npos);
+}
+
+void test_memory_tiers_formatting() {
+    std::vector<MemoryTiers::Point> points;
+    const std::pair<size_t, size_t> ratios[] = {{1, 0}, {3, 1}, {1, 1}, {0, 1}};
+    const double bandwidths[] = {40.0, 52.0, 46.0, 20.0};
+    for (size_t i = 0; i < 4; ++i) {
+        MemoryTiers::Point point;
+        point.local_node = 0;
+        point.far_node = 2;
+        point.ratio.local_weight = ratios[i].first;
+        point.ratio.far_weight = ratios[i].second;
+        point.policy = i == 1 ? "weighted-interleave" : "bind";
+        point.far_page_share = MemoryTiers::far_share(point.ratio);
+        point.num_threads = 8;
+        point.stats.bandwidth_gbps = bandwidths[i];
+        point.stats.latency_ns = 100.0 + 50.0 * i;
+        points.push_back(point);
+    }
+    points[2].far_page_share = -1.0;  // Not measured
+
+    OutputFormatter md_formatter(OutputFormat::MARKDOWN);
+    std::string md_output = md_formatter.format_memory_tiers("sequential_read", "1GB", points);
+    ASSERT_TRUE(md_output.find("Memory Tiers (1GB)") != std::string::npos);
+    ASSERT_TRUE(md_output.find("| 3:1 **best** | interleave | weighted-interleave | 25.0 |") != std::string::npos);
+    ASSERT_TRUE(md_output.find("1.30x") != std::string::npos);  // 52 over 40 GB/s local-only
+    ASSERT_TRUE(md_output.find("| 1:1 | interleave | bind | - |") != std::string::npos);
+    ASSERT_TRUE(md_output.find("Fastest ratio for node 2: 3:1 local:far (25% far) at 52.00 GB/s") !=
+                std::string::npos);
+
+    OutputFormatter json_formatter(OutputFormat::JSON);
+    std::string json_output = json_formatter.format_memory_tiers("sequential_read", "1GB", points);
+    ASSERT_TRUE(json_output.find("\"memory_tiers\": true") != std::string::npos);
+    ASSERT_TRUE(json_output.find("\"far_page_share\": null") != std::string::npos);
+    ASSERT_TRUE(json_output.find("\"far_weight\": 1, \"placement\": \"interleave\"") != std::string::npos);
+
+    OutputFormatter csv_formatter(OutputFormat::CSV);
+    std::string csv_output = csv_formatter.format_memory_tiers("sequential_read", "1GB", points);
+    ASSERT_TRUE(csv_output.find("0,2,3,1,interleave,weighted-interleave,25.0,8,52.00,150.0,yes") != std::string::npos);
+    ASSERT_TRUE(csv_output.find("0,2,0,1,far,bind,100.0,8,20.00,250.0,no") != std::string::npos);
+}
+
+void test_gpu_bandwidth_formatting() {
+    GpuBandwidth::Point point;
+    point.kernel = GpuBandwidth::Kernel::COPY;
+    point.device = "Apple M2 Max";
+    point.array_bytes = 256 * 1024 * 1024;
+    point.gpu_iterations = 40;
+    point.cpu_threads = 8;
+    point.gpu_alone_gbps = 300.0;
+    point.cpu_alone_gbps = 200.0;
+    point.gpu_shared_gbps = 240.0;
+    point.cpu_shared_gbps = 150.0;
+    GpuBandwidth::Point unverified = point;
+    unverified.kernel = GpuBandwidth::Kernel::TRIAD;
+    unverified.verified = false;
+    std::vector<GpuBandwidth::Point> points = {point, unverified};
+
+    OutputFormatter md_formatter(OutputFormat::MARKDOWN);
+    std::string md_output = md_formatter.format_gpu_bandwidth("1GB", points);
+    ASSERT_TRUE(md_output.find("GPU Unified Memory (1GB)") != std::string::npos);
+    ASSERT_TRUE(md_output.find("GPU: Apple M2 Max, 8 CPU threads") != std::string::npos);
+    ASSERT_TRUE(md_output.find("| copy | 256MB | 300.00 | 200.00 | 240.00 | 150.00 | 80.0 | 75.0 | 390.00 | 0.78x | yes |") !=
+                std::string::npos);
+    ASSERT_TRUE(md_output.find("| triad |") != std::string::npos);
+    ASSERT_TRUE(md_output.find("| **no** |") != std::string::npos);
+
+    OutputFormatter json_formatter(OutputFormat::JSON);
+    std::string json_output = json_formatter.format_gpu_bandwidth("1GB", points);
+    ASSERT_TRUE(json_output.find("\"gpu_bandwidth\": true") != std::string::npos);
+    ASSERT_TRUE(json_output.find("\"device\": \"Apple M2 Max\"") != std::string::npos);
+    ASSERT_TRUE(json_output.find("\"gpu_retained_percent\": 80.0, \"cpu_retained_percent\": 75.0") !=
+                std::string::npos);
+
+    OutputFormatter csv_formatter(OutputFormat::CSV);
+    std::string csv_output = csv_formatter.format_gpu_bandwidth("1GB", points);
+    ASSERT_TRUE(csv_output.find("copy,Apple M2 Max,268435456,40,8,300.00,200.00,240.00,150.00,80.0,75.0,yes") !=
+                std::string::npos);
+}
+
+void test_fleet_report_formatting() {
+    Fleet::Report report;
+    report.fleet_id = "coord-1-1700000000";
+    Fleet::HostRun ok;
+    ok.endpoint = "node1:7531";
+    ok.hostname = "node1";
+    ok.sku = "Xeon DDR5-4800 x8";
+    ok.accepted = true;
+    ok.exit_code = 0;
+    ok.records = 12;
+    ok.clock_offset_ms = 120.0;
+    Fleet::HostRun refused;
+    refused.endpoint = "node2:7531";
+    refused.message = "connect: Connection refused";
+    report.hosts = {ok, refused};
+
+    Fleet::Summary summary;
+    summary.sku = ok.sku;
+    summary.test = "Copy 1GB avx2 temporal 8T";
+    summary.metric = "bandwidth_gbps";
+    summary.hosts = 5;
+    summary.min = 80.0;
+    summary.p10 = 88.0;
+    summary.median = 100.0;
+    summary.p90 = 100.8;
+    summary.max = 101.0;
+    report.summaries = {summary};
+    Fleet::Outlier outlier;
+    outlier.hostname = "node5";
+    outlier.sku = ok.sku;
+    outlier.test = summary.test;
+    outlier.metric = "bandwidth_gbps";
+    outlier.value = 80.0;
+    outlier.median = 100.0;
+    outlier.deviation_percent = -20.0;
+    outlier.robust_z = 13.5;
+    report.outliers = {outlier};
+
+    OutputFormatter md_formatter(OutputFormat::MARKDOWN);
+    std::string md_output = md_formatter.format_fleet_report(report);
+    ASSERT_TRUE(md_output.find("Fleet Report (coord-1-1700000000)") != std::string::npos);
+    ASSERT_TRUE(md_output.find("| node1:7531 | node1 | Xeon DDR5-4800 x8 | 12 | +120.0 (skewed) | ok |") !=
+                std::string::npos);
+    ASSERT_TRUE(md_output.find("| node2:7531 | - | - | 0 | - | failed: connect: Connection refused |") !=
+                std::string::npos);
+    ASSERT_TRUE(md_output.find("| 5 | 80.00 | 88.00 | 100.00 | 100.80 | 101.00 | GB/s |") != std::string::npos);
+    ASSERT_TRUE(md_output.find("| **node5** |") != std::string::npos);
+    ASSERT_TRUE(md_output.find("| -20.0% | 13.5 |") != std::string::npos);
+
+    OutputFormatter json_formatter(OutputFormat::JSON);
+    std::string json_output = json_formatter.format_fleet_report(report);
+    ASSERT_TRUE(json_output.find("\"fleet_report\": true") != std::string::npos);
+    ASSERT_TRUE(json_output.find("\"accepted\": false, \"exit_code\": -1") != std::string::npos);
+    ASSERT_TRUE(json_output.find("\"deviation_percent\": -20.00") != std::string::npos);
+
+    OutputFormatter csv_formatter(OutputFormat::CSV);
+    std::string csv_output = csv_formatter.format_fleet_report(report);
+    ASSERT_TRUE(csv_output.find("# Fleet Report (coord-1-1700000000): 2 agents, 1 outliers") != std::string::npos);
+    ASSERT_TRUE(csv_output.find("Xeon DDR5-4800 x8,Copy 1GB avx2 temporal 8T,bandwidth_gbps,5,80.00") !=
+                std::string::npos);
+    ASSERT_TRUE(csv_output.find("node5,Xeon DDR5-4800 x8,Copy 1GB avx2 temporal 8T,bandwidth_gbps,80.00,100.00,-20.00") !=
+                std::string::npos);
+}
+
+void test_sample_stats_formatting() {
+    TestResult result = {};
+    result.test_name = "sequential_read";
+    result.pattern_name = "sequential_read";
+    result.working_set_desc = "1GB";
+    result.num_threads = 2;
+    result.kernel_name = "avx512";
+    result.store_policy = "-";
+    result.stats.bandwidth_gbps = 40.0;
+    result.bandwidth_distribution = SampleStats::summarize({38.0, 40.0, 42.0});
+    result.latency_distribution = SampleStats::summarize({1.5, 1.6, 1.7});
+    for (size_t i = 0; i < 2; ++i) {
+        ThreadStats thread;
+        thread.thread_id = i;
+        thread.stats.bandwidth_gbps = 20.0 + i;
+        thread.bandwidth = SampleStats::summarize({19.0, 20.0, 21.0});
+        result.thread_stats.push_back(thread);
+    }
+    MemorySpecs mem_specs = {};
+
+    OutputFormatter json_formatter(OutputFormat::JSON);
+    std::string json_output = json_formatter.format_test_results({result}, mem_specs);
+    ASSERT_TRUE(json_output.find("\"bandwidth_stats\": {\"samples\": 3, \"min\": 38.00") != std::string::npos);
+    ASSERT_TRUE(json_output.find("\"median\": 40.00") != std::string::npos);
+    ASSERT_TRUE(json_output.find("\"thread_id\": 1, \"bandwidth_gbps\": 21.00") != std::string::npos);
+
+    OutputFormatter csv_formatter(OutputFormat::CSV);
+    std::string csv_output = csv_formatter.format_test_results({result}, mem_specs);
+    ASSERT_TRUE(csv_output.find(",38.00,40.00,") != std::string::npos);
+    ASSERT_TRUE(csv_output.find("# Per-Thread Results") != std::string::npos);
+    ASSERT_TRUE(csv_output.find("avx512,-,1,21.00") != std::string::npos);
+
+    // Results without samples keep their previous shape
+    result.bandwidth_distribution = DistributionStats{};
+    result.latency_distribution = DistributionStats{};
+    result.thread_stats.clear();
+    json_output = json_formatter.format_test_results({result}, mem_specs);
+    ASSERT_TRUE(json_output.find("bandwidth_stats") == std::string::npos);
+    csv_output = csv_formatter.format_test_results({result}, mem_specs);
+    ASSERT_TRUE(csv_output.find("# Per-Thread Results") == std::string::npos);
+}
+
+void test_loaded_latency_formatting() {
+    std::vector<LoadedLatencyPoint> points;
+    points.push_back({0, 0, 0.0, 90.0, SampleStats::summarize({89.0, 90.0, 92.0})});
+    points.push_back({3, 1000, 10.0, 95.0, SampleStats::summarize({95.0})});
+    points.push_back({3, 0, 40.0, 180.0, SampleStats::summarize({170.0, 190.0})});
+
+    OutputFormatter md_formatter(OutputFormat::MARKDOWN);
+    std::string md_output = md_formatter.format_loaded_latency("Sequential Read", "1GB", points);
+    ASSERT_TRUE(md_output.find("| idle | 0 | - | - | 90.0 |") != std::string::npos);
+    ASSERT_TRUE(md_output.find("| 1000 | 3 | 10.00 | 25.0 | 95.0 |") != std::string::npos);  // 10 of 40 GB/s
+
+    OutputFormatter json_formatter(OutputFormat::JSON);
+    std::string json_output = json_formatter.format_loaded_latency("Sequential Read", "1GB", points);
+    ASSERT_TRUE(json_output.find("\"loaded_latency\": true") != std::string::npos);
+    ASSERT_TRUE(json_output.find("\"utilization_percent\": 100.0") != std::string::npos);
+
+    OutputFormatter csv_formatter(OutputFormat::CSV);
+    std::string csv_output = csv_formatter.format_loaded_latency("Sequential Read", "1GB", points);
+    ASSERT_TRUE(csv_output.find("0,3,40.00,100.0,180.0,180.0,") != std::string::npos);
+}
+
+void test_contention_formatting() {
+    std::vector<Contention::ContentionPoint> points(3);
+    points[0].victim_gbps = 20.0;
+    points[0].victim_latency_ns = 4.0;
+    points[1].aggressor_threads = 3;
+    points[1].delay_spins = 1000;
+    points[1].aggressor_gbps = 10.0;
+    points[1].victim_gbps = 16.0;
+    points[1].victim_latency_ns = 5.0;
+    points[2].aggressor_threads = 3;
+    points[2].aggressor_gbps = 30.0;
+    points[2].victim_gbps = 10.0;
+    points[2].victim_latency_ns = 8.0;
+    points[0].slowdown = 1.0;
+    points[1].slowdown = 1.25;
+    points[2].slowdown = 2.0;
+
+    OutputFormatter md_formatter(OutputFormat::MARKDOWN);
+    std::string md_output = md_formatter.format_contention("Sequential Read", "sequential_write", "1GB", points);
+    ASSERT_TRUE(md_output.find("Sequential Read under sequential_write Contention") != std::string::npos);
+    ASSERT_TRUE(md_output.find("| 0 | alone | 0.00 | 20.00 | 4.00 | 1.00x |") != std::string::npos);
+    ASSERT_TRUE(md_output.find("| 3 | 1000 | 10.00 | 16.00 | 5.00 | 1.25x |") != std::string::npos);
+    ASSERT_TRUE(md_output.find("Worst slowdown 2.00x at 30.00 GB/s") != std::string::npos);
+
+    OutputFormatter json_formatter(OutputFormat::JSON);
+    std::string json_output = json_formatter.format_contention("Sequential Read", "atomics", "1GB", points);
+    ASSERT_TRUE(json_output.find("\"contention\": true") != std::string::npos);
+    ASSERT_TRUE(json_output.find("\"aggressor\": \"atomics\"") != std::string::npos);
+    ASSERT_TRUE(json_output.find("\"slowdown\": 2.000") != std::string::npos);
+
+    OutputFormatter csv_formatter(OutputFormat::CSV);
+    std::string csv_output = csv_formatter.format_contention("Sequential Read", "copy", "1GB", points);
+    ASSERT_TRUE(csv_output.find("3,0,30.00,10.00,8.00,2.000") != std::string::npos);
+}
+
+void test_soak_formatting() {
+    std::vector<Soak::Sample> samples(3);
+    for (size_t i = 0; i < samples.size(); ++i) {
+        samples[i].elapsed_seconds = 0.1 * static_cast<double>(i + 1);
+        samples[i].bandwidth_gbps = 20.0 - 4.0 * static_cast<double>(i);
+        samples[i].frequency_mhz = 3000.0;
+    }
+    samples[2].dimm_temperature_c = 52.5;
+    Soak::Summary summary;
+    summary.samples = 3;
+    summary.duration_seconds = 0.3;
+    summary.first_gbps = 20.0;
+    summary.last_gbps = 12.0;
+    summary.decay_percent = 40.0;
+    summary.first_mhz = 3000.0;
+    summary.last_mhz = 3000.0;
+    summary.max_dimm_temperature_c = 52.5;
+    summary.throttled = true;
+
+    OutputFormatter md_formatter(OutputFormat::MARKDOWN);
+    std::string md_output = md_formatter.format_soak("Sequential Read", "1GB", summary, samples);
+    ASSERT_TRUE(md_output.find("Sequential Read Soak (1GB, 0.3s, 3 samples)") != std::string::npos);
+    ASSERT_TRUE(md_output.find("last window 12.00 GB/s (-40.0%)") != std::string::npos);
+    ASSERT_TRUE(md_output.find("**Throttling detected**") != std::string::npos);
+    ASSERT_TRUE(md_output.find("| Elapsed | Bandwidth (GB/s) | Frequency (MHz) | DIMM (C) |") != std::string::npos);
+    ASSERT_TRUE(md_output.find("CPU (C)") == std::string::npos);  // No CPU sensor reading
+    ASSERT_TRUE(md_output.find("| 0.3s | 12.00 | 3000 | 52.5 |") != std::string::npos);
+
+    OutputFormatter json_formatter(OutputFormat::JSON);
+    std::string json_output = json_formatter.format_soak("Sequential Read", "1GB", summary, samples);
+    ASSERT_TRUE(json_output.find("\"soak\": true") != std::string::npos);
+    ASSERT_TRUE(json_output.find("\"throttled\": true") != std::string::npos);
+    ASSERT_TRUE(json_output.find("{\"elapsed_seconds\": 0.200, \"bandwidth_gbps\": 16.00") != std::string::npos);
+
+    OutputFormatter csv_formatter(OutputFormat::CSV);
+    std::string csv_output = csv_formatter.format_soak("Sequential Read", "1GB", summary, samples);
+    ASSERT_TRUE(csv_output.find("Elapsed (s),Bandwidth (GB/s),Frequency (MHz)") != std::string::npos);
+    ASSERT_TRUE(csv_output.find("0.300,12.00,3000,,52.5\n") != std::string::npos);
+    ASSERT_TRUE(csv_output.find("0.100,20.00,3000,,\n") != std::string::npos);  // No reading is no value
+}
+
+void test_gemm_compute_formatting() {
+    TestResult result = {};
+    result.test_name = "Matrix Multiply (GEMM) BF16";
+    result.pattern_name = "Matrix Multiply (GEMM)";
+    result.working_set_desc = "1GB";
+    result.num_threads = 4;
+    result.kernel_name = "Intel AMX (BF16)";
+    result.store_policy = "-";
+    result.gemm = {"BF16", "FP32", 1024, 512.5, 204.8};
+    MemorySpecs mem_specs = {};
+
+    OutputFormatter markdown_formatter(OutputFormat::MARKDOWN);
+    std::string markdown_output = markdown_formatter.format_test_results({result}, mem_specs);
+    ASSERT_TRUE(markdown_output.find("#### Matrix Multiply Compute") != std::string::npos);
+    ASSERT_TRUE(markdown_output.find("| BF16 | FP32 | Intel AMX (BF16) | 4 | 1024 | 512.50 | 204.80 |") !=
+                std::string::npos);
+
+    OutputFormatter json_formatter(OutputFormat::JSON);
+    std::string json_output = json_formatter.format_test_results({result}, mem_specs);
+    ASSERT_TRUE(json_output.find("\"gemm\": {\"precision\": \"BF16\", \"accumulate\": \"FP32\", \"matrix_size\": 1024, "
+                                 "\"gops\": 512.50, \"arithmetic_intensity\": 204.80}") != std::string::npos);
+
+    OutputFormatter csv_formatter(OutputFormat::CSV);
+    std::string csv_output = csv_formatter.format_test_results({result}, mem_specs);
+    ASSERT_TRUE(csv_output.find("# Matrix Multiply Compute") != std::string::npos);
+    ASSERT_TRUE(csv_output.find("BF16,FP32,\"Intel AMX (BF16)\",4,1024,512.50,204.80") != std::string::npos);
+
+    // Other patterns carry no GEMM metrics
+    result.gemm = GemmStats{};
+    ASSERT_TRUE(markdown_formatter.format_test_results({result}, mem_specs).find("Compute") == std::string::npos);
+    ASSERT_TRUE(json_formatter.format_test_results({result}, mem_specs).find("gemm") == std::string::npos);
+}
+
+void test_roofline_formatting() {
+    Roofline roofline;
+    roofline.ceilings.push_back({"L1", "memory", 400.0, 0.2});
+    roofline.ceilings.push_back({"DRAM", "memory", 20.0, 4.0});
+    roofline.ceilings.push_back({"FP64 FMA (roofline kernel)", "compute", 80.0, 0.0});
+    roofline.points.push_back({"DRAM", 1024 * 1024, 0.0625, 1.25, 20.0});
+    roofline.points.push_back({"DRAM", 1024 * 1024, 64.0, 80.0, 1.25});
+
+    OutputFormatter md_formatter(OutputFormat::MARKDOWN);
+    std::string md_output = md_formatter.format_roofline("1GB", roofline);
+    ASSERT_TRUE(md_output.find("### Roofline (1GB)") != std::string::npos);
+    ASSERT_TRUE(md_output.find("| DRAM | memory | 20.00 GB/s | 4.000 |") != std::string::npos);
+    ASSERT_TRUE(md_output.find("| FP64 FMA (roofline kernel) | compute | 80.00 GFLOP/s | - |") != std::string::npos);
+    ASSERT_TRUE(md_output.find("| DRAM | 1024 | 0.0625 | 1.25 | 20.00 |") != std::string::npos);
+
+    OutputFormatter json_formatter(OutputFormat::JSON);
+    std::string json_output = json_formatter.format_roofline("1GB", roofline);
+    ASSERT_TRUE(json_output.find("\"roofline\": true") != std::string::npos);
+    ASSERT_TRUE(json_output.find("\"unit\": \"GFLOP/s\"") != std::string::npos);
+    ASSERT_TRUE(json_output.find("\"arithmetic_intensity\": 64.0000") != std::string::npos);
+
+    OutputFormatter csv_formatter(OutputFormat::CSV);
+    std::string csv_output = csv_formatter.format_roofline("1GB", roofline);
+    ASSERT_TRUE(csv_output.find("\"L1\",memory,400.00,GB/s,0.200") != std::string::npos);
+    ASSERT_TRUE(csv_output.find("# Roofline Points (1GB)") != std::string::npos);
+    ASSERT_TRUE(csv_output.find("DRAM,1048576,0.0625,1.25,20.00") != std::string::npos);
+}
+
+void test_working_set_sweep_formatting() {
+    WorkingSetSweep sweep;
+    sweep.steps_per_octave = 4;
+    sweep.points.push_back({32 * 1024, 180.0, 1.2});
+    sweep.points.push_back({1536 * 1024, 60.0, 5.5});
+    sweep.bandwidth_knees.push_back({32 * 1024, 180.0, 60.0});
+    sweep.capacities.push_back({"L1", 48 * 1024, 32 * 1024, 0});
+    sweep.capacities.push_back({"unattributed", 0, 0, 64 * 1024 * 1024});
+
+    OutputFormatter md_formatter(OutputFormat::MARKDOWN);
+    std::string md_output = md_formatter.format_working_set_sweep(sweep);
+    ASSERT_TRUE(md_output.find("### Working-Set Sweep (log2:4)") != std::string::npos);
+    ASSERT_TRUE(md_output.find("| 1.5MB | 60.00 | 5.5 |") != std::string::npos);
+    ASSERT_TRUE(md_output.find("| L1 | 48KB | 32KB | - |") != std::string::npos);
+    ASSERT_TRUE(md_output.find("| unattributed | - | - | 64MB |") != std::string::npos);
+
+    OutputFormatter json_formatter(OutputFormat::JSON);
+    std::string json_output = json_formatter.format_working_set_sweep(sweep);
+    ASSERT_TRUE(json_output.find("\"working_set_sweep\": true") != std::string::npos);
+    ASSERT_TRUE(json_output.find("\"bandwidth_knee_bytes\": 32768") != std::string::npos);
+    ASSERT_TRUE(json_output.find("\"latency_knees\": []") != std::string::npos);
+
+    OutputFormatter csv_formatter(OutputFormat::CSV);
+    std::string csv_output = csv_formatter.format_working_set_sweep(sweep);
+    ASSERT_TRUE(csv_output.find("32768,180.00,1.2") != std::string::npos);
+    ASSERT_TRUE(csv_output.find("L1,49152,32768,0") != std::string::npos);
+}
+
+void test_counters_formatting() {
+    TestResult result;
+    result.test_name = "Copy";
+    result.working_set_desc = "1GB";
+    result.stats = {20.0, 5.0, 1000, 0.5};
+    result.num_threads = 4;
+    result.counters.set(PerfCounters::Counter::CYCLES, 2000);
+    result.counters.set(PerfCounters::Counter::INSTRUCTIONS, 3000);
+    result.counters.set(PerfCounters::Counter::DRAM_READ_BYTES, 2000);
+    result.counters.set(PerfCounters::Counter::DRAM_WRITE_BYTES, 1000);
+
+    TestResult uncounted = result;
+    uncounted.test_name = "Triad";
+    uncounted.counters = PerfCounters::CounterValues{};
+
+    std::vector<TestResult> results = {result, uncounted};
+    MemorySpecs specs = {};
+
+    OutputFormatter md_formatter(OutputFormat::MARKDOWN);
+    std::string md_output = md_formatter.format_test_results(results, specs);
+    ASSERT_TRUE(md_output.find("#### Hardware Counters") != std::string::npos);
+    ASSERT_TRUE(md_output.find("| Copy | 1GB | 4 | 1.50 | - | - | - | 2000 | 1000 | 3.00x |") != std::string::npos);
+    ASSERT_TRUE(md_output.find("| Triad | 1GB | 4 | 1.50") == std::string::npos);
+
+    OutputFormatter json_formatter(OutputFormat::JSON);
+    std::string json_output = json_formatter.format_test_results(results, specs);
+    ASSERT_TRUE(json_output.find("\"counters\": {\"cycles\": 2000, \"instructions\": 3000") != std::string::npos);
+    ASSERT_TRUE(json_output.find("\"dram_bytes_per_nominal_byte\": 3.000") != std::string::npos);
+
+    OutputFormatter csv_formatter(OutputFormat::CSV);
+    std::string csv_output = csv_formatter.format_test_results(results, specs);
+    ASSERT_TRUE(csv_output.find("\"Copy\",\"1GB\",4,2000,3000,,,,2000,1000,3.000") != std::string::npos);
+
+    // Nothing counted: no counter section at all
+    std::string plain = md_formatter.format_test_results({uncounted}, specs);
+    ASSERT_TRUE(plain.find("Hardware Counters") == std::string::npos);
+}
+
+void test_page_faults_formatting() {
+    TestResult result;
+    result.test_name = "Sequential Read";
+    result.working_set_desc = "1GB";
+    result.stats = {20.0, 5.0, 1000, 0.5};
+    result.num_threads = 2;
+    result.page_faults.measured = true;
+    result.page_faults.minor_faults = 4096;
+    result.page_faults.major_faults = 12;
+    result.page_faults.faults_per_second = 8236.0;
+
+    std::vector<TestResult> results = {result};
+    MemorySpecs specs = {};
+
+    OutputFormatter md_formatter(OutputFormat::MARKDOWN);
+    std::string md_output = md_formatter.format_test_results(results, specs);
+    ASSERT_TRUE(md_output.find("#### Page Faults") != std::string::npos);
+    ASSERT_TRUE(md_output.find("| Sequential Read | 1GB | 2 | 4096 | 12 | 8236 |") != std::string::npos);
+
+    OutputFormatter json_formatter(OutputFormat::JSON);
+    std::string json_output = json_formatter.format_test_results(results, specs);
+    ASSERT_TRUE(json_output.find("\"page_faults\": {\"minor\": 4096, \"major\": 12, \"faults_per_second\": 8236}") !=
+                std::string::npos);
+
+    OutputFormatter csv_formatter(OutputFormat::CSV);
+    std::string csv_output = csv_formatter.format_test_results(results, specs);
+    ASSERT_TRUE(csv_output.find("\"Sequential Read\",\"1GB\",2,4096,12,8236") != std::string::npos);
+
+    // Anonymous memory: no page fault section
+    result.page_faults = PageFaultStats{};
+    std::string plain = md_formatter.format_test_results({result}, specs);
+    ASSERT_TRUE(plain.find("Page Faults") == std::string::npos);
+}
+
+void test_prefetch_sweep_formatting() {
+    std::vector<PrefetchPoint> points = {
+        {0, false, 10.0, 6.4, 0.0},
+        {512, false, 10.41, 6.15, 4.1},
+        {0, true, 7.5, 8.53, -25.0},
+    };
+
+    OutputFormatter md_formatter(OutputFormat::MARKDOWN);
+    std::string md_output = md_formatter.format_prefetch_sweep("Sequential Read", "1GB", points);
+    ASSERT_TRUE(md_output.find("### Sequential Read Prefetch Sweep (1GB)") != std::string::npos);
+    ASSERT_TRUE(md_output.find("| none | on | 10.00 | 6.40 | baseline |") != std::string::npos);
+    ASSERT_TRUE(md_output.find("| 512 B | on | 10.41 | 6.15 | +4.1 |") != std::string::npos);
+    ASSERT_TRUE(md_output.find("| none | off | 7.50 | 8.53 | -25.0 |") != std::string::npos);
+    ASSERT_TRUE(md_output.find("Best: software prefetch 512 B, hardware prefetchers on (+4.1% vs baseline)") !=
+                std::string::npos);
+
+    OutputFormatter json_formatter(OutputFormat::JSON);
+    std::string json_output = json_formatter.format_prefetch_sweep("Sequential Read", "1GB", points);
+    ASSERT_TRUE(json_output.find("\"prefetch_sweep\": true") != std::string::npos);
+    ASSERT_TRUE(json_output.find("\"best\": {\"distance_bytes\": 512, \"hardware_prefetchers\": \"on\", "
+                                 "\"delta_percent\": 4.1}") != std::string::npos);
+    ASSERT_TRUE(json_output.find("\"hardware_prefetchers\": \"off\"") != std::string::npos);
+
+    OutputFormatter csv_formatter(OutputFormat::CSV);
+    std::string csv_output = csv_formatter.format_prefetch_sweep("Sequential Read", "1GB", points);
+    ASSERT_TRUE(csv_output.find("Software Prefetch (B),Hardware Prefetchers,Bandwidth (GB/s)") != std::string::npos);
+    ASSERT_TRUE(csv_output.find("512,on,10.41,6.15,4.1,1") != std::string::npos);
+    ASSERT_TRUE(csv_output.find("0,off,7.50,8.53,-25.0,0") != std::string::npos);
+}
+
+void test_core_to_core_formatting() {
+    std::vector<size_t> cpus = {0, 1, 2};
+    std::vector<CoherenceTests::PingPongResult> matrix(9);
+    for (size_t row = 0; row < 3; ++row) {
+        for (size_t col = 0; col < 3; ++col) {
+            matrix[row * 3 + col] = {cpus[row], cpus[col], 0.0, 0.0, 0};
+        }
+    }
+    matrix[1] = {0, 1, 40.0, 39.0, 100};
+    matrix[2] = {0, 2, 130.0, 125.0, 100};
+    matrix[3] = {1, 0, 41.0, 40.0, 100};
+    matrix[5] = {1, 2, 128.0, 120.0, 100};
+    matrix[6] = {2, 0, 131.0, 126.0, 100};
+    matrix[7] = {2, 1, 129.0, 121.0, 100};
+
+    OutputFormatter md_formatter(OutputFormat::MARKDOWN);
+    std::string md_output = md_formatter.format_core_to_core(cpus, matrix);
+    ASSERT_TRUE(md_output.find("### Core-to-Core Transfer Latency") != std::string::npos);
+    ASSERT_TRUE(md_output.find("| ns | CPU 0 | CPU 1 | CPU 2 |") != std::string::npos);
+    ASSERT_TRUE(md_output.find("| CPU 0 | - | 40.0 | 130.0 |") != std::string::npos);
+    ASSERT_TRUE(md_output.find("Fastest: CPU 0 -> CPU 1 40.0 ns, median 128.5 ns, slowest: CPU 2 -> CPU 0 "
+                               "131.0 ns (3.3x the fastest)") != std::string::npos);
+
+    OutputFormatter json_formatter(OutputFormat::JSON);
+    std::string json_output = json_formatter.format_core_to_core(cpus, matrix);
+    ASSERT_TRUE(json_output.find("\"cpus\": [0, 1, 2]") != std::string::npos);
+    ASSERT_TRUE(json_output.find("[null, 40.0, 130.0]") != std::string::npos);
+    ASSERT_TRUE(json_output.find("\"fastest\": {\"cpu_a\": 0, \"cpu_b\": 1, \"one_way_ns\": 40.0}") !=
+                std::string::npos);
+
+    OutputFormatter csv_formatter(OutputFormat::CSV);
+    std::string csv_output = csv_formatter.format_core_to_core(cpus, matrix);
+    ASSERT_TRUE(csv_output.find("CPU,0,1,2\n0,,40.0,130.0\n") != std::string::npos);
+}
+
+void test_false_sharing_formatting() {
+    std::vector<CoherenceTests::FalseSharingResult> results(2);
+    results[0].layout = CoherenceTests::CounterLayout::PACKED;
+    results[0].num_threads = 4;
+    results[0].increments_per_thread = 1000;
+    results[0].ns_per_increment = 60.0;
+    results[0].total_mops = 66.7;
+    results[0].verified = true;
+    results[1] = results[0];
+    results[1].layout = CoherenceTests::CounterLayout::PADDED;
+    results[1].ns_per_increment = 6.0;
+    results[1].total_mops = 666.7;
+
+    OutputFormatter md_formatter(OutputFormat::MARKDOWN);
+    std::string md_output = md_formatter.format_false_sharing(results);
+    ASSERT_TRUE(md_output.find("| packed | 4 | 60.00 | 66.7 | 10.00x | yes |") != std::string::npos);
+    ASSERT_TRUE(md_output.find("| padded | 4 | 6.00 | 666.7 | 1.00x | yes |") != std::string::npos);
+
+    OutputFormatter json_formatter(OutputFormat::JSON);
+    std::string json_output = json_formatter.format_false_sharing(results);
+    ASSERT_TRUE(json_output.find("\"layout\": \"packed\"") != std::string::npos);
+    ASSERT_TRUE(json_output.find("\"slowdown_vs_padded\": 10.00") != std::string::npos);
+
+    OutputFormatter csv_formatter(OutputFormat::CSV);
+    std::string csv_output = csv_formatter.format_false_sharing(results);
+    ASSERT_TRUE(csv_output.find("packed,4,1000,60.00,66.7,10.00,true") != std::string::npos);
+}
+
+void test_thread_scaling_formatting() {
+    std::vector<ThreadScaling::ScalingPoint> points(3);
+    points[0].threads = 1;
+    points[0].bandwidth_gbps = 10.0;
+    points[1].threads = 2;
+    points[1].bandwidth_gbps = 19.0;
+    points[2].threads = 4;
+    points[2].bandwidth_gbps = 20.0;
+    ThreadScaling::annotate(points);
+
+    OutputFormatter md_formatter(OutputFormat::MARKDOWN);
+    std::string md_output = md_formatter.format_thread_scaling("Sequential Read", "1GB", "compact", points);
+    ASSERT_TRUE(md_output.find("Sequential Read Thread Scaling (1GB, compact placement)") != std::string::npos);
+    ASSERT_TRUE(md_output.find("| 4 | 20.00 | 0.00 | 2.00x | 5.00 | 50.0 |") != std::string::npos);
+    ASSERT_TRUE(md_output.find("Saturates at 2 threads: 19.00 GB/s") != std::string::npos);
+
+    OutputFormatter json_formatter(OutputFormat::JSON);
+    std::string json_output = json_formatter.format_thread_scaling("Sequential Read", "1GB", "compact", points);
+    ASSERT_TRUE(json_output.find("\"saturation_threads\": 2") != std::string::npos);
+    ASSERT_TRUE(json_output.find("\"efficiency\": 0.950") != std::string::npos);
+
+    OutputFormatter csv_formatter(OutputFormat::CSV);
+    std::string csv_output = csv_formatter.format_thread_scaling("Sequential Read", "1GB", "compact", points);
+    ASSERT_TRUE(csv_output.find("2,19.00,0.00,1.90,0.950,1") != std::string::npos);
+}
+
+void test_atomics_formatting() {
+    std::vector<AtomicTests::Result> results(2);
+    results[0].config.op = AtomicTests::Operation::CAS_LOOP;
+    results[0].config.ordering = AtomicTests::Ordering::SEQ_CST;
+    results[0].config.sharing = AtomicTests::Sharing::SHARED;
+    results[0].config.ops_per_thread = 1000;
+    results[0].num_threads = 1;
+    results[0].total_mops = 100.0;
+    results[0].ns_per_op = 10.0;
+    results[0].verified = true;
+    results[1] = results[0];
+    results[1].num_threads = 4;
+    results[1].total_mops = 25.0;
+    results[1].ns_per_op = 160.0;
+
+    OutputFormatter md_formatter(OutputFormat::MARKDOWN);
+    std::string md_output = md_formatter.format_atomics("lock prefix", results);
+    ASSERT_TRUE(md_output.find("std::atomic compiled as: lock prefix") != std::string::npos);
+    ASSERT_TRUE(md_output.find("| cas_loop | seq_cst | shared | std | 4 | 25.0 | 160.00 | 0.25x | yes |") !=
+                std::string::npos);
+
+    OutputFormatter json_formatter(OutputFormat::JSON);
+    std::string json_output = json_formatter.format_atomics("lock prefix", results);
+    ASSERT_TRUE(json_output.find("\"std_atomics\": \"lock prefix\"") != std::string::npos);
+    ASSERT_TRUE(json_output.find("\"scaling_vs_single_thread\": 0.25") != std::string::npos);
+
+    OutputFormatter csv_formatter(OutputFormat::CSV);
+    std::string csv_output = csv_formatter.format_atomics("lock prefix", results);
+    ASSERT_TRUE(csv_output.find("cas_loop,seq_cst,shared,std,4,1000,25.0,160.00,0.25,true") != std::string::npos);
+}
+
+void test_access_formatting() {
+    TestResult result;
+    result.test_name = "Gather 8B";
+    result.working_set_desc = "1GB";
+    result.stats = {2.0, 4.0, 1000, 0.5};
+    result.num_threads = 4;
+    result.access.measured = true;
+    result.access.element_bytes = 8;
+    result.access.layout = "zipf:0.99";
+    result.access.useful_gbps = 2.0;
+    result.access.line_gbps = 16.0;
+    result.access.line_use = 0.125;
+
+    std::vector<TestResult> results = {result};
+    MemorySpecs specs = {};
+
+    OutputFormatter md_formatter(OutputFormat::MARKDOWN);
+    std::string md_output = md_formatter.format_test_results(results, specs);
+    ASSERT_TRUE(md_output.find("#### Sparse Access") != std::string::npos);
+    ASSERT_TRUE(md_output.find("| Gather 8B | 1GB | 4 | 8 B | zipf:0.99 | 2.00 | 16.00 | 12.5% |") !=
+                std::string::npos);
+
+    OutputFormatter json_formatter(OutputFormat::JSON);
+    std::string json_output = json_formatter.format_test_results(results, specs);
+    ASSERT_TRUE(json_output.find("\"access\": {\"element_bytes\": 8, \"layout\": \"zipf:0.99\", "
+                                 "\"useful_gbps\": 2.00, \"line_gbps\": 16.00, \"line_use\": 0.125}") !=
+                std::string::npos);
+
+    OutputFormatter csv_formatter(OutputFormat::CSV);
+    std::string csv_output = csv_formatter.format_test_results(results, specs);
+    ASSERT_TRUE(csv_output.find("\"Gather 8B\",\"1GB\",4,8,zipf:0.99,2.00,16.00,0.125") != std::string::npos);
+
+    // Dense patterns: no sparse access section
+    result.access = AccessStats{};
+    std::string plain = md_formatter.format_test_results({result}, specs);
+    ASSERT_TRUE(plain.find("Sparse Access") == std::string::npos);
+}
+
+void test_decode_formatting() {
+    TestResult result;
+    result.test_name = "Decode Dict 16b";
+    result.working_set_desc = "L2";
+    result.stats = {2.0, 4.0, 1000, 0.5};
+    result.num_threads = 1;
+    result.decode.measured = true;
+    result.decode.encoding = "dict";
+    result.decode.bits = 16;
+    result.decode.values_per_second = 1e9;
+    result.decode.output_gbps = 8.0;
+    result.decode.expansion = 4.0;
+
+    std::vector<TestResult> results = {result};
+    MemorySpecs specs = {};
+
+    OutputFormatter md_formatter(OutputFormat::MARKDOWN);
+    std::string md_output = md_formatter.format_test_results(results, specs);
+    ASSERT_TRUE(md_output.find("#### Decoded Output") != std::string::npos);
+    ASSERT_TRUE(md_output.find("| Decode Dict 16b | L2 | 1 | dict | 16 | 2.00 | 1.00 | 8.00 | 4.0x |") !=
+                std::string::npos);
+
+    OutputFormatter json_formatter(OutputFormat::JSON);
+    std::string json_output = json_formatter.format_test_results(results, specs);
+    ASSERT_TRUE(json_output.find("\"decode\": {\"encoding\": \"dict\", \"bits\": 16, "
+                                 "\"values_per_second\": 1000000000, \"output_gbps\": 8.00, \"expansion\": 4.00}") !=
+                std::string::npos);
+
+    OutputFormatter csv_formatter(OutputFormat::CSV);
+    std::string csv_output = csv_formatter.format_test_results(results, specs);
+    ASSERT_TRUE(csv_output.find("\"Decode Dict 16b\",\"L2\",1,dict,16,2.00,1000000000,8.00,4.00") != std::string::npos);
+
+    result.decode = DecodeStats{};
+    std::string plain = md_formatter.format_test_results({result}, specs);
+    ASSERT_TRUE(plain.find("Decoded Output") == std::string::npos);
+}
+
+void test_proxy_formatting() {
+    TestResult result;
+    result.test_name = "Hash Probe (group, 75% full, batch 16)";
+    result.working_set_desc = "L3";
+    result.stats = {3.2, 5.0, 1000, 0.5};
+    result.num_threads = 4;
+    result.proxy.measured = true;
+    result.proxy.unit = "lookups";
+    result.proxy.per_second = 2e8;
+    result.proxy.bytes_per_operation = 16;
+
+    std::vector<TestResult> results = {result};
+    MemorySpecs specs = {};
+
+    OutputFormatter md_formatter(OutputFormat::MARKDOWN);
+    std::string md_output = md_formatter.format_test_results(results, specs);
+    ASSERT_TRUE(md_output.find("#### Application Proxies") != std::string::npos);
+    ASSERT_TRUE(md_output.find("| Hash Probe (group, 75% full, batch 16) | L3 | 4 | 3.20 | 200.00 Mlookups/s | 16 | "
+                               "5.00 |") != std::string::npos);
+
+    OutputFormatter json_formatter(OutputFormat::JSON);
+    std::string json_output = json_formatter.format_test_results(results, specs);
+    ASSERT_TRUE(json_output.find("\"proxy\": {\"unit\": \"lookups\", \"per_second\": 200000000, "
+                                 "\"bytes_per_operation\": 16}") != std::string::npos);
+
+    OutputFormatter csv_formatter(OutputFormat::CSV);
+    std::string csv_output = csv_formatter.format_test_results(results, specs);
+    ASSERT_TRUE(csv_output.find("\"Hash Probe (group, 75% full, batch 16)\",\"L3\",4,3.20,lookups,200000000,16,5.00") !=
+                std::string::npos);
+
+    result.proxy = ProxyStats{};
+    std::string plain = md_formatter.format_test_results({result}, specs);
+    ASSERT_TRUE(plain.find("Application Proxies") == std::string::npos);
+}
+
+void test_irregular_formatting() {
+    TestResult result;
+    result.test_name = "SpMV SELL-8-256 powerlaw 16/row";
+    result.working_set_desc = "L3";
+    result.stats = {12.5, 0.4, 1000, 0.5};
+    result.num_threads = 4;
+    result.irregular.measured = true;
+    result.irregular.gflops = 2.25;
+    result.irregular.triad_gbps = 25.0;
+    result.irregular.triad_percent = 50.0;
+    result.irregular.padding_percent = 12.5;
+
+    std::vector<TestResult> results = {result};
+    MemorySpecs specs = {};
+
+    OutputFormatter md_formatter(OutputFormat::MARKDOWN);
+    std::string md_output = md_formatter.format_test_results(results, specs);
+    ASSERT_TRUE(md_output.find("#### Irregular Compute") != std::string::npos);
+    ASSERT_TRUE(md_output.find("| SpMV SELL-8-256 powerlaw 16/row | L3 | 4 | 12.50 | 2.25 | 25.00 | 50.0% | 12.5% |") !=
+                std::string::npos);
+
+    OutputFormatter json_formatter(OutputFormat::JSON);
+    std::string json_output = json_formatter.format_test_results(results, specs);
+    ASSERT_TRUE(json_output.find("\"irregular\": {\"gflops\": 2.250, \"triad_gbps\": 25.00, \"triad_percent\": 50.0, "
+                                 "\"padding_percent\": 12.5}") != std::string::npos);
+
+    OutputFormatter csv_formatter(OutputFormat::CSV);
+    std::string csv_output = csv_formatter.format_test_results(results, specs);
+    ASSERT_TRUE(csv_output.find("\"SpMV SELL-8-256 powerlaw 16/row\",\"L3\",4,12.50,2.250,25.00,50.0,12.5") !=
+                std::string::npos);
+
+    result.irregular = IrregularStats{};
+    std::string plain = md_formatter.format_test_results({result}, specs);
+    ASSERT_TRUE(plain.find("Irregular Compute") == std::string::npos);
+}
+
+void test_energy_formatting() {
+    TestResult result;
+    result.test_name = "Sequential Read";
+    result.working_set_desc = "4GB";
+    result.stats = {20.0, 4.0, 1000, 0.5};
+    result.num_threads = 8;
+    result.energy.measured = true;
+    result.energy.has_dram = true;
+    result.energy.package_joules = 40.0;
+    result.energy.dram_joules = 10.0;
+    result.energy.seconds = 0.5;
+    result.energy.package_watts = 80.0;
+    result.energy.dram_watts = 20.0;
+    result.energy.pj_per_byte = 5000.0;
+
+    std::vector<TestResult> results = {result};
+    MemorySpecs specs = {};
+
+    OutputFormatter md_formatter(OutputFormat::MARKDOWN);
+    std::string md_output = md_formatter.format_test_results(results, specs);
+    ASSERT_TRUE(md_output.find("#### Energy") != std::string::npos);
+    ASSERT_TRUE(md_output.find("| Sequential Read | 4GB | 8 | 20.00 | 80.0 | 20.0 | 5000.0 |") != std::string::npos);
+
+    OutputFormatter json_formatter(OutputFormat::JSON);
+    std::string json_output = json_formatter.format_test_results(results, specs);
+    ASSERT_TRUE(json_output.find("\"energy\": {\"package_joules\": 40.000, \"dram_joules\": 10.000, "
+                                 "\"seconds\": 0.5000, \"package_watts\": 80.00, \"dram_watts\": 20.00, "
+                                 "\"pj_per_byte\": 5000.00}") != std::string::npos);
+
+    OutputFormatter csv_formatter(OutputFormat::CSV);
+    std::string csv_output = csv_formatter.format_test_results(results, specs);
+    ASSERT_TRUE(csv_output.find("\"Sequential Read\",\"4GB\",8,20.00,40.000,10.000,0.5000,80.00,20.00,5000.00") !=
+                std::string::npos);
+
+    // Without a DRAM domain the DRAM columns stay empty
+    result.energy.has_dram = false;
+    ASSERT_TRUE(md_formatter.format_test_results({result}, specs).find("| 80.0 | - | 5000.0 |") != std::string::npos);
+    ASSERT_TRUE(json_formatter.format_test_results({result}, specs).find("dram_watts") == std::string::npos);
+
+    result.energy = EnergyStats{};
+    ASSERT_TRUE(md_formatter.format_test_results({result}, specs).find("Energy") == std::string::npos);
+
+    // A thread sweep names the count with the least energy per byte
+    std::vector<ThreadScaling::ScalingPoint> points(3);
+    const double gbps[] = {10.0, 19.0, 20.0};
+    const double pj[] = {900.0, 500.0, 650.0};
+    for (size_t i = 0; i < points.size(); ++i) {
+        points[i].threads = size_t(1) << i;
+        points[i].bandwidth_gbps = gbps[i];
+        points[i].energy_measured = true;
+        points[i].package_watts = 50.0 + 10.0 * static_cast<double>(i);
+        points[i].pj_per_byte = pj[i];
+    }
+    ThreadScaling::annotate(points);
+    md_output = md_formatter.format_thread_scaling("Sequential Read", "1GB", "compact", points);
+    ASSERT_TRUE(md_output.find("| Package (W) | DRAM (W) | pJ/byte |") != std::string::npos);
+    ASSERT_TRUE(md_output.find("Least energy per byte at 2 threads: 500.0 pJ/byte at 19.00 GB/s") !=
+                std::string::npos);
+    json_output = json_formatter.format_thread_scaling("Sequential Read", "1GB", "compact", points);
+    ASSERT_TRUE(json_output.find("\"energy_optimal_threads\": 2") != std::string::npos);
+    csv_output = csv_formatter.format_thread_scaling("Sequential Read", "1GB", "compact", points);
+    ASSERT_TRUE(csv_output.find("2,19.00,0.00,1.90,0.950,1,60.00,0.00,500.00,1") != std::string::npos);
+}
+
+void test_io_results_formatting() {
+    IoTests::Result uring;
+    uring.method = IoTests::Method::IO_URING;
+    uring.block_size = 128 * 1024;
+    uring.queue_depth = 32;
+    uring.available = true;
+    uring.stats = {6.5, 20000.0, 2000, 1.0};
+    uring.cycles_per_byte = 0.125;
+
+    IoTests::Result direct;
+    direct.method = IoTests::Method::DIRECT;
+    direct.block_size = 128 * 1024;
+    direct.note = "open with O_DIRECT: Invalid argument";
+
+    std::vector<IoTests::Result> results = {uring, direct};
+
+    OutputFormatter md_formatter(OutputFormat::MARKDOWN);
+    std::string md_output = md_formatter.format_io_results(1024 * 1024, 3.0, results);
+    ASSERT_TRUE(md_output.find("### I/O Paths (1MB file, core clock ~3.00 GHz)") != std::string::npos);
+    ASSERT_TRUE(md_output.find("| io_uring | 128KB | 32 | 6.50 | 20.0 | 0.125 | - |") != std::string::npos);
+    ASSERT_TRUE(md_output.find("| direct | 128KB | 1 | - | - | - | open with O_DIRECT: Invalid argument |") !=
+                std::string::npos);
+
+    OutputFormatter json_formatter(OutputFormat::JSON);
+    std::string json_output = json_formatter.format_io_results(1024 * 1024, 3.0, results);
+    ASSERT_TRUE(json_output.find("\"method\": \"io_uring\", \"block_bytes\": 131072, \"queue_depth\": 32") !=
+                std::string::npos);
+    ASSERT_TRUE(json_output.find("\"cycles_per_byte\": 0.125") != std::string::npos);
+    ASSERT_TRUE(json_output.find("\"available\": false, \"note\"") != std::string::npos);
+
+    OutputFormatter csv_formatter(OutputFormat::CSV);
+    std::string csv_output = csv_formatter.format_io_results(1024 * 1024, 3.0, results);
+    ASSERT_TRUE(csv_output.find("io_uring,131072,32,6.50,20000.0,0.125,\"\"") != std::string::npos);
+    ASSERT_TRUE(csv_output.find("direct,131072,1,,,,\"open with O_DIRECT") != std::string::npos);
+}
+
+void test_baseline_comparison_formatting() {
+    Baseline::Comparison slower;
+    slower.current = {"Copy", "1GB", "avx2", "temporal", 8, 85.0, {}};
+    slower.baseline_gbps = 100.0;
+    slower.current_gbps = 85.0;
+    slower.change_percent = -15.0;
+    slower.p_value = 0.0002;
+    slower.tested = true;
+    slower.verdict = Baseline::Verdict::REGRESSED;
+
+    Baseline::Comparison added;
+    added.current = {"Triad", "1GB", "avx2", "temporal", 8, 70.0, {}};
+    added.current_gbps = 70.0;
+
+    std::vector<Baseline::Comparison> comparisons = {slower, added};
+    std::vector<std::string> changes = {"memory_channels: 8 -> 4"};
+
+    OutputFormatter md_formatter(OutputFormat::MARKDOWN);
+    std::string md_output = md_formatter.format_baseline_comparison("node-1", changes, comparisons);
+    ASSERT_TRUE(md_output.find("### Baseline Comparison (node-1)") != std::string::npos);
+    ASSERT_TRUE(md_output.find("- memory_channels: 8 -> 4") != std::string::npos);
+    ASSERT_TRUE(md_output.find("| Copy | 1GB | avx2 | 8 | 100.00 | 85.00 | -15.0% | 0.0002 | **regressed** |") !=
+                std::string::npos);
+    ASSERT_TRUE(md_output.find("| Triad | 1GB | avx2 | 8 | - | 70.00 | - | - | new |") != std::string::npos);
+    ASSERT_TRUE(md_output.find("**1 significant regression** (median drop of 5% or more at p < 0.01)") !=
+                std::string::npos);
+
+    OutputFormatter json_formatter(OutputFormat::JSON);
+    std::string json_output = json_formatter.format_baseline_comparison("node-1", changes, comparisons);
+    ASSERT_TRUE(json_output.find("\"host_changes\": [\"memory_channels: 8 -> 4\"]") != std::string::npos);
+    ASSERT_TRUE(json_output.find("\"regressions\": 1") != std::string::npos);
+    ASSERT_TRUE(json_output.find("\"verdict\": \"regressed\"") != std::string::npos);
+
+    OutputFormatter csv_formatter(OutputFormat::CSV);
+    std::string csv_output = csv_formatter.format_baseline_comparison("node-1", {}, comparisons);
+    ASSERT_TRUE(csv_output.find("# Baseline Comparison (node-1): 1 regressions") != std::string::npos);
+    ASSERT_TRUE(csv_output.find("Copy,1GB,avx2,temporal,8,100.00,85.00,-15.00,0.000200,regressed") !=
+                std::string::npos);
+}
+
+void test_peak_calibration_formatting() {
+    PeakCalibration::HostPeak peak;
+    peak.host_key = "Test CPU|DDR5|4800|8|6.1|default";
+    peak.working_set = "4GB";
+    peak.recorded = "2026-01-31T12:00:00.000Z";
+    peak.ceilings = {{"read", "Sequential Read", "avx2", "-", 8, 80.0},
+                     {"write", "Sequential Write", "avx2", "nontemporal", 4, 60.0}};
+
+    MemorySpecs mem_specs = {};
+    mem_specs.theoretical_bandwidth_gbps = 100.0;
+
+    OutputFormatter md_formatter(OutputFormat::MARKDOWN);
+    std::string md_output = md_formatter.format_peak_calibration(peak, mem_specs);
+    ASSERT_TRUE(md_output.find("### Calibrated Peak (4GB, recorded 2026-01-31T12:00:00.000Z)") != std::string::npos);
+    ASSERT_TRUE(md_output.find("| write | Sequential Write | avx2 | nontemporal | 4 | 60.00 | 60.0 |") !=
+                std::string::npos);
+    ASSERT_TRUE(md_output.find("Calibrated peak: **80.00 GB/s**, 80.0% of the theoretical") != std::string::npos);
+
+    OutputFormatter json_formatter(OutputFormat::JSON);
+    std::string json_output = json_formatter.format_peak_calibration(peak, mem_specs);
+    ASSERT_TRUE(json_output.find("\"calibrated_bandwidth_gbps\": 80.00") != std::string::npos);
+    ASSERT_TRUE(json_output.find("\"family\": \"write\"") != std::string::npos);
+
+    OutputFormatter csv_formatter(OutputFormat::CSV);
+    std::string csv_output = csv_formatter.format_peak_calibration(peak, mem_specs);
+    ASSERT_TRUE(csv_output.find("read,\"Sequential Read\",avx2,-,8,80.00,80.0") != std::string::npos);
+
+    // Results report their share of the calibrated peak once one is known
+    TestResult result = {};
+    result.test_name = "Copy";
+    result.working_set_desc = "4GB";
+    result.num_threads = 8;
+    result.kernel_name = "avx2";
+    result.store_policy = "temporal";
+    result.stats.bandwidth_gbps = 40.0;
+    std::string uncalibrated = md_formatter.format_test_results({result}, mem_specs);
+    ASSERT_TRUE(uncalibrated.find("| 40.0 | N/A |") != std::string::npos);
+    ASSERT_TRUE(json_formatter.format_test_results({result}, mem_specs).find(
+                    "\"calibrated_efficiency_percent\": null") != std::string::npos);
+
+    mem_specs.calibrated_bandwidth_gbps = 80.0;
+    std::string calibrated = md_formatter.format_test_results({result}, mem_specs);
+    ASSERT_TRUE(calibrated.find("| 40.0 | 50.0 |") != std::string::npos);
+    ASSERT_TRUE(json_formatter.format_test_results({result}, mem_specs).find(
+                    "\"calibrated_efficiency_percent\": 50.0") != std::string::npos);
+}
+
 int main() {
     TestFramework framework;
     
@@ -178,6 +1134,32 @@ int main() {
     TEST_CASE("Cache info formatting", test_cache_info_formatting);
     TEST_CASE("Format enum conversion", test_format_enum_conversion);
     TEST_CASE("Special characters handling", test_special_characters_handling);
+    TEST_CASE("NUMA matrix formatting", test_numa_matrix_formatting);
+    TEST_CASE("Memory tiers formatting", test_memory_tiers_formatting);
+    TEST_CASE("GPU bandwidth formatting", test_gpu_bandwidth_formatting);
+    TEST_CASE("Fleet report formatting", test_fleet_report_formatting);
+    TEST_CASE("Sample stats formatting", test_sample_stats_formatting);
+    TEST_CASE("Loaded latency formatting", test_loaded_latency_formatting);
+    TEST_CASE("GEMM compute formatting", test_gemm_compute_formatting);
+    TEST_CASE("Roofline formatting", test_roofline_formatting);
+    TEST_CASE("Working-set sweep formatting", test_working_set_sweep_formatting);
+    TEST_CASE("Counters formatting", test_counters_formatting);
+    TEST_CASE("Page faults formatting", test_page_faults_formatting);
+    TEST_CASE("Sparse access formatting", test_access_formatting);
+    TEST_CASE("Decode formatting", test_decode_formatting);
+    TEST_CASE("Proxy formatting", test_proxy_formatting);
+    TEST_CASE("Irregular formatting", test_irregular_formatting);
+    TEST_CASE("Energy formatting", test_energy_formatting);
+    TEST_CASE("Prefetch sweep formatting", test_prefetch_sweep_formatting);
+    TEST_CASE("Core-to-core formatting", test_core_to_core_formatting);
+    TEST_CASE("False sharing formatting", test_false_sharing_formatting);
+    TEST_CASE("Atomics formatting", test_atomics_formatting);
+    TEST_CASE("Thread scaling formatting", test_thread_scaling_formatting);
+    TEST_CASE("Contention formatting", test_contention_formatting);
+    TEST_CASE("Soak formatting", test_soak_formatting);
+    TEST_CASE("I/O results formatting", test_io_results_formatting);
+    TEST_CASE("Baseline comparison formatting", test_baseline_comparison_formatting);
+    TEST_CASE("Peak calibration formatting", test_peak_calibration_formatting);
     
     return framework.run_all();
 }
\ No newline at end of file
@@ -80,6 +80,38 @@ void test_format_memory_specifications_basic() {
     ASSERT_TRUE(result.find("✓") != std::string::npos);
 }
 
+void test_format_memory_specifications_detection() {
+    MemorySpecs mem_specs = {};
+    mem_specs.type = "DDR5";
+    mem_specs.speed_mtps = 4800;
+    mem_specs.data_width_bits = 64;
+    mem_specs.num_channels = 12;
+    mem_specs.num_channels_detected = true;
+    mem_specs.theoretical_bandwidth_gbps = 460.8;
+    mem_specs.speed_detected = true;
+    mem_specs.detection_source = "SMBIOS (2 sockets)";
+
+    std::string result = format_memory_specifications(mem_specs);
+    ASSERT_TRUE(result.find("4800 MT/s ✓") != std::string::npos);
+    ASSERT_TRUE(result.find("- **Detected From:** SMBIOS (2 sockets)") != std::string::npos);
+    ASSERT_TRUE(result.find("460.8 GB/s (3686.4 Gb/s) ✓") != std::string::npos);
+
+    // Platform defaults: the speed is shown as assumed and the peak is not checked
+    mem_specs.speed_detected = false;
+    mem_specs.detection_source.clear();
+    result = format_memory_specifications(mem_specs);
+    ASSERT_TRUE(result.find("4800 MT/s (assumed)") != std::string::npos);
+    ASSERT_TRUE(result.find("Detected From") == std::string::npos);
+    ASSERT_TRUE(result.find("Gb/s) ✓") == std::string::npos);
+    ASSERT_TRUE(result.find("Calibrated Peak") == std::string::npos);
+
+    mem_specs.calibrated_bandwidth_gbps = 368.64;
+    mem_specs.calibrated_on = "2026-01-31T12:00:00.000Z";
+    result = format_memory_specifications(mem_specs);
+    ASSERT_TRUE(result.find("- **Calibrated Peak:** 368.6 GB/s, 80.0% of theoretical (measured "
+                            "2026-01-31T12:00:00.000Z)") != std::string::npos);
+}
+
 void test_format_memory_specifications_virtualized() {
     MemorySpecs mem_specs = {};
     mem_specs.type = "DDR4";
@@ -154,6 +186,12 @@ void test_format_cache_information_traditional() {
     
     // Should NOT have System Level Cache
     ASSERT_FALSE(result.find("System Level Cache") != std::string::npos);
+    ASSERT_FALSE(result.find("instances") != std::string::npos);
+
+    // One L3 per CCX
+    cache_info.l3_sharing = {{0, 1, 2, 3}, {4, 5, 6, 7}};
+    result = format_cache_information(cache_info, mem_specs);
+    ASSERT_TRUE(result.find("8 MB shared (2 instances)") != std::string::npos);
 }
 
 void test_format_efficiency_display() {
@@ -238,6 +276,13 @@ void test_cache_information_size_calculations() {
     ASSERT_TRUE(result.find("1 MB shared") != std::string::npos);
 }
 
+void test_format_byte_size() {
+    TestAssert::assert_equal(std::string("512B"), format_byte_size(512));
+    TestAssert::assert_equal(std::string("48KB"), format_byte_size(48 * 1024));
+    TestAssert::assert_equal(std::string("1.5MB"), format_byte_size(1536 * 1024));
+    TestAssert::assert_equal(std::string("2GB"), format_byte_size(2ULL * 1024 * 1024 * 1024));
+}
+
 int main() {
     TestFramework framework;
     
@@ -245,6 +290,7 @@ int main() {
     TEST_CASE("Format basic system info edge cases", test_format_basic_system_info_edge_cases);
     TEST_CASE("Format memory specifications basic", test_format_memory_specifications_basic);
     TEST_CASE("Format memory specifications virtualized", test_format_memory_specifications_virtualized);
+    TEST_CASE("Format memory specifications detection", test_format_memory_specifications_detection);
     TEST_CASE("Format memory specifications unknown speed", test_format_memory_specifications_unknown_speed);
     TEST_CASE("Format cache information unified", test_format_cache_information_unified);
     TEST_CASE("Format cache information traditional", test_format_cache_information_traditional);
@@ -252,6 +298,7 @@ int main() {
     TEST_CASE("Is memory type detected", test_is_memory_type_detected);
     TEST_CASE("Format memory specifications edge cases", test_format_memory_specifications_edge_cases);
     TEST_CASE("Cache information size calculations", test_cache_information_size_calculations);
+    TEST_CASE("Format byte size", test_format_byte_size);
     
     return framework.run_all();
 }
\ No newline at end of file
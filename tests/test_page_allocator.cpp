@@ -0,0 +1,189 @@
+#include "test_framework.h"
+#include "../common/page_allocator.h"
+#include "../common/errors.h"
+#include <cstdint>
+#include <cstring>
+
+namespace {
+
+constexpr size_t TEST_SIZE = 4 * 1024 * 1024 + 123;  // Not a multiple of any page size
+constexpr size_t CACHE_LINE = 64;
+
+bool is_aligned_to(const void* ptr, size_t alignment) {
+    return (reinterpret_cast<uintptr_t>(ptr) & (alignment - 1)) == 0;
+}
+
+// Allocate, touch every byte, verify and release
+void exercise_mode(PageMode mode, size_t expected_alignment) {
+    PageAllocator::Allocation allocation = PageAllocator::allocate(TEST_SIZE, CACHE_LINE, mode);
+    ASSERT_NOT_NULL(allocation.usable);
+    ASSERT_TRUE(allocation.mode == mode);
+    ASSERT_TRUE(is_aligned_to(allocation.usable, expected_alignment));
+    ASSERT_TRUE(allocation.length >= TEST_SIZE);
+
+    uint8_t* data = static_cast<uint8_t*>(allocation.usable);
+    std::memset(data, 0xA5, TEST_SIZE);
+    ASSERT_TRUE(data[0] == 0xA5);
+    ASSERT_TRUE(data[TEST_SIZE - 1] == 0xA5);
+
+    PageAllocator::release(allocation);
+    ASSERT_TRUE(allocation.base == nullptr);
+    ASSERT_TRUE(allocation.usable == nullptr);
+}
+
+}  // namespace
+
+void test_mode_names_round_trip() {
+    for (const auto& name : PageAllocator::get_page_mode_names()) {
+        PageMode mode = PageAllocator::string_to_page_mode(name);
+        TestAssert::assert_equal(name, PageAllocator::page_mode_to_string(mode));
+    }
+    ASSERT_TRUE(PageAllocator::string_to_page_mode("2m") == PageMode::HUGE_2M);
+}
+
+void test_invalid_mode_name() {
+    try {
+        PageAllocator::string_to_page_mode("64k");
+        ASSERT_TRUE(false);  // Should throw
+    } catch (const ArgumentError& e) {
+        std::string error_msg = e.what();
+        ASSERT_TRUE(error_msg.find("Invalid page size '64k'") != std::string::npos);
+        ASSERT_TRUE(error_msg.find("thp") != std::string::npos);
+    }
+}
+
+void test_default_allocation() {
+    exercise_mode(PageMode::DEFAULT, CACHE_LINE);
+}
+
+void test_small_page_allocation() {
+    exercise_mode(PageMode::SMALL, 4096);
+}
+
+void test_thp_allocation() {
+#ifdef __linux__
+    try {
+        exercise_mode(PageMode::THP, 2 * 1024 * 1024);
+    } catch (const MemoryError&) {
+        // THP disabled on this system ("never"); the failure must be a MemoryError
+    }
+#endif
+}
+
+void test_hugetlb_allocation_or_error() {
+    // Depends on reserved pages: either a usable 2 MB aligned mapping or a MemoryError
+    try {
+        exercise_mode(PageMode::HUGE_2M, 2 * 1024 * 1024);
+    } catch (const MemoryError& e) {
+        std::string error_msg = e.what();
+        ASSERT_TRUE(error_msg.find("2M pages") != std::string::npos);
+    }
+}
+
+void test_zero_size_rejected() {
+    try {
+        PageAllocator::allocate(0, CACHE_LINE, PageMode::SMALL);
+        ASSERT_TRUE(false);  // Should throw
+    } catch (const MemoryError&) {
+    }
+}
+
+void test_query_backing() {
+    PageAllocator::Allocation allocation = PageAllocator::allocate(TEST_SIZE, CACHE_LINE, PageMode::SMALL);
+    std::memset(allocation.usable, 1, TEST_SIZE);
+
+    PageAllocator::PageReport report = PageAllocator::query_backing(allocation.usable, PageMode::SMALL);
+#ifdef __linux__
+    ASSERT_TRUE(report.available);
+    ASSERT_TRUE(report.kernel_page_size >= 4096);
+    ASSERT_TRUE(report.resident_bytes >= TEST_SIZE);
+    // MADV_NOHUGEPAGE keeps THP away from the range
+    ASSERT_TRUE(report.anon_huge_bytes == 0);
+#endif
+    ASSERT_FALSE(PageAllocator::describe_backing(report).empty());
+
+    PageAllocator::release(allocation);
+}
+
+void test_describe_backing() {
+    PageAllocator::PageReport report;
+    TestAssert::assert_equal(std::string("unknown"), PageAllocator::describe_backing(report));
+
+    report.available = true;
+    report.kernel_page_size = 2 * 1024 * 1024;
+    TestAssert::assert_equal(std::string("2M hugetlb"), PageAllocator::describe_backing(report));
+
+    report.kernel_page_size = 4096;
+    report.resident_bytes = 100 * 1024 * 1024;
+    report.anon_huge_bytes = 50 * 1024 * 1024;
+    TestAssert::assert_equal(std::string("4K + 50% 2M THP"), PageAllocator::describe_backing(report));
+}
+
+void test_file_advice_names() {
+    for (FileAdvice advice : {FileAdvice::NORMAL, FileAdvice::SEQUENTIAL, FileAdvice::RANDOM, FileAdvice::WILLNEED}) {
+        ASSERT_TRUE(PageAllocator::string_to_file_advice(PageAllocator::file_advice_to_string(advice)) == advice);
+    }
+    ASSERT_TRUE(PageAllocator::string_to_file_cache("cold") == FileCache::COLD);
+    try {
+        PageAllocator::string_to_file_advice("dontneed");
+        ASSERT_TRUE(false);  // Should throw
+    } catch (const ArgumentError& e) {
+        std::string error_msg = e.what();
+        ASSERT_TRUE(error_msg.find("Invalid madvise mode 'dontneed'") != std::string::npos);
+    }
+}
+
+void test_file_allocation() {
+    FileOptions options;
+    options.directory = "/tmp";
+    options.advice = FileAdvice::SEQUENTIAL;
+    options.cache = FileCache::COLD;
+
+    PageAllocator::Allocation allocation = PageAllocator::allocate_file(TEST_SIZE, options);
+    ASSERT_NOT_NULL(allocation.usable);
+    ASSERT_TRUE(allocation.fd >= 0);
+    ASSERT_TRUE(is_aligned_to(allocation.usable, 4096));
+    ASSERT_TRUE(allocation.length >= TEST_SIZE);
+
+    // Writes reach the file, so they survive dropping the page tables
+    uint8_t* data = static_cast<uint8_t*>(allocation.usable);
+    std::memset(data, 0x5A, TEST_SIZE);
+    PageAllocator::reset_file_pages(allocation, options);
+    ASSERT_TRUE(data[0] == 0x5A);
+    ASSERT_TRUE(data[TEST_SIZE - 1] == 0x5A);
+
+    PageAllocator::release(allocation);
+    ASSERT_TRUE(allocation.base == nullptr);
+    ASSERT_TRUE(allocation.fd == -1);
+}
+
+void test_file_allocation_bad_directory() {
+    FileOptions options;
+    options.directory = "/nonexistent-memory-benchmarks-dir";
+    try {
+        PageAllocator::allocate_file(TEST_SIZE, options);
+        ASSERT_TRUE(false);  // Should throw
+    } catch (const MemoryError& e) {
+        std::string error_msg = e.what();
+        ASSERT_TRUE(error_msg.find("Failed to create a backing file") != std::string::npos);
+    }
+}
+
+int main() {
+    TestFramework framework;
+
+    TEST_CASE("Mode names round trip", test_mode_names_round_trip);
+    TEST_CASE("Invalid mode name", test_invalid_mode_name);
+    TEST_CASE("Default allocation", test_default_allocation);
+    TEST_CASE("Small page allocation", test_small_page_allocation);
+    TEST_CASE("THP allocation", test_thp_allocation);
+    TEST_CASE("Hugetlb allocation or error", test_hugetlb_allocation_or_error);
+    TEST_CASE("Zero size rejected", test_zero_size_rejected);
+    TEST_CASE("Query backing", test_query_backing);
+    TEST_CASE("Describe backing", test_describe_backing);
+    TEST_CASE("File advice names", test_file_advice_names);
+    TEST_CASE("File allocation", test_file_allocation);
+    TEST_CASE("File allocation in a missing directory", test_file_allocation_bad_directory);
+
+    return framework.run_all();
+}
@@ -0,0 +1,258 @@
+#include "test_framework.h"
+#include "../common/pattern_registry.h"
+#include "../common/aligned_buffer.h"
+#include "../common/errors.h"
+#include <atomic>
+#include <string>
+#include <vector>
+
+void test_every_pattern_registered() {
+    const auto& patterns = PatternRegistry::all();
+    TestAssert::assert_equal_size_t(23, patterns.size());
+    for (const auto& pattern : patterns) {
+        // Each enum value once, under a unique name that parses back to it
+        ASSERT_TRUE(&PatternRegistry::get(pattern.id) == &pattern);
+        ASSERT_TRUE(PatternRegistry::parse(pattern.name) == pattern.id);
+        ASSERT_TRUE(!get_pattern_name(pattern.id).empty());
+        ASSERT_TRUE(pattern.run != nullptr || pattern.variants == PatternRegistry::KernelVariants::GEMM);
+    }
+    TestAssert::assert_equal(std::string("sequential_read"), PatternRegistry::names().front());
+}
+
+void test_parse() {
+    ASSERT_TRUE(PatternRegistry::parse("triad") == TestPattern::TRIAD);
+    ASSERT_TRUE(PatternRegistry::parse("strided") == TestPattern::STRIDED_READ);
+    ASSERT_TRUE(PatternRegistry::find("all") == nullptr);
+
+    try {
+        PatternRegistry::parse("all");
+        ASSERT_TRUE(false);  // Should throw
+    } catch (const ArgumentError& e) {
+        std::string error_msg = e.what();
+        ASSERT_TRUE(error_msg.find("Unknown pattern 'all'") != std::string::npos);
+    }
+}
+
+void test_defaults() {
+    std::vector<TestPattern> expected = {TestPattern::SEQUENTIAL_READ, TestPattern::SEQUENTIAL_WRITE,
+                                         TestPattern::RANDOM_READ, TestPattern::RANDOM_WRITE,
+                                         TestPattern::COPY, TestPattern::SCALE, TestPattern::ADD, TestPattern::TRIAD,
+                                         TestPattern::MATRIX_MULTIPLY, TestPattern::LATENCY_CHASE};
+    ASSERT_TRUE(PatternRegistry::defaults() == expected);
+}
+
+void test_arrays_and_traffic() {
+    StreamCounts streams = parse_stream_counts("8:2");
+    const size_t size = 4096;
+
+    TestAssert::assert_equal_size_t(1, PatternRegistry::arrays(PatternRegistry::get(TestPattern::SEQUENTIAL_READ),
+                                                               streams));
+    TestAssert::assert_equal_size_t(2, PatternRegistry::arrays(PatternRegistry::get(TestPattern::COPY), streams));
+    TestAssert::assert_equal_size_t(3, PatternRegistry::arrays(PatternRegistry::get(TestPattern::TRIAD), streams));
+    TestAssert::assert_equal_size_t(10, PatternRegistry::arrays(PatternRegistry::get(TestPattern::STREAMS), streams));
+    TestAssert::assert_equal_size_t(1, PatternRegistry::arrays(PatternRegistry::get(TestPattern::SCATTER), streams));
+
+    TestAssert::assert_equal_size_t(2 * size,
+                                    PatternRegistry::bytes_per_pass(PatternRegistry::get(TestPattern::COPY), size,
+                                                                    streams));
+    TestAssert::assert_equal_size_t(3 * size,
+                                    PatternRegistry::bytes_per_pass(PatternRegistry::get(TestPattern::TRIAD), size,
+                                                                    streams));
+    TestAssert::assert_equal_size_t(10 * size,
+                                    PatternRegistry::bytes_per_pass(PatternRegistry::get(TestPattern::STREAMS), size,
+                                                                    streams));
+}
+
+void test_declared_traffic_matches_kernels() {
+    // The declared reads and writes are the byte accounting of every dense kernel
+    const size_t size = 64 * 1024;
+    const size_t iterations = 2;
+    StreamCounts streams;
+    std::vector<AlignedBuffer> storage;
+    std::vector<uint8_t*> buffers;
+    for (size_t i = 0; i < streams.arrays(); ++i) {
+        storage.emplace_back(size, 64);
+    }
+    for (auto& buffer : storage) {
+        buffers.push_back(buffer.data());
+    }
+    std::atomic<bool> stop_flag(false);
+
+    for (const auto& pattern : PatternRegistry::all()) {
+        if (pattern.run == nullptr || pattern.variants != PatternRegistry::KernelVariants::SELECTED) {
+            continue;
+        }
+        PatternRegistry::KernelContext context;
+        context.buffers = &buffers;
+        context.buffer_size = size;
+        context.start_offset = 0;
+        context.end_offset = size;
+        context.iterations = iterations;
+        context.stop_flag = &stop_flag;
+        context.kernel = KernelType::SCALAR;
+        context.streams = &streams;
+        PerformanceStats stats = pattern.run(context);
+        TestAssert::assert_equal_size_t(PatternRegistry::bytes_per_pass(pattern, size, streams) * iterations,
+                                        stats.bytes_processed);
+    }
+}
+
+void test_decode_patterns() {
+    // 7-bit values: 56-byte groups, so the slice is trimmed to whole groups on both ends
+    const size_t size = 64 * 1024;
+    AlignedBuffer storage(size, 64);
+    for (size_t i = 0; i < size; ++i) {
+        storage.data()[i] = static_cast<uint8_t>(i * 131 + 7);
+    }
+    std::vector<uint8_t*> buffers = {storage.data()};
+    std::atomic<bool> stop_flag(false);
+
+    for (TestPattern id : {TestPattern::DECODE_BITPACK, TestPattern::DECODE_DELTA, TestPattern::DECODE_DICT}) {
+        const PatternRegistry::Pattern& pattern = PatternRegistry::get(id);
+        ASSERT_TRUE(pattern.encoded);
+        ASSERT_FALSE(pattern.in_all);
+        ASSERT_TRUE(pattern.variants == PatternRegistry::KernelVariants::DECODE);
+
+        PatternRegistry::KernelContext context;
+        context.buffers = &buffers;
+        context.buffer_size = size;
+        context.start_offset = 10;
+        context.end_offset = size - 10;
+        context.iterations = 3;
+        context.stop_flag = &stop_flag;
+        context.kernel = KernelType::AUTO;
+        context.decode_bits = 7;
+        PerformanceStats stats = pattern.run(context);
+        size_t groups = (size - 10) / 56 - 1;
+        TestAssert::assert_equal_size_t(groups * 56 * 3, stats.bytes_processed);
+        ASSERT_TRUE(stats.verified);
+    }
+    ASSERT_TRUE(PatternRegistry::get(TestPattern::DECODE_DICT).encoding == EncodedScans::Encoding::DICTIONARY);
+}
+
+void test_proxy_patterns() {
+    // Two threads' slices of one range, each with its own table or key column
+    const size_t size = 64 * 1024;
+    AlignedBuffer src(size, 64);
+    AlignedBuffer dst(size, 64);
+    std::vector<uint8_t*> buffers = {src.data(), dst.data()};
+    std::atomic<bool> stop_flag(false);
+    ProxyKernels::Config config;
+    config.merge_ways = 5;
+
+    for (TestPattern id : {TestPattern::HASH_PROBE, TestPattern::RADIX_PARTITION, TestPattern::MULTIWAY_MERGE}) {
+        const PatternRegistry::Pattern& pattern = PatternRegistry::get(id);
+        ASSERT_TRUE(pattern.proxy);
+        ASSERT_FALSE(pattern.in_all);
+        ASSERT_FALSE(pattern.cold);
+
+        for (size_t half = 0; half < 2; ++half) {
+            PatternRegistry::KernelContext context;
+            context.buffers = &buffers;
+            context.buffer_size = size;
+            context.start_offset = half * size / 2;
+            context.end_offset = (half + 1) * size / 2;
+            context.iterations = 3;
+            context.stop_flag = &stop_flag;
+            context.proxy = &config;
+            PerformanceStats stats = pattern.run(context);
+            ASSERT_TRUE(stats.bytes_processed > 0);
+            ASSERT_TRUE(stats.verified);
+        }
+    }
+    // 4096 keys per slice: the partition reads the source twice and writes once, the merge drops the remainder
+    PatternRegistry::KernelContext context;
+    context.buffers = &buffers;
+    context.buffer_size = size;
+    context.end_offset = size / 2;
+    context.iterations = 1;
+    context.stop_flag = &stop_flag;
+    context.proxy = &config;
+    const auto& partition = PatternRegistry::get(TestPattern::RADIX_PARTITION);
+    const auto& merge = PatternRegistry::get(TestPattern::MULTIWAY_MERGE);
+    TestAssert::assert_equal_size_t(4096 * 24, partition.run(context).bytes_processed);
+    TestAssert::assert_equal_size_t(4095 * 16, merge.run(context).bytes_processed);
+}
+
+void test_irregular_patterns() {
+    // Two threads' slices, each with its own matrix or grid pair
+    const size_t size = 256 * 1024;
+    AlignedBuffer storage(size, 64);
+    std::vector<uint8_t*> buffers = {storage.data()};
+    std::atomic<bool> stop_flag(false);
+    IrregularKernels::Config config;
+    config.matrix = IrregularKernels::Matrix::POWER_LAW;
+    config.block = 8;
+
+    for (TestPattern id : {TestPattern::SPMV_CSR, TestPattern::SPMV_SELL, TestPattern::STENCIL_7PT}) {
+        const PatternRegistry::Pattern& pattern = PatternRegistry::get(id);
+        ASSERT_TRUE(pattern.irregular);
+        ASSERT_FALSE(pattern.in_all);
+        ASSERT_FALSE(pattern.cold);
+
+        for (size_t half = 0; half < 2; ++half) {
+            IrregularKernels::Work work;
+            PatternRegistry::KernelContext context;
+            context.buffers = &buffers;
+            context.buffer_size = size;
+            context.start_offset = half * size / 2;
+            context.end_offset = (half + 1) * size / 2;
+            context.iterations = 3;
+            context.stop_flag = &stop_flag;
+            context.irregular = &config;
+            context.work = &work;
+            PerformanceStats stats = pattern.run(context);
+            ASSERT_TRUE(stats.bytes_processed > 0);
+            ASSERT_TRUE(stats.verified);
+            ASSERT_TRUE(work.flops > 0);
+            if (id == TestPattern::STENCIL_7PT) {
+                TestAssert::assert_equal_size_t(0, work.nonzeros);
+            } else {
+                // Effective bytes count the nonzeros, whatever the format pads
+                TestAssert::assert_equal_size_t(work.nonzeros * IrregularKernels::SPMV_FLOPS_PER_NONZERO, work.flops);
+                ASSERT_TRUE(id == TestPattern::SPMV_SELL ? work.stored >= work.nonzeros
+                                                         : work.stored == work.nonzeros);
+            }
+        }
+    }
+}
+
+void test_alignment() {
+    ASSERT_TRUE(PatternRegistry::get(TestPattern::TRIAD).alignment >= 64);
+    TestAssert::assert_equal_size_t(0, PatternRegistry::get(TestPattern::LATENCY_CHASE).alignment);
+    ASSERT_TRUE(PatternRegistry::get(TestPattern::LATENCY_CHASE).single_thread);
+    ASSERT_TRUE(PatternRegistry::get(TestPattern::GATHER).sparse);
+    ASSERT_TRUE(PatternRegistry::get(TestPattern::COPY).store_policy);
+    ASSERT_FALSE(PatternRegistry::get(TestPattern::SCALE).store_policy);
+}
+
+void test_cold_patterns() {
+    size_t cold = 0;
+    for (const auto& pattern : PatternRegistry::all()) {
+        if (pattern.cold) {
+            ++cold;
+            ASSERT_TRUE(pattern.run != nullptr);
+        }
+    }
+    TestAssert::assert_equal_size_t(9, cold);
+    ASSERT_TRUE(PatternRegistry::get(TestPattern::LATENCY_CHASE).cold);
+    ASSERT_FALSE(PatternRegistry::get(TestPattern::STREAMS).cold);
+    ASSERT_FALSE(PatternRegistry::get(TestPattern::GATHER).cold);
+}
+
+int main() {
+    TestFramework framework;
+
+    TEST_CASE("Every pattern registered", test_every_pattern_registered);
+    TEST_CASE("Cold patterns", test_cold_patterns);
+    TEST_CASE("Parse", test_parse);
+    TEST_CASE("Defaults", test_defaults);
+    TEST_CASE("Arrays and traffic", test_arrays_and_traffic);
+    TEST_CASE("Declared traffic matches kernels", test_declared_traffic_matches_kernels);
+    TEST_CASE("Decode patterns", test_decode_patterns);
+    TEST_CASE("Proxy patterns", test_proxy_patterns);
+    TEST_CASE("Irregular patterns", test_irregular_patterns);
+    TEST_CASE("Alignment and flags", test_alignment);
+
+    return framework.run_all();
+}
@@ -0,0 +1,224 @@
+#include "test_framework.h"
+#include "../common/peak_calibration.h"
+#include "../common/errors.h"
+#include <cstdio>
+#include <cstdlib>
+#include <fstream>
+#include <string>
+#include <unistd.h>
+#include <vector>
+
+using PeakCalibration::Ceiling;
+
+namespace {
+
+Ceiling ceiling(const std::string& family, const std::string& store_policy, size_t threads, double bandwidth) {
+    Ceiling c;
+    c.family = family;
+    c.test_name = family == "read" ? "Sequential Read" : family == "write" ? "Sequential Write" : "Copy";
+    c.kernel = "avx2";
+    c.store_policy = store_policy;
+    c.threads = threads;
+    c.bandwidth_gbps = bandwidth;
+    return c;
+}
+
+PeakCalibration::HostPeak host(const std::string& host_key) {
+    PeakCalibration::HostPeak h;
+    h.host_key = host_key;
+    h.host.hostname = "node-1";
+    h.host.cpu_name = "Test CPU";
+    h.host.memory_channels = 8;
+    h.pages = "default";
+    h.recorded = "2026-01-31T12:00:00.000Z";
+    h.working_set = "4GB";
+    return h;
+}
+
+std::string temporary_directory() {
+    char path_template[] = "/tmp/peaks_XXXXXX";
+    return mkdtemp(path_template);
+}
+
+}  // namespace
+
+void test_best_point() {
+    std::vector<ThreadScaling::ScalingPoint> points(4);
+    const double bandwidths[] = {20.0, 38.0, 61.5, 60.0};
+    for (size_t i = 0; i < points.size(); ++i) {
+        points[i].threads = size_t(1) << i;
+        points[i].bandwidth_gbps = bandwidths[i];
+    }
+
+    // Past saturation extra threads only queue: the best point need not be the last
+    Ceiling best = PeakCalibration::best_point("read", "Sequential Read", "avx512", "-", points);
+    TestAssert::assert_equal_size_t(4, best.threads);
+    ASSERT_TRUE(best.bandwidth_gbps == 61.5);
+    TestAssert::assert_equal(std::string("avx512"), best.kernel);
+
+    Ceiling none = PeakCalibration::best_point("read", "Sequential Read", "avx512", "-", {});
+    TestAssert::assert_equal_size_t(0, none.threads);
+    ASSERT_TRUE(none.bandwidth_gbps == 0.0);
+}
+
+void test_best_per_family() {
+    std::vector<Ceiling> best = PeakCalibration::best_per_family(
+        {ceiling("read", "-", 8, 90.0), ceiling("write", "temporal", 8, 40.0), ceiling("write", "nontemporal", 4, 70.0),
+         ceiling("copy", "temporal", 8, 50.0), ceiling("copy", "nontemporal", 8, 45.0)});
+
+    TestAssert::assert_equal_size_t(3, best.size());
+    TestAssert::assert_equal(std::string("read"), best[0].family);
+    TestAssert::assert_equal(std::string("nontemporal"), best[1].store_policy);
+    TestAssert::assert_equal_size_t(4, best[1].threads);
+    TestAssert::assert_equal(std::string("temporal"), best[2].store_policy);
+
+    PeakCalibration::HostPeak peak = host("key");
+    peak.ceilings = best;
+    ASSERT_TRUE(peak.peak_gbps() == 90.0);
+    ASSERT_TRUE(host("key").peak_gbps() == 0.0);
+}
+
+void test_upsert_and_find() {
+    PeakCalibration::Store store;
+    PeakCalibration::HostPeak first = host("a");
+    first.ceilings = {ceiling("read", "-", 8, 10.0)};
+    PeakCalibration::upsert(store, first);
+    PeakCalibration::upsert(store, host("b"));
+    PeakCalibration::HostPeak again = host("a");
+    again.ceilings = {ceiling("read", "-", 8, 12.0)};
+    PeakCalibration::upsert(store, again);
+
+    TestAssert::assert_equal_size_t(2, store.hosts.size());
+    const PeakCalibration::HostPeak* found = PeakCalibration::find(store, "a");
+    ASSERT_TRUE(found != nullptr);
+    ASSERT_TRUE(found->peak_gbps() == 12.0);
+    ASSERT_TRUE(PeakCalibration::find(store, "c") == nullptr);
+}
+
+void test_save_and_load() {
+    std::string directory = temporary_directory();
+    // save creates the missing cache directories
+    std::string path = directory + "/memory-benchmarks/peaks.json";
+    TestAssert::assert_equal_size_t(0, PeakCalibration::load(path).hosts.size());
+
+    PeakCalibration::Store store;
+    PeakCalibration::HostPeak stored = host("Test CPU|DDR5|4800|8|6.1|default");
+    stored.ceilings = {ceiling("read", "-", 8, 90.25), ceiling("write", "nontemporal", 4, 70.5)};
+    PeakCalibration::upsert(store, stored);
+    PeakCalibration::save(path, store);
+
+    PeakCalibration::Store loaded = PeakCalibration::load(path);
+    TestAssert::assert_equal_size_t(1, loaded.hosts.size());
+    const PeakCalibration::HostPeak& peak = loaded.hosts[0];
+    TestAssert::assert_equal(stored.host_key, peak.host_key);
+    TestAssert::assert_equal(std::string("node-1"), peak.host.hostname);
+    TestAssert::assert_equal_size_t(8, peak.host.memory_channels);
+    TestAssert::assert_equal(std::string("4GB"), peak.working_set);
+    TestAssert::assert_equal(std::string("2026-01-31T12:00:00.000Z"), peak.recorded);
+    TestAssert::assert_equal_size_t(2, peak.ceilings.size());
+    TestAssert::assert_equal(std::string("nontemporal"), peak.ceilings[1].store_policy);
+    TestAssert::assert_equal_size_t(4, peak.ceilings[1].threads);
+    ASSERT_TRUE(peak.peak_gbps() == 90.25);
+
+    std::remove(path.c_str());
+    rmdir((directory + "/memory-benchmarks").c_str());
+    rmdir(directory.c_str());
+}
+
+void test_tuned_shapes() {
+    std::string directory = temporary_directory();
+    std::string path = directory + "/peaks.json";
+
+    PeakCalibration::Store store;
+    PeakCalibration::HostPeak calibrated = host("a");
+    calibrated.ceilings = {ceiling("read", "-", 8, 90.25)};
+    PeakCalibration::upsert(store, calibrated);
+
+    // Tuning the host keeps its ceilings, and calibrating it again keeps its shapes
+    PeakCalibration::HostPeak tuned = host("a");
+    tuned.recorded = "";
+    tuned.tuned = "2026-02-01T08:00:00.000Z";
+    PeakCalibration::TunedShape shape;
+    shape.family = "read";
+    shape.level = "L1";
+    shape.shape = "w64u4a2";
+    shape.threads = 8;
+    shape.bandwidth_gbps = 812.5;
+    shape.baseline_gbps = 640.0;
+    tuned.shapes = {shape};
+    PeakCalibration::upsert(store, tuned);
+    PeakCalibration::upsert(store, calibrated);
+    TestAssert::assert_equal_size_t(1, store.hosts.size());
+    ASSERT_TRUE(store.hosts[0].peak_gbps() == 90.25);
+    TestAssert::assert_equal(std::string("2026-01-31T12:00:00.000Z"), store.hosts[0].recorded);
+    PeakCalibration::save(path, store);
+
+    PeakCalibration::Store loaded = PeakCalibration::load(path);
+    const PeakCalibration::HostPeak* peak = PeakCalibration::find(loaded, "a");
+    ASSERT_TRUE(peak != nullptr);
+    TestAssert::assert_equal_size_t(1, peak->ceilings.size());
+    TestAssert::assert_equal_size_t(1, peak->shapes.size());
+    TestAssert::assert_equal(std::string("2026-02-01T08:00:00.000Z"), peak->tuned);
+    TestAssert::assert_equal(std::string("w64u4a2"), peak->shapes[0].shape);
+    TestAssert::assert_equal(std::string("L1"), peak->shapes[0].level);
+    TestAssert::assert_equal_size_t(8, peak->shapes[0].threads);
+    ASSERT_TRUE(peak->shapes[0].bandwidth_gbps == 812.5);
+    ASSERT_TRUE(peak->shapes[0].baseline_gbps == 640.0);
+
+    std::remove(path.c_str());
+    rmdir(directory.c_str());
+}
+
+void test_load_rejects_bad_files() {
+    std::string directory = temporary_directory();
+    std::string path = directory + "/peaks.json";
+    for (const char* text : {"{\"hosts\": [", "{\"hosts\": []}", "{\"peak_version\": 99, \"hosts\": []}"}) {
+        {
+            std::ofstream file(path);
+            file << text;
+        }
+        try {
+            PeakCalibration::load(path);
+            ASSERT_TRUE(false);  // Should throw
+        } catch (const ConfigurationError& e) {
+            std::string error_msg = e.what();
+            ASSERT_TRUE(error_msg.find("Peak file " + path) != std::string::npos);
+        }
+    }
+    std::remove(path.c_str());
+    rmdir(directory.c_str());
+}
+
+void test_default_path() {
+    const char* saved_cache = std::getenv("XDG_CACHE_HOME");
+    std::string saved = saved_cache ? saved_cache : "";
+
+    setenv("XDG_CACHE_HOME", "/var/cache/ci", 1);
+    TestAssert::assert_equal(std::string("/var/cache/ci/memory-benchmarks/peaks.json"),
+                             PeakCalibration::default_path());
+    setenv("XDG_CACHE_HOME", "", 1);
+    if (const char* home = std::getenv("HOME")) {
+        TestAssert::assert_equal(std::string(home) + "/.cache/memory-benchmarks/peaks.json",
+                                 PeakCalibration::default_path());
+    }
+
+    if (saved_cache) {
+        setenv("XDG_CACHE_HOME", saved.c_str(), 1);
+    } else {
+        unsetenv("XDG_CACHE_HOME");
+    }
+}
+
+int main() {
+    TestFramework framework;
+
+    TEST_CASE("Best point of a curve", test_best_point);
+    TEST_CASE("Best ceiling per family", test_best_per_family);
+    TEST_CASE("Upsert and find", test_upsert_and_find);
+    TEST_CASE("Save and load", test_save_and_load);
+    TEST_CASE("Tuned shapes", test_tuned_shapes);
+    TEST_CASE("Load rejects bad files", test_load_rejects_bad_files);
+    TEST_CASE("Default path", test_default_path);
+
+    return framework.run_all();
+}
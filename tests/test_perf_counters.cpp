@@ -0,0 +1,122 @@
+#include "test_framework.h"
+#include "../common/perf_counters.h"
+#include <vector>
+
+using PerfCounters::Counter;
+using PerfCounters::CounterValues;
+
+namespace {
+
+// Counts start/stop calls instead of hardware events
+class FakeGroup : public PerfCounters::CounterGroup {
+public:
+    bool open() override { return true; }
+    void start() override { ++starts; }
+    void stop() override { ++stops; }
+    void reset() override { starts = stops = 0; }
+    CounterValues read() override {
+        CounterValues values;
+        values.set(Counter::CYCLES, starts);
+        return values;
+    }
+
+    size_t starts = 0;
+    size_t stops = 0;
+};
+
+}  // namespace
+
+void test_counter_values() {
+    CounterValues a;
+    ASSERT_TRUE(a.empty());
+    a.set(Counter::CYCLES, 100);
+    a.set(Counter::DRAM_READ_BYTES, 640);
+
+    CounterValues b;
+    b.set(Counter::CYCLES, 50);
+    b.set(Counter::DTLB_MISSES, 3);
+    a += b;
+
+    TestAssert::assert_equal_size_t(150, a.get(Counter::CYCLES));
+    TestAssert::assert_equal_size_t(3, a.get(Counter::DTLB_MISSES));
+    ASSERT_FALSE(a.has(Counter::INSTRUCTIONS));
+    ASSERT_TRUE(a.has_dram_bytes());
+    TestAssert::assert_equal_size_t(640, a.dram_bytes());
+    TestAssert::assert_equal(std::string("llc_miss_loads"), PerfCounters::counter_name(Counter::LLC_MISS_LOADS));
+}
+
+void test_encode_sysfs_event() {
+    std::vector<std::pair<std::string, std::string>> formats = {
+        {"event", "config:0-7"}, {"umask", "config:8-15,32-35"}, {"edge", "config:18"}};
+
+    uint64_t config = 0;
+    ASSERT_TRUE(PerfCounters::encode_sysfs_event("event=0x04,umask=0x03", formats, config));
+    TestAssert::assert_equal_size_t(0x0304, config);
+
+    // Umask bits above 8 continue in the second range; bare terms set 1
+    ASSERT_TRUE(PerfCounters::encode_sysfs_event("event=0xff,umask=0x1ff,edge", formats, config));
+    TestAssert::assert_equal_size_t((uint64_t{1} << 32) | (1u << 18) | 0xffff, config);
+
+    ASSERT_FALSE(PerfCounters::encode_sysfs_event("event=0x04,cmask=1", formats, config));
+    ASSERT_FALSE(PerfCounters::encode_sysfs_event("event=zz", formats, config));
+    ASSERT_FALSE(PerfCounters::encode_sysfs_event("event=1", {{"event", "config1:0-7"}}, config));
+}
+
+void test_regions_follow_attached_groups() {
+    FakeGroup thread_group;
+    FakeGroup uncore;
+    PerfCounters::SharedRegion shared(&uncore);
+
+    PerfCounters::region_begin();  // Nothing attached yet
+    PerfCounters::region_end();
+
+    PerfCounters::attach_thread(&thread_group, &shared);
+    PerfCounters::region_begin();
+    PerfCounters::region_end();
+    PerfCounters::attach_thread(nullptr, nullptr);
+
+    TestAssert::assert_equal_size_t(1, thread_group.starts);
+    TestAssert::assert_equal_size_t(1, thread_group.stops);
+    TestAssert::assert_equal_size_t(1, uncore.starts);
+}
+
+void test_shared_region_runs_while_any_thread_measures() {
+    FakeGroup uncore;
+    PerfCounters::SharedRegion shared(&uncore);
+
+    shared.enter();
+    shared.enter();
+    shared.leave();
+    TestAssert::assert_equal_size_t(0, uncore.stops);  // One thread still inside
+    shared.leave();
+    shared.leave();  // Unbalanced leave is ignored
+
+    TestAssert::assert_equal_size_t(1, uncore.starts);
+    TestAssert::assert_equal_size_t(1, uncore.stops);
+}
+
+void test_unavailable_groups() {
+    ASSERT_TRUE(PerfCounters::create_perf_event_group({}) == nullptr);
+    ASSERT_TRUE(PerfCounters::sysfs_uncore_events("no_such_pmu", "a", "b", 64.0).empty());
+
+    // Opening may fail without a PMU or privileges; reading must still be safe
+    auto group = PerfCounters::create_perf_event_group(PerfCounters::generic_core_events());
+    if (group && group->open()) {
+        group->reset();
+        group->start();
+        group->stop();
+        ASSERT_FALSE(group->read().empty());
+    }
+}
+
+int main() {
+    TestFramework framework;
+
+    TEST_CASE("Counter values", test_counter_values);
+    TEST_CASE("Encode sysfs event", test_encode_sysfs_event);
+    TEST_CASE("Regions follow attached groups", test_regions_follow_attached_groups);
+    TEST_CASE("Shared region runs while any thread measures", test_shared_region_runs_while_any_thread_measures);
+    TEST_CASE("Unavailable groups", test_unavailable_groups);
+
+    return framework.run_all();
+}
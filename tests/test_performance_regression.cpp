@@ -1,8 +1,12 @@
 #include "test_framework.h"
 #include "../common/standard_tests.h"
 #include "../common/aligned_buffer.h"
+#include "../common/matrix_multiply_interface.h"
+#include "../common/errors.h"
 #include <atomic>
 #include <chrono>
+#include <cmath>
+#include <vector>
 
 /**
  * @brief Performance regression test suite
@@ -30,6 +34,7 @@ void test_sequential_read_performance() {
     ASSERT_TRUE(stats.time_seconds > 0.0);   // Should actually take some time
     ASSERT_TRUE(stats.bytes_processed > 0);  // Should process data
     ASSERT_TRUE(total_seconds < 60.0);       // Should complete within 60 seconds
+    ASSERT_TRUE(stats.verified);            // Kernel output matched the reference
     
     std::cout << "Sequential Read: " << stats.bandwidth_gbps << " Gb/s" << std::endl;
 }
@@ -53,6 +58,7 @@ void test_sequential_write_performance() {
     ASSERT_TRUE(stats.time_seconds > 0.0);
     ASSERT_TRUE(stats.bytes_processed > 0);
     ASSERT_TRUE(total_seconds < 60.0);
+    ASSERT_TRUE(stats.verified);            // Kernel output matched the reference
     
     std::cout << "Sequential Write: " << stats.bandwidth_gbps << " Gb/s" << std::endl;
 }
@@ -80,6 +86,28 @@ void test_random_access_performance() {
     std::cout << "Random Access Latency: " << stats.latency_ns << " ns" << std::endl;
 }
 
+void test_latency_chase_performance() {
+    AlignedBuffer buffer(32 * 1024, 128);             // Fits in L1/L2 on every target
+    AlignedBuffer large_buffer(64 * 1024 * 1024, 128);  // Larger than most L3 slices
+    
+    std::atomic<bool> stop_flag{false};
+    
+    auto small = StandardTests::latency_chase_test(
+        buffer.data(), buffer.size(), 0, buffer.size(), 4, stop_flag
+    );
+    auto large = StandardTests::latency_chase_test(
+        large_buffer.data(), large_buffer.size(), 0, large_buffer.size(), 2, stop_flag
+    );
+    
+    ASSERT_TRUE(small.latency_ns > 0.0);
+    ASSERT_TRUE(small.latency_ns < 100.0);     // A cache hit is never 100ns
+    ASSERT_TRUE(large.latency_ns > small.latency_ns);  // Dependent misses cost more than hits
+    ASSERT_TRUE(large.latency_ns < 10000.0);
+    
+    std::cout << "Chase Latency: " << small.latency_ns << " ns (32KB), "
+              << large.latency_ns << " ns (64MB)" << std::endl;
+}
+
 void test_copy_performance() {
     const size_t buffer_size = 8 * 1024 * 1024; // 8MB
     AlignedBuffer src_buffer(buffer_size, 128);
@@ -100,10 +128,101 @@ void test_copy_performance() {
     ASSERT_TRUE(stats.time_seconds > 0.0);
     ASSERT_TRUE(stats.bytes_processed > 0);
     ASSERT_TRUE(total_seconds < 60.0);
+    ASSERT_TRUE(stats.verified);            // Kernel output matched the reference
     
     std::cout << "Copy: " << stats.bandwidth_gbps << " Gb/s" << std::endl;
 }
 
+void test_stream_kernels_performance() {
+    const size_t buffer_size = 2 * 1024 * 1024; // 2MB per array
+    std::vector<AlignedBuffer> arrays;
+    for (size_t i = 0; i < 6; ++i) {
+        arrays.emplace_back(buffer_size, 128);
+    }
+    std::atomic<bool> stop_flag{false};
+
+    auto scale = StandardTests::scale_test(arrays[0].data(), arrays[1].data(), buffer_size, 0, buffer_size, 2,
+                                           stop_flag);
+    auto add = StandardTests::add_test(arrays[0].data(), arrays[1].data(), arrays[2].data(), buffer_size, 0,
+                                       buffer_size, 2, stop_flag);
+    ASSERT_TRUE(scale.verified && add.verified);
+    TestAssert::assert_equal_size_t(buffer_size * 2 * 2, scale.bytes_processed);
+    TestAssert::assert_equal_size_t(buffer_size * 2 * 3, add.bytes_processed);
+
+    // 4 reads and 2 writes, then the read-only and write-only extremes
+    std::vector<const uint8_t*> sources = {arrays[2].data(), arrays[3].data(), arrays[4].data(),
+                                           arrays[5].data()};
+    std::vector<uint8_t*> destinations = {arrays[0].data(), arrays[1].data()};
+    auto mixed = StandardTests::streams_test(sources, destinations, buffer_size, 0, buffer_size, 2, stop_flag);
+    auto reads = StandardTests::streams_test(sources, {}, buffer_size, 0, buffer_size, 2, stop_flag);
+    auto writes = StandardTests::streams_test({}, destinations, buffer_size, 0, buffer_size, 2, stop_flag);
+
+    ASSERT_TRUE(mixed.verified && reads.verified && writes.verified);
+    TestAssert::assert_equal_size_t(buffer_size * 2 * 6, mixed.bytes_processed);
+    TestAssert::assert_equal_size_t(buffer_size * 2 * 4, reads.bytes_processed);
+    TestAssert::assert_equal_size_t(buffer_size * 2 * 2, writes.bytes_processed);
+    ASSERT_TRUE(mixed.bandwidth_gbps > 0.3);
+
+    std::cout << "Streams 4R:2W: " << mixed.bandwidth_gbps << " Gb/s" << std::endl;
+}
+
+void test_sparse_access_performance() {
+    const size_t buffer_size = 4 * 1024 * 1024; // 4MB
+    AlignedBuffer buffer(buffer_size, 64);
+    std::atomic<bool> stop_flag{false};
+
+    AccessPatterns::AccessConfig config;
+    config.element_bytes = 8;
+    config.stride_bytes = 256;
+    AccessPatterns::LineTraffic traffic;
+    auto strided = StandardTests::strided_read_test(buffer.data(), buffer_size, 0, buffer_size, 2, stop_flag,
+                                                    config, nullptr, &traffic);
+    ASSERT_TRUE(strided.verified);
+    TestAssert::assert_equal_size_t(buffer_size / 256 * 8 * 2, strided.bytes_processed);
+    TestAssert::assert_equal_size_t(buffer_size / 256 * 64 * 2, traffic.line_bytes);
+    TestAssert::assert_equal_size_t(strided.bytes_processed, traffic.used_bytes);
+
+    AccessPatterns::parse_distribution("zipf", config);
+    auto gather = StandardTests::gather_test(buffer.data(), buffer_size, 0, buffer_size, 2, false, stop_flag,
+                                             config, KernelType::AUTO, nullptr, &traffic);
+    auto scatter = StandardTests::gather_test(buffer.data(), buffer_size, 0, buffer_size, 2, true, stop_flag,
+                                              config, KernelType::AUTO, nullptr, &traffic);
+    ASSERT_TRUE(gather.verified && scatter.verified);
+    // One access per line of the range, each using 8 of its bytes
+    TestAssert::assert_equal_size_t(buffer_size / 64 * 8 * 2, gather.bytes_processed);
+    // Hot keys repeat: fewer distinct bytes than accesses, never more than the lines holding them
+    ASSERT_TRUE(traffic.used_bytes > 0 && traffic.used_bytes < gather.bytes_processed);
+    ASSERT_TRUE(traffic.used_bytes <= traffic.line_bytes && traffic.line_bytes <= buffer_size * 2);
+    ASSERT_TRUE(gather.bandwidth_gbps > 0.0);
+
+    std::cout << "Gather 8B zipf: " << gather.bandwidth_gbps << " Gb/s useful" << std::endl;
+}
+
+void test_prefetch_distance_performance() {
+    const size_t buffer_size = 4 * 1024 * 1024; // 4MB
+    AlignedBuffer buffer(buffer_size, 64);
+    std::atomic<bool> stop_flag{false};
+
+    // Prefetching changes the timing of every pattern, never its result
+    auto read = StandardTests::sequential_read_test(buffer.data(), buffer_size, 0, buffer_size, 2, stop_flag,
+                                                    false, KernelType::AUTO, nullptr, 1024);
+    ASSERT_TRUE(read.verified);
+    TestAssert::assert_equal_size_t(buffer_size * 2, read.bytes_processed);
+
+    AccessPatterns::AccessConfig config;
+    config.stride_bytes = 256;
+    auto strided = StandardTests::strided_read_test(buffer.data(), buffer_size, 0, buffer_size, 2, stop_flag,
+                                                    config, nullptr, nullptr, 2048);
+    ASSERT_TRUE(strided.verified);
+
+    auto random_write = StandardTests::random_access_test(buffer.data(), buffer_size, 0, buffer_size, 2, true,
+                                                          stop_flag, nullptr, 512);
+    ASSERT_TRUE(random_write.verified);
+    ASSERT_TRUE(random_write.latency_ns > 0.0);
+
+    std::cout << "Sequential Read (prefetch 1 KB): " << read.bandwidth_gbps << " Gb/s" << std::endl;
+}
+
 void test_alignment_performance_impact() {
     const size_t buffer_size = 4 * 1024 * 1024; // 4MB
     
@@ -212,6 +331,71 @@ void test_memory_allocation_performance() {
     std::cout << "64MB allocation time: " << (allocation_time * 1000) << " ms" << std::endl;
 }
 
+void test_matrix_multiply_row_bands() {
+    // Two bands of one shared product, computed by the portable fallback
+    const size_t n = 96;
+    std::vector<float> A(n * n), B(n * n), C(n * n, 0.0f);
+    MatrixMultiply::initialize_matrix_random(A.data(), n, n, 1.0f);
+    MatrixMultiply::initialize_matrix_random(B.data(), n, n, 1.0f);
+    CacheInfo cache = {32 * 1024, 32 * 1024, 1024 * 1024, 8 * 1024 * 1024, 8, 8, 16, 16, 64, 64, 64};
+
+    std::atomic<bool> stop_flag{false};
+    const size_t split = 64;
+    MatrixMultiply::MatrixConfig top = MatrixMultiply::create_matrix_config(n, 1, false);
+    top.M = split;
+    MatrixMultiply::MatrixConfig bottom = top;
+    bottom.M = n - split;
+
+    auto top_stats = StandardTests::matrix_multiply_test(C.data(), A.data(), B.data(), top, nullptr, cache, stop_flag);
+    auto bottom_stats = StandardTests::matrix_multiply_test(C.data() + split * n, A.data() + split * n, B.data(),
+                                                            bottom, nullptr, cache, stop_flag);
+
+    double max_error = 0.0;
+    for (size_t i = 0; i < n; ++i) {
+        for (size_t j = 0; j < n; ++j) {
+            double expected = 0.0;
+            for (size_t k = 0; k < n; ++k) {
+                expected += static_cast<double>(A[i * n + k]) * B[k * n + j];
+            }
+            max_error = std::max(max_error, std::abs(C[i * n + j] - expected));
+        }
+    }
+    ASSERT_TRUE(max_error < 1e-3);
+    TestAssert::assert_equal_size_t(2 * n * n * n, top_stats.operations + bottom_stats.operations);
+    ASSERT_EQ(std::string(StandardTests::PORTABLE_GEMM_NAME), top_stats.acceleration);
+}
+
+void test_arithmetic_intensity_kernel() {
+    // 1000 doubles: 15 full blocks plus a scalar tail
+    const size_t count = 1000;
+    std::vector<double> data(count, 1.0);
+    std::atomic<bool> stop_flag{false};
+    uint8_t* buffer = reinterpret_cast<uint8_t*>(data.data());
+
+    auto low = StandardTests::arithmetic_intensity_test(buffer, count * sizeof(double), 0, count * sizeof(double),
+                                                        2, 1, stop_flag);
+    TestAssert::assert_equal_size_t(count * 16 * 2, low.bytes_processed);
+    ASSERT_TRUE(std::abs(data[0] - (1.0 + 2e-6)) < 1e-12);
+    ASSERT_TRUE(std::abs(data[count - 1] - (1.0 + 2e-6)) < 1e-12);
+
+    auto high = StandardTests::arithmetic_intensity_test(buffer, count * sizeof(double), 0, count * sizeof(double),
+                                                         1, 1024, stop_flag);
+    TestAssert::assert_equal_size_t(count * 16, high.bytes_processed);
+    for (double value : data) {
+        ASSERT_TRUE(std::isfinite(value) && value > 0.0);
+    }
+    ASSERT_EQ(data[0], data[count - 1]);  // Blocked and tail elements get the same chain
+
+    bool threw = false;
+    try {
+        StandardTests::arithmetic_intensity_test(buffer, count * sizeof(double), 0, count * sizeof(double),
+                                                 1, 3, stop_flag);
+    } catch (const TestError&) {
+        threw = true;
+    }
+    ASSERT_TRUE(threw);
+}
+
 int main() {
     TestFramework framework;
     
@@ -222,11 +406,17 @@ int main() {
     TEST_CASE("Sequential read performance", test_sequential_read_performance);
     TEST_CASE("Sequential write performance", test_sequential_write_performance);
     TEST_CASE("Random access performance", test_random_access_performance);
+    TEST_CASE("Latency chase performance", test_latency_chase_performance);
     TEST_CASE("Copy performance", test_copy_performance);
+    TEST_CASE("Stream kernels performance", test_stream_kernels_performance);
+    TEST_CASE("Sparse access performance", test_sparse_access_performance);
+    TEST_CASE("Prefetch distance performance", test_prefetch_distance_performance);
     TEST_CASE("Alignment performance impact", test_alignment_performance_impact);
     TEST_CASE("Buffer size scaling", test_buffer_size_scaling);
     TEST_CASE("Iteration consistency", test_iteration_consistency);
     TEST_CASE("Memory allocation performance", test_memory_allocation_performance);
+    TEST_CASE("Matrix multiply row bands", test_matrix_multiply_row_bands);
+    TEST_CASE("Arithmetic intensity kernel", test_arithmetic_intensity_kernel);
     
     int result = framework.run_all();
     
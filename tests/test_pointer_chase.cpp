@@ -0,0 +1,145 @@
+#include "test_framework.h"
+#include "../common/pointer_chase.h"
+#include "../common/errors.h"
+#include <set>
+#include <vector>
+
+namespace {
+
+// 64 pages plus a partial page so page-local chains cover a short final page
+constexpr size_t TEST_BYTES = 64 * PointerChase::PAGE_SIZE_BYTES + 5 * PointerChase::NODE_SIZE;
+
+struct ChainBuffer {
+    std::vector<uint8_t> storage;
+    uint8_t* base;
+
+    ChainBuffer() : storage(TEST_BYTES + PointerChase::NODE_SIZE) {
+        uintptr_t raw = reinterpret_cast<uintptr_t>(storage.data());
+        uintptr_t aligned = (raw + PointerChase::NODE_SIZE - 1) & ~(PointerChase::NODE_SIZE - 1);
+        base = reinterpret_cast<uint8_t*>(aligned);
+    }
+};
+
+// Walk the chain once and return the distinct nodes seen before returning to base
+std::set<const void*> walk_cycle(const uint8_t* base, size_t node_count) {
+    std::set<const void*> visited;
+    const void* p = base;
+    for (size_t i = 0; i < node_count; ++i) {
+        visited.insert(p);
+        p = PointerChase::chase(p, 1);
+    }
+    TestAssert::assert_true(p == base, "chain does not close after node_count hops");
+    return visited;
+}
+
+}  // namespace
+
+void test_random_chain_is_single_cycle() {
+    ChainBuffer buffer;
+    PointerChase::ChaseConfig config;
+    size_t nodes = PointerChase::build_chain(buffer.base, TEST_BYTES, config, 42);
+
+    TestAssert::assert_equal_size_t(TEST_BYTES / PointerChase::NODE_SIZE, nodes);
+    TestAssert::assert_equal_size_t(nodes, walk_cycle(buffer.base, nodes).size());
+}
+
+void test_page_local_chain_stays_in_page() {
+    ChainBuffer buffer;
+    PointerChase::ChaseConfig config;
+    config.mode = PointerChase::ChaseMode::PAGE_LOCAL;
+    size_t nodes = PointerChase::build_chain(buffer.base, TEST_BYTES, config, 7);
+
+    TestAssert::assert_equal_size_t(nodes, walk_cycle(buffer.base, nodes).size());
+
+    // Consecutive hops only change page once every page's worth of nodes
+    size_t page_changes = 0;
+    const uint8_t* p = buffer.base;
+    for (size_t i = 0; i < nodes; ++i) {
+        const uint8_t* next = static_cast<const uint8_t*>(PointerChase::chase(p, 1));
+        if ((p - buffer.base) / PointerChase::PAGE_SIZE_BYTES != (next - buffer.base) / PointerChase::PAGE_SIZE_BYTES) {
+            ++page_changes;
+        }
+        p = next;
+    }
+    TestAssert::assert_equal_size_t(65, page_changes);
+}
+
+void test_stride_chain_visits_stride() {
+    ChainBuffer buffer;
+    PointerChase::ChaseConfig config = PointerChase::parse_chase_mode("stride:256");
+    size_t nodes = PointerChase::build_chain(buffer.base, TEST_BYTES, config, 0);
+
+    TestAssert::assert_equal_size_t((TEST_BYTES / PointerChase::NODE_SIZE + 3) / 4, nodes);
+    ASSERT_TRUE(PointerChase::chase(buffer.base, 1) == buffer.base + 256);
+    TestAssert::assert_equal_size_t(nodes, walk_cycle(buffer.base, nodes).size());
+}
+
+void test_same_seed_same_chain() {
+    ChainBuffer first;
+    ChainBuffer second;
+    PointerChase::ChaseConfig config;
+    size_t nodes = PointerChase::build_chain(first.base, TEST_BYTES, config, 1234);
+    PointerChase::build_chain(second.base, TEST_BYTES, config, 1234);
+
+    const uint8_t* a = first.base;
+    const uint8_t* b = second.base;
+    for (size_t i = 0; i < nodes; ++i) {
+        a = static_cast<const uint8_t*>(PointerChase::chase(a, 1));
+        b = static_cast<const uint8_t*>(PointerChase::chase(b, 1));
+        TestAssert::assert_true(a - first.base == b - second.base, "chains differ for the same seed");
+    }
+}
+
+void test_too_small_range() {
+    ChainBuffer buffer;
+    PointerChase::ChaseConfig config;
+    TestAssert::assert_equal_size_t(0, PointerChase::build_chain(buffer.base, PointerChase::NODE_SIZE, config, 1));
+}
+
+void test_parse_chase_mode() {
+    TestAssert::assert_equal(std::string("random"),
+                             PointerChase::chase_mode_to_string(PointerChase::parse_chase_mode("random")));
+    TestAssert::assert_equal(std::string("page"),
+                             PointerChase::chase_mode_to_string(PointerChase::parse_chase_mode("page")));
+    TestAssert::assert_equal(std::string("stride:4096"),
+                             PointerChase::chase_mode_to_string(PointerChase::parse_chase_mode("stride:4096")));
+
+    for (const char* invalid : {"linear", "stride:", "stride:100", "stride:0", "stride:64k"}) {
+        bool threw = false;
+        try {
+            PointerChase::parse_chase_mode(invalid);
+        } catch (const ArgumentError&) {
+            threw = true;
+        }
+        TestAssert::assert_true(threw, std::string("expected ArgumentError for ") + invalid);
+    }
+}
+
+void test_single_cycle() {
+    std::vector<size_t> next = PointerChase::single_cycle(1000, 7);
+    TestAssert::assert_equal_size_t(1000, next.size());
+    size_t item = 0;
+    std::set<size_t> visited;
+    for (size_t i = 0; i < next.size(); ++i) {
+        visited.insert(item);
+        item = next[item];
+    }
+    TestAssert::assert_equal_size_t(0, item);  // Back at the start after every item
+    TestAssert::assert_equal_size_t(1000, visited.size());
+    TestAssert::assert_true(next == PointerChase::single_cycle(1000, 7), "same seed gave another cycle");
+    TestAssert::assert_true(PointerChase::single_cycle(0, 7).empty(), "no items, no cycle");
+}
+
+int main() {
+    TestFramework framework;
+
+    TEST_CASE("Random chain is single cycle", test_random_chain_is_single_cycle);
+    TEST_CASE("Single cycle", test_single_cycle);
+    TEST_CASE("Page-local chain stays in page", test_page_local_chain_stays_in_page);
+    TEST_CASE("Stride chain visits stride", test_stride_chain_visits_stride);
+    TEST_CASE("Same seed same chain", test_same_seed_same_chain);
+    TEST_CASE("Too small range", test_too_small_range);
+    TEST_CASE("Parse chase mode", test_parse_chase_mode);
+
+    return framework.run_all();
+}
@@ -0,0 +1,92 @@
+#include "test_framework.h"
+#include "../common/prefetch_control.h"
+#include "../common/errors.h"
+#include <string>
+#include <vector>
+
+using PrefetchControl::HardwareMode;
+
+void test_parse_distance() {
+    TestAssert::assert_equal_size_t(64, PrefetchControl::parse_distance("64"));
+    TestAssert::assert_equal_size_t(512, PrefetchControl::parse_distance("512"));
+    TestAssert::assert_equal_size_t(16384, PrefetchControl::parse_distance("16384"));
+    for (const char* bad : {"0", "32", "100", "16448", "-64", "512b", "", "sweep"}) {
+        try {
+            PrefetchControl::parse_distance(bad);
+            ASSERT_TRUE(false);  // Should throw
+        } catch (const ArgumentError& e) {
+            std::string error_msg = e.what();
+            ASSERT_TRUE(error_msg.find("Invalid prefetch distance") != std::string::npos);
+        }
+    }
+}
+
+void test_sweep_distances() {
+    std::vector<size_t> distances = PrefetchControl::sweep_distances();
+    TestAssert::assert_equal_size_t(9, distances.size());
+    // The baseline comes first, then powers of two from one line
+    TestAssert::assert_equal_size_t(0, distances.front());
+    TestAssert::assert_equal_size_t(64, distances[1]);
+    TestAssert::assert_equal_size_t(8192, distances.back());
+    for (size_t i = 2; i < distances.size(); ++i) {
+        TestAssert::assert_equal_size_t(distances[i - 1] * 2, distances[i]);
+    }
+}
+
+void test_parse_hardware_mode() {
+    ASSERT_TRUE(PrefetchControl::parse_hardware_mode("on") == HardwareMode::DEFAULT);
+    ASSERT_TRUE(PrefetchControl::parse_hardware_mode("off") == HardwareMode::OFF);
+    ASSERT_TRUE(PrefetchControl::parse_hardware_mode("both") == HardwareMode::BOTH);
+    try {
+        PrefetchControl::parse_hardware_mode("auto");
+        ASSERT_TRUE(false);  // Should throw
+    } catch (const ArgumentError& e) {
+        std::string error_msg = e.what();
+        ASSERT_TRUE(error_msg.find("Valid modes: on, off, both") != std::string::npos);
+    }
+}
+
+void test_distance_names_and_patterns() {
+    TestAssert::assert_equal(std::string("none"), PrefetchControl::distance_to_string(0));
+    TestAssert::assert_equal(std::string("512 B"), PrefetchControl::distance_to_string(512));
+
+    ASSERT_TRUE(PrefetchControl::supports_pattern(TestPattern::SEQUENTIAL_READ));
+    ASSERT_TRUE(PrefetchControl::supports_pattern(TestPattern::STRIDED_READ));
+    ASSERT_TRUE(PrefetchControl::supports_pattern(TestPattern::RANDOM_READ));
+    ASSERT_TRUE(PrefetchControl::supports_pattern(TestPattern::RANDOM_WRITE));
+    ASSERT_FALSE(PrefetchControl::supports_pattern(TestPattern::SEQUENTIAL_WRITE));
+    ASSERT_FALSE(PrefetchControl::supports_pattern(TestPattern::LATENCY_CHASE));
+}
+
+void test_msr_control_without_access() {
+    std::unique_ptr<PrefetchControl::HardwarePrefetchers> control =
+        PrefetchControl::create_msr_prefetchers(0x1A4, 0xF);
+#ifdef __linux__
+    ASSERT_TRUE(control != nullptr);
+    ASSERT_TRUE(control->describe().find("MSR 0x1a4 mask 0xf") != std::string::npos);
+    // Restoring before anything was disabled writes nothing
+    control->restore();
+
+    std::string error;
+    if (!control->disable(error)) {
+        // No root or no msr driver: the failure says why and nothing is left changed
+        ASSERT_FALSE(error.empty());
+    } else {
+        control->restore();
+    }
+#else
+    ASSERT_TRUE(control == nullptr);
+#endif
+}
+
+int main() {
+    TestFramework framework;
+
+    TEST_CASE("Parse prefetch distance", test_parse_distance);
+    TEST_CASE("Sweep distances", test_sweep_distances);
+    TEST_CASE("Parse hardware prefetch mode", test_parse_hardware_mode);
+    TEST_CASE("Distance names and patterns", test_distance_names_and_patterns);
+    TEST_CASE("MSR control without access", test_msr_control_without_access);
+
+    return framework.run_all();
+}
@@ -0,0 +1,109 @@
+#include "test_framework.h"
+#include "../common/proxy_kernels.h"
+#include "../common/constants.h"
+#include "../common/errors.h"
+#include <string>
+#include <vector>
+
+using ProxyKernels::Probe;
+
+void test_parse_options() {
+    ASSERT_TRUE(ProxyKernels::parse_probe("linear") == Probe::LINEAR);
+    ASSERT_TRUE(ProxyKernels::parse_probe("group") == Probe::GROUP);
+    TestAssert::assert_equal(std::string("group"), ProxyKernels::probe_to_string(Probe::GROUP));
+    ASSERT_TRUE(ProxyKernels::parse_load_factor("0.5") == 0.5);
+    TestAssert::assert_equal_size_t(1, ProxyKernels::parse_batch("1"));
+    TestAssert::assert_equal_size_t(BenchmarkConstants::HASH_MAX_BATCH, ProxyKernels::parse_batch("64"));
+    TestAssert::assert_equal_size_t(2, ProxyKernels::parse_merge_ways("2"));
+
+    const std::vector<std::string> bad_load = {"0", "0.99", "-0.5", "0.5x", ""};
+    for (const auto& text : bad_load) {
+        try {
+            ProxyKernels::parse_load_factor(text);
+            ASSERT_TRUE(false);  // Should throw
+        } catch (const ArgumentError& e) {
+            ASSERT_TRUE(std::string(e.what()).find("Valid values") != std::string::npos);
+        }
+    }
+    const std::vector<std::string> bad_count = {"0", "65", "-2", "8w", ""};
+    for (const auto& text : bad_count) {
+        try {
+            ProxyKernels::parse_batch(text);
+            ASSERT_TRUE(false);  // Should throw
+        } catch (const ArgumentError&) {
+            ASSERT_TRUE(true);
+        }
+    }
+    try {
+        ProxyKernels::parse_merge_ways("1");
+        ASSERT_TRUE(false);  // Should throw
+    } catch (const ArgumentError&) {
+        ASSERT_TRUE(true);
+    }
+    try {
+        ProxyKernels::parse_probe("cuckoo");
+        ASSERT_TRUE(false);  // Should throw
+    } catch (const ArgumentError&) {
+        ASSERT_TRUE(true);
+    }
+}
+
+void test_probe_finds_every_key() {
+    std::vector<uint64_t> storage(64 * 1024 / sizeof(uint64_t));
+    uint8_t* base = reinterpret_cast<uint8_t*>(storage.data());
+    for (Probe probe : {Probe::LINEAR, Probe::GROUP}) {
+        ProxyKernels::Table table = ProxyKernels::table_layout(base, storage.size() * sizeof(uint64_t), probe);
+        ASSERT_TRUE(table.capacity > 0 && table.capacity % ProxyKernels::GROUP_SLOTS == 0);
+        ASSERT_TRUE(table.capacity * ProxyKernels::SLOT_BYTES + (probe == Probe::GROUP ? table.capacity : 0) <=
+                    storage.size() * sizeof(uint64_t));
+
+        for (double load_factor : {0.05, 0.75, 0.95}) {
+            ProxyKernels::build(table, probe, load_factor);
+            ASSERT_TRUE(table.keys == static_cast<size_t>(table.capacity * load_factor));
+            for (size_t batch : {size_t(1), size_t(16), size_t(64)}) {
+                ProxyKernels::ProbeResult result = ProxyKernels::probe_pass(table, probe, 3000, batch, 7);
+                TestAssert::assert_equal_size_t(3000, result.found);
+                ASSERT_TRUE(result.value_sum == result.expected_sum);
+            }
+        }
+    }
+    // Too small for one group
+    ASSERT_TRUE(ProxyKernels::table_layout(base, 100, Probe::LINEAR).capacity == 0);
+}
+
+void test_partition_pass() {
+    const size_t count = 10000;  // Not a multiple of the line buffers
+    std::vector<uint64_t> src(count), dst(count);
+    ProxyKernels::fill_random_keys(src.data(), count, 1);
+    for (unsigned shift : {0u, 8u, 56u}) {
+        ProxyKernels::partition_pass(src.data(), dst.data(), count, shift);
+        ASSERT_TRUE(ProxyKernels::is_partitioned(src.data(), dst.data(), count, shift));
+    }
+    // The last pass was on the top digit, not the bottom one
+    ASSERT_FALSE(ProxyKernels::is_partitioned(src.data(), dst.data(), count, 0));
+    dst[10] ^= 1;
+    ASSERT_FALSE(ProxyKernels::is_partitioned(src.data(), dst.data(), count, 56));
+}
+
+void test_merge_pass() {
+    std::vector<uint64_t> src(10003), dst(10003);
+    for (size_t ways : {size_t(2), size_t(8), size_t(64)}) {
+        size_t count = ProxyKernels::fill_sorted_runs(src.data(), src.size(), ways, 3);
+        TestAssert::assert_equal_size_t(src.size() / ways * ways, count);
+        ProxyKernels::merge_pass(src.data(), dst.data(), count, ways);
+        ASSERT_TRUE(ProxyKernels::is_merged(src.data(), dst.data(), count));
+    }
+    dst[0] = 0;
+    ASSERT_FALSE(ProxyKernels::is_merged(src.data(), dst.data(), src.size() / 64 * 64));
+}
+
+int main() {
+    TestFramework framework;
+
+    TEST_CASE("Parse options", test_parse_options);
+    TEST_CASE("Probe finds every key", test_probe_finds_every_key);
+    TEST_CASE("Partition pass", test_partition_pass);
+    TEST_CASE("Merge pass", test_merge_pass);
+
+    return framework.run_all();
+}
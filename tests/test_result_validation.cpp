@@ -0,0 +1,107 @@
+#include "test_framework.h"
+#include "../common/result_validation.h"
+#include <string>
+#include <vector>
+
+namespace {
+
+CacheInfo test_cache_info() {
+    CacheInfo cache_info = {};
+    cache_info.l1_data_size = 48 * 1024;
+    cache_info.l2_size = 2 * 1024 * 1024;
+    cache_info.l3_size = 32 * 1024 * 1024;
+    return cache_info;
+}
+
+MemorySpecs test_mem_specs(double theoretical_gbps) {
+    MemorySpecs mem_specs = {};
+    mem_specs.theoretical_bandwidth_gbps = theoretical_gbps;
+    return mem_specs;
+}
+
+PerformanceStats stats_with_bandwidth(double bandwidth_gbps) {
+    PerformanceStats stats = {bandwidth_gbps, 1.0, 1000000, 0.01};
+    return stats;
+}
+
+bool contains(const std::vector<std::string>& warnings, const std::string& text) {
+    for (const auto& warning : warnings) {
+        if (warning.find(text) != std::string::npos) return true;
+    }
+    return false;
+}
+
+}  // namespace
+
+void test_classify_working_set() {
+    using ResultValidation::MemoryLevel;
+    CacheInfo cache_info = test_cache_info();
+
+    ASSERT_TRUE(ResultValidation::classify_working_set(32 * 1024, 256 * 1024, cache_info) == MemoryLevel::L1);
+    ASSERT_TRUE(ResultValidation::classify_working_set(1024 * 1024, 8 * 1024 * 1024, cache_info) == MemoryLevel::L2);
+    ASSERT_TRUE(ResultValidation::classify_working_set(4 * 1024 * 1024, 16 * 1024 * 1024, cache_info) ==
+                MemoryLevel::L3);
+    ASSERT_TRUE(ResultValidation::classify_working_set(1ULL << 30, 8ULL << 30, cache_info) == MemoryLevel::DRAM);
+
+    // Undetected cache levels are skipped
+    CacheInfo unknown = {};
+    ASSERT_TRUE(ResultValidation::classify_working_set(1024, 1024, unknown) == MemoryLevel::DRAM);
+}
+
+void test_cache_results_are_not_flagged() {
+    // Hundreds of GB/s from L1 are expected, not an error
+    std::vector<std::string> warnings = ResultValidation::validate(
+        stats_with_bandwidth(600.0), 32 * 1024, 256 * 1024, 8, test_cache_info(), test_mem_specs(51.2));
+    ASSERT_TRUE(warnings.empty());
+}
+
+void test_dram_ceiling_is_flagged() {
+    std::vector<std::string> warnings = ResultValidation::validate(
+        stats_with_bandwidth(80.0), 1ULL << 30, 4ULL << 30, 8, test_cache_info(), test_mem_specs(51.2));
+    ASSERT_TRUE(contains(warnings, "exceeds the DRAM ceiling"));
+
+    // Within the theoretical peak plus headroom
+    warnings = ResultValidation::validate(stats_with_bandwidth(54.0), 1ULL << 30, 4ULL << 30, 8,
+                                          test_cache_info(), test_mem_specs(51.2));
+    ASSERT_TRUE(warnings.empty());
+
+    // No DRAM ceiling without detected specs (virtualized hosts report -1)
+    warnings = ResultValidation::validate(stats_with_bandwidth(500.0), 1ULL << 30, 4ULL << 30, 8,
+                                          test_cache_info(), test_mem_specs(-1.0));
+    ASSERT_TRUE(warnings.empty());
+}
+
+void test_impossible_cache_bandwidth_is_flagged() {
+    // One thread cannot exceed 256 B/cycle at 6.5 GHz from L1
+    std::vector<std::string> warnings = ResultValidation::validate(
+        stats_with_bandwidth(5000.0), 32 * 1024, 32 * 1024, 1, test_cache_info(), test_mem_specs(51.2));
+    ASSERT_TRUE(contains(warnings, "exceeds the L1 ceiling"));
+}
+
+void test_unverified_kernel_is_flagged() {
+    PerformanceStats stats = stats_with_bandwidth(10.0);
+    stats.verified = false;
+    std::vector<std::string> warnings = ResultValidation::validate(stats, 1ULL << 30, 1ULL << 30, 1,
+                                                                   test_cache_info(), test_mem_specs(51.2));
+    ASSERT_TRUE(contains(warnings, "did not verify"));
+}
+
+void test_zero_time_is_flagged() {
+    PerformanceStats stats = {0.0, 0.0, 4096, 0.0};
+    std::vector<std::string> warnings = ResultValidation::validate(stats, 4096, 4096, 1, test_cache_info(),
+                                                                   test_mem_specs(51.2));
+    ASSERT_TRUE(contains(warnings, "time is zero"));
+}
+
+int main() {
+    TestFramework framework;
+
+    TEST_CASE("Classify working set", test_classify_working_set);
+    TEST_CASE("Cache results are not flagged", test_cache_results_are_not_flagged);
+    TEST_CASE("DRAM ceiling is flagged", test_dram_ceiling_is_flagged);
+    TEST_CASE("Impossible cache bandwidth is flagged", test_impossible_cache_bandwidth_is_flagged);
+    TEST_CASE("Unverified kernel is flagged", test_unverified_kernel_is_flagged);
+    TEST_CASE("Zero time is flagged", test_zero_time_is_flagged);
+
+    return framework.run_all();
+}
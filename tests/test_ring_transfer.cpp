@@ -0,0 +1,139 @@
+#include "test_framework.h"
+#include "../common/ring_transfer.h"
+#include "../common/constants.h"
+#include "../common/errors.h"
+#include <algorithm>
+#include <mutex>
+#include <string>
+#include <vector>
+
+using RingTransfer::Kind;
+using RingTransfer::Relation;
+
+void test_parse_kinds_and_payloads() {
+    std::vector<Kind> kinds = RingTransfer::parse_kinds("mpmc,spsc,mpmc");
+    ASSERT_TRUE(kinds == std::vector<Kind>({Kind::MPMC, Kind::SPSC}));
+    TestAssert::assert_equal(std::string("mpmc"), RingTransfer::kind_to_string(Kind::MPMC));
+
+    std::vector<size_t> payloads = RingTransfer::parse_payloads("64,4k,8,64");
+    ASSERT_TRUE(payloads == std::vector<size_t>({64, 4096, 8}));
+
+    for (const char* bad : {"12", "0", "128k", "64,x", ""}) {
+        try {
+            RingTransfer::parse_payloads(bad);
+            ASSERT_TRUE(false);  // Should throw
+        } catch (const ArgumentError&) {
+            ASSERT_TRUE(true);
+        }
+    }
+    for (const char* bad : {"spsc,lifo", ""}) {
+        try {
+            RingTransfer::parse_kinds(bad);
+            ASSERT_TRUE(false);  // Should throw
+        } catch (const ArgumentError&) {
+            ASSERT_TRUE(true);
+        }
+    }
+}
+
+void test_slot_count() {
+    TestAssert::assert_equal_size_t(BenchmarkConstants::RING_MAX_SLOTS, RingTransfer::slot_count(8));
+    TestAssert::assert_equal_size_t(BenchmarkConstants::RING_BYTES / 256, RingTransfer::slot_count(256));
+    TestAssert::assert_equal_size_t(BenchmarkConstants::RING_MIN_SLOTS,
+                                    RingTransfer::slot_count(BenchmarkConstants::RING_MAX_PAYLOAD));
+}
+
+void test_classify_pairs() {
+    // Two packages; package 0 has two clusters, cluster 0 two cores with two threads each
+    CpuTopology topology;
+    topology.cpus = {{0, 0, 0, 0, 0, 0, 0, CPUAffinityType::DEFAULT}, {1, 0, 0, 0, 0, 1, 0, CPUAffinityType::DEFAULT},
+                     {2, 0, 0, 0, 1, 0, 0, CPUAffinityType::DEFAULT}, {3, 0, 0, 1, 2, 0, 0, CPUAffinityType::DEFAULT},
+                     {4, 1, 1, 2, 3, 0, 1, CPUAffinityType::DEFAULT}};
+    CacheInfo cache = {};
+    TestAssert::assert_equal(std::string("smt"), RingTransfer::relation_to_string(
+                                                     RingTransfer::classify(topology, cache, 0, 1)));
+    ASSERT_TRUE(RingTransfer::classify(topology, cache, 0, 2) == Relation::LLC);
+    ASSERT_TRUE(RingTransfer::classify(topology, cache, 0, 3) == Relation::PACKAGE);
+    ASSERT_TRUE(RingTransfer::classify(topology, cache, 3, 4) == Relation::REMOTE);
+    ASSERT_TRUE(RingTransfer::classify(topology, cache, 0, 9) == Relation::PACKAGE);
+
+    cache.l2_sharing = {{0, 1, 2}, {3}, {4}};
+    ASSERT_TRUE(RingTransfer::classify(topology, cache, 2, 0) == Relation::L2);
+    ASSERT_TRUE(RingTransfer::classify(topology, cache, 0, 1) == Relation::SMT);
+}
+
+void test_measure_transfers_every_message() {
+    for (Kind kind : {Kind::SPSC, Kind::MPMC}) {
+        for (size_t payload : {8, 200, 4096}) {
+            RingTransfer::Result result = RingTransfer::measure(kind, payload, 0, 1, 500, 2, nullptr);
+            ASSERT_TRUE(result.verified);
+            TestAssert::assert_equal_size_t(500, result.messages);
+            TestAssert::assert_equal_size_t(RingTransfer::slot_count(payload), result.slots);
+            ASSERT_TRUE(result.seconds > 0.0 && result.bandwidth_gbps > 0.0);
+            ASSERT_TRUE(result.handoff_ns > 0.0);
+        }
+    }
+
+    try {
+        RingTransfer::measure(Kind::SPSC, 64, 2, 2, 100, 1, nullptr);
+        ASSERT_TRUE(false);  // Should throw
+    } catch (const ConfigurationError& e) {
+        std::string error_msg = e.what();
+        ASSERT_TRUE(error_msg.find("two different CPUs") != std::string::npos);
+    }
+}
+
+void test_summarize_groups_relations() {
+    std::vector<RingTransfer::Result> results(4);
+    const double gbps[] = {10.0, 2.0, 4.0, 20.0};
+    const Relation relations[] = {Relation::LLC, Relation::REMOTE, Relation::REMOTE, Relation::SMT};
+    for (size_t i = 0; i < results.size(); ++i) {
+        results[i].payload_bytes = 64;
+        results[i].seconds = 1.0;
+        results[i].bandwidth_gbps = gbps[i];
+        results[i].handoff_ns = 10.0 * static_cast<double>(i + 1);
+        results[i].relation = relations[i];
+    }
+    std::vector<RingTransfer::RelationSummary> summaries = RingTransfer::summarize(results);
+    TestAssert::assert_equal_size_t(3, summaries.size());
+    ASSERT_TRUE(summaries[0].relation == Relation::SMT);
+    ASSERT_TRUE(summaries[1].relation == Relation::LLC);
+    ASSERT_TRUE(summaries[2].relation == Relation::REMOTE);
+    TestAssert::assert_equal_size_t(2, summaries[2].pairs);
+    ASSERT_TRUE(summaries[2].median_gbps == 3.0 && summaries[2].median_handoff_ns == 25.0);
+}
+
+void test_run_pins_both_ends() {
+    std::vector<size_t> pinned;
+    std::mutex mutex;
+    CoherenceTests::PinFunction pin = [&](size_t cpu) {
+        std::lock_guard<std::mutex> lock(mutex);
+        pinned.push_back(cpu);
+    };
+    RingTransfer::Result result = RingTransfer::measure(Kind::SPSC, 64, 5, 3, 100, 1, pin);
+    ASSERT_TRUE(result.verified);
+    TestAssert::assert_equal_size_t(5, result.producer_cpu);
+    std::sort(pinned.begin(), pinned.end());
+    ASSERT_TRUE(pinned == std::vector<size_t>({3, 3, 5, 5}));  // Streaming threads, then handoff threads
+
+    try {
+        RingTransfer::run({Kind::SPSC}, {64}, {0}, CpuTopology{}, CacheInfo{}, 1, nullptr);
+        ASSERT_TRUE(false);  // Should throw
+    } catch (const ConfigurationError& e) {
+        std::string error_msg = e.what();
+        ASSERT_TRUE(error_msg.find("at least two CPUs") != std::string::npos);
+    }
+}
+
+int main() {
+    TestFramework framework;
+
+    TEST_CASE("Parse kinds and payloads", test_parse_kinds_and_payloads);
+    TEST_CASE("Slot count", test_slot_count);
+    TEST_CASE("Classify pairs", test_classify_pairs);
+    TEST_CASE("Measure transfers every message", test_measure_transfers_every_message);
+    TEST_CASE("Summarize groups relations", test_summarize_groups_relations);
+    TEST_CASE("Run pins both ends", test_run_pins_both_ends);
+
+    return framework.run_all();
+}
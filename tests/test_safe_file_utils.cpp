@@ -18,6 +18,31 @@ void test_safe_path_validation() {
     // since SafeFileUtils requires actual files to exist for realpath() validation
 }
 
+void test_whitelisted_directory_entries() {
+#ifdef __linux__
+    // Files below a whitelisted sysfs directory must be accepted
+    std::ifstream cpu_online("/sys/devices/system/cpu/online");
+    if (cpu_online.is_open()) {
+        ASSERT_TRUE(SafeFileUtils::is_safe_path("/sys/devices/system/cpu/online"));
+    }
+    std::ifstream node_online("/sys/devices/system/node/online");
+    if (node_online.is_open()) {
+        ASSERT_TRUE(SafeFileUtils::is_safe_path("/sys/devices/system/node/online"));
+    }
+#endif
+    // Sibling directories sharing a prefix stay rejected
+    ASSERT_FALSE(SafeFileUtils::is_safe_path("/sys/devices/system/cpuX"));
+}
+
+void test_own_proc_entries() {
+#ifdef __linux__
+    // /proc/self resolves to this process's pid directory, which is allowed
+    ASSERT_TRUE(SafeFileUtils::is_safe_path("/proc/self/smaps"));
+    // Other processes stay off limits
+    ASSERT_FALSE(SafeFileUtils::is_safe_path("/proc/1/smaps"));
+#endif
+}
+
 void test_input_sanitization() {
     // Test normal input
     std::string normal = "Apple M3 Max";
@@ -110,6 +135,8 @@ int main() {
     TestFramework framework;
     
     TEST_CASE("Safe path validation", test_safe_path_validation);
+    TEST_CASE("Whitelisted directory entries", test_whitelisted_directory_entries);
+    TEST_CASE("Own proc entries", test_own_proc_entries);
     TEST_CASE("Input sanitization", test_input_sanitization);
     TEST_CASE("Pattern validation", test_pattern_validation);
     TEST_CASE("Line length limits", test_line_length_limits);
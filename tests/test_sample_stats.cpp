@@ -0,0 +1,88 @@
+#include "test_framework.h"
+#include "../common/sample_stats.h"
+#include <cmath>
+#include <vector>
+
+void test_ring_keeps_recording_order() {
+    SampleRing ring(4);
+    for (size_t i = 1; i <= 3; ++i) {
+        ring.record(1.0, i, 1);
+    }
+
+    std::vector<IterationSample> samples = ring.samples();
+    TestAssert::assert_equal_size_t(3, samples.size());
+    TestAssert::assert_equal_size_t(1, samples[0].bytes);
+    TestAssert::assert_equal_size_t(3, samples[2].bytes);
+}
+
+void test_ring_overwrites_oldest() {
+    SampleRing ring(4);
+    for (size_t i = 1; i <= 6; ++i) {
+        ring.record(1.0, i, 1);
+    }
+
+    std::vector<IterationSample> samples = ring.samples();
+    TestAssert::assert_equal_size_t(4, ring.size());
+    TestAssert::assert_equal_size_t(3, samples.front().bytes);
+    TestAssert::assert_equal_size_t(6, samples.back().bytes);
+
+    ring.clear();
+    TestAssert::assert_equal_size_t(0, ring.size());
+    TestAssert::assert_equal_size_t(4, ring.capacity());
+}
+
+void test_batch_size() {
+    SampleRing ring(100);
+    TestAssert::assert_equal_size_t(1, ring.batch_size(0));
+    TestAssert::assert_equal_size_t(1, ring.batch_size(100));
+    TestAssert::assert_equal_size_t(2, ring.batch_size(101));
+    TestAssert::assert_equal_size_t(10, ring.batch_size(1000));
+}
+
+void test_bandwidth_and_latency_samples() {
+    SampleRing ring;
+    ring.record(0.5, 1000000000, 1000);
+    ring.record(0.0, 64, 1);  // Unmeasurable batches are skipped
+
+    std::vector<double> bandwidth = ring.bandwidth_samples();
+    std::vector<double> latency = ring.latency_samples();
+    TestAssert::assert_equal_size_t(1, bandwidth.size());
+    ASSERT_TRUE(std::abs(bandwidth[0] - 2.0) < 1e-9);
+    ASSERT_TRUE(std::abs(latency[0] - 500000.0) < 1e-6);
+}
+
+void test_percentile_interpolation() {
+    std::vector<double> sorted = {10.0, 20.0, 30.0, 40.0, 50.0};
+    ASSERT_TRUE(SampleStats::percentile(sorted, 0.0) == 10.0);
+    ASSERT_TRUE(SampleStats::percentile(sorted, 0.5) == 30.0);
+    ASSERT_TRUE(SampleStats::percentile(sorted, 1.0) == 50.0);
+    ASSERT_TRUE(std::abs(SampleStats::percentile(sorted, 0.95) - 48.0) < 1e-9);
+    ASSERT_TRUE(SampleStats::percentile({7.0}, 0.99) == 7.0);
+}
+
+void test_summarize() {
+    DistributionStats stats = SampleStats::summarize({4.0, 2.0, 6.0});
+    TestAssert::assert_equal_size_t(3, stats.count);
+    ASSERT_TRUE(stats.min == 2.0);
+    ASSERT_TRUE(stats.median == 4.0);
+    ASSERT_TRUE(stats.max == 6.0);
+    ASSERT_TRUE(stats.mean == 4.0);
+    ASSERT_TRUE(std::abs(stats.cv - 0.5) < 1e-9);  // Sample stddev 2 over mean 4
+
+    DistributionStats empty = SampleStats::summarize({});
+    TestAssert::assert_equal_size_t(0, empty.count);
+    ASSERT_TRUE(empty.cv == 0.0);
+}
+
+int main() {
+    TestFramework framework;
+
+    TEST_CASE("Ring keeps recording order", test_ring_keeps_recording_order);
+    TEST_CASE("Ring overwrites oldest", test_ring_overwrites_oldest);
+    TEST_CASE("Batch size", test_batch_size);
+    TEST_CASE("Bandwidth and latency samples", test_bandwidth_and_latency_samples);
+    TEST_CASE("Percentile interpolation", test_percentile_interpolation);
+    TEST_CASE("Summarize", test_summarize);
+
+    return framework.run_all();
+}
@@ -0,0 +1,439 @@
+#include "test_framework.h"
+#include "../common/simd_kernels.h"
+#include "../common/cpu_features.h"
+#include "../common/errors.h"
+#include <algorithm>
+#include <cmath>
+#include <string>
+#include <vector>
+
+namespace {
+
+// Odd size so every kernel exercises its vector tail and 8-byte scalar tail
+constexpr size_t TEST_WORDS = 1024 + 13;
+
+std::vector<uint64_t> make_words() {
+    std::vector<uint64_t> words(TEST_WORDS);
+    for (size_t i = 0; i < words.size(); ++i) {
+        words[i] = i * 0x9E3779B97F4A7C15ULL;
+    }
+    return words;
+}
+
+}  // namespace
+
+void test_scalar_always_supported() {
+    ASSERT_TRUE(SimdKernels::is_kernel_supported(KernelType::SCALAR));
+    ASSERT_TRUE(SimdKernels::is_kernel_supported(KernelType::AUTO));
+}
+
+void test_auto_resolves_to_supported_kernel() {
+    KernelType resolved = SimdKernels::resolve_kernel(KernelType::AUTO);
+    ASSERT_TRUE(resolved != KernelType::AUTO);
+    ASSERT_TRUE(SimdKernels::is_kernel_supported(resolved));
+
+    const SimdKernels::KernelSet& kernels = SimdKernels::get_kernel_set(KernelType::AUTO);
+    ASSERT_TRUE(kernels.type == resolved);
+}
+
+void test_kernel_name_round_trip() {
+    for (const std::string& name : SimdKernels::get_kernel_names()) {
+        KernelType type = SimdKernels::string_to_kernel_type(name);
+        TestAssert::assert_equal(name, SimdKernels::kernel_type_to_string(type));
+    }
+}
+
+void test_unknown_kernel_name_throws() {
+    bool threw = false;
+    try {
+        SimdKernels::string_to_kernel_type("mmx");
+    } catch (const ArgumentError&) {
+        threw = true;
+    }
+    ASSERT_TRUE(threw);
+}
+
+void test_unsupported_kernel_throws() {
+    // Each architecture lacks the other's instruction sets
+#if defined(__x86_64__) || defined(__amd64__)
+    KernelType foreign = KernelType::NEON;
+#else
+    KernelType foreign = KernelType::AVX2;
+#endif
+    ASSERT_FALSE(SimdKernels::is_kernel_supported(foreign));
+
+    bool threw = false;
+    try {
+        SimdKernels::resolve_kernel(foreign);
+    } catch (const ConfigurationError&) {
+        threw = true;
+    }
+    ASSERT_TRUE(threw);
+}
+
+void test_read_checksum_matches_scalar() {
+    std::vector<uint64_t> words = make_words();
+    const uint8_t* data = reinterpret_cast<const uint8_t*>(words.data());
+    size_t bytes = words.size() * sizeof(uint64_t);
+
+    uint64_t expected = 0;
+    for (uint64_t w : words) {
+        expected += w;
+    }
+
+    for (KernelType type : SimdKernels::get_supported_kernels()) {
+        const SimdKernels::KernelSet& kernels = SimdKernels::get_kernel_set(type);
+        TestAssert::assert_true(kernels.read(data, bytes) == expected,
+                                std::string("read checksum mismatch for ") + kernels.name);
+        // Prefetching past the end of the buffer never faults or changes the sum
+        for (size_t distance : {64, 512, 8192}) {
+            TestAssert::assert_true(kernels.read_prefetch(data, bytes, distance) == expected,
+                                    std::string("prefetching read checksum mismatch for ") + kernels.name);
+        }
+    }
+}
+
+void test_write_fills_pattern() {
+    for (KernelType type : SimdKernels::get_supported_kernels()) {
+        const SimdKernels::KernelSet& kernels = SimdKernels::get_kernel_set(type);
+        std::vector<uint64_t> words(TEST_WORDS, 0);
+        const uint64_t pattern = 0xA5A5A5A5DEADBEEFULL;
+
+        kernels.write(reinterpret_cast<uint8_t*>(words.data()), words.size() * sizeof(uint64_t),
+                      pattern);
+
+        for (uint64_t w : words) {
+            TestAssert::assert_true(w == pattern,
+                                    std::string("write pattern mismatch for ") + kernels.name);
+        }
+    }
+}
+
+void test_copy_matches_source() {
+    std::vector<uint64_t> src = make_words();
+
+    for (KernelType type : SimdKernels::get_supported_kernels()) {
+        const SimdKernels::KernelSet& kernels = SimdKernels::get_kernel_set(type);
+        std::vector<uint64_t> dst(src.size(), 0);
+
+        kernels.copy(reinterpret_cast<uint8_t*>(dst.data()),
+                     reinterpret_cast<const uint8_t*>(src.data()), src.size() * sizeof(uint64_t));
+
+        TestAssert::assert_true(dst == src, std::string("copy mismatch for ") + kernels.name);
+    }
+}
+
+void test_triad_matches_reference() {
+    std::vector<double> b(TEST_WORDS), c(TEST_WORDS);
+    for (size_t i = 0; i < TEST_WORDS; ++i) {
+        b[i] = static_cast<double>(i) * 0.5;
+        c[i] = 1.0 + static_cast<double>(i % 7);
+    }
+    const double scalar = 3.0;
+
+    for (KernelType type : SimdKernels::get_supported_kernels()) {
+        const SimdKernels::KernelSet& kernels = SimdKernels::get_kernel_set(type);
+        std::vector<double> a(TEST_WORDS, 0.0);
+
+        kernels.triad(a.data(), b.data(), c.data(), scalar, TEST_WORDS);
+
+        for (size_t i = 0; i < TEST_WORDS; ++i) {
+            double expected = b[i] + scalar * c[i];
+            TestAssert::assert_true(std::abs(a[i] - expected) < 1e-9,
+                                    std::string("triad mismatch for ") + kernels.name);
+        }
+    }
+}
+
+void test_scale_and_add_match_reference() {
+    std::vector<double> b(TEST_WORDS), c(TEST_WORDS);
+    for (size_t i = 0; i < TEST_WORDS; ++i) {
+        b[i] = static_cast<double>(i) * 0.5;
+        c[i] = 1.0 + static_cast<double>(i % 7);
+    }
+
+    for (KernelType type : SimdKernels::get_supported_kernels()) {
+        const SimdKernels::KernelSet& kernels = SimdKernels::get_kernel_set(type);
+        std::vector<double> scaled(TEST_WORDS, 0.0), added(TEST_WORDS, 0.0);
+
+        kernels.scale(scaled.data(), b.data(), 3.0, TEST_WORDS);
+        kernels.add(added.data(), b.data(), c.data(), TEST_WORDS);
+
+        for (size_t i = 0; i < TEST_WORDS; ++i) {
+            TestAssert::assert_true(scaled[i] == 3.0 * b[i], std::string("scale mismatch for ") + kernels.name);
+            TestAssert::assert_true(added[i] == b[i] + c[i], std::string("add mismatch for ") + kernels.name);
+        }
+    }
+}
+
+void test_streams_match_reference() {
+    constexpr size_t READS = 5;
+    std::vector<std::vector<double>> sources(READS, std::vector<double>(TEST_WORDS));
+    std::vector<const double*> src;
+    double expected_sum = 0.0;
+    for (size_t r = 0; r < READS; ++r) {
+        for (size_t i = 0; i < TEST_WORDS; ++i) {
+            sources[r][i] = static_cast<double>((i + r) % 11);
+        }
+        src.push_back(sources[r].data());
+    }
+    for (size_t i = 0; i < TEST_WORDS; ++i) {
+        for (size_t r = 0; r < READS; ++r) {
+            expected_sum += sources[r][i];
+        }
+    }
+
+    for (KernelType type : SimdKernels::get_supported_kernels()) {
+        const SimdKernels::KernelSet& kernels = SimdKernels::get_kernel_set(type);
+        std::string label = kernels.name;
+        std::vector<std::vector<double>> outputs(2, std::vector<double>(TEST_WORDS, 0.0));
+        std::vector<double*> dst = {outputs[0].data(), outputs[1].data()};
+
+        // 5 reads, 2 writes: every output holds the element-wise sum
+        kernels.streams(dst.data(), dst.size(), src.data(), src.size(), 0.0, TEST_WORDS);
+        for (size_t i = 0; i < TEST_WORDS; ++i) {
+            double expected = 0.0;
+            for (size_t r = 0; r < READS; ++r) {
+                expected += sources[r][i];
+            }
+            TestAssert::assert_true(outputs[0][i] == expected && outputs[1][i] == expected,
+                                    "streams sum mismatch for " + label);
+        }
+
+        // Read-only: the sum comes back as a checksum (small integers add exactly in any order)
+        double checksum = kernels.streams(nullptr, 0, src.data(), src.size(), 0.0, TEST_WORDS);
+        TestAssert::assert_true(checksum == expected_sum, "streams checksum mismatch for " + label);
+
+        // Write-only: the fill value is stored
+        kernels.streams(dst.data(), 1, nullptr, 0, 2.5, TEST_WORDS);
+        for (size_t i = 0; i < TEST_WORDS; ++i) {
+            TestAssert::assert_true(outputs[0][i] == 2.5, "streams fill mismatch for " + label);
+        }
+    }
+}
+
+void test_gather_and_scatter_match_reference() {
+    // One line per word of the other tests, so 64-byte elements have room too
+    const size_t bytes = TEST_WORDS * 64;
+    std::vector<uint64_t> storage(bytes / sizeof(uint64_t));
+    for (size_t i = 0; i < storage.size(); ++i) {
+        storage[i] = 0x0123456789ABCDEFULL * (i + 1);
+    }
+    const uint8_t* base = reinterpret_cast<const uint8_t*>(storage.data());
+
+    for (size_t element : {size_t{4}, size_t{8}, size_t{64}}) {
+        size_t elements = bytes / element;
+        std::vector<uint32_t> indices(TEST_WORDS);
+        for (size_t i = 0; i < indices.size(); ++i) {
+            indices[i] = static_cast<uint32_t>((i * 7919 + 3) % elements);
+        }
+
+        uint64_t expected = 0;
+        uint32_t expected32 = 0;
+        for (uint32_t index : indices) {
+            if (element == 4) {
+                expected32 += reinterpret_cast<const uint32_t*>(base)[index];
+            } else {
+                for (size_t w = 0; w < element / 8; ++w) {
+                    expected += storage[index * (element / 8) + w];
+                }
+            }
+        }
+        if (element == 4) {
+            expected = expected32;
+        }
+
+        for (KernelType type : SimdKernels::get_supported_kernels()) {
+            const SimdKernels::KernelSet& kernels = SimdKernels::get_kernel_set(type);
+            std::string label = std::string(kernels.name) + " " + std::to_string(element) + "B";
+            TestAssert::assert_true(kernels.gather(base, indices.data(), indices.size(), element) == expected,
+                                    "gather checksum mismatch for " + label);
+
+            std::vector<uint64_t> target(storage.size(), 0);
+            uint8_t* out = reinterpret_cast<uint8_t*>(target.data());
+            const uint64_t pattern = 0xA5A5A5A55A5A5A5AULL;
+            kernels.scatter(out, indices.data(), indices.size(), element, pattern);
+
+            // Every indexed element holds the pattern and nothing else was written
+            std::vector<bool> indexed(elements, false);
+            for (uint32_t index : indices) {
+                indexed[index] = true;
+            }
+            bool ok = true;
+            for (size_t e = 0; e < elements; ++e) {
+                const uint8_t* p = out + e * element;
+                for (size_t offset = 0; offset < element; offset += 4) {
+                    uint32_t value = *reinterpret_cast<const uint32_t*>(p + offset);
+                    uint32_t want = (element == 4) ? static_cast<uint32_t>(pattern)
+                                                   : static_cast<uint32_t>(pattern >> ((offset % 8) * 8));
+                    ok = ok && (value == (indexed[e] ? want : 0u));
+                }
+            }
+            TestAssert::assert_true(ok, "scatter mismatch for " + label);
+        }
+    }
+
+    // The scalar table never claims hardware gather or scatter
+    ASSERT_FALSE(SimdKernels::has_hardware_gather(KernelType::SCALAR));
+    ASSERT_FALSE(SimdKernels::has_hardware_scatter(KernelType::SCALAR));
+}
+
+void test_decoders_match_reference() {
+    // Counts below, at and past the padded tail; packed columns sized exactly so overreads show up
+    for (unsigned bits : {1u, 3u, 7u, 8u, 13u, 16u, 17u, 31u, 32u}) {
+        for (size_t count : {size_t(64), size_t(576), size_t(1088)}) {
+            std::vector<uint8_t> packed(count * bits / 8);
+            for (size_t i = 0; i < packed.size(); ++i) {
+                packed[i] = static_cast<uint8_t>((i * 0x9E3779B97F4A7C15ULL) >> 56);
+            }
+            // Bit-by-bit reference: value i is bits i * bits ... i * bits + bits - 1, LSB first
+            std::vector<uint32_t> values(count);
+            for (size_t i = 0; i < count; ++i) {
+                for (unsigned b = 0; b < bits; ++b) {
+                    size_t bit = i * bits + b;
+                    values[i] |= static_cast<uint32_t>((packed[bit / 8] >> (bit % 8)) & 1) << b;
+                }
+            }
+            std::vector<uint64_t> dictionary(size_t(1) << std::min(bits, 16u));
+            for (size_t i = 0; i < dictionary.size(); ++i) {
+                dictionary[i] = i * 0xD6E8FEB86659FD93ULL;
+            }
+            uint64_t sum = 0, delta_sum = 0, dict_sum = 0;
+            uint32_t running = 0xFFFFFF00u;  // Wraps modulo 2^32
+            for (uint32_t value : values) {
+                sum += value;
+                running += value;
+                delta_sum += running;
+                if (bits <= 16) {
+                    dict_sum += dictionary[value];
+                }
+            }
+
+            for (KernelType type : SimdKernels::get_supported_kernels()) {
+                const SimdKernels::KernelSet& kernels = SimdKernels::get_kernel_set(type);
+                std::string label = std::string(kernels.name) + " " + std::to_string(bits) + "b x" +
+                                    std::to_string(count);
+                TestAssert::assert_true(kernels.unpack(packed.data(), count, bits) == sum,
+                                        "unpack mismatch for " + label);
+
+                // Two calls continue one column
+                uint32_t base = 0xFFFFFF00u;
+                size_t half = count / 128 * 64;
+                uint64_t decoded = kernels.delta(packed.data(), half, bits, base);
+                decoded += kernels.delta(packed.data() + half * bits / 8, count - half, bits, base);
+                TestAssert::assert_true(decoded == delta_sum && base == running, "delta mismatch for " + label);
+
+                if (bits <= 16) {
+                    TestAssert::assert_true(kernels.dict(packed.data(), count, bits, dictionary.data()) == dict_sum,
+                                            "dict mismatch for " + label);
+                }
+            }
+        }
+    }
+
+    ASSERT_FALSE(SimdKernels::has_simd_decode(KernelType::SCALAR));
+}
+
+void test_store_policies_match_temporal() {
+    std::vector<uint64_t> src = make_words();
+    std::vector<double> b(TEST_WORDS), c(TEST_WORDS);
+    for (size_t i = 0; i < TEST_WORDS; ++i) {
+        b[i] = static_cast<double>(i) * 0.25;
+        c[i] = 2.0 + static_cast<double>(i % 5);
+    }
+
+    for (KernelType type : SimdKernels::get_supported_kernels()) {
+        for (StorePolicy policy : {StorePolicy::TEMPORAL, StorePolicy::NONTEMPORAL,
+                                   StorePolicy::CLZERO, StorePolicy::DC_ZVA}) {
+            if (!SimdKernels::is_store_policy_supported(type, policy)) {
+                continue;
+            }
+            SimdKernels::StoreKernels stores = SimdKernels::get_store_kernels(type, policy);
+            std::string label = SimdKernels::kernel_type_to_string(type) + "/" +
+                                SimdKernels::store_policy_to_string(policy);
+
+            // Offset by one word so the aligned-head path is exercised
+            std::vector<uint64_t> dst(src.size() + 1, 0);
+            uint8_t* dst_bytes = reinterpret_cast<uint8_t*>(dst.data() + 1);
+            size_t bytes = src.size() * sizeof(uint64_t);
+
+            stores.write(dst_bytes, bytes, 0x1234567890ABCDEFULL);
+            for (size_t i = 1; i < dst.size(); ++i) {
+                TestAssert::assert_true(dst[i] == 0x1234567890ABCDEFULL, "write mismatch for " + label);
+            }
+
+            stores.copy(dst_bytes, reinterpret_cast<const uint8_t*>(src.data()), bytes);
+            for (size_t i = 0; i < src.size(); ++i) {
+                TestAssert::assert_true(dst[i + 1] == src[i], "copy mismatch for " + label);
+            }
+
+            std::vector<double> a(TEST_WORDS + 1, 0.0);
+            stores.triad(a.data() + 1, b.data(), c.data(), 2.0, TEST_WORDS);
+            for (size_t i = 0; i < TEST_WORDS; ++i) {
+                TestAssert::assert_true(std::abs(a[i + 1] - (b[i] + 2.0 * c[i])) < 1e-9,
+                                        "triad mismatch for " + label);
+            }
+        }
+    }
+}
+
+void test_temporal_store_policy_always_supported() {
+    for (KernelType type : SimdKernels::get_supported_kernels()) {
+        ASSERT_TRUE(SimdKernels::is_store_policy_supported(type, StorePolicy::TEMPORAL));
+    }
+}
+
+void test_parse_store_policies() {
+    std::vector<StorePolicy> policies =
+        SimdKernels::parse_store_policies("nontemporal,temporal,nontemporal", KernelType::AUTO);
+    TestAssert::assert_equal_size_t(2, policies.size());
+    ASSERT_TRUE(policies[0] == StorePolicy::NONTEMPORAL);
+    ASSERT_TRUE(policies[1] == StorePolicy::TEMPORAL);
+
+    std::vector<StorePolicy> all = SimdKernels::parse_store_policies("all", KernelType::AUTO);
+    ASSERT_FALSE(all.empty());
+    ASSERT_TRUE(all[0] == StorePolicy::TEMPORAL);
+
+    bool threw = false;
+    try {
+        SimdKernels::parse_store_policies("writeback", KernelType::AUTO);
+    } catch (const ArgumentError&) {
+        threw = true;
+    }
+    ASSERT_TRUE(threw);
+}
+
+void test_cpu_features_description() {
+    std::string description = CpuFeatureDetection::describe_cpu_features();
+    ASSERT_FALSE(description.empty());
+#if defined(__x86_64__) || defined(__amd64__)
+    // SSE2 is part of the x86-64 baseline
+    ASSERT_TRUE(CpuFeatureDetection::get_cpu_features().sse2);
+#elif defined(__aarch64__)
+    ASSERT_TRUE(CpuFeatureDetection::get_cpu_features().neon);
+#endif
+}
+
+int main() {
+    TestFramework framework;
+
+    TEST_CASE("Scalar always supported", test_scalar_always_supported);
+    TEST_CASE("Auto resolves to supported kernel", test_auto_resolves_to_supported_kernel);
+    TEST_CASE("Kernel name round trip", test_kernel_name_round_trip);
+    TEST_CASE("Unknown kernel name throws", test_unknown_kernel_name_throws);
+    TEST_CASE("Unsupported kernel throws", test_unsupported_kernel_throws);
+    TEST_CASE("Read checksum matches scalar", test_read_checksum_matches_scalar);
+    TEST_CASE("Write fills pattern", test_write_fills_pattern);
+    TEST_CASE("Copy matches source", test_copy_matches_source);
+    TEST_CASE("Triad matches reference", test_triad_matches_reference);
+    TEST_CASE("Scale and add match reference", test_scale_and_add_match_reference);
+    TEST_CASE("Streams match reference", test_streams_match_reference);
+    TEST_CASE("Gather and scatter match reference", test_gather_and_scatter_match_reference);
+    TEST_CASE("Decoders match reference", test_decoders_match_reference);
+    TEST_CASE("Store policies match temporal", test_store_policies_match_temporal);
+    TEST_CASE("Temporal store policy always supported", test_temporal_store_policy_always_supported);
+    TEST_CASE("Parse store policies", test_parse_store_policies);
+    TEST_CASE("CPU features description", test_cpu_features_description);
+
+    return framework.run_all();
+}
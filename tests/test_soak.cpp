@@ -0,0 +1,193 @@
+#include "test_framework.h"
+#include "../common/soak.h"
+#include "../common/errors.h"
+#include <atomic>
+#include <chrono>
+#include <cstdlib>
+#include <fstream>
+#include <string>
+#include <sys/stat.h>
+#include <thread>
+#include <unistd.h>
+#include <vector>
+
+using Soak::Sample;
+
+namespace {
+
+Sample sample(double elapsed_seconds, double bandwidth_gbps, double frequency_mhz = 0.0) {
+    Sample s;
+    s.elapsed_seconds = elapsed_seconds;
+    s.bandwidth_gbps = bandwidth_gbps;
+    s.frequency_mhz = frequency_mhz;
+    return s;
+}
+
+void write_file(const std::string& path, const std::string& text) {
+    std::ofstream file(path);
+    file << text << "\n";
+}
+
+}  // namespace
+
+void test_parse_duration() {
+    ASSERT_TRUE(Soak::parse_duration("90") == 90.0);
+    ASSERT_TRUE(Soak::parse_duration("30s") == 30.0);
+    ASSERT_TRUE(Soak::parse_duration("10m") == 600.0);
+    ASSERT_TRUE(Soak::parse_duration("24h") == 86400.0);
+    ASSERT_TRUE(Soak::parse_duration("0.5") == 0.5);
+
+    for (const char* bad : {"", "0", "-5", "10d", "m", "5 m", "inf"}) {
+        try {
+            Soak::parse_duration(bad);
+            ASSERT_TRUE(false);  // Should throw
+        } catch (const ArgumentError& e) {
+            std::string error_msg = e.what();
+            ASSERT_TRUE(error_msg.find("Invalid duration") != std::string::npos);
+        }
+    }
+}
+
+void test_parse_interval() {
+    TestAssert::assert_equal_size_t(100, Soak::parse_interval("100"));
+    TestAssert::assert_equal_size_t(10, Soak::parse_interval("10"));
+
+    for (const char* bad : {"", "5", "60001", "1e3", "-100"}) {
+        try {
+            Soak::parse_interval(bad);
+            ASSERT_TRUE(false);  // Should throw
+        } catch (const ArgumentError& e) {
+            std::string error_msg = e.what();
+            ASSERT_TRUE(error_msg.find("Invalid sample interval") != std::string::npos);
+        }
+    }
+}
+
+void test_parse_cpuinfo_mhz() {
+    std::vector<std::string> lines = {"processor\t: 0", "cpu MHz\t\t: 3000.000", "processor\t: 1",
+                                      "cpu MHz\t\t: 2000.500", "flags\t\t: fpu"};
+    ASSERT_TRUE(Soak::parse_cpuinfo_mhz(lines) == 2500.25);
+    ASSERT_TRUE(Soak::parse_cpuinfo_mhz({"processor\t: 0"}) == 0.0);
+}
+
+void test_read_temperatures() {
+    char root_template[] = "/tmp/soak_sensors_XXXXXX";
+    ASSERT_TRUE(mkdtemp(root_template) != nullptr);
+    std::string root = root_template;
+    std::string hwmon = root + "/hwmon/";
+    std::string thermal = root + "/thermal/";
+    for (const std::string& dir : {hwmon, hwmon + "hwmon0", hwmon + "hwmon1", hwmon + "hwmon2", thermal,
+                                   thermal + "thermal_zone0"}) {
+        mkdir(dir.c_str(), 0755);
+    }
+    write_file(hwmon + "hwmon0/name", "coretemp");
+    write_file(hwmon + "hwmon0/temp1_input", "61000");
+    write_file(hwmon + "hwmon0/temp2_input", "67500");
+    write_file(hwmon + "hwmon1/name", "jc42");
+    write_file(hwmon + "hwmon1/temp1_input", "45250");
+    write_file(hwmon + "hwmon2/name", "nvme");
+    write_file(hwmon + "hwmon2/temp1_input", "90000");
+    write_file(thermal + "thermal_zone0/temp", "80000");
+
+    double cpu_c = 0.0;
+    double dimm_c = 0.0;
+    Soak::read_temperatures(cpu_c, dimm_c, hwmon, thermal);
+    ASSERT_TRUE(cpu_c == 67.5);   // The NVMe sensor and the thermal zone are not CPU sensors here
+    ASSERT_TRUE(dimm_c == 45.25);
+
+    // Without CPU hwmon sensors the hottest thermal zone is used
+    write_file(hwmon + "hwmon0/name", "acpitz");
+    Soak::read_temperatures(cpu_c, dimm_c, hwmon, thermal);
+    ASSERT_TRUE(cpu_c == 80.0);
+
+    Soak::read_temperatures(cpu_c, dimm_c, root + "/missing/", root + "/missing/");
+    ASSERT_TRUE(cpu_c == 0.0 && dimm_c == 0.0);
+
+    std::string cleanup = "rm -rf " + root;
+    ASSERT_TRUE(std::system(cleanup.c_str()) == 0);
+}
+
+void test_summarize() {
+    // 20 samples: the first two (10%) at 20 GB/s and 3 GHz, the last two at 15 GB/s and 2.7 GHz
+    std::vector<Sample> samples;
+    for (size_t i = 0; i < 20; ++i) {
+        double gbps = i < 2 ? 20.0 : (i >= 18 ? 15.0 : 18.0);
+        double mhz = i < 2 ? 3000.0 : (i >= 18 ? 2700.0 : 2900.0);
+        samples.push_back(sample(0.1 * static_cast<double>(i + 1), gbps, mhz));
+    }
+    Soak::Summary summary = Soak::summarize(samples);
+    TestAssert::assert_equal_size_t(20, summary.samples);
+    ASSERT_TRUE(summary.first_gbps == 20.0 && summary.last_gbps == 15.0);
+    ASSERT_TRUE(summary.min_gbps == 15.0 && summary.max_gbps == 20.0);
+    ASSERT_TRUE(summary.decay_percent == 25.0);
+    ASSERT_TRUE(summary.frequency_drop_percent > 9.99 && summary.frequency_drop_percent < 10.01);
+    ASSERT_TRUE(summary.throttled);
+
+    std::vector<Sample> steady = {sample(0.1, 20.0), sample(0.2, 19.8), sample(0.3, 20.1)};
+    ASSERT_FALSE(Soak::summarize(steady).throttled);
+
+    TestAssert::assert_equal_size_t(0, Soak::summarize({}).samples);
+}
+
+void test_downsample() {
+    std::vector<Sample> samples;
+    for (size_t i = 0; i < 10; ++i) {
+        samples.push_back(sample(static_cast<double>(i + 1), static_cast<double>(i)));
+    }
+    TestAssert::assert_equal_size_t(10, Soak::downsample(samples, 10).size());
+
+    std::vector<Sample> rows = Soak::downsample(samples, 4);  // Buckets of 3: 0-2, 3-5, 6-8, 9
+    TestAssert::assert_equal_size_t(4, rows.size());
+    ASSERT_TRUE(rows[0].bandwidth_gbps == 1.0 && rows[0].elapsed_seconds == 3.0);
+    ASSERT_TRUE(rows[3].bandwidth_gbps == 9.0 && rows[3].elapsed_seconds == 10.0);
+}
+
+void test_duration_to_string() {
+    TestAssert::assert_equal(std::string("24h"), Soak::duration_to_string(86400.0));
+    TestAssert::assert_equal(std::string("1m 30s"), Soak::duration_to_string(90.0));
+    TestAssert::assert_equal(std::string("1h 1s"), Soak::duration_to_string(3601.0));
+    TestAssert::assert_equal(std::string("0.5s"), Soak::duration_to_string(0.5));
+    TestAssert::assert_equal(std::string("0s"), Soak::duration_to_string(0.0));
+}
+
+void test_run_sampler() {
+    std::vector<Soak::ProgressSlot> slots(2);
+    std::atomic<bool> stop(false);
+    std::thread worker([&]() {
+        while (!stop.load()) {
+            slots[0].bytes.fetch_add(1000000);
+            slots[1].bytes.fetch_add(1000000);
+            std::this_thread::sleep_for(std::chrono::milliseconds(1));
+        }
+    });
+    std::vector<Sample> samples = Soak::run_sampler(slots, {0}, 0.1, 20, stop);
+    worker.join();
+
+    ASSERT_TRUE(stop.load());
+    ASSERT_TRUE(samples.size() >= 4 && samples.size() <= 6);
+    ASSERT_TRUE(samples.back().elapsed_seconds >= 0.1);
+    for (const auto& s : samples) {
+        ASSERT_TRUE(s.bandwidth_gbps > 0.0);
+    }
+
+    // A stop raised elsewhere ends sampling before the deadline
+    std::atomic<bool> stopped(true);
+    auto start = std::chrono::steady_clock::now();
+    ASSERT_TRUE(Soak::run_sampler(slots, {0}, 60.0, 100, stopped).empty());
+    ASSERT_TRUE(std::chrono::steady_clock::now() - start < std::chrono::seconds(1));
+}
+
+int main() {
+    TestFramework framework;
+
+    TEST_CASE("Parse duration", test_parse_duration);
+    TEST_CASE("Parse sample interval", test_parse_interval);
+    TEST_CASE("Parse cpuinfo MHz", test_parse_cpuinfo_mhz);
+    TEST_CASE("Read temperatures", test_read_temperatures);
+    TEST_CASE("Summarize soak series", test_summarize);
+    TEST_CASE("Downsample series", test_downsample);
+    TEST_CASE("Duration to string", test_duration_to_string);
+    TEST_CASE("Run sampler", test_run_sampler);
+
+    return framework.run_all();
+}
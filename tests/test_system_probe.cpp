@@ -0,0 +1,230 @@
+#include "test_framework.h"
+#include "../common/system_probe.h"
+#include <cstdio>
+#include <cstdlib>
+#include <fstream>
+#include <map>
+#include <string>
+#include <thread>
+#include <unistd.h>
+#include <vector>
+
+namespace {
+
+// Counts the detections that reach it; everything else is inert
+class CountingPlatform : public PlatformInterface {
+  public:
+    explicit CountingPlatform(size_t& calls) : calls_(calls) {}
+
+    std::pair<std::string, std::string> detect_processor_info() override {
+        ++calls_;
+        return {"x86_64", "Test CPU"};
+    }
+    size_t detect_cache_line_size() override {
+        ++calls_;
+        return 64;
+    }
+    CacheInfo detect_cache_info() override {
+        ++calls_;
+        return cache(32 * 1024);
+    }
+    CacheInfo get_core_specific_cache_info(CPUAffinityType affinity_type) override {
+        ++calls_;
+        return cache(affinity_type == CPUAffinityType::E_CORES ? 64 * 1024 : 48 * 1024);
+    }
+    MemorySpecs get_memory_specs() override {
+        ++calls_;
+        return memory();
+    }
+    SystemInfo get_system_info() override {
+        ++calls_;
+        SystemInfo info = {};
+        info.total_ram_gb = 64;
+        info.available_ram_gb = 60;
+        info.cpu_cores = 8;
+        info.cpu_threads = 16;
+        info.cache_line_size = 64;
+        info.cpu_name = "Test \"Quoted\" CPU";
+        info.memory_specs = memory();
+        info.cache_info = cache(32 * 1024);
+        return info;
+    }
+    NumaTopology detect_numa_topology() override {
+        ++calls_;
+        return {{{0, {0, 1}, 1024, {10}, {}}}, true};
+    }
+    CpuTopology detect_cpu_topology() override {
+        ++calls_;
+        CpuTopology topology = {};
+        topology.physical_cores = 8;
+        return topology;
+    }
+
+    size_t get_max_threads_for_affinity(CPUAffinityType) override { return 16; }
+    void set_thread_affinity(size_t, CPUAffinityType, size_t) override {}
+    bool validate_thread_count(size_t, CPUAffinityType, std::string&) override { return true; }
+    bool bind_thread_to_numa_node(size_t, size_t) override { return false; }
+    bool bind_memory_to_numa_node(void*, size_t, size_t) override { return false; }
+    bool interleave_memory_across_numa_nodes(void*, size_t, const std::vector<NumaWeight>&, std::string&) override {
+        return false;
+    }
+    std::string get_platform_name() override { return "Counting"; }
+    bool supports_cpu_affinity() override { return false; }
+    std::unique_ptr<MatrixMultiply::MatrixMultiplier> create_matrix_multiplier() override { return nullptr; }
+    std::unique_ptr<PerfCounters::CounterGroup> create_thread_counters() override { return nullptr; }
+    std::unique_ptr<PerfCounters::CounterGroup> create_uncore_counters() override { return nullptr; }
+    std::unique_ptr<PrefetchControl::HardwarePrefetchers> create_prefetcher_control() override { return nullptr; }
+    std::unique_ptr<EnergyMeter::Meter> create_energy_meter() override { return nullptr; }
+    std::unique_ptr<GpuBandwidth::Device> create_gpu_device() override { return nullptr; }
+
+  private:
+    static CacheInfo cache(size_t l1) {
+        CacheInfo info = {l1, 32 * 1024, 2 * 1024 * 1024, 32 * 1024 * 1024, 12, 8, 16, 16, 64, 64, 64};
+        info.l2_sharing = {{0, 1}, {2, 3}};
+        return info;
+    }
+    static MemorySpecs memory() {
+        MemorySpecs specs = {};
+        specs.type = "DDR5";
+        specs.speed_mtps = 4800;
+        specs.num_channels = 8;
+        specs.theoretical_bandwidth_gbps = 307.2;
+        specs.num_channels_detected = true;
+        specs.detection_source = "SMBIOS";
+        return specs;
+    }
+
+    size_t& calls_;
+};
+
+std::string temporary_path(const std::string& name) {
+    return "/tmp/test_system_probe_" + std::to_string(getpid()) + "/" + name;
+}
+
+}  // namespace
+
+void test_detects_once() {
+    size_t calls = 0;
+    SystemProbe::Probe probe(std::make_unique<CountingPlatform>(calls));
+    SystemProbe::CachedPlatform first(std::make_unique<CountingPlatform>(calls), probe);
+    SystemProbe::CachedPlatform second(std::make_unique<CountingPlatform>(calls), probe);
+
+    TestAssert::assert_equal(std::string("Test \"Quoted\" CPU"), first.get_system_info().cpu_name);
+    TestAssert::assert_equal_size_t(64, second.detect_cache_line_size());
+    TestAssert::assert_equal(std::string("DDR5"), second.get_memory_specs().type);
+    TestAssert::assert_equal_size_t(32 * 1024, first.detect_cache_info().l1_data_size);
+    TestAssert::assert_equal_size_t(1, calls);  // Line size, memory and caches come from the system information
+
+    TestAssert::assert_equal_size_t(64 * 1024,
+                                    first.get_core_specific_cache_info(CPUAffinityType::E_CORES).l1_data_size);
+    TestAssert::assert_equal_size_t(64 * 1024,
+                                    second.get_core_specific_cache_info(CPUAffinityType::E_CORES).l1_data_size);
+    TestAssert::assert_equal_size_t(48 * 1024,
+                                    second.get_core_specific_cache_info(CPUAffinityType::DEFAULT).l1_data_size);
+    first.detect_numa_topology();
+    second.detect_numa_topology();
+    TestAssert::assert_equal_size_t(4, calls);
+    TestAssert::assert_equal_size_t(4, probe.detections());
+
+    // Everything else reaches the native platform
+    TestAssert::assert_equal(std::string("Counting"), first.get_platform_name());
+    TestAssert::assert_equal_size_t(16, first.get_max_threads_for_affinity(CPUAffinityType::DEFAULT));
+}
+
+void test_parallel_start() {
+    size_t calls = 0;
+    SystemProbe::Probe probe(std::make_unique<CountingPlatform>(calls));
+    probe.start(CPUAffinityType::P_CORES);
+
+    // Callers racing the background detections wait for them rather than detect again
+    std::vector<std::thread> callers;
+    for (size_t i = 0; i < 4; ++i) {
+        callers.emplace_back([&probe]() {
+            probe.system_info();
+            probe.core_cache_info(CPUAffinityType::P_CORES);
+            probe.cpu_topology();
+            probe.numa_topology();
+        });
+    }
+    for (auto& caller : callers) {
+        caller.join();
+    }
+    TestAssert::assert_equal_size_t(8, probe.cpu_topology().physical_cores);
+    TestAssert::assert_equal_size_t(4, probe.detections());
+    probe.start(CPUAffinityType::P_CORES);
+    TestAssert::assert_equal_size_t(4, probe.detections());
+}
+
+void test_json_round_trip() {
+    size_t calls = 0;
+    CountingPlatform platform(calls);
+    SystemInfo info = platform.get_system_info();
+    std::map<CPUAffinityType, CacheInfo> caches = {
+        {CPUAffinityType::DEFAULT, platform.get_core_specific_cache_info(CPUAffinityType::DEFAULT)},
+        {CPUAffinityType::E_CORES, platform.get_core_specific_cache_info(CPUAffinityType::E_CORES)}};
+    std::string text = SystemProbe::to_json("boot-a", info, caches);
+
+    SystemInfo read = {};
+    std::map<CPUAffinityType, CacheInfo> read_caches;
+    ASSERT_TRUE(SystemProbe::from_json(text, "boot-a", read, read_caches));
+    TestAssert::assert_equal(info.cpu_name, read.cpu_name);
+    TestAssert::assert_equal_size_t(16, read.cpu_threads);
+    TestAssert::assert_equal_size_t(0, read.available_ram_gb);  // Not kept: it is read live
+    TestAssert::assert_equal(std::string("SMBIOS"), read.memory_specs.detection_source);
+    ASSERT_TRUE(read.memory_specs.num_channels_detected);
+    ASSERT_FALSE(read.memory_specs.is_virtualized);
+    ASSERT_TRUE(read.memory_specs.theoretical_bandwidth_gbps == 307.2);
+    ASSERT_TRUE(read.cache_info.l2_sharing == info.cache_info.l2_sharing);
+    TestAssert::assert_equal_size_t(2, read_caches.size());
+    TestAssert::assert_equal_size_t(64 * 1024, read_caches[CPUAffinityType::E_CORES].l1_data_size);
+
+    // Another boot, another layout version or a damaged file are misses
+    ASSERT_FALSE(SystemProbe::from_json(text, "boot-b", read, read_caches));
+    ASSERT_FALSE(SystemProbe::from_json(text, "", read, read_caches));
+    std::string old_version = text;
+    old_version.replace(old_version.find("\"probe_version\":1"), 17, "\"probe_version\":0");
+    ASSERT_FALSE(SystemProbe::from_json(old_version, "boot-a", read, read_caches));
+    ASSERT_FALSE(SystemProbe::from_json("{\"probe_version\":", "boot-a", read, read_caches));
+}
+
+void test_cache_file() {
+    std::string path = temporary_path("probe/system.json");
+    size_t calls = 0;
+    {
+        SystemProbe::Probe probe(std::make_unique<CountingPlatform>(calls));
+        ASSERT_FALSE(probe.load(path, "boot-a"));  // Not written yet
+        probe.core_cache_info(CPUAffinityType::DEFAULT);
+        probe.save(path, "boot-a");  // Creates the directory
+        TestAssert::assert_equal_size_t(2, calls);
+    }
+
+    calls = 0;
+    SystemProbe::Probe cached(std::make_unique<CountingPlatform>(calls));
+    ASSERT_TRUE(cached.load(path, "boot-a"));
+    TestAssert::assert_equal_size_t(8, cached.system_info().cpu_cores);
+    TestAssert::assert_equal_size_t(48 * 1024, cached.core_cache_info(CPUAffinityType::DEFAULT).l1_data_size);
+    TestAssert::assert_equal_size_t(0, calls);
+    // Topologies and core types not on file are still detected
+    cached.start(CPUAffinityType::E_CORES);
+    cached.cpu_topology();
+    TestAssert::assert_equal_size_t(64 * 1024, cached.core_cache_info(CPUAffinityType::E_CORES).l1_data_size);
+    TestAssert::assert_equal_size_t(3, cached.detections());
+
+    SystemProbe::Probe rebooted(std::make_unique<CountingPlatform>(calls));
+    ASSERT_FALSE(rebooted.load(path, "boot-b"));
+
+    std::remove(path.c_str());
+    std::remove(temporary_path("probe").c_str());
+    std::remove(temporary_path("").c_str());
+}
+
+int main() {
+    TestFramework framework;
+
+    TEST_CASE("Detects once", test_detects_once);
+    TEST_CASE("Parallel start", test_parallel_start);
+    TEST_CASE("JSON round trip", test_json_round_trip);
+    TEST_CASE("Cache file", test_cache_file);
+
+    return framework.run_all();
+}
@@ -1,6 +1,8 @@
 #include "test_framework.h"
 #include "../common/test_patterns.h"
+#include "../common/errors.h"
 #include <cmath>
+#include <string>
 
 void test_get_pattern_name_all_patterns() {
     // Test all defined pattern names
@@ -11,6 +13,13 @@ void test_get_pattern_name_all_patterns() {
     ASSERT_TRUE(get_pattern_name(TestPattern::COPY) == "Copy");
     ASSERT_TRUE(get_pattern_name(TestPattern::TRIAD) == "Triad");
     ASSERT_TRUE(get_pattern_name(TestPattern::MATRIX_MULTIPLY) == "Matrix Multiply (GEMM)");
+    ASSERT_TRUE(get_pattern_name(TestPattern::LATENCY_CHASE) == "Latency Chase");
+    ASSERT_TRUE(get_pattern_name(TestPattern::SCALE) == "Scale");
+    ASSERT_TRUE(get_pattern_name(TestPattern::ADD) == "Add");
+    ASSERT_TRUE(get_pattern_name(TestPattern::STREAMS) == "Streams");
+    ASSERT_TRUE(get_pattern_name(TestPattern::STRIDED_READ) == "Strided Read");
+    ASSERT_TRUE(get_pattern_name(TestPattern::GATHER) == "Gather");
+    ASSERT_TRUE(get_pattern_name(TestPattern::SCATTER) == "Scatter");
 }
 
 void test_get_pattern_name_unknown() {
@@ -67,16 +76,15 @@ void test_calculate_stats_zero_operations() {
     ASSERT_TRUE(stats.latency_ns == 0.0);
 }
 
-void test_calculate_stats_high_bandwidth_clamping() {
-    // Test the bandwidth clamping feature for unrealistically high values
+void test_calculate_stats_high_bandwidth_not_clamped() {
+    // Unrealistically high values are reported as measured; ResultValidation flags them
     size_t bytes = 1000000000000ULL; // 1TB
-    double time = 0.001;              // 1ms - would give 1,000,000 GB/s 
+    double time = 0.001;              // 1ms - gives 1,000,000 GB/s 
     size_t operations = 1000000;
     
     PerformanceStats stats = calculate_stats(bytes, time, operations);
     
-    // Should be clamped to MAX_REALISTIC_BANDWIDTH_GBPS (60.0)
-    ASSERT_TRUE(stats.bandwidth_gbps == 60.0);
+    ASSERT_TRUE(std::abs(stats.bandwidth_gbps - 1000000.0) < 1e-6);
     ASSERT_TRUE(stats.bytes_processed == bytes);
     ASSERT_TRUE(stats.time_seconds == time);
     
@@ -95,7 +103,8 @@ void test_calculate_stats_realistic_bandwidth() {
     
     double expected_bandwidth = bytes / (time * 1e9); // 50MB/s = 0.05 GB/s
     ASSERT_TRUE(std::abs(stats.bandwidth_gbps - expected_bandwidth) < 1e-10);
-    ASSERT_TRUE(stats.bandwidth_gbps < 60.0); // Should not be clamped
+    ASSERT_TRUE(stats.bandwidth_gbps < 60.0);
+    ASSERT_TRUE(stats.verified);
 }
 
 void test_calculate_stats_boundary_bandwidth() {
@@ -106,14 +115,14 @@ void test_calculate_stats_boundary_bandwidth() {
     
     PerformanceStats stats = calculate_stats(bytes, time, operations);
     
-    ASSERT_TRUE(stats.bandwidth_gbps == 60.0);
+    ASSERT_TRUE(std::abs(stats.bandwidth_gbps - 60.0) < 1e-10);
     ASSERT_TRUE(stats.bytes_processed == bytes);
 }
 
 void test_calculate_stats_small_values() {
-    // Test with values that will definitely exceed the 60 GB/s limit
+    // Cache-level bandwidth well above the old 60 GB/s clamp
     size_t bytes = 1000000000;  // 1GB  
-    double time = 0.001;        // 1 millisecond -> 1000 GB/s raw, should be clamped
+    double time = 0.001;        // 1 millisecond -> 1000 GB/s
     size_t operations = 1000;
     
     PerformanceStats stats = calculate_stats(bytes, time, operations);
@@ -121,9 +130,8 @@ void test_calculate_stats_small_values() {
     ASSERT_TRUE(stats.bytes_processed == bytes);
     ASSERT_TRUE(stats.time_seconds == time);
     
-    // Should be clamped to exactly 60.0 
-    // Raw calculation: 1GB / (0.001s * 1e9) = 1000 GB/s -> clamped to 60.0
-    ASSERT_TRUE(stats.bandwidth_gbps == 60.0);
+    // 1GB / (0.001s * 1e9) = 1000 GB/s, reported unchanged
+    ASSERT_TRUE(std::abs(stats.bandwidth_gbps - 1000.0) < 1e-9);
     
     double expected_latency = (time * 1e9) / operations; // 1000000 ns
     ASSERT_TRUE(std::abs(stats.latency_ns - expected_latency) < 1e-10);
@@ -179,6 +187,27 @@ void test_pattern_name_consistency() {
     ASSERT_FALSE(matrix_multiply.empty());
 }
 
+void test_parse_stream_counts() {
+    StreamCounts counts = parse_stream_counts("8:2");
+    TestAssert::assert_equal_size_t(8, counts.reads);
+    TestAssert::assert_equal_size_t(2, counts.writes);
+    TestAssert::assert_equal_size_t(10, counts.arrays());
+    TestAssert::assert_equal(std::string("8R:2W"), stream_counts_to_string(counts));
+
+    TestAssert::assert_equal_size_t(0, parse_stream_counts("0:16").reads);
+    TestAssert::assert_equal_size_t(0, parse_stream_counts("12:0").writes);
+
+    for (const char* bad : {"8", "8:", ":2", "a:1", "17:0", "1:-1", "0:0"}) {
+        try {
+            parse_stream_counts(bad);
+            ASSERT_TRUE(false);  // Should throw
+        } catch (const ArgumentError& e) {
+            std::string error_msg = e.what();
+            ASSERT_TRUE(error_msg.find("Invalid stream count") != std::string::npos);
+        }
+    }
+}
+
 void test_performance_stats_structure() {
     // Test that PerformanceStats structure is properly initialized
     PerformanceStats stats = calculate_stats(1000, 1.0, 1000);
@@ -198,13 +227,14 @@ int main() {
     TEST_CASE("Calculate stats basic", test_calculate_stats_basic);
     TEST_CASE("Calculate stats zero time", test_calculate_stats_zero_time);
     TEST_CASE("Calculate stats zero operations", test_calculate_stats_zero_operations);
-    TEST_CASE("Calculate stats high bandwidth clamping", test_calculate_stats_high_bandwidth_clamping);
+    TEST_CASE("Calculate stats high bandwidth not clamped", test_calculate_stats_high_bandwidth_not_clamped);
     TEST_CASE("Calculate stats realistic bandwidth", test_calculate_stats_realistic_bandwidth);
     TEST_CASE("Calculate stats boundary bandwidth", test_calculate_stats_boundary_bandwidth);
     TEST_CASE("Calculate stats small values", test_calculate_stats_small_values);
     TEST_CASE("Calculate stats large operations", test_calculate_stats_large_operations);
     TEST_CASE("Calculate stats edge case negative time", test_calculate_stats_edge_case_negative_time);
     TEST_CASE("Pattern name consistency", test_pattern_name_consistency);
+    TEST_CASE("Parse stream counts", test_parse_stream_counts);
     TEST_CASE("Performance stats structure", test_performance_stats_structure);
     
     return framework.run_all();
@@ -0,0 +1,87 @@
+#include "test_framework.h"
+#include "../common/thread_scaling.h"
+#include "../common/errors.h"
+#include <string>
+#include <vector>
+
+using ThreadScaling::ScalingPoint;
+
+namespace {
+
+ScalingPoint point(size_t threads, double bandwidth_gbps) {
+    ScalingPoint p;
+    p.threads = threads;
+    p.bandwidth_gbps = bandwidth_gbps;
+    return p;
+}
+
+}  // namespace
+
+void test_parse_thread_counts() {
+    ASSERT_TRUE(ThreadScaling::parse_thread_counts("sweep", 1) == std::vector<size_t>({1}));
+    ASSERT_TRUE(ThreadScaling::parse_thread_counts("sweep", 16) == std::vector<size_t>({1, 2, 4, 8, 16}));
+    ASSERT_TRUE(ThreadScaling::parse_thread_counts("sweep", 24) == std::vector<size_t>({1, 2, 4, 8, 16, 24}));
+    ASSERT_TRUE(ThreadScaling::parse_thread_counts("8,1,4,4", 2) == std::vector<size_t>({1, 4, 8}));
+    ASSERT_TRUE(ThreadScaling::parse_thread_counts("1-3,6", 0) == std::vector<size_t>({1, 2, 3, 6}));
+
+    for (const char* bad : {"0,2", "2,x", ","}) {
+        try {
+            ThreadScaling::parse_thread_counts(bad, 4);
+            ASSERT_TRUE(false);  // Should throw
+        } catch (const ArgumentError& e) {
+            std::string error_msg = e.what();
+            ASSERT_TRUE(error_msg.find("Invalid thread counts") != std::string::npos);
+        }
+    }
+
+    ASSERT_TRUE(ThreadScaling::is_thread_sweep("sweep"));
+    ASSERT_TRUE(ThreadScaling::is_thread_sweep("1,2"));
+    ASSERT_FALSE(ThreadScaling::is_thread_sweep("8"));
+}
+
+void test_annotate() {
+    std::vector<ScalingPoint> points = {point(2, 10.0), point(4, 18.0), point(8, 20.0)};
+    ThreadScaling::annotate(points);
+    ASSERT_TRUE(points[0].speedup == 1.0 && points[0].efficiency == 1.0);
+    ASSERT_TRUE(points[1].speedup == 1.8 && points[1].efficiency == 0.9);
+    ASSERT_TRUE(points[2].speedup == 2.0 && points[2].efficiency == 0.5);
+}
+
+void test_saturation_index() {
+    // 19.0 is within 5% of the 20.0 peak, so 4 threads already saturate
+    std::vector<ScalingPoint> points = {point(1, 6.0), point(2, 12.0), point(4, 19.0), point(8, 20.0)};
+    TestAssert::assert_equal_size_t(2, ThreadScaling::saturation_index(points));
+
+    std::vector<ScalingPoint> linear = {point(1, 5.0), point(2, 10.0), point(4, 20.0)};
+    TestAssert::assert_equal_size_t(2, ThreadScaling::saturation_index(linear));
+
+    TestAssert::assert_equal_size_t(0, ThreadScaling::saturation_index({}));
+    std::vector<ScalingPoint> empty = {point(1, 0.0)};
+    TestAssert::assert_equal_size_t(1, ThreadScaling::saturation_index(empty));
+}
+
+void test_energy_optimal_index() {
+    std::vector<ScalingPoint> points = {point(1, 6.0), point(2, 12.0), point(4, 19.0), point(8, 20.0)};
+    TestAssert::assert_equal_size_t(4, ThreadScaling::energy_optimal_index(points));
+
+    // Power keeps rising past saturation, so energy per byte bottoms out before it
+    const double pj_per_byte[] = {900.0, 520.0, 480.0, 610.0};
+    for (size_t i = 0; i < points.size(); ++i) {
+        points[i].energy_measured = true;
+        points[i].pj_per_byte = pj_per_byte[i];
+    }
+    TestAssert::assert_equal_size_t(2, ThreadScaling::energy_optimal_index(points));
+    points[2].energy_measured = false;
+    TestAssert::assert_equal_size_t(1, ThreadScaling::energy_optimal_index(points));
+}
+
+int main() {
+    TestFramework framework;
+
+    TEST_CASE("Parse thread counts", test_parse_thread_counts);
+    TEST_CASE("Annotate speedup and efficiency", test_annotate);
+    TEST_CASE("Saturation index", test_saturation_index);
+    TEST_CASE("Energy optimal index", test_energy_optimal_index);
+
+    return framework.run_all();
+}
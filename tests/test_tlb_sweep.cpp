@@ -0,0 +1,115 @@
+#include "test_framework.h"
+#include "../common/tlb_sweep.h"
+#include "../common/constants.h"
+#include "../common/errors.h"
+#include "../common/pointer_chase.h"
+#include <cstdint>
+#include <set>
+#include <string>
+#include <vector>
+
+void test_parse_page_modes() {
+    std::vector<PageMode> modes = TlbSweep::parse_page_modes("1g,4k,2m,4k");
+    ASSERT_TRUE(modes == std::vector<PageMode>({PageMode::SMALL, PageMode::HUGE_2M, PageMode::HUGE_1G}));
+    TestAssert::assert_equal_size_t(2 * BenchmarkConstants::MB, TlbSweep::page_bytes(PageMode::THP));
+    TestAssert::assert_equal_size_t(BenchmarkConstants::GB, TlbSweep::page_bytes(PageMode::HUGE_1G));
+
+    for (const char* bad : {"4k,default", "4k,8m", ""}) {
+        try {
+            TlbSweep::parse_page_modes(bad);
+            ASSERT_TRUE(false);  // Should throw
+        } catch (const ArgumentError&) {
+            ASSERT_TRUE(true);
+        }
+    }
+}
+
+void test_page_counts() {
+    std::vector<size_t> counts = TlbSweep::page_counts(64);
+    TestAssert::assert_equal_size_t(BenchmarkConstants::TLB_MIN_PAGES, counts.front());
+    TestAssert::assert_equal_size_t(64, counts.back());
+    for (size_t i = 1; i < counts.size(); ++i) {
+        ASSERT_TRUE(counts[i] > counts[i - 1]);
+    }
+    ASSERT_TRUE(TlbSweep::page_counts(1).empty());
+}
+
+void test_chain_visits_one_line_per_page() {
+    const size_t stride = 4096;
+    const size_t pages = 100;
+    std::vector<uint8_t> storage(pages * stride + PointerChase::NODE_SIZE);
+    uint8_t* base = reinterpret_cast<uint8_t*>(
+        (reinterpret_cast<uintptr_t>(storage.data()) + PointerChase::NODE_SIZE - 1) & ~(PointerChase::NODE_SIZE - 1));
+
+    const void* start = TlbSweep::build_chain(base, pages, stride, 7);
+    ASSERT_TRUE(start != nullptr);
+    std::set<size_t> visited_pages;
+    std::set<size_t> lines;
+    const void* p = start;
+    for (size_t hop = 0; hop < pages; ++hop) {
+        size_t offset = static_cast<size_t>(static_cast<const uint8_t*>(p) - base);
+        visited_pages.insert(offset / stride);
+        lines.insert(offset % stride);
+        p = *static_cast<const void* const*>(p);
+    }
+    ASSERT_TRUE(p == start);  // A single cycle through every page
+    TestAssert::assert_equal_size_t(pages, visited_pages.size());
+    ASSERT_TRUE(lines.size() > stride / PointerChase::NODE_SIZE / 2);  // Spread over the lines of a page
+
+    ASSERT_TRUE(TlbSweep::build_chain(base, 1, stride, 7) == nullptr);
+}
+
+void test_detect_levels_names_knees() {
+    // Latency rises past 64 pages, then past 1024, over a flat baseline
+    std::vector<TlbSweep::Point> points;
+    for (size_t pages : TlbSweep::page_counts(8192)) {
+        TlbSweep::Point point;
+        point.pages = pages;
+        point.baseline_ns = 2.0;
+        point.latency_ns = pages <= 64 ? 2.0 : (pages <= 1024 ? 5.0 : 30.0);
+        points.push_back(point);
+    }
+    std::vector<TlbSweep::Level> levels = TlbSweep::detect_levels(points, 4096);
+    TestAssert::assert_equal_size_t(2, levels.size());
+    TestAssert::assert_equal(std::string("L1 dTLB"), levels[0].name);
+    TestAssert::assert_equal_size_t(64, levels[0].entries);
+    TestAssert::assert_equal_size_t(64 * 4096, levels[0].reach_bytes);
+    TestAssert::assert_equal(std::string("STLB"), levels[1].name);
+    TestAssert::assert_equal_size_t(1024, levels[1].entries);
+    ASSERT_TRUE(levels[1].before_ns == 5.0 && levels[1].after_ns == 30.0);
+}
+
+void test_run_sweeps_base_pages() {
+    size_t pinned = 0;
+    CoherenceTests::PinFunction pin = [&](size_t cpu) { pinned = cpu; };
+    size_t bytes = 64 * TlbSweep::page_bytes(PageMode::SMALL);
+    std::vector<TlbSweep::Curve> curves =
+        TlbSweep::run({PageMode::SMALL, PageMode::HUGE_1G}, bytes, 1, 3, pin);
+    TestAssert::assert_equal_size_t(3, pinned);
+    TestAssert::assert_equal_size_t(2, curves.size());
+
+    const TlbSweep::Curve& small = curves[0];
+    ASSERT_TRUE(small.available);
+    TestAssert::assert_equal_size_t(64, small.points.back().pages);
+    for (const auto& point : small.points) {
+        ASSERT_TRUE(point.latency_ns > 0.0);
+        ASSERT_TRUE(point.walk_ns >= 0.0);
+    }
+    ASSERT_FALSE(small.backing.empty());
+
+    // 256 KB holds no 1 GB page
+    ASSERT_FALSE(curves[1].available);
+    ASSERT_TRUE(curves[1].note.find("fewer than") != std::string::npos);
+}
+
+int main() {
+    TestFramework framework;
+
+    TEST_CASE("Parse page modes", test_parse_page_modes);
+    TEST_CASE("Page counts", test_page_counts);
+    TEST_CASE("Chain visits one line per page", test_chain_visits_one_line_per_page);
+    TEST_CASE("Detect levels names knees", test_detect_levels_names_knees);
+    TEST_CASE("Run sweeps base pages", test_run_sweeps_base_pages);
+
+    return framework.run_all();
+}
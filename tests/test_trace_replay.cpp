@@ -0,0 +1,253 @@
+#include "test_framework.h"
+#include "../common/trace_replay.h"
+#include "../common/constants.h"
+#include "../common/errors.h"
+#include <cstdio>
+#include <cstring>
+#include <fstream>
+#include <sstream>
+#include <string>
+#include <vector>
+#include <unistd.h>
+
+namespace {
+
+std::string temporary_path() {
+    char path_template[] = "/tmp/trace_XXXXXX";
+    int fd = mkstemp(path_template);
+    close(fd);
+    return path_template;
+}
+
+// Two and a half blocks of mixed reads and writes, forwards and backwards
+std::vector<TraceReplay::Access> mixed_accesses(uint64_t span) {
+    std::vector<TraceReplay::Access> accesses;
+    size_t count = BenchmarkConstants::TRACE_BLOCK_RECORDS * 5 / 2;
+    for (size_t i = 0; i < count; ++i) {
+        uint64_t offset = (i * 4099 + (i % 3) * 5) % (span - 64);
+        accesses.push_back({offset, static_cast<uint16_t>(1 + i % 40), i % 4 == 0});
+    }
+    return accesses;
+}
+
+template <typename Fn>
+void expect_configuration_error(Fn&& fn, const std::string& text) {
+    try {
+        fn();
+        ASSERT_TRUE(false);  // Should throw
+    } catch (const ConfigurationError& e) {
+        std::string error_msg = e.what();
+        ASSERT_TRUE(error_msg.find(text) != std::string::npos);
+    }
+}
+
+}  // namespace
+
+void test_round_trip() {
+    const uint64_t span = 1 << 20;
+    std::vector<TraceReplay::Access> accesses = mixed_accesses(span);
+    std::string path = temporary_path();
+    TraceReplay::write_trace(path, accesses, span);
+
+    TraceReplay::Trace trace(path);
+    const TraceReplay::Summary& summary = trace.summary();
+    TestAssert::assert_equal_size_t(accesses.size(), summary.records);
+    TestAssert::assert_equal_size_t(3, summary.blocks);
+    TestAssert::assert_equal_size_t(span, summary.span_bytes);
+    size_t writes = 0;
+    uint64_t bytes = 0;
+    for (const auto& access : accesses) {
+        writes += access.write ? 1 : 0;
+        bytes += access.size;
+    }
+    TestAssert::assert_equal_size_t(writes, summary.writes);
+    TestAssert::assert_equal_size_t(accesses.size() - writes, summary.reads);
+    TestAssert::assert_equal_size_t(bytes, summary.bytes());
+
+    // Every block decodes back to the absolute accesses, from its own base
+    TraceReplay::Workspace workspace;
+    for (size_t block = 0; block < summary.blocks; ++block) {
+        size_t first = block * BenchmarkConstants::TRACE_BLOCK_RECORDS;
+        size_t count = std::min(BenchmarkConstants::TRACE_BLOCK_RECORDS, accesses.size() - first);
+        TraceReplay::decode_block(trace.records() + first, count, trace.block_base(block), workspace);
+        for (size_t i = 0; i < count; ++i) {
+            ASSERT_TRUE(workspace.offsets[i] == accesses[first + i].offset);
+            ASSERT_TRUE(workspace.sizes[i] == accesses[first + i].size);
+            ASSERT_TRUE((workspace.writes[i] == 1) == accesses[first + i].write);
+        }
+    }
+    std::remove(path.c_str());
+}
+
+void test_invalid_traces() {
+    std::string path = temporary_path();
+    expect_configuration_error([&]() { TraceReplay::Trace trace(path); }, "shorter than the trace header");
+
+    std::ofstream(path, std::ios::binary) << std::string(64, 'x');
+    expect_configuration_error([&]() { TraceReplay::Trace trace(path); }, "bad magic");
+
+    // A record beyond the declared span is caught on open, with its index
+    TraceReplay::FileHeader header = {};
+    std::memcpy(header.magic, "MBTRACE", 8);
+    header.version = BenchmarkConstants::TRACE_VERSION;
+    header.record_count = 2;
+    header.span_bytes = 4096;
+    TraceReplay::Record records[2] = {{0, 8, 0, 0}, {4092, 8, 1, 0}};
+    {
+        std::ofstream out(path, std::ios::binary);
+        out.write(reinterpret_cast<const char*>(&header), sizeof(header));
+        out.write(reinterpret_cast<const char*>(records), sizeof(records));
+    }
+    expect_configuration_error([&]() { TraceReplay::Trace trace(path); }, "Record 1");
+
+    header.record_count = 3;
+    {
+        std::ofstream out(path, std::ios::binary);
+        out.write(reinterpret_cast<const char*>(&header), sizeof(header));
+        out.write(reinterpret_cast<const char*>(records), sizeof(records));
+    }
+    expect_configuration_error([&]() { TraceReplay::Trace trace(path); }, "truncated");
+
+    // Jumps wider than the 32-bit delta and accesses outside the span cannot be encoded
+    const uint64_t far = 3ULL << 30;
+    expect_configuration_error([&]() { TraceReplay::write_trace(path, {{0, 8, false}, {far, 8, false}}, far + 8); },
+                               "2 GiB");
+    expect_configuration_error([&]() { TraceReplay::write_trace(path, {{4090, 8, false}}, 4096); },
+                               "leaves the 4096-byte span");
+    std::remove(path.c_str());
+}
+
+void test_block_slice() {
+    size_t next = 0;
+    for (size_t i = 0; i < 3; ++i) {
+        auto slice = TraceReplay::block_slice(i, 3, 8);
+        TestAssert::assert_equal_size_t(next, slice.first);
+        ASSERT_TRUE(slice.second - slice.first == (i < 2 ? 3u : 2u));
+        next = slice.second;
+    }
+    TestAssert::assert_equal_size_t(8, next);
+}
+
+void test_replay() {
+    // Writes land on the covering words; reads and writes count their record bytes
+    const uint64_t span = 8192;
+    std::vector<TraceReplay::Access> accesses = {{100, 16, true}, {4, 8, true}, {200, 3, false}, {8000, 24, false}};
+    std::string path = temporary_path();
+    TraceReplay::write_trace(path, accesses, span);
+    TraceReplay::Trace trace(path);
+
+    std::vector<uint64_t> words(span / sizeof(uint64_t), 0);
+    uint8_t* buffer = reinterpret_cast<uint8_t*>(words.data());
+    TraceReplay::Workspace workspace;
+    std::atomic<bool> stop_flag(false);
+    PerformanceStats stats = TraceReplay::replay(trace, 0, 1, buffer, 3, workspace, stop_flag);
+    TestAssert::assert_equal_size_t((16 + 8 + 3 + 24) * 3, stats.bytes_processed);
+    ASSERT_TRUE(stats.time_seconds > 0.0);
+
+    uint64_t last_pass = BenchmarkConstants::TEST_PATTERN_BASE + 2;
+    ASSERT_TRUE(words[12] == last_pass && words[13] == last_pass && words[14] == last_pass);  // 100..115
+    ASSERT_TRUE(words[0] == last_pass && words[1] == last_pass);                              // 4..11
+    ASSERT_TRUE(words[11] == 0 && words[15] == 0);
+
+    ASSERT_TRUE(TraceReplay::decode_only(trace, 0, 1, 3, workspace) >= 0.0);
+    TestAssert::assert_equal_size_t(0, TraceReplay::replay(trace, 1, 1, buffer, 3, workspace,
+                                                           stop_flag).bytes_processed);
+    std::remove(path.c_str());
+}
+
+void test_perf_script() {
+    std::istringstream in("# perf script -F event,addr\n"
+                          "  cpu/mem-loads,ldlat=30/P:     7f3a5c0012a8\n"
+                          "  cpu/mem-stores/P:             7f3a5c0012b0\n"
+                          "  cpu/mem-loads,ldlat=30/P:     55d0c1234010\n"
+                          "  cpu/mem-loads,ldlat=30/P:     not-an-address\n"
+                          "  cpu/mem-loads,ldlat=30/P:                0\n");
+    TraceReplay::ConvertStats stats;
+    std::vector<TraceReplay::Access> accesses = TraceReplay::parse_perf_script(in, stats);
+    TestAssert::assert_equal_size_t(3, accesses.size());
+    TestAssert::assert_equal_size_t(2, stats.skipped);
+    ASSERT_FALSE(accesses[0].write);
+    ASSERT_TRUE(accesses[1].write);
+    ASSERT_TRUE(accesses[0].size == BenchmarkConstants::TRACE_SAMPLE_ACCESS_BYTES);
+
+    // The two pages are renumbered 1 (the 0x7f... page) and 0 (the heap page), keeping in-page offsets
+    size_t pages = 0;
+    uint64_t span = TraceReplay::compact_pages(accesses, pages);
+    TestAssert::assert_equal_size_t(2, pages);
+    TestAssert::assert_equal_size_t(8192, span);
+    TestAssert::assert_equal_size_t(4096 + 0x2a8, accesses[0].offset);
+    TestAssert::assert_equal_size_t(4096 + 0x2b0, accesses[1].offset);
+    TestAssert::assert_equal_size_t(0x010, accesses[2].offset);
+}
+
+void test_histogram() {
+    const std::string text = "0x1000 3\n"
+                             "0x1040 2 w 64\n"
+                             "0x2000 1 x\n"      // Unknown operation
+                             "0x3000 0\n";       // No accesses
+    std::istringstream in(text);
+    TraceReplay::ConvertStats stats;
+    std::vector<TraceReplay::Access> accesses = TraceReplay::parse_histogram(in, stats);
+    TestAssert::assert_equal_size_t(5, accesses.size());
+    TestAssert::assert_equal_size_t(2, stats.skipped);
+    size_t writes = 0;
+    for (const auto& access : accesses) {
+        writes += access.write ? 1 : 0;
+        ASSERT_TRUE(access.size == (access.write ? 64 : 8));
+    }
+    TestAssert::assert_equal_size_t(2, writes);
+
+    // The expansion order is shuffled, but the same on every conversion
+    std::istringstream again(text);
+    TraceReplay::ConvertStats again_stats;
+    std::vector<TraceReplay::Access> repeated = TraceReplay::parse_histogram(again, again_stats);
+    for (size_t i = 0; i < accesses.size(); ++i) {
+        ASSERT_TRUE(repeated[i].offset == accesses[i].offset && repeated[i].write == accesses[i].write);
+    }
+
+    std::istringstream huge("0x1000 999999999999\n");
+    expect_configuration_error([&]() { TraceReplay::parse_histogram(huge, stats); }, "scale the counts down");
+}
+
+void test_convert() {
+    std::string source_path = temporary_path();
+    std::string trace_path = temporary_path();
+    std::ofstream(source_path) << "cpu/mem-loads/P: 7ffd00001000\ncpu/mem-stores/P: 7ffd00003008\n";
+
+    TraceReplay::ConvertStats stats = TraceReplay::convert(TraceReplay::parse_source("perf:" + source_path),
+                                                           trace_path);
+    TestAssert::assert_equal_size_t(2, stats.summary.records);
+    TestAssert::assert_equal_size_t(1, stats.summary.writes);
+    TestAssert::assert_equal_size_t(2, stats.pages);
+
+    TraceReplay::Trace trace(trace_path);
+    TestAssert::assert_equal_size_t(2, trace.summary().records);
+    TestAssert::assert_equal_size_t(8192, trace.summary().span_bytes);
+
+    std::ofstream(source_path) << "# nothing sampled\n";
+    expect_configuration_error([&]() { TraceReplay::convert(TraceReplay::parse_source("histogram:" + source_path),
+                                                            trace_path); },
+                               "holds no addresses");
+    try {
+        TraceReplay::parse_source("perf:");
+        ASSERT_TRUE(false);  // Should throw
+    } catch (const ArgumentError&) {
+        ASSERT_TRUE(true);
+    }
+    std::remove(source_path.c_str());
+    std::remove(trace_path.c_str());
+}
+
+int main() {
+    TestFramework framework;
+
+    TEST_CASE("Round trip", test_round_trip);
+    TEST_CASE("Invalid traces", test_invalid_traces);
+    TEST_CASE("Block slice", test_block_slice);
+    TEST_CASE("Replay", test_replay);
+    TEST_CASE("perf script", test_perf_script);
+    TEST_CASE("Histogram", test_histogram);
+    TEST_CASE("Convert", test_convert);
+
+    return framework.run_all();
+}
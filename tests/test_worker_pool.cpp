@@ -0,0 +1,132 @@
+#include "test_framework.h"
+#include "../common/worker_pool.h"
+#include <atomic>
+#include <chrono>
+#include <cmath>
+#include <mutex>
+#include <stdexcept>
+#include <thread>
+#include <vector>
+
+void test_runs_every_thread_once() {
+    WorkerPool pool;
+    std::vector<std::atomic<int>> calls(4);
+    for (auto& count : calls) {
+        count = 0;
+    }
+
+    std::vector<ThreadTiming> timings = pool.run(4, [&](size_t thread_id) { ++calls[thread_id]; });
+
+    TestAssert::assert_equal_size_t(4, timings.size());
+    for (const auto& count : calls) {
+        ASSERT_TRUE(count == 1);
+    }
+    for (const auto& timing : timings) {
+        ASSERT_TRUE(timing.end >= timing.start);
+    }
+}
+
+void test_workers_are_reused() {
+    WorkerPool pool;
+    std::mutex mutex;
+    std::vector<std::thread::id> first(3), second(3);
+
+    pool.run(3, [&](size_t thread_id) {
+        std::lock_guard<std::mutex> lock(mutex);
+        first[thread_id] = std::this_thread::get_id();
+    });
+    // A smaller run uses a subset of the same workers
+    pool.run(2, [&](size_t thread_id) {
+        std::lock_guard<std::mutex> lock(mutex);
+        second[thread_id] = std::this_thread::get_id();
+    });
+
+    TestAssert::assert_equal_size_t(3, pool.size());
+    ASSERT_TRUE(first[0] == second[0]);
+    ASSERT_TRUE(first[1] == second[1]);
+    ASSERT_TRUE(first[0] != std::this_thread::get_id());
+}
+
+void test_pool_grows() {
+    WorkerPool pool;
+    std::atomic<size_t> total{0};
+    pool.run(1, [&](size_t) { ++total; });
+    pool.run(5, [&](size_t) { ++total; });
+    TestAssert::assert_equal_size_t(5, pool.size());
+    TestAssert::assert_equal_size_t(6, total.load());
+}
+
+void test_task_exception_is_rethrown() {
+    WorkerPool pool;
+    bool caught = false;
+    try {
+        pool.run(2, [](size_t thread_id) {
+            if (thread_id == 1) {
+                throw std::runtime_error("worker failure");
+            }
+        });
+    } catch (const std::runtime_error&) {
+        caught = true;
+    }
+    ASSERT_TRUE(caught);
+
+    // The pool stays usable after a failed run
+    std::atomic<size_t> total{0};
+    pool.run(2, [&](size_t) { ++total; });
+    TestAssert::assert_equal_size_t(2, total.load());
+}
+
+void test_spin_barrier_reuse() {
+    SpinBarrier barrier(3);
+    std::atomic<size_t> phase_one{0};
+    bool ordered = true;
+    std::mutex mutex;
+
+    auto participant = [&]() {
+        for (int round = 0; round < 100; ++round) {
+            ++phase_one;
+            barrier.arrive_and_wait();
+            // Every participant arrived before anyone passed the barrier
+            if (phase_one.load() < static_cast<size_t>(3 * (round + 1))) {
+                std::lock_guard<std::mutex> lock(mutex);
+                ordered = false;
+            }
+            barrier.arrive_and_wait();
+        }
+    };
+
+    std::thread a(participant), b(participant);
+    participant();
+    a.join();
+    b.join();
+    ASSERT_TRUE(ordered);
+}
+
+void test_overlap_and_span() {
+    using clock = std::chrono::high_resolution_clock;
+    clock::time_point t0 = clock::now();
+    auto at_ms = [t0](int ms) { return t0 + std::chrono::milliseconds(ms); };
+
+    // Thread 0 runs 0-10 ms, thread 1 runs 2-8 ms: overlap 6 ms, span 10 ms
+    std::vector<ThreadTiming> timings = {{at_ms(0), at_ms(10)}, {at_ms(2), at_ms(8)}};
+    ASSERT_TRUE(std::abs(WorkerPool::overlap_seconds(timings) - 0.006) < 1e-9);
+    ASSERT_TRUE(std::abs(WorkerPool::span_seconds(timings) - 0.010) < 1e-9);
+
+    // Disjoint intervals have no overlap
+    std::vector<ThreadTiming> disjoint = {{at_ms(0), at_ms(1)}, {at_ms(2), at_ms(3)}};
+    ASSERT_TRUE(WorkerPool::overlap_seconds(disjoint) == 0.0);
+    ASSERT_TRUE(WorkerPool::overlap_seconds({}) == 0.0);
+}
+
+int main() {
+    TestFramework framework;
+
+    TEST_CASE("Runs every thread once", test_runs_every_thread_once);
+    TEST_CASE("Workers are reused", test_workers_are_reused);
+    TEST_CASE("Pool grows", test_pool_grows);
+    TEST_CASE("Task exception is rethrown", test_task_exception_is_rethrown);
+    TEST_CASE("Spin barrier reuse", test_spin_barrier_reuse);
+    TEST_CASE("Overlap and span", test_overlap_and_span);
+
+    return framework.run_all();
+}
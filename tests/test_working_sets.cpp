@@ -1,6 +1,7 @@
 #include "test_framework.h"
 #include "../common/working_sets.h"
 #include "../common/constants.h"
+#include "../common/errors.h"
 
 using namespace BenchmarkConstants;
 
@@ -266,6 +267,84 @@ void test_working_set_ordering() {
     }
 }
 
+void test_thread_aware_sizes_shared_caches() {
+    // Two CCXs of four cores with SMT siblings 8-15, each CCX with its own 32MB L3
+    CacheInfo cache = {};
+    cache.l1_data_size = 32768;
+    cache.l2_size = 1048576;
+    cache.l3_size = 33554432;
+    for (size_t core = 0; core < 8; ++core) {
+        cache.l1d_sharing.push_back({core, core + 8});
+        cache.l2_sharing.push_back({core, core + 8});
+    }
+    cache.l3_sharing = {{0, 1, 2, 3, 8, 9, 10, 11}, {4, 5, 6, 7, 12, 13, 14, 15}};
+
+    // Eight threads filling one CCX with its siblings: L3 split eight ways, L1 and L2 two ways
+    std::vector<size_t> compact = {0, 1, 2, 3, 8, 9, 10, 11};
+    auto [sizes, descriptions] = WorkingSetSizes::get_thread_aware_sizes(cache, 8, compact);
+    for (size_t i = 0; i < descriptions.size(); ++i) {
+        if (descriptions[i] == "SLC per thread") {
+            TestAssert::assert_equal_size_t(cache.l3_size / 8, sizes[i]);
+        } else if (descriptions[i] == "L2 per thread") {
+            TestAssert::assert_equal_size_t(cache.l2_size / 2, sizes[i]);
+        } else if (descriptions[i] == "L1 per thread") {
+            TestAssert::assert_equal_size_t(cache.l1_data_size / 2, sizes[i]);
+        }
+    }
+
+    // One thread per core over both CCXs: every core keeps its L1 and L2, each L3 is split four ways
+    std::vector<size_t> spread = {0, 4, 1, 5, 2, 6, 3, 7};
+    auto [spread_sizes, spread_descriptions] = WorkingSetSizes::get_thread_aware_sizes(cache, 8, spread);
+    for (size_t i = 0; i < spread_descriptions.size(); ++i) {
+        if (spread_descriptions[i] == "SLC per thread") {
+            TestAssert::assert_equal_size_t(cache.l3_size / 4, spread_sizes[i]);
+        } else if (spread_descriptions[i] == "L2 per thread") {
+            TestAssert::assert_equal_size_t(cache.l2_size, spread_sizes[i]);
+        }
+    }
+
+    // Unknown sharing falls back to private L1/L2 and one L3 for all threads
+    TestAssert::assert_equal_size_t(8, WorkingSetSizes::threads_per_instance({}, compact, 8));
+    TestAssert::assert_equal_size_t(1, WorkingSetSizes::threads_per_instance(cache.l3_sharing, {}, 0));
+    TestAssert::assert_equal_size_t(4, WorkingSetSizes::threads_per_instance(cache.l3_sharing, spread, 8));
+}
+
+void test_sweep_sizes() {
+    std::vector<size_t> sizes = WorkingSetSizes::get_sweep_sizes(64 * 1024, 2);
+
+    // 4KB to 64KB is four octaves: 2 steps each plus the end point
+    TestAssert::assert_equal_size_t(9, sizes.size());
+    TestAssert::assert_equal_size_t(4096, sizes.front());
+    TestAssert::assert_equal_size_t(5760, sizes[1]);  // 4096 * sqrt(2), rounded down to a cache line
+    TestAssert::assert_equal_size_t(8192, sizes[2]);
+    TestAssert::assert_equal_size_t(64 * 1024, sizes.back());
+    for (size_t i = 1; i < sizes.size(); ++i) {
+        ASSERT_TRUE(sizes[i] > sizes[i - 1]);
+        ASSERT_TRUE(sizes[i] % 64 == 0);
+    }
+
+    // Dense ladders never repeat a size
+    std::vector<size_t> dense = WorkingSetSizes::get_sweep_sizes(8192, 32);
+    TestAssert::assert_equal_size_t(33, dense.size());
+    ASSERT_TRUE(WorkingSetSizes::get_sweep_sizes(2048, 4).empty());
+}
+
+void test_parse_sweep() {
+    TestAssert::assert_equal_size_t(4, WorkingSetSizes::parse_sweep("log2:4"));
+    TestAssert::assert_equal_size_t(1, WorkingSetSizes::parse_sweep("log2:1"));
+
+    const char* invalid[] = {"log2:0", "log2:33", "log2:", "log2:4x", "linear:4", ""};
+    for (const char* spec : invalid) {
+        bool threw = false;
+        try {
+            WorkingSetSizes::parse_sweep(spec);
+        } catch (const ArgumentError&) {
+            threw = true;
+        }
+        ASSERT_TRUE(threw);
+    }
+}
+
 int main() {
     TestFramework framework;
     
@@ -275,12 +354,15 @@ int main() {
     TEST_CASE("Get thread aware sizes single thread", test_get_thread_aware_sizes_single_thread);
     TEST_CASE("Get thread aware sizes multi thread", test_get_thread_aware_sizes_multi_thread);
     TEST_CASE("Get thread aware sizes filtering", test_get_thread_aware_sizes_filtering);
+    TEST_CASE("Thread aware sizes with shared caches", test_thread_aware_sizes_shared_caches);
     TEST_CASE("Thread aware beyond cache sizes", test_thread_aware_beyond_cache_sizes);
     TEST_CASE("Working set fractions", test_working_set_fractions);
     TEST_CASE("Edge cases zero cache", test_edge_cases_zero_cache);
     TEST_CASE("Edge cases huge cache", test_edge_cases_huge_cache);
     TEST_CASE("Consistency between constructors", test_consistency_between_constructors);
     TEST_CASE("Working set ordering", test_working_set_ordering);
+    TEST_CASE("Sweep sizes", test_sweep_sizes);
+    TEST_CASE("Parse sweep", test_parse_sweep);
     
     return framework.run_all();
 }
\ No newline at end of file